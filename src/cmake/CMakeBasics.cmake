@@ -127,6 +127,23 @@ else()
     message(STATUS "Building without coverage flags (ENABLE_COVERAGE == OFF)")
 endif()
 
+################################
+# Thread Sanitizer Flags
+################################
+# Used to check the concurrent read tests (for example
+# t_conduit_node_freeze) for data races.
+# Note: OpenMP runtimes are usually not instrumented, so OpenMP builds
+# may report false positives.
+if(ENABLE_TSAN)
+    message(STATUS "Building using thread sanitizer flags (ENABLE_TSAN == ON)")
+    set(CMAKE_C_FLAGS   "${CMAKE_C_FLAGS} -fsanitize=thread -fno-omit-frame-pointer")
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fsanitize=thread -fno-omit-frame-pointer")
+    set(CMAKE_EXE_LINKER_FLAGS    "${CMAKE_EXE_LINKER_FLAGS} -fsanitize=thread")
+    set(CMAKE_SHARED_LINKER_FLAGS "${CMAKE_SHARED_LINKER_FLAGS} -fsanitize=thread")
+else()
+    message(STATUS "Building without thread sanitizer flags (ENABLE_TSAN == OFF)")
+endif()
+
 
 ################################
 # Standard CTest Options
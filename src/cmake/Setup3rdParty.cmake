@@ -16,11 +16,10 @@
 # Threads support
 ################################
 if(UNIX AND NOT APPLE)
-    if(ENABLE_RELAY_WEBSERVER)
-        # on some linux platforms we need to explicitly link threading
-        # options.
-        find_package( Threads REQUIRED )
-    endif()
+    # on some linux platforms we need to explicitly link threading
+    # options. conduit uses threads for batch parsing and the
+    # relay web server uses them for civetweb.
+    find_package( Threads REQUIRED )
 endif()
 
 
@@ -158,6 +157,18 @@ if(H5ZZFP_DIR)
     endif()
 endif()
 
+################################
+# Setup Caliper if available
+################################
+if(CALIPER_DIR)
+    include(cmake/thirdparty/SetupCaliper.cmake)
+    include_directories(${CALIPER_INCLUDE_DIR})
+    # if we don't find Caliper, throw a fatal error
+    if(NOT CALIPER_FOUND)
+        message(FATAL_ERROR "CALIPER_DIR is set, but Caliper wasn't found.")
+    endif()
+endif()
+
 ################################
 # Setup Parmetis if available
 ################################
@@ -20,6 +20,26 @@ if(ENABLE_FORTRAN)
                     OUTPUT_VARIABLE OUTPUT)
 
         set(ENABLE_FORTRAN_OBJ_INTERFACE ${Fortran_COMPILER_SUPPORTS_CLASS})
+
+        # the assumed-rank (C descriptor) interface needs fortran 2018
+        # type(*), dimension(..) support and the compiler's
+        # ISO_Fortran_binding.h header
+        try_compile(Fortran_COMPILER_SUPPORTS_ASSUMED_RANK ${CMAKE_BINARY_DIR}
+                    ${CMAKE_SOURCE_DIR}/cmake/tests/fortran_test_assumed_rank_support.f90
+                    CMAKE_FLAGS "-DCMAKE_Fortran_FORMAT=FREE"
+                    OUTPUT_VARIABLE OUTPUT)
+
+        include(CheckIncludeFileCXX)
+        check_include_file_cxx(ISO_Fortran_binding.h
+                               CONDUIT_HAS_ISO_FORTRAN_BINDING_H)
+
+        if(Fortran_COMPILER_SUPPORTS_ASSUMED_RANK AND
+           CONDUIT_HAS_ISO_FORTRAN_BINDING_H)
+            set(ENABLE_FORTRAN_CDESC_INTERFACE ON)
+        else()
+            set(ENABLE_FORTRAN_CDESC_INTERFACE OFF)
+        endif()
+        MESSAGE(STATUS "Fortran assumed-rank interface: ${ENABLE_FORTRAN_CDESC_INTERFACE}")
         
     elseif(CMAKE_GENERATOR STREQUAL Xcode)
         MESSAGE(STATUS "Disabling Fortran support: ENABLE_FORTRAN is true, "
@@ -0,0 +1,49 @@
+! Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+! Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+! other details. No copyright assignment is required to contribute to Conduit.
+
+
+!------------------------------------------------------------------------------
+! fortran_test_assumed_rank_support.f
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+! Basic check for fortran compiler support of assumed-type, assumed-rank
+! (type(*), dimension(..)) arguments to bind(C) procedures
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+module f_assumed_rank_test
+    !--------------------------------------------------------------------------
+    interface
+    !--------------------------------------------------------------------------
+    subroutine c_go(data) bind(C, name="c_go")
+        implicit none
+        type(*), dimension(..), intent(IN) :: data
+    end subroutine c_go
+    !--------------------------------------------------------------------------
+    end interface
+    !--------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+contains
+
+    !--------------------------------------------------------------------------
+    function arr_rank(data) result(v)
+        implicit none
+        type(*), dimension(..), intent(IN) :: data
+        integer(4) :: v
+        v = rank(data)
+    end function arr_rank
+
+end module
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+program test
+    use f_assumed_rank_test
+    real(8), dimension(4,2) :: a
+    integer(4)::v
+    v = arr_rank(a(1:4:2,:))
+    print *, "Test:", v
+end program test
@@ -0,0 +1,47 @@
+# Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+# Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+# other details. No copyright assignment is required to contribute to Conduit.
+###############################################################################
+#
+# Setup Caliper
+# This file defines:
+#  CALIPER_FOUND - If Caliper was found
+#  CALIPER_INCLUDE_DIR - The Caliper include directories
+#  CALIPER_LIB - Caliper library
+
+
+# first Check for CALIPER_DIR
+
+if(NOT CALIPER_DIR)
+    MESSAGE(FATAL_ERROR "Caliper support needs explicit CALIPER_DIR")
+endif()
+
+find_path(CALIPER_INCLUDE_DIR caliper/cali.h
+          PATHS ${CALIPER_DIR}/include
+          NO_DEFAULT_PATH
+          NO_CMAKE_ENVIRONMENT_PATH
+          NO_CMAKE_PATH
+          NO_SYSTEM_ENVIRONMENT_PATH
+          NO_CMAKE_SYSTEM_PATH)
+
+find_library(CALIPER_LIB NAMES caliper
+             PATHS ${CALIPER_DIR}/lib64 ${CALIPER_DIR}/lib
+             NO_DEFAULT_PATH
+             NO_CMAKE_ENVIRONMENT_PATH
+             NO_CMAKE_PATH
+             NO_SYSTEM_ENVIRONMENT_PATH
+             NO_CMAKE_SYSTEM_PATH)
+
+include(FindPackageHandleStandardArgs)
+# handle the QUIETLY and REQUIRED arguments and set CALIPER_FOUND to TRUE
+# if all listed variables are TRUE
+find_package_handle_standard_args(Caliper  DEFAULT_MSG
+                                  CALIPER_LIB CALIPER_INCLUDE_DIR)
+
+mark_as_advanced(CALIPER_INCLUDE_DIR
+                 CALIPER_LIB)
+
+
+blt_register_library(NAME caliper
+                     INCLUDES ${CALIPER_INCLUDE_DIR}
+                     LIBRARIES ${CALIPER_LIB} )
@@ -26,6 +26,10 @@ endif()
 if(ZLIB_DIR)
     set(ZLIB_ROOT ${ZLIB_DIR})
     find_package(ZLIB REQUIRED)
+else()
+    # relay also uses zlib directly (to compress hdf5 chunks on threads)
+    # when it's available
+    find_package(ZLIB QUIET)
 endif()
 
 # find the absolute path w/ symlinks resolved of the passed HDF5_DIR, 
@@ -342,3 +346,14 @@ else()
                          LIBRARIES ${HDF5_LIBRARIES}
                          LINK_FLAGS ${hdf5_tpl_lnk_flags})
 endif()
+
+#
+# register zlib for relay's threaded gzip chunk filtering
+#
+if(ZLIB_FOUND)
+    message(STATUS "ZLIB Include Dirs: ${ZLIB_INCLUDE_DIRS}")
+    message(STATUS "ZLIB Libraries:    ${ZLIB_LIBRARIES}")
+    blt_register_library(NAME zlib
+                         INCLUDES  ${ZLIB_INCLUDE_DIRS}
+                         LIBRARIES ${ZLIB_LIBRARIES})
+endif()
@@ -26,13 +26,21 @@ endif()
 # Setup Threads
 ###############################################################################
 if(UNIX AND NOT APPLE)
-    # if built web server support, we depend on Threads::Threads
-    # in our exported targets so we need to bootstrap that here
-    if(EXISTS ${_IMPORT_ROOT}/include/conduit/conduit_relay_web.hpp)
+    # we depend on Threads::Threads in our exported targets
+    # so we need to bootstrap that here
+    if(NOT TARGET Threads::Threads)
+        find_package( Threads REQUIRED )
+    endif()
+endif()
 
-        if(NOT TARGET Threads::Threads)
-            find_package( Threads REQUIRED )
-        endif()
+###############################################################################
+# Setup OpenMP
+###############################################################################
+if(CONDUIT_USE_OPENMP)
+    # static builds of conduit carry OpenMP::OpenMP_CXX in their
+    # exported link interface
+    if(NOT TARGET OpenMP::OpenMP_CXX)
+        find_dependency(OpenMP)
     endif()
 endif()
 
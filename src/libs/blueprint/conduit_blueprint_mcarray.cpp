@@ -12,15 +12,19 @@
 // conduit includes
 //-----------------------------------------------------------------------------
 #include "conduit_blueprint_mcarray.hpp"
+#include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_log.hpp"
 
 //-----------------------------------------------------------------------------
 // -- standard cpp lib includes -- 
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <cstring>
 #include <map>
 #include <set>
 #include <limits>
+#include <thread>
+#include <vector>
 
 using namespace conduit;
 // Easier access to the Conduit logging functions
@@ -141,15 +145,445 @@ bool verify(const conduit::Node &n,
 
 
 //-----------------------------------------------------------------------------
-bool
-to_contiguous(const conduit::Node &src,
-              conduit::Node &dest)
+// -- begin conduit::blueprint::mcarray::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// the fewest tuples handed to each thread by the transpose kernels
+static const index_t MIN_CHUNK_TUPLES = 65536;
+// tuples per cache block in the kernels for an arbitrary number of
+// components
+static const index_t BLOCK_TUPLES = 256;
+
+//-----------------------------------------------------------------------------
+// Element 0 and byte stride of each component of an mcarray whose
+// components have the same number of elements and the same element size.
+//-----------------------------------------------------------------------------
+template <typename BytePtr>
+struct ComponentLayout
+{
+    index_t num_tuples;
+    index_t elem_bytes;
+    std::vector<BytePtr> ptrs;
+    std::vector<index_t> strides;
+
+    index_t num_comps() const { return (index_t)ptrs.size(); }
+
+    // true when the components are packed tuple by tuple from ptrs[0]
+    bool is_packed_interleaved() const
+    {
+        const index_t nc = num_comps();
+        for(index_t c = 0; c < nc; c++)
+        {
+            if(ptrs[c] != ptrs[0] + c * elem_bytes ||
+               strides[c] != nc * elem_bytes)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // true when the components are packed one after another from ptrs[0]
+    bool is_packed_contiguous() const
+    {
+        const index_t nc = num_comps();
+        for(index_t c = 0; c < nc; c++)
+        {
+            if(ptrs[c] != ptrs[0] + c * num_tuples * elem_bytes ||
+               strides[c] != elem_bytes)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Fills 'layout' from the children of 'n', returns false if they don't
+// share an element size the kernels support.
+//-----------------------------------------------------------------------------
+template <typename NodeT, typename BytePtr>
+static bool
+read_layout(NodeT &n, ComponentLayout<BytePtr> &layout)
+{
+    layout.num_tuples = 0;
+    layout.elem_bytes = 0;
+    layout.ptrs.clear();
+    layout.strides.clear();
+
+    const index_t nc = n.number_of_children();
+    for(index_t c = 0; c < nc; c++)
+    {
+        NodeT &comp = n.child(c);
+        const DataType &dt = comp.dtype();
+        if(!dt.is_number() ||
+           dt.element_bytes() != DataType::default_dtype(dt.id()).element_bytes())
+        {
+            return false;
+        }
+
+        if(c == 0)
+        {
+            layout.num_tuples = dt.number_of_elements();
+            layout.elem_bytes = dt.element_bytes();
+        }
+        else if(dt.number_of_elements() != layout.num_tuples ||
+                dt.element_bytes() != layout.elem_bytes)
+        {
+            return false;
+        }
+
+        layout.ptrs.push_back((BytePtr)comp.element_ptr(0));
+        layout.strides.push_back(dt.stride());
+    }
+
+    return nc > 0 && (layout.elem_bytes == 1 || layout.elem_bytes == 2 ||
+                      layout.elem_bytes == 4 || layout.elem_bytes == 8);
+}
+
+//-----------------------------------------------------------------------------
+// Transpose kernels over tuples [begin, end). T is an unsigned integer as
+// wide as the elements, NC the number of components (0 when only known at
+// runtime). The fixed NC kernels copy a whole tuple per iteration, which the
+// compiler turns into vector loads and shuffles; the runtime NC kernels
+// walk a block of tuples one component at a time so the block stays in
+// cache.
+//-----------------------------------------------------------------------------
+template <typename T, int NC>
+struct Transpose
+{
+    static void interleave(const T *const *src, index_t nc, T *dst,
+                           index_t begin, index_t end)
+    {
+        const T *s[NC];
+        for(int c = 0; c < NC; c++)
+        {
+            s[c] = src[c];
+        }
+        (void)nc;
+        for(index_t t = begin; t < end; t++)
+        {
+            for(int c = 0; c < NC; c++)
+            {
+                dst[t * NC + c] = s[c][t];
+            }
+        }
+    }
+
+    static void deinterleave(const T *src, index_t nc, T *const *dst,
+                             index_t begin, index_t end)
+    {
+        T *d[NC];
+        for(int c = 0; c < NC; c++)
+        {
+            d[c] = dst[c];
+        }
+        (void)nc;
+        for(index_t t = begin; t < end; t++)
+        {
+            for(int c = 0; c < NC; c++)
+            {
+                d[c][t] = src[t * NC + c];
+            }
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+template <typename T>
+struct Transpose<T, 0>
+{
+    static void interleave(const T *const *src, index_t nc, T *dst,
+                           index_t begin, index_t end)
+    {
+        for(index_t b = begin; b < end; b += BLOCK_TUPLES)
+        {
+            const index_t e = std::min(end, b + BLOCK_TUPLES);
+            for(index_t c = 0; c < nc; c++)
+            {
+                const T *s = src[c];
+                for(index_t t = b; t < e; t++)
+                {
+                    dst[t * nc + c] = s[t];
+                }
+            }
+        }
+    }
+
+    static void deinterleave(const T *src, index_t nc, T *const *dst,
+                             index_t begin, index_t end)
+    {
+        for(index_t b = begin; b < end; b += BLOCK_TUPLES)
+        {
+            const index_t e = std::min(end, b + BLOCK_TUPLES);
+            for(index_t c = 0; c < nc; c++)
+            {
+                T *d = dst[c];
+                for(index_t t = b; t < e; t++)
+                {
+                    d[t] = src[t * nc + c];
+                }
+            }
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Copies tuples [begin, end) of one component between arbitrary strides.
+//-----------------------------------------------------------------------------
+template <typename T>
+static void
+copy_strided(const uint8 *src, index_t src_stride,
+             uint8 *dst, index_t dst_stride,
+             index_t begin, index_t end)
+{
+    if(src_stride == (index_t)sizeof(T) && dst_stride == (index_t)sizeof(T))
+    {
+        std::memcpy(dst + begin * sizeof(T), src + begin * sizeof(T),
+                    (size_t)(end - begin) * sizeof(T));
+        return;
+    }
+
+    for(index_t t = begin; t < end; t++)
+    {
+        std::memcpy(dst + t * dst_stride, src + t * src_stride, sizeof(T));
+    }
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+static bool
+is_aligned(const uint8 *ptr, index_t stride)
+{
+    return ((size_t)ptr) % sizeof(T) == 0 && stride % (index_t)sizeof(T) == 0;
+}
+
+//-----------------------------------------------------------------------------
+template <typename T, int NC>
+static void
+copy_components_range(const ComponentLayout<const uint8*> &src,
+                      const ComponentLayout<uint8*> &dst,
+                      int mode,
+                      index_t begin, index_t end)
+{
+    const index_t nc = src.num_comps();
+    if(mode == 1)
+    {
+        std::vector<const T*> s((size_t)nc);
+        for(index_t c = 0; c < nc; c++)
+        {
+            s[c] = (const T*)src.ptrs[c];
+        }
+        Transpose<T,NC>::interleave(&s[0], nc, (T*)dst.ptrs[0], begin, end);
+    }
+    else if(mode == 2)
+    {
+        std::vector<T*> d((size_t)nc);
+        for(index_t c = 0; c < nc; c++)
+        {
+            d[c] = (T*)dst.ptrs[c];
+        }
+        Transpose<T,NC>::deinterleave((const T*)src.ptrs[0], nc, &d[0], begin, end);
+    }
+    else
+    {
+        for(index_t c = 0; c < nc; c++)
+        {
+            copy_strided<T>(src.ptrs[c], src.strides[c],
+                            dst.ptrs[c], dst.strides[c],
+                            begin, end);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+static void
+copy_components(const ComponentLayout<const uint8*> &src,
+                const ComponentLayout<uint8*> &dst,
+                index_t num_threads)
+{
+    const index_t nc = src.num_comps();
+
+    // mode 1: unit stride components into packed tuples
+    // mode 2: packed tuples into unit stride components
+    // mode 0: anything else, one strided copy per component
+    int mode = 0;
+    bool src_unit = true;
+    bool dst_unit = true;
+    bool aligned = true;
+    for(index_t c = 0; c < nc; c++)
+    {
+        src_unit = src_unit && src.strides[c] == (index_t)sizeof(T);
+        dst_unit = dst_unit && dst.strides[c] == (index_t)sizeof(T);
+        aligned = aligned && is_aligned<T>(src.ptrs[c], src.strides[c]) &&
+                             is_aligned<T>(dst.ptrs[c], dst.strides[c]);
+    }
+    if(aligned && nc > 1 && src_unit && dst.is_packed_interleaved())
+    {
+        mode = 1;
+    }
+    else if(aligned && nc > 1 && dst_unit && src.is_packed_interleaved())
+    {
+        mode = 2;
+    }
+
+    const index_t num_tuples = src.num_tuples;
+    mesh::utils::detail::parallel_chunks(
+        mesh::utils::detail::parallel_num_chunks(num_threads, num_tuples,
+                                                 MIN_CHUNK_TUPLES),
+        num_tuples,
+        [&](index_t, index_t begin, index_t end)
+        {
+            switch(mode == 0 ? 0 : nc)
+            {
+                case 2: copy_components_range<T,2>(src, dst, mode, begin, end); break;
+                case 3: copy_components_range<T,3>(src, dst, mode, begin, end); break;
+                case 4: copy_components_range<T,4>(src, dst, mode, begin, end); break;
+                default: copy_components_range<T,0>(src, dst, mode, begin, end); break;
+            }
+        });
+}
+
+//-----------------------------------------------------------------------------
+// Copies the components of 'src' into the (already allocated) components of
+// 'dest', returns false when the kernels don't support the components.
+//-----------------------------------------------------------------------------
+static bool
+copy_components(const Node &src, Node &dest, index_t num_threads)
+{
+    ComponentLayout<const uint8*> src_layout;
+    ComponentLayout<uint8*> dst_layout;
+    if(!read_layout(src, src_layout) || !read_layout(dest, dst_layout))
+    {
+        return false;
+    }
+
+    switch(src_layout.elem_bytes)
+    {
+        case 1: copy_components<uint8>(src_layout, dst_layout, num_threads); break;
+        case 2: copy_components<uint16>(src_layout, dst_layout, num_threads); break;
+        case 4: copy_components<uint32>(src_layout, dst_layout, num_threads); break;
+        default: copy_components<uint64>(src_layout, dst_layout, num_threads); break;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Transposes the row major 'num_rows' x 'num_cols' matrix of elements at
+// 'data' in place by following the cycles of the permutation; 'visited'
+// costs one bit per element.
+//-----------------------------------------------------------------------------
+template <typename T>
+static void
+transpose_in_place(uint8 *data, index_t num_rows, index_t num_cols)
+{
+    const uint64 num_elems = (uint64)num_rows * (uint64)num_cols;
+    if(num_rows <= 1 || num_cols <= 1)
+    {
+        return;
+    }
+
+    // element p of the source lands at p * num_rows mod (num_elems - 1);
+    // the first and last elements stay put
+    const uint64 modulus = num_elems - 1;
+    std::vector<bool> visited((size_t)num_elems, false);
+    for(uint64 start = 1; start < modulus; start++)
+    {
+        if(visited[start])
+        {
+            continue;
+        }
+
+        T carry;
+        std::memcpy(&carry, data + start * sizeof(T), sizeof(T));
+        uint64 p = start;
+        do
+        {
+            p = (p * (uint64)num_rows) % modulus;
+            T tmp;
+            std::memcpy(&tmp, data + p * sizeof(T), sizeof(T));
+            std::memcpy(data + p * sizeof(T), &carry, sizeof(T));
+            carry = tmp;
+            visited[p] = true;
+        } while(p != start);
+    }
+}
+
+//-----------------------------------------------------------------------------
+static bool
+transpose_in_place(Node &n, bool interleave)
+{
+    ComponentLayout<uint8*> layout;
+    if(!read_layout(n, layout))
+    {
+        return false;
+    }
+
+    const index_t nc = layout.num_comps();
+    const index_t nt = layout.num_tuples;
+    const index_t eb = layout.elem_bytes;
+    const bool packed_interleaved = layout.is_packed_interleaved();
+    const bool packed_contiguous = layout.is_packed_contiguous();
+
+    // the block has to belong to views, so re-pointing the components
+    // can't release it
+    for(index_t c = 0; c < nc; c++)
+    {
+        if(!n.child(c).is_data_external())
+        {
+            return false;
+        }
+    }
+
+    uint8 *base = layout.ptrs[0];
+    if(interleave && packed_contiguous && !packed_interleaved)
+    {
+        switch(eb)
+        {
+            case 1: transpose_in_place<uint8>(base, nc, nt); break;
+            case 2: transpose_in_place<uint16>(base, nc, nt); break;
+            case 4: transpose_in_place<uint32>(base, nc, nt); break;
+            default: transpose_in_place<uint64>(base, nc, nt); break;
+        }
+    }
+    else if(!interleave && packed_interleaved && !packed_contiguous)
+    {
+        switch(eb)
+        {
+            case 1: transpose_in_place<uint8>(base, nt, nc); break;
+            case 2: transpose_in_place<uint16>(base, nt, nc); break;
+            case 4: transpose_in_place<uint32>(base, nt, nc); break;
+            default: transpose_in_place<uint64>(base, nt, nc); break;
+        }
+    }
+    else if(!(interleave ? packed_interleaved : packed_contiguous))
+    {
+        return false;
+    }
+
+    for(index_t c = 0; c < nc; c++)
+    {
+        Node &comp = n.child(c);
+        DataType dt = comp.dtype();
+        dt.set_offset(interleave ? c * eb : c * nt * eb);
+        dt.set_stride(interleave ? nc * eb : eb);
+        comp.set_external(dt, base);
+    }
+    n.invalidate_hash();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+static void
+contiguous_schema(const Node &src, Schema &s_dest)
 {
     // goal is to setup dest with children with the same names as src
     // that point into the desired layout
-    //index_t num_dest_elems = src.child(0).number_of_elements() * num_comps;
-    
-    Schema s_dest;
     NodeConstIterator itr = src.children();
     
     index_t curr_offset = 0;
@@ -178,27 +612,14 @@ to_contiguous(const conduit::Node &src,
         // update the offset for the next component
         curr_offset += elem_bytes * curr_dt.number_of_elements();
     }
-    
-    // allocate using our schema
-    dest.set(s_dest);
-    // copy the data from the source
-    dest.update(src);
-    
-    return true; // we always work!
 }
 
-
-
 //-----------------------------------------------------------------------------
-bool
-to_interleaved(const conduit::Node &src,
-               conduit::Node &dest)
+static void
+interleaved_schema(const Node &src, Schema &s_dest)
 {
     // goal is to setup dest with children with the same names as src
     // that point into the desired layout
-    
-    Schema s_dest;
-    
     NodeConstIterator itr = src.children();
     index_t stride = 0;
     index_t curr_offset = 0;
@@ -237,15 +658,99 @@ to_interleaved(const conduit::Node &src,
         // update the offset for the next component
         curr_offset += elem_bytes;
     }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mcarray::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+bool
+to_contiguous(const conduit::Node &src,
+              conduit::Node &dest)
+{
+    return to_contiguous(src, dest, Node());
+}
+
+//-----------------------------------------------------------------------------
+bool
+to_contiguous(const conduit::Node &src,
+              conduit::Node &dest,
+              const conduit::Node &options)
+{
+    Schema s_dest;
+    detail::contiguous_schema(src, s_dest);
 
     // allocate using our schema
     dest.set(s_dest);
     // copy the data from the source
-    dest.update(src);
+    const index_t num_threads =
+        mesh::utils::detail::num_threads_option(options);
+    if(!detail::copy_components(src, dest, num_threads))
+    {
+        dest.update(src);
+    }
     
     return true; // we always work!
 }
 
+//-----------------------------------------------------------------------------
+bool
+to_interleaved(const conduit::Node &src,
+               conduit::Node &dest)
+{
+    return to_interleaved(src, dest, Node());
+}
+
+//-----------------------------------------------------------------------------
+bool
+to_interleaved(const conduit::Node &src,
+               conduit::Node &dest,
+               const conduit::Node &options)
+{
+    Schema s_dest;
+    detail::interleaved_schema(src, s_dest);
+
+    // allocate using our schema
+    dest.set(s_dest);
+    // copy the data from the source
+    const index_t num_threads =
+        mesh::utils::detail::num_threads_option(options);
+    if(!detail::copy_components(src, dest, num_threads))
+    {
+        dest.update(src);
+    }
+    
+    return true; // we always work!
+}
+
+//-----------------------------------------------------------------------------
+bool
+to_contiguous_in_place(conduit::Node &n)
+{
+    if(!detail::transpose_in_place(n, false))
+    {
+        Node res;
+        to_contiguous(n, res);
+        n.swap(res);
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+to_interleaved_in_place(conduit::Node &n)
+{
+    if(!detail::transpose_in_place(n, true))
+    {
+        Node res;
+        to_interleaved(n, res);
+        n.swap(res);
+    }
+    return true;
+}
+
 
 
 //----------------------------------------------------------------------------
@@ -68,6 +68,36 @@ bool CONDUIT_BLUEPRINT_API to_contiguous(const conduit::Node &src,
 bool CONDUIT_BLUEPRINT_API to_interleaved(const conduit::Node &src,
                                           conduit::Node &dest);
 
+//-----------------------------------------------------------------------------
+/// The options variants accept "num_threads", the number of threads the
+/// copy is split over once there are enough tuples (default 1, <= 0 uses
+/// the hardware concurrency).
+///
+/// When all components have the same element size (1, 2, 4 or 8 bytes)
+/// the data is moved by transpose kernels specialized for 2, 3 and 4
+/// components instead of per component Node updates.
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API to_contiguous(const conduit::Node &src,
+                                         conduit::Node &dest,
+                                         const conduit::Node &options);
+
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API to_interleaved(const conduit::Node &src,
+                                          conduit::Node &dest,
+                                          const conduit::Node &options);
+
+//-----------------------------------------------------------------------------
+/// In place variants: when the components of 'n' share an element size and
+/// are views that exactly fill one interleaved or contiguous block, the
+/// block is transposed where it is and the components are re-pointed into
+/// it, so no second copy of the data is allocated. Otherwise 'n' is
+/// replaced by the result of the copying transform.
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API to_contiguous_in_place(conduit::Node &n);
+
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API to_interleaved_in_place(conduit::Node &n);
+
 
 //-----------------------------------------------------------------------------
 }
@@ -23,19 +23,27 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <set>
 #include <iterator>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // conduit includes
 //-----------------------------------------------------------------------------
 #include "conduit_blueprint_mcarray.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
+#include "conduit_blueprint_zfparray.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
+#include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
+#include "conduit_blueprint_mesh_execution.hpp"
 #include "conduit_blueprint_mesh_partition.hpp"
 #include "conduit_blueprint_mesh_flatten.hpp"
 #include "conduit_blueprint_mesh.hpp"
+#include "conduit_blueprint_table.hpp"
 #include "conduit_log.hpp"
 
 using namespace conduit;
@@ -45,6 +53,8 @@ using namespace conduit::utils;
 using ::conduit::utils::join_path;
 // access conduit blueprint mesh utilities
 namespace bputils = conduit::blueprint::mesh::utils;
+// access conduit blueprint mesh execution backends
+namespace bpexec = conduit::blueprint::mesh::execution;
 typedef bputils::ShapeType ShapeType;
 typedef bputils::ShapeCascade ShapeCascade;
 typedef bputils::TopologyMetadata TopologyMetadata;
@@ -139,8 +149,8 @@ std::vector<index_t> intersect_sets(const std::set<index_t> &s1,
 }
 
 //-----------------------------------------------------------------------------
-std::vector<index_t> intersect_sets(const std::vector<index_t> &v1,
-                                    const std::vector<index_t> &v2)
+std::vector<index_t> intersect_sets(const Span<const index_t> &v1,
+                                    const Span<const index_t> &v2)
 {
     std::vector<index_t> res;
     for(index_t i1 = 0; i1 < (index_t)v1.size(); i1++)
@@ -177,6 +187,29 @@ std::vector<index_t> subtract_sets(const std::vector<index_t> &v1,
     return std::vector<index_t>(std::move(res));
 }
 
+//-----------------------------------------------------------------------------
+// reads a thread count (such as the one used to build 'TopologyMetadata')
+// from the 'num_threads' option
+using bputils::detail::num_threads_option;
+
+//-----------------------------------------------------------------------------
+// fills the 'TopologyMetadata' options that build only the given dimension
+// and its GLOBAL associations with the topology's elements
+void topology_metadata_dim_options(const conduit::Node &options,
+                                   const conduit::Node &topo,
+                                   index_t dim,
+                                   conduit::Node &md_options)
+{
+    const index_t topo_dim = bputils::ShapeType(topo).dim;
+    const index_t assocs[4] = {topo_dim, dim, dim, topo_dim};
+
+    md_options.reset();
+    md_options["num_threads"].set(num_threads_option(options));
+    md_options["dims"].set(dim);
+    md_options["associations"].set(assocs, 4);
+    md_options["local"].set(0);
+}
+
 //-----------------------------------------------------------------------------
 // - end internal potpourri functions -
 //-----------------------------------------------------------------------------
@@ -361,6 +394,46 @@ bool verify_mcarray_field(const std::string &protocol,
 }
 
 
+//-----------------------------------------------------------------------------
+// zfp compressed values (see relay::io::wrap_zfparray) are recognized by
+// their header and compressed data children.
+bool is_zfparray_field(const conduit::Node &node)
+{
+    return node.dtype().is_object() &&
+           node.has_child(blueprint::zfparray::ZFP_HEADER_FIELD_NAME) &&
+           node.has_child(blueprint::zfparray::ZFP_COMPRESSED_DATA_FIELD_NAME);
+}
+
+
+//-----------------------------------------------------------------------------
+bool verify_zfparray_field(const std::string &protocol,
+                           const conduit::Node &node,
+                           conduit::Node &info,
+                           const std::string &field_name)
+{
+    Node &field_info = info[field_name];
+
+    bool res = verify_field_exists(protocol, node, info, field_name);
+    if(res)
+    {
+        const Node &field_node = node[field_name];
+        res = blueprint::zfparray::verify(field_node,field_info);
+        if(res)
+        {
+            log::info(info, protocol, log::quote(field_name) + "is a zfparray");
+        }
+        else
+        {
+            log::error(info, protocol, log::quote(field_name) + "is not a zfparray");
+        }
+    }
+
+    log::validation(field_info, res);
+
+    return res;
+}
+
+
 //-----------------------------------------------------------------------------
 bool verify_mlarray_field(const std::string &protocol,
                           const conduit::Node &node,
@@ -498,7 +571,10 @@ bool verify_reference_field(const std::string &protocol,
     return res;
 }
 
-bool verify_shapes_node(const Node &node, const Node &shape_map, Node &info)
+bool verify_shapes_node(const Node &node,
+                        const Node &shape_map,
+                        Node &info,
+                        bool shallow)
 {
   const std::string protocol = "mesh::topology::unstructured";
   bool res = true;
@@ -512,7 +588,8 @@ bool verify_shapes_node(const Node &node, const Node &shape_map, Node &info)
     range.emplace_back(child.to_int32());
   }
 
-  for(index_t i = 0; i < shapes.number_of_elements(); ++i)
+  // the shallow level skips this per element check
+  for(index_t i = 0; i < (shallow ? 0 : shapes.number_of_elements()); ++i)
   {
     const int32 shape = shapes[i];
     const bool expectedShape = std::find(range.begin(), range.end(), shape) != range.end();
@@ -537,7 +614,10 @@ bool verify_shapes_node(const Node &node, const Node &shape_map, Node &info)
   return res;
 }
 
-bool verify_mixed_elements_node(const Node& topo_elems, Node &info_elems, bool& elems_res)
+bool verify_mixed_elements_node(const Node& topo_elems,
+                                Node &info_elems,
+                                bool& elems_res,
+                                bool shallow)
 {
   const std::string protocol = "mesh::topology::unstructured";
   elems_res &= verify_field_exists(protocol, topo_elems, info_elems, "shape") &&
@@ -547,18 +627,22 @@ bool verify_mixed_elements_node(const Node& topo_elems, Node &info_elems, bool&
       conduit::blueprint::mesh::topology::shape_map::verify(topo_elems["shape_map"], info_elems["shape_map"]);
 
   elems_res &= verify_field_exists(protocol, topo_elems, info_elems, "shapes") &&
-      verify_shapes_node(topo_elems["shapes"], topo_elems["shape_map"], info_elems["shapes"]);
+      verify_shapes_node(topo_elems["shapes"], topo_elems["shape_map"], info_elems["shapes"], shallow);
 
   return elems_res;
 }
 
-bool verify_mixed_node(const Node &topo, Node &info, bool& elems_res, bool& subelems_res)
+bool verify_mixed_node(const Node &topo,
+                       Node &info,
+                       bool& elems_res,
+                       bool& subelems_res,
+                       bool shallow)
 {
     const std::string protocol = "mesh::topology::unstructured";
     const Node& topo_elems = topo["elements"];
     Node& info_elems = info["elements"];
 
-    elems_res &= verify_mixed_elements_node(topo_elems, info_elems, elems_res);
+    elems_res &= verify_mixed_elements_node(topo_elems, info_elems, elems_res, shallow);
     elems_res &= verify_o2mrelation_field(protocol, topo, info, "elements");
 
     // if polyhedra in mixed definition, the polyhedra have their faces in subelements
@@ -567,7 +651,7 @@ bool verify_mixed_node(const Node &topo, Node &info, bool& elems_res, bool& sube
         const Node& topo_subelems = topo["subelements"];
         Node& info_subelems = info["subelements"];
 
-        subelems_res &= verify_mixed_elements_node(topo_subelems, info_subelems, subelems_res);
+        subelems_res &= verify_mixed_elements_node(topo_subelems, info_subelems, subelems_res, shallow);
         subelems_res &= verify_o2mrelation_field(protocol, topo, info, "subelements");
     }
     return elems_res && subelems_res;
@@ -649,10 +733,157 @@ bool verify_poly_node(bool is_mixed_topo,
 }
 
 
+//-----------------------------------------------------------------------------
+// the shallow level skips the checks that scan array values
+bool
+verify_unstructured_topology(const Node &topo,
+                             Node &info,
+                             bool shallow)
+{
+    const std::string protocol = "mesh::topology::unstructured";
+    bool res = true;
+    info.reset();
+
+    res &= verify_string_field(protocol, topo, info, "coordset");
+
+    res &= verify_enum_field(protocol, topo, info, "type",
+        std::vector<std::string>(1, "unstructured"));
+
+    if(!verify_object_field(protocol, topo, info, "elements"))
+    {
+        res = false;
+    }
+    else
+    {
+        const Node &topo_elems = topo["elements"];
+        Node &info_elems = info["elements"];
+
+        bool elems_res = true;
+        bool subelems_res = true;
+
+        // single shape or mixed definition case
+        if(topo_elems.has_child("shape"))
+        {
+            elems_res &= verify_field_exists(protocol, topo_elems, info_elems, "shape") &&
+                   blueprint::mesh::topology::shape::verify(topo_elems["shape"], info_elems["shape"]);
+            elems_res &= verify_integer_field(protocol, topo_elems, info_elems, "connectivity");
+
+            if (topo_elems["shape"].dtype().is_string() &&
+                topo_elems["shape"].as_string() == "mixed")
+            {
+              elems_res &= verify_mixed_node(topo, info, elems_res, subelems_res, shallow);
+            }
+            else
+            {
+              // Verify if node is polygonal or polyhedral
+              elems_res &= verify_poly_node(false, "", topo_elems, info_elems, topo, info, elems_res);
+            }
+        }
+        // shape stream case
+        else if(topo_elems.has_child("element_types"))
+        {
+            // TODO
+        }
+        // mixed shape case
+        else if(topo_elems.number_of_children() != 0)
+        {
+            bool has_names = topo_elems.dtype().is_object();
+
+            NodeConstIterator itr = topo_elems.children();
+            while(itr.has_next())
+            {
+                const Node &chld  = itr.next();
+                std::string name = itr.name();
+                Node &chld_info = has_names ? info["elements"][name] :
+                    info["elements"].append();
+
+                bool chld_res = true;
+                chld_res &= verify_field_exists(protocol, chld, chld_info, "shape") &&
+                       blueprint::mesh::topology::shape::verify(chld["shape"], chld_info["shape"]);
+                chld_res &= verify_integer_field(protocol, chld, chld_info, "connectivity");
+
+                // Verify if child is polygonal or polyhedral
+                chld_res &= verify_poly_node (true, name, chld, chld_info, topo, info, elems_res);
+
+                log::validation(chld_info,chld_res);
+                elems_res &= chld_res;
+            }
+        }
+        else
+        {
+            log::error(info,protocol,"invalid child 'elements'");
+            res = false;
+        }
+
+        log::validation(info_elems,elems_res);
+        res &= elems_res;
+        res &= subelems_res;
+    }
+
+    log::validation(info,res);
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+bool
+verify_topology(const Node &topo,
+                Node &info,
+                bool shallow)
+{
+    const std::string protocol = "mesh::topology";
+    bool res = true;
+    info.reset();
+
+    if(!(verify_field_exists(protocol, topo, info, "type") &&
+         blueprint::mesh::topology::type::verify(topo["type"], info["type"])))
+    {
+        res = false;
+    }
+    else
+    {
+        const std::string topo_type = topo["type"].as_string();
+
+        if(topo_type == "points")
+        {
+            res &= blueprint::mesh::topology::points::verify(topo,info);
+        }
+        else if(topo_type == "uniform")
+        {
+            res &= blueprint::mesh::topology::uniform::verify(topo,info);
+        }
+        else if(topo_type == "rectilinear")
+        {
+            res &= blueprint::mesh::topology::rectilinear::verify(topo,info);
+        }
+        else if(topo_type == "structured")
+        {
+            res &= blueprint::mesh::topology::structured::verify(topo,info);
+        }
+        else if(topo_type == "unstructured")
+        {
+            res &= verify_unstructured_topology(topo,info,shallow);
+        }
+    }
+
+    if(topo.has_child("grid_function"))
+    {
+        log::optional(info, protocol, "includes grid_function");
+        res &= verify_string_field(protocol, topo, info, "grid_function");
+    }
+
+    log::validation(info,res);
+
+    return res;
+
+}
+
 //-----------------------------------------------------------------------------
 bool
 verify_single_domain(const Node &n,
-                     Node &info)
+                     Node &info,
+                     bool shallow,
+                     index_t num_threads)
 {
     const std::string protocol = "mesh";
     bool res = true;
@@ -692,7 +923,7 @@ verify_single_domain(const Node &n,
             const std::string chld_name = itr.name();
             Node &chld_info = info["topologies"][chld_name];
 
-            topo_res &= blueprint::mesh::topology::verify(chld, chld_info);
+            topo_res &= verify_topology(chld, chld_info, shallow);
             topo_res &= verify_reference_field(protocol, n, info,
                 chld, chld_info, "coordset", "coordsets");
         }
@@ -764,15 +995,35 @@ verify_single_domain(const Node &n,
         }
         else
         {
+            // NOTE: fields are verified into separate info nodes (on up to
+            // 'num_threads' threads), which are added in field order before
+            // their references are checked
+            const Node &fields = n["fields"];
+            const index_t num_fields = fields.number_of_children();
+            std::vector<Node> fields_info((size_t)num_fields);
+            std::vector<int> fields_res((size_t)num_fields);
+            bputils::detail::parallel_chunks(
+                bputils::detail::parallel_num_chunks(num_threads, num_fields, 1),
+                num_fields,
+                [&] (index_t /*ci*/, index_t fbegin, index_t fend)
+            {
+                for(index_t fi = fbegin; fi < fend; fi++)
+                {
+                    fields_res[fi] = blueprint::mesh::field::verify(
+                        fields.child(fi), fields_info[fi]) ? 1 : 0;
+                }
+            });
+
             bool field_res = true;
-            NodeConstIterator itr = n["fields"].children();
-            while(itr.has_next())
+            NodeConstIterator itr = fields.children();
+            for(index_t fi = 0; itr.has_next(); fi++)
             {
                 const Node &chld = itr.next();
                 const std::string chld_name = itr.name();
                 Node &chld_info = info["fields"][chld_name];
 
-                field_res &= blueprint::mesh::field::verify(chld, chld_info);
+                chld_info.swap(fields_info[fi]);
+                field_res &= fields_res[fi] != 0;
                 if(chld.has_child("topology"))
                 {
                     field_res &= verify_reference_field(protocol, n, info,
@@ -877,7 +1128,9 @@ verify_single_domain(const Node &n,
 //-------------------------------------------------------------------------
 bool
 verify_multi_domain(const Node &n,
-                    Node &info)
+                    Node &info,
+                    bool shallow,
+                    index_t num_threads)
 {
     const std::string protocol = "mesh";
     bool res = true;
@@ -896,12 +1149,32 @@ verify_multi_domain(const Node &n,
         }
         else
         {
+            // NOTE: domains are verified into separate info nodes (on up to
+            // 'num_threads' threads, which are split among the domains),
+            // which are added in domain order
+            const index_t num_doms = n.number_of_children();
+            const index_t dom_chunks =
+                bputils::detail::parallel_num_chunks(num_threads, num_doms, 1);
+            const index_t dom_threads = std::max((index_t)1, num_threads / dom_chunks);
+            std::vector<Node> doms_info((size_t)num_doms);
+            std::vector<int> doms_res((size_t)num_doms);
+            bputils::detail::parallel_chunks(dom_chunks, num_doms,
+                [&] (index_t /*ci*/, index_t dbegin, index_t dend)
+            {
+                for(index_t di = dbegin; di < dend; di++)
+                {
+                    doms_res[di] = verify_single_domain(n.child(di), doms_info[di],
+                        shallow, dom_threads) ? 1 : 0;
+                }
+            });
+
             NodeConstIterator itr = n.children();
-            while(itr.has_next())
+            for(index_t di = 0; itr.has_next(); di++)
             {
-                const Node &chld = itr.next();
+                itr.next();
                 const std::string chld_name = itr.name();
-                res &= verify_single_domain(chld, info[chld_name]);
+                info[chld_name].swap(doms_info[di]);
+                res &= doms_res[di] != 0;
             }
         }
 
@@ -913,6 +1186,69 @@ verify_multi_domain(const Node &n,
     return res;
 }
 
+//-----------------------------------------------------------------------------
+// results of 'mesh::verify' calls made with the 'cache' option, keyed by the
+// verified node and level (shallow or not) and stamped with the content hash
+// of the node
+struct VerifyCacheEntry
+{
+    uint64 stamp;
+    bool   res;
+    Node   info;
+};
+
+typedef std::pair<const Node*, bool> VerifyCacheKey;
+
+static const size_t VERIFY_CACHE_MAX_ENTRIES = 64;
+static std::mutex verify_cache_mutex;
+static std::map<VerifyCacheKey, VerifyCacheEntry> verify_cache;
+// insertion order of the cache keys, the oldest entry is evicted first
+static std::deque<VerifyCacheKey> verify_cache_keys;
+
+//-----------------------------------------------------------------------------
+bool
+verify_cache_find(const VerifyCacheKey &key,
+                  uint64 stamp,
+                  Node &info,
+                  bool &res)
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    std::map<VerifyCacheKey, VerifyCacheEntry>::const_iterator itr =
+        verify_cache.find(key);
+    if(itr == verify_cache.end() || itr->second.stamp != stamp)
+    {
+        return false;
+    }
+
+    info.set(itr->second.info);
+    res = itr->second.res;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+verify_cache_store(const VerifyCacheKey &key,
+                   uint64 stamp,
+                   const Node &info,
+                   bool res)
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    if(verify_cache.find(key) == verify_cache.end())
+    {
+        if(verify_cache_keys.size() >= VERIFY_CACHE_MAX_ENTRIES)
+        {
+            verify_cache.erase(verify_cache_keys.front());
+            verify_cache_keys.pop_front();
+        }
+        verify_cache_keys.push_back(key);
+    }
+
+    VerifyCacheEntry &entry = verify_cache[key];
+    entry.stamp = stamp;
+    entry.res = res;
+    entry.info.set(info);
+}
+
 //-----------------------------------------------------------------------------
 // - end internal data function helpers -
 //-----------------------------------------------------------------------------
@@ -1158,21 +1494,102 @@ convert_topology_to_structured(const std::string &base_type,
     }
 }
 
+//-------------------------------------------------------------------------
+// Writes the connectivity of a lattice of line/quad/hex elements with
+// edims elements per axis. The vertex at logical (i,j,k) is
+// voffset + i*vstrides[0] + j*vstrides[1] + k*vstrides[2]. Element rows
+// (along i) are written by each thread in contiguous blocks, in the
+// default blueprint vertex order.
+template <typename T>
+void
+emit_lattice_connectivity(index_t ndims,
+                          const index_t edims[3],
+                          const index_t vstrides[3],
+                          index_t voffset,
+                          index_t num_threads,
+                          T *conn)
+{
+    const index_t sx = vstrides[0], sy = vstrides[1], sz = vstrides[2];
+    const index_t indices_per_elem = (index_t)1 << ndims;
+    const index_t row_elems = edims[0];
+    const index_t num_rows = edims[1] * edims[2];
+    const index_t min_chunk_rows =
+        std::max((index_t)1, (index_t)4096 / std::max((index_t)1, row_elems));
+
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_rows, min_chunk_rows),
+        num_rows,
+        [&] (index_t /*ci*/, index_t rbegin, index_t rend)
+    {
+        for(index_t r = rbegin; r < rend; r++)
+        {
+            const index_t row_base = voffset +
+                (r % edims[1]) * sy + (r / edims[1]) * sz;
+            T *out = conn + r * row_elems * indices_per_elem;
+
+            if(ndims == 3)
+            {
+                for(index_t i = 0; i < row_elems; i++, out += 8)
+                {
+                    const index_t v = row_base + i * sx;
+                    out[0] = (T)(v);
+                    out[1] = (T)(v + sx);
+                    out[2] = (T)(v + sx + sy);
+                    out[3] = (T)(v + sy);
+                    out[4] = (T)(v + sz);
+                    out[5] = (T)(v + sx + sz);
+                    out[6] = (T)(v + sx + sy + sz);
+                    out[7] = (T)(v + sy + sz);
+                }
+            }
+            else if(ndims == 2)
+            {
+                for(index_t i = 0; i < row_elems; i++, out += 4)
+                {
+                    const index_t v = row_base + i * sx;
+                    out[0] = (T)(v);
+                    out[1] = (T)(v + sx);
+                    out[2] = (T)(v + sx + sy);
+                    out[3] = (T)(v + sy);
+                }
+            }
+            else
+            {
+                for(index_t i = 0; i < row_elems; i++, out += 2)
+                {
+                    const index_t v = row_base + i * sx;
+                    out[0] = (T)(v);
+                    out[1] = (T)(v + sx);
+                }
+            }
+        }
+    });
+}
+
 //-------------------------------------------------------------------------
 void
 convert_topology_to_unstructured(const std::string &base_type,
                                  const conduit::Node &topo,
                                  conduit::Node &dest,
-                                 conduit::Node &cdest)
+                                 conduit::Node &cdest,
+                                 const conduit::Node &options)
 {
     bool is_base_structured = base_type == "structured";
     bool is_base_rectilinear = base_type == "rectilinear";
     bool is_base_uniform = base_type == "uniform";
 
+    const Node *coordset = bputils::find_reference_node(topo, "coordset");
+    if(bpexec::select_backend(topo, *coordset) != bpexec::BACKEND_HOST)
+    {
+        Node host;
+        const Node &host_topo = bpexec::to_host_topology(topo, host);
+        convert_topology_to_unstructured(base_type, host_topo, dest, cdest,
+                                         options);
+        return;
+    }
+
     dest.reset();
     cdest.reset();
-
-    const Node *coordset = bputils::find_reference_node(topo, "coordset");
     if(is_base_structured)
     {
         cdest.set(*coordset);
@@ -1198,17 +1615,18 @@ convert_topology_to_unstructured(const std::string &base_type,
     DataType int_dtype = bputils::find_widest_dtype(topo, bputils::DEFAULT_INT_DTYPES);
 
     const std::vector<std::string> csys_axes = bputils::coordset::axes(*coordset);
+    const index_t ndims = (index_t)csys_axes.size();
     dest["elements/shape"].set(
-        (csys_axes.size() == 1) ? "line" : (
-        (csys_axes.size() == 2) ? "quad" : (
-        (csys_axes.size() == 3) ? "hex"  : "")));
+        (ndims == 1) ? "line" : (
+        (ndims == 2) ? "quad" : (
+        (ndims == 3) ? "hex"  : "")));
     const std::vector<std::string> &logical_axes = bputils::LOGICAL_AXES;
 
     index_t edims_axes[3] = {1, 1, 1};
     if(is_base_structured)
     {
         const conduit::Node &dim_node = topo["elements/dims"];
-        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
+        for(index_t i = 0; i < ndims; i++)
         {
             edims_axes[i] = dim_node[logical_axes[i]].to_int();
         }
@@ -1216,7 +1634,7 @@ convert_topology_to_unstructured(const std::string &base_type,
     else if(is_base_rectilinear)
     {
         const conduit::Node &dim_node = (*coordset)["values"];
-        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
+        for(index_t i = 0; i < ndims; i++)
         {
             edims_axes[i] =
                 dim_node[csys_axes[i]].dtype().number_of_elements() - 1;
@@ -1225,66 +1643,68 @@ convert_topology_to_unstructured(const std::string &base_type,
     else if(is_base_uniform)
     {
         const conduit::Node &dim_node = (*coordset)["dims"];
-        for(index_t i = 0; i < (index_t)csys_axes.size(); i++)
+        for(index_t i = 0; i < ndims; i++)
         {
             edims_axes[i] = dim_node[logical_axes[i]].to_int() - 1;
         }
     }
 
-    index_t vdims_axes[3] = {1, 1, 1}, num_elems = 1;
+    index_t num_elems = 1;
+    index_t vstrides[3] = {1, 1, 1};
     for(index_t d = 0; d < 3; d++)
     {
         num_elems *= edims_axes[d];
-        vdims_axes[d] = edims_axes[d] + 1;
+        if(d > 0)
+        {
+            vstrides[d] = vstrides[d - 1] * (edims_axes[d - 1] + 1);
+        }
     }
-    index_t indices_per_elem = (index_t) pow(2, csys_axes.size());
-
-    conduit::Node &conn_node = dest["elements/connectivity"];
-    conn_node.set(DataType(int_dtype.id(), num_elems * indices_per_elem));
 
-    Node src_idx_node, dst_idx_node;
-    index_t curr_elem[3], curr_vert[3];
-    for(index_t e = 0; e < num_elems; e++)
+    // strided structured topologies index a (ghost padded) window of their
+    // coordset, the connectivity refers to the full coordset directly
+    index_t voffset = 0;
+    if(is_base_structured)
     {
-        grid_id_to_ijk(e, &edims_axes[0], &curr_elem[0]);
-
-        // NOTE(JRC): In order to get all adjacent vertices for the
-        // element, we use the bitwise interpretation of each index
-        // per element to inform the direction (e.g. 5, which is
-        // 101 bitwise, means (z+1, y+0, x+1)).
-        for(index_t i = 0, v = 0; i < indices_per_elem; i++)
+        const conduit::Node &dim_node = topo["elements/dims"];
+        if(dim_node.has_child("strides"))
         {
-            memcpy(&curr_vert[0], &curr_elem[0], 3 * sizeof(index_t));
-            for(index_t d = 0; d < (index_t)csys_axes.size(); d++)
+            index_t_accessor strides = dim_node["strides"].as_index_t_accessor();
+            for(index_t d = 0; d < ndims; d++)
             {
-                curr_vert[d] += (i & (index_t)pow(2, d)) >> d;
+                vstrides[d] = strides[d];
             }
-            grid_ijk_to_id(&curr_vert[0], &vdims_axes[0], v);
-
-            src_idx_node.set(v);
-            dst_idx_node.set_external(int_dtype,
-                conn_node.element_ptr(e * indices_per_elem + i));
-            src_idx_node.to_data_type(int_dtype.id(), dst_idx_node);
         }
-
-        // TODO(JRC): This loop inverts quads/hexes to conform to
-        // the default Blueprint ordering. Once the ordering transforms
-        // are introduced, this code should be removed and replaced
-        // with initializing the ordering label value.
-        for(index_t p = 2; p < indices_per_elem; p += 4)
+        if(dim_node.has_child("offsets"))
         {
-            index_t p1 = e * indices_per_elem + p;
-            index_t p2 = e * indices_per_elem + p + 1;
+            index_t_accessor offsets = dim_node["offsets"].as_index_t_accessor();
+            for(index_t d = 0; d < ndims; d++)
+            {
+                voffset += offsets[d] * vstrides[d];
+            }
+        }
+    }
 
-            Node t1, t2, t3;
-            t1.set(int_dtype, conn_node.element_ptr(p1));
-            t2.set(int_dtype, conn_node.element_ptr(p2));
+    const index_t indices_per_elem = (index_t)1 << ndims;
+    conduit::Node &conn_node = dest["elements/connectivity"];
+    conn_node.set(DataType(int_dtype.id(), num_elems * indices_per_elem));
 
-            t3.set_external(int_dtype, conn_node.element_ptr(p1));
-            t2.to_data_type(int_dtype.id(), t3);
-            t3.set_external(int_dtype, conn_node.element_ptr(p2));
-            t1.to_data_type(int_dtype.id(), t3);
-        }
+    const index_t num_threads = num_threads_option(options);
+    if(int_dtype.is_int32())
+    {
+        emit_lattice_connectivity(ndims, edims_axes, vstrides, voffset,
+                                  num_threads, conn_node.as_int32_ptr());
+    }
+    else if(int_dtype.is_int64())
+    {
+        emit_lattice_connectivity(ndims, edims_axes, vstrides, voffset,
+                                  num_threads, conn_node.as_int64_ptr());
+    }
+    else
+    {
+        Node conn_int64(DataType::int64(num_elems * indices_per_elem));
+        emit_lattice_connectivity(ndims, edims_axes, vstrides, voffset,
+                                  num_threads, conn_int64.as_int64_ptr());
+        conn_int64.to_data_type(int_dtype.id(), conn_node);
     }
 }
 
@@ -1352,6 +1772,7 @@ calculate_unstructured_centroids(const conduit::Node &topo,
 
     const Node &topo_conn_const = topo["elements/connectivity"];
     Node topo_conn; topo_conn.set_external(topo_conn_const);
+    const bputils::coordset::CoordAccessor coords(coordset);
     const DataType conn_dtype(topo_conn.dtype().id(), 1);
     const DataType offset_dtype(topo_offsets.dtype().id(), 1);
     const DataType size_dtype(topo_sizes.dtype().id(), 1);
@@ -1441,10 +1862,7 @@ calculate_unstructured_centroids(const conduit::Node &topo,
             index_t ci = *elem_cindices_it;
             for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
             {
-                const Node &axis_data = coordset["values"][csys_axes[ai]];
-                data_node.set_external(DataType(axis_data.dtype().id(), 1),
-                    const_cast<void*>(axis_data.element_ptr(ci)));
-                ecentroid[ai] += data_node.to_float64() / elem_coord_indices.size();
+                ecentroid[ai] += coords.axis(ai)[ci] / elem_coord_indices.size();
             }
         }
 
@@ -1463,13 +1881,822 @@ calculate_unstructured_centroids(const conduit::Node &topo,
     }
 }
 
+//-------------------------------------------------------------------------
+// Returns true for uniform, rectilinear and structured topologies.
+bool
+is_structured_topology(const conduit::Node &topo)
+{
+    const std::string topo_type = topo["type"].as_string();
+    return topo_type == "uniform" ||
+           topo_type == "rectilinear" ||
+           topo_type == "structured";
+}
+
+//-------------------------------------------------------------------------
+// Fixed shape centroid helpers. These compute the centroids (and optionally
+// the lengths, areas or volumes) of single shape unstructured and of
+// uniform, rectilinear and structured topologies in one pass over their
+// elements, without materializing connectivity for implicit topologies.
+//-------------------------------------------------------------------------
+typedef bputils::topology::ShapeId ShapeId;
+
+//-------------------------------------------------------------------------
+inline float64
+centroid_tri_area(const float64 *p0, const float64 *p1, const float64 *p2)
+{
+    const float64 a[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+    const float64 b[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+    const float64 c[3] = {a[1] * b[2] - a[2] * b[1],
+                          a[2] * b[0] - a[0] * b[2],
+                          a[0] * b[1] - a[1] * b[0]};
+    return 0.5 * std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+}
+
+//-------------------------------------------------------------------------
+inline float64
+centroid_tet_volume(const float64 *p0, const float64 *p1,
+                    const float64 *p2, const float64 *p3)
+{
+    const float64 a[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+    const float64 b[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+    const float64 c[3] = {p3[0] - p0[0], p3[1] - p0[1], p3[2] - p0[2]};
+    return std::abs(a[0] * (b[1] * c[2] - b[2] * c[1]) +
+                    a[1] * (b[2] * c[0] - b[0] * c[2]) +
+                    a[2] * (b[0] * c[1] - b[1] * c[0])) / 6.0;
+}
+
+//-------------------------------------------------------------------------
+// Measure (length, area or volume) of an element from its point positions.
+// 3D shapes sum the volumes of a tet decomposition, which is exact for
+// convex elements with planar faces.
+template<ShapeId S> struct fixed_element_measure;
+
+template<> struct fixed_element_measure<ShapeId::Point>
+{
+    static float64 value(const float64 (*)[3]) { return 0.0; }
+};
+
+template<> struct fixed_element_measure<ShapeId::Line>
+{
+    static float64 value(const float64 (*p)[3])
+    {
+        const float64 d[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+        return std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    }
+};
+
+template<> struct fixed_element_measure<ShapeId::Tri>
+{
+    static float64 value(const float64 (*p)[3])
+    {
+        return centroid_tri_area(p[0], p[1], p[2]);
+    }
+};
+
+template<> struct fixed_element_measure<ShapeId::Quad>
+{
+    static float64 value(const float64 (*p)[3])
+    {
+        // half the cross product of the diagonals
+        const float64 o[3] = {0.0, 0.0, 0.0};
+        const float64 d0[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+        const float64 d1[3] = {p[3][0] - p[1][0], p[3][1] - p[1][1], p[3][2] - p[1][2]};
+        return centroid_tri_area(o, d0, d1);
+    }
+};
+
+template<> struct fixed_element_measure<ShapeId::Tet>
+{
+    static float64 value(const float64 (*p)[3])
+    {
+        return centroid_tet_volume(p[0], p[1], p[2], p[3]);
+    }
+};
+
+template<> struct fixed_element_measure<ShapeId::Hex>
+{
+    static float64 value(const float64 (*p)[3])
+    {
+        // six tets around the 0-6 diagonal
+        return centroid_tet_volume(p[0], p[1], p[2], p[6]) +
+               centroid_tet_volume(p[0], p[2], p[3], p[6]) +
+               centroid_tet_volume(p[0], p[3], p[7], p[6]) +
+               centroid_tet_volume(p[0], p[7], p[4], p[6]) +
+               centroid_tet_volume(p[0], p[4], p[5], p[6]) +
+               centroid_tet_volume(p[0], p[5], p[1], p[6]);
+    }
+};
+
+template<> struct fixed_element_measure<ShapeId::Wedge>
+{
+    static float64 value(const float64 (*p)[3])
+    {
+        return centroid_tet_volume(p[0], p[1], p[2], p[5]) +
+               centroid_tet_volume(p[0], p[1], p[5], p[4]) +
+               centroid_tet_volume(p[0], p[4], p[5], p[3]);
+    }
+};
+
+template<> struct fixed_element_measure<ShapeId::Pyramid>
+{
+    static float64 value(const float64 (*p)[3])
+    {
+        return centroid_tet_volume(p[0], p[1], p[2], p[4]) +
+               centroid_tet_volume(p[0], p[2], p[3], p[4]);
+    }
+};
+
+//-------------------------------------------------------------------------
+// Element functor for 'iterate_fixed_elements_parallel'. Coordinates are
+// read through 'CoordView' (a Span for compact float values, otherwise an
+// accessor) and centroids are written as 'OutT'. Like
+// 'calculate_unstructured_centroids', repeated point ids are only counted
+// once in an element's centroid.
+template<typename CoordView, typename OutT>
+struct FixedCentroidKernel
+{
+    FixedCentroidKernel(const CoordView &x, const CoordView &y, const CoordView &z,
+                        index_t num_axes, OutT *const *centroids, float64 *measures)
+    : m_x(x), m_y(y), m_z(z), m_num_axes(num_axes), m_measures(measures)
+    {
+        for(index_t ai = 0; ai < 3; ai++)
+        {
+            m_centroids[ai] = ai < num_axes ? centroids[ai] : NULL;
+        }
+    }
+
+    template<ShapeId S>
+    void operator()(const bputils::topology::fixed_entity<S> &e) const
+    {
+        const index_t num_indices = bputils::topology::fixed_shape_indices<S>::value;
+        float64 pts[num_indices][3];
+        for(index_t pi = 0; pi < num_indices; pi++)
+        {
+            const index_t id = e.element_ids[pi];
+            pts[pi][0] = static_cast<float64>(m_x[id]);
+            pts[pi][1] = m_num_axes > 1 ? static_cast<float64>(m_y[id]) : 0.0;
+            pts[pi][2] = m_num_axes > 2 ? static_cast<float64>(m_z[id]) : 0.0;
+        }
+
+        float64 centroid[3] = {0.0, 0.0, 0.0};
+        index_t num_unique = 0;
+        for(index_t pi = 0; pi < num_indices; pi++)
+        {
+            bool is_repeat = false;
+            for(index_t pj = 0; pj < pi; pj++)
+            {
+                is_repeat |= e.element_ids[pj] == e.element_ids[pi];
+            }
+            if(!is_repeat)
+            {
+                centroid[0] += pts[pi][0];
+                centroid[1] += pts[pi][1];
+                centroid[2] += pts[pi][2];
+                num_unique++;
+            }
+        }
+
+        for(index_t ai = 0; ai < m_num_axes; ai++)
+        {
+            m_centroids[ai][e.entity_id] =
+                static_cast<OutT>(centroid[ai] / num_unique);
+        }
+        if(m_measures != NULL)
+        {
+            m_measures[e.entity_id] = fixed_element_measure<S>::value(pts);
+        }
+    }
+
+    CoordView  m_x, m_y, m_z;
+    index_t    m_num_axes;
+    OutT      *m_centroids[3];
+    float64   *m_measures;
+};
+
+//-------------------------------------------------------------------------
+template<typename CoordView, typename OutT>
+void
+fixed_centroids_kernel(const conduit::Node &topo,
+                       const std::vector<CoordView> &axis_views,
+                       index_t num_threads,
+                       OutT *const *centroids,
+                       float64 *measures)
+{
+    const index_t num_axes = (index_t)axis_views.size();
+    FixedCentroidKernel<CoordView, OutT> kernel(
+        axis_views[0],
+        axis_views[num_axes > 1 ? 1 : 0],
+        axis_views[num_axes > 2 ? 2 : 0],
+        num_axes, centroids, measures);
+    bputils::topology::iterate_fixed_elements_parallel(topo, num_threads, kernel);
+}
+
+//-------------------------------------------------------------------------
+// Centroids of the elements of a single shape unstructured or a structured
+// topology. Uniform and rectilinear coordsets are read through a
+// 'CoordAccessor' instead of being made explicit.
+template<typename OutT>
+void
+fixed_centroids(const conduit::Node &topo,
+                const conduit::Node &coordset,
+                index_t num_threads,
+                OutT *const *centroids,
+                float64 *measures)
+{
+    if(coordset["type"].as_string() != "explicit")
+    {
+        const bputils::coordset::CoordAccessor coords(coordset);
+        std::vector<bputils::coordset::CoordAccessor::Axis> views;
+        for(index_t ai = 0; ai < coords.dims(); ai++)
+        {
+            views.push_back(coords.axis(ai));
+        }
+        fixed_centroids_kernel(topo, views, num_threads, centroids, measures);
+        return;
+    }
+
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
+    std::vector<const Node*> axis_nodes;
+    bool all_compact_float64 = true, all_compact_float32 = true;
+    for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
+    {
+        const Node &axis = coordset["values"][csys_axes[ai]];
+        axis_nodes.push_back(&axis);
+        all_compact_float64 &= axis.dtype().is_float64() && axis.dtype().is_compact();
+        all_compact_float32 &= axis.dtype().is_float32() && axis.dtype().is_compact();
+    }
+
+    if(all_compact_float64)
+    {
+        std::vector<Span<const float64> > views;
+        for(const Node *axis : axis_nodes)
+        {
+            views.push_back(axis->as_span<float64>());
+        }
+        fixed_centroids_kernel(topo, views, num_threads, centroids, measures);
+    }
+    else if(all_compact_float32)
+    {
+        std::vector<Span<const float32> > views;
+        for(const Node *axis : axis_nodes)
+        {
+            views.push_back(axis->as_span<float32>());
+        }
+        fixed_centroids_kernel(topo, views, num_threads, centroids, measures);
+    }
+    else
+    {
+        std::vector<float64_accessor> views;
+        for(const Node *axis : axis_nodes)
+        {
+            views.push_back(axis->as_float64_accessor());
+        }
+        fixed_centroids_kernel(topo, views, num_threads, centroids, measures);
+    }
+}
+
+//-------------------------------------------------------------------------
+// Centroids of the elements of a uniform or rectilinear topology, computed
+// from the midpoints of each axis' element intervals.
+template<typename OutT>
+void
+implicit_centroids(const conduit::Node &topo,
+                   const conduit::Node &coordset,
+                   index_t num_threads,
+                   OutT *const *centroids,
+                   float64 *measures)
+{
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
+    const index_t num_axes = (index_t)csys_axes.size();
+    const bool is_uniform = coordset["type"].as_string() == "uniform";
+
+    index_t dims[3] = {1, 1, 1};
+    bputils::topology::logical_dims(topo, dims, 3);
+
+    std::vector<float64> axis_mids[3], axis_widths[3];
+    for(index_t ai = 0; ai < num_axes; ai++)
+    {
+        axis_mids[ai].resize(dims[ai]);
+        axis_widths[ai].resize(dims[ai]);
+        if(is_uniform)
+        {
+            const std::string &csys_axis = csys_axes[ai];
+            const float64 origin = coordset.has_child("origin") ?
+                coordset["origin"][csys_axis].to_float64() : 0.0;
+            const float64 spacing = coordset.has_child("spacing") ?
+                coordset["spacing"]["d" + csys_axis].to_float64() : 1.0;
+            for(index_t i = 0; i < dims[ai]; i++)
+            {
+                axis_mids[ai][i] = origin + (i + 0.5) * spacing;
+                axis_widths[ai][i] = std::abs(spacing);
+            }
+        }
+        else
+        {
+            float64_accessor vals = coordset["values"][csys_axes[ai]].as_float64_accessor();
+            for(index_t i = 0; i < dims[ai]; i++)
+            {
+                axis_mids[ai][i] = 0.5 * (vals[i] + vals[i + 1]);
+                axis_widths[ai][i] = std::abs(vals[i + 1] - vals[i]);
+            }
+        }
+    }
+
+    const index_t num_elems = dims[0] * dims[1] * dims[2];
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_elems, 4096),
+        num_elems,
+        [&] (index_t /*ci*/, index_t ebegin, index_t eend)
+    {
+        for(index_t ei = ebegin; ei < eend; ei++)
+        {
+            const index_t ijk[3] = {ei % dims[0],
+                                    (ei / dims[0]) % dims[1],
+                                    ei / (dims[0] * dims[1])};
+            float64 measure = 1.0;
+            for(index_t ai = 0; ai < num_axes; ai++)
+            {
+                centroids[ai][ei] = static_cast<OutT>(axis_mids[ai][ijk[ai]]);
+                measure *= axis_widths[ai][ijk[ai]];
+            }
+            if(measures != NULL)
+            {
+                measures[ei] = measure;
+            }
+        }
+    });
+}
+
+//-------------------------------------------------------------------------
+// Returns true if the centroids of 'topo' can be computed by the fixed
+// shape helpers (otherwise 'calculate_unstructured_centroids' is used).
+bool
+has_fixed_centroids(const conduit::Node &topo)
+{
+    if(is_structured_topology(topo))
+    {
+        return true;
+    }
+    else if(topo["type"].as_string() != "unstructured")
+    {
+        return false;
+    }
+
+    const Node *shape = topo.fetch_ptr("elements/shape");
+    if(shape == NULL || !shape->dtype().is_string())
+    {
+        return false;
+    }
+    const ShapeType topo_shape(shape->as_string());
+    return topo_shape.is_valid() && !topo_shape.is_poly() &&
+        topo_shape.type != "mixed" && topo.has_path("elements/connectivity");
+}
+
+//-------------------------------------------------------------------------
+template<typename OutT>
+void
+typed_fixed_centroids(const conduit::Node &topo,
+                      const conduit::Node &coordset,
+                      index_t num_threads,
+                      conduit::Node &cdest,
+                      float64 *measures)
+{
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
+    OutT *centroids[3] = {NULL, NULL, NULL};
+    for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
+    {
+        centroids[ai] = static_cast<OutT*>(
+            cdest["values"][csys_axes[ai]].data_ptr());
+    }
+
+    const std::string topo_type = topo["type"].as_string();
+    const std::string cset_type = coordset["type"].as_string();
+    if(topo_type != "unstructured" &&
+       (cset_type == "uniform" || cset_type == "rectilinear"))
+    {
+        implicit_centroids(topo, coordset, num_threads, centroids, measures);
+    }
+    else
+    {
+        fixed_centroids(topo, coordset, num_threads, centroids, measures);
+    }
+}
+
+//-------------------------------------------------------------------------
+// Counterpart of 'calculate_unstructured_centroids' for the topologies
+// accepted by 'has_fixed_centroids'. If 'measures' isn't NULL, it receives
+// the length, area or volume of each element.
+void
+calculate_fixed_centroids(const conduit::Node &topo,
+                          const conduit::Node &coordset,
+                          index_t num_threads,
+                          conduit::Node &dest,
+                          conduit::Node &cdest,
+                          float64 *measures)
+{
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
+    const index_t topo_num_elems = bputils::topology::length(topo);
+
+    DataType int_dtype, float_dtype;
+    {
+        conduit::Node src_node;
+        src_node["topology"].set_external(topo);
+        src_node["coordset"].set_external(coordset);
+        int_dtype = bputils::find_widest_dtype(src_node, bputils::DEFAULT_INT_DTYPES);
+        float_dtype = bputils::find_widest_dtype(src_node, bputils::DEFAULT_FLOAT_DTYPE);
+    }
+
+    dest.reset();
+    dest["type"].set("unstructured");
+    dest["coordset"].set(cdest.name());
+    dest["elements/shape"].set("point");
+    Node &dest_conn = dest["elements/connectivity"];
+    dest_conn.set(DataType(int_dtype.id(), topo_num_elems));
+    if(int_dtype.is_int32())
+    {
+        int32 *conn = dest_conn.as_int32_ptr();
+        for(index_t ei = 0; ei < topo_num_elems; ei++)
+        {
+            conn[ei] = static_cast<int32>(ei);
+        }
+    }
+    else
+    {
+        Node conn(DataType::int64(topo_num_elems));
+        int64 *conn_vals = conn.as_int64_ptr();
+        for(index_t ei = 0; ei < topo_num_elems; ei++)
+        {
+            conn_vals[ei] = static_cast<int64>(ei);
+        }
+        conn.to_data_type(int_dtype.id(), dest_conn);
+    }
+
+    cdest.reset();
+    cdest["type"].set("explicit");
+    for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
+    {
+        cdest["values"][csys_axes[ai]].set(DataType(float_dtype.id(), topo_num_elems));
+    }
+
+    if(float_dtype.is_float32())
+    {
+        typed_fixed_centroids<float32>(topo, coordset, num_threads, cdest, measures);
+    }
+    else
+    {
+        typed_fixed_centroids<float64>(topo, coordset, num_threads, cdest, measures);
+    }
+}
+
+//-------------------------------------------------------------------------
+// Structured entity helpers. These generate the points, lines and faces of
+// uniform, rectilinear and structured topologies directly from their
+// logical dims, without converting them to unstructured topologies first.
+//
+// The 'dim' dimensional entities of a grid are grouped in families by the
+// logical axes they extend along (e.g. the i, j and k lines of a 3D grid).
+// Families are ordered by their axes (i before j before k), and entities
+// are numbered family by family, in i, j, k order over the family's dims.
+//-------------------------------------------------------------------------
+class StructuredEntities
+{
+public:
+    StructuredEntities(const index_t *elem_dims, index_t topo_dim, index_t dim)
+    : m_topo_dim(topo_dim), m_dim(dim)
+    {
+        for(index_t a = 0; a < 3; a++)
+        {
+            m_edims[a] = a < topo_dim ? elem_dims[a] : 1;
+            m_pdims[a] = a < topo_dim ? elem_dims[a] + 1 : 1;
+        }
+
+        m_family_offsets.push_back(0);
+        for(index_t mask = 0; mask < (1 << topo_dim); mask++)
+        {
+            if(mask_size(mask) != dim) { continue; }
+
+            index_t fdims[3], fsize = 1;
+            for(index_t a = 0; a < 3; a++)
+            {
+                fdims[a] = (mask & (1 << a)) ? m_edims[a] : m_pdims[a];
+                fsize *= fdims[a];
+            }
+            m_family_masks.push_back(mask);
+            m_family_dims.insert(m_family_dims.end(), fdims, fdims + 3);
+            m_family_offsets.push_back(m_family_offsets.back() + fsize);
+        }
+    }
+
+    index_t num_elements() const { return m_edims[0] * m_edims[1] * m_edims[2]; }
+    index_t num_entities() const { return m_family_offsets.back(); }
+    index_t num_families() const { return (index_t)m_family_masks.size(); }
+    index_t entity_indices() const { return (index_t)1 << m_dim; }
+    // number of 'dim' entities of each element
+    index_t element_entities() const
+    { return num_families() * ((index_t)1 << (m_topo_dim - m_dim)); }
+
+    //---------------------------------------------------------------------
+    // Point ids of entity 'id', in the winding of the matching shape
+    // (point, line, quad or hex).
+    void entity_points(index_t id, index_t *pts) const
+    {
+        index_t fi, ijk[3];
+        entity_ijk(id, fi, ijk);
+        const index_t mask = m_family_masks[fi];
+
+        index_t axes[3], num_axes = 0;
+        for(index_t a = 0; a < 3; a++)
+        {
+            if(mask & (1 << a)) { axes[num_axes++] = a; }
+        }
+
+        // corners given by bits over the entity's axes, in quad/hex order
+        static const index_t corner_bits[8] = {0, 1, 3, 2, 4, 5, 7, 6};
+        const index_t num_pts = entity_indices();
+        for(index_t ci = 0; ci < num_pts; ci++)
+        {
+            const index_t bits = num_pts > 2 ? corner_bits[ci] : ci;
+            index_t pijk[3] = {ijk[0], ijk[1], ijk[2]};
+            for(index_t ai = 0; ai < num_axes; ai++)
+            {
+                pijk[axes[ai]] += (bits >> ai) & 1;
+            }
+            pts[ci] = pijk[0] + m_pdims[0] * (pijk[1] + m_pdims[1] * pijk[2]);
+        }
+    }
+
+    //---------------------------------------------------------------------
+    // Ids of the 'dim' entities of element 'eid', family by family.
+    void element_entities(index_t eid, index_t *ents) const
+    {
+        const index_t eijk[3] = {eid % m_edims[0],
+                                 (eid / m_edims[0]) % m_edims[1],
+                                 eid / (m_edims[0] * m_edims[1])};
+        index_t ei = 0;
+        for(index_t fi = 0; fi < num_families(); fi++)
+        {
+            index_t free_axes[3], num_free = 0;
+            for(index_t a = 0; a < m_topo_dim; a++)
+            {
+                if(!(m_family_masks[fi] & (1 << a))) { free_axes[num_free++] = a; }
+            }
+            for(index_t bits = 0; bits < ((index_t)1 << num_free); bits++)
+            {
+                index_t ijk[3] = {eijk[0], eijk[1], eijk[2]};
+                for(index_t ai = 0; ai < num_free; ai++)
+                {
+                    ijk[free_axes[ai]] += (bits >> ai) & 1;
+                }
+                ents[ei++] = entity_id(fi, ijk);
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------
+    // Ids of the elements that contain entity 'id', in increasing order.
+    // Returns the number of elements.
+    index_t entity_elements(index_t id, index_t *elems) const
+    {
+        index_t fi, ijk[3];
+        entity_ijk(id, fi, ijk);
+
+        index_t free_axes[3], num_free = 0;
+        for(index_t a = 0; a < m_topo_dim; a++)
+        {
+            if(!(m_family_masks[fi] & (1 << a))) { free_axes[num_free++] = a; }
+        }
+
+        index_t num_elems = 0;
+        for(index_t bits = 0; bits < ((index_t)1 << num_free); bits++)
+        {
+            index_t eijk[3] = {ijk[0], ijk[1], ijk[2]};
+            bool is_valid = true;
+            for(index_t ai = 0; ai < num_free; ai++)
+            {
+                const index_t a = free_axes[ai];
+                eijk[a] -= ((bits >> ai) & 1) ? 0 : 1;
+                is_valid &= eijk[a] >= 0 && eijk[a] < m_edims[a];
+            }
+            if(is_valid)
+            {
+                elems[num_elems++] =
+                    eijk[0] + m_edims[0] * (eijk[1] + m_edims[1] * eijk[2]);
+            }
+        }
+        return num_elems;
+    }
+
+private:
+    static index_t mask_size(index_t mask)
+    {
+        return (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1);
+    }
+
+    void entity_ijk(index_t id, index_t &fi, index_t *ijk) const
+    {
+        fi = (index_t)(std::upper_bound(m_family_offsets.begin(),
+            m_family_offsets.end(), id) - m_family_offsets.begin()) - 1;
+        const index_t *fdims = &m_family_dims[3 * fi];
+        const index_t fid = id - m_family_offsets[fi];
+        ijk[0] = fid % fdims[0];
+        ijk[1] = (fid / fdims[0]) % fdims[1];
+        ijk[2] = fid / (fdims[0] * fdims[1]);
+    }
+
+    index_t entity_id(index_t fi, const index_t *ijk) const
+    {
+        const index_t *fdims = &m_family_dims[3 * fi];
+        return m_family_offsets[fi] + ijk[0] + fdims[0] * (ijk[1] + fdims[1] * ijk[2]);
+    }
+
+    index_t m_topo_dim, m_dim;
+    index_t m_edims[3], m_pdims[3];
+    std::vector<index_t> m_family_masks;
+    std::vector<index_t> m_family_dims;
+    std::vector<index_t> m_family_offsets;
+};
+
+//-------------------------------------------------------------------------
+// Fills the entity topology and maps of 'ents' with integer type 'T'.
+template<typename T>
+void
+typed_structured_entities(const StructuredEntities &ents,
+                          index_t num_threads,
+                          Node &dest,
+                          Node &s2dmap,
+                          Node &d2smap)
+{
+    const index_t int_id = conduit::detail::DataViewTypeId<T>::id;
+    const index_t min_chunk_items = 4096;
+    const index_t num_elems = ents.num_elements();
+    const index_t num_ents = ents.num_entities();
+    const index_t ent_indices = ents.entity_indices();
+    const index_t elem_ents = ents.element_entities();
+
+    Node &conn_node = dest["elements/connectivity"];
+    conn_node.set(DataType(int_id, num_ents * ent_indices));
+    T *conn = static_cast<T*>(conn_node.data_ptr());
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_ents, min_chunk_items),
+        num_ents,
+        [&] (index_t /*ci*/, index_t begin, index_t end)
+    {
+        index_t pts[8];
+        for(index_t id = begin; id < end; id++)
+        {
+            ents.entity_points(id, pts);
+            for(index_t pi = 0; pi < ent_indices; pi++)
+            {
+                conn[id * ent_indices + pi] = static_cast<T>(pts[pi]);
+            }
+        }
+    });
+
+    // element to entity map, with the same number of entities per element
+    s2dmap.reset();
+    s2dmap["values"].set(DataType(int_id, num_elems * elem_ents));
+    s2dmap["sizes"].set(DataType(int_id, num_elems));
+    s2dmap["offsets"].set(DataType(int_id, num_elems));
+    T *s2d_values = static_cast<T*>(s2dmap["values"].data_ptr());
+    T *s2d_sizes = static_cast<T*>(s2dmap["sizes"].data_ptr());
+    T *s2d_offsets = static_cast<T*>(s2dmap["offsets"].data_ptr());
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_elems, min_chunk_items),
+        num_elems,
+        [&] (index_t /*ci*/, index_t begin, index_t end)
+    {
+        index_t elem_ent_ids[12];
+        for(index_t eid = begin; eid < end; eid++)
+        {
+            ents.element_entities(eid, elem_ent_ids);
+            for(index_t ei = 0; ei < elem_ents; ei++)
+            {
+                s2d_values[eid * elem_ents + ei] = static_cast<T>(elem_ent_ids[ei]);
+            }
+            s2d_sizes[eid] = static_cast<T>(elem_ents);
+            s2d_offsets[eid] = static_cast<T>(eid * elem_ents);
+        }
+    });
+
+    // entity to element map; sizes first, then the values at their offsets
+    d2smap.reset();
+    d2smap["sizes"].set(DataType(int_id, num_ents));
+    d2smap["offsets"].set(DataType(int_id, num_ents));
+    T *d2s_sizes = static_cast<T*>(d2smap["sizes"].data_ptr());
+    T *d2s_offsets = static_cast<T*>(d2smap["offsets"].data_ptr());
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_ents, min_chunk_items),
+        num_ents,
+        [&] (index_t /*ci*/, index_t begin, index_t end)
+    {
+        index_t ent_elems[8];
+        for(index_t id = begin; id < end; id++)
+        {
+            d2s_sizes[id] = static_cast<T>(ents.entity_elements(id, ent_elems));
+        }
+    });
+    T d2s_size = 0;
+    for(index_t id = 0; id < num_ents; id++)
+    {
+        d2s_offsets[id] = d2s_size;
+        d2s_size += d2s_sizes[id];
+    }
+
+    d2smap["values"].set(DataType(int_id, (index_t)d2s_size));
+    T *d2s_values = static_cast<T*>(d2smap["values"].data_ptr());
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_ents, min_chunk_items),
+        num_ents,
+        [&] (index_t /*ci*/, index_t begin, index_t end)
+    {
+        index_t ent_elems[8];
+        for(index_t id = begin; id < end; id++)
+        {
+            const index_t num_ent_elems = ents.entity_elements(id, ent_elems);
+            for(index_t ei = 0; ei < num_ent_elems; ei++)
+            {
+                d2s_values[d2s_offsets[id] + ei] = static_cast<T>(ent_elems[ei]);
+            }
+        }
+    });
+}
+
+//-------------------------------------------------------------------------
+// Counterpart of the 'TopologyMetadata' based generation of the 'dim'
+// dimensional entities of a topology for uniform, rectilinear and
+// structured topologies. Outputs an unstructured topology of the entities
+// on the original coordset, and the element to entity and entity to element
+// maps (as o2m relations).
+void
+generate_structured_entities(const conduit::Node &topo,
+                             const conduit::Node &coordset,
+                             index_t dim,
+                             index_t num_threads,
+                             conduit::Node &dest,
+                             conduit::Node &s2dmap,
+                             conduit::Node &d2smap)
+{
+    const index_t topo_dim = bputils::topology::dims(topo);
+    if(dim > topo_dim)
+    {
+        CONDUIT_ERROR("Failed to generate " << dim << "D entities for a "
+                      << topo_dim << "D topology.");
+    }
+
+    index_t elem_dims[3] = {1, 1, 1};
+    bputils::topology::logical_dims(topo, elem_dims, 3);
+    const StructuredEntities ents(elem_dims, topo_dim, dim);
+
+    const char *shape_names[] = {"point", "line", "quad", "hex"};
+    dest.reset();
+    dest["type"].set("unstructured");
+    dest["coordset"].set(coordset.name());
+    dest["elements/shape"].set(shape_names[dim]);
+
+    // use int32 outputs when both the inputs and the largest output value
+    // (an id, offset or map length) fit in it
+    const DataType int_dtype = bputils::find_widest_dtype(
+        bputils::link_nodes(topo, coordset), bputils::DEFAULT_INT_DTYPES);
+    const index_t max_value = std::max(
+        std::max(ents.num_entities() * ents.entity_indices(),
+                 ents.num_elements() * ents.element_entities()),
+        ents.num_elements() * ((index_t)1 << topo_dim) + ents.num_entities());
+    if(int_dtype.is_int32() &&
+       max_value <= (index_t)std::numeric_limits<int32>::max())
+    {
+        typed_structured_entities<int32>(ents, num_threads, dest, s2dmap, d2smap);
+    }
+    else if(int_dtype.is_int32() || int_dtype.is_int64())
+    {
+        typed_structured_entities<int64>(ents, num_threads, dest, s2dmap, d2smap);
+    }
+    else
+    {
+        Node dest_int64, s2dmap_int64, d2smap_int64;
+        typed_structured_entities<int64>(ents, num_threads,
+            dest_int64, s2dmap_int64, d2smap_int64);
+        dest_int64["elements/connectivity"].to_data_type(int_dtype.id(),
+            dest["elements/connectivity"]);
+        s2dmap.reset();
+        d2smap.reset();
+        const std::string map_paths[] = {"values", "sizes", "offsets"};
+        for(const std::string &map_path : map_paths)
+        {
+            s2dmap_int64[map_path].to_data_type(int_dtype.id(), s2dmap[map_path]);
+            d2smap_int64[map_path].to_data_type(int_dtype.id(), d2smap[map_path]);
+        }
+    }
+
+    bputils::topology::unstructured::generate_offsets_inline(dest, num_threads);
+}
+
+//-----------------------------------------------------------------------------
+// - end internal topology helpers -
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- end internal helper functions --
 //-----------------------------------------------------------------------------
-// - end internal topology helpers -
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-// -- end internal helper functions --
-//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -1570,16 +2797,82 @@ mesh::verify(const Node &mesh,
     // mesh
     if(mesh.has_child("coordsets"))
     {
-        res = verify_single_domain(mesh, info);
+        res = verify_single_domain(mesh, info, false, 1);
     }
     else
     {
-       res = verify_multi_domain(mesh, info);
+       res = verify_multi_domain(mesh, info, false, 1);
     }
     return res;
 }
 
 
+//-----------------------------------------------------------------------------
+bool
+mesh::verify(const Node &mesh,
+             Node &info,
+             const Node &options)
+{
+    bool shallow = false;
+    if(options.has_child("level"))
+    {
+        const std::string level = options["level"].as_string();
+        if(level == "shallow")
+        {
+            shallow = true;
+        }
+        else if(level != "full")
+        {
+            CONDUIT_ERROR("mesh::verify: unsupported level '" << level
+                          << "' (expected 'full' or 'shallow')");
+        }
+    }
+
+    bool use_cache = false;
+    if(options.has_child("cache"))
+    {
+        const Node &cache_opt = options["cache"];
+        use_cache = cache_opt.dtype().is_string() ?
+            cache_opt.as_string() == "true" : cache_opt.to_int() != 0;
+    }
+
+    const index_t num_threads = num_threads_option(options);
+
+    bool res = true;
+    uint64 stamp = 0;
+    const VerifyCacheKey cache_key(&mesh, shallow);
+    if(use_cache)
+    {
+        // NOTE: the cached subtree hashes make the stamp of an unchanged
+        // mesh cheap to recompute
+        Node hash_opts;
+        hash_opts["cache"] = "true";
+        stamp = mesh.hash(hash_opts);
+        if(verify_cache_find(cache_key, stamp, info, res))
+        {
+            return res;
+        }
+    }
+
+    info.reset();
+    if(mesh.has_child("coordsets"))
+    {
+        res = verify_single_domain(mesh, info, shallow, num_threads);
+    }
+    else
+    {
+        res = verify_multi_domain(mesh, info, shallow, num_threads);
+    }
+
+    if(use_cache)
+    {
+        verify_cache_store(cache_key, stamp, info, res);
+    }
+
+    return res;
+}
+
+
 //-------------------------------------------------------------------------
 bool mesh::is_multi_domain(const conduit::Node &mesh)
 {
@@ -1741,6 +3034,8 @@ mesh::generate_index(const conduit::Node &mesh,
                      index_t number_of_domains,
                      Node &index_out)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::generate_index");
+
     // domains can have different fields, etc
     // so we need the union of the index entries
     index_out.reset();
@@ -2018,7 +3313,9 @@ mesh::generate_index_for_single_domain(const Node &mesh,
             index_t ncomps = 1;
             if(fld.has_child("values"))
             {
-                if(fld["values"].dtype().is_object())
+                // (zfparray values hold a single component)
+                if(fld["values"].dtype().is_object() &&
+                   !is_zfparray_field(fld["values"]))
                 {
                     ncomps = fld["values"].number_of_children();
                 }
@@ -2143,6 +3440,134 @@ mesh::can_generate_strip(const Node &mesh,
     return res;
 }
 
+//-------------------------------------------------------------------------
+// strip fields of at least this many values are copied in element ranges
+// split over threads
+static const index_t STRIP_MIN_CHUNK_VALUES = 65536;
+
+//-------------------------------------------------------------------------
+// Copies 'src' (a child of a field, such as its values) to 'dest', compacting
+// it like Node::set. Numeric leaves are copied in element ranges split over
+// up to 'num_threads' threads.
+void
+strip_copy_field_data(const Node &src,
+                      Node &dest,
+                      index_t num_threads)
+{
+    const DataType &src_dtype = src.dtype();
+    if(src_dtype.is_object())
+    {
+        NodeConstIterator itr = src.children();
+        while(itr.has_next())
+        {
+            const Node &chld = itr.next();
+            strip_copy_field_data(chld, dest[itr.name()], num_threads);
+        }
+    }
+    else if(src_dtype.is_list())
+    {
+        NodeConstIterator itr = src.children();
+        while(itr.has_next())
+        {
+            strip_copy_field_data(itr.next(), dest.append(), num_threads);
+        }
+    }
+    else if(src_dtype.is_number() && num_threads > 1)
+    {
+        const index_t num_vals = src_dtype.number_of_elements();
+        const index_t ele_bytes = src_dtype.element_bytes();
+        const bool is_compact = src_dtype.is_compact();
+        dest.set(DataType(src_dtype.id(), num_vals, 0, ele_bytes, ele_bytes,
+                          src_dtype.endianness()));
+        bputils::detail::parallel_chunks(
+            bputils::detail::parallel_num_chunks(num_threads, num_vals,
+                                                 STRIP_MIN_CHUNK_VALUES),
+            num_vals,
+            [&] (index_t /*ci*/, index_t begin, index_t end)
+        {
+            uint8 *dest_ptr = static_cast<uint8*>(dest.element_ptr(begin));
+            if(is_compact)
+            {
+                memcpy(dest_ptr, src.element_ptr(begin), (size_t)((end - begin) * ele_bytes));
+                return;
+            }
+            for(index_t i = begin; i < end; i++, dest_ptr += ele_bytes)
+            {
+                memcpy(dest_ptr, src.element_ptr(i), (size_t)ele_bytes);
+            }
+        });
+    }
+    else
+    {
+        dest.set(src);
+    }
+}
+
+//-------------------------------------------------------------------------
+// Adds the strip versions of the fields 'names' of 'fields_src' to
+// 'fields_dest' as 'dest_names', on topology 'dest_topo_name'.
+//
+// Strip fields are built on up to 'num_threads' threads (split among the
+// fields, then among the values of each field) and added in order. With
+// 'external', the strip fields' data refers to the source fields' data
+// instead of being copied (unless a strip field replaces a source field).
+void
+generate_strip_fields(const Node &fields_src,
+                      const std::vector<std::string> &names,
+                      const std::vector<std::string> &dest_names,
+                      const std::string &dest_topo_name,
+                      index_t num_threads,
+                      bool external,
+                      Node &fields_dest)
+{
+    if(external && &fields_src == &fields_dest)
+    {
+        for(const std::string &dest_name : dest_names)
+        {
+            external &= !fields_src.has_child(dest_name);
+        }
+    }
+
+    const index_t num_fields = (index_t)names.size();
+    const index_t field_chunks =
+        bputils::detail::parallel_num_chunks(num_threads, num_fields, 1);
+    const index_t field_threads = std::max((index_t)1, num_threads / field_chunks);
+
+    std::vector<Node> strip_fields((size_t)num_fields);
+    bputils::detail::parallel_chunks(field_chunks, num_fields,
+        [&] (index_t /*ci*/, index_t fbegin, index_t fend)
+    {
+        for(index_t fi = fbegin; fi < fend; fi++)
+        {
+            const Node &src = fields_src[names[fi]];
+            Node &dest = strip_fields[fi];
+            NodeConstIterator itr = src.children();
+            while(itr.has_next())
+            {
+                const Node &chld = itr.next();
+                const std::string chld_name = itr.name();
+                if(chld_name == "topology")
+                {
+                    dest[chld_name].set(dest_topo_name);
+                }
+                else if(external && !chld.dtype().is_string())
+                {
+                    dest[chld_name].set_external(chld);
+                }
+                else
+                {
+                    strip_copy_field_data(chld, dest[chld_name], field_threads);
+                }
+            }
+        }
+    });
+
+    for(index_t fi = 0; fi < num_fields; fi++)
+    {
+        fields_dest[dest_names[fi]].swap(strip_fields[fi]);
+    }
+}
+
 //-------------------------------------------------------------------------
 void
 mesh::generate_strip(conduit::Node &mesh,
@@ -2245,15 +3670,14 @@ mesh::generate_strip(const conduit::Node& topo,
     mesh::coordset::generate_strip(coordset_src, coords_dest);
     mesh::topology::generate_strip(topo, coords_dest.name(), topo_dest);
 
+    std::vector<std::string> strip_names, strip_dest_names;
     for (const std::string& field_name : field_names)
     {
         // TODO Something useful with grid functions, when needed by users.
         if (fields_src[field_name]["association"].as_string() == "element")
         {
-            std::string field_dest_name = field_prefix + field_name;
-            fields_dest[field_dest_name] = fields_src[field_name];
-
-            fields_dest[field_dest_name]["topology"] = topo_dest_name;
+            strip_names.push_back(field_name);
+            strip_dest_names.push_back(field_prefix + field_name);
         }
         else
         {
@@ -2261,6 +3685,12 @@ mesh::generate_strip(const conduit::Node& topo,
             // TODO Something useful with vertex fields.  Confer with users.
         }
     }
+
+    const bool external = options.has_child("external") &&
+                          options["external"].to_index_t() != 0;
+    generate_strip_fields(fields_src, strip_names, strip_dest_names,
+                          topo_dest_name, num_threads_option(options),
+                          external, fields_dest);
 }
 
 
@@ -2763,10 +4193,8 @@ void
 verify_generate_mesh(const conduit::Node &mesh,
                      const std::string &adjset_name)
 {
-    const std::vector<const Node *> domains = blueprint::mesh::domains(mesh);
-    for(index_t di = 0; di < (index_t)domains.size(); di++)
+    blueprint::mesh::for_each_domain(mesh, [&](const Node &domain)
     {
-        const Node &domain = *domains[di];
         Node info;
 
         if(!domain["adjsets"].has_child(adjset_name))
@@ -2795,7 +4223,7 @@ verify_generate_mesh(const conduit::Node &mesh,
                           "Supported types:\n" <<
                           "  'unstructured'");
         }
-    }
+    });
 }
 
 
@@ -2808,6 +4236,8 @@ mesh::generate_points(conduit::Node &mesh,
                       conduit::Node &s2dmap,
                       conduit::Node &d2smap)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::generate_points");
+
     verify_generate_mesh(mesh, src_adjset_name);
     generate_derived_entities(
         mesh, src_adjset_name, dst_adjset_name, dst_topo_name, s2dmap, d2smap,
@@ -2824,6 +4254,8 @@ mesh::generate_lines(conduit::Node &mesh,
                      conduit::Node &s2dmap,
                      conduit::Node &d2smap)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::generate_lines");
+
     verify_generate_mesh(mesh, src_adjset_name);
     generate_derived_entities(
         mesh, src_adjset_name, dst_adjset_name, dst_topo_name, s2dmap, d2smap,
@@ -2840,6 +4272,8 @@ mesh::generate_faces(conduit::Node &mesh,
                      conduit::Node& s2dmap,
                      conduit::Node& d2smap)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::generate_faces");
+
     verify_generate_mesh(mesh, src_adjset_name);
     generate_derived_entities(
         mesh, src_adjset_name, dst_adjset_name, dst_topo_name, s2dmap, d2smap,
@@ -2857,6 +4291,8 @@ mesh::generate_centroids(conduit::Node& mesh,
                          conduit::Node& s2dmap,
                          conduit::Node& d2smap)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::generate_centroids");
+
     const static auto identify_centroid = []
         (const bputils::TopologyMetadata &/*topo_data*/, const index_t ei, const index_t /*di*/)
     {
@@ -2889,6 +4325,8 @@ mesh::generate_sides(conduit::Node& mesh,
                      conduit::Node& s2dmap,
                      conduit::Node& d2smap)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::generate_sides");
+
     const static auto identify_side = []
         (const bputils::TopologyMetadata &topo_data, const index_t ei, const index_t di)
     {
@@ -2938,6 +4376,8 @@ mesh::generate_corners(conduit::Node& mesh,
                        conduit::Node& s2dmap,
                        conduit::Node& d2smap)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::generate_corners");
+
     const static auto identify_corner = []
         (const bputils::TopologyMetadata &topo_data, const index_t ei, const index_t di)
     {
@@ -3412,51 +4852,7 @@ bool
 mesh::topology::verify(const Node &topo,
                        Node &info)
 {
-    const std::string protocol = "mesh::topology";
-    bool res = true;
-    info.reset();
-
-    if(!(verify_field_exists(protocol, topo, info, "type") &&
-         mesh::topology::type::verify(topo["type"], info["type"])))
-    {
-        res = false;
-    }
-    else
-    {
-        const std::string topo_type = topo["type"].as_string();
-
-        if(topo_type == "points")
-        {
-            res &= mesh::topology::points::verify(topo,info);
-        }
-        else if(topo_type == "uniform")
-        {
-            res &= mesh::topology::uniform::verify(topo,info);
-        }
-        else if(topo_type == "rectilinear")
-        {
-            res &= mesh::topology::rectilinear::verify(topo,info);
-        }
-        else if(topo_type == "structured")
-        {
-            res &= mesh::topology::structured::verify(topo,info);
-        }
-        else if(topo_type == "unstructured")
-        {
-            res &= mesh::topology::unstructured::verify(topo,info);
-        }
-    }
-
-    if(topo.has_child("grid_function"))
-    {
-        log::optional(info, protocol, "includes grid_function");
-        res &= verify_string_field(protocol, topo, info, "grid_function");
-    }
-
-    log::validation(info,res);
-
-    return res;
-
+    return verify_topology(topo, info, false);
 }
 
 
@@ -3583,7 +4979,18 @@ mesh::topology::uniform::to_unstructured(const conduit::Node &topo,
                                          conduit::Node &topo_dest,
                                          conduit::Node &coords_dest)
 {
-    convert_topology_to_unstructured("uniform", topo, topo_dest, coords_dest);
+    convert_topology_to_unstructured("uniform", topo, topo_dest, coords_dest, Node());
+}
+
+
+//-------------------------------------------------------------------------
+void
+mesh::topology::uniform::to_unstructured(const conduit::Node &topo,
+                                         conduit::Node &topo_dest,
+                                         conduit::Node &coords_dest,
+                                         const conduit::Node &options)
+{
+    convert_topology_to_unstructured("uniform", topo, topo_dest, coords_dest, options);
 }
 
 //-----------------------------------------------------------------------------
@@ -3629,7 +5036,18 @@ mesh::topology::rectilinear::to_unstructured(const conduit::Node &topo,
                                              conduit::Node &topo_dest,
                                              conduit::Node &coords_dest)
 {
-    convert_topology_to_unstructured("rectilinear", topo, topo_dest, coords_dest);
+    convert_topology_to_unstructured("rectilinear", topo, topo_dest, coords_dest, Node());
+}
+
+
+//-------------------------------------------------------------------------
+void
+mesh::topology::rectilinear::to_unstructured(const conduit::Node &topo,
+                                             conduit::Node &topo_dest,
+                                             conduit::Node &coords_dest,
+                                             const conduit::Node &options)
+{
+    convert_topology_to_unstructured("rectilinear", topo, topo_dest, coords_dest, options);
 }
 
 //-----------------------------------------------------------------------------
@@ -3680,9 +5098,20 @@ mesh::topology::structured::verify(const Node &topo,
 void
 mesh::topology::structured::to_unstructured(const conduit::Node &topo,
                                             conduit::Node &topo_dest,
-                                            conduit::Node &coords_dest)
+                                            conduit::Node &coords_dest)
+{
+    convert_topology_to_unstructured("structured", topo, topo_dest, coords_dest, Node());
+}
+
+
+//-------------------------------------------------------------------------
+void
+mesh::topology::structured::to_unstructured(const conduit::Node &topo,
+                                            conduit::Node &topo_dest,
+                                            conduit::Node &coords_dest,
+                                            const conduit::Node &options)
 {
-    convert_topology_to_unstructured("structured", topo, topo_dest, coords_dest);
+    convert_topology_to_unstructured("structured", topo, topo_dest, coords_dest, options);
 }
 
 //-----------------------------------------------------------------------------
@@ -3694,106 +5123,225 @@ bool
 mesh::topology::unstructured::verify(const Node &topo,
                                      Node &info)
 {
-    const std::string protocol = "mesh::topology::unstructured";
-    bool res = true;
-    info.reset();
+    return verify_unstructured_topology(topo, info, false);
+}
 
-    res &= verify_string_field(protocol, topo, info, "coordset");
 
-    res &= verify_enum_field(protocol, topo, info, "type",
-        std::vector<std::string>(1, "unstructured"));
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::to_polytopal(const Node &topo,
+                                           Node &dest)
+{
+    to_polygonal(topo,dest);
+}
 
-    if(!verify_object_field(protocol, topo, info, "elements"))
-    {
-        res = false;
-    }
-    else
-    {
-        const Node &topo_elems = topo["elements"];
-        Node &info_elems = info["elements"];
+//-----------------------------------------------------------------------------
+// Builds the polyhedral connectivity and sizes (and polygonal subelements)
+// of a 3D single shape topology directly in the integer type 'T'.
+//
+// Each element face ("slot", ei * faces_per_elem + fi) gets a canonical key,
+// its sorted vertex ids, and a hash of that key. Slots are split by hash
+// across threads, and each thread finds the first slot with the same key
+// (the face's representative) through an open addressing table over its
+// slots. Faces are then numbered in the order their representatives appear,
+// counted per chunk and filled in a second pass, so the result doesn't
+// depend on the number of threads.
+//-----------------------------------------------------------------------------
+template<typename T>
+static void
+to_polyhedral_typed(const Node &topo_conn,
+                    const ShapeCascade &topo_cascade,
+                    index_t num_threads,
+                    Node &dest)
+{
+    // NOTE(JRC): Polyhedral topologies are a bit more complicated
+    // because the derivation comes from the embedding. The embedding
+    // is statically RHR positive, but this can be turned negative by
+    // an initially RHR negative element.
+    const ShapeType topo_shape = topo_cascade.get_shape();
+    const ShapeType embed_shape = topo_cascade.get_shape(topo_shape.dim - 1);
+    const index_t topo_elems = topo_conn.dtype().number_of_elements() / topo_shape.indices;
+    const index_t faces_per_elem = topo_shape.embed_count;
+    const index_t face_indices = embed_shape.indices;
+    const index_t num_slots = topo_elems * faces_per_elem;
+
+    index_t_accessor topo_conn_vals = topo_conn.as_index_t_accessor();
+
+    // pass 0: face vertex ids (in element order), sorted keys and hashes
+    std::vector<T> slot_verts(num_slots * face_indices);
+    std::vector<T> slot_keys(num_slots * face_indices);
+    std::vector<uint64> slot_hashes(num_slots);
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, topo_elems, 1024),
+        topo_elems,
+        [&] (index_t /*ci*/, index_t ebegin, index_t eend)
+    {
+        for(index_t ei = ebegin; ei < eend; ei++)
+        {
+            const index_t data_off = topo_shape.indices * ei;
+            for(index_t fi = 0; fi < faces_per_elem; fi++)
+            {
+                const index_t slot = ei * faces_per_elem + fi;
+                T *verts = &slot_verts[slot * face_indices];
+                T *key = &slot_keys[slot * face_indices];
+                for(index_t ii = 0; ii < face_indices; ii++)
+                {
+                    verts[ii] = static_cast<T>(topo_conn_vals[data_off +
+                        topo_shape.embedding[fi * face_indices + ii]]);
+                    key[ii] = verts[ii];
+                }
+                std::sort(key, key + face_indices);
 
-        bool elems_res = true;
-        bool subelems_res = true;
+                uint64 hash = 14695981039346656037ULL;
+                for(index_t ii = 0; ii < face_indices; ii++)
+                {
+                    hash = (hash ^ (uint64)key[ii]) * 1099511628211ULL;
+                }
+                slot_hashes[slot] = hash ^ (hash >> 29);
+            }
+        }
+    });
 
-        // single shape or mixed definition case
-        if(topo_elems.has_child("shape"))
+    // pass 1: the representative (first) slot of each slot's face
+    std::vector<index_t> slot_reps(num_slots);
+    const index_t num_buckets =
+        bputils::detail::parallel_num_chunks(num_threads, num_slots, 16384);
+    bputils::detail::parallel_chunks(num_buckets, num_buckets,
+        [&] (index_t /*ci*/, index_t bbegin, index_t bend)
+    {
+        for(index_t bi = bbegin; bi < bend; bi++)
         {
-            elems_res &= verify_field_exists(protocol, topo_elems, info_elems, "shape") &&
-                   mesh::topology::shape::verify(topo_elems["shape"], info_elems["shape"]);
-            elems_res &= verify_integer_field(protocol, topo_elems, info_elems, "connectivity");
+            std::vector<index_t> bucket_slots;
+            for(index_t slot = 0; slot < num_slots; slot++)
+            {
+                if((index_t)(slot_hashes[slot] % (uint64)num_buckets) == bi)
+                {
+                    bucket_slots.push_back(slot);
+                }
+            }
 
-            if (topo_elems["shape"].dtype().is_string() &&
-                topo_elems["shape"].as_string() == "mixed")
+            uint64 table_size = 16;
+            while(table_size < 2 * (uint64)bucket_slots.size())
             {
-              elems_res &= verify_mixed_node(topo, info, elems_res, subelems_res);
+                table_size <<= 1;
             }
-            else
+            std::vector<index_t> table(table_size, -1);
+            for(size_t si = 0; si < bucket_slots.size(); si++)
             {
-              // Verify if node is polygonal or polyhedral
-              elems_res &= verify_poly_node(false, "", topo_elems, info_elems, topo, info, elems_res);
+                const index_t slot = bucket_slots[si];
+                const T *key = &slot_keys[slot * face_indices];
+                uint64 pos = (slot_hashes[slot] / (uint64)num_buckets) & (table_size - 1);
+                while(true)
+                {
+                    const index_t entry = table[pos];
+                    if(entry < 0)
+                    {
+                        table[pos] = slot;
+                        slot_reps[slot] = slot;
+                        break;
+                    }
+                    if(slot_hashes[entry] == slot_hashes[slot] &&
+                       std::equal(key, key + face_indices,
+                                  &slot_keys[entry * face_indices]))
+                    {
+                        slot_reps[slot] = entry;
+                        break;
+                    }
+                    pos = (pos + 1) & (table_size - 1);
+                }
             }
         }
-        // shape stream case
-        else if(topo_elems.has_child("element_types"))
+    });
+    std::vector<T>().swap(slot_keys);
+    std::vector<uint64>().swap(slot_hashes);
+
+    // pass 2: count the faces first seen in each chunk of slots, then
+    // number them and fill the connectivity
+    const index_t num_chunks =
+        bputils::detail::parallel_num_chunks(num_threads, num_slots, 16384);
+    std::vector<index_t> chunk_faces(num_chunks + 1, 0);
+    bputils::detail::parallel_chunks(num_chunks, num_slots,
+        [&] (index_t ci, index_t sbegin, index_t send)
+    {
+        index_t count = 0;
+        for(index_t slot = sbegin; slot < send; slot++)
         {
-            // TODO
+            count += (slot_reps[slot] == slot) ? 1 : 0;
         }
-        // mixed shape case
-        else if(topo_elems.number_of_children() != 0)
-        {
-            bool has_names = topo_elems.dtype().is_object();
+        chunk_faces[ci + 1] = count;
+    });
+    for(index_t ci = 0; ci < num_chunks; ci++)
+    {
+        chunk_faces[ci + 1] += chunk_faces[ci];
+    }
+    const index_t num_faces = chunk_faces[num_chunks];
 
-            NodeConstIterator itr = topo_elems.children();
-            while(itr.has_next())
+    std::vector<T> polyhedral_conn_data(num_slots);
+    std::vector<T> polygonal_conn_data(num_faces * face_indices);
+    bputils::detail::parallel_chunks(num_chunks, num_slots,
+        [&] (index_t ci, index_t sbegin, index_t send)
+    {
+        index_t face_id = chunk_faces[ci];
+        for(index_t slot = sbegin; slot < send; slot++)
+        {
+            if(slot_reps[slot] == slot)
             {
-                const Node &chld  = itr.next();
-                std::string name = itr.name();
-                Node &chld_info = has_names ? info["elements"][name] :
-                    info["elements"].append();
-
-                bool chld_res = true;
-                chld_res &= verify_field_exists(protocol, chld, chld_info, "shape") &&
-                       mesh::topology::shape::verify(chld["shape"], chld_info["shape"]);
-                chld_res &= verify_integer_field(protocol, chld, chld_info, "connectivity");
-
-                // Verify if child is polygonal or polyhedral
-                chld_res &= verify_poly_node (true, name, chld, chld_info, topo, info, elems_res);
-
-                log::validation(chld_info,chld_res);
-                elems_res &= chld_res;
+                std::copy(&slot_verts[slot * face_indices],
+                          &slot_verts[slot * face_indices] + face_indices,
+                          &polygonal_conn_data[face_id * face_indices]);
+                // (representatives record their face id in place)
+                slot_reps[slot] = -1 - face_id;
+                face_id++;
             }
         }
-        else
+    });
+    bputils::detail::parallel_chunks(num_chunks, num_slots,
+        [&] (index_t /*ci*/, index_t sbegin, index_t send)
+    {
+        for(index_t slot = sbegin; slot < send; slot++)
         {
-            log::error(info,protocol,"invalid child 'elements'");
-            res = false;
+            index_t rep = slot_reps[slot];
+            if(rep >= 0)
+            {
+                rep = slot_reps[rep];
+            }
+            polyhedral_conn_data[slot] = static_cast<T>(-1 - rep);
         }
+    });
 
-        log::validation(info_elems,elems_res);
-        res &= elems_res;
-        res &= subelems_res;
-    }
-
-    log::validation(info,res);
-
-    return res;
+    dest["elements/connectivity"].set(polyhedral_conn_data);
+    dest["elements/sizes"].set(std::vector<T>(topo_elems,
+        static_cast<T>(faces_per_elem)));
+    dest["subelements/connectivity"].set(polygonal_conn_data);
+    dest["subelements/sizes"].set(std::vector<T>(num_faces,
+        static_cast<T>(face_indices)));
 }
 
-
 //-----------------------------------------------------------------------------
 void
 mesh::topology::unstructured::to_polytopal(const Node &topo,
-                                           Node &dest)
+                                           Node &dest,
+                                           const Node &options)
 {
-    to_polygonal(topo,dest);
+    to_polygonal(topo, dest, options);
 }
 
 //-----------------------------------------------------------------------------
 void
 mesh::topology::unstructured::to_polygonal(const Node &topo,
                                            Node &dest)
+{
+    to_polygonal(topo, dest, Node());
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::to_polygonal(const Node &topo,
+                                           Node &dest,
+                                           const Node &options)
 {
     dest.reset();
+    const index_t num_threads = num_threads_option(options);
 
     const ShapeCascade topo_cascade(topo);
     const ShapeType topo_shape(topo_cascade.get_shape());
@@ -3805,9 +5353,7 @@ mesh::topology::unstructured::to_polygonal(const Node &topo,
     }
     else // if(!topo_shape.is_poly())
     {
-        const Node &topo_conn_const = topo["elements/connectivity"];
-        Node topo_conn; topo_conn.set_external(topo_conn_const);
-        const DataType topo_dtype(topo_conn.dtype().id(), 1);
+        const Node &topo_conn = topo["elements/connectivity"];
         const index_t topo_indices = topo_conn.dtype().number_of_elements();
         const index_t topo_elems = topo_indices / topo_shape.indices;
         const bool is_topo_3d = topo_shape.dim == 3;
@@ -3818,150 +5364,376 @@ mesh::topology::unstructured::to_polygonal(const Node &topo,
         dest.set(topo_templ);
         dest["elements/shape"].set(is_topo_3d ? "polyhedral" : "polygonal");
 
-        Node temp;
         if (!is_topo_3d) // polygonal
         {
             // NOTE(JRC): The derived polygonal topology simply inherits the
             // original implicit connectivity and adds sizes/offsets, which
             // means that it inherits the orientation/winding of the source as well.
-            temp.set_external(topo_conn);
-            temp.to_data_type(int_dtype.id(), dest["elements/connectivity"]);
+            topo_conn.to_data_type(int_dtype.id(), dest["elements/connectivity"]);
 
-            std::vector<int64> poly_size_data(topo_elems, topo_shape.indices);
-            temp.set_external(poly_size_data);
-            temp.to_data_type(int_dtype.id(), dest["elements/sizes"]);
+            Node &poly_sizes = dest["elements/sizes"];
+            if(int_dtype.is_int32())
+            {
+                poly_sizes.set(std::vector<int32>(topo_elems,
+                    static_cast<int32>(topo_shape.indices)));
+            }
+            else if(int_dtype.is_int64())
+            {
+                poly_sizes.set(std::vector<int64>(topo_elems,
+                    static_cast<int64>(topo_shape.indices)));
+            }
+            else
+            {
+                Node temp;
+                temp.set(std::vector<int64>(topo_elems, topo_shape.indices));
+                temp.to_data_type(int_dtype.id(), poly_sizes);
+            }
 
             utils::topology::unstructured::generate_offsets_inline(dest);
         }
         else // if(is_topo_3d) // polyhedral
         {
-            // NOTE(JRC): Polyhedral topologies are a bit more complicated
-            // because the derivation comes from the embedding. The embedding
-            // is statically RHR positive, but this can be turned negative by
-            // an initially RHR negative element.
-            const ShapeType embed_shape = topo_cascade.get_shape(topo_shape.dim - 1);
+            if(int_dtype.is_int32())
+            {
+                to_polyhedral_typed<int32>(topo_conn, topo_cascade, num_threads, dest);
+            }
+            else if(int_dtype.is_int64())
+            {
+                to_polyhedral_typed<int64>(topo_conn, topo_cascade, num_threads, dest);
+            }
+            else
+            {
+                Node dest_int64;
+                to_polyhedral_typed<int64>(topo_conn, topo_cascade, num_threads, dest_int64);
+                const char *int_paths[] = {"elements/connectivity",
+                                           "elements/sizes",
+                                           "subelements/connectivity",
+                                           "subelements/sizes"};
+                for(index_t pi = 0; pi < 4; pi++)
+                {
+                    dest_int64[int_paths[pi]].to_data_type(int_dtype.id(),
+                                                           dest[int_paths[pi]]);
+                }
+            }
 
-            std::vector<int64> polyhedral_conn_data(topo_elems * topo_shape.embed_count);
-            std::vector<int64> polygonal_conn_data;
-            std::vector<int64> face_indices(embed_shape.indices);
+            dest["subelements/shape"].set("polygonal");
 
-            // Generate each polyhedral element by generating its constituent
-            // polygonal faces. Also, make sure that faces connecting the same
-            // set of vertices aren't duplicated; reuse the ID generated by the
-            // first polyhedral element to create the polygonal face.
-            for (index_t ei = 0; ei < topo_elems; ei++)
-            {
-                index_t data_off = topo_shape.indices * ei;
-                index_t polyhedral_off = topo_shape.embed_count * ei;
+            utils::topology::unstructured::generate_offsets_inline(dest);
+        }
+    }
+}
 
-                for (index_t fi = 0; fi < topo_shape.embed_count; fi++)
-                {
-                    for (index_t ii = 0; ii < embed_shape.indices; ii++)
-                    {
-                        index_t inner_data_off = data_off +
-                          topo_shape.embedding[fi * embed_shape.indices + ii];
-                        temp.set_external(topo_dtype,
-                            topo_conn.element_ptr(inner_data_off));
-                        face_indices[ii] = temp.to_int64();
-                    }
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_points(const Node &topo,
+                                              Node &dest,
+                                              Node &s2dmap,
+                                              Node &d2smap)
+{
+    Node opts;
+    generate_points(topo, dest, s2dmap, d2smap, opts);
+}
 
-                    bool face_exists = false;
-                    index_t face_index = polygonal_conn_data.size() / embed_shape.indices;
-                    for (index_t poly_i = 0; poly_i < face_index; poly_i++)
-                    {
-                        index_t face_off = poly_i * embed_shape.indices;
-                        face_exists |= std::is_permutation(polygonal_conn_data.begin() + face_off,
-                                                           polygonal_conn_data.begin() + face_off + embed_shape.indices,
-                                                           face_indices.begin());
-                        face_index = face_exists ? poly_i : face_index;
-                    }
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_points(const Node &topo,
+                                              Node &dest,
+                                              Node &s2dmap,
+                                              Node &d2smap,
+                                              const Node &options)
+{
+    // TODO(JRC): Revise this function so that it works on every base topology
+    // type and then move it to "mesh::topology::{uniform|...}::generate_points".
+    const Node *coordset = bputils::find_reference_node(topo, "coordset");
+    if(is_structured_topology(topo))
+    {
+        generate_structured_entities(topo, *coordset, 0,
+            num_threads_option(options), dest, s2dmap, d2smap);
+        return;
+    }
 
-                    polyhedral_conn_data[polyhedral_off + fi] = face_index;
-                    if (!face_exists)
-                    {
-                        polygonal_conn_data.insert(polygonal_conn_data.end(),
-                            face_indices.begin(), face_indices.end());
-                    }
-                }
-            }
+    Node topo_data_opts;
+    topology_metadata_dim_options(options, topo, 0, topo_data_opts);
+    TopologyMetadata topo_data(topo, *coordset, topo_data_opts);
+    dest.reset();
+    dest.set(topo_data.dim_topos[0]);
+
+    const index_t src_dim = topo_data.topo_cascade.dim, dst_dim = 0;
+    topo_data.get_dim_map(TopologyMetadata::GLOBAL, src_dim, dst_dim, s2dmap);
+    topo_data.get_dim_map(TopologyMetadata::GLOBAL, dst_dim, src_dim, d2smap);
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_lines(const Node &topo,
+                                             Node &dest,
+                                             Node &s2dmap,
+                                             Node &d2smap)
+{
+    Node opts;
+    generate_lines(topo, dest, s2dmap, d2smap, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_lines(const Node &topo,
+                                             Node &dest,
+                                             Node &s2dmap,
+                                             Node &d2smap,
+                                             const Node &options)
+{
+    // TODO(JRC): Revise this function so that it works on every base topology
+    // type and then move it to "mesh::topology::{uniform|...}::generate_lines".
+    const Node *coordset = bputils::find_reference_node(topo, "coordset");
+    if(is_structured_topology(topo))
+    {
+        generate_structured_entities(topo, *coordset, 1,
+            num_threads_option(options), dest, s2dmap, d2smap);
+        return;
+    }
+
+    Node topo_data_opts;
+    topology_metadata_dim_options(options, topo, 1, topo_data_opts);
+    TopologyMetadata topo_data(topo, *coordset, topo_data_opts);
+    dest.reset();
+    dest.set(topo_data.dim_topos[1]);
 
-            temp.set_external(polyhedral_conn_data);
-            temp.to_data_type(int_dtype.id(), dest["elements/connectivity"]);
+    const index_t src_dim = topo_data.topo_cascade.dim, dst_dim = 1;
+    topo_data.get_dim_map(TopologyMetadata::GLOBAL, src_dim, dst_dim, s2dmap);
+    topo_data.get_dim_map(TopologyMetadata::GLOBAL, dst_dim, src_dim, d2smap);
+}
 
-            std::vector<int64> polyhedral_size_data(topo_elems, topo_shape.embed_count);
-            temp.set_external(polyhedral_size_data);
-            temp.to_data_type(int_dtype.id(), dest["elements/sizes"]);
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_faces(const Node &topo,
+                                             Node &dest,
+                                             Node &s2dmap,
+                                             Node &d2smap)
+{
+    Node opts;
+    generate_faces(topo, dest, s2dmap, d2smap, opts);
+}
 
-            temp.set_external(polygonal_conn_data);
-            temp.to_data_type(int_dtype.id(), dest["subelements/connectivity"]);
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_faces(const Node &topo,
+                                             Node &dest,
+                                             Node &s2dmap,
+                                             Node &d2smap,
+                                             const Node &options)
+{
+    // TODO(JRC): Revise this function so that it works on every base topology
+    // type and then move it to "mesh::topology::{uniform|...}::generate_faces".
+    const Node *coordset = bputils::find_reference_node(topo, "coordset");
+    if(is_structured_topology(topo))
+    {
+        generate_structured_entities(topo, *coordset, 2,
+            num_threads_option(options), dest, s2dmap, d2smap);
+        return;
+    }
 
-            std::vector<int64> polygonal_size_data(polygonal_conn_data.size() / embed_shape.indices,
-                                                   embed_shape.indices);
-            temp.set_external(polygonal_size_data);
-            temp.to_data_type(int_dtype.id(), dest["subelements/sizes"]);
+    Node topo_data_opts;
+    topology_metadata_dim_options(options, topo, 2, topo_data_opts);
+    TopologyMetadata topo_data(topo, *coordset, topo_data_opts);
+    dest.reset();
+    dest.set(topo_data.dim_topos[2]);
 
-            dest["subelements/shape"].set("polygonal");
+    const index_t src_dim = topo_data.topo_cascade.dim, dst_dim = 2;
+    topo_data.get_dim_map(TopologyMetadata::GLOBAL, src_dim, dst_dim, s2dmap);
+    topo_data.get_dim_map(TopologyMetadata::GLOBAL, dst_dim, src_dim, d2smap);
+}
+
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// Device path of 'generate_centroids' for single shape unstructured
+// topologies with explicit coordsets, using the fixed_centroids kernel of
+// the connectivity's allocator. Returns false (leaving the destinations in
+// an unspecified state) if the topology or the kernel don't support it.
+bool
+device_fixed_centroids(const Node &topo,
+                       const Node &coordset,
+                       Node &dest,
+                       Node &cdest,
+                       index_t &alloc_id)
+{
+    if(topo["type"].as_string() != "unstructured" ||
+       coordset["type"].as_string() != "explicit" ||
+       !has_fixed_centroids(topo))
+    {
+        return false;
+    }
+
+    const Node &topo_conn = topo["elements/connectivity"];
+    alloc_id = bpexec::device_allocator(topo_conn);
+    const bpexec::DeviceKernels *kernels = bpexec::device_kernels(alloc_id);
+    if(kernels == NULL || kernels->fixed_centroids == NULL ||
+       bpexec::device_allocator(coordset["values"]) != alloc_id)
+    {
+        return false;
+    }
+
+    const ShapeType topo_shape(topo);
+    const index_t topo_num_elems = topo_conn.dtype().number_of_elements() /
+                                   topo_shape.indices;
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(coordset);
+
+    DataType int_dtype, float_dtype;
+    {
+        conduit::Node src_node;
+        src_node["topology"].set_external(topo);
+        src_node["coordset"].set_external(coordset);
+        int_dtype = bputils::find_widest_dtype(src_node, bputils::DEFAULT_INT_DTYPES);
+        float_dtype = bputils::find_widest_dtype(src_node, bputils::DEFAULT_FLOAT_DTYPE);
+    }
+
+    // the point topology's connectivity is an iota, made on the host
+    Node conn(DataType::int64(topo_num_elems));
+    int64 *conn_vals = conn.as_int64_ptr();
+    for(index_t ei = 0; ei < topo_num_elems; ei++)
+    {
+        conn_vals[ei] = static_cast<int64>(ei);
+    }
+    Node host_conn;
+    conn.to_data_type(int_dtype.id(), host_conn);
+
+    dest.reset();
+    dest["type"].set("unstructured");
+    dest["coordset"].set(cdest.name());
+    dest["elements/shape"].set("point");
+    Node &dest_conn = dest["elements/connectivity"];
+    dest_conn.set_allocator(alloc_id);
+    dest_conn.set(host_conn);
 
-            utils::topology::unstructured::generate_offsets_inline(dest);
-        }
+    cdest.reset();
+    cdest["type"].set("explicit");
+    Node &cdest_values = cdest["values"];
+    for(index_t ai = 0; ai < (index_t)csys_axes.size(); ai++)
+    {
+        Node &cdest_axis = cdest_values[csys_axes[ai]];
+        cdest_axis.set_allocator(alloc_id);
+        cdest_axis.set(DataType(float_dtype.id(), topo_num_elems));
     }
+
+    return kernels->fixed_centroids(topo_conn, topo_shape.indices,
+                                    coordset["values"], cdest_values);
 }
 
 //-----------------------------------------------------------------------------
+// shared implementation of the 'generate_centroids' variants. Element
+// measures are only computed when 'measures_dest' isn't NULL.
 void
-mesh::topology::unstructured::generate_points(const Node &topo,
-                                              Node &dest,
-                                              Node &s2dmap,
-                                              Node &d2smap)
+generate_centroids(const Node &topo,
+                   Node &topo_dest,
+                   Node &coords_dest,
+                   Node &s2dmap,
+                   Node &d2smap,
+                   Node *measures_dest,
+                   index_t num_threads)
 {
     // TODO(JRC): Revise this function so that it works on every base topology
-    // type and then move it to "mesh::topology::{uniform|...}::generate_points".
+    // type and then move it to "mesh::topology::{uniform|...}::generate_centroids".
     const Node *coordset = bputils::find_reference_node(topo, "coordset");
-    TopologyMetadata topo_data(topo, *coordset);
-    dest.reset();
-    dest.set(topo_data.dim_topos[0]);
 
-    const index_t src_dim = topo_data.topo_cascade.dim, dst_dim = 0;
-    topo_data.get_dim_map(TopologyMetadata::GLOBAL, src_dim, dst_dim, s2dmap);
-    topo_data.get_dim_map(TopologyMetadata::GLOBAL, dst_dim, src_dim, d2smap);
+    index_t device_alloc_id = -1;
+    const bpexec::Backend backend = bpexec::select_backend(topo, *coordset);
+    if(backend == bpexec::BACKEND_HOST_STAGED ||
+       (backend == bpexec::BACKEND_DEVICE &&
+        (measures_dest != NULL ||
+         !device_fixed_centroids(topo, *coordset, topo_dest, coords_dest,
+                                 device_alloc_id))))
+    {
+        Node host;
+        const Node &host_topo = bpexec::to_host_topology(topo, host);
+        generate_centroids(host_topo, topo_dest, coords_dest, s2dmap, d2smap,
+                           measures_dest, num_threads);
+        return;
+    }
+
+    const index_t topo_num_elems = bputils::topology::length(topo);
+    if(device_alloc_id >= 0)
+    {
+        // computed by device_fixed_centroids
+    }
+    else if(has_fixed_centroids(topo))
+    {
+        float64 *measures = NULL;
+        if(measures_dest != NULL)
+        {
+            measures_dest->reset();
+            (*measures_dest)["association"].set("element");
+            (*measures_dest)["topology"].set(topo.name());
+            (*measures_dest)["values"].set(DataType::float64(topo_num_elems));
+            measures = (*measures_dest)["values"].as_float64_ptr();
+        }
+        calculate_fixed_centroids(topo, *coordset, num_threads,
+                                  topo_dest, coords_dest, measures);
+    }
+    else
+    {
+        if(measures_dest != NULL)
+        {
+            CONDUIT_ERROR("generate_centroids: element measures are only "
+                          "supported for single shape unstructured and for "
+                          "uniform, rectilinear and structured topologies");
+        }
+        calculate_unstructured_centroids(topo, *coordset, topo_dest, coords_dest);
+    }
+
+    DataType int_dtype = bputils::find_widest_dtype(bputils::link_nodes(topo, *coordset), bputils::DEFAULT_INT_DTYPES);
+    Node map_node(DataType::int64(2 * topo_num_elems));
+    int64 *map_vals = map_node.as_int64_ptr();
+    for(index_t ei = 0; ei < topo_num_elems; ei++)
+    {
+        map_vals[2 * ei] = 1;
+        map_vals[2 * ei + 1] = static_cast<int64>(ei);
+    }
+
+    s2dmap.reset();
+    d2smap.reset();
+    if(device_alloc_id >= 0)
+    {
+        Node host_map;
+        map_node.to_data_type(int_dtype.id(), host_map);
+        s2dmap.set_allocator(device_alloc_id);
+        d2smap.set_allocator(device_alloc_id);
+        s2dmap.set(host_map);
+        d2smap.set(host_map);
+    }
+    else
+    {
+        map_node.to_data_type(int_dtype.id(), s2dmap);
+        map_node.to_data_type(int_dtype.id(), d2smap);
+    }
 }
 
+} // end namespace detail
+
 //-----------------------------------------------------------------------------
 void
-mesh::topology::unstructured::generate_lines(const Node &topo,
-                                             Node &dest,
-                                             Node &s2dmap,
-                                             Node &d2smap)
+mesh::topology::unstructured::generate_centroids(const Node &topo,
+                                                 Node &topo_dest,
+                                                 Node &coords_dest,
+                                                 Node &s2dmap,
+                                                 Node &d2smap)
 {
-    // TODO(JRC): Revise this function so that it works on every base topology
-    // type and then move it to "mesh::topology::{uniform|...}::generate_lines".
-    const Node *coordset = bputils::find_reference_node(topo, "coordset");
-    TopologyMetadata topo_data(topo, *coordset);
-    dest.reset();
-    dest.set(topo_data.dim_topos[1]);
-
-    const index_t src_dim = topo_data.topo_cascade.dim, dst_dim = 1;
-    topo_data.get_dim_map(TopologyMetadata::GLOBAL, src_dim, dst_dim, s2dmap);
-    topo_data.get_dim_map(TopologyMetadata::GLOBAL, dst_dim, src_dim, d2smap);
+    Node opts;
+    generate_centroids(topo, topo_dest, coords_dest, s2dmap, d2smap, opts);
 }
 
 //-----------------------------------------------------------------------------
 void
-mesh::topology::unstructured::generate_faces(const Node &topo,
-                                             Node &dest,
-                                             Node &s2dmap,
-                                             Node &d2smap)
+mesh::topology::unstructured::generate_centroids(const Node &topo,
+                                                 Node &topo_dest,
+                                                 Node &coords_dest,
+                                                 Node &s2dmap,
+                                                 Node &d2smap,
+                                                 const Node &options)
 {
-    // TODO(JRC): Revise this function so that it works on every base topology
-    // type and then move it to "mesh::topology::{uniform|...}::generate_faces".
-    const Node *coordset = bputils::find_reference_node(topo, "coordset");
-    TopologyMetadata topo_data(topo, *coordset);
-    dest.reset();
-    dest.set(topo_data.dim_topos[2]);
-
-    const index_t src_dim = topo_data.topo_cascade.dim, dst_dim = 2;
-    topo_data.get_dim_map(TopologyMetadata::GLOBAL, src_dim, dst_dim, s2dmap);
-    topo_data.get_dim_map(TopologyMetadata::GLOBAL, dst_dim, src_dim, d2smap);
+    detail::generate_centroids(topo, topo_dest, coords_dest, s2dmap, d2smap,
+                               NULL, num_threads_option(options));
 }
 
 //-----------------------------------------------------------------------------
@@ -3970,36 +5742,28 @@ mesh::topology::unstructured::generate_centroids(const Node &topo,
                                                  Node &topo_dest,
                                                  Node &coords_dest,
                                                  Node &s2dmap,
-                                                 Node &d2smap)
+                                                 Node &d2smap,
+                                                 Node &measures_dest,
+                                                 const Node &options)
 {
-    // TODO(JRC): Revise this function so that it works on every base topology
-    // type and then move it to "mesh::topology::{uniform|...}::generate_centroids".
-    const Node *coordset = bputils::find_reference_node(topo, "coordset");
-    calculate_unstructured_centroids(topo, *coordset, topo_dest, coords_dest);
-
-    Node map_node;
-    std::vector<index_t> map_vec;
-    for(index_t ei = 0; ei < bputils::topology::length(topo); ei++)
-    {
-        map_vec.push_back(1);
-        map_vec.push_back(ei);
-    }
-    map_node.set(map_vec);
-
-    DataType int_dtype = bputils::find_widest_dtype(bputils::link_nodes(topo, *coordset), bputils::DEFAULT_INT_DTYPES);
-    s2dmap.reset();
-    d2smap.reset();
-    map_node.to_data_type(int_dtype.id(), s2dmap);
-    map_node.to_data_type(int_dtype.id(), d2smap);
+    detail::generate_centroids(topo, topo_dest, coords_dest, s2dmap, d2smap,
+                               &measures_dest, num_threads_option(options));
 }
 
 //-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// shared implementation of the 'generate_sides' variants, with the number
+// of threads used to build the topology's 'TopologyMetadata'
 void
-mesh::topology::unstructured::generate_sides(const Node &topo,
-                                             Node &topo_dest,
-                                             Node &coords_dest,
-                                             Node &s2dmap,
-                                             Node &d2smap)
+generate_sides(const Node &topo,
+               Node &topo_dest,
+               Node &coords_dest,
+               Node &s2dmap,
+               Node &d2smap,
+               index_t num_threads)
 {
     // Retrieve Relevent Coordinate/Topology Metadata //
 
@@ -4018,7 +5782,7 @@ mesh::topology::unstructured::generate_sides(const Node &topo,
 
     // Extract Derived Coordinate/Topology Data //
 
-    const TopologyMetadata topo_data(topo, *coordset);
+    const TopologyMetadata topo_data(topo, *coordset, num_threads);
     const DataType &int_dtype = topo_data.int_dtype;
     const DataType &float_dtype = topo_data.float_dtype;
 
@@ -4137,7 +5901,7 @@ mesh::topology::unstructured::generate_sides(const Node &topo,
 
             // NOTE(JRC): We iterate using local index values so that we
             // get the correct orientations for per-element lines.
-            const std::vector<index_t> &embed_ids = topo_data.get_entity_assocs(
+            const Span<const index_t> embed_ids = topo_data.get_entity_assocs(
                 TopologyMetadata::LOCAL, embed_index, embed_dim, embed_dim - 1);
             if(embed_dim > line_shape.dim)
             {
@@ -4204,9 +5968,6 @@ mesh::topology::unstructured::generate_sides(const Node &topo,
     blueprint::o2mrelation::generate_offsets(d2smap, info);
 }
 
-//-----------------------------------------------------------------------------
-namespace detail
-{
     class vec3
     {
     public:
@@ -5039,6 +6800,18 @@ namespace detail
     }
 } // end namespace detail
 
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_sides(const Node &topo,
+                                             Node &topo_dest,
+                                             Node &coords_dest,
+                                             Node &s2dmap,
+                                             Node &d2smap)
+{
+    detail::generate_sides(topo, topo_dest, coords_dest, s2dmap, d2smap, 1);
+}
+
+//-----------------------------------------------------------------------------
 void
 mesh::topology::unstructured::generate_sides(const conduit::Node &topo_src,
                                              conduit::Node &topo_dest,
@@ -5105,7 +6878,8 @@ mesh::topology::unstructured::generate_sides(const conduit::Node &topo_src,
     }
 
     // generate sides as usual
-    generate_sides(topo_src, topo_dest, coordset_dest, s2dmap, d2smap);
+    detail::generate_sides(topo_src, topo_dest, coordset_dest, s2dmap, d2smap,
+                           num_threads_option(options));
 
     // now map fields
     if (d2smap["values"].dtype().is_uint64())
@@ -5190,6 +6964,19 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
                                                Node &coords_dest,
                                                Node &s2dmap,
                                                Node &d2smap)
+{
+    Node opts;
+    generate_corners(topo, topo_dest, coords_dest, s2dmap, d2smap, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_corners(const Node &topo,
+                                               Node &topo_dest,
+                                               Node &coords_dest,
+                                               Node &s2dmap,
+                                               Node &d2smap,
+                                               const Node &options)
 {
     // Retrieve Relevent Coordinate/Topology Metadata //
 
@@ -5211,7 +6998,8 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
 
     // Extract Derived Coordinate/Topology Data //
 
-    const TopologyMetadata topo_data(topo, *coordset);
+    const TopologyMetadata topo_data(topo, *coordset,
+                                     num_threads_option(options));
     const index_t topo_num_elems = topo_data.get_length(topo_shape.dim);
     const DataType &int_dtype = topo_data.int_dtype;
     const DataType &float_dtype = topo_data.float_dtype;
@@ -5295,21 +7083,21 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
         // per-face, per-line orientations for this element, i.e. {(f_gi, l_gj) => (v_gk, v_gl)}
         std::map< std::pair<index_t, index_t>, std::pair<index_t, index_t> > elem_orient;
         { // establish the element's internal line constraints
-            const std::vector<index_t> &elem_faces = topo_data.get_entity_assocs(
+            const Span<const index_t> elem_faces = topo_data.get_entity_assocs(
                 TopologyMetadata::LOCAL, elem_index, topo_shape.dim, face_shape.dim);
             for(index_t fi = 0; fi < (index_t)elem_faces.size(); fi++)
             {
                 const index_t face_lid = elem_faces[fi];
                 const index_t face_gid = topo_data.dim_le2ge_maps[face_shape.dim][face_lid];
 
-                const std::vector<index_t> &face_lines = topo_data.get_entity_assocs(
+                const Span<const index_t> face_lines = topo_data.get_entity_assocs(
                     TopologyMetadata::LOCAL, face_lid, face_shape.dim, line_shape.dim);
                 for(index_t li = 0; li < (index_t)face_lines.size(); li++)
                 {
                     const index_t line_lid = face_lines[li];
                     const index_t line_gid = topo_data.dim_le2ge_maps[line_shape.dim][line_lid];
 
-                    const std::vector<index_t> &line_points = topo_data.get_entity_assocs(
+                    const Span<const index_t> line_points = topo_data.get_entity_assocs(
                         TopologyMetadata::LOCAL, line_lid, line_shape.dim, point_shape.dim);
                     const index_t start_gid = topo_data.dim_le2ge_maps[point_shape.dim][line_points[0]];
                     const index_t end_gid = topo_data.dim_le2ge_maps[point_shape.dim][line_points[1]];
@@ -5320,9 +7108,9 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
             }
         }
 
-        const std::vector<index_t> &elem_lines = topo_data.get_entity_assocs(
+        const Span<const index_t> elem_lines = topo_data.get_entity_assocs(
             TopologyMetadata::GLOBAL, elem_index, topo_shape.dim, line_shape.dim);
-        const std::vector<index_t> &elem_faces = topo_data.get_entity_assocs(
+        const Span<const index_t> elem_faces = topo_data.get_entity_assocs(
             TopologyMetadata::GLOBAL, elem_index, topo_shape.dim, face_shape.dim);
 
         // NOTE(JRC): Corner ordering retains original element orientation
@@ -5382,15 +7170,15 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
         //
 
         // per-elem, per-point corners, informed by cell-face-line orientation constraints
-        const std::vector<index_t> &elem_points = topo_data.get_entity_assocs(
+        const Span<const index_t> elem_points = topo_data.get_entity_assocs(
             TopologyMetadata::GLOBAL, elem_index, topo_shape.dim, point_shape.dim);
         for(index_t pi = 0; pi < (index_t)elem_points.size(); pi++, corner_index++)
         {
             const index_t point_index = elem_points[pi];
 
-            const std::vector<index_t> &point_faces = topo_data.get_entity_assocs(
+            const Span<const index_t> point_faces = topo_data.get_entity_assocs(
                 TopologyMetadata::GLOBAL, point_index, point_shape.dim, face_shape.dim);
-            const std::vector<index_t> &point_lines = topo_data.get_entity_assocs(
+            const Span<const index_t> point_lines = topo_data.get_entity_assocs(
                 TopologyMetadata::GLOBAL, point_index, point_shape.dim, line_shape.dim);
             const std::vector<index_t> elem_point_faces = intersect_sets(
                 elem_faces, point_faces);
@@ -5414,7 +7202,7 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
             {
                 const index_t face_index = elem_point_faces[fi];
 
-                const std::vector<index_t> &elem_face_lines = topo_data.get_entity_assocs(
+                const Span<const index_t> elem_face_lines = topo_data.get_entity_assocs(
                     TopologyMetadata::GLOBAL, face_index, face_shape.dim, line_shape.dim);
                 const std::vector<index_t> corner_face_lines = intersect_sets(
                     elem_face_lines, point_lines);
@@ -5448,7 +7236,7 @@ mesh::topology::unstructured::generate_corners(const Node &topo,
             {
                 const index_t line_index = elem_point_lines[li];
 
-                const std::vector<index_t> &line_faces = topo_data.get_entity_assocs(
+                const Span<const index_t> line_faces = topo_data.get_entity_assocs(
                     TopologyMetadata::GLOBAL, line_index, line_shape.dim, face_shape.dim);
                 const std::vector<index_t> corner_line_faces = intersect_sets(
                     elem_faces, line_faces);
@@ -5590,6 +7378,19 @@ mesh::topology::unstructured::generate_offsets(const Node &topo,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_offsets(const Node &topo,
+                                               Node &dest_eleoffsets,
+                                               Node &dest_subeleoffsets,
+                                               const Node &options)
+{
+    return bputils::topology::unstructured::generate_offsets(topo,
+                                                             dest_eleoffsets,
+                                                             dest_subeleoffsets,
+                                                             num_threads_option(options));
+}
+
 //-----------------------------------------------------------------------------
 void
 mesh::topology::unstructured::generate_offsets_inline(Node &topo)
@@ -5597,6 +7398,15 @@ mesh::topology::unstructured::generate_offsets_inline(Node &topo)
     return bputils::topology::unstructured::generate_offsets_inline(topo);
 }
 
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_offsets_inline(Node &topo,
+                                                      const Node &options)
+{
+    return bputils::topology::unstructured::generate_offsets_inline(topo,
+        num_threads_option(options));
+}
+
 //-----------------------------------------------------------------------------
 // blueprint::mesh::topology::index protocol interface
 //-----------------------------------------------------------------------------
@@ -6022,7 +7832,15 @@ mesh::field::verify(const Node &field,
     else if(has_topo && has_topo_values)
     {
         res &= verify_string_field(protocol, field, info, "topology");
-        res &= verify_mlarray_field(protocol, field, info, "values", 0, 1, false);
+        // values may also be held zfp compressed, without decompressing them
+        if(is_zfparray_field(field["values"]))
+        {
+            res &= verify_zfparray_field(protocol, field, info, "values");
+        }
+        else
+        {
+            res &= verify_mlarray_field(protocol, field, info, "values", 0, 1, false);
+        }
     }
 
     if(has_matset ^ has_matset_values)
@@ -6056,7 +7874,17 @@ mesh::field::generate_strip(Node& fields,
                             const std::string& toponame,
                             const std::string& dest_toponame)
 {
-    Node newfields;
+    generate_strip(fields, toponame, dest_toponame, Node());
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::field::generate_strip(Node& fields,
+                            const std::string& toponame,
+                            const std::string& dest_toponame,
+                            const Node& options)
+{
+    std::vector<std::string> strip_names, strip_dest_names;
 
     NodeConstIterator fields_it = fields.children();
     while (fields_it.has_next())
@@ -6070,9 +7898,8 @@ mesh::field::generate_strip(Node& fields,
             {
                 if (field["association"].as_string() == "element")
                 {
-                    const std::string newfieldname = dest_toponame + "_" + fields_it.name();
-                    newfields[newfieldname] = field;
-                    newfields[newfieldname]["topology"] = dest_toponame;
+                    strip_names.push_back(fields_it.name());
+                    strip_dest_names.push_back(dest_toponame + "_" + fields_it.name());
                 }
                 else
                 {
@@ -6083,12 +7910,10 @@ mesh::field::generate_strip(Node& fields,
         }
     }
 
-    NodeConstIterator newfields_it = newfields.children();
-    while (newfields_it.has_next())
-    {
-        const Node& newfield = newfields_it.next();
-        fields[newfields_it.name()] = newfield;
-    }
+    const bool external = options.has_child("external") &&
+                          options["external"].to_index_t() != 0;
+    generate_strip_fields(fields, strip_names, strip_dest_names, dest_toponame,
+                          num_threads_option(options), external, fields);
 }
 
 //-----------------------------------------------------------------------------
@@ -6402,84 +8227,46 @@ mesh::adjset::is_maxshare(const Node &adjset)
 }
 
 //-----------------------------------------------------------------------------
-void
-mesh::adjset::to_pairwise(const Node &adjset,
-                          Node &dest)
+static void
+adjset_to_pairwise(const Node &adjset,
+                   Node &dest)
 {
     dest.reset();
 
     const DataType int_dtype = bputils::find_widest_dtype(adjset, bputils::DEFAULT_INT_DTYPES);
 
-    // NOTE(JRC): We assume that group names are shared across ranks, but
-    // make no assumptions on the uniqueness of a set of neighbors for a group
-    // (i.e. the same set of neighbors can be used in >1 groups).
-    std::vector<std::string> adjset_group_names = adjset["groups"].child_names();
-    std::sort(adjset_group_names.begin(), adjset_group_names.end());
-
-    // Compile ordered lists for each neighbor containing their unique lists
-    // of 'adjset' entity indices, as compiled from all groups in the source 'adjset'.
-    std::map<index_t, std::vector<index_t>> pair_values_map;
-    for(const std::string &group_name : adjset_group_names)
-    {
-        const Node &group_node = adjset["groups"][group_name];
-
-        std::vector<index_t> group_neighbors;
-        {
-            const Node &group_nvals = group_node["neighbors"];
-            for(index_t ni = 0; ni < group_nvals.dtype().number_of_elements(); ++ni)
-            {
-                Node temp(DataType(group_nvals.dtype().id(), 1),
-                    (void*)group_nvals.element_ptr(ni), true);
-                group_neighbors.push_back(temp.to_index_t());
-            }
-        }
-
-        std::vector<index_t> group_values;
-        {
-            const Node &group_vals = group_node["values"];
-            for(index_t vi = 0; vi < group_vals.dtype().number_of_elements(); ++vi)
-            {
-                Node temp(DataType(group_vals.dtype().id(), 1),
-                    (void*)group_vals.element_ptr(vi), true);
-                group_values.push_back(temp.to_index_t());
-            }
-        }
+    // Compile ordered lists for each neighbor containing their lists of
+    // 'adjset' entity indices, as compiled from all groups in the source 'adjset'.
+    std::vector<index_t> nbrs, offsets, values;
+    bputils::adjset::pairwise_values(adjset, nbrs, offsets, values);
 
-        for(const index_t &neighbor_id : group_neighbors)
-        {
-            std::vector<index_t> &neighbor_values = pair_values_map[neighbor_id];
-            neighbor_values.insert(neighbor_values.end(),
-                group_values.begin(), group_values.end());
-        }
-    }
+    std::vector<index_t> nbrs_offsets(nbrs.size() + 1);
+    std::iota(nbrs_offsets.begin(), nbrs_offsets.end(), 0);
+    bputils::adjset::write_flat_groups(adjset, int_dtype, nbrs_offsets, nbrs, offsets, values, dest);
+}
 
-    // Given ordered lists of adjset values per neighbor, generate the destination
-    // adjset hierarchy.
-    Node adjset_template;
-    adjset_template.set_external(adjset);
-    adjset_template.remove("groups");
+//-----------------------------------------------------------------------------
+static void
+adjset_to_maxshare(const Node &adjset,
+                   Node &dest)
+{
+    dest.reset();
 
-    dest.set(adjset_template);
-    dest["groups"].set(DataType::object());
+    const DataType int_dtype = bputils::find_widest_dtype(adjset, bputils::DEFAULT_INT_DTYPES);
 
-    for(const auto &pair_values_pair : pair_values_map)
-    {
-        const index_t &neighbor_id = pair_values_pair.first;
-        const std::vector<index_t> &neighbor_values = pair_values_pair.second;
+    std::vector<index_t> nbrs_offsets, nbrs, values_offsets, values;
+    bputils::adjset::maxshare_values(adjset, nbrs_offsets, nbrs,
+                                     values_offsets, values);
+    bputils::adjset::write_flat_groups(adjset, int_dtype, nbrs_offsets, nbrs,
+                      values_offsets, values, dest);
+}
 
-        Node &group_node = dest["groups"][std::to_string(dest["groups"].number_of_children())];
-        group_node["neighbors"].set(DataType(int_dtype.id(), 1));
-        {
-            Node temp(DataType::index_t(1), (void*)&neighbor_id, true);
-            temp.to_data_type(int_dtype.id(), group_node["neighbors"]);
-        }
-        group_node["values"].set(DataType(int_dtype.id(), neighbor_values.size()));
-        {
-            Node temp(DataType::index_t(neighbor_values.size()),
-                (void*)neighbor_values.data(), true);
-            temp.to_data_type(int_dtype.id(), group_node["values"]);
-        }
-    }
+//-----------------------------------------------------------------------------
+void
+mesh::adjset::to_pairwise(const Node &adjset,
+                          Node &dest)
+{
+    adjset_to_pairwise(adjset, dest);
     bputils::adjset::canonicalize(dest);
 }
 
@@ -6488,117 +8275,75 @@ void
 mesh::adjset::to_maxshare(const Node &adjset,
                           Node &dest)
 {
-    dest.reset();
-
-    const DataType int_dtype = bputils::find_widest_dtype(adjset, bputils::DEFAULT_INT_DTYPES);
+    adjset_to_maxshare(adjset, dest);
+    bputils::adjset::canonicalize(dest);
+}
 
-    // NOTE(JRC): We assume that group names are shared across ranks, but
-    // make no assumptions on the uniqueness of a set of neighbors for a group
-    // (i.e. the same set of neighbors can be used in >1 groups).
-    std::vector<std::string> adjset_group_names = adjset["groups"].child_names();
-    std::sort(adjset_group_names.begin(), adjset_group_names.end());
+//-----------------------------------------------------------------------------
+// converts the adjset_name adjset of each domain of mesh with 'convert' on
+// up to 'num_threads' threads, the domains are converted concurrently
+template <typename ConvertFunc>
+static void
+convert_mesh_adjsets(Node &mesh,
+                     const std::string &adjset_name,
+                     const std::string &dest_adjset_name,
+                     const Node &options,
+                     const ConvertFunc &convert)
+{
+    const index_t num_threads = num_threads_option(options);
+    std::vector<Node *> doms = mesh::domains(mesh);
 
-    std::map<index_t, std::set<index_t>> entity_groupset_map;
-    for(const std::string &group_name : adjset_group_names)
+    std::vector<Node *> conv_doms;
+    for(Node *dom : doms)
     {
-        const Node &group_node = adjset["groups"][group_name];
-
-        std::vector<index_t> group_neighbors;
-        {
-            const Node &group_nvals = group_node["neighbors"];
-            for(index_t ni = 0; ni < group_nvals.dtype().number_of_elements(); ++ni)
-            {
-                Node temp(DataType(group_nvals.dtype().id(), 1),
-                    (void*)group_nvals.element_ptr(ni), true);
-                group_neighbors.push_back(temp.to_index_t());
-            }
-        }
-
-        std::vector<index_t> group_values;
-        {
-            const Node &group_vals = group_node["values"];
-            for(index_t vi = 0; vi < group_vals.dtype().number_of_elements(); ++vi)
-            {
-                Node temp(DataType(group_vals.dtype().id(), 1),
-                    (void*)group_vals.element_ptr(vi), true);
-                group_values.push_back(temp.to_index_t());
-            }
-        }
-
-        for(const index_t &entity_id : group_values)
+        if(dom->has_child("adjsets") && (*dom)["adjsets"].has_child(adjset_name))
         {
-            std::set<index_t> &entity_groupset = entity_groupset_map[entity_id];
-            entity_groupset.insert(group_neighbors.begin(), group_neighbors.end());
+            conv_doms.push_back(dom);
         }
     }
 
-    // Given ordered lists of adjset values per neighbor, generate the destination
-    // adjset hierarchy.
-    Node adjset_template;
-    adjset_template.set_external(adjset);
-    adjset_template.remove("groups");
-
-    dest.set(adjset_template);
-    dest["groups"].set(DataType::object());
-
-    std::map<std::set<index_t>, Node *> groupset_groupnode_map;
-    for(const auto &entity_groupset_pair : entity_groupset_map)
+    const index_t num_doms = (index_t)conv_doms.size();
+    std::vector<Node> results((size_t)num_doms);
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_doms, 1), num_doms,
+        [&] (index_t /*ci*/, index_t dbegin, index_t dend)
     {
-        const std::set<index_t> &groupset = entity_groupset_pair.second;
-        if(groupset_groupnode_map.find(groupset) == groupset_groupnode_map.end())
+        for(index_t di = dbegin; di < dend; di++)
         {
-            Node &group_node = dest["groups"][std::to_string(dest["groups"].number_of_children())];
-            group_node["neighbors"].set(DataType(int_dtype.id(), groupset.size()));
-            {
-                const std::vector<index_t> grouplist(groupset.begin(), groupset.end());
-                Node temp(DataType::index_t(grouplist.size()), (void*)grouplist.data(), true);
-                temp.to_data_type(int_dtype.id(), group_node["neighbors"]);
-            }
-
-            groupset_groupnode_map[groupset] = &group_node;
+            const Node &dom = *conv_doms[di];
+            const index_t domain_id = dom.has_path("state/domain_id") ?
+                dom["state/domain_id"].to_index_t() : -1;
+            convert(dom["adjsets"][adjset_name], results[di]);
+            bputils::adjset::canonicalize(results[di], domain_id);
         }
-    }
+    });
 
-    // Now that the groundwork for each unique max-share group has been set,
-    // we populate the 'values' content of each group in order based on
-    // lexicographically sorted group names
-    std::map<std::set<index_t>, std::pair<std::vector<index_t>, std::set<index_t>>> groupset_values_map;
-    for(const std::string &group_name : adjset_group_names)
+    for(index_t di = 0; di < num_doms; di++)
     {
-        const Node &group_node = adjset["groups"][group_name];
-        const Node &group_vals = group_node["values"];
-        for(index_t vi = 0; vi < group_vals.dtype().number_of_elements(); ++vi)
-        {
-            Node temp(DataType(group_vals.dtype().id(), 1),
-                (void*)group_vals.element_ptr(vi), true);
-            const index_t group_entity = temp.to_index_t();
-
-            auto &groupset_pair = groupset_values_map[entity_groupset_map[group_entity]];
-            std::vector<index_t> &groupset_valuelist = groupset_pair.first;
-            std::set<index_t> &groupset_valueset = groupset_pair.second;
-            if(groupset_valueset.find(group_entity) == groupset_valueset.end())
-            {
-                groupset_valuelist.push_back(group_entity);
-                groupset_valueset.insert(group_entity);
-            }
-        }
+        (*conv_doms[di])["adjsets"][dest_adjset_name].swap(results[di]);
     }
+}
 
-    for(const auto &groupset_values_pair : groupset_values_map)
-    {
-        const std::set<index_t> &groupset = groupset_values_pair.first;
-        const std::vector<index_t> &groupset_values = groupset_values_pair.second.first;
-
-        Node &group_node = *groupset_groupnode_map[groupset];
-        group_node["values"].set(DataType(int_dtype.id(), groupset_values.size()));
-        {
-            Node temp(DataType::index_t(groupset_values.size()),
-                (void*)groupset_values.data(), true);
-            temp.to_data_type(int_dtype.id(), group_node["values"]);
-        }
-    }
+//-----------------------------------------------------------------------------
+void
+mesh::adjset::to_pairwise(Node &mesh,
+                          const std::string &adjset_name,
+                          const std::string &dest_adjset_name,
+                          const Node &options)
+{
+    convert_mesh_adjsets(mesh, adjset_name, dest_adjset_name, options,
+                         adjset_to_pairwise);
+}
 
-    bputils::adjset::canonicalize(dest);
+//-----------------------------------------------------------------------------
+void
+mesh::adjset::to_maxshare(Node &mesh,
+                          const std::string &adjset_name,
+                          const std::string &dest_adjset_name,
+                          const Node &options)
+{
+    convert_mesh_adjsets(mesh, adjset_name, dest_adjset_name, options,
+                         adjset_to_maxshare);
 }
 
 //-----------------------------------------------------------------------------
@@ -7020,6 +8765,17 @@ mesh::partition(const conduit::Node &n_mesh,
                 const conduit::Node &options,
                 conduit::Node &output)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::partition");
+
+    // device resident meshes are partitioned on the host
+    if(bpexec::select_backend(n_mesh) != bpexec::BACKEND_HOST)
+    {
+        Node host_mesh;
+        host_mesh.set(n_mesh);
+        partition(host_mesh, options, output);
+        return;
+    }
+
     mesh::Partitioner p;
     if(p.initialize(n_mesh, options))
     {
@@ -7033,6 +8789,8 @@ void mesh::partition_map_back(const Node& repart_mesh,
                               const Node& options,
                               Node& orig_mesh)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::partition_map_back");
+
     mesh::Partitioner p;
     p.map_back_fields(repart_mesh, options, orig_mesh);
 }
@@ -7043,13 +8801,46 @@ mesh::flatten(const conduit::Node &mesh,
               const conduit::Node &options,
               conduit::Node &output)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mesh::flatten");
+
     output.reset();
 
+    if(options.has_child("row_group_rows"))
+    {
+        // build the tables one row group at a time
+        Node batch_options;
+        batch_options.set(options);
+        batch_options["batch_rows"].set(options["row_group_rows"].to_index_t());
+        flatten_batches(mesh, batch_options,
+            [&](const std::string &table_name, index_t, const Node &batch)
+        {
+            table::append_row_group(batch, output[table_name]);
+        });
+        return;
+    }
+
     MeshFlattener do_flatten;
     do_flatten.set_options(options);
     do_flatten.execute(mesh, output);
 }
 
+//-------------------------------------------------------------------------
+void
+mesh::flatten_batches(const conduit::Node &mesh,
+    const conduit::Node &options,
+    const std::function<void(const std::string &, index_t, const conduit::Node &)> &callback)
+{
+    index_t batch_rows = 65536;
+    if(options.has_child("batch_rows"))
+    {
+        batch_rows = options["batch_rows"].to_index_t();
+    }
+
+    MeshFlattener do_flatten;
+    do_flatten.set_options(options);
+    do_flatten.execute(mesh, batch_rows, callback);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint --
@@ -17,6 +17,8 @@
 #include "conduit.hpp"
 #include "conduit_blueprint_exports.h"
 
+#include <functional>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit --
 //-----------------------------------------------------------------------------
@@ -59,6 +61,28 @@ bool CONDUIT_BLUEPRINT_API verify(const std::string &protocol,
 bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &mesh,
                                   conduit::Node &info);
 
+//-----------------------------------------------------------------------------
+/// Verify a mesh with options:
+///   level: "full"     all checks (default, same as verify(mesh,info))
+///          "shallow"  skip the checks that scan array values (such as the
+///                     shape ids of mixed topologies)
+///   cache: "false"    (default)
+///          "true"     keep the result, stamped with the mesh's content hash
+///                     (see Node::hash), and reuse it in later calls on the
+///                     same node with the same level until the mesh changes
+///   num_threads:      threads used to verify the domains of a multi domain
+///                     mesh and the fields of each domain (default: 1,
+///                     <= 0 uses the hardware concurrency). The info
+///                     output doesn't depend on the number of threads.
+///
+/// Cached results are kept for a limited number of nodes. As with cached
+/// hashes, writes through pointers or to external data are not tracked:
+/// call mesh.invalidate_hash() after them.
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &mesh,
+                                  conduit::Node &info,
+                                  const conduit::Node &options);
+
 
 //-----------------------------------------------------------------------------
 /// blueprint mesh property and transform methods
@@ -86,9 +110,55 @@ void CONDUIT_BLUEPRINT_API domains(const Node &mesh,
 void CONDUIT_BLUEPRINT_API domains(Node &mesh,
                                    std::vector<conduit::Node *> &res);
 
-/// Note: to_multi_domain uses Node::set_external to avoid copying data.
-/// If you need a copy of the data unlinked from the input, set into
-/// another node.
+//-----------------------------------------------------------------------------
+/// Calls func(Node &domain) for each domain of the mesh, in order, without
+/// building a list of domains or a multi domain view. A single domain mesh
+/// is passed as its only domain; empty meshes have no domains.
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+for_each_domain(conduit::Node &mesh, Func &&func)
+{
+    if(!is_multi_domain(mesh))
+    {
+        func(mesh);
+    }
+    else if(!mesh.dtype().is_empty())
+    {
+        const index_t num_doms = mesh.number_of_children();
+        for(index_t di = 0; di < num_doms; di++)
+        {
+            func(mesh.child(di));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+/// Calls func(const Node &domain) for each domain of the mesh.
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+for_each_domain(const conduit::Node &mesh, Func &&func)
+{
+    if(!is_multi_domain(mesh))
+    {
+        func(mesh);
+    }
+    else if(!mesh.dtype().is_empty())
+    {
+        const index_t num_doms = mesh.number_of_children();
+        for(index_t di = 0; di < num_doms; di++)
+        {
+            func(mesh.child(di));
+        }
+    }
+}
+
+/// Note: to_multi_domain uses Node::set_external to avoid copying data:
+/// the result's leaves point into the input, so only the tree structure is
+/// allocated. If you need a copy of the data unlinked from the input, set
+/// into another node. To visit the domains of a mesh that may be single
+/// domain, for_each_domain() or domains() avoid building the view at all.
 //-------------------------------------------------------------------------
 void CONDUIT_BLUEPRINT_API to_multi_domain(const conduit::Node &mesh,
                                            conduit::Node &dest);
@@ -128,6 +198,14 @@ void CONDUIT_BLUEPRINT_API generate_strip(conduit::Node &mesh,
                                           std::string src_topo_name,
                                           std::string dst_topo_name);
 
+//-------------------------------------------------------------------------
+// Options:
+//   field_prefix: prefix of the strip fields' names
+//   field_names: the fields (a string or a list of strings) to convert
+//   num_threads: number of threads the fields are converted on (default
+//                1, <= 0 selects the hardware concurrency)
+//   external: when true (default false), the strip fields' data refers
+//             to the source fields' data instead of being copied
 //-------------------------------------------------------------------------
 void CONDUIT_BLUEPRINT_API generate_strip(const conduit::Node& topo,
                                           conduit::Node& topo_dest,
@@ -180,6 +258,9 @@ void CONDUIT_BLUEPRINT_API partition(const conduit::Node &mesh,
  @param options     A Conduit node containing options that govern the partitioning.
                     Some available options:
                      "fields": a list of variable names to map back
+                     "num_threads": threads used to scatter the values into
+                                    the original fields (default 1, <= 0
+                                    uses all hardware threads)
  @param orig_mesh   A Conduit node containing the original mesh onto which
                     fields will be mapped onto.
  @param fields      A list of field names to map back.
@@ -210,11 +291,38 @@ void CONDUIT_BLUEPRINT_API partition_map_back(const conduit::Node& repart_mesh,
     "add_vertex_locations": Determines whether the coordinate locations of every vertex
         in the mesh should be included in the output table. Should be passed as int.
         (Default 1 (true))
+    "num_threads": The number of threads used to flatten domains concurrently.
+        (Default 1)
+    "row_group_rows": When given, the output tables hold their rows in row
+        groups of this many rows (see blueprint::table::append_row_group),
+        built one at a time with flatten_batches. "num_threads" is ignored.
 */
 void CONDUIT_BLUEPRINT_API flatten(const conduit::Node &mesh,
                                    const conduit::Node &options,
                                    conduit::Node &output);
 
+/**
+ @brief Convert the given blueprint mesh into blueprint table rows that are
+    passed to callback in batches, so the whole table is never built.
+ @param mesh    A Conduit node containing a blueprint mesh or set of mesh domains.
+ @param options A Conduit node containing options for the flatten operation.
+ @param callback Called as callback(table_name, row_offset, batch) for each
+    batch of rows, where table_name is "vertex_data" or "element_data",
+    row_offset is the row of the full table that the batch starts at, and
+    batch is a blueprint table that is only valid during the call. Batches of
+    each table arrive in row order.
+
+ Supported options:
+    All of the options of flatten() are supported, except for "num_threads".
+    "batch_rows": The number of rows in each batch. The last batch of each
+        table may have fewer rows. (Default 65536)
+*/
+void CONDUIT_BLUEPRINT_API flatten_batches(const conduit::Node &mesh,
+    const conduit::Node &options,
+    const std::function<void(const std::string &table_name,
+                             index_t row_offset,
+                             const conduit::Node &batch)> &callback);
+
 
 //-----------------------------------------------------------------------------
 /// blueprint mesh transform methods (these work on multi domain meshes)
@@ -463,6 +571,17 @@ namespace topology
         void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
                                                    conduit::Node &topo_dest,
                                                    conduit::Node &coords_dest);
+
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node.
+        // The options node can have a child "num_threads", the number of
+        // threads used to write the connectivity (default 1, <= 0 selects
+        // the hardware concurrency). Results don't depend on the number of
+        // threads.
+        void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
+                                                   conduit::Node &topo_dest,
+                                                   conduit::Node &coords_dest,
+                                                   const conduit::Node &options);
     }
 
     //-------------------------------------------------------------------------
@@ -483,6 +602,14 @@ namespace topology
         void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
                                                    conduit::Node &topo_dest,
                                                    conduit::Node &coords_dest);
+
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node,
+        // see 'uniform::to_unstructured'.
+        void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
+                                                   conduit::Node &topo_dest,
+                                                   conduit::Node &coords_dest,
+                                                   const conduit::Node &options);
     }
 
     //-------------------------------------------------------------------------
@@ -495,9 +622,21 @@ namespace topology
                                           conduit::Node &info);
 
         //-------------------------------------------------------------------------
+        // When the topology's 'elements/dims' has 'offsets' and 'strides'
+        // (a strided structured topology, see examples::strided_structured),
+        // the connectivity indexes the full coordset through them, so ghost
+        // padded coordsets are used as they are.
         void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
                                                    conduit::Node &topo_dest,
                                                    conduit::Node &coords_dest);
+
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node,
+        // see 'uniform::to_unstructured'.
+        void CONDUIT_BLUEPRINT_API to_unstructured(const conduit::Node &topo,
+                                                   conduit::Node &topo_dest,
+                                                   conduit::Node &coords_dest,
+                                                   const conduit::Node &options);
     }
 
     //-------------------------------------------------------------------------
@@ -513,6 +652,16 @@ namespace topology
         void CONDUIT_BLUEPRINT_API to_polygonal(const conduit::Node &topo,
                                                 conduit::Node &dest);
 
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node.
+        // The options node can have a child "num_threads", the number of
+        // threads used to find the faces shared by polyhedra (default 1,
+        // <= 0 selects the hardware concurrency). Results don't depend on
+        // the number of threads.
+        void CONDUIT_BLUEPRINT_API to_polygonal(const conduit::Node &topo,
+                                                conduit::Node &dest,
+                                                const conduit::Node &options);
+
         // Note: 
         // this is an alias to `to_polygonal`
         // to_polytopal is a better name for our existing to_polygonal
@@ -522,6 +671,11 @@ namespace topology
         void CONDUIT_BLUEPRINT_API to_polytopal(const conduit::Node &topo,
                                                 conduit::Node &dest);
 
+        //-------------------------------------------------------------------------
+        void CONDUIT_BLUEPRINT_API to_polytopal(const conduit::Node &topo,
+                                                conduit::Node &dest,
+                                                const conduit::Node &options);
+
 
         //-------------------------------------------------------------------------
         void CONDUIT_BLUEPRINT_API generate_points(const conduit::Node &topo,
@@ -529,12 +683,33 @@ namespace topology
                                                    conduit::Node &s2dmap,
                                                    conduit::Node &d2smap);
 
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node.
+        // The options node can have a child "num_threads", the number of
+        // threads used to discover the topology's entities (default 1,
+        // <= 0 selects the hardware concurrency). Results don't depend on
+        // the number of threads.
+        void CONDUIT_BLUEPRINT_API generate_points(const conduit::Node &topo,
+                                                   conduit::Node &dest,
+                                                   conduit::Node &s2dmap,
+                                                   conduit::Node &d2smap,
+                                                   const conduit::Node &options);
+
         //-------------------------------------------------------------------------
         void CONDUIT_BLUEPRINT_API generate_lines(const conduit::Node &topo,
                                                   conduit::Node &dest,
                                                   conduit::Node &s2dmap,
                                                   conduit::Node &d2smap);
 
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node,
+        // see 'generate_points'.
+        void CONDUIT_BLUEPRINT_API generate_lines(const conduit::Node &topo,
+                                                  conduit::Node &dest,
+                                                  conduit::Node &s2dmap,
+                                                  conduit::Node &d2smap,
+                                                  const conduit::Node &options);
+
         //-------------------------------------------------------------------------
         void CONDUIT_BLUEPRINT_API generate_faces(const conduit::Node &topo,
                                                   conduit::Node &dest,
@@ -542,12 +717,49 @@ namespace topology
                                                   conduit::Node &d2smap);
 
         //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node,
+        // see 'generate_points'.
+        void CONDUIT_BLUEPRINT_API generate_faces(const conduit::Node &topo,
+                                                  conduit::Node &dest,
+                                                  conduit::Node &s2dmap,
+                                                  conduit::Node &d2smap,
+                                                  const conduit::Node &options);
+
+        //-------------------------------------------------------------------------
+        // Also accepts single shape unstructured, uniform, rectilinear and
+        // structured topologies, whose centroids are computed directly from
+        // their coordinates (implicit topologies don't build connectivity).
         void CONDUIT_BLUEPRINT_API generate_centroids(const conduit::Node &topo,
                                                       conduit::Node &topo_dest,
                                                       conduit::Node &coords_dest,
                                                       conduit::Node &s2dmap,
                                                       conduit::Node &d2smap);
 
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node,
+        // see 'generate_points'.
+        void CONDUIT_BLUEPRINT_API generate_centroids(const conduit::Node &topo,
+                                                      conduit::Node &topo_dest,
+                                                      conduit::Node &coords_dest,
+                                                      conduit::Node &s2dmap,
+                                                      conduit::Node &d2smap,
+                                                      const conduit::Node &options);
+
+        //-------------------------------------------------------------------------
+        // this variant also computes the length, area or volume of each
+        // element in the same pass, as an element associated float64 field
+        // on 'topo' in 'measures_dest'. Measures of 3D elements sum a tet
+        // decomposition, and are exact for convex elements with planar faces.
+        // Only single shape unstructured, uniform, rectilinear and structured
+        // topologies are supported.
+        void CONDUIT_BLUEPRINT_API generate_centroids(const conduit::Node &topo,
+                                                      conduit::Node &topo_dest,
+                                                      conduit::Node &coords_dest,
+                                                      conduit::Node &s2dmap,
+                                                      conduit::Node &d2smap,
+                                                      conduit::Node &measures_dest,
+                                                      const conduit::Node &options);
+
         //---------------------------------------------------------------------
         void CONDUIT_BLUEPRINT_API generate_sides(const conduit::Node &topo,
                                                   conduit::Node &topo_dest,
@@ -562,7 +774,8 @@ namespace topology
         // to insert into the names of the fields stored in fields_dest. The options
         // node can also have a child "field_names", which should be a string or list
         // of strings that allow the user to specify which fields they want to be 
-        // mapped from the original set of fields.
+        // mapped from the original set of fields. The "num_threads" option is
+        // the same as for 'generate_points'.
         void CONDUIT_BLUEPRINT_API generate_sides(const conduit::Node &topo,
                                                   conduit::Node &topo_dest,
                                                   conduit::Node &coords_dest,
@@ -589,6 +802,16 @@ namespace topology
                                                     conduit::Node &s2dmap,
                                                     conduit::Node &d2smap);
 
+        //---------------------------------------------------------------------
+        // this variant of the function call accepts an options node,
+        // see 'generate_points'.
+        void CONDUIT_BLUEPRINT_API generate_corners(const conduit::Node &topo,
+                                                    conduit::Node &topo_dest,
+                                                    conduit::Node &coords_dest,
+                                                    conduit::Node &s2dmap,
+                                                    conduit::Node &d2smap,
+                                                    const conduit::Node &options);
+
         //-------------------------------------------------------------------------
         // Generates element offsets for given topo
         void CONDUIT_BLUEPRINT_API generate_offsets(const conduit::Node &topo,
@@ -601,10 +824,26 @@ namespace topology
                                                     Node &dest_ele_offsets,
                                                     Node &dest_subele_offsets);
 
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node.
+        // The options node can have a child "num_threads", the number of
+        // threads used for the offsets prefix sum (default 1, <= 0 selects
+        // the hardware concurrency).
+        void CONDUIT_BLUEPRINT_API generate_offsets(const Node &topo,
+                                                    Node &dest_ele_offsets,
+                                                    Node &dest_subele_offsets,
+                                                    const conduit::Node &options);
+
         //-------------------------------------------------------------------------
         // Adds offsets to given topo
         void CONDUIT_BLUEPRINT_API generate_offsets_inline(conduit::Node &topo);
 
+        //-------------------------------------------------------------------------
+        // this variant of the function call accepts an options node,
+        // see 'generate_offsets'.
+        void CONDUIT_BLUEPRINT_API generate_offsets_inline(conduit::Node &topo,
+                                                           const conduit::Node &options);
+
 
     }
 
@@ -683,6 +922,90 @@ namespace matset
                                        conduit::Node &dest,
                                        const float64 epsilon = CONDUIT_EPSILON);
 
+    //-------------------------------------------------------------------------
+    // Conversions among the matset flavors:
+    //
+    //  to_multi_buffer_full:        multi-buffer, element-dominant, with
+    //                               one volume fraction per element for
+    //                               every material
+    //  to_multi_buffer_by_material: multi-buffer, material-dominant
+    //  to_sparse_by_element:        uni-buffer, element-dominant
+    //  to_uni_buffer_by_material:   uni-buffer, material-dominant
+    //
+    // Any matset flavor can be passed. The sparse outputs drop volume
+    // fractions at or below 'epsilon'. Outputs always include the
+    // 'material_map'; materials within an element are ordered as in the
+    // map and the elements of a material are in ascending order. For
+    // material-dominant sources, the number of elements is one more than
+    // the largest element id.
+    //
+    // The options variants accept "epsilon" (default CONDUIT_EPSILON) and
+    // "num_threads", the number of threads the conversion passes are split
+    // over (default 1, <= 0 selects the hardware concurrency). Results
+    // don't depend on the number of threads.
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_full(const conduit::Node &src_matset,
+                                                    conduit::Node &dest_matset);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_full(const conduit::Node &src_matset,
+                                                    conduit::Node &dest_matset,
+                                                    const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_by_material(const conduit::Node &src_matset,
+                                                           conduit::Node &dest_matset,
+                                                           const float64 epsilon = CONDUIT_EPSILON);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_by_material(const conduit::Node &src_matset,
+                                                           conduit::Node &dest_matset,
+                                                           const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_sparse_by_element(const conduit::Node &src_matset,
+                                                    conduit::Node &dest_matset,
+                                                    const float64 epsilon = CONDUIT_EPSILON);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_sparse_by_element(const conduit::Node &src_matset,
+                                                    conduit::Node &dest_matset,
+                                                    const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_uni_buffer_by_material(const conduit::Node &src_matset,
+                                                         conduit::Node &dest_matset,
+                                                         const float64 epsilon = CONDUIT_EPSILON);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_uni_buffer_by_material(const conduit::Node &src_matset,
+                                                         conduit::Node &dest_matset,
+                                                         const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    // Reduces the matset values of field by material, streaming over the
+    // sparse entries of any matset flavor without densifying it. op is one
+    // of "sum", "min", "max" or "average" (weighted by volume fraction).
+    // dest holds a float64 for each material with entries above "epsilon",
+    // named as in the material map.
+    //
+    // The options variant accepts "epsilon" (default CONDUIT_EPSILON),
+    // "num_threads" (as for the conversions above) and "element_weights",
+    // one value per element that scales the "average" weights, such as
+    // element volumes. Results don't depend on the number of threads.
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API reduce_by_material(const conduit::Node &matset,
+                                                  const conduit::Node &field,
+                                                  const std::string &op,
+                                                  conduit::Node &dest);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API reduce_by_material(const conduit::Node &matset,
+                                                  const conduit::Node &field,
+                                                  const std::string &op,
+                                                  conduit::Node &dest,
+                                                  const conduit::Node &options);
+
     //-------------------------------------------------------------------------
     // blueprint::mesh::matset::index protocol interface
     //-------------------------------------------------------------------------
@@ -711,6 +1034,44 @@ namespace field
                                               const std::string & toponame,
                                               const std::string& topo_dest);
 
+    //-------------------------------------------------------------------------
+    // Options (see the mesh::generate_strip() variant with options):
+    //   num_threads: number of threads the fields are converted on
+    //   external: when true, the strip fields' data refers to the source
+    //             fields' data instead of being copied
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API generate_strip(conduit::Node& fields,
+                                              const std::string & toponame,
+                                              const std::string& topo_dest,
+                                              const conduit::Node& options);
+
+    //-------------------------------------------------------------------------
+    // Recenters the field 'field_name' of a (single domain) mesh to the
+    // given association ("vertex" or "element") of its topology, and stores
+    // the result in dest_field.
+    //
+    // Element values are the average of the values of their vertices,
+    // vertex values are the average of the values of the elements that use
+    // them (0 for unused vertices). float32 values stay float32, other
+    // values are written as float64. Each component of a multi-component
+    // field is recentered.
+    //
+    // options:
+    //   num_threads: number of threads (default 1, <= 0 selects the
+    //                hardware concurrency); results don't depend on it
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API recenter(const conduit::Node &mesh,
+                                        const std::string &field_name,
+                                        const std::string &association,
+                                        conduit::Node &dest_field);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API recenter(const conduit::Node &mesh,
+                                        const std::string &field_name,
+                                        const std::string &association,
+                                        conduit::Node &dest_field,
+                                        const conduit::Node &options);
+
     //-------------------------------------------------------------------------
     // Given a blueprint field and matset, converts the matset and the field
     // values + matset_values to the silo style sparse mixed slot
@@ -724,6 +1085,68 @@ namespace field
                                        conduit::Node &dest,
                                        const float64 epsilon = CONDUIT_EPSILON);
 
+    //-------------------------------------------------------------------------
+    // Given a field defined over src_matset, converts its matset_values to
+    // the layout of the matching matset conversion (see the matset
+    // namespace) of src_matset. The result is stored in dest_field, with
+    // its 'matset' set to dest_matset_name. The volume fractions and the
+    // matset values are moved in the same pass. Matset values are written
+    // as float64.
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_full(const conduit::Node &src_matset,
+                                                    const conduit::Node &src_field,
+                                                    const std::string &dest_matset_name,
+                                                    conduit::Node &dest_field);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_full(const conduit::Node &src_matset,
+                                                    const conduit::Node &src_field,
+                                                    const std::string &dest_matset_name,
+                                                    conduit::Node &dest_field,
+                                                    const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_by_material(const conduit::Node &src_matset,
+                                                           const conduit::Node &src_field,
+                                                           const std::string &dest_matset_name,
+                                                           conduit::Node &dest_field,
+                                                           const float64 epsilon = CONDUIT_EPSILON);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_multi_buffer_by_material(const conduit::Node &src_matset,
+                                                           const conduit::Node &src_field,
+                                                           const std::string &dest_matset_name,
+                                                           conduit::Node &dest_field,
+                                                           const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_sparse_by_element(const conduit::Node &src_matset,
+                                                    const conduit::Node &src_field,
+                                                    const std::string &dest_matset_name,
+                                                    conduit::Node &dest_field,
+                                                    const float64 epsilon = CONDUIT_EPSILON);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_sparse_by_element(const conduit::Node &src_matset,
+                                                    const conduit::Node &src_field,
+                                                    const std::string &dest_matset_name,
+                                                    conduit::Node &dest_field,
+                                                    const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_uni_buffer_by_material(const conduit::Node &src_matset,
+                                                         const conduit::Node &src_field,
+                                                         const std::string &dest_matset_name,
+                                                         conduit::Node &dest_field,
+                                                         const float64 epsilon = CONDUIT_EPSILON);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_uni_buffer_by_material(const conduit::Node &src_matset,
+                                                         const conduit::Node &src_field,
+                                                         const std::string &dest_matset_name,
+                                                         conduit::Node &dest_field,
+                                                         const conduit::Node &options);
+
     //-------------------------------------------------------------------------
     // blueprint::mesh::field::index protocol interface
     //-------------------------------------------------------------------------
@@ -794,6 +1217,27 @@ namespace adjset
     void CONDUIT_BLUEPRINT_API to_maxshare(const conduit::Node &adjset,
                                            conduit::Node &dest);
 
+    //-------------------------------------------------------------------------
+    // Converts the adjset named adjset_name of every domain of mesh and
+    // stores the result as the adjset dest_adjset_name of the domain (which
+    // may be adjset_name to replace it). Domains without the adjset are
+    // skipped.
+    //
+    // options:
+    //   num_threads: the number of threads the domains are converted on
+    //     (default 1; <= 0 selects the hardware concurrency)
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_pairwise(conduit::Node &mesh,
+                                           const std::string &adjset_name,
+                                           const std::string &dest_adjset_name,
+                                           const conduit::Node &options);
+
+    //-------------------------------------------------------------------------
+    void CONDUIT_BLUEPRINT_API to_maxshare(conduit::Node &mesh,
+                                           const std::string &adjset_name,
+                                           const std::string &dest_adjset_name,
+                                           const conduit::Node &options);
+
     //-------------------------------------------------------------------------
     // blueprint::mesh::adjset::index protocol interface
     //-------------------------------------------------------------------------
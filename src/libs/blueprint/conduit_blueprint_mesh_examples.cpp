@@ -27,6 +27,7 @@
 #include <set>
 #include <vector>
 #include <queue>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // conduit includes
@@ -73,6 +74,25 @@ const float64 PI_VALUE = 3.14159265359;
 // this and related CONDUIT_INFO logic
 const bool STRICT_NPTS_Z_FOR_2D = false;
 
+//---------------------------------------------------------------------------//
+// Smallest number of values handed to a thread when the example generators
+// split their fill loops.
+const index_t PARALLEL_MIN_CHUNK_ITEMS = 16384;
+
+//---------------------------------------------------------------------------//
+// Calls 'func(begin, end)' for contiguous sub-ranges of [0, num_items),
+// using at most 'num_threads' threads.
+template <typename Func>
+void
+parallel_ranges(index_t num_threads, index_t num_items, const Func &func)
+{
+    utils::detail::parallel_chunks(
+        utils::detail::parallel_num_chunks(num_threads, num_items,
+                                           PARALLEL_MIN_CHUNK_ITEMS),
+        num_items,
+        [&](index_t, index_t begin, index_t end) { func(begin, end); });
+}
+
 //---------------------------------------------------------------------------//
 struct point
 {
@@ -102,7 +122,8 @@ void basic_init_example_element_scalar_field(index_t nele_x,
                                              index_t nele_y,
                                              index_t nele_z,
                                              Node &res,
-                                             index_t prims_per_ele=1)
+                                             index_t prims_per_ele=1,
+                                             index_t num_threads=1)
 {
     index_t nele = nele_x;
 
@@ -122,10 +143,15 @@ void basic_init_example_element_scalar_field(index_t nele_x,
     res["values"].set(DataType::float64(nele*prims_per_ele));
 
     float64 *vals = res["values"].value();
-    for(index_t i = 0; i < nele*prims_per_ele; i++)
-    {
-        vals[i] = i + 0.0;
-    }
+    parallel_ranges(num_threads,
+                    nele*prims_per_ele,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t i = begin; i < end; i++)
+                        {
+                            vals[i] = i + 0.0;
+                        }
+                    });
 }
 
 //---------------------------------------------------------------------------//
@@ -238,7 +264,8 @@ inline float64 braid_init_example_point_scalar_field_calc_single_val(
 void braid_init_example_point_scalar_field(index_t npts_x,
                                            index_t npts_y,
                                            index_t npts_z,
-                                           Node &res)
+                                           Node &res,
+                                           index_t num_threads=1)
 {
 
     if(npts_y < 1)
@@ -263,36 +290,22 @@ void braid_init_example_point_scalar_field(index_t npts_x,
     float64 dy = braid_init_example_point_scalar_field_calc_dy(npts_y);
     float64 dz = braid_init_example_point_scalar_field_calc_dz(npts_z);
 
-    index_t idx = 0;
-
-    for(index_t k = 0; k < npts_z ; k++)
-    {
-        float64 cz =  (k * dz) - (1.5 * PI_VALUE);
-
-        for(index_t j = 0; j < npts_y ; j++)
-        {
-            float64 cy =  (j * dy) - ( PI_VALUE);
-            for(index_t i = 0; i < npts_x ; i++)
-            {
-
-                float64 cx =  (i * dx) + (2.0 * PI_VALUE);
-
-                float64 cv =  sin( cx ) +
-                              sin( cy ) +
-                              2 * cos(sqrt( (cx*cx)/2.0 +cy*cy) / .75) +
-                              4 * cos( cx*cy / 4.0);
-
-                if(npts_z > 1)
-                {
-                    cv += sin( cz ) +
-                          1.5 * cos(sqrt(cx*cx + cy*cy + cz*cz) / .75);
-                }
+    // each value only depends on its logical (i,j,k) location, so threads
+    // fill contiguous runs of the values array
+    parallel_ranges(num_threads,
+                    npts,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t idx = begin; idx < end; idx++)
+                        {
+                            index_t i = idx % npts_x;
+                            index_t j = (idx / npts_x) % npts_y;
+                            index_t k = idx / (npts_x * npts_y);
 
-                vals[idx] = cv;
-                idx++;
-            }
-        }
-    }
+                            vals[idx] = braid_init_example_point_scalar_field_calc_single_val(
+                                dx, dy, dz, i, j, k, npts_z);
+                        }
+                    });
 }
 
 
@@ -320,7 +333,8 @@ inline void braid_init_example_point_vector_field_calc_single_val(
 void braid_init_example_point_vector_field(index_t npts_x,
                                            index_t npts_y,
                                            index_t npts_z,
-                                           Node &res)
+                                           Node &res,
+                                           index_t num_threads=1)
 {
    index_t npts = npts_x;
 
@@ -392,36 +406,29 @@ void braid_init_example_point_vector_field(index_t npts_x,
         npts_z = 1;
     }
 
-    index_t idx = 0;
-    for(index_t k = 0; k < npts_z ; k++)
-    {
-        float64 cz = -10.0 + k * dz;
-
-        for(index_t j = 0; j < npts_y ; j++)
-        {
-            float64 cy =  -10.0 + j * dy;
-
-            for(index_t i = 0; i < npts_x ; i++)
-            {
-                float64 cx =  -10.0 + i * dx;
-
-                u_vals[idx] = cx;
-
-                if(dy > 0.0)
-                {
-                    v_vals[idx] = cy;
-                }
+    parallel_ranges(num_threads,
+                    npts,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t idx = begin; idx < end; idx++)
+                        {
+                            index_t i = idx % npts_x;
+                            index_t j = (idx / npts_x) % npts_y;
+                            index_t k = idx / (npts_x * npts_y);
 
-                if(dz > 0.0)
-                {
-                    w_vals[idx] = cz;
-                }
+                            u_vals[idx] = -10.0 + i * dx;
 
-                idx++;
-            }
+                            if(dy > 0.0)
+                            {
+                                v_vals[idx] = -10.0 + j * dy;
+                            }
 
-        }
-    }
+                            if(dz > 0.0)
+                            {
+                                w_vals[idx] = -10.0 + k * dz;
+                            }
+                        }
+                    });
 }
 
 
@@ -430,7 +437,8 @@ void braid_init_example_element_scalar_field(index_t nele_x,
                                              index_t nele_y,
                                              index_t nele_z,
                                              Node &res,
-                                             index_t prims_per_ele=1)
+                                             index_t prims_per_ele=1,
+                                             index_t num_threads=1)
 {
     index_t nele = nele_x;
 
@@ -467,39 +475,42 @@ void braid_init_example_element_scalar_field(index_t nele_x,
         dz = 20.0 / float64(nele_z);
     }
 
-    index_t idx = 0;
-    for(index_t k = 0; (idx == 0 || k < nele_z); k++)
-    {
-        float64 cz =  (k * dz) + -10.0;
-
-        for(index_t j = 0; (idx == 0 || j < nele_y) ; j++)
-        {
-            float64 cy =  (j * dy) + -10.0;
-
-            for(index_t i = 0; (idx == 0 || i < nele_x) ; i++)
-            {
-                float64 cx = (i * dx) + -10.0;
-
-                float64 cv = 10.0 * sqrt( cx*cx );
-
-                if(nele_y != 0)
-                {
-                    cv = 10.0 * sqrt( cx*cx + cy*cy );
-                }
-
-                if(nele_z != 0)
-                {
-                    cv = 10.0 * sqrt( cx*cx + cy*cy +cz*cz );
-                }
+    // missing dims still contribute a single layer of elements
+    const index_t ext_x = (nele_x > 0) ? nele_x : 1;
+    const index_t ext_y = (nele_y > 0) ? nele_y : 1;
 
-                for(index_t ppe = 0; ppe < prims_per_ele; ppe++ )
-                {
-                    vals[idx] = cv;
-                    idx++;
-                }
-            }
-        }
-    }
+    parallel_ranges(num_threads,
+                    nele,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t eidx = begin; eidx < end; eidx++)
+                        {
+                            index_t i = eidx % ext_x;
+                            index_t j = (eidx / ext_x) % ext_y;
+                            index_t k = eidx / (ext_x * ext_y);
+
+                            float64 cx = (i * dx) + -10.0;
+                            float64 cy = (j * dy) + -10.0;
+                            float64 cz = (k * dz) + -10.0;
+
+                            float64 cv = 10.0 * sqrt( cx*cx );
+
+                            if(nele_y != 0)
+                            {
+                                cv = 10.0 * sqrt( cx*cx + cy*cy );
+                            }
+
+                            if(nele_z != 0)
+                            {
+                                cv = 10.0 * sqrt( cx*cx + cy*cy +cz*cz );
+                            }
+
+                            for(index_t ppe = 0; ppe < prims_per_ele; ppe++ )
+                            {
+                                vals[eidx * prims_per_ele + ppe] = cv;
+                            }
+                        }
+                    });
 }
 
 
@@ -847,7 +858,8 @@ void
 braid_init_explicit_coordset(index_t npts_x,
                              index_t npts_y,
                              index_t npts_z,
-                             Node &coords)
+                             Node &coords,
+                             index_t num_threads=1)
 {
     coords["type"] = "explicit";
 
@@ -903,49 +915,37 @@ braid_init_explicit_coordset(index_t npts_x,
         dz = 20.0 / float64(npts_z-1);
     }
 
-    index_t idx = 0;
-    // default to one loop iteration (2d case)
-    index_t outer = 1;
-    // expand loop iteration for 3d case
-    if(npts_z > 1)
-    {
-        outer = npts_z;
-    }
-    // default to one loop iteration (1d case)
+    // default to one row (1d case)
     index_t middle = 1;
-    // expand loop iteration for 2d and 3d case
+    // expand rows for 2d and 3d case
     if(npts_y > 1)
     {
         middle = npts_y;
     }
 
-    for(index_t k = 0; k < outer; k++)
-    {
-        float64 cz = -10.0 + k * dz;
-
-        for(index_t j = 0; j < middle ; j++)
-        {
-            float64 cy =  -10.0 + j * dy;
-
-            for(index_t i = 0; i < npts_x ; i++)
-            {
-                x_vals[idx] = -10.0 + i * dx;
-
-                if(npts_y > 1)
-                {
-                    y_vals[idx] = cy;
-                }
+    parallel_ranges(num_threads,
+                    npts,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t idx = begin; idx < end; idx++)
+                        {
+                            index_t i = idx % npts_x;
+                            index_t j = (idx / npts_x) % middle;
+                            index_t k = idx / (npts_x * middle);
 
-                if(npts_z > 1)
-                {
-                    z_vals[idx] = cz;
-                }
+                            x_vals[idx] = -10.0 + i * dx;
 
-                idx++;
-            }
+                            if(npts_y > 1)
+                            {
+                                y_vals[idx] = -10.0 + j * dy;
+                            }
 
-        }
-    }
+                            if(npts_z > 1)
+                            {
+                                z_vals[idx] = -10.0 + k * dz;
+                            }
+                        }
+                    });
 
 }
 
@@ -1343,7 +1343,8 @@ void
 braid_uniform(index_t npts_x,
               index_t npts_y,
               index_t npts_z,
-              Node &res)
+              Node &res,
+              index_t num_threads=1)
 {
     res.reset();
 
@@ -1366,17 +1367,21 @@ braid_uniform(index_t npts_x,
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(nele_x,
                                             nele_y,
                                             nele_z,
-                                            fields["radial"]);
+                                            fields["radial"],
+                                            1,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 
 }
 
@@ -1387,7 +1392,8 @@ void
 braid_rectilinear(index_t npts_x,
                   index_t npts_y,
                   index_t npts_z,
-                  Node &res)
+                  Node &res,
+                  index_t num_threads=1)
 {
     res.reset();
 
@@ -1409,17 +1415,21 @@ braid_rectilinear(index_t npts_x,
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(nele_x,
                                             nele_y,
                                             nele_z,
-                                            fields["radial"]);
+                                            fields["radial"],
+                                            1,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 
 }
 
@@ -1428,7 +1438,8 @@ void
 braid_structured(index_t npts_x,
                  index_t npts_y,
                  index_t npts_z,
-                 Node &res)
+                 Node &res,
+                 index_t num_threads=1)
 {
     res.reset();
 
@@ -1440,7 +1451,8 @@ braid_structured(index_t npts_x,
     braid_init_explicit_coordset(npts_x,
                                  npts_y,
                                  npts_z,
-                                 res["coordsets/coords"]);
+                                 res["coordsets/coords"],
+                                 num_threads);
 
     res["topologies/mesh/type"] = "structured";
     res["topologies/mesh/coordset"] = "coords";
@@ -1461,17 +1473,21 @@ braid_structured(index_t npts_x,
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(nele_x,
                                             nele_y,
                                             nele_z,
-                                            fields["radial"]);
+                                            fields["radial"],
+                                            1,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 
 }
 
@@ -1481,7 +1497,8 @@ void
 braid_points_explicit(index_t npts_x,
                       index_t npts_y,
                       index_t npts_z,
-                      Node &res)
+                      Node &res,
+                      index_t num_threads=1)
 {
     res.reset();
 
@@ -1490,7 +1507,8 @@ braid_points_explicit(index_t npts_x,
     braid_init_explicit_coordset(npts_x,
                                  npts_y,
                                  npts_z,
-                                 res["coordsets/coords"]);
+                                 res["coordsets/coords"],
+                                 num_threads);
 
     res["topologies/mesh/type"] = "unstructured";
     res["topologies/mesh/coordset"] = "coords";
@@ -1506,27 +1524,36 @@ braid_points_explicit(index_t npts_x,
     res["topologies/mesh/elements/connectivity"].set(DataType::int32(npts_total));
     int32 *conn = res["topologies/mesh/elements/connectivity"].value();
 
-    for(int32 i = 0; i < (int32)npts_total ; i++)
-    {
-        conn[i] = i;
-    }
+    parallel_ranges(num_threads,
+                    npts_total,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t i = begin; i < end; i++)
+                        {
+                            conn[i] = (int32)i;
+                        }
+                    });
 
     Node &fields = res["fields"];
 
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(npts_x,
                                             npts_y,
                                             npts_z,
-                                            fields["radial"]);
+                                            fields["radial"],
+                                            1,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 
 }
 
@@ -1536,7 +1563,8 @@ void
 braid_points_implicit(index_t npts_x,
                       index_t npts_y,
                       index_t npts_z,
-                      Node &res)
+                      Node &res,
+                      index_t num_threads=1)
 {
     res.reset();
 
@@ -1545,7 +1573,8 @@ braid_points_implicit(index_t npts_x,
     braid_init_explicit_coordset(npts_x,
                                  npts_y,
                                  npts_z,
-                                 res["coordsets/coords"]);
+                                 res["coordsets/coords"],
+                                 num_threads);
 
     res["topologies/mesh/type"] = "points";
     res["topologies/mesh/coordset"] = "coords";
@@ -1555,17 +1584,21 @@ braid_points_implicit(index_t npts_x,
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(npts_x,
                                             npts_y,
                                             npts_z,
-                                            fields["radial"]);
+                                            fields["radial"],
+                                            1,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 
 }
 
@@ -1574,7 +1607,8 @@ braid_points_implicit(index_t npts_x,
 void
 braid_quads(index_t npts_x,
             index_t npts_y,
-            Node &res)
+            Node &res,
+            index_t num_threads=1)
 {
     res.reset();
 
@@ -1586,7 +1620,8 @@ braid_quads(index_t npts_x,
     braid_init_explicit_coordset(npts_x,
                                  npts_y,
                                  1,
-                                 res["coordsets/coords"]);
+                                 res["coordsets/coords"],
+                                 num_threads);
 
     res["topologies/mesh/type"] = "unstructured";
     res["topologies/mesh/coordset"] = "coords";
@@ -1594,20 +1629,22 @@ braid_quads(index_t npts_x,
     res["topologies/mesh/elements/connectivity"].set(DataType::int32(nele*4));
     int32 *conn = res["topologies/mesh/elements/connectivity"].value();
 
-    int32 idx = 0;
-    for(int32 j = 0; j < nele_y ; j++)
-    {
-        int32 yoff = j * (nele_x+1);
-        for(int32 i = 0; i < nele_x; i++)
-        {
-            conn[idx+0] = yoff + i;
-            conn[idx+1] = yoff + i + (nele_x+1);
-            conn[idx+2] = yoff + i + 1 + (nele_x+1);
-            conn[idx+3] = yoff + i + 1;
-
-            idx+=4;
-        }
-    }
+    parallel_ranges(num_threads,
+                    nele,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t e = begin; e < end; e++)
+                        {
+                            int32 i = (int32)(e % nele_x);
+                            int32 yoff = (int32)(e / nele_x) * (nele_x+1);
+                            int32 *ele_conn = conn + e * 4;
+
+                            ele_conn[0] = yoff + i;
+                            ele_conn[1] = yoff + i + (nele_x+1);
+                            ele_conn[2] = yoff + i + 1 + (nele_x+1);
+                            ele_conn[3] = yoff + i + 1;
+                        }
+                    });
 
 
     Node &fields = res["fields"];
@@ -1615,17 +1652,21 @@ braid_quads(index_t npts_x,
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           1,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(nele_x,
                                             nele_y,
                                             0,
-                                            fields["radial"]);
+                                            fields["radial"],
+                                            1,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           1,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 }
 
 //---------------------------------------------------------------------------//
@@ -1956,7 +1997,8 @@ braid_lines_2d(index_t npts_x,
 void
 braid_tris(index_t npts_x,
            index_t npts_y,
-           Node &res)
+           Node &res,
+           index_t num_threads=1)
 {
     res.reset();
 
@@ -1970,7 +2012,8 @@ braid_tris(index_t npts_x,
     braid_init_explicit_coordset(npts_x,
                                  npts_y,
                                  1,
-                                 res["coordsets/coords"]);
+                                 res["coordsets/coords"],
+                                 num_threads);
 
     res["topologies/mesh/type"] = "unstructured";
     res["topologies/mesh/coordset"] = "coords";
@@ -1978,25 +2021,26 @@ braid_tris(index_t npts_x,
     res["topologies/mesh/elements/connectivity"].set(DataType::int32(nele_quads*6));
     int32 *conn = res["topologies/mesh/elements/connectivity"].value();
 
-    int32 idx = 0;
-    for(int32 j = 0; j < nele_quads_y ; j++)
-    {
-        int32 yoff = j * (nele_quads_x+1);
-
-        for(int32 i = 0; i < nele_quads_x; i++)
-        {
-            // two tris per quad.
-            conn[idx+0] = yoff + i;
-            conn[idx+1] = yoff + i + (nele_quads_x+1);
-            conn[idx+2] = yoff + i + 1 + (nele_quads_x+1);
-
-            conn[idx+3] = yoff + i;
-            conn[idx+4] = yoff + i + 1;
-            conn[idx+5] = yoff + i + 1 + (nele_quads_x+1);
-
-            idx+=6;
-        }
-    }
+    parallel_ranges(num_threads,
+                    nele_quads,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t e = begin; e < end; e++)
+                        {
+                            int32 i = (int32)(e % nele_quads_x);
+                            int32 yoff = (int32)(e / nele_quads_x) * (nele_quads_x+1);
+                            int32 *quad_conn = conn + e * 6;
+
+                            // two tris per quad.
+                            quad_conn[0] = yoff + i;
+                            quad_conn[1] = yoff + i + (nele_quads_x+1);
+                            quad_conn[2] = yoff + i + 1 + (nele_quads_x+1);
+
+                            quad_conn[3] = yoff + i;
+                            quad_conn[4] = yoff + i + 1;
+                            quad_conn[5] = yoff + i + 1 + (nele_quads_x+1);
+                        }
+                    });
 
 
     Node &fields = res["fields"];
@@ -2004,17 +2048,21 @@ braid_tris(index_t npts_x,
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           1,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(nele_quads_x,
                                             nele_quads_y,
                                             0,
-                                            fields["radial"],2);
+                                            fields["radial"],
+                                            2,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           1,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 
 }
 
@@ -2333,7 +2381,8 @@ void
 braid_hexs(index_t npts_x,
            index_t npts_y,
            index_t npts_z,
-           Node &res)
+           Node &res,
+           index_t num_threads=1)
 {
     res.reset();
 
@@ -2346,7 +2395,8 @@ braid_hexs(index_t npts_x,
     braid_init_explicit_coordset(npts_x,
                                  npts_y,
                                  npts_z,
-                                 res["coordsets/coords"]);
+                                 res["coordsets/coords"],
+                                 num_threads);
 
     res["topologies/mesh/type"] = "unstructured";
     res["topologies/mesh/coordset"] = "coords";
@@ -2354,53 +2404,56 @@ braid_hexs(index_t npts_x,
     res["topologies/mesh/elements/connectivity"].set(DataType::int32(nele*8));
     int32 *conn = res["topologies/mesh/elements/connectivity"].value();
 
-    int32 idx = 0;
-    for(int32 k = 0; k < nele_z ; k++)
-    {
-        int32 zoff = k * (nele_x+1)*(nele_y+1);
-        int32 zoff_n = (k+1) * (nele_x+1)*(nele_y+1);
-
-        for(int32 j = 0; j < nele_y ; j++)
-        {
-            int32 yoff = j * (nele_x+1);
-            int32 yoff_n = (j+1) * (nele_x+1);
-
-
-            for(int32 i = 0; i < nele_x; i++)
-            {
-                // ordering is same as VTK_HEXAHEDRON
-
-                conn[idx+0] = zoff + yoff + i;
-                conn[idx+1] = zoff + yoff + i + 1;
-                conn[idx+2] = zoff + yoff_n + i + 1;
-                conn[idx+3] = zoff + yoff_n + i;
-
-                conn[idx+4] = zoff_n + yoff + i;
-                conn[idx+5] = zoff_n + yoff + i + 1;
-                conn[idx+6] = zoff_n + yoff_n + i + 1;
-                conn[idx+7] = zoff_n + yoff_n + i;
-
-                idx+=8;
-            }
-        }
-    }
+    parallel_ranges(num_threads,
+                    nele,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t e = begin; e < end; e++)
+                        {
+                            int32 i = (int32)(e % nele_x);
+                            int32 j = (int32)((e / nele_x) % nele_y);
+                            int32 k = (int32)(e / (nele_x * nele_y));
+
+                            int32 zoff = k * (nele_x+1)*(nele_y+1);
+                            int32 zoff_n = (k+1) * (nele_x+1)*(nele_y+1);
+                            int32 yoff = j * (nele_x+1);
+                            int32 yoff_n = (j+1) * (nele_x+1);
+                            int32 *ele_conn = conn + e * 8;
+
+                            // ordering is same as VTK_HEXAHEDRON
+
+                            ele_conn[0] = zoff + yoff + i;
+                            ele_conn[1] = zoff + yoff + i + 1;
+                            ele_conn[2] = zoff + yoff_n + i + 1;
+                            ele_conn[3] = zoff + yoff_n + i;
+
+                            ele_conn[4] = zoff_n + yoff + i;
+                            ele_conn[5] = zoff_n + yoff + i + 1;
+                            ele_conn[6] = zoff_n + yoff_n + i + 1;
+                            ele_conn[7] = zoff_n + yoff_n + i;
+                        }
+                    });
 
     Node &fields = res["fields"];
 
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(nele_x,
                                             nele_y,
                                             nele_z,
-                                            fields["radial"]);
+                                            fields["radial"],
+                                            1,
+                                            num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 }
 
 //---------------------------------------------------------------------------//
@@ -2408,7 +2461,8 @@ void
 braid_tets(index_t npts_x,
            index_t npts_y,
            index_t npts_z,
-           Node &res)
+           Node &res,
+           index_t num_threads=1)
 {
     res.reset();
 
@@ -2425,7 +2479,8 @@ braid_tets(index_t npts_x,
     braid_init_explicit_coordset(npts_x,
                                  npts_y,
                                  npts_z,
-                                 res["coordsets/coords"]);
+                                 res["coordsets/coords"],
+                                 num_threads);
 
 
     res["topologies/mesh/type"] = "unstructured";
@@ -2435,84 +2490,87 @@ braid_tets(index_t npts_x,
     int32 *conn = res["topologies/mesh/elements/connectivity"].value();
 
 
-    int32 idx = 0;
-    for(int32 k = 0; k < nele_hexs_z ; k++)
-    {
-        int32 zoff = k * (nele_hexs_x+1)*(nele_hexs_y+1);
-        int32 zoff_n = (k+1) * (nele_hexs_x+1)*(nele_hexs_y+1);
-
-        for(int32 j = 0; j < nele_hexs_y ; j++)
-        {
-            int32 yoff = j * (nele_hexs_x+1);
-            int32 yoff_n = (j+1) * (nele_hexs_x+1);
-
-
-            for(int32 i = 0; i < nele_hexs_x; i++)
-            {
-                // Create a local array of the vertex indices
-                // ordering is same as VTK_HEXAHEDRON
-                int32 vidx[8] =   {zoff + yoff + i
-                                  ,zoff + yoff + i + 1
-                                  ,zoff + yoff_n + i + 1
-                                  ,zoff + yoff_n + i
-                                  ,zoff_n + yoff + i
-                                  ,zoff_n + yoff + i + 1
-                                  ,zoff_n + yoff_n + i + 1
-                                  ,zoff_n + yoff_n + i};
-
-                // Create six tets all sharing diagonal from vertex 0 to 6
-                // Uses SILO convention for vertex order (normals point in)
-                conn[idx++] = vidx[0];
-                conn[idx++] = vidx[2];
-                conn[idx++] = vidx[1];
-                conn[idx++] = vidx[6];
-
-                conn[idx++] = vidx[0];
-                conn[idx++] = vidx[3];
-                conn[idx++] = vidx[2];
-                conn[idx++] = vidx[6];
-
-                conn[idx++] = vidx[0];
-                conn[idx++] = vidx[7];
-                conn[idx++] = vidx[3];
-                conn[idx++] = vidx[6];
-
-                conn[idx++] = vidx[0];
-                conn[idx++] = vidx[4];
-                conn[idx++] = vidx[7];
-                conn[idx++] = vidx[6];
-
-                conn[idx++] = vidx[0];
-                conn[idx++] = vidx[5];
-                conn[idx++] = vidx[4];
-                conn[idx++] = vidx[6];
-
-                conn[idx++] = vidx[0];
-                conn[idx++] = vidx[1];
-                conn[idx++] = vidx[5];
-                conn[idx++] = vidx[6];
-
-            }
-        }
-    }
+    parallel_ranges(num_threads,
+                    nele_hexs,
+                    [&](index_t begin, index_t end)
+                    {
+                        for(index_t e = begin; e < end; e++)
+                        {
+                            int32 i = (int32)(e % nele_hexs_x);
+                            int32 j = (int32)((e / nele_hexs_x) % nele_hexs_y);
+                            int32 k = (int32)(e / (nele_hexs_x * nele_hexs_y));
+
+                            int32 zoff = k * (nele_hexs_x+1)*(nele_hexs_y+1);
+                            int32 zoff_n = (k+1) * (nele_hexs_x+1)*(nele_hexs_y+1);
+                            int32 yoff = j * (nele_hexs_x+1);
+                            int32 yoff_n = (j+1) * (nele_hexs_x+1);
+
+                            // Create a local array of the vertex indices
+                            // ordering is same as VTK_HEXAHEDRON
+                            int32 vidx[8] =   {zoff + yoff + i
+                                              ,zoff + yoff + i + 1
+                                              ,zoff + yoff_n + i + 1
+                                              ,zoff + yoff_n + i
+                                              ,zoff_n + yoff + i
+                                              ,zoff_n + yoff + i + 1
+                                              ,zoff_n + yoff_n + i + 1
+                                              ,zoff_n + yoff_n + i};
+
+                            index_t idx = e * tets_per_hex * verts_per_tet;
+
+                            // Create six tets all sharing diagonal from vertex 0 to 6
+                            // Uses SILO convention for vertex order (normals point in)
+                            conn[idx++] = vidx[0];
+                            conn[idx++] = vidx[2];
+                            conn[idx++] = vidx[1];
+                            conn[idx++] = vidx[6];
+
+                            conn[idx++] = vidx[0];
+                            conn[idx++] = vidx[3];
+                            conn[idx++] = vidx[2];
+                            conn[idx++] = vidx[6];
+
+                            conn[idx++] = vidx[0];
+                            conn[idx++] = vidx[7];
+                            conn[idx++] = vidx[3];
+                            conn[idx++] = vidx[6];
+
+                            conn[idx++] = vidx[0];
+                            conn[idx++] = vidx[4];
+                            conn[idx++] = vidx[7];
+                            conn[idx++] = vidx[6];
+
+                            conn[idx++] = vidx[0];
+                            conn[idx++] = vidx[5];
+                            conn[idx++] = vidx[4];
+                            conn[idx++] = vidx[6];
+
+                            conn[idx++] = vidx[0];
+                            conn[idx++] = vidx[1];
+                            conn[idx++] = vidx[5];
+                            conn[idx++] = vidx[6];
+                        }
+                    });
 
     Node &fields = res["fields"];
 
     braid_init_example_point_scalar_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["braid"]);
+                                          fields["braid"],
+                                          num_threads);
 
     braid_init_example_element_scalar_field(nele_hexs_x,
                                             nele_hexs_y,
                                             nele_hexs_z,
                                             fields["radial"],
-                                            tets_per_hex);
+                                            tets_per_hex, num_threads);
 
     braid_init_example_point_vector_field(npts_x,
                                           npts_y,
                                           npts_z,
-                                          fields["vel"]);
+                                          fields["vel"],
+                                          num_threads);
 
 }
 
@@ -3145,6 +3203,19 @@ basic(const std::string &mesh_type,
       index_t npts_y, // number of points in y
       index_t npts_z, // number of points in z
       Node &res)
+{
+    basic(mesh_type, npts_x, npts_y, npts_z, Node(), res);
+}
+
+
+//---------------------------------------------------------------------------//
+void
+basic(const std::string &mesh_type,
+      index_t npts_x, // number of points in x
+      index_t npts_y, // number of points in y
+      index_t npts_z, // number of points in z
+      const Node &options,
+      Node &res)
 {
     // NOTE(JRC): The basic mesh example only supports simple, homogenous
     // element types that can be spanned by zone-centered fields.
@@ -3236,12 +3307,13 @@ basic(const std::string &mesh_type,
                       " npts_z: " << npts_z << std::endl);
     }
 
-    braid(braid_types[mesh_type_index], npts_x, npts_y, npts_z, res);
+    braid(braid_types[mesh_type_index], npts_x, npts_y, npts_z, options, res);
     res.remove("fields");
     res.remove("state");
 
     basic_init_example_element_scalar_field(npts_x-1, npts_y-1, npts_z-1,
-        res["fields/field"], mesh_types_subelems_per_elem[mesh_type_index]);
+        res["fields/field"], mesh_types_subelems_per_elem[mesh_type_index],
+        utils::detail::num_threads_option(options));
 }
 
 void
@@ -3425,6 +3497,26 @@ grid(const std::string &mesh_type,
      index_t ndoms_y, // number of domains in y
      index_t ndoms_z, // number of domains in z
      Node &res)
+{
+    grid(mesh_type,
+         npts_x, npts_y, npts_z,
+         ndoms_x, ndoms_y, ndoms_z,
+         Node(),
+         res);
+}
+
+
+//---------------------------------------------------------------------------//
+void
+grid(const std::string &mesh_type,
+     index_t npts_x, // number of per-domain points in x
+     index_t npts_y, // number of per-domain points in y
+     index_t npts_z, // number of per-domain points in z
+     index_t ndoms_x, // number of domains in x
+     index_t ndoms_y, // number of domains in y
+     index_t ndoms_z, // number of domains in z
+     const Node &options,
+     Node &res)
 {
     const bool ndoms_x_ok = ndoms_x > 0;
     const bool ndoms_y_ok = ndoms_y > 0;
@@ -3494,7 +3586,7 @@ grid(const std::string &mesh_type,
             for(index_t dx = 0; dx < ndoms_x; dx++, domain_id++)
             {
                 Node &domain_node = res["domain" + std::to_string(domain_id)];
-                braid(mesh_type, npts_x, npts_y, npts_z, domain_node);
+                braid(mesh_type, npts_x, npts_y, npts_z, options, domain_node);
                 domain_node["state/domain_id"].set(domain_id);
 
                 Node &domain_coords_node = domain_node["coordsets/coords"];
@@ -3533,6 +3625,21 @@ braid(const std::string &mesh_type,
       index_t npts_z, // number of points in z
       Node &res)
 {
+    braid(mesh_type, npts_x, npts_y, npts_z, Node(), res);
+}
+
+
+//---------------------------------------------------------------------------//
+void
+braid(const std::string &mesh_type,
+      index_t npts_x, // number of points in x
+      index_t npts_y, // number of points in y
+      index_t npts_z, // number of points in z
+      const Node &options,
+      Node &res)
+{
+    const index_t num_threads = utils::detail::num_threads_option(options);
+
     bool npts_x_ok = true;
     bool npts_y_ok = true;
     bool npts_z_ok = true;
@@ -3640,15 +3747,15 @@ braid(const std::string &mesh_type,
 
     if(mesh_type == "uniform")
     {
-        braid_uniform(npts_x,npts_y,npts_z,res);
+        braid_uniform(npts_x,npts_y,npts_z,res,num_threads);
     }
     else if(mesh_type == "rectilinear")
     {
-        braid_rectilinear(npts_x,npts_y,npts_z,res);
+        braid_rectilinear(npts_x,npts_y,npts_z,res,num_threads);
     }
     else if(mesh_type == "structured")
     {
-        braid_structured(npts_x,npts_y,npts_z,res);
+        braid_structured(npts_x,npts_y,npts_z,res,num_threads);
     }
     else if(mesh_type == "lines")
     {
@@ -3659,15 +3766,15 @@ braid(const std::string &mesh_type,
     }
     else if(mesh_type == "tris")
     {
-        braid_tris(npts_x,npts_y,res);
+        braid_tris(npts_x,npts_y,res,num_threads);
     }
     else if(mesh_type == "quads")
     {
-        braid_quads(npts_x,npts_y,res);
+        braid_quads(npts_x,npts_y,res,num_threads);
     }
     else if(mesh_type == "quads_poly")
     {
-        braid_quads(npts_x,npts_y,res);
+        braid_quads(npts_x,npts_y,res,num_threads);
         braid_to_poly(res);
     }
     else if(mesh_type == "quads_and_tris")
@@ -3680,15 +3787,15 @@ braid(const std::string &mesh_type,
     }
     else if(mesh_type == "tets")
     {
-        braid_tets(npts_x,npts_y,npts_z,res);
+        braid_tets(npts_x,npts_y,npts_z,res,num_threads);
     }
     else if(mesh_type == "hexs")
     {
-        braid_hexs(npts_x,npts_y,npts_z,res);
+        braid_hexs(npts_x,npts_y,npts_z,res,num_threads);
     }
     else if(mesh_type == "hexs_poly")
     {
-        braid_hexs(npts_x,npts_y,npts_z,res);
+        braid_hexs(npts_x,npts_y,npts_z,res,num_threads);
         braid_to_poly(res);
     }
     else if(mesh_type == "hexs_and_tets")
@@ -3697,11 +3804,11 @@ braid(const std::string &mesh_type,
     }
     else if(mesh_type == "points")
     {
-        braid_points_explicit(npts_x,npts_y,npts_z,res);
+        braid_points_explicit(npts_x,npts_y,npts_z,res,num_threads);
     }
     else if(mesh_type == "points_implicit")
     {
-        braid_points_implicit(npts_x,npts_y,npts_z,res);
+        braid_points_implicit(npts_x,npts_y,npts_z,res,num_threads);
     }
     else if (mesh_type == "mixed")
     {
@@ -3714,13 +3821,13 @@ braid(const std::string &mesh_type,
     else if (mesh_type == "wedges")
     {
         Node braid_regular;
-        braid_hexs(npts_x,npts_y,npts_z,braid_regular);
+        braid_hexs(npts_x,npts_y,npts_z,braid_regular,num_threads);
         braid_to_wedges(braid_regular, res);
     }
     else if (mesh_type == "pyramids")
     {
         Node braid_regular;
-        braid_hexs(npts_x,npts_y,npts_z,braid_regular);
+        braid_hexs(npts_x,npts_y,npts_z,braid_regular,num_threads);
         braid_to_pyramids(npts_x,npts_y,npts_z,braid_regular, res);
     }
     else
@@ -3733,6 +3840,16 @@ braid(const std::string &mesh_type,
 void spiral(index_t ndoms,
             Node &res)
 {
+    spiral(ndoms, Node(), res);
+}
+
+//---------------------------------------------------------------------------//
+void spiral(index_t ndoms,
+            const Node &options,
+            Node &res)
+{
+    const index_t num_threads = utils::detail::num_threads_option(options);
+
     res.reset();
 
     int f_1 = 1;
@@ -3788,25 +3905,21 @@ void spiral(index_t ndoms,
         dom["fields/dist/topology"] = "topo";
         dom["fields/dist/values"] = DataType::float64((f+1) * (f+1));
 
-        float64_array dist_vals = dom["fields/dist/values"].value();
+        float64 *dist_vals = dom["fields/dist/values"].value();
 
-        index_t idx = 0;
         // fill the scalar with approx dist to spiral
-        yv = y;
-
-        for(int j=0; j < f+1; j++)
-        {
-            xv = x;
-            for(int i=0; i < f+1; i++)
-            {
-                float64 l_x = xv - loc_xo;
-                float64 l_y = yv - loc_yo;
-                dist_vals[idx] = sqrt( l_x * l_x + l_y * l_y) - f;
-                xv+=1;
-                idx++;
-            }
-            yv+=1;
-        }
+        const index_t dom_npts = f+1;
+        parallel_ranges(num_threads,
+                        dom_npts * dom_npts,
+                        [&](index_t begin, index_t end)
+                        {
+                            for(index_t idx = begin; idx < end; idx++)
+                            {
+                                float64 l_x = (x + (idx % dom_npts)) - loc_xo;
+                                float64 l_y = (y + (idx / dom_npts)) - loc_yo;
+                                dist_vals[idx] = sqrt( l_x * l_x + l_y * l_y) - f;
+                            }
+                        });
 
         // setup for next domain using one of 4 rotation cases
         switch(rot_case)
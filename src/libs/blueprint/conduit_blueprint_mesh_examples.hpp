@@ -54,6 +54,19 @@ namespace examples
                                      conduit::index_t nz,
                                      conduit::Node &res);
 
+    /// Same as above, with options:
+    ///
+    /// \code{.yaml}
+    /// num_threads: N  # threads used to fill coordinates, connectivity
+    ///                 # and fields (default 1, <= 0 uses all cores)
+    /// \endcode
+    void CONDUIT_BLUEPRINT_API basic(const std::string &mesh_type,
+                                     conduit::index_t nx,
+                                     conduit::index_t ny,
+                                     conduit::index_t nz,
+                                     const conduit::Node &options,
+                                     conduit::Node &res);
+
     /// Generates a structured grid with an element field and a vertex field,
     /// each element of which contains a sequentially increasing value.
     /// Calling code can specify the shape of the storage array for the fields.
@@ -173,6 +186,18 @@ namespace examples
                                      conduit::index_t dz,
                                      conduit::Node &res);
 
+    /// Same as above, with the `num_threads` option used by each domain's
+    /// braid call.
+    void CONDUIT_BLUEPRINT_API grid(const std::string &mesh_type,
+                                     conduit::index_t nx,
+                                     conduit::index_t ny,
+                                     conduit::index_t nz,
+                                     conduit::index_t dx,
+                                     conduit::index_t dy,
+                                     conduit::index_t dz,
+                                     const conduit::Node &options,
+                                     conduit::Node &res);
+
     /// Generates a braid-like example mesh that covers elements defined in a
     /// rectilinear grid. The element type (e.g. triangles, quads, their 3D
     /// counterparts, or a mixture) and the coordinate set/topology
@@ -184,10 +209,31 @@ namespace examples
                                      conduit::index_t nz,
                                      conduit::Node &res);
 
+    /// Same as above, with options:
+    ///
+    /// \code{.yaml}
+    /// num_threads: N  # threads used to fill coordinates, connectivity
+    ///                 # and fields (default 1, <= 0 uses all cores)
+    /// \endcode
+    ///
+    /// The generated mesh does not depend on the number of threads.
+    void CONDUIT_BLUEPRINT_API braid(const std::string &mesh_type,
+                                     conduit::index_t nx,
+                                     conduit::index_t ny,
+                                     conduit::index_t nz,
+                                     const conduit::Node &options,
+                                     conduit::Node &res);
+
     /// Generates a multi-domain fibonacci estimation of a golden spiral.
     void CONDUIT_BLUEPRINT_API spiral(conduit::index_t ndomains,
                                       conduit::Node &res);
 
+    /// Same as above, with the `num_threads` option used to fill each
+    /// domain's field.
+    void CONDUIT_BLUEPRINT_API spiral(conduit::index_t ndomains,
+                                      const conduit::Node &options,
+                                      conduit::Node &res);
+
     /// Generates a tessellated heterogeneous polygonal mesh consisting of
     /// packed octogons and rectangles. The parameter nz can be any nonzero
     /// natural number. An nz value of 1 will produce a polytess in 2D,
@@ -0,0 +1,274 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_mesh_execution.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_blueprint_mesh_execution.hpp"
+
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <map>
+#include <mutex>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include "conduit_blueprint_mesh_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh --
+//-----------------------------------------------------------------------------
+namespace mesh
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::execution --
+//-----------------------------------------------------------------------------
+namespace execution
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::execution::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// kernels bound to allocator ids. Entries are only replaced or erased by
+// set_device_kernels and clear_device_kernels, so pointers to them stay
+// valid while an algorithm runs.
+std::mutex &
+device_kernels_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+//-----------------------------------------------------------------------------
+std::map<index_t, DeviceKernels> &
+device_kernels_map()
+{
+    static std::map<index_t, DeviceKernels> kernels;
+    return kernels;
+}
+
+//-----------------------------------------------------------------------------
+// where the numeric leaves of a set of nodes live
+struct LeafAllocators
+{
+    LeafAllocators()
+    : num_host(0), num_device(0), device_id(-1), mixed_devices(false)
+    {}
+
+    void add(const Node &n)
+    {
+        const index_t num_children = n.number_of_children();
+        if(num_children > 0)
+        {
+            for(index_t i = 0; i < num_children; i++)
+            {
+                add(n.child(i));
+            }
+            return;
+        }
+
+        if(!n.dtype().is_number())
+        {
+            return;
+        }
+
+        const index_t alloc_id = n.allocator();
+        if(!conduit::utils::is_device_allocator(alloc_id))
+        {
+            num_host++;
+        }
+        else
+        {
+            if(num_device > 0 && alloc_id != device_id)
+            {
+                mixed_devices = true;
+            }
+            device_id = alloc_id;
+            num_device++;
+        }
+    }
+
+    Backend backend() const
+    {
+        if(num_device == 0)
+        {
+            return BACKEND_HOST;
+        }
+        if(!mixed_devices && device_kernels(device_id) != NULL)
+        {
+            return BACKEND_DEVICE;
+        }
+        return BACKEND_HOST_STAGED;
+    }
+
+    index_t num_host;
+    index_t num_device;
+    index_t device_id;
+    bool    mixed_devices;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::execution::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+DeviceKernels::DeviceKernels()
+: min_max(NULL),
+  exclusive_scan(NULL),
+  fixed_centroids(NULL)
+{
+}
+
+//-----------------------------------------------------------------------------
+void
+set_device_kernels(index_t allocator_id,
+                   const DeviceKernels &kernels)
+{
+    std::lock_guard<std::mutex> lock(detail::device_kernels_mutex());
+    detail::device_kernels_map()[allocator_id] = kernels;
+}
+
+//-----------------------------------------------------------------------------
+void
+clear_device_kernels(index_t allocator_id)
+{
+    std::lock_guard<std::mutex> lock(detail::device_kernels_mutex());
+    detail::device_kernels_map().erase(allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+const DeviceKernels *
+device_kernels(index_t allocator_id)
+{
+    std::lock_guard<std::mutex> lock(detail::device_kernels_mutex());
+    std::map<index_t, DeviceKernels> &kernels = detail::device_kernels_map();
+    std::map<index_t, DeviceKernels>::const_iterator itr = kernels.find(allocator_id);
+    return itr != kernels.end() ? &itr->second : NULL;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+device_allocator(const Node &n)
+{
+    detail::LeafAllocators allocs;
+    allocs.add(n);
+    if(allocs.num_host > 0 || allocs.num_device == 0 || allocs.mixed_devices)
+    {
+        return -1;
+    }
+    return allocs.device_id;
+}
+
+//-----------------------------------------------------------------------------
+Backend
+select_backend(const Node &n)
+{
+    detail::LeafAllocators allocs;
+    allocs.add(n);
+    return allocs.backend();
+}
+
+//-----------------------------------------------------------------------------
+Backend
+select_backend(const Node &n0,
+               const Node &n1)
+{
+    detail::LeafAllocators allocs;
+    allocs.add(n0);
+    allocs.add(n1);
+    return allocs.backend();
+}
+
+//-----------------------------------------------------------------------------
+std::string
+backend_name(Backend backend)
+{
+    if(backend == BACKEND_DEVICE)
+    {
+        return "device";
+    }
+    else if(backend == BACKEND_HOST_STAGED)
+    {
+        return "host_staged";
+    }
+    return "host";
+}
+
+//-----------------------------------------------------------------------------
+const Node &
+to_host(const Node &n,
+        Node &host)
+{
+    if(select_backend(n) == BACKEND_HOST)
+    {
+        return n;
+    }
+    host.reset();
+    host.set(n);
+    return host;
+}
+
+//-----------------------------------------------------------------------------
+const Node &
+to_host_topology(const Node &topo,
+                 Node &host)
+{
+    const Node *coordset = utils::find_reference_node(topo, "coordset");
+    if(coordset == NULL)
+    {
+        CONDUIT_ERROR("blueprint::mesh::execution::to_host_topology: "
+                      "could not find the coordset of topology "
+                      << topo.name());
+    }
+
+    host.reset();
+    const std::string topo_name = topo.name().empty() ? "topo" : topo.name();
+    Node &host_topo = host["topologies"][topo_name];
+    host_topo.set(topo);
+    host["coordsets"][coordset->name()].set(*coordset);
+    return host_topo;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::execution --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,216 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_mesh_execution.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_BLUEPRINT_MESH_EXECUTION_HPP
+#define CONDUIT_BLUEPRINT_MESH_EXECUTION_HPP
+
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <string>
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_blueprint_exports.h"
+#include "conduit_blueprint_config.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh --
+//-----------------------------------------------------------------------------
+namespace mesh
+{
+
+//-----------------------------------------------------------------------------
+/// Execution backends for mesh algorithms.
+///
+/// Mesh data can live in device memory, allocated with a device allocator
+/// (see conduit::utils::set_device_allocator). The host code paths of the
+/// mesh algorithms can't read that memory, so algorithms select a backend
+/// from the allocators of their inputs' numeric leaves:
+///
+///  BACKEND_HOST: no leaf is device resident, the host path runs as is.
+///  BACKEND_DEVICE: the device resident leaves all come from one allocator
+///   with device kernels bound to it (see set_device_kernels). Supported
+///   algorithms run those kernels on the device data, their results are
+///   allocated with the same allocator.
+///  BACKEND_HOST_STAGED: any other mix of device resident leaves. Inputs
+///   are copied to host memory (with the allocators' memcpy handlers) and
+///   the host path runs on the copies.
+///
+/// The device path runs for:
+///   coordset::extents (explicit and rectilinear coordsets)
+///   topology::unstructured::generate_offsets (non stream topologies)
+///   topology::unstructured::generate_centroids (single shape unstructured
+///    topologies with explicit coordsets, without element measures)
+///
+/// to_unstructured, partition and the matset conversions are staged to
+/// the host when their inputs are device resident. Algorithms also fall
+/// back to host staging when the bound kernels don't support the types or
+/// layout of their inputs. Results of the host path (including staged
+/// runs) are in host memory, unless they are written to existing nodes
+/// that use another allocator.
+///
+/// Only numeric leaves may be device resident, string leaves (types,
+/// shapes and names) must be readable on the host.
+//-----------------------------------------------------------------------------
+namespace execution
+{
+
+//-----------------------------------------------------------------------------
+enum Backend
+{
+    BACKEND_HOST = 0,
+    BACKEND_DEVICE,
+    BACKEND_HOST_STAGED
+};
+
+//-----------------------------------------------------------------------------
+/// Kernels a device backend provides for the memory of an allocator. Each
+/// kernel gets nodes describing device resident data (its dtype is read on
+/// the host, its data only on the device) and returns false, without
+/// writing any results, if it doesn't support the given types or layout.
+/// Kernels left NULL are not supported.
+//-----------------------------------------------------------------------------
+struct CONDUIT_BLUEPRINT_API DeviceKernels
+{
+    DeviceKernels();
+
+    /// min and max of the values of a numeric leaf
+    bool (*min_max)(const Node &values,
+                    float64 &min,
+                    float64 &max);
+
+    /// offsets[i] = sizes[0] + ... + sizes[i-1], offsets is allocated by the
+    /// caller (compact, with as many elements as sizes)
+    bool (*exclusive_scan)(const Node &sizes,
+                           Node &offsets);
+
+    /// centroids of the elements of a single shape connectivity array, with
+    /// 'indices' point ids per element. Like the host path, repeated point
+    /// ids of an element are only counted once. coord_values holds the
+    /// coordset's "values", centroid_values the destination axes with the
+    /// same names (compact, one value per element, allocated by the caller).
+    bool (*fixed_centroids)(const Node &connectivity,
+                            index_t indices,
+                            const Node &coord_values,
+                            Node &centroid_values);
+};
+
+//-----------------------------------------------------------------------------
+/// Binds (or replaces) the device kernels used for data allocated with
+/// the given allocator. clear_device_kernels removes the binding.
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API set_device_kernels(index_t allocator_id,
+                                              const DeviceKernels &kernels);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API clear_device_kernels(index_t allocator_id);
+
+//-----------------------------------------------------------------------------
+/// Returns the kernels bound to the allocator, or NULL if there are none.
+//-----------------------------------------------------------------------------
+const DeviceKernels CONDUIT_BLUEPRINT_API *device_kernels(index_t allocator_id);
+
+//-----------------------------------------------------------------------------
+/// Returns the device allocator of the numeric leaves of n if all of them
+/// come from the same device allocator, otherwise -1.
+//-----------------------------------------------------------------------------
+index_t CONDUIT_BLUEPRINT_API device_allocator(const Node &n);
+
+//-----------------------------------------------------------------------------
+/// Selects the backend for an algorithm with the given inputs.
+//-----------------------------------------------------------------------------
+Backend CONDUIT_BLUEPRINT_API select_backend(const Node &n);
+
+//-----------------------------------------------------------------------------
+Backend CONDUIT_BLUEPRINT_API select_backend(const Node &n0,
+                                             const Node &n1);
+
+//-----------------------------------------------------------------------------
+std::string CONDUIT_BLUEPRINT_API backend_name(Backend backend);
+
+//-----------------------------------------------------------------------------
+/// Returns n if none of its leaves are device resident, otherwise copies n
+/// to host memory in host and returns host.
+//-----------------------------------------------------------------------------
+const Node CONDUIT_BLUEPRINT_API &to_host(const Node &n,
+                                          Node &host);
+
+//-----------------------------------------------------------------------------
+/// Copies topo and the coordset it references to host memory, as
+/// host["topologies"][name] and host["coordsets"][name], and returns the
+/// host copy of topo.
+//-----------------------------------------------------------------------------
+const Node CONDUIT_BLUEPRINT_API &to_host_topology(const Node &topo,
+                                                   Node &host);
+
+#if defined(CONDUIT_BLUEPRINT_CUDA_ENABLED)
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::execution::cuda --
+//-----------------------------------------------------------------------------
+namespace cuda
+{
+
+//-----------------------------------------------------------------------------
+/// CUDA implementations of the device kernels (for compact int32, int64,
+/// float32 and float64 data). They may be bound to any allocator that
+/// returns CUDA device or managed memory.
+//-----------------------------------------------------------------------------
+const DeviceKernels CONDUIT_BLUEPRINT_API &kernels();
+
+//-----------------------------------------------------------------------------
+/// Returns the id of an allocator for CUDA device memory, registering it
+/// on first use: it is marked as a device allocator, and bound to
+/// cudaMemcpy and cudaMemset handlers and to kernels().
+/// (the first call registers the allocator, which is not thread safe)
+//-----------------------------------------------------------------------------
+index_t CONDUIT_BLUEPRINT_API allocator_id();
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::execution::cuda --
+//-----------------------------------------------------------------------------
+#endif
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::execution --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
+
+#endif
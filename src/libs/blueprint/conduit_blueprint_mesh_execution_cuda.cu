@@ -0,0 +1,434 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_mesh_execution_cuda.cu
+///
+//-----------------------------------------------------------------------------
+#include "conduit_blueprint_mesh_execution.hpp"
+
+//-----------------------------------------------------------------------------
+// cuda includes
+//-----------------------------------------------------------------------------
+#include <cuda_runtime.h>
+#include <thrust/execution_policy.h>
+#include <thrust/extrema.h>
+#include <thrust/scan.h>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh --
+//-----------------------------------------------------------------------------
+namespace mesh
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::execution --
+//-----------------------------------------------------------------------------
+namespace execution
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::execution::cuda --
+//-----------------------------------------------------------------------------
+namespace cuda
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::execution::cuda::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+#define CONDUIT_CUDA_CHECK(call, msg)                                        \
+{                                                                            \
+    cudaError_t cuda_err = (call);                                           \
+    if(cuda_err != cudaSuccess)                                              \
+    {                                                                        \
+        CONDUIT_ERROR("blueprint::mesh::execution::cuda: " << msg << ": "    \
+                      << cudaGetErrorString(cuda_err));                      \
+    }                                                                        \
+}
+
+//-----------------------------------------------------------------------------
+// the kernels handle compact int32, int64, float32 and float64 leaves
+bool
+is_supported(const Node &n)
+{
+    const DataType &dt = n.dtype();
+    return dt.is_compact() &&
+           (dt.is_int32() || dt.is_int64() ||
+            dt.is_float32() || dt.is_float64());
+}
+
+//-----------------------------------------------------------------------------
+// allocator handlers
+//-----------------------------------------------------------------------------
+void *
+device_alloc(size_t items, size_t item_size)
+{
+    void *res = NULL;
+    // like the default allocator, memory is zero initialized
+    CONDUIT_CUDA_CHECK(cudaMalloc(&res, items * item_size), "cudaMalloc");
+    CONDUIT_CUDA_CHECK(cudaMemset(res, 0, items * item_size), "cudaMemset");
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+device_free(void *ptr)
+{
+    cudaFree(ptr);
+}
+
+//-----------------------------------------------------------------------------
+void
+device_memcpy(void *dest, const void *src, size_t num)
+{
+    CONDUIT_CUDA_CHECK(cudaMemcpy(dest, src, num, cudaMemcpyDefault),
+                       "cudaMemcpy");
+}
+
+//-----------------------------------------------------------------------------
+void
+device_memset(void *ptr, int value, size_t num)
+{
+    CONDUIT_CUDA_CHECK(cudaMemset(ptr, value, num), "cudaMemset");
+}
+
+//-----------------------------------------------------------------------------
+// min_max
+//-----------------------------------------------------------------------------
+template<typename T>
+void
+typed_min_max(const Node &values, float64 &min, float64 &max)
+{
+    const T *vals = static_cast<const T*>(values.data_ptr());
+    const index_t num_vals = values.dtype().number_of_elements();
+    thrust::pair<const T*, const T*> res =
+        thrust::minmax_element(thrust::device, vals, vals + num_vals);
+
+    T host_min, host_max;
+    CONDUIT_CUDA_CHECK(cudaMemcpy(&host_min, res.first, sizeof(T),
+                                  cudaMemcpyDeviceToHost),
+                       "min_max");
+    CONDUIT_CUDA_CHECK(cudaMemcpy(&host_max, res.second, sizeof(T),
+                                  cudaMemcpyDeviceToHost),
+                       "min_max");
+    min = static_cast<float64>(host_min);
+    max = static_cast<float64>(host_max);
+}
+
+//-----------------------------------------------------------------------------
+bool
+min_max(const Node &values, float64 &min, float64 &max)
+{
+    if(!is_supported(values) || values.dtype().number_of_elements() == 0)
+    {
+        return false;
+    }
+
+    const DataType &dt = values.dtype();
+    if(dt.is_int32())        { typed_min_max<int32>(values, min, max); }
+    else if(dt.is_int64())   { typed_min_max<int64>(values, min, max); }
+    else if(dt.is_float32()) { typed_min_max<float32>(values, min, max); }
+    else                     { typed_min_max<float64>(values, min, max); }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// exclusive_scan
+//-----------------------------------------------------------------------------
+template<typename SizeT, typename OffsetT>
+void
+typed_exclusive_scan(const Node &sizes, Node &offsets)
+{
+    const SizeT *sizes_ptr = static_cast<const SizeT*>(sizes.data_ptr());
+    OffsetT *offsets_ptr = static_cast<OffsetT*>(offsets.data_ptr());
+    const index_t num_sizes = sizes.dtype().number_of_elements();
+    thrust::exclusive_scan(thrust::device,
+                           sizes_ptr, sizes_ptr + num_sizes,
+                           offsets_ptr,
+                           OffsetT(0));
+}
+
+//-----------------------------------------------------------------------------
+template<typename SizeT>
+bool
+exclusive_scan_to(const Node &sizes, Node &offsets)
+{
+    if(offsets.dtype().is_int32())
+    {
+        typed_exclusive_scan<SizeT, int32>(sizes, offsets);
+    }
+    else if(offsets.dtype().is_int64())
+    {
+        typed_exclusive_scan<SizeT, int64>(sizes, offsets);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+exclusive_scan(const Node &sizes, Node &offsets)
+{
+    if(!is_supported(sizes) || !is_supported(offsets) ||
+       offsets.dtype().number_of_elements() != sizes.dtype().number_of_elements())
+    {
+        return false;
+    }
+
+    if(sizes.dtype().number_of_elements() == 0)
+    {
+        return true;
+    }
+
+    if(sizes.dtype().is_int32())
+    {
+        return exclusive_scan_to<int32>(sizes, offsets);
+    }
+    else if(sizes.dtype().is_int64())
+    {
+        return exclusive_scan_to<int64>(sizes, offsets);
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// fixed_centroids
+//-----------------------------------------------------------------------------
+const index_t MAX_FIXED_INDICES = 8;
+
+//-----------------------------------------------------------------------------
+template<typename IndexT, typename CoordT>
+struct CentroidArgs
+{
+    const IndexT *conn;
+    index_t       indices;
+    index_t       num_elems;
+    index_t       num_axes;
+    const CoordT *coords[3];
+    CoordT       *centroids[3];
+};
+
+//-----------------------------------------------------------------------------
+template<typename IndexT, typename CoordT>
+__global__ void
+centroids_kernel(CentroidArgs<IndexT, CoordT> args)
+{
+    const index_t ei = (index_t)blockIdx.x * blockDim.x + threadIdx.x;
+    if(ei >= args.num_elems)
+    {
+        return;
+    }
+
+    const IndexT *ids = args.conn + ei * args.indices;
+    float64 sums[3] = {0.0, 0.0, 0.0};
+    index_t num_unique = 0;
+    for(index_t pi = 0; pi < args.indices; pi++)
+    {
+        bool is_repeat = false;
+        for(index_t pj = 0; pj < pi; pj++)
+        {
+            is_repeat |= ids[pj] == ids[pi];
+        }
+        if(!is_repeat)
+        {
+            for(index_t ai = 0; ai < args.num_axes; ai++)
+            {
+                sums[ai] += static_cast<float64>(args.coords[ai][ids[pi]]);
+            }
+            num_unique++;
+        }
+    }
+
+    for(index_t ai = 0; ai < args.num_axes; ai++)
+    {
+        args.centroids[ai][ei] = static_cast<CoordT>(sums[ai] / num_unique);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<typename IndexT, typename CoordT>
+void
+typed_fixed_centroids(const Node &connectivity,
+                      index_t indices,
+                      const Node &coord_values,
+                      Node &centroid_values)
+{
+    CentroidArgs<IndexT, CoordT> args;
+    args.conn = static_cast<const IndexT*>(connectivity.data_ptr());
+    args.indices = indices;
+    args.num_elems = connectivity.dtype().number_of_elements() / indices;
+    args.num_axes = coord_values.number_of_children();
+    for(index_t ai = 0; ai < 3; ai++)
+    {
+        args.coords[ai] = NULL;
+        args.centroids[ai] = NULL;
+        if(ai < args.num_axes)
+        {
+            args.coords[ai] =
+                static_cast<const CoordT*>(coord_values.child(ai).data_ptr());
+            args.centroids[ai] =
+                static_cast<CoordT*>(centroid_values[coord_values.child(ai).name()].data_ptr());
+        }
+    }
+
+    if(args.num_elems == 0)
+    {
+        return;
+    }
+
+    const int block_size = 256;
+    const int num_blocks = (int)((args.num_elems + block_size - 1) / block_size);
+    centroids_kernel<IndexT, CoordT><<<num_blocks, block_size>>>(args);
+    CONDUIT_CUDA_CHECK(cudaGetLastError(), "fixed_centroids launch");
+    CONDUIT_CUDA_CHECK(cudaDeviceSynchronize(), "fixed_centroids");
+}
+
+//-----------------------------------------------------------------------------
+template<typename IndexT>
+bool
+fixed_centroids_for(const Node &connectivity,
+                    index_t indices,
+                    const Node &coord_values,
+                    Node &centroid_values)
+{
+    const DataType &coord_dt = coord_values.child(0).dtype();
+    if(coord_dt.is_float32())
+    {
+        typed_fixed_centroids<IndexT, float32>(connectivity, indices,
+                                               coord_values, centroid_values);
+    }
+    else if(coord_dt.is_float64())
+    {
+        typed_fixed_centroids<IndexT, float64>(connectivity, indices,
+                                               coord_values, centroid_values);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+fixed_centroids(const Node &connectivity,
+                index_t indices,
+                const Node &coord_values,
+                Node &centroid_values)
+{
+    const index_t num_axes = coord_values.number_of_children();
+    if(indices <= 0 || indices > MAX_FIXED_INDICES ||
+       num_axes < 1 || num_axes > 3 ||
+       !is_supported(connectivity))
+    {
+        return false;
+    }
+
+    // all axes (and their centroids) share one float type
+    const DataType &coord_dt = coord_values.child(0).dtype();
+    for(index_t ai = 0; ai < num_axes; ai++)
+    {
+        const Node &axis = coord_values.child(ai);
+        if(!is_supported(axis) || axis.dtype().id() != coord_dt.id() ||
+           !centroid_values.has_child(axis.name()))
+        {
+            return false;
+        }
+        const Node &dest_axis = centroid_values[axis.name()];
+        if(!is_supported(dest_axis) || dest_axis.dtype().id() != coord_dt.id())
+        {
+            return false;
+        }
+    }
+
+    if(connectivity.dtype().is_int32())
+    {
+        return fixed_centroids_for<int32>(connectivity, indices,
+                                          coord_values, centroid_values);
+    }
+    else if(connectivity.dtype().is_int64())
+    {
+        return fixed_centroids_for<int64>(connectivity, indices,
+                                          coord_values, centroid_values);
+    }
+    return false;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::execution::cuda::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+const DeviceKernels &
+kernels()
+{
+    static DeviceKernels res;
+    res.min_max = detail::min_max;
+    res.exclusive_scan = detail::exclusive_scan;
+    res.fixed_centroids = detail::fixed_centroids;
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+allocator_id()
+{
+    static index_t id = -1;
+    if(id < 0)
+    {
+        id = conduit::utils::register_allocator(detail::device_alloc,
+                                       detail::device_free);
+        conduit::utils::set_device_allocator(id);
+        conduit::utils::set_memcpy_handler(id, detail::device_memcpy);
+        conduit::utils::set_memset_handler(id, detail::device_memset);
+        set_device_kernels(id, kernels());
+    }
+    return id;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::execution::cuda --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::execution --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,349 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_mesh_field_xforms.cpp
+///
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// std lib includes
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include "conduit_blueprint_mesh.hpp"
+#include "conduit_blueprint_mesh_utils.hpp"
+#include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
+
+using namespace conduit;
+// access conduit blueprint mesh utilities
+namespace bputils = conduit::blueprint::mesh::utils;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh --
+//-----------------------------------------------------------------------------
+namespace mesh
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::field --
+//-----------------------------------------------------------------------------
+namespace field
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::field::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// Field Recentering
+//
+// Vertex to element recentering gathers the values of each element's
+// vertices: single shape and structured topologies are read with
+// shape-specialized kernels ('iterate_fixed_elements_parallel'), other
+// topologies through their element to vertex adjacency. Element to vertex
+// recentering gathers the values of each vertex's elements, from the
+// inverse (vertex to element) adjacency. Every output value is written by
+// one thread, so no atomics are needed.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Element functor for 'iterate_fixed_elements_parallel' that sets each
+// element's value to the average of the values of its vertices. Like the
+// element centroids, repeated point ids are only counted once.
+template<typename InView, typename OutT>
+struct FixedVertexToElementKernel
+{
+    FixedVertexToElementKernel(const InView &in, OutT *out)
+    : m_in(in), m_out(out)
+    {}
+
+    template<bputils::topology::ShapeId S>
+    void operator()(const bputils::topology::fixed_entity<S> &e) const
+    {
+        const index_t num_indices = bputils::topology::fixed_shape_indices<S>::value;
+        float64 sum = 0.0;
+        index_t num_unique = 0;
+        for(index_t pi = 0; pi < num_indices; pi++)
+        {
+            bool is_repeat = false;
+            for(index_t pj = 0; pj < pi; pj++)
+            {
+                is_repeat |= e.element_ids[pj] == e.element_ids[pi];
+            }
+            if(!is_repeat)
+            {
+                sum += static_cast<float64>(m_in[e.element_ids[pi]]);
+                num_unique++;
+            }
+        }
+        m_out[e.entity_id] = static_cast<OutT>(sum / num_unique);
+    }
+
+    InView  m_in;
+    OutT   *m_out;
+};
+
+//-----------------------------------------------------------------------------
+// The adjacency a field is recentered with. 'offsets' and 'ids' hold the
+// inputs of each output (element to vertex or vertex to element), they are
+// left empty when vertex values are gathered with the fixed shape kernel.
+struct Recentering
+{
+    const Node           *topo;
+    bool                  use_fixed_kernel;
+    index_t               num_threads;
+    index_t               num_inputs;
+    index_t               num_outputs;
+    std::vector<index_t>  offsets;
+    std::vector<index_t>  ids;
+
+    //-------------------------------------------------------------------------
+    template<typename InView, typename OutT>
+    void execute(const InView &in, OutT *out) const
+    {
+        if(use_fixed_kernel)
+        {
+            bputils::topology::iterate_fixed_elements_parallel(*topo, num_threads,
+                FixedVertexToElementKernel<InView, OutT>(in, out));
+            return;
+        }
+
+        bputils::detail::parallel_chunks(
+            bputils::detail::parallel_num_chunks(num_threads, num_outputs, 1024),
+            num_outputs,
+            [&](index_t /*ci*/, index_t begin, index_t end)
+        {
+            for(index_t oi = begin; oi < end; oi++)
+            {
+                const index_t ids_begin = offsets[oi];
+                const index_t ids_end = offsets[oi + 1];
+                float64 sum = 0.0;
+                for(index_t ii = ids_begin; ii < ids_end; ii++)
+                {
+                    sum += static_cast<float64>(in[ids[ii]]);
+                }
+                out[oi] = ids_end > ids_begin ?
+                    static_cast<OutT>(sum / (ids_end - ids_begin)) : OutT(0);
+            }
+        });
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Recenters one array of values. Compact float32 and float64 values are read
+// through Spans, other values through an accessor. float32 values stay
+// float32, others are written as float64.
+static void
+recenter_values(const Node &src,
+                const Recentering &rc,
+                Node &dest)
+{
+    const DataType &src_dtype = src.dtype();
+    if(src_dtype.number_of_elements() != rc.num_inputs)
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter field values '"
+                      << src.path() << "' have "
+                      << src_dtype.number_of_elements()
+                      << " entries, expected " << rc.num_inputs);
+    }
+
+    if(src_dtype.is_float32())
+    {
+        dest.set(DataType::float32(rc.num_outputs));
+        float32 *out = dest.value();
+        if(src_dtype.is_compact())
+        {
+            rc.execute(src.as_span<float32>(), out);
+        }
+        else
+        {
+            rc.execute(src.as_float64_accessor(), out);
+        }
+    }
+    else
+    {
+        dest.set(DataType::float64(rc.num_outputs));
+        float64 *out = dest.value();
+        if(src_dtype.is_float64() && src_dtype.is_compact())
+        {
+            rc.execute(src.as_span<float64>(), out);
+        }
+        else
+        {
+            rc.execute(src.as_float64_accessor(), out);
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::field::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+recenter(const conduit::Node &mesh,
+         const std::string &field_name,
+         const std::string &association,
+         conduit::Node &dest_field)
+{
+    recenter(mesh, field_name, association, dest_field, Node());
+}
+
+//-----------------------------------------------------------------------------
+void
+recenter(const conduit::Node &mesh,
+         const std::string &field_name,
+         const std::string &association,
+         conduit::Node &dest_field,
+         const conduit::Node &options)
+{
+    if(!mesh.has_child("fields") || !mesh["fields"].has_child(field_name))
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter mesh does not have "
+                      "field '" << field_name << "'");
+    }
+    if(association != "vertex" && association != "element")
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter association must be "
+                      "'vertex' or 'element', not '" << association << "'");
+    }
+
+    const Node &field = mesh["fields"][field_name];
+    if(!field.has_child("association") || !field.has_child("topology") ||
+       !field.has_child("values"))
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter field '" << field_name
+                      << "' must have an 'association', a 'topology' and "
+                      "'values'");
+    }
+
+    const std::string src_association = field["association"].as_string();
+    const std::string topo_name = field["topology"].as_string();
+    if(src_association != "vertex" && src_association != "element")
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter field '" << field_name
+                      << "' has unsupported association '"
+                      << src_association << "'");
+    }
+
+    const Node &topo = mesh["topologies"][topo_name];
+
+    dest_field.reset();
+    dest_field["association"].set(association);
+    dest_field["topology"].set(topo_name);
+    if(field.has_child("units"))
+    {
+        dest_field["units"].set(field["units"]);
+    }
+
+    if(src_association == association)
+    {
+        dest_field["values"].set(field["values"]);
+        return;
+    }
+
+    // Adjacency //
+
+    detail::Recentering rc;
+    rc.topo = &topo;
+    rc.num_threads = bputils::detail::num_threads_option(options);
+    rc.use_fixed_kernel = false;
+
+    const index_t num_verts = bputils::coordset::length(bputils::topology::coordset(topo));
+    if(association == "element")
+    {
+        rc.num_inputs = num_verts;
+        rc.num_outputs = bputils::topology::length(topo);
+        const std::string topo_type = topo["type"].as_string();
+        const Node *shape = topo.fetch_ptr("elements/shape");
+        rc.use_fixed_kernel = topo_type == "uniform" ||
+                              topo_type == "rectilinear" ||
+                              topo_type == "structured";
+        if(topo_type == "unstructured" &&
+           shape != NULL && shape->dtype().is_string())
+        {
+            const bputils::ShapeType st(shape->as_string());
+            rc.use_fixed_kernel = st.is_valid() && !st.is_poly() &&
+                                  st.type != "mixed";
+        }
+
+        if(!rc.use_fixed_kernel)
+        {
+            bputils::topology::element_vertices(topo, rc.num_threads,
+                                                rc.offsets, rc.ids);
+            rc.num_outputs = (index_t)rc.offsets.size() - 1;
+        }
+    }
+    else // element to vertex
+    {
+        std::vector<index_t> elem_offsets, elem_verts;
+        bputils::topology::element_vertices(topo, rc.num_threads,
+                                            elem_offsets, elem_verts);
+        bputils::topology::invert_adjacency(elem_offsets, elem_verts,
+                                            num_verts, rc.num_threads,
+                                            rc.offsets, rc.ids);
+        rc.num_inputs = (index_t)elem_offsets.size() - 1;
+        rc.num_outputs = num_verts;
+    }
+
+    // Values //
+
+    const Node &src_values = field["values"];
+    Node &dest_values = dest_field["values"];
+    if(src_values.dtype().is_object())
+    {
+        NodeConstIterator comp_itr = src_values.children();
+        while(comp_itr.has_next())
+        {
+            const Node &comp = comp_itr.next();
+            detail::recenter_values(comp, rc, dest_values[comp_itr.name()]);
+        }
+    }
+    else
+    {
+        detail::recenter_values(src_values, rc, dest_values);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::field --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint:::mesh --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
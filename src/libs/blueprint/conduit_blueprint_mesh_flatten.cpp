@@ -12,7 +12,9 @@
 //-----------------------------------------------------------------------------
 // std lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <iostream>
 #include <set>
 #include <string>
@@ -65,9 +67,11 @@ namespace utils
 {
 
 //-----------------------------------------------------------------------------
-template<typename SrcType, typename DestType>
+// 'SrcArray' is a DataArray or anything else indexable like one, such as a
+// coordset::CoordAccessor::Axis.
+template<typename SrcArray, typename DestType>
 static void
-append_data_array_impl2(const DataArray<SrcType> &src,
+append_data_array_impl2(const SrcArray &src,
     DataArray<DestType> &dest, index_t offset, index_t nelems)
 {
     index_t off = offset;
@@ -78,83 +82,71 @@ append_data_array_impl2(const DataArray<SrcType> &src,
 }
 
 //-----------------------------------------------------------------------------
-template<typename SrcType>
-static void
-append_data_array_impl1(const DataArray<SrcType> &src, Node &dest,
-    index_t offset, index_t nelems)
+// dispatch functor for append_data_array_impl1, the dest element type
+// is the dispatched type.
+template<typename SrcArray>
+struct AppendDataArrayImpl1
 {
-    const index_t dtype_id = dest.dtype().id();
-    switch(dtype_id)
-    {
-    // Signed int types
-    case DataType::INT8_ID:
-    {
-        DataArray<int8> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    case DataType::INT16_ID:
-    {
-        DataArray<int16> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    case DataType::INT32_ID:
-    {
-        DataArray<int32> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    case DataType::INT64_ID:
-    {
-        DataArray<int64> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    // Unsigned int types
-    case DataType::UINT8_ID:
-    {
-        DataArray<uint8> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    case DataType::UINT16_ID:
-    {
-        DataArray<uint16> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    case DataType::UINT32_ID:
-    {
-        DataArray<uint32> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    case DataType::UINT64_ID:
-    {
-        DataArray<uint64> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    // Floating point types
-    case DataType::FLOAT32_ID:
-    {
-        DataArray<float32> value = dest.value();
-        append_data_array_impl2(src, value, offset, nelems);
-        break;
-    }
-    case DataType::FLOAT64_ID:
+    const SrcArray &src;
+    Node           &dest;
+    index_t         offset;
+    index_t         nelems;
+
+    template<typename DestType>
+    void operator()(DestType *) const
     {
-        DataArray<float64> value = dest.value();
+        DataArray<DestType> value(dest.data_ptr(), dest.dtype());
         append_data_array_impl2(src, value, offset, nelems);
-        break;
     }
-    default:
+};
+
+//-----------------------------------------------------------------------------
+template<typename SrcArray>
+static void
+append_data_array_impl1(const SrcArray &src, Node &dest,
+    index_t offset, index_t nelems)
+{
+    AppendDataArrayImpl1<SrcArray> func = {src, dest, offset, nelems};
+    dispatch(dest, func);
+}
+
+//-----------------------------------------------------------------------------
+// dispatch2 functor that converts 'nelems' values of the source to the
+// dest, starting at the dest element 'offset'. Compact arrays are copied
+// with a plain pointer loop the compiler can vectorize.
+struct AppendDataArray
+{
+    index_t src_stride;
+    index_t dest_stride;
+    index_t offset;
+    index_t nelems;
+
+    template<typename SrcType, typename DestType>
+    void operator()(const SrcType *src, DestType *dest) const
     {
-        CONDUIT_ERROR("Invalid data type passed to append_data");
-    }
+        if(src_stride == (index_t)sizeof(SrcType) &&
+           dest_stride == (index_t)sizeof(DestType))
+        {
+            DestType *dest_vals = dest + offset;
+            for(index_t i = 0; i < nelems; i++)
+            {
+                dest_vals[i] = static_cast<DestType>(src[i]);
+            }
+        }
+        else
+        {
+            const uint8 *src_bytes = reinterpret_cast<const uint8 *>(src);
+            uint8 *dest_bytes = reinterpret_cast<uint8 *>(dest) +
+                                offset * dest_stride;
+            for(index_t i = 0; i < nelems; i++)
+            {
+                *reinterpret_cast<DestType *>(dest_bytes + i * dest_stride) =
+                    static_cast<DestType>(
+                        *reinterpret_cast<const SrcType *>(src_bytes + i * src_stride));
+            }
+        }
     }
-}
+};
 
 //-----------------------------------------------------------------------------
 static void
@@ -174,78 +166,15 @@ append_data_array(const Node &src, Node &dest,
             << " > " << dest.dtype().number_of_elements() << ".");
         return;
     }
-
-    const index_t dtype_id = src.dtype().id();
-    switch(dtype_id)
-    {
-    // Signed int types
-    case DataType::INT8_ID:
-    {
-        const DataArray<int8> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    case DataType::INT16_ID:
-    {
-        const DataArray<int16> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    case DataType::INT32_ID:
-    {
-        const DataArray<int32> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    case DataType::INT64_ID:
-    {
-        const DataArray<int64> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    // Unsigned int types
-    case DataType::UINT8_ID:
-    {
-        const DataArray<uint8> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    case DataType::UINT16_ID:
-    {
-        const DataArray<uint16> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    case DataType::UINT32_ID:
-    {
-        const DataArray<uint32> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    case DataType::UINT64_ID:
-    {
-        const DataArray<uint64> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    // Floating point types
-    case DataType::FLOAT32_ID:
-    {
-        const DataArray<float32> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    case DataType::FLOAT64_ID:
-    {
-        const DataArray<float64> value = src.value();
-        append_data_array_impl1(value, dest, offset, nelems);
-        break;
-    }
-    default:
+    if(!src.dtype().is_number() || !dest.dtype().is_number())
     {
         CONDUIT_ERROR("Invalid data type passed to append_data");
+        return;
     }
-    }
+
+    AppendDataArray func = {src.dtype().stride(), dest.dtype().stride(),
+                            offset, nelems};
+    dispatch2(src, dest, func);
 }
 
 //-----------------------------------------------------------------------------
@@ -284,10 +213,10 @@ append_data(const Node &src, Node &dest, index_t offset,
 }
 
 //-----------------------------------------------------------------------------
-template<typename CsetType, typename OutputType>
+template<typename CsetArray, typename OutputType>
 static void
 generate_element_centers_impl(const Node &topo, const index_t dimension,
-    const DataArray<CsetType> *cset_values, DataArray<OutputType> *output_values,
+    const CsetArray *cset_values, DataArray<OutputType> *output_values,
     const index_t offset)
 {
     using conduit::blueprint::mesh::utils::topology::entity;
@@ -317,7 +246,7 @@ MeshFlattener::MeshFlattener()
     : topology(""), field_names(),
     default_dtype(blueprint::mesh::utils::DEFAULT_FLOAT_DTYPE.id()),
     float_fill_value(0.), int_fill_value(0), add_cell_centers(true),
-    add_domain_info(true), add_vertex_locations(true)
+    add_domain_info(true), add_vertex_locations(true), num_threads(1)
 {
     // Construct with defaults
 }
@@ -479,6 +408,22 @@ MeshFlattener::set_options(const Node &options)
         }
     }
 
+    // "num_threads", the number of threads used to flatten domains
+    if(options.has_child("num_threads"))
+    {
+        const Node &n_num_threads = options["num_threads"];
+        if(n_num_threads.dtype().is_number())
+        {
+            this->num_threads = std::max<index_t>(1, n_num_threads.to_index_t());
+        }
+        else
+        {
+            ok = false;
+            CONDUIT_ERROR("options[" << quote("num_threads") <<
+                "] must be a number.");
+        }
+    }
+
     return ok;
 }
 
@@ -868,17 +813,51 @@ MeshFlattener::allocate_column(Node &column, index_t nrows, index_t dtype_id,
 //-----------------------------------------------------------------------------
 void
 MeshFlattener::generate_element_centers(const Node &topo,
-    const Node &explicit_cset, Node &output, index_t offset) const
+    const Node &cset, Node &output, index_t offset) const
 {
     using namespace blueprint::mesh::utils::topology;
-    const Node &n_cset_values = explicit_cset["values"];
-    const index_t dimension = n_cset_values.number_of_children();
     if(!output[0].dtype().is_floating_point())
     {
         CONDUIT_ERROR("Cell center output DataType must be floating point.");
         return;
     }
 
+    if(cset["type"].as_string() != "explicit")
+    {
+        typedef utils::coordset::CoordAccessor::Axis Axis;
+        const utils::coordset::CoordAccessor coords(cset);
+        const index_t dimension = coords.dims();
+        const std::array<Axis, 3> cset_values{
+            (dimension > 0) ? coords.axis(0) : Axis(),
+            (dimension > 1) ? coords.axis(1) : Axis(),
+            (dimension > 2) ? coords.axis(2) : Axis(),
+        };
+        if(output[0].dtype().is_float32())
+        {
+            std::array<DataArray<float32>, 3> output_values{
+                (dimension > 0) ? output[0].value() : DataArray<float32>(),
+                (dimension > 1) ? output[1].value() : DataArray<float32>(),
+                (dimension > 2) ? output[2].value() : DataArray<float32>(),
+            };
+            utils::generate_element_centers_impl<Axis, float32>(topo, dimension,
+                cset_values.data(), output_values.data(), offset);
+        }
+        else
+        {
+            std::array<DataArray<float64>, 3> output_values{
+                (dimension > 0) ? output[0].value() : DataArray<float64>(),
+                (dimension > 1) ? output[1].value() : DataArray<float64>(),
+                (dimension > 2) ? output[2].value() : DataArray<float64>(),
+            };
+            utils::generate_element_centers_impl<Axis, float64>(topo, dimension,
+                cset_values.data(), output_values.data(), offset);
+        }
+        return;
+    }
+
+    const Node &n_cset_values = cset["values"];
+    const index_t dimension = n_cset_values.number_of_children();
+
     // Figure out the type of the input coordinates
     // Need to be sure that they are all the same type
     const index_t cset_type = determine_element_dtype(n_cset_values);
@@ -922,7 +901,7 @@ MeshFlattener::generate_element_centers(const Node &topo,
         (dimension > 1) ? n_cset_values[1].value() : DataArray<CsetType>(),\
         (dimension > 2) ? n_cset_values[2].value() : DataArray<CsetType>(),\
     };\
-    utils::generate_element_centers_impl<CsetType, OutputType>(topo, dimension,\
+    utils::generate_element_centers_impl<DataArray<CsetType>, OutputType>(topo, dimension,\
         cset_values.data(), output_values.data(), offset);\
 }
 
@@ -1065,34 +1044,42 @@ MeshFlattener::flatten_single_domain(const Node &mesh, Node &output,
     const conduit::Node &cset = get_coordset(mesh);
     const index_t nelems = blueprint::mesh::topology::length(topo);
     const index_t nverts = blueprint::mesh::coordset::length(cset);
-    Node &vert_table = output["vertex_data"];
-    Node &elem_table = output["element_data"];
-
-    // Used to store an explicit version of the current cset.
-    //  Either holds ownership of data created by coordset::<type>::to_explicit
-    //  OR points to the actual coordset data via set_external.
-    //  Should be treated as READ ONLY.
-    // NOTE: Is there a better way for me todo this? Don't want to have
-    //  to copy an entire explicit coordset if it's already explicit.
-    Node explicit_cset;
-
-    // Add coordset data to table
+    // Domains may be flattened concurrently, so only look up existing
+    // children of the (already allocated) output.
+    Node &vert_table = output.fetch_existing("vertex_data");
+    Node &elem_table = output.fetch_existing("element_data");
+
+    // Add coordset data to table. Uniform and rectilinear coordinates are
+    //  computed as they are appended instead of being made explicit first.
     if(this->add_vertex_locations)
     {
-        coordset_to_explicit(cset, explicit_cset);
-        Node &cset_output = vert_table["values"][0];
-        utils::append_data(explicit_cset["values"], cset_output, vert_offset, nverts);
+        Node &cset_output = vert_table.fetch_existing("values").child(0);
+        if(cset["type"].as_string() != "explicit")
+        {
+            const utils::coordset::CoordAccessor coords(cset);
+            const std::vector<std::string> cset_axes = utils::coordset::axes(cset);
+            for(index_t d = 0; d < coords.dims(); d++)
+            {
+                if(!cset_output.has_child(cset_axes[d]))
+                {
+                    CONDUIT_ERROR("Dest does not have a child named " << quote(cset_axes[d]));
+                    continue;
+                }
+                utils::append_data_array_impl1(coords.axis(d),
+                    cset_output[cset_axes[d]], vert_offset, nverts);
+            }
+        }
+        else
+        {
+            utils::append_data(cset["values"], cset_output, vert_offset, nverts);
+        }
     }
 
     // Add cell center information to element table
     if(this->add_cell_centers)
     {
-        if(explicit_cset.dtype().is_empty())
-        {
-            coordset_to_explicit(cset, explicit_cset);
-        }
-        Node &element_center_output = elem_table["values/element_centers"];
-        generate_element_centers(topo, explicit_cset, element_center_output, elem_offset);
+        Node &element_center_output = elem_table.fetch_existing("values/element_centers");
+        generate_element_centers(topo, cset, element_center_output, elem_offset);
     }
 
     // Add domain_id + vertex/element ids to their respective tables
@@ -1108,9 +1095,9 @@ MeshFlattener::flatten_single_domain(const Node &mesh, Node &output,
         if(vert_table.has_path("values/domain_id")
             && vert_table.has_path("values/vertex_id"))
         {
-            utils::for_each_in_range<index_t>(vert_table["values/domain_id"],
+            utils::for_each_in_range<index_t>(vert_table.fetch_existing("values/domain_id"),
                 vert_offset, vert_offset + nverts, set_domain_id);
-            utils::for_each_in_range<index_t>(vert_table["values/vertex_id"],
+            utils::for_each_in_range<index_t>(vert_table.fetch_existing("values/vertex_id"),
                 vert_offset, vert_offset + nverts, set_id);
         }
 
@@ -1118,9 +1105,9 @@ MeshFlattener::flatten_single_domain(const Node &mesh, Node &output,
             && elem_table.has_path("values/element_id"))
         {
             // Element table values
-            utils::for_each_in_range<index_t>(elem_table["values/domain_id"],
+            utils::for_each_in_range<index_t>(elem_table.fetch_existing("values/domain_id"),
                 elem_offset, elem_offset + nelems, set_domain_id);
-            utils::for_each_in_range<index_t>(elem_table["values/element_id"],
+            utils::for_each_in_range<index_t>(elem_table.fetch_existing("values/element_id"),
                 elem_offset, elem_offset + nelems, set_id);
         }
     }
@@ -1146,12 +1133,14 @@ MeshFlattener::flatten_single_domain(const Node &mesh, Node &output,
             const Node &field_values = field->child("values");
             if(association == "vertex")
             {
-                utils::append_data(field_values, vert_table["values/" + field_name],
+                utils::append_data(field_values,
+                    vert_table.fetch_existing("values/" + field_name),
                     vert_offset, nverts);
             }
             else if(association == "element")
             {
-                utils::append_data(field_values, elem_table["values/" + field_name],
+                utils::append_data(field_values,
+                    elem_table.fetch_existing("values/" + field_name),
                     elem_offset, nelems);
             }
         }
@@ -1167,15 +1156,10 @@ MeshFlattener::flatten_single_domain(const Node &mesh, Node &output,
 
 //-----------------------------------------------------------------------------
 void
-MeshFlattener::flatten_many_domains(const Node &mesh, Node &output) const
+MeshFlattener::allocate_tables(const Node &mesh, const MeshInfo &info,
+    const std::vector<std::string> &fields_to_flatten,
+    index_t nverts, index_t nelems, Node &output) const
 {
-    MeshInfo info;
-    collect_mesh_info(mesh, info);
-#ifdef DEBUG_MESH_FLATTEN
-    std::cout << "Total number of verticies: " << info.nverts << "\n"
-        << "Total number of elements: " << info.nelems << std::endl;
-#endif
-
     // Make allocations
     Node &vertex_table = output["vertex_data"];
     Node &element_table = output["element_data"];
@@ -1187,7 +1171,7 @@ MeshFlattener::flatten_many_domains(const Node &mesh, Node &output) const
         for(index_t d = 0; d < info.dimension; d++)
         {
             allocate_column(vertex_table[cset_output_path + "/" + info.axes[d]],
-                info.nverts, info.coord_type);
+                nverts, info.coord_type);
         }
     }
 
@@ -1198,13 +1182,11 @@ MeshFlattener::flatten_many_domains(const Node &mesh, Node &output) const
         for(index_t d = 0; d < info.dimension; d++)
         {
             allocate_column(element_table[elem_center_output_path + "/" + info.axes[d]],
-                info.nelems, this->default_dtype);
+                nelems, this->default_dtype);
         }
     }
 
     // Allocate fields output
-    std::vector<std::string> fields_to_flatten;
-    get_fields_to_flatten(mesh, get_topology(mesh[0]).name(), fields_to_flatten);
     for(const std::string &field_name : fields_to_flatten)
     {
         const Node *ref_field = get_reference_field(mesh, get_topology(mesh[0]).name(),
@@ -1216,11 +1198,11 @@ MeshFlattener::flatten_many_domains(const Node &mesh, Node &output) const
             const index_t elem_dtype_id = determine_element_dtype(field_values);
             if(assoc == "vertex")
             {
-                allocate_column(vertex_table["values/" + field_name], info.nverts, elem_dtype_id, &field_values);
+                allocate_column(vertex_table["values/" + field_name], nverts, elem_dtype_id, &field_values);
             }
             else if(assoc == "element")
             {
-                allocate_column(element_table["values/" + field_name], info.nelems, elem_dtype_id, &field_values);
+                allocate_column(element_table["values/" + field_name], nelems, elem_dtype_id, &field_values);
             }
             else
             {
@@ -1242,8 +1224,8 @@ MeshFlattener::flatten_many_domains(const Node &mesh, Node &output) const
     {
         if(this->add_domain_info)
         {
-            allocate_column(vertex_table["values/domain_id"], info.nverts, dt_index_t.id());
-            allocate_column(vertex_table["values/vertex_id"], info.nverts, dt_index_t.id());
+            allocate_column(vertex_table["values/domain_id"], nverts, dt_index_t.id());
+            allocate_column(vertex_table["values/vertex_id"], nverts, dt_index_t.id());
         }
     }
 
@@ -1251,25 +1233,200 @@ MeshFlattener::flatten_many_domains(const Node &mesh, Node &output) const
     {
         if(this->add_domain_info)
         {
-            allocate_column(element_table["values/domain_id"], info.nelems, dt_index_t.id());
-            allocate_column(element_table["values/element_id"], info.nelems, dt_index_t.id());
+            allocate_column(element_table["values/domain_id"], nelems, dt_index_t.id());
+            allocate_column(element_table["values/element_id"], nelems, dt_index_t.id());
         }
     }
+}
 
-    DEBUG_PRINT("Table allocation:" << output.schema().to_json() << std::endl);
-
-    // Flatten each domain
-    index_t vert_offset = 0, elem_offset = 0;
+//-----------------------------------------------------------------------------
+void
+MeshFlattener::flatten_domains(const Node &mesh, Node &output,
+    const std::vector<std::string> &fields_to_flatten, const MeshInfo &info,
+    index_t vert_offset, index_t elem_offset) const
+{
+    // The rows of each domain start after the rows of the domains before it.
+    std::vector<index_t> vert_offsets(info.ndomains), elem_offsets(info.ndomains);
     for(index_t i = 0; i < info.ndomains; i++)
     {
-        flatten_single_domain(mesh[i], output, fields_to_flatten, info.domain_ids[i], vert_offset, elem_offset);
+        vert_offsets[i] = vert_offset;
+        elem_offsets[i] = elem_offset;
         vert_offset += info.verts_per_domain[i];
         elem_offset += info.elems_per_domain[i];
     }
 
+    // Make sure both tables exist so flatten_single_domain() only looks up
+    // existing children.
+    output["vertex_data"];
+    output["element_data"];
+
+    // Each domain fills its own range of rows in every column.
+    utils::detail::parallel_chunks(
+        utils::detail::parallel_num_chunks(this->num_threads, info.ndomains, 1),
+        info.ndomains,
+        [&](index_t, index_t begin, index_t end)
+    {
+        for(index_t i = begin; i < end; i++)
+        {
+            DEBUG_PRINT("Flattening domain " << i << std::endl);
+            flatten_single_domain(mesh[i], output, fields_to_flatten,
+                info.domain_ids[i], vert_offsets[i], elem_offsets[i]);
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+void
+MeshFlattener::flatten_many_domains(const Node &mesh, Node &output) const
+{
+    MeshInfo info;
+    collect_mesh_info(mesh, info);
+#ifdef DEBUG_MESH_FLATTEN
+    std::cout << "Total number of verticies: " << info.nverts << "\n"
+        << "Total number of elements: " << info.nelems << std::endl;
+#endif
+
+    std::vector<std::string> fields_to_flatten;
+    get_fields_to_flatten(mesh, get_topology(mesh[0]).name(), fields_to_flatten);
+    allocate_tables(mesh, info, fields_to_flatten, info.nverts, info.nelems, output);
+
+    DEBUG_PRINT("Table allocation:" << output.schema().to_json() << std::endl);
+
+    // Flatten each domain
+    flatten_domains(mesh, output, fields_to_flatten, info, 0, 0);
+
     cleanup_output(output);
 }
 
+//-----------------------------------------------------------------------------
+// Collects the leaf columns of a table's values (mcarray columns have one
+// leaf per component) in a fixed order.
+static void
+table_leaves(Node &values, std::vector<Node *> &leaves)
+{
+    leaves.clear();
+    for(index_t i = 0; i < values.number_of_children(); i++)
+    {
+        Node &column = values[i];
+        if(column.number_of_children() > 0)
+        {
+            for(index_t j = 0; j < column.number_of_children(); j++)
+                leaves.push_back(&column[j]);
+        }
+        else
+        {
+            leaves.push_back(&column);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+MeshFlattener::execute(const Node &mesh, index_t batch_rows,
+    const BatchCallback &callback) const
+{
+    if(batch_rows < 1)
+    {
+        CONDUIT_ERROR("MeshFlattener::execute batch_rows must be at least 1.");
+    }
+
+    Node temp;
+    const Node *domains = &mesh;
+    if(!blueprint::mesh::is_multi_domain(mesh))
+    {
+        temp["domain_0"].set_external(mesh);
+        domains = &temp;
+    }
+
+    MeshInfo info;
+    collect_mesh_info(*domains, info);
+    std::vector<std::string> fields_to_flatten;
+    get_fields_to_flatten(*domains, get_topology(domains->child(0)).name(),
+        fields_to_flatten);
+
+    // One batch of rows per table, filled from each domain's table.
+    Node batches;
+    allocate_tables(*domains, info, fields_to_flatten, batch_rows, batch_rows, batches);
+    MeshFlattener::cleanup_output(batches);
+
+    const index_t ntables = batches.number_of_children();
+    std::vector<std::vector<Node *>> batch_leaves(ntables);
+    std::vector<index_t> batch_fill(ntables, 0), rows_emitted(ntables, 0);
+    for(index_t t = 0; t < ntables; t++)
+        table_leaves(batches[t]["values"], batch_leaves[t]);
+
+    // Passes the first nrows rows of table t's batch to the callback.
+    const auto emit = [&](index_t t, index_t nrows)
+    {
+        Node batch;
+        Node &batch_values = batch["values"];
+        Node &values = batches[t]["values"];
+        for(index_t i = 0; i < values.number_of_children(); i++)
+        {
+            Node &column = values[i];
+            if(column.number_of_children() > 0)
+            {
+                for(index_t j = 0; j < column.number_of_children(); j++)
+                {
+                    batch_values[column.name()][column[j].name()].set_external(
+                        DataType(column[j].dtype().id(), nrows), column[j].data_ptr());
+                }
+            }
+            else
+            {
+                batch_values[column.name()].set_external(
+                    DataType(column.dtype().id(), nrows), column.data_ptr());
+            }
+        }
+        callback(batches[t].name(), rows_emitted[t], batch);
+        rows_emitted[t] += nrows;
+        batch_fill[t] = 0;
+    };
+
+    std::vector<Node *> dom_leaves;
+    for(index_t d = 0; d < info.ndomains; d++)
+    {
+        Node dom_output;
+        allocate_tables(*domains, info, fields_to_flatten,
+            info.verts_per_domain[d], info.elems_per_domain[d], dom_output);
+        flatten_single_domain(domains->child(d), dom_output, fields_to_flatten,
+            info.domain_ids[d], 0, 0);
+
+        for(index_t t = 0; t < ntables; t++)
+        {
+            const std::string &table_name = batches[t].name();
+            const index_t dom_rows = (table_name == "vertex_data") ?
+                info.verts_per_domain[d] : info.elems_per_domain[d];
+            table_leaves(dom_output[table_name]["values"], dom_leaves);
+
+            // Copy the domain's rows into the batch, emitting it when full.
+            index_t row = 0;
+            while(row < dom_rows)
+            {
+                const index_t n = std::min(dom_rows - row, batch_rows - batch_fill[t]);
+                for(size_t c = 0; c < dom_leaves.size(); c++)
+                {
+                    const index_t nbytes = dom_leaves[c]->dtype().element_bytes();
+                    std::memcpy(static_cast<uint8 *>(batch_leaves[t][c]->data_ptr()) + batch_fill[t] * nbytes,
+                                static_cast<const uint8 *>(dom_leaves[c]->data_ptr()) + row * nbytes,
+                                n * nbytes);
+                }
+                batch_fill[t] += n;
+                row += n;
+                if(batch_fill[t] == batch_rows)
+                    emit(t, batch_rows);
+            }
+        }
+    }
+
+    // Emit what is left of each table.
+    for(index_t t = 0; t < ntables; t++)
+    {
+        if(batch_fill[t] > 0)
+            emit(t, batch_fill[t]);
+    }
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh --
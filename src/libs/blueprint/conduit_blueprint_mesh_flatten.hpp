@@ -16,6 +16,7 @@
 //-----------------------------------------------------------------------------
 // std lib includes
 //-----------------------------------------------------------------------------
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -94,6 +95,25 @@ public:
     virtual bool set_options(const Node &options);
 
     void execute(const Node &mesh, Node &output) const;
+
+    /**
+    @brief Called with each batch of rows of a table.
+    @param table_name "vertex_data" or "element_data".
+    @param row_offset The row of the whole table that the batch starts at.
+    @param batch A blueprint table whose columns hold the rows of the batch.
+        Its data is only valid during the call.
+    */
+    using BatchCallback = std::function<void(const std::string &table_name,
+        index_t row_offset, const Node &batch)>;
+
+    /**
+    @brief Flattens the mesh one domain at a time and passes the rows of each
+        table to callback in batches of batch_rows rows (the last batch of
+        each table may be shorter). Only one domain's table and one batch
+        per table are held in memory at a time.
+    */
+    void execute(const Node &mesh, index_t batch_rows,
+        const BatchCallback &callback) const;
 protected:
     const Node &get_coordset(const Node &mesh) const;
     const Node &get_topology(const Node &mesh) const;
@@ -159,9 +179,22 @@ protected:
     void allocate_column(Node &column, index_t nrows, index_t dtype_id,
         const Node *ref_node = nullptr) const;
 
-    void generate_element_centers(const Node &topo, const Node &explicit_cset,
+    /**
+    @brief Writes the element centers of topo to the output columns starting
+        at row offset. Uniform and rectilinear coordsets are read through a
+        coordset::CoordAccessor instead of being made explicit.
+    */
+    void generate_element_centers(const Node &topo, const Node &cset,
         Node &output, index_t offset) const;
 
+    /**
+    @brief Allocates the columns of the output tables for the given fields
+        with nverts rows in "vertex_data" and nelems rows in "element_data".
+    */
+    void allocate_tables(const Node &mesh, const MeshInfo &info,
+        const std::vector<std::string> &fields_to_flatten,
+        index_t nverts, index_t nelems, Node &output) const;
+
     /**
     @brief Inspects the output node and removes tables that do not have any
         columns.
@@ -182,6 +215,15 @@ protected:
     virtual void
     flatten_many_domains(const Node &mesh, Node &output) const;
 
+    /**
+    @brief Invokes flatten_single_domain() over each domain, with rows
+        starting at the given offsets. Domains are flattened concurrently
+        when num_threads > 1, output must already be allocated.
+    */
+    void flatten_domains(const Node &mesh, Node &output,
+        const std::vector<std::string> &fields_to_flatten, const MeshInfo &info,
+        index_t vert_offset, index_t elem_offset) const;
+
     std::string topology;
     std::vector<std::string> field_names;
     index_t default_dtype; // Must be either float32 or float64
@@ -190,6 +232,7 @@ protected:
     bool add_cell_centers;
     bool add_domain_info;
     bool add_vertex_locations;
+    index_t num_threads;
 };
 
 //-----------------------------------------------------------------------------
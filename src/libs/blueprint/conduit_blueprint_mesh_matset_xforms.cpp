@@ -12,17 +12,21 @@
 // std lib includes
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <string>
 #include <map>
+#include <thread>
 #include <vector>
 
 //-----------------------------------------------------------------------------
 // conduit includes
 //-----------------------------------------------------------------------------
 #include "conduit_blueprint_mesh.hpp"
+#include "conduit_blueprint_mesh_execution.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
+#include "conduit_blueprint_o2mrelation_view.hpp"
 
 using namespace conduit;
 // access conduit blueprint mesh utilities
@@ -79,6 +83,17 @@ to_silo(const conduit::Node &field,
         conduit::Node &dest,
         const float64 epsilon)
 {
+    // device resident matsets and fields are converted on the host
+    if(execution::select_backend(field, matset) != execution::BACKEND_HOST)
+    {
+        Node host_field, host_matset;
+        to_silo(execution::to_host(field, host_field),
+                execution::to_host(matset, host_matset),
+                dest,
+                epsilon);
+        return;
+    }
+
     Node temp, data;
     const DataType int_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_INT_DTYPES);
     const DataType float_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_FLOAT_DTYPE);
@@ -509,6 +524,699 @@ to_silo(const conduit::Node &field,
     }
 }
 
+//-----------------------------------------------------------------------------
+// Matset Conversions
+//
+// Every conversion reads the source matset once into a flat list of
+// (element, material, volume fraction) entries, counting sorts the entries
+// by element, and writes the requested flavor from the sorted entries.
+// When a field is converted with the matset, its matset values are read
+// and moved along with the volume fractions. The passes are split over
+// 'num_threads' threads; the results don't depend on the number of threads.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+enum MatsetFlavor
+{
+    MULTI_BUFFER_FULL,
+    MULTI_BUFFER_BY_MATERIAL,
+    UNI_BUFFER_BY_ELEMENT,
+    UNI_BUFFER_BY_MATERIAL
+};
+
+//-----------------------------------------------------------------------------
+// The entries of a matset, grouped by element and ordered by material slot
+// within each element. Material slots follow the order of 'material_map'.
+struct MatsetEntries
+{
+    Node                     material_map;
+    std::vector<std::string> mat_names;    // slot -> material name
+    std::vector<index_t>     mat_ids;      // slot -> material id
+    index_t                  num_elems;
+    std::vector<index_t>     elem_offsets; // element -> first entry (num_elems + 1)
+    std::vector<index_t>     mats;         // entry -> material slot
+    std::vector<float64>     vfs;          // entry -> volume fraction
+    std::vector<float64>     values;       // entry -> matset value (fields only)
+};
+
+//-----------------------------------------------------------------------------
+// One o2m volume fraction buffer of a matset: the matset itself for
+// uni-buffer matsets, or the buffer of one material for multi-buffer ones.
+// The entries of 'one' i are [starts[i], starts[i+1]) over all buffers.
+struct MatsetBuffer
+{
+    const Node *o2m;
+    const Node *vfs;
+    const Node *eids;   // NULL for element-dominant matsets
+    const Node *mids;   // NULL for multi-buffer matsets
+    const Node *mvals;  // NULL when there are no matset values
+    index_t slot;
+    std::vector<index_t> starts;
+};
+
+//-----------------------------------------------------------------------------
+// The material slots and o2m buffers of a matset. Material slots follow
+// the order of 'material_map'.
+struct MatsetSource
+{
+    Node                      material_map;
+    std::vector<std::string>  mat_names;   // slot -> material name
+    std::vector<index_t>      mat_ids;     // slot -> material id
+    index_t                   min_id;
+    std::vector<index_t>      id_to_slot;  // material id - min_id -> slot
+    std::vector<MatsetBuffer> bufs;
+    index_t                   num_entries;
+    index_t                   max_ones;
+};
+
+//-----------------------------------------------------------------------------
+static const Node &
+o2m_data_node(const Node &node)
+{
+    if(node.dtype().is_number())
+    {
+        return node;
+    }
+    return node[blueprint::o2mrelation::data_paths(node).front()];
+}
+
+//-----------------------------------------------------------------------------
+static float64
+epsilon_option(const Node &options)
+{
+    return options.has_child("epsilon") ? options["epsilon"].to_float64()
+                                        : CONDUIT_EPSILON;
+}
+
+//-----------------------------------------------------------------------------
+// Describes the buffers of 'matset' and, if 'matset_values' isn't NULL, the
+// matching matset values of a field.
+void
+read_matset_source(const Node &matset,
+                   const Node *matset_values,
+                   MatsetSource &res)
+{
+    const DataType int_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_INT_DTYPES);
+    const bool is_uni = blueprint::mesh::matset::is_uni_buffer(matset);
+    const bool is_matdom = blueprint::mesh::matset::is_material_dominant(matset);
+
+    // Material Slots //
+
+    res.material_map.reset();
+    if(matset.has_child("material_map"))
+    {
+        res.material_map.set(matset["material_map"]);
+    }
+    else
+    {
+        NodeConstIterator vf_itr = matset["volume_fractions"].children();
+        while(vf_itr.has_next())
+        {
+            vf_itr.next();
+            Node temp;
+            temp.set(vf_itr.index());
+            temp.to_data_type(int_dtype.id(), res.material_map[vf_itr.name()]);
+        }
+    }
+
+    res.mat_names.clear();
+    res.mat_ids.clear();
+    std::map<std::string, index_t> name_to_slot;
+    index_t min_id = 0, max_id = -1;
+    NodeConstIterator map_itr = res.material_map.children();
+    while(map_itr.has_next())
+    {
+        const Node &id_node = map_itr.next();
+        const index_t mat_id = id_node.to_index_t();
+        name_to_slot[map_itr.name()] = (index_t)res.mat_names.size();
+        res.mat_names.push_back(map_itr.name());
+        res.mat_ids.push_back(mat_id);
+        min_id = (max_id < min_id) ? mat_id : std::min(min_id, mat_id);
+        max_id = std::max(max_id, mat_id);
+    }
+    res.min_id = min_id;
+    res.id_to_slot.assign((size_t)(max_id - min_id + 1), -1);
+    for(size_t slot = 0; slot < res.mat_ids.size(); slot++)
+    {
+        res.id_to_slot[(size_t)(res.mat_ids[slot] - min_id)] = (index_t)slot;
+    }
+
+    // Source Buffers //
+
+    res.bufs.clear();
+    if(is_uni)
+    {
+        MatsetBuffer buf;
+        buf.o2m = &matset;
+        buf.vfs = &matset["volume_fractions"];
+        buf.eids = is_matdom ? &matset["element_ids"] : NULL;
+        buf.mids = &matset["material_ids"];
+        buf.mvals = (matset_values != NULL) ? &o2m_data_node(*matset_values) : NULL;
+        buf.slot = -1;
+        res.bufs.push_back(buf);
+    }
+    else
+    {
+        NodeConstIterator vf_itr = matset["volume_fractions"].children();
+        while(vf_itr.has_next())
+        {
+            const Node &mat_node = vf_itr.next();
+            const std::string mat_name = vf_itr.name();
+            if(name_to_slot.find(mat_name) == name_to_slot.end())
+            {
+                CONDUIT_ERROR("blueprint::mesh::matset material '" << mat_name
+                              << "' is missing from 'material_map'");
+            }
+
+            MatsetBuffer buf;
+            buf.o2m = &mat_node;
+            buf.vfs = &o2m_data_node(mat_node);
+            buf.eids = is_matdom ? &matset["element_ids"][mat_name] : NULL;
+            buf.mids = NULL;
+            buf.mvals = (matset_values != NULL && matset_values->has_child(mat_name))
+                ? &o2m_data_node((*matset_values)[mat_name]) : NULL;
+            buf.slot = name_to_slot[mat_name];
+            res.bufs.push_back(buf);
+        }
+    }
+
+    // the number of entries of each 'one' of each buffer
+    res.num_entries = 0;
+    res.max_ones = 0;
+    for(MatsetBuffer &buf : res.bufs)
+    {
+        const Node &o2m = *buf.o2m;
+        index_t num_ones = buf.vfs->dtype().number_of_elements();
+        if(o2m.has_child("sizes"))
+        {
+            const index_t_accessor sizes = o2m["sizes"].value();
+            num_ones = sizes.number_of_elements();
+            buf.starts.resize((size_t)num_ones + 1);
+            buf.starts[0] = res.num_entries;
+            for(index_t i = 0; i < num_ones; i++)
+            {
+                buf.starts[i + 1] = buf.starts[i] + sizes[i];
+            }
+        }
+        else
+        {
+            if(o2m.has_child("indices"))
+            {
+                num_ones = o2m["indices"].dtype().number_of_elements();
+            }
+            buf.starts.resize((size_t)num_ones + 1);
+            for(index_t i = 0; i <= num_ones; i++)
+            {
+                buf.starts[i] = res.num_entries + i;
+            }
+        }
+        res.num_entries = buf.starts.back();
+        res.max_ones = std::max(res.max_ones, num_ones);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Walks the entries of the 'ones' [begin, end) of 'buf' through an O2MView
+// of the buffer's o2m arrays, see visit_buffer_entries.
+template <typename Func>
+struct BufferEntriesVisitor
+{
+    const MatsetSource &src;
+    const MatsetBuffer &buf;
+    index_t begin;
+    index_t end;
+    const Func &func;
+
+    template <typename IndexT>
+    void operator()(const blueprint::o2mrelation::O2MView<IndexT> &view) const
+    {
+        Node empty_ints;
+        empty_ints.set(DataType::index_t(0));
+        const index_t_accessor eids = (buf.eids ? *buf.eids : empty_ints).value();
+        const index_t_accessor mids = (buf.mids ? *buf.mids : empty_ints).value();
+        const float64_accessor vfs = buf.vfs->value();
+        const float64_accessor mvals = (buf.mvals ? *buf.mvals : empty_ints).value();
+        const index_t max_id = src.min_id + (index_t)src.id_to_slot.size() - 1;
+
+        for(index_t i = begin; i < end; i++)
+        {
+            const index_t elem = buf.eids ? eids[i] : i;
+            if(elem < 0)
+            {
+                CONDUIT_ERROR("blueprint::mesh::matset 'element_ids' has a "
+                              "negative element id " << elem);
+            }
+
+            index_t r = buf.starts[i];
+            for(const index_t d : view[i])
+            {
+                index_t slot = buf.slot;
+                if(buf.mids)
+                {
+                    const index_t mat_id = mids[d];
+                    slot = (mat_id >= src.min_id && mat_id <= max_id)
+                        ? src.id_to_slot[(size_t)(mat_id - src.min_id)] : -1;
+                    if(slot < 0)
+                    {
+                        CONDUIT_ERROR("blueprint::mesh::matset material id "
+                                      << mat_id << " is missing from 'material_map'");
+                    }
+                }
+                func(r++, elem, slot, vfs[d], buf.mvals ? mvals[d] : 0.0);
+            }
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Calls 'func(r, elem, slot, vf, value)' for each entry 'r' of the 'ones'
+// [begin, end) of 'buf'. 'value' is 0 when there are no matset values.
+template <typename Func>
+void
+visit_buffer_entries(const MatsetSource &src,
+                     const MatsetBuffer &buf,
+                     index_t begin,
+                     index_t end,
+                     const Func &func)
+{
+    const BufferEntriesVisitor<Func> visitor = {src, buf, begin, end, func};
+    blueprint::o2mrelation::dispatch_view(*buf.o2m, visitor);
+}
+
+//-----------------------------------------------------------------------------
+// Reads the entries of 'matset' and, if 'matset_values' isn't NULL, the
+// matching matset values of a field. Entries with volume fractions at or
+// below 'epsilon' are dropped unless 'keep_all' is set.
+void
+read_matset_entries(const Node &matset,
+                    const Node *matset_values,
+                    bool keep_all,
+                    float64 epsilon,
+                    index_t num_threads,
+                    MatsetEntries &res)
+{
+    const bool is_matdom = blueprint::mesh::matset::is_material_dominant(matset);
+
+    MatsetSource src;
+    read_matset_source(matset, matset_values, src);
+    res.material_map.set(src.material_map);
+    res.mat_names = src.mat_names;
+    res.mat_ids = src.mat_ids;
+
+    // Raw Entries //
+
+    const index_t num_raw = src.num_entries;
+    std::vector<index_t> raw_elems((size_t)num_raw), raw_mats((size_t)num_raw);
+    std::vector<float64> raw_vfs((size_t)num_raw), raw_vals;
+    if(matset_values != NULL)
+    {
+        raw_vals.resize((size_t)num_raw, 0.0);
+    }
+
+    index_t max_elem = -1;
+    for(const MatsetBuffer &buf : src.bufs)
+    {
+        const index_t num_ones = (index_t)buf.starts.size() - 1;
+        const index_t num_chunks = bputils::detail::parallel_num_chunks(num_threads, num_ones, 4096);
+        std::vector<index_t> chunk_max_elem((size_t)num_chunks, -1);
+        bputils::detail::parallel_chunks(num_chunks, num_ones,
+            [&](index_t ci, index_t begin, index_t end)
+        {
+            index_t &chunk_max = chunk_max_elem[ci];
+            visit_buffer_entries(src, buf, begin, end,
+                [&](index_t r, index_t elem, index_t slot, float64 vf, float64 value)
+            {
+                chunk_max = std::max(chunk_max, elem);
+                raw_elems[r] = elem;
+                raw_mats[r] = slot;
+                raw_vfs[r] = vf;
+                if(matset_values != NULL)
+                {
+                    raw_vals[r] = value;
+                }
+            });
+        });
+
+        for(const index_t chunk_max : chunk_max_elem)
+        {
+            max_elem = std::max(max_elem, chunk_max);
+        }
+    }
+    res.num_elems = is_matdom ? max_elem + 1 : src.max_ones;
+
+    // Counting Sort by Element //
+
+    const index_t num_elems = res.num_elems;
+    const index_t num_chunks = bputils::detail::parallel_num_chunks(num_threads, num_raw, 16384);
+    std::vector<std::vector<index_t>> chunk_pos((size_t)num_chunks);
+    bputils::detail::parallel_chunks(num_chunks, num_raw,
+        [&](index_t ci, index_t begin, index_t end)
+    {
+        std::vector<index_t> &counts = chunk_pos[ci];
+        counts.assign((size_t)num_elems, 0);
+        for(index_t r = begin; r < end; r++)
+        {
+            if(keep_all || raw_vfs[r] > epsilon)
+            {
+                counts[raw_elems[r]]++;
+            }
+        }
+    });
+
+    res.elem_offsets.resize((size_t)num_elems + 1);
+    index_t num_entries = 0;
+    for(index_t e = 0; e < num_elems; e++)
+    {
+        res.elem_offsets[e] = num_entries;
+        for(index_t ci = 0; ci < num_chunks; ci++)
+        {
+            const index_t count = chunk_pos[ci][e];
+            chunk_pos[ci][e] = num_entries;
+            num_entries += count;
+        }
+    }
+    res.elem_offsets[num_elems] = num_entries;
+
+    res.mats.resize((size_t)num_entries);
+    res.vfs.resize((size_t)num_entries);
+    res.values.resize((matset_values != NULL) ? (size_t)num_entries : 0);
+    bputils::detail::parallel_chunks(num_chunks, num_raw,
+        [&](index_t ci, index_t begin, index_t end)
+    {
+        std::vector<index_t> &pos = chunk_pos[ci];
+        for(index_t r = begin; r < end; r++)
+        {
+            if(keep_all || raw_vfs[r] > epsilon)
+            {
+                const index_t k = pos[raw_elems[r]]++;
+                res.mats[k] = raw_mats[r];
+                res.vfs[k] = raw_vfs[r];
+                if(matset_values != NULL)
+                {
+                    res.values[k] = raw_vals[r];
+                }
+            }
+        }
+    });
+
+    // elements hold a few materials, so an insertion sort orders them
+    const bool has_values = (matset_values != NULL);
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_elems, 16384),
+        num_elems,
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        for(index_t e = begin; e < end; e++)
+        {
+            for(index_t i = res.elem_offsets[e] + 1; i < res.elem_offsets[e + 1]; i++)
+            {
+                for(index_t j = i; j > res.elem_offsets[e] && res.mats[j - 1] > res.mats[j]; j--)
+                {
+                    std::swap(res.mats[j - 1], res.mats[j]);
+                    std::swap(res.vfs[j - 1], res.vfs[j]);
+                    if(has_values)
+                    {
+                        std::swap(res.values[j - 1], res.values[j]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+// The entries in material order: 'order[p]' is the entry at position 'p'
+// and 'elems[p]' its element. The positions of material slot 's' are
+// [mat_offsets[s], mat_offsets[s + 1]), ordered by element.
+struct MaterialOrder
+{
+    std::vector<index_t> mat_offsets;
+    std::vector<index_t> order;
+    std::vector<index_t> elems;
+};
+
+//-----------------------------------------------------------------------------
+void
+material_order(const MatsetEntries &ents,
+               index_t num_threads,
+               MaterialOrder &res)
+{
+    const index_t num_mats = (index_t)ents.mat_names.size();
+    const index_t num_chunks = bputils::detail::parallel_num_chunks(
+        num_threads, ents.num_elems, 16384);
+    std::vector<std::vector<index_t>> chunk_pos((size_t)num_chunks);
+    bputils::detail::parallel_chunks(num_chunks, ents.num_elems,
+        [&](index_t ci, index_t begin, index_t end)
+    {
+        std::vector<index_t> &counts = chunk_pos[ci];
+        counts.assign((size_t)num_mats, 0);
+        for(index_t k = ents.elem_offsets[begin]; k < ents.elem_offsets[end]; k++)
+        {
+            counts[ents.mats[k]]++;
+        }
+    });
+
+    res.mat_offsets.resize((size_t)num_mats + 1);
+    index_t pos = 0;
+    for(index_t s = 0; s < num_mats; s++)
+    {
+        res.mat_offsets[s] = pos;
+        for(index_t ci = 0; ci < num_chunks; ci++)
+        {
+            const index_t count = chunk_pos[ci][s];
+            chunk_pos[ci][s] = pos;
+            pos += count;
+        }
+    }
+    res.mat_offsets[num_mats] = pos;
+
+    res.order.resize((size_t)pos);
+    res.elems.resize((size_t)pos);
+    bputils::detail::parallel_chunks(num_chunks, ents.num_elems,
+        [&](index_t ci, index_t begin, index_t end)
+    {
+        std::vector<index_t> &next = chunk_pos[ci];
+        for(index_t e = begin; e < end; e++)
+        {
+            for(index_t k = ents.elem_offsets[e]; k < ents.elem_offsets[e + 1]; k++)
+            {
+                const index_t p = next[ents.mats[k]]++;
+                res.order[p] = k;
+                res.elems[p] = e;
+            }
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+static void
+write_array(const T *vals, index_t count, const DataType &dtype, Node &dest)
+{
+    if(count == 0)
+    {
+        dest.set(DataType(dtype.id(), 0));
+        return;
+    }
+    Node src;
+    src.set_external(const_cast<T*>(vals), count);
+    src.to_data_type(dtype.id(), dest);
+}
+
+//-----------------------------------------------------------------------------
+// Writes per entry values ('vals' holds one value per entry) in the layout
+// of 'flavor' to 'dest', which becomes 'volume_fractions' or 'matset_values'.
+void
+write_entry_values(const MatsetEntries &ents,
+                   const MaterialOrder &morder,
+                   MatsetFlavor flavor,
+                   const std::vector<float64> &vals,
+                   const DataType &dtype,
+                   index_t num_threads,
+                   Node &dest)
+{
+    const index_t num_mats = (index_t)ents.mat_names.size();
+    const index_t num_elems = ents.num_elems;
+    dest.reset();
+    if(flavor == MULTI_BUFFER_FULL)
+    {
+        std::vector<float64> full((size_t)(num_mats * num_elems), 0.0);
+        bputils::detail::parallel_chunks(
+            bputils::detail::parallel_num_chunks(num_threads, num_elems, 16384),
+            num_elems,
+            [&](index_t /*ci*/, index_t begin, index_t end)
+        {
+            for(index_t e = begin; e < end; e++)
+            {
+                for(index_t k = ents.elem_offsets[e]; k < ents.elem_offsets[e + 1]; k++)
+                {
+                    full[(size_t)(ents.mats[k] * num_elems + e)] = vals[k];
+                }
+            }
+        });
+        for(index_t s = 0; s < num_mats; s++)
+        {
+            write_array(full.data() + s * num_elems, num_elems, dtype,
+                        dest[ents.mat_names[s]]);
+        }
+    }
+    else if(flavor == UNI_BUFFER_BY_ELEMENT)
+    {
+        write_array(vals.data(), (index_t)vals.size(), dtype, dest);
+    }
+    else
+    {
+        const index_t num_entries = (index_t)morder.order.size();
+        std::vector<float64> gathered((size_t)num_entries);
+        bputils::detail::parallel_chunks(
+            bputils::detail::parallel_num_chunks(num_threads, num_entries, 16384),
+            num_entries,
+            [&](index_t /*ci*/, index_t begin, index_t end)
+        {
+            for(index_t p = begin; p < end; p++)
+            {
+                gathered[p] = vals[morder.order[p]];
+            }
+        });
+
+        if(flavor == MULTI_BUFFER_BY_MATERIAL)
+        {
+            for(index_t s = 0; s < num_mats; s++)
+            {
+                write_array(gathered.data() + morder.mat_offsets[s],
+                            morder.mat_offsets[s + 1] - morder.mat_offsets[s],
+                            dtype, dest[ents.mat_names[s]]);
+            }
+        }
+        else // if(flavor == UNI_BUFFER_BY_MATERIAL)
+        {
+            write_array(gathered.data(), num_entries, dtype, dest);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Converts 'matset' to 'flavor'. The matset is written to 'dest_matset' and,
+// when 'field' isn't NULL, the field is written to 'dest_field' with its
+// matset values in the new layout and its 'matset' set to 'dest_matset_name'.
+void
+convert(const Node &matset,
+        const Node *field,
+        MatsetFlavor flavor,
+        float64 epsilon,
+        index_t num_threads,
+        Node *dest_matset,
+        const std::string &dest_matset_name,
+        Node *dest_field)
+{
+    // device resident matsets and fields are converted on the host
+    const Node empty_field;
+    if(execution::select_backend(matset, field != NULL ? *field : empty_field) !=
+       execution::BACKEND_HOST)
+    {
+        Node host_matset, host_field;
+        const Node &src_matset = execution::to_host(matset, host_matset);
+        const Node *src_field = field != NULL ?
+            &execution::to_host(*field, host_field) : NULL;
+        convert(src_matset, src_field, flavor, epsilon, num_threads,
+                dest_matset, dest_matset_name, dest_field);
+        return;
+    }
+
+    const Node *matset_values = (field != NULL && field->has_child("matset_values"))
+        ? &(*field)["matset_values"] : NULL;
+
+    MatsetEntries ents;
+    read_matset_entries(matset, matset_values, flavor == MULTI_BUFFER_FULL,
+                        epsilon, num_threads, ents);
+
+    MaterialOrder morder;
+    if(flavor == MULTI_BUFFER_BY_MATERIAL || flavor == UNI_BUFFER_BY_MATERIAL)
+    {
+        material_order(ents, num_threads, morder);
+    }
+
+    if(dest_field != NULL)
+    {
+        // the source field may be (a part of) the destination
+        Node res;
+        NodeConstIterator itr = field->children();
+        while(itr.has_next())
+        {
+            const Node &child = itr.next();
+            if(itr.name() != "matset_values" && itr.name() != "matset")
+            {
+                res[itr.name()].set(child);
+            }
+        }
+        res["matset"] = dest_matset_name;
+        if(matset_values != NULL)
+        {
+            // NOTE: matset values are always written as float64, as in to_silo
+            write_entry_values(ents, morder, flavor, ents.values, DataType::float64(1),
+                               num_threads, res["matset_values"]);
+        }
+        dest_field->set(res);
+    }
+
+    if(dest_matset == NULL)
+    {
+        return;
+    }
+
+    const DataType int_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(matset, bputils::DEFAULT_FLOAT_DTYPE);
+
+    Node res;
+    res["topology"].set(matset["topology"]);
+    res["material_map"].set(ents.material_map);
+    write_entry_values(ents, morder, flavor, ents.vfs, float_dtype,
+                       num_threads, res["volume_fractions"]);
+
+    const index_t num_mats = (index_t)ents.mat_names.size();
+    if(flavor == MULTI_BUFFER_BY_MATERIAL)
+    {
+        Node &eids = res["element_ids"];
+        for(index_t s = 0; s < num_mats; s++)
+        {
+            write_array(morder.elems.data() + morder.mat_offsets[s],
+                        morder.mat_offsets[s + 1] - morder.mat_offsets[s],
+                        int_dtype, eids[ents.mat_names[s]]);
+        }
+    }
+    else if(flavor == UNI_BUFFER_BY_ELEMENT)
+    {
+        const index_t num_entries = (index_t)ents.mats.size();
+        std::vector<index_t> mids((size_t)num_entries);
+        for(index_t k = 0; k < num_entries; k++)
+        {
+            mids[k] = ents.mat_ids[ents.mats[k]];
+        }
+        std::vector<index_t> sizes((size_t)ents.num_elems);
+        for(index_t e = 0; e < ents.num_elems; e++)
+        {
+            sizes[e] = ents.elem_offsets[e + 1] - ents.elem_offsets[e];
+        }
+        write_array(mids.data(), num_entries, int_dtype, res["material_ids"]);
+        write_array(sizes.data(), ents.num_elems, int_dtype, res["sizes"]);
+        write_array(ents.elem_offsets.data(), ents.num_elems, int_dtype, res["offsets"]);
+    }
+    else if(flavor == UNI_BUFFER_BY_MATERIAL)
+    {
+        const index_t num_entries = (index_t)morder.order.size();
+        std::vector<index_t> mids((size_t)num_entries);
+        for(index_t s = 0; s < num_mats; s++)
+        {
+            std::fill(mids.begin() + morder.mat_offsets[s],
+                      mids.begin() + morder.mat_offsets[s + 1],
+                      ents.mat_ids[s]);
+        }
+        write_array(mids.data(), num_entries, int_dtype, res["material_ids"]);
+        write_array(morder.elems.data(), num_entries, int_dtype, res["element_ids"]);
+    }
+    dest_matset->set(res);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::matset::detail --
@@ -538,6 +1246,146 @@ to_silo(const conduit::Node &matset,
                     epsilon);
 }
 
+//-----------------------------------------------------------------------------
+static void
+check_matset(const conduit::Node &matset, const std::string &func_name)
+{
+    if(!matset.dtype().is_object() )
+    {
+        CONDUIT_ERROR("blueprint::mesh::matset::" << func_name << " passed matset node"
+                      " must be a valid matset tree.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_full(const conduit::Node &src_matset,
+                     conduit::Node &dest_matset)
+{
+    check_matset(src_matset, "to_multi_buffer_full");
+    detail::convert(src_matset, NULL, detail::MULTI_BUFFER_FULL, 0.0, 1,
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_full(const conduit::Node &src_matset,
+                     conduit::Node &dest_matset,
+                     const conduit::Node &options)
+{
+    check_matset(src_matset, "to_multi_buffer_full");
+    detail::convert(src_matset, NULL, detail::MULTI_BUFFER_FULL, 0.0,
+                    bputils::detail::num_threads_option(options),
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_by_material(const conduit::Node &src_matset,
+                            conduit::Node &dest_matset,
+                            const float64 epsilon)
+{
+    check_matset(src_matset, "to_multi_buffer_by_material");
+    detail::convert(src_matset, NULL, detail::MULTI_BUFFER_BY_MATERIAL, epsilon, 1,
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_by_material(const conduit::Node &src_matset,
+                            conduit::Node &dest_matset,
+                            const conduit::Node &options)
+{
+    check_matset(src_matset, "to_multi_buffer_by_material");
+    detail::convert(src_matset, NULL, detail::MULTI_BUFFER_BY_MATERIAL,
+                    detail::epsilon_option(options),
+                    bputils::detail::num_threads_option(options),
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_sparse_by_element(const conduit::Node &src_matset,
+                     conduit::Node &dest_matset,
+                     const float64 epsilon)
+{
+    check_matset(src_matset, "to_sparse_by_element");
+    detail::convert(src_matset, NULL, detail::UNI_BUFFER_BY_ELEMENT, epsilon, 1,
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_sparse_by_element(const conduit::Node &src_matset,
+                     conduit::Node &dest_matset,
+                     const conduit::Node &options)
+{
+    check_matset(src_matset, "to_sparse_by_element");
+    detail::convert(src_matset, NULL, detail::UNI_BUFFER_BY_ELEMENT,
+                    detail::epsilon_option(options),
+                    bputils::detail::num_threads_option(options),
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_uni_buffer_by_material(const conduit::Node &src_matset,
+                          conduit::Node &dest_matset,
+                          const float64 epsilon)
+{
+    check_matset(src_matset, "to_uni_buffer_by_material");
+    detail::convert(src_matset, NULL, detail::UNI_BUFFER_BY_MATERIAL, epsilon, 1,
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_uni_buffer_by_material(const conduit::Node &src_matset,
+                          conduit::Node &dest_matset,
+                          const conduit::Node &options)
+{
+    check_matset(src_matset, "to_uni_buffer_by_material");
+    detail::convert(src_matset, NULL, detail::UNI_BUFFER_BY_MATERIAL,
+                    detail::epsilon_option(options),
+                    bputils::detail::num_threads_option(options),
+                    &dest_matset, "", NULL);
+}
+
+//-----------------------------------------------------------------------------
+void
+reduce_by_material(const conduit::Node &matset,
+                   const conduit::Node &field,
+                   const std::string &op,
+                   conduit::Node &dest)
+{
+    Node options;
+    reduce_by_material(matset, field, op, dest, options);
+}
+
+//-----------------------------------------------------------------------------
+void
+reduce_by_material(const conduit::Node &matset,
+                   const conduit::Node &field,
+                   const std::string &op,
+                   conduit::Node &dest,
+                   const conduit::Node &options)
+{
+    check_matset(matset, "reduce_by_material");
+    bputils::matset::check_material_stat_op(op);
+
+    std::vector<std::string> names;
+    std::vector<bputils::matset::MaterialStats> stats;
+    bputils::matset::material_stats(matset, field, options, names, stats);
+
+    dest.reset();
+    for(size_t slot = 0; slot < names.size(); slot++)
+    {
+        if(stats[slot].count > 0)
+        {
+            dest[names[slot]].set(bputils::matset::material_stat(stats[slot], op));
+        }
+    }
+}
 
 //-----------------------------------------------------------------------------
 
@@ -581,6 +1429,152 @@ to_silo(const conduit::Node &field,
                                                       epsilon);
 }
 
+//-----------------------------------------------------------------------------
+static void
+check_field(const conduit::Node &matset,
+            const conduit::Node &field,
+            const std::string &func_name)
+{
+    if(!field.dtype().is_object() )
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::" << func_name << " passed field node"
+                      " must be a valid field tree.");
+    }
+
+    if(!matset.dtype().is_object() )
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::" << func_name << " passed matset node"
+                      " must be a valid matset tree.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_full(const conduit::Node &src_matset,
+                     const conduit::Node &src_field,
+                     const std::string &dest_matset_name,
+                     conduit::Node &dest_field)
+{
+    check_field(src_matset, src_field, "to_multi_buffer_full");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::MULTI_BUFFER_FULL,
+        0.0, 1, NULL, dest_matset_name, &dest_field);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_full(const conduit::Node &src_matset,
+                     const conduit::Node &src_field,
+                     const std::string &dest_matset_name,
+                     conduit::Node &dest_field,
+                     const conduit::Node &options)
+{
+    check_field(src_matset, src_field, "to_multi_buffer_full");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::MULTI_BUFFER_FULL,
+        0.0,
+        bputils::detail::num_threads_option(options),
+        NULL, dest_matset_name, &dest_field);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_by_material(const conduit::Node &src_matset,
+                            const conduit::Node &src_field,
+                            const std::string &dest_matset_name,
+                            conduit::Node &dest_field,
+                            const float64 epsilon)
+{
+    check_field(src_matset, src_field, "to_multi_buffer_by_material");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::MULTI_BUFFER_BY_MATERIAL,
+        epsilon, 1, NULL, dest_matset_name, &dest_field);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer_by_material(const conduit::Node &src_matset,
+                            const conduit::Node &src_field,
+                            const std::string &dest_matset_name,
+                            conduit::Node &dest_field,
+                            const conduit::Node &options)
+{
+    check_field(src_matset, src_field, "to_multi_buffer_by_material");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::MULTI_BUFFER_BY_MATERIAL,
+        conduit::blueprint::mesh::matset::detail::epsilon_option(options),
+        bputils::detail::num_threads_option(options),
+        NULL, dest_matset_name, &dest_field);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_sparse_by_element(const conduit::Node &src_matset,
+                     const conduit::Node &src_field,
+                     const std::string &dest_matset_name,
+                     conduit::Node &dest_field,
+                     const float64 epsilon)
+{
+    check_field(src_matset, src_field, "to_sparse_by_element");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::UNI_BUFFER_BY_ELEMENT,
+        epsilon, 1, NULL, dest_matset_name, &dest_field);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_sparse_by_element(const conduit::Node &src_matset,
+                     const conduit::Node &src_field,
+                     const std::string &dest_matset_name,
+                     conduit::Node &dest_field,
+                     const conduit::Node &options)
+{
+    check_field(src_matset, src_field, "to_sparse_by_element");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::UNI_BUFFER_BY_ELEMENT,
+        conduit::blueprint::mesh::matset::detail::epsilon_option(options),
+        bputils::detail::num_threads_option(options),
+        NULL, dest_matset_name, &dest_field);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_uni_buffer_by_material(const conduit::Node &src_matset,
+                          const conduit::Node &src_field,
+                          const std::string &dest_matset_name,
+                          conduit::Node &dest_field,
+                          const float64 epsilon)
+{
+    check_field(src_matset, src_field, "to_uni_buffer_by_material");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::UNI_BUFFER_BY_MATERIAL,
+        epsilon, 1, NULL, dest_matset_name, &dest_field);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_uni_buffer_by_material(const conduit::Node &src_matset,
+                          const conduit::Node &src_field,
+                          const std::string &dest_matset_name,
+                          conduit::Node &dest_field,
+                          const conduit::Node &options)
+{
+    check_field(src_matset, src_field, "to_uni_buffer_by_material");
+    conduit::blueprint::mesh::matset::detail::convert(src_matset,
+        &src_field,
+        conduit::blueprint::mesh::matset::detail::UNI_BUFFER_BY_MATERIAL,
+        conduit::blueprint::mesh::matset::detail::epsilon_option(options),
+        bputils::detail::num_threads_option(options),
+        NULL, dest_matset_name, &dest_field);
+}
+
 //-----------------------------------------------------------------------------
 
 }
@@ -588,6 +1582,197 @@ to_silo(const conduit::Node &field,
 // -- end conduit::blueprint::mesh::field --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::utils --
+//-----------------------------------------------------------------------------
+namespace utils
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::utils::matset --
+//-----------------------------------------------------------------------------
+namespace matset
+{
+
+//-----------------------------------------------------------------------------
+MaterialStats
+empty_material_stats()
+{
+    MaterialStats res;
+    res.count = 0;
+    res.sum = 0.0;
+    res.weighted_sum = 0.0;
+    res.weight = 0.0;
+    res.min = std::numeric_limits<float64>::max();
+    res.max = -std::numeric_limits<float64>::max();
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+combine_material_stats(const MaterialStats &src,
+                       MaterialStats &dest)
+{
+    dest.count += src.count;
+    dest.sum += src.sum;
+    dest.weighted_sum += src.weighted_sum;
+    dest.weight += src.weight;
+    dest.min = std::min(dest.min, src.min);
+    dest.max = std::max(dest.max, src.max);
+}
+
+//-----------------------------------------------------------------------------
+void
+material_stats(const Node &matset,
+               const Node &field,
+               const Node &options,
+               std::vector<std::string> &names,
+               std::vector<MaterialStats> &stats)
+{
+    namespace mdetail = conduit::blueprint::mesh::matset::detail;
+
+    if(!field.has_child("matset_values"))
+    {
+        CONDUIT_ERROR("blueprint::mesh::utils::matset::material_stats passed "
+                      "field must have 'matset_values'");
+    }
+
+    const float64 epsilon = mdetail::epsilon_option(options);
+    const index_t num_threads = bputils::detail::num_threads_option(options);
+    const bool has_weights = options.has_child("element_weights");
+    Node empty_floats;
+    empty_floats.set(DataType::float64(0));
+    const float64_accessor elem_weights =
+        (has_weights ? options["element_weights"] : empty_floats).value();
+    const index_t num_weights = elem_weights.number_of_elements();
+
+    mdetail::MatsetSource src;
+    mdetail::read_matset_source(matset, &field["matset_values"], src);
+    names = src.mat_names;
+    const size_t num_mats = names.size();
+    stats.assign(num_mats, empty_material_stats());
+
+    // partials over fixed size blocks, combined in block order, keep the
+    // sums independent of the number of threads
+    const index_t block_size = 4096;
+    for(const mdetail::MatsetBuffer &buf : src.bufs)
+    {
+        if(buf.mvals == NULL)
+        {
+            CONDUIT_ERROR("blueprint::mesh::utils::matset::material_stats "
+                          "field 'matset_values' is missing material '"
+                          << names[(size_t)buf.slot] << "'");
+        }
+
+        const index_t num_ones = (index_t)buf.starts.size() - 1;
+        const index_t num_blocks = (num_ones + block_size - 1) / block_size;
+        std::vector<MaterialStats> block_stats((size_t)num_blocks * num_mats,
+                                               empty_material_stats());
+        detail::parallel_chunks(
+            detail::parallel_num_chunks(num_threads, num_blocks, 1),
+            num_blocks,
+            [&](index_t /*ci*/, index_t begin, index_t end)
+        {
+            for(index_t b = begin; b < end; b++)
+            {
+                MaterialStats *bstats = &block_stats[(size_t)b * num_mats];
+                mdetail::visit_buffer_entries(src, buf,
+                    b * block_size, std::min(num_ones, (b + 1) * block_size),
+                    [&](index_t /*r*/, index_t elem, index_t slot, float64 vf, float64 value)
+                {
+                    if(vf <= epsilon)
+                    {
+                        return;
+                    }
+
+                    float64 weight = vf;
+                    if(has_weights)
+                    {
+                        if(elem >= num_weights)
+                        {
+                            CONDUIT_ERROR("blueprint::mesh::utils::matset::material_stats "
+                                          "'element_weights' has no weight for element "
+                                          << elem);
+                        }
+                        weight *= elem_weights[elem];
+                    }
+
+                    MaterialStats &st = bstats[slot];
+                    st.count++;
+                    st.sum += value;
+                    st.weighted_sum += weight * value;
+                    st.weight += weight;
+                    st.min = std::min(st.min, value);
+                    st.max = std::max(st.max, value);
+                });
+            }
+        });
+
+        for(index_t b = 0; b < num_blocks; b++)
+        {
+            for(size_t slot = 0; slot < num_mats; slot++)
+            {
+                combine_material_stats(block_stats[(size_t)b * num_mats + slot],
+                                       stats[slot]);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+check_material_stat_op(const std::string &op)
+{
+    if(op != "sum" && op != "min" && op != "max" && op != "average")
+    {
+        CONDUIT_ERROR("blueprint::mesh::utils::matset unknown op '" << op
+                      << "', expected 'sum', 'min', 'max' or 'average'");
+    }
+}
+
+//-----------------------------------------------------------------------------
+float64
+material_stat(const MaterialStats &stats,
+              const std::string &op)
+{
+    check_material_stat_op(op);
+    if(stats.count == 0)
+    {
+        CONDUIT_ERROR("blueprint::mesh::utils::matset::material_stat "
+                      "passed stats without entries");
+    }
+
+    float64 res = stats.sum;
+    if(op == "min")
+    {
+        res = stats.min;
+    }
+    else if(op == "max")
+    {
+        res = stats.max;
+    }
+    else if(op == "average")
+    {
+        if(stats.weight <= 0.0)
+        {
+            CONDUIT_ERROR("blueprint::mesh::utils::matset::material_stat "
+                          "'average' passed stats with no weight");
+        }
+        res = stats.weighted_sum / stats.weight;
+    }
+    return res;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::utils::matset --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::utils --
+//-----------------------------------------------------------------------------
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint:::mesh --
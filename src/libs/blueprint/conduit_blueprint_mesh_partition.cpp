@@ -30,6 +30,7 @@
 #include <map>
 #include <unordered_set>
 #include <numeric>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // conduit includes
@@ -42,6 +43,7 @@
 #include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
 #include "conduit_blueprint_mesh.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
+#include "conduit_blueprint_o2mrelation_view.hpp"
 #include "conduit_log.hpp"
 
 #include "conduit_fmt/conduit_fmt.h"
@@ -85,30 +87,30 @@ namespace blueprint
 namespace mesh
 {
 
+//-------------------------------------------------------------------------
+// dispatch functor that reads the first value of an integer node.
+struct FirstIndexValue
+{
+    index_t &value;
+
+    template <typename T>
+    void operator()(const T *vals) const
+    {
+        value = static_cast<index_t>(vals[0]);
+    }
+};
+
 //-------------------------------------------------------------------------
 static index_t
 get_index_t(const conduit::Node &n, bool &ok)
 {
-    ok = true;
     index_t retval = 0;
-    if(n.dtype().is_int8())
-        retval = static_cast<index_t>(n.as_int8());
-    else if(n.dtype().is_int16())
-        retval = static_cast<index_t>(n.as_int16());
-    else if(n.dtype().is_int32())
-        retval = static_cast<index_t>(n.as_int32());
-    else if(n.dtype().is_int64())
-        retval = static_cast<index_t>(n.as_int64());
-    else if(n.dtype().is_uint8())
-        retval = static_cast<index_t>(n.as_uint8());
-    else if(n.dtype().is_uint16())
-        retval = static_cast<index_t>(n.as_uint16());
-    else if(n.dtype().is_uint32())
-        retval = static_cast<index_t>(n.as_uint32());
-    else if(n.dtype().is_uint64())
-        retval = static_cast<index_t>(n.as_uint64());
-    else
-        ok = false;
+    ok = n.dtype().is_integer();
+    if(ok)
+    {
+        FirstIndexValue func = {retval};
+        dispatch(n, func);
+    }
     return retval;
 }
 
@@ -1564,212 +1566,1287 @@ SelectionField::print(std::ostream &os) const
 
 //---------------------------------------------------------------------------
 //---------------------------------------------------------------------------
-Partitioner::Chunk::Chunk()
-: mesh(nullptr),
-  owns(false),
-  destination_rank(Selection::FREE_RANK_ID),
-  destination_domain(Selection::FREE_DOMAIN_ID)
+/**
+ @brief Returns the key of a point along a space-filling curve, given its
+        quantized coordinates. The Hilbert key uses Skilling's transform
+        ("Programming the Hilbert curve", 2004) before interleaving bits.
+*/
+static uint64
+sfc_key(uint32 X[3], int ndims, int bits, bool hilbert)
 {
-}
+    if(hilbert && ndims > 1)
+    {
+        const uint32 M = 1u << (bits - 1);
+        // Inverse undo excess work.
+        for(uint32 Q = M; Q > 1; Q >>= 1)
+        {
+            const uint32 P = Q - 1;
+            for(int i = 0; i < ndims; i++)
+            {
+                if(X[i] & Q)
+                    X[0] ^= P;
+                else
+                {
+                    const uint32 t = (X[0] ^ X[i]) & P;
+                    X[0] ^= t;
+                    X[i] ^= t;
+                }
+            }
+        }
+        // Gray encode.
+        for(int i = 1; i < ndims; i++)
+            X[i] ^= X[i-1];
+        uint32 t = 0;
+        for(uint32 Q = M; Q > 1; Q >>= 1)
+        {
+            if(X[ndims-1] & Q)
+                t ^= Q - 1;
+        }
+        for(int i = 0; i < ndims; i++)
+            X[i] ^= t;
+    }
 
-//---------------------------------------------------------------------------
-Partitioner::Chunk::Chunk(const Node *m, bool own)
-: mesh(m),
-  owns(own),
-  destination_rank(Selection::FREE_RANK_ID),
-  destination_domain(Selection::FREE_DOMAIN_ID)
-{
+    uint64 key = 0;
+    for(int b = bits - 1; b >= 0; b--)
+    {
+        for(int i = 0; i < ndims; i++)
+            key = (key << 1) | ((X[i] >> b) & 1u);
+    }
+    return key;
 }
 
 //---------------------------------------------------------------------------
-Partitioner::Chunk::Chunk(const Node *m, bool own, int dr, int dd)
-: mesh(m),
-  owns(own),
-  destination_rank(dr),
-  destination_domain(dd)
+/**
+ @brief Returns the keys that cut a sorted list of keys into nparts pieces
+        with balanced key counts. A key k belongs to the part
+        upper_bound(splitters, k). Each splitter is the smallest key value
+        with at least p*n/nparts keys before it.
+*/
+static std::vector<uint64>
+sfc_splitters(const std::vector<uint64> &sorted_keys, index_t nparts)
 {
+    std::vector<uint64> splitters;
+    const uint64 n = static_cast<uint64>(sorted_keys.size());
+    for(index_t p = 1; p < nparts; p++)
+    {
+        const uint64 goal = (static_cast<uint64>(p) * n) / static_cast<uint64>(nparts);
+        splitters.push_back(goal > 0 ? sorted_keys[goal - 1] + 1 : 0);
+    }
+    return splitters;
 }
 
 //---------------------------------------------------------------------------
-void
-Partitioner::Chunk::free()
+//---------------------------------------------------------------------------
+/**
+ @brief This class represents a selection that orders the elements of a mesh
+        along a space-filling curve through their centroids and cuts the
+        curve into pieces with balanced numbers of elements.
+*/
+class SelectionSFC : public Selection
 {
-    if(owns)
+public:
+    SelectionSFC();
+    SelectionSFC(const SelectionSFC &obj);
+    virtual ~SelectionSFC();
+
+    static std::string name() { return "sfc"; }
+
+    virtual std::shared_ptr<Selection> copy() const override;
+
+    // Initializes the selection from a conduit::Node.
+    virtual bool init(const conduit::Node &n_options) override;
+
+    virtual bool applicable(const conduit::Node &n_mesh) override;
+
+    // Computes the number of cells in the selection.
+    virtual index_t length(const conduit::Node &n_mesh) const override;
+
+    virtual bool requires_initial_partition() const override;
+
+    virtual std::vector<std::shared_ptr<Selection> > partition(const conduit::Node &n_mesh) const override;
+
+    virtual int get_destination_domain() const override;
+
+    virtual void get_element_ids(const conduit::Node &n_mesh,
+                                 std::vector<index_t> &element_ids) const override;
+
+    virtual void print(std::ostream &os) const override;
+
+    index_t get_parts() const
     {
-        Node *m = const_cast<Node *>(mesh);
-        delete m;
-        mesh = nullptr;
-        owns = false;
+        return parts;
     }
+
+    /**
+     @brief Computes the centroids of the elements in the selected topology,
+            3 values per element, and grows bounds (xmin,ymin,zmin,xmax,ymax,
+            zmax) to contain them. Missing dimensions do not grow bounds.
+     */
+    void centroids(const conduit::Node &n_mesh, std::vector<float64> &xyz,
+                   float64 bounds[6]) const;
+
+    /**
+     @brief Computes the curve keys of centroids within bounds.
+     */
+    void keys(const std::vector<float64> &xyz, const float64 bounds[6],
+              std::vector<uint64> &k) const;
+
+    /**
+     @brief Makes the selection cut the elements of every domain at common
+            splitters, with keys computed within common bounds, so each part
+            becomes the destination domain of its elements.
+     */
+    void set_global_parts(index_t nparts, const float64 bounds[6],
+                          const std::vector<uint64> &s,
+                          std::map<const conduit::Node *, std::vector<uint64> > &k);
+
+protected:
+    virtual bool supports_domain_any() const override { return true; }
+
+    virtual bool determine_is_whole(const conduit::Node &n_mesh) const override;
+
+    std::shared_ptr<Selection> make_part(std::vector<index_t> &ids, int dd) const;
+
+    static const std::string CURVE_KEY;
+    static const std::string PARTS_KEY;
+
+    bool                                                 hilbert;
+    index_t                                              parts;
+    bool                                                 global_parts;
+    float64                                              global_bounds[6];
+    std::vector<uint64>                                  splitters;
+    std::map<const conduit::Node *, std::vector<uint64> > mesh_keys;
+    std::vector<index_t>                                 element_ids;
+    bool                                                 element_ids_set;
+    int                                                  part_domain;
+};
+
+const std::string SelectionSFC::CURVE_KEY("curve");
+const std::string SelectionSFC::PARTS_KEY("parts");
+
+//---------------------------------------------------------------------------
+SelectionSFC::SelectionSFC()
+: Selection(),
+  hilbert(true),
+  parts(0),
+  global_parts(false),
+  splitters(),
+  mesh_keys(),
+  element_ids(),
+  element_ids_set(false),
+  part_domain(FREE_DOMAIN_ID)
+{
+    for(int i = 0; i < 6; i++)
+        global_bounds[i] = 0.;
 }
 
 //---------------------------------------------------------------------------
-Partitioner::Partitioner()
-: rank(0),
-  size(1),
-  target(1),
-  meshes(),
-  selections(),
-  selected_fields(),
-  mapping(true),
-  merge_tolerance(1.e-8)
+SelectionSFC::SelectionSFC(const SelectionSFC &obj)
+: Selection(obj),
+  hilbert(obj.hilbert),
+  parts(obj.parts),
+  global_parts(obj.global_parts),
+  splitters(obj.splitters),
+  mesh_keys(obj.mesh_keys),
+  element_ids(obj.element_ids),
+  element_ids_set(obj.element_ids_set),
+  part_domain(obj.part_domain)
 {
+    for(int i = 0; i < 6; i++)
+        global_bounds[i] = obj.global_bounds[i];
 }
 
 //---------------------------------------------------------------------------
-Partitioner::~Partitioner()
+SelectionSFC::~SelectionSFC()
 {
 }
 
 //---------------------------------------------------------------------------
 std::shared_ptr<Selection>
-Partitioner::create_selection(const std::string &type) const
+SelectionSFC::copy() const
 {
-    std::shared_ptr<Selection> retval;
+    return std::make_shared<SelectionSFC>(*this);
+}
 
-    if(type == SelectionLogical::name())
-        retval = std::make_shared<SelectionLogical>();
-    else if(type == SelectionExplicit::name())
-        retval = std::make_shared<SelectionExplicit>();
-    else if(type == SelectionRanges::name())
-        retval = std::make_shared<SelectionRanges>();
-    else if(type == SelectionField::name())
-        retval = std::make_shared<SelectionField>();
-    else
+//---------------------------------------------------------------------------
+bool
+SelectionSFC::init(const conduit::Node &n_options)
+{
+    bool retval = false;
+    if(Selection::init(n_options))
     {
-        CONDUIT_ERROR("Unknown selection type: " << type);
+        retval = true;
+        if(n_options.has_child(CURVE_KEY))
+        {
+            const std::string curve(n_options[CURVE_KEY].as_string());
+            if(curve == "hilbert")
+                hilbert = true;
+            else if(curve == "morton")
+                hilbert = false;
+            else
+            {
+                CONDUIT_INFO("Unknown curve " << curve << " for sfc selection.");
+                retval = false;
+            }
+        }
+        if(n_options.has_child(PARTS_KEY))
+            parts = std::max(n_options[PARTS_KEY].to_index_t(), (index_t)0);
     }
     return retval;
 }
 
 //---------------------------------------------------------------------------
-std::shared_ptr<Selection>
-Partitioner::create_selection_all_elements(const conduit::Node &n_mesh) const
+bool
+SelectionSFC::applicable(const conduit::Node &n_mesh)
 {
-    std::shared_ptr<Selection> retval;
-
-    // We're making a selection that includes all elements for the mesh.
-    // Take the first topology and its coordset.
-    const conduit::Node &n_topo = n_mesh["topologies"][0];
-    std::string csname(n_topo["coordset"].as_string());
-    const conduit::Node &n_coords = n_mesh["coordsets"][csname];
-
-    // Does the topo+coordset combo look structured?
-    bool is_uniform = n_coords["type"].as_string() == "uniform";
-    bool is_rectilinear = n_coords["type"].as_string() == "rectilinear";
-    bool is_structured = n_coords["type"].as_string() == "explicit" && 
-                         n_topo["type"].as_string() == "structured";
-
-    if(is_uniform || is_rectilinear || is_structured)
+    bool retval = false;
+    try
     {
-        index_t edims[3] = {1,1,1};
-        conduit::blueprint::mesh::utils::topology::logical_dims(n_topo, edims, 3);
-        retval = create_selection(SelectionLogical::name());
-        retval->set_whole(true);
-        retval->set_topology(n_topo.name());
-        auto typed_sel = dynamic_cast<SelectionLogical *>(retval.get());
-        if(typed_sel != nullptr)
-        {
-            typed_sel->set_end(edims[0] > 0 ? edims[0]-1 : 0,
-                               edims[1] > 0 ? edims[1]-1 : 0,
-                               edims[2] > 0 ? edims[2]-1 : 0);
-        }
+        const conduit::Node &n_topo = selected_topology(n_mesh);
+        retval = n_mesh.has_child("coordsets") &&
+                 n_mesh["coordsets"].has_child(n_topo["coordset"].as_string());
     }
-    else
+    catch(conduit::Error &)
     {
-        index_t nelem = topology::length(n_topo);
-
-        // Create a range that selects the topology.
-        retval = create_selection(SelectionRanges::name());
-        retval->set_whole(true);
-        retval->set_topology(n_topo.name());
-        auto typed_sel = dynamic_cast<SelectionRanges *>(retval.get());
-        if(typed_sel != nullptr)
-        {
-#ifdef CONDUIT_INDEX_32
-            std::vector<uint32> range;
-            range.push_back(0);
-            range.push_back(static_cast<uint32>(nelem - 1));
-            conduit::Node n_range;
-            n_range.set(range);
-            typed_sel->set_ranges(n_range);
-#else
-            std::vector<uint64> range;
-            range.push_back(0);
-            range.push_back(static_cast<uint64>(nelem - 1));
-            conduit::Node n_range;
-            n_range.set(range);
-            typed_sel->set_ranges(n_range);
-#endif
-        }
+        retval = false;
     }
     return retval;
 }
 
 //---------------------------------------------------------------------------
-bool
-Partitioner::options_get_target(const conduit::Node &options,
-                                unsigned int &value) const
+index_t
+SelectionSFC::length(const conduit::Node &n_mesh) const
 {
-    bool retval = false;
-    value = 0;
-    if(options.has_child("target"))
+    index_t len = 0;
+    if(element_ids_set)
+        len = static_cast<index_t>(element_ids.size());
+    else
     {
-        const conduit::Node &n_target = options["target"];
-        if(n_target.dtype().is_number())
+        try
         {
-            // For signed int types, make the min allowable value be 0.
-            if(n_target.dtype().is_int8())
-            {
-                auto v = n_target.as_int8();
-                value = static_cast<unsigned int>((v < 0) ? 0 : v);
-            }
-            else if(n_target.dtype().is_int16())
-            {
-                auto v = n_target.as_int16();
-                value = static_cast<unsigned int>((v < 0) ? 0 : v);
-            }
-            else if(n_target.dtype().is_int32())
-            {
-                auto v = n_target.as_int32();
-                value = static_cast<unsigned int>((v < 0) ? 0 : v);
-            }
-            else if(n_target.dtype().is_int64())
-            {
-                auto v = n_target.as_int64();
-                value = static_cast<unsigned int>((v < 0) ? 0 : v);
-            }
-            else
-            {
-                value = n_target.to_unsigned_int();
-            }
-            retval = true;
+            len = topology::length(selected_topology(n_mesh));
         }
-        else
+        catch(conduit::Error &)
         {
-            CONDUIT_INFO("Nonnumber passed as selection target.");
+            len = 0;
         }
     }
-#ifdef CONDUIT_DEBUG_PARTITIONER
-    std::cout << "Partition called with target " << value << std::endl;
-#endif
-    return retval;
+    return len;
 }
 
 //---------------------------------------------------------------------------
 bool
-Partitioner::initialize(const conduit::Node &n_mesh,
-                        const conduit::Node &options)
+SelectionSFC::requires_initial_partition() const
 {
-    auto global_domids = get_global_domids(n_mesh);
-
-    auto doms = conduit::blueprint::mesh::domains(n_mesh);
+    // Pieces are only cut up front when a number of parts is known. Otherwise,
+    // the curve is halved as needed to reach the target.
+    return !element_ids_set && (global_parts || parts > 1);
+}
 
-    // Iterate over the selections in the options and check them against the
-    // domains that were passed in to make a vector of meshes and selections
-    // that can be used to partition the meshes.
-    selections.clear();
-    if(options.has_child("selections"))
+//---------------------------------------------------------------------------
+bool
+SelectionSFC::determine_is_whole(const conduit::Node &n_mesh) const
+{
+    bool retval = true;
+    if(element_ids_set)
+    {
+        try
+        {
+            const conduit::Node &n_topo = selected_topology(n_mesh);
+            retval = topology::length(n_topo) == static_cast<index_t>(element_ids.size());
+        }
+        catch(conduit::Error &)
+        {
+            retval = false;
+        }
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSFC::centroids(const conduit::Node &n_mesh, std::vector<float64> &xyz,
+    float64 bounds[6]) const
+{
+    const conduit::Node &n_topo = selected_topology(n_mesh);
+    conduit::Node n_topo_dest, n_coords_dest, s2dmap, d2smap;
+    topology::unstructured::generate_centroids(n_topo, n_topo_dest,
+        n_coords_dest, s2dmap, d2smap);
+
+    const conduit::Node &n_values = n_coords_dest["values"];
+    const index_t nelem = topology::length(n_topo);
+    const index_t ndims = std::min(n_values.number_of_children(), (index_t)3);
+    xyz.assign(3 * nelem, 0.);
+    for(index_t d = 0; d < ndims; d++)
+    {
+        conduit::Node n_comp;
+        n_values[d].to_float64_array(n_comp);
+        const float64 *comp = n_comp.as_float64_ptr();
+        for(index_t ei = 0; ei < nelem; ei++)
+        {
+            xyz[3 * ei + d] = comp[ei];
+            bounds[d] = std::min(bounds[d], comp[ei]);
+            bounds[3 + d] = std::max(bounds[3 + d], comp[ei]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSFC::keys(const std::vector<float64> &xyz, const float64 bounds[6],
+    std::vector<uint64> &k) const
+{
+    // Dimensions that no centroid had are left out of the keys.
+    int ndims = 0;
+    while(ndims < 3 && bounds[3 + ndims] >= bounds[ndims])
+        ndims++;
+    const int bits = (ndims <= 1) ? 32 : ((ndims == 2) ? 31 : 21);
+    const float64 maxq = static_cast<float64>((static_cast<uint64>(1) << bits) - 1);
+    float64 scale[3] = {0., 0., 0.};
+    for(int d = 0; d < ndims; d++)
+    {
+        const float64 extent = bounds[3 + d] - bounds[d];
+        scale[d] = (extent > 0.) ? (maxq / extent) : 0.;
+    }
+
+    const size_t n = xyz.size() / 3;
+    k.resize(n);
+    for(size_t i = 0; i < n; i++)
+    {
+        uint32 X[3] = {0, 0, 0};
+        for(int d = 0; d < ndims; d++)
+        {
+            const float64 q = (xyz[3 * i + d] - bounds[d]) * scale[d];
+            X[d] = static_cast<uint32>(std::max(0., std::min(q, maxq)));
+        }
+        k[i] = sfc_key(X, ndims, bits, hilbert);
+    }
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSFC::set_global_parts(index_t nparts, const float64 bounds[6],
+    const std::vector<uint64> &s,
+    std::map<const conduit::Node *, std::vector<uint64> > &k)
+{
+    parts = nparts;
+    global_parts = true;
+    for(int i = 0; i < 6; i++)
+        global_bounds[i] = bounds[i];
+    splitters = s;
+    mesh_keys.swap(k);
+}
+
+//---------------------------------------------------------------------------
+std::shared_ptr<Selection>
+SelectionSFC::make_part(std::vector<index_t> &ids, int dd) const
+{
+    auto p = std::make_shared<SelectionSFC>();
+    p->hilbert = hilbert;
+    p->element_ids.swap(ids);
+    p->element_ids_set = true;
+    p->part_domain = dd;
+    p->set_whole(false);
+    p->set_domain(domain);
+    p->set_topology(topology);
+    return p;
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Cuts the elements along the curve. A selection that has not been cut
+        yet makes its parts (or 2 when it does not know a number of parts).
+        Parts that are cut further are halved along the curve.
+ */
+std::vector<std::shared_ptr<Selection> >
+SelectionSFC::partition(const conduit::Node &n_mesh) const
+{
+    std::vector<std::shared_ptr<Selection> > pieces;
+    std::vector<std::vector<index_t> > part_ids;
+
+    if(element_ids_set)
+    {
+        const size_t n2 = element_ids.size() / 2;
+        part_ids.resize(2);
+        part_ids[0].assign(element_ids.begin(), element_ids.begin() + n2);
+        part_ids[1].assign(element_ids.begin() + n2, element_ids.end());
+        for(size_t p = 0; p < part_ids.size(); p++)
+            pieces.push_back(make_part(part_ids[p], FREE_DOMAIN_ID));
+        return pieces;
+    }
+
+    // Get the curve keys of the elements. Those of global parts were computed
+    // when the parts were made.
+    std::vector<uint64> local_keys;
+    const std::vector<uint64> *k = &local_keys;
+    std::vector<uint64> s(splitters);
+    auto it = mesh_keys.find(&n_mesh);
+    if(global_parts && it != mesh_keys.end())
+        k = &it->second;
+    else
+    {
+        const float64 inf = std::numeric_limits<float64>::infinity();
+        float64 bounds[6] = {inf, inf, inf, -inf, -inf, -inf};
+        std::vector<float64> xyz;
+        centroids(n_mesh, xyz, bounds);
+        keys(xyz, global_parts ? global_bounds : bounds, local_keys);
+        if(!global_parts)
+        {
+            std::vector<uint64> sorted_keys(local_keys);
+            std::sort(sorted_keys.begin(), sorted_keys.end());
+            s = sfc_splitters(sorted_keys, std::max(parts, (index_t)2));
+        }
+    }
+
+    // Order the elements along the curve and cut them at the splitters.
+    const std::vector<uint64> &ekeys = *k;
+    std::vector<index_t> order(ekeys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](index_t a, index_t b)
+    {
+        return (ekeys[a] < ekeys[b]) || (ekeys[a] == ekeys[b] && a < b);
+    });
+    part_ids.resize(s.size() + 1);
+    for(const index_t ei : order)
+    {
+        const size_t p = std::upper_bound(s.begin(), s.end(), ekeys[ei]) - s.begin();
+        part_ids[p].push_back(ei);
+    }
+    for(size_t p = 0; p < part_ids.size(); p++)
+    {
+        if(!part_ids[p].empty())
+        {
+            int dd = global_parts ? static_cast<int>(p) : FREE_DOMAIN_ID;
+            pieces.push_back(make_part(part_ids[p], dd));
+        }
+    }
+
+    return pieces;
+}
+
+//---------------------------------------------------------------------------
+int
+SelectionSFC::get_destination_domain() const
+{
+    return part_domain;
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSFC::get_element_ids(const conduit::Node &n_mesh,
+    std::vector<index_t> &ids) const
+{
+    if(element_ids_set)
+    {
+        // Keep the input element order within the part.
+        size_t start = ids.size();
+        ids.insert(ids.end(), element_ids.begin(), element_ids.end());
+        std::sort(ids.begin() + start, ids.end());
+    }
+    else
+    {
+        const index_t n = length(n_mesh);
+        for(index_t i = 0; i < n; i++)
+            ids.push_back(i);
+    }
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSFC::print(std::ostream &os) const
+{
+    os << "{"
+       << "\"name\":\"" << name() << "\","
+       << "\"domain\":" << get_domain() << ", "
+       << "\"topology\":\"" << get_topology() << "\", "
+       << "\"curve\":\"" << (hilbert ? "hilbert" : "morton") << "\", "
+       << "\"parts\":" << parts << ", "
+       << "\"destination_domain\":" << part_domain << ", "
+       << "\"elements\":" << (element_ids_set ? element_ids.size() : 0)
+       << "}";
+}
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+/**
+ @brief This class represents a selection of the elements whose centroids
+        are inside a region: a box, a sphere, or the half space on the side
+        of a plane that its normal points to. Uniform and rectilinear
+        topologies are selected a row of elements at a time with index math
+        on their cell centers, other topologies through a spatial index over
+        their elements. The elements are found when the selection is first
+        partitioned, after which it is cut like an explicit selection.
+*/
+class SelectionSpatial : public Selection
+{
+public:
+    enum RegionType
+    {
+        BOX,
+        SPHERE,
+        PLANE
+    };
+
+    SelectionSpatial(RegionType rt);
+    SelectionSpatial(const SelectionSpatial &obj);
+    virtual ~SelectionSpatial();
+
+    static std::string name(RegionType rt)
+    {
+        return rt == BOX ? "box" : (rt == SPHERE ? "sphere" : "plane");
+    }
+
+    virtual std::shared_ptr<Selection> copy() const override;
+
+    // Initializes the selection from a conduit::Node.
+    virtual bool init(const conduit::Node &n_options) override;
+
+    virtual bool applicable(const conduit::Node &n_mesh) override;
+
+    // Computes the number of cells in the selection.
+    virtual index_t length(const conduit::Node &n_mesh) const override;
+
+    virtual bool requires_initial_partition() const override
+    {
+        return !element_ids_set;
+    }
+
+    virtual std::vector<std::shared_ptr<Selection> > partition(const conduit::Node &n_mesh) const override;
+
+    virtual void get_element_ids(const conduit::Node &n_mesh,
+                                 std::vector<index_t> &element_ids) const override;
+
+    virtual void print(std::ostream &os) const override;
+
+    /**
+     @brief Returns whether point p (3 values) is inside the region.
+     */
+    bool contains(const float64 *p) const;
+
+    /**
+     @brief Returns -1 if the box is outside of the region, 1 if it is inside
+            and 0 otherwise.
+     */
+    int classify(const float64 *bmin, const float64 *bmax) const;
+
+    /**
+     @brief Computes the ids of the elements whose centroids are inside the
+            region, in ascending order.
+     */
+    void select(const conduit::Node &n_mesh, std::vector<index_t> &ids) const;
+
+protected:
+    virtual bool supports_domain_any() const override { return true; }
+
+    virtual bool determine_is_whole(const conduit::Node &n_mesh) const override;
+
+    bool select_logical(const conduit::Node &n_topo, std::vector<index_t> &ids) const;
+
+    bool x_interval(float64 y, float64 z, float64 &lo, float64 &hi) const;
+
+    std::shared_ptr<Selection> make_part(std::vector<index_t> &ids) const;
+
+    static bool read_point(const conduit::Node &n_options, const std::string &key,
+                           float64 fill, float64 p[3]);
+
+    RegionType           region;
+    // box: min and max corners, sphere: center, plane: origin and normal
+    float64              p0[3];
+    float64              p1[3];
+    float64              radius;
+    std::vector<index_t> element_ids;
+    bool                 element_ids_set;
+};
+
+//---------------------------------------------------------------------------
+SelectionSpatial::SelectionSpatial(RegionType rt)
+: Selection(),
+  region(rt),
+  radius(0.),
+  element_ids(),
+  element_ids_set(false)
+{
+    for(int i = 0; i < 3; i++)
+        p0[i] = p1[i] = 0.;
+}
+
+//---------------------------------------------------------------------------
+SelectionSpatial::SelectionSpatial(const SelectionSpatial &obj)
+: Selection(obj),
+  region(obj.region),
+  radius(obj.radius),
+  element_ids(obj.element_ids),
+  element_ids_set(obj.element_ids_set)
+{
+    for(int i = 0; i < 3; i++)
+    {
+        p0[i] = obj.p0[i];
+        p1[i] = obj.p1[i];
+    }
+}
+
+//---------------------------------------------------------------------------
+SelectionSpatial::~SelectionSpatial()
+{
+}
+
+//---------------------------------------------------------------------------
+std::shared_ptr<Selection>
+SelectionSpatial::copy() const
+{
+    return std::make_shared<SelectionSpatial>(*this);
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Reads up to 3 coordinates from n_options[key] into p. Missing
+        coordinates are set to fill.
+ */
+bool
+SelectionSpatial::read_point(const conduit::Node &n_options,
+    const std::string &key, float64 fill, float64 p[3])
+{
+    if(!n_options.has_child(key) || !n_options[key].dtype().is_number())
+    {
+        CONDUIT_INFO("Selection " << key << " must be a list of coordinates.");
+        return false;
+    }
+    const float64_accessor values = n_options[key].as_float64_accessor();
+    const index_t n = values.number_of_elements();
+    for(index_t i = 0; i < 3; i++)
+        p[i] = (i < n) ? values[i] : fill;
+    return n > 0;
+}
+
+//---------------------------------------------------------------------------
+bool
+SelectionSpatial::init(const conduit::Node &n_options)
+{
+    bool retval = false;
+    if(Selection::init(n_options))
+    {
+        const float64 inf = std::numeric_limits<float64>::infinity();
+        if(region == BOX)
+        {
+            // Axes the corners leave out are not limited.
+            retval = read_point(n_options, "min", -inf, p0) &&
+                     read_point(n_options, "max", inf, p1);
+        }
+        else if(region == SPHERE)
+        {
+            retval = read_point(n_options, "center", 0., p0) &&
+                     n_options.has_child("radius");
+            if(retval)
+                radius = n_options["radius"].to_float64();
+        }
+        else
+        {
+            retval = read_point(n_options, "origin", 0., p0) &&
+                     read_point(n_options, "normal", 0., p1);
+            if(retval && p1[0] == 0. && p1[1] == 0. && p1[2] == 0.)
+            {
+                CONDUIT_INFO("Plane selection normal must not be zero.");
+                retval = false;
+            }
+        }
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+bool
+SelectionSpatial::applicable(const conduit::Node &n_mesh)
+{
+    bool retval = false;
+    try
+    {
+        const conduit::Node &n_topo = selected_topology(n_mesh);
+        retval = n_mesh.has_child("coordsets") &&
+                 n_mesh["coordsets"].has_child(n_topo["coordset"].as_string());
+    }
+    catch(conduit::Error &)
+    {
+        retval = false;
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+bool
+SelectionSpatial::contains(const float64 *p) const
+{
+    bool retval = false;
+    if(region == BOX)
+    {
+        retval = p[0] >= p0[0] && p[0] <= p1[0] &&
+                 p[1] >= p0[1] && p[1] <= p1[1] &&
+                 p[2] >= p0[2] && p[2] <= p1[2];
+    }
+    else if(region == SPHERE)
+    {
+        float64 dist2 = 0.;
+        for(int d = 0; d < 3; d++)
+            dist2 += (p[d] - p0[d]) * (p[d] - p0[d]);
+        retval = dist2 <= radius * radius;
+    }
+    else
+    {
+        float64 dot = 0.;
+        for(int d = 0; d < 3; d++)
+            dot += (p[d] - p0[d]) * p1[d];
+        retval = dot >= 0.;
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+int
+SelectionSpatial::classify(const float64 *bmin, const float64 *bmax) const
+{
+    int retval = 0;
+    if(region == BOX)
+    {
+        bool outside = false, inside = true;
+        for(int d = 0; d < 3; d++)
+        {
+            outside |= bmax[d] < p0[d] || bmin[d] > p1[d];
+            inside &= bmin[d] >= p0[d] && bmax[d] <= p1[d];
+        }
+        retval = outside ? -1 : (inside ? 1 : 0);
+    }
+    else if(region == SPHERE)
+    {
+        // Nearest and furthest box points from the center.
+        float64 near2 = 0., far2 = 0.;
+        for(int d = 0; d < 3; d++)
+        {
+            const float64 dmin = p0[d] - bmin[d], dmax = bmax[d] - p0[d];
+            const float64 dnear = std::max(0., std::max(-dmin, -dmax));
+            const float64 dfar = std::max(std::abs(dmin), std::abs(dmax));
+            near2 += dnear * dnear;
+            far2 += dfar * dfar;
+        }
+        const float64 r2 = radius * radius;
+        retval = near2 > r2 ? -1 : (far2 <= r2 ? 1 : 0);
+    }
+    else
+    {
+        // Lowest and highest values of the plane equation over the box.
+        float64 lo = 0., hi = 0.;
+        for(int d = 0; d < 3; d++)
+        {
+            const float64 a = (bmin[d] - p0[d]) * p1[d];
+            const float64 b = (bmax[d] - p0[d]) * p1[d];
+            lo += std::min(a, b);
+            hi += std::max(a, b);
+        }
+        retval = hi < 0. ? -1 : (lo >= 0. ? 1 : 0);
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Computes the x interval of the region in the row of points with
+        coordinates y and z. Returns false if the row misses the region.
+ */
+bool
+SelectionSpatial::x_interval(float64 y, float64 z, float64 &lo, float64 &hi) const
+{
+    const float64 inf = std::numeric_limits<float64>::infinity();
+    bool retval = false;
+    if(region == BOX)
+    {
+        retval = y >= p0[1] && y <= p1[1] && z >= p0[2] && z <= p1[2];
+        lo = p0[0];
+        hi = p1[0];
+    }
+    else if(region == SPHERE)
+    {
+        const float64 h2 = radius * radius -
+            (y - p0[1]) * (y - p0[1]) - (z - p0[2]) * (z - p0[2]);
+        retval = h2 >= 0.;
+        const float64 h = retval ? std::sqrt(h2) : 0.;
+        lo = p0[0] - h;
+        hi = p0[0] + h;
+    }
+    else
+    {
+        // nx * (x - ox) >= -(ny * (y - oy) + nz * (z - oz))
+        const float64 rest = p1[1] * (y - p0[1]) + p1[2] * (z - p0[2]);
+        if(p1[0] == 0.)
+        {
+            retval = rest >= 0.;
+            lo = -inf;
+            hi = inf;
+        }
+        else
+        {
+            const float64 x = p0[0] - rest / p1[0];
+            retval = true;
+            lo = (p1[0] > 0.) ? x : -inf;
+            hi = (p1[0] > 0.) ? inf : x;
+        }
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Selects the elements of a uniform or rectilinear topology. The cell
+        centers along each axis are sorted, so the elements of each row
+        (fixed j,k) that are inside form one range of i that is found with
+        binary searches. Only the rows within the region's bounds along j
+        and k are visited. Returns false for other topologies, and for
+        coordinates that do not increase along an axis.
+ */
+bool
+SelectionSpatial::select_logical(const conduit::Node &n_topo,
+    std::vector<index_t> &ids) const
+{
+    const std::string type(n_topo["type"].as_string());
+    if(type != "uniform" && type != "rectilinear")
+        return false;
+
+    const conduit::Node &n_coordset = utils::topology::coordset(n_topo);
+    conduit::Node n_rect;
+    if(n_coordset["type"].as_string() == "uniform")
+        conduit::blueprint::mesh::coordset::uniform::to_rectilinear(n_coordset, n_rect);
+    else
+        n_rect.set_external(n_coordset);
+
+    // Cell centers along each axis.
+    const conduit::Node &n_values = n_rect["values"];
+    const index_t ndims = std::min(n_values.number_of_children(), (index_t)3);
+    std::vector<float64> centers[3];
+    for(index_t d = 0; d < 3; d++)
+    {
+        if(d >= ndims)
+        {
+            centers[d].push_back(0.);
+            continue;
+        }
+        const float64_accessor v = n_values[d].as_float64_accessor();
+        const index_t n = v.number_of_elements();
+        for(index_t i = 0; i + 1 < n; i++)
+        {
+            if(v[i + 1] < v[i])
+                return false;
+            centers[d].push_back(0.5 * (v[i] + v[i + 1]));
+        }
+    }
+    const index_t ni = static_cast<index_t>(centers[0].size());
+    const index_t nj = static_cast<index_t>(centers[1].size());
+
+    // Rows within the region's bounds along j and k.
+    const float64 inf = std::numeric_limits<float64>::infinity();
+    float64 bmin[3] = {-inf, -inf, -inf}, bmax[3] = {inf, inf, inf};
+    for(int d = 1; d < 3; d++)
+    {
+        if(region == BOX)
+        {
+            bmin[d] = p0[d];
+            bmax[d] = p1[d];
+        }
+        else if(region == SPHERE)
+        {
+            bmin[d] = p0[d] - radius;
+            bmax[d] = p0[d] + radius;
+        }
+    }
+    auto first = [&](int d) -> index_t {
+        return std::lower_bound(centers[d].begin(), centers[d].end(), bmin[d]) - centers[d].begin();
+    };
+    auto last = [&](int d) -> index_t {
+        return std::upper_bound(centers[d].begin(), centers[d].end(), bmax[d]) - centers[d].begin();
+    };
+
+    const index_t k0 = first(2), k1 = last(2);
+    const index_t j0 = first(1), j1 = last(1);
+    for(index_t k = k0; k < k1; k++)
+    {
+        for(index_t j = j0; j < j1; j++)
+        {
+            float64 lo = 0., hi = 0.;
+            if(!x_interval(centers[1][j], centers[2][k], lo, hi))
+                continue;
+            const index_t i0 = std::lower_bound(centers[0].begin(), centers[0].end(), lo) - centers[0].begin();
+            const index_t i1 = std::upper_bound(centers[0].begin(), centers[0].end(), hi) - centers[0].begin();
+            const index_t row = (k * nj + j) * ni;
+            for(index_t i = i0; i < i1; i++)
+                ids.push_back(row + i);
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSpatial::select(const conduit::Node &n_mesh, std::vector<index_t> &ids) const
+{
+    ids.clear();
+    const conduit::Node &n_topo = selected_topology(n_mesh);
+    if(!select_logical(n_topo, ids))
+    {
+        // Cell centers in the spatial index are vertex averages, like the
+        // ones of uniform and rectilinear cells.
+        utils::SpatialIndex index;
+        index.build(n_topo);
+        index.find_elements_in(
+            [&](const float64 *bmin, const float64 *bmax) { return classify(bmin, bmax); },
+            [&](const float64 *p) { return contains(p); },
+            ids);
+    }
+}
+
+//---------------------------------------------------------------------------
+index_t
+SelectionSpatial::length(const conduit::Node &n_mesh) const
+{
+    index_t len = 0;
+    if(element_ids_set)
+        len = static_cast<index_t>(element_ids.size());
+    else
+    {
+        try
+        {
+            std::vector<index_t> ids;
+            select(n_mesh, ids);
+            len = static_cast<index_t>(ids.size());
+        }
+        catch(conduit::Error &)
+        {
+            len = 0;
+        }
+    }
+    return len;
+}
+
+//---------------------------------------------------------------------------
+bool
+SelectionSpatial::determine_is_whole(const conduit::Node &n_mesh) const
+{
+    bool retval = false;
+    try
+    {
+        const conduit::Node &n_topo = selected_topology(n_mesh);
+        retval = topology::length(n_topo) == length(n_mesh);
+    }
+    catch(conduit::Error &)
+    {
+        retval = false;
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+std::shared_ptr<Selection>
+SelectionSpatial::make_part(std::vector<index_t> &ids) const
+{
+    auto p = std::make_shared<SelectionSpatial>(*this);
+    p->element_ids.swap(ids);
+    p->element_ids_set = true;
+    p->set_whole(false);
+    return p;
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Finds the selected elements the first time the selection is
+        partitioned (a single part, or none if no element is inside). Parts
+        that are cut further are halved.
+ */
+std::vector<std::shared_ptr<Selection> >
+SelectionSpatial::partition(const conduit::Node &n_mesh) const
+{
+    std::vector<std::shared_ptr<Selection> > pieces;
+    if(element_ids_set)
+    {
+        const size_t n2 = element_ids.size() / 2;
+        std::vector<index_t> ids0(element_ids.begin(), element_ids.begin() + n2);
+        std::vector<index_t> ids1(element_ids.begin() + n2, element_ids.end());
+        pieces.push_back(make_part(ids0));
+        pieces.push_back(make_part(ids1));
+    }
+    else
+    {
+        std::vector<index_t> ids;
+        select(n_mesh, ids);
+        if(!ids.empty())
+            pieces.push_back(make_part(ids));
+    }
+    return pieces;
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSpatial::get_element_ids(const conduit::Node &n_mesh,
+    std::vector<index_t> &ids) const
+{
+    if(element_ids_set)
+        ids.insert(ids.end(), element_ids.begin(), element_ids.end());
+    else
+    {
+        try
+        {
+            std::vector<index_t> sel_ids;
+            select(n_mesh, sel_ids);
+            ids.insert(ids.end(), sel_ids.begin(), sel_ids.end());
+        }
+        catch(conduit::Error &)
+        {
+        }
+    }
+}
+
+//---------------------------------------------------------------------------
+void
+SelectionSpatial::print(std::ostream &os) const
+{
+    os << "{"
+       << "\"name\":\"" << name(region) << "\","
+       << "\"domain\":" << get_domain() << ", "
+       << "\"topology\":\"" << get_topology() << "\", ";
+    if(region == BOX)
+    {
+        os << "\"min\":[" << p0[0] << ", " << p0[1] << ", " << p0[2] << "], "
+           << "\"max\":[" << p1[0] << ", " << p1[1] << ", " << p1[2] << "], ";
+    }
+    else if(region == SPHERE)
+    {
+        os << "\"center\":[" << p0[0] << ", " << p0[1] << ", " << p0[2] << "], "
+           << "\"radius\":" << radius << ", ";
+    }
+    else
+    {
+        os << "\"origin\":[" << p0[0] << ", " << p0[1] << ", " << p0[2] << "], "
+           << "\"normal\":[" << p1[0] << ", " << p1[1] << ", " << p1[2] << "], ";
+    }
+    os << "\"elements\":" << (element_ids_set ? element_ids.size() : 0)
+       << "}";
+}
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+Partitioner::Chunk::Chunk()
+: mesh(nullptr),
+  owns(false),
+  destination_rank(Selection::FREE_RANK_ID),
+  destination_domain(Selection::FREE_DOMAIN_ID)
+{
+}
+
+//---------------------------------------------------------------------------
+Partitioner::Chunk::Chunk(const Node *m, bool own)
+: mesh(m),
+  owns(own),
+  destination_rank(Selection::FREE_RANK_ID),
+  destination_domain(Selection::FREE_DOMAIN_ID)
+{
+}
+
+//---------------------------------------------------------------------------
+Partitioner::Chunk::Chunk(const Node *m, bool own, int dr, int dd)
+: mesh(m),
+  owns(own),
+  destination_rank(dr),
+  destination_domain(dd)
+{
+}
+
+//---------------------------------------------------------------------------
+void
+Partitioner::Chunk::free()
+{
+    if(owns)
+    {
+        Node *m = const_cast<Node *>(mesh);
+        delete m;
+        mesh = nullptr;
+        owns = false;
+    }
+}
+
+//---------------------------------------------------------------------------
+Partitioner::Partitioner()
+: rank(0),
+  size(1),
+  target(1),
+  meshes(),
+  selections(),
+  selected_fields(),
+  mapping(true),
+  merge_tolerance(1.e-8),
+  num_threads(1),
+  external(false),
+  minimize_migration(false)
+{
+}
+
+//---------------------------------------------------------------------------
+Partitioner::~Partitioner()
+{
+}
+
+//---------------------------------------------------------------------------
+std::shared_ptr<Selection>
+Partitioner::create_selection(const std::string &type) const
+{
+    std::shared_ptr<Selection> retval;
+
+    if(type == SelectionLogical::name())
+        retval = std::make_shared<SelectionLogical>();
+    else if(type == SelectionExplicit::name())
+        retval = std::make_shared<SelectionExplicit>();
+    else if(type == SelectionRanges::name())
+        retval = std::make_shared<SelectionRanges>();
+    else if(type == SelectionField::name())
+        retval = std::make_shared<SelectionField>();
+    else if(type == SelectionSFC::name())
+        retval = std::make_shared<SelectionSFC>();
+    else if(type == SelectionSpatial::name(SelectionSpatial::BOX))
+        retval = std::make_shared<SelectionSpatial>(SelectionSpatial::BOX);
+    else if(type == SelectionSpatial::name(SelectionSpatial::SPHERE))
+        retval = std::make_shared<SelectionSpatial>(SelectionSpatial::SPHERE);
+    else if(type == SelectionSpatial::name(SelectionSpatial::PLANE))
+        retval = std::make_shared<SelectionSpatial>(SelectionSpatial::PLANE);
+    else
+    {
+        CONDUIT_ERROR("Unknown selection type: " << type);
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+std::shared_ptr<Selection>
+Partitioner::create_selection_all_elements(const conduit::Node &n_mesh) const
+{
+    std::shared_ptr<Selection> retval;
+
+    // We're making a selection that includes all elements for the mesh.
+    // Take the first topology and its coordset.
+    const conduit::Node &n_topo = n_mesh["topologies"][0];
+    std::string csname(n_topo["coordset"].as_string());
+    const conduit::Node &n_coords = n_mesh["coordsets"][csname];
+
+    // Does the topo+coordset combo look structured?
+    bool is_uniform = n_coords["type"].as_string() == "uniform";
+    bool is_rectilinear = n_coords["type"].as_string() == "rectilinear";
+    bool is_structured = n_coords["type"].as_string() == "explicit" && 
+                         n_topo["type"].as_string() == "structured";
+
+    if(is_uniform || is_rectilinear || is_structured)
+    {
+        index_t edims[3] = {1,1,1};
+        conduit::blueprint::mesh::utils::topology::logical_dims(n_topo, edims, 3);
+        retval = create_selection(SelectionLogical::name());
+        retval->set_whole(true);
+        retval->set_topology(n_topo.name());
+        auto typed_sel = dynamic_cast<SelectionLogical *>(retval.get());
+        if(typed_sel != nullptr)
+        {
+            typed_sel->set_end(edims[0] > 0 ? edims[0]-1 : 0,
+                               edims[1] > 0 ? edims[1]-1 : 0,
+                               edims[2] > 0 ? edims[2]-1 : 0);
+        }
+    }
+    else
+    {
+        index_t nelem = topology::length(n_topo);
+
+        // Create a range that selects the topology.
+        retval = create_selection(SelectionRanges::name());
+        retval->set_whole(true);
+        retval->set_topology(n_topo.name());
+        auto typed_sel = dynamic_cast<SelectionRanges *>(retval.get());
+        if(typed_sel != nullptr)
+        {
+#ifdef CONDUIT_INDEX_32
+            std::vector<uint32> range;
+            range.push_back(0);
+            range.push_back(static_cast<uint32>(nelem - 1));
+            conduit::Node n_range;
+            n_range.set(range);
+            typed_sel->set_ranges(n_range);
+#else
+            std::vector<uint64> range;
+            range.push_back(0);
+            range.push_back(static_cast<uint64>(nelem - 1));
+            conduit::Node n_range;
+            n_range.set(range);
+            typed_sel->set_ranges(n_range);
+#endif
+        }
+    }
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+bool
+Partitioner::options_get_target(const conduit::Node &options,
+                                unsigned int &value) const
+{
+    bool retval = false;
+    value = 0;
+    if(options.has_child("target"))
+    {
+        const conduit::Node &n_target = options["target"];
+        if(n_target.dtype().is_number())
+        {
+            // For signed int types, make the min allowable value be 0.
+            if(n_target.dtype().is_int8())
+            {
+                auto v = n_target.as_int8();
+                value = static_cast<unsigned int>((v < 0) ? 0 : v);
+            }
+            else if(n_target.dtype().is_int16())
+            {
+                auto v = n_target.as_int16();
+                value = static_cast<unsigned int>((v < 0) ? 0 : v);
+            }
+            else if(n_target.dtype().is_int32())
+            {
+                auto v = n_target.as_int32();
+                value = static_cast<unsigned int>((v < 0) ? 0 : v);
+            }
+            else if(n_target.dtype().is_int64())
+            {
+                auto v = n_target.as_int64();
+                value = static_cast<unsigned int>((v < 0) ? 0 : v);
+            }
+            else
+            {
+                value = n_target.to_unsigned_int();
+            }
+            retval = true;
+        }
+        else
+        {
+            CONDUIT_INFO("Nonnumber passed as selection target.");
+        }
+    }
+#ifdef CONDUIT_DEBUG_PARTITIONER
+    std::cout << "Partition called with target " << value << std::endl;
+#endif
+    return retval;
+}
+
+//---------------------------------------------------------------------------
+bool
+Partitioner::initialize(const conduit::Node &n_mesh,
+                        const conduit::Node &options)
+{
+    CONDUIT_ANNOTATE_MARK_SCOPE("initialize");
+
+    auto global_domids = get_global_domids(n_mesh);
+
+    auto doms = conduit::blueprint::mesh::domains(n_mesh);
+
+    // Iterate over the selections in the options and check them against the
+    // domains that were passed in to make a vector of meshes and selections
+    // that can be used to partition the meshes.
+    selections.clear();
+    if(options.has_child("selections"))
     {
         const conduit::Node &n_selections = options["selections"];
         for(index_t i = 0; i < n_selections.number_of_children(); i++)
@@ -1785,6 +2862,14 @@ Partitioner::initialize(const conduit::Node &n_mesh,
                 auto sel = create_selection(type);
                 if(sel != nullptr && sel->init(n_sel))
                 {
+                    // A curve selection that applies to any domain cuts the
+                    // elements of all domains, so its parts are made first.
+                    if(sel->get_domain_any() &&
+                       dynamic_cast<SelectionSFC *>(sel.get()) != nullptr)
+                    {
+                        initialize_sfc_parts(sel, doms, options);
+                    }
+
                     // The selection is good. See if it applies to the domains.
                     auto n = static_cast<index_t>(doms.size());
                     for(index_t di = 0; di < n; di++)
@@ -1894,6 +2979,23 @@ Partitioner::initialize(const conduit::Node &n_mesh,
     if(options.has_child("merge_tolerance"))
         merge_tolerance = options["merge_tolerance"].to_double();
 
+    // Get the number of threads to use when merging points.
+    if(options.has_child("num_threads"))
+    {
+        num_threads = options["num_threads"].to_index_t();
+        if(num_threads <= 0)
+            num_threads = std::max((index_t)1, (index_t)std::thread::hardware_concurrency());
+    }
+
+    // Get whether whole domains may reference the input arrays in the output.
+    if(options.has_child("external"))
+        external = options["external"].to_unsigned_int() != 0;
+
+    // Get whether domains that are free to move should stay on the rank that
+    // already holds most of their elements.
+    if(options.has_child("minimize_migration"))
+        minimize_migration = options["minimize_migration"].to_unsigned_int() != 0;
+
 #ifdef CONDUIT_DEBUG_PARTITIONER
     cout << rank << ": Partitioner::initialize" << endl;
     cout << "\ttarget=" << target << endl;
@@ -1910,6 +3012,103 @@ Partitioner::initialize(const conduit::Node &n_mesh,
     return true; //!selections.empty();
 }
 
+//---------------------------------------------------------------------------
+void
+Partitioner::initialize_sfc_parts(const std::shared_ptr<Selection> &sel,
+    const std::vector<const conduit::Node *> &doms,
+    const conduit::Node &options)
+{
+    auto sfc = dynamic_cast<SelectionSFC *>(sel.get());
+
+    // The selection's parts, or else the target, sets the number of parts.
+    index_t nparts = sfc->get_parts();
+    unsigned int targetval = 0;
+    if(options_get_target(options, targetval) && nparts == 0)
+        nparts = static_cast<index_t>(targetval);
+    nparts = std::max(nparts, (index_t)1);
+
+    // Compute the centroids of the selected elements in all domains and
+    // their bounds.
+    const float64 inf = std::numeric_limits<float64>::infinity();
+    float64 bounds[6] = {inf, inf, inf, -inf, -inf, -inf};
+    std::vector<const conduit::Node *> sel_doms;
+    std::vector<std::vector<float64> > xyz;
+    for(const conduit::Node *dom : doms)
+    {
+        if(sfc->applicable(*dom))
+        {
+            sel_doms.push_back(dom);
+            xyz.push_back(std::vector<float64>());
+            sfc->centroids(*dom, xyz.back(), bounds);
+        }
+    }
+    reduce_sfc_bounds(bounds);
+
+    // Compute the keys within the common bounds.
+    std::map<const conduit::Node *, std::vector<uint64> > mesh_keys;
+    std::vector<uint64> sorted_keys;
+    for(size_t i = 0; i < sel_doms.size(); i++)
+    {
+        std::vector<uint64> &k = mesh_keys[sel_doms[i]];
+        sfc->keys(xyz[i], bounds, k);
+        sorted_keys.insert(sorted_keys.end(), k.begin(), k.end());
+    }
+    xyz.clear();
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+
+    // Find the splitters of the keys from all domains by bisection: each
+    // splitter is the smallest key value with at least p*n/nparts keys
+    // before it. All keys are less than 2^63.
+    std::vector<uint64> counts(1, static_cast<uint64>(sorted_keys.size()));
+    reduce_sfc_counts(counts);
+    const uint64 total = counts[0];
+    const size_t nsplit = static_cast<size_t>(nparts - 1);
+    std::vector<uint64> goal(nsplit), lo(nsplit, 0), hi(nsplit, static_cast<uint64>(1) << 63);
+    for(size_t p = 0; p < nsplit; p++)
+        goal[p] = (static_cast<uint64>(p + 1) * total) / static_cast<uint64>(nparts);
+    bool searching = nsplit > 0;
+    while(searching)
+    {
+        std::vector<uint64> mid(nsplit);
+        counts.resize(nsplit);
+        for(size_t p = 0; p < nsplit; p++)
+        {
+            mid[p] = lo[p] + (hi[p] - lo[p]) / 2;
+            counts[p] = static_cast<uint64>(std::lower_bound(sorted_keys.begin(),
+                sorted_keys.end(), mid[p]) - sorted_keys.begin());
+        }
+        reduce_sfc_counts(counts);
+        searching = false;
+        for(size_t p = 0; p < nsplit; p++)
+        {
+            if(lo[p] < hi[p])
+            {
+                if(counts[p] >= goal[p])
+                    hi[p] = mid[p];
+                else
+                    lo[p] = mid[p] + 1;
+            }
+            searching |= lo[p] < hi[p];
+        }
+    }
+
+    sfc->set_global_parts(nparts, bounds, lo, mesh_keys);
+}
+
+//---------------------------------------------------------------------------
+void
+Partitioner::reduce_sfc_bounds(float64 /*bounds*/[6]) const
+{
+    // implemented only in parallel case
+}
+
+//---------------------------------------------------------------------------
+void
+Partitioner::reduce_sfc_counts(std::vector<uint64> &/*counts*/) const
+{
+    // implemented only in parallel case
+}
+
 //---------------------------------------------------------------------------
 std::vector<index_t>
 Partitioner::get_global_domids(const conduit::Node& n_mesh)
@@ -1984,6 +3183,8 @@ Partitioner::get_total_selections() const
 void
 Partitioner::split_selections()
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("split_selections");
+
     // Splitting based on target.
 #ifdef CONDUIT_DEBUG_PARTITIONER
     int iteration = 1;
@@ -2039,64 +3240,161 @@ Partitioner::split_selections()
 }
 
 //---------------------------------------------------------------------------
-template<typename FloatType>
+template<typename Copy>
+struct O2MOnesWalker
+{
+    const std::vector<index_t> &ones;
+    const Copy &copy;
+
+    template<typename IndexT>
+    void operator()(const conduit::blueprint::o2mrelation::O2MView<IndexT> &view) const
+    {
+        for(const index_t one : ones)
+        {
+            for(const index_t data_idx : view[one])
+            {
+                copy(data_idx);
+            }
+        }
+    }
+};
+
+//---------------------------------------------------------------------------
+/**
+ @brief Calls copy(data_idx) for the data index of each "many" item of the
+        given "ones" of an o2mrelation, in order.
+*/
+template<typename Copy>
+static void
+walk_o2m_ones(const conduit::Node &o2m,
+              const std::vector<index_t> &ones,
+              const Copy &copy)
+{
+    const O2MOnesWalker<Copy> walker = {ones, copy};
+    conduit::blueprint::o2mrelation::dispatch_view(o2m, walker);
+}
+
+//---------------------------------------------------------------------------
+template<typename Func>
+struct O2MWalker
+{
+    const Func &func;
+
+    template<typename IndexT>
+    void operator()(const conduit::blueprint::o2mrelation::O2MView<IndexT> &view) const
+    {
+        for(const auto &one : view)
+        {
+            for(const index_t data_idx : one)
+            {
+                func(one.id(), data_idx);
+            }
+        }
+    }
+};
+
+//---------------------------------------------------------------------------
+/**
+ @brief Calls func(one_idx, data_idx) for each "many" item of each "one"
+        of an o2mrelation, in order.
+*/
+template<typename Func>
 static void
-copy_volume_fractions(
-    const std::vector<index_t> &element_ids,
-    const Node &in_data,
-    Node &out_data)
+walk_o2m(const conduit::Node &o2m, const Func &func)
 {
-    out_data.set_dtype(conduit::DataType(in_data.dtype().id(), element_ids.size()));
+    const O2MWalker<Func> walker = {func};
+    conduit::blueprint::o2mrelation::dispatch_view(o2m, walker);
+}
 
-    const conduit::DataArray<FloatType> in_values(in_data.element_ptr(0), in_data.dtype());
-    conduit::DataArray<FloatType> out_values(out_data.element_ptr(0), out_data.dtype());
+//---------------------------------------------------------------------------
+/**
+ @brief The data indices a matset's selected elements use, in output order.
+        The volume fractions, and the matset_values of fields on the matset
+        (which are laid out like the volume fractions), are gathered with
+        these indices.
+*/
+struct MatsetGather
+{
+    /// Uni-buffer: indices into material_ids and volume_fractions.
+    std::vector<index_t> indices;
+    /// Multi-buffer: indices into each material's volume_fractions.
+    std::vector<std::pair<std::string, std::vector<index_t>>> materials;
+};
 
-    // Iterate over desired element ids
-    index_t out_idx = 0;
-    for(const auto elem_id : element_ids)
+//---------------------------------------------------------------------------
+/**
+ @brief Returns the node holding the values of a matset array, which is the
+        first data path when the array is an o2mrelation.
+*/
+static const conduit::Node &
+matset_array_values(const conduit::Node &n_array)
+{
+    if(n_array.dtype().is_object())
     {
-        out_values[out_idx++] = in_values[elem_id];
+        const auto data_paths = blueprint::o2mrelation::data_paths(n_array);
+        if(data_paths.empty())
+        {
+            CONDUIT_ERROR(n_array.name() << " appears to be an o2m relation but has no data_paths.");
+        }
+        return n_array[data_paths[0]];
     }
+    return n_array;
 }
 
 //---------------------------------------------------------------------------
-template<typename FloatType>
+/**
+ @brief Gathers the data indices of the "many" items of the given "ones" of
+        an o2mrelation, counting them first so indices is sized once.
+*/
 static void
-copy_volume_fractions_o2m(
-    const std::vector<index_t> &element_ids,
-    const Node &in_data,
-    Node &out_data)
+gather_o2m_indices(const conduit::Node &o2m,
+                   const std::vector<index_t> &ones,
+                   std::vector<index_t> &indices)
 {
-    // In data is o2m, need to extract "values" to get data
-    conduit::blueprint::o2mrelation::O2MIterator indexer(in_data);
-    const conduit::Node &n_in_values = in_data["values"];
-    out_data.set_dtype(conduit::DataType(in_data["values"].dtype().id(), element_ids.size()));
+    index_t count = 0;
+    walk_o2m_ones(o2m, ones, [&](index_t)
+    {
+        count++;
+    });
 
-    const conduit::DataArray<FloatType> in_values(n_in_values.element_ptr(0), n_in_values.dtype());
-    conduit::DataArray<FloatType> out_values(out_data.element_ptr(0), out_data.dtype());
+    indices.resize(count);
+    index_t offset = 0;
+    walk_o2m_ones(o2m, ones, [&](index_t idx)
+    {
+        indices[offset++] = idx;
+    });
+}
 
-    // Iterate over desired element ids
-    index_t out_idx = 0;
-    for(const auto elem_id : element_ids)
+//---------------------------------------------------------------------------
+/**
+ @brief Copies the material ids at the given indices as index_t.
+*/
+static void
+gather_material_ids(const conduit::Node &n_material_ids,
+                    const std::vector<index_t> &indices,
+                    conduit::Node &out_material_ids)
+{
+    out_material_ids.set_dtype(conduit::DataType::index_t(indices.size()));
+    const conduit::DataAccessor<index_t> in_ids = n_material_ids.value();
+    conduit::DataArray<index_t> out_ids = out_material_ids.value();
+    const index_t n = (index_t)indices.size();
+    for(index_t i = 0; i < n; i++)
     {
-        indexer.to(elem_id);
-        const auto index = indexer.index();
-        out_values[out_idx++] = in_values[index];
+        out_ids[i] = in_ids[indices[i]];
     }
 }
 
 //---------------------------------------------------------------------------
-template<typename FloatType>
 static void
-copy_uni_buffer_matset_impl(
+gather_uni_buffer_matset(
     const std::vector<index_t> &element_ids,
     const conduit::Node &n_matset,
-    conduit::Node &out_matset)
+    conduit::Node &out_matset,
+    MatsetGather &gather)
 {
     const index_t num_elements = (index_t)element_ids.size();
 
-    // Determine output size and sizes/offsets
-    index_t out_size = 0;
+    // Determine sizes/offsets
     if(n_matset.has_child("sizes"))
     {
         // Element based matset will have an entry for each element, should be able to safely index by element id
@@ -2106,8 +3404,9 @@ copy_uni_buffer_matset_impl(
         DataArray<index_t> out_sizes   = out_matset["sizes"].value();
         DataArray<index_t> out_offsets = out_matset["offsets"].value();
 
-        // Build output sizes / offsets, while computing size of output data array
+        // Build output sizes / offsets
         bool need_offsets_sizes = false;
+        index_t out_size = 0;
         for(index_t i = 0; i < num_elements; i++)
         {
             const index_t id = element_ids[i];
@@ -2128,398 +3427,200 @@ copy_uni_buffer_matset_impl(
             out_matset.remove("offsets");
         }
     }
-    else
-    {
-        out_size = num_elements;
-    }
-
-    // Allocate output arrays
-    out_matset["material_ids"].set_dtype(conduit::DataType::index_t(out_size));
-    out_matset["volume_fractions"].set_dtype(
-        conduit::DataType(n_matset.fetch_existing("volume_fractions").dtype().id(), out_size));
-    DataArray<index_t> out_material_ids = out_matset.fetch_existing("material_ids").value();
-    DataArray<FloatType> out_volume_fractions = out_matset.fetch_existing("volume_fractions").value();
-
-    const DataAccessor<index_t> in_material_ids = n_matset.fetch_existing("material_ids").value();
-    const DataArray<FloatType> in_volume_fractions = n_matset.fetch_existing("volume_fractions").value();
-    conduit::blueprint::o2mrelation::O2MIterator indexer(n_matset);
-    index_t offset = 0;
-
-    for(index_t i = 0; i < num_elements; i++)
-    {
-        // Point the o2m iterator at (element_id, 0)
-        const auto element_id = element_ids[i];
-        indexer.to(element_id, conduit::blueprint::o2mrelation::ONE);
-        indexer.to(0, conduit::blueprint::o2mrelation::MANY);
-
-        // Get the number of "many" elements for this element_id
-        const index_t size = indexer.elements(conduit::blueprint::o2mrelation::MANY);
-        index_t idx  = indexer.index(conduit::blueprint::o2mrelation::DATA);
-
-#if 0
-        std::cout << "element_id = " << element_id
-            << "\nsize = " << size
-            << "\nidx = " << idx << std::endl;
-#endif
-
-        // Copy each item in the O2M relation
-        for(index_t j = 0; j < size; j++)
-        {
-            out_material_ids[offset]     = in_material_ids[idx];
-            out_volume_fractions[offset] = in_volume_fractions[idx];
-            idx++;
-            offset++;
-        }
-    }
-}
-
-//---------------------------------------------------------------------------
-static void
-copy_uni_buffer_matset(
-    const std::vector<index_t> &element_ids,
-    const conduit::Node &n_matset,
-    conduit::Node &out_matset)
-{
-    // Determine floating point type
-    const auto &dtype = n_matset.fetch_existing("volume_fractions").dtype();
-    if(dtype.is_float())
-    {
-        copy_uni_buffer_matset_impl<float>(element_ids, n_matset, out_matset);
-    }
-    else if(dtype.is_double())
-    {
-        copy_uni_buffer_matset_impl<double>(element_ids, n_matset, out_matset);
-    }
-#if CONDUIT_USE_LONG_DOUBLE
-    else if(dtype.is_long_double())
-    {
-        copy_uni_buffer_matset_impl<long double>(element_ids, n_matset, out_matset);
-    }
-#endif
 
+    // Each item in the O2M relation of each element
+    gather_o2m_indices(n_matset, element_ids, gather.indices);
+    gather_material_ids(n_matset.fetch_existing("material_ids"), gather.indices,
+        out_matset["material_ids"]);
 }
 
 //---------------------------------------------------------------------------
 static void
-copy_multi_buffer_matset(
+gather_multi_buffer_matset(
     const std::vector<index_t> &element_ids,
     const conduit::Node &n_matset,
-    conduit::Node &out_matset)
+    MatsetGather &gather)
 {
     const conduit::Node &n_vfracts = n_matset["volume_fractions"];
-    conduit::Node &out_vfracts = out_matset.add_child("volume_fractions");
     auto vfract_itr = n_vfracts.children();
     while(vfract_itr.has_next())
     {
         const conduit::Node &n_vfract = vfract_itr.next();
-        conduit::Node &out_vfract = out_vfracts.add_child(n_vfract.name());
-        bool is_o2m = n_vfract.dtype().is_object();
-        if(is_o2m)
+        gather.materials.emplace_back();
+        gather.materials.back().first = n_vfract.name();
+        std::vector<index_t> &indices = gather.materials.back().second;
+        if(n_vfract.dtype().is_object())
         {
-            const auto data_paths = blueprint::o2mrelation::data_paths(n_vfract);
-            if(data_paths.empty())
-            {
-                CONDUIT_ERROR("volume_fractions appears to be an o2m relation but has no data_paths.");
-                return;
-            }
-            std::string data_name = data_paths[0];
-
-            const auto &dtype = n_vfract[data_name].dtype();
-            if(dtype.is_float())
-            {
-                copy_volume_fractions_o2m<float>(element_ids, n_vfract, out_vfract);
-            }
-            else if(dtype.is_double())
-            {
-                copy_volume_fractions_o2m<double>(element_ids, n_vfract, out_vfract);
-            }
-#if CONDUIT_USE_LONG_DOUBLE
-            else if(dtype.is_long_double())
-            {
-                copy_volume_fractions_o2m<long double>(element_ids, n_vfract, out_vfract);
-            }
-#endif
+            gather_o2m_indices(n_vfract, element_ids, indices);
         }
         else
         {
-            const auto &dtype = n_vfract.dtype();
-            if(dtype.is_float())
-            {
-                copy_volume_fractions<float>(element_ids, n_vfract, out_vfract);
-            }
-            else if(dtype.is_double())
-            {
-                copy_volume_fractions<double>(element_ids, n_vfract, out_vfract);
-            }
-#if CONDUIT_USE_LONG_DOUBLE
-            else if(dtype.is_long_double())
-            {
-                copy_volume_fractions<long double>(element_ids, n_vfract, out_vfract);
-            }
-#endif
+            indices = element_ids;
         }
     }
 }
 
 //---------------------------------------------------------------------------
 /**
- @brief Populate unordered map of topological element_ids -> matset data indicies
+ @brief Finds the entries of a material based matset's element_ids that
+        belong to selected elements, in selection order (and entry order
+        within an element, since uni-buffer matsets list an element once per
+        material). The entries of each element are chained from a dense
+        lookup by element id (sized by the largest selected id, all -1)
+        rather than found through a hash map. The lookup is restored to -1
+        before returning.
+
+ @param mat_elems The element_ids of the matset (or of one material).
+ @param element_ids The selected element ids.
+ @param lookup The dense lookup, holding the first entry of each element.
+ @param next Scratch space for the chains of entries.
+ @param[out] sel_idxs The positions in element_ids of the entries found.
+ @param[out] mat_idxs The entries found.
 */
 static void
-create_element_to_material_map(const conduit::DataAccessor<index_t> &mat_element_ids,
-                               std::unordered_map<index_t, index_t> &out)
-{
-    const auto mat_nelem = mat_element_ids.number_of_elements();
-    out.clear();
-    out.reserve(mat_nelem);
-    for(index_t i = 0; i < mat_nelem; i++)
-    {
-        // Map the actual element id to an index
-        out.insert({mat_element_ids[i], i});
-    }
-}
-
-//---------------------------------------------------------------------------
-template<typename FloatType>
-static void
-copy_material_based_volume_fractions(const std::vector<index_t> &element_ids,
-                                     const conduit::Node &n_vfract,
-                                     const std::unordered_map<index_t, index_t> &elem_map,
-                                     conduit::Node &out_matset)
+find_material_elements(const conduit::DataAccessor<index_t> &mat_elems,
+                       const std::vector<index_t> &element_ids,
+                       std::vector<index_t> &lookup,
+                       std::vector<index_t> &next,
+                       std::vector<index_t> &sel_idxs,
+                       std::vector<index_t> &mat_idxs)
 {
-    // Figure out if vfract is o2m, create iterator if it is
-    const bool is_o2m = n_vfract.dtype().is_object();
-
-    std::string o2m_data_name;
-    if(is_o2m)
+    const index_t mat_nelem = mat_elems.number_of_elements();
+    const index_t nlookup = (index_t)lookup.size();
+    next.resize(mat_nelem);
+    // Build the chains backwards so they are in entry order
+    for(index_t i = mat_nelem - 1; i >= 0; i--)
     {
-        auto paths = blueprint::o2mrelation::data_paths(n_vfract);
-        if(paths.empty())
+        const index_t id = mat_elems[i];
+        if(id >= 0 && id < nlookup)
         {
-            CONDUIT_ERROR("volume_fraction appears to be an o2m relation but it contains no data paths.");
-            return;
+            next[i] = lookup[id];
+            lookup[id] = i;
         }
-        o2m_data_name = paths[0];
     }
-    const conduit::DataArray<FloatType> vfracts = (is_o2m) ? n_vfract[o2m_data_name].value() : n_vfract.value();
-
-    const std::string &mat_name = n_vfract.name();
-    conduit::Node &out_mat_vfract = out_matset["volume_fractions"].add_child(mat_name);
-    conduit::Node &out_mat_elems  = out_matset["element_ids"].add_child(mat_name);
 
-    std::vector<FloatType> out_vfracts;
-    std::vector<index_t> out_elems;
+    // Count, then fill
     const index_t nelem = (index_t)element_ids.size();
-    if(is_o2m)
+    index_t count = 0;
+    for(index_t i = 0; i < nelem; i++)
     {
-        conduit::blueprint::o2mrelation::O2MIterator indexer(n_vfract);
-        for(index_t i = 0; i < nelem; i++)
+        for(index_t idx = lookup[element_ids[i]]; idx >= 0; idx = next[idx])
         {
-            const index_t id = element_ids[i];
-            const auto itr = elem_map.find(id);
-            if(itr != elem_map.end())
-            {
-                const index_t one_idx = itr->second;
-                indexer.to(one_idx, conduit::blueprint::o2mrelation::ONE);
-                indexer.to(0, conduit::blueprint::o2mrelation::MANY);
-                const index_t data_idx = indexer.index();
-                out_vfracts.push_back(vfracts[data_idx]);
-                out_elems.push_back(i);
-            }
+            count++;
         }
     }
-    else
+    sel_idxs.resize(count);
+    mat_idxs.resize(count);
+    index_t n = 0;
+    for(index_t i = 0; i < nelem; i++)
     {
-        for(index_t i = 0; i < nelem; i++)
+        for(index_t idx = lookup[element_ids[i]]; idx >= 0; idx = next[idx])
         {
-            const index_t id = element_ids[i];
-            const auto itr = elem_map.find(id);
-            if(itr != elem_map.end())
-            {
-                const index_t data_idx = itr->second;
-                out_vfracts.push_back(vfracts[data_idx]);
-                out_elems.push_back(i);
-            }
+            sel_idxs[n] = i;
+            mat_idxs[n] = idx;
+            n++;
         }
     }
 
-    // For baseline consistency
-    if(out_vfracts.size() > 0)
+    for(index_t i = 0; i < mat_nelem; i++)
     {
-        out_mat_vfract.set(out_vfracts);
-        out_mat_elems.set(out_elems);
+        const index_t id = mat_elems[i];
+        if(id >= 0 && id < nlookup)
+        {
+            lookup[id] = -1;
+        }
     }
 }
 
 //---------------------------------------------------------------------------
-template<typename FloatType>
 static void
-copy_material_based_uni_buffer(const std::vector<index_t> &element_ids,
-                               const conduit::Node &n_matset,
-                               const std::unordered_map<index_t, index_t> &elem_map,
-                               conduit::Node &out_matset)
+gather_material_based_multi_buffer(const std::vector<index_t> &element_ids,
+                                   const conduit::Node &n_matset,
+                                   std::vector<index_t> &lookup,
+                                   conduit::Node &out_matset,
+                                   MatsetGather &gather)
 {
-    const conduit::DataAccessor<index_t> in_material_ids     = n_matset["material_ids"].value();
-    const conduit::DataArray<FloatType>  in_volume_fractions = n_matset["volume_fractions"].value();
-    const index_t num_elements = (index_t)element_ids.size();
-
-    // Make a first pass to determine sizes, offsets, and new element ids
-    // Also build "one_idxs" so we don't have to query the map again on the second pass
-    std::vector<index_t> one_idxs;
-    one_idxs.reserve(num_elements);
-    index_t out_size = 0;
-    if(n_matset.has_child("sizes"))
+    const conduit::Node &n_elem_ids = n_matset["element_ids"];
+    std::vector<index_t> next, sel_idxs, mat_idxs;
+    auto itr = n_matset["volume_fractions"].children();
+    while(itr.has_next())
     {
-        // Element based matset will have an entry for each element, should be able to safely index by element id
-        const conduit::DataAccessor<index_t> size_access = n_matset.fetch_existing("sizes").value();
-        std::vector<index_t> out_sizes;
-        std::vector<index_t> out_offsets;
-        std::vector<index_t> out_elem_ids;
-        out_sizes.reserve(num_elements);
-        out_offsets.reserve(num_elements);
-        out_elem_ids.reserve(num_elements);
-
-        // Build output sizes / offsets, while computing size of output data array
-        bool need_offsets_sizes = false;
-        for(index_t i = 0; i < num_elements; i++)
-        {
-            const index_t id = element_ids[i];
-            const auto itr   = elem_map.find(id);
-            if(itr != elem_map.end())
-            {
-                const index_t idx = itr->second;
-                one_idxs.push_back(idx);
-                out_elem_ids.push_back(i);
-                const index_t s  = size_access[idx];
-                if(s != 1)
-                {
-                    need_offsets_sizes = true;
-                }
-                out_offsets.push_back(out_size);
-                out_sizes.push_back(s);
-                out_size += s;
-            }
-        }
+        const conduit::Node &n_vfract = itr.next();
+        const std::string &mat_name = n_vfract.name();
+        const conduit::DataAccessor<index_t> mat_elems = n_elem_ids[mat_name].value();
+        find_material_elements(mat_elems, element_ids, lookup, next,
+            sel_idxs, mat_idxs);
 
-        out_matset["element_ids"].set(out_elem_ids);
-        // Only copy sizes/offsets if they are actually needed
-        if(need_offsets_sizes)
+        gather.materials.emplace_back();
+        gather.materials.back().first = mat_name;
+        std::vector<index_t> &indices = gather.materials.back().second;
+        if(n_vfract.dtype().is_object())
         {
-            out_matset["sizes"].set(out_sizes);
-            out_matset["offsets"].set(out_offsets);
+            gather_o2m_indices(n_vfract, mat_idxs, indices);
         }
-    }
-    else
-    {
-        std::vector<index_t> out_elem_ids;
-        out_elem_ids.reserve(num_elements);
-        for(index_t i = 0; i < num_elements; i++)
+        else
         {
-            const index_t id = element_ids[i];
-            const auto itr   = elem_map.find(id);
-            if(itr != elem_map.end())
-            {
-                one_idxs.push_back(itr->second);
-                out_elem_ids.push_back(i);
-            }
+            indices.swap(mat_idxs);
         }
-        out_size = (index_t)out_elem_ids.size();
-        out_matset["element_ids"].set(out_elem_ids);
-    }
-
-    // Allocate output
-    out_matset["material_ids"].set_dtype(conduit::DataType::index_t(out_size));
-    out_matset["volume_fractions"].set_dtype(conduit::DataType(in_volume_fractions.dtype().id(), out_size));
-
-    conduit::blueprint::o2mrelation::O2MIterator indexer(n_matset);
-    conduit::DataArray<index_t>   out_mat_ids = out_matset.fetch_existing("material_ids").value();
-    conduit::DataArray<FloatType> out_vfracts = out_matset.fetch_existing("volume_fractions").value();
-    index_t offset = 0;
-    for(const index_t one_idx : one_idxs)
-    {
-        // Point the o2m iterator at (element_id, 0)
-        indexer.to(one_idx, conduit::blueprint::o2mrelation::ONE);
-        indexer.to(0, conduit::blueprint::o2mrelation::MANY);
-
-        // Get the number of "many" elements for this element_id
-        const index_t size = indexer.elements(conduit::blueprint::o2mrelation::MANY);
-        index_t idx  = indexer.index(conduit::blueprint::o2mrelation::DATA);
 
-        // Copy each item in the O2M relation
-        for(index_t j = 0; j < size; j++)
+        out_matset["volume_fractions"].add_child(mat_name);
+        conduit::Node &out_mat_elems = out_matset["element_ids"].add_child(mat_name);
+        // For baseline consistency, materials with no selected elements are empty
+        if(!indices.empty())
         {
-            out_mat_ids[offset] = in_material_ids[idx];
-            out_vfracts[offset] = in_volume_fractions[idx];
-            idx++;
-            offset++;
+            out_mat_elems.set(sel_idxs);
         }
     }
 }
 
 //---------------------------------------------------------------------------
 static void
-copy_material_based_matset(const std::vector<index_t> &element_ids,
-                           const conduit::Node &n_matset,
-                           conduit::Node &out_matset)
-{
-    const conduit::Node &n_elem_ids = n_matset["element_ids"];
-    const conduit::Node &n_volume_fractions = n_matset["volume_fractions"];
-    std::unordered_map<index_t, index_t> elem_map;
-    // Material based matsets can also be multi or uni buffer
-    if(blueprint::mesh::matset::is_multi_buffer(n_matset))
+gather_material_based_uni_buffer(const std::vector<index_t> &element_ids,
+                                 const conduit::Node &n_matset,
+                                 std::vector<index_t> &lookup,
+                                 conduit::Node &out_matset,
+                                 MatsetGather &gather)
+{
+    const conduit::DataAccessor<index_t> mat_elems = n_matset["element_ids"].value();
+    std::vector<index_t> next, sel_idxs, mat_idxs;
+    find_material_elements(mat_elems, element_ids, lookup, next,
+        sel_idxs, mat_idxs);
+    out_matset["element_ids"].set(sel_idxs);
+
+    if(n_matset.has_child("sizes"))
     {
-        auto itr = n_volume_fractions.children();
-        while(itr.has_next())
-        {
-            const conduit::Node &n_mat_vfract = itr.next();
-            const conduit::Node &n_mat_elems = n_elem_ids[n_mat_vfract.name()];
-            const conduit::DataAccessor<index_t> mat_elems = n_mat_elems.value();
-            create_element_to_material_map(mat_elems, elem_map);
+        // Element based matset will have an entry for each element, should be able to safely index by element id
+        const conduit::DataAccessor<index_t> size_access = n_matset.fetch_existing("sizes").value();
+        const index_t n = (index_t)mat_idxs.size();
+        std::vector<index_t> out_sizes(n), out_offsets(n);
 
-            const auto &dtype = n_mat_vfract.dtype();
-            if(dtype.is_float())
-            {
-                copy_material_based_volume_fractions<float>(element_ids, n_mat_vfract,
-                    elem_map, out_matset);
-            }
-            else if(dtype.is_double())
-            {
-                copy_material_based_volume_fractions<double>(element_ids, n_mat_vfract,
-                    elem_map, out_matset);
-            }
-#if CONDUIT_USE_LONG_DOUBLE
-            else if(dtype.is_long_double())
+        // Build output sizes / offsets
+        bool need_offsets_sizes = false;
+        index_t out_size = 0;
+        for(index_t i = 0; i < n; i++)
+        {
+            const index_t s = size_access[mat_idxs[i]];
+            if(s != 1)
             {
-                copy_material_based_volume_fractions<long double>(element_ids, n_mat_vfract,
-                    elem_map, out_matset);
+                need_offsets_sizes = true;
             }
-#endif
+            out_offsets[i] = out_size;
+            out_sizes[i]   = s;
+            out_size      += s;
         }
-    }
-    else
-    {
-        const conduit::DataAccessor<index_t> mat_elems = n_elem_ids.value();
-        create_element_to_material_map(mat_elems, elem_map);
 
-        const auto &dtype = n_volume_fractions.dtype();
-        if(dtype.is_float())
-        {
-            copy_material_based_uni_buffer<float>(element_ids, n_matset,
-                elem_map, out_matset);
-        }
-        else if(dtype.is_double())
-        {
-            copy_material_based_uni_buffer<double>(element_ids, n_matset,
-                elem_map, out_matset);
-        }
-#if CONDUIT_USE_LONG_DOUBLE
-        else if(dtype.is_long_double())
+        // Only copy sizes/offsets if they are actually needed
+        if(need_offsets_sizes)
         {
-            copy_material_based_volume_fractions<long double>(element_ids, n_mat_vfract,
-                elem_map, out_matset);
+            out_matset["sizes"].set(out_sizes);
+            out_matset["offsets"].set(out_offsets);
         }
-#endif
     }
+
+    // Each item in the O2M relation of each element
+    gather_o2m_indices(n_matset, mat_idxs, gather.indices);
+    gather_material_ids(n_matset["material_ids"], gather.indices,
+        out_matset["material_ids"]);
 }
 
 //---------------------------------------------------------------------------
@@ -2533,6 +3634,9 @@ Partitioner::copy_matsets(const std::string &topology,
     if(!n_mesh.has_child("matsets"))
         return;
 
+    // Dense element id lookup for material based matsets, built on demand.
+    std::vector<index_t> lookup;
+
     // n_output.schema().print();
     const conduit::Node &n_matsets = n_mesh["matsets"];
     conduit::Node &out_matsets = n_output["matsets"];
@@ -2554,20 +3658,113 @@ Partitioner::copy_matsets(const std::string &topology,
             out_matset["material_map"].set(n_matset["material_map"]);
         }
 
-        // Check if material based
+        // First pass: find the data indices of the selected elements and
+        // build the index arrays of the output matset.
+        const bool multi_buffer = blueprint::mesh::matset::is_multi_buffer(n_matset);
+        MatsetGather gather;
         if(n_matset.has_child("element_ids"))
         {
-            copy_material_based_matset(element_ids, n_matset, out_matset);
+            // Material based
+            if(lookup.empty() && !element_ids.empty())
+            {
+                const index_t max_id = *std::max_element(element_ids.begin(),
+                                                         element_ids.end());
+                lookup.assign(max_id + 1, -1);
+            }
+
+            if(multi_buffer)
+            {
+                gather_material_based_multi_buffer(element_ids, n_matset,
+                    lookup, out_matset, gather);
+            }
+            else
+            {
+                gather_material_based_uni_buffer(element_ids, n_matset,
+                    lookup, out_matset, gather);
+            }
         }
-        else if(blueprint::mesh::matset::is_multi_buffer(n_matset))
+        else if(multi_buffer)
         {
             // Element based
-            copy_multi_buffer_matset(element_ids, n_matset, out_matset);
+            gather_multi_buffer_matset(element_ids, n_matset, gather);
         }
         else
         {
             // Element based
-            copy_uni_buffer_matset(element_ids, n_matset, out_matset);
+            gather_uni_buffer_matset(element_ids, n_matset, out_matset, gather);
+        }
+
+        // Second pass: gather the volume fractions.
+        const conduit::Node &n_vfracts = n_matset["volume_fractions"];
+        if(multi_buffer)
+        {
+            conduit::Node &out_vfracts = out_matset["volume_fractions"];
+            for(const auto &mat : gather.materials)
+            {
+                conduit::Node &out_vfract = out_vfracts[mat.first];
+                if(!mat.second.empty() || !n_matset.has_child("element_ids"))
+                {
+                    slice_array(matset_array_values(n_vfracts[mat.first]),
+                        mat.second, out_vfract);
+                }
+            }
+        }
+        else
+        {
+            slice_array(matset_array_values(n_vfracts), gather.indices,
+                out_matset["volume_fractions"]);
+        }
+
+        // The matset_values of fields on this matset are gathered with the
+        // same indices.
+        if(element_ids.empty() || !n_mesh.has_child("fields"))
+        {
+            continue;
+        }
+        const conduit::Node &n_fields = n_mesh["fields"];
+        for(index_t i = 0; i < n_fields.number_of_children(); i++)
+        {
+            const conduit::Node &n_field = n_fields[i];
+            if(!n_field.has_child("matset") ||
+               !n_field.has_child("matset_values") ||
+               n_field["matset"].as_string() != n_matset.name())
+            {
+                continue;
+            }
+
+            if(!selected_fields.empty() &&
+               std::find(selected_fields.begin(),
+                         selected_fields.end(),
+                         n_field.name()) == selected_fields.end())
+            {
+                continue;
+            }
+
+            conduit::Node &n_new_field = n_output["fields"][n_field.name()];
+            n_new_field["matset"].set(n_matset.name());
+            const conduit::Node &n_mvals = n_field["matset_values"];
+            conduit::Node &out_mvals = n_new_field["matset_values"];
+            if(multi_buffer)
+            {
+                for(const auto &mat : gather.materials)
+                {
+                    if(!n_mvals.has_child(mat.first))
+                    {
+                        continue;
+                    }
+                    conduit::Node &out_mval = out_mvals[mat.first];
+                    if(!mat.second.empty() || !n_matset.has_child("element_ids"))
+                    {
+                        slice_array(matset_array_values(n_mvals[mat.first]),
+                            mat.second, out_mval);
+                    }
+                }
+            }
+            else
+            {
+                slice_array(matset_array_values(n_mvals), gather.indices,
+                    out_mvals);
+            }
         }
     }
 }
@@ -2676,58 +3873,77 @@ Partitioner::copy_field(const conduit::Node &n_field,
             n_new_field[key] = n_field[key];
     }
 
+    // slice_array handles strided and interleaved values directly, so
+    // there is no need to compact the values first.
     const conduit::Node &n_values = n_field["values"];
     conduit::Node &new_values = n_new_field["values"];
-    if(n_values.dtype().is_compact()) 
+    if(n_values.number_of_children() > 0)
     {
-        if(n_values.number_of_children() > 0)
+        // mcarray.
+        for(index_t i = 0; i < n_values.number_of_children(); i++)
         {
+            const conduit::Node &n_vals = n_values[i];
+            slice_array(n_vals, ids, new_values[n_vals.name()]);
+        }
+    }
+    else
+        slice_array(n_values, ids, new_values);
+}
 
-// The vel data must be interleaved. We need to use the DataArray element methods for access.
-
+//---------------------------------------------------------------------------
+// Runs of consecutive ids at least this long are copied with memcpy.
+static const size_t SLICE_MIN_RUN = 8;
+// How many ids ahead of the current one the gather prefetches.
+static const size_t SLICE_PREFETCH_DISTANCE = 16;
 
-            // mcarray.
-            for(index_t i = 0; i < n_values.number_of_children(); i++)
+//---------------------------------------------------------------------------
+// @brief Gather the elements of src (elements of T's size, stride bytes
+//        apart) at the indices stored in ids into the compact dest array.
+//        When src is contiguous, runs of consecutive ids (as logical
+//        selections make) are copied with memcpy.
+template <typename T>
+static void
+typed_slice_array(const uint8 *src, index_t stride,
+                  const std::vector<index_t> &ids, T *dest)
+{
+    const size_t n = ids.size();
+    const index_t *idx = ids.data();
+    if(stride == static_cast<index_t>(sizeof(T)))
+    {
+        size_t i = 0;
+        while(i < n)
+        {
+            size_t j = i + 1;
+            while(j < n && idx[j] == idx[j - 1] + 1)
+                j++;
+            if(j - i >= SLICE_MIN_RUN)
+            {
+                std::memcpy(dest + i, src + idx[i] * stride, (j - i) * sizeof(T));
+            }
+            else
             {
-                const conduit::Node &n_vals = n_values[i];
-                slice_array(n_vals, ids, new_values[n_vals.name()]);
+                // memcpy, since the source need not be aligned for T.
+                for(size_t k = i; k < j; k++)
+                    std::memcpy(dest + k, src + idx[k] * stride, sizeof(T));
             }
+            i = j;
         }
-        else
-            slice_array(n_values, ids, new_values);
     }
     else
     {
-        // otherwise, we need to compact our data first
-        conduit::Node n;
-        n_values.compact_to(n);
-        if(n.number_of_children() > 0)
+        // Strided (e.g. interleaved) data. The column loads are far apart
+        // so prefetch ahead of them.
+        for(size_t i = 0; i < n; i++)
         {
-            // mcarray.
-            for(index_t i = 0; i < n.number_of_children(); i++)
-            {
-                const conduit::Node &n_vals = n[i];
-                slice_array(n_vals, ids, new_values[n_vals.name()]);
-            }
+#if defined(__GNUC__) || defined(__clang__)
+            if(i + SLICE_PREFETCH_DISTANCE < n)
+                __builtin_prefetch(src + idx[i + SLICE_PREFETCH_DISTANCE] * stride);
+#endif
+            std::memcpy(dest + i, src + idx[i] * stride, sizeof(T));
         }
-        else
-            slice_array(n, ids, new_values);
     }
 }
 
-//---------------------------------------------------------------------------
-// @brief Slice the n_src array using the indices stored in ids. We use the
-//        array classes for their [] operators that deal with interleaved
-//        and non-interleaved arrays.
-template <typename T>
-inline void
-typed_slice_array(const T &src, const std::vector<index_t> &ids, T &dest)
-{
-    size_t n = ids.size();
-    for(size_t i = 0; i < n; i++)
-        dest[i] = src[ids[i]];
-}
-
 //---------------------------------------------------------------------------
 // @note Should this be part of conduit::Node or DataArray somehow. The number
 //       of times I've had to slice an array...
@@ -2738,99 +3954,38 @@ Partitioner::slice_array(const conduit::Node &n_src_values,
     // Copy the DataType of the input conduit::Node but override the number of elements
     // before copying it in so assigning to n_dest_values triggers a memory
     // allocation.
-    auto dt = n_src_values.dtype();
-    n_dest_values = DataType(n_src_values.dtype().id(), ids.size());
+    const DataType &dt = n_src_values.dtype();
+    n_dest_values = DataType(dt.id(), ids.size());
+    if(ids.empty())
+        return;
 
-    // Do the slice.
-    if(dt.is_int8())
-    {
-        auto dest(n_dest_values.as_int8_array());
-        typed_slice_array(n_src_values.as_int8_array(), ids, dest);
-    }
-    else if(dt.is_int16())
-    {
-        auto dest(n_dest_values.as_int16_array());
-        typed_slice_array(n_src_values.as_int16_array(), ids, dest);
-    }
-    else if(dt.is_int32())
-    {
-        auto dest(n_dest_values.as_int32_array());
-        typed_slice_array(n_src_values.as_int32_array(), ids, dest);
-    }
-    else if(dt.is_int64())
-    {
-        auto dest(n_dest_values.as_int64_array());
-        typed_slice_array(n_src_values.as_int64_array(), ids, dest);
-    }
-    else if(dt.is_uint8())
-    {
-        auto dest(n_dest_values.as_uint8_array());
-        typed_slice_array(n_src_values.as_uint8_array(), ids, dest);
-    }
-    else if(dt.is_uint16())
-    {
-        auto dest(n_dest_values.as_uint16_array());
-        typed_slice_array(n_src_values.as_uint16_array(), ids, dest);
-    }
-    else if(dt.is_uint32())
-    {
-        auto dest(n_dest_values.as_uint32_array());
-        typed_slice_array(n_src_values.as_uint32_array(), ids, dest);
-    }
-    else if(dt.is_uint64())
-    {
-        auto dest(n_dest_values.as_uint64_array());
-        typed_slice_array(n_src_values.as_uint64_array(), ids, dest);
-    }
-    else if(dt.is_char())
-    {
-        auto dest(n_dest_values.as_char_array());
-        typed_slice_array(n_src_values.as_char_array(), ids, dest);
-    }
-    else if(dt.is_short())
-    {
-        auto dest(n_dest_values.as_short_array());
-        typed_slice_array(n_src_values.as_short_array(), ids, dest);
-    }
-    else if(dt.is_int())
-    {
-        auto dest(n_dest_values.as_int_array());
-        typed_slice_array(n_src_values.as_int_array(), ids, dest);
-    }
-    else if(dt.is_long())
-    {
-        auto dest(n_dest_values.as_long_array());
-        typed_slice_array(n_src_values.as_long_array(), ids, dest);
-    }
-    else if(dt.is_unsigned_char())
-    {
-        auto dest(n_dest_values.as_unsigned_char_array());
-        typed_slice_array(n_src_values.as_unsigned_char_array(), ids, dest);
-    }
-    else if(dt.is_unsigned_short())
-    {
-        auto dest(n_dest_values.as_unsigned_short_array());
-        typed_slice_array(n_src_values.as_unsigned_short_array(), ids, dest);
-    }
-    else if(dt.is_unsigned_int())
-    {
-        auto dest(n_dest_values.as_unsigned_int_array());
-        typed_slice_array(n_src_values.as_unsigned_int_array(), ids, dest);
-    }
-    else if(dt.is_unsigned_long())
+    // Values are copied as raw bytes, so we dispatch on the element size
+    // once instead of on every type.
+    const uint8 *src = static_cast<const uint8 *>(n_src_values.element_ptr(0));
+    void *dest = n_dest_values.data_ptr();
+    const index_t stride = dt.stride();
+    switch(dt.element_bytes())
     {
-        auto dest(n_dest_values.as_unsigned_long_array());
-        typed_slice_array(n_src_values.as_unsigned_long_array(), ids, dest);
-    }
-    else if(dt.is_float())
+    case 1:
+        typed_slice_array(src, stride, ids, static_cast<uint8 *>(dest));
+        break;
+    case 2:
+        typed_slice_array(src, stride, ids, static_cast<uint16 *>(dest));
+        break;
+    case 4:
+        typed_slice_array(src, stride, ids, static_cast<uint32 *>(dest));
+        break;
+    case 8:
+        typed_slice_array(src, stride, ids, static_cast<uint64 *>(dest));
+        break;
+    default:
     {
-        auto dest(n_dest_values.as_float_array());
-        typed_slice_array(n_src_values.as_float_array(), ids, dest);
+        const index_t nbytes = dt.element_bytes();
+        uint8 *bdest = static_cast<uint8 *>(dest);
+        for(size_t i = 0; i < ids.size(); i++)
+            std::memcpy(bdest + i * nbytes, src + ids[i] * stride, nbytes);
+        break;
     }
-    else if(dt.is_double())
-    {
-        auto dest(n_dest_values.as_double_array());
-        typed_slice_array(n_src_values.as_double_array(), ids, dest);
     }
 }
 
@@ -3127,12 +4282,13 @@ Partitioner::extract(size_t idx, const conduit::Node &n_mesh, std::vector<index_
                 element_ids, vertex_ids, n_new_topos[n_topo.name()]);
         }
 
-        // Create new matsets
-        copy_matsets(n_topo.name(), element_ids, n_mesh, n_output);
-
-        // Create new fields.
+        // Create new fields, then new matsets, which add the matset_values
+        // of the fields on them. Matsets stay ahead of fields in the output.
+        if(n_mesh.has_child("matsets"))
+            n_output["matsets"];
         copy_fields(selections[idx]->get_domain(), n_topo.name(),
             vertex_ids, element_ids, n_mesh, n_output);
+        copy_matsets(n_topo.name(), element_ids, n_mesh, n_output);
 
         vertex_ids_out = std::move(vertex_ids);
     }
@@ -3201,28 +4357,18 @@ void
 Partitioner::create_new_explicit_coordset(const conduit::Node &n_coordset,
     const std::vector<index_t> &vertex_ids, conduit::Node &n_new_coordset) const
 {
-    conduit::Node n_explicit;
     n_new_coordset["type"] = "explicit";
-    if(n_coordset["type"].as_string() == "uniform")
+    if(n_coordset["type"].as_string() == "uniform" ||
+       n_coordset["type"].as_string() == "rectilinear")
     {
-        conduit::blueprint::mesh::coordset::uniform::to_explicit(n_coordset, n_explicit);
-
-        auto axes = conduit::blueprint::mesh::utils::coordset::axes(n_explicit);
-        const conduit::Node &n_values = n_explicit["values"];
-        conduit::Node &n_new_values = n_new_coordset["values"];
-        for(size_t i = 0; i < axes.size(); i++)
-        {
-            const conduit::Node &n_axis_values = n_values[axes[i]];
-            conduit::Node &n_new_axis_values = n_new_values[axes[i]];
-            slice_array(n_axis_values, vertex_ids, n_new_axis_values);
-        }
+        // Compute the coordinates of the selected vertices directly rather
+        // than converting the whole coordset to explicit first.
+        implicit_coordset_values(n_coordset, vertex_ids, n_new_coordset["values"]);
     }
-    else if(n_coordset["type"].as_string() == "rectilinear")
+    else if(n_coordset["type"].as_string() == "explicit")
     {
-        conduit::blueprint::mesh::coordset::rectilinear::to_explicit(n_coordset, n_explicit);
-
-        auto axes = conduit::blueprint::mesh::utils::coordset::axes(n_explicit);
-        const conduit::Node &n_values = n_explicit["values"];
+        auto axes = conduit::blueprint::mesh::utils::coordset::axes(n_coordset);
+        const conduit::Node &n_values = n_coordset["values"];
         conduit::Node &n_new_values = n_new_coordset["values"];
         for(size_t i = 0; i < axes.size(); i++)
         {
@@ -3231,16 +4377,31 @@ Partitioner::create_new_explicit_coordset(const conduit::Node &n_coordset,
             slice_array(n_axis_values, vertex_ids, n_new_axis_values);
         }
     }
-    else if(n_coordset["type"].as_string() == "explicit")
+}
+
+//---------------------------------------------------------------------------
+void
+Partitioner::implicit_coordset_values(const conduit::Node &n_coordset,
+    const std::vector<index_t> &vertex_ids, conduit::Node &n_new_values) const
+{
+    // Use the same type that the explicit conversion would produce.
+    const DataType float_dtype = conduit::blueprint::mesh::utils::find_widest_dtype(
+        n_coordset, conduit::blueprint::mesh::utils::DEFAULT_FLOAT_DTYPE);
+
+    auto axes = conduit::blueprint::mesh::utils::coordset::axes(n_coordset);
+    const conduit::blueprint::mesh::utils::coordset::CoordAccessor coords(n_coordset);
+    const index_t nids = static_cast<index_t>(vertex_ids.size());
+    for(index_t i = 0; i < coords.dims(); i++)
     {
-        auto axes = conduit::blueprint::mesh::utils::coordset::axes(n_coordset);
-        const conduit::Node &n_values = n_coordset["values"];
-        conduit::Node &n_new_values = n_new_coordset["values"];
-        for(size_t i = 0; i < axes.size(); i++)
+        conduit::Node &n_axis_values = n_new_values[axes[i]];
+        n_axis_values.set(DataType(float_dtype.id(), nids));
+        if(float_dtype.is_float32())
         {
-            const conduit::Node &n_axis_values = n_values[axes[i]];
-            conduit::Node &n_new_axis_values = n_new_values[axes[i]];
-            slice_array(n_axis_values, vertex_ids, n_new_axis_values);
+            coords.gather(i, vertex_ids.data(), nids, n_axis_values.as_float32_ptr());
+        }
+        else
+        {
+            coords.gather(i, vertex_ids.data(), nids, n_axis_values.as_float64_ptr());
         }
     }
 }
@@ -3325,28 +4486,70 @@ Partitioner::create_new_unstructured_topo(const conduit::Node &n_topo,
     const std::vector<index_t> &vertex_ids,
     conduit::Node &n_new_topo) const
 {
-    if(n_topo["type"].as_string() == "uniform")
+    if(n_topo["type"].as_string() == "uniform" ||
+       n_topo["type"].as_string() == "rectilinear" ||
+       n_topo["type"].as_string() == "structured")
     {
-        conduit::Node n_uns, cdest; // what is cdest?
-        conduit::blueprint::mesh::topology::uniform::to_unstructured(n_topo, n_uns, cdest);
-        unstructured_topo_from_unstructured(n_uns, csname, element_ids, vertex_ids, n_new_topo);
+        unstructured_topo_from_structured(n_topo, csname, element_ids, vertex_ids, n_new_topo);
     }
-    else if(n_topo["type"].as_string() == "rectilinear")
-    {
-        conduit::Node n_uns, cdest; // what is cdest?
-        conduit::blueprint::mesh::topology::rectilinear::to_unstructured(n_topo, n_uns, cdest);
-        unstructured_topo_from_unstructured(n_uns, csname, element_ids, vertex_ids, n_new_topo);
-    }
-    else if(n_topo["type"].as_string() == "structured")
+    else if(n_topo["type"].as_string() == "unstructured")
     {
-        conduit::Node n_uns, cdest; // what is cdest?
-        conduit::blueprint::mesh::topology::structured::to_unstructured(n_topo, n_uns, cdest);
-        unstructured_topo_from_unstructured(n_uns, csname, element_ids, vertex_ids, n_new_topo);
+        unstructured_topo_from_unstructured(n_topo, csname, element_ids, vertex_ids, n_new_topo);
     }
-    else if(n_topo["type"].as_string() == "unstructured")
+}
+
+//---------------------------------------------------------------------------
+void
+Partitioner::unstructured_topo_from_structured(const conduit::Node &n_topo,
+    const std::string &csname,
+    const std::vector<index_t> &element_ids,
+    const std::vector<index_t> &vertex_ids,
+    conduit::Node &n_new_topo) const
+{
+    n_new_topo["type"].set("unstructured");
+    n_new_topo["coordset"].set(csname);
+
+    std::map<index_t,index_t> old2new;
+    for(size_t i = 0; i < vertex_ids.size(); i++)
+        old2new[vertex_ids[i]] = static_cast<index_t>(i);
+
+    index_t edims[3] = {1,1,1}, dims[3] = {1,1,1};
+    auto ndims = topology::dims(n_topo);
+    conduit::blueprint::mesh::utils::topology::logical_dims(n_topo, edims, 3);
+    for(index_t d = 0; d < ndims; d++)
+        dims[d] = edims[d] + 1;
+
+    // Vertex order matches the one used by the unstructured conversion.
+    static const index_t offsets[8][3] = {
+        {0,0,0},
+        {1,0,0},
+        {1,1,0},
+        {0,1,0},
+        {0,0,1},
+        {1,0,1},
+        {1,1,1},
+        {0,1,1}
+    };
+    const index_t np = index_t(1) << ndims;
+    index_t cell_ijk[3] = {0,0,0}, pt_ijk[3] = {0,0,0}, ptid = 0;
+    std::vector<index_t> new_conn;
+    new_conn.reserve(element_ids.size() * np);
+    for(size_t j = 0; j < element_ids.size(); j++)
     {
-        unstructured_topo_from_unstructured(n_topo, csname, element_ids, vertex_ids, n_new_topo);
+        grid_id_to_ijk(element_ids[j], edims, cell_ijk);
+        for(index_t i = 0; i < np; i++)
+        {
+            pt_ijk[0] = cell_ijk[0] + offsets[i][0];
+            pt_ijk[1] = cell_ijk[1] + offsets[i][1];
+            pt_ijk[2] = cell_ijk[2] + offsets[i][2];
+            grid_ijk_to_id(pt_ijk, dims, ptid);
+            new_conn.push_back(old2new[ptid]);
+        }
     }
+
+    n_new_topo["elements/shape"].set(ndims == 1 ? "line" :
+                                     (ndims == 2 ? "quad" : "hex"));
+    n_new_topo["elements/connectivity"].set(new_conn);
 }
 
 //---------------------------------------------------------------------------
@@ -4261,6 +5464,8 @@ merge_chunked_adjsets(conduit::Node& dom_adjsets, const std::vector<int>& chunks
 void
 Partitioner::execute(conduit::Node &output)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("execute");
+
     // By this stage, we will have at least target selections spread across
     // the participating ranks. Now, we need to process the selections to
     // make chunks.
@@ -4273,6 +5478,36 @@ Partitioner::execute(conduit::Node &output)
     DomainToChunkMap domain_to_chunk_map;
     std::map<index_t, const conduit::Node*> domain_id_to_node;
 
+    // Extract the selections. They don't depend on one another, so they are
+    // extracted concurrently.
+    CONDUIT_ANNOTATE_MARK_BEGIN("extract");
+    const index_t nsel = (index_t)selections.size();
+    std::vector<conduit::Node *> extracted(selections.size(), nullptr);
+    std::vector<std::vector<index_t>> extracted_vert_ids(selections.size());
+    std::vector<unsigned char> whole(selections.size(), 0);
+    mesh::utils::detail::parallel_chunks(std::min(num_threads, nsel), nsel,
+        [&](index_t, index_t begin, index_t end)
+        {
+            for(index_t i = begin; i < end; i++)
+            {
+                whole[i] = selections[i]->get_whole(*meshes[i]) ? 1 : 0;
+                if(whole[i])
+                {
+                    // We had a selection that spanned the entire mesh so we'll take
+                    // the whole mesh rather than extracting. If we are using "mapping"
+                    // then we will be wrapping the mesh so we can add vertex and element
+                    // maps to it without changing the input mesh.
+                    if(mapping || meshes[i]->has_child("adjsets"))
+                        extracted[i] = wrap(i, *meshes[i]);
+                }
+                else
+                {
+                    extracted[i] = extract(i, *meshes[i], extracted_vert_ids[i]);
+                }
+            }
+        });
+    CONDUIT_ANNOTATE_MARK_END("extract");
+
     for(size_t i = 0; i < selections.size(); i++)
     {
         // Get destination rank, domain if the selection has any. If not, it
@@ -4283,17 +5518,13 @@ Partitioner::execute(conduit::Node &output)
         index_t sr = selections[i]->get_domain();
 
         domain_id_to_node[sr] = meshes[i];
-        if(selections[i]->get_whole(*meshes[i]))
+        if(whole[i])
         {
-            // We had a selection that spanned the entire mesh so we'll take
-            // the whole mesh rather than extracting. If we are using "mapping"
-            // then we will be wrapping the mesh so we can add vertex and element
-            // maps to it without changing the input mesh.
             const conduit::Node* assoc_aset = nullptr;
             conduit::Node* wrapped_adjset = nullptr;
-            if(mapping || meshes[i]->has_child("adjsets"))
+            if(extracted[i] != nullptr)
             {
-                conduit::Node *c = wrap(i, *meshes[i]);
+                conduit::Node *c = extracted[i];
                 chunks.push_back(Chunk(c, true, dr, dd));
                 assoc_aset = get_associated_topo_adjset(*meshes[i], selections[i]->get_topology());
                 if (assoc_aset)
@@ -4311,8 +5542,7 @@ Partitioner::execute(conduit::Node &output)
         }
         else
         {
-            std::vector<index_t> vert_ids;
-            conduit::Node *c = extract(i, *meshes[i], vert_ids);
+            conduit::Node *c = extracted[i];
             chunks.push_back(Chunk(c, true, dr, dd));
             const conduit::Node* assoc_aset
                 = get_associated_topo_adjset(*meshes[i], selections[i]->get_topology());
@@ -4325,7 +5555,7 @@ Partitioner::execute(conduit::Node &output)
             {
                 adjset_data.push_back(nullptr);
             }
-            domain_to_chunk_map[meshes[i]][i] = std::move(vert_ids);
+            domain_to_chunk_map[meshes[i]][i] = std::move(extracted_vert_ids[i]);
         }
     }
 
@@ -4334,79 +5564,143 @@ Partitioner::execute(conduit::Node &output)
     std::vector<int> dest_rank, dest_domain, offsets;
     map_chunks(chunks, dest_rank, dest_domain, offsets);
 
+    CONDUIT_ANNOTATE_MARK_BEGIN("adjsets");
     init_chunk_adjsets(chunk_assoc_aset, adjset_data);
     build_interdomain_adjsets(offsets, domain_to_chunk_map, domain_id_to_node, adjset_data);
     build_intradomain_adjsets(offsets, domain_to_chunk_map, adjset_data);
+    CONDUIT_ANNOTATE_MARK_END("adjsets");
 
-    // Communicate chunks to the right destination ranks
-    std::vector<Chunk> chunks_to_assemble;
-    std::vector<int> chunks_to_assemble_domains;
-    std::vector<int> chunks_to_assemble_gids;
-    communicate_chunks(chunks, dest_rank, dest_domain, offsets,
-        chunks_to_assemble,
-        chunks_to_assemble_domains,
-        chunks_to_assemble_gids);
-
-    // Now that we have all the parts we need in chunks_to_assemble, combine
-    // the chunks.
-    std::set<int> unique_doms;
-    for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
+    // The output domains this rank assembles and the number of chunks each
+    // one is made from. They are known before the chunks are communicated.
+    std::map<int, size_t> chunks_needed;
+    for(size_t i = 0; i < dest_rank.size(); i++)
     {
-        unique_doms.insert(chunks_to_assemble_domains[i]);
+        if(dest_rank[i] == rank)
+            chunks_needed[dest_domain[i]]++;
     }
 
 #ifdef CONDUIT_DEBUG_PARTITIONER
     std::cout << "unique_doms:\n";
-    for(auto dom = unique_doms.begin(); dom != unique_doms.end(); dom++)
-        std::cout << "  " << (int)*dom << "\n";
+    for(auto dom = chunks_needed.begin(); dom != chunks_needed.end(); dom++)
+        std::cout << "  " << dom->first << "\n";
     std::cout << std::endl;
 #endif
 
-    if(!chunks_to_assemble.empty())
+    // Make the output domains up front, so each one can be assembled as soon
+    // as its chunks are here.
+    std::vector<int> doms;
+    std::map<int, size_t> dom_index;
+    std::vector<conduit::Node *> new_doms;
+    if(!chunks_needed.empty())
     {
         output.reset();
-        for(auto dom = unique_doms.begin(); dom != unique_doms.end(); dom++)
+        for(const auto &cn : chunks_needed)
         {
-            // Get the chunks for this output domain.
-            std::vector<const Node *> this_dom_chunks;
-            std::vector<index_t> this_dom_cnkid;
-            for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
-            {
-                if(chunks_to_assemble_domains[i] == *dom)
-                {
-                    this_dom_chunks.push_back(chunks_to_assemble[i].mesh);
-                    this_dom_cnkid.push_back(chunks_to_assemble_gids[i]);
-                }
-            }
+            dom_index[cn.first] = doms.size();
+            doms.push_back(cn.first);
+        }
+        for(size_t di = 0; di < doms.size(); di++)
+        {
+            new_doms.push_back((doms.size() > 1) ? &(output.append()) : &output);
+        }
+    }
 
-            conduit::Node* new_dom;
-            if (unique_doms.size() > 1)
-            {
-                new_dom = &(output.append());
-            }
-            else
-            {
-                new_dom = &output;
-            }
-            if(this_dom_chunks.size() == 1)
-            {
-                new_dom->set(*this_dom_chunks[0]); // Could we transfer ownership if we own the chunk?
-                new_dom->set_path("state/domain_id", (int)*dom);
+    // Note which chunks were extracted here, which wrap arrays from the
+    // input, and which are the input, so single chunk domains can take
+    // over the chunk rather than copy it. Other chunks (received from or
+    // wrapped by a derived class) are copied since they may refer to
+    // chunks that are freed below.
+    std::set<const Node *> extracted_chunks, wrapped_chunks, input_chunks;
+    for(size_t i = 0; i < selections.size(); i++)
+    {
+        if(extracted[i] == nullptr)
+            input_chunks.insert(meshes[i]);
+        else if(whole[i])
+            wrapped_chunks.insert(extracted[i]);
+        else
+            extracted_chunks.insert(extracted[i]);
+    }
 
-                attach_chunk_adjset_to_single_dom(*new_dom, this_dom_cnkid[0]);
-            }
-            else if(this_dom_chunks.size() > 1)
-            {
-                // Combine the chunks for this domain and add to a list in output.
-                combine(*dom, this_dom_chunks, this_dom_cnkid, *new_dom);
-            }
+    // Communicate chunks to the right destination ranks. Each time some
+    // chunks are ready, the domains they complete are assembled concurrently
+    // while the other chunks are still in flight. When there are fewer
+    // domains than threads, the remaining threads are used to merge points
+    // within each domain.
+    std::vector<Chunk> chunks_to_assemble;
+    std::vector<int> chunks_to_assemble_domains;
+    std::vector<int> chunks_to_assemble_gids;
+    auto assemble_ready_domains = [&](const std::vector<size_t> &ready)
+    {
+        std::vector<size_t> ready_doms;
+        for(size_t ci : ready)
+        {
+            const int dom = chunks_to_assemble_domains[ci];
+            if(--chunks_needed[dom] == 0)
+                ready_doms.push_back(dom_index[dom]);
+        }
 
-            if (new_dom->has_child("adjsets"))
+        const index_t nready = (index_t)ready_doms.size();
+        const index_t dom_threads = std::min(num_threads, nready);
+        const index_t merge_threads = std::max((index_t)1, num_threads / std::max((index_t)1, dom_threads));
+        mesh::utils::detail::parallel_chunks(dom_threads, nready,
+            [&](index_t, index_t begin, index_t end)
             {
-                merge_chunked_adjsets((*new_dom)["adjsets"], dest_domain);
-            }
-        }
-    }
+                for(index_t ri = begin; ri < end; ri++)
+                {
+                    const size_t di = ready_doms[ri];
+                    const int dom = doms[di];
+                    // Get the chunks for this output domain.
+                    std::vector<const Node *> this_dom_chunks;
+                    std::vector<index_t> this_dom_cnkid;
+                    for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
+                    {
+                        if(chunks_to_assemble_domains[i] == dom)
+                        {
+                            this_dom_chunks.push_back(chunks_to_assemble[i].mesh);
+                            this_dom_cnkid.push_back(chunks_to_assemble_gids[i]);
+                        }
+                    }
+
+                    conduit::Node* new_dom = new_doms[di];
+                    if(this_dom_chunks.size() == 1)
+                    {
+                        // Extracted chunks are moved into the output. Chunks
+                        // that refer to the input are copied unless external
+                        // output was requested.
+                        const Node *chunk = this_dom_chunks[0];
+                        if(extracted_chunks.count(chunk) > 0 ||
+                           (external && wrapped_chunks.count(chunk) > 0))
+                            new_dom->move(*const_cast<Node *>(chunk));
+                        else if(external && input_chunks.count(chunk) > 0)
+                            new_dom->set_external(*chunk);
+                        else
+                            new_dom->set(*chunk);
+                        // The domain_id may be external so replace it
+                        // rather than write through to the input.
+                        if(new_dom->has_path("state/domain_id"))
+                            new_dom->remove("state/domain_id");
+                        new_dom->set_path("state/domain_id", dom);
+
+                        attach_chunk_adjset_to_single_dom(*new_dom, this_dom_cnkid[0]);
+                    }
+                    else if(this_dom_chunks.size() > 1)
+                    {
+                        // Combine the chunks for this domain and add to a list in output.
+                        combine(dom, this_dom_chunks, this_dom_cnkid, merge_threads, *new_dom);
+                    }
+
+                    if (new_dom->has_child("adjsets"))
+                    {
+                        merge_chunked_adjsets((*new_dom)["adjsets"], dest_domain);
+                    }
+                }
+            });
+    };
+    communicate_chunks(chunks, dest_rank, dest_domain, offsets,
+        chunks_to_assemble,
+        chunks_to_assemble_domains,
+        chunks_to_assemble_gids,
+        assemble_ready_domains);
 
     // Clean up
     for(size_t i = 0; i < chunks.size(); i++)
@@ -4616,17 +5910,21 @@ Partitioner::communicate_chunks(const std::vector<Partitioner::Chunk> &chunks,
     const std::vector<int> &/*offsets*/,
     std::vector<Partitioner::Chunk> &chunks_to_assemble,
     std::vector<int> &chunks_to_assemble_domains,
-    std::vector<int> &chunks_to_assemble_gids)
+    std::vector<int> &chunks_to_assemble_gids,
+    const ChunksReady &chunks_ready)
 {
     // In serial, communicating the chunks among ranks means passing them
     // back in the output arguments. We mark them as not-owned so we do not
     // double-free.
+    std::vector<size_t> ready;
     for(size_t i = 0; i < chunks.size(); i++)
     {
+        ready.push_back(chunks_to_assemble.size());
         chunks_to_assemble.push_back(Chunk(chunks[i].mesh, false));
         chunks_to_assemble_domains.push_back(dest_domain[i]);
         chunks_to_assemble_gids.push_back(i);
     }
+    chunks_ready(ready);
 }
 
 //-------------------------------------------------------------------------
@@ -4658,7 +5956,8 @@ class point_merge
 public:
     void execute(const std::vector<const conduit::Node *> &coordsets, 
                  double tolerance,
-                 Node &output);
+                 Node &output,
+                 index_t num_threads = 1);
 
 private:
     enum class coord_system
@@ -4690,20 +5989,25 @@ private:
     /**
     @brief Iterates the coordinates in the given coordinate set,
         invoking the given lambda function with the signature
-        void (float64 *point, index_t dim)
+        void (float64 *point, index_t dim). Only the points in
+        [begin, end) are visited when end >= 0.
     NOTE: It will always be valid to index the "point" as if its
         "dim" was 3. For example if the original data was only 2D then
         point[2] will be 0 and dim will be 2.
     */
     template<typename Func>
-    static void iterate_coordinates(const Node &coordset, Func &&func);
+    static void iterate_coordinates(const Node &coordset, Func &&func,
+        index_t begin = 0, index_t end = -1);
 
     /**
     @brief Determines how many points there are and reserves space in member vectors
         new_points and old_to_new_ids
+        If given, coordset_points receives the number of points in each
+        coordset.
     @return npoints*dimension
     */
-    index_t reserve_vectors(const std::vector<Node> &coordsets, index_t dimension);
+    index_t reserve_vectors(const std::vector<Node> &coordsets, index_t dimension,
+        std::vector<index_t> *coordset_points = nullptr);
 
     /**
     @brief The simple (slow) approach to merging the data based off distance.
@@ -4741,6 +6045,7 @@ private:
     static const std::vector<std::string> &get_axes_for_system(coord_system);
 
     coord_system out_system;
+    index_t num_threads{1};
 
     // Outputs
     std::vector<std::vector<index_t>> old_to_new_ids;
@@ -4754,7 +6059,7 @@ namespace utils
 {
 
 /**
- @brief A simple vector struct to be used by the kdtree
+ @brief A simple vector struct
 */
 template<typename T, size_t Size>
 struct vector
@@ -4887,394 +6192,47 @@ public:
     {
         return std::sqrt(distance2(other));
     }
-};
-
-//-----------------------------------------------------------------------------
-/**
- @brief A simple bounding box struct to be used by the kdtree
-*/
-template<typename VectorType>
-struct bounding_box
-{
-    using value_type = typename VectorType::value_type;
-    using data_type = typename VectorType::data_type;
-    using T = value_type;
-    VectorType min;
-    VectorType max;
-
-    bool contains(const VectorType &point) const
-    {
-        return (point >= min && point <= max);
-    }
-
-    bool contains(const VectorType &point, double tolerance) const
-    {
-        return (point >= (min - tolerance) && point <= (max + tolerance));
-    }
-
-    void expand(const VectorType &point)
-    {
-        for(size_t i = 0u; i < min.size(); i++)
-        {
-            min[i] = std::min(min[i], point[i]);
-            max[i] = std::max(max[i], point[i]);
-        }
-    }
-};
-
-//-----------------------------------------------------------------------------
-using vec2f = vector<float,2>;
-using vec3f = vector<float,3>;
-using vec2  = vector<double,2>;
-using vec3  = vector<double,3>;
-
-/**
- @brief A spatial search structure used to merge points within a given tolerance
-*/
-template<typename VectorType, typename DataType>
-class kdtree
-{
-private:
-    using Float = typename VectorType::value_type;
-    // using IndexType = conduit_index_t;
-public:
-    constexpr static auto dimension = std::tuple_size<typename VectorType::data_type>::value;
-    using vector_type = VectorType;
-    using data_type = DataType;
-    using IndexType = size_t;
-
-    template<typename Precision, size_t D>
-    struct kdnode
-    {
-        using node = kdnode<Precision, D>;
-        std::vector<VectorType> points;
-        std::vector<DataType> data;
-        bounding_box<VectorType> bb;
-        node *left{nullptr};
-        node *right{nullptr};
-        Float split{0.0};
-        unsigned int dim;
-        bool has_split{false};
-    };
-    using node = kdnode<Float, dimension>;
-    using pair = std::pair<std::pair<node*,DataType&>, bool>;
-
-    kdtree() = default;
-    ~kdtree()
-    {
-        const auto lambda = [](node *node, unsigned int)
-        {
-            delete node;
-        };
-        if(root) { traverse_lrn(lambda, root); }
-    }
-
-    /**
-    @brief Searches the tree for the given point using
-            tolerance as an acceptable distance to merge like-points.
-    */
-    DataType *find_point(const VectorType &point, Float tolerance)
-    {
-        DataType *retval = nullptr;
-        if(!root)
-        {
-            retval = nullptr;
-        }
-        else if(root->bb.contains(point, tolerance))
-        {
-            retval = find_point(root, 0, point, tolerance);
-        }
-        return retval;
-    }
-
-    void insert(const VectorType &point, const DataType &r)
-    {
-        scratch.reserve(point_vec_size*2);
-        if(!root)
-        {
-            root = create_node(point, r);
-            npoints++;
-        }
-        else
-        {
-            insert(root, 0, point, r);
-        }
-    }
-
-    IndexType size()  const { return npoints; }
-    IndexType nodes() const { return nnodes; }
-    IndexType depth() const { return tree_depth; }
-
-    void set_bucket_size(IndexType n) { point_vec_size = n; }
-    IndexType get_bucket_size() const { return point_vec_size; }
-
-    template<typename Func>
-    void iterate_points(Func &&func)
-    {
-        IndexType point_id = 0u;
-        const auto lambda = [&](node *n, unsigned int) {
-            for(IndexType i = 0u; i < n->points.size(); i++)
-            {
-                func(point_id, n->points[i], n->data[i]);
-                point_id++;
-            }
-        };
-        if(root) { traverse_lnr(lambda, root); }
-    }
-
-    template<typename Func>
-    void traverse_nodes(Func &&func)
-    {
-        if(root) { traverse_lnr(func, root); }
-    }
-
-private:
-    // Create an empty node
-    node *create_node()
-    {
-        node *newnode = new node;
-        newnode->points.reserve(point_vec_size);
-        newnode->data.reserve(point_vec_size);
-        for(size_t i = 0; i < newnode->bb.min.size(); i++)
-            newnode->bb.min[i] = std::numeric_limits<Float>::max();
-        for(size_t i = 0; i < newnode->bb.max.size(); i++)
-            newnode->bb.max[i] = std::numeric_limits<Float>::lowest();
-        newnode->left = nullptr;
-        newnode->right = nullptr;
-        newnode->split = 0;
-        newnode->dim = 0;
-        newnode->has_split = false;
-        nnodes++;
-        return newnode;
-    }
-
-    // Create a node with initial values inserted
-    node *create_node(VectorType loc, const DataType &r)
-    {
-        node *newnode = create_node();
-        node_add_data(newnode, loc, r);
-        return newnode;
-    }
-
-    static void node_add_data(node *n, const VectorType &p, const DataType &d)
-    {
-        n->bb.expand(p);
-        n->points.push_back(p);
-        n->data.push_back(d);
-    }
-
-    /**
-    @brief Splits the given node and inserts point/data into the proper child
-    */
-    void node_split(node *n, const VectorType &point, const DataType &data)
-    {
-        // Determine which dim to split on
-        IndexType dim = 0;
-        {
-            Float longest_dim = std::numeric_limits<Float>::lowest();
-            for(IndexType i = 0; i < n->bb.min.size(); i++)
-            {
-                const Float dim_len = n->bb.max[i] - n->bb.min[i];
-                if(longest_dim < dim_len)
-                {
-                    dim = i;
-                    longest_dim = dim_len;
-                }
-            }
-            n->dim = dim;
-        }
-
-        // Determine what value on the dim to split on
-        {
-            scratch.clear();
-            for(IndexType i = 0; i < point_vec_size; i++)
-            {
-                scratch.push_back(i);
-            }
-            std::sort(scratch.begin(), scratch.end(), [=](IndexType i0, IndexType i1) {
-                return n->points[i0][dim] < n->points[i1][dim];
-            });
-
-            // If the index stored in scratch is point_vec_size
-            const IndexType scratch_idx = scratch.size() / 2;
-            const IndexType median_idx = scratch[scratch_idx];
-            Float median = n->points[median_idx][dim];
-            // Check if the new point is our actual median
-            if(point[dim] > n->points[scratch[scratch_idx-1]][dim] && point[dim] < median)
-            {
-                median = point[dim];
-            }
-
-            n->split = median;
-            n->left = create_node();
-            n->right = create_node();
-            n->has_split = true;
-
-            for(IndexType i = 0; i < point_vec_size; i++)
-            {
-                const Float temp = n->points[i][dim];
-                if(temp < median)
-                {
-                    node_add_data(n->left, n->points[i], n->data[i]);
-                }
-                else
-                {
-                    node_add_data(n->right, n->points[i], n->data[i]);
-                }
-            }
-
-            if(point[dim] < median)
-            {
-                node_add_data(n->left, point, data);
-            }
-            else
-            {
-                node_add_data(n->right, point, data);
-            }
-
-            // Clear the data from the parent node
-            std::vector<VectorType>{}.swap(n->points);
-            std::vector<DataType>{}.swap(n->data);
-        }
-    }
-
-    DataType *find_point(node *current, unsigned int depth, const VectorType &point, Float tolerance)
-    {
-        // If we got here we know that the point was in this node's bounding box
-        DataType *retval = nullptr;
-
-        // This node has children
-        if(current->has_split)
-        {
-            const bool left_contains = current->left->bb.contains(point, tolerance);
-            const bool right_contains = current->right->bb.contains(point, tolerance);
-            if(!left_contains && !right_contains)
-            {
-                // ERROR! This shouldn't happen, the tree must've been built improperly
-                retval = nullptr;
-            }
-            else if(left_contains)
-            {
-                // Traverse left
-                retval = find_point(current->left, depth+1, point, tolerance);
-            }
-            else if(right_contains)
-            {
-                // Traverse right
-                retval = find_point(current->right, depth+1, point, tolerance);
-            }
-            else // (left_contains && right_contains)
-            {
-                // Rare, but possible due to tolerance.
-                // Check if the left side has the point without tolerance
-                const bool pref_left = current->left->bb.contains(point);
-                retval = (pref_left)
-                    ? find_point(current->left, depth+1, point, tolerance)
-                    : find_point(current->right, depth+1, point, tolerance);
-                // We tried the preferred side but it didn't contain the point
-                if(retval == nullptr)
-                {
-                    retval = (pref_left)
-                        ? find_point(current->right, depth+1, point, tolerance)
-                        : find_point(current->left, depth+1, point, tolerance);
-                }
-            }
-        }
-        else
-        {
-            // This is a leaf node.
-            const auto t2 = tolerance * tolerance;
-            const IndexType N = current->points.size();
-            IndexType idx = 0;
-            for(idx = 0; idx < N; idx++)
-            {
-                const auto &p = current->points[idx];
-                const auto dist2 = point.distance2(p);
-                if(dist2 <= t2)
-                {
-                    break;
-                }
-            }
-
-            // Did not find point
-            if(idx == N)
-            {
-                retval = nullptr;
-            }
-            else
-            {
-                retval = &current->data[idx];
-            }
-        }
-        return retval;
-    }
-
-    void insert(node *current, unsigned int depth, const VectorType &loc, const DataType &r)
-    {
-        // No matter what we need to add this point to the current bounding box
-        current->bb.expand(loc);
-
-        // This node has children
-        if(current->has_split)
-        {
-            const auto dim = current->dim;
-            if(loc[dim] < current->split)
-            {
-                // Go left
-                insert(current->left, depth+1, loc, r);
-            }
-            else // (loc[dim] >= current->split)
-            {
-                // Go right
-                insert(current->right, depth+1, loc, r);
-            }
-        }
-        else
-        {
-            // This is a leaf node
-            // Determine if the node needs to be split
-            if((current->points.size()) == point_vec_size)
-            {
-                // This will add the point and data to the correct child
-                node_split(current, loc, r);
-                tree_depth = std::max(tree_depth, (IndexType)depth+1);
-                npoints++;
-            }
-            else
-            {
-                // This node does not need to be split
-                node_add_data(current, loc, r);
-                npoints++;
-            }
-        }
-    }
+};
 
-    template<typename Func>
-    void traverse_lnr(Func &&func, node *node, unsigned int depth = 0)
+//-----------------------------------------------------------------------------
+/**
+ @brief A simple bounding box struct
+*/
+template<typename VectorType>
+struct bounding_box
+{
+    using value_type = typename VectorType::value_type;
+    using data_type = typename VectorType::data_type;
+    using T = value_type;
+    VectorType min;
+    VectorType max;
+
+    bool contains(const VectorType &point) const
     {
-        if(node->left) { traverse_lnr(func, node->left, depth + 1); }
-        func(node, depth);
-        if(node->right) { traverse_lnr(func, node->right, depth + 1); }
+        return (point >= min && point <= max);
     }
 
-    template<typename Func>
-    void traverse_lrn(Func &&func, node *node, unsigned int depth = 0)
+    bool contains(const VectorType &point, double tolerance) const
     {
-        if(node->left) { traverse_lrn(func, node->left, depth + 1); }
-        if(node->right) { traverse_lrn(func, node->right, depth + 1); }
-        func(node, depth);
+        return (point >= (min - tolerance) && point <= (max + tolerance));
     }
 
-    // Keep track of tree performance
-    IndexType npoints{0u};
-    IndexType nnodes{0u};
-    IndexType tree_depth{0u};
-
-    node *root{nullptr};
-    IndexType point_vec_size{32};
-    std::vector<IndexType> scratch;
+    void expand(const VectorType &point)
+    {
+        for(size_t i = 0u; i < min.size(); i++)
+        {
+            min[i] = std::min(min[i], point[i]);
+            max[i] = std::max(max[i], point[i]);
+        }
+    }
 };
 
+//-----------------------------------------------------------------------------
+using vec2f = vector<float,2>;
+using vec3f = vector<float,3>;
+using vec2  = vector<double,2>;
+using vec3  = vector<double,3>;
+
 //-----------------------------------------------------------------------------
 using combine_implicit_data_t = std::pair<const Node*, bounding_box<vec3>>;
 
@@ -5517,8 +6475,10 @@ find_rectilinear_offset(const DataArray_t &da, T val, double tolerance = CONDUIT
 void
 point_merge::execute(const std::vector<const Node *> &coordsets,
                      double tolerance,
-                     Node &output)
+                     Node &output,
+                     index_t num_threads)
 {
+    this->num_threads = num_threads;
     if(coordsets.empty())
         return;
 
@@ -5584,20 +6544,10 @@ point_merge::execute(const std::vector<const Node *> &coordsets,
             systems.push_back(coord_system::cartesian);
         }
 
-        // We only work on explicit sets
+        // Implicit sets are read through a CoordAccessor, so no set needs
+        // to be made explicit (or copied)
         working_sets.emplace_back();
-        if(type == "uniform")
-        {
-            mesh::coordset::uniform::to_explicit(*cset, working_sets.back());
-        }
-        else if(type == "rectilinear")
-        {
-            mesh::coordset::rectilinear::to_explicit(*cset, working_sets.back());
-        }
-        else // type == "explicit"
-        {
-            working_sets.back() = *cset;
-        }
+        working_sets.back().set_external(*cset);
     }
 
     // Determine best output coordinate system
@@ -5765,22 +6715,13 @@ point_merge::create_output(index_t dimension, Node &output) const
             s[axes[i]].set(DataType::float64(npoints,i*size,stride));
         }
 
-        // Copy out coordinate values
+        // Copy out coordinate values. The axes are interleaved just like
+        // new_coords, so this is a single copy.
         values.set(s);
-        float64_array coord_arrays[3];
-        for(auto i = 0; i < dimension; i++)
-        {
-            coord_arrays[i] = values[axes[i]].value();
-        }
-
-        index_t point_id = 0;
-        for(auto itr = new_coords.begin(); itr != new_coords.end();)
+        if(!new_coords.empty())
         {
-            for(auto d = 0; d < dimension; d++)
-            {
-                coord_arrays[d][point_id] = *itr++;
-            }
-            point_id++;
+            std::memcpy(values[axes[0]].element_ptr(0), new_coords.data(),
+                new_coords.size() * sizeof(float64));
         }
     }
 
@@ -5801,10 +6742,9 @@ point_merge::create_output(index_t dimension, Node &output) const
             auto &ids = pointmaps.append();
             ids.set(DataType::index_t(size));
             // Copy the contents into the node
-            DataArray<index_t> ids_data = ids.value();
-            for(size_t i = 0u; i < size; i++)
+            if(size > 0)
             {
-                ids_data[i] = idmap[i];
+                std::memcpy(ids.data_ptr(), idmap.data(), size * sizeof(index_t));
             }
         }
     }
@@ -5813,7 +6753,8 @@ point_merge::create_output(index_t dimension, Node &output) const
 //-----------------------------------------------------------------------------
 template<typename Func>
 void
-point_merge::iterate_coordinates(const Node &coordset, Func &&func)
+point_merge::iterate_coordinates(const Node &coordset, Func &&func,
+    index_t begin, index_t end)
 {
     if(!coordset.has_child("type"))
     {
@@ -5821,118 +6762,93 @@ point_merge::iterate_coordinates(const Node &coordset, Func &&func)
         return;
     }
 
-    if(coordset["type"].as_string() != "explicit")
-    {
-        CONDUIT_ERROR("Coordset is not explicit");
-        return;
-    }
-
-    if(!coordset.has_child("values"))
-    {
-        CONDUIT_ERROR("Coordset does not have values");
-        return;
-    }
-
-    const Node &coords = coordset["values"];
-
-    // Fetch the nodes for the coordinate values
-    const Node *xnode = coords.fetch_ptr("x");
-    const Node *ynode = nullptr, *znode = nullptr;
-    if(xnode)
+    // Pick the named axes that make up a point, in the order the merge
+    // expects them
+    const std::vector<std::string> cset_axes = mesh::utils::coordset::axes(coordset);
+    const auto has_axis = [&](const std::string &name) -> bool {
+        return std::find(cset_axes.begin(), cset_axes.end(), name) != cset_axes.end();
+    };
+    std::vector<std::string> point_axes;
+    if(has_axis("x"))
     {
         // Cartesian
-        ynode = coords.fetch_ptr("y");
-        znode = coords.fetch_ptr("z");
+        point_axes = {"x", "y", "z"};
     }
-    else if((xnode = coords.fetch_ptr("r")))
+    else if(has_axis("r"))
     {
-        if((ynode = coords.fetch_ptr("z")))
+        if(has_axis("z"))
         {
             // Cylindrical
+            point_axes = {"r", "z"};
         }
-        else if((ynode = coords.fetch_ptr("theta")))
+        else if(has_axis("theta"))
         {
             // Spherical
-            znode = coords.fetch_ptr("phi");
+            point_axes = {"r", "theta", "phi"};
+        }
+        else
+        {
+            point_axes = {"r"};
         }
     }
-    else if(((xnode = coords.fetch_ptr("i"))))
+    else if(has_axis("i"))
     {
         // Logical
-        ynode = coords.fetch_ptr("j");
-        znode = coords.fetch_ptr("k");
+        point_axes = {"i", "j", "k"};
     }
 
-    // Iterate accordingly
-    float64 p[3] {0., 0., 0.};
-    if(xnode && ynode && znode)
+    // A point has the leading axes that are present
+    index_t point_axis_ids[3] = {0, 0, 0};
+    index_t dim = 0;
+    for(const std::string &name : point_axes)
     {
-        // 3D
-        auto xarray = xnode->as_float64_accessor();
-        auto yarray = ynode->as_float64_accessor();
-        auto zarray = znode->as_float64_accessor();
-        const index_t N = xarray.number_of_elements();
-        for(index_t i = 0; i < N; i++)
+        const auto itr = std::find(cset_axes.begin(), cset_axes.end(), name);
+        if(itr == cset_axes.end())
         {
-            p[0] = xarray[i]; p[1] = yarray[i]; p[2] = zarray[i];
-            func(p, 3);
+            break;
         }
+        point_axis_ids[dim++] = (index_t)(itr - cset_axes.begin());
     }
-    else if(xnode && ynode)
+
+    if(dim == 0)
     {
-        // 2D
-        auto xarray = xnode->as_float64_accessor();
-        auto yarray = ynode->as_float64_accessor();
-        const index_t N = xarray.number_of_elements();
-        for(index_t i = 0; i < N; i++)
-        {
-            p[0] = xarray[i]; p[1] = yarray[i]; p[2] = 0.;
-            func(p, 2);
-        }
+        CONDUIT_ERROR("No valid node values found.");
+        return;
     }
-    else if(xnode)
+
+    // Iterate accordingly
+    const mesh::utils::coordset::CoordAccessor coords(coordset);
+    const index_t N = (end < 0) ? coords.size() : std::min(end, coords.size());
+    float64 p[3] {0., 0., 0.};
+    for(index_t i = begin; i < N; i++)
     {
-        // 1D
-        auto xarray = xnode->as_float64_accessor();
-        const index_t N = xarray.number_of_elements();
-        for(index_t i = 0; i < N; i++)
+        for(index_t d = 0; d < dim; d++)
         {
-            p[0] = xarray[i]; p[1] = 0.; p[2] = 0.;
-            func(p, 1);
+            p[d] = coords.axis(point_axis_ids[d])[i];
         }
-    }
-    else
-    {
-        CONDUIT_ERROR("No valid node values found.");
+        for(index_t d = dim; d < 3; d++)
+        {
+            p[d] = 0.;
+        }
+        func(p, dim);
     }
 }
 
 //-----------------------------------------------------------------------------
 index_t
-point_merge::reserve_vectors(const std::vector<Node> &coordsets, index_t dimension)
+point_merge::reserve_vectors(const std::vector<Node> &coordsets, index_t dimension,
+    std::vector<index_t> *coordset_points)
 {
     old_to_new_ids.reserve(coordsets.size());
+    if(coordset_points)
+        coordset_points->clear();
     index_t new_size = 0;
     for(size_t i = 0u; i < coordsets.size(); i++)
     {
-        const Node *values = coordsets[i].fetch_ptr("values");
         index_t npts = 0;
-        if(values)
+        if(coordsets[i].has_child("type"))
         {
-            const Node *xnode = values->fetch_ptr("x");
-            if(!xnode)
-            {
-                xnode = values->fetch_ptr("r");
-            }
-            if(!xnode)
-            {
-                xnode = values->fetch_ptr("i");
-            }
-
-            if(xnode)
-            {
-                npts = xnode->dtype().number_of_elements();
-            }
+            npts = mesh::utils::coordset::length(coordsets[i]);
         #ifdef DEBUG_POINT_MERGE
             std::cout << "coordset " << i << " ";
             std::cout << npts << std::endl;
@@ -5942,6 +6858,8 @@ point_merge::reserve_vectors(const std::vector<Node> &coordsets, index_t dimensi
 
         old_to_new_ids.push_back({});
         old_to_new_ids.back().reserve(npts);
+        if(coordset_points)
+            coordset_points->push_back(npts);
         new_size += npts*dimension;
     }
     new_coords.reserve(new_size);
@@ -6018,57 +6936,176 @@ point_merge::spatial_search_merge(const std::vector<Node> &coordsets,
         double tolerance)
 {
     PM_DEBUG_PRINT("Spatial search merging!" << std::endl);
-    reserve_vectors(coordsets, dimension);
+    std::vector<index_t> coordset_points;
+    reserve_vectors(coordsets, dimension, &coordset_points);
 
-    using namespace utils;
-    kdtree<vec3, index_t> point_records;
-    point_records.set_bucket_size(32);
+    // Gather all of the (cartesian) points, splitting each coordset into
+    // chunks of points that are gathered concurrently.
+    std::vector<index_t> coordset_offsets(1, 0);
     for(size_t i = 0u; i < coordsets.size(); i++)
     {
-        const auto &coordset = coordsets[i];
+        coordset_offsets.push_back(coordset_offsets.back() +
+            coordset_points[i]);
+    }
+    const index_t npts = coordset_offsets.back();
 
-        // To be invoked on every coordinate
-        const auto merge = [&](float64 *p, index_t) {
-            vec3 key;
-            key.v[0] = p[0]; key.v[1] = p[1]; key.v[2] = p[2];
-            const auto potential_id = new_coords.size() / dimension;
-            const index_t *existing_id = point_records.find_point(key, tolerance);
-            // Point wasn't already in the tree, insert it
-            if(!existing_id)
-            {
-                old_to_new_ids[i].push_back(potential_id);
-                for(index_t d = 0; d < dimension; d++)
+    static const index_t MIN_CHUNK = 4096;
+    std::vector<std::pair<size_t, std::pair<index_t, index_t>>> gather_chunks;
+    for(size_t i = 0u; i < coordsets.size(); i++)
+    {
+        const index_t n = coordset_offsets[i + 1] - coordset_offsets[i];
+        const index_t nchunks = mesh::utils::detail::parallel_num_chunks(num_threads, n, MIN_CHUNK);
+        for(index_t ci = 0; ci < nchunks; ci++)
+        {
+            gather_chunks.push_back(std::make_pair(i,
+                std::make_pair(ci * n / nchunks, (ci + 1) * n / nchunks)));
+        }
+    }
+
+    std::vector<float64> points(npts * 3);
+    const index_t ngather = (index_t)gather_chunks.size();
+    mesh::utils::detail::parallel_chunks(std::min(num_threads, ngather), ngather,
+        [&](index_t, index_t begin, index_t end)
+        {
+            for(index_t gi = begin; gi < end; gi++)
+            {
+                const size_t i = gather_chunks[gi].first;
+                const index_t first = gather_chunks[gi].second.first;
+                float64 *dest = &points[(coordset_offsets[i] + first) * 3];
+                const auto gather = [&](float64 *p, index_t) {
+                    *dest++ = p[0]; *dest++ = p[1]; *dest++ = p[2];
+                };
+
+                const auto translate_gather = [&](float64 *p, index_t d) {
+                    translate_system(systems[i], coord_system::cartesian,
+                        p[0], p[1], p[2], p[0], p[1], p[2]);
+                    gather(p, d);
+                };
+
+                if(systems[i] != coord_system::cartesian
+                    && systems[i] != coord_system::logical)
                 {
-                    new_coords.push_back(p[d]);
+                    iterate_coordinates(coordsets[i], translate_gather,
+                        first, gather_chunks[gi].second.second);
+                }
+                else
+                {
+                    iterate_coordinates(coordsets[i], gather,
+                        first, gather_chunks[gi].second.second);
                 }
-                // Store the point in the tree so we can look it up later
-                point_records.insert(key, potential_id);
             }
-            else
+        });
+
+    mesh::utils::kdtree<float64, 3> point_records;
+    point_records.set_bucket_size(32);
+    point_records.build(points.data(), npts, num_threads);
+
+    // Find the earlier points within tolerance of each point. Most points
+    // have none, so only the points that do are recorded.
+    const index_t nchunks = mesh::utils::detail::parallel_num_chunks(num_threads, npts, MIN_CHUNK);
+    std::vector<std::vector<index_t>> chunk_points(nchunks), chunk_offsets(nchunks),
+        chunk_neighbors(nchunks);
+    mesh::utils::detail::parallel_chunks(nchunks, npts,
+        [&](index_t ci, index_t begin, index_t end)
+        {
+            std::vector<index_t> neighbors;
+            for(index_t pi = begin; pi < end; pi++)
             {
-                // Point already existed in the tree, reference the known id
-                old_to_new_ids[i].push_back(*existing_id);
+                point_records.find_points(&points[pi * 3], tolerance, neighbors);
+                const auto last = std::lower_bound(neighbors.begin(), neighbors.end(), pi);
+                if(last != neighbors.begin())
+                {
+                    chunk_points[ci].push_back(pi);
+                    chunk_offsets[ci].push_back((index_t)chunk_neighbors[ci].size());
+                    chunk_neighbors[ci].insert(chunk_neighbors[ci].end(), neighbors.begin(), last);
+                }
             }
-        };
-
-        const auto translate_merge = [&](float64 *p, index_t d) {
-            translate_system(systems[i], coord_system::cartesian,
-                p[0], p[1], p[2], p[0], p[1], p[2]);
-            merge(p, d);
-        };
+            chunk_offsets[ci].push_back((index_t)chunk_neighbors[ci].size());
+        });
 
-        // Invoke the proper lambda on each coordinate
-        if(systems[i] != coord_system::cartesian
-            && systems[i] != coord_system::logical)
+    // A point starts a new id unless one of the earlier points within
+    // tolerance did. In that case it takes the id of the first such point.
+    // Only the points with earlier neighbors need to be visited (in order).
+    std::vector<index_t> source(npts);
+    mesh::utils::detail::parallel_chunks(nchunks, npts,
+        [&](index_t, index_t begin, index_t end)
         {
-            iterate_coordinates(coordset, translate_merge);
-        }
-        else
+            for(index_t pi = begin; pi < end; pi++)
+            {
+                source[pi] = pi;
+            }
+        });
+    for(index_t ci = 0; ci < nchunks; ci++)
+    {
+        for(size_t cpi = 0; cpi < chunk_points[ci].size(); cpi++)
         {
-            iterate_coordinates(coordset, merge);
+            const index_t pi = chunk_points[ci][cpi];
+            for(index_t ni = chunk_offsets[ci][cpi]; ni < chunk_offsets[ci][cpi + 1]; ni++)
+            {
+                const index_t neighbor = chunk_neighbors[ci][ni];
+                if(source[neighbor] == neighbor)
+                {
+                    source[pi] = neighbor;
+                    break;
+                }
+            }
         }
     }
 
+    // Number the points that start new ids in point order.
+    std::vector<index_t> chunk_new(nchunks + 1, 0);
+    mesh::utils::detail::parallel_chunks(nchunks, npts,
+        [&](index_t ci, index_t begin, index_t end)
+        {
+            index_t count = 0;
+            for(index_t pi = begin; pi < end; pi++)
+            {
+                count += (source[pi] == pi) ? 1 : 0;
+            }
+            chunk_new[ci + 1] = count;
+        });
+    for(index_t ci = 0; ci < nchunks; ci++)
+    {
+        chunk_new[ci + 1] += chunk_new[ci];
+    }
+
+    std::vector<index_t> new_ids(npts);
+    new_coords.resize(chunk_new[nchunks] * dimension);
+    mesh::utils::detail::parallel_chunks(nchunks, npts,
+        [&](index_t ci, index_t begin, index_t end)
+        {
+            index_t next_id = chunk_new[ci];
+            for(index_t pi = begin; pi < end; pi++)
+            {
+                if(source[pi] == pi)
+                {
+                    for(index_t d = 0; d < dimension; d++)
+                    {
+                        new_coords[next_id * dimension + d] = points[pi * 3 + d];
+                    }
+                    new_ids[pi] = next_id++;
+                }
+            }
+        });
+    // Sources come before the points that use them, but may be in other chunks.
+    mesh::utils::detail::parallel_chunks(nchunks, npts,
+        [&](index_t, index_t begin, index_t end)
+        {
+            for(index_t pi = begin; pi < end; pi++)
+            {
+                if(source[pi] != pi)
+                {
+                    new_ids[pi] = new_ids[source[pi]];
+                }
+            }
+        });
+
+    for(size_t i = 0u; i < coordsets.size(); i++)
+    {
+        old_to_new_ids[i].assign(new_ids.begin() + coordset_offsets[i],
+                                 new_ids.begin() + coordset_offsets[i + 1]);
+    }
+
     PM_DEBUG_PRINT("Number of points in tree " << point_records.size()
         << ", depth of tree " << point_records.depth()
         << ", nodes in tree " << point_records.nodes() << std::endl);
@@ -7991,9 +9028,7 @@ private:
                         }
 
                         // Convenience
-                        using mesh::coordset::utils::kdtree;
-                        using mesh::coordset::utils::vec3;
-                        using mesh::coordset::utils::vec2;
+                        using point_tree = mesh::utils::kdtree<float64, MAXDIM>;
                         const Node &n_cset_lhs = n_lhs->fetch_existing(cset_path);
                         const Node &n_topo_lhs = n_lhs->fetch_existing(topo_path);
                         const Node &n_cset_rhs = n_rhs->fetch_existing(cset_path);
@@ -8035,8 +9070,8 @@ private:
                         if(dimension == 3)
                         {
                             // Build the tree with all the points from the lhs face
-                            kdtree<mesh::coordset::utils::vec3, index_t> verts;
-                            vec3 temp;
+                            point_tree verts;
+                            std::vector<float64> face_points;
                             index_t idx;
 
                             // TODO: Sort "other_dims" in ascending order for better memory traversal
@@ -8052,17 +9087,17 @@ private:
                                     for(index_t di = 0; di < dimension; di++)
                                     {
                                         n_temp.set_external(dts_lhs[di], const_cast<void*>(vals_lhs[di]->element_ptr(idx)));
-                                        temp[di] = n_temp.to_double();
+                                        face_points.push_back(n_temp.to_double());
                                     }
-                                    verts.insert(temp, idx);
                                 }
                             }
+                            verts.build(face_points.data(), (index_t)face_points.size() / MAXDIM);
+                            face_points.clear();
 
                             // Check all the points in the tree against the points from the rhs face
                             // TODO: Sort "other_dims" in ascending order for better memory traversal
                             determine_matched_dim(rhs_face, other_dims.data());
                             idx_for_matched_dim(rhs_face, dims_rhs.data(), ijk.data());
-                            index_t *existing_idx = nullptr;
                             for(index_t j = 0; j < dims_rhs[other_dims[1]]; j++)
                             {
                                 ijk[other_dims[1]] = j;
@@ -8073,23 +9108,25 @@ private:
                                     for(index_t di = 0; di < dimension; di++)
                                     {
                                         n_temp.set_external(dts_rhs[di], const_cast<void*>(vals_rhs[di]->element_ptr(idx)));
-                                        temp[di] = n_temp.to_double();
-                                    }
-                                    existing_idx = verts.find_point(temp, tolerance);
-                                    if(!existing_idx)
-                                    {
-                                        // If we couldn't match this face then we can't combine as structured.
-                                        CONDUIT_INFO("Face definition does not match.");
-                                        return false;
+                                        face_points.push_back(n_temp.to_double());
                                     }
                                 }
                             }
+                            const index_t nface_points = (index_t)face_points.size() / MAXDIM;
+                            std::vector<index_t> existing_idx(nface_points);
+                            verts.find_point(face_points.data(), nface_points, tolerance, existing_idx.data());
+                            if(std::find(existing_idx.begin(), existing_idx.end(), point_tree::NOT_FOUND) != existing_idx.end())
+                            {
+                                // If we couldn't match this face then we can't combine as structured.
+                                CONDUIT_INFO("Face definition does not match.");
+                                return false;
+                            }
                         }
                         else if(dimension == 2)
                         {
                             // Build the tree with all the points from the lhs face
-                            kdtree<mesh::coordset::utils::vec2, index_t> verts;
-                            vec2 temp;
+                            point_tree verts;
+                            std::vector<float64> face_points;
                             index_t idx;
 
                             // This is the lhs so our plane is on the end of matched dim
@@ -8099,35 +9136,43 @@ private:
                             {
                                 ijk[other_dims[0]] = i;
                                 grid_ijk_to_id(ijk.data(), dims_lhs.data(), idx);
-                                for(index_t di = 0; di < dimension; di++)
+                                for(index_t di = 0; di < MAXDIM; di++)
                                 {
-                                    n_temp.set_external(dts_lhs[di], const_cast<void*>(vals_lhs[di]->element_ptr(idx)));
-                                    temp[di] = n_temp.to_double();
+                                    if(di < dimension)
+                                    {
+                                        n_temp.set_external(dts_lhs[di], const_cast<void*>(vals_lhs[di]->element_ptr(idx)));
+                                    }
+                                    face_points.push_back(di < dimension ? n_temp.to_double() : 0.);
                                 }
-                                verts.insert(temp, idx);
                             }
+                            verts.build(face_points.data(), (index_t)face_points.size() / MAXDIM);
+                            face_points.clear();
 
                             // Check all the points in the tree against the points from the rhs face
                             determine_matched_dim(rhs_face, other_dims.data());
                             idx_for_matched_dim(rhs_face, dims_rhs.data(), ijk.data());
-                            index_t *existing_idx = nullptr;
                             for(index_t i = 0; i < dims_rhs[other_dims[0]]; i++)
                             {
                                 ijk[other_dims[0]] = i;
                                 grid_ijk_to_id(ijk.data(), dims_rhs.data(), idx);
-                                for(index_t di = 0; di < dimension; di++)
-                                {
-                                    n_temp.set_external(dts_rhs[di], const_cast<void*>(vals_rhs[di]->element_ptr(idx)));
-                                    temp[di] = n_temp.to_double();
-                                }
-                                existing_idx = verts.find_point(temp, tolerance);
-                                if(!existing_idx)
+                                for(index_t di = 0; di < MAXDIM; di++)
                                 {
-                                    // If we couldn't match this face then we can't combine as structured.
-                                    CONDUIT_INFO("Face definition does not match.");
-                                    return false;
+                                    if(di < dimension)
+                                    {
+                                        n_temp.set_external(dts_rhs[di], const_cast<void*>(vals_rhs[di]->element_ptr(idx)));
+                                    }
+                                    face_points.push_back(di < dimension ? n_temp.to_double() : 0.);
                                 }
                             }
+                            const index_t nface_points = (index_t)face_points.size() / MAXDIM;
+                            std::vector<index_t> existing_idx(nface_points);
+                            verts.find_point(face_points.data(), nface_points, tolerance, existing_idx.data());
+                            if(std::find(existing_idx.begin(), existing_idx.end(), point_tree::NOT_FOUND) != existing_idx.end())
+                            {
+                                // If we couldn't match this face then we can't combine as structured.
+                                CONDUIT_INFO("Face definition does not match.");
+                                return false;
+                            }
                         }
                         // Nothing needs to be checked for dimension 1
                         // NOTE: We would have returned from the function if the check failed
@@ -8838,6 +9883,72 @@ map_element_field(const std::vector<const Node*> &in_nodes,
     }
 }
 
+//-------------------------------------------------------------------------
+// Minimum number of values each thread scatters.
+static const index_t SCATTER_MIN_CHUNK = 16384;
+
+//-------------------------------------------------------------------------
+// Typed scatter of src[i] to dest[ids[i]], converting to dest's type.
+// Strides are in bytes.
+struct ScatterValues
+{
+    const DataArray<index_t> &ids;
+    index_t                   src_stride;
+    index_t                   dest_stride;
+    index_t                   num_threads;
+
+    template <typename S, typename D>
+    void operator()(const S *src, D *dest) const
+    {
+        const uint8 *src_bytes = reinterpret_cast<const uint8*>(src);
+        uint8 *dest_bytes = reinterpret_cast<uint8*>(dest);
+        const index_t num_ids = ids.number_of_elements();
+        utils::detail::parallel_chunks(
+            utils::detail::parallel_num_chunks(num_threads, num_ids,
+                                               SCATTER_MIN_CHUNK),
+            num_ids,
+            [&] (index_t /*ci*/, index_t ibegin, index_t iend)
+        {
+            for(index_t i = ibegin; i < iend; i++)
+            {
+                *reinterpret_cast<D*>(dest_bytes + ids[i] * dest_stride) =
+                    static_cast<D>(*reinterpret_cast<const S*>(
+                        src_bytes + i * src_stride));
+            }
+        });
+    }
+};
+
+//-------------------------------------------------------------------------
+/**
+ @brief Scatters the values of a field chunk into a field's values:
+        out_values[ids[i]] = in_values[i]. out_values must already be
+        allocated (mcarray components are matched by index). The ids of
+        a chunk must be unique, since they are written in parallel.
+*/
+static void
+scatter_values(const Node &in_values,
+        const DataArray<index_t> &ids,
+        Node &out_values,
+        index_t num_threads)
+{
+    const index_t ncomps = in_values.number_of_children();
+    if(ncomps > 0)
+    {
+        for(index_t ci = 0; ci < ncomps; ci++)
+        {
+            scatter_values(in_values[ci], ids, out_values[ci], num_threads);
+        }
+        return;
+    }
+
+    ScatterValues scatter = {ids,
+                             in_values.dtype().stride(),
+                             out_values.dtype().stride(),
+                             num_threads};
+    dispatch2(in_values, out_values, scatter);
+}
+
 //-----------------------------------------------------------------------------
 static void
 combine(const std::vector<const Node*> &in_fields,
@@ -9039,35 +10150,20 @@ handle_uni_buffer(const Node &n_matset,
 
     const DataAccessor<index_t> material_ids = n_matset["material_ids"].value();
     const DataAccessor<double> volume_fractions = n_matset["volume_fractions"].value();
-    index_t local_elem_id = 0;
-    blueprint::o2mrelation::O2MIterator o2m_itr(n_matset);
-    // Question: Why does o2m_itr.has_next(o2mrelaton::ONE) contain different logic
-    //  than the implementation of o2m_itr.next(o2mrelation::ONE)?
-    //  For instance, if we have an o2m relation with 1 item has_next(ONE) will always
-    //  return false - even if we called o2m_itr.to_front() first.
-    while(o2m_itr.has_next())
+    walk_o2m(n_matset, [&](index_t local_elem_id, index_t o2m_idx)
     {
-        o2m_itr.next(blueprint::o2mrelation::ONE);
-        o2m_itr.to_front(blueprint::o2mrelation::MANY);
-
-        while(o2m_itr.has_next(blueprint::o2mrelation::MANY))
+        const std::string &mat_name = material_map[material_ids[o2m_idx]];
+        auto &pair = out_vfracts_eids[mat_name];
+        pair.first.push_back(volume_fractions[o2m_idx]);
+        if(!is_elem_based)
         {
-            o2m_itr.next(blueprint::o2mrelation::MANY);
-            const index_t o2m_idx = o2m_itr.index();
-            const std::string &mat_name = material_map[material_ids[o2m_idx]];
-            auto &pair = out_vfracts_eids[mat_name];
-            pair.first.push_back(volume_fractions[o2m_idx]);
-            if(!is_elem_based)
-            {
-                pair.second.push_back(elem_map[element_ids->element(local_elem_id)]);
-            }
-            else // if(is_elem_based)
-            {
-                pair.second.push_back(elem_map[local_elem_id]);
-            }
+            pair.second.push_back(elem_map[element_ids->element(local_elem_id)]);
         }
-        local_elem_id++;
-    }
+        else // if(is_elem_based)
+        {
+            pair.second.push_back(elem_map[local_elem_id]);
+        }
+    });
 }
 
 //-----------------------------------------------------------------------------
@@ -9128,13 +10224,10 @@ handle_multi_buffer(const Node &n_matset,
         }
 
         auto &out_pair = out_vfracts_eids[mat_name];
-        blueprint::o2mrelation::O2MIterator itr(temp_vfracts);
-        itr.to_front();
         // Iterate the volume fraction data, still need i for indexing into element ids
-        for(index_t i = 0; itr.has_next(); i++)
+        index_t i = 0;
+        walk_o2m(temp_vfracts, [&](index_t /*one_idx*/, index_t idx)
         {
-            itr.next();
-            const index_t idx = itr.index();
             out_pair.first.push_back(volume_fractions[idx]);
             // Material based will use element_ids array
             if(!is_elem_based && (element_ids.get() != nullptr))
@@ -9145,7 +10238,8 @@ handle_multi_buffer(const Node &n_matset,
             {
                 out_pair.second.push_back(elem_map[i]);
             }
-        }
+            i++;
+        });
     }
 }
 
@@ -9447,6 +10541,17 @@ Partitioner::combine(int domain,
     const std::vector<const Node *> &inputs,
     const std::vector<index_t> &chunk_ids,
     Node &output)
+{
+    combine(domain, inputs, chunk_ids, num_threads, output);
+}
+
+//-------------------------------------------------------------------------
+void
+Partitioner::combine(int domain,
+    const std::vector<const Node *> &inputs,
+    const std::vector<index_t> &chunk_ids,
+    index_t merge_threads,
+    Node &output)
 {
     // NOTE: Some decisions upstream, for the time being, make all the chunks
     //       unstructured. We will try to relax that so we might end up
@@ -9524,7 +10629,7 @@ Partitioner::combine(int domain,
             }
 
             combine_as_unstructured(main_topo_name, topo_groups,
-                cset_groups, output);
+                cset_groups, merge_threads, output);
             combined = true;
         }
     }
@@ -9857,7 +10962,16 @@ Partitioner::map_back_fields(const conduit::Node& repart_mesh,
                              const conduit::Node& options,
                              Node& orig_mesh)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("map_back_fields");
+
     using namespace std;
+    index_t mapback_threads = 1;
+    if (options.has_child("num_threads"))
+    {
+        mapback_threads = options["num_threads"].to_index_t();
+        if (mapback_threads <= 0)
+            mapback_threads = std::max((index_t)1, (index_t)std::thread::hardware_concurrency());
+    }
     auto repart_doms = mesh::domains(repart_mesh);
     auto orig_doms = mesh::domains(orig_mesh);
     // the below should also init dom_to_rank_map in mpi partitioner
@@ -10056,72 +11170,61 @@ Partitioner::map_back_fields(const conduit::Node& repart_mesh,
     // domain homes
     communicate_mapback(packed_fields);
 
-    // bool first_warn = true; // unused
+    // Scatter the chunks of each original domain's fields into place
     for (const auto& orig_dom : packed_fields)
     {
+        const Node& chunks = orig_dom.second;
+
         // Precompute final element count
         index_t nelems = 0;
-        for (const Node& src_chunk : orig_dom.second.children())
+        for (const Node& src_chunk : chunks.children())
         {
-            DataArray<index_t> cnk_map = src_chunk["elem_map"].value();
-            nelems += cnk_map.number_of_elements();
+            nelems += src_chunk["elem_map"].dtype().number_of_elements();
         }
 
-        int cnk_id = 0;
-        vector<index_t> tgt_elem_map(nelems * 2);
-        vector<DataArray<index_t>> tgt_vert_maps(orig_dom.second.number_of_children());
-        unordered_map<string, vector<const Node*>> field_groups;
-        for (const Node& src_chunk : orig_dom.second.children())
+        Node& tgt_dom = *gid_to_orig_dom[orig_dom.first];
+        std::set<string> allocated_fields;
+        for (const Node& src_chunk : chunks.children())
         {
-            // Group common field nodes together by name
+            const DataArray<index_t> elem_map = src_chunk["elem_map"].value();
+            const DataArray<index_t> vert_map = src_chunk["vert_map"].value();
             for (const Node& field : src_chunk["fields"].children())
             {
-                field_groups[field.name()].push_back(&field);
-            }
-            // Build element map
-            DataArray<index_t> cnk_map = src_chunk["elem_map"].value();
-            for (index_t i = 0; i < cnk_map.number_of_elements(); i++)
-            {
-                index_t out_idx = cnk_map[i];
-                tgt_elem_map[2*out_idx] = cnk_id;
-                tgt_elem_map[2*out_idx + 1] = i;
-            }
-            // map_vertex_field expects a collection of vertex maps for each
-            // chunk, instead of a single unified map
-            tgt_vert_maps[cnk_id] = src_chunk["vert_map"].value();
-            cnk_id++;
-        }
-        // map_element_field expects a DataArray
-        DataArray<index_t> elem_map_arr;
-        {
-            Node tmp;
-            tmp.set_external(tgt_elem_map);
-            elem_map_arr = tmp.value();
-        }
-        Node& tgt_dom = *gid_to_orig_dom[orig_dom.first];
-        for (const auto& fg : field_groups)
-        {
-            const vector<const Node*>& src_fields = fg.second;
-            const string& field_name = fg.first;
-            const string& assoc = src_fields[0]->child("association").as_string();
-            const string& assoc_topo = src_fields[0]->child("topology").as_string();
+                const string& field_name = field.name();
+                const string& assoc = field["association"].as_string();
+                const string& assoc_topo = field["topology"].as_string();
+                Node& output = tgt_dom["fields"][field_name];
 
-            Node& output = tgt_dom["fields"][field_name];
-            output["association"] = assoc;
-            output["topology"] = assoc_topo;
-            if (assoc == "vertex")
-            {
-                const std::string& assoc_cset = tgt_dom["topologies"][assoc_topo]["coordset"].as_string();
-                const Node& assoc_coordset = tgt_dom["coordsets"][assoc_cset];
-                index_t nverts = coordset::length(assoc_coordset);
-                fields::map_vertex_field(src_fields, tgt_vert_maps, nverts, output["values"]);
-            }
-            else if (assoc == "element")
-            {
-                fields::map_element_field(src_fields, elem_map_arr, output["values"]);
+                // Allocate the field the first time we see it
+                if (allocated_fields.insert(field_name).second)
+                {
+                    index_t nvalues = nelems;
+                    if (assoc == "vertex")
+                    {
+                        const std::string& assoc_cset = tgt_dom["topologies"][assoc_topo]["coordset"].as_string();
+                        nvalues = coordset::length(tgt_dom["coordsets"][assoc_cset]);
+                    }
+                    output["association"] = assoc;
+                    output["topology"] = assoc_topo;
+                    index_t ncomps = 0;
+                    Schema out_schema;
+                    fields::determine_schema(field["values"], nvalues, ncomps, out_schema);
+                    output["values"].reset();
+                    output["values"].set(out_schema);
+                }
+
+                if (assoc == "vertex")
+                {
+                    fields::scatter_values(field["values"], vert_map,
+                                           output["values"], mapback_threads);
+                }
+                else if (assoc == "element")
+                {
+                    fields::scatter_values(field["values"], elem_map,
+                                           output["values"], mapback_threads);
+                }
             }
         }
-        // first_warn = false; // unused
     }
 }
 
@@ -10141,6 +11244,7 @@ void
 Partitioner::combine_as_unstructured(const std::string &topo_name,
     const std::vector<std::pair<std::string, std::vector<const Node*>>> &topo_groups,
     const std::vector<std::pair<std::string, std::vector<const Node*>>> &coordset_groups,
+    index_t merge_threads,
     Node &output)
 {
     using pair_t = std::pair<std::string, std::vector<const Node*>>;
@@ -10173,7 +11277,8 @@ Partitioner::combine_as_unstructured(const std::string &topo_name,
     Node &output_coordsets = output.add_child("coordsets");
     {
         coordset::point_merge pm;
-        pm.execute(cg_itr->second, merge_tolerance, output_coordsets.add_child(cset_name));
+        pm.execute(cg_itr->second, merge_tolerance, output_coordsets.add_child(cset_name),
+            merge_threads);
     }
     const Node &pointmaps = output_coordsets[cset_name]["pointmaps"];
 
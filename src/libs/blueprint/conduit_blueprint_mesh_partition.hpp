@@ -14,6 +14,7 @@
 //-----------------------------------------------------------------------------
 // std includes
 //-----------------------------------------------------------------------------
+#include <functional>
 #include <map>
 #include <unordered_map>
 #include <memory>
@@ -324,6 +325,7 @@ public:
 protected:
 
     using ChunkToVertsMap = std::unordered_map<index_t, std::vector<index_t>>;
+    using ChunksReady = std::function<void(const std::vector<size_t> &)>;
     using DomainToChunkMap = std::unordered_map<const Node*, ChunkToVertsMap>;
 
     /**
@@ -402,6 +404,35 @@ protected:
      */
     std::shared_ptr<Selection> create_selection_all_elements(const conduit::Node &n_mesh) const;
 
+    /**
+     @brief Makes the parts of an "sfc" selection that applies to any domain.
+            The elements of all domains (on all ranks) are ordered along the
+            curve and cut into parts with balanced numbers of elements. Each
+            part becomes an output domain.
+     @param sel The sfc selection.
+     @param doms The domains on this rank.
+     @param options The partition options. The target gives the number of
+                    parts when the selection does not.
+     */
+    void initialize_sfc_parts(const std::shared_ptr<Selection> &sel,
+                              const std::vector<const conduit::Node *> &doms,
+                              const conduit::Node &options);
+
+    /**
+     @brief Combines the centroid bounds of an "sfc" selection over ranks.
+     @param[inout] bounds The xmin,ymin,zmin,xmax,ymax,zmax bounds on this
+                          rank, replaced by the bounds over all ranks.
+     @note Reimplemented in parallel
+     */
+    virtual void reduce_sfc_bounds(float64 bounds[6]) const;
+
+    /**
+     @brief Sums counts of "sfc" selection keys over ranks.
+     @param[inout] counts The counts on this rank, replaced by their sums.
+     @note Reimplemented in parallel
+     */
+    virtual void reduce_sfc_counts(std::vector<uint64> &counts) const;
+
     void copy_matsets(const std::string &topology,
                       const std::vector<index_t> &element_ids,
                       const conduit::Node &n_mesh,
@@ -467,6 +498,18 @@ protected:
              const std::vector<index_t> &vertex_ids,
              conduit::Node &n_new_coordset) const;
 
+    /**
+     @brief Computes explicit coordinate values for a subset of the vertices
+            in a uniform or rectilinear coordset.
+
+     @param n_coordset A Conduit node containing the source coordset.
+     @param vertex_ids The vertex ids to include from the source coordset.
+     @param n_new_values A Conduit node that will contain the new values.
+     */
+    void implicit_coordset_values(const conduit::Node &n_coordset,
+             const std::vector<index_t> &vertex_ids,
+             conduit::Node &n_new_values) const;
+
     void create_new_uniform_topo(const conduit::Node &n_topo,
              const std::string &csname,
              const index_t start[3],
@@ -485,8 +528,8 @@ protected:
 
     /**
      @brief Creates a new unstructured topology from a subset of the 
-            input topology. Any topologies that are not unstructured are
-            currently converted to unstructured.
+            input topology. Any topologies that are not unstructured
+            produce unstructured output.
 
      @param n_topo A Conduit node containing source topology.
      @param csname The name of the coordset to use in the new topology.
@@ -500,6 +543,23 @@ protected:
              const std::vector<index_t> &vertex_ids,
              conduit::Node &n_new_topo) const;
 
+    /**
+     @brief Creates a new unstructured topology from a subset of the 
+            input uniform, rectilinear, or structured topology without
+            converting the whole input topology to unstructured.
+
+     @param n_topo A Conduit node containing source topology.
+     @param csname The name of the coordset to use in the new topology.
+     @param element_ids The element ids to include from the source topology.
+     @param vertex_ids The vertex ids that are used from the source topology's coordset.
+     @param n_new_topo A Conduit node that will contain the new topology.
+     */
+    void unstructured_topo_from_structured(const conduit::Node &n_topo,
+             const std::string &csname,
+             const std::vector<index_t> &element_ids,
+             const std::vector<index_t> &vertex_ids,
+             conduit::Node &n_new_topo) const;
+
     /**
      @brief Creates a new unstructured topology from a subset of the 
             input unstructured topology.
@@ -559,18 +619,30 @@ protected:
         const std::vector<const Node *> &inputs,
         Node &output);
 
+    /**
+     @brief Combines the inputs like the public combine method, using
+            merge_threads threads to merge points.
+     */
+    void combine(int domain,
+                 const std::vector<const Node *> &inputs,
+                 const std::vector<index_t> &chunk_ids,
+                 index_t merge_threads,
+                 Node &output);
+
     /**
      @brief Given a set of inputs that are of various types, assemble them
             into a single output mesh with unstructured topology. This
             method combines like-named coordsets and topologies.
 
      @param inputs A vector of Blueprint mesh nodes to combine.
+     @param merge_threads The number of threads used to merge points.
      @param output The Conduit node into which the combined mesh output
                    will be added.
      */
     void combine_as_unstructured(const std::string &topo_name,
         const std::vector<std::pair<std::string, std::vector<const Node*>>> &topo_groups,
         const std::vector<std::pair<std::string, std::vector<const Node*>>> &coordset_groups,
+        index_t merge_threads,
         Node &output);
 
     /**
@@ -701,6 +773,11 @@ protected:
                                             into a single output domain.
      @param[out] chunks_to_assemble_gids The global chunk numbering of each
                                          chunk in chunks_to_assemble.
+     @param chunks_ready Called with the indices in chunks_to_assemble of the
+                         chunks that became available, first for the chunks
+                         already on this rank and then as others arrive. It
+                         may use any chunk passed to it so far, before
+                         communicate_chunks returns.
      @note Reimplemented in parallel
      */
     virtual void communicate_chunks(const std::vector<Chunk> &chunks,
@@ -709,7 +786,8 @@ protected:
                                     const std::vector<int> &offsets,
                                     std::vector<Chunk> &chunks_to_assemble,
                                     std::vector<int> &chunks_to_assemble_domains,
-                                    std::vector<int> &chunks_to_assemble_gids);
+                                    std::vector<int> &chunks_to_assemble_gids,
+                                    const ChunksReady &chunks_ready);
 
     /**
      @brief During the field back-map, communicates packed field data to the
@@ -745,6 +823,9 @@ protected:
     std::vector<std::string>                 selected_fields;
     bool                                     mapping;
     double                                   merge_tolerance;
+    index_t                                  num_threads;
+    bool                                     external;
+    bool                                     minimize_migration;
 };
 
 }
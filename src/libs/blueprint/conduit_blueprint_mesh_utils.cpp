@@ -11,23 +11,30 @@
 //-----------------------------------------------------------------------------
 // std lib includes
 #include <algorithm>
+#include <array>
 #include <cmath>
-#include <deque>
+#include <cstring>
 #include <string>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <vector>
 #include <unordered_map>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // conduit includes
 //-----------------------------------------------------------------------------
 #include "conduit_blueprint_mesh.hpp"
+#include "conduit_blueprint_mesh_execution.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
+#include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
 
 // access one-to-many index types
 namespace O2MIndex = conduit::blueprint::o2mrelation;
@@ -83,10 +90,12 @@ ShapeType::ShapeType(const conduit::Node &topology)
 {
     init(-1);
 
-    if(topology["type"].as_string() == "unstructured" &&
-        topology["elements"].has_child("shape"))
+    const Node &topo_type = topology["type"];
+    if(topo_type.dtype().is_string() &&
+       std::strcmp(topo_type.as_char8_str(), "unstructured") == 0 &&
+       topology["elements"].has_child("shape"))
     {
-        init(topology["elements/shape"].as_string());
+        init(id_from_name(topology["elements/shape"].as_char8_str()));
     }
 }
 
@@ -95,15 +104,56 @@ ShapeType::ShapeType(const conduit::Node &topology)
 void
 ShapeType::init(const std::string &type_name)
 {
-    init(-1);
+    init(id_from_name(type_name.c_str()));
+}
+
+
+//---------------------------------------------------------------------------//
+index_t
+ShapeType::id_from_name(const std::string &type_name)
+{
+    return id_from_name(type_name.c_str());
+}
 
-    for(index_t i = 0; i < (index_t)TOPO_SHAPES.size(); i++)
+
+//---------------------------------------------------------------------------//
+index_t
+ShapeType::id_from_name(const char *type_name)
+{
+    // the first character narrows the name down to at most four shapes
+    static const index_t NO_SHAPE = -1;
+    const index_t *candidates = &NO_SHAPE;
+    index_t num_candidates = 0;
+
+    static const index_t P_SHAPES[] = {0 /*point*/, 7 /*pyramid*/,
+                                       8 /*polygonal*/, 9 /*polyhedral*/};
+    static const index_t T_SHAPES[] = {2 /*tri*/, 4 /*tet*/};
+    static const index_t L_SHAPES[] = {1 /*line*/};
+    static const index_t Q_SHAPES[] = {3 /*quad*/};
+    static const index_t H_SHAPES[] = {5 /*hex*/};
+    static const index_t W_SHAPES[] = {6 /*wedge*/};
+    static const index_t M_SHAPES[] = {10 /*mixed*/};
+
+    switch(type_name[0])
     {
-        if(type_name == TOPO_SHAPES[i])
+    case 'p': candidates = P_SHAPES; num_candidates = 4; break;
+    case 't': candidates = T_SHAPES; num_candidates = 2; break;
+    case 'l': candidates = L_SHAPES; num_candidates = 1; break;
+    case 'q': candidates = Q_SHAPES; num_candidates = 1; break;
+    case 'h': candidates = H_SHAPES; num_candidates = 1; break;
+    case 'w': candidates = W_SHAPES; num_candidates = 1; break;
+    case 'm': candidates = M_SHAPES; num_candidates = 1; break;
+    default: break;
+    }
+
+    for(index_t ci = 0; ci < num_candidates; ci++)
+    {
+        if(std::strcmp(type_name, TOPO_SHAPES[candidates[ci]].c_str()) == 0)
         {
-            init(i);
+            return candidates[ci];
         }
     }
+    return -1;
 }
 
 
@@ -202,54 +252,301 @@ ShapeCascade::get_shape(const index_t level) const
     return dim_types[level < 0 ? dim : level];
 }
 
+//---------------------------------------------------------------------------//
+// The cascade of each shape in TOPO_SHAPES (left invalid for 'mixed'), built
+// on first use.
+static const std::vector<std::array<ShapeType, 4>> &
+shape_cascades()
+{
+    static const std::vector<std::array<ShapeType, 4>> cascades = []()
+    {
+        std::vector<std::array<ShapeType, 4>> res(TOPO_SHAPES.size());
+        for(index_t si = 0; si < (index_t)TOPO_SHAPES.size(); si++)
+        {
+            const ShapeType base_type(si);
+            if(base_type.dim < 0)
+            {
+                continue;
+            }
+            res[si][base_type.dim] = base_type;
+            for(index_t di = base_type.dim - 1; di >= 0; di--)
+            {
+                res[si][di] = ShapeType(res[si][di + 1].embed_id);
+            }
+        }
+        return res;
+    }();
+    return cascades;
+}
+
 //---------------------------------------------------------------------------//
 void
 ShapeCascade::init(const ShapeType &base_type)
 {
     dim = base_type.dim;
 
-    dim_types[base_type.dim] = base_type;
-    for(index_t di = base_type.dim - 1; di >= 0; di--)
+    if(base_type.is_valid() && dim >= 0)
+    {
+        const std::array<ShapeType, 4> &cascade = shape_cascades()[base_type.id];
+        for(index_t di = 0; di <= dim; di++)
+        {
+            dim_types[di] = cascade[di];
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::utils::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// Open addressing hash table used for entity discovery in 'TopologyMetadata'.
+// It holds the ids of entities whose keys (sorted point id sets) are stored
+// externally in packed arrays, and maps each entity to the first inserted
+// entity with the same key. Slots are linear probed, with -1 marking an
+// empty slot, so inserts don't allocate per entity.
+//---------------------------------------------------------------------------//
+class EntityKeyMap
+{
+public:
+    EntityKeyMap(const index_t *keys,
+                 const index_t *key_offsets,
+                 const index_t *key_sizes,
+                 const uint64 *key_hashes)
+    : m_keys(keys),
+      m_key_offsets(key_offsets),
+      m_key_sizes(key_sizes),
+      m_key_hashes(key_hashes),
+      m_slots(16, -1),
+      m_size(0)
+    {}
+
+    // returns the first inserted entity with the same key as entity 'id',
+    // which is 'id' itself if its key wasn't already in the map
+    index_t insert(index_t id)
+    {
+        const uint64 mask = (uint64)m_slots.size() - 1;
+        uint64 si = m_key_hashes[id] & mask;
+        while(m_slots[si] != -1)
+        {
+            const index_t sid = m_slots[si];
+            if(equals(sid, id))
+            {
+                return sid;
+            }
+            si = (si + 1) & mask;
+        }
+
+        m_slots[si] = id;
+        m_size++;
+        if(2 * (size_t)m_size > m_slots.size())
+        {
+            grow();
+        }
+        return id;
+    }
+
+    static uint64 hash(const index_t *key, index_t key_size)
+    {
+        uint64 res = (uint64)key_size;
+        for(index_t ki = 0; ki < key_size; ki++)
+        {
+            res = (res ^ (uint64)key[ki]) * 0x9E3779B97F4A7C15ULL;
+            res ^= res >> 29;
+        }
+        return res ^ (res >> 32);
+    }
+
+private:
+    bool equals(index_t id0, index_t id1) const
+    {
+        const index_t *key0 = m_keys + m_key_offsets[id0];
+        const index_t *key1 = m_keys + m_key_offsets[id1];
+        return m_key_hashes[id0] == m_key_hashes[id1] &&
+            m_key_sizes[id0] == m_key_sizes[id1] &&
+            std::equal(key0, key0 + m_key_sizes[id0], key1);
+    }
+
+    void grow()
+    {
+        std::vector<index_t> old_slots(2 * m_slots.size(), -1);
+        old_slots.swap(m_slots);
+        const uint64 mask = (uint64)m_slots.size() - 1;
+        for(size_t oi = 0; oi < old_slots.size(); oi++)
+        {
+            if(old_slots[oi] != -1)
+            {
+                uint64 si = m_key_hashes[old_slots[oi]] & mask;
+                while(m_slots[si] != -1)
+                {
+                    si = (si + 1) & mask;
+                }
+                m_slots[si] = old_slots[oi];
+            }
+        }
+    }
+
+    const index_t       *m_keys;
+    const index_t       *m_key_offsets;
+    const index_t       *m_key_sizes;
+    const uint64        *m_key_hashes;
+    std::vector<index_t> m_slots;
+    index_t              m_size;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::utils::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+TopologyMetadata::TopologyMetadata(const conduit::Node &topology,
+                                   const conduit::Node &coordset,
+                                   index_t num_threads) :
+    topo(&topology), cset(&coordset),
+    int_dtype(find_widest_dtype(link_nodes(topology, coordset), DEFAULT_INT_DTYPES)),
+    float_dtype(find_widest_dtype(link_nodes(topology, coordset), DEFAULT_FLOAT_DTYPE)),
+    topo_cascade(topology), topo_shape(topology),
+    m_num_threads(1), m_min_dim(0), m_has_local(true)
+{
+    init(num_threads, 0);
+
+    for(index_t edi = 0; edi <= topo_shape.dim; edi++)
     {
-        dim_types[di] = ShapeType(dim_types[di + 1].embed_id);
+        for(index_t adi = 0; adi <= topo_shape.dim; adi++)
+        {
+            build_global_assoc(edi, adi);
+        }
     }
 }
 
 //---------------------------------------------------------------------------//
-TopologyMetadata::TopologyMetadata(const conduit::Node &topology, const conduit::Node &coordset) :
+TopologyMetadata::TopologyMetadata(const conduit::Node &topology,
+                                   const conduit::Node &coordset,
+                                   const conduit::Node &options) :
     topo(&topology), cset(&coordset),
     int_dtype(find_widest_dtype(link_nodes(topology, coordset), DEFAULT_INT_DTYPES)),
     float_dtype(find_widest_dtype(link_nodes(topology, coordset), DEFAULT_FLOAT_DTYPE)),
-    topo_cascade(topology), topo_shape(topology)
+    topo_cascade(topology), topo_shape(topology),
+    m_num_threads(1), m_min_dim(0), m_has_local(true)
 {
-    // NOTE(JRC): This type current only works at forming associations within
-    // an unstructured topology's hierarchy.
-    Node topo_offsets, topo_suboffsets;
-    bool is_polyhedral = topo->has_child("subelements");
+    const index_t topo_dim = topo_shape.dim;
 
-    if(is_polyhedral)
+    index_t num_threads = 1;
+    if(options.has_child("num_threads"))
+    {
+        num_threads = options["num_threads"].to_index_t();
+        if(num_threads <= 0)
+        {
+            num_threads = (index_t)std::thread::hardware_concurrency();
+        }
+    }
+
+    index_t min_dim = 0;
+    if(options.has_child("dims"))
+    {
+        index_t_accessor dims = options["dims"].value();
+        if(dims.number_of_elements() == 0)
+        {
+            CONDUIT_ERROR("TopologyMetadata: option 'dims' is empty");
+        }
+
+        min_dim = topo_dim;
+        for(index_t di = 0; di < dims.number_of_elements(); di++)
+        {
+            if(dims[di] < 0 || dims[di] > topo_dim)
+            {
+                CONDUIT_ERROR("TopologyMetadata: option 'dims' has invalid dimension "
+                              << dims[di] << " for a topology of dimension " << topo_dim);
+            }
+            min_dim = std::min(min_dim, (index_t)dims[di]);
+        }
+    }
+
+    std::vector<index_t> assoc_pairs;
+    if(options.has_child("associations"))
     {
-        topology::unstructured::generate_offsets(*topo,
-                                                 topo_offsets,
-                                                 topo_suboffsets);
+        index_t_accessor assocs = options["associations"].value();
+        if(assocs.number_of_elements() % 2 != 0)
+        {
+            CONDUIT_ERROR("TopologyMetadata: option 'associations' must list "
+                          "(entity dim, assoc dim) pairs");
+        }
+
+        for(index_t ai = 0; ai < assocs.number_of_elements(); ai++)
+        {
+            if(assocs[ai] < min_dim || assocs[ai] > topo_dim)
+            {
+                CONDUIT_ERROR("TopologyMetadata: option 'associations' has "
+                              "dimension " << assocs[ai] << " outside of the "
+                              "built dimensions [" << min_dim << ", " << topo_dim << "]");
+            }
+            assoc_pairs.push_back(assocs[ai]);
+        }
     }
     else
     {
-        topology::unstructured::generate_offsets(*topo, topo_offsets);
+        for(index_t edi = min_dim; edi <= topo_dim; edi++)
+        {
+            for(index_t adi = min_dim; adi <= topo_dim; adi++)
+            {
+                assoc_pairs.push_back(edi);
+                assoc_pairs.push_back(adi);
+            }
+        }
+    }
+
+    init(num_threads, min_dim);
+
+    for(index_t pi = 0; pi < (index_t)assoc_pairs.size(); pi += 2)
+    {
+        build_global_assoc(assoc_pairs[pi], assoc_pairs[pi + 1]);
+    }
+
+    if(options.has_child("local") && options["local"].to_int() == 0)
+    {
+        m_has_local = false;
+        std::vector< std::vector<index_t> >().swap(dim_lchild_offsets);
+        std::vector< std::vector<index_t> >().swap(dim_lancestors);
     }
+}
+
+//---------------------------------------------------------------------------//
+void
+TopologyMetadata::init(index_t num_threads, index_t min_dim)
+{
+    const conduit::Node &topology = *topo;
+    const conduit::Node &coordset = *cset;
+
+    // NOTE(JRC): This type current only works at forming associations within
+    // an unstructured topology's hierarchy.
+    Node topo_offsets, topo_suboffsets;
+    const bool is_polyhedral = topo->has_child("subelements");
+    num_threads = std::max((index_t)1, num_threads);
+    topology::unstructured::generate_offsets(*topo,
+                                             topo_offsets,
+                                             topo_suboffsets,
+                                             num_threads);
 
     const index_t topo_num_elems = topo_offsets.dtype().number_of_elements();
     const index_t topo_num_coords = coordset::length(coordset);
+    const index_t topo_dim = topo_shape.dim;
+    m_num_threads = num_threads;
+    m_min_dim = min_dim;
 
     // Allocate Data Templates for Outputs //
 
-    dim_topos.resize(topo_shape.dim + 1);
-    dim_geid_maps.resize(topo_shape.dim + 1);
-    dim_geassocs_maps.resize(topo_shape.dim + 1);
-    dim_leassocs_maps.resize(topo_shape.dim + 1);
-    dim_le2ge_maps.resize(topo_shape.dim + 1);
+    dim_topos.resize(topo_dim + 1);
+    dim_le2ge_maps.resize(topo_dim + 1);
+    dim_ge2le_offsets.resize(topo_dim + 1);
+    dim_ge2le_values.resize(topo_dim + 1);
+    dim_lchild_offsets.resize(topo_dim + 1);
+    dim_lancestors.resize(topo_dim + 1);
+    dim_iotas.resize(topo_dim + 1);
 
-    for(index_t di = 0; di < topo_shape.dim; di++)
+    for(index_t di = 0; di < topo_dim; di++)
     {
         Node &dim_topo = dim_topos[di];
         dim_topo.reset();
@@ -258,210 +555,451 @@ TopologyMetadata::TopologyMetadata(const conduit::Node &topology, const conduit:
         dim_topo["elements/shape"].set(topo_cascade.get_shape(di).type);
     }
     // NOTE: This is done so that the index values for the top-level entities
-    // can be extracted by the 'get_entity_data' function before DFS
-    // processing below.
-    dim_topos[topo_shape.dim].set_external(topology);
-    dim_topos[topo_shape.dim]["elements/offsets"].set(topo_offsets);
+    // can be extracted by the 'get_entity_data' function.
+    dim_topos[topo_dim].set_external(topology);
+    dim_topos[topo_dim]["elements/offsets"].set(topo_offsets);
     if(is_polyhedral)
     {
-        dim_topos[topo_shape.dim]["subelements/offsets"].set(topo_suboffsets);
+        dim_topos[topo_dim]["subelements/offsets"].set(topo_suboffsets);
     }
-    std::vector< std::vector<int64> > dim_buffers(topo_shape.dim + 1);
-
-    // Prepare Initial Values for Processing //
-
-    // Temporary nodes to manage pointers to important information (temp) and
-    // associated conversations (data).
-    Node temp, data;
-
-    // NOTE(JRC): A 'deque' is used so that queue behavior (FIFO)
-    // is responsible for ordering the identifiers in the cascade of entities,
-    // which more closely follows the average intuition.
-    const index_t bag_num_elems = topo_num_coords + topo_num_elems;
-    std::deque< std::vector<int64> > entity_index_bag(bag_num_elems);
-    std::deque< index_t > entity_dim_bag(bag_num_elems, -1);
-    std::deque< std::vector< std::pair<int64, int64> > > entity_parent_bag(bag_num_elems);
+    std::vector< std::vector<int64> > dim_buffers(topo_dim + 1);
+    std::vector<int64> poly_sizes_raw;
+
+    const Node no_subelems(DataType::index_t(0));
+    index_t_accessor subelem_sizes = (is_polyhedral ?
+        topo->fetch_existing("subelements/sizes") : no_subelems).value();
+    index_t_accessor subelem_offsets = (is_polyhedral ?
+        topo_suboffsets : no_subelems).value();
+    index_t_accessor subelem_conn = (is_polyhedral ?
+        topo->fetch_existing("subelements/connectivity") : no_subelems).value();
+
+    // NOTE: Entities are discovered in FIFO cascade order, which (since each
+    // entity's embeddings are one dimension lower) is equivalent to visiting
+    // the cascade level by level: first the points of the topology, then the
+    // top-level elements, then their embedded entities, and so on. Each level
+    // is stored as a flat list of entity index sets with the local id of each
+    // entity's parent, and the embeddings of a level's entity form a
+    // contiguous range of local ids in the next level.
+    //
+    // Each level is processed in parallel chunks of entities. Duplicate
+    // entities are found by partitioning the level by key hash, so each key
+    // is only seen by one thread, which visits its entities in local id
+    // order. Global ids are then numbered by first occurrence, so results
+    // don't depend on the number of threads.
+
+    const index_t min_chunk_items = 4096;
+    std::vector<index_t> level_indices, level_offsets, level_parents;
 
     // NOTE(JRC): We start with processing the points of the topology followed
     // by the top-level elements in order to ensure that order is preserved
     // relative to the original topology for these entities.
-    for(index_t pi = 0; pi < topo_num_coords; pi++)
-    {
-        index_t bi = pi;
-        entity_index_bag[bi].push_back(bi);
-        entity_dim_bag[bi] = 0;
-    }
-    for(index_t ei = 0; ei < topo_num_elems; ei++)
     {
-        index_t bi = topo_num_coords + ei;
-
-        temp.reset();
-        get_entity_data(TopologyMetadata::GLOBAL, ei, topo_shape.dim, temp);
+        const index_t num_seeds = (topo_dim == 0) ? topo_num_coords : 0;
+        index_t_accessor topo_conn = topo->fetch_existing("elements/connectivity").value();
+        index_t_accessor topo_offs = topo_offsets.value();
 
-        std::vector<int64> &elem_indices = entity_index_bag[bi];
-        elem_indices.resize(temp.dtype().number_of_elements());
-        data.set_external(DataType::int64(elem_indices.size()), &elem_indices[0]);
-        temp.to_int64_array(data);
+        level_offsets.resize(num_seeds + topo_num_elems + 1);
+        level_parents.assign(num_seeds + topo_num_elems, -1);
+        for(index_t pi = 0; pi < num_seeds; pi++)
+        {
+            level_offsets[pi] = pi;
+        }
+        level_offsets[num_seeds] = num_seeds;
+        for(index_t ei = 0; ei < topo_num_elems; ei++)
+        {
+            const index_t elem_start = topo_offs[ei];
+            const index_t elem_end = (ei < topo_num_elems - 1) ?
+                topo_offs[ei + 1] : topo_conn.number_of_elements();
+            level_offsets[num_seeds + ei + 1] =
+                level_offsets[num_seeds + ei] + (elem_end - elem_start);
+        }
 
-        entity_dim_bag[bi] = topo_shape.dim;
+        level_indices.resize(level_offsets.back());
+        for(index_t pi = 0; pi < num_seeds; pi++)
+        {
+            level_indices[pi] = pi;
+        }
+        detail::parallel_chunks(
+            detail::parallel_num_chunks(num_threads, topo_num_elems, min_chunk_items),
+            topo_num_elems,
+            [&] (index_t /*ci*/, index_t ebegin, index_t eend)
+        {
+            for(index_t ei = ebegin; ei < eend; ei++)
+            {
+                const index_t elem_start = topo_offs[ei];
+                index_t *elem_indices = &level_indices[level_offsets[num_seeds + ei]];
+                const index_t elem_size = level_offsets[num_seeds + ei + 1] -
+                    level_offsets[num_seeds + ei];
+                for(index_t ii = 0; ii < elem_size; ii++)
+                {
+                    elem_indices[ii] = topo_conn[elem_start + ii];
+                }
+            }
+        });
     }
 
-    while(!entity_index_bag.empty())
+    std::vector<index_t> embed_indices, embed_offsets, embed_parents;
+    std::vector<index_t> keys, key_offsets_buffer, key_sizes, key_reps, bucket_ids;
+    std::vector<uint64> key_hashes;
+    for(index_t di = topo_dim; di >= 0; di--)
     {
-        std::vector<int64> entity_indices = entity_index_bag.front();
-        entity_index_bag.pop_front();
-        index_t entity_dim = entity_dim_bag.front();
-        entity_dim_bag.pop_front();
-        std::vector< std::pair<int64, int64> > entity_parents = entity_parent_bag.front();
-        entity_parent_bag.pop_front();
+        const ShapeType dim_shape = topo_cascade.get_shape(di);
+        const index_t level_size = (index_t)level_parents.size();
+        const index_t level_chunks =
+            detail::parallel_num_chunks(num_threads, level_size, min_chunk_items);
 
-        std::vector<int64> &dim_buffer = dim_buffers[entity_dim];
-        std::map< std::set<index_t>, index_t > &dim_geid_map = dim_geid_maps[entity_dim];
-        auto &dim_geassocs = dim_geassocs_maps[entity_dim];
-        auto &dim_leassocs = dim_leassocs_maps[entity_dim];
-        std::vector<index_t> &dim_le2ge_map = dim_le2ge_maps[entity_dim];
-        ShapeType dim_shape = topo_cascade.get_shape(entity_dim);
-
-        // Add Element to Topology //
+        // Add Elements to Topology //
 
         // NOTE: This code assumes that all entities can be uniquely
         // identified by the list of coordinate indices of which they
         // are comprised. This is certainly true of all implicit topologies
         // and of 2D polygonal topologies, but it may not be always the
         // case for 3D polygonal topologies.
-        std::set<int64> vert_ids;
-        if(!dim_shape.is_polyhedral())
+        const index_t *key_offsets = level_offsets.data();
+        if(dim_shape.is_polyhedral())
         {
-            vert_ids = std::set<int64>(entity_indices.begin(), entity_indices.end());
+            key_offsets_buffer.assign(level_size + 1, 0);
+            for(index_t li = 0; li < level_size; li++)
+            {
+                index_t key_bound = 0;
+                for(index_t oi = level_offsets[li]; oi < level_offsets[li + 1]; oi++)
+                {
+                    key_bound += subelem_sizes[level_indices[oi]];
+                }
+                key_offsets_buffer[li + 1] = key_offsets_buffer[li] + key_bound;
+            }
+            key_offsets = key_offsets_buffer.data();
         }
-        else // if(dim_shape.is_polyhedral())
+
+        keys.resize(key_offsets[level_size]);
+        key_sizes.resize(level_size);
+        key_hashes.resize(level_size);
+        detail::parallel_chunks(level_chunks, level_size,
+            [&] (index_t /*ci*/, index_t lbegin, index_t lend)
         {
-            const index_t elem_outer_count = entity_indices.size();
-            index_t_accessor elem_inner_sizes   = topo->fetch_existing("subelements/sizes").value();
-            index_t_accessor elem_inner_offsets = topo_suboffsets.value();
-            index_t_accessor elem_inner_conn    = topo->fetch_existing("subelements/connectivity").value();
-            
-            for(index_t oi = 0; oi < elem_outer_count; oi++)
+            for(index_t li = lbegin; li < lend; li++)
             {
-                const index_t elem_inner_size   = elem_inner_sizes[entity_indices[oi]];
-                const index_t elem_inner_offset = elem_inner_offsets[entity_indices[oi]];
-
-                for(index_t ii = 0; ii < elem_inner_size; ii++)
+                index_t *key = keys.data() + key_offsets[li];
+                index_t key_size = 0;
+                if(!dim_shape.is_polyhedral())
+                {
+                    key_size = level_offsets[li + 1] - level_offsets[li];
+                    std::copy(level_indices.begin() + level_offsets[li],
+                              level_indices.begin() + level_offsets[li + 1],
+                              key);
+                }
+                else // if(dim_shape.is_polyhedral())
                 {
-                    const index_t vi = elem_inner_conn[elem_inner_offset + ii];
-                    vert_ids.insert(vi);
+                    for(index_t oi = level_offsets[li]; oi < level_offsets[li + 1]; oi++)
+                    {
+                        const index_t inner_size   = subelem_sizes[level_indices[oi]];
+                        const index_t inner_offset = subelem_offsets[level_indices[oi]];
+                        for(index_t ii = 0; ii < inner_size; ii++)
+                        {
+                            key[key_size++] = subelem_conn[inner_offset + ii];
+                        }
+                    }
                 }
+                std::sort(key, key + key_size);
+                key_sizes[li] = (index_t)(std::unique(key, key + key_size) - key);
+                key_hashes[li] = detail::EntityKeyMap::hash(key, key_sizes[li]);
             }
-        }
+        });
 
-        const index_t local_id = dim_leassocs.size();
-        if(dim_geid_map.find(vert_ids) == dim_geid_map.end())
+        // find the first entity with each key, one hash partition per thread
+        key_reps.resize(level_size);
+        const index_t num_buckets = level_chunks;
+        if(num_buckets == 1)
         {
-            const index_t global_id = dim_geassocs.size();
-            dim_buffer.insert(dim_buffer.end(), entity_indices.begin(), entity_indices.end());
-            dim_geid_map[vert_ids] = global_id;
+            detail::EntityKeyMap key_map(keys.data(), key_offsets,
+                key_sizes.data(), key_hashes.data());
+            for(index_t li = 0; li < level_size; li++)
+            {
+                key_reps[li] = key_map.insert(li);
+            }
         }
-        const index_t global_id = dim_geid_map.find(vert_ids)->second;
-
-        { // create_entity(global_id, local_id, entity_dim)
-            if((index_t)dim_geassocs.size() <= global_id)
+        else
+        {
+            // stable counting sort of the level's entities by bucket
+            std::vector<index_t> bucket_counts(level_chunks * num_buckets, 0);
+            auto bucket_of = [&] (index_t li)
+            {
+                return (index_t)((key_hashes[li] >> 40) % (uint64)num_buckets);
+            };
+            detail::parallel_chunks(level_chunks, level_size,
+                [&] (index_t ci, index_t lbegin, index_t lend)
             {
-                dim_geassocs.resize(global_id + 1);
+                for(index_t li = lbegin; li < lend; li++)
+                {
+                    bucket_counts[ci * num_buckets + bucket_of(li)]++;
+                }
+            });
+            std::vector<index_t> bucket_offsets(num_buckets + 1, 0);
+            for(index_t bi = 0, bsum = 0; bi < num_buckets; bi++)
+            {
+                for(index_t ci = 0; ci < level_chunks; ci++)
+                {
+                    const index_t count = bucket_counts[ci * num_buckets + bi];
+                    bucket_counts[ci * num_buckets + bi] = bsum;
+                    bsum += count;
+                }
+                bucket_offsets[bi + 1] = bsum;
             }
-            if((index_t)dim_leassocs.size() <= local_id)
+            bucket_ids.resize(level_size);
+            detail::parallel_chunks(level_chunks, level_size,
+                [&] (index_t ci, index_t lbegin, index_t lend)
+            {
+                for(index_t li = lbegin; li < lend; li++)
+                {
+                    bucket_ids[bucket_counts[ci * num_buckets + bucket_of(li)]++] = li;
+                }
+            });
+
+            detail::parallel_chunks(num_buckets, num_buckets,
+                [&] (index_t /*ci*/, index_t bbegin, index_t bend)
+            {
+                for(index_t bi = bbegin; bi < bend; bi++)
+                {
+                    detail::EntityKeyMap key_map(keys.data(), key_offsets,
+                        key_sizes.data(), key_hashes.data());
+                    for(index_t ii = bucket_offsets[bi]; ii < bucket_offsets[bi + 1]; ii++)
+                    {
+                        key_reps[bucket_ids[ii]] = key_map.insert(bucket_ids[ii]);
+                    }
+                }
+            });
+        }
+
+        // number the unique entities by first occurrence
+        std::vector<index_t> &dim_le2ge_map = dim_le2ge_maps[di];
+        std::vector<index_t> buffer_offsets;
+        dim_le2ge_map.resize(level_size);
+        buffer_offsets.reserve(level_size + 1);
+        buffer_offsets.push_back(0);
+        for(index_t li = 0; li < level_size; li++)
+        {
+            const index_t rep_id = key_reps[li];
+            if(rep_id == li)
             {
-                dim_leassocs.resize(local_id + 1);
+                dim_le2ge_map[li] = (index_t)buffer_offsets.size() - 1;
+                buffer_offsets.push_back(buffer_offsets.back() +
+                    level_offsets[li + 1] - level_offsets[li]);
             }
-            if((index_t)dim_le2ge_map.size() <= local_id)
+            else
             {
-                dim_le2ge_map.resize(local_id + 1);
+                dim_le2ge_map[li] = dim_le2ge_map[rep_id];
             }
-            dim_le2ge_map[local_id] = global_id;
         }
 
-        // Add Element to Associations //
-
-        add_entity_assoc(IndexType::GLOBAL, global_id, entity_dim, global_id, entity_dim);
-        add_entity_assoc(IndexType::LOCAL, local_id, entity_dim, local_id, entity_dim);
-        for(index_t pi = 0; pi < (index_t)entity_parents.size(); pi++)
+        std::vector<int64> &dim_buffer = dim_buffers[di];
+        dim_buffer.resize(buffer_offsets.back());
+        if(di == 2 && topo_shape.is_polyhedral())
         {
-            index_t plevel = entity_parents.size() - pi - 1;
-            const index_t parent_global_id = entity_parents[plevel].first;
-            const index_t parent_local_id = entity_parents[plevel].second;
-            const index_t parent_dim = entity_dim + pi + 1;
-            add_entity_assoc(IndexType::GLOBAL, global_id, entity_dim, parent_global_id, parent_dim);
-            add_entity_assoc(IndexType::LOCAL, local_id, entity_dim, parent_local_id, parent_dim);
+            poly_sizes_raw.resize(buffer_offsets.size() - 1);
         }
 
-        // Add Embedded Elements for Further Processing //
+        // Add Elements to Associations //
+
+        std::vector<index_t> &ancestors = dim_lancestors[di];
+        const index_t num_ancestors = topo_dim - di;
+        ancestors.resize(level_size * num_ancestors);
+        detail::parallel_chunks(level_chunks, level_size,
+            [&] (index_t /*ci*/, index_t lbegin, index_t lend)
+        {
+            for(index_t li = lbegin; li < lend; li++)
+            {
+                if(key_reps[li] == li)
+                {
+                    const index_t global_id = dim_le2ge_map[li];
+                    std::copy(level_indices.begin() + level_offsets[li],
+                              level_indices.begin() + level_offsets[li + 1],
+                              dim_buffer.begin() + buffer_offsets[global_id]);
+                    if(!poly_sizes_raw.empty() && di == 2)
+                    {
+                        poly_sizes_raw[global_id] = key_sizes[li];
+                    }
+                }
 
-        if(entity_dim > 0)
+                // the local ancestors at each higher dimension, nearest first
+                index_t *entity_ancestors = ancestors.data() + li * num_ancestors;
+                const index_t parent_local_id = level_parents[li];
+                if(parent_local_id < 0)
+                {
+                    std::fill(entity_ancestors, entity_ancestors + num_ancestors, -1);
+                }
+                else if(num_ancestors > 0)
+                {
+                    const index_t *parent_ancestors = dim_lancestors[di + 1].data() +
+                        parent_local_id * (num_ancestors - 1);
+                    entity_ancestors[0] = parent_local_id;
+                    std::copy(parent_ancestors, parent_ancestors + num_ancestors - 1,
+                              entity_ancestors + 1);
+                }
+            }
+        });
+
+        if(di == min_dim)
         {
-            std::vector< std::pair<int64, int64> > embed_parents = entity_parents;
-            embed_parents.push_back(std::make_pair(global_id, local_id));
-            ShapeType embed_shape = topo_cascade.get_shape(entity_dim - 1);
+            break;
+        }
+
+        // Add Embedded Elements for Further Processing //
 
-            index_t elem_outer_count = dim_shape.is_poly() ?
-                entity_indices.size() : dim_shape.embed_count;
+        ShapeType embed_shape = topo_cascade.get_shape(di - 1);
+        const index_t num_seeds = (di == 1) ? topo_num_coords : 0;
 
-            // NOTE(JRC): This is horribly complicated for the poly case and needs
-            // to be refactored so that it's legible. There's a lot of overlap in
-            // used variables where it feels unnecessary (e.g. 'poly' being
-            // shoehorned into using 'implicit' variables), for example.
-            
-            
-            //
-            // NOTE(CYRUSH): Refactored to use accessors, however we still have
-            // inner loop accessor fetches, which is less than ideal
-            //
-            for(index_t oi = 0, ooff = 0; oi < elem_outer_count; oi++)
+        // per-entity embedding and embedding index counts (as offsets)
+        std::vector<index_t> &child_offsets = dim_lchild_offsets[di];
+        std::vector<index_t> child_index_offsets(level_size + 1);
+        child_offsets.resize(level_size + 1);
+        detail::parallel_chunks(level_chunks, level_size,
+            [&] (index_t /*ci*/, index_t lbegin, index_t lend)
+        {
+            for(index_t li = lbegin; li < lend; li++)
             {
-                index_t elem_inner_count = embed_shape.indices;
-
-                if (dim_shape.is_polyhedral())
+                const index_t entity_size = level_offsets[li + 1] - level_offsets[li];
+                const index_t elem_outer_count = dim_shape.is_poly() ?
+                    entity_size : dim_shape.embed_count;
+                index_t elem_index_count = elem_outer_count * embed_shape.indices;
+                if(dim_shape.is_polyhedral())
                 {
-                    index_t_accessor subelem_sizes   = topo->fetch_existing("subelements/sizes").value();
-                    index_t_accessor subelem_offsets = topo_suboffsets.value();
-                    elem_inner_count = subelem_sizes[entity_indices[oi]];
-                    ooff = subelem_offsets[entity_indices[oi]];
+                    elem_index_count = 0;
+                    for(index_t oi = 0; oi < elem_outer_count; oi++)
+                    {
+                        elem_index_count += subelem_sizes[level_indices[level_offsets[li] + oi]];
+                    }
                 }
+                child_offsets[li + 1] = elem_outer_count;
+                child_index_offsets[li + 1] = elem_index_count;
+            }
+        });
+        child_offsets[0] = num_seeds;
+        child_index_offsets[0] = num_seeds;
+        for(index_t li = 0; li < level_size; li++)
+        {
+            child_offsets[li + 1] += child_offsets[li];
+            child_index_offsets[li + 1] += child_index_offsets[li];
+        }
 
-                std::vector<int64> embed_indices;
-                for(index_t ii = 0; ii < elem_inner_count; ii++)
+        const index_t embed_size = child_offsets[level_size];
+        embed_indices.resize(child_index_offsets[level_size]);
+        embed_offsets.resize(embed_size + 1);
+        embed_parents.resize(embed_size);
+        for(index_t pi = 0; pi < num_seeds; pi++)
+        {
+            embed_indices[pi] = pi;
+            embed_offsets[pi] = pi;
+            embed_parents[pi] = -1;
+        }
+        embed_offsets[embed_size] = (index_t)embed_indices.size();
+
+        detail::parallel_chunks(level_chunks, level_size,
+            [&] (index_t /*ci*/, index_t lbegin, index_t lend)
+        {
+            for(index_t li = lbegin; li < lend; li++)
+            {
+                const index_t *entity_indices = level_indices.data() + level_offsets[li];
+                const index_t entity_size = level_offsets[li + 1] - level_offsets[li];
+                const index_t elem_outer_count = dim_shape.is_poly() ?
+                    entity_size : dim_shape.embed_count;
+                index_t embed_id = child_offsets[li];
+                index_t embed_index = child_index_offsets[li];
+
+                for(index_t oi = 0, ooff = 0; oi < elem_outer_count; oi++, embed_id++)
                 {
-                    index_t ioff = ooff + (dim_shape.is_poly() ?
-                        ii : dim_shape.embedding[oi * elem_inner_count + ii]);
+                    index_t elem_inner_count = embed_shape.indices;
 
                     if (dim_shape.is_polyhedral())
                     {
-                        index_t_accessor subele_conn = topo->fetch_existing("subelements/connectivity").value();
-                        embed_indices.push_back(subele_conn[ioff]);
+                        elem_inner_count = subelem_sizes[entity_indices[oi]];
+                        ooff = subelem_offsets[entity_indices[oi]];
                     }
-                    else
+
+                    embed_offsets[embed_id] = embed_index;
+                    embed_parents[embed_id] = li;
+                    for(index_t ii = 0; ii < elem_inner_count; ii++)
                     {
-                        embed_indices.push_back(entity_indices[ioff % entity_indices.size()]);
+                        index_t ioff = ooff + (dim_shape.is_poly() ?
+                            ii : dim_shape.embedding[oi * elem_inner_count + ii]);
+
+                        if (dim_shape.is_polyhedral())
+                        {
+                            embed_indices[embed_index++] = subelem_conn[ioff];
+                        }
+                        else
+                        {
+                            embed_indices[embed_index++] = entity_indices[ioff % entity_size];
+                        }
                     }
+
+                    ooff += dim_shape.is_polygonal() ? 1 : 0;
                 }
+            }
+        });
+
+        level_indices.swap(embed_indices);
+        level_offsets.swap(embed_offsets);
+        level_parents.swap(embed_parents);
+    }
 
-                ooff += dim_shape.is_polygonal() ? 1 : 0;
+    // Build Association Tables //
 
-                entity_index_bag.push_back(embed_indices);
-                entity_dim_bag.push_back(embed_shape.dim);
-                entity_parent_bag.push_back(embed_parents);
-            }
+    for(index_t di = 0; di <= topo_dim; di++)
+    {
+        std::vector<index_t> &dim_iota = dim_iotas[di];
+        dim_iota.resize(dim_le2ge_maps[di].size());
+        for(index_t ii = 0; ii < (index_t)dim_iota.size(); ii++)
+        {
+            dim_iota[ii] = ii;
+        }
+    }
+    for(index_t di = 0; di <= topo_dim; di++)
+    {
+        const std::vector<index_t> &le2ge = dim_le2ge_maps[di];
+        index_t num_global = 0;
+        for(index_t li = 0; li < (index_t)le2ge.size(); li++)
+        {
+            num_global = std::max(num_global, le2ge[li] + 1);
+        }
+
+        std::vector<index_t> &offsets = dim_ge2le_offsets[di];
+        std::vector<index_t> &values = dim_ge2le_values[di];
+        offsets.assign(num_global + 1, 0);
+        for(index_t li = 0; li < (index_t)le2ge.size(); li++)
+        {
+            offsets[le2ge[li] + 1]++;
+        }
+        for(index_t gi = 0; gi < num_global; gi++)
+        {
+            offsets[gi + 1] += offsets[gi];
+        }
+        std::vector<index_t> cursors(offsets.begin(), offsets.end() - 1);
+        values.resize(le2ge.size());
+        for(index_t li = 0; li < (index_t)le2ge.size(); li++)
+        {
+            values[cursors[le2ge[li]]++] = li;
         }
     }
 
+    // NOTE: The global associations of each (entity dim, assoc dim) pair are
+    // built by 'build_global_assoc', either by the constructor or on the
+    // pair's first query.
+    const index_t num_dims = topo_dim + 1;
+    dim_gassoc_offsets.assign(num_dims * num_dims, std::vector<index_t>());
+    dim_gassoc_values.assign(num_dims * num_dims, std::vector<index_t>());
+    m_gassoc_flags.reset(new std::once_flag[num_dims * num_dims]);
+
     // Move Topological Data into Per-Dim Nodes //
 
-    for(index_t di = 0; di <= topo_shape.dim; di++)
+    Node data;
+    for(index_t di = 0; di <= topo_dim; di++)
     {
         Node &dim_conn = dim_topos[di]["elements/connectivity"];
         dim_conn.set(DataType(int_dtype.id(), dim_buffers[di].size()));
 
         data.reset();
         data.set_external(DataType::int64(dim_buffers[di].size()),
-            &(dim_buffers[di][0]));
+            dim_buffers[di].data());
         data.to_data_type(int_dtype.id(), dim_conn);
 
         // Initialize element sizes for 2D polygonal mesh generating
@@ -469,76 +1007,175 @@ TopologyMetadata::TopologyMetadata(const conduit::Node &topology, const conduit:
         if(di == 2 && topo_shape.is_polyhedral())
         {
             Node &poly_sizes = dim_topos[di]["elements/sizes"];
-            poly_sizes.set(DataType(int_dtype.id(), dim_geid_maps[di].size()));
-
-            temp.reset();
             data.reset();
-
-            for(const auto &poly_pair : dim_geid_maps[di])
-            {
-                const std::set<index_t> &poly_verts = poly_pair.first;
-                const index_t &poly_geid = poly_pair.second;
-
-                temp.set_external(DataType(int_dtype.id(), 1),
-                    poly_sizes.element_ptr(poly_geid));
-                data.set((index_t)poly_verts.size());
-                data.to_data_type(int_dtype.id(), temp);
-            }
+            data.set_external(poly_sizes_raw);
+            data.to_data_type(int_dtype.id(), poly_sizes);
         }
 
-        topology::unstructured::generate_offsets_inline(dim_topos[di]);
+        topology::unstructured::generate_offsets_inline(dim_topos[di], num_threads);
     }
 }
 
 //---------------------------------------------------------------------------//
 void
-TopologyMetadata::add_entity_assoc(IndexType type, index_t e0_id, index_t e0_dim, index_t e1_id, index_t e1_dim)
+TopologyMetadata::build_global_assoc(index_t entity_dim, index_t assoc_dim) const
 {
-    auto &assoc_maps = (type == IndexType::LOCAL) ? dim_leassocs_maps : dim_geassocs_maps;
-    std::vector< std::pair< std::vector<index_t>, std::set<index_t> > > *entity_assocs[2] = {
-        &assoc_maps[e0_dim][e0_id],
-        &assoc_maps[e1_dim][e1_id]
-    };
-
-    for(index_t ai = 0; ai < 2; ai++)
+    // NOTE: The global associations of an entity are the (unique) global ids
+    // of its local instances' associations, in order of first occurrence.
+    if(entity_dim == assoc_dim)
     {
-        auto &curr_assocs = *entity_assocs[ai];
-        curr_assocs.resize(topo_shape.dim + 1);
+        return;
+    }
 
-        const index_t cross_id = (ai == 0) ? e1_id : e0_id;
-        const index_t cross_dim = (ai == 0) ? e1_dim : e0_dim;
-        auto &cross_assocs = curr_assocs[cross_dim];
-        if(cross_assocs.second.find(cross_id) == cross_assocs.second.end())
+    const index_t num_dims = topo_shape.dim + 1;
+    const index_t pair_index = entity_dim * num_dims + assoc_dim;
+    std::call_once(m_gassoc_flags[pair_index], [&] ()
+    {
+        if(!m_has_local)
         {
-            cross_assocs.first.push_back(cross_id);
-            cross_assocs.second.insert(cross_id);
+            CONDUIT_ERROR("TopologyMetadata: the global associations from dimension "
+                          << entity_dim << " to dimension " << assoc_dim
+                          << " weren't built and the local associations "
+                          "needed to build them were released");
         }
-    }
-}
-
-
-//---------------------------------------------------------------------------//
-const std::vector<index_t>&
-TopologyMetadata::get_entity_assocs(IndexType type, index_t entity_id, index_t entity_dim, index_t assoc_dim) const
-{
-    auto &dim_assocs = (type == IndexType::LOCAL) ? dim_leassocs_maps : dim_geassocs_maps;
-    return dim_assocs[entity_dim][entity_id][assoc_dim].first;
-}
+
+        const index_t min_chunk_items = 4096;
+        const std::vector<index_t> &ge2le_offsets = dim_ge2le_offsets[entity_dim];
+        const std::vector<index_t> &ge2le_values = dim_ge2le_values[entity_dim];
+        const index_t num_global = (index_t)ge2le_offsets.size() - 1;
+        const index_t num_chunks =
+            detail::parallel_num_chunks(m_num_threads, num_global, min_chunk_items);
+
+        const std::vector<index_t> &assoc_le2ge = dim_le2ge_maps[assoc_dim];
+        const index_t assoc_num_global = (index_t)dim_ge2le_offsets[assoc_dim].size() - 1;
+        std::vector<index_t> &offsets = dim_gassoc_offsets[pair_index];
+        std::vector<index_t> &values = dim_gassoc_values[pair_index];
+        std::vector< std::vector<index_t> > chunk_values(num_chunks);
+        offsets.resize(num_global + 1);
+        offsets[0] = 0;
+
+        detail::parallel_chunks(num_chunks, num_global,
+            [&] (index_t ci, index_t gbegin, index_t gend)
+        {
+            std::vector<index_t> &cvalues = (num_chunks == 1) ? values : chunk_values[ci];
+            std::vector<index_t> assoc_marks(assoc_num_global, -1);
+            for(index_t gi = gbegin; gi < gend; gi++)
+            {
+                const index_t row_start = (index_t)cvalues.size();
+                for(index_t ii = ge2le_offsets[gi]; ii < ge2le_offsets[gi + 1]; ii++)
+                {
+                    const Span<const index_t> local_assocs =
+                        get_entity_assocs(LOCAL, ge2le_values[ii], entity_dim, assoc_dim);
+                    for(index_t ai = 0; ai < local_assocs.size(); ai++)
+                    {
+                        const index_t assoc_gid = assoc_le2ge[local_assocs[ai]];
+                        if(assoc_marks[assoc_gid] != gi)
+                        {
+                            assoc_marks[assoc_gid] = gi;
+                            cvalues.push_back(assoc_gid);
+                        }
+                    }
+                }
+                offsets[gi + 1] = (index_t)cvalues.size() - row_start;
+            }
+        });
+
+        for(index_t gi = 0; gi < num_global; gi++)
+        {
+            offsets[gi + 1] += offsets[gi];
+        }
+        if(num_chunks > 1)
+        {
+            values.resize(offsets[num_global]);
+            detail::parallel_chunks(num_chunks, num_global,
+                [&] (index_t ci, index_t gbegin, index_t /*gend*/)
+            {
+                std::copy(chunk_values[ci].begin(), chunk_values[ci].end(),
+                          values.begin() + offsets[gbegin]);
+                std::vector<index_t>().swap(chunk_values[ci]);
+            });
+        }
+    });
+}
+
+//---------------------------------------------------------------------------//
+void
+TopologyMetadata::check_dims(IndexType type, index_t entity_dim, index_t assoc_dim) const
+{
+    if(entity_dim < m_min_dim || assoc_dim < m_min_dim)
+    {
+        CONDUIT_ERROR("TopologyMetadata: dimension " << std::min(entity_dim, assoc_dim)
+                      << " wasn't built (the lowest built dimension is "
+                      << m_min_dim << ")");
+    }
+    if(type == IndexType::LOCAL && !m_has_local && entity_dim != assoc_dim)
+    {
+        CONDUIT_ERROR("TopologyMetadata: the local associations were released");
+    }
+}
+
+
+//---------------------------------------------------------------------------//
+Span<const index_t>
+TopologyMetadata::get_entity_assocs(IndexType type, index_t entity_id, index_t entity_dim, index_t assoc_dim) const
+{
+    check_dims(type, entity_dim, assoc_dim);
+
+    if(assoc_dim == entity_dim)
+    {
+        return Span<const index_t>(&dim_iotas[entity_dim][entity_id], 1);
+    }
+    else if(type == IndexType::GLOBAL)
+    {
+        build_global_assoc(entity_dim, assoc_dim);
+        const index_t pair_index = entity_dim * (topo_shape.dim + 1) + assoc_dim;
+        const std::vector<index_t> &offsets = dim_gassoc_offsets[pair_index];
+        const index_t start = offsets[entity_id];
+        return Span<const index_t>(dim_gassoc_values[pair_index].data() + start,
+                                   offsets[entity_id + 1] - start);
+    }
+    else if(assoc_dim > entity_dim)
+    {
+        const index_t num_ancestors = topo_shape.dim - entity_dim;
+        const index_t *ancestor =
+            &dim_lancestors[entity_dim][entity_id * num_ancestors + assoc_dim - entity_dim - 1];
+        return (*ancestor < 0) ? Span<const index_t>() : Span<const index_t>(ancestor, 1);
+    }
+    else // if(assoc_dim < entity_dim)
+    {
+        // the embeddings of consecutive local entities are consecutive,
+        // so all the descendants at a given dimension form one range
+        index_t start = entity_id, end = entity_id + 1;
+        for(index_t di = entity_dim; di > assoc_dim; di--)
+        {
+            start = dim_lchild_offsets[di][start];
+            end = dim_lchild_offsets[di][end];
+        }
+        return Span<const index_t>(dim_iotas[assoc_dim].data() + start, end - start);
+    }
+}
 
 
 //---------------------------------------------------------------------------//
 void
 TopologyMetadata::get_dim_map(IndexType type, index_t src_dim, index_t dst_dim, Node &map_node) const
 {
-    auto &dim_assocs = (type == IndexType::LOCAL) ? dim_leassocs_maps : dim_geassocs_maps;
+    check_dims(type, src_dim, dst_dim);
+
+    const index_t src_num_entities = (type == IndexType::LOCAL) ?
+        (index_t)dim_le2ge_maps[src_dim].size() :
+        (index_t)dim_ge2le_offsets[src_dim].size() - 1;
 
     std::vector<index_t> values, sizes, offsets;
-    for(index_t sdi = 0, so = 0; sdi < (index_t)dim_assocs[src_dim].size(); sdi++, so += sizes.back())
+    sizes.reserve(src_num_entities);
+    offsets.reserve(src_num_entities);
+    for(index_t sdi = 0, so = 0; sdi < src_num_entities; sdi++)
     {
-        const std::vector<index_t> &src_assocs = get_entity_assocs(type, sdi, src_dim, dst_dim);
+        const Span<const index_t> src_assocs = get_entity_assocs(type, sdi, src_dim, dst_dim);
         values.insert(values.end(), src_assocs.begin(), src_assocs.end());
-        sizes.push_back((index_t)src_assocs.size());
+        sizes.push_back(src_assocs.size());
         offsets.push_back(so);
+        so += src_assocs.size();
     }
 
     std::vector<index_t>* path_data[] = { &values, &sizes, &offsets };
@@ -669,7 +1306,7 @@ TopologyMetadata::get_embed_length(index_t entity_dim, index_t embed_dim) const
         }
         else
         {
-            const std::vector<index_t> &embed_ids = get_entity_assocs(
+            const Span<const index_t> embed_ids = get_entity_assocs(
                 TopologyMetadata::LOCAL, entity_index, entity_dim_back, entity_dim_back - 1);
             for(index_t ei = 0; ei < (index_t)embed_ids.size(); ei++)
             {
@@ -1547,28 +2184,112 @@ coordset::logical_dims(const conduit::Node &n, index_t *d, index_t maxdims)
 }
 
 //-----------------------------------------------------------------------------
-template<typename data_array>
-static void
-typed_minmax(const data_array &da, float64 &out_min, float64 &out_max)
+// min and max of a coordinate axis, in one (possibly threaded) pass of the
+// DataArray min_max reduction
+struct AxisMinMax
+{
+    const Node &axis;
+    float64    &out_min;
+    float64    &out_max;
+
+    template <typename T>
+    void operator()(const T *) const
+    {
+        DataArray<T> da(axis.data_ptr(), axis.dtype());
+        T min = std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::lowest();
+        if(da.number_of_elements() > 0)
+        {
+            da.min_max(min, max);
+        }
+        out_min = (float64)min;
+        out_max = (float64)max;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// min and max of a rectilinear axis, which is monotonic, from its end values
+struct RectilinearAxisMinMax
+{
+    const Node &axis;
+    float64    &out_min;
+    float64    &out_max;
+
+    template <typename T>
+    void operator()(const T *) const
+    {
+        DataArray<T> da(axis.data_ptr(), axis.dtype());
+        const index_t nelem = da.number_of_elements();
+        T min = std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::lowest();
+        if(nelem > 0)
+        {
+            min = std::min(da[0], da[nelem - 1]);
+            max = std::max(da[0], da[nelem - 1]);
+        }
+        out_min = (float64)min;
+        out_max = (float64)max;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// extents of an explicit or rectilinear coordset with device resident values,
+// from the min_max kernel of their allocator. Returns false if the kernel
+// doesn't support the values.
+static bool
+device_extents(const Node &n,
+               std::vector<float64> &cset_extents)
 {
-    // Figure out what primitive type we are dealing with
-    using T = decltype(std::declval<data_array>().min());
-    const index_t nelem = da.number_of_elements();
-    T min = std::numeric_limits<T>::max();
-    T max = std::numeric_limits<T>::lowest();
-    for(index_t i = 0; i < nelem; i++)
+    const std::string csys_type = n["type"].as_string();
+    if(csys_type == "uniform")
+    {
+        return false;
+    }
+
+    const Node &n_values = n["values"];
+    const execution::DeviceKernels *kernels =
+        execution::device_kernels(execution::device_allocator(n_values));
+    if(kernels == NULL || kernels->min_max == NULL)
+    {
+        return false;
+    }
+
+    const std::vector<std::string> csys_axes = coordset::axes(n);
+    cset_extents.clear();
+    for(size_t i = 0; i < csys_axes.size(); i++)
     {
-        min = std::min(min, da[i]);
-        max = std::max(max, da[i]);
+        float64 min = std::numeric_limits<float64>::max();
+        float64 max = std::numeric_limits<float64>::lowest();
+        const Node &axis = n_values[csys_axes[i]];
+        if(axis.dtype().number_of_elements() > 0 &&
+           !kernels->min_max(axis, min, max))
+        {
+            return false;
+        }
+        cset_extents.push_back(min);
+        cset_extents.push_back(max);
     }
-    out_min = (float64)min;
-    out_max = (float64)max;
+    return true;
 }
 
 //-----------------------------------------------------------------------------
 std::vector<float64>
 coordset::extents(const Node &n)
 {
+    const execution::Backend backend = execution::select_backend(n);
+    if(backend != execution::BACKEND_HOST)
+    {
+        std::vector<float64> device_exts;
+        if(backend == execution::BACKEND_DEVICE &&
+           device_extents(n, device_exts))
+        {
+            return device_exts;
+        }
+        Node n_host;
+        n_host.set(n);
+        return extents(n_host);
+    }
+
     std::vector<float64> cset_extents;
     const std::string csys_type = n["type"].as_string();
     const std::vector<std::string> csys_axes = coordset::axes(n);
@@ -1579,63 +2300,35 @@ coordset::extents(const Node &n)
         float64 min, max;
         if(csys_type == "uniform")
         {
-            index_t origin = 0;
+            float64 origin = 0.0;
             float64 spacing = 1.0;
             index_t dim = n["dims"][LOGICAL_AXES[i]].to_index_t();
             if(n.has_child("origin")
                 && n["origin"].has_child(csys_axes[i]))
             {
-                origin = n["origin"][csys_axes[i]].to_index_t();
+                origin = n["origin"][csys_axes[i]].to_float64();
             }
             if(n.has_child("spacing")
                 && n["spacing"].has_child("d"+csys_axes[i]))
             {
                 spacing = n["spacing"]["d" + csys_axes[i]].to_float64();
             }
-            min = (float64)origin;
-            max = (float64)origin + (spacing * ((float64)dim - 1.));
+            min = origin;
+            max = origin + (spacing * ((float64)dim - 1.));
             if(spacing < 0.)
             {
                 std::swap(min, max);
             }
         }
-        else // csys_type == "rectilinear" || csys_type == "explicit"
+        else if(csys_type == "rectilinear")
         {
-            const auto &axis = n["values"][csys_axes[i]];
-            const auto id = axis.dtype().id();
-            switch(id)
-            {
-            case conduit::DataType::INT8_ID:
-                typed_minmax(axis.as_int8_array(), min, max);
-                break;
-            case conduit::DataType::INT16_ID:
-                typed_minmax(axis.as_int16_array(), min, max);
-                break;
-            case conduit::DataType::INT32_ID:
-                typed_minmax(axis.as_int32_array(), min, max);
-                break;
-            case conduit::DataType::INT64_ID:
-                typed_minmax(axis.as_int64_array(), min, max);
-                break;
-            case conduit::DataType::UINT8_ID:
-                typed_minmax(axis.as_uint8_array(), min, max);
-                break;
-            case conduit::DataType::UINT16_ID:
-                typed_minmax(axis.as_uint16_array(), min, max);
-                break;
-            case conduit::DataType::UINT32_ID:
-                typed_minmax(axis.as_uint32_array(), min, max);
-                break;
-            case conduit::DataType::UINT64_ID:
-                typed_minmax(axis.as_uint64_array(), min, max);
-                break;
-            case conduit::DataType::FLOAT32_ID:
-                typed_minmax(axis.as_float32_array(), min, max);
-                break;
-            case conduit::DataType::FLOAT64_ID:
-                typed_minmax(axis.as_float64_array(), min, max);
-                break;
-            }
+            const Node &axis = n["values"][csys_axes[i]];
+            dispatch(axis, RectilinearAxisMinMax{axis, min, max});
+        }
+        else // csys_type == "explicit"
+        {
+            const Node &axis = n["values"][csys_axes[i]];
+            dispatch(axis, AxisMinMax{axis, min, max});
         }
         cset_extents.push_back(min);
         cset_extents.push_back(max);
@@ -1643,6 +2336,91 @@ coordset::extents(const Node &n)
     return cset_extents;
 }
 
+//-----------------------------------------------------------------------------
+std::vector<float64>
+coordset::cached_extents(Node &n)
+{
+    // uniform and rectilinear extents only read the ends of each axis,
+    // device resident values can't be hashed on the host
+    if(n["type"].as_string() != "explicit" ||
+       execution::select_backend(n["values"]) != execution::BACKEND_HOST)
+    {
+        return extents(n);
+    }
+
+    // cached hashes miss writes through arrays and pointers, so the values
+    // are hashed each call
+    const uint64 values_hash = n["values"].hash();
+
+    if(n.has_path("state/extents") &&
+       n.has_path("state/extents_hash") &&
+       n["state/extents_hash"].to_uint64() == values_hash)
+    {
+        const Node &n_exts = n["state/extents"];
+        const float64 *exts_ptr = n_exts.as_float64_ptr();
+        return std::vector<float64>(exts_ptr,
+                                    exts_ptr + n_exts.dtype().number_of_elements());
+    }
+
+    std::vector<float64> cset_extents = extents(n);
+    n["state/extents"].set(cset_extents);
+    n["state/extents_hash"].set(values_hash);
+    return cset_extents;
+}
+
+//-----------------------------------------------------------------------------
+coordset::CoordAccessor::CoordAccessor()
+: m_num_axes(0), m_num_points(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+coordset::CoordAccessor::CoordAccessor(const Node &n)
+: m_num_axes(0), m_num_points(0)
+{
+    const std::string cset_type = n["type"].as_string();
+    const std::vector<std::string> cset_axes = coordset::axes(n);
+    const bool is_uniform = cset_type == "uniform";
+    const bool is_implicit = is_uniform || cset_type == "rectilinear";
+
+    index_t dims[3] = {1, 1, 1};
+    coordset::logical_dims(n, dims, 3);
+
+    m_num_axes = std::min((index_t)cset_axes.size(), (index_t)3);
+    m_num_points = m_num_axes > 0 ? 1 : 0;
+    index_t stride = 1;
+    for(index_t ai = 0; ai < m_num_axes; ai++)
+    {
+        const std::string &axis_name = cset_axes[ai];
+        Axis &axis = m_axes[ai];
+        axis.m_uniform = is_uniform;
+        axis.m_implicit = is_implicit;
+        if(is_uniform)
+        {
+            axis.m_origin = n.has_child("origin") ?
+                n["origin"][axis_name].to_float64() : 0.0;
+            axis.m_spacing = n.has_child("spacing") ?
+                n["spacing"]["d" + axis_name].to_float64() : 1.0;
+        }
+        else
+        {
+            axis.m_values = n["values"][axis_name].as_float64_accessor();
+        }
+
+        if(is_implicit)
+        {
+            axis.m_stride = stride;
+            axis.m_dim = dims[ai];
+            stride *= dims[ai];
+            m_num_points *= dims[ai];
+        }
+        else
+        {
+            m_num_points = axis.m_values.number_of_elements();
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::blueprint::mesh::utils::coordset::uniform --
 //-----------------------------------------------------------------------------
@@ -1747,9 +2525,16 @@ topology::logical_dims(const Node &n, index_t *d, index_t maxdims)
     {
         const Node &dims = n["elements/dims"];
 
-        for(index_t i = 0; i < (index_t)dims.number_of_children(); i++)
+        // dims may also hold "offsets" and "strides" (strided structured)
+        const index_t num_dims = std::min(std::min(dims.number_of_children(),
+                                                   (index_t)3),
+                                          maxdims);
+        for(index_t i = 0; i < num_dims; i++)
         {
-            d[i] = dims[LOGICAL_AXES[i]].to_index_t();
+            if(dims.has_child(LOGICAL_AXES[i]))
+            {
+                d[i] = dims[LOGICAL_AXES[i]].to_index_t();
+            }
         }
     }
     else if(type == "points")
@@ -1825,6 +2610,84 @@ topology::coordset(const Node &n)
     return *res;
 }
 
+//-----------------------------------------------------------------------------
+// Maps global vertex ids to their index in a coordset. When the ids cover a
+// dense range the map is a flat table indexed by 'gvid - min'; otherwise it
+// is an array of (gvid, index) pairs sorted by gvid and searched. If an id
+// appears more than once the last index wins.
+//-----------------------------------------------------------------------------
+class GlobalVertexIdMap
+{
+public:
+    GlobalVertexIdMap(const index_t_accessor &gvids)
+    : m_min(0)
+    {
+        const index_t num_gvids = gvids.number_of_elements();
+        if(num_gvids == 0)
+        {
+            return;
+        }
+
+        index_t gmin = gvids[0], gmax = gvids[0];
+        for(index_t i = 1; i < num_gvids; i++)
+        {
+            gmin = std::min(gmin, gvids[i]);
+            gmax = std::max(gmax, gvids[i]);
+        }
+
+        // allow a table up to 4x the number of ids
+        const uint64 range = static_cast<uint64>(gmax) -
+                             static_cast<uint64>(gmin) + 1;
+        if(range <= 4 * static_cast<uint64>(num_gvids))
+        {
+            m_min = gmin;
+            m_table.assign(static_cast<size_t>(range), -1);
+            for(index_t i = 0; i < num_gvids; i++)
+            {
+                m_table[static_cast<size_t>(gvids[i] - gmin)] = i;
+            }
+        }
+        else
+        {
+            m_sorted.resize(static_cast<size_t>(num_gvids));
+            for(index_t i = 0; i < num_gvids; i++)
+            {
+                m_sorted[static_cast<size_t>(i)] = std::make_pair(gvids[i], i);
+            }
+            std::sort(m_sorted.begin(), m_sorted.end());
+        }
+    }
+
+    // returns -1 if 'gvid' is not in the map
+    index_t find(index_t gvid) const
+    {
+        if(!m_table.empty())
+        {
+            if(gvid < m_min ||
+               static_cast<uint64>(gvid - m_min) >= m_table.size())
+            {
+                return -1;
+            }
+            return m_table[static_cast<size_t>(gvid - m_min)];
+        }
+
+        // last pair with this gvid, the pairs are sorted by (gvid, index)
+        std::vector<std::pair<index_t,index_t>>::const_iterator itr =
+            std::upper_bound(m_sorted.begin(), m_sorted.end(),
+                std::make_pair(gvid, std::numeric_limits<index_t>::max()));
+        if(itr == m_sorted.begin() || (itr - 1)->first != gvid)
+        {
+            return -1;
+        }
+        return (itr - 1)->second;
+    }
+
+private:
+    index_t                                   m_min;
+    std::vector<index_t>                      m_table;
+    std::vector<std::pair<index_t,index_t>>   m_sorted;
+};
+
 //-----------------------------------------------------------------------------
 void
 topology::reindex_coords(const Node& topo,
@@ -1832,6 +2695,18 @@ topology::reindex_coords(const Node& topo,
                          const Node& old_gvids,
                          const Node& new_gvids,
                          Node& out_topo)
+{
+    reindex_coords(topo, new_coordset, old_gvids, new_gvids, out_topo, 1);
+}
+
+//-----------------------------------------------------------------------------
+void
+topology::reindex_coords(const Node& topo,
+                         const Node& new_coordset,
+                         const Node& old_gvids,
+                         const Node& new_gvids,
+                         Node& out_topo,
+                         index_t num_threads)
 {
     if (&out_topo != &topo)
     {
@@ -1840,14 +2715,7 @@ topology::reindex_coords(const Node& topo,
     }
 
     // Build a mapping of global vids -> new coordset indices
-    // TODO: if we assume clustering of gvids, maybe a vector would be faster?
-    std::unordered_map<index_t, index_t> remap_vids;
-
-    index_t_accessor new_gvid_vals = new_gvids["values"].as_index_t_accessor();
-    for (index_t idx = 0; idx < new_gvid_vals.number_of_elements(); idx++)
-    {
-        remap_vids[new_gvid_vals[idx]] = idx;
-    }
+    const GlobalVertexIdMap remap_vids(new_gvids["values"].as_index_t_accessor());
 
     std::string node_path = "elements/connectivity";
     if (out_topo["elements/shape"].as_string() == "polyhedral")
@@ -1855,15 +2723,27 @@ topology::reindex_coords(const Node& topo,
         node_path = "subelements/connectivity";
     }
 
-    index_t_accessor old_vids = out_topo[node_path].as_index_t_accessor();
-    index_t_accessor old_to_gvids = old_gvids["values"].as_index_t_accessor();
-    std::vector<index_t> new_vids(old_vids.number_of_elements());
-    for (index_t idx = 0; idx < static_cast<index_t>(new_vids.size()); idx++)
+    const index_t_accessor old_vids = out_topo[node_path].as_index_t_accessor();
+    const index_t_accessor old_to_gvids = old_gvids["values"].as_index_t_accessor();
+    const index_t num_vids = old_vids.number_of_elements();
+    std::vector<index_t> new_vids(static_cast<size_t>(num_vids));
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, num_vids, 65536),
+        num_vids,
+        [&] (index_t /*ci*/, index_t vbegin, index_t vend)
     {
-        index_t old_vid = old_vids[idx];
-        index_t gvid = old_to_gvids[old_vid];
-        new_vids[idx] = remap_vids[gvid];
-    }
+        for (index_t idx = vbegin; idx < vend; idx++)
+        {
+            const index_t gvid = old_to_gvids[old_vids[idx]];
+            const index_t new_vid = remap_vids.find(gvid);
+            if (new_vid < 0)
+            {
+                CONDUIT_ERROR("reindex_coords: global vertex id " << gvid
+                              << " is not in the new coordset");
+            }
+            new_vids[static_cast<size_t>(idx)] = new_vid;
+        }
+    });
 
     // Set the new vertex connectivity
     out_topo[node_path].set(new_vids);
@@ -1875,6 +2755,14 @@ topology::reindex_coords(const Node& topo,
 //-----------------------------------------------------------------------------
 void
 topology::unstructured::generate_offsets_inline(Node &topo)
+{
+    generate_offsets_inline(topo, 1);
+}
+
+//-----------------------------------------------------------------------------
+void
+topology::unstructured::generate_offsets_inline(Node &topo,
+                                                index_t num_threads)
 {
     // check for polyhedral case
     if(topo.has_child("subelements"))
@@ -1888,7 +2776,8 @@ topology::unstructured::generate_offsets_inline(Node &topo)
         {
             blueprint::mesh::utils::topology::unstructured::generate_offsets(topo,
                                                                              topo["elements/offsets"],
-                                                                             topo["subelements/offsets"]);
+                                                                             topo["subelements/offsets"],
+                                                                             num_threads);
         }
 
     }
@@ -1898,8 +2787,11 @@ topology::unstructured::generate_offsets_inline(Node &topo)
         if( !topo["elements"].has_child("offsets") || 
             topo["elements/offsets"].dtype().is_empty())
         {
+            Node subele_offsets;
             blueprint::mesh::utils::topology::unstructured::generate_offsets(topo,
-                                                                             topo["elements/offsets"]);
+                                                                             topo["elements/offsets"],
+                                                                             subele_offsets,
+                                                                             num_threads);
         }
     }
 }
@@ -1915,74 +2807,334 @@ topology::unstructured::generate_offsets(const Node &topo,
 }
 
 //-----------------------------------------------------------------------------
-void
-topology::unstructured::generate_offsets(const Node &topo,
-                                         Node &dest_ele_offsets,
-                                         Node &dest_subele_offsets)
-{
-    dest_ele_offsets.reset();
-    dest_subele_offsets.reset();
-
-    const ShapeType topo_shape(topo);
-    const DataType int_dtype = find_widest_dtype(topo, DEFAULT_INT_DTYPES);
-    std::string key("elements/connectivity"), stream_key("elements/stream");
-
-    if(!topo.has_path(key))
-        key = stream_key;
-    const Node &topo_conn = topo[key];
-
-    const DataType topo_dtype(topo_conn.dtype().id(), 1, 0, 0,
-        topo_conn.dtype().element_bytes(), topo_conn.dtype().endianness());
+// Offsets are written directly in the integer type 'T' they are emitted in,
+// so int32 topologies never pass through widened temporaries. Work is split
+// into chunks of at least 'OFFSETS_MIN_CHUNK' elements over 'num_threads'.
+//-----------------------------------------------------------------------------
+static const index_t OFFSETS_MIN_CHUNK = 16384;
 
-    // if these have already been generate, use set external to copy out results
-    if(topo_shape.type == "polyhedral")
+//-----------------------------------------------------------------------------
+template<typename T>
+static void
+typed_fixed_offsets(const index_t num_shapes,
+                    const index_t shape_indices,
+                    const index_t num_threads,
+                    Node &dest)
+{
+    dest.set(DataType(conduit::detail::DataViewTypeId<T>::id, num_shapes));
+    T *offsets = static_cast<T*>(dest.data_ptr());
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, num_shapes, OFFSETS_MIN_CHUNK),
+        num_shapes,
+        [&] (index_t /*ci*/, index_t sbegin, index_t send)
     {
-    
-        if( (topo["elements"].has_child("offsets") &&
-             !topo["elements/offsets"].dtype().is_empty())  &&
-             (topo["subelements"].has_child("offsets") &&
-             !topo["subelements/offsets"].dtype().is_empty())
-          )
+        for(index_t s = sbegin; s < send; s++)
         {
-            // they are already here, set external and return
-            if(&dest_ele_offsets != &topo["elements/offsets"])
-            {
-                dest_ele_offsets.set_external(topo["elements/offsets"]);
-            }
-            if(&dest_subele_offsets != &topo["subelements/offsets"])
-            {
-                dest_subele_offsets.set_external(topo["subelements/offsets"]);
-            }
-            // we are done
-            return;
+            offsets[s] = static_cast<T>(s * shape_indices);
         }
-    }
-    else // non polyhedral
+    });
+}
+
+//-----------------------------------------------------------------------------
+// Exclusive prefix sum of 'sizes' into 'offsets'. With more than one chunk,
+// the first pass sums each chunk's sizes, and the second pass writes each
+// chunk's offsets starting from the sum of the chunks before it.
+//-----------------------------------------------------------------------------
+template<typename T, typename SizesView>
+static void
+typed_prefix_offsets(const SizesView &sizes,
+                     const index_t num_sizes,
+                     const index_t num_threads,
+                     T *offsets)
+{
+    const index_t num_chunks =
+        detail::parallel_num_chunks(num_threads, num_sizes, OFFSETS_MIN_CHUNK);
+    if(num_chunks <= 1)
     {
-        if( topo["elements"].has_child("offsets") &&
-            !topo["elements/offsets"].dtype().is_empty()
-          )
+        T offset = 0;
+        for(index_t i = 0; i < num_sizes; i++)
         {
-            // they are already here, set external and return
-            if(&dest_ele_offsets != &topo["elements/offsets"])
-            {
-                dest_ele_offsets.set_external(topo["elements/offsets"]);
-            }
-            return;
+            offsets[i] = offset;
+            offset += static_cast<T>(sizes[i]);
         }
+        return;
     }
 
-    ///
-    /// Generate Cases
-    ///
-    if(topo.has_path(stream_key))
+    std::vector<T> chunk_offsets((size_t)(num_chunks + 1), 0);
+    detail::parallel_chunks(num_chunks, num_sizes,
+        [&] (index_t ci, index_t ibegin, index_t iend)
     {
-        ///
-        /// TODO STREAM TOPOS ARE DEPRECATED
-        ///
-        // Mixed element types
-        std::map<int,int> stream_id_npts;
-        const conduit::Node &n_element_types = topo["elements/element_types"];
+        T chunk_size = 0;
+        for(index_t i = ibegin; i < iend; i++)
+        {
+            chunk_size += static_cast<T>(sizes[i]);
+        }
+        chunk_offsets[ci + 1] = chunk_size;
+    });
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                     chunk_offsets.begin());
+    detail::parallel_chunks(num_chunks, num_sizes,
+        [&] (index_t ci, index_t ibegin, index_t iend)
+    {
+        T offset = chunk_offsets[ci];
+        for(index_t i = ibegin; i < iend; i++)
+        {
+            offsets[i] = offset;
+            offset += static_cast<T>(sizes[i]);
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static void
+typed_sizes_to_offsets(const Node &sizes,
+                       const index_t num_threads,
+                       Node &dest)
+{
+    const index_t num_sizes = sizes.dtype().number_of_elements();
+    dest.set(DataType(conduit::detail::DataViewTypeId<T>::id, num_sizes));
+    T *offsets = static_cast<T*>(dest.data_ptr());
+
+    // sizes that already use the offset type are read in place
+    if(sizes.dtype().id() == conduit::detail::DataViewTypeId<T>::id)
+    {
+        typed_prefix_offsets(sizes.as_strided_view<T>(), num_sizes,
+                             num_threads, offsets);
+    }
+    else
+    {
+        typed_prefix_offsets(sizes.as_index_t_accessor(), num_sizes,
+                             num_threads, offsets);
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+typed_sizes_to_offsets(const Node &sizes,
+                       const DataType &int_dtype,
+                       const index_t num_threads,
+                       Node &dest)
+{
+    if(int_dtype.is_int32())
+    {
+        typed_sizes_to_offsets<int32>(sizes, num_threads, dest);
+    }
+    else if(int_dtype.is_int64())
+    {
+        typed_sizes_to_offsets<int64>(sizes, num_threads, dest);
+    }
+    else
+    {
+        Node offsets;
+        typed_sizes_to_offsets<int64>(sizes, num_threads, offsets);
+        offsets.to_data_type(int_dtype.id(), dest);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// offsets of a single shape topology
+//-----------------------------------------------------------------------------
+static void
+fixed_offsets(const index_t num_shapes,
+              const index_t shape_indices,
+              const DataType &int_dtype,
+              const index_t num_threads,
+              Node &dest)
+{
+    if(int_dtype.is_int32())
+    {
+        typed_fixed_offsets<int32>(num_shapes, shape_indices,
+                                   num_threads, dest);
+    }
+    else if(int_dtype.is_int64())
+    {
+        typed_fixed_offsets<int64>(num_shapes, shape_indices,
+                                   num_threads, dest);
+    }
+    else
+    {
+        Node shape_node;
+        typed_fixed_offsets<int64>(num_shapes, shape_indices,
+                                   num_threads, shape_node);
+        shape_node.to_data_type(int_dtype.id(), dest);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Offsets of device resident sizes, from the exclusive_scan kernel of their
+// allocator. dest uses the same allocator.
+//-----------------------------------------------------------------------------
+static bool
+device_sizes_to_offsets(const Node &sizes,
+                        const DataType &int_dtype,
+                        Node &dest)
+{
+    const index_t alloc_id = execution::device_allocator(sizes);
+    const execution::DeviceKernels *kernels = execution::device_kernels(alloc_id);
+    if(kernels == NULL || kernels->exclusive_scan == NULL)
+    {
+        return false;
+    }
+
+    const index_t dest_alloc_id = dest.allocator();
+    dest.reset();
+    dest.set_allocator(alloc_id);
+    dest.set(DataType(int_dtype.id(), sizes.dtype().number_of_elements()));
+    if(!kernels->exclusive_scan(sizes, dest))
+    {
+        dest.reset();
+        dest.set_allocator(dest_alloc_id);
+        return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Device path of 'generate_offsets'. Offsets of single shape topologies
+// don't depend on the data, they are generated on the host and copied to
+// the connectivity's allocator. Returns false for stream and mixed
+// topologies and if the kernels don't support the sizes.
+//-----------------------------------------------------------------------------
+static bool
+device_offsets(const Node &topo,
+               const ShapeType &topo_shape,
+               const DataType &int_dtype,
+               const index_t num_threads,
+               Node &dest_ele_offsets,
+               Node &dest_subele_offsets)
+{
+    if(!topo.has_path("elements/connectivity") || topo_shape.type == "mixed")
+    {
+        return false;
+    }
+
+    if(!topo_shape.is_poly())
+    {
+        const Node &topo_conn = topo["elements/connectivity"];
+        const index_t alloc_id = execution::device_allocator(topo_conn);
+        if(alloc_id < 0)
+        {
+            return false;
+        }
+
+        Node host_offsets;
+        fixed_offsets(topo_conn.dtype().number_of_elements() / topo_shape.indices,
+                      topo_shape.indices, int_dtype, num_threads, host_offsets);
+        dest_ele_offsets.reset();
+        dest_ele_offsets.set_allocator(alloc_id);
+        dest_ele_offsets.set(host_offsets);
+        return true;
+    }
+
+    if(!device_sizes_to_offsets(topo["elements/sizes"], int_dtype,
+                                dest_ele_offsets))
+    {
+        return false;
+    }
+    return !topo_shape.is_polyhedral() ||
+           device_sizes_to_offsets(topo["subelements/sizes"], int_dtype,
+                                   dest_subele_offsets);
+}
+
+//-----------------------------------------------------------------------------
+void
+topology::unstructured::generate_offsets(const Node &topo,
+                                         Node &dest_ele_offsets,
+                                         Node &dest_subele_offsets)
+{
+    generate_offsets(topo, dest_ele_offsets, dest_subele_offsets, 1);
+}
+
+//-----------------------------------------------------------------------------
+void
+topology::unstructured::generate_offsets(const Node &topo,
+                                         Node &dest_ele_offsets,
+                                         Node &dest_subele_offsets,
+                                         index_t num_threads)
+{
+    dest_ele_offsets.reset();
+    dest_subele_offsets.reset();
+
+    const ShapeType topo_shape(topo);
+    const DataType int_dtype = find_widest_dtype(topo, DEFAULT_INT_DTYPES);
+    std::string key("elements/connectivity"), stream_key("elements/stream");
+
+    if(!topo.has_path(key))
+        key = stream_key;
+    const Node &topo_conn = topo[key];
+
+    const DataType topo_dtype(topo_conn.dtype().id(), 1, 0, 0,
+        topo_conn.dtype().element_bytes(), topo_conn.dtype().endianness());
+
+    // if these have already been generate, use set external to copy out results
+    if(topo_shape.type == "polyhedral")
+    {
+    
+        if( (topo["elements"].has_child("offsets") &&
+             !topo["elements/offsets"].dtype().is_empty())  &&
+             (topo["subelements"].has_child("offsets") &&
+             !topo["subelements/offsets"].dtype().is_empty())
+          )
+        {
+            // they are already here, set external and return
+            if(&dest_ele_offsets != &topo["elements/offsets"])
+            {
+                dest_ele_offsets.set_external(topo["elements/offsets"]);
+            }
+            if(&dest_subele_offsets != &topo["subelements/offsets"])
+            {
+                dest_subele_offsets.set_external(topo["subelements/offsets"]);
+            }
+            // we are done
+            return;
+        }
+    }
+    else // non polyhedral
+    {
+        if( topo["elements"].has_child("offsets") &&
+            !topo["elements/offsets"].dtype().is_empty()
+          )
+        {
+            // they are already here, set external and return
+            if(&dest_ele_offsets != &topo["elements/offsets"])
+            {
+                dest_ele_offsets.set_external(topo["elements/offsets"]);
+            }
+            return;
+        }
+    }
+
+    const execution::Backend backend = execution::select_backend(topo);
+    if(backend != execution::BACKEND_HOST)
+    {
+        if(backend == execution::BACKEND_DEVICE &&
+           device_offsets(topo, topo_shape, int_dtype, num_threads,
+                          dest_ele_offsets, dest_subele_offsets))
+        {
+            return;
+        }
+
+        Node host_topo, host_ele_offsets, host_subele_offsets;
+        host_topo.set(topo);
+        generate_offsets(host_topo, host_ele_offsets, host_subele_offsets,
+                         num_threads);
+        dest_ele_offsets.set(host_ele_offsets);
+        dest_subele_offsets.set(host_subele_offsets);
+        return;
+    }
+
+    ///
+    /// Generate Cases
+    ///
+    if(topo.has_path(stream_key))
+    {
+        ///
+        /// TODO STREAM TOPOS ARE DEPRECATED
+        ///
+        // Mixed element types
+        std::map<int,int> stream_id_npts;
+        const conduit::Node &n_element_types = topo["elements/element_types"];
         for(index_t i = 0; i < n_element_types.number_of_children(); i++)
         {
             const Node &n_et = n_element_types[i];
@@ -2070,61 +3222,20 @@ topology::unstructured::generate_offsets(const Node &topo,
         // Single element type
         const index_t num_topo_shapes =
             topo_conn.dtype().number_of_elements() / topo_shape.indices;
-
-        Node shape_node(DataType::int64(num_topo_shapes));
-        int64_array shape_array = shape_node.as_int64_array();
-        for(index_t s = 0; s < num_topo_shapes; s++)
-        {
-            shape_array[s] = s * topo_shape.indices;
-        }
-        shape_node.to_data_type(int_dtype.id(), dest_ele_offsets);
+        fixed_offsets(num_topo_shapes, topo_shape.indices, int_dtype,
+                      num_threads, dest_ele_offsets);
     }
     else if(topo_shape.type == "polygonal")
     {
-        const Node &topo_size = topo["elements/sizes"];
-        int64_accessor topo_sizes = topo_size.as_int64_accessor();
-        std::vector<int64> shape_array;
-        index_t i = 0;
-        index_t s = 0;
-        while(i < topo_size.dtype().number_of_elements())
-        {
-            shape_array.push_back(s);
-            s += topo_sizes[i];
-            i++;
-        }
-
-        Node shape_node;
-        shape_node.set_external(shape_array);
-        shape_node.to_data_type(int_dtype.id(), dest_ele_offsets);
+        typed_sizes_to_offsets(topo["elements/sizes"], int_dtype,
+                               num_threads, dest_ele_offsets);
     }
     else if(topo_shape.type == "polyhedral")
     {
-        index_t_accessor topo_elem_size = topo["elements/sizes"].value();
-        index_t_accessor topo_subelem_size = topo["subelements/sizes"].value();
-
-        index_t es_count = topo_elem_size.number_of_elements();
-
-        dest_ele_offsets.set(DataType::index_t(es_count));
-        index_t_array shape_array = dest_ele_offsets.value();
-
-        index_t es = 0;
-        for (index_t ei = 0; ei < es_count; ++ei)
-        {
-            shape_array[ei] = es;
-            es += topo_elem_size[ei];
-        }
-
-        int ses_count = topo_subelem_size.number_of_elements();
-
-        dest_subele_offsets.set(DataType::index_t(ses_count));
-        index_t_array subshape_array = dest_subele_offsets.value();
-
-        index_t ses = 0;
-        for (index_t ei = 0; ei < ses_count; ++ei)
-        {
-            subshape_array[ei] = ses;
-            ses += topo_subelem_size[ei];
-        }
+        typed_sizes_to_offsets(topo["elements/sizes"], int_dtype,
+                               num_threads, dest_ele_offsets);
+        typed_sizes_to_offsets(topo["subelements/sizes"], int_dtype,
+                               num_threads, dest_subele_offsets);
     }
 }
 
@@ -2198,59 +3309,1319 @@ topology::unstructured::points(const Node &n,
 }
 
 //-----------------------------------------------------------------------------
-// -- end conduit::blueprint::mesh::utils::topology --
-//-----------------------------------------------------------------------------
+// true for the topologies iterate_fixed_elements supports: structured
+// topologies and single (non poly) shape unstructured topologies
+static bool
+has_fixed_element_shape(const Node &topo)
+{
+    const std::string topo_type = topo["type"].as_string();
+    if(topo_type == "uniform" ||
+       topo_type == "rectilinear" ||
+       topo_type == "structured")
+    {
+        const index_t dimension = topology::dims(topo);
+        return dimension >= 1 && dimension <= 3;
+    }
+    else if(topo_type == "unstructured")
+    {
+        const Node *shape = topo.fetch_ptr("elements/shape");
+        if(shape != NULL && shape->dtype().is_string())
+        {
+            const ShapeType st(shape->as_string());
+            return st.is_valid() && !st.is_poly() && st.type != "mixed";
+        }
+    }
+    return false;
+}
 
 //-----------------------------------------------------------------------------
-// -- begin conduit::blueprint::mesh::utils::adjset --
+// Element functor for 'iterate_fixed_elements_parallel' that copies the
+// point ids of each element to 'ids' (S's number of indices per element).
+struct FixedElementIdsKernel
+{
+    explicit FixedElementIdsKernel(index_t *ids)
+    : m_ids(ids)
+    {}
+
+    template<topology::ShapeId S>
+    void operator()(const topology::fixed_entity<S> &e) const
+    {
+        const index_t num_indices = topology::fixed_shape_indices<S>::value;
+        index_t *ids = m_ids + e.entity_id * num_indices;
+        for(index_t pi = 0; pi < num_indices; pi++)
+        {
+            ids[pi] = e.element_ids[pi];
+        }
+    }
+
+    index_t *m_ids;
+};
+
 //-----------------------------------------------------------------------------
+// number of ids in [begin, end) that don't repeat an earlier id of the range
+static index_t
+count_unique_ids(const index_t *begin, const index_t *end)
+{
+    index_t res = 0;
+    for(const index_t *id = begin; id != end; id++)
+    {
+        res += (std::find(begin, id, *id) == id) ? 1 : 0;
+    }
+    return res;
+}
 
 //-----------------------------------------------------------------------------
 void
-adjset::canonicalize(Node &adjset)
+topology::element_vertices(const Node &topo,
+                           index_t num_threads,
+                           std::vector<index_t> &offsets,
+                           std::vector<index_t> &vertices)
 {
-    const index_t domain_id = find_domain_id(adjset);
-
-    const std::vector<std::string> &adjset_group_names = adjset["groups"].child_names();
-    for(const std::string &old_group_name : adjset_group_names)
+    // Raw Adjacency (vertices may repeat within an element) //
+
+    std::vector<index_t> raw_offsets, raw_ids;
+    const Node *shape = topo.fetch_ptr("elements/shape");
+    const bool is_polygonal = topo["type"].as_string() == "unstructured" &&
+        shape != NULL && shape->dtype().is_string() &&
+        shape->as_string() == "polygonal";
+    if(has_fixed_element_shape(topo))
     {
-        const Node &group_node = adjset["groups"][old_group_name];
-        const Node &neighbors_node = group_node["neighbors"];
-
-        std::string new_group_name;
+        const index_t num_indices =
+            ShapeType((index_t)topology::impl::fixed_shape_id(topo)).indices;
+        const index_t num_elems = topology::length(topo);
+        raw_offsets.resize((size_t)num_elems + 1);
+        for(index_t ei = 0; ei <= num_elems; ei++)
         {
-            std::ostringstream oss;
-            oss << "group";
-
-            Node temp;
-            DataType temp_dtype(neighbors_node.dtype().id(), 1);
+            raw_offsets[ei] = ei * num_indices;
+        }
+        raw_ids.resize((size_t)(num_elems * num_indices));
+        topology::iterate_fixed_elements_parallel(topo, num_threads,
+            FixedElementIdsKernel(raw_ids.data()));
+    }
+    else if(is_polygonal)
+    {
+        const Node &elems = topo["elements"];
+        Node offsets_node;
+        if(elems.has_child("offsets") && !elems["offsets"].dtype().is_empty())
+        {
+            offsets_node.set_external(elems["offsets"]);
+        }
+        else
+        {
+            topology::unstructured::generate_offsets(topo, offsets_node);
+        }
 
-            // NOTE(JRC): Need to use a vector instead of direct 'Node::to_index_t'
-            // because the local node ID isn't included in the neighbor list and
-            // 'DataArray' uses a static array size.
-            std::vector<index_t> group_neighbors(1, domain_id);
-            for(index_t ni = 0; ni < neighbors_node.dtype().number_of_elements(); ni++)
+        const index_t_accessor conn = elems["connectivity"].as_index_t_accessor();
+        const index_t_accessor sizes = elems["sizes"].as_index_t_accessor();
+        const index_t_accessor offs = offsets_node.as_index_t_accessor();
+        const index_t num_elems = sizes.number_of_elements();
+        raw_offsets.resize((size_t)num_elems + 1);
+        raw_offsets[0] = 0;
+        for(index_t ei = 0; ei < num_elems; ei++)
+        {
+            raw_offsets[ei + 1] = raw_offsets[ei] + sizes[ei];
+        }
+        raw_ids.resize((size_t)raw_offsets[num_elems]);
+        detail::parallel_chunks(
+            detail::parallel_num_chunks(num_threads, num_elems, 1024), num_elems,
+            [&](index_t /*ci*/, index_t begin, index_t end)
+        {
+            for(index_t ei = begin; ei < end; ei++)
             {
-                temp.set_external(temp_dtype, (void*)neighbors_node.element_ptr(ni));
-                group_neighbors.push_back(temp.to_index_t());
+                const index_t src = offs[ei];
+                for(index_t pi = raw_offsets[ei]; pi < raw_offsets[ei + 1]; pi++)
+                {
+                    raw_ids[pi] = conn[src + pi - raw_offsets[ei]];
+                }
             }
-            std::sort(group_neighbors.begin(), group_neighbors.end());
-
-            for(const index_t &neighbor_id : group_neighbors)
+        });
+    }
+    else
+    {
+        raw_offsets.push_back(0);
+        topology::iterate_elements(topo, [&](const topology::entity &e)
+        {
+            if(e.shape.is_polyhedral())
             {
-                oss << "_" << neighbor_id;
+                for(const std::vector<index_t> &face : e.subelement_ids)
+                {
+                    raw_ids.insert(raw_ids.end(), face.begin(), face.end());
+                }
+            }
+            else
+            {
+                raw_ids.insert(raw_ids.end(), e.element_ids.begin(), e.element_ids.end());
             }
+            raw_offsets.push_back((index_t)raw_ids.size());
+        });
+    }
 
-            new_group_name = oss.str();
+    // Compaction (keeps the first of repeated vertices) //
+
+    const index_t num_elems = (index_t)raw_offsets.size() - 1;
+    const index_t num_chunks = detail::parallel_num_chunks(num_threads, num_elems, 1024);
+    offsets.resize((size_t)num_elems + 1);
+    detail::parallel_chunks(num_chunks, num_elems,
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        for(index_t ei = begin; ei < end; ei++)
+        {
+            offsets[ei + 1] = count_unique_ids(raw_ids.data() + raw_offsets[ei],
+                                               raw_ids.data() + raw_offsets[ei + 1]);
         }
+    });
 
-        adjset["groups"].rename_child(old_group_name, new_group_name);
+    offsets[0] = 0;
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        offsets[ei + 1] += offsets[ei];
     }
+
+    vertices.resize((size_t)offsets[num_elems]);
+    detail::parallel_chunks(num_chunks, num_elems,
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        for(index_t ei = begin; ei < end; ei++)
+        {
+            const index_t *ids_begin = raw_ids.data() + raw_offsets[ei];
+            const index_t *ids_end = raw_ids.data() + raw_offsets[ei + 1];
+            index_t vi = offsets[ei];
+            for(const index_t *id = ids_begin; id != ids_end; id++)
+            {
+                if(std::find(ids_begin, id, *id) == id)
+                {
+                    vertices[vi++] = *id;
+                }
+            }
+        }
+    });
 }
 
 //-----------------------------------------------------------------------------
-// -- end conduit::blueprint::mesh::utils::adjset --
-//-----------------------------------------------------------------------------
+void
+topology::invert_adjacency(const std::vector<index_t> &offsets,
+                           const std::vector<index_t> &values,
+                           index_t num_targets,
+                           index_t num_threads,
+                           std::vector<index_t> &res_offsets,
+                           std::vector<index_t> &res_values)
+{
+    const index_t num_sources = (index_t)offsets.size() - 1;
+    const index_t num_chunks = detail::parallel_num_chunks(num_threads, num_sources, 1024);
+
+    // each chunk counts the entries of its sources per target, the counts
+    // then become the positions the chunk writes its entries to
+    std::vector<std::vector<index_t> > chunk_pos((size_t)num_chunks);
+    detail::parallel_chunks(num_chunks, num_sources,
+        [&](index_t ci, index_t begin, index_t end)
+    {
+        std::vector<index_t> &counts = chunk_pos[ci];
+        counts.assign((size_t)num_targets, 0);
+        for(index_t vi = offsets[begin]; vi < offsets[end]; vi++)
+        {
+            const index_t target = values[vi];
+            if(target < 0 || target >= num_targets)
+            {
+                CONDUIT_ERROR("invert_adjacency: target " << target
+                              << " is out of range [0, " << num_targets << ")");
+            }
+            counts[target]++;
+        }
+    });
+
+    res_offsets.resize((size_t)num_targets + 1);
+    index_t num_entries = 0;
+    for(index_t ti = 0; ti < num_targets; ti++)
+    {
+        res_offsets[ti] = num_entries;
+        for(index_t ci = 0; ci < num_chunks; ci++)
+        {
+            const index_t count = chunk_pos[ci][ti];
+            chunk_pos[ci][ti] = num_entries;
+            num_entries += count;
+        }
+    }
+    res_offsets[num_targets] = num_entries;
+
+    res_values.resize((size_t)num_entries);
+    detail::parallel_chunks(num_chunks, num_sources,
+        [&](index_t ci, index_t begin, index_t end)
+    {
+        std::vector<index_t> &pos = chunk_pos[ci];
+        for(index_t si = begin; si < end; si++)
+        {
+            for(index_t vi = offsets[si]; vi < offsets[si + 1]; vi++)
+            {
+                res_values[pos[values[vi]]++] = si;
+            }
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::utils::topology --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::utils::adjset --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+adjset::canonicalize(Node &adjset)
+{
+    canonicalize(adjset, find_domain_id(adjset));
+}
+
+//-----------------------------------------------------------------------------
+void
+adjset::canonicalize(Node &adjset, index_t domain_id)
+{
+    const std::vector<std::string> &adjset_group_names = adjset["groups"].child_names();
+    for(const std::string &old_group_name : adjset_group_names)
+    {
+        const Node &group_node = adjset["groups"][old_group_name];
+        index_t_accessor group_nvals = group_node["neighbors"].as_index_t_accessor();
+
+        std::string new_group_name;
+        {
+            std::ostringstream oss;
+            oss << "group";
+
+            std::vector<index_t> group_neighbors(1, domain_id);
+            for(index_t ni = 0; ni < group_nvals.number_of_elements(); ni++)
+            {
+                group_neighbors.push_back(group_nvals[ni]);
+            }
+            std::sort(group_neighbors.begin(), group_neighbors.end());
+
+            for(const index_t &neighbor_id : group_neighbors)
+            {
+                oss << "_" << neighbor_id;
+            }
+
+            new_group_name = oss.str();
+        }
+
+        adjset["groups"].rename_child(old_group_name, new_group_name);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Reads the neighbors and values of the groups of adjset, in sorted group
+// name order, into flat arrays: group gi has neighbors
+// [nbrs_offsets[gi], nbrs_offsets[gi+1]) and values
+// [vals_offsets[gi], vals_offsets[gi+1]).
+static void
+adjset_flat_groups(const Node &adjset,
+                   std::vector<index_t> &nbrs_offsets,
+                   std::vector<index_t> &nbrs,
+                   std::vector<index_t> &vals_offsets,
+                   std::vector<index_t> &vals)
+{
+    // NOTE(JRC): We assume that group names are shared across ranks, but
+    // make no assumptions on the uniqueness of a set of neighbors for a group
+    // (i.e. the same set of neighbors can be used in >1 groups).
+    std::vector<std::string> group_names = adjset["groups"].child_names();
+    std::sort(group_names.begin(), group_names.end());
+
+    nbrs_offsets.assign(1, 0);
+    vals_offsets.assign(1, 0);
+    nbrs.clear();
+    vals.clear();
+    for(const std::string &group_name : group_names)
+    {
+        const Node &group_node = adjset["groups"][group_name];
+        index_t_accessor group_nvals = group_node["neighbors"].as_index_t_accessor();
+        index_t_accessor group_vals = group_node["values"].as_index_t_accessor();
+        for(index_t ni = 0; ni < group_nvals.number_of_elements(); ni++)
+        {
+            nbrs.push_back(group_nvals[ni]);
+        }
+        for(index_t vi = 0; vi < group_vals.number_of_elements(); vi++)
+        {
+            vals.push_back(group_vals[vi]);
+        }
+        nbrs_offsets.push_back((index_t)nbrs.size());
+        vals_offsets.push_back((index_t)vals.size());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+adjset::pairwise_values(const Node &adjset,
+                        std::vector<index_t> &nbrs,
+                        std::vector<index_t> &offsets,
+                        std::vector<index_t> &values)
+{
+    std::vector<index_t> grp_nbrs_offsets, grp_nbrs, grp_vals_offsets, grp_vals;
+    adjset_flat_groups(adjset, grp_nbrs_offsets, grp_nbrs,
+                       grp_vals_offsets, grp_vals);
+    const index_t num_groups = (index_t)grp_nbrs_offsets.size() - 1;
+
+    nbrs = grp_nbrs;
+    std::sort(nbrs.begin(), nbrs.end());
+    nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+    const auto nbr_slot = [&] (index_t nbr)
+    {
+        return (index_t)(std::lower_bound(nbrs.begin(), nbrs.end(), nbr) - nbrs.begin());
+    };
+
+    // a counting sort of the (neighbor, value) pairs on their neighbor,
+    // which keeps the group order of each neighbor's values
+    offsets.assign(nbrs.size() + 1, 0);
+    for(index_t gi = 0; gi < num_groups; gi++)
+    {
+        const index_t nvals = grp_vals_offsets[gi + 1] - grp_vals_offsets[gi];
+        for(index_t ni = grp_nbrs_offsets[gi]; ni < grp_nbrs_offsets[gi + 1]; ni++)
+        {
+            offsets[nbr_slot(grp_nbrs[ni]) + 1] += nvals;
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    values.resize(offsets.back());
+    std::vector<index_t> cursor(offsets.begin(), offsets.end() - 1);
+    for(index_t gi = 0; gi < num_groups; gi++)
+    {
+        for(index_t ni = grp_nbrs_offsets[gi]; ni < grp_nbrs_offsets[gi + 1]; ni++)
+        {
+            index_t &pos = cursor[nbr_slot(grp_nbrs[ni])];
+            std::copy(grp_vals.begin() + grp_vals_offsets[gi],
+                      grp_vals.begin() + grp_vals_offsets[gi + 1],
+                      values.begin() + pos);
+            pos += grp_vals_offsets[gi + 1] - grp_vals_offsets[gi];
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+adjset::maxshare_values(const Node &adjset,
+                        std::vector<index_t> &nbrs_offsets,
+                        std::vector<index_t> &nbrs,
+                        std::vector<index_t> &values_offsets,
+                        std::vector<index_t> &values)
+{
+    std::vector<index_t> grp_nbrs_offsets, grp_nbrs, grp_vals_offsets, grp_vals;
+    adjset_flat_groups(adjset, grp_nbrs_offsets, grp_nbrs,
+                       grp_vals_offsets, grp_vals);
+    const index_t num_groups = (index_t)grp_nbrs_offsets.size() - 1;
+
+    // the unique entities
+    std::vector<index_t> ents = grp_vals;
+    std::sort(ents.begin(), ents.end());
+    ents.erase(std::unique(ents.begin(), ents.end()), ents.end());
+    const index_t num_ents = (index_t)ents.size();
+    const auto ent_slot = [&] (index_t ent)
+    {
+        return (index_t)(std::lower_bound(ents.begin(), ents.end(), ent) - ents.begin());
+    };
+
+    // the sorted, unique (entity, neighbor) pairs give each entity's set of
+    // neighbors as a contiguous run
+    std::vector<std::pair<index_t, index_t>> pairs;
+    for(index_t gi = 0; gi < num_groups; gi++)
+    {
+        for(index_t vi = grp_vals_offsets[gi]; vi < grp_vals_offsets[gi + 1]; vi++)
+        {
+            const index_t slot = ent_slot(grp_vals[vi]);
+            for(index_t ni = grp_nbrs_offsets[gi]; ni < grp_nbrs_offsets[gi + 1]; ni++)
+            {
+                pairs.push_back(std::make_pair(slot, grp_nbrs[ni]));
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    std::vector<index_t> ent_begin(num_ents + 1, 0);
+    for(const auto &pair : pairs)
+    {
+        ent_begin[pair.first + 1]++;
+    }
+    std::partial_sum(ent_begin.begin(), ent_begin.end(), ent_begin.begin());
+
+    // order the entities by their neighbor set, then by entity
+    const auto nbr_less = [] (const std::pair<index_t, index_t> &p0,
+                              const std::pair<index_t, index_t> &p1)
+    {
+        return p0.second < p1.second;
+    };
+    const auto set_less = [&] (index_t e0, index_t e1)
+    {
+        return std::lexicographical_compare(
+            pairs.begin() + ent_begin[e0], pairs.begin() + ent_begin[e0 + 1],
+            pairs.begin() + ent_begin[e1], pairs.begin() + ent_begin[e1 + 1],
+            nbr_less);
+    };
+    std::vector<index_t> ent_order(num_ents);
+    std::iota(ent_order.begin(), ent_order.end(), 0);
+    std::sort(ent_order.begin(), ent_order.end(), [&] (index_t e0, index_t e1)
+    {
+        return set_less(e0, e1) || (!set_less(e1, e0) && e0 < e1);
+    });
+
+    // each run of equal neighbor sets is a group, numbered in the order of
+    // its smallest entity
+    std::vector<std::pair<index_t, index_t>> group_firsts;
+    std::vector<index_t> ent_run(num_ents, -1);
+    for(index_t oi = 0; oi < num_ents; oi++)
+    {
+        const index_t ent = ent_order[oi];
+        if(oi == 0 || set_less(ent_order[oi - 1], ent))
+        {
+            group_firsts.push_back(std::make_pair(ent, (index_t)group_firsts.size()));
+        }
+        ent_run[ent] = group_firsts.back().second;
+    }
+    std::sort(group_firsts.begin(), group_firsts.end());
+    const index_t num_out_groups = (index_t)group_firsts.size();
+    std::vector<index_t> run_group(num_out_groups);
+    for(index_t gi = 0; gi < num_out_groups; gi++)
+    {
+        run_group[group_firsts[gi].second] = gi;
+    }
+
+    nbrs_offsets.assign(1, 0);
+    nbrs.clear();
+    for(index_t gi = 0; gi < num_out_groups; gi++)
+    {
+        const index_t ent = group_firsts[gi].first;
+        for(index_t pi = ent_begin[ent]; pi < ent_begin[ent + 1]; pi++)
+        {
+            nbrs.push_back(pairs[pi].second);
+        }
+        nbrs_offsets.push_back((index_t)nbrs.size());
+    }
+
+    // each group's entities in the order they first appear in the groups
+    values_offsets.assign(num_out_groups + 1, 0);
+    for(index_t ent = 0; ent < num_ents; ent++)
+    {
+        values_offsets[run_group[ent_run[ent]] + 1]++;
+    }
+    std::partial_sum(values_offsets.begin(), values_offsets.end(),
+                     values_offsets.begin());
+    values.resize(num_ents);
+    std::vector<index_t> cursor(values_offsets.begin(), values_offsets.end() - 1);
+    std::vector<unsigned char> placed(num_ents, 0);
+    for(size_t vi = 0; vi < grp_vals.size(); vi++)
+    {
+        const index_t ent = ent_slot(grp_vals[vi]);
+        if(!placed[ent])
+        {
+            placed[ent] = 1;
+            values[cursor[run_group[ent_run[ent]]]++] = grp_vals[vi];
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+adjset::write_flat_groups(const Node &adjset,
+                          const DataType &int_dtype,
+                          const std::vector<index_t> &nbrs_offsets,
+                          const std::vector<index_t> &nbrs,
+                          const std::vector<index_t> &values_offsets,
+                          const std::vector<index_t> &values,
+                          Node &dest)
+{
+    Node adjset_template;
+    adjset_template.set_external(adjset);
+    if(adjset_template.has_child("groups"))
+    {
+        adjset_template.remove("groups");
+    }
+
+    dest.set(adjset_template);
+    dest["groups"].set(DataType::object());
+
+    const index_t num_groups = (index_t)nbrs_offsets.size() - 1;
+    for(index_t gi = 0; gi < num_groups; gi++)
+    {
+        Node &group_node = dest["groups"][std::to_string(gi)];
+        {
+            const index_t nnbrs = nbrs_offsets[gi + 1] - nbrs_offsets[gi];
+            Node temp(DataType::index_t(nnbrs),
+                (void*)(nbrs.data() + nbrs_offsets[gi]), true);
+            temp.to_data_type(int_dtype.id(), group_node["neighbors"]);
+        }
+        {
+            const index_t nvals = values_offsets[gi + 1] - values_offsets[gi];
+            Node temp(DataType::index_t(nvals),
+                (void*)(values.data() + values_offsets[gi]), true);
+            temp.to_data_type(int_dtype.id(), group_node["values"]);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::utils::adjset --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- SpatialIndex --
+//-----------------------------------------------------------------------------
+
+// The faces of the fixed 3D shapes the spatial index splits into tetrahedra,
+// each given as its number of vertices followed by the element local ids.
+static const index_t SPATIAL_INDEX_HEX_FACES[] = {
+    4, 0, 3, 2, 1,  4, 0, 1, 5, 4,  4, 1, 2, 6, 5,
+    4, 2, 3, 7, 6,  4, 3, 0, 4, 7,  4, 4, 5, 6, 7};
+static const index_t SPATIAL_INDEX_WEDGE_FACES[] = {
+    3, 0, 1, 2,  3, 3, 5, 4,
+    4, 0, 1, 4, 3,  4, 1, 2, 5, 4,  4, 2, 0, 3, 5};
+static const index_t SPATIAL_INDEX_PYRAMID_FACES[] = {
+    4, 0, 1, 2, 3,  3, 0, 1, 4,  3, 1, 2, 4,  3, 2, 3, 4,  3, 3, 0, 4};
+
+//-----------------------------------------------------------------------------
+static inline void
+spatial_index_sub(const float64 *a, const float64 *b, float64 *res)
+{
+    res[0] = a[0] - b[0];
+    res[1] = a[1] - b[1];
+    res[2] = a[2] - b[2];
+}
+
+//-----------------------------------------------------------------------------
+static inline void
+spatial_index_cross(const float64 *a, const float64 *b, float64 *res)
+{
+    res[0] = a[1] * b[2] - a[2] * b[1];
+    res[1] = a[2] * b[0] - a[0] * b[2];
+    res[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+//-----------------------------------------------------------------------------
+static inline float64
+spatial_index_dot(const float64 *a, const float64 *b)
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+//-----------------------------------------------------------------------------
+static inline float64
+spatial_index_length(const float64 *a)
+{
+    return std::sqrt(spatial_index_dot(a, a));
+}
+
+//-----------------------------------------------------------------------------
+// true if 'p' is within 'tol' of the segment [a, b]
+static bool
+spatial_index_in_segment(const float64 *p, const float64 *a, const float64 *b,
+                         float64 tol)
+{
+    float64 ab[3], ap[3];
+    spatial_index_sub(b, a, ab);
+    spatial_index_sub(p, a, ap);
+    const float64 len2 = spatial_index_dot(ab, ab);
+    float64 t = len2 > 0.0 ? spatial_index_dot(ap, ab) / len2 : 0.0;
+    t = std::min(1.0, std::max(0.0, t));
+    const float64 diff[3] = {ap[0] - t * ab[0], ap[1] - t * ab[1], ap[2] - t * ab[2]};
+    return spatial_index_dot(diff, diff) <= tol * tol;
+}
+
+//-----------------------------------------------------------------------------
+// true if 'p' is within 'tol' of the triangle (a, b, c): within 'tol' of
+// its plane, and no further than 'tol' outside of each of its edges
+static bool
+spatial_index_in_triangle(const float64 *p, const float64 *a, const float64 *b,
+                          const float64 *c, float64 tol)
+{
+    float64 ab[3], ac[3], bc[3], n[3];
+    spatial_index_sub(b, a, ab);
+    spatial_index_sub(c, a, ac);
+    spatial_index_sub(c, b, bc);
+    spatial_index_cross(ab, ac, n);
+    const float64 nn = spatial_index_dot(n, n);
+    if(nn <= 0.0)
+    {
+        return false;
+    }
+    const float64 nlen = std::sqrt(nn);
+
+    float64 ap[3], bp[3], cp[3], tmp[3];
+    spatial_index_sub(p, a, ap);
+    if(std::abs(spatial_index_dot(ap, n)) > tol * nlen)
+    {
+        return false;
+    }
+    spatial_index_sub(p, b, bp);
+    spatial_index_sub(p, c, cp);
+
+    // barycentric coordinates, each is the distance to the opposite edge
+    // over the triangle's height
+    spatial_index_cross(bp, cp, tmp);
+    const float64 la = spatial_index_dot(tmp, n) / nn;
+    spatial_index_cross(cp, ap, tmp);
+    const float64 lb = spatial_index_dot(tmp, n) / nn;
+    const float64 lc = 1.0 - la - lb;
+    return la >= -tol * spatial_index_length(bc) / nlen &&
+           lb >= -tol * spatial_index_length(ac) / nlen &&
+           lc >= -tol * spatial_index_length(ab) / nlen;
+}
+
+//-----------------------------------------------------------------------------
+// true if 'p' is no further than 'tol' outside of each face of the
+// tetrahedron (a, b, c, d)
+static bool
+spatial_index_in_tet(const float64 *p, const float64 *a, const float64 *b,
+                     const float64 *c, const float64 *d, float64 tol)
+{
+    float64 ab[3], ac[3], ad[3], ap[3];
+    spatial_index_sub(b, a, ab);
+    spatial_index_sub(c, a, ac);
+    spatial_index_sub(d, a, ad);
+    spatial_index_sub(p, a, ap);
+
+    float64 acd[3], abd[3], abc[3];
+    spatial_index_cross(ac, ad, acd);
+    spatial_index_cross(ab, ad, abd);
+    spatial_index_cross(ab, ac, abc);
+    const float64 det = spatial_index_dot(ab, acd);
+    if(det == 0.0)
+    {
+        return false;
+    }
+    const float64 adet = std::abs(det);
+
+    float64 tmp[3];
+    const float64 lb = spatial_index_dot(ap, acd) / det;
+    spatial_index_cross(ap, ad, tmp);
+    const float64 lc = spatial_index_dot(ab, tmp) / det;
+    spatial_index_cross(ac, ap, tmp);
+    const float64 ld = spatial_index_dot(ab, tmp) / det;
+    const float64 la = 1.0 - lb - lc - ld;
+
+    float64 bc[3], bd[3], bcd[3];
+    spatial_index_sub(c, b, bc);
+    spatial_index_sub(d, b, bd);
+    spatial_index_cross(bc, bd, bcd);
+    return la >= -tol * spatial_index_length(bcd) / adet &&
+           lb >= -tol * spatial_index_length(acd) / adet &&
+           lc >= -tol * spatial_index_length(abd) / adet &&
+           ld >= -tol * spatial_index_length(abc) / adet;
+}
+
+//-----------------------------------------------------------------------------
+// squared distance from 'p' to the box [min, max]
+static inline float64
+spatial_index_box_distance2(const float64 *p, const float64 *min,
+                            const float64 *max)
+{
+    float64 res = 0.0;
+    for(int d = 0; d < 3; d++)
+    {
+        const float64 diff = p[d] < min[d] ? min[d] - p[d] :
+                             (p[d] > max[d] ? p[d] - max[d] : 0.0);
+        res += diff * diff;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+const index_t SpatialIndex::NOT_FOUND;
+
+//-----------------------------------------------------------------------------
+SpatialIndex::SpatialIndex()
+: m_dim(0), m_leaf_size(8), m_depth(0), m_tolerance(1e-9)
+{}
+
+//-----------------------------------------------------------------------------
+void
+SpatialIndex::build(const Node &topo)
+{
+    build(topo, Node());
+}
+
+//-----------------------------------------------------------------------------
+void
+SpatialIndex::build(const Node &topo, const Node &options)
+{
+    index_t num_threads = 1;
+    if(options.has_child("num_threads"))
+    {
+        num_threads = options["num_threads"].to_index_t();
+        if(num_threads <= 0)
+        {
+            num_threads = std::max((index_t)1, (index_t)std::thread::hardware_concurrency());
+        }
+    }
+    m_leaf_size = options.has_child("leaf_size") ?
+        std::max((index_t)1, options["leaf_size"].to_index_t()) : 8;
+    m_tolerance = options.has_child("tolerance") ?
+        std::max(0.0, options["tolerance"].to_float64()) : 1e-9;
+
+    // Coordinates //
+
+    const coordset::CoordAccessor coords(topology::coordset(topo));
+    const index_t num_verts = coords.size();
+    m_dim = coords.dims();
+    m_coords.resize((size_t)(3 * num_verts));
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, num_verts, 65536), num_verts,
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        for(index_t vi = begin; vi < end; vi++)
+        {
+            coords.point(vi, &m_coords[3 * vi]);
+        }
+    });
+
+    // Elements //
+
+    m_shapes.clear();
+    m_offsets.clear();
+    m_verts.clear();
+    m_elem_faces.clear();
+    m_face_offsets.clear();
+    if(has_fixed_element_shape(topo))
+    {
+        const index_t shape_id = (index_t)topology::impl::fixed_shape_id(topo);
+        const index_t num_indices = ShapeType(shape_id).indices;
+        const index_t num_elems = topology::length(topo);
+        m_shapes.assign((size_t)num_elems, shape_id);
+        m_offsets.resize((size_t)num_elems + 1);
+        for(index_t ei = 0; ei <= num_elems; ei++)
+        {
+            m_offsets[ei] = ei * num_indices;
+        }
+        m_verts.resize((size_t)(num_elems * num_indices));
+        topology::iterate_fixed_elements_parallel(topo, num_threads,
+            FixedElementIdsKernel(m_verts.data()));
+    }
+    else
+    {
+        m_offsets.push_back(0);
+        m_elem_faces.push_back(0);
+        topology::iterate_elements(topo, [&](const topology::entity &e)
+        {
+            m_shapes.push_back(e.shape.id);
+            if(e.shape.is_polyhedral())
+            {
+                for(const std::vector<index_t> &face : e.subelement_ids)
+                {
+                    m_face_offsets.push_back((index_t)m_verts.size());
+                    m_verts.insert(m_verts.end(), face.begin(), face.end());
+                }
+            }
+            else
+            {
+                m_verts.insert(m_verts.end(), e.element_ids.begin(), e.element_ids.end());
+            }
+            m_offsets.push_back((index_t)m_verts.size());
+            m_elem_faces.push_back((index_t)m_face_offsets.size());
+        });
+        m_face_offsets.push_back((index_t)m_verts.size());
+    }
+
+    for(const index_t vi : m_verts)
+    {
+        if(vi < 0 || vi >= num_verts)
+        {
+            CONDUIT_ERROR("SpatialIndex: vertex " << vi << " is out of range [0, "
+                          << num_verts << ")");
+        }
+    }
+
+    // Element Boxes and Centroids //
+
+    const index_t num_elems = (index_t)m_shapes.size();
+    m_box_min.resize((size_t)(3 * num_elems));
+    m_box_max.resize((size_t)(3 * num_elems));
+    m_centroids.resize((size_t)(3 * num_elems));
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, num_elems, 4096), num_elems,
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        for(index_t ei = begin; ei < end; ei++)
+        {
+            float64 *bmin = &m_box_min[3 * ei];
+            float64 *bmax = &m_box_max[3 * ei];
+            float64 *cent = &m_centroids[3 * ei];
+            for(int d = 0; d < 3; d++)
+            {
+                bmin[d] = std::numeric_limits<float64>::max();
+                bmax[d] = std::numeric_limits<float64>::lowest();
+                cent[d] = 0.0;
+            }
+            const index_t vbegin = m_offsets[ei];
+            const index_t vend = m_offsets[ei + 1];
+            for(index_t vi = vbegin; vi < vend; vi++)
+            {
+                const float64 *p = &m_coords[3 * m_verts[vi]];
+                for(int d = 0; d < 3; d++)
+                {
+                    bmin[d] = std::min(bmin[d], p[d]);
+                    bmax[d] = std::max(bmax[d], p[d]);
+                    cent[d] += p[d];
+                }
+            }
+            for(int d = 0; d < 3; d++)
+            {
+                bmin[d] -= m_tolerance;
+                bmax[d] += m_tolerance;
+                cent[d] = vend > vbegin ? cent[d] / (vend - vbegin) : 0.0;
+            }
+        }
+    });
+
+    // Tree //
+
+    m_nodes.clear();
+    m_ids.resize((size_t)num_elems);
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        m_ids[ei] = ei;
+    }
+    m_depth = 0;
+    if(num_elems > 0)
+    {
+        m_nodes.resize((size_t)subtree_nodes(num_elems));
+        m_depth = build_node(0, 0, num_elems, num_threads);
+    }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+SpatialIndex::subtree_nodes(index_t n) const
+{
+    return (n <= m_leaf_size) ? 1 :
+        1 + subtree_nodes(n / 2) + subtree_nodes(n - n / 2);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+SpatialIndex::build_node(index_t ni, index_t begin, index_t end,
+                         index_t num_threads)
+{
+    node &n = m_nodes[ni];
+    n.begin = begin;
+    n.end = end;
+    n.right = -1;
+    float64 cmin[3], cmax[3];
+    for(int d = 0; d < 3; d++)
+    {
+        n.min[d] = cmin[d] = std::numeric_limits<float64>::max();
+        n.max[d] = cmax[d] = std::numeric_limits<float64>::lowest();
+    }
+    for(index_t i = begin; i < end; i++)
+    {
+        const index_t ei = m_ids[i];
+        for(int d = 0; d < 3; d++)
+        {
+            n.min[d] = std::min(n.min[d], m_box_min[3 * ei + d]);
+            n.max[d] = std::max(n.max[d], m_box_max[3 * ei + d]);
+            cmin[d] = std::min(cmin[d], m_centroids[3 * ei + d]);
+            cmax[d] = std::max(cmax[d], m_centroids[3 * ei + d]);
+        }
+    }
+
+    const index_t count = end - begin;
+    if(count <= m_leaf_size)
+    {
+        return 1;
+    }
+
+    int dim = 0;
+    for(int d = 1; d < 3; d++)
+    {
+        if(cmax[d] - cmin[d] > cmax[dim] - cmin[dim])
+        {
+            dim = d;
+        }
+    }
+
+    // Partition around the median centroid, breaking ties by id so the
+    // split is the same for any order of equal centroids.
+    const index_t mid = begin + count / 2;
+    std::nth_element(m_ids.begin() + begin, m_ids.begin() + mid,
+        m_ids.begin() + end,
+        [&](index_t a, index_t b)
+        {
+            const float64 ca = m_centroids[3 * a + dim];
+            const float64 cb = m_centroids[3 * b + dim];
+            return ca < cb || (ca == cb && a < b);
+        });
+
+    const index_t left = ni + 1;
+    const index_t right = left + subtree_nodes(mid - begin);
+    n.right = right;
+
+    index_t depths[2] = {0, 0};
+    if(num_threads > 1)
+    {
+        const index_t left_threads = num_threads / 2;
+        detail::parallel_chunks(2, 2, [&](index_t ci, index_t, index_t)
+        {
+            depths[ci] = (ci == 0) ?
+                build_node(left, begin, mid, left_threads) :
+                build_node(right, mid, end, num_threads - left_threads);
+        });
+    }
+    else
+    {
+        depths[0] = build_node(left, begin, mid, 1);
+        depths[1] = build_node(right, mid, end, 1);
+    }
+    return 1 + std::max(depths[0], depths[1]);
+}
+
+//-----------------------------------------------------------------------------
+bool
+SpatialIndex::contains(index_t ei, const float64 *p) const
+{
+    const index_t *verts = m_verts.data() + m_offsets[ei];
+    const index_t num_verts = m_offsets[ei + 1] - m_offsets[ei];
+    const index_t shape_id = m_shapes[ei];
+    const float64 tol = m_tolerance;
+    if(num_verts == 0)
+    {
+        return false;
+    }
+    auto vert = [&](index_t i) { return &m_coords[3 * verts[i]]; };
+
+    const index_t dim = TOPO_SHAPE_DIMS[shape_id];
+    if(dim == 0)
+    {
+        const float64 *a = vert(0);
+        float64 ap[3];
+        spatial_index_sub(p, a, ap);
+        return spatial_index_dot(ap, ap) <= tol * tol;
+    }
+    else if(dim == 1)
+    {
+        return num_verts >= 2 &&
+            spatial_index_in_segment(p, vert(0), vert(1), tol);
+    }
+    else if(dim == 2)
+    {
+        for(index_t i = 1; i + 1 < num_verts; i++)
+        {
+            if(spatial_index_in_triangle(p, vert(0), vert(i), vert(i + 1), tol))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if(shape_id == (index_t)topology::ShapeId::Tet)
+    {
+        return spatial_index_in_tet(p, vert(0), vert(1), vert(2), vert(3), tol);
+    }
+
+    // other 3D elements: tetrahedra from the centroid to the triangle fans
+    // of the faces
+    const float64 *cent = &m_centroids[3 * ei];
+    const index_t *faces = NULL;
+    index_t faces_size = 0;
+    if(shape_id == (index_t)topology::ShapeId::Hex)
+    {
+        faces = SPATIAL_INDEX_HEX_FACES;
+        faces_size = sizeof(SPATIAL_INDEX_HEX_FACES) / sizeof(index_t);
+    }
+    else if(shape_id == (index_t)topology::ShapeId::Wedge)
+    {
+        faces = SPATIAL_INDEX_WEDGE_FACES;
+        faces_size = sizeof(SPATIAL_INDEX_WEDGE_FACES) / sizeof(index_t);
+    }
+    else if(shape_id == (index_t)topology::ShapeId::Pyramid)
+    {
+        faces = SPATIAL_INDEX_PYRAMID_FACES;
+        faces_size = sizeof(SPATIAL_INDEX_PYRAMID_FACES) / sizeof(index_t);
+    }
+
+    if(faces != NULL)
+    {
+        for(index_t fi = 0; fi < faces_size; fi += faces[fi] + 1)
+        {
+            const index_t *face = faces + fi + 1;
+            for(index_t i = 1; i + 1 < faces[fi]; i++)
+            {
+                if(spatial_index_in_tet(p, cent, vert(face[0]), vert(face[i]),
+                                        vert(face[i + 1]), tol))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // polyhedra
+    for(index_t fi = m_elem_faces[ei]; fi < m_elem_faces[ei + 1]; fi++)
+    {
+        const index_t *face = m_verts.data() + m_face_offsets[fi];
+        const index_t face_size = m_face_offsets[fi + 1] - m_face_offsets[fi];
+        for(index_t i = 1; i + 1 < face_size; i++)
+        {
+            if(spatial_index_in_tet(p, cent, &m_coords[3 * face[0]],
+                   &m_coords[3 * face[i]], &m_coords[3 * face[i + 1]], tol))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+SpatialIndex::locate(const float64 *p) const
+{
+    index_t res = NOT_FOUND;
+    if(m_nodes.empty())
+    {
+        return res;
+    }
+
+    // Pending subtrees. Each level leaves at most one right child.
+    index_t stack[128];
+    index_t stack_size = 0;
+    stack[stack_size++] = 0;
+    while(stack_size > 0)
+    {
+        const index_t ni = stack[--stack_size];
+        const node &n = m_nodes[ni];
+        if(spatial_index_box_distance2(p, n.min, n.max) > 0.0)
+        {
+            continue;
+        }
+
+        if(n.right >= 0)
+        {
+            stack[stack_size++] = n.right;
+            stack[stack_size++] = ni + 1;
+            continue;
+        }
+
+        for(index_t i = n.begin; i < n.end; i++)
+        {
+            const index_t ei = m_ids[i];
+            if((res == NOT_FOUND || ei < res) &&
+               spatial_index_box_distance2(p, &m_box_min[3 * ei], &m_box_max[3 * ei]) == 0.0 &&
+               contains(ei, p))
+            {
+                res = ei;
+            }
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+SpatialIndex::nearest(const float64 *p, float64 &distance) const
+{
+    index_t res = locate(p);
+    if(res != NOT_FOUND || m_nodes.empty())
+    {
+        distance = 0.0;
+        return res;
+    }
+
+    // Visits the nearer child first, and skips the subtrees whose boxes
+    // (which hold the centroids of their elements) are further away than
+    // the closest centroid so far.
+    float64 best = std::numeric_limits<float64>::max();
+    index_t stack[128];
+    index_t stack_size = 0;
+    stack[stack_size++] = 0;
+    while(stack_size > 0)
+    {
+        const index_t ni = stack[--stack_size];
+        const node &n = m_nodes[ni];
+        if(spatial_index_box_distance2(p, n.min, n.max) > best)
+        {
+            continue;
+        }
+
+        if(n.right >= 0)
+        {
+            const node &l = m_nodes[ni + 1];
+            const node &r = m_nodes[n.right];
+            const bool left_first = spatial_index_box_distance2(p, l.min, l.max) <=
+                                    spatial_index_box_distance2(p, r.min, r.max);
+            stack[stack_size++] = left_first ? n.right : ni + 1;
+            stack[stack_size++] = left_first ? ni + 1 : n.right;
+            continue;
+        }
+
+        for(index_t i = n.begin; i < n.end; i++)
+        {
+            const index_t ei = m_ids[i];
+            float64 diff[3];
+            spatial_index_sub(p, &m_centroids[3 * ei], diff);
+            const float64 dist2 = spatial_index_dot(diff, diff);
+            if(dist2 < best || (dist2 == best && ei < res))
+            {
+                best = dist2;
+                res = ei;
+            }
+        }
+    }
+    distance = std::sqrt(best);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+SpatialIndex::find_element(const float64 *point) const
+{
+    float64 p[3] = {0.0, 0.0, 0.0};
+    for(index_t d = 0; d < m_dim; d++)
+    {
+        p[d] = point[d];
+    }
+    return locate(p);
+}
+
+//-----------------------------------------------------------------------------
+void
+SpatialIndex::find_elements(const float64 *points, index_t num_points,
+                            index_t *ids, index_t num_threads) const
+{
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, num_points, 1024),
+        num_points,
+        [&](index_t, index_t begin, index_t end)
+        {
+            for(index_t i = begin; i < end; i++)
+            {
+                ids[i] = find_element(points + i * m_dim);
+            }
+        });
+}
+
+//-----------------------------------------------------------------------------
+void
+SpatialIndex::find_elements(const Node &coords, Node &ids,
+                            index_t num_threads) const
+{
+    const index_t num_axes = coords.number_of_children();
+    if(num_axes != m_dim)
+    {
+        CONDUIT_ERROR("SpatialIndex: query coordinates have " << num_axes
+                      << " axes, expected " << m_dim);
+    }
+    std::vector<float64_accessor> axes;
+    for(index_t d = 0; d < num_axes; d++)
+    {
+        axes.push_back(coords.child(d).as_float64_accessor());
+    }
+    const index_t num_points = num_axes > 0 ? axes[0].number_of_elements() : 0;
+    for(index_t d = 1; d < num_axes; d++)
+    {
+        if(axes[d].number_of_elements() != num_points)
+        {
+            CONDUIT_ERROR("SpatialIndex: query coordinate axes have "
+                          "different lengths");
+        }
+    }
+
+    ids.set(DataType::index_t(num_points));
+    index_t *ids_ptr = ids.value();
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, num_points, 1024),
+        num_points,
+        [&](index_t, index_t begin, index_t end)
+        {
+            float64 p[3] = {0.0, 0.0, 0.0};
+            for(index_t i = begin; i < end; i++)
+            {
+                for(index_t d = 0; d < num_axes; d++)
+                {
+                    p[d] = axes[d][i];
+                }
+                ids_ptr[i] = locate(p);
+            }
+        });
+}
+
+//-----------------------------------------------------------------------------
+index_t
+SpatialIndex::find_nearest_element(const float64 *point, float64 &distance) const
+{
+    float64 p[3] = {0.0, 0.0, 0.0};
+    for(index_t d = 0; d < m_dim; d++)
+    {
+        p[d] = point[d];
+    }
+    return nearest(p, distance);
+}
+
+//-----------------------------------------------------------------------------
+void
+SpatialIndex::find_nearest_elements(const float64 *points, index_t num_points,
+                                    index_t *ids, float64 *distances,
+                                    index_t num_threads) const
+{
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, num_points, 1024),
+        num_points,
+        [&](index_t, index_t begin, index_t end)
+        {
+            for(index_t i = begin; i < end; i++)
+            {
+                float64 distance = 0.0;
+                ids[i] = find_nearest_element(points + i * m_dim, distance);
+                if(distances != NULL)
+                {
+                    distances[i] = distance;
+                }
+            }
+        });
+}
+
+//-----------------------------------------------------------------------------
+void
+SpatialIndex::find_elements_in(const std::function<int(const float64 *, const float64 *)> &classify,
+                               const std::function<bool(const float64 *)> &contains,
+                               std::vector<index_t> &ids) const
+{
+    ids.clear();
+    if(m_nodes.empty())
+    {
+        return;
+    }
+
+    index_t stack[128];
+    index_t stack_size = 0;
+    stack[stack_size++] = 0;
+    while(stack_size > 0)
+    {
+        const index_t ni = stack[--stack_size];
+        const node &n = m_nodes[ni];
+        const int c = classify(n.min, n.max);
+        if(c < 0)
+        {
+            continue;
+        }
+        else if(c > 0)
+        {
+            ids.insert(ids.end(), m_ids.begin() + n.begin, m_ids.begin() + n.end);
+        }
+        else if(n.right >= 0)
+        {
+            stack[stack_size++] = n.right;
+            stack[stack_size++] = ni + 1;
+        }
+        else
+        {
+            for(index_t i = n.begin; i < n.end; i++)
+            {
+                if(contains(&m_centroids[3 * m_ids[i]]))
+                {
+                    ids.push_back(m_ids[i]);
+                }
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+}
 
 }
 //-----------------------------------------------------------------------------
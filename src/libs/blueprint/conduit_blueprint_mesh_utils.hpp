@@ -14,9 +14,17 @@
 //-----------------------------------------------------------------------------
 // std includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <functional>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 //-----------------------------------------------------------------------------
@@ -49,6 +57,96 @@ namespace mesh
 namespace utils
 {
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::utils::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// Reads a thread count from the 'num_threads' option (default 1; <= 0
+// selects the hardware concurrency).
+//---------------------------------------------------------------------------//
+inline index_t
+num_threads_option(const conduit::Node &options)
+{
+    if(!options.has_child("num_threads"))
+    {
+        return 1;
+    }
+
+    index_t res = options["num_threads"].to_index_t();
+    if(res <= 0)
+    {
+        res = std::max((index_t)1, (index_t)std::thread::hardware_concurrency());
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// Splits [0, num_items) into 'num_chunks' contiguous chunks and calls
+// 'func(chunk, begin, end)' for each, one thread per chunk (the calling
+// thread runs the first). Errors raised by 'func' are rethrown on the
+// calling thread.
+//---------------------------------------------------------------------------//
+inline index_t
+parallel_num_chunks(index_t num_threads, index_t num_items, index_t min_chunk_items)
+{
+    return std::max((index_t)1, std::min(num_threads,
+        (num_items + min_chunk_items - 1) / min_chunk_items));
+}
+
+template <typename Func>
+void
+parallel_chunks(index_t num_chunks, index_t num_items, const Func &func)
+{
+    if(num_chunks <= 1)
+    {
+        func(0, 0, num_items);
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&] (index_t ci)
+    {
+        try
+        {
+            func(ci, ci * num_items / num_chunks, (ci + 1) * num_items / num_chunks);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if(!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve((size_t)(num_chunks - 1));
+    for(index_t ci = 1; ci < num_chunks; ci++)
+    {
+        threads.push_back(std::thread(worker, ci));
+    }
+    worker(0);
+    for(size_t ti = 0; ti < threads.size(); ti++)
+    {
+        threads[ti].join();
+    }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::utils::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 /// blueprint mesh utility constants
 //-----------------------------------------------------------------------------
@@ -87,6 +185,8 @@ static const std::vector<std::string> TOPO_TYPES = {"points", "uniform", "rectil
 //     you are adding.
 //  3) Head over to conduit_blueprint_mesh_utils_iterate_elements.hpp and find the enum class ShapeId.
 //     Add an element for your shape there, and update the others if adding in the middle.
+//     Add a shape_traits specialization for it next to the enum.
+//  4) Add the shape's name to the first character lookup in ShapeType::id_from_name.
 
 static const std::vector<std::string> TOPO_SHAPES = {"point", "line", "tri", "quad", 
     "tet", "hex", "wedge", "pyramid", "polygonal", "polyhedral", "mixed"};
@@ -173,6 +273,11 @@ public:
     bool is_polyhedral() const;
     bool is_valid() const;
 
+    // Returns the index of 'type_name' in TOPO_SHAPES, or -1 if it isn't
+    // a shape name. Names are looked up in constant time.
+    static index_t id_from_name(const std::string &type_name);
+    static index_t id_from_name(const char *type_name);
+
     std::string type;
     index_t id, dim, indices;
     index_t embed_id, embed_count, *embedding;
@@ -247,11 +352,29 @@ struct CONDUIT_BLUEPRINT_API TopologyMetadata
     //
     enum IndexType { GLOBAL = 0, LOCAL = 1 };
 
-    TopologyMetadata(const conduit::Node &topology, const conduit::Node &coordset);
-
-    void add_entity_assoc(IndexType type, index_t e0_id, index_t e0_dim, index_t e1_id, index_t e1_dim);
+    // NOTE: Entity discovery runs on up to 'num_threads' threads; the
+    // results don't depend on the number of threads.
+    TopologyMetadata(const conduit::Node &topology,
+                     const conduit::Node &coordset,
+                     index_t num_threads = 1);
 
-    const std::vector<index_t> &get_entity_assocs(IndexType type, index_t entity_id, index_t entity_dim, index_t assoc_dim) const;
+    // NOTE: Builds a subset of the metadata, as selected by 'options':
+    //
+    // - "num_threads": as above (default 1, <= 0 selects the hardware concurrency)
+    // - "dims": the dimension(s) to discover; all dimensions between the
+    //   lowest listed dimension and the topology's dimension are built
+    //   (default: all dimensions). Unbuilt dimensions have no entities.
+    // - "associations": flat list of (entity dim, assoc dim) pairs whose
+    //   GLOBAL associations are built up front (default: all pairs). The
+    //   other pairs are built on their first query.
+    // - "local": if 0, the LOCAL associations are released once the
+    //   requested maps are built and can't be queried (default 1).
+    TopologyMetadata(const conduit::Node &topology,
+                     const conduit::Node &coordset,
+                     const conduit::Node &options);
+
+    // NOTE: The returned span views storage owned by this object.
+    Span<const index_t> get_entity_assocs(IndexType type, index_t entity_id, index_t entity_dim, index_t assoc_dim) const;
     void get_dim_map(IndexType type, index_t src_dim, index_t dst_dim, Node &map_node) const;
     void get_entity_data(IndexType type, index_t entity_id, index_t entity_dim, Node &data) const;
     void get_point_data(IndexType type, index_t point_id, Node &data) const;
@@ -268,14 +391,472 @@ struct CONDUIT_BLUEPRINT_API TopologyMetadata
 
     // per-dimension topology nodes (mapped onto 'cset' coordinate set)
     std::vector< conduit::Node > dim_topos;
-    // per-dimension maps from an entity's point id set to its global entity id
-    std::vector< std::map< std::set<index_t>, index_t > > dim_geid_maps;
-    // per-dimension maps from global entity ids to per-dimension global associate ids
-    std::vector< std::vector< std::vector< std::pair< std::vector<index_t>, std::set<index_t> > > > > dim_geassocs_maps;
-    // per-dimension maps from local entity ids to per-dimension local associate ids
-    std::vector< std::vector< std::vector< std::pair< std::vector<index_t>, std::set<index_t> > > > > dim_leassocs_maps;
     // per-dimension mapping from local entity ids to global entity ids (delegates)
     std::vector< std::vector<index_t> > dim_le2ge_maps;
+    // per-dimension mapping from global entity ids to local entity ids (CSR:
+    // the local ids of global entity 'g' are values[offsets[g]:offsets[g+1]])
+    std::vector< std::vector<index_t> > dim_ge2le_offsets;
+    std::vector< std::vector<index_t> > dim_ge2le_values;
+    // per-dimension offsets of the local ids of each local entity's
+    // embedded (dimension - 1) entities, which are contiguous
+    std::vector< std::vector<index_t> > dim_lchild_offsets;
+    // per-dimension local ancestor ids, (topo dim - dim) per local entity
+    // ordered by increasing dimension (-1 for the topology's points)
+    std::vector< std::vector<index_t> > dim_lancestors;
+    // per-dimension sequences 0..n-1, used to view local id ranges
+    std::vector< std::vector<index_t> > dim_iotas;
+    // per-(entity dim, associate dim) CSR of global associate ids,
+    // indexed by 'entity_dim * (topo dim + 1) + assoc_dim' (built on demand)
+    mutable std::vector< std::vector<index_t> > dim_gassoc_offsets;
+    mutable std::vector< std::vector<index_t> > dim_gassoc_values;
+
+private:
+    void init(index_t num_threads, index_t min_dim);
+    void build_global_assoc(index_t entity_dim, index_t assoc_dim) const;
+    void check_dims(IndexType type, index_t entity_dim, index_t assoc_dim) const;
+
+    index_t m_num_threads;
+    index_t m_min_dim;
+    bool m_has_local;
+    // guards the construction of each (entity dim, assoc dim) pair
+    std::unique_ptr<std::once_flag[]> m_gassoc_flags;
+};
+
+//---------------------------------------------------------------------------
+/**
+ @brief A kd-tree over a fixed set of points, built all at once.
+
+ The tree splits boxes at the median point along their longest axis until
+ the boxes hold at most bucket_size points. Points are copied into one flat
+ array, grouped by leaf, and the nodes are stored depth first in one
+ contiguous vector (the left child follows its parent). Queries don't
+ modify the tree, so they can run from many threads at once.
+
+ Point ids are the positions of the points in the build input.
+
+ @tparam T     The coordinate type.
+ @tparam NDIMS The number of coordinates per point.
+*/
+template <typename T, int NDIMS>
+class kdtree
+{
+public:
+    typedef std::array<T, NDIMS> point_type;
+
+    static const index_t NOT_FOUND = -1;
+
+    kdtree() : m_bucket_size(32), m_depth(0) {}
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Sets the max number of points in a leaf. Takes effect on the
+            next build.
+    */
+    void set_bucket_size(index_t bucket_size)
+    {
+        m_bucket_size = std::max((index_t)1, bucket_size);
+    }
+    index_t bucket_size() const { return m_bucket_size; }
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Builds the tree from 'num_points' points whose coordinates are
+            interleaved in 'coords' (NDIMS values per point). Subtrees are
+            built concurrently on up to 'num_threads' threads. The tree
+            doesn't depend on the number of threads.
+    */
+    void build(const T *coords, index_t num_points, index_t num_threads = 1)
+    {
+        m_nodes.clear();
+        m_points.clear();
+        m_ids.resize((size_t)num_points);
+        for(index_t i = 0; i < num_points; i++)
+        {
+            m_ids[i] = i;
+        }
+        m_depth = 0;
+        if(num_points == 0)
+        {
+            return;
+        }
+
+        m_nodes.resize((size_t)subtree_nodes(num_points));
+        m_depth = build_node(coords, 0, 0, num_points, std::max((index_t)1, num_threads));
+
+        m_points.resize((size_t)num_points);
+        detail::parallel_chunks(
+            detail::parallel_num_chunks(num_threads, num_points, 65536),
+            num_points,
+            [&](index_t, index_t begin, index_t end)
+            {
+                for(index_t i = begin; i < end; i++)
+                {
+                    for(int d = 0; d < NDIMS; d++)
+                    {
+                        m_points[i][d] = coords[m_ids[i] * NDIMS + d];
+                    }
+                }
+            });
+    }
+
+    index_t size()  const { return (index_t)m_points.size(); }
+    index_t nodes() const { return (index_t)m_nodes.size(); }
+    index_t depth() const { return m_depth; }
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Returns the smallest id of the points within 'tolerance' of
+            'point' (NDIMS values), or NOT_FOUND.
+    */
+    index_t find_point(const T *point, T tolerance) const
+    {
+        index_t res = NOT_FOUND;
+        visit_points(point, tolerance, [&](index_t id)
+        {
+            if(res == NOT_FOUND || id < res)
+            {
+                res = id;
+            }
+        });
+        return res;
+    }
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Looks up 'num_points' points whose coordinates are interleaved
+            in 'points', storing the result of 'find_point' for each in
+            'ids'. The queries are split over up to 'num_threads' threads.
+    */
+    void find_point(const T *points, index_t num_points, T tolerance,
+                    index_t *ids, index_t num_threads = 1) const
+    {
+        detail::parallel_chunks(
+            detail::parallel_num_chunks(num_threads, num_points, 4096),
+            num_points,
+            [&](index_t, index_t begin, index_t end)
+            {
+                for(index_t i = begin; i < end; i++)
+                {
+                    ids[i] = find_point(points + i * NDIMS, tolerance);
+                }
+            });
+    }
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Replaces the contents of 'ids' with the ids of all of the points
+            within 'tolerance' of 'point', in ascending order.
+    */
+    void find_points(const T *point, T tolerance, std::vector<index_t> &ids) const
+    {
+        ids.clear();
+        visit_points(point, tolerance, [&](index_t id)
+        {
+            ids.push_back(id);
+        });
+        std::sort(ids.begin(), ids.end());
+    }
+
+private:
+    struct node
+    {
+        point_type min;
+        point_type max;
+        // the node's points are [begin, end) in m_points
+        index_t begin;
+        index_t end;
+        // the right child (the left child is the next node), -1 for leaves
+        index_t right;
+    };
+
+    // The number of nodes in a subtree with 'n' points.
+    index_t subtree_nodes(index_t n) const
+    {
+        return (n <= m_bucket_size) ? 1 :
+            1 + subtree_nodes(n / 2) + subtree_nodes(n - n / 2);
+    }
+
+    // Builds node 'ni' over m_ids[begin, end) and returns the subtree depth.
+    index_t build_node(const T *coords, index_t ni, index_t begin, index_t end,
+                       index_t num_threads)
+    {
+        node &n = m_nodes[ni];
+        n.begin = begin;
+        n.end = end;
+        n.right = -1;
+        for(int d = 0; d < NDIMS; d++)
+        {
+            n.min[d] = std::numeric_limits<T>::max();
+            n.max[d] = std::numeric_limits<T>::lowest();
+        }
+        for(index_t i = begin; i < end; i++)
+        {
+            const T *p = coords + m_ids[i] * NDIMS;
+            for(int d = 0; d < NDIMS; d++)
+            {
+                n.min[d] = std::min(n.min[d], p[d]);
+                n.max[d] = std::max(n.max[d], p[d]);
+            }
+        }
+
+        const index_t count = end - begin;
+        if(count <= m_bucket_size)
+        {
+            return 1;
+        }
+
+        int dim = 0;
+        for(int d = 1; d < NDIMS; d++)
+        {
+            if(n.max[d] - n.min[d] > n.max[dim] - n.min[dim])
+            {
+                dim = d;
+            }
+        }
+
+        // Partition around the median, breaking ties by id so the
+        // split is the same for any order of equal coordinates.
+        const index_t mid = begin + count / 2;
+        std::nth_element(m_ids.begin() + begin, m_ids.begin() + mid,
+            m_ids.begin() + end,
+            [&](index_t a, index_t b)
+            {
+                const T ca = coords[a * NDIMS + dim];
+                const T cb = coords[b * NDIMS + dim];
+                return ca < cb || (ca == cb && a < b);
+            });
+
+        const index_t left = ni + 1;
+        const index_t right = left + subtree_nodes(mid - begin);
+        n.right = right;
+
+        index_t depths[2] = {0, 0};
+        if(num_threads > 1)
+        {
+            const index_t left_threads = num_threads / 2;
+            detail::parallel_chunks(2, 2, [&](index_t ci, index_t, index_t)
+            {
+                depths[ci] = (ci == 0) ?
+                    build_node(coords, left, begin, mid, left_threads) :
+                    build_node(coords, right, mid, end, num_threads - left_threads);
+            });
+        }
+        else
+        {
+            depths[0] = build_node(coords, left, begin, mid, 1);
+            depths[1] = build_node(coords, right, mid, end, 1);
+        }
+        return 1 + std::max(depths[0], depths[1]);
+    }
+
+    // Calls 'func(id)' for each point within 'tolerance' of 'point'.
+    template <typename Func>
+    void visit_points(const T *point, T tolerance, const Func &func) const
+    {
+        if(m_nodes.empty())
+        {
+            return;
+        }
+
+        const T tol2 = tolerance * tolerance;
+        // Pending subtrees. Each level leaves at most one right child.
+        index_t stack[128];
+        index_t stack_size = 0;
+        stack[stack_size++] = 0;
+        while(stack_size > 0)
+        {
+            const index_t ni = stack[--stack_size];
+            const node &n = m_nodes[ni];
+            bool inside = true;
+            for(int d = 0; d < NDIMS && inside; d++)
+            {
+                inside = point[d] >= n.min[d] - tolerance &&
+                         point[d] <= n.max[d] + tolerance;
+            }
+            if(!inside)
+            {
+                continue;
+            }
+
+            if(n.right >= 0)
+            {
+                stack[stack_size++] = n.right;
+                stack[stack_size++] = ni + 1;
+                continue;
+            }
+
+            for(index_t i = n.begin; i < n.end; i++)
+            {
+                const point_type &p = m_points[i];
+                T dist2 = 0;
+                for(int d = 0; d < NDIMS; d++)
+                {
+                    const T diff = p[d] - point[d];
+                    dist2 += diff * diff;
+                }
+                if(dist2 <= tol2)
+                {
+                    func(m_ids[i]);
+                }
+            }
+        }
+    }
+
+    index_t                 m_bucket_size;
+    index_t                 m_depth;
+    std::vector<node>       m_nodes;
+    std::vector<point_type> m_points;
+    std::vector<index_t>    m_ids;
+};
+
+template <typename T, int NDIMS>
+const index_t kdtree<T, NDIMS>::NOT_FOUND;
+
+//---------------------------------------------------------------------------
+/**
+ @brief A bounding volume hierarchy over the elements of a topology, for
+        locating points in its elements.
+
+ The tree splits groups of elements at the median element centroid along
+ their longest axis until the groups hold at most leaf_size elements, and
+ each node stores the box around its elements' boxes. Like kdtree, the
+ nodes are stored depth first and subtrees are built concurrently. The
+ index copies the element vertices and coordinates it needs, so the mesh
+ doesn't have to outlive it, and queries can run from many threads.
+
+ Points are inside an element when they are within 'tolerance' of it:
+ lines and points are tested directly, 2D elements are split into a fan of
+ triangles from their first vertex and 3D elements into tetrahedra from
+ their centroid to the triangles of their faces, so elements are assumed
+ to be convex (or star shaped around their centroid).
+
+ Query points have dimension() coordinates, the dimension of the
+ topology's coordset.
+*/
+class CONDUIT_BLUEPRINT_API SpatialIndex
+{
+public:
+    static const index_t NOT_FOUND = -1;
+
+    SpatialIndex();
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Builds the index over the elements of 'topo', which has to be
+            part of a mesh (its coordset is looked up next to it).
+
+     options:
+       num_threads: threads used to build the index (default 1,
+                    <= 0 uses all cores)
+       leaf_size:   max number of elements in a leaf (default 8)
+       tolerance:   distance within which points are inside elements
+                    (default 1e-9)
+    */
+    void build(const conduit::Node &topo);
+    void build(const conduit::Node &topo, const conduit::Node &options);
+
+    index_t dimension() const { return m_dim; }
+    index_t number_of_elements() const { return (index_t)m_shapes.size(); }
+    index_t depth() const { return m_depth; }
+    float64 tolerance() const { return m_tolerance; }
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Returns the smallest id of the elements that contain 'point'
+            (dimension() values), or NOT_FOUND.
+    */
+    index_t find_element(const float64 *point) const;
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Looks up 'num_points' points whose coordinates are interleaved
+            in 'points', storing the result of find_element() for each in
+            'ids'. The queries are split over up to 'num_threads' threads.
+    */
+    void find_elements(const float64 *points, index_t num_points,
+                       index_t *ids, index_t num_threads = 1) const;
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Looks up the points in 'coords', an object with one array per
+            axis like the values of an explicit coordset, and sets 'ids' to
+            an index_t array with the result of find_element() for each.
+    */
+    void find_elements(const conduit::Node &coords, conduit::Node &ids,
+                       index_t num_threads = 1) const;
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Returns the element that contains 'point' (with 'distance' 0),
+            or else the element whose centroid is closest to 'point' (with
+            'distance' set to the distance to that centroid). Returns
+            NOT_FOUND for an empty index.
+    */
+    index_t find_nearest_element(const float64 *point, float64 &distance) const;
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Batched find_nearest_element(), 'distances' may be NULL.
+    */
+    void find_nearest_elements(const float64 *points, index_t num_points,
+                               index_t *ids, float64 *distances,
+                               index_t num_threads = 1) const;
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Sets 'ids' to the elements whose centroids are inside a region,
+            in ascending order. 'classify(min, max)' returns -1 for boxes
+            outside of the region, 1 for boxes inside of it and 0 otherwise,
+            'contains(point)' tells whether a point is inside. Both take 3
+            coordinates. Subtrees whose boxes are inside or outside of the
+            region are taken or skipped without testing their elements.
+    */
+    void find_elements_in(const std::function<int(const float64 *, const float64 *)> &classify,
+                          const std::function<bool(const float64 *)> &contains,
+                          std::vector<index_t> &ids) const;
+
+private:
+    struct node
+    {
+        float64 min[3];
+        float64 max[3];
+        // the node's elements are [begin, end) in m_ids
+        index_t begin;
+        index_t end;
+        // the right child (the left child is the next node), -1 for leaves
+        index_t right;
+    };
+
+    index_t subtree_nodes(index_t n) const;
+    index_t build_node(index_t ni, index_t begin, index_t end,
+                       index_t num_threads);
+    bool contains(index_t ei, const float64 *p) const;
+    // queries for points with 3 coordinates (the axes past m_dim are 0)
+    index_t locate(const float64 *p) const;
+    index_t nearest(const float64 *p, float64 &distance) const;
+
+    index_t               m_dim;
+    index_t               m_leaf_size;
+    index_t               m_depth;
+    float64               m_tolerance;
+    // interleaved vertex coordinates (3 per vertex)
+    std::vector<float64>  m_coords;
+    // shape id of each element (ShapeType::id)
+    std::vector<index_t>  m_shapes;
+    // the vertices of element e are m_verts[m_offsets[e], m_offsets[e+1]),
+    // for polyhedra the concatenated vertices of their faces
+    std::vector<index_t>  m_offsets;
+    std::vector<index_t>  m_verts;
+    // the faces of polyhedron e are [m_elem_faces[e], m_elem_faces[e+1])
+    // in m_face_offsets, which index m_verts (empty for other shapes)
+    std::vector<index_t>  m_elem_faces;
+    std::vector<index_t>  m_face_offsets;
+    // element boxes (expanded by the tolerance) and centroids, 3 per element
+    std::vector<float64>  m_box_min;
+    std::vector<float64>  m_box_max;
+    std::vector<float64>  m_centroids;
+    std::vector<node>     m_nodes;
+    std::vector<index_t>  m_ids;
 };
 
 //-----------------------------------------------------------------------------
@@ -383,13 +964,25 @@ namespace coordset
     //-----------------------------------------------------------------------------
     /**
     @brief Reads the coordset's data and determines min/max for each axis.
-    NOTE: This simply takes the min/max of each data array for recilinear/explicit,
+    NOTE: This simply takes the min/max of each data array for explicit,
     are there any special considerations for cylindrical and spherical coordinates?
-    For uniform it calculates min/max based off of origin/spacing/dims.
+    For uniform it calculates min/max based off of origin/spacing/dims, and
+    for rectilinear from the end values of each (monotonic) axis.
     @return A vector of float64 in the format {d0min, d0max, ... , dNmin, dNmax}
     */
     std::vector<float64> CONDUIT_BLUEPRINT_API extents(const Node &n);
 
+    //-----------------------------------------------------------------------------
+    /**
+    @brief Returns extents(n), caching the extents of explicit coordsets in
+        n["state/extents"] along with the hash of n["values"]
+        (n["state/extents_hash"]). Later calls reuse the cached extents while
+        the hash matches. The values are hashed on each call (without
+        Node::hash's cache option), so writes through Node methods, data
+        arrays and raw pointers all invalidate the cached extents.
+    */
+    std::vector<float64> CONDUIT_BLUEPRINT_API cached_extents(Node &n);
+
     namespace uniform
     {
         /**
@@ -403,6 +996,109 @@ namespace coordset
 
     std::string CONDUIT_BLUEPRINT_API coordsys(const Node &coordset);
 
+    //-------------------------------------------------------------------------
+    /**
+    @brief Reads the point coordinates of a uniform, rectilinear or explicit
+           coordset, with the axes in the order of axes(). Uniform and
+           rectilinear coordinates are computed from the origin/spacing or
+           the per axis values as they are read (matching the values
+           to_explicit() would produce), so no explicit arrays are
+           allocated. The accessor refers to the coordset's data, which has
+           to outlive it.
+    */
+    class CONDUIT_BLUEPRINT_API CoordAccessor
+    {
+    public:
+        //---------------------------------------------------------------------
+        /**
+        @brief Reads one axis of the coordset; operator[] takes a point id.
+        */
+        class Axis
+        {
+        public:
+            Axis()
+            : m_values(static_cast<const void*>(NULL), DataType::empty()),
+              m_origin(0.0), m_spacing(1.0), m_stride(1), m_dim(1),
+              m_uniform(false), m_implicit(false)
+            {}
+
+            float64 operator[](index_t id) const
+            {
+                const index_t li = m_implicit ? (id / m_stride) % m_dim : id;
+                return m_uniform ? m_origin + li * m_spacing : m_values[li];
+            }
+
+        private:
+            friend class CoordAccessor;
+
+            float64_accessor m_values;
+            float64          m_origin;
+            float64          m_spacing;
+            index_t          m_stride;
+            index_t          m_dim;
+            bool             m_uniform;
+            bool             m_implicit;
+        };
+
+        CoordAccessor();
+        explicit CoordAccessor(const conduit::Node &coordset);
+
+        /// number of axes and number of points
+        index_t dims() const { return m_num_axes; }
+        index_t size() const { return m_num_points; }
+
+        /// true for uniform and rectilinear coordsets
+        bool is_implicit() const { return m_axes[0].m_implicit; }
+
+        const Axis &axis(index_t ai) const { return m_axes[ai]; }
+
+        float64 x(index_t id) const { return m_axes[0][id]; }
+        float64 y(index_t id) const { return m_num_axes > 1 ? m_axes[1][id] : 0.0; }
+        float64 z(index_t id) const { return m_num_axes > 2 ? m_axes[2][id] : 0.0; }
+
+        /// Sets 'point' (3 values) to the coordinates of point 'id', axes
+        /// the coordset doesn't have are 0.
+        void point(index_t id, float64 *point) const
+        {
+            point[0] = x(id);
+            point[1] = y(id);
+            point[2] = z(id);
+        }
+
+        //---------------------------------------------------------------------
+        /**
+        @brief Writes axis 'ai' of the points [begin, end) to 'dest'.
+        */
+        template <typename T>
+        void values(index_t ai, index_t begin, index_t end, T *dest) const
+        {
+            const Axis &a = m_axes[ai];
+            for(index_t id = begin; id < end; id++)
+            {
+                dest[id - begin] = static_cast<T>(a[id]);
+            }
+        }
+
+        //---------------------------------------------------------------------
+        /**
+        @brief Writes axis 'ai' of the 'count' points in 'ids' to 'dest'.
+        */
+        template <typename T, typename IdT>
+        void gather(index_t ai, const IdT *ids, index_t count, T *dest) const
+        {
+            const Axis &a = m_axes[ai];
+            for(index_t i = 0; i < count; i++)
+            {
+                dest[i] = static_cast<T>(a[static_cast<index_t>(ids[i])]);
+            }
+        }
+
+    private:
+        Axis    m_axes[3];
+        index_t m_num_axes;
+        index_t m_num_points;
+    };
+
     //-------------------------------------------------------------------------
     // -- begin conduit::blueprint::mesh::utils::coordset::_explicit --
     //-------------------------------------------------------------------------
@@ -440,7 +1136,12 @@ namespace topology
     /**
      * @brief Reindexes the vertices in a topology to be associated with a new
      * coordset, based on a global vertex ID numbering.
-     * The old coordset must be a subset of the new coordset.
+     * The old coordset must be a subset of the new coordset; an error is
+     * raised for global vertex ids missing from new_gvids.
+     *
+     * The global ids are looked up in a flat table when new_gvids spans a
+     * dense range, or by binary search otherwise. The connectivity is
+     * rewritten on up to 'num_threads' threads.
      */
     void CONDUIT_BLUEPRINT_API reindex_coords(const conduit::Node& topo,
                                               const conduit::Node& new_coordset,
@@ -448,6 +1149,45 @@ namespace topology
                                               const conduit::Node& new_gvids,
                                               conduit::Node& out_topo);
 
+    void CONDUIT_BLUEPRINT_API reindex_coords(const conduit::Node& topo,
+                                              const conduit::Node& new_coordset,
+                                              const conduit::Node& old_gvids,
+                                              const conduit::Node& new_gvids,
+                                              conduit::Node& out_topo,
+                                              index_t num_threads);
+
+    //-------------------------------------------------------------------------
+    /**
+    @brief Builds the element to vertex adjacency of a topology in CSR form:
+           the vertices of element e are
+           vertices[offsets[e]] ... vertices[offsets[e+1] - 1], each listed
+           once, in the order they first appear in the element (polyhedra
+           list the vertices of their faces). Single shape, polygonal and
+           structured topologies are read on up to 'num_threads' threads,
+           other topologies (mixed shapes, streams, polyhedra) serially.
+    */
+    void CONDUIT_BLUEPRINT_API element_vertices(const conduit::Node &topo,
+                                                index_t num_threads,
+                                                std::vector<index_t> &offsets,
+                                                std::vector<index_t> &vertices);
+
+    //-------------------------------------------------------------------------
+    /**
+    @brief Inverts a CSR adjacency from 'offsets.size() - 1' sources to
+           'num_targets' targets, for example the output of
+           element_vertices() into the elements of each vertex. The sources
+           of each target are listed in increasing order. The sources are
+           split into up to 'num_threads' chunks that count and place their
+           own entries, so no atomics are needed and the result doesn't
+           depend on the number of threads.
+    */
+    void CONDUIT_BLUEPRINT_API invert_adjacency(const std::vector<index_t> &offsets,
+                                                const std::vector<index_t> &values,
+                                                index_t num_targets,
+                                                index_t num_threads,
+                                                std::vector<index_t> &res_offsets,
+                                                std::vector<index_t> &res_values);
+
     //-------------------------------------------------------------------------
     // -- begin conduit::blueprint::mesh::utils::topology::unstructured --
     //-------------------------------------------------------------------------
@@ -464,10 +1204,24 @@ namespace topology
                                                     Node &dest_ele_offsets,
                                                     Node &dest_subele_offsets);
 
+        //-------------------------------------------------------------------------
+        // Generates element and subelement offsets for given topo, computing
+        // them as a prefix sum over the sizes split across 'num_threads'
+        // threads (small topologies use fewer threads).
+        void CONDUIT_BLUEPRINT_API generate_offsets(const Node &topo,
+                                                    Node &dest_ele_offsets,
+                                                    Node &dest_subele_offsets,
+                                                    index_t num_threads);
+
         //-------------------------------------------------------------------------
         // Adds offsets to given topo
         void CONDUIT_BLUEPRINT_API generate_offsets_inline(Node &topo);
 
+        //-------------------------------------------------------------------------
+        // Adds offsets to given topo, using up to 'num_threads' threads
+        void CONDUIT_BLUEPRINT_API generate_offsets_inline(Node &topo,
+                                                           index_t num_threads);
+
         //-------------------------------------------------------------------------
         std::vector<index_t> CONDUIT_BLUEPRINT_API points(const Node &topo,
                                                           const index_t i);
@@ -487,11 +1241,104 @@ namespace adjset
 {
     //-------------------------------------------------------------------------
     void CONDUIT_BLUEPRINT_API canonicalize(Node &adjset);
+
+    //-------------------------------------------------------------------------
+    // renames the groups after domain_id and their sorted neighbors, as
+    // canonicalize(adjset) does with the domain id found above adjset
+    void CONDUIT_BLUEPRINT_API canonicalize(Node &adjset, index_t domain_id);
+
+    //-------------------------------------------------------------------------
+    // The entities shared with each neighbor: the values of the groups, in
+    // sorted group name order, appended to the list of each neighbor of the
+    // group. nbrs holds the sorted neighbors and the entities of nbrs[i] are
+    // values[offsets[i], offsets[i+1]).
+    void CONDUIT_BLUEPRINT_API pairwise_values(const Node &adjset,
+                                               std::vector<index_t> &nbrs,
+                                               std::vector<index_t> &offsets,
+                                               std::vector<index_t> &values);
+
+    //-------------------------------------------------------------------------
+    // The max-share groups: each entity is placed in the group of all of the
+    // neighbors it is shared with. Output group gi has the sorted neighbors
+    // nbrs[nbrs_offsets[gi], nbrs_offsets[gi+1]) and the entities
+    // values[values_offsets[gi], values_offsets[gi+1]), in the order they
+    // first appear in the groups (in sorted group name order). The groups
+    // are ordered by their smallest entity.
+    void CONDUIT_BLUEPRINT_API maxshare_values(const Node &adjset,
+                                               std::vector<index_t> &nbrs_offsets,
+                                               std::vector<index_t> &nbrs,
+                                               std::vector<index_t> &values_offsets,
+                                               std::vector<index_t> &values);
+
+    //-------------------------------------------------------------------------
+    // Writes adjset with its groups replaced by the given flat groups (laid
+    // out as maxshare_values outputs them) to dest, with int_dtype neighbors
+    // and values. The groups are named by their index.
+    void CONDUIT_BLUEPRINT_API write_flat_groups(const Node &adjset,
+                                                 const DataType &int_dtype,
+                                                 const std::vector<index_t> &nbrs_offsets,
+                                                 const std::vector<index_t> &nbrs,
+                                                 const std::vector<index_t> &values_offsets,
+                                                 const std::vector<index_t> &values,
+                                                 Node &dest);
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils::adjset --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mesh::utils::matset --
+//-----------------------------------------------------------------------------
+namespace matset
+{
+    //-------------------------------------------------------------------------
+    // Per material partial reductions of the matset values of a field,
+    // which combine across domains and ranks. The weight of an entry is its
+    // volume fraction times the weight of its element.
+    struct MaterialStats
+    {
+        index_t count;
+        float64 sum;
+        float64 weighted_sum;
+        float64 weight;
+        float64 min;
+        float64 max;
+    };
+
+    //-------------------------------------------------------------------------
+    // The empty stats: no entries, and min/max at the +/- extremes.
+    MaterialStats CONDUIT_BLUEPRINT_API empty_material_stats();
+
+    //-------------------------------------------------------------------------
+    // Combines src into dest.
+    void CONDUIT_BLUEPRINT_API combine_material_stats(const MaterialStats &src,
+                                                      MaterialStats &dest);
+
+    //-------------------------------------------------------------------------
+    // Streams the entries of matset with the matset values of field and
+    // reduces them by material, without densifying the matset. names and
+    // stats hold one entry per material, in 'material_map' order. See
+    // blueprint::mesh::matset::reduce_by_material for the options.
+    void CONDUIT_BLUEPRINT_API material_stats(const Node &matset,
+                                              const Node &field,
+                                              const Node &options,
+                                              std::vector<std::string> &names,
+                                              std::vector<MaterialStats> &stats);
+
+    //-------------------------------------------------------------------------
+    // The value of op ("sum", "min", "max" or "average") for stats, checking
+    // op and that stats has entries.
+    float64 CONDUIT_BLUEPRINT_API material_stat(const MaterialStats &stats,
+                                                const std::string &op);
+
+    //-------------------------------------------------------------------------
+    // Raises an error unless op is one of the material_stat ops.
+    void CONDUIT_BLUEPRINT_API check_material_stat_op(const std::string &op);
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mesh::utils::matset --
+//-----------------------------------------------------------------------------
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils --
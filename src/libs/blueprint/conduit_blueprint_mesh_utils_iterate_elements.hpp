@@ -18,6 +18,7 @@
 //-----------------------------------------------------------------------------
 #include <algorithm>
 #include <array>
+#include <type_traits>
 #include <utility>
 
 
@@ -82,6 +83,58 @@ enum class ShapeId : index_t
     Polyhedral = 9
 };
 
+//-----------------------------------------------------------------------------
+// Number of point ids of each fixed (non-poly) shape, known at compile time.
+template<ShapeId S> struct fixed_shape_indices;
+template<> struct fixed_shape_indices<ShapeId::Point>   { static const index_t value = 1; };
+template<> struct fixed_shape_indices<ShapeId::Line>    { static const index_t value = 2; };
+template<> struct fixed_shape_indices<ShapeId::Tri>     { static const index_t value = 3; };
+template<> struct fixed_shape_indices<ShapeId::Quad>    { static const index_t value = 4; };
+template<> struct fixed_shape_indices<ShapeId::Tet>     { static const index_t value = 4; };
+template<> struct fixed_shape_indices<ShapeId::Hex>     { static const index_t value = 8; };
+template<> struct fixed_shape_indices<ShapeId::Wedge>   { static const index_t value = 6; };
+template<> struct fixed_shape_indices<ShapeId::Pyramid> { static const index_t value = 5; };
+
+//-----------------------------------------------------------------------------
+// Compile-time traits of each shape, matching the TOPO_SHAPE_* tables in
+// conduit_blueprint_mesh_utils.hpp: dimension, point ids per element (-1 for
+// poly shapes), and the TOPO_SHAPES id and count of the embedded shapes.
+template<ShapeId S> struct shape_traits;
+#define CONDUIT_BLUEPRINT_SHAPE_TRAITS(S, DIM, INDICES, EMBED_ID, EMBED_COUNT) \
+template<> struct shape_traits<ShapeId::S>                                    \
+{                                                                              \
+    static const index_t id = (index_t)ShapeId::S;                            \
+    static const index_t dim = DIM;                                           \
+    static const index_t indices = INDICES;                                   \
+    static const index_t embed_id = EMBED_ID;                                 \
+    static const index_t embed_count = EMBED_COUNT;                           \
+    static const bool is_poly = INDICES < 0;                                  \
+}
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Point,      0,  1, -1,  0);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Line,       1,  2,  0,  2);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Tri,        2,  3,  1,  3);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Quad,       2,  4,  1,  4);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Tet,        3,  4,  2,  4);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Hex,        3,  8,  3,  6);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Wedge,      3,  6,  2,  8);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Pyramid,    3,  5,  2,  6);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Polygonal,  2, -1,  1, -1);
+CONDUIT_BLUEPRINT_SHAPE_TRAITS(Polyhedral, 3, -1,  8, -1);
+#undef CONDUIT_BLUEPRINT_SHAPE_TRAITS
+
+//-----------------------------------------------------------------------------
+// One element of a single shape topology. Unlike 'entity', the point ids of
+// the element are held in a fixed size array, so iterating doesn't allocate.
+template<ShapeId S>
+struct fixed_entity
+{
+    static const ShapeId shape_id = S;
+    static const index_t num_indices = fixed_shape_indices<S>::value;
+
+    std::array<index_t, fixed_shape_indices<S>::value> element_ids;
+    index_t                                            entity_id;
+};
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::blueprint::mesh::utils::topology::impl --
 //-----------------------------------------------------------------------------
@@ -567,6 +620,243 @@ traverse_structured(FuncType &&func, const Node &topo)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Calls func for the elements [begin, end) of a single shape connectivity
+// array, 'conn' is any view with operator[] (Span, StridedView, accessor).
+template<ShapeId S, typename ConnType, typename FuncType>
+inline void
+traverse_fixed_range(FuncType &func, const ConnType &conn,
+                     index_t begin, index_t end)
+{
+    const index_t ent_size = fixed_shape_indices<S>::value;
+    fixed_entity<S> e;
+    for(index_t i = begin; i < end; i++)
+    {
+        e.entity_id = i;
+        const index_t ei = i * ent_size;
+        for(index_t j = 0; j < ent_size; j++)
+        {
+            e.element_ids[j] = (index_t)conn[ei + j];
+        }
+        func(e);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<ShapeId S, typename ConnType, typename FuncType>
+inline void
+traverse_fixed_chunks(FuncType &func, const ConnType &conn,
+                      index_t nents, index_t num_threads)
+{
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, nents, 1024), nents,
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        traverse_fixed_range<S>(func, conn, begin, end);
+    });
+}
+
+//-----------------------------------------------------------------------------
+// Point ids of the element at logical index (i,j,k) of a structured
+// topology with nx * ny points per k plane.
+template<ShapeId S> struct structured_element;
+
+template<> struct structured_element<ShapeId::Line>
+{
+    static void ids(index_t *e, index_t i, index_t, index_t, index_t, index_t)
+    {
+        e[0] = i;
+        e[1] = i + 1;
+    }
+};
+
+template<> struct structured_element<ShapeId::Quad>
+{
+    static void ids(index_t *e, index_t i, index_t j, index_t, index_t nx, index_t)
+    {
+        const index_t jnx  = j * nx;
+        const index_t j1nx = (j + 1) * nx;
+        e[0] = jnx + i;
+        e[1] = jnx + i + 1;
+        e[2] = j1nx + i + 1;
+        e[3] = j1nx + i;
+    }
+};
+
+template<> struct structured_element<ShapeId::Hex>
+{
+    static void ids(index_t *e, index_t i, index_t j, index_t k, index_t nx, index_t ny)
+    {
+        const index_t knxny  = k * nx * ny;
+        const index_t k1nxny = (k + 1) * nx * ny;
+        const index_t jnx  = j * nx;
+        const index_t j1nx = (j + 1) * nx;
+        e[0] = knxny  + jnx  + i;
+        e[1] = knxny  + jnx  + i + 1;
+        e[2] = knxny  + j1nx + i + 1;
+        e[3] = knxny  + j1nx + i;
+        e[4] = k1nxny + jnx  + i;
+        e[5] = k1nxny + jnx  + i + 1;
+        e[6] = k1nxny + j1nx + i + 1;
+        e[7] = k1nxny + j1nx + i;
+    }
+};
+
+//-----------------------------------------------------------------------------
+template<ShapeId S, typename FuncType>
+inline void
+traverse_structured_range(FuncType &func, const std::array<index_t, 3> &dims,
+                          index_t begin, index_t end)
+{
+    const index_t nx = dims[0] + 1;
+    const index_t ny = dims[1] + 1;
+    fixed_entity<S> e;
+    for(index_t id = begin; id < end; id++)
+    {
+        const index_t i = id % dims[0];
+        const index_t j = (id / dims[0]) % dims[1];
+        const index_t k = id / (dims[0] * dims[1]);
+        e.entity_id = id;
+        structured_element<S>::ids(e.element_ids.data(), i, j, k, nx, ny);
+        func(e);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Returns the shape of the elements of a single (fixed) shape topology.
+inline ShapeId
+fixed_shape_id(const Node &topo)
+{
+    const std::string topo_type = topo["type"].as_string();
+    if(topo_type == "unstructured")
+    {
+        const Node *shape = topo.fetch_ptr("elements/shape");
+        if(shape != NULL && shape->dtype().is_string())
+        {
+            const ShapeType st(shape->as_string());
+            if(st.is_valid() && !st.is_poly() && st.type != "mixed")
+            {
+                return (ShapeId)st.id;
+            }
+        }
+    }
+    else if(topo_type == "uniform" ||
+            topo_type == "rectilinear" ||
+            topo_type == "structured")
+    {
+        const index_t dimension = topology::dims(topo);
+        if(dimension >= 1 && dimension <= 3)
+        {
+            const ShapeId ids[] = {ShapeId::Line, ShapeId::Quad, ShapeId::Hex};
+            return ids[dimension - 1];
+        }
+    }
+
+    CONDUIT_ERROR("iterate_fixed_elements: topology doesn't have a single "
+                  "fixed element shape");
+    return ShapeId::Point;
+}
+
+//-----------------------------------------------------------------------------
+template<ShapeId S, typename FuncType>
+inline void
+traverse_fixed_structured(FuncType &func, const Node &topo, index_t num_threads,
+                          std::true_type /*is_structured_shape*/)
+{
+    std::array<index_t, 3> dims{{1, 1, 1}};
+    topology::logical_dims(topo, dims.data(), 3);
+    const index_t dimension = topology::dims(topo);
+    index_t nents = 1;
+    for(index_t d = 0; d < dimension; d++)
+    {
+        nents *= dims[d];
+    }
+
+    detail::parallel_chunks(
+        detail::parallel_num_chunks(num_threads, nents, 1024), nents,
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        traverse_structured_range<S>(func, dims, begin, end);
+    });
+}
+
+template<ShapeId S, typename FuncType>
+inline void
+traverse_fixed_structured(FuncType &, const Node &, index_t,
+                          std::false_type /*is_structured_shape*/)
+{
+    CONDUIT_ERROR("iterate_fixed_elements: structured topologies only have "
+                  "line, quad or hex elements");
+}
+
+//-----------------------------------------------------------------------------
+template<ShapeId S, typename FuncType>
+inline void
+traverse_fixed(FuncType &func, const Node &topo, index_t num_threads)
+{
+    const ShapeId topo_shape = fixed_shape_id(topo);
+    if(topo_shape != S)
+    {
+        CONDUIT_ERROR("iterate_fixed_elements: topology has shape "
+                      << ShapeType((index_t)topo_shape).type
+                      << ", not " << ShapeType((index_t)S).type);
+    }
+
+    if(topo["type"].as_string() != "unstructured")
+    {
+        typedef std::integral_constant<bool,
+            S == ShapeId::Line || S == ShapeId::Quad || S == ShapeId::Hex> is_structured_shape;
+        traverse_fixed_structured<S>(func, topo, num_threads, is_structured_shape());
+        return;
+    }
+
+    // NOTE: int32 and int64 connectivity is read through typed views,
+    // other types through an index_t accessor
+    const Node &conn = topo["elements/connectivity"];
+    const DataType &conn_dtype = conn.dtype();
+    const index_t nents = conn_dtype.number_of_elements() / fixed_shape_indices<S>::value;
+    if(conn_dtype.is_int32() && conn_dtype.is_compact())
+    {
+        traverse_fixed_chunks<S>(func, conn.as_span<int32>(), nents, num_threads);
+    }
+    else if(conn_dtype.is_int64() && conn_dtype.is_compact())
+    {
+        traverse_fixed_chunks<S>(func, conn.as_span<int64>(), nents, num_threads);
+    }
+    else if(conn_dtype.is_int32())
+    {
+        traverse_fixed_chunks<S>(func, conn.as_strided_view<int32>(), nents, num_threads);
+    }
+    else if(conn_dtype.is_int64())
+    {
+        traverse_fixed_chunks<S>(func, conn.as_strided_view<int64>(), nents, num_threads);
+    }
+    else
+    {
+        traverse_fixed_chunks<S>(func, conn.as_index_t_accessor(), nents, num_threads);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<typename FuncType>
+inline void
+dispatch_fixed(FuncType &func, const Node &topo, index_t num_threads)
+{
+    switch(fixed_shape_id(topo))
+    {
+    case ShapeId::Point:   traverse_fixed<ShapeId::Point>(func, topo, num_threads);   break;
+    case ShapeId::Line:    traverse_fixed<ShapeId::Line>(func, topo, num_threads);    break;
+    case ShapeId::Tri:     traverse_fixed<ShapeId::Tri>(func, topo, num_threads);     break;
+    case ShapeId::Quad:    traverse_fixed<ShapeId::Quad>(func, topo, num_threads);    break;
+    case ShapeId::Tet:     traverse_fixed<ShapeId::Tet>(func, topo, num_threads);     break;
+    case ShapeId::Hex:     traverse_fixed<ShapeId::Hex>(func, topo, num_threads);     break;
+    case ShapeId::Wedge:   traverse_fixed<ShapeId::Wedge>(func, topo, num_threads);   break;
+    case ShapeId::Pyramid: traverse_fixed<ShapeId::Pyramid>(func, topo, num_threads); break;
+    default:
+        CONDUIT_ERROR("iterate_fixed_elements: unsupported shape");
+    }
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils::topology::impl --
@@ -676,6 +966,57 @@ iterate_elements(const Node &topo, Func &&func)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Fixed shape iteration
+//
+// Calls 'func(const fixed_entity<S> &e)' for each element of 'topo', which
+// must be an unstructured topology with the single shape S (point, line,
+// tri, quad, tet, hex, wedge or pyramid), or a uniform, rectilinear or
+// structured topology (line, quad or hex elements). Element ids are the
+// same as those given by iterate_elements.
+//
+//   iterate_fixed_elements<ShapeId::Hex>(topo,
+//       [&](const fixed_entity<ShapeId::Hex> &e) { ... });
+//
+// The variants without S dispatch on the topology's shape at runtime, so
+// 'func' must accept any fixed_entity<S> (e.g. a functor with a templated
+// operator()).
+//
+// The _parallel variants split the elements into contiguous ranges on up
+// to 'num_threads' threads, so 'func' is called concurrently (with each
+// element once) and must be safe to call that way.
+//-----------------------------------------------------------------------------
+template<ShapeId S, typename Func>
+inline void
+iterate_fixed_elements(const Node &topo, Func &&func)
+{
+    impl::traverse_fixed<S>(func, topo, 1);
+}
+
+//-----------------------------------------------------------------------------
+template<ShapeId S, typename Func>
+inline void
+iterate_fixed_elements_parallel(const Node &topo, index_t num_threads, Func &&func)
+{
+    impl::traverse_fixed<S>(func, topo, num_threads);
+}
+
+//-----------------------------------------------------------------------------
+template<typename Func>
+inline void
+iterate_fixed_elements(const Node &topo, Func &&func)
+{
+    impl::dispatch_fixed(func, topo, 1);
+}
+
+//-----------------------------------------------------------------------------
+template<typename Func>
+inline void
+iterate_fixed_elements_parallel(const Node &topo, index_t num_threads, Func &&func)
+{
+    impl::dispatch_fixed(func, topo, num_threads);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils::topology --
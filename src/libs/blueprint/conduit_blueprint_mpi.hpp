@@ -19,6 +19,7 @@
 #include "conduit_blueprint_exports.h"
 #include "conduit_blueprint_mpi_mesh.hpp"
 #include "conduit_blueprint_mpi_mesh_examples.hpp"
+#include "conduit_blueprint_mpi_mesh_exchange.hpp"
 
 
 #include <mpi.h>
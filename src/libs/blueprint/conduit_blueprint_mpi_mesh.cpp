@@ -12,6 +12,7 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <map>
 #include <tuple>
 #include <vector>
 #include <cmath>
@@ -22,16 +23,20 @@
 #include "conduit_blueprint_mesh.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_blueprint_mpi_mesh.hpp"
+#include "conduit_blueprint_mpi_mesh_exchange.hpp"
 #include "conduit_blueprint_mpi_mesh_flatten.hpp"
 #include "conduit_blueprint_mpi_mesh_partition.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
 #include "conduit_relay_mpi.hpp"
+#include "conduit_fmt/conduit_fmt.h"
 #include <assert.h>
 #include <cmath>
 #include <limits>
 #include <list>
+#include <numeric>
+#include <thread>
 // access conduit blueprint mesh utilities
 namespace bputils = conduit::blueprint::mesh::utils;
 
@@ -116,25 +121,36 @@ verify(const conduit::Node &n,
 }
 
 //-------------------------------------------------------------------------
-void
-generate_index(const conduit::Node &mesh,
-               const std::string &ref_path,
-               Node &index_out,
-               MPI_Comm comm)
+// Unions the index of every rank up a tree to root (every rank when root is
+// negative) and sets the global number of domains.
+static void
+union_local_indices(const Node &local_idx,
+                    index_t global_num_domains,
+                    int root,
+                    Node &index_out,
+                    MPI_Comm comm)
 {
-    // we need a list of all possible topos, coordsets, etc
-    // for the blueprint index in the root file. 
-    //
-    // across ranks, domains may be sparse
-    //  for example: a topo may only exist in one domain
-    // so we union all local mesh indices, and then 
-    // se an all gather and union the results together
-    // to create an accurate global index. 
+    index_out.reset();
+    if(root < 0)
+    {
+        relay::mpi::all_union_using_schema(local_idx, index_out, comm);
+    }
+    else
+    {
+        relay::mpi::union_using_schema(local_idx, index_out, root, comm);
+    }
 
-    index_t local_num_domains = blueprint::mesh::number_of_domains(mesh);
-    // note: 
-    // find global # of domains w/o conduit_blueprint_mpi for now
-    // since we aren't yet linking conduit_blueprint_mpi
+    if(root < 0 || relay::mpi::rank(comm) == root)
+    {
+        index_out["state/number_of_domains"] = global_num_domains;
+    }
+}
+
+//-------------------------------------------------------------------------
+static index_t
+global_number_of_domains(index_t local_num_domains,
+                         MPI_Comm comm)
+{
     Node n_src, n_reduce;
     n_src = local_num_domains;
 
@@ -142,11 +158,31 @@ generate_index(const conduit::Node &mesh,
                                n_reduce,
                                comm);
 
-    index_t global_num_domains = n_reduce.to_int();
+    return n_reduce.to_index_t();
+}
 
-    index_out.reset();
+//-------------------------------------------------------------------------
+static void
+union_mesh_index(const conduit::Node &mesh,
+                 const std::string &ref_path,
+                 int root,
+                 Node &index_out,
+                 MPI_Comm comm)
+{
+    // we need a list of all possible topos, coordsets, etc
+    // for the blueprint index in the root file. 
+    //
+    // across ranks, domains may be sparse
+    //  for example: a topo may only exist in one domain
+    // so we union all local mesh indices, and then 
+    // union the results of all ranks up a tree
+    // to create an accurate global index. 
 
-    Node local_idx, gather_idx;
+    index_t local_num_domains = blueprint::mesh::number_of_domains(mesh);
+    index_t global_num_domains = global_number_of_domains(local_num_domains,
+                                                          comm);
+
+    Node local_idx;
 
     if(local_num_domains > 0)
     {
@@ -156,18 +192,62 @@ generate_index(const conduit::Node &mesh,
                                                    local_idx);
     }
 
-    relay::mpi::all_gather_using_schema(local_idx,
-                                        gather_idx,
-                                        comm);
+    union_local_indices(local_idx, global_num_domains, root, index_out, comm);
+}
 
-    // union all entries into final index that reps
-    // all domains
-    NodeConstIterator itr = gather_idx.children();
+//-------------------------------------------------------------------------
+void
+generate_index(const conduit::Node &mesh,
+               const std::string &ref_path,
+               Node &index_out,
+               MPI_Comm comm)
+{
+    union_mesh_index(mesh, ref_path, -1, index_out, comm);
+}
+
+//-------------------------------------------------------------------------
+void
+generate_index(const conduit::Node &mesh,
+               const std::string &ref_path,
+               Node &index_out,
+               int root,
+               MPI_Comm comm)
+{
+    if(root < 0 || root >= relay::mpi::size(comm))
+    {
+        CONDUIT_ERROR("generate_index: root (" << root << ") must be a rank"
+                      " of the communicator.");
+    }
+    union_mesh_index(mesh, ref_path, root, index_out, comm);
+}
+
+//-------------------------------------------------------------------------
+void
+generate_index_from_summaries(const conduit::Node &summaries,
+                              Node &index_out,
+                              int root,
+                              MPI_Comm comm)
+{
+    if(root < 0 || root >= relay::mpi::size(comm))
+    {
+        CONDUIT_ERROR("generate_index_from_summaries: root (" << root << ")"
+                      " must be a rank of the communicator.");
+    }
+
+    index_t local_num_domains = summaries.number_of_children();
+    index_t global_num_domains = global_number_of_domains(local_num_domains,
+                                                          comm);
+
+    // union the summaries of the local domains, the same way the serial
+    // generate_index unions the index of each domain
+    Node local_idx;
+    NodeConstIterator itr = summaries.children();
     while(itr.has_next())
     {
-        const Node &curr = itr.next();
-        index_out.update(curr);
+        local_idx.update(itr.next());
     }
+
+    union_local_indices(local_idx, global_num_domains, root, index_out, comm);
 }
 
 
@@ -212,6 +292,221 @@ void generate_domain_to_rank_map(const conduit::Node &mesh,
     relay::mpi::max_all_reduce(local_par, domain_to_rank_map, comm);
 }
 
+//-----------------------------------------------------------------------------
+// Picks the rank that keeps the directory entry of a domain id. The ids are
+// mixed (splitmix64 finalizer) so consecutive ids spread over the ranks.
+static int
+domain_directory_owner(int64 domain_id, int par_size)
+{
+    uint64 h = static_cast<uint64>(domain_id);
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return static_cast<int>(h % static_cast<uint64>(par_size));
+}
+
+//-----------------------------------------------------------------------------
+void generate_domain_to_rank_map(const conduit::Node &mesh,
+                                 const conduit::Node &domain_ids,
+                                 Node &domain_to_rank_map,
+                                 MPI_Comm comm)
+{
+    const int par_rank = relay::mpi::rank(comm);
+    const int par_size = relay::mpi::size(comm);
+
+    // the local domains register with their owners
+    std::vector<const Node *> domains = ::conduit::blueprint::mesh::domains(mesh);
+    std::vector<int64> local_domains;
+    for(index_t di = 0; di < (index_t)domains.size(); di++)
+    {
+        const conduit::Node &domain = *domains[di];
+
+        int64 domain_id = par_rank;
+        if(domain.has_child("state") && domain["state"].has_child("domain_id"))
+        {
+            domain_id = domain["state/domain_id"].to_int64();
+        }
+        local_domains.push_back(domain_id);
+    }
+
+    // the queried ids, sorted and unique
+    std::vector<int64> queries;
+    if(!domain_ids.dtype().is_empty())
+    {
+        Node n_ids;
+        domain_ids.to_int64_array(n_ids);
+        const int64 *ids_ptr = n_ids.as_int64_ptr();
+        queries.assign(ids_ptr, ids_ptr + n_ids.dtype().number_of_elements());
+    }
+    std::sort(queries.begin(), queries.end());
+    queries.erase(std::unique(queries.begin(), queries.end()), queries.end());
+
+    // bucket the registrations and queries by owner. Each message holds the
+    // registered ids followed by the queried ids.
+    std::vector<std::vector<int64>> regs_by_owner(par_size);
+    std::vector<std::vector<int64>> queries_by_owner(par_size);
+    for(const int64 domain_id : local_domains)
+    {
+        regs_by_owner[domain_directory_owner(domain_id, par_size)].push_back(domain_id);
+    }
+    for(const int64 domain_id : queries)
+    {
+        queries_by_owner[domain_directory_owner(domain_id, par_size)].push_back(domain_id);
+    }
+
+    // the only count exchange: (# registrations, # queries) per peer
+    std::vector<int> snd_counts(2 * par_size), rcv_counts(2 * par_size);
+    for(int p = 0; p < par_size; p++)
+    {
+        snd_counts[2 * p]     = static_cast<int>(regs_by_owner[p].size());
+        snd_counts[2 * p + 1] = static_cast<int>(queries_by_owner[p].size());
+    }
+    MPI_Alltoall(snd_counts.data(), 2, MPI_INT,
+                 rcv_counts.data(), 2, MPI_INT, comm);
+
+    std::vector<int> snd_sizes(par_size), snd_displs(par_size);
+    std::vector<int> rcv_sizes(par_size), rcv_displs(par_size);
+    std::vector<int> qry_sizes(par_size), qry_displs(par_size);
+    std::vector<int> ans_sizes(par_size), ans_displs(par_size);
+    int snd_total = 0, rcv_total = 0, qry_total = 0, ans_total = 0;
+    for(int p = 0; p < par_size; p++)
+    {
+        snd_sizes[p] = snd_counts[2 * p] + snd_counts[2 * p + 1];
+        snd_displs[p] = snd_total;
+        snd_total += snd_sizes[p];
+
+        rcv_sizes[p] = rcv_counts[2 * p] + rcv_counts[2 * p + 1];
+        rcv_displs[p] = rcv_total;
+        rcv_total += rcv_sizes[p];
+
+        // answers to the queries we received go back to their sender, the
+        // answers to ours come back in the order we asked
+        qry_sizes[p] = rcv_counts[2 * p + 1];
+        qry_displs[p] = qry_total;
+        qry_total += qry_sizes[p];
+
+        ans_sizes[p] = snd_counts[2 * p + 1];
+        ans_displs[p] = ans_total;
+        ans_total += ans_sizes[p];
+    }
+
+    std::vector<int64> snd_buffer;
+    snd_buffer.reserve(snd_total);
+    for(int p = 0; p < par_size; p++)
+    {
+        snd_buffer.insert(snd_buffer.end(),
+                          regs_by_owner[p].begin(), regs_by_owner[p].end());
+        snd_buffer.insert(snd_buffer.end(),
+                          queries_by_owner[p].begin(), queries_by_owner[p].end());
+    }
+
+    std::vector<int64> rcv_buffer(rcv_total);
+    MPI_Alltoallv(snd_buffer.data(), snd_sizes.data(), snd_displs.data(), MPI_INT64_T,
+                  rcv_buffer.data(), rcv_sizes.data(), rcv_displs.data(), MPI_INT64_T,
+                  comm);
+
+    // build this rank's part of the directory. Like the dense map, the
+    // highest rank wins if a domain id is registered more than once.
+    std::map<int64, int64> directory;
+    for(int p = 0; p < par_size; p++)
+    {
+        const int64 *regs = rcv_buffer.data() + rcv_displs[p];
+        for(int i = 0; i < rcv_counts[2 * p]; i++)
+        {
+            int64 &owner = directory.emplace(regs[i], -1).first->second;
+            owner = std::max(owner, static_cast<int64>(p));
+        }
+    }
+
+    // answer the queries
+    std::vector<int64> qry_answers(qry_total);
+    for(int p = 0; p < par_size; p++)
+    {
+        const int64 *qrys = rcv_buffer.data() + rcv_displs[p] + rcv_counts[2 * p];
+        int64 *answers = qry_answers.data() + qry_displs[p];
+        for(int i = 0; i < rcv_counts[2 * p + 1]; i++)
+        {
+            auto itr = directory.find(qrys[i]);
+            answers[i] = (itr != directory.end()) ? itr->second : -1;
+        }
+    }
+
+    std::vector<int64> answers(ans_total);
+    MPI_Alltoallv(qry_answers.data(), qry_sizes.data(), qry_displs.data(), MPI_INT64_T,
+                  answers.data(), ans_sizes.data(), ans_displs.data(), MPI_INT64_T,
+                  comm);
+
+    // queries_by_owner[p] was answered in order at answers[ans_displs[p]]
+    std::map<int64, int64> found;
+    for(int p = 0; p < par_size; p++)
+    {
+        for(size_t i = 0; i < queries_by_owner[p].size(); i++)
+        {
+            found[queries_by_owner[p][i]] = answers[ans_displs[p] + i];
+        }
+    }
+
+    domain_to_rank_map.reset();
+    domain_to_rank_map["domain_ids"].set(DataType::int64(queries.size()));
+    domain_to_rank_map["ranks"].set(DataType::int64(queries.size()));
+    int64 *ids_ptr   = domain_to_rank_map["domain_ids"].value();
+    int64 *ranks_ptr = domain_to_rank_map["ranks"].value();
+    size_t i = 0;
+    for(const auto &entry : found)
+    {
+        ids_ptr[i] = entry.first;
+        ranks_ptr[i] = entry.second;
+        i++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void generate_neighbor_domain_to_rank_map(const conduit::Node &mesh,
+                                          Node &domain_to_rank_map,
+                                          MPI_Comm comm)
+{
+    // collect the neighbor domains of every adjset group
+    std::vector<int64> neighbors;
+    std::vector<const Node *> domains = ::conduit::blueprint::mesh::domains(mesh);
+    for(const Node *domain : domains)
+    {
+        if(!domain->has_child("adjsets"))
+        {
+            continue;
+        }
+
+        NodeConstIterator adjset_itr = domain->fetch_existing("adjsets").children();
+        while(adjset_itr.has_next())
+        {
+            const Node &adjset = adjset_itr.next();
+            if(!adjset.has_child("groups"))
+            {
+                continue;
+            }
+
+            NodeConstIterator group_itr = adjset["groups"].children();
+            while(group_itr.has_next())
+            {
+                const Node &group = group_itr.next();
+                if(group.has_child("neighbors"))
+                {
+                    Node n_nbrs;
+                    group["neighbors"].to_int64_array(n_nbrs);
+                    const int64 *nbrs_ptr = n_nbrs.as_int64_ptr();
+                    neighbors.insert(neighbors.end(), nbrs_ptr,
+                        nbrs_ptr + n_nbrs.dtype().number_of_elements());
+                }
+            }
+        }
+    }
+
+    Node n_neighbors;
+    n_neighbors.set_external(neighbors);
+    generate_domain_to_rank_map(mesh, n_neighbors, domain_to_rank_map, comm);
+}
+
 
 //-----------------------------------------------------------------------------
 index_t
@@ -712,6 +1007,8 @@ partition(const conduit::Node &n_mesh,
           conduit::Node &output,
           MPI_Comm comm)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mpi::mesh::partition");
+
     ParallelPartitioner p(comm);
     output.reset();
 
@@ -734,6 +1031,8 @@ partition_map_back(const conduit::Node& repart_mesh,
                    conduit::Node& orig_mesh,
                    MPI_Comm comm)
 {
+    CONDUIT_ANNOTATE_MARK_SCOPE("blueprint::mpi::mesh::partition_map_back");
+
     ParallelPartitioner p(comm);
     p.map_back_fields(repart_mesh, options, orig_mesh);
 }
@@ -785,6 +1084,814 @@ find_delegate_domain(const conduit::Node &n,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+exchange_fields(conduit::Node &mesh,
+                const std::string &adjset_name,
+                const std::vector<std::string> &field_names,
+                MPI_Comm comm)
+{
+    Node opts;
+    exchange_fields(mesh, adjset_name, field_names, opts, comm);
+}
+
+//-----------------------------------------------------------------------------
+void
+exchange_fields(conduit::Node &mesh,
+                const std::string &adjset_name,
+                const std::vector<std::string> &field_names,
+                const conduit::Node &options,
+                MPI_Comm comm)
+{
+    bool check_association = true;
+    if(options.has_child("check_association"))
+    {
+        check_association = options["check_association"].to_int() != 0;
+    }
+
+    // every rank checks its own domains and all ranks fail together
+    std::string bad_field = "";
+    if(check_association)
+    {
+        const std::vector<Node *> doms = ::conduit::blueprint::mesh::domains(mesh);
+        for(const Node *dom_ptr : doms)
+        {
+            const Node &dom = *dom_ptr;
+            if(!dom.has_child("adjsets") || !dom["adjsets"].has_child(adjset_name))
+            {
+                continue;
+            }
+            const Node &adjset = dom["adjsets"][adjset_name];
+            for(const std::string &field_name : field_names)
+            {
+                if(!dom.has_child("fields") || !dom["fields"].has_child(field_name))
+                {
+                    continue;
+                }
+                const Node &field = dom["fields"][field_name];
+                if(field["association"].as_string() != adjset["association"].as_string() ||
+                   field["topology"].as_string() != adjset["topology"].as_string())
+                {
+                    bad_field = field_name;
+                }
+            }
+        }
+    }
+    int local_bad = bad_field.empty() ? 0 : 1;
+    int global_bad = 0;
+    MPI_Allreduce(&local_bad, &global_bad, 1, MPI_INT, MPI_MAX, comm);
+    if(global_bad > 0)
+    {
+        CONDUIT_ERROR("exchange_fields: field "
+                      << (bad_field.empty() ? std::string("on another rank")
+                                            : "\"" + bad_field + "\"")
+                      << " does not have the association and topology"
+                      << " of adjset " << "\"" << adjset_name << "\"");
+    }
+
+    AdjsetExchange plan;
+    plan.build(mesh, adjset_name, comm);
+    plan.exchange(mesh, field_names);
+}
+
+//-----------------------------------------------------------------------------
+void
+generate_maxshare_adjset(conduit::Node &mesh,
+                         const std::string &adjset_name,
+                         const std::string &dest_adjset_name,
+                         MPI_Comm comm)
+{
+    const int par_rank = relay::mpi::rank(comm);
+    const int par_size = relay::mpi::size(comm);
+
+    // the entities each domain shares with every neighbor (pairwise) and its
+    // max-share groups
+    struct DomainShares
+    {
+        Node *dom;
+        index_t domain_id;
+        std::vector<index_t> pw_nbrs, pw_offsets, pw_values;
+        // (entity, position) of each pairwise segment, sorted by entity
+        std::vector<std::pair<index_t, index_t>> pw_sorted;
+        std::vector<index_t> nbrs_offsets, nbrs, values_offsets, values;
+        // (entity, group) sorted by entity
+        std::vector<std::pair<index_t, index_t>> ent_groups;
+        std::vector<index_t> group_owner;
+    };
+
+    std::vector<DomainShares> shares;
+    std::vector<int64> nbr_ids;
+    for(Node *dom : ::conduit::blueprint::mesh::domains(mesh))
+    {
+        if(!dom->has_child("adjsets") || !(*dom)["adjsets"].has_child(adjset_name))
+        {
+            continue;
+        }
+        const Node &adjset = (*dom)["adjsets"][adjset_name];
+
+        shares.push_back(DomainShares());
+        DomainShares &ds = shares.back();
+        ds.dom = dom;
+        ds.domain_id = dom->has_path("state/domain_id") ?
+            (*dom)["state/domain_id"].to_index_t() : par_rank;
+
+        bputils::adjset::pairwise_values(adjset, ds.pw_nbrs, ds.pw_offsets,
+                                         ds.pw_values);
+        bputils::adjset::maxshare_values(adjset, ds.nbrs_offsets, ds.nbrs,
+                                         ds.values_offsets, ds.values);
+        nbr_ids.insert(nbr_ids.end(), ds.pw_nbrs.begin(), ds.pw_nbrs.end());
+
+        ds.pw_sorted.resize(ds.pw_values.size());
+        for(size_t ni = 0; ni < ds.pw_nbrs.size(); ni++)
+        {
+            for(index_t pi = ds.pw_offsets[ni]; pi < ds.pw_offsets[ni + 1]; pi++)
+            {
+                ds.pw_sorted[pi] = std::make_pair(ds.pw_values[pi],
+                                                  pi - ds.pw_offsets[ni]);
+            }
+            std::sort(ds.pw_sorted.begin() + ds.pw_offsets[ni],
+                      ds.pw_sorted.begin() + ds.pw_offsets[ni + 1]);
+        }
+
+        const index_t num_groups = (index_t)ds.nbrs_offsets.size() - 1;
+        ds.group_owner.resize(num_groups);
+        for(index_t gi = 0; gi < num_groups; gi++)
+        {
+            // neighbors are sorted, the owner is the lowest domain id
+            ds.group_owner[gi] = std::min(ds.domain_id, ds.nbrs[ds.nbrs_offsets[gi]]);
+            for(index_t vi = ds.values_offsets[gi]; vi < ds.values_offsets[gi + 1]; vi++)
+            {
+                ds.ent_groups.push_back(std::make_pair(ds.values[vi], gi));
+            }
+        }
+        std::sort(ds.ent_groups.begin(), ds.ent_groups.end());
+    }
+
+    Node n_nbr_ids, rank_map;
+    n_nbr_ids.set_external(nbr_ids);
+    generate_domain_to_rank_map(mesh, n_nbr_ids, rank_map, comm);
+    const int64_accessor map_ids = rank_map["domain_ids"].value();
+    const int64_accessor map_ranks = rank_map["ranks"].value();
+    auto rank_of = [&](index_t domain_id) -> int
+    {
+        index_t lo = 0, hi = map_ids.number_of_elements();
+        while(lo < hi)
+        {
+            const index_t mid = (lo + hi) / 2;
+            if(map_ids[mid] < domain_id) lo = mid + 1; else hi = mid;
+        }
+        return (lo < map_ids.number_of_elements() && map_ids[lo] == domain_id) ?
+            (int)map_ranks[lo] : -1;
+    };
+
+    // the owner of each group lists its entities in ascending order and
+    // sends the other members their positions in the pairwise list the
+    // two domains share, (from, to) -> positions
+    std::string error_msg = "";
+    std::map<std::pair<index_t, index_t>, std::vector<int64>> messages;
+    std::vector<int> send_to(par_size, 0), recv_from(par_size, 0);
+    for(DomainShares &ds : shares)
+    {
+        const index_t num_groups = (index_t)ds.group_owner.size();
+        for(index_t gi = 0; gi < num_groups; gi++)
+        {
+            const index_t owner = ds.group_owner[gi];
+            if(owner != ds.domain_id)
+            {
+                const int owner_rank = rank_of(owner);
+                if(owner_rank < 0)
+                {
+                    error_msg = conduit_fmt::format("domain {} is not on any rank", owner);
+                }
+                else if(owner_rank != par_rank)
+                {
+                    recv_from[owner_rank] = 1;
+                }
+                continue;
+            }
+
+            std::sort(ds.values.begin() + ds.values_offsets[gi],
+                      ds.values.begin() + ds.values_offsets[gi + 1]);
+            for(index_t ni = ds.nbrs_offsets[gi]; ni < ds.nbrs_offsets[gi + 1]; ni++)
+            {
+                const index_t nbr = ds.nbrs[ni];
+                const int nbr_rank = rank_of(nbr);
+                if(nbr_rank < 0)
+                {
+                    error_msg = conduit_fmt::format("domain {} is not on any rank", nbr);
+                    continue;
+                }
+                if(nbr_rank != par_rank)
+                {
+                    send_to[nbr_rank] = 1;
+                }
+
+                const index_t pni = std::lower_bound(ds.pw_nbrs.begin(),
+                    ds.pw_nbrs.end(), nbr) - ds.pw_nbrs.begin();
+                const auto seg_begin = ds.pw_sorted.begin() + ds.pw_offsets[pni];
+                const auto seg_end = ds.pw_sorted.begin() + ds.pw_offsets[pni + 1];
+                std::vector<int64> &positions = messages[std::make_pair(ds.domain_id, nbr)];
+                for(index_t vi = ds.values_offsets[gi]; vi < ds.values_offsets[gi + 1]; vi++)
+                {
+                    // the first position of the entity
+                    positions.push_back(std::lower_bound(seg_begin, seg_end,
+                        std::make_pair(ds.values[vi], (index_t)-1))->second);
+                }
+            }
+        }
+    }
+
+    // every rank must expect a message from each rank that sends it one
+    std::vector<int> senders_counts(par_size, 1);
+    int num_senders = 0;
+    MPI_Reduce_scatter(send_to.data(), &num_senders, senders_counts.data(),
+                       MPI_INT, MPI_SUM, comm);
+    const int num_expected = (int)std::count(recv_from.begin(), recv_from.end(), 1);
+    if(error_msg.empty() && num_senders != num_expected)
+    {
+        error_msg = conduit_fmt::format("rank {} expects {} ranks to send it "
+                                        "positions and {} do", par_rank,
+                                        num_expected, num_senders);
+    }
+    int local_bad = error_msg.empty() ? 0 : 1;
+    int global_bad = 0;
+    MPI_Allreduce(&local_bad, &global_bad, 1, MPI_INT, MPI_MAX, comm);
+    if(global_bad > 0)
+    {
+        CONDUIT_ERROR("generate_maxshare_adjset: adjset \"" << adjset_name
+                      << "\" is inconsistent across domains: "
+                      << (error_msg.empty() ? std::string("see other ranks")
+                                            : error_msg));
+    }
+
+    // one message per rank, same rank positions are used directly
+    std::vector<Node> send_nodes(par_size), recv_nodes(par_size);
+    for(const auto &msg : messages)
+    {
+        const int dest_rank = rank_of(msg.first.second);
+        if(dest_rank != par_rank)
+        {
+            Node &entry = send_nodes[dest_rank].append();
+            entry["from"] = (int64)msg.first.first;
+            entry["to"] = (int64)msg.first.second;
+            entry["positions"].set_external(const_cast<int64 *>(msg.second.data()),
+                                            (index_t)msg.second.size());
+        }
+    }
+    const int tag = 422;
+    relay::mpi::communicate_using_schema C(comm);
+    for(int r = 0; r < par_size; r++)
+    {
+        if(send_to[r])
+        {
+            C.add_isend(send_nodes[r], r, tag);
+        }
+        if(recv_from[r])
+        {
+            C.add_irecv(recv_nodes[r], r, tag);
+        }
+    }
+    C.execute();
+    for(int r = 0; r < par_size; r++)
+    {
+        NodeConstIterator itr = recv_nodes[r].children();
+        while(itr.has_next())
+        {
+            const Node &entry = itr.next();
+            Node n_pos;
+            entry["positions"].to_int64_array(n_pos);
+            const int64 *pos_ptr = n_pos.as_int64_ptr();
+            messages[std::make_pair(entry["from"].to_index_t(),
+                                    entry["to"].to_index_t())].assign(
+                pos_ptr, pos_ptr + n_pos.dtype().number_of_elements());
+        }
+    }
+
+    // the other members take the owner's order
+    for(DomainShares &ds : shares)
+    {
+        const index_t num_groups = (index_t)ds.group_owner.size();
+        std::vector<index_t> cursor(ds.values_offsets.begin(), ds.values_offsets.end() - 1);
+        for(index_t pni = 0; pni < (index_t)ds.pw_nbrs.size(); pni++)
+        {
+            const index_t owner = ds.pw_nbrs[pni];
+            if(owner > ds.domain_id)
+            {
+                continue;
+            }
+            const auto msg = messages.find(std::make_pair(owner, ds.domain_id));
+            if(msg == messages.end())
+            {
+                continue;
+            }
+            const index_t seg_size = ds.pw_offsets[pni + 1] - ds.pw_offsets[pni];
+            for(const int64 pos : msg->second)
+            {
+                index_t gi = -1;
+                if(pos >= 0 && pos < seg_size)
+                {
+                    const index_t ent = ds.pw_values[ds.pw_offsets[pni] + pos];
+                    gi = std::lower_bound(ds.ent_groups.begin(), ds.ent_groups.end(),
+                        std::make_pair(ent, (index_t)-1))->second;
+                    if(ds.group_owner[gi] == owner &&
+                       cursor[gi] < ds.values_offsets[gi + 1])
+                    {
+                        ds.values[cursor[gi]++] = ent;
+                        continue;
+                    }
+                }
+                error_msg = conduit_fmt::format("domain {} does not share entity "
+                    "position {} with domain {} as it expects", owner, pos,
+                    ds.domain_id);
+                break;
+            }
+        }
+        for(index_t gi = 0; gi < num_groups && error_msg.empty(); gi++)
+        {
+            if(ds.group_owner[gi] != ds.domain_id &&
+               cursor[gi] != ds.values_offsets[gi + 1])
+            {
+                error_msg = conduit_fmt::format("domain {} and its owner domain "
+                    "{} list different entities in a group", ds.domain_id,
+                    ds.group_owner[gi]);
+            }
+        }
+    }
+    local_bad = error_msg.empty() ? 0 : 1;
+    MPI_Allreduce(&local_bad, &global_bad, 1, MPI_INT, MPI_MAX, comm);
+    if(global_bad > 0)
+    {
+        CONDUIT_ERROR("generate_maxshare_adjset: adjset \"" << adjset_name
+                      << "\" is inconsistent across domains: "
+                      << (error_msg.empty() ? std::string("see other ranks")
+                                            : error_msg));
+    }
+
+    for(DomainShares &ds : shares)
+    {
+        const Node &adjset = (*ds.dom)["adjsets"][adjset_name];
+        const DataType int_dtype = bputils::find_widest_dtype(adjset,
+            bputils::DEFAULT_INT_DTYPES);
+        Node dest;
+        bputils::adjset::write_flat_groups(adjset, int_dtype, ds.nbrs_offsets,
+                                           ds.nbrs, ds.values_offsets,
+                                           ds.values, dest);
+        bputils::adjset::canonicalize(dest, ds.domain_id);
+        (*ds.dom)["adjsets"][dest_adjset_name].swap(dest);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// The boundary points of a domain for generate_adjsets: the ids of the
+// points of the faces of topo with a single element (all of the points of
+// point topologies) in ascending order, and their coordinates as x,y,z.
+static void
+topology_boundary_points(const Node &topo,
+                         const Node &options,
+                         std::vector<index_t> &point_ids,
+                         std::vector<float64> &coords,
+                         float64 *box)
+{
+    namespace bptopo = ::conduit::blueprint::mesh::topology;
+    namespace bpcset = ::conduit::blueprint::mesh::coordset;
+
+    // uniform, rectilinear and structured topologies are matched through
+    // their unstructured form, which keeps the point ids
+    Node utopo, ucset;
+    const Node *topo_ptr = &topo;
+    const Node *cset_ptr = bputils::find_reference_node(topo, "coordset");
+    const std::string topo_type = topo["type"].as_string();
+    if(topo_type == "uniform")
+    {
+        bptopo::uniform::to_unstructured(topo, utopo, ucset);
+        topo_ptr = &utopo;
+        cset_ptr = &ucset;
+    }
+    else if(topo_type == "rectilinear")
+    {
+        bptopo::rectilinear::to_unstructured(topo, utopo, ucset);
+        topo_ptr = &utopo;
+        cset_ptr = &ucset;
+    }
+    else if(topo_type == "structured")
+    {
+        bptopo::structured::to_unstructured(topo, utopo, ucset);
+        topo_ptr = &utopo;
+        cset_ptr = &ucset;
+    }
+
+    Node ecset;
+    const std::string cset_type = (*cset_ptr)["type"].as_string();
+    if(cset_type == "uniform")
+    {
+        bpcset::uniform::to_explicit(*cset_ptr, ecset);
+        cset_ptr = &ecset;
+    }
+    else if(cset_type == "rectilinear")
+    {
+        bpcset::rectilinear::to_explicit(*cset_ptr, ecset);
+        cset_ptr = &ecset;
+    }
+
+    const index_t num_cset_points = bputils::coordset::length(*cset_ptr);
+    const bputils::ShapeType shape = (topo_type == "points") ?
+        bputils::ShapeType("point") : bputils::ShapeType(*topo_ptr);
+    point_ids.clear();
+    if(shape.dim == 0)
+    {
+        point_ids.resize(num_cset_points);
+        std::iota(point_ids.begin(), point_ids.end(), 0);
+    }
+    else
+    {
+        // only the faces and their elements are discovered, the points of
+        // each face are read from its connectivity
+        Node md_opts;
+        if(options.has_child("num_threads"))
+        {
+            md_opts["num_threads"].set(options["num_threads"].to_index_t());
+        }
+        md_opts["dims"].set(std::vector<index_t>{shape.dim - 1});
+        md_opts["associations"].set(std::vector<index_t>{shape.dim - 1, shape.dim});
+        md_opts["local"].set((index_t)0);
+        const bputils::TopologyMetadata md(*topo_ptr, *cset_ptr, md_opts);
+
+        const Node &faces = md.dim_topos[shape.dim - 1]["elements"];
+        const index_t_accessor face_conn = faces["connectivity"].value();
+        const index_t_accessor face_offsets = faces["offsets"].value();
+        std::vector<unsigned char> on_boundary(num_cset_points, 0);
+        const index_t num_faces = md.get_length(shape.dim - 1);
+        for(index_t fi = 0; fi < num_faces; fi++)
+        {
+            if(md.get_entity_assocs(bputils::TopologyMetadata::GLOBAL, fi,
+                                    shape.dim - 1, shape.dim).size() != 1)
+            {
+                continue;
+            }
+            const index_t end = (fi + 1 < num_faces) ? face_offsets[fi + 1] :
+                face_conn.number_of_elements();
+            for(index_t ci = face_offsets[fi]; ci < end; ci++)
+            {
+                on_boundary[face_conn[ci]] = 1;
+            }
+        }
+        for(index_t pi = 0; pi < num_cset_points; pi++)
+        {
+            if(on_boundary[pi])
+            {
+                point_ids.push_back(pi);
+            }
+        }
+    }
+
+    const std::vector<std::string> axes = bputils::coordset::axes(*cset_ptr);
+    const index_t num_points = (index_t)point_ids.size();
+    coords.assign(3 * num_points, 0.0);
+    for(int d = 0; d < 3; d++)
+    {
+        box[d] = std::numeric_limits<float64>::max();
+        box[3 + d] = std::numeric_limits<float64>::lowest();
+    }
+    for(size_t d = 0; d < axes.size() && d < 3; d++)
+    {
+        const float64_accessor vals = (*cset_ptr)["values"][axes[d]].as_float64_accessor();
+        for(index_t i = 0; i < num_points; i++)
+        {
+            coords[3 * i + d] = vals[point_ids[i]];
+        }
+    }
+    for(index_t i = 0; i < num_points; i++)
+    {
+        for(int d = 0; d < 3; d++)
+        {
+            box[d] = std::min(box[d], coords[3 * i + d]);
+            box[3 + d] = std::max(box[3 + d], coords[3 * i + d]);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// true if the boxes (min x,y,z then max x,y,z) are within tolerance
+static bool
+boxes_overlap(const float64 *a, const float64 *b, float64 tolerance)
+{
+    for(int d = 0; d < 3; d++)
+    {
+        if(a[d] > b[3 + d] + tolerance || b[d] > a[3 + d] + tolerance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+generate_adjsets(conduit::Node &mesh,
+                 const std::string &topo_name,
+                 const std::string &adjset_name,
+                 float64 tolerance,
+                 MPI_Comm comm)
+{
+    Node opts;
+    generate_adjsets(mesh, topo_name, adjset_name, tolerance, opts, comm);
+}
+
+//-----------------------------------------------------------------------------
+void
+generate_adjsets(conduit::Node &mesh,
+                 const std::string &topo_name,
+                 const std::string &adjset_name,
+                 float64 tolerance,
+                 const conduit::Node &options,
+                 MPI_Comm comm)
+{
+    const int par_rank = relay::mpi::rank(comm);
+    const int par_size = relay::mpi::size(comm);
+
+    index_t num_threads = 1;
+    if(options.has_child("num_threads"))
+    {
+        num_threads = options["num_threads"].to_index_t();
+        if(num_threads <= 0)
+        {
+            num_threads = std::max((index_t)1, (index_t)std::thread::hardware_concurrency());
+        }
+    }
+
+    // the boundary points of this rank's domains
+    struct BoundaryPoints
+    {
+        index_t domain_id;
+        Node *dom;
+        std::vector<index_t> point_ids;
+        std::vector<float64> coords;
+        float64 box[6];
+    };
+    std::vector<BoundaryPoints> local;
+    for(Node *dom : ::conduit::blueprint::mesh::domains(mesh))
+    {
+        if(dom->has_child("topologies") && (*dom)["topologies"].has_child(topo_name))
+        {
+            local.push_back(BoundaryPoints());
+            local.back().dom = dom;
+            local.back().domain_id = dom->has_path("state/domain_id") ?
+                (*dom)["state/domain_id"].to_index_t() : par_rank;
+        }
+    }
+    const index_t num_local = (index_t)local.size();
+    std::string error_msg = "";
+    try
+    {
+        bputils::detail::parallel_chunks(
+            bputils::detail::parallel_num_chunks(num_threads, num_local, 1), num_local,
+            [&](index_t, index_t begin, index_t end)
+        {
+            for(index_t li = begin; li < end; li++)
+            {
+                BoundaryPoints &bp = local[li];
+                topology_boundary_points((*bp.dom)["topologies"][topo_name], options,
+                                         bp.point_ids, bp.coords, bp.box);
+            }
+        });
+    }
+    catch(const conduit::Error &e)
+    {
+        error_msg = e.message();
+    }
+    // all ranks fail together
+    int local_bad = error_msg.empty() ? 0 : 1;
+    int global_bad = 0;
+    MPI_Allreduce(&local_bad, &global_bad, 1, MPI_INT, MPI_MAX, comm);
+    if(global_bad > 0)
+    {
+        CONDUIT_ERROR("generate_adjsets: could not find the boundary points "
+                      "of topology \"" << topo_name << "\": "
+                      << (error_msg.empty() ? std::string("see other ranks")
+                                            : error_msg));
+    }
+
+    // only the boxes around the boundary points of each rank are gathered,
+    // the points are sent to the ranks whose boxes are within tolerance
+    float64 rank_box[6];
+    for(int d = 0; d < 3; d++)
+    {
+        rank_box[d] = std::numeric_limits<float64>::max();
+        rank_box[3 + d] = std::numeric_limits<float64>::lowest();
+    }
+    for(const BoundaryPoints &bp : local)
+    {
+        for(int d = 0; d < 3; d++)
+        {
+            rank_box[d] = std::min(rank_box[d], bp.box[d]);
+            rank_box[3 + d] = std::max(rank_box[3 + d], bp.box[3 + d]);
+        }
+    }
+    std::vector<float64> rank_boxes(6 * par_size);
+    MPI_Allgather(rank_box, 6, MPI_DOUBLE, rank_boxes.data(), 6, MPI_DOUBLE, comm);
+
+    std::vector<int> peers;
+    for(int r = 0; r < par_size; r++)
+    {
+        if(r != par_rank &&
+           boxes_overlap(rank_box, &rank_boxes[6 * r], tolerance))
+        {
+            peers.push_back(r);
+        }
+    }
+
+    std::vector<Node> send_nodes(peers.size()), recv_nodes(peers.size());
+    const int tag = 423;
+    relay::mpi::communicate_using_schema C(comm);
+    for(size_t pi = 0; pi < peers.size(); pi++)
+    {
+        Node &send_node = send_nodes[pi];
+        send_node["domains"].set(DataType::list());
+        for(BoundaryPoints &bp : local)
+        {
+            if(!bp.point_ids.empty() &&
+               boxes_overlap(bp.box, &rank_boxes[6 * peers[pi]], tolerance))
+            {
+                Node &entry = send_node["domains"].append();
+                entry["domain_id"] = (int64)bp.domain_id;
+                entry["box"].set(bp.box, 6);
+                entry["coords"].set_external(bp.coords);
+            }
+        }
+        C.add_isend(send_node, peers[pi], tag);
+        C.add_irecv(recv_nodes[pi], peers[pi], tag);
+    }
+    C.execute();
+
+    // the domains that may share points with the local domains
+    struct Candidate
+    {
+        index_t domain_id;
+        const float64 *box;
+        const float64 *coords;
+        index_t num_points;
+    };
+    std::vector<Candidate> candidates;
+    for(const BoundaryPoints &bp : local)
+    {
+        candidates.push_back(Candidate{bp.domain_id, bp.box, bp.coords.data(),
+                                       (index_t)bp.point_ids.size()});
+    }
+    for(Node &recv_node : recv_nodes)
+    {
+        if(!recv_node.has_child("domains"))
+        {
+            continue;
+        }
+        NodeIterator itr = recv_node["domains"].children();
+        while(itr.has_next())
+        {
+            Node &entry = itr.next();
+            Node &coords = entry["coords"];
+            candidates.push_back(Candidate{entry["domain_id"].to_index_t(),
+                                           entry["box"].as_float64_ptr(),
+                                           coords.as_float64_ptr(),
+                                           coords.dtype().number_of_elements() / 3});
+        }
+    }
+
+    // every (local domain, candidate) pair with overlapping boxes is matched
+    // with a kd-tree of the local domain's boundary points
+    std::vector<bputils::kdtree<float64, 3>> trees(num_local);
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_local, 1), num_local,
+        [&](index_t, index_t begin, index_t end)
+    {
+        for(index_t li = begin; li < end; li++)
+        {
+            trees[li].build(local[li].coords.data(),
+                            (index_t)local[li].point_ids.size());
+        }
+    });
+
+    std::vector<std::pair<index_t, index_t>> tasks;
+    for(index_t li = 0; li < num_local; li++)
+    {
+        for(index_t ci = 0; ci < (index_t)candidates.size(); ci++)
+        {
+            const Candidate &cand = candidates[ci];
+            if(cand.domain_id != local[li].domain_id && cand.num_points > 0 &&
+               !local[li].point_ids.empty() &&
+               boxes_overlap(local[li].box, cand.box, tolerance))
+            {
+                tasks.push_back(std::make_pair(li, ci));
+            }
+        }
+    }
+
+    // the local points shared with each task's candidate, each point of
+    // either domain is matched with its nearest (lowest index) point of the
+    // other domain when that point also picks it, so both domains find the
+    // same pairs. The pairs are ordered by the point of the lower domain id.
+    const index_t num_tasks = (index_t)tasks.size();
+    std::vector<std::vector<index_t>> task_values(num_tasks);
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, num_tasks, 1), num_tasks,
+        [&](index_t, index_t begin, index_t end)
+    {
+        std::vector<index_t> matches;
+        for(index_t ti = begin; ti < end; ti++)
+        {
+            const BoundaryPoints &bp = local[tasks[ti].first];
+            const Candidate &cand = candidates[tasks[ti].second];
+
+            // (local index, candidate index) of the points within tolerance
+            std::vector<std::pair<index_t, index_t>> pairs;
+            for(index_t ci = 0; ci < cand.num_points; ci++)
+            {
+                trees[tasks[ti].first].find_points(cand.coords + 3 * ci,
+                                                   tolerance, matches);
+                for(const index_t li : matches)
+                {
+                    pairs.push_back(std::make_pair(li, ci));
+                }
+            }
+
+            std::vector<index_t> local_best(bp.point_ids.size(), -1);
+            std::vector<index_t> cand_best(cand.num_points, -1);
+            for(const auto &pair : pairs)
+            {
+                if(local_best[pair.first] < 0 || pair.second < local_best[pair.first])
+                {
+                    local_best[pair.first] = pair.second;
+                }
+                if(cand_best[pair.second] < 0 || pair.first < cand_best[pair.second])
+                {
+                    cand_best[pair.second] = pair.first;
+                }
+            }
+
+            std::vector<std::pair<index_t, index_t>> shared;
+            const bool local_lower = bp.domain_id < cand.domain_id;
+            for(index_t li = 0; li < (index_t)local_best.size(); li++)
+            {
+                const index_t ci = local_best[li];
+                if(ci >= 0 && cand_best[ci] == li)
+                {
+                    shared.push_back(local_lower ? std::make_pair(li, ci) :
+                                                   std::make_pair(ci, li));
+                }
+            }
+            std::sort(shared.begin(), shared.end());
+            for(const auto &pair : shared)
+            {
+                task_values[ti].push_back(bp.point_ids[local_lower ? pair.first : pair.second]);
+            }
+        }
+    });
+
+    // one pairwise group per neighbor
+    std::vector<std::vector<index_t>> nbrs_offsets(num_local, std::vector<index_t>(1, 0));
+    std::vector<std::vector<index_t>> nbrs(num_local);
+    std::vector<std::vector<index_t>> values_offsets(num_local, std::vector<index_t>(1, 0));
+    std::vector<std::vector<index_t>> values(num_local);
+    std::vector<std::pair<index_t, index_t>> task_order;
+    for(index_t ti = 0; ti < num_tasks; ti++)
+    {
+        task_order.push_back(std::make_pair(tasks[ti].first,
+                                            candidates[tasks[ti].second].domain_id));
+    }
+    std::vector<index_t> sorted_tasks(num_tasks);
+    std::iota(sorted_tasks.begin(), sorted_tasks.end(), 0);
+    std::sort(sorted_tasks.begin(), sorted_tasks.end(), [&](index_t a, index_t b)
+    {
+        return task_order[a] < task_order[b];
+    });
+    for(const index_t ti : sorted_tasks)
+    {
+        const index_t li = tasks[ti].first;
+        if(task_values[ti].empty())
+        {
+            continue;
+        }
+        nbrs[li].push_back(task_order[ti].second);
+        nbrs_offsets[li].push_back((index_t)nbrs[li].size());
+        values[li].insert(values[li].end(), task_values[ti].begin(), task_values[ti].end());
+        values_offsets[li].push_back((index_t)values[li].size());
+    }
+
+    for(index_t li = 0; li < num_local; li++)
+    {
+        Node &dom = *local[li].dom;
+        Node adjset_template;
+        adjset_template["association"] = "vertex";
+        adjset_template["topology"] = topo_name;
+        const DataType int_dtype = bputils::find_widest_dtype(
+            dom["topologies"][topo_name], bputils::DEFAULT_INT_DTYPES);
+        Node dest;
+        bputils::adjset::write_flat_groups(adjset_template, int_dtype,
+                                           nbrs_offsets[li], nbrs[li],
+                                           values_offsets[li], values[li], dest);
+        bputils::adjset::canonicalize(dest, local[li].domain_id);
+        dom["adjsets"][adjset_name].swap(dest);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void match_nbr_elems(PolyBndry& pbnd,
                      std::map<index_t, bputils::connectivity::ElemType>& nbr_elems,
@@ -2683,6 +3790,197 @@ generate_corners(conduit::Node& mesh,
 
 }
 
+//-----------------------------------------------------------------------------
+void
+reduce_by_material(const conduit::Node &mesh,
+                   const std::string &matset_name,
+                   const std::string &field_name,
+                   const std::string &op,
+                   conduit::Node &dest,
+                   MPI_Comm comm)
+{
+    Node opts;
+    reduce_by_material(mesh, matset_name, field_name, op, dest, opts, comm);
+}
+
+//-----------------------------------------------------------------------------
+void
+reduce_by_material(const conduit::Node &mesh,
+                   const std::string &matset_name,
+                   const std::string &field_name,
+                   const std::string &op,
+                   conduit::Node &dest,
+                   const conduit::Node &options,
+                   MPI_Comm comm)
+{
+    bputils::matset::check_material_stat_op(op);
+
+    std::string weights_field;
+    Node dom_opts;
+    NodeConstIterator opts_itr = options.children();
+    while(opts_itr.has_next())
+    {
+        const Node &opt = opts_itr.next();
+        if(opts_itr.name() == "weights_field")
+        {
+            weights_field = opt.as_string();
+        }
+        else if(opts_itr.name() != "element_weights")
+        {
+            dom_opts[opts_itr.name()].set_external(opt);
+        }
+    }
+
+    // the partials of this rank's domains, by material name
+    std::map<std::string, bputils::matset::MaterialStats> local_stats;
+    const std::vector<const Node *> domains = ::conduit::blueprint::mesh::domains(mesh);
+    for(const Node *dom_ptr : domains)
+    {
+        const Node &dom = *dom_ptr;
+        if(!dom.has_path("matsets/" + matset_name) ||
+           !dom.has_path("fields/" + field_name))
+        {
+            continue;
+        }
+
+        if(!weights_field.empty())
+        {
+            if(!dom.has_path("fields/" + weights_field + "/values"))
+            {
+                CONDUIT_ERROR("blueprint::mpi::mesh::reduce_by_material domain "
+                              "is missing weights field '" << weights_field << "'");
+            }
+            dom_opts["element_weights"].set_external(
+                dom["fields/" + weights_field + "/values"]);
+        }
+
+        std::vector<std::string> names;
+        std::vector<bputils::matset::MaterialStats> stats;
+        bputils::matset::material_stats(dom["matsets/" + matset_name],
+                                        dom["fields/" + field_name],
+                                        dom_opts,
+                                        names,
+                                        stats);
+        for(size_t slot = 0; slot < names.size(); slot++)
+        {
+            if(local_stats.find(names[slot]) == local_stats.end())
+            {
+                local_stats[names[slot]] = bputils::matset::empty_material_stats();
+            }
+            bputils::matset::combine_material_stats(stats[slot],
+                                                    local_stats[names[slot]]);
+        }
+    }
+
+    // every rank needs the same material order for the all-reduce
+    Node local_names, global_names;
+    for(const auto &name_stats : local_stats)
+    {
+        local_names[name_stats.first].set((int8)1);
+    }
+    relay::mpi::all_union_using_schema(local_names, global_names, comm);
+    std::vector<std::string> names = global_names.child_names();
+    std::sort(names.begin(), names.end());
+
+    const size_t num_mats = names.size();
+    std::vector<int64> counts(num_mats, 0);
+    std::vector<float64> sums(3 * num_mats, 0.0);
+    std::vector<float64> mins(num_mats), maxs(num_mats);
+    for(size_t i = 0; i < num_mats; i++)
+    {
+        auto stats_itr = local_stats.find(names[i]);
+        const bputils::matset::MaterialStats st = (stats_itr != local_stats.end())
+            ? stats_itr->second : bputils::matset::empty_material_stats();
+        counts[i] = (int64)st.count;
+        sums[3 * i + 0] = st.sum;
+        sums[3 * i + 1] = st.weighted_sum;
+        sums[3 * i + 2] = st.weight;
+        mins[i] = st.min;
+        maxs[i] = st.max;
+    }
+
+    if(num_mats > 0)
+    {
+        MPI_Allreduce(MPI_IN_PLACE, &counts[0], (int)num_mats,
+                      MPI_INT64_T, MPI_SUM, comm);
+        MPI_Allreduce(MPI_IN_PLACE, &sums[0], (int)sums.size(),
+                      MPI_DOUBLE, MPI_SUM, comm);
+        MPI_Allreduce(MPI_IN_PLACE, &mins[0], (int)num_mats,
+                      MPI_DOUBLE, MPI_MIN, comm);
+        MPI_Allreduce(MPI_IN_PLACE, &maxs[0], (int)num_mats,
+                      MPI_DOUBLE, MPI_MAX, comm);
+    }
+
+    dest.reset();
+    for(size_t i = 0; i < num_mats; i++)
+    {
+        if(counts[i] > 0)
+        {
+            bputils::matset::MaterialStats st;
+            st.count = (index_t)counts[i];
+            st.sum = sums[3 * i + 0];
+            st.weighted_sum = sums[3 * i + 1];
+            st.weight = sums[3 * i + 2];
+            st.min = mins[i];
+            st.max = maxs[i];
+            dest[names[i]].set(bputils::matset::material_stat(st, op));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+std::vector<float64>
+coordset_extents(const conduit::Node &mesh,
+                 const std::string &coordset_name,
+                 MPI_Comm comm)
+{
+    std::vector<float64> mins, maxs;
+    ::conduit::blueprint::mesh::for_each_domain(mesh, [&](const Node &dom)
+    {
+        if(!dom.has_path("coordsets/" + coordset_name))
+        {
+            return;
+        }
+
+        const std::vector<float64> dom_extents =
+            bputils::coordset::extents(dom["coordsets/" + coordset_name]);
+        const size_t naxes = dom_extents.size() / 2;
+        if(naxes > mins.size())
+        {
+            mins.resize(naxes, std::numeric_limits<float64>::max());
+            maxs.resize(naxes, std::numeric_limits<float64>::lowest());
+        }
+        for(size_t i = 0; i < naxes; i++)
+        {
+            mins[i] = std::min(mins[i], dom_extents[2 * i]);
+            maxs[i] = std::max(maxs[i], dom_extents[2 * i + 1]);
+        }
+    });
+
+    // ranks may have no domains with the coordset
+    int local_naxes = (int)mins.size();
+    int global_naxes = 0;
+    MPI_Allreduce(&local_naxes, &global_naxes, 1, MPI_INT, MPI_MAX, comm);
+    mins.resize((size_t)global_naxes, std::numeric_limits<float64>::max());
+    maxs.resize((size_t)global_naxes, std::numeric_limits<float64>::lowest());
+
+    if(global_naxes > 0)
+    {
+        MPI_Allreduce(MPI_IN_PLACE, &mins[0], global_naxes,
+                      MPI_DOUBLE, MPI_MIN, comm);
+        MPI_Allreduce(MPI_IN_PLACE, &maxs[0], global_naxes,
+                      MPI_DOUBLE, MPI_MAX, comm);
+    }
+
+    std::vector<float64> res((size_t)(2 * global_naxes));
+    for(size_t i = 0; i < (size_t)global_naxes; i++)
+    {
+        res[2 * i]     = mins[i];
+        res[2 * i + 1] = maxs[i];
+    }
+    return res;
+}
+
 //-------------------------------------------------------------------------
 void
 flatten(const conduit::Node &mesh, const conduit::Node &options,
@@ -61,11 +61,32 @@ bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &n,
 /// These methods can be called on any verified blueprint mesh.
 //-----------------------------------------------------------------------------
 
+/// Generates the blueprint index of the domains on all ranks, every rank
+/// gets the index. The indices of the ranks are merged up a tree, ranks with
+/// identical indices only exchange a hash of them.
 void CONDUIT_BLUEPRINT_API generate_index(const conduit::Node &mesh,
                                           const std::string &ref_path,
                                           Node &index_out,
                                           MPI_Comm comm);
 
+/// Variant that only sets index_out on root.
+void CONDUIT_BLUEPRINT_API generate_index(const conduit::Node &mesh,
+                                          const std::string &ref_path,
+                                          Node &index_out,
+                                          int root,
+                                          MPI_Comm comm);
+
+/// Generates the blueprint index on root from per domain summaries instead
+/// of the mesh. Each child of summaries describes one domain of this rank
+/// with the entries that blueprint::mesh::generate_index_for_single_domain
+/// creates for it (coordsets, topologies, fields, etc, with their paths),
+/// so the index can be built after the domain data is gone. Ranks without
+/// domains pass an empty node.
+void CONDUIT_BLUEPRINT_API generate_index_from_summaries(const conduit::Node &summaries,
+                                                         Node &index_out,
+                                                         int root,
+                                                         MPI_Comm comm);
+
 //
 //  note: the to_poly methods require a structured grid 
 //        with an adjset
@@ -93,6 +114,34 @@ void CONDUIT_BLUEPRINT_API generate_domain_to_rank_map(
                                               Node &domain_to_rank_map,
                                               MPI_Comm comm);
 
+//-------------------------------------------------------------------------
+/// Distributed directory variant of generate_domain_to_rank_map: only looks
+/// up the ranks of the domain ids this rank passes in domain_ids (an integer
+/// array, may be empty). Each domain id is kept by a rank picked from a hash
+/// of the id, and the registrations and queries are exchanged with one
+/// MPI_Alltoall of counts and two MPI_Alltoallv calls, so memory follows the
+/// number of local and queried domains instead of the global number of
+/// domains.
+///
+/// domain_to_rank_map:
+///    domain_ids: the sorted unique queried ids (int64)
+///    ranks: the rank that holds each of them, -1 if no rank does (int64)
+//-------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API generate_domain_to_rank_map(
+                                              const conduit::Node &mesh,
+                                              const conduit::Node &domain_ids,
+                                              Node &domain_to_rank_map,
+                                              MPI_Comm comm);
+
+//-------------------------------------------------------------------------
+/// Directory variant that queries the neighbor domains referenced by the
+/// adjsets of this rank's domains.
+//-------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API generate_neighbor_domain_to_rank_map(
+                                              const conduit::Node &mesh,
+                                              Node &domain_to_rank_map,
+                                              MPI_Comm comm);
+
 //-------------------------------------------------------------------------
 index_t CONDUIT_BLUEPRINT_API number_of_domains(const conduit::Node &mesh,
                                                 MPI_Comm comm);
@@ -123,6 +172,81 @@ void CONDUIT_BLUEPRINT_API find_delegate_domain(const conduit::Node &mesh,
                                                 conduit::Node &domain,
                                                 MPI_Comm comm);
 
+//-----------------------------------------------------------------------------
+/// description:
+///   exchange_fields(...) copies the values of the named fields that are
+///   shared through the adjset named adjset_name from the lowest domain id
+///   of each group to the other domains of the group, e.g. to refresh ghost
+///   values. All of the fields are sent to a neighbor rank in one message,
+///   and domains on the same rank copy their values directly. This builds an
+///   AdjsetExchange for each call, code that exchanges every cycle should
+///   build one AdjsetExchange and reuse it.
+///
+/// options:
+///   check_association: 1 (default) or 0; when 1, each field must have the
+///     association and topology of the adjset
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API exchange_fields(conduit::Node &mesh,
+                                           const std::string &adjset_name,
+                                           const std::vector<std::string> &field_names,
+                                           MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API exchange_fields(conduit::Node &mesh,
+                                           const std::string &adjset_name,
+                                           const std::vector<std::string> &field_names,
+                                           const conduit::Node &options,
+                                           MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+/// description:
+///   generate_maxshare_adjset(...) writes the max-share form of the adjset
+///   named adjset_name of each domain to its dest_adjset_name adjset, (as
+///   conduit::blueprint::mesh::adjset::to_maxshare does) so that the
+///   domains of a group list its shared entities in the same order. The
+///   lowest domain id of each group orders the entities ascending and sends
+///   the other members of the group their positions in the entities each
+///   pair of domains share; no pairwise adjset is built. The entities each
+///   pair of domains share must be listed in the same order by both of
+///   them, as they are in pairwise adjsets. The result can be used to build
+///   an AdjsetExchange.
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API generate_maxshare_adjset(conduit::Node &mesh,
+                                                    const std::string &adjset_name,
+                                                    const std::string &dest_adjset_name,
+                                                    MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+/// description:
+///   generate_adjsets(...) finds the points of the topology named topo_name
+///   that are within tolerance of a point of another domain and writes them
+///   to a pairwise vertex adjset named adjset_name on each domain, e.g. for
+///   meshes that were repartitioned without adjsets. Only the points on the
+///   boundary of each domain (the points of faces with one element) are
+///   matched. The ranks gather one bounding box of their boundary points
+///   and send the boundary points only to the ranks whose boxes are within
+///   tolerance; the points are matched with a kd-tree per domain. Each
+///   point is paired with at most one point of a neighbor domain and both
+///   domains list the pairs in the same order.
+///
+/// options:
+///   num_threads: the number of threads used to find boundary points and
+///     match them (default 1; <= 0 selects the hardware concurrency)
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API generate_adjsets(conduit::Node &mesh,
+                                            const std::string &topo_name,
+                                            const std::string &adjset_name,
+                                            float64 tolerance,
+                                            MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API generate_adjsets(conduit::Node &mesh,
+                                            const std::string &topo_name,
+                                            const std::string &adjset_name,
+                                            float64 tolerance,
+                                            const conduit::Node &options,
+                                            MPI_Comm comm);
+
 //-----------------------------------------------------------------------------
 /// blueprint mesh transform methods
 ///
@@ -186,6 +310,52 @@ void CONDUIT_BLUEPRINT_API generate_corners(conduit::Node& mesh,
                                             conduit::Node& d2smap,
                                             MPI_Comm comm);
 
+//-----------------------------------------------------------------------------
+/// description:
+///   reduce_by_material(...) reduces the matset values of the field named
+///   field_name by material over the matset named matset_name of every
+///   domain on every rank, as blueprint::mesh::matset::reduce_by_material
+///   does for one matset, without densifying the matsets. Each rank reduces
+///   its domains to per material partials, the partials of all ranks are
+///   combined with one all-reduce and every rank gets dest. Domains without
+///   the matset or field are skipped.
+///
+/// options:
+///   the options of blueprint::mesh::matset::reduce_by_material, except
+///   "element_weights", plus
+///   weights_field: the name of an element field of each domain that holds
+///     the element weights, such as element volumes
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API reduce_by_material(const conduit::Node &mesh,
+                                              const std::string &matset_name,
+                                              const std::string &field_name,
+                                              const std::string &op,
+                                              conduit::Node &dest,
+                                              MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API reduce_by_material(const conduit::Node &mesh,
+                                              const std::string &matset_name,
+                                              const std::string &field_name,
+                                              const std::string &op,
+                                              conduit::Node &dest,
+                                              const conduit::Node &options,
+                                              MPI_Comm comm);
+
+//-----------------------------------------------------------------------------
+/// description:
+///   coordset_extents(...) returns the global extents of the coordset named
+///   coordset_name over every domain on every rank, in the format of
+///   blueprint::mesh::utils::coordset::extents ({d0min, d0max, ...}). Each
+///   rank combines the extents of its domains and one all-reduce combines
+///   the ranks. Domains without the coordset are skipped, an axis that no
+///   domain has is reported as {max float64, lowest float64}.
+//-----------------------------------------------------------------------------
+std::vector<float64> CONDUIT_BLUEPRINT_API coordset_extents(
+                                        const conduit::Node &mesh,
+                                        const std::string &coordset_name,
+                                        MPI_Comm comm);
+
 //-------------------------------------------------------------------------
 /**
  @brief Performs the mesh::flatten() operation across all ranks in comm.
@@ -200,6 +370,11 @@ Supports the same options as serial flatten() plus:
         (Default = 0 (false))
     "root": The rank that will contain the output table for all ranks in comm.
         (Default = 0)
+    "gather": When 0 (false) the table is not gathered to root, every rank
+        keeps the rows of its own domains instead. The tables have the same
+        columns on every rank, so writing them in rank order (for instance
+        with relay::mpi::io::write_csv) gives the gathered table.
+        (Default = 1 (true))
 */
 void CONDUIT_BLUEPRINT_API flatten(const conduit::Node &mesh,
                                    const conduit::Node &options,
@@ -13,6 +13,14 @@
 #include "conduit_blueprint_mpi_mesh_examples.hpp"
 #include "conduit_relay_mpi.hpp"
 #include "conduit_blueprint_mesh_examples.hpp"
+#include "conduit_blueprint_mesh_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <sstream>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -131,6 +139,244 @@ spiral_round_robin(conduit::index_t ndomains,
     }
 }
 
+
+//---------------------------------------------------------------------------//
+// Builds the vertex adjset of grid domain 'dom' (logical domain coordinates)
+// directly from the domain layout. Along each axis, the first (last) plane
+// of vertices is shared with the domain below (above), if there is one.
+// Visiting the 3x3x3 combinations of {low plane, interior, high plane}
+// yields the vertices shared by each distinct set of domains.
+static void
+grid_domain_adjset(const index_t npts[3],
+                   const index_t ndoms[3],
+                   const index_t dom[3],
+                   Node &adjset)
+{
+    adjset["association"] = "vertex";
+    adjset["topology"] = "mesh";
+    Node &groups = adjset["groups"];
+
+    index_t rbegin[3][3], rend[3][3];
+    for(index_t a = 0; a < 3; a++)
+    {
+        const bool has_low = dom[a] > 0;
+        const bool has_high = dom[a] < ndoms[a] - 1;
+
+        rbegin[a][0] = 0;
+        rend[a][0]   = has_low ? 1 : 0;
+        rbegin[a][1] = has_low ? 1 : 0;
+        rend[a][1]   = has_high ? npts[a] - 1 : npts[a];
+        rbegin[a][2] = npts[a] - 1;
+        rend[a][2]   = has_high ? npts[a] : npts[a] - 1;
+    }
+
+    const index_t dom_id = dom[0] + ndoms[0] * (dom[1] + ndoms[1] * dom[2]);
+
+    for(index_t r = 0; r < 27; r++)
+    {
+        // region 13 is the domain interior
+        const index_t reg[3] = {r % 3, (r / 3) % 3, r / 9};
+        if(r == 13)
+        {
+            continue;
+        }
+
+        bool empty = false;
+        for(index_t a = 0; a < 3; a++)
+        {
+            empty |= rend[a][reg[a]] <= rbegin[a][reg[a]];
+        }
+        if(empty)
+        {
+            continue;
+        }
+
+        // the sharing domains are the product of the per-axis choices of
+        // {this domain} or {this domain, the neighbor across the plane}
+        std::vector<index_t> group_doms(1, 0);
+        index_t dom_stride = 1;
+        for(index_t a = 0; a < 3; a++)
+        {
+            const size_t prev_size = group_doms.size();
+            for(size_t gi = 0; gi < prev_size; gi++)
+            {
+                group_doms[gi] += dom[a] * dom_stride;
+                if(reg[a] != 1)
+                {
+                    const index_t nbr_offset = (reg[a] == 0) ? -1 : 1;
+                    group_doms.push_back(group_doms[gi] + nbr_offset * dom_stride);
+                }
+            }
+            dom_stride *= ndoms[a];
+        }
+        std::sort(group_doms.begin(), group_doms.end());
+
+        std::ostringstream oss;
+        oss << "group";
+        std::vector<index_t> neighbors;
+        for(size_t gi = 0; gi < group_doms.size(); gi++)
+        {
+            oss << "_" << group_doms[gi];
+            if(group_doms[gi] != dom_id)
+            {
+                neighbors.push_back(group_doms[gi]);
+            }
+        }
+
+        Node &group = groups[oss.str()];
+        group["neighbors"].set(neighbors);
+
+        const index_t bi = rbegin[0][reg[0]], ei = rend[0][reg[0]];
+        const index_t bj = rbegin[1][reg[1]], ej = rend[1][reg[1]];
+        const index_t bk = rbegin[2][reg[2]], ek = rend[2][reg[2]];
+
+        group["values"].set(DataType::index_t((ei - bi) * (ej - bj) * (ek - bk)));
+        index_t *vals = group["values"].value();
+        for(index_t k = bk; k < ek; k++)
+        {
+            for(index_t j = bj; j < ej; j++)
+            {
+                for(index_t i = bi; i < ei; i++)
+                {
+                    *vals++ = i + npts[0] * (j + npts[1] * k);
+                }
+            }
+        }
+    }
+}
+
+
+//---------------------------------------------------------------------------//
+void
+grid(const std::string &mesh_type,
+     index_t npts_x,
+     index_t npts_y,
+     index_t npts_z,
+     index_t ndoms_x,
+     index_t ndoms_y,
+     index_t ndoms_z,
+     Node &res,
+     MPI_Comm comm)
+{
+    grid(mesh_type,
+         npts_x, npts_y, npts_z,
+         ndoms_x, ndoms_y, ndoms_z,
+         Node(),
+         res,
+         comm);
+}
+
+
+//---------------------------------------------------------------------------//
+void
+grid(const std::string &mesh_type,
+     index_t npts_x,
+     index_t npts_y,
+     index_t npts_z,
+     index_t ndoms_x,
+     index_t ndoms_y,
+     index_t ndoms_z,
+     const Node &options,
+     Node &res,
+     MPI_Comm comm)
+{
+    res.reset();
+
+    // the adjsets assume the lattice vertex ordering used by these types
+    const bool shape_2d = mesh_type == "tris" ||
+                          mesh_type == "quads" ||
+                          mesh_type == "quads_poly";
+    const bool shape_3d = mesh_type == "tets" ||
+                          mesh_type == "hexs" ||
+                          mesh_type == "hexs_poly" ||
+                          mesh_type == "wedges" ||
+                          mesh_type == "pyramids";
+    const bool shape_any = mesh_type == "uniform" ||
+                           mesh_type == "rectilinear" ||
+                           mesh_type == "structured";
+
+    if(!(shape_2d || shape_3d || shape_any))
+    {
+        CONDUIT_ERROR("blueprint::mpi::mesh::examples::grid does not support"
+                      " mesh_type = " << mesh_type);
+    }
+
+    // every task checks the arguments, including tasks without domains
+    const bool is_3d = !shape_2d && npts_z > 1;
+    const bool npts_ok = npts_x > 1 && npts_y > 1 && (!shape_3d || is_3d);
+    const bool ndoms_ok = ndoms_x > 0 && ndoms_y > 0 && ndoms_z > 0 &&
+                          (is_3d || ndoms_z == 1);
+
+    if(!(npts_ok && ndoms_ok))
+    {
+        CONDUIT_ERROR("blueprint::mpi::mesh::examples::grid requires "
+                      "npts_x > 1 and npts_y > 1 (and npts_z > 1 for 3D"
+                      " mesh types), ndoms_x, ndoms_y, ndoms_z > 0, and"
+                      " ndoms_z == 1 for 2D meshes" << std::endl <<
+                      "values provided:" << std::endl <<
+                      " mesh_type: " << mesh_type << std::endl <<
+                      " npts_x: " << npts_x << std::endl <<
+                      " npts_y: " << npts_y << std::endl <<
+                      " npts_z: " << npts_z << std::endl <<
+                      " ndoms_x: " << ndoms_x << std::endl <<
+                      " ndoms_y: " << ndoms_y << std::endl <<
+                      " ndoms_z: " << ndoms_z << std::endl);
+    }
+
+    const index_t par_rank = relay::mpi::rank(comm);
+    const index_t par_size = relay::mpi::size(comm);
+
+    const index_t npts[3]  = {npts_x, npts_y, is_3d ? npts_z : 1};
+    const index_t ndoms[3] = {ndoms_x, ndoms_y, ndoms_z};
+    const index_t ndoms_total = ndoms_x * ndoms_y * ndoms_z;
+
+    const index_t dom_begin = par_rank * ndoms_total / par_size;
+    const index_t dom_end = (par_rank + 1) * ndoms_total / par_size;
+
+    for(index_t domain_id = dom_begin; domain_id < dom_end; domain_id++)
+    {
+        const index_t dom[3] = {domain_id % ndoms_x,
+                                (domain_id / ndoms_x) % ndoms_y,
+                                domain_id / (ndoms_x * ndoms_y)};
+
+        Node &domain_node = res["domain" + std::to_string(domain_id)];
+        blueprint::mesh::examples::braid(mesh_type,
+                                         npts_x,
+                                         npts_y,
+                                         npts_z,
+                                         options,
+                                         domain_node);
+        domain_node["state/domain_id"].set(domain_id);
+
+        // same placement as blueprint::mesh::examples::grid
+        Node &domain_coords_node = domain_node["coordsets/coords"];
+        const std::string domain_coords_path =
+            (domain_coords_node["type"].as_string() == "uniform") ? "origin" : "values";
+        const std::vector<std::string> domain_axes =
+            blueprint::mesh::utils::coordset::axes(domain_coords_node);
+
+        for(const std::string &domain_axis : domain_axes)
+        {
+            const index_t domain_axis_offset = 20.0 * (
+                (domain_axis == "x") ? dom[0] : (
+                (domain_axis == "y") ? dom[1] : (
+                (domain_axis == "z") ? dom[2] : 0)));
+
+            float64_array domain_axis_coords =
+                domain_coords_node[domain_coords_path][domain_axis].as_float64_array();
+            for(index_t dai = 0; dai < domain_axis_coords.number_of_elements(); dai++)
+            {
+                domain_axis_coords[dai] += domain_axis_offset;
+            }
+        }
+
+        if(ndoms_total > 1)
+        {
+            grid_domain_adjset(npts, ndoms, dom, domain_node["adjsets/mesh_adj"]);
+        }
+    }
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mpi::mesh::examples --
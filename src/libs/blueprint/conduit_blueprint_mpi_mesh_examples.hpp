@@ -60,6 +60,45 @@ namespace examples
     void CONDUIT_BLUEPRINT_API spiral_round_robin(conduit::index_t ndomains,
                                                   conduit::Node &res,
                                                   MPI_Comm comm);
+
+    /// Generates this MPI task's domains of the multi-domain grid built by
+    /// blueprint::mesh::examples::grid, without creating the other tasks'
+    /// domains. The ndoms_x * ndoms_y * ndoms_z domains are split into
+    /// contiguous blocks of domain ids, one block per task. When there is
+    /// more than one domain, each domain gets a vertex adjset ("mesh_adj")
+    /// computed from the logical domain layout, with one group per set of
+    /// domains that share vertices.
+    ///
+    /// Supported mesh types are those whose vertices lie on the braid
+    /// lattice: "uniform", "rectilinear", "structured", "tris", "quads",
+    /// "quads_poly", "tets", "hexs", "hexs_poly", "wedges" and "pyramids".
+    ///
+    /// options:
+    ///
+    /// \code{.yaml}
+    /// num_threads: N  # threads used within each domain (see braid)
+    /// \endcode
+    void CONDUIT_BLUEPRINT_API grid(const std::string &mesh_type,
+                                    conduit::index_t npts_x,
+                                    conduit::index_t npts_y,
+                                    conduit::index_t npts_z,
+                                    conduit::index_t ndoms_x,
+                                    conduit::index_t ndoms_y,
+                                    conduit::index_t ndoms_z,
+                                    const conduit::Node &options,
+                                    conduit::Node &res,
+                                    MPI_Comm comm);
+
+    /// Same as above, using default options.
+    void CONDUIT_BLUEPRINT_API grid(const std::string &mesh_type,
+                                    conduit::index_t npts_x,
+                                    conduit::index_t npts_y,
+                                    conduit::index_t npts_z,
+                                    conduit::index_t ndoms_x,
+                                    conduit::index_t ndoms_y,
+                                    conduit::index_t ndoms_z,
+                                    conduit::Node &res,
+                                    MPI_Comm comm);
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mpi::mesh::examples --
@@ -0,0 +1,624 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_mpi_mesh_exchange.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_blueprint_mpi_mesh_exchange.hpp"
+
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include "conduit_blueprint_mesh.hpp"
+#include "conduit_blueprint_mpi_mesh.hpp"
+#include "conduit_relay_mpi.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mpi::mesh --
+//-----------------------------------------------------------------------------
+namespace mesh
+{
+
+//-----------------------------------------------------------------------------
+// A group of a local domain that sends to or receives from one domain. Both
+// sides of the exchange sort these by (owner, receiver, members) so they pack
+// and unpack the segments between two ranks in the same order.
+namespace
+{
+struct AdjsetExchangeItem
+{
+    int64 owner;
+    int64 receiver;
+    std::vector<int64> members;
+    index_t domain;
+    std::vector<index_t> entries;
+
+    bool operator<(const AdjsetExchangeItem &other) const
+    {
+        if(owner != other.owner)
+        {
+            return owner < other.owner;
+        }
+        if(receiver != other.receiver)
+        {
+            return receiver < other.receiver;
+        }
+        return members < other.members;
+    }
+};
+}
+
+//-----------------------------------------------------------------------------
+// Appends the leaves of a field's values; an array is its own single leaf.
+static void
+values_leaves(Node &values, std::vector<Node *> &leaves)
+{
+    if(values.number_of_children() == 0)
+    {
+        leaves.push_back(&values);
+    }
+    else
+    {
+        for(index_t i = 0; i < values.number_of_children(); i++)
+        {
+            leaves.push_back(&values.child(i));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+AdjsetExchange::AdjsetExchange()
+: m_comm(MPI_COMM_NULL),
+  m_num_domains(0),
+  m_local_entries(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+AdjsetExchange::~AdjsetExchange()
+{
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if(!finalized)
+    {
+        reset();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+AdjsetExchange::reset()
+{
+    if(m_comm != MPI_COMM_NULL)
+    {
+        MPI_Comm_free(&m_comm);
+        m_comm = MPI_COMM_NULL;
+    }
+    m_num_domains = 0;
+    m_domains.clear();
+    m_domains_max_entry.clear();
+    m_local_send.clear();
+    m_local_recv.clear();
+    m_local_entries = 0;
+    m_send_segments.clear();
+    m_recv_segments.clear();
+    m_send_entries.clear();
+    m_recv_entries.clear();
+    m_send_buffer.clear();
+    m_recv_buffer.clear();
+    m_send_counts.clear();
+    m_send_displs.clear();
+    m_recv_counts.clear();
+    m_recv_displs.clear();
+}
+
+//-----------------------------------------------------------------------------
+bool
+AdjsetExchange::is_built() const
+{
+    return m_comm != MPI_COMM_NULL;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+AdjsetExchange::number_of_send_ranks() const
+{
+    return (index_t)m_send_segments.size();
+}
+
+//-----------------------------------------------------------------------------
+index_t
+AdjsetExchange::number_of_recv_ranks() const
+{
+    return (index_t)m_recv_segments.size();
+}
+
+//-----------------------------------------------------------------------------
+index_t
+AdjsetExchange::number_of_send_entries() const
+{
+    index_t res = m_local_entries;
+    for(size_t i = 0; i < m_send_entries.size(); i++)
+    {
+        res += m_send_entries[i];
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+AdjsetExchange::number_of_recv_entries() const
+{
+    index_t res = m_local_entries;
+    for(size_t i = 0; i < m_recv_entries.size(); i++)
+    {
+        res += m_recv_entries[i];
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+AdjsetExchange::build(const conduit::Node &mesh,
+                      const std::string &adjset_name,
+                      MPI_Comm comm)
+{
+    reset();
+
+    const int par_rank = relay::mpi::rank(comm);
+    const std::vector<const Node *> doms = ::conduit::blueprint::mesh::domains(mesh);
+    m_num_domains = (index_t)doms.size();
+
+    // the groups of each domain with the adjset, with the owner first in
+    // the sorted members
+    std::vector<int64> dom_ids(doms.size(), par_rank);
+    std::vector<std::vector<std::vector<int64>>> dom_members(doms.size());
+    std::vector<int64> nbr_ids;
+    for(size_t di = 0; di < doms.size(); di++)
+    {
+        const Node &dom = *doms[di];
+        if(!dom.has_child("adjsets") || !dom["adjsets"].has_child(adjset_name))
+        {
+            continue;
+        }
+        if(dom.has_path("state/domain_id"))
+        {
+            dom_ids[di] = dom["state/domain_id"].to_int64();
+        }
+        const Node &groups = dom["adjsets"][adjset_name]["groups"];
+        for(index_t gi = 0; gi < groups.number_of_children(); gi++)
+        {
+            int64_accessor nbrs = groups.child(gi)["neighbors"].as_int64_accessor();
+            std::vector<int64> members(1, dom_ids[di]);
+            for(index_t ni = 0; ni < nbrs.number_of_elements(); ni++)
+            {
+                members.push_back(nbrs[ni]);
+                nbr_ids.push_back(nbrs[ni]);
+            }
+            std::sort(members.begin(), members.end());
+            members.erase(std::unique(members.begin(), members.end()),
+                          members.end());
+            dom_members[di].push_back(members);
+        }
+    }
+
+    // look up where the neighbors live, all ranks take part
+    Node n_nbr_ids, n_nbr_map;
+    n_nbr_ids.set(nbr_ids);
+    generate_domain_to_rank_map(mesh, n_nbr_ids, n_nbr_map, comm);
+    int64_accessor map_ids = n_nbr_map["domain_ids"].as_int64_accessor();
+    int64_accessor map_ranks = n_nbr_map["ranks"].as_int64_accessor();
+    const auto rank_of = [&](int64 domain_id) -> int
+    {
+        index_t lo = 0, hi = map_ids.number_of_elements();
+        while(lo < hi)
+        {
+            const index_t mid = (lo + hi) / 2;
+            if(map_ids[mid] < domain_id)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        if(lo == map_ids.number_of_elements() || map_ids[lo] != domain_id ||
+           map_ranks[lo] < 0)
+        {
+            CONDUIT_ERROR("adjset " << "\"" << adjset_name << "\""
+                          << " references domain " << domain_id
+                          << " which no rank holds");
+        }
+        return (int)map_ranks[lo];
+    };
+
+    std::map<int, std::vector<AdjsetExchangeItem>> sends, recvs;
+    for(size_t di = 0; di < doms.size(); di++)
+    {
+        if(dom_members[di].empty())
+        {
+            continue;
+        }
+        const Node &groups = (*doms[di])["adjsets"][adjset_name]["groups"];
+        for(index_t gi = 0; gi < groups.number_of_children(); gi++)
+        {
+            const std::vector<int64> &members = dom_members[di][gi];
+            index_t_accessor vals = groups.child(gi)["values"].as_index_t_accessor();
+
+            AdjsetExchangeItem item;
+            item.owner = members[0];
+            item.members = members;
+            item.domain = (index_t)di;
+            item.entries.resize(vals.number_of_elements());
+            for(index_t vi = 0; vi < vals.number_of_elements(); vi++)
+            {
+                item.entries[vi] = vals[vi];
+            }
+
+            if(item.owner == dom_ids[di])
+            {
+                for(size_t mi = 1; mi < members.size(); mi++)
+                {
+                    item.receiver = members[mi];
+                    sends[rank_of(members[mi])].push_back(item);
+                }
+            }
+            else
+            {
+                item.receiver = dom_ids[di];
+                recvs[rank_of(item.owner)].push_back(item);
+            }
+        }
+    }
+
+    // the segments with this rank's own domains are copied directly, the
+    // others go through the graph
+    std::vector<int> dests, srcs;
+    std::vector<index_t> max_entry(doms.size(), -1);
+    const auto to_segments = [&](std::vector<AdjsetExchangeItem> &items,
+                                 std::vector<Segment> &segs) -> index_t
+    {
+        std::stable_sort(items.begin(), items.end());
+        index_t nentries = 0;
+        for(AdjsetExchangeItem &item : items)
+        {
+            nentries += (index_t)item.entries.size();
+            for(size_t ei = 0; ei < item.entries.size(); ei++)
+            {
+                max_entry[item.domain] = std::max(max_entry[item.domain],
+                                                  item.entries[ei]);
+            }
+            segs.push_back(Segment());
+            segs.back().domain = item.domain;
+            segs.back().entries.swap(item.entries);
+        }
+        return nentries;
+    };
+    for(auto &rank_items : sends)
+    {
+        if(rank_items.first == par_rank)
+        {
+            m_local_entries = to_segments(rank_items.second, m_local_send);
+            continue;
+        }
+        dests.push_back(rank_items.first);
+        m_send_segments.push_back(std::vector<Segment>());
+        m_send_entries.push_back(to_segments(rank_items.second,
+                                             m_send_segments.back()));
+    }
+    for(auto &rank_items : recvs)
+    {
+        if(rank_items.first == par_rank)
+        {
+            to_segments(rank_items.second, m_local_recv);
+            continue;
+        }
+        srcs.push_back(rank_items.first);
+        m_recv_segments.push_back(std::vector<Segment>());
+        m_recv_entries.push_back(to_segments(rank_items.second,
+                                             m_recv_segments.back()));
+    }
+    for(size_t di = 0; di < doms.size(); di++)
+    {
+        if(max_entry[di] >= 0)
+        {
+            m_domains.push_back((index_t)di);
+            m_domains_max_entry.push_back(max_entry[di]);
+        }
+    }
+
+    MPI_Dist_graph_create_adjacent(comm,
+                                   (int)srcs.size(), srcs.data(), MPI_UNWEIGHTED,
+                                   (int)dests.size(), dests.data(), MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL, 0, &m_comm);
+
+    // check that every sender and receiver agree on the segments
+    int local_ok = (m_local_send.size() == m_local_recv.size()) ? 1 : 0;
+    for(size_t i = 0; local_ok && i < m_local_send.size(); i++)
+    {
+        if(m_local_send[i].entries.size() != m_local_recv[i].entries.size())
+        {
+            local_ok = 0;
+        }
+    }
+    std::vector<int64> snd_sizes(2 * dests.size());
+    std::vector<int64> rcv_sizes(2 * srcs.size());
+    for(size_t i = 0; i < dests.size(); i++)
+    {
+        snd_sizes[2 * i] = (int64)m_send_segments[i].size();
+        snd_sizes[2 * i + 1] = (int64)m_send_entries[i];
+    }
+    MPI_Neighbor_alltoall(snd_sizes.data(), 2, MPI_INT64_T,
+                          rcv_sizes.data(), 2, MPI_INT64_T, m_comm);
+    for(size_t i = 0; i < srcs.size(); i++)
+    {
+        if(rcv_sizes[2 * i] != (int64)m_recv_segments[i].size() ||
+           rcv_sizes[2 * i + 1] != (int64)m_recv_entries[i])
+        {
+            local_ok = 0;
+        }
+    }
+    int global_ok = 1;
+    MPI_Allreduce(&local_ok, &global_ok, 1, MPI_INT, MPI_MIN, comm);
+    if(!global_ok)
+    {
+        reset();
+        CONDUIT_ERROR("adjset " << "\"" << adjset_name << "\""
+                      << " groups do not match between neighbor domains");
+    }
+
+    m_send_counts.resize(dests.size());
+    m_send_displs.resize(dests.size());
+    m_recv_counts.resize(srcs.size());
+    m_recv_displs.resize(srcs.size());
+}
+
+//-----------------------------------------------------------------------------
+void
+AdjsetExchange::exchange(conduit::Node &mesh, const std::string &field_name)
+{
+    exchange(mesh, std::vector<std::string>(1, field_name));
+}
+
+//-----------------------------------------------------------------------------
+void
+AdjsetExchange::exchange(conduit::Node &mesh,
+                         const std::vector<std::string> &field_names)
+{
+    if(!is_built())
+    {
+        CONDUIT_ERROR("AdjsetExchange::exchange called before build");
+    }
+    const std::vector<Node *> doms = ::conduit::blueprint::mesh::domains(mesh);
+    if((index_t)doms.size() != m_num_domains)
+    {
+        CONDUIT_ERROR("AdjsetExchange was built for " << m_num_domains
+                      << " domains but the mesh has " << doms.size());
+    }
+
+    std::vector<std::vector<Node *>> leaves(m_domains.size());
+    for(size_t i = 0; i < m_domains.size(); i++)
+    {
+        Node &dom = *doms[m_domains[i]];
+        for(size_t fi = 0; fi < field_names.size(); fi++)
+        {
+            if(!dom.has_child("fields") || !dom["fields"].has_child(field_names[fi]))
+            {
+                CONDUIT_ERROR("AdjsetExchange domain " << dom.name()
+                              << " has no field " << "\"" << field_names[fi] << "\"");
+            }
+            values_leaves(dom["fields"][field_names[fi]]["values"], leaves[i]);
+        }
+    }
+    exchange_leaves(leaves);
+}
+
+//-----------------------------------------------------------------------------
+void
+AdjsetExchange::exchange(const std::vector<conduit::Node *> &values)
+{
+    if(!is_built())
+    {
+        CONDUIT_ERROR("AdjsetExchange::exchange called before build");
+    }
+    if((index_t)values.size() != m_num_domains)
+    {
+        CONDUIT_ERROR("AdjsetExchange was built for " << m_num_domains
+                      << " domains but given values for " << values.size());
+    }
+
+    std::vector<std::vector<Node *>> leaves(m_domains.size());
+    for(size_t i = 0; i < m_domains.size(); i++)
+    {
+        if(values[m_domains[i]] == NULL)
+        {
+            CONDUIT_ERROR("AdjsetExchange missing values for domain "
+                          << m_domains[i]);
+        }
+        values_leaves(*values[m_domains[i]], leaves[i]);
+    }
+    exchange_leaves(leaves);
+}
+
+//-----------------------------------------------------------------------------
+void
+AdjsetExchange::exchange_leaves(std::vector<std::vector<Node *>> &leaves)
+{
+    // every domain must hold the same leaf dtypes, long enough for the
+    // entries the plan moves
+    std::vector<index_t> leaf_bytes;
+    index_t entry_bytes = 0;
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        if(i == 0)
+        {
+            for(size_t li = 0; li < leaves[i].size(); li++)
+            {
+                leaf_bytes.push_back(leaves[i][li]->dtype().element_bytes());
+                entry_bytes += leaf_bytes.back();
+            }
+        }
+        bool same = leaves[i].size() == leaf_bytes.size();
+        for(size_t li = 0; same && li < leaves[i].size(); li++)
+        {
+            const DataType &dt = leaves[i][li]->dtype();
+            same = dt.element_bytes() == leaf_bytes[li];
+            if(dt.number_of_elements() <= m_domains_max_entry[i])
+            {
+                CONDUIT_ERROR("AdjsetExchange entry " << m_domains_max_entry[i]
+                              << " is out of range for the values of domain "
+                              << m_domains[i]);
+            }
+        }
+        if(!same)
+        {
+            CONDUIT_ERROR("AdjsetExchange values of domain " << m_domains[i]
+                          << " do not have the same dtypes as the others");
+        }
+    }
+
+    // from a plan domain index to its place in leaves
+    std::vector<index_t> leaves_idx(m_num_domains, -1);
+    for(size_t i = 0; i < m_domains.size(); i++)
+    {
+        leaves_idx[m_domains[i]] = (index_t)i;
+    }
+
+    // copies every entry of segs into buf (pack) or back out of it
+    const auto walk = [&](const std::vector<Segment> &segs, char *buf, bool pack)
+    {
+        for(size_t si = 0; si < segs.size(); si++)
+        {
+            const Segment &seg = segs[si];
+            const std::vector<Node *> &seg_leaves = leaves[leaves_idx[seg.domain]];
+            for(size_t ei = 0; ei < seg.entries.size(); ei++)
+            {
+                const index_t entry = seg.entries[ei];
+                for(size_t li = 0; li < seg_leaves.size(); li++)
+                {
+                    if(pack)
+                    {
+                        std::memcpy(buf, seg_leaves[li]->element_ptr(entry),
+                                    leaf_bytes[li]);
+                    }
+                    else
+                    {
+                        std::memcpy(seg_leaves[li]->element_ptr(entry), buf,
+                                    leaf_bytes[li]);
+                    }
+                    buf += leaf_bytes[li];
+                }
+            }
+        }
+    };
+
+    index_t send_bytes = 0;
+    for(size_t i = 0; i < m_send_segments.size(); i++)
+    {
+        m_send_displs[i] = (int)send_bytes;
+        m_send_counts[i] = (int)(m_send_entries[i] * entry_bytes);
+        send_bytes += m_send_counts[i];
+    }
+    index_t recv_bytes = 0;
+    for(size_t i = 0; i < m_recv_segments.size(); i++)
+    {
+        m_recv_displs[i] = (int)recv_bytes;
+        m_recv_counts[i] = (int)(m_recv_entries[i] * entry_bytes);
+        recv_bytes += m_recv_counts[i];
+    }
+    // only grows, so repeated exchanges of the same fields don't reallocate
+    if((index_t)m_send_buffer.size() < send_bytes)
+    {
+        m_send_buffer.resize(send_bytes);
+    }
+    if((index_t)m_recv_buffer.size() < recv_bytes)
+    {
+        m_recv_buffer.resize(recv_bytes);
+    }
+
+    for(size_t i = 0; i < m_send_segments.size(); i++)
+    {
+        walk(m_send_segments[i], m_send_buffer.data() + m_send_displs[i], true);
+    }
+
+    MPI_Request request;
+    MPI_Ineighbor_alltoallv(m_send_buffer.data(), m_send_counts.data(),
+                            m_send_displs.data(), MPI_BYTE,
+                            m_recv_buffer.data(), m_recv_counts.data(),
+                            m_recv_displs.data(), MPI_BYTE,
+                            m_comm, &request);
+
+    // copy between the domains of this rank while the messages are in flight
+    for(size_t si = 0; si < m_local_send.size(); si++)
+    {
+        const Segment &src = m_local_send[si];
+        const Segment &dst = m_local_recv[si];
+        const std::vector<Node *> &src_leaves = leaves[leaves_idx[src.domain]];
+        const std::vector<Node *> &dst_leaves = leaves[leaves_idx[dst.domain]];
+        for(size_t li = 0; li < src_leaves.size(); li++)
+        {
+            for(size_t ei = 0; ei < src.entries.size(); ei++)
+            {
+                std::memcpy(dst_leaves[li]->element_ptr(dst.entries[ei]),
+                            src_leaves[li]->element_ptr(src.entries[ei]),
+                            leaf_bytes[li]);
+            }
+        }
+    }
+
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    for(size_t i = 0; i < m_recv_segments.size(); i++)
+    {
+        walk(m_recv_segments[i], m_recv_buffer.data() + m_recv_displs[i], false);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mpi::mesh --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mpi --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
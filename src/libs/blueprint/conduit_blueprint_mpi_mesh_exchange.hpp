@@ -0,0 +1,189 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_mpi_mesh_exchange.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_BLUEPRINT_MPI_MESH_EXCHANGE_HPP
+#define CONDUIT_BLUEPRINT_MPI_MESH_EXCHANGE_HPP
+
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_blueprint_exports.h"
+
+#include <mpi.h>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mpi::mesh --
+//-----------------------------------------------------------------------------
+namespace mesh
+{
+
+//-----------------------------------------------------------------------------
+/**
+ @brief A reusable plan that copies the values shared through an adjset from
+        the domain that owns them to the other domains of each group.
+
+        The owner of a group is its lowest domain id (the rule used to number
+        shared vertices in generate_global_element_and_vertex_ids). build()
+        looks up the ranks of the neighbor domains, creates a distributed
+        graph communicator over the other ranks that exchange values
+        (MPI_Dist_graph_create_adjacent) and checks that both sides of every
+        group agree on its size. Each exchange() packs all of its fields
+        for a rank into one message and starts one MPI_Ineighbor_alltoallv
+        into buffers that are kept between calls. Values shared by domains
+        of the same rank are copied directly while the messages are in
+        flight. A plan can be built once and used for a ghost exchange
+        every cycle.
+
+        The entries of a group's "values" must be listed in the same order by
+        every domain of the group, as the adjsets generated by conduit are.
+ */
+class CONDUIT_BLUEPRINT_API AdjsetExchange
+{
+public:
+    AdjsetExchange();
+    virtual ~AdjsetExchange();
+
+    /**
+     @brief Builds the plan for the adjset named adjset_name of the domains
+            of mesh (collective over comm). Domains without the adjset take
+            no part. Domains without a state/domain_id use their rank as
+            their domain id. Any previous plan is released.
+     */
+    void build(const conduit::Node &mesh,
+               const std::string &adjset_name,
+               MPI_Comm comm);
+
+    /**
+     @brief Overwrites the shared entries of field_name in each domain of
+            mesh with the owner's values (collective over the comm passed to
+            build). mesh must hold the domains the plan was built from, in
+            the same order. The field values may be an array or an mcarray,
+            and every domain must use the same dtypes.
+     */
+    void exchange(conduit::Node &mesh, const std::string &field_name);
+
+    /**
+     @brief Same as exchange(mesh, field_name) for several fields at once,
+            each rank pair exchanges one message holding all of them.
+     */
+    void exchange(conduit::Node &mesh,
+                  const std::vector<std::string> &field_names);
+
+    /**
+     @brief Same as exchange(mesh, field_name), for the values (an array or
+            an mcarray) of each domain the plan was built from, in order.
+            Domains that take no part may pass NULL.
+     */
+    void exchange(const std::vector<conduit::Node *> &values);
+
+    /// Releases the plan and its communicator.
+    void reset();
+
+    /// true after build() until reset()
+    bool is_built() const;
+
+    /**
+     @brief The number of other ranks this rank sends to and receives from.
+     */
+    index_t number_of_send_ranks() const;
+    index_t number_of_recv_ranks() const;
+
+    /// The number of shared entries this rank's domains send and receive per
+    /// exchange, including the ones copied between its own domains
+    index_t number_of_send_entries() const;
+    index_t number_of_recv_entries() const;
+
+private:
+    // not copyable, the plan owns a communicator
+    AdjsetExchange(const AdjsetExchange &);
+    AdjsetExchange &operator=(const AdjsetExchange &);
+
+    // the entries of one local domain copied to or from one peer rank
+    struct Segment
+    {
+        index_t domain;
+        std::vector<index_t> entries;
+    };
+
+    // leaves holds the value leaves of each domain in m_domains
+    void exchange_leaves(std::vector<std::vector<conduit::Node *>> &leaves);
+
+    MPI_Comm m_comm;
+    index_t m_num_domains;
+    // the local domains that take part and the largest entry each one uses
+    std::vector<index_t> m_domains;
+    std::vector<index_t> m_domains_max_entry;
+    // segments between domains of this rank, m_local_send[i] is copied to
+    // m_local_recv[i]
+    std::vector<Segment> m_local_send;
+    std::vector<Segment> m_local_recv;
+    index_t m_local_entries;
+    // for each neighbor in the graph, the segments in the order both sides
+    // pack them
+    std::vector<std::vector<Segment>> m_send_segments;
+    std::vector<std::vector<Segment>> m_recv_segments;
+    std::vector<index_t> m_send_entries;
+    std::vector<index_t> m_recv_entries;
+
+    // kept between exchanges
+    std::vector<char> m_send_buffer;
+    std::vector<char> m_recv_buffer;
+    std::vector<int> m_send_counts;
+    std::vector<int> m_send_displs;
+    std::vector<int> m_recv_counts;
+    std::vector<int> m_recv_displs;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mpi::mesh --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mpi --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -85,6 +85,7 @@ ParallelMeshFlattener::ParallelMeshFlattener(MPI_Comm comm)
     root = 0;
     rank = relay::mpi::rank(comm);
     add_rank = false;
+    gather = true;
 }
 
 //-----------------------------------------------------------------------------
@@ -114,6 +115,22 @@ ParallelMeshFlattener::set_options(const Node &opts)
         }
     }
 
+    // "gather", boolean
+    if(opts.has_child("gather"))
+    {
+        const Node &n_gather = opts["gather"];
+        if(n_gather.dtype().is_number())
+        {
+            this->gather = n_gather.to_int() != 0;
+        }
+        else
+        {
+            ok = false;
+            CONDUIT_ERROR("options[" << quote("gather") <<
+                "] must be a number. It will be treated as a boolean (.to_int() != 0).");
+        }
+    }
+
     // "root", int
     if(opts.has_child("root"))
     {
@@ -488,14 +505,27 @@ ParallelMeshFlattener::gather_global_mesh_metadata(const MeshInfo &my_info,
 }
 
 //-----------------------------------------------------------------------------
-void
-ParallelMeshFlattener::gather_values(int nrows, int *rank_counts,
-    int *rank_offsets, Node &values) const
+// Appends one struct block per leaf column of values that covers the rows
+// [offset, offset + nrows). Columns are contiguous, so each block is just the
+// address of its first row.
+static void
+append_row_blocks(Node &values, index_t offset, index_t nrows,
+    std::vector<int> &lengths, std::vector<MPI_Aint> &displs,
+    std::vector<MPI_Datatype> &types)
 {
-// #define DEBUG_GATHER_VERBOSE
-    DEBUG_PRINT("Rank " << rank << " - gather_values" << std::endl);
-    int send_count = (rank == root) ? 0 : nrows;
-    int no_data[] = {0};
+    if(nrows < 1)
+    {
+        return;
+    }
+
+    const auto append_block = [&](Node &column) {
+        MPI_Aint addr;
+        MPI_Get_address(column.element_ptr(offset), &addr);
+        lengths.push_back(static_cast<int>(nrows));
+        displs.push_back(addr);
+        types.push_back(relay::mpi::conduit_dtype_to_mpi_dtype(column.dtype()));
+    };
+
     for(index_t i = 0; i < values.number_of_children(); i++)
     {
         Node &value = values[i];
@@ -505,108 +535,106 @@ ParallelMeshFlattener::gather_values(int nrows, int *rank_counts,
             // mcarray
             for(index_t j = 0; j < ncomps; j++)
             {
-                Node &column = value[j];
-                // If we don't have data send_count is 0.
-                // On root our send_count is 0. Send buff and recv buff may not alias.
-                void *ptr = (send_count == 0) ? no_data : column.element_ptr(0);
-                void *recv_ptr = (rank == root) ? column.element_ptr(0) : nullptr;
-                const auto mtype = relay::mpi::conduit_dtype_to_mpi_dtype(column.dtype());
-#ifdef DEBUG_GATHER_VERBOSE
-                DEBUG_PRINT("Rank " << rank << " - MPI_Gatherv(" << ptr << ", " << send_count
-                    << ", " << mtype << ", " << recv_ptr << ", " << rank_counts << ", " << rank_offsets
-                    << ", " << mtype << ", " << root << ", " << comm << ");" << std::endl);
-#else
-                DEBUG_PRINT("Rank " << rank << " - MPI_Gatherv(" << value.name()
-                    << "[" << column.name() << "]);" << std::endl);
-#endif
-                MPI_Gatherv(ptr, send_count, mtype,
-                    recv_ptr, rank_counts, rank_offsets,
-                    mtype, root, comm);
+                append_block(value[j]);
             }
         }
         else
         {
-            // If we don't have data send_count is 0.
-            // On root our send_count is 0. Send buff and recv buff may not alias.
-            void *ptr = (send_count == 0) ? no_data : value.element_ptr(0);
-            void *recv_ptr = (rank == root) ? value.element_ptr(0) : nullptr;
-            const auto mtype = relay::mpi::conduit_dtype_to_mpi_dtype(value.dtype());
-#ifdef DEBUG_GATHER_VERBOSE
-            DEBUG_PRINT("Rank " << rank << " - MPI_Gatherv(" << ptr << ", " << send_count
-                << ", " << mtype << ", " << recv_ptr << ", " << rank_counts << ", " << rank_offsets
-                << ", " << mtype << ", " << root << ", " << comm << ");" << std::endl);
-#else
-            DEBUG_PRINT("Rank " << rank << " - MPI_Gatherv(" << value.name() << ");" << std::endl);
-#endif
-            MPI_Gatherv(ptr, send_count, mtype, recv_ptr, rank_counts,
-                rank_offsets, mtype, root, comm);
+            append_block(value);
         }
     }
 }
 
+//-----------------------------------------------------------------------------
+MPI_Datatype
+ParallelMeshFlattener::create_rows_type(Node &output,
+    index_t vert_offset, index_t nverts,
+    index_t elem_offset, index_t nelems) const
+{
+    std::vector<int> lengths;
+    std::vector<MPI_Aint> displs;
+    std::vector<MPI_Datatype> types;
+    append_row_blocks(output["vertex_data/values"], vert_offset, nverts,
+        lengths, displs, types);
+    append_row_blocks(output["element_data/values"], elem_offset, nelems,
+        lengths, displs, types);
+    if(lengths.empty())
+    {
+        return MPI_DATATYPE_NULL;
+    }
+
+    MPI_Datatype rows_type;
+    MPI_Type_create_struct(static_cast<int>(lengths.size()), lengths.data(),
+        displs.data(), types.data(), &rows_type);
+    MPI_Type_commit(&rows_type);
+    return rows_type;
+}
+
 //-----------------------------------------------------------------------------
 void
 ParallelMeshFlattener::gather_results(const MeshInfo &my_info,
     const MeshMetaData &global_meta_data, Node &output) const
 {
     DEBUG_PRINT("Rank " << rank << " - gather_results" << std::endl);
-    // Everyone should have the same exact columns
+    // Everyone has the same exact columns, in the same order. Each rank
+    // describes all of its vertex and element rows with one struct type
+    // over the column addresses, root describes where every other rank's
+    // rows land in its columns, and a single MPI_Alltoallw moves all of
+    // the columns at once. Root already holds its rows "in place".
     const int comm_size = relay::mpi::size(comm);
-    std::vector<int> rank_counts;
-    std::vector<int> rank_offsets;
+    std::vector<int> send_counts(comm_size, 0);
+    std::vector<int> recv_counts(comm_size, 0);
+    std::vector<int> displs(comm_size, 0);
+    std::vector<MPI_Datatype> send_types(comm_size, MPI_BYTE);
+    std::vector<MPI_Datatype> recv_types(comm_size, MPI_BYTE);
     if(rank == root)
     {
-        rank_counts.resize(comm_size);
-        rank_offsets.resize(comm_size);
-        int offset = 0;
+        // counts stored as [nverts0, nelems0, nverts1, nelems1, ...]
+        index_t vert_offset = 0;
+        index_t elem_offset = 0;
         const index_t *c = global_meta_data.counts.data();
         for(int i = 0; i < comm_size; i++, c += 2)
         {
-            int count = static_cast<int>(*c);
-            rank_counts[i] = count;
-            rank_offsets[i] = offset;
-            offset += count;
+            if(i != root)
+            {
+                MPI_Datatype rows_type = create_rows_type(output,
+                    vert_offset, c[0], elem_offset, c[1]);
+                if(rows_type != MPI_DATATYPE_NULL)
+                {
+                    recv_types[i] = rows_type;
+                    recv_counts[i] = 1;
+                }
+            }
+            vert_offset += c[0];
+            elem_offset += c[1];
+        }
+    }
+    else
+    {
+        MPI_Datatype rows_type = create_rows_type(output,
+            0, my_info.nverts, 0, my_info.nelems);
+        if(rows_type != MPI_DATATYPE_NULL)
+        {
+            send_types[root] = rows_type;
+            send_counts[root] = 1;
         }
-        // Root will perform the operation "in place".
-        rank_counts[root] = 0;
-#ifdef DEBUG_MESH_FLATTEN
-        std::cout << "Rank counts:\n  ";
-        for(int count : rank_counts) std::cout << count << ", ";
-        std::cout << "\nRank offsets:\n  ";
-        for(int off : rank_offsets) std::cout << off << ", ";
-        std::cout << std::endl;
-#endif
     }
 
-    gather_values(my_info.nverts, rank_counts.data(), rank_offsets.data(),
-        output["vertex_data/values"]);
-    DEBUG_PRINT("Rank " << rank << " - done gathering vertex values." << std::endl);
+    MPI_Alltoallw(MPI_BOTTOM, send_counts.data(), displs.data(), send_types.data(),
+        MPI_BOTTOM, recv_counts.data(), displs.data(), recv_types.data(), comm);
+    DEBUG_PRINT("Rank " << rank << " - done gathering values." << std::endl);
 
-    if(rank == root)
+    for(int i = 0; i < comm_size; i++)
     {
-        int offset = 0;
-        const index_t *c = global_meta_data.counts.data() + 1;
-        for(int i = 0; i < comm_size; i++, c += 2)
+        if(send_counts[i] > 0)
         {
-            int count = static_cast<int>(*c);
-            rank_counts[i] = count;
-            rank_offsets[i] = offset;
-            offset += count;
+            MPI_Type_free(&send_types[i]);
+        }
+        if(recv_counts[i] > 0)
+        {
+            MPI_Type_free(&recv_types[i]);
         }
-        // Root will perform the operation "in place".
-        rank_counts[root] = 0;
-#ifdef DEBUG_MESH_FLATTEN
-        std::cout << "Rank counts:\n  ";
-        for(int count : rank_counts) std::cout << count << ", ";
-        std::cout << "\nRank offsets:\n  ";
-        for(int off : rank_offsets) std::cout << off << ", ";
-        std::cout << std::endl;
-#endif
     }
-
-    gather_values(my_info.nelems, rank_counts.data(), rank_offsets.data(),
-        output["element_data/values"]);
-    DEBUG_PRINT("Rank " << rank << " - done gathering element values." << std::endl);
 }
 
 //-----------------------------------------------------------------------------
@@ -803,8 +831,9 @@ ParallelMeshFlattener::make_root_allocations(const MeshMetaData &mdata,
 void
 ParallelMeshFlattener::cleanup_output(Node &output) const
 {
-    // On all ranks other than root, remove data.
-    if(rank != root)
+    // On all ranks other than root, remove data. When the results are not
+    // gathered every rank keeps its own rows.
+    if(gather && rank != root)
     {
         output.reset();
     }
@@ -853,7 +882,7 @@ ParallelMeshFlattener::flatten_many_domains(const Node &mesh, Node &output) cons
         my_mesh_info.cset_name = "coords";
     }
 
-    if(rank != root)
+    if(!gather || rank != root)
     {
         make_local_allocations(my_mesh_info, global_field_info, output);
     }
@@ -874,7 +903,7 @@ ParallelMeshFlattener::flatten_many_domains(const Node &mesh, Node &output) cons
         index_t elem_offset_start = 0;
 
         // Root needs to update offsets before doing local flatten
-        if(rank == root)
+        if(gather && rank == root)
         {
             // counts stored as [nverts0, nelems0, nverts1, nelems1, ...]
             const index_t *c = global_metadata.counts.data();
@@ -885,16 +914,10 @@ ParallelMeshFlattener::flatten_many_domains(const Node &mesh, Node &output) cons
             }
         }
 
-        index_t vert_offset = vert_offset_start;
-        index_t elem_offset = elem_offset_start;
-        for(index_t i = 0; i < my_mesh_info.ndomains; i++)
-        {
-            DEBUG_PRINT("Rank " << rank << " flattening domain " << i << std::endl);
-            flatten_single_domain(mesh[i], output, global_field_info.field_names,
-                my_mesh_info.domain_ids[i], vert_offset, elem_offset);
-            vert_offset += my_mesh_info.verts_per_domain[i];
-            elem_offset += my_mesh_info.elems_per_domain[i];
-        }
+        DEBUG_PRINT("Rank " << rank << " flattening " << my_mesh_info.ndomains
+            << " domains" << std::endl);
+        flatten_domains(mesh, output, global_field_info.field_names,
+            my_mesh_info, vert_offset_start, elem_offset_start);
 
         if(this->add_rank)
         {
@@ -903,7 +926,10 @@ ParallelMeshFlattener::flatten_many_domains(const Node &mesh, Node &output) cons
         }
     }
 
-    gather_results(my_mesh_info, global_metadata, output);
+    if(gather)
+    {
+        gather_results(my_mesh_info, global_metadata, output);
+    }
 
     cleanup_output(output);
 
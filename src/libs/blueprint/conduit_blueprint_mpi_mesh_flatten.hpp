@@ -102,10 +102,20 @@ protected:
     */
     void gather_global_mesh_metadata(const MeshInfo &my_info, MeshMetaData &out) const;
 
-    void gather_values(int nrows,
-        int *rank_counts,
-        int *rank_offsets,
-        Node &values) const;
+    /**
+    @brief Creates a committed struct type covering rows
+        [vert_offset, vert_offset + nverts) of every vertex column and rows
+        [elem_offset, elem_offset + nelems) of every element column in
+        output, addressed from MPI_BOTTOM. Returns MPI_DATATYPE_NULL when
+        there are no rows.
+    */
+    MPI_Datatype create_rows_type(Node &output,
+        index_t vert_offset, index_t nverts,
+        index_t elem_offset, index_t nelems) const;
+
+    /**
+    @brief Moves every rank's rows into root's output with one MPI_Alltoallw.
+    */
     void gather_results(const MeshInfo &my_info,
         const MeshMetaData &global_meta_data,
         Node &output) const;
@@ -128,6 +138,7 @@ protected:
     int root;
     int rank;
     bool add_rank;
+    bool gather;
 };
 
 }
@@ -14,6 +14,7 @@
 #include "conduit_blueprint_mesh.hpp"
 #include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_blueprint_mpi_mesh.hpp"
+#include "conduit_blueprint_mpi_mesh_exchange.hpp"
 #include "conduit_blueprint_mpi_mesh_parmetis.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
@@ -24,6 +25,7 @@
 #include <parmetis.h>
 
 #include <algorithm>
+#include <cmath>
 #include <unordered_map>
 
 using namespace conduit::blueprint::mesh::utils;
@@ -120,7 +122,6 @@ void generate_global_element_and_vertex_ids(conduit::Node &mesh,
     
     
     int par_rank = conduit::relay::mpi::rank(comm);
-    int par_size = conduit::relay::mpi::size(comm);
 
     index_t local_num_doms = ::conduit::blueprint::mesh::number_of_domains(mesh);
     index_t global_num_doms = number_of_domains(mesh,comm);
@@ -180,16 +181,6 @@ void generate_global_element_and_vertex_ids(conduit::Node &mesh,
     uint64_array local_num_verts_pri = local_info["num_verts_primary"].value();
     std::vector<std::unordered_map<uint64, int64>> dom_shared_nodes(domains.size());
 
-    const int64 local_ndomains = domains.size();
-    int64 global_ndomains;
-    MPI_Allreduce(&local_ndomains, &global_ndomains, 1,
-                  MPI_INT64_T, MPI_SUM, comm);
-
-    // A map of global domain IDs to their rank.
-    std::vector<int64> dom_locs(global_ndomains, INT64_MAX);
-    // A map of local domain IDs to global domain IDs.
-    std::vector<int64> global_domids(domains.size(), -1);
-
     for(size_t local_dom_idx=0; local_dom_idx < domains.size(); local_dom_idx++)
     {
         Node &dom = *domains[local_dom_idx];
@@ -219,10 +210,7 @@ void generate_global_element_and_vertex_ids(conduit::Node &mesh,
                 CONDUIT_ERROR("Specified adjset = \"" << adjset_name
                                 << "\" was not found in adjsets node");
             }
-            // Set up global domain ID maps
             uint64 global_domid = dom["state/domain_id"].to_uint64();
-            dom_locs[global_domid] = par_rank;
-            global_domids[local_dom_idx] = global_domid;
 
             std::unordered_map<uint64, int64>& shared_nodes = dom_shared_nodes[local_dom_idx];
             const Node& dom_aset = dom["adjsets"][adjset_name];
@@ -273,50 +261,21 @@ void generate_global_element_and_vertex_ids(conduit::Node &mesh,
         local_total_num_verts += local_num_verts_pri[local_dom_idx];
     }
 
-    // Reduce to get locations of all domains.
-    MPI_Allreduce(MPI_IN_PLACE, dom_locs.data(), dom_locs.size(),
-                  MPI_INT64_T, MPI_MIN, comm);
-
     // calc per MPI task offsets using 
     // local_total_num_verts
     // local_total_num_eles
-
-    // first count verts
-    Node max_local, max_global;
-    max_local.set(DataType::uint64(par_size));
-    max_global.set(DataType::uint64(par_size));
-
-    uint64_array max_local_vals = max_local.value();
-    uint64_array max_global_vals = max_global.value();
-
-    max_local_vals[par_rank] = local_total_num_verts;
-
-    relay::mpi::max_all_reduce(max_local, max_global, comm);
-
-
-    index_t global_verts_offset = 0;
-    for(index_t i=0; i< par_rank; i++ )
+    // with one exclusive scan of both counts
+    uint64 local_counts[2]  = {local_total_num_verts, local_total_num_eles};
+    uint64 global_offsets[2] = {0, 0};
+    MPI_Exscan(local_counts, global_offsets, 2, MPI_UINT64_T, MPI_SUM, comm);
+    // the result is undefined on rank 0
+    if(par_rank == 0)
     {
-        global_verts_offset += max_global_vals[i];
-    }
-    
-    // reset our buffers 
-    for(index_t i=0; i< par_size; i++ )
-    {
-        max_local_vals[i]  = 0;
-        max_global_vals[i] = 0;
-    }
-
-    // now count eles
-    max_local_vals[par_rank] = local_total_num_eles;
-
-    relay::mpi::max_all_reduce(max_local, max_global, comm);
-
-    index_t global_eles_offset = 0;
-    for(index_t i=0; i< par_rank; i++ )
-    {
-        global_eles_offset += max_global_vals[i];
+        global_offsets[0] = 0;
+        global_offsets[1] = 0;
     }
+    const index_t global_verts_offset = (index_t)global_offsets[0];
+    const index_t global_eles_offset  = (index_t)global_offsets[1];
 
     // we now have our offsets, we can create output fields on each local domain
     for(size_t local_dom_idx=0; local_dom_idx < domains.size(); local_dom_idx++)
@@ -375,169 +334,106 @@ void generate_global_element_and_vertex_ids(conduit::Node &mesh,
 
     if (adjset_name != "")
     {
-        const int TAG_SHARED_NODE_SYNC = 175000000;
-        // map of groups -> global vtx ids
-        std::map<std::set<uint64>, std::vector<uint64>> groups_2_vids;
-        // map of rank -> sends to/recvs from that rank of global vtx ids for
-        // an adjset group
-        std::unordered_map<uint64, std::vector<std::set<uint64>>> pending_sends, pending_recvs;
+        // the lowest domain id of each group numbered its shared vertices,
+        // copy those ids over the marked entries of the other domains
+        AdjsetExchange shared_vids;
+        shared_vids.build(mesh, adjset_name, comm);
+        shared_vids.exchange(mesh, field_prefix + "global_vertex_ids");
+    }
+}
 
-        // 1. First iterate through our local domains to prepare global vtx id
-        //    lists that we control
-        for(size_t local_dom_idx=0; local_dom_idx < domains.size(); local_dom_idx++)
+//-----------------------------------------------------------------------------
+// The field names given by options[key] (a string or a list of strings)
+static std::vector<std::string>
+option_field_names(const Node &options, const std::string &key)
+{
+    std::vector<std::string> names;
+    if(options.has_child(key))
+    {
+        const Node &opt = options[key];
+        if(opt.dtype().is_string())
         {
-            Node &dom = *domains[local_dom_idx];
-            int64 global_domid = global_domids[local_dom_idx];
-            Node &verts_field = dom["fields"][field_prefix + "global_vertex_ids"];
-            int64_array vert_ids_vals = verts_field["values"].value();
-            const Node& dom_aset = dom["adjsets"][adjset_name];
-
-            for (const Node& group : dom_aset["groups"].children())
+            names.push_back(opt.as_string());
+        }
+        else
+        {
+            NodeConstIterator itr = opt.children();
+            while(itr.has_next())
             {
-                uint64_accessor nbr_doms = group["neighbors"].as_uint64_accessor();
-                uint64 min_domain = global_domid;
-                std::set<uint64> sorted_nbrs;
-                sorted_nbrs.insert(global_domid);
-                for (index_t inbr = 0; inbr < nbr_doms.number_of_elements(); inbr++)
-                {
-                    min_domain = std::min(min_domain, nbr_doms[inbr]);
-                    sorted_nbrs.insert(nbr_doms[inbr]);
-                }
-
-                uint64_accessor group_verts = group["values"].as_uint64_accessor();
-                if (static_cast<int64>(min_domain) == global_domid)
-                {
-                    // This domain provides the actual vids
-                    std::vector<uint64> actual_vids(group_verts.number_of_elements());
-                    for (index_t ivert = 0; ivert < group_verts.number_of_elements(); ivert++)
-                    {
-                        actual_vids[ivert] = vert_ids_vals[group_verts[ivert]];
-                    }
-                    if (groups_2_vids.count(sorted_nbrs) > 0)
-                    {
-                        CONDUIT_ERROR("Multiple primary domains?");
-                    }
-                    groups_2_vids[sorted_nbrs] = std::move(actual_vids);
-
-                    // If any neighbor domains are off-rank, we need to send
-                    // our global vids to those ranks.
-                    for (uint64 nbr_dom : sorted_nbrs)
-                    {
-                        if (static_cast<int64>(nbr_dom) == global_domid)
-                        {
-                            // skip source domain
-                            continue;
-                        }
-                        const uint64 dst_rank = dom_locs[nbr_dom];
-                        if (static_cast<uint64>(par_rank) != dst_rank)
-                        {
-                            pending_sends[dst_rank].push_back(sorted_nbrs);
-                        }
-                    }
-                }
-                else
-                {
-                    // We need primary domain data, which might not yet exist
-                    // on this rank. Prepare irecv if necessary.
-                    const uint64 src_rank = dom_locs[min_domain];
-
-                    if (static_cast<uint64>(par_rank) != src_rank)
-                    {
-                        pending_recvs[src_rank].push_back(sorted_nbrs);
-                        groups_2_vids[sorted_nbrs].resize(group_verts.number_of_elements());
-                    }
-                }
+                names.push_back(itr.next().as_string());
             }
         }
+    }
+    return names;
+}
 
-        // 2. Do required communication asynchronously.
-        std::vector<MPI_Request> async_sends, async_recvs;
-        for (auto& it : pending_recvs)
+//-----------------------------------------------------------------------------
+// Appends the elements of topo to ParMETIS' element to vertex CSR (eptr,
+// eind) as global vertex ids, and for each field of vert_weights the mean
+// of the field over the element's vertices to elem_vert_weights. Single
+// shape unstructured topologies are read straight from their connectivity.
+static void
+append_parmetis_elements(const Node &topo,
+                         const int64_accessor &global_vert_ids,
+                         const std::vector<float64_accessor> &vert_weights,
+                         std::vector<idx_t> &eptr,
+                         std::vector<idx_t> &eind,
+                         std::vector<std::vector<float64>> &elem_vert_weights)
+{
+    const size_t num_vert_weights = vert_weights.size();
+    std::vector<float64> sums(num_vert_weights, 0.0);
+    index_t elem_size = 0;
+
+    auto add_vertex = [&](index_t vert_id)
+    {
+        eind.push_back((idx_t)global_vert_ids[vert_id]);
+        for(size_t wi = 0; wi < num_vert_weights; wi++)
         {
-            const uint64 rank_from = it.first;
-            std::vector<std::set<uint64>>& recv_groups = it.second;
-            // Sort the groups to receive first. This gives us a consistent
-            // ordering of isends/irecvs
-            std::sort(recv_groups.begin(), recv_groups.end());
-
-            int group_idx = 0;
-            for (const std::set<uint64>& group : recv_groups)
-            {
-                index_t domid = *(group.begin());
-                const int tag = TAG_SHARED_NODE_SYNC + domid * 100 + group_idx;
-                async_recvs.push_back(MPI_Request{});
-                group_idx++;
-                std::vector<uint64>& recvbuf = groups_2_vids[group];
-                MPI_Irecv(recvbuf.data(), recvbuf.size(), MPI_UINT64_T,
-                          rank_from, tag, comm, &(*async_recvs.rbegin()));
-            }
+            sums[wi] += vert_weights[wi][vert_id];
         }
-        for (auto& it : pending_sends)
+        elem_size++;
+    };
+    auto end_element = [&]()
+    {
+        eptr.push_back((idx_t)eind.size());
+        for(size_t wi = 0; wi < num_vert_weights; wi++)
         {
-            const uint64 rank_to = it.first;
-            std::vector<std::set<uint64>>& send_groups = it.second;
-            // Sort the groups to send first. This gives us a consistent
-            // ordering of isends/irecvs
-            std::sort(send_groups.begin(), send_groups.end());
-
-            int group_idx = 0;
-            for (const std::set<uint64>& group : send_groups)
+            elem_vert_weights[wi].push_back(elem_size > 0 ? sums[wi] / elem_size : 0.0);
+            sums[wi] = 0.0;
+        }
+        elem_size = 0;
+    };
+
+    const ShapeType shape(topo);
+    if(topo["type"].as_string() == "unstructured" &&
+       topo["elements"].has_child("shape") &&
+       !topo["elements"].has_child("shape_map") &&
+       shape.is_valid() && !shape.is_poly())
+    {
+        const index_t_accessor conn = topo["elements/connectivity"].value();
+        const index_t num_elems = conn.number_of_elements() / shape.indices;
+        eind.reserve(eind.size() + num_elems * shape.indices);
+        eptr.reserve(eptr.size() + num_elems);
+        index_t ci = 0;
+        for(index_t ei = 0; ei < num_elems; ei++)
+        {
+            for(index_t vi = 0; vi < shape.indices; vi++)
             {
-                index_t domid = *(group.begin());
-                const int tag = TAG_SHARED_NODE_SYNC + domid * 100 + group_idx;
-                async_sends.push_back(MPI_Request{});
-                group_idx++;
-                const std::vector<uint64>& sendbuf = groups_2_vids[group];
-                MPI_Isend(sendbuf.data(), sendbuf.size(), MPI_UINT64_T,
-                          rank_to, tag, comm, &(*async_sends.rbegin()));
+                add_vertex(conn[ci++]);
             }
+            end_element();
         }
-        std::vector<MPI_Status> async_recv_statuses(async_recvs.size());
-        // Make sure all our irecvs have completed
-        MPI_Waitall(async_recvs.size(), async_recvs.data(), async_recv_statuses.data());
-
-        // 3. Finally, iterate through our local domains to remap any vertices
-        //    that have been numbered by another domain.
-        for(size_t local_dom_idx=0; local_dom_idx < domains.size(); local_dom_idx++)
+    }
+    else
+    {
+        topology::iterate_elements(topo, [&](const topology::entity &e)
         {
-            Node &dom = *domains[local_dom_idx];
-            int64 global_domid = global_domids[local_dom_idx];
-            Node &verts_field = dom["fields"][field_prefix + "global_vertex_ids"];
-            int64_array vert_ids_vals = verts_field["values"].value();
-            const Node& dom_aset = dom["adjsets"][adjset_name];
-
-            for (const Node& group : dom_aset["groups"].children())
+            for(size_t i = 0; i < e.element_ids.size(); i++)
             {
-                uint64_accessor nbr_doms = group["neighbors"].as_uint64_accessor();
-                uint64 min_domain = global_domid;
-                std::set<uint64> sorted_nbrs;
-                sorted_nbrs.insert(global_domid);
-                for (index_t inbr = 0; inbr < nbr_doms.number_of_elements(); inbr++)
-                {
-                    min_domain = std::min(min_domain, nbr_doms[inbr]);
-                    sorted_nbrs.insert(nbr_doms[inbr]);
-                }
-
-                uint64_accessor group_verts = group["values"].as_uint64_accessor();
-                if ( static_cast<int64>(min_domain) != global_domid)
-                {
-                    // Remap higher-numbered domains with primary domain's
-                    // assigned global vtx ids
-                    const std::vector<uint64>& actual_vids = groups_2_vids[sorted_nbrs];
-                    if (static_cast<index_t>(actual_vids.size()) != group_verts.number_of_elements())
-                    {
-                        CONDUIT_ERROR("mismatch in shared verts");
-                    }
-                    for (index_t ivert = 0; ivert < static_cast<index_t>(actual_vids.size()); ivert++)
-                    {
-                        vert_ids_vals[group_verts[ivert]] = actual_vids[ivert];
-                    }
-                }
+                add_vertex(e.element_ids[i]);
             }
-        }
-        std::vector<MPI_Status> async_send_statuses(async_sends.size());
-        // Make sure all our isends have completed
-        MPI_Waitall(async_sends.size(), async_sends.data(), async_send_statuses.data());
+            end_element();
+        });
     }
 }
 
@@ -558,8 +454,8 @@ void generate_partition_field(conduit::Node &mesh,
                                            options,
                                            comm);
 
-    int par_rank = conduit::relay::mpi::rank(comm);
     int par_size = conduit::relay::mpi::size(comm);
+    int par_rank = conduit::relay::mpi::rank(comm);
 
     index_t global_num_doms = number_of_domains(mesh,comm);
 
@@ -627,134 +523,220 @@ void generate_partition_field(conduit::Node &mesh,
     // the total number of element to vers entries
 
 
-    index_t local_total_num_eles =0;
-    index_t local_total_ele_to_verts_size = 0;
-    
+    // the weight of each element for each balance constraint, taken from
+    // element fields or averaged from vertex fields
+    const std::vector<std::string> elem_weight_names = option_field_names(options, "element_weights");
+    const std::vector<std::string> vert_weight_names = option_field_names(options, "vertex_weights");
+    const idx_t num_elem_weights = (idx_t)elem_weight_names.size();
+    idx_t ncon = num_elem_weights + (idx_t)vert_weight_names.size();
+
+    // repartitioning starts from the partition the elements are in now,
+    // from a field or the rank that holds them
+    const bool repartition = options.has_child("repartition") &&
+                             options["repartition"].to_int() != 0;
+    std::string current_partition_name = "";
+    if(options.has_child("current_partition"))
+    {
+        current_partition_name = options["current_partition"].as_string();
+    }
+    real_t repartition_itr = 1000.0;
+    if(options.has_child("repartition_itr"))
+    {
+        repartition_itr = (real_t)options["repartition_itr"].to_float64();
+    }
+    const idx_t rank_part = (idx_t)((int64)par_rank * nparts / par_size);
+
+    // we now have global element and vertex ids
+    // we just need to traverse our topo to convert this info to parmetis
+    // input: eptr, the offsets of each element's vertex list, and eind, the
+    // global vertex ids of the element's vertices. eind can't view the
+    // connectivity (it holds global ids), so both are filled in one pass.
+    std::vector<idx_t> eptr(1, 0);
+    std::vector<idx_t> eind;
+    std::vector<std::vector<float64>> elem_weights(ncon);
+    std::vector<idx_t> cur_part;
+    std::string error_msg = "";
     for(size_t local_dom_idx=0; local_dom_idx < domains.size(); local_dom_idx++)
     {
         Node &dom = *domains[local_dom_idx];
         // we do need to make sure we have the requested topo
-        if(dom["topologies"].has_child(topo_name))
+        if(!dom["topologies"].has_child(topo_name))
         {
-            // get the topo node
-            const Node &dom_topo = dom["topologies"][topo_name];
-            // get the number of elements in the topo
-            local_total_num_eles += blueprint::mesh::utils::topology::length(dom_topo);
+            continue;
+        }
+
+        // get the topo node
+        const Node &dom_topo = dom["topologies"][topo_name];
+        const index_t dom_num_eles = blueprint::mesh::utils::topology::length(dom_topo);
 
-            topology::iterate_elements(dom_topo, [&](const topology::entity &e)
+        // check and view the weight fields
+        std::vector<Node> weight_values(ncon);
+        for(idx_t ci = 0; ci < ncon; ci++)
+        {
+            const bool is_elem = ci < num_elem_weights;
+            const std::string &weight_name = is_elem ? elem_weight_names[ci] :
+                vert_weight_names[ci - num_elem_weights];
+            if(!dom.has_child("fields") || !dom["fields"].has_child(weight_name))
+            {
+                error_msg = "weight field \"" + weight_name + "\" is missing";
+                continue;
+            }
+            const Node &field = dom["fields"][weight_name];
+            if(field["association"].as_string() != (is_elem ? "element" : "vertex") ||
+               field["topology"].as_string() != topo_name)
             {
-                local_total_ele_to_verts_size += e.element_ids.size();
-            });
+                error_msg = "weight field \"" + weight_name + "\" is not " +
+                    (is_elem ? "an element" : "a vertex") + " field of topology \"" +
+                    topo_name + "\"";
+                continue;
+            }
+            if(!field["values"].dtype().is_number())
+            {
+                error_msg = "weight field \"" + weight_name + "\" does not have "
+                            "a single value per entry";
+                continue;
+            }
+            field["values"].to_float64_array(weight_values[ci]);
+            if(is_elem && weight_values[ci].dtype().number_of_elements() != dom_num_eles)
+            {
+                error_msg = "weight field \"" + weight_name + "\" does not have "
+                            "one value per element";
+            }
+        }
+        if(!error_msg.empty())
+        {
+            continue;
+        }
 
+        if(repartition && current_partition_name.empty())
+        {
+            cur_part.insert(cur_part.end(), (size_t)dom_num_eles, rank_part);
+        }
+        else if(repartition)
+        {
+            if(!dom.has_child("fields") || !dom["fields"].has_child(current_partition_name))
+            {
+                error_msg = "current partition field \"" + current_partition_name + "\" is missing";
+                continue;
+            }
+            const Node &field = dom["fields"][current_partition_name];
+            if(field["association"].as_string() != "element" ||
+               field["topology"].as_string() != topo_name ||
+               !field["values"].dtype().is_number() ||
+               field["values"].dtype().number_of_elements() != dom_num_eles)
+            {
+                error_msg = "current partition field \"" + current_partition_name +
+                            "\" does not have one value per element of topology \"" +
+                            topo_name + "\"";
+                continue;
+            }
+            const index_t_accessor vals = field["values"].as_index_t_accessor();
+            for(index_t ei = 0; ei < dom_num_eles; ei++)
+            {
+                if(vals[ei] < 0 || vals[ei] >= (index_t)nparts)
+                {
+                    error_msg = "current partition field \"" + current_partition_name +
+                                "\" has values outside of [0, partitions)";
+                    break;
+                }
+                cur_part.push_back((idx_t)vals[ei]);
+            }
+            if(!error_msg.empty())
+            {
+                continue;
+            }
         }
-    }
 
-    // reminder:
-    // idx_t eldist[] = {0, 3, 4};
-    //
-    // idx_t eptr[] = {0,4,8,12};
-    //
-    // idx_t eind[] = {0,1,3,4,
-    //                        1,2,4,5,
-    //                        3,4,6,7};
+        for(idx_t ci = 0; ci < num_elem_weights; ci++)
+        {
+            const float64 *vals = weight_values[ci].as_float64_ptr();
+            elem_weights[ci].insert(elem_weights[ci].end(), vals, vals + dom_num_eles);
+        }
+        std::vector<float64_accessor> vert_weights;
+        std::vector<std::vector<float64>> elem_vert_weights(ncon - num_elem_weights);
+        for(idx_t ci = num_elem_weights; ci < ncon; ci++)
+        {
+            vert_weights.push_back(weight_values[ci].as_float64_accessor());
+        }
 
-    Node parmetis_params;
-    // eldist tells how many elements there are per mpi task,
-    // it will be size par_size + 1
-    parmetis_params["eldist"].set(DataType(metis_idx_t_to_conduit_dtype_id(),
-                                           par_size+1));
-    // eptr holds the offsets to the start of each element's
-    // vertex list
-    // size == total number of local elements (we counted this above)
-    parmetis_params["eptr"].set(DataType(metis_idx_t_to_conduit_dtype_id(),
-                                         local_total_num_eles+1));
-    // eind holds, for each element, a list of vertex ids
-    // (we also counted this above)
-    parmetis_params["eind"].set(DataType(metis_idx_t_to_conduit_dtype_id(),
-                                         local_total_ele_to_verts_size));
+        const Node &dom_g_vert_ids = dom["fields"][field_prefix + "global_vertex_ids"]["values"];
+        append_parmetis_elements(dom_topo, dom_g_vert_ids.as_int64_accessor(),
+                                 vert_weights, eptr, eind, elem_vert_weights);
+        for(idx_t ci = num_elem_weights; ci < ncon; ci++)
+        {
+            std::vector<float64> &dest = elem_weights[ci];
+            const std::vector<float64> &src = elem_vert_weights[ci - num_elem_weights];
+            dest.insert(dest.end(), src.begin(), src.end());
+        }
+    }
+    const index_t local_total_num_eles = (index_t)eptr.size() - 1;
 
-    // output array, size of local num elements
-    parmetis_params["part"].set(DataType(metis_idx_t_to_conduit_dtype_id(),
-                                         local_total_num_eles));
+    // ParMETIS takes integer weights, interleaved per element
+    std::vector<idx_t> elmwgt((size_t)(ncon * local_total_num_eles));
+    for(idx_t ci = 0; ci < ncon && error_msg.empty(); ci++)
+    {
+        for(index_t ei = 0; ei < local_total_num_eles; ei++)
+        {
+            const float64 weight = elem_weights[ci][ei];
+            if(!(weight >= 0.0))
+            {
+                error_msg = "weights must not be negative";
+                break;
+            }
+            elmwgt[ei * ncon + ci] = (idx_t)std::llround(weight);
+        }
+    }
 
+    // all ranks fail together, before any of them enters ParMETIS
+    int local_bad = error_msg.empty() ? 0 : 1;
+    int global_bad = 0;
+    MPI_Allreduce(&local_bad, &global_bad, 1, MPI_INT, MPI_MAX, comm);
+    if(global_bad > 0)
+    {
+        CONDUIT_ERROR("generate_partition_field: "
+                      << (error_msg.empty() ? std::string("invalid weights on another rank")
+                                            : error_msg));
+    }
 
-    // first lets get eldist setup:
-    // eldist[0] = 0,\
-    // eldist[1] == # of elements on rank 0-
+    // eldist tells how many elements there are per mpi task,
+    // it will be size par_size + 1:
+    // eldist[0] = 0,
+    // eldist[1] == # of elements on rank 0
     // eldist[2] == # of elemens on rank 0 + rank 1
     //    ...
     // eldist[n] == # of total elements
-    //
-    Node el_counts;
-    el_counts["local"]  = DataType(metis_idx_t_to_conduit_dtype_id(),
-                                   par_size);
-    el_counts["global"] = DataType(metis_idx_t_to_conduit_dtype_id(),
-                                   par_size);
-
-    idx_t *el_counts_local_vals  = el_counts["local"].value();
-    idx_t *el_counts_global_vals = el_counts["global"].value();
-    el_counts_local_vals[par_rank] = local_total_num_eles;
-    relay::mpi::max_all_reduce(el_counts["local"], el_counts["global"], comm);
-
-    // prefix sum to set eldist
-    idx_t *eldist_vals = parmetis_params["eldist"].value();
-    eldist_vals[0] = 0;
+    std::vector<idx_t> eldist(par_size + 1, 0);
+    idx_t local_num_eles_idx = (idx_t)local_total_num_eles;
+    MPI_Allgather(&local_num_eles_idx, 1, (sizeof(idx_t) == 8) ? MPI_INT64_T : MPI_INT32_T,
+                  eldist.data() + 1, 1, (sizeof(idx_t) == 8) ? MPI_INT64_T : MPI_INT32_T,
+                  comm);
     for(size_t i=0;i<(size_t)par_size;i++)
     {
-        eldist_vals[i+1] =  eldist_vals[i] + el_counts_global_vals[i];
+        eldist[i+1] += eldist[i];
     }
 
-    idx_t *eptr_vals = parmetis_params["eptr"].value();
-    idx_t *eind_vals = parmetis_params["eind"].value();
-
-    // now elptr  == prefix sum of the sizes
-    // (note: the offsets don't matter for elptr b/c we are creating a compact
-    //  rep for parmetis)
-    //
-    // and eind == look up of global vertex id
-    size_t eptr_idx=0;
-    size_t eind_idx=0;
-    idx_t  curr_offset = 0;
-    for(size_t local_dom_idx=0; local_dom_idx < domains.size(); local_dom_idx++)
+    idx_t wgtflag = (ncon > 0) ? 2 : 0; // weights on the elements, or NULL
+    idx_t numflag = 0; // C-style numbering
+    if(ncon == 0)
     {
-        Node &dom = *domains[local_dom_idx];
-        // we do need to make sure we have the requested topo
-        if(dom["topologies"].has_child(topo_name))
+        ncon = 1; // the number of weights per vertex
+    }
+    // equal weights for each proc, for every constraint
+    std::vector<real_t> tpwgts(nparts * ncon, 1.0/nparts);
+    // the allowed imbalance of each constraint
+    std::vector<real_t> ubvec(ncon, 1.05);
+    if(options.has_child("imbalance"))
+    {
+        Node n_imbalance;
+        options["imbalance"].to_float64_array(n_imbalance);
+        const float64_accessor imbalance = n_imbalance.as_float64_accessor();
+        for(idx_t ci = 0; ci < ncon && imbalance.number_of_elements() > 0; ci++)
         {
-            // get the topo node
-            Node &dom_topo = dom["topologies"][topo_name];
-
-            topology::iterate_elements(dom_topo, [&](const topology::entity &e)
-            {
-                eptr_vals[eptr_idx] = curr_offset;
-                curr_offset += e.element_ids.size();
-                eptr_idx++;
-            });
-
-            // add last offset
-            eptr_vals[eptr_idx] = curr_offset;
-
-            const Node &dom_g_vert_ids = dom["fields"][field_prefix + "global_vertex_ids"]["values"];
-            int64_accessor global_vert_ids = dom_g_vert_ids.as_int64_accessor();
-
-            blueprint::mesh::utils::topology::iterate_elements(dom_topo, [&](const blueprint::mesh::utils::topology::entity &e)
-            {
-                for(size_t i=0;i< e.element_ids.size();i++)
-                {
-                    eind_vals[eind_idx] = (idx_t) global_vert_ids[e.element_ids[i]];
-                    eind_idx++;
-                }
-            });
+            ubvec[ci] = (real_t)imbalance[std::min((index_t)ci,
+                imbalance.number_of_elements() - 1)];
         }
     }
 
-    idx_t wgtflag = 0; // weights are NULL
-    idx_t numflag = 0; // C-style numbering
-    idx_t ncon = 1; // the number of weights per vertex
-    // equal weights for each proc
-    std::vector<real_t> tpwgts(nparts, 1.0/nparts);
-    real_t ubvec = 1.050000;
-
     // options == extra output
     idx_t parmetis_opts[] = {1,
                        PARMETIS_DBGLVL_TIME |
@@ -769,30 +751,82 @@ void generate_partition_field(conduit::Node &mesh,
     idx_t edgecut = 0; // will hold # of cut edges
 
     // output array, size of local num elements
-    parmetis_params["part"].set(DataType(metis_idx_t_to_conduit_dtype_id(),
-                                         local_total_num_eles));
-    idx_t *part_vals = parmetis_params["part"].value();
-
-    int parmetis_res = ParMETIS_V3_PartMeshKway(eldist_vals,
-                                                eptr_vals,
-                                                eind_vals,
-                                                NULL,
-                                                &wgtflag,
-                                                &numflag,
-                                                &ncon,
-                                                &ncommonnodes,
-                                                &nparts,
-                                                tpwgts.data(),
-                                                &ubvec,
-                                                parmetis_opts,
-                                                &edgecut,
-                                                part_vals,
-                                                &comm);
-
-    if( parmetis_res == METIS_ERROR )
-    {
-        // TODO: Should this be a full Error?
-        CONDUIT_INFO("ParMETIS_V3_PartMeshKway call failed!");
+    std::vector<idx_t> part_vals(local_total_num_eles);
+
+    if(!repartition)
+    {
+        int parmetis_res = ParMETIS_V3_PartMeshKway(eldist.data(),
+                                                    eptr.data(),
+                                                    eind.data(),
+                                                    wgtflag == 0 ? NULL : elmwgt.data(),
+                                                    &wgtflag,
+                                                    &numflag,
+                                                    &ncon,
+                                                    &ncommonnodes,
+                                                    &nparts,
+                                                    tpwgts.data(),
+                                                    ubvec.data(),
+                                                    parmetis_opts,
+                                                    &edgecut,
+                                                    part_vals.data(),
+                                                    &comm);
+
+        if( parmetis_res == METIS_ERROR )
+        {
+            // TODO: Should this be a full Error?
+            CONDUIT_INFO("ParMETIS_V3_PartMeshKway call failed!");
+        }
+    }
+    else
+    {
+        // AdaptiveRepart works on the dual graph of the mesh and balances
+        // the cut against the number of elements that leave their current
+        // partition, which is passed in part_vals
+        idx_t *xadj = NULL;
+        idx_t *adjncy = NULL;
+        int parmetis_res = ParMETIS_V3_Mesh2Dual(eldist.data(),
+                                                 eptr.data(),
+                                                 eind.data(),
+                                                 &numflag,
+                                                 &ncommonnodes,
+                                                 &xadj,
+                                                 &adjncy,
+                                                 &comm);
+        if( parmetis_res == METIS_ERROR )
+        {
+            CONDUIT_INFO("ParMETIS_V3_Mesh2Dual call failed!");
+        }
+        else
+        {
+            part_vals = cur_part;
+            idx_t repart_opts[] = {1,
+                                   parmetis_opts[1],
+                                   0,
+                                   PARMETIS_PSR_UNCOUPLED};
+            parmetis_res = ParMETIS_V3_AdaptiveRepart(eldist.data(),
+                                                      xadj,
+                                                      adjncy,
+                                                      wgtflag == 0 ? NULL : elmwgt.data(),
+                                                      NULL,
+                                                      NULL,
+                                                      &wgtflag,
+                                                      &numflag,
+                                                      &ncon,
+                                                      &nparts,
+                                                      tpwgts.data(),
+                                                      ubvec.data(),
+                                                      &repartition_itr,
+                                                      repart_opts,
+                                                      &edgecut,
+                                                      part_vals.data(),
+                                                      &comm);
+            if( parmetis_res == METIS_ERROR )
+            {
+                CONDUIT_INFO("ParMETIS_V3_AdaptiveRepart call failed!");
+            }
+        }
+        METIS_Free(xadj);
+        METIS_Free(adjncy);
     }
 
     index_t part_vals_idx=0;
@@ -56,6 +56,36 @@ void CONDUIT_BLUEPRINT_API generate_partition_field(conduit::Node &mesh,
 /// opts:
 ///      partitions:  # of partitions to use (integer) 
 ///         (default ==> # of MPI Tasks)
+///      topology: name of the topology to partition (string)
+///         (default ==> the first topology)
+///      field_prefix: prefix for the output field names (string)
+///         (default ==> "")
+///      adjset: name of an adjset used to number shared vertices (string)
+///         (default ==> none, vertices are matched by coordinates)
+///      parmetis_ncommonnodes: # of vertices two elements must share to be
+///         neighbors in the dual graph (integer)
+///         (default ==> # of coordset dimensions)
+///      element_weights: name(s) of element fields whose values are the
+///         weights of each element (string or list of strings)
+///      vertex_weights: name(s) of vertex fields, each adds a constraint
+///         weighted by the mean value of the vertices of each element
+///         (string or list of strings)
+///      imbalance: allowed load imbalance of each constraint (number or
+///         list of numbers, the last value is used for the rest)
+///         (default ==> 1.05)
+///      repartition: when non-zero, improve the current partition with
+///         ParMETIS_V3_AdaptiveRepart instead of partitioning from scratch,
+///         trading edge cut against the elements that change partition
+///         (integer) (default ==> 0)
+///      current_partition: name of an element field holding the current
+///         partition of each element, used with repartition (string)
+///         (default ==> rank * partitions / # of MPI Tasks)
+///      repartition_itr: ratio of the cost of communication to the cost of
+///         moving data, used with repartition (number)
+///         (default ==> 1000.0)
+///
+///      Each weight field adds one balance constraint, element fields first.
+///      Weights are rounded to integers and must not be negative.
 //-------------------------------------------------------------------------
 void CONDUIT_BLUEPRINT_API generate_partition_field(conduit::Node &mesh,
                                                     const conduit::Node &opts,
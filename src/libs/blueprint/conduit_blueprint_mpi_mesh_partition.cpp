@@ -21,7 +21,10 @@
 #include "conduit_fmt/conduit_fmt.h"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <numeric>
+#include <set>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -274,6 +277,31 @@ ParallelPartitioner::get_largest_selection(int &sel_rank, int &sel_index) const
     }
 }
 
+//---------------------------------------------------------------------------
+void
+ParallelPartitioner::reduce_sfc_bounds(float64 bounds[6]) const
+{
+    MPI_Allreduce(MPI_IN_PLACE, bounds, 3, MPI_DOUBLE, MPI_MIN, comm);
+    MPI_Allreduce(MPI_IN_PLACE, bounds + 3, 3, MPI_DOUBLE, MPI_MAX, comm);
+}
+
+//---------------------------------------------------------------------------
+/**
+ @note The splitters of a global sfc selection are found by bisection over
+       the key values, so the keys are sorted across ranks by summing the
+       counts of local keys below each candidate splitter. Each pass of the
+       bisection is one reduction over all splitters.
+ */
+void
+ParallelPartitioner::reduce_sfc_counts(std::vector<uint64> &counts) const
+{
+    if(!counts.empty())
+    {
+        MPI_Allreduce(MPI_IN_PLACE, counts.data(), static_cast<int>(counts.size()),
+                      MPI_UINT64_T, MPI_SUM, comm);
+    }
+}
+
 //-------------------------------------------------------------------------
 void
 ParallelPartitioner::create_chunk_info_dt()
@@ -517,10 +545,55 @@ ParallelPartitioner::map_chunks(const std::vector<Partitioner::Chunk> &chunks,
             rank_elem_counts[dest_rank[i]] += global_chunk_info[i].num_elements;
         }
     }
+
+    if(minimize_migration && !domains_to_assign.empty())
+    {
+        // Count the elements of each domain that already live on each rank.
+        // The chunks made on rank r are numbered from _offsets[r].
+        std::map<std::pair<int,int>, uint64> resident;
+        int src = 0;
+        for(int i = 0; i < ntotal_chunks; i++)
+        {
+            while(src + 1 < size && i >= _offsets[src + 1])
+                src++;
+            if(dest_rank[i] == Selection::FREE_RANK_ID)
+                resident[std::make_pair(dest_domain[i], src)] += global_chunk_info[i].num_elements;
+        }
+
+        // Keep the domains where most of their elements are, largest
+        // resident counts first, while no rank gets more than its share.
+        std::vector<std::pair<uint64, std::pair<int,int>>> candidates;
+        for(const auto &r : resident)
+            candidates.push_back(std::make_pair(r.second, r.first));
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [](const std::pair<uint64, std::pair<int,int>> &a,
+               const std::pair<uint64, std::pair<int,int>> &b)
+            {
+                return a.first > b.first;
+            });
+        const int max_per_rank = (static_cast<int>(domains_to_assign.size()) + size - 1) / size;
+        std::vector<int> rank_num_domains(size, 0);
+        for(const auto &c : candidates)
+        {
+            int domid = c.second.first;
+            int r = c.second.second;
+            if(domains_to_assign.find(domid) == domains_to_assign.end() ||
+               rank_num_domains[r] >= max_per_rank)
+                continue;
+
+            rank_num_domains[r]++;
+            rank_elem_counts[r] += domain_elem_counts[domid];
+            for(int i = 0; i < ntotal_chunks; i++)
+            {
+                if(dest_domain[i] == domid)
+                    dest_rank[i] = r;
+            }
+            domains_to_assign.erase(domid);
+        }
+    }
 #if 1
-    // NOTE: This could be better. We could try to minimize communication
-    //       by keeping domains where they are if possible while also
-    //       trying to keep things balanced.
+    // NOTE: The minimize_migration option keeps domains where they are
+    //       when it can, otherwise we only try to keep things balanced.
 
     // Add domains to ranks largest to smallest. This should
     // make smaller domains group together on a rank to some extent.
@@ -587,7 +660,8 @@ ParallelPartitioner::communicate_chunks(const std::vector<Partitioner::Chunk> &c
     const std::vector<int> &offsets,
     std::vector<Partitioner::Chunk> &chunks_to_assemble,
     std::vector<int> &chunks_to_assemble_domains,
-    std::vector<int> &chunks_to_assemble_gids)
+    std::vector<int> &chunks_to_assemble_gids,
+    const ChunksReady &chunks_ready)
 {
     const int PARTITION_TAG_BASE = 12000;
 
@@ -641,7 +715,10 @@ ParallelPartitioner::communicate_chunks(const std::vector<Partitioner::Chunk> &c
         }
     }
 
-    // Do recvs.
+    // Do recvs. ready holds the chunks this rank already has, recv_index
+    // the place of each received chunk in chunks_to_assemble.
+    std::vector<size_t> ready;
+    std::map<conduit::Node*,size_t> recv_index;
 #ifdef RENUMBER_DOMAINS
     std::map<conduit::Node*,int> node_domains;
 #endif
@@ -677,11 +754,13 @@ ParallelPartitioner::communicate_chunks(const std::vector<Partitioner::Chunk> &c
                 (*n_recv)["state/domain_id"] = dest_domain[i];
 
                 // Save the chunk "wrapper" that has its own state.
+                ready.push_back(chunks_to_assemble.size());
                 chunks_to_assemble.push_back(Chunk(n_recv, true));
                 chunks_to_assemble_domains.push_back(dest_domain[i]);
                 chunks_to_assemble_gids.push_back(gidx);
 #else
                 // Pass the chunk through since we already own it on this rank.
+                ready.push_back(chunks_to_assemble.size());
                 chunks_to_assemble.push_back(Chunk(chunks[local_i].mesh, false));
                 chunks_to_assemble_domains.push_back(dest_domain[i]);
                 chunks_to_assemble_gids.push_back(gidx);
@@ -701,6 +780,7 @@ ParallelPartitioner::communicate_chunks(const std::vector<Partitioner::Chunk> &c
                 node_domains[n_recv] = dest_domain[i];
 #endif
                 // Save the received chunk and indicate we own it for later.
+                recv_index[n_recv] = chunks_to_assemble.size();
                 chunks_to_assemble.push_back(Chunk(n_recv, true));
                 chunks_to_assemble_domains.push_back(dest_domain[i]);
                 chunks_to_assemble_gids.push_back(gidx);
@@ -708,17 +788,25 @@ ParallelPartitioner::communicate_chunks(const std::vector<Partitioner::Chunk> &c
         }
     }
 
-    // Execute all of the isends/irecvs
-    C.execute();
-
-#ifdef RENUMBER_DOMAINS
-    // Make another pass through the received domains and renumber them.
-    for(auto it : node_domains)
+    // Start the isends/irecvs. The chunks this rank already has are ready
+    // now, the others as they arrive, so domains can be assembled while
+    // chunks for other domains are still in flight.
+    C.start();
+    chunks_ready(ready);
+    std::vector<conduit::Node *> received;
+    while(C.wait_some(received))
     {
-        conduit::Node &n = *it.first;
-        n["state/domain_id"] = it.second;
-    }
+        ready.clear();
+        for(conduit::Node *n : received)
+        {
+#ifdef RENUMBER_DOMAINS
+            (*n)["state/domain_id"] = node_domains[n];
 #endif
+            ready.push_back(recv_index[n]);
+        }
+        chunks_ready(ready);
+    }
+    C.finish();
 }
 
 //-----------------------------------------------------------------------------
@@ -803,112 +891,97 @@ ParallelPartitioner::get_prelb_adjset_maps(const std::vector<int>& chunk_offsets
 void
 ParallelPartitioner::communicate_mapback(std::unordered_map<index_t, Node>& packed_fields)
 {
-    // Get source ranks for domains homed on this processor
-    std::unordered_map<index_t, std::vector<index_t>> dom_to_recv_rnk;
+    // Gather the chunks bound for each rank into one message:
+    //   - domain: original domain id
+    //     chunks: [chunk0, chunk1, ...]
+    std::vector<Node> snd_msgs(size);
+    for (auto& dom_field : packed_fields)
     {
-        // Get number of outgoing chunks
-        int64 nchunks = packed_fields.size();
-        std::vector<int> cnks_per_proc(size, 0);
-        cnks_per_proc[rank] = nchunks;
-        MPI_Allgather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
-                      cnks_per_proc.data(), 1, MPI_INT, comm);
-
-        int64 ncnks = std::accumulate(cnks_per_proc.begin(),
-                                      cnks_per_proc.end(), 0);
-        std::vector<int> displs(size, 0);
-        for (int irnk = 1; irnk < size; irnk++)
+        const int tgt_rank = domain_to_rank_map[dom_field.first];
+        if (tgt_rank != rank)
         {
-            displs[irnk] = displs[irnk - 1] + cnks_per_proc[irnk - 1];
+            Node& entry = snd_msgs[tgt_rank].append();
+            entry["domain"] = static_cast<int64>(dom_field.first);
+            entry["chunks"].set_external(dom_field.second);
         }
+    }
 
-        std::vector<int64> all_doms(ncnks, -1), all_src_rnks(ncnks, -1);
-        // We'll allgather corresponding domain ids and source ranks from each
-        // processor
-        size_t offset = displs[rank];
-        for (const auto& dom_field : packed_fields)
-        {
-            index_t tgt_domain = dom_field.first;
-            all_doms[offset] = tgt_domain;
-            all_src_rnks[offset] = rank;
-            offset++;
-        }
-        size_t expected_max = (rank + 1 == size) ? ncnks : displs[rank + 1];
-        if (offset != expected_max)
+    // Pack each message as: int64 schema length, binary schema (padded to
+    // 8 bytes), compact data.
+    std::vector<int> snd_sizes(size, 0), snd_displs(size, 0);
+    std::vector<uint8> snd_buffer;
+    for (int irnk = 0; irnk < size; irnk++)
+    {
+        snd_displs[irnk] = static_cast<int>(snd_buffer.size());
+        const Node& msg = snd_msgs[irnk];
+        if (msg.number_of_children() == 0)
         {
-            CONDUIT_ERROR(
-              conduit_fmt::format("Displacement error: (rank = {} offset = {} "
-                                  "bound = {}", rank, offset, expected_max));
+            continue;
         }
 
-        MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
-                       all_doms.data(), cnks_per_proc.data(), displs.data(),
-                       MPI_INT64_T, comm);
-
-        MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
-                       all_src_rnks.data(), cnks_per_proc.data(), displs.data(),
-                       MPI_INT64_T, comm);
-
-        // Put everything we own in dom_to_recv_rnk
-        for (int64 icnk = 0; icnk < ncnks; icnk++)
+        Schema s_compact;
+        msg.schema().compact_to(s_compact);
+        std::vector<uint8> schema_bytes;
+        s_compact.serialize_binary(schema_bytes, true);
+        const int64 schema_len = static_cast<int64>(schema_bytes.size());
+        const int64 data_offset = sizeof(int64) + ((schema_len + 7) & ~7);
+        const int64 msg_len = data_offset + s_compact.total_bytes_compact();
+        if (static_cast<int64>(snd_buffer.size()) + msg_len > std::numeric_limits<int>::max())
         {
-            int64 dom_id = all_doms[icnk];
-            int64 src_rnk = all_src_rnks[icnk];
-            if (domain_to_rank_map[dom_id] == rank && src_rnk != rank)
-            {
-                dom_to_recv_rnk[dom_id].push_back(src_rnk);
-            }
+            CONDUIT_ERROR("communicate_mapback: packed fields exceed 2 GB");
         }
-    }
-
-    conduit::relay::mpi::communicate_using_schema C(comm);
-    C.set_logging(true);
-
-    constexpr int MAPBACK_TAG_BASE = 16000;
 
-    // Setup nonblocking sends.
-    for (const auto& dom_field : packed_fields)
-    {
-        index_t tgt_domain = dom_field.first;
-        index_t tgt_rank = domain_to_rank_map[tgt_domain];
-        if (tgt_rank != rank)
-        {
-            const int tag = MAPBACK_TAG_BASE + tgt_domain;
-            C.add_isend(dom_field.second, tgt_rank, tag);
-        }
+        const size_t offset = snd_buffer.size();
+        snd_buffer.resize(offset + msg_len, 0);
+        uint8* msg_ptr = snd_buffer.data() + offset;
+        std::memcpy(msg_ptr, &schema_len, sizeof(int64));
+        std::memcpy(msg_ptr + sizeof(int64), schema_bytes.data(), schema_bytes.size());
+        Node n_data(s_compact, msg_ptr + data_offset, true);
+        n_data.update(msg);
+        snd_sizes[irnk] = static_cast<int>(msg_len);
     }
 
-    // Compute the total number of receive nodes to allocate.
-    // This avoids vector resizes invalidating any stored references to nodes
-    // in the communication object.
-    index_t ntotal_recvs = 0;
-    for (const auto& dom_recv_pair : dom_to_recv_rnk)
+    // Exchange the messages with one all-to-all
+    std::vector<int> rcv_sizes(size, 0), rcv_displs(size, 0);
+    MPI_Alltoall(snd_sizes.data(), 1, MPI_INT,
+                 rcv_sizes.data(), 1, MPI_INT, comm);
+    int64 rcv_total = 0;
+    for (int irnk = 0; irnk < size; irnk++)
     {
-        ntotal_recvs += dom_recv_pair.second.size();
+        rcv_displs[irnk] = static_cast<int>(rcv_total);
+        rcv_total += rcv_sizes[irnk];
     }
-
-    // Setup nonblocking receives.
-    std::vector<std::pair<index_t, Node>> pending_recvs(ntotal_recvs);
-    for (const auto& dom_recv_pair : dom_to_recv_rnk)
+    if (rcv_total > std::numeric_limits<int>::max())
     {
-        index_t tgt_domain = dom_recv_pair.first;
-        const int tag = MAPBACK_TAG_BASE + tgt_domain;
-        for (index_t src_rank : dom_recv_pair.second)
-        {
-            pending_recvs.emplace_back(tgt_domain, Node{});
-            Node& recv_node = pending_recvs.rbegin()->second;
-            C.add_irecv(recv_node, src_rank, tag);
-        }
+        CONDUIT_ERROR("communicate_mapback: received fields exceed 2 GB");
     }
-
-    C.execute();
+    std::vector<uint8> rcv_buffer(rcv_total);
+    MPI_Alltoallv(snd_buffer.data(), snd_sizes.data(), snd_displs.data(), MPI_BYTE,
+                  rcv_buffer.data(), rcv_sizes.data(), rcv_displs.data(), MPI_BYTE,
+                  comm);
 
     // Append received chunks to original domain chunk map
-    for (const auto& recv_result : pending_recvs)
+    for (int irnk = 0; irnk < size; irnk++)
     {
-        index_t tgt_domain = recv_result.first;
-        for (const Node& cnk : recv_result.second.children())
+        if (rcv_sizes[irnk] == 0)
+        {
+            continue;
+        }
+        const uint8* msg_ptr = rcv_buffer.data() + rcv_displs[irnk];
+        int64 schema_len = 0;
+        std::memcpy(&schema_len, msg_ptr, sizeof(int64));
+        const int64 data_offset = sizeof(int64) + ((schema_len + 7) & ~7);
+        Schema s_msg;
+        s_msg.deserialize_binary(msg_ptr + sizeof(int64), schema_len);
+        Node msg;
+        msg.set_external(s_msg, const_cast<uint8*>(msg_ptr + data_offset));
+        for (const Node& entry : msg.children())
         {
-            packed_fields[tgt_domain].append().set(cnk);
+            Node& dom_chunks = packed_fields[entry["domain"].to_index_t()];
+            for (const Node& cnk : entry["chunks"].children())
+            {
+                dom_chunks.append().set(cnk);
+            }
         }
     }
 
@@ -933,112 +1006,138 @@ ParallelPartitioner::synchronize_gvids(
     const std::vector<std::vector<index_t>>& remap_to_local_doms,
     std::map<index_t, std::vector<index_t>>& orig_dom_gvids)
 {
-    std::vector<int64> orig_domain_nverts(domain_to_rank_map.size(), 0);
-    for (const auto& orig_dom_verts : orig_dom_gvids)
+    // First, figure out the unique domains that we need to receive on this
+    // rank, grouped by the rank that holds them.
+    std::map<int, std::vector<index_t>> domain_requests;
     {
-        index_t domid = orig_dom_verts.first;
-        orig_domain_nverts[domid] = orig_dom_verts.second.size();
-    }
-    // Get the number of verts in each domain
-    MPI_Allreduce(MPI_IN_PLACE,
-                  orig_domain_nverts.data(),
-                  orig_domain_nverts.size(),
-                  MPI_INT64_T, MPI_MAX, comm);
-
-    // First, figure out the unique domains that we need to receive on this rank
-    std::unordered_set<index_t> orig_doms_required;
-    for (const auto& orig_domset : remap_to_local_doms)
-    {
-        for (index_t domid : orig_domset)
+        std::set<index_t> orig_doms_required;
+        for (const auto& orig_domset : remap_to_local_doms)
         {
-            if (domain_to_rank_map[domid] != rank)
+            for (index_t domid : orig_domset)
             {
-                orig_doms_required.insert(domid);
+                if (domain_to_rank_map[domid] != rank)
+                {
+                    orig_doms_required.insert(domid);
+                }
             }
         }
+        for (index_t domid : orig_doms_required)
+        {
+            domain_requests[domain_to_rank_map[domid]].push_back(domid);
+        }
     }
 
     MPI_Datatype index_mpi_dtype
         = relay::mpi::conduit_dtype_to_mpi_dtype(conduit::DataType::index_t());
-    std::vector<std::pair<int, index_t>> domain_sends;
-    // Determine ranks that we need to send domains to
+    const int GVID_REQUEST_TAG = 227000;
+    const int GVID_TAG = 227001;
+
+    // Send one request to each rank that holds domains we need. The ranks do
+    // not know how many requests they will get, so each one answers requests
+    // as they arrive until a barrier, entered once all of its own requests
+    // were received, completes on all ranks. Only ranks that share domains
+    // exchange messages.
+    std::vector<MPI_Request> request_reqs(domain_requests.size());
+    int req_id = 0;
+    for (auto& dst_req : domain_requests)
     {
-        std::vector<int> counts(size, 0);
-        counts[rank] = orig_doms_required.size();
-        MPI_Allgather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
-                      counts.data(), 1, MPI_INT,
-                      comm);
+        MPI_Issend(dst_req.second.data(),
+                   static_cast<int>(dst_req.second.size()),
+                   index_mpi_dtype,
+                   dst_req.first,
+                   GVID_REQUEST_TAG,
+                   comm,
+                   &request_reqs[req_id]);
+        req_id++;
+    }
 
-        std::vector<int> offsets(size, 0);
-        for (int irnk = 1; irnk < size; irnk++)
+    // Each reply holds the number of vertices of each requested domain,
+    // followed by their global vertex ids.
+    std::vector<std::vector<index_t>> replies;
+    std::vector<int> reply_ranks;
+    MPI_Request barrier_req = MPI_REQUEST_NULL;
+    bool in_barrier = false;
+    bool done = false;
+    while (!done)
+    {
+        int have_request = 0;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, GVID_REQUEST_TAG, comm, &have_request, &status);
+        if (have_request)
         {
-            offsets[irnk] = offsets[irnk-1] + counts[irnk-1];
+            int count = 0;
+            MPI_Get_count(&status, index_mpi_dtype, &count);
+            std::vector<index_t> domids(count);
+            MPI_Recv(domids.data(), count, index_mpi_dtype, status.MPI_SOURCE,
+                     GVID_REQUEST_TAG, comm, MPI_STATUS_IGNORE);
+
+            std::vector<index_t> reply(domids.begin(), domids.end());
+            for (int i = 0; i < count; i++)
+            {
+                index_t domid = domids[i];
+                CONDUIT_ASSERT((domain_to_rank_map[domid] == rank),
+                    conduit_fmt::format("Rank {}: domain id {} doesn't exist on this rank",
+                                        rank, domid));
+                const std::vector<index_t>& gvids = orig_dom_gvids[domid];
+                reply[i] = static_cast<index_t>(gvids.size());
+                reply.insert(reply.end(), gvids.begin(), gvids.end());
+            }
+            replies.push_back(std::move(reply));
+            reply_ranks.push_back(status.MPI_SOURCE);
         }
-        int64 total_counts = offsets[size-1] + counts[size-1];
-        std::vector<int64> all_doms(total_counts);
-        std::copy(orig_doms_required.begin(), orig_doms_required.end(),
-                  all_doms.begin() + offsets[rank]);
-        MPI_Allgatherv(MPI_IN_PLACE,
-                       0,
-                       MPI_DATATYPE_NULL,
-                       all_doms.data(),
-                       counts.data(),
-                       offsets.data(),
-                       index_mpi_dtype, comm);
-        // Add domains which other ranks will need to receive from us
-        for (int irnk = 0; irnk < size; irnk++)
+
+        if (!in_barrier)
         {
-            for (int ireq = 0; ireq < counts[irnk]; ireq++)
+            int sent = 0;
+            MPI_Testall(static_cast<int>(request_reqs.size()), request_reqs.data(),
+                        &sent, MPI_STATUSES_IGNORE);
+            if (sent)
             {
-                size_t realIdx = offsets[irnk] + ireq;
-                index_t domid = all_doms[realIdx];
-                if (domain_to_rank_map[domid] == rank)
-                {
-                    domain_sends.emplace_back(irnk, domid);
-                }
+                MPI_Ibarrier(comm, &barrier_req);
+                in_barrier = true;
             }
         }
+        else
+        {
+            int barrier_done = 0;
+            MPI_Test(&barrier_req, &barrier_done, MPI_STATUS_IGNORE);
+            done = (barrier_done != 0);
+        }
     }
 
-    std::vector<MPI_Request> pending_reqs(orig_doms_required.size()
-                                          + domain_sends.size());
-    const int GVID_TAG = 227000;
-    int req_id = 0;
-    // Start any receives of required domains
-    for (index_t domid : orig_doms_required)
+    // Send the replies, then receive ours.
+    std::vector<MPI_Request> reply_reqs(replies.size());
+    for (size_t i = 0; i < replies.size(); i++)
     {
-        int src_rnk = domain_to_rank_map[domid];
-        CONDUIT_ASSERT((src_rnk != rank),
-            conduit_fmt::format("Rank {}: Unnecessary recv of original domain {}",
-                                rank, domid));
-        orig_dom_gvids[domid].resize(orig_domain_nverts[domid]);
-        MPI_Irecv(orig_dom_gvids[domid].data(),
-                  orig_dom_gvids[domid].size(),
+        MPI_Isend(replies[i].data(),
+                  static_cast<int>(replies[i].size()),
                   index_mpi_dtype,
-                  src_rnk,
-                  GVID_TAG + domid,
+                  reply_ranks[i],
+                  GVID_TAG,
                   comm,
-                  &pending_reqs[req_id]);
-        req_id++;
+                  &reply_reqs[i]);
     }
-    for (const auto& incoming_req : domain_sends)
+    for (const auto& dst_req : domain_requests)
     {
-        int dst_rank = incoming_req.first;
-        int64 domid = incoming_req.second;
-        CONDUIT_ASSERT((domain_to_rank_map[domid] == rank),
-            conduit_fmt::format("Rank {}: domain id {} doesn't exist on this rank",
-                                rank, domid));
-        MPI_Isend(orig_dom_gvids[domid].data(),
-                  orig_dom_gvids[domid].size(),
-                  index_mpi_dtype,
-                  dst_rank,
-                  GVID_TAG + domid,
-                  comm,
-                  &pending_reqs[req_id]);
-        req_id++;
+        MPI_Status status;
+        MPI_Probe(dst_req.first, GVID_TAG, comm, &status);
+        int count = 0;
+        MPI_Get_count(&status, index_mpi_dtype, &count);
+        std::vector<index_t> reply(count);
+        MPI_Recv(reply.data(), count, index_mpi_dtype, dst_req.first,
+                 GVID_TAG, comm, MPI_STATUS_IGNORE);
+
+        size_t offset = dst_req.second.size();
+        for (size_t i = 0; i < dst_req.second.size(); i++)
+        {
+            const size_t nverts = static_cast<size_t>(reply[i]);
+            orig_dom_gvids[dst_req.second[i]].assign(reply.begin() + offset,
+                                                     reply.begin() + offset + nverts);
+            offset += nverts;
+        }
     }
-
-    MPI_Waitall(pending_reqs.size(), pending_reqs.data(), MPI_STATUSES_IGNORE);
+    MPI_Waitall(static_cast<int>(reply_reqs.size()), reply_reqs.data(),
+                MPI_STATUSES_IGNORE);
 }
 
 }
@@ -86,6 +86,10 @@ protected:
 
     virtual void get_largest_selection(int &sel_rank, int &sel_index) const override;
 
+    virtual void reduce_sfc_bounds(float64 bounds[6]) const override;
+
+    virtual void reduce_sfc_counts(std::vector<uint64> &counts) const override;
+
     struct long_int
     {
         long value;
@@ -110,7 +114,8 @@ protected:
                                     const std::vector<int> &offsets,
                                     std::vector<Chunk> &chunks_to_assemble,
                                     std::vector<int> &chunks_to_assemble_domains,
-                                    std::vector<int> &chunks_to_assemble_gids) override;
+                                    std::vector<int> &chunks_to_assemble_gids,
+                                    const ChunksReady &chunks_ready) override;
 
     virtual void get_prelb_adjset_maps(const std::vector<int>& chunk_offsets,
                                        const DomainToChunkMap& chunks,
@@ -0,0 +1,415 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_o2mrelation_view.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_BLUEPRINT_O2MRELATION_VIEW_HPP
+#define CONDUIT_BLUEPRINT_O2MRELATION_VIEW_HPP
+
+//-----------------------------------------------------------------------------
+// std includes
+//-----------------------------------------------------------------------------
+#include <iterator>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// conduit lib includes
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_blueprint_exports.h"
+#include "conduit_blueprint_mesh_utils.hpp"
+#include "conduit_blueprint_o2mrelation.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::o2mrelation --
+//-----------------------------------------------------------------------------
+namespace o2mrelation
+{
+
+//-----------------------------------------------------------------------------
+/// The conduit type id of the index types an O2MView supports.
+//-----------------------------------------------------------------------------
+template <typename IndexT> struct O2MIndexTypeId;
+template <> struct O2MIndexTypeId<int32>  { static const index_t value = DataType::INT32_ID; };
+template <> struct O2MIndexTypeId<int64>  { static const index_t value = DataType::INT64_ID; };
+template <> struct O2MIndexTypeId<uint32> { static const index_t value = DataType::UINT32_ID; };
+template <> struct O2MIndexTypeId<uint64> { static const index_t value = DataType::UINT64_ID; };
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::o2mrelation::O2MView --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::blueprint::o2mrelation::O2MView
+///
+/// description:
+///  Header only, read-only view of an 'o2mrelation' Node whose 'sizes',
+///  'offsets' and 'indices' arrays (each of which may be absent) hold
+///  IndexT values. The arrays are resolved to raw pointers and strides
+///  when the view is built, so walking the relation does no Node lookups,
+///  no dtype dispatch and no allocation. Unlike O2MIterator, a view gives
+///  random access to its 'ones':
+///
+///    O2MView<int32> view(o2m);
+///    for(const auto &one : view)          // or view[i] for 'one' i
+///        for(const index_t d : one)       // or one[k] for 'many' k
+///            ... data index d of the 'one' ...
+///
+///  A number array may also be viewed, as a relation with one item per
+///  'one'. Use dispatch_view when the index type isn't known.
+///
+//-----------------------------------------------------------------------------
+template <typename IndexT>
+class O2MView
+{
+public:
+    //-------------------------------------------------------------------------
+    /// A strided array of IndexT values, or a missing one.
+    struct Array
+    {
+        const uint8 *data;
+        index_t      stride;
+
+        index_t operator[](index_t i) const
+        {
+            return (index_t)*reinterpret_cast<const IndexT *>(data + i * stride);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    /// Random access iterator over the data indices of one 'one'.
+    class DataIterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef index_t                         value_type;
+        typedef index_t                         difference_type;
+        typedef const index_t                  *pointer;
+        typedef index_t                         reference;
+
+        DataIterator(const Array &indices, index_t pos)
+        : m_indices(indices), m_pos(pos) {}
+
+        index_t operator*() const
+        { return m_indices.data ? m_indices[m_pos] : m_pos; }
+        index_t operator[](index_t i) const { return *(*this + i); }
+
+        DataIterator &operator++() { m_pos++; return *this; }
+        DataIterator operator++(int) { DataIterator res = *this; m_pos++; return res; }
+        DataIterator &operator--() { m_pos--; return *this; }
+        DataIterator operator--(int) { DataIterator res = *this; m_pos--; return res; }
+        DataIterator &operator+=(index_t n) { m_pos += n; return *this; }
+        DataIterator &operator-=(index_t n) { m_pos -= n; return *this; }
+        DataIterator operator+(index_t n) const { return DataIterator(m_indices, m_pos + n); }
+        DataIterator operator-(index_t n) const { return DataIterator(m_indices, m_pos - n); }
+        index_t operator-(const DataIterator &o) const { return m_pos - o.m_pos; }
+
+        bool operator==(const DataIterator &o) const { return m_pos == o.m_pos; }
+        bool operator!=(const DataIterator &o) const { return m_pos != o.m_pos; }
+        bool operator<(const DataIterator &o) const { return m_pos < o.m_pos; }
+        bool operator>(const DataIterator &o) const { return m_pos > o.m_pos; }
+        bool operator<=(const DataIterator &o) const { return m_pos <= o.m_pos; }
+        bool operator>=(const DataIterator &o) const { return m_pos >= o.m_pos; }
+
+    private:
+        Array   m_indices;
+        index_t m_pos;
+    };
+
+    //-------------------------------------------------------------------------
+    /// The 'many' items of one 'one', a range of data indices. It holds
+    /// copies of the view's pointers, so it may outlive the view (but not
+    /// the viewed Node).
+    class One
+    {
+    public:
+        One(const Array &indices, index_t id, index_t offset, index_t size)
+        : m_indices(indices), m_id(id), m_offset(offset), m_size(size) {}
+
+        /// the index of this 'one'
+        index_t id() const { return m_id; }
+        /// the number of 'many' items of this 'one'
+        index_t size() const { return m_size; }
+        /// the data index of 'many' item i
+        index_t operator[](index_t i) const { return begin()[i]; }
+
+        DataIterator begin() const { return DataIterator(m_indices, m_offset); }
+        DataIterator end() const { return DataIterator(m_indices, m_offset + m_size); }
+
+    private:
+        Array   m_indices;
+        index_t m_id;
+        index_t m_offset;
+        index_t m_size;
+    };
+
+    //-------------------------------------------------------------------------
+    /// Random access iterator over the 'ones' of a view.
+    class OneIterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef One                             value_type;
+        typedef index_t                         difference_type;
+        typedef const One                      *pointer;
+        typedef One                             reference;
+
+        OneIterator(const O2MView *view, index_t pos)
+        : m_view(view), m_pos(pos) {}
+
+        One operator*() const { return (*m_view)[m_pos]; }
+        One operator[](index_t i) const { return (*m_view)[m_pos + i]; }
+
+        OneIterator &operator++() { m_pos++; return *this; }
+        OneIterator operator++(int) { OneIterator res = *this; m_pos++; return res; }
+        OneIterator &operator--() { m_pos--; return *this; }
+        OneIterator operator--(int) { OneIterator res = *this; m_pos--; return res; }
+        OneIterator &operator+=(index_t n) { m_pos += n; return *this; }
+        OneIterator &operator-=(index_t n) { m_pos -= n; return *this; }
+        OneIterator operator+(index_t n) const { return OneIterator(m_view, m_pos + n); }
+        OneIterator operator-(index_t n) const { return OneIterator(m_view, m_pos - n); }
+        index_t operator-(const OneIterator &o) const { return m_pos - o.m_pos; }
+
+        bool operator==(const OneIterator &o) const { return m_pos == o.m_pos; }
+        bool operator!=(const OneIterator &o) const { return m_pos != o.m_pos; }
+        bool operator<(const OneIterator &o) const { return m_pos < o.m_pos; }
+        bool operator>(const OneIterator &o) const { return m_pos > o.m_pos; }
+        bool operator<=(const OneIterator &o) const { return m_pos <= o.m_pos; }
+        bool operator>=(const OneIterator &o) const { return m_pos >= o.m_pos; }
+
+    private:
+        const O2MView *m_view;
+        index_t        m_pos;
+    };
+
+    //-------------------------------------------------------------------------
+    /// An empty view.
+    O2MView()
+    : m_num_ones(0)
+    {
+        m_sizes = m_offsets = m_indices = missing_array();
+    }
+
+    //-------------------------------------------------------------------------
+    /// Views 'o2m', an 'o2mrelation' or a number array. The 'sizes',
+    /// 'offsets' and 'indices' of 'o2m' must hold IndexT values (see
+    /// is_compatible). The view doesn't own any data, 'o2m' must outlive it.
+    explicit O2MView(const Node &o2m)
+    {
+        m_sizes = m_offsets = m_indices = missing_array();
+        if(o2m.dtype().is_number())
+        {
+            m_num_ones = o2m.dtype().number_of_elements();
+            return;
+        }
+
+        if(!is_compatible(o2m))
+        {
+            CONDUIT_ERROR("blueprint::o2mrelation::O2MView passed o2mrelation "
+                          "with index arrays that don't match the view's "
+                          "index type " << DataType::id_to_name(index_type_id()));
+        }
+
+        if(o2m.has_child("sizes"))
+        {
+            m_sizes = make_array(o2m["sizes"]);
+            m_offsets = make_array(o2m["offsets"]);
+            m_num_ones = o2m["sizes"].dtype().number_of_elements();
+        }
+        if(o2m.has_child("indices"))
+        {
+            m_indices = make_array(o2m["indices"]);
+            if(!m_sizes.data)
+            {
+                m_num_ones = o2m["indices"].dtype().number_of_elements();
+            }
+        }
+        if(!m_sizes.data && !m_indices.data)
+        {
+            const std::vector<std::string> paths = data_paths(o2m);
+            m_num_ones = paths.empty() ? 0 :
+                o2m[paths.front()].dtype().number_of_elements();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    /// Returns true when the index arrays of 'o2m' (if any) hold IndexT
+    /// values, so that an O2MView<IndexT> can be built for 'o2m'.
+    static bool is_compatible(const Node &o2m)
+    {
+        if(o2m.dtype().is_number())
+        {
+            return true;
+        }
+
+        const char *paths[] = {"sizes", "offsets", "indices"};
+        for(const char *path : paths)
+        {
+            if(o2m.has_child(path) && o2m[path].dtype().id() != index_type_id())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    /// The conduit type id of IndexT.
+    static index_t index_type_id()
+    {
+        return O2MIndexTypeId<IndexT>::value;
+    }
+
+    //-------------------------------------------------------------------------
+    /// The number of 'ones'.
+    index_t size() const { return m_num_ones; }
+
+    //-------------------------------------------------------------------------
+    /// The number of 'many' items of 'one'.
+    index_t size(index_t one) const
+    {
+        return m_sizes.data ? m_sizes[one] : 1;
+    }
+
+    //-------------------------------------------------------------------------
+    /// The data index of 'many' item 'many' of 'one'.
+    index_t index(index_t one, index_t many) const
+    {
+        const index_t pos = (m_offsets.data ? m_offsets[one] : one) + many;
+        return m_indices.data ? m_indices[pos] : pos;
+    }
+
+    //-------------------------------------------------------------------------
+    /// The 'many' items of 'one'.
+    One operator[](index_t one) const
+    {
+        return One(m_indices, one,
+                   m_offsets.data ? m_offsets[one] : one,
+                   m_sizes.data ? m_sizes[one] : 1);
+    }
+
+    OneIterator begin() const { return OneIterator(this, 0); }
+    OneIterator end() const { return OneIterator(this, m_num_ones); }
+
+private:
+    static Array missing_array()
+    {
+        Array res;
+        res.data = NULL;
+        res.stride = 0;
+        return res;
+    }
+
+    static Array make_array(const Node &node)
+    {
+        Array res;
+        res.data = static_cast<const uint8 *>(node.element_ptr(0));
+        res.stride = node.dtype().stride();
+        return res;
+    }
+
+    Array   m_sizes;
+    Array   m_offsets;
+    Array   m_indices;
+    index_t m_num_ones;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::o2mrelation::O2MView --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/// Calls 'func' with an O2MView of 'o2m' for the index type of its arrays:
+/// an O2MView<int32> or O2MView<int64>. Relations with other or mixed index
+/// types are viewed through an index_t copy of their index arrays.
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+dispatch_view(const Node &o2m, const Func &func)
+{
+    if(O2MView<int32>::is_compatible(o2m))
+    {
+        func(O2MView<int32>(o2m));
+    }
+    else if(O2MView<int64>::is_compatible(o2m))
+    {
+        func(O2MView<int64>(o2m));
+    }
+    else
+    {
+        Node o2m_index_t;
+        NodeConstIterator itr = o2m.children();
+        while(itr.has_next())
+        {
+            const Node &child = itr.next();
+            const std::string name = itr.name();
+            if(name == "sizes" || name == "offsets" || name == "indices")
+            {
+                child.to_data_type(DataType::index_t().id(), o2m_index_t[name]);
+            }
+            else
+            {
+                o2m_index_t[name].set_external(child);
+            }
+        }
+        func(O2MView<index_t>(o2m_index_t));
+    }
+}
+
+//-----------------------------------------------------------------------------
+/// Calls 'func(one)' for each 'one' of 'view' on 'num_threads' threads.
+/// Each thread gets a contiguous range of at least 'min_chunk_ones' 'ones'.
+//-----------------------------------------------------------------------------
+template <typename IndexT, typename Func>
+void
+parallel_for_ones(const O2MView<IndexT> &view,
+                  index_t num_threads,
+                  const Func &func,
+                  index_t min_chunk_ones = 4096)
+{
+    namespace bputils = conduit::blueprint::mesh::utils;
+    bputils::detail::parallel_chunks(
+        bputils::detail::parallel_num_chunks(num_threads, view.size(), min_chunk_ones),
+        view.size(),
+        [&](index_t /*ci*/, index_t begin, index_t end)
+    {
+        for(index_t i = begin; i < end; i++)
+        {
+            func(view[i]);
+        }
+    });
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::o2mrelation --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
@@ -11,7 +11,7 @@
 //-----------------------------------------------------------------------------
 // std lib includes
 //-----------------------------------------------------------------------------
-// std lib includes will go here
+#include <cstring>
 
 //-----------------------------------------------------------------------------
 // conduit includes
@@ -129,6 +129,167 @@ verify_single_table(const Node &n, Node &info)
     return res;
 }
 
+//-----------------------------------------------------------------------------
+// Returns the number of rows of a table with "values".
+static index_t
+single_table_rows(const Node &table)
+{
+    const Node &values = table["values"];
+    index_t res = 0;
+    if(values.number_of_children() > 0)
+    {
+        const Node &col = values[0];
+        res = col.number_of_children() > 0
+            ? col[0].dtype().number_of_elements()
+            : col.dtype().number_of_elements();
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// Returns true if the tables with values a_values and b_values have the same
+// columns: the same names, components and types, in the same order.
+static bool
+same_columns(const Node &a_values, const Node &b_values)
+{
+    const index_t ncols = a_values.number_of_children();
+    if(ncols != b_values.number_of_children())
+    {
+        return false;
+    }
+
+    for(index_t col = 0; col < ncols; col++)
+    {
+        const Node &a_col = a_values[col];
+        const Node &b_col = b_values[col];
+        const index_t ncomps = a_col.number_of_children();
+        if(a_col.name() != b_col.name() ||
+           ncomps != b_col.number_of_children())
+        {
+            return false;
+        }
+
+        if(ncomps == 0)
+        {
+            if(a_col.dtype().id() != b_col.dtype().id())
+            {
+                return false;
+            }
+        }
+        for(index_t comp = 0; comp < ncomps; comp++)
+        {
+            if(a_col[comp].name() != b_col[comp].name() ||
+               a_col[comp].dtype().id() != b_col[comp].dtype().id())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+static bool
+verify_row_grouped_table(const Node &n, Node &info)
+{
+    bool res = true;
+
+    // "row_groups" child must be a non-empty list or object of tables
+    const Node &n_groups = n["row_groups"];
+    Node &i_groups = info["row_groups"];
+    if(!n_groups.dtype().is_object() && !n_groups.dtype().is_list())
+    {
+        utils::log::error(info, PROTOCOL, utils::log::quote("row_groups", 0) + " must be an object or a list.");
+        utils::log::validation(info, false);
+        return false;
+    }
+    if(n_groups.number_of_children() == 0)
+    {
+        utils::log::error(info, PROTOCOL, utils::log::quote("row_groups", 0) + " must have at least one row group.");
+        utils::log::validation(info, false);
+        return false;
+    }
+
+    // Each row group is a table with the columns of the first one
+    const Node *first_values = NULL;
+    index_t num_rows = 0;
+    auto groups = n_groups.children();
+    while(groups.has_next())
+    {
+        const Node &n_group = groups.next();
+        Node &i_group = n_groups.dtype().is_list() ? i_groups.append()
+                                                   : i_groups[n_group.name()];
+        bool this_res = verify_single_table(n_group, i_group);
+        if(this_res && first_values == NULL)
+        {
+            first_values = n_group.fetch_ptr("values");
+        }
+        else if(this_res && !same_columns(*first_values, n_group["values"]))
+        {
+            utils::log::error(i_group, PROTOCOL, "row group does not have the columns of the first row group.");
+            utils::log::validation(i_group, false);
+            this_res = false;
+        }
+        if(this_res)
+        {
+            num_rows += single_table_rows(n_group);
+        }
+        res &= this_res;
+    }
+
+    if(res)
+    {
+        info["columns"] = first_values->number_of_children();
+        info["rows"] = num_rows;
+    }
+    utils::log::validation(info, res);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static bool
+verify_table(const Node &n, Node &info)
+{
+    return n.has_child("row_groups") ? verify_row_grouped_table(n, info)
+                                     : verify_single_table(n, info);
+}
+
+//-----------------------------------------------------------------------------
+// Copies the values of src to the values of dest from element offset on.
+static void
+copy_rows(const Node &src, Node &dest, index_t offset)
+{
+    const index_t nelems = src.dtype().number_of_elements();
+    if(nelems == 0)
+    {
+        return;
+    }
+
+    const index_t ele_bytes = src.dtype().element_bytes();
+    uint8 *dest_ptr = static_cast<uint8*>(dest.element_ptr(offset));
+    if(src.dtype().is_compact())
+    {
+        std::memcpy(dest_ptr, src.element_ptr(0), (size_t)(nelems * ele_bytes));
+    }
+    else
+    {
+        for(index_t i = 0; i < nelems; i++)
+        {
+            std::memcpy(dest_ptr + i * ele_bytes, src.element_ptr(i),
+                        (size_t)ele_bytes);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+allocate_column(const Node &src, index_t num_rows, Node &dest)
+{
+    const DataType &dt = src.dtype();
+    dest.set(DataType(dt.id(), num_rows, 0, dt.element_bytes(),
+                      dt.element_bytes(), dt.endianness()));
+}
+
 //-----------------------------------------------------------------------------
 static bool
 verify_many_tables(const conduit::Node &n, conduit::Node &info)
@@ -142,7 +303,7 @@ verify_many_tables(const conduit::Node &n, conduit::Node &info)
     {
         const Node &child = children.next();
         Node &info_child = info[child.name()];
-        res &= verify_single_table(child, info_child);
+        res &= verify_table(child, info_child);
         num_tables++;
     }
 
@@ -186,9 +347,9 @@ bool verify(const conduit::Node &n,
     bool res = true;
     info.reset();
 
-    if(n.has_child("values"))
+    if(n.has_child("values") || n.has_child("row_groups"))
     {
-        res = verify_single_table(n, info);
+        res = verify_table(n, info);
     }
     else
     {
@@ -209,6 +370,130 @@ bool verify(const std::string &,
     return false;
 }
 
+//-----------------------------------------------------------------------------
+index_t
+number_of_rows(const conduit::Node &table)
+{
+    index_t res = 0;
+    iterate_row_groups(table, [&](index_t, const Node &row_group)
+    {
+        res += single_table_rows(row_group);
+    });
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+number_of_row_groups(const conduit::Node &table)
+{
+    if(table.has_child("values"))
+    {
+        return 1;
+    }
+    return table.has_child("row_groups")
+        ? table["row_groups"].number_of_children() : 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+append_row_group(const conduit::Node &row_group,
+                 conduit::Node &table)
+{
+    if(!row_group.has_child("values"))
+    {
+        CONDUIT_ERROR("blueprint::table::append_row_group row_group must be "
+                      "a table with " << utils::log::quote("values"));
+    }
+    if(table.has_child("values"))
+    {
+        CONDUIT_ERROR("blueprint::table::append_row_group can't append to a "
+                      "table with " << utils::log::quote("values")
+                      << ", only to a table with "
+                      << utils::log::quote("row_groups"));
+    }
+
+    Node &groups = table["row_groups"];
+    if(groups.number_of_children() > 0 &&
+       !same_columns(groups[0]["values"], row_group["values"]))
+    {
+        CONDUIT_ERROR("blueprint::table::append_row_group row_group does not "
+                      "have the columns of the table's first row group");
+    }
+    groups.append().set(row_group);
+}
+
+//-----------------------------------------------------------------------------
+void
+iterate_row_groups(const conduit::Node &table,
+    const std::function<void(index_t, const conduit::Node &)> &func)
+{
+    if(table.has_child("values"))
+    {
+        func(0, table);
+        return;
+    }
+    if(!table.has_child("row_groups"))
+    {
+        CONDUIT_ERROR("blueprint::table::iterate_row_groups table must have "
+                      << utils::log::quote("values") << " or "
+                      << utils::log::quote("row_groups"));
+    }
+
+    index_t row_offset = 0;
+    auto groups = table["row_groups"].children();
+    while(groups.has_next())
+    {
+        const Node &row_group = groups.next();
+        func(row_offset, row_group);
+        row_offset += single_table_rows(row_group);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+concatenate_row_groups(const conduit::Node &table,
+                       conduit::Node &dest)
+{
+    Node res;
+    const index_t num_rows = number_of_rows(table);
+    Node &res_values = res["values"];
+    iterate_row_groups(table, [&](index_t row_offset, const Node &row_group)
+    {
+        const Node &values = row_group["values"];
+        const index_t ncols = values.number_of_children();
+        for(index_t col = 0; col < ncols; col++)
+        {
+            const Node &src_col = values[col];
+            if(row_offset == 0)
+            {
+                Node &dest_col = values.dtype().is_list()
+                    ? res_values.append() : res_values[src_col.name()];
+                for(index_t comp = 0; comp < src_col.number_of_children(); comp++)
+                {
+                    allocate_column(src_col[comp], num_rows,
+                        src_col.dtype().is_list() ? dest_col.append()
+                                                  : dest_col[src_col[comp].name()]);
+                }
+                if(src_col.number_of_children() == 0)
+                {
+                    allocate_column(src_col, num_rows, dest_col);
+                }
+            }
+
+            Node &dest_col = res_values[col];
+            for(index_t comp = 0; comp < src_col.number_of_children(); comp++)
+            {
+                copy_rows(src_col[comp], dest_col[comp], row_offset);
+            }
+            if(src_col.number_of_children() == 0)
+            {
+                copy_rows(src_col, dest_col, row_offset);
+            }
+        }
+    });
+    dest.swap(res);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::table --
@@ -17,6 +17,8 @@
 #include "conduit.hpp"
 #include "conduit_blueprint_exports.h"
 
+#include <functional>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit --
 //-----------------------------------------------------------------------------
@@ -45,6 +47,62 @@ bool CONDUIT_BLUEPRINT_API verify(const std::string &protocol,
                                   const conduit::Node &n,
                                   conduit::Node &info);
 
+//-----------------------------------------------------------------------------
+// Row groups
+//
+// A table can hold its rows in row groups, a list of tables that share one
+// set of columns (names, components and types):
+//
+//   row_groups:
+//     -
+//       values: {...}
+//     -
+//       values: {...}
+//
+// The rows of the table are the rows of its row groups, in order. Row
+// groups let a table be built, written and read a group at a time, so the
+// whole table doesn't have to be held in memory. The functions below treat
+// a table with "values" as a table with a single row group.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/**
+@brief Returns the number of rows of a table, which may have row groups.
+*/
+index_t CONDUIT_BLUEPRINT_API number_of_rows(const conduit::Node &table);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Returns the number of row groups of a table (1 if it has "values").
+*/
+index_t CONDUIT_BLUEPRINT_API number_of_row_groups(const conduit::Node &table);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Copies row_group, a table with "values", to the end of table's
+    "row_groups". An empty table becomes a table with row groups. The
+    columns of row_group must match the columns of table's first row group.
+*/
+void CONDUIT_BLUEPRINT_API append_row_group(const conduit::Node &row_group,
+                                            conduit::Node &table);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Calls func(row_offset, row_group) for each row group of table in
+    order, where row_offset is the table row that row_group starts at.
+*/
+void CONDUIT_BLUEPRINT_API iterate_row_groups(const conduit::Node &table,
+    const std::function<void(index_t row_offset,
+                             const conduit::Node &row_group)> &func);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Concatenates the row groups of table into dest, a table with
+    "values" whose columns are compact.
+*/
+void CONDUIT_BLUEPRINT_API concatenate_row_groups(const conduit::Node &table,
+                                                  conduit::Node &dest);
+
 //-----------------------------------------------------------------------------
 }
 //-----------------------------------------------------------------------------
@@ -11,7 +11,19 @@
 #include "conduit.hpp"
 #include "conduit_relay.hpp"
 #include "conduit_blueprint.hpp"
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+#include "conduit_relay_io_hdf5.hpp"
+#endif
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+#include "conduit_relay_mpi.hpp"
+#include <mpi.h>
+#endif
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace conduit;
 using namespace conduit::relay;
@@ -26,23 +38,34 @@ usage()
     conduit::relay::io::about(n_about_relay_io);
     std::cout << "usage:" << std::endl
               << " conduit_blueprint_verify {blueprint-protocol} "
-              << "{data file} " << std::endl 
+              << "{data file} " << std::endl
               << " conduit_blueprint_verify {blueprint-protocol} "
               << "{data file} "
               << "--relay-protocol {protocol to use for reading with relay }"
-              << std::endl << std::endl 
+              << std::endl << std::endl
+              << " optional arguments for mesh verify:" << std::endl
+              << "  --threads {# of threads (default: 1,"
+              << " <= 0 uses the hardware concurrency)}" << std::endl
+              << "  --level {full or shallow (default: full)}" << std::endl
+              << "  --cache {keep verify results, see"
+              << " blueprint::mesh::verify}" << std::endl
+              << std::endl
+              << " The domains of mesh root files (.root) are read and"
+              << " verified one at a time on each thread (and spread across"
+              << " ranks with MPI), followed by a summary of the failures."
+              << std::endl << std::endl
               << "examples: " << std::endl
               << " conduit_blueprint_verify mesh my_mesh.yaml " << std::endl
               << " conduit_blueprint_verify mesh my_mesh.yaml "
               << "--relay-protocol yaml "<< std::endl
               << " conduit_blueprint_verify mesh my_mesh.root " << std::endl
               << " conduit_blueprint_verify mesh my_mesh.root "
-              << "--relay-protocol hdf5 "<< std::endl
+              << "--threads 8 --level shallow"<< std::endl
               << std::endl << std::endl
-              << "[blueprint protocols]" 
+              << "[blueprint protocols]"
               << n_about_bp["protocols"].to_yaml()
               << std::endl << std::endl
-              << "[relay protocols]" 
+              << "[relay protocols]"
               << n_about_relay_io["protocols"].to_yaml()
               << std::endl << std::endl;
 
@@ -55,11 +78,12 @@ parse_args(int argc,
            char *argv[],
            std::string &bp_protocol,
            std::string &data_file,
-           std::string &relay_protocol)
+           std::string &relay_protocol,
+           Node &verify_opts)
 {
     bp_protocol = std::string(argv[1]);
     data_file   = std::string(argv[2]);
-    
+
     for(int i=3; i < argc ; i++)
     {
         std::string arg_str(argv[i]);
@@ -74,32 +98,311 @@ parse_args(int argc,
             relay_protocol = std::string(argv[i+1]);
             i++;
         }
+        else if(arg_str == "--threads")
+        {
+            if(i+1 >= argc || !utils::string_is_integer(argv[i+1]))
+            {
+                CONDUIT_ERROR("expected integer value following "
+                              "--threads option");
+            }
+
+            verify_opts["num_threads"] =
+                utils::string_to_value<index_t>(std::string(argv[i+1]));
+            i++;
+        }
+        else if(arg_str == "--level")
+        {
+            if(i+1 >= argc )
+            {
+                CONDUIT_ERROR("expected value following "
+                              "--level option");
+            }
+
+            verify_opts["level"] = std::string(argv[i+1]);
+            i++;
+        }
+        else if(arg_str == "--cache")
+        {
+            verify_opts["cache"] = "true";
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+resolve_num_threads(const Node &verify_opts)
+{
+    index_t res = 1;
+    if(verify_opts.has_child("num_threads"))
+    {
+        res = verify_opts["num_threads"].to_index_t();
+    }
+
+    if(res <= 0)
+    {
+        res = std::max((index_t)1,
+                       (index_t)std::thread::hardware_concurrency());
     }
+    return res;
 }
 
+//-----------------------------------------------------------------------------
+// Verifies the domains of a mesh root file, one domain at a time per
+// thread. Returns true if all domains are valid. With MPI, the domains are
+// split into contiguous blocks across ranks and rank 0 prints the summary.
+//-----------------------------------------------------------------------------
+bool
+verify_mesh_root(const std::string &root_file,
+                 const Node &verify_opts)
+{
+    utils::Timer total_timer;
+
+    int par_rank = 0;
+    int par_size = 1;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Comm_rank(MPI_COMM_WORLD, &par_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &par_size);
+#endif
+
+    index_t num_domains = 0;
+    {
+        relay::io::blueprint::LazyMesh lazy(root_file);
+        num_domains = lazy.number_of_domains();
+    }
+
+    index_t block = num_domains / par_size;
+    index_t rem   = num_domains % par_size;
+    index_t dom_begin = par_rank * block + std::min((index_t)par_rank, rem);
+    index_t dom_end   = dom_begin + block + (par_rank < rem ? 1 : 0);
+
+    index_t num_threads = std::min(resolve_num_threads(verify_opts),
+                                   std::max((index_t)1, dom_end - dom_begin));
+
+    // the threads verify whole domains
+    Node dom_opts;
+    dom_opts.set(verify_opts);
+    dom_opts["num_threads"] = 1;
+
+    // hdf5 (unless built thread safe), silo and adios reads can't overlap
+    bool serial_reads = false;
+#if (defined(CONDUIT_RELAY_IO_HDF5_ENABLED) && !defined(H5_HAVE_THREADSAFE)) || \
+     defined(CONDUIT_RELAY_IO_SILO_ENABLED) || \
+     defined(CONDUIT_RELAY_IO_ADIOS_ENABLED)
+    serial_reads = true;
+#endif
+
+    std::vector<int>         dom_valid((size_t)(dom_end - dom_begin), 1);
+    std::vector<Node>        dom_info((size_t)(dom_end - dom_begin));
+    std::vector<std::string> dom_error((size_t)(dom_end - dom_begin));
+    std::vector<float64>     read_times((size_t)num_threads, 0.0);
+    std::vector<float64>     verify_times((size_t)num_threads, 0.0);
+    std::atomic<index_t>     next_dom(dom_begin);
+    std::mutex               read_mutex;
+
+    auto worker = [&](index_t tid)
+    {
+        relay::io::blueprint::LazyMesh lazy(root_file);
+        for(index_t d = next_dom++; d < dom_end; d = next_dom++)
+        {
+            size_t idx = (size_t)(d - dom_begin);
+            try
+            {
+                utils::Timer read_timer;
+                if(serial_reads)
+                {
+                    std::lock_guard<std::mutex> lock(read_mutex);
+                    lazy.domain(d);
+                }
+                else
+                {
+                    lazy.domain(d);
+                }
+                read_times[(size_t)tid] += read_timer.elapsed();
+
+                utils::Timer verify_timer;
+                Node info;
+                if(!conduit::blueprint::mesh::verify(lazy.domain(d),
+                                                     info,
+                                                     dom_opts))
+                {
+                    dom_valid[idx] = 0;
+                    dom_info[idx].set(info);
+                }
+                verify_times[(size_t)tid] += verify_timer.elapsed();
+            }
+            catch(const conduit::Error &e)
+            {
+                dom_valid[idx] = 0;
+                dom_error[idx] = e.message();
+            }
+            lazy.release(d);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(index_t t = 1; t < num_threads; t++)
+    {
+        threads.push_back(std::thread(worker, t));
+    }
+    worker(0);
+    for(size_t t = 0; t < threads.size(); t++)
+    {
+        threads[t].join();
+    }
+
+    // summary of this rank
+    Node res;
+    res["num_failed"] = (int64)0;
+    res["read_time"]  = (float64)0.0;
+    res["verify_time"] = (float64)0.0;
+    res["total_time"] = (float64)total_timer.elapsed();
+    for(index_t t = 0; t < num_threads; t++)
+    {
+        res["read_time"] = res["read_time"].as_float64() +
+                           read_times[(size_t)t];
+        res["verify_time"] = res["verify_time"].as_float64() +
+                             verify_times[(size_t)t];
+    }
+    for(index_t d = dom_begin; d < dom_end; d++)
+    {
+        size_t idx = (size_t)(d - dom_begin);
+        if(dom_valid[idx] == 1)
+        {
+            continue;
+        }
+        res["num_failed"] = res["num_failed"].as_int64() + 1;
+        Node &failure = res["failures"].append();
+        failure["domain"] = (int64)d;
+        if(!dom_error[idx].empty())
+        {
+            failure["error"] = dom_error[idx];
+        }
+        else
+        {
+            failure["info"].set(dom_info[idx]);
+        }
+    }
+
+    Node all_res;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    relay::mpi::gather_using_schema(res, all_res, 0, MPI_COMM_WORLD);
+#else
+    all_res.append().set(res);
+#endif
+
+    int64 num_failed = 0;
+    if(par_rank == 0)
+    {
+        float64 read_time   = 0.0;
+        float64 verify_time = 0.0;
+        float64 total_time  = 0.0;
+        NodeConstIterator itr = all_res.children();
+        while(itr.has_next())
+        {
+            const Node &rank_res = itr.next();
+            num_failed  += rank_res["num_failed"].to_int64();
+            read_time   += rank_res["read_time"].to_float64();
+            verify_time += rank_res["verify_time"].to_float64();
+            total_time   = std::max(total_time,
+                                    rank_res["total_time"].to_float64());
+        }
+
+        if(num_failed > 0)
+        {
+            std::cout << "failed domains:" << std::endl;
+            itr = all_res.children();
+            while(itr.has_next())
+            {
+                const Node &rank_res = itr.next();
+                if(!rank_res.has_child("failures"))
+                {
+                    continue;
+                }
+                NodeConstIterator fitr = rank_res["failures"].children();
+                while(fitr.has_next())
+                {
+                    const Node &failure = fitr.next();
+                    std::cout << "domain "
+                              << failure["domain"].to_int64() << ":"
+                              << std::endl;
+                    if(failure.has_child("error"))
+                    {
+                        std::cout << "  error: "
+                                  << failure["error"].as_string()
+                                  << std::endl;
+                    }
+                    else
+                    {
+                        failure["info"].print();
+                    }
+                }
+            }
+        }
+
+        std::cout << "conduit::blueprint::verify summary" << std::endl
+                  << "  root file: " << root_file << std::endl
+                  << "  level: "
+                  << (verify_opts.has_child("level") ?
+                        verify_opts["level"].as_string() : "full")
+                  << std::endl
+                  << "  ranks: " << par_size
+                  << " threads per rank: " << num_threads << std::endl
+                  << "  domains: " << num_domains
+                  << " failed: " << num_failed << std::endl
+                  << "  read time (summed over threads): "
+                  << read_time << " s" << std::endl
+                  << "  verify time (summed over threads): "
+                  << verify_time << " s" << std::endl
+                  << "  total time: " << total_time << " s" << std::endl;
+
+        if(num_failed == 0)
+        {
+            std::cout << "conduit::blueprint::verify succeeded" << std::endl;
+        }
+        else
+        {
+            std::cout << "conduit::blueprint::verify FAILED" << std::endl;
+        }
+    }
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Bcast(&num_failed, 1, MPI_INT64_T, 0, MPI_COMM_WORLD);
+#endif
 
+    return num_failed == 0;
+}
 
 //-----------------------------------------------------------------------------
 int
-main(int argc, char* argv[])
+run(int argc, char* argv[])
 {
+    int par_rank = 0;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Comm_rank(MPI_COMM_WORLD, &par_rank);
+#endif
+
     try
     {
         if(argc < 3)
         {
-            usage();
+            if(par_rank == 0)
+            {
+                usage();
+            }
             return -1;
         }
-        
+
         std::string bp_protocol("");
         std::string data_file("");
         std::string relay_protocol("");
+        Node verify_opts;
 
         parse_args(argc,
                    argv,
                    bp_protocol,
                    data_file,
-                   relay_protocol);
+                   relay_protocol,
+                   verify_opts);
 
         if(data_file.empty())
         {
@@ -124,6 +427,17 @@ main(int argc, char* argv[])
                                       data_file_name_ext,
                                       data_file_name_base);
 
+        if(data_file_name_ext == "root" && bp_protocol == "mesh")
+        {
+            return verify_mesh_root(data_file, verify_opts) ? 0 : 1;
+        }
+
+        // other files are verified as a whole, on rank 0
+        if(par_rank != 0)
+        {
+            return 0;
+        }
+
         Node data;
         if(data_file_name_ext == "root")
         {
@@ -133,14 +447,14 @@ main(int argc, char* argv[])
         else if(relay_protocol.empty())
         {
             // load guessing protocol
-            std::cout << "loading: " 
+            std::cout << "loading: "
                       << "  file: "<< data_file << std::endl;
             relay::io::load(data_file,data);
         }
         else
         {
             // load with given protocol
-            std::cout << "loading: " 
+            std::cout << "loading: "
                       << "  file: "<< data_file << std::endl
                       << "  relay_protocol: " << relay_protocol << std::endl;
             relay::io::load(data_file,relay_protocol,data);
@@ -150,7 +464,18 @@ main(int argc, char* argv[])
                   << "  blueprint protocol:" << bp_protocol << std::endl;
 
         Node info;
-        if(conduit::blueprint::verify(bp_protocol,data,info))
+        bool valid = false;
+        if(bp_protocol == "mesh")
+        {
+            verify_opts["num_threads"] = resolve_num_threads(verify_opts);
+            valid = conduit::blueprint::mesh::verify(data, info, verify_opts);
+        }
+        else
+        {
+            valid = conduit::blueprint::verify(bp_protocol, data, info);
+        }
+
+        if(valid)
         {
             std::cout << "conduit::blueprint::verify succeeded" << std::endl;
         }
@@ -162,6 +487,7 @@ main(int argc, char* argv[])
         std::cout << "verify info:" << std::endl;
         info.print();
 
+        return valid ? 0 : 1;
     }
     catch(const conduit::Error &e)
     {
@@ -172,9 +498,21 @@ main(int argc, char* argv[])
         usage();
         return -1;
     }
-    
-    return 0;
 }
 
+//-----------------------------------------------------------------------------
+int
+main(int argc, char* argv[])
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Init(&argc, &argv);
+#endif
+
+    int res = run(argc, argv);
 
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Finalize();
+#endif
 
+    return res;
+}
@@ -270,9 +270,12 @@ PyBlueprint_mesh_partition(PyObject *, //self
     Node &options = *PyConduit_Node_Get_Node_Ptr(py_options);
     Node &output = *PyConduit_Node_Get_Node_Ptr(py_output);
 
-    blueprint::mesh::partition(mesh,
-                               options,
-                               output);
+    {
+        PyConduit_Allow_Threads allow_threads;
+        blueprint::mesh::partition(mesh,
+                                   options,
+                                   output);
+    }
 
     Py_RETURN_NONE;
 }
@@ -345,7 +348,10 @@ PyBlueprint_mesh_flatten(PyObject *, //self
     const Node &options = *PyConduit_Node_Get_Node_Ptr(py_options);
     Node &output = *PyConduit_Node_Get_Node_Ptr(py_output);
 
-    blueprint::mesh::flatten(mesh, options, output);
+    {
+        PyConduit_Allow_Threads allow_threads;
+        blueprint::mesh::flatten(mesh, options, output);
+    }
 
     Py_RETURN_NONE;
 }
@@ -108,6 +108,36 @@ cpp_datatype_ref(const conduit_datatype *cdatatype)
     return *reinterpret_cast<const DataType*>(cdatatype);
 }
 
+struct conduit_path_impl {};
+
+//---------------------------------------------------------------------------//
+Path *
+cpp_path(conduit_path *cpath)
+{
+    return reinterpret_cast<Path*>(cpath);
+}
+
+//---------------------------------------------------------------------------//
+conduit_path *
+c_path(Path *path)
+{
+    return reinterpret_cast<conduit_path*>(path);
+}
+
+//---------------------------------------------------------------------------//
+const Path *
+cpp_path(const conduit_path *cpath)
+{
+    return reinterpret_cast<const Path*>(cpath);
+}
+
+//---------------------------------------------------------------------------//
+const conduit_path *
+c_path(const Path *path)
+{
+    return reinterpret_cast<const conduit_path*>(path);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
@@ -52,6 +52,16 @@ CONDUIT_API conduit::DataType &cpp_datatype_ref(conduit_datatype *cdatatype);
 //---------------------------------------------------------------------------//
 CONDUIT_API const conduit::DataType &cpp_datatype_ref(const conduit_datatype *datatype);
 
+//---------------------------------------------------------------------------//
+CONDUIT_API conduit::Path *cpp_path(conduit_path *cpath);
+//---------------------------------------------------------------------------//
+CONDUIT_API conduit_path  *c_path(conduit::Path *path);
+
+//---------------------------------------------------------------------------//
+CONDUIT_API const conduit::Path *cpp_path(const conduit_path *cpath);
+//---------------------------------------------------------------------------//
+CONDUIT_API const conduit_path  *c_path(const conduit::Path *path);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
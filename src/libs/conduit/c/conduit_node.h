@@ -34,6 +34,17 @@ extern "C" {
 struct conduit_node_impl;
 typedef struct conduit_node_impl  conduit_node;
 
+//-----------------------------------------------------------------------------
+// -- typedef for conduit_path --
+//-----------------------------------------------------------------------------
+// pre-parsed path handle (see conduit::Path), used to avoid parsing the
+// same paths in repeated batch calls
+struct conduit_path_impl;
+typedef struct conduit_path_impl  conduit_path;
+
+CONDUIT_API conduit_path *conduit_path_create(const char *path);
+CONDUIT_API void          conduit_path_destroy(conduit_path *cpath);
+
 //-----------------------------------------------------------------------------
 // -- conduit_node creation and destruction --
 //-----------------------------------------------------------------------------
@@ -2500,6 +2511,102 @@ CONDUIT_API char* conduit_node_to_summary_string_with_options(const conduit_node
     //-------------------------------------------------------------------------
     CONDUIT_API const conduit_datatype *conduit_node_dtype(const conduit_node *cnode);
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// -- batched leaf access --
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// These methods set or fetch num_leaves leaves in a single call.
+//
+// Each takes an array of num_leaves path strings, and has a variant
+// (conduit_node_*_path_handle_*) that takes pre-parsed path handles
+// created with conduit_path_create.
+//
+// Data type ids are the conduit_datatype ids (CONDUIT_INT8_ID, ...,
+// CONDUIT_FLOAT64_ID), only numeric types are supported.
+//-----------------------------------------------------------------------------
+
+    //-------------------------------------------------------------------------
+    // set_external for each path: leaf i describes num_elements[i] compact
+    // elements of type dtype_ids[i] at data[i]
+    //-------------------------------------------------------------------------
+    CONDUIT_API void conduit_node_set_path_external_batch(conduit_node *cnode,
+                                                          conduit_index_t num_leaves,
+                                                          const char **paths,
+                                                          void **data,
+                                                          const conduit_index_t *dtype_ids,
+                                                          const conduit_index_t *num_elements);
+
+    CONDUIT_API void conduit_node_set_path_handle_external_batch(conduit_node *cnode,
+                                                                 conduit_index_t num_leaves,
+                                                                 const conduit_path **paths,
+                                                                 void **data,
+                                                                 const conduit_index_t *dtype_ids,
+                                                                 const conduit_index_t *num_elements);
+
+    //-------------------------------------------------------------------------
+    // set (copy) for each path: leaf i is a copy of num_elements[i] compact
+    // elements of type dtype_ids[i] at data[i].
+    // If dest_dtype_ids is not NULL, leaf i is converted to dest_dtype_ids[i].
+    //-------------------------------------------------------------------------
+    CONDUIT_API void conduit_node_set_path_batch(conduit_node *cnode,
+                                                 conduit_index_t num_leaves,
+                                                 const char **paths,
+                                                 const void **data,
+                                                 const conduit_index_t *dtype_ids,
+                                                 const conduit_index_t *num_elements,
+                                                 const conduit_index_t *dest_dtype_ids);
+
+    CONDUIT_API void conduit_node_set_path_handle_batch(conduit_node *cnode,
+                                                        conduit_index_t num_leaves,
+                                                        const conduit_path **paths,
+                                                        const void **data,
+                                                        const conduit_index_t *dtype_ids,
+                                                        const conduit_index_t *num_elements,
+                                                        const conduit_index_t *dest_dtype_ids);
+
+    //-------------------------------------------------------------------------
+    // fetches existing leaves without copying: for each path, stores the
+    // address of the first element, the dtype id, the number of elements,
+    // and the stride (in bytes) between elements. Any of the output arrays
+    // may be NULL.
+    //-------------------------------------------------------------------------
+    CONDUIT_API void conduit_node_fetch_path_data_batch(conduit_node *cnode,
+                                                        conduit_index_t num_leaves,
+                                                        const char **paths,
+                                                        void **data,
+                                                        conduit_index_t *dtype_ids,
+                                                        conduit_index_t *num_elements,
+                                                        conduit_index_t *strides);
+
+    CONDUIT_API void conduit_node_fetch_path_handle_data_batch(conduit_node *cnode,
+                                                               conduit_index_t num_leaves,
+                                                               const conduit_path **paths,
+                                                               void **data,
+                                                               conduit_index_t *dtype_ids,
+                                                               conduit_index_t *num_elements,
+                                                               conduit_index_t *strides);
+
+    //-------------------------------------------------------------------------
+    // copies existing leaves into caller buffers: leaf i is converted to
+    // dest_dtype_ids[i] and written compactly to dest[i].
+    // num_elements[i] holds the capacity of dest[i] (in elements) on input,
+    // and the number of elements copied on output.
+    //-------------------------------------------------------------------------
+    CONDUIT_API void conduit_node_fetch_path_copy_batch(const conduit_node *cnode,
+                                                        conduit_index_t num_leaves,
+                                                        const char **paths,
+                                                        void **dest,
+                                                        const conduit_index_t *dest_dtype_ids,
+                                                        conduit_index_t *num_elements);
+
+    CONDUIT_API void conduit_node_fetch_path_handle_copy_batch(const conduit_node *cnode,
+                                                               conduit_index_t num_leaves,
+                                                               const conduit_path **paths,
+                                                               void **dest,
+                                                               const conduit_index_t *dest_dtype_ids,
+                                                               conduit_index_t *num_elements);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,6 +21,201 @@
     #define _conduit_strdup strdup
 #endif
 
+//-----------------------------------------------------------------------------
+// -- batched leaf access helpers --
+//-----------------------------------------------------------------------------
+namespace
+{
+
+//---------------------------------------------------------------------------//
+inline conduit::Node &
+batch_fetch(conduit::Node &node, const char *path)
+{
+    return node.fetch(std::string(path));
+}
+
+//---------------------------------------------------------------------------//
+inline conduit::Node &
+batch_fetch(conduit::Node &node, const conduit_path *path)
+{
+    return node.fetch(*conduit::cpp_path(path));
+}
+
+//---------------------------------------------------------------------------//
+inline conduit::Node &
+batch_fetch_existing(conduit::Node &node, const char *path)
+{
+    return node.fetch_existing(std::string(path));
+}
+
+//---------------------------------------------------------------------------//
+inline conduit::Node &
+batch_fetch_existing(conduit::Node &node, const conduit_path *path)
+{
+    return node.fetch_existing(*conduit::cpp_path(path));
+}
+
+//---------------------------------------------------------------------------//
+inline const conduit::Node &
+batch_fetch_existing(const conduit::Node &node, const char *path)
+{
+    return node.fetch_existing(std::string(path));
+}
+
+//---------------------------------------------------------------------------//
+inline const conduit::Node &
+batch_fetch_existing(const conduit::Node &node, const conduit_path *path)
+{
+    return node.fetch_existing(*conduit::cpp_path(path));
+}
+
+//---------------------------------------------------------------------------//
+conduit::DataType
+batch_dtype(conduit_index_t dtype_id,
+            conduit_index_t num_elements,
+            const char *method)
+{
+    conduit::DataType res(dtype_id, num_elements);
+    if(!res.is_number())
+    {
+        CONDUIT_ERROR("<" << method << "> unsupported dtype id: "
+                      << dtype_id << " (expected a numeric type id)");
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename PathType>
+void
+set_path_external_batch(conduit::Node &node,
+                        conduit_index_t num_leaves,
+                        PathType *paths,
+                        void **data,
+                        const conduit_index_t *dtype_ids,
+                        const conduit_index_t *num_elements)
+{
+    for(conduit_index_t i = 0; i < num_leaves; i++)
+    {
+        batch_fetch(node, paths[i]).set_external(
+            batch_dtype(dtype_ids[i],
+                        num_elements[i],
+                        "conduit_node_set_path_external_batch"),
+            data[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename PathType>
+void
+set_path_batch(conduit::Node &node,
+               conduit_index_t num_leaves,
+               PathType *paths,
+               const void **data,
+               const conduit_index_t *dtype_ids,
+               const conduit_index_t *num_elements,
+               const conduit_index_t *dest_dtype_ids)
+{
+    conduit::Node src;
+    for(conduit_index_t i = 0; i < num_leaves; i++)
+    {
+        src.set_external(batch_dtype(dtype_ids[i],
+                                     num_elements[i],
+                                     "conduit_node_set_path_batch"),
+                         const_cast<void*>(data[i]));
+
+        conduit::Node &dest = batch_fetch(node, paths[i]);
+        if(dest_dtype_ids == NULL || dest_dtype_ids[i] == dtype_ids[i])
+        {
+            dest.set(src);
+        }
+        else
+        {
+            batch_dtype(dest_dtype_ids[i], 1, "conduit_node_set_path_batch");
+            src.to_data_type(dest_dtype_ids[i], dest);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename PathType>
+void
+fetch_path_data_batch(conduit::Node &node,
+                      conduit_index_t num_leaves,
+                      PathType *paths,
+                      void **data,
+                      conduit_index_t *dtype_ids,
+                      conduit_index_t *num_elements,
+                      conduit_index_t *strides)
+{
+    for(conduit_index_t i = 0; i < num_leaves; i++)
+    {
+        conduit::Node &leaf = batch_fetch_existing(node, paths[i]);
+        const conduit::DataType &dtype = leaf.dtype();
+        if(data != NULL)
+        {
+            data[i] = dtype.number_of_elements() > 0 ? leaf.element_ptr(0)
+                                                     : NULL;
+        }
+        if(dtype_ids != NULL)
+        {
+            dtype_ids[i] = dtype.id();
+        }
+        if(num_elements != NULL)
+        {
+            num_elements[i] = dtype.number_of_elements();
+        }
+        if(strides != NULL)
+        {
+            strides[i] = dtype.stride();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename PathType>
+void
+fetch_path_copy_batch(const conduit::Node &node,
+                      conduit_index_t num_leaves,
+                      PathType *paths,
+                      void **dest,
+                      const conduit_index_t *dest_dtype_ids,
+                      conduit_index_t *num_elements)
+{
+    conduit::Node n_dest;
+    for(conduit_index_t i = 0; i < num_leaves; i++)
+    {
+        const conduit::Node &leaf = batch_fetch_existing(node, paths[i]);
+        conduit_index_t leaf_num_elements = leaf.dtype().number_of_elements();
+        if(!leaf.dtype().is_number())
+        {
+            CONDUIT_ERROR("<conduit_node_fetch_path_copy_batch> leaf "
+                          << leaf.path() << " is not numeric");
+        }
+
+        if(leaf_num_elements > num_elements[i])
+        {
+            CONDUIT_ERROR("<conduit_node_fetch_path_copy_batch> leaf "
+                          << leaf.path() << " has " << leaf_num_elements
+                          << " elements, but the destination buffer only"
+                          << " holds " << num_elements[i]);
+        }
+
+        // the conversion writes into n_dest's existing (external) memory
+        // because its dtype is compatible with the converted leaf
+        n_dest.set_external(batch_dtype(dest_dtype_ids[i],
+                                        leaf_num_elements,
+                                        "conduit_node_fetch_path_copy_batch"),
+                            dest[i]);
+        leaf.to_data_type(dest_dtype_ids[i], n_dest);
+        num_elements[i] = leaf_num_elements;
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end batched leaf access helpers --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // -- begin extern C
 //-----------------------------------------------------------------------------
@@ -29,6 +224,24 @@ extern "C" {
 
 using namespace conduit;
 
+//-----------------------------------------------------------------------------
+// -- conduit_path handles --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+conduit_path *
+conduit_path_create(const char *path)
+{
+    return c_path(new Path(std::string(path)));
+}
+
+//---------------------------------------------------------------------------//
+void
+conduit_path_destroy(conduit_path *cpath)
+{
+    delete cpp_path(cpath);
+}
+
 //-----------------------------------------------------------------------------
 // -- basic constructor and destruction -- 
 //-----------------------------------------------------------------------------
@@ -4906,6 +5119,154 @@ conduit_node_dtype(const conduit_node *cnode)
     return c_datatype(&(cpp_node(cnode)->dtype()));
 }
 
+//-----------------------------------------------------------------------------
+// -- batched leaf access --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_set_path_external_batch(conduit_node *cnode,
+                                     conduit_index_t num_leaves,
+                                     const char **paths,
+                                     void **data,
+                                     const conduit_index_t *dtype_ids,
+                                     const conduit_index_t *num_elements)
+{
+    set_path_external_batch(cpp_node_ref(cnode),
+                            num_leaves,
+                            paths,
+                            data,
+                            dtype_ids,
+                            num_elements);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_set_path_handle_external_batch(conduit_node *cnode,
+                                            conduit_index_t num_leaves,
+                                            const conduit_path **paths,
+                                            void **data,
+                                            const conduit_index_t *dtype_ids,
+                                            const conduit_index_t *num_elements)
+{
+    set_path_external_batch(cpp_node_ref(cnode),
+                            num_leaves,
+                            paths,
+                            data,
+                            dtype_ids,
+                            num_elements);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_set_path_batch(conduit_node *cnode,
+                            conduit_index_t num_leaves,
+                            const char **paths,
+                            const void **data,
+                            const conduit_index_t *dtype_ids,
+                            const conduit_index_t *num_elements,
+                            const conduit_index_t *dest_dtype_ids)
+{
+    set_path_batch(cpp_node_ref(cnode),
+                   num_leaves,
+                   paths,
+                   data,
+                   dtype_ids,
+                   num_elements,
+                   dest_dtype_ids);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_set_path_handle_batch(conduit_node *cnode,
+                                   conduit_index_t num_leaves,
+                                   const conduit_path **paths,
+                                   const void **data,
+                                   const conduit_index_t *dtype_ids,
+                                   const conduit_index_t *num_elements,
+                                   const conduit_index_t *dest_dtype_ids)
+{
+    set_path_batch(cpp_node_ref(cnode),
+                   num_leaves,
+                   paths,
+                   data,
+                   dtype_ids,
+                   num_elements,
+                   dest_dtype_ids);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_fetch_path_data_batch(conduit_node *cnode,
+                                   conduit_index_t num_leaves,
+                                   const char **paths,
+                                   void **data,
+                                   conduit_index_t *dtype_ids,
+                                   conduit_index_t *num_elements,
+                                   conduit_index_t *strides)
+{
+    fetch_path_data_batch(cpp_node_ref(cnode),
+                          num_leaves,
+                          paths,
+                          data,
+                          dtype_ids,
+                          num_elements,
+                          strides);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_fetch_path_handle_data_batch(conduit_node *cnode,
+                                          conduit_index_t num_leaves,
+                                          const conduit_path **paths,
+                                          void **data,
+                                          conduit_index_t *dtype_ids,
+                                          conduit_index_t *num_elements,
+                                          conduit_index_t *strides)
+{
+    fetch_path_data_batch(cpp_node_ref(cnode),
+                          num_leaves,
+                          paths,
+                          data,
+                          dtype_ids,
+                          num_elements,
+                          strides);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_fetch_path_copy_batch(const conduit_node *cnode,
+                                   conduit_index_t num_leaves,
+                                   const char **paths,
+                                   void **dest,
+                                   const conduit_index_t *dest_dtype_ids,
+                                   conduit_index_t *num_elements)
+{
+    fetch_path_copy_batch(cpp_node_ref(cnode),
+                          num_leaves,
+                          paths,
+                          dest,
+                          dest_dtype_ids,
+                          num_elements);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_fetch_path_handle_copy_batch(const conduit_node *cnode,
+                                          conduit_index_t num_leaves,
+                                          const conduit_path **paths,
+                                          void **dest,
+                                          const conduit_index_t *dest_dtype_ids,
+                                          conduit_index_t *num_elements)
+{
+    fetch_path_copy_batch(cpp_node_ref(cnode),
+                          num_leaves,
+                          paths,
+                          dest,
+                          dest_dtype_ids,
+                          num_elements);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end extern C
@@ -21,10 +21,17 @@
 #include "conduit_endianness.hpp"
 #include "conduit_data_type.hpp"
 #include "conduit_data_array.hpp"
+#include "conduit_data_view.hpp"
 #include "conduit_schema.hpp"
+#include "conduit_path.hpp"
+#include "conduit_external_layout.hpp"
 #include "conduit_node.hpp"
+#include "conduit_dispatch.hpp"
 #include "conduit_generator.hpp"
+#include "conduit_pack.hpp"
+#include "conduit_compression.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_annotations.hpp"
 #include "conduit_data_accessor.hpp"
 
 #endif
@@ -0,0 +1,230 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_annotations.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_annotations.hpp"
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(CONDUIT_USE_CALIPER)
+#include <caliper/cali.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils --
+//-----------------------------------------------------------------------------
+namespace utils
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::annotations --
+//-----------------------------------------------------------------------------
+namespace annotations
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::annotations::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+typedef std::chrono::high_resolution_clock clock;
+
+//-----------------------------------------------------------------------------
+struct OpenRegion
+{
+    std::string        name;
+    std::string        path;
+    clock::time_point  start;
+};
+
+//-----------------------------------------------------------------------------
+struct RegionStats
+{
+    index_t  count;
+    float64  total_time;
+    float64  min_time;
+    float64  max_time;
+};
+
+// open regions of the calling thread, innermost last
+static thread_local std::vector<OpenRegion> open_regions;
+
+// recorded regions of all threads, keyed by path
+static std::map<std::string,RegionStats> region_stats;
+static std::mutex region_stats_mutex;
+
+//-----------------------------------------------------------------------------
+static void
+record(const std::string &path, float64 time)
+{
+    std::lock_guard<std::mutex> lock(region_stats_mutex);
+    std::map<std::string,RegionStats>::iterator itr = region_stats.find(path);
+    if(itr == region_stats.end())
+    {
+        RegionStats stats = {1, time, time, time};
+        region_stats[path] = stats;
+    }
+    else
+    {
+        RegionStats &stats = itr->second;
+        stats.count++;
+        stats.total_time += time;
+        stats.min_time = std::min(stats.min_time, time);
+        stats.max_time = std::max(stats.max_time, time);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::annotations::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+bool
+supported()
+{
+#if defined(CONDUIT_USE_ANNOTATIONS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool
+caliper_supported()
+{
+#if defined(CONDUIT_USE_CALIPER)
+    return true;
+#else
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+begin(const char *name)
+{
+    detail::OpenRegion region;
+    region.name = name;
+    if(detail::open_regions.empty())
+    {
+        region.path = region.name;
+    }
+    else
+    {
+        region.path = detail::open_regions.back().path + "/" + region.name;
+    }
+#if defined(CONDUIT_USE_CALIPER)
+    cali_begin_region(name);
+#endif
+    region.start = detail::clock::now();
+    detail::open_regions.push_back(region);
+}
+
+//-----------------------------------------------------------------------------
+void
+end(const char *name)
+{
+    const detail::clock::time_point stop = detail::clock::now();
+
+    std::vector<detail::OpenRegion> &regions = detail::open_regions;
+    index_t idx = (index_t)regions.size() - 1;
+    while(idx >= 0 && regions[(size_t)idx].name != name)
+    {
+        idx--;
+    }
+
+    if(idx < 0)
+    {
+        return;
+    }
+
+    const detail::OpenRegion &region = regions[(size_t)idx];
+    const std::chrono::duration<float64> time = stop - region.start;
+    detail::record(region.path, time.count());
+#if defined(CONDUIT_USE_CALIPER)
+    // caliper regions must be closed innermost first
+    for(index_t i = (index_t)regions.size() - 1; i >= idx; i--)
+    {
+        cali_end_region(regions[(size_t)i].name.c_str());
+    }
+#endif
+    regions.resize((size_t)idx);
+}
+
+//-----------------------------------------------------------------------------
+void
+timings(Node &out)
+{
+    out.reset();
+    std::lock_guard<std::mutex> lock(detail::region_stats_mutex);
+    std::map<std::string,detail::RegionStats>::const_iterator itr;
+    for(itr = detail::region_stats.begin();
+        itr != detail::region_stats.end();
+        itr++)
+    {
+        Node &region = out[itr->first];
+        region["count"]      = itr->second.count;
+        region["total_time"] = itr->second.total_time;
+        region["min_time"]   = itr->second.min_time;
+        region["max_time"]   = itr->second.max_time;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+reset()
+{
+    std::lock_guard<std::mutex> lock(detail::region_stats_mutex);
+    detail::region_stats.clear();
+}
+
+//-----------------------------------------------------------------------------
+ScopedRegion::ScopedRegion(const char *name)
+: m_name(name)
+{
+    begin(m_name);
+}
+
+//-----------------------------------------------------------------------------
+ScopedRegion::~ScopedRegion()
+{
+    end(m_name);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::annotations --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
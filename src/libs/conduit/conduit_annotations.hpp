@@ -0,0 +1,156 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_annotations.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_ANNOTATIONS_HPP
+#define CONDUIT_ANNOTATIONS_HPP
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+//
+/// Timing annotations.
+///
+/// The CONDUIT_ANNOTATE_MARK_* macros mark timed regions at the major
+/// phases of Conduit, Blueprint and Relay operations. They compile to
+/// nothing unless Conduit is configured with ENABLE_ANNOTATIONS=ON.
+///
+/// When enabled, regions are recorded by a built-in aggregator. Regions
+/// opened while another region is open on the same thread are nested
+/// under it, and utils::annotations::timings() exports the call counts
+/// and times per region as a Node. If Conduit is also built with Caliper
+/// (CALIPER_DIR), regions are forwarded to Caliper as well.
+///
+/// Region names may not contain '/'.
+///
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_USE_ANNOTATIONS)
+
+#define CONDUIT_ANNOTATE_CONCAT_IMPL( a, b ) a ## b
+#define CONDUIT_ANNOTATE_CONCAT( a, b ) CONDUIT_ANNOTATE_CONCAT_IMPL(a, b)
+
+#define CONDUIT_ANNOTATE_MARK_BEGIN( name )                          \
+    conduit::utils::annotations::begin(name)
+
+#define CONDUIT_ANNOTATE_MARK_END( name )                            \
+    conduit::utils::annotations::end(name)
+
+#define CONDUIT_ANNOTATE_MARK_SCOPE( name )                          \
+    conduit::utils::annotations::ScopedRegion                        \
+        CONDUIT_ANNOTATE_CONCAT(conduit_annotate_scope_, __LINE__)(name)
+
+#define CONDUIT_ANNOTATE_MARK_FUNCTION                               \
+    CONDUIT_ANNOTATE_MARK_SCOPE(__func__)
+
+#else
+
+#define CONDUIT_ANNOTATE_MARK_BEGIN( name )
+#define CONDUIT_ANNOTATE_MARK_END( name )
+#define CONDUIT_ANNOTATE_MARK_SCOPE( name )
+#define CONDUIT_ANNOTATE_MARK_FUNCTION
+
+#endif
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+class Node;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils --
+//-----------------------------------------------------------------------------
+namespace utils
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::annotations --
+//-----------------------------------------------------------------------------
+namespace annotations
+{
+
+//-----------------------------------------------------------------------------
+/// returns true if the library's annotation macros are compiled in
+//-----------------------------------------------------------------------------
+bool CONDUIT_API supported();
+
+//-----------------------------------------------------------------------------
+/// returns true if annotations are forwarded to Caliper
+//-----------------------------------------------------------------------------
+bool CONDUIT_API caliper_supported();
+
+//-----------------------------------------------------------------------------
+/// open and close a timed region on the calling thread.
+///
+/// end() closes the most recent open region with the given name (and any
+/// regions left open inside it, which are not recorded). Closing a region
+/// that is not open is a no-op.
+//-----------------------------------------------------------------------------
+void CONDUIT_API begin(const char *name);
+void CONDUIT_API end(const char *name);
+
+//-----------------------------------------------------------------------------
+/// exports the recorded regions, one child per region with its nested
+/// regions as children:
+///
+///   partition:
+///     count: 1
+///     total_time: 0.25
+///     min_time: 0.25
+///     max_time: 0.25
+///     execute:
+///       count: 1
+///       ...
+///
+/// times are in seconds.
+//-----------------------------------------------------------------------------
+void CONDUIT_API timings(Node &out);
+
+//-----------------------------------------------------------------------------
+/// clears the recorded regions
+//-----------------------------------------------------------------------------
+void CONDUIT_API reset();
+
+//-----------------------------------------------------------------------------
+/// opens a region for the lifetime of the object
+//-----------------------------------------------------------------------------
+class CONDUIT_API ScopedRegion
+{
+public:
+    explicit ScopedRegion(const char *name);
+            ~ScopedRegion();
+
+private:
+    ScopedRegion(const ScopedRegion &);
+    ScopedRegion &operator=(const ScopedRegion &);
+
+    const char *m_name;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::annotations --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,574 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_compression.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_compression.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::compression --
+//-----------------------------------------------------------------------------
+namespace compression
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::compression::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// block layout (in the writer's endianness):
+//   [ 0, 4) magic string "CNDZ"
+//   [ 4, 5) method id
+//   [ 5, 6) shuffle element bytes (0 or 1 for no shuffle)
+//   [ 6, 8) unused
+//   [ 8,16) decompressed size
+//   [16, .) compressed stream
+//-----------------------------------------------------------------------------
+static const char    BLOCK_MAGIC[4] = {'C','N','D','Z'};
+static const index_t BLOCK_HEADER_BYTES = 16;
+static const uint8   METHOD_LZ = 1;
+
+//-----------------------------------------------------------------------------
+// lz stream:
+//  a series of sequences, each
+//   [token] [extra literal length bytes] [literals]
+//   [offset (2 bytes, little endian)] [extra match length bytes]
+//  the high nibble of the token is the literal length, the low nibble the
+//  match length minus LZ_MIN_MATCH, a nibble of 15 is continued by bytes
+//  that are added to it until a byte is less than 255. The last sequence
+//  ends after its literals.
+//-----------------------------------------------------------------------------
+static const index_t LZ_MIN_MATCH  = 4;
+static const index_t LZ_MAX_OFFSET = 65535;
+static const int     LZ_HASH_BITS  = 14;
+
+//-----------------------------------------------------------------------------
+static inline uint32
+read_uint32(const uint8 *ptr)
+{
+    uint32 res;
+    std::memcpy(&res, ptr, sizeof(uint32));
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static inline uint32
+lz_hash(uint32 value)
+{
+    return (value * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+//-----------------------------------------------------------------------------
+static void
+lz_write_length(index_t len, std::vector<uint8> &out)
+{
+    len -= 15;
+    while(len >= 255)
+    {
+        out.push_back(255);
+        len -= 255;
+    }
+    out.push_back((uint8)len);
+}
+
+//-----------------------------------------------------------------------------
+static void
+lz_write_sequence(const uint8 *literals,
+                  index_t num_literals,
+                  index_t offset,
+                  index_t match_len,
+                  std::vector<uint8> &out)
+{
+    const index_t match_code = match_len > 0 ? match_len - LZ_MIN_MATCH : 0;
+    out.push_back((uint8)((std::min(num_literals, (index_t)15) << 4) |
+                          std::min(match_code, (index_t)15)));
+    if(num_literals >= 15)
+    {
+        lz_write_length(num_literals, out);
+    }
+    out.insert(out.end(), literals, literals + num_literals);
+
+    if(match_len > 0)
+    {
+        out.push_back((uint8)(offset & 0xff));
+        out.push_back((uint8)(offset >> 8));
+        if(match_code >= 15)
+        {
+            lz_write_length(match_code, out);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+lz_compress(const uint8 *src,
+            index_t nbytes,
+            std::vector<uint8> &out)
+{
+    std::vector<index_t> table((size_t)1 << LZ_HASH_BITS, -1);
+
+    index_t anchor = 0;
+    index_t pos    = 0;
+    index_t misses = 0;
+    while(nbytes >= LZ_MIN_MATCH && pos <= nbytes - LZ_MIN_MATCH)
+    {
+        const uint32  seq  = read_uint32(src + pos);
+        const uint32  hval = lz_hash(seq);
+        const index_t cand = table[hval];
+        table[hval] = pos;
+
+        if(cand >= 0 &&
+           pos - cand <= LZ_MAX_OFFSET &&
+           read_uint32(src + cand) == seq)
+        {
+            index_t match_len = LZ_MIN_MATCH;
+            while(pos + match_len < nbytes &&
+                  src[cand + match_len] == src[pos + match_len])
+            {
+                match_len++;
+            }
+            lz_write_sequence(src + anchor,
+                              pos - anchor,
+                              pos - cand,
+                              match_len,
+                              out);
+            pos   += match_len;
+            anchor = pos;
+            misses = 0;
+        }
+        else
+        {
+            // step faster through data that doesn't compress
+            pos += 1 + (misses++ >> 5);
+        }
+    }
+
+    lz_write_sequence(src + anchor, nbytes - anchor, 0, 0, out);
+}
+
+//-----------------------------------------------------------------------------
+static index_t
+lz_read_length(const uint8 *src,
+               index_t nbytes,
+               index_t &pos)
+{
+    index_t res = 0;
+    uint8 curr = 255;
+    while(curr == 255)
+    {
+        if(pos >= nbytes)
+        {
+            CONDUIT_ERROR("compression: corrupt lz stream (truncated length)");
+        }
+        curr = src[pos++];
+        res += curr;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static void
+lz_decompress(const uint8 *src,
+              index_t nbytes,
+              uint8 *dest,
+              index_t dest_bytes)
+{
+    index_t ipos = 0;
+    index_t opos = 0;
+    bool    done = false;
+    while(ipos < nbytes)
+    {
+        const uint8 token = src[ipos++];
+
+        index_t num_literals = token >> 4;
+        if(num_literals == 15)
+        {
+            num_literals += lz_read_length(src, nbytes, ipos);
+        }
+        if(num_literals > nbytes - ipos || num_literals > dest_bytes - opos)
+        {
+            CONDUIT_ERROR("compression: corrupt lz stream (literals overrun)");
+        }
+        std::memcpy(dest + opos, src + ipos, (size_t)num_literals);
+        ipos += num_literals;
+        opos += num_literals;
+
+        // the last sequence has no match
+        if(ipos == nbytes)
+        {
+            done = true;
+            break;
+        }
+
+        if(nbytes - ipos < 2)
+        {
+            CONDUIT_ERROR("compression: corrupt lz stream (truncated offset)");
+        }
+        const index_t offset = (index_t)src[ipos] |
+                               ((index_t)src[ipos + 1] << 8);
+        ipos += 2;
+
+        index_t match_len = token & 15;
+        if(match_len == 15)
+        {
+            match_len += lz_read_length(src, nbytes, ipos);
+        }
+        match_len += LZ_MIN_MATCH;
+
+        if(offset == 0 || offset > opos || match_len > dest_bytes - opos)
+        {
+            CONDUIT_ERROR("compression: corrupt lz stream (bad match)");
+        }
+
+        uint8 *match = dest + opos - offset;
+        if(offset >= match_len)
+        {
+            std::memcpy(dest + opos, match, (size_t)match_len);
+        }
+        else
+        {
+            // overlapping matches repeat the last offset bytes
+            for(index_t i = 0; i < match_len; i++)
+            {
+                dest[opos + i] = match[i];
+            }
+        }
+        opos += match_len;
+    }
+
+    if(!done)
+    {
+        CONDUIT_ERROR("compression: corrupt lz stream (truncated)");
+    }
+
+    if(opos != dest_bytes)
+    {
+        CONDUIT_ERROR("compression: corrupt lz stream (decompressed "
+                      << opos << " bytes, expected " << dest_bytes << ")");
+    }
+}
+
+//-----------------------------------------------------------------------------
+// transposes the bytes of nbytes / ele_bytes elements so bytes of the same
+// significance are adjacent, trailing bytes are copied as is
+static void
+shuffle(const uint8 *src,
+        index_t nbytes,
+        index_t ele_bytes,
+        uint8 *dest)
+{
+    const index_t num_eles = nbytes / ele_bytes;
+    for(index_t b = 0; b < ele_bytes; b++)
+    {
+        uint8 *dest_b = dest + b * num_eles;
+        for(index_t e = 0; e < num_eles; e++)
+        {
+            dest_b[e] = src[e * ele_bytes + b];
+        }
+    }
+    const index_t done = num_eles * ele_bytes;
+    std::memcpy(dest + done, src + done, (size_t)(nbytes - done));
+}
+
+//-----------------------------------------------------------------------------
+static void
+unshuffle(const uint8 *src,
+          index_t nbytes,
+          index_t ele_bytes,
+          uint8 *dest)
+{
+    const index_t num_eles = nbytes / ele_bytes;
+    for(index_t b = 0; b < ele_bytes; b++)
+    {
+        const uint8 *src_b = src + b * num_eles;
+        for(index_t e = 0; e < num_eles; e++)
+        {
+            dest[e * ele_bytes + b] = src_b[e];
+        }
+    }
+    const index_t done = num_eles * ele_bytes;
+    std::memcpy(dest + done, src + done, (size_t)(nbytes - done));
+}
+
+//-----------------------------------------------------------------------------
+static void
+read_header(const uint8 *block,
+            index_t block_bytes,
+            uint8 &method,
+            index_t &ele_bytes,
+            index_t &nbytes)
+{
+    if(block == NULL ||
+       block_bytes < BLOCK_HEADER_BYTES ||
+       std::memcmp(block, BLOCK_MAGIC, 4) != 0)
+    {
+        CONDUIT_ERROR("compression: invalid compressed block");
+    }
+    method    = block[4];
+    ele_bytes = block[5];
+    uint64 size = 0;
+    std::memcpy(&size, block + 8, sizeof(uint64));
+    nbytes = (index_t)size;
+}
+
+//-----------------------------------------------------------------------------
+// Decompressed cache state, never destroyed so nodes destroyed during
+// static destruction can still remove their entries.
+//-----------------------------------------------------------------------------
+struct CacheState
+{
+    CacheState()
+    : bytes(0),
+      budget((index_t)64 * 1024 * 1024)
+    {}
+
+    std::mutex                    mutex;
+    // most recently used first
+    std::list<CacheEntry*>        entries;
+    std::unordered_map<CacheEntry*,
+                       std::list<CacheEntry*>::iterator> lookup;
+    index_t                       bytes;
+    index_t                       budget;
+};
+
+//-----------------------------------------------------------------------------
+static CacheState &
+cache_state()
+{
+    static CacheState *state = new CacheState();
+    return *state;
+}
+
+//-----------------------------------------------------------------------------
+// evicts least recently used entries while over budget, keeping the two
+// most recently used (called with the lock held)
+static void
+cache_trim(CacheState &state, size_t keep)
+{
+    while(state.bytes > state.budget && state.entries.size() > keep)
+    {
+        CacheEntry *entry = state.entries.back();
+        state.entries.pop_back();
+        state.lookup.erase(entry);
+        state.bytes -= entry->cached_bytes();
+        entry->evict();
+    }
+}
+
+//-----------------------------------------------------------------------------
+CacheEntry::~CacheEntry()
+{}
+
+//-----------------------------------------------------------------------------
+void
+cache_touch(CacheEntry *entry)
+{
+    CacheState &state = cache_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto itr = state.lookup.find(entry);
+    if(itr != state.lookup.end())
+    {
+        state.entries.splice(state.entries.begin(),
+                             state.entries,
+                             itr->second);
+    }
+    else
+    {
+        state.entries.push_front(entry);
+        state.lookup[entry] = state.entries.begin();
+        state.bytes += entry->cached_bytes();
+    }
+    cache_trim(state, 2);
+}
+
+//-----------------------------------------------------------------------------
+void
+cache_remove(CacheEntry *entry)
+{
+    CacheState &state = cache_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto itr = state.lookup.find(entry);
+    if(itr != state.lookup.end())
+    {
+        state.bytes -= entry->cached_bytes();
+        state.entries.erase(itr->second);
+        state.lookup.erase(itr);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::compression::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+bool
+supports_method(const std::string &method)
+{
+    return method == "lz";
+}
+
+//-----------------------------------------------------------------------------
+void
+compress(const void *data,
+         index_t nbytes,
+         index_t element_bytes,
+         const std::string &method,
+         std::vector<uint8> &res)
+{
+    if(!supports_method(method))
+    {
+        CONDUIT_ERROR("compression: unsupported method '" << method << "'"
+                      << " (supported methods: \"lz\")");
+    }
+
+    const uint8 *src = static_cast<const uint8*>(data);
+    index_t ele_bytes = (element_bytes > 1 && element_bytes < 256) ?
+                        element_bytes : 0;
+
+    std::vector<uint8> shuffled;
+    if(ele_bytes > 1 && nbytes > 0)
+    {
+        shuffled.resize((size_t)nbytes);
+        detail::shuffle(src, nbytes, ele_bytes, shuffled.data());
+        src = shuffled.data();
+    }
+
+    res.clear();
+    res.reserve((size_t)(detail::BLOCK_HEADER_BYTES + nbytes / 2 + 16));
+    res.resize((size_t)detail::BLOCK_HEADER_BYTES, 0);
+    std::memcpy(res.data(), detail::BLOCK_MAGIC, 4);
+    res[4] = detail::METHOD_LZ;
+    res[5] = (uint8)ele_bytes;
+    const uint64 size = (uint64)nbytes;
+    std::memcpy(res.data() + 8, &size, sizeof(uint64));
+
+    detail::lz_compress(src, nbytes, res);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+decompressed_bytes(const uint8 *block,
+                   index_t block_bytes)
+{
+    uint8   method = 0;
+    index_t ele_bytes = 0;
+    index_t nbytes = 0;
+    detail::read_header(block, block_bytes, method, ele_bytes, nbytes);
+    return nbytes;
+}
+
+//-----------------------------------------------------------------------------
+void
+decompress(const uint8 *block,
+           index_t block_bytes,
+           void *dest)
+{
+    uint8   method = 0;
+    index_t ele_bytes = 0;
+    index_t nbytes = 0;
+    detail::read_header(block, block_bytes, method, ele_bytes, nbytes);
+
+    if(method != detail::METHOD_LZ)
+    {
+        CONDUIT_ERROR("compression: unknown method id " << (int)method);
+    }
+
+    const uint8 *stream = block + detail::BLOCK_HEADER_BYTES;
+    const index_t stream_bytes = block_bytes - detail::BLOCK_HEADER_BYTES;
+
+    if(ele_bytes > 1 && nbytes > 0)
+    {
+        std::vector<uint8> shuffled((size_t)nbytes);
+        detail::lz_decompress(stream, stream_bytes, shuffled.data(), nbytes);
+        detail::unshuffle(shuffled.data(),
+                          nbytes,
+                          ele_bytes,
+                          static_cast<uint8*>(dest));
+    }
+    else
+    {
+        detail::lz_decompress(stream,
+                              stream_bytes,
+                              static_cast<uint8*>(dest),
+                              nbytes);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+set_cache_budget(index_t nbytes)
+{
+    detail::CacheState &state = detail::cache_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.budget = std::max((index_t)0, nbytes);
+    detail::cache_trim(state, 2);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+cache_budget()
+{
+    detail::CacheState &state = detail::cache_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.budget;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+cache_bytes()
+{
+    detail::CacheState &state = detail::cache_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.bytes;
+}
+
+//-----------------------------------------------------------------------------
+void
+clear_cache()
+{
+    detail::CacheState &state = detail::cache_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    const index_t budget = state.budget;
+    state.budget = 0;
+    detail::cache_trim(state, 0);
+    state.budget = budget;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::compression --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,144 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_compression.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_COMPRESSION_HPP
+#define CONDUIT_COMPRESSION_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::compression --
+//-----------------------------------------------------------------------------
+///
+/// Lossless byte compression used for compressed Node leaves
+/// (see Node::compress).
+///
+/// Methods:
+///   "lz"  a byte oriented LZ77 codec (in the style of LZ4) built into
+///         conduit, so compressed leaves need no third party libraries.
+///
+/// With shuffle, the bytes of each element are first transposed so the
+/// bytes of the same significance are stored together (like the HDF5
+/// shuffle filter). This makes the slowly varying high bytes of integer and
+/// floating point arrays compress far better.
+///
+/// Compressed blocks start with a small header holding the method, the
+/// shuffle element size and the original size, blocks are written in the
+/// machine's endianness.
+///
+//-----------------------------------------------------------------------------
+namespace compression
+{
+
+//-----------------------------------------------------------------------------
+/// returns true if method names a supported compression method
+//-----------------------------------------------------------------------------
+bool CONDUIT_API supports_method(const std::string &method);
+
+//-----------------------------------------------------------------------------
+/// compresses the nbytes bytes at data into res. Bytes are shuffled by
+/// element_bytes first (element_bytes <= 1 disables the shuffle).
+//-----------------------------------------------------------------------------
+void CONDUIT_API compress(const void *data,
+                          index_t nbytes,
+                          index_t element_bytes,
+                          const std::string &method,
+                          std::vector<uint8> &res);
+
+//-----------------------------------------------------------------------------
+/// returns the original size of a block created by compress()
+//-----------------------------------------------------------------------------
+index_t CONDUIT_API decompressed_bytes(const uint8 *block,
+                                       index_t block_bytes);
+
+//-----------------------------------------------------------------------------
+/// decompresses a block created by compress() into dest, which must hold
+/// decompressed_bytes(block, block_bytes) bytes. Raises an Error if the
+/// block is corrupt.
+//-----------------------------------------------------------------------------
+void CONDUIT_API decompress(const uint8 *block,
+                            index_t block_bytes,
+                            void *dest);
+
+//-----------------------------------------------------------------------------
+/// Decompressed cache
+///
+/// Const access to a compressed leaf decompresses it into a cache buffer
+/// that is shared by all compressed leaves of the process. When the cached
+/// bytes exceed the budget, the least recently used buffers are released
+/// (their leaves decompress again on the next access). The two most
+/// recently used buffers are always kept, so operations that read two
+/// leaves at once (like diff) see both.
+///
+/// The default budget is 64 MiB.
+//-----------------------------------------------------------------------------
+void    CONDUIT_API set_cache_budget(index_t nbytes);
+index_t CONDUIT_API cache_budget();
+/// returns the number of decompressed bytes held in the cache
+index_t CONDUIT_API cache_bytes();
+/// releases all cached buffers
+void    CONDUIT_API clear_cache();
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::compression::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+/// interface of the buffers held in the decompressed cache
+//-----------------------------------------------------------------------------
+class CONDUIT_API CacheEntry
+{
+public:
+    virtual         ~CacheEntry();
+    /// bytes held by the entry while it is cached
+    virtual index_t  cached_bytes() const = 0;
+    /// releases the cached bytes, called by the cache with its lock held
+    virtual void     evict() = 0;
+};
+
+/// marks entry as the most recently used, adding it to the cache if
+/// needed, and evicts the least recently used entries over the budget
+void CONDUIT_API cache_touch(CacheEntry *entry);
+/// removes entry from the cache (without evicting it)
+void CONDUIT_API cache_remove(CacheEntry *entry);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::compression::detail --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::compression --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -13,8 +13,15 @@
 // -- standard includes -- 
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <limits>
+#include <type_traits>
+#include <vector>
+
+#if defined(CONDUIT_USE_OPENMP)
+#include <omp.h>
+#endif
 
 
 //-----------------------------------------------------------------------------
@@ -23,6 +30,7 @@
 #include "conduit_node.hpp"
 #include "conduit_utils.hpp"
 #include "conduit_log.hpp"
+#include "conduit_fmt/conduit_fmt.h"
 
 // Easier access to the Conduit logging functions
 using namespace conduit::utils;
@@ -34,6 +42,561 @@ namespace conduit
 {
 
 
+//---------------------------------------------------------------------------//
+///
+/// Summary Stats Kernels
+///
+/// These helpers walk raw element memory instead of calling element(i),
+/// which avoids recomputing the element index for every value.
+/// Contiguous arrays (stride == sizeof(T)) and strided arrays use the same
+/// kernel source, the Contiguous template arg lets the compiler drop the
+/// stride multiply from the contiguous loads. Each kernel keeps
+/// REDUCE_LANES independent partial results, so the compiler can keep
+/// them in vector registers without reordering a single dependent chain.
+///
+/// When conduit is built with OpenMP support, arrays with at least
+/// REDUCE_PARALLEL_THRESHOLD elements are split into one chunk per thread.
+///
+//---------------------------------------------------------------------------//
+namespace detail
+{
+
+static const index_t REDUCE_LANES = 8;
+static const index_t REDUCE_PARALLEL_THRESHOLD = 1 << 20;
+
+//---------------------------------------------------------------------------//
+template <typename T, bool Contiguous>
+inline const T &
+reduce_load(const uint8 *data, index_t stride, index_t idx)
+{
+    return Contiguous ? ((const T*)data)[idx]
+                      : *((const T*)(data + idx * stride));
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, typename R>
+struct ReduceSum
+{
+    typedef R value_type;
+
+    static value_type identity()
+    {
+        return R(0);
+    }
+
+    static value_type combine(const value_type &a, const value_type &b)
+    {
+        return a + b;
+    }
+
+    template <bool Contiguous>
+    static value_type run(const uint8 *data, index_t stride, index_t num_eles)
+    {
+        R lanes[REDUCE_LANES];
+        for(index_t l = 0; l < REDUCE_LANES; l++)
+        {
+            lanes[l] = R(0);
+        }
+
+        index_t i = 0;
+        for(; i + REDUCE_LANES <= num_eles; i += REDUCE_LANES)
+        {
+            for(index_t l = 0; l < REDUCE_LANES; l++)
+            {
+                lanes[l] += (R)reduce_load<T,Contiguous>(data, stride, i + l);
+            }
+        }
+
+        R res = R(0);
+        for(index_t l = 0; l < REDUCE_LANES; l++)
+        {
+            res += lanes[l];
+        }
+
+        for(; i < num_eles; i++)
+        {
+            res += (R)reduce_load<T,Contiguous>(data, stride, i);
+        }
+        return res;
+    }
+};
+
+//---------------------------------------------------------------------------//
+template <typename T>
+struct MinMax
+{
+    T min;
+    T max;
+};
+
+//---------------------------------------------------------------------------//
+template <typename T>
+struct ReduceMinMax
+{
+    typedef MinMax<T> value_type;
+
+    static value_type identity()
+    {
+        value_type res;
+        res.min = std::numeric_limits<T>::max();
+        res.max = std::numeric_limits<T>::lowest();
+        return res;
+    }
+
+    static value_type combine(const value_type &a, const value_type &b)
+    {
+        value_type res;
+        res.min = b.min < a.min ? b.min : a.min;
+        res.max = b.max > a.max ? b.max : a.max;
+        return res;
+    }
+
+    template <bool Contiguous>
+    static value_type run(const uint8 *data, index_t stride, index_t num_eles)
+    {
+        T lanes_min[REDUCE_LANES];
+        T lanes_max[REDUCE_LANES];
+        for(index_t l = 0; l < REDUCE_LANES; l++)
+        {
+            lanes_min[l] = std::numeric_limits<T>::max();
+            lanes_max[l] = std::numeric_limits<T>::lowest();
+        }
+
+        index_t i = 0;
+        for(; i + REDUCE_LANES <= num_eles; i += REDUCE_LANES)
+        {
+            for(index_t l = 0; l < REDUCE_LANES; l++)
+            {
+                const T val = reduce_load<T,Contiguous>(data, stride, i + l);
+                lanes_min[l] = val < lanes_min[l] ? val : lanes_min[l];
+                lanes_max[l] = val > lanes_max[l] ? val : lanes_max[l];
+            }
+        }
+
+        value_type res = identity();
+        for(index_t l = 0; l < REDUCE_LANES; l++)
+        {
+            res.min = lanes_min[l] < res.min ? lanes_min[l] : res.min;
+            res.max = lanes_max[l] > res.max ? lanes_max[l] : res.max;
+        }
+
+        for(; i < num_eles; i++)
+        {
+            const T val = reduce_load<T,Contiguous>(data, stride, i);
+            res.min = val < res.min ? val : res.min;
+            res.max = val > res.max ? val : res.max;
+        }
+        return res;
+    }
+};
+
+//---------------------------------------------------------------------------//
+template <typename T>
+struct Stats
+{
+    T       min;
+    T       max;
+    float64 sum;
+};
+
+//---------------------------------------------------------------------------//
+template <typename T>
+struct ReduceStats
+{
+    typedef Stats<T> value_type;
+
+    static value_type identity()
+    {
+        value_type res;
+        res.min = std::numeric_limits<T>::max();
+        res.max = std::numeric_limits<T>::lowest();
+        res.sum = 0.0;
+        return res;
+    }
+
+    static value_type combine(const value_type &a, const value_type &b)
+    {
+        value_type res;
+        res.min = b.min < a.min ? b.min : a.min;
+        res.max = b.max > a.max ? b.max : a.max;
+        res.sum = a.sum + b.sum;
+        return res;
+    }
+
+    template <bool Contiguous>
+    static value_type run(const uint8 *data, index_t stride, index_t num_eles)
+    {
+        T       lanes_min[REDUCE_LANES];
+        T       lanes_max[REDUCE_LANES];
+        float64 lanes_sum[REDUCE_LANES];
+        for(index_t l = 0; l < REDUCE_LANES; l++)
+        {
+            lanes_min[l] = std::numeric_limits<T>::max();
+            lanes_max[l] = std::numeric_limits<T>::lowest();
+            lanes_sum[l] = 0.0;
+        }
+
+        index_t i = 0;
+        for(; i + REDUCE_LANES <= num_eles; i += REDUCE_LANES)
+        {
+            for(index_t l = 0; l < REDUCE_LANES; l++)
+            {
+                const T val = reduce_load<T,Contiguous>(data, stride, i + l);
+                lanes_min[l] = val < lanes_min[l] ? val : lanes_min[l];
+                lanes_max[l] = val > lanes_max[l] ? val : lanes_max[l];
+                lanes_sum[l] += (float64)val;
+            }
+        }
+
+        value_type res = identity();
+        for(index_t l = 0; l < REDUCE_LANES; l++)
+        {
+            res.min = lanes_min[l] < res.min ? lanes_min[l] : res.min;
+            res.max = lanes_max[l] > res.max ? lanes_max[l] : res.max;
+            res.sum += lanes_sum[l];
+        }
+
+        for(; i < num_eles; i++)
+        {
+            const T val = reduce_load<T,Contiguous>(data, stride, i);
+            res.min = val < res.min ? val : res.min;
+            res.max = val > res.max ? val : res.max;
+            res.sum += (float64)val;
+        }
+        return res;
+    }
+};
+
+//---------------------------------------------------------------------------//
+template <typename T, typename Op>
+typename Op::value_type
+reduce_serial(const uint8 *data, index_t stride, index_t num_eles)
+{
+    if(stride == (index_t)sizeof(T))
+    {
+        return Op::template run<true>(data, stride, num_eles);
+    }
+    return Op::template run<false>(data, stride, num_eles);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, typename Op>
+typename Op::value_type
+reduce(const void *data, index_t stride, index_t num_eles)
+{
+    const uint8 *data_ptr = (const uint8*)data;
+    if(num_eles <= 0 || data == NULL)
+    {
+        return Op::identity();
+    }
+
+#if defined(CONDUIT_USE_OPENMP)
+    if(num_eles >= REDUCE_PARALLEL_THRESHOLD &&
+       omp_get_max_threads() > 1 &&
+       !omp_in_parallel())
+    {
+        std::vector<typename Op::value_type> partials(omp_get_max_threads(),
+                                                      Op::identity());
+        #pragma omp parallel
+        {
+            index_t num_threads = (index_t)omp_get_num_threads();
+            index_t thread_id   = (index_t)omp_get_thread_num();
+            index_t chunk = (num_eles + num_threads - 1) / num_threads;
+            index_t begin = std::min(num_eles, thread_id * chunk);
+            index_t end   = std::min(num_eles, begin + chunk);
+            if(begin < end)
+            {
+                partials[(size_t)thread_id] =
+                    reduce_serial<T,Op>(data_ptr + begin * stride,
+                                        stride,
+                                        end - begin);
+            }
+        }
+
+        typename Op::value_type res = Op::identity();
+        for(size_t i = 0; i < partials.size(); i++)
+        {
+            res = Op::combine(res, partials[i]);
+        }
+        return res;
+    }
+#endif
+
+    return reduce_serial<T,Op>(data_ptr, stride, num_eles);
+}
+
+//---------------------------------------------------------------------------//
+///
+/// Boolean Diff Kernels
+///
+/// Used by has_diff and has_diff_compatible. Arrays are compared in blocks
+/// of DIFF_BLOCK_ELES elements, so a mismatch stops the comparison early.
+/// Blocks of two contiguous arrays are first compared with memcmp: equal
+/// bytes can't differ by more than epsilon, so only mismatched blocks of
+/// floating point arrays need the element wise epsilon test.
+///
+/// When conduit is built with OpenMP support, arrays with at least
+/// DIFF_PARALLEL_THRESHOLD elements are split into one chunk per thread,
+/// and threads stop once any thread finds a mismatch.
+///
+//---------------------------------------------------------------------------//
+static const index_t DIFF_BLOCK_ELES = 4096;
+static const index_t DIFF_PARALLEL_THRESHOLD = 1 << 20;
+
+//---------------------------------------------------------------------------//
+template <typename T, bool Contiguous>
+bool
+diff_block_run(const uint8 *t_data,
+               index_t t_stride,
+               const uint8 *o_data,
+               index_t o_stride,
+               index_t num_eles,
+               const float64 epsilon)
+{
+    // accumulate without branching so the loop can be vectorized
+    bool res = false;
+    for(index_t i = 0; i < num_eles; i++)
+    {
+        const T t_val = reduce_load<T,Contiguous>(t_data, t_stride, i);
+        const T o_val = reduce_load<T,Contiguous>(o_data, o_stride, i);
+        if(std::numeric_limits<T>::is_integer)
+        {
+            res |= t_val != o_val;
+        }
+        else
+        {
+            const T delta = t_val - o_val;
+            res |= (delta > epsilon) | (delta < -epsilon);
+        }
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+bool
+diff_block(const uint8 *t_data,
+           index_t t_stride,
+           const uint8 *o_data,
+           index_t o_stride,
+           index_t num_eles,
+           const float64 epsilon)
+{
+    if(t_stride == (index_t)sizeof(T) && o_stride == (index_t)sizeof(T))
+    {
+        if(memcmp(t_data, o_data, (size_t)num_eles * sizeof(T)) == 0)
+        {
+            return false;
+        }
+
+        if(std::numeric_limits<T>::is_integer)
+        {
+            return true;
+        }
+
+        return diff_block_run<T,true>(t_data, t_stride,
+                                      o_data, o_stride,
+                                      num_eles, epsilon);
+    }
+
+    return diff_block_run<T,false>(t_data, t_stride,
+                                   o_data, o_stride,
+                                   num_eles, epsilon);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+bool
+diff_range(const uint8 *t_data,
+           index_t t_stride,
+           const uint8 *o_data,
+           index_t o_stride,
+           index_t begin,
+           index_t end,
+           const float64 epsilon,
+           const std::atomic<bool> *found)
+{
+    for(index_t i = begin; i < end; i += DIFF_BLOCK_ELES)
+    {
+        if(found != NULL && found->load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        index_t n = std::min(DIFF_BLOCK_ELES, end - i);
+        if(diff_block<T>(t_data + i * t_stride, t_stride,
+                         o_data + i * o_stride, o_stride,
+                         n, epsilon))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+bool
+has_diff(const void *t_data,
+         index_t t_stride,
+         const void *o_data,
+         index_t o_stride,
+         index_t num_eles,
+         const float64 epsilon)
+{
+    const uint8 *t_ptr = (const uint8*)t_data;
+    const uint8 *o_ptr = (const uint8*)o_data;
+    if(num_eles <= 0 || (t_ptr == o_ptr && t_stride == o_stride))
+    {
+        return false;
+    }
+
+#if defined(CONDUIT_USE_OPENMP)
+    if(num_eles >= DIFF_PARALLEL_THRESHOLD &&
+       omp_get_max_threads() > 1 &&
+       !omp_in_parallel())
+    {
+        std::atomic<bool> found(false);
+        #pragma omp parallel
+        {
+            index_t num_threads = (index_t)omp_get_num_threads();
+            index_t thread_id   = (index_t)omp_get_thread_num();
+            index_t chunk = (num_eles + num_threads - 1) / num_threads;
+            index_t begin = std::min(num_eles, thread_id * chunk);
+            index_t end   = std::min(num_eles, begin + chunk);
+            if(diff_range<T>(t_ptr, t_stride, o_ptr, o_stride,
+                             begin, end, epsilon, &found))
+            {
+                found.store(true, std::memory_order_relaxed);
+            }
+        }
+        return found.load();
+    }
+#endif
+
+    return diff_range<T>(t_ptr, t_stride, o_ptr, o_stride,
+                         0, num_eles, epsilon, NULL);
+}
+
+//---------------------------------------------------------------------------//
+///
+/// Conversion Kernels
+///
+/// Used by the DataArray::set overloads that take arrays or pointers of
+/// another type (and so by Node::to_{type}_array, Node::to_data_type and
+/// utils::convert). The source and dest types are template args, so
+/// the type dispatch happens once per array, not per element. When both
+/// arrays are contiguous the loop is a plain pointer loop the compiler
+/// can vectorize, and a memcpy when the types match.
+///
+/// When conduit is built with OpenMP support, arrays with at least
+/// CONVERT_PARALLEL_THRESHOLD elements are split into one chunk per thread.
+///
+//---------------------------------------------------------------------------//
+static const index_t CONVERT_PARALLEL_THRESHOLD = 1 << 20;
+
+//---------------------------------------------------------------------------//
+template <typename S, typename D, bool Contiguous>
+void
+convert_run(const uint8 *src,
+            index_t src_stride,
+            uint8 *dst,
+            index_t dst_stride,
+            index_t num_eles)
+{
+    if(Contiguous)
+    {
+        const S *src_vals = (const S*)src;
+        D *dst_vals = (D*)dst;
+        for(index_t i = 0; i < num_eles; i++)
+        {
+            dst_vals[i] = (D)src_vals[i];
+        }
+    }
+    else
+    {
+        for(index_t i = 0; i < num_eles; i++)
+        {
+            *((D*)(dst + i * dst_stride)) =
+                (D)*((const S*)(src + i * src_stride));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename S, typename D>
+void
+convert_serial(const uint8 *src,
+               index_t src_stride,
+               uint8 *dst,
+               index_t dst_stride,
+               index_t num_eles)
+{
+    if(src_stride == (index_t)sizeof(S) && dst_stride == (index_t)sizeof(D))
+    {
+        if(std::is_same<S,D>::value)
+        {
+            // memmove, since set() may be called with overlapping views
+            memmove(dst, src, (size_t)num_eles * sizeof(D));
+            return;
+        }
+        convert_run<S,D,true>(src, src_stride, dst, dst_stride, num_eles);
+        return;
+    }
+    convert_run<S,D,false>(src, src_stride, dst, dst_stride, num_eles);
+}
+
+//---------------------------------------------------------------------------//
+template <typename S, typename D>
+void
+convert(const void *src,
+        index_t src_stride,
+        void *dst,
+        index_t dst_stride,
+        index_t num_eles)
+{
+    const uint8 *src_ptr = (const uint8*)src;
+    uint8 *dst_ptr = (uint8*)dst;
+    if(num_eles <= 0 || (src_ptr == dst_ptr &&
+                         src_stride == dst_stride &&
+                         std::is_same<S,D>::value))
+    {
+        return;
+    }
+
+#if defined(CONDUIT_USE_OPENMP)
+    if(num_eles >= CONVERT_PARALLEL_THRESHOLD &&
+       omp_get_max_threads() > 1 &&
+       !omp_in_parallel())
+    {
+        #pragma omp parallel
+        {
+            index_t num_threads = (index_t)omp_get_num_threads();
+            index_t thread_id   = (index_t)omp_get_thread_num();
+            index_t chunk = (num_eles + num_threads - 1) / num_threads;
+            index_t begin = std::min(num_eles, thread_id * chunk);
+            index_t end   = std::min(num_eles, begin + chunk);
+            if(begin < end)
+            {
+                convert_serial<S,D>(src_ptr + begin * src_stride,
+                                    src_stride,
+                                    dst_ptr + begin * dst_stride,
+                                    dst_stride,
+                                    end - begin);
+            }
+        }
+        return;
+    }
+#endif
+
+    convert_serial<S,D>(src_ptr, src_stride, dst_ptr, dst_stride, num_eles);
+}
+
+}
+//---------------------------------------------------------------------------//
+// -- end detail --
+//---------------------------------------------------------------------------//
+
 //-----------------------------------------------------------------------------
 //
 // -- conduit::DataArray public methods --
@@ -234,6 +797,66 @@ DataArray<T>::diff(const DataArray<T> &array, Node &info, const float64 epsilon)
     return res;
 }
 
+//---------------------------------------------------------------------------//
+template <typename T> 
+bool
+DataArray<T>::has_diff(const DataArray<T> &array, const float64 epsilon) const
+{
+    index_t t_nelems = number_of_elements();
+    index_t o_nelems = array.number_of_elements();
+
+    if(dtype().is_char8_str())
+    {
+        // match diff, which ignores the null term
+        if(t_nelems > 1)
+        {
+            t_nelems--;
+        }
+        if(o_nelems > 1)
+        {
+            o_nelems--;
+        }
+    }
+
+    if(t_nelems != o_nelems)
+    {
+        return true;
+    }
+
+    return detail::has_diff<T>(element_ptr(0),
+                               dtype().stride(),
+                               array.element_ptr(0),
+                               array.dtype().stride(),
+                               t_nelems,
+                               epsilon);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+bool
+DataArray<T>::has_diff_compatible(const DataArray<T> &array,
+                                  const float64 epsilon) const
+{
+    // strings use the diff comparison, see diff_compatible
+    if(dtype().is_char8_str())
+    {
+        return has_diff(array, epsilon);
+    }
+
+    index_t t_nelems = number_of_elements();
+    if(t_nelems > array.number_of_elements())
+    {
+        return true;
+    }
+
+    return detail::has_diff<T>(element_ptr(0),
+                               dtype().stride(),
+                               array.element_ptr(0),
+                               array.dtype().stride(),
+                               t_nelems,
+                               epsilon);
+}
+
 //---------------------------------------------------------------------------//
 template <typename T> 
 bool
@@ -373,17 +996,9 @@ template <typename T>
 T
 DataArray<T>::min()  const
 {
-    T res = std::numeric_limits<T>::max();
-    for(index_t i = 0; i < number_of_elements(); i++)
-    {
-        const T &val = element(i);
-        if(val < res)
-        {
-            res = val;
-        }
-    }
-
-    return res;
+    return detail::reduce< T, detail::ReduceMinMax<T> >(element_ptr(0),
+                                                        m_dtype.stride(),
+                                                        number_of_elements()).min;
 }
 
 //---------------------------------------------------------------------------// 
@@ -391,33 +1006,48 @@ template <typename T>
 T
 DataArray<T>::max() const
 {
-    T res = std::numeric_limits<T>::lowest();
-    for(index_t i = 0; i < number_of_elements(); i++)
-    {
-        const T &val = element(i);
-        if(val > res)
-        {
-            res = val;
-        }
-    }
+    return detail::reduce< T, detail::ReduceMinMax<T> >(element_ptr(0),
+                                                        m_dtype.stride(),
+                                                        number_of_elements()).max;
+}
 
-    return res;
+//---------------------------------------------------------------------------// 
+template <typename T>
+void
+DataArray<T>::min_max(T &min_value, T &max_value) const
+{
+    detail::MinMax<T> res;
+    res = detail::reduce< T, detail::ReduceMinMax<T> >(element_ptr(0),
+                                                       m_dtype.stride(),
+                                                       number_of_elements());
+    min_value = res.min;
+    max_value = res.max;
 }
 
+//---------------------------------------------------------------------------// 
+template <typename T>
+void
+DataArray<T>::summary_stats(T &min_value,
+                            T &max_value,
+                            float64 &mean_value) const
+{
+    detail::Stats<T> res;
+    res = detail::reduce< T, detail::ReduceStats<T> >(element_ptr(0),
+                                                      m_dtype.stride(),
+                                                      number_of_elements());
+    min_value  = res.min;
+    max_value  = res.max;
+    mean_value = res.sum / float64(number_of_elements());
+}
 
 //---------------------------------------------------------------------------// 
 template <typename T>
 T
 DataArray<T>::sum() const
 {
-    T res =0;
-    for(index_t i = 0; i < number_of_elements(); i++)
-    {
-        const T &val = element(i);
-        res += val;
-    }
-
-    return res;
+    return detail::reduce< T, detail::ReduceSum<T,T> >(element_ptr(0),
+                                                       m_dtype.stride(),
+                                                       number_of_elements());
 }
 
 //---------------------------------------------------------------------------// 
@@ -425,13 +1055,10 @@ template <typename T>
 float64
 DataArray<T>::mean() const
 {
-    float64 res =0;
-    for(index_t i = 0; i < number_of_elements(); i++)
-    {
-        const T &val = element(i);
-        res += val;
-    }
-
+    float64 res;
+    res = detail::reduce< T, detail::ReduceSum<T,float64> >(element_ptr(0),
+                                                            m_dtype.stride(),
+                                                            number_of_elements());
     res = res / float64(number_of_elements());
     return res;
 }
@@ -452,6 +1079,127 @@ DataArray<T>::count(T val) const
     return res;
 }
 
+//---------------------------------------------------------------------------//
+///
+/// Text output helpers
+///
+/// TextWriter formats values into a char buffer and writes the buffer to
+/// the stream in large blocks, which is much cheaper than formatting each
+/// value with the std::ostream operators. Floating point values follow the
+/// same rules as utils::float64_to_string (a ".0" suffix for integral
+/// values and quoted inf and nan strings).
+///
+//---------------------------------------------------------------------------//
+namespace detail
+{
+
+class TextWriter
+{
+public:
+    // size at which flush_if_full() writes the buffer to the stream
+    static const size_t FLUSH_BYTES = 1 << 16;
+
+    TextWriter(std::ostream &os)
+    : m_os(os)
+    {}
+
+    void append(char c)
+    {
+        m_buffer.push_back(c);
+    }
+
+    void append_separator()
+    {
+        m_buffer.push_back(',');
+        m_buffer.push_back(' ');
+    }
+
+    void append_int64(int64 value)
+    {
+        conduit_fmt::format_int txt((long long)value);
+        m_buffer.append(txt.data(),txt.data() + txt.size());
+    }
+
+    void append_uint64(uint64 value)
+    {
+        conduit_fmt::format_int txt((unsigned long long)value);
+        m_buffer.append(txt.data(),txt.data() + txt.size());
+    }
+
+    template <typename F>
+    void append_float(F value, index_t float_precision)
+    {
+        size_t start = m_buffer.size();
+
+        if(float_precision > 0)
+        {
+            // matches printf("%.<float_precision>g")
+            conduit_fmt::format_to(m_buffer,
+                                   "{:.{}g}",
+                                   (float64)value,
+                                   (int)float_precision);
+        }
+        else
+        {
+            // shortest round trip representation of the value
+            // (in its own precision, float32 values are not widened)
+            conduit_fmt::format_to(m_buffer,"{}",value);
+        }
+
+        bool has_n   = false;
+        bool has_dot = false;
+        for(size_t i = start; i < m_buffer.size(); i++)
+        {
+            char c = m_buffer[i];
+            if(c == 'n')
+                has_n = true;
+            else if(c == '.' || c == 'e')
+                has_dot = true;
+        }
+
+        // looking for 'n' covers inf and nan, which we quote
+        if(has_n)
+        {
+            std::string txt(m_buffer.data() + start, m_buffer.size() - start);
+            m_buffer.resize(start);
+            m_buffer.push_back('"');
+            m_buffer.append(txt.data(),txt.data() + txt.size());
+            m_buffer.push_back('"');
+        }
+        else if(!has_dot)
+        {
+            m_buffer.push_back('.');
+            m_buffer.push_back('0');
+        }
+    }
+
+    void flush_if_full()
+    {
+        if(m_buffer.size() >= FLUSH_BYTES)
+        {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        if(m_buffer.size() > 0)
+        {
+            m_os.write(m_buffer.data(),(std::streamsize)m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
+private:
+    std::ostream                 &m_os;
+    conduit_fmt::memory_buffer    m_buffer;
+};
+
+}
+//---------------------------------------------------------------------------//
+// -- end detail --
+//---------------------------------------------------------------------------//
+
 //---------------------------------------------------------------------------// 
 template <typename T>
 std::string 
@@ -516,58 +1264,85 @@ DataArray<T>::to_json(std::ostream &os) const
 template <typename T> 
 void            
 DataArray<T>::to_json_stream(std::ostream &os) const 
+{ 
+    to_json_stream(os,15);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+void            
+DataArray<T>::to_json_stream(std::ostream &os,
+                             index_t float_precision) const 
 { 
     index_t nele = number_of_elements();
+
+    detail::TextWriter writer(os);
     // note: nele == 0 case: 
     // https://github.com/LLNL/conduit/issues/992
     // we want empty arrays to display as [] not empty string
     if(nele == 0 || nele > 1)
-        os << "[";
+        writer.append('[');
 
-    bool first=true;
-    for(index_t idx = 0; idx < nele; idx++)
+    switch(m_dtype.id())
     {
-        if(!first)
-            os << ", ";
-        switch(m_dtype.id())
+        // ints 
+        case DataType::INT8_ID:
+        case DataType::INT16_ID: 
+        case DataType::INT32_ID:
+        case DataType::INT64_ID:
         {
-            // ints 
-            case DataType::INT8_ID:
-            case DataType::INT16_ID: 
-            case DataType::INT32_ID:
-            case DataType::INT64_ID:
+            for(index_t idx = 0; idx < nele; idx++)
             {
-                 os << (int64) element(idx);
-                 break;
+                if(idx > 0)
+                    writer.append_separator();
+                writer.append_int64((int64) element(idx));
+                writer.flush_if_full();
             }
-            // uints
-            case DataType::UINT8_ID:
-            case DataType::UINT16_ID:
-            case DataType::UINT32_ID:
-            case DataType::UINT64_ID:
+            break;
+        }
+        // uints
+        case DataType::UINT8_ID:
+        case DataType::UINT16_ID:
+        case DataType::UINT32_ID:
+        case DataType::UINT64_ID:
+        {
+            for(index_t idx = 0; idx < nele; idx++)
             {
-                os << (uint64) element(idx);
-                break;
+                if(idx > 0)
+                    writer.append_separator();
+                writer.append_uint64((uint64) element(idx));
+                writer.flush_if_full();
             }
-            // floats 
-            case DataType::FLOAT32_ID: 
-            case DataType::FLOAT64_ID: 
+            break;
+        }
+        // floats 
+        case DataType::FLOAT32_ID: 
+        {
+            for(index_t idx = 0; idx < nele; idx++)
             {
-                std::string fs = utils::float64_to_string((float64)element(idx));
-                //check for inf and nan
-                // looking for 'n' covers inf and nan
-                bool inf_or_nan = fs.find('n') != std::string::npos;
-                
-                if(inf_or_nan)
-                    os << "\"";
-                
-                os << fs;
-
-                if(inf_or_nan)
-                    os << "\"";
-                break;
+                if(idx > 0)
+                    writer.append_separator();
+                writer.append_float((float32) element(idx),
+                                    float_precision);
+                writer.flush_if_full();
             }
-            default:
+            break;
+        }
+        case DataType::FLOAT64_ID: 
+        {
+            for(index_t idx = 0; idx < nele; idx++)
+            {
+                if(idx > 0)
+                    writer.append_separator();
+                writer.append_float((float64) element(idx),
+                                    float_precision);
+                writer.flush_if_full();
+            }
+            break;
+        }
+        default:
+        {
+            if(nele > 0)
             {
                 CONDUIT_ERROR("Leaf type \"" 
                               <<  m_dtype.name()
@@ -575,13 +1350,14 @@ DataArray<T>::to_json_stream(std::ostream &os) const
                               << "is not supported in conduit::DataArray.")
             }
         }
-        first=false;
     }
     // note: nele == 0 case: 
     // https://github.com/LLNL/conduit/issues/992
     // we want empty arrays to display as [] not empty string
     if(nele == 0 || nele > 1)
-        os << "]";
+        writer.append(']');
+
+    writer.flush();
 }
 
 //---------------------------------------------------------------------------//
@@ -600,7 +1376,17 @@ void
 DataArray<T>::to_yaml_stream(std::ostream &os) const 
 { 
     // yep, its the same as to_json_stream ...
-    to_json_stream(os);;
+    to_json_stream(os);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+void            
+DataArray<T>::to_yaml_stream(std::ostream &os,
+                             index_t float_precision) const 
+{ 
+    // yep, its the same as to_json_stream ...
+    to_json_stream(os,float_precision);
 }
 
 //---------------------------------------------------------------------------//
@@ -608,21 +1394,23 @@ template <typename T>
 void            
 DataArray<T>::set(const int8 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int8,T>(values,
+                          (index_t)sizeof(int8),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T> 
 void            
-DataArray<T>::set(const  int16 *values, index_t num_elements)
+DataArray<T>::set(const int16 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int16,T>(values,
+                          (index_t)sizeof(int16),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -630,43 +1418,47 @@ template <typename T>
 void            
 DataArray<T>::set(const int32 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int32,T>(values,
+                          (index_t)sizeof(int32),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T> 
 void            
-DataArray<T>::set(const  int64 *values, index_t num_elements)
+DataArray<T>::set(const int64 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int64,T>(values,
+                          (index_t)sizeof(int64),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T> 
 void            
-DataArray<T>::set(const  uint8 *values, index_t num_elements)
+DataArray<T>::set(const uint8 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint8,T>(values,
+                          (index_t)sizeof(uint8),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
 template <typename T> 
 void            
-DataArray<T>::set(const  uint16 *values, index_t num_elements)
+DataArray<T>::set(const uint16 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint16,T>(values,
+                          (index_t)sizeof(uint16),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -674,10 +1466,11 @@ template <typename T>
 void            
 DataArray<T>::set(const uint32 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint32,T>(values,
+                          (index_t)sizeof(uint32),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -685,10 +1478,11 @@ template <typename T>
 void            
 DataArray<T>::set(const uint64 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint64,T>(values,
+                          (index_t)sizeof(uint64),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -696,10 +1490,11 @@ template <typename T>
 void            
 DataArray<T>::set(const float32 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<float32,T>(values,
+                          (index_t)sizeof(float32),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -707,10 +1502,11 @@ template <typename T>
 void            
 DataArray<T>::set(const float64 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<float64,T>(values,
+                          (index_t)sizeof(float64),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -1597,11 +2393,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int8> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int8,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1609,11 +2405,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int16> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int16,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1621,11 +2417,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int32,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1633,11 +2429,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<int64,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1649,11 +2445,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint8> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint8,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1661,11 +2457,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint16> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint16,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1673,11 +2469,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint32,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1685,11 +2481,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<uint64,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1701,11 +2497,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<float32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<float32,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1713,11 +2509,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<float64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert<float64,T>(values.element_ptr(0),
+                          values.dtype().stride(),
+                          element_ptr(0),
+                          m_dtype.stride(),
+                          m_dtype.number_of_elements());
 }
 
 
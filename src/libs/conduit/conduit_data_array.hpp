@@ -104,14 +104,31 @@ public:
     bool            diff_compatible(const DataArray<T> &array,
                                     Node &info,
                                     const float64 epsilon = CONDUIT_EPSILON) const;
+    /// boolean versions of diff and diff_compatible, which return at the
+    /// first mismatch without building an info node. Compact arrays are
+    /// compared with memcmp before falling back to the epsilon test.
+    bool            has_diff(const DataArray<T> &array,
+                             const float64 epsilon = CONDUIT_EPSILON) const;
+    bool            has_diff_compatible(const DataArray<T> &array,
+                                        const float64 epsilon = CONDUIT_EPSILON) const;
 
     ///
     /// Summary Stats Helpers
     ///
+    /// These use unrolled kernels over the raw element memory, with a
+    /// specialized path for contiguous arrays. If conduit is built with
+    /// OpenMP support, large arrays are reduced in parallel.
+    ///
     T               min()  const;
     T               max()  const;
     T               sum()  const;
     float64         mean() const;
+    /// finds both the min and max value in a single pass
+    void            min_max(T &min_value, T &max_value) const;
+    /// finds the min, max and mean value in a single pass
+    void            summary_stats(T &min_value,
+                                  T &max_value,
+                                  float64 &mean_value) const;
     
     /// counts number of occurrences of given value
     index_t         count(T value) const;
@@ -342,6 +359,16 @@ public:
     std::string     to_yaml() const;
     void            to_yaml_stream(std::ostream &os) const;
 
+    /// json and yaml output with a given floating point precision:
+    ///  float_precision > 0:  max number of significant digits
+    ///                        (the other to_json/to_yaml methods use 15)
+    ///  float_precision <= 0: shortest representation that reads back
+    ///                        as the same value
+    void            to_json_stream(std::ostream &os,
+                                   index_t float_precision) const;
+    void            to_yaml_stream(std::ostream &os,
+                                   index_t float_precision) const;
+
     void            compact_elements_to(uint8 *data) const;
 
     /// Creates a string repression for printing that limits
@@ -440,6 +467,45 @@ typedef DataArray<double>  double_array;
 typedef DataArray<long double>  long_double_array;
 #endif
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils --
+//-----------------------------------------------------------------------------
+namespace utils
+{
+
+//-----------------------------------------------------------------------------
+/// Converts (casts) each element of src to the element type of dst.
+/// dst must have at least as many elements as src, extra dst elements
+/// are not modified. src and dst may be strided.
+///
+/// This uses the same type-pair kernels as DataArray::set: dispatch is
+/// done once per array, contiguous arrays use a vectorizable loop, and
+/// large arrays are converted in parallel when conduit is built with
+/// OpenMP support.
+//-----------------------------------------------------------------------------
+template <typename S, typename D>
+void
+convert(const DataArray<S> &src, DataArray<D> &dst)
+{
+    index_t num_eles = src.number_of_elements();
+    if(dst.number_of_elements() < num_eles)
+    {
+        CONDUIT_ERROR("utils::convert: dest has fewer elements ("
+                      << dst.number_of_elements() << ") than source ("
+                      << num_eles << ")");
+    }
+
+    DataType dst_dtype(dst.dtype());
+    dst_dtype.set_number_of_elements(num_eles);
+    DataArray<D> dst_view(dst.data_ptr(), dst_dtype);
+    dst_view.set(src);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils --
+//-----------------------------------------------------------------------------
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
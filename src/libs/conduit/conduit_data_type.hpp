@@ -319,6 +319,10 @@ public:
     DataType(const DataType& type);
     /// Assignment operator
     DataType& operator=(const DataType& type);
+    /// move constructor
+    DataType(DataType&& type) noexcept;
+    /// move assignment operator
+    DataType& operator=(DataType&& type) noexcept;
     /// construct simplest dtype for given type id
     explicit DataType(conduit::index_t id,
                       conduit::index_t num_elements=0);
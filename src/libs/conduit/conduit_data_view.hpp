@@ -0,0 +1,345 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_data_view.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_DATA_VIEW_HPP
+#define CONDUIT_DATA_VIEW_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+// -- conduit  includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+#include "conduit_data_type.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+/// Maps a bitwidth style element type to its DataType id.
+/// Only the bitwidth style types (and char for char8_str) are mapped,
+/// other types fail to compile.
+//-----------------------------------------------------------------------------
+template <typename T> struct DataViewTypeId;
+
+template <typename T> struct DataViewTypeId<const T>
+{ static const index_t id = DataViewTypeId<T>::id; };
+
+template <> struct DataViewTypeId<int8>
+{ static const index_t id = DataType::INT8_ID; };
+template <> struct DataViewTypeId<int16>
+{ static const index_t id = DataType::INT16_ID; };
+template <> struct DataViewTypeId<int32>
+{ static const index_t id = DataType::INT32_ID; };
+template <> struct DataViewTypeId<int64>
+{ static const index_t id = DataType::INT64_ID; };
+template <> struct DataViewTypeId<uint8>
+{ static const index_t id = DataType::UINT8_ID; };
+template <> struct DataViewTypeId<uint16>
+{ static const index_t id = DataType::UINT16_ID; };
+template <> struct DataViewTypeId<uint32>
+{ static const index_t id = DataType::UINT32_ID; };
+template <> struct DataViewTypeId<uint64>
+{ static const index_t id = DataType::UINT64_ID; };
+template <> struct DataViewTypeId<float32>
+{ static const index_t id = DataType::FLOAT32_ID; };
+template <> struct DataViewTypeId<float64>
+{ static const index_t id = DataType::FLOAT64_ID; };
+template <> struct DataViewTypeId<char>
+{ static const index_t id = DataType::CHAR8_STR_ID; };
+
+//-----------------------------------------------------------------------------
+/// Holds the byte stride of a StridedView: a compile time constant when
+/// STRIDE > 0, otherwise a runtime value. Used as a base class so the
+/// compile time case adds no storage.
+//-----------------------------------------------------------------------------
+template <index_t STRIDE>
+class DataViewStride
+{
+public:
+    explicit DataViewStride(index_t /*stride*/) {}
+    index_t view_stride() const { return STRIDE; }
+};
+
+template <>
+class DataViewStride<0>
+{
+public:
+    explicit DataViewStride(index_t stride) : m_stride(stride) {}
+    index_t view_stride() const { return m_stride; }
+private:
+    index_t m_stride;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Span --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::Span
+///
+/// description:
+///  Non owning view of contiguous elements, similar to std::span.
+///  Element access is a plain pointer offset, so loops over a Span can
+///  be vectorized by the compiler.
+///
+//-----------------------------------------------------------------------------
+template <typename T>
+class Span
+{
+public:
+    typedef T          element_type;
+    typedef index_t    size_type;
+    typedef T         *pointer;
+    typedef T         &reference;
+    typedef T         *iterator;
+
+    Span()
+    : m_data(NULL),
+      m_size(0)
+    {}
+
+    Span(T *data, index_t size)
+    : m_data(data),
+      m_size(size)
+    {}
+
+    /// a Span<T> converts to a Span<const T>
+    operator Span<const T>() const
+    {
+        return Span<const T>(m_data, m_size);
+    }
+
+    T        *data()             const { return m_data; }
+    index_t   size()             const { return m_size; }
+    index_t   size_bytes()       const { return m_size * (index_t)sizeof(T); }
+    bool      empty()            const { return m_size == 0; }
+
+    T        &operator[](index_t idx) const { return m_data[idx]; }
+
+    T        *begin()            const { return m_data; }
+    T        *end()              const { return m_data + m_size; }
+
+private:
+    T        *m_data;
+    index_t   m_size;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::Span --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::StridedView --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::StridedView
+///
+/// description:
+///  Non owning view of elements separated by a fixed byte stride.
+///
+///  With STRIDE == 0 (the default) the stride is a runtime member.
+///  With STRIDE > 0 the stride is a compile time constant, for example
+///  StridedView<T,sizeof(T)> (aka CompactView<T>) for compact data.
+///
+//-----------------------------------------------------------------------------
+template <typename T, index_t STRIDE = 0>
+class StridedView : private detail::DataViewStride<STRIDE>
+{
+public:
+    typedef T          element_type;
+    typedef index_t    size_type;
+
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                         value_type;
+        typedef std::ptrdiff_t            difference_type;
+        typedef T                        *pointer;
+        typedef T                        &reference;
+
+        iterator(const StridedView *view, index_t idx)
+        : m_view(view),
+          m_idx(idx)
+        {}
+
+        T        &operator*() const { return (*m_view)[m_idx]; }
+        iterator &operator++()      { m_idx++; return *this; }
+        iterator  operator++(int)   { iterator res(*this); m_idx++; return res; }
+        bool      operator==(const iterator &o) const { return m_idx == o.m_idx; }
+        bool      operator!=(const iterator &o) const { return m_idx != o.m_idx; }
+
+    private:
+        const StridedView *m_view;
+        index_t            m_idx;
+    };
+
+    StridedView()
+    : detail::DataViewStride<STRIDE>(STRIDE),
+      m_data(NULL),
+      m_size(0)
+    {}
+
+    /// stride is in bytes, and is ignored if STRIDE > 0
+    StridedView(T *data, index_t size, index_t stride = STRIDE)
+    : detail::DataViewStride<STRIDE>(stride),
+      m_data(data),
+      m_size(size)
+    {}
+
+    /// a StridedView<T> converts to a StridedView<const T>
+    operator StridedView<const T, STRIDE>() const
+    {
+        return StridedView<const T, STRIDE>(m_data, m_size, stride());
+    }
+
+    T        *data()             const { return m_data; }
+    index_t   size()             const { return m_size; }
+    /// stride between elements, in bytes
+    index_t   stride()           const { return this->view_stride(); }
+    bool      empty()            const { return m_size == 0; }
+    bool      is_compact()       const { return stride() == (index_t)sizeof(T); }
+
+    T        &operator[](index_t idx) const
+    {
+        typedef typename std::conditional<std::is_const<T>::value,
+                                          const char,
+                                          char>::type byte;
+        return *reinterpret_cast<T*>(reinterpret_cast<byte*>(m_data) +
+                                     idx * stride());
+    }
+
+    iterator  begin()            const { return iterator(this, 0); }
+    iterator  end()              const { return iterator(this, m_size); }
+
+private:
+    T        *m_data;
+    index_t   m_size;
+};
+
+/// strided view with a compile time compact stride
+template <typename T>
+using CompactView = StridedView<T, (index_t)sizeof(T)>;
+
+//-----------------------------------------------------------------------------
+// -- end conduit::StridedView --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::MDView --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::MDView
+///
+/// description:
+///  Non owning multi-dimensional view, similar to std::mdspan.
+///
+///  The first index varies fastest, matching the i,j,k ordering of
+///  blueprint structured fields. Strides are in bytes and are
+///  computed from the element stride and the extents.
+///
+//-----------------------------------------------------------------------------
+template <typename T, index_t RANK>
+class MDView
+{
+public:
+    typedef T          element_type;
+    typedef index_t    size_type;
+
+    MDView()
+    : m_data(NULL)
+    {
+        for(index_t d = 0; d < RANK; d++)
+        {
+            m_extents[d] = 0;
+            m_strides[d] = 0;
+        }
+    }
+
+    /// ele_stride is the byte stride between elements along the
+    /// first (fastest) dimension
+    MDView(T *data, const index_t *extents, index_t ele_stride)
+    : m_data(data)
+    {
+        index_t stride = ele_stride;
+        for(index_t d = 0; d < RANK; d++)
+        {
+            m_extents[d] = extents[d];
+            m_strides[d] = stride;
+            stride *= extents[d];
+        }
+    }
+
+    T        *data()               const { return m_data; }
+    static index_t rank()                { return RANK; }
+    index_t   extent(index_t d)    const { return m_extents[d]; }
+    /// stride along dimension d, in bytes
+    index_t   stride(index_t d)    const { return m_strides[d]; }
+
+    index_t   size() const
+    {
+        index_t res = 1;
+        for(index_t d = 0; d < RANK; d++)
+        {
+            res *= m_extents[d];
+        }
+        return res;
+    }
+
+    template <typename... Idx>
+    T &operator()(Idx... idx) const
+    {
+        static_assert(sizeof...(Idx) == (size_t)RANK,
+                      "MDView: number of indices must equal the rank");
+        const index_t ids[] = {(index_t)idx...};
+        index_t offset = 0;
+        for(index_t d = 0; d < RANK; d++)
+        {
+            offset += ids[d] * m_strides[d];
+        }
+        typedef typename std::conditional<std::is_const<T>::value,
+                                          const char,
+                                          char>::type byte;
+        return *reinterpret_cast<T*>(reinterpret_cast<byte*>(m_data) + offset);
+    }
+
+private:
+    T        *m_data;
+    index_t   m_extents[RANK];
+    index_t   m_strides[RANK];
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::MDView --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
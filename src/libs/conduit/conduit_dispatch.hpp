@@ -0,0 +1,251 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_dispatch.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_DISPATCH_HPP
+#define CONDUIT_DISPATCH_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+// -- conduit  includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+#include "conduit_data_type.hpp"
+#include "conduit_node.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+//
+/// Data type dispatch.
+///
+/// dispatch() resolves the numeric type of a DataType once and calls a
+/// functor with a typed pointer to the data, so the functor's body is
+/// compiled (and can be vectorized) for each element type instead of
+/// checking the type per element:
+///
+///   struct Sum
+///   {
+///       index_t  n;
+///       float64 &res;
+///       template <typename T>
+///       void operator()(const T *vals) const
+///       {
+///           for(index_t i = 0; i < n; i++) res += vals[i];
+///       }
+///   };
+///
+///   conduit::dispatch(node, Sum{num_eles, res});
+///
+/// With C++14 or newer, a generic lambda (`[&](auto *vals){...}`) can be
+/// used as the functor.
+///
+/// The functor is called with a T* (or const T* for const data) where T is
+/// one of int8, int16, int32, int64, uint8, uint16, uint32, uint64, float32
+/// or float64. Other data types raise an error. The pointer is the data
+/// pointer passed in (the Node overloads pass element_ptr(0)), so functors
+/// for strided data use the DataType's stride, and functors for data with
+/// non-native endianness must swap bytes themselves.
+///
+/// dispatch2() resolves two DataTypes and calls the functor with both typed
+/// pointers (for example a source and a dest of a conversion).
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+/// T* for void data, const T* for const void data
+//-----------------------------------------------------------------------------
+template <typename T, typename V> struct DispatchPtr
+{ typedef T *type; };
+
+template <typename T> struct DispatchPtr<T, const void>
+{ typedef const T *type; };
+
+//-----------------------------------------------------------------------------
+template <typename V, typename Func>
+void
+dispatch_data(const DataType &dtype, V *data, Func &func)
+{
+    switch(dtype.id())
+    {
+        case DataType::INT8_ID:
+            func(static_cast<typename DispatchPtr<int8,V>::type>(data));
+            break;
+        case DataType::INT16_ID:
+            func(static_cast<typename DispatchPtr<int16,V>::type>(data));
+            break;
+        case DataType::INT32_ID:
+            func(static_cast<typename DispatchPtr<int32,V>::type>(data));
+            break;
+        case DataType::INT64_ID:
+            func(static_cast<typename DispatchPtr<int64,V>::type>(data));
+            break;
+        case DataType::UINT8_ID:
+            func(static_cast<typename DispatchPtr<uint8,V>::type>(data));
+            break;
+        case DataType::UINT16_ID:
+            func(static_cast<typename DispatchPtr<uint16,V>::type>(data));
+            break;
+        case DataType::UINT32_ID:
+            func(static_cast<typename DispatchPtr<uint32,V>::type>(data));
+            break;
+        case DataType::UINT64_ID:
+            func(static_cast<typename DispatchPtr<uint64,V>::type>(data));
+            break;
+        case DataType::FLOAT32_ID:
+            func(static_cast<typename DispatchPtr<float32,V>::type>(data));
+            break;
+        case DataType::FLOAT64_ID:
+            func(static_cast<typename DispatchPtr<float64,V>::type>(data));
+            break;
+        default:
+            CONDUIT_ERROR("conduit::dispatch unsupported data type: "
+                          << dtype.name());
+    }
+}
+
+//-----------------------------------------------------------------------------
+/// binds the first typed pointer of a dispatch2 call
+//-----------------------------------------------------------------------------
+template <typename A, typename Func>
+struct Dispatch2Second
+{
+    A    *a;
+    Func &func;
+
+    template <typename B>
+    void operator()(B *b) const
+    {
+        func(a, b);
+    }
+};
+
+//-----------------------------------------------------------------------------
+/// dispatches the second DataType of a dispatch2 call
+//-----------------------------------------------------------------------------
+template <typename VB, typename Func>
+struct Dispatch2First
+{
+    const DataType &b_dtype;
+    VB             *b_data;
+    Func           &func;
+
+    template <typename A>
+    void operator()(A *a) const
+    {
+        Dispatch2Second<A,Func> second = {a, func};
+        dispatch_data(b_dtype, b_data, second);
+    }
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/// calls func(T *data) for the numeric type T of dtype
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+dispatch(const DataType &dtype, void *data, Func &&func)
+{
+    detail::dispatch_data(dtype, data, func);
+}
+
+//-----------------------------------------------------------------------------
+/// calls func(const T *data) for the numeric type T of dtype
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+dispatch(const DataType &dtype, const void *data, Func &&func)
+{
+    detail::dispatch_data(dtype, data, func);
+}
+
+//-----------------------------------------------------------------------------
+/// calls func(T *ptr) with a pointer to the node's first element
+/// (mutable access, so copy-on-write leaves are unshared first)
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+dispatch(Node &node, Func &&func)
+{
+    detail::dispatch_data(node.dtype(), node.element_ptr(0), func);
+}
+
+//-----------------------------------------------------------------------------
+/// calls func(const T *ptr) with a pointer to the node's first element
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+dispatch(const Node &node, Func &&func)
+{
+    detail::dispatch_data(node.dtype(), node.element_ptr(0), func);
+}
+
+//-----------------------------------------------------------------------------
+/// calls func(A *a_data, B *b_data) for the numeric types A and B of
+/// a_dtype and b_dtype (const pointers for const data)
+//-----------------------------------------------------------------------------
+template <typename VA, typename VB, typename Func>
+void
+dispatch2(const DataType &a_dtype, VA *a_data,
+          const DataType &b_dtype, VB *b_data,
+          Func &&func)
+{
+    // typed pointers are dispatched as (const) void pointers
+    typedef typename std::conditional<std::is_const<VA>::value,
+                                      const void, void>::type VoidA;
+    typedef typename std::conditional<std::is_const<VB>::value,
+                                      const void, void>::type VoidB;
+    typedef typename std::remove_reference<Func>::type FuncT;
+    detail::Dispatch2First<VoidB,FuncT> first = {b_dtype, b_data, func};
+    detail::dispatch_data(a_dtype, static_cast<VoidA*>(a_data), first);
+}
+
+//-----------------------------------------------------------------------------
+/// dispatch2 for the elements of two nodes
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+dispatch2(const Node &a, Node &b, Func &&func)
+{
+    dispatch2(a.dtype(), a.element_ptr(0), b.dtype(), b.element_ptr(0), func);
+}
+
+//-----------------------------------------------------------------------------
+template <typename Func>
+void
+dispatch2(const Node &a, const Node &b, Func &&func)
+{
+    dispatch2(a.dtype(), a.element_ptr(0), b.dtype(), b.element_ptr(0), func);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
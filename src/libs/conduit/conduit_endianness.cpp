@@ -9,12 +9,280 @@
 //-----------------------------------------------------------------------------
 #include "conduit_endianness.hpp"
 
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+
+#if defined(CONDUIT_USE_OPENMP)
+#include <omp.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- simd byte shuffle kernel support --
+//-----------------------------------------------------------------------------
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define CONDUIT_ENDIAN_SWAP_USE_AVX2
+#include <immintrin.h>
+#endif
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
 namespace conduit
 {
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+///
+/// Bulk swap kernels
+///
+/// Each element is loaded with memcpy, byte reversed and stored, which
+/// compilers turn into bswap (or movbe) instructions and handles
+/// unaligned and strided data. Compact arrays first run an AVX2 pshufb
+/// kernel (selected at runtime) over whole 32 byte blocks.
+///
+/// When conduit is built with OpenMP support, arrays with at least
+/// SWAP_PARALLEL_THRESHOLD elements are split into one chunk per thread.
+///
+//---------------------------------------------------------------------------//
+static const index_t SWAP_PARALLEL_THRESHOLD = 1 << 20;
+
+//---------------------------------------------------------------------------//
+inline uint16
+byte_swap(uint16 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(v);
+#else
+    return (uint16)((v >> 8) | (v << 8));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+inline uint32
+byte_swap(uint32 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(v);
+#else
+    return ((v >> 24) & 0x000000ffu) |
+           ((v >>  8) & 0x0000ff00u) |
+           ((v <<  8) & 0x00ff0000u) |
+           ((v << 24) & 0xff000000u);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+inline uint64
+byte_swap(uint64 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(v);
+#else
+    return ((uint64)byte_swap((uint32)(v & 0xffffffffu)) << 32) |
+            (uint64)byte_swap((uint32)(v >> 32));
+#endif
+}
+
+#if defined(CONDUIT_ENDIAN_SWAP_USE_AVX2)
+//---------------------------------------------------------------------------//
+// swaps whole 32 byte blocks of compact W byte elements,
+// returns the number of elements swapped
+template <index_t W>
+__attribute__((target("avx2")))
+index_t
+swap_compact_avx2(const uint8 *src,
+                  uint8 *dest,
+                  index_t num_eles)
+{
+    uint8 shuf_bytes[32];
+    for(index_t i = 0; i < 32; i++)
+    {
+        shuf_bytes[i] = (uint8)((i / W) * W + (W - 1 - (i % W)));
+    }
+    const __m256i shuf = _mm256_loadu_si256((const __m256i*)shuf_bytes);
+
+    index_t nbytes = num_eles * W;
+    index_t i = 0;
+    for(; i + 64 <= nbytes; i += 64)
+    {
+        __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i v1 = _mm256_loadu_si256((const __m256i*)(src + i + 32));
+        _mm256_storeu_si256((__m256i*)(dest + i),
+                            _mm256_shuffle_epi8(v0,shuf));
+        _mm256_storeu_si256((__m256i*)(dest + i + 32),
+                            _mm256_shuffle_epi8(v1,shuf));
+    }
+    for(; i + 32 <= nbytes; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dest + i),
+                            _mm256_shuffle_epi8(v,shuf));
+    }
+    return i / W;
+}
+
+//---------------------------------------------------------------------------//
+bool
+swap_use_avx2()
+{
+    static const bool res = __builtin_cpu_supports("avx2") != 0;
+    return res;
+}
+#endif
+
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+swap_serial(const uint8 *src,
+            index_t src_stride,
+            uint8 *dest,
+            index_t dest_stride,
+            index_t num_eles)
+{
+    const index_t W = (index_t)sizeof(T);
+    index_t i = 0;
+    if(src_stride == W && dest_stride == W)
+    {
+#if defined(CONDUIT_ENDIAN_SWAP_USE_AVX2)
+        if(swap_use_avx2())
+        {
+            i = swap_compact_avx2<(index_t)sizeof(T)>(src,dest,num_eles);
+        }
+#endif
+        for(; i < num_eles; i++)
+        {
+            T v;
+            memcpy(&v, src + i * W, sizeof(T));
+            v = byte_swap(v);
+            memcpy(dest + i * W, &v, sizeof(T));
+        }
+    }
+    else
+    {
+        for(; i < num_eles; i++)
+        {
+            T v;
+            memcpy(&v, src + i * src_stride, sizeof(T));
+            v = byte_swap(v);
+            memcpy(dest + i * dest_stride, &v, sizeof(T));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+swap(const uint8 *src,
+     index_t src_stride,
+     uint8 *dest,
+     index_t dest_stride,
+     index_t num_eles)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    if(num_eles >= SWAP_PARALLEL_THRESHOLD &&
+       omp_get_max_threads() > 1 &&
+       !omp_in_parallel())
+    {
+        #pragma omp parallel
+        {
+            index_t num_threads = (index_t)omp_get_num_threads();
+            index_t thread_id   = (index_t)omp_get_thread_num();
+            index_t chunk = (num_eles + num_threads - 1) / num_threads;
+            index_t begin = std::min(num_eles, thread_id * chunk);
+            index_t end   = std::min(num_eles, begin + chunk);
+            if(begin < end)
+            {
+                swap_serial<T>(src  + begin * src_stride,
+                               src_stride,
+                               dest + begin * dest_stride,
+                               dest_stride,
+                               end - begin);
+            }
+        }
+        return;
+    }
+#endif
+
+    swap_serial<T>(src, src_stride, dest, dest_stride, num_eles);
+}
+
+//---------------------------------------------------------------------------//
+void
+swap_elements(const void *src,
+              index_t src_stride,
+              void *dest,
+              index_t dest_stride,
+              index_t num_eles,
+              index_t ele_bytes)
+{
+    if(src_stride == 0)
+    {
+        src_stride = ele_bytes;
+    }
+
+    if(dest_stride == 0)
+    {
+        dest_stride = ele_bytes;
+    }
+
+    const uint8 *src_ptr  = (const uint8*)src;
+    uint8       *dest_ptr = (uint8*)dest;
+
+    if(num_eles <= 0)
+    {
+        return;
+    }
+
+    if(ele_bytes == 2)
+    {
+        swap<uint16>(src_ptr, src_stride, dest_ptr, dest_stride, num_eles);
+    }
+    else if(ele_bytes == 4)
+    {
+        swap<uint32>(src_ptr, src_stride, dest_ptr, dest_stride, num_eles);
+    }
+    else if(ele_bytes == 8)
+    {
+        swap<uint64>(src_ptr, src_stride, dest_ptr, dest_stride, num_eles);
+    }
+    else if(ele_bytes == 1)
+    {
+        if(src_ptr == dest_ptr && src_stride == dest_stride)
+        {
+            return;
+        }
+        for(index_t i = 0; i < num_eles; i++)
+        {
+            dest_ptr[i * dest_stride] = src_ptr[i * src_stride];
+        }
+    }
+    else
+    {
+        CONDUIT_ERROR("Endianness: unsupported element size for swap: "
+                      << ele_bytes << " bytes "
+                      << "(supported sizes: 1, 2, 4, 8)");
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::Endianness --
 //-----------------------------------------------------------------------------
@@ -159,6 +427,42 @@ Endianness::swap64(void *src,void *dest)
 
 }
 
+//-----------------------------------------------------------------------------
+/// Bulk endianness transforms
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Endianness::swap_elements(void *data,
+                          index_t num_elements,
+                          index_t ele_bytes,
+                          index_t stride)
+{
+    detail::swap_elements(data,
+                          stride,
+                          data,
+                          stride,
+                          num_elements,
+                          ele_bytes);
+}
+
+//---------------------------------------------------------------------------//
+void
+Endianness::copy_and_swap_elements(const void *src,
+                                   void *dest,
+                                   index_t num_elements,
+                                   index_t ele_bytes,
+                                   index_t src_stride,
+                                   index_t dest_stride)
+{
+    detail::swap_elements(src,
+                          src_stride,
+                          dest,
+                          dest_stride,
+                          num_elements,
+                          ele_bytes);
+}
+
 
 }
 //-----------------------------------------------------------------------------
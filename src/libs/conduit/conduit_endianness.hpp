@@ -103,6 +103,32 @@ public:
     /// src and dest must not be the same location.
     static void             swap64(void *src, void *dest);
 
+//-----------------------------------------------------------------------------
+/// Bulk endianness transforms
+///
+/// These swap arrays of 2, 4, or 8 byte elements (1 byte elements are
+/// left as is). Strides are in bytes, a stride of 0 means the elements
+/// are compact (stride == ele_bytes). Compact arrays use SIMD byte shuffle
+/// kernels when the CPU supports them, and when conduit is built with
+/// OpenMP large arrays are split across threads.
+//-----------------------------------------------------------------------------
+    /// swaps num_elements elements in place.
+    static void             swap_elements(void *data,
+                                          index_t num_elements,
+                                          index_t ele_bytes,
+                                          index_t stride = 0);
+
+    /// fused copy and swap: reads elements from src and writes the
+    /// swapped values to dest in a single pass. Intended for io backends
+    /// that copy out of staging buffers. src and dest must not overlap,
+    /// unless they are the same location with the same stride.
+    static void             copy_and_swap_elements(const void *src,
+                                                   void *dest,
+                                                   index_t num_elements,
+                                                   index_t ele_bytes,
+                                                   index_t src_stride = 0,
+                                                   index_t dest_stride = 0);
+
 };
 //-----------------------------------------------------------------------------
 // -- end conduit::Endianness --
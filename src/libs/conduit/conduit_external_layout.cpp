@@ -0,0 +1,142 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_external_layout.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_external_layout.hpp"
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_node.hpp"
+#include "conduit_error.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::ExternalLayout public methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+ExternalLayout::ExternalLayout()
+: m_root(NULL),
+  m_leaves()
+{}
+
+//---------------------------------------------------------------------------//
+ExternalLayout::ExternalLayout(const ExternalLayout &layout)
+: m_root(layout.m_root),
+  m_leaves(layout.m_leaves)
+{}
+
+//---------------------------------------------------------------------------//
+ExternalLayout::~ExternalLayout()
+{}
+
+//---------------------------------------------------------------------------//
+ExternalLayout &
+ExternalLayout::operator=(const ExternalLayout &layout)
+{
+    if(this != &layout)
+    {
+        m_root   = layout.m_root;
+        m_leaves = layout.m_leaves;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+ExternalLayout::leaf(index_t idx) const
+{
+    check_leaf_index(idx);
+    return *m_leaves[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+std::string
+ExternalLayout::leaf_path(index_t idx) const
+{
+    check_leaf_index(idx);
+    std::string res = m_leaves[(size_t)idx]->path();
+    std::string root_path = m_root->path();
+    // strip the bound node's path (and the following "/")
+    if(!root_path.empty())
+    {
+        res = res.substr(root_path.size() + 1);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+ExternalLayout::rebind(void * const *ptrs)
+{
+    size_t num_leaves = m_leaves.size();
+    if(num_leaves > 0 && ptrs == NULL)
+    {
+        CONDUIT_ERROR("ExternalLayout::rebind: ptrs is NULL");
+    }
+
+    for(size_t i = 0; i < num_leaves; i++)
+    {
+        m_leaves[i]->set_data_ptr(ptrs[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+ExternalLayout::rebind(const std::vector<void*> &ptrs)
+{
+    if(ptrs.size() != m_leaves.size())
+    {
+        CONDUIT_ERROR("ExternalLayout::rebind: number of pointers ("
+                      << ptrs.size() << ") does not match the number of"
+                      << " bound leaves (" << m_leaves.size() << ")");
+    }
+
+    if(!ptrs.empty())
+    {
+        rebind(&ptrs[0]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+ExternalLayout::rebind(index_t idx, void *ptr)
+{
+    check_leaf_index(idx);
+    m_leaves[(size_t)idx]->set_data_ptr(ptr);
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::ExternalLayout private methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+ExternalLayout::check_leaf_index(index_t idx) const
+{
+    if(idx < 0 || idx >= (index_t)m_leaves.size())
+    {
+        CONDUIT_ERROR("ExternalLayout: invalid leaf index: " << idx
+                      << " (number of leaves: " << m_leaves.size() << ")");
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,133 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_external_layout.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_EXTERNAL_LAYOUT_HPP
+#define CONDUIT_EXTERNAL_LAYOUT_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+class Node;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::ExternalLayout --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::ExternalLayout
+///
+/// description:
+///  A handle to the external leaves of a Node tree, created by
+///  Node::bind_external_layout().
+///
+///  Codes that publish the same set of external arrays every cycle
+///  (for example with a fixed sequence of set_path_external calls) can
+///  bind the layout once and then use rebind() to re-point the leaves at
+///  new data. rebind() only replaces each leaf's data pointer: the schema
+///  (dtype, offset, stride and number of elements) of each leaf is kept,
+///  and no paths are parsed or looked up.
+///
+///  Leaves are held as Node pointers in depth-first order, which is the
+///  order they were first published in. The bound tree must outlive the
+///  layout, and its hierarchy and leaf dtypes must not change between
+///  bind and rebind (create a new layout after any such change).
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API ExternalLayout
+{
+public:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::ExternalLayout public methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// create an empty layout
+    ExternalLayout();
+    /// copy constructor
+    ExternalLayout(const ExternalLayout &layout);
+    ~ExternalLayout();
+
+    ExternalLayout &operator=(const ExternalLayout &layout);
+
+//-----------------------------------------------------------------------------
+// Info and Access
+//-----------------------------------------------------------------------------
+    /// number of bound leaves
+    index_t             number_of_leaves() const
+                            { return (index_t)m_leaves.size(); }
+    /// true if no leaves are bound
+    bool                is_empty() const
+                            { return m_leaves.empty(); }
+    /// access the bound leaf at given index
+    Node               &leaf(index_t idx) const;
+    /// path of the bound leaf at given index, relative to the bound node
+    std::string         leaf_path(index_t idx) const;
+
+//-----------------------------------------------------------------------------
+// Rebind
+//-----------------------------------------------------------------------------
+    /// re-points every bound leaf, ptrs must hold number_of_leaves()
+    /// pointers (in leaf order)
+    void                rebind(void * const *ptrs);
+    /// re-points every bound leaf, ptrs.size() must equal
+    /// number_of_leaves()
+    void                rebind(const std::vector<void*> &ptrs);
+    /// re-points the bound leaf at given index
+    void                rebind(index_t idx, void *ptr);
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::ExternalLayout private methods --
+//
+//-----------------------------------------------------------------------------
+    friend class Node;
+
+    /// checks idx is a valid leaf index
+    void                check_leaf_index(index_t idx) const;
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::ExternalLayout private data members --
+//
+//-----------------------------------------------------------------------------
+    /// node the layout was bound from
+    Node                *m_root;
+    /// bound leaves, in depth-first order
+    std::vector<Node*>   m_leaves;
+
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::ExternalLayout --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -8,6 +8,7 @@
 ///
 //-----------------------------------------------------------------------------
 #include "conduit_generator.hpp"
+#include "conduit_parallel.hpp"
 
 
 //-----------------------------------------------------------------------------
@@ -15,11 +16,22 @@
 //-----------------------------------------------------------------------------
 #include <stdio.h>
 #include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // -- rapidjson includes -- 
 //-----------------------------------------------------------------------------
 #include "rapidjson/document.h"
+#include "rapidjson/reader.h"
+#include "rapidjson/filereadstream.h"
 #include "rapidjson/error/en.h"
 
 //-----------------------------------------------------------------------------
@@ -112,6 +124,84 @@ public:
     // converts c-string to long
     static long int string_to_long(const char *txt_value);
 
+    // decodes a base64 encoded copy of a numeric leaf's compact data
+    // (as written by Node::to_json with the base64_threshold option)
+    // into node, which must already have the leaf's dtype
+    static void    parse_base64_value(const char *txt_value,
+                                      index_t txt_len,
+                                      Node &node);
+
+//-----------------------------------------------------------------------------
+// Shared helpers for the streaming (event based) parsers
+//-----------------------------------------------------------------------------
+    // creates a new child of an object node
+    static Node   *append_object_child(Node *node,
+                                       const std::string &name);
+    // creates a new child of a list node
+    static Node   *append_list_child(Node *node);
+
+    // casts value to the dtype of a numeric node and writes it
+    // to the element at idx
+    template<typename T>
+    static void    set_numeric_element(Node &node,
+                                       index_t idx,
+                                       T value);
+
+    //
+    // NumericSequence holds the values of a json array or yaml sequence
+    // while we don't know if it is a homogenous numeric array. It keeps
+    // the kind of each value so the sequence can be converted to a list
+    // if a non numeric entry shows up.
+    //
+    // The streaming parsers reuse a single instance, so its storage
+    // grows to the size of the largest numeric array parsed.
+    //
+    class NumericSequence
+    {
+    public:
+        enum Kind
+        {
+            INT64_VALUE,
+            UINT64_VALUE,
+            FLOAT64_VALUE,
+            STRING_VALUE    // float64 value parsed from a string (nan, etc)
+        };
+
+        NumericSequence();
+
+        void        reset();
+
+        void        append_int64(int64 value);
+        void        append_uint64(uint64 value);
+        void        append_float64(float64 value);
+        void        append_string(const std::string &txt_value,
+                                  float64 value);
+
+        index_t     size() const
+                        { return (index_t)m_values.size(); }
+        // true if any entry is a float64 or a string
+        bool        has_float64() const
+                        { return m_has_float64; }
+
+        int                 kind(index_t idx) const;
+        const std::string  &string_value(index_t idx) const;
+
+        int64       to_int64(index_t idx) const;
+        uint64      to_uint64(index_t idx) const;
+        float64     to_float64(index_t idx) const;
+
+    private:
+        void        append(int kind, uint64 bits);
+
+        // values are stored as raw 64-bit patterns
+        std::vector<uint64>             m_values;
+        // kind of each entry, only filled when entries have mixed kinds
+        std::vector<uint8>              m_kinds;
+        int                             m_kind;
+        bool                            m_has_float64;
+        std::map<index_t,std::string>   m_strings;
+    };
+
 //-----------------------------------------------------------------------------
 // Generator::Parser::JSON handles parsing via rapidjson.
 // We want to isolate the conduit API from the rapidjson headers
@@ -185,12 +275,40 @@ public:
                                     const conduit_rapidjson::Value &jvalue,
                                     index_t curr_offset);
     
+    // decodes the data of a conduit_base64_json document. when compact
+    // is true, data with a non compact schema is compacted.
     static void    parse_base64(Node *node,
-                                const conduit_rapidjson::Value &jvalue);
+                                const conduit_rapidjson::Value &jvalue,
+                                bool compact = false);
 
     static void    parse_error_details(const std::string &json,
                                        const conduit_rapidjson::Document &document,
                                        std::ostream &os);
+
+    //
+    // streaming (SAX) parsing support
+    //
+
+    // input stream adaptor that applies utils::json_sanitize rules
+    // on the fly
+    template<typename InputStream>
+    class SanitizedStream;
+
+    // SAX handlers that build a node tree for the "json"
+    // and "conduit_json" protocols
+    class PureJSONHandler;
+    class ConduitJSONHandler;
+
+    // runs a SAX parse of the input stream, throws on errors
+    template<typename Handler, typename InputStream>
+    static void    parse_stream(InputStream &is,
+                                Handler &handler);
+
+    // main entry point for streaming json, dispatches on protocol
+    template<typename InputStream>
+    static void    walk_json_stream(InputStream &is,
+                                    const std::string &protocol,
+                                    Node &node);
   };
 //-----------------------------------------------------------------------------
 // Generator::Parser::YAML handles parsing via libyaml.
@@ -292,6 +410,42 @@ public:
     static void    parse_error_details(yaml_parser_t *yaml_parser,
                                        std::ostream &os);
 
+    //
+    // streaming (event) parsing support
+    //
+
+    // YAMLEventParserWrapper class helps with libyaml cleanup when
+    // exceptions are thrown during event parsing
+    class YAMLEventParserWrapper
+    {
+    public:
+        YAMLEventParserWrapper();
+       ~YAMLEventParserWrapper();
+
+       // set input, throws exception when things go wrong
+       void         set_input(const char *yaml_txt);
+       void         set_input(FILE *yaml_file);
+
+       // parses and returns the next event, throws exception
+       // when things go wrong
+       yaml_event_t *next_event();
+
+    private:
+        void         init();
+
+        yaml_parser_t   m_yaml_parser;
+        yaml_event_t    m_yaml_event;
+
+        bool m_yaml_parser_is_valid;
+        bool m_yaml_event_is_valid;
+    };
+
+    // builds a node tree from pure yaml events
+    class PureYAMLBuilder;
+
+    // main entry point for streaming pure yaml
+    static void    walk_pure_yaml_events(Node *node,
+                                         YAMLEventParserWrapper &parser);
   };
 
 };
@@ -363,6 +517,287 @@ Generator::Parser::string_to_long(const char *txt_value)
     return strtol(txt_value,&val_end,10);
 }
 
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::parse_base64_value(const char *txt_value,
+                                      index_t txt_len,
+                                      Node &node)
+{
+    const DataType &dtype = node.dtype();
+    if(!dtype.is_number())
+    {
+        CONDUIT_ERROR("JSON Generator error:\n"
+                      << "a base64 value can only be used as an inline"
+                      << " value for a Conduit Numeric Node.");
+    }
+
+    index_t nbytes = dtype.bytes_compact();
+    index_t dec_buff_size = utils::base64_decode_buffer_size(txt_len);
+    if(dec_buff_size < nbytes)
+    {
+        CONDUIT_ERROR("JSON Generator error:\n"
+                      << "base64 value holds fewer bytes (" << dec_buff_size
+                      << ") than the dtype requires (" << nbytes << ")");
+    }
+
+    if(dtype.is_compact() &&
+       !utils::is_device_allocator(node.allocator()))
+    {
+        // the encoded data has the leaf's layout, decode it in place
+        utils::base64_decode(txt_value,txt_len,node.element_ptr(0),nbytes);
+        return;
+    }
+
+    std::vector<uint8> dec_buff((size_t)dec_buff_size + 1,0);
+    utils::base64_decode(txt_value,txt_len,&dec_buff[0]);
+
+    // the encoded data is compact, copy it into the leaf's layout
+    index_t ele_bytes = dtype.element_bytes();
+    Node n_src;
+    n_src.set_external(DataType(dtype.id(),
+                                dtype.number_of_elements(),
+                                0,
+                                ele_bytes,
+                                ele_bytes,
+                                dtype.endianness()),
+                       &dec_buff[0]);
+    node.update(n_src);
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::append_object_child(Node *node,
+                                       const std::string &name)
+{
+    Schema *curr_schema = &node->schema_ptr()->add_child(name);
+    Node *curr_node = new Node();
+    curr_node->set_schema_ptr(curr_schema);
+    curr_node->set_parent(node);
+    node->append_node_ptr(curr_node);
+    return curr_node;
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::append_list_child(Node *node)
+{
+    Schema *schema = node->schema_ptr();
+    schema->append();
+    Schema *curr_schema = schema->child_ptr(schema->number_of_children() - 1);
+    Node *curr_node = new Node();
+    curr_node->set_schema_ptr(curr_schema);
+    curr_node->set_parent(node);
+    node->append_node_ptr(curr_node);
+    return curr_node;
+}
+
+//---------------------------------------------------------------------------//
+template<typename T>
+void
+Generator::Parser::set_numeric_element(Node &node,
+                                       index_t idx,
+                                       T value)
+{
+    void *ele_ptr = node.element_ptr(idx);
+    switch(node.dtype().id())
+    {
+        // signed ints
+        case DataType::INT8_ID:
+            *((int8*)ele_ptr) = (int8)value;
+            break;
+        case DataType::INT16_ID:
+            *((int16*)ele_ptr) = (int16)value;
+            break;
+        case DataType::INT32_ID:
+            *((int32*)ele_ptr) = (int32)value;
+            break;
+        case DataType::INT64_ID:
+            *((int64*)ele_ptr) = (int64)value;
+            break;
+        // unsigned ints
+        case DataType::UINT8_ID:
+            *((uint8*)ele_ptr) = (uint8)value;
+            break;
+        case DataType::UINT16_ID:
+            *((uint16*)ele_ptr) = (uint16)value;
+            break;
+        case DataType::UINT32_ID:
+            *((uint32*)ele_ptr) = (uint32)value;
+            break;
+        case DataType::UINT64_ID:
+            *((uint64*)ele_ptr) = (uint64)value;
+            break;
+        //floats
+        case DataType::FLOAT32_ID:
+            *((float32*)ele_ptr) = (float32)value;
+            break;
+        case DataType::FLOAT64_ID:
+            *((float64*)ele_ptr) = (float64)value;
+            break;
+        default:
+            CONDUIT_ERROR("JSON Generator error:\n"
+                           << "attempting to set non-numeric Node with"
+                           << " numeric array");
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser::NumericSequence --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Generator::Parser::NumericSequence::NumericSequence()
+: m_values(),
+  m_kinds(),
+  m_kind(INT64_VALUE),
+  m_has_float64(false),
+  m_strings()
+{}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequence::reset()
+{
+    // clear keeps capacity, so storage is reused by the next sequence
+    m_values.clear();
+    m_kinds.clear();
+    m_kind = INT64_VALUE;
+    m_has_float64 = false;
+    m_strings.clear();
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequence::append(int kind,
+                                           uint64 bits)
+{
+    if(m_values.empty())
+    {
+        m_kind = kind;
+    }
+    else if(m_kinds.empty() && kind != m_kind)
+    {
+        // first mixed entry, start tracking per entry kinds
+        m_kinds.assign(m_values.size(),(uint8)m_kind);
+    }
+
+    if(!m_kinds.empty())
+    {
+        m_kinds.push_back((uint8)kind);
+    }
+
+    m_values.push_back(bits);
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequence::append_int64(int64 value)
+{
+    append(INT64_VALUE,(uint64)value);
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequence::append_uint64(uint64 value)
+{
+    append(UINT64_VALUE,value);
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequence::append_float64(float64 value)
+{
+    uint64 bits;
+    memcpy(&bits,&value,sizeof(uint64));
+    append(FLOAT64_VALUE,bits);
+    m_has_float64 = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::NumericSequence::append_string(const std::string &txt_value,
+                                                  float64 value)
+{
+    m_strings[size()] = txt_value;
+    uint64 bits;
+    memcpy(&bits,&value,sizeof(uint64));
+    append(STRING_VALUE,bits);
+    m_has_float64 = true;
+}
+
+//---------------------------------------------------------------------------//
+int
+Generator::Parser::NumericSequence::kind(index_t idx) const
+{
+    if(m_kinds.empty())
+    {
+        return m_kind;
+    }
+    return m_kinds[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+const std::string &
+Generator::Parser::NumericSequence::string_value(index_t idx) const
+{
+    std::map<index_t,std::string>::const_iterator itr = m_strings.find(idx);
+    if(itr == m_strings.end())
+    {
+        CONDUIT_ERROR("NumericSequence: entry " << idx
+                      << " is not a string value");
+    }
+    return itr->second;
+}
+
+//---------------------------------------------------------------------------//
+int64
+Generator::Parser::NumericSequence::to_int64(index_t idx) const
+{
+    int k = kind(idx);
+    if(k == FLOAT64_VALUE || k == STRING_VALUE)
+    {
+        return (int64)to_float64(idx);
+    }
+    return (int64)m_values[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+uint64
+Generator::Parser::NumericSequence::to_uint64(index_t idx) const
+{
+    int k = kind(idx);
+    if(k == FLOAT64_VALUE || k == STRING_VALUE)
+    {
+        return (uint64)to_float64(idx);
+    }
+    return m_values[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+float64
+Generator::Parser::NumericSequence::to_float64(index_t idx) const
+{
+    int k = kind(idx);
+    uint64 bits = m_values[(size_t)idx];
+    if(k == INT64_VALUE)
+    {
+        return (float64)((int64)bits);
+    }
+    else if(k == UINT64_VALUE)
+    {
+        return (float64)bits;
+    }
+
+    float64 res;
+    memcpy(&res,&bits,sizeof(float64));
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::NumericSequence --
+//-----------------------------------------------------------------------------
+
 
 //-----------------------------------------------------------------------------
 // -- begin conduit::Generator::Parser::JSON --
@@ -1032,6 +1467,15 @@ Generator::Parser::JSON::parse_inline_value(const conduit_rapidjson::Value &jval
                         << " is not homogenous");
         }
     }
+    else if(jvalue.IsObject() &&
+            jvalue.HasMember("base64") &&
+            jvalue["base64"].IsString())
+    {
+        const conduit_rapidjson::Value &b64_value = jvalue["base64"];
+        parse_base64_value(b64_value.GetString(),
+                           (index_t)b64_value.GetStringLength(),
+                           node);
+    }
     else
     {
         parse_inline_leaf(jvalue,node);
@@ -1441,11 +1885,11 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
     {
         DataType dtype;
         parse_leaf_dtype(jvalue,curr_offset,dtype);
-        schema->set(dtype);
         
         if(data != NULL)
         {
              // node is already linked to the schema pointer
+             schema->set(dtype);
              node->set_data_ptr(data);
              
         }
@@ -1467,55 +1911,67 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
 //---------------------------------------------------------------------------//
 void 
 Generator::Parser::JSON::parse_base64(Node *node,
-                                      const conduit_rapidjson::Value &jvalue)
+                                      const conduit_rapidjson::Value &jvalue,
+                                      bool compact)
 {
-    // object case
+    if(!jvalue.IsObject())
+    {
+        CONDUIT_ERROR("conduit_base64_json protocol error: missing schema and data/base64");
+    }
 
-    std::string base64_str = "";
-    
-    if(jvalue.IsObject())
+    if(!jvalue.HasMember("data") || !jvalue["data"].HasMember("base64"))
     {
-        Schema s;
-        if (jvalue.HasMember("data") && jvalue["data"].HasMember("base64"))
-        {
-            base64_str = jvalue["data"]["base64"].GetString();
-        }
-        else
-        {
-            CONDUIT_ERROR("conduit_base64_json protocol error: missing data/base64");
-        }
-        
-        if (jvalue.HasMember("schema"))
-        {
-            // parse schema
-            index_t curr_offset = 0;
-            walk_json_schema(&s,jvalue["schema"],curr_offset);
-        }
-        else
-        {
-            CONDUIT_ERROR("conduit_base64_json protocol error: missing schema");
-        }
-        
-        const char *src_ptr = base64_str.c_str();
-        index_t encoded_len = (index_t) base64_str.length();
-        index_t dec_buff_size = utils::base64_decode_buffer_size(encoded_len);
+        CONDUIT_ERROR("conduit_base64_json protocol error: missing data/base64");
+    }
 
-        // decode buffer
-        Node bb64_decode;
-        bb64_decode.set(DataType::char8_str(dec_buff_size));
-        char *decode_ptr = (char*)bb64_decode.data_ptr();
-        memset(decode_ptr,0,dec_buff_size);
+    if(!jvalue.HasMember("schema"))
+    {
+        CONDUIT_ERROR("conduit_base64_json protocol error: missing schema");
+    }
 
-        utils::base64_decode(src_ptr,
-                             encoded_len,
-                             decode_ptr);
+    // parse schema
+    Schema s;
+    index_t curr_offset = 0;
+    walk_json_schema(&s,jvalue["schema"],curr_offset);
+
+    // decode straight from the document's string
+    const conduit_rapidjson::Value &b64_value = jvalue["data"]["base64"];
+    const char *src_ptr = b64_value.GetString();
+    index_t encoded_len = (index_t) b64_value.GetStringLength();
+
+    // the encoded data has the schema's layout, it is decoded directly
+    // into the node's allocation unless it needs to be compacted or
+    // the node's allocator returns device memory
+    bool in_place = !utils::is_device_allocator(node->allocator());
+    if(in_place && compact)
+    {
+        Schema s_compact;
+        s.compact_to(s_compact);
+        // (equals() does not compare strides)
+        in_place = s.is_compact() && s_compact.equals(s);
+    }
 
-        node->set(s,decode_ptr);
+    Node n_staging;
+    Node &n_dec = in_place ? *node : n_staging;
+    n_dec.allocate_using_schema(s);
+    uint8 *data_ptr = (uint8*)n_dec.m_data;
+    index_t nbytes  = n_dec.m_data_size;
+    index_t dec_nbytes = utils::base64_decode(src_ptr,
+                                              encoded_len,
+                                              data_ptr,
+                                              nbytes);
+    if(dec_nbytes < nbytes)
+    {
+        memset(data_ptr + dec_nbytes, 0, (size_t)(nbytes - dec_nbytes));
+    }
 
+    if(compact && !in_place)
+    {
+        n_staging.compact_to(*node);
     }
-    else
+    else if(!in_place)
     {
-        CONDUIT_ERROR("conduit_base64_json protocol error: missing schema and data/base64");
+        node->set(s,data_ptr);
     }
 }
 
@@ -1554,43 +2010,1453 @@ Generator::Parser::JSON::parse_error_details(const std::string &json,
        << " json:\n"     << json << "\n"; 
 }
 
-
-//-----------------------------------------------------------------------------
-// -- end conduit::Generator::Parser::JSON --
 //-----------------------------------------------------------------------------
-
+// -- begin conduit::Generator::Parser::JSON::SanitizedStream --
 //-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML --
+//
+// Applies the same rules as utils::json_sanitize (strip '//' comments and
+// quote unquoted identifiers) while the text is read, so we don't need a
+// sanitized copy of the entire input.
+//
+// Follows the rapidjson input stream concept.
+//
 //-----------------------------------------------------------------------------
+template<typename InputStream>
+class Generator::Parser::JSON::SanitizedStream
+{
+public:
+    typedef char Ch;
+
+    SanitizedStream(InputStream &is)
+    : m_is(is),
+      m_out(),
+      m_out_pos(0),
+      m_in_comment(false),
+      m_in_string(false),
+      m_in_id(false),
+      m_has_prev(false),
+      m_prev('\0'),
+      m_cur_id(),
+      m_count(0),
+      m_line(0),
+      m_char(0)
+    {}
+
+    Ch Peek() const
+    {
+        if(m_out_pos == m_out.size())
+        {
+            fill();
+        }
+        return m_out_pos < m_out.size() ? m_out[m_out_pos] : '\0';
+    }
 
+    Ch Take()
+    {
+        Ch c = Peek();
+        if(c != '\0')
+        {
+            m_out_pos++;
+            m_count++;
+            if(c == '\n')
+            {
+                m_line++;
+                m_char = 0;
+            }
+            else
+            {
+                m_char++;
+            }
+        }
+        return c;
+    }
 
-//-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML::YAMLParserWrapper --
-//-----------------------------------------------------------------------------
-
+    size_t  Tell() const { return m_count; }
 
-//---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::YAMLParserWrapper()
-: m_yaml_parser_is_valid(false),
-  m_yaml_doc_is_valid(false)
-{
+    // line and character of the current position (for error messages)
+    index_t line() const      { return m_line; }
+    index_t character() const { return m_char; }
 
-}
+    // output stream methods are not supported
+    Ch     *PutBegin() { RAPIDJSON_ASSERT(false); return 0; }
+    void    Put(Ch) { RAPIDJSON_ASSERT(false); }
+    void    Flush() { RAPIDJSON_ASSERT(false); }
+    size_t  PutEnd(Ch*) { RAPIDJSON_ASSERT(false); return 0; }
 
-//---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::~YAMLParserWrapper()
-{
-    // cleanup!
-    if(m_yaml_parser_is_valid)
+private:
+    // same checks as used by utils::json_sanitize
+    static bool is_word_char(const char v)
     {
-        yaml_parser_delete(&m_yaml_parser);
+        return ( 'A' <= v && v <= 'Z') ||
+               ( 'a' <= v && v <= 'z') ||
+               v == '_';
     }
 
-    if(m_yaml_doc_is_valid)
+    static bool is_num_char(const char v)
     {
-        yaml_document_delete(&m_yaml_doc);
+        return ( '0' <= v && v <= '9');
     }
-}
+
+    // sanitizes the next chunk of input text
+    void fill() const
+    {
+        m_out.clear();
+        m_out_pos = 0;
+
+        while(m_out.size() < 4096 && m_is.Peek() != '\0')
+        {
+            char c    = m_is.Take();
+            char next = m_is.Peek();
+            bool emit = true;
+
+            // check for start & end of a string
+            if(c == '\"' && m_has_prev && m_prev != '\\')
+            {
+                m_in_string = !m_in_string;
+            }
+
+            if(!m_in_string)
+            {
+                if(!m_in_comment && c == '/' && next == '/')
+                {
+                    m_in_comment = true;
+                    emit = false;
+                }
+
+                if(!m_in_comment)
+                {
+                    if( !m_in_id && is_word_char(c))
+                    {
+                        // ids can't start with numbers
+                        if(m_has_prev &&
+                           !is_num_char(m_prev) &&
+                           m_prev != '.')
+                        {
+                            m_in_id = true;
+                            m_cur_id += c;
+                            emit = false;
+                        }
+                    }
+                    else if(m_in_id) // finish the id
+                    {
+                        if(is_word_char(c) ||
+                           is_num_char(c))
+                        {
+                            m_cur_id += c;
+                            emit = false;
+                        }
+                        else
+                        {
+                            m_in_id = false;
+                            // don't quote true, false, or null
+                            if( !(m_cur_id == "true"  ||
+                                  m_cur_id == "false" ||
+                                  m_cur_id == "null" ))
+                            {
+                                m_out += "\"" + m_cur_id + "\"";
+                            }
+                            else
+                            {
+                                m_out += m_cur_id;
+                            }
+                            m_cur_id.clear();
+                        }
+                    }
+                }
+
+                if(m_in_comment)
+                {
+                    emit = false;
+                    if(c == '\n')
+                    {
+                        m_in_comment = false;
+                    }
+                }
+            }
+
+            if(emit)
+            {
+                m_out += c;
+            }
+
+            m_prev = c;
+            m_has_prev = true;
+        }
+    }
+
+    InputStream            &m_is;
+    // sanitized text that has not been consumed
+    mutable std::string     m_out;
+    mutable size_t          m_out_pos;
+    // json_sanitize state
+    mutable bool            m_in_comment;
+    mutable bool            m_in_string;
+    mutable bool            m_in_id;
+    mutable bool            m_has_prev;
+    mutable char            m_prev;
+    mutable std::string     m_cur_id;
+    // position info
+    size_t                  m_count;
+    index_t                 m_line;
+    index_t                 m_char;
+};
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON::SanitizedStream --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser::JSON::PureJSONHandler --
+//-----------------------------------------------------------------------------
+//
+// Builds a node tree from "json" SAX events, following the same rules
+// as walk_pure_json_schema.
+//
+// Arrays start out as numeric candidates, with values collected in
+// a NumericSequence. At the end of the array they become an int64 or
+// float64 leaf. If a non numeric entry shows up, the array is converted
+// to a list.
+//
+//-----------------------------------------------------------------------------
+class Generator::Parser::JSON::PureJSONHandler
+{
+public:
+    PureJSONHandler(Node &node)
+    : m_root(node),
+      m_stack(),
+      m_key(),
+      m_seq()
+    {}
+
+    bool Null()
+    {
+        value_node()->reset();
+        return true;
+    }
+
+    bool Bool(bool value)
+    {
+        // we store bools as uint8s
+        value_node()->set((uint8)(value ? 1 : 0));
+        return true;
+    }
+
+    bool Int(int value)
+    {
+        return Int64((int64_t)value);
+    }
+
+    bool Uint(unsigned value)
+    {
+        return Int64((int64_t)value);
+    }
+
+    bool Int64(int64_t value)
+    {
+        if(in_numeric_seq())
+        {
+            m_seq.append_int64((int64)value);
+        }
+        else
+        {
+            value_node()->set((int64)value);
+        }
+        return true;
+    }
+
+    bool Uint64(uint64_t value)
+    {
+        // use int64 when the value fits, like the rapidjson dom path
+        if(value <= (uint64_t)std::numeric_limits<int64>::max())
+        {
+            return Int64((int64_t)value);
+        }
+
+        if(in_numeric_seq())
+        {
+            m_seq.append_uint64((uint64)value);
+        }
+        else
+        {
+            value_node()->set((uint64)value);
+        }
+        return true;
+    }
+
+    bool Double(double value)
+    {
+        if(in_numeric_seq())
+        {
+            m_seq.append_float64((float64)value);
+        }
+        else
+        {
+            value_node()->set((float64)value);
+        }
+        return true;
+    }
+
+    bool String(const char *str,
+                conduit_rapidjson::SizeType length,
+                bool /*copy*/)
+    {
+        std::string sval(str,length);
+        // we may have strings that are nan, inf, etc
+        if(in_numeric_seq() && string_is_double(sval.c_str()))
+        {
+            m_seq.append_string(sval,string_to_double(sval.c_str()));
+        }
+        else
+        {
+            value_node()->set(sval);
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        Node *node = value_node();
+        // if we make it here and have an empty json object
+        // we still want the conduit node to take on the
+        // object role
+        node->schema_ptr()->set(DataType::object());
+        push(node,OBJECT);
+        return true;
+    }
+
+    bool Key(const char *str,
+             conduit_rapidjson::SizeType length,
+             bool /*copy*/)
+    {
+        m_key.assign(str,length);
+        Node *node = m_stack.back().node;
+        // json files may have duplicate object names
+        // however duplicate object names are most likely a
+        // typo, so it's best to throw an error
+        if(node->schema_ptr()->has_child(m_key))
+        {
+            CONDUIT_ERROR("JSON Generator error:\n"
+                          << "Duplicate JSON object name: "
+                          << utils::join_path(node->path(),m_key));
+        }
+        return true;
+    }
+
+    bool EndObject(conduit_rapidjson::SizeType /*count*/)
+    {
+        m_stack.pop_back();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        Node *node = value_node();
+        push(node,NUMERIC_SEQ);
+        m_seq.reset();
+        return true;
+    }
+
+    bool EndArray(conduit_rapidjson::SizeType /*count*/)
+    {
+        Frame &frame = m_stack.back();
+        if(frame.type == NUMERIC_SEQ)
+        {
+            Node *node = frame.node;
+            index_t num_vals = m_seq.size();
+            if(num_vals == 0)
+            {
+                // if we make it here and have an empty json list
+                // we still want the conduit node to take on the
+                // list role
+                node->schema_ptr()->set(DataType::list());
+            }
+            else if(m_seq.has_float64())
+            {
+                node->set(DataType::float64(num_vals));
+                float64 *vals_ptr = (float64*)node->element_ptr(0);
+                for(index_t i=0; i < num_vals; i++)
+                {
+                    vals_ptr[i] = m_seq.to_float64(i);
+                }
+            }
+            else
+            {
+                node->set(DataType::int64(num_vals));
+                int64 *vals_ptr = (int64*)node->element_ptr(0);
+                for(index_t i=0; i < num_vals; i++)
+                {
+                    vals_ptr[i] = m_seq.to_int64(i);
+                }
+            }
+            m_seq.reset();
+        }
+        m_stack.pop_back();
+        return true;
+    }
+
+private:
+    enum FrameType
+    {
+        OBJECT,
+        LIST,
+        NUMERIC_SEQ
+    };
+
+    struct Frame
+    {
+        Node *node;
+        int   type;
+    };
+
+    void push(Node *node, int type)
+    {
+        Frame frame;
+        frame.node = node;
+        frame.type = type;
+        m_stack.push_back(frame);
+    }
+
+    bool in_numeric_seq() const
+    {
+        return !m_stack.empty() && m_stack.back().type == NUMERIC_SEQ;
+    }
+
+    // returns the node that holds the next value
+    Node *value_node()
+    {
+        if(m_stack.empty())
+        {
+            return &m_root;
+        }
+
+        Frame &frame = m_stack.back();
+
+        if(frame.type == OBJECT)
+        {
+            return append_object_child(frame.node,m_key);
+        }
+
+        if(frame.type == NUMERIC_SEQ)
+        {
+            to_list(frame);
+        }
+
+        return append_list_child(frame.node);
+    }
+
+    // converts a numeric candidate array into a list, adding a child for
+    // each value that was collected so far.
+    void to_list(Frame &frame)
+    {
+        Node *node = frame.node;
+        node->schema_ptr()->set(DataType::list());
+        index_t num_vals = m_seq.size();
+        for(index_t i=0; i < num_vals; i++)
+        {
+            Node *curr_node = append_list_child(node);
+            switch(m_seq.kind(i))
+            {
+                case NumericSequence::INT64_VALUE:
+                    curr_node->set(m_seq.to_int64(i));
+                    break;
+                case NumericSequence::UINT64_VALUE:
+                    curr_node->set(m_seq.to_uint64(i));
+                    break;
+                case NumericSequence::FLOAT64_VALUE:
+                    curr_node->set(m_seq.to_float64(i));
+                    break;
+                default: // NumericSequence::STRING_VALUE
+                    curr_node->set(m_seq.string_value(i));
+                    break;
+            }
+        }
+        m_seq.reset();
+        frame.type = LIST;
+    }
+
+    Node               &m_root;
+    std::vector<Frame>  m_stack;
+    // name of the next object entry
+    std::string         m_key;
+    // values of the current numeric candidate array
+    NumericSequence     m_seq;
+};
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON::PureJSONHandler --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser::JSON::ConduitJSONHandler --
+//-----------------------------------------------------------------------------
+//
+// Builds a node tree from "conduit_json" SAX events, following the same
+// rules as walk_json_schema (without external data).
+//
+// An object whose first entry is "dtype" is a leaf. Its dtype entries are
+// collected until "value" is found, at that point the leaf is allocated.
+// When the number of elements is known, inline array values are written
+// directly into the leaf, otherwise they are collected in a
+// NumericSequence and copied into the leaf at the end of the array.
+//
+//-----------------------------------------------------------------------------
+class Generator::Parser::JSON::ConduitJSONHandler
+{
+public:
+    ConduitJSONHandler(Node &node)
+    : m_root(node),
+      m_stack(),
+      m_key(),
+      m_skip_depth(0),
+      m_leaf(),
+      m_seq()
+    {}
+
+    bool Null()
+    {
+        if(m_skip_depth > 0)
+            return true;
+
+        switch(top_type())
+        {
+            case LEAF:
+                if(m_leaf.key == "value")
+                {
+                    // empty data type
+                    create_leaf(false)->reset();
+                    m_leaf.has_value = true;
+                }
+                else
+                {
+                    check_leaf_entry_type("null");
+                }
+                break;
+            case VALUE_ARRAY:
+                invalid_value_entry();
+                break;
+            case VALUE_OBJECT:
+                // other entries are ignored
+                break;
+            default:
+                invalid_schema_type();
+                break;
+        }
+        return true;
+    }
+
+    bool Bool(bool value)
+    {
+        if(m_skip_depth > 0)
+            return true;
+
+        switch(top_type())
+        {
+            case LEAF:
+                if(m_leaf.key == "value")
+                {
+                    Node *node = create_leaf(false);
+                    if(node->dtype().id() != DataType::UINT8_ID)
+                    {
+                        CONDUIT_ERROR("JSON Generator error:\n"
+                                       << "a JSON bool can only be used as an inline"
+                                       << " value for a Conduit UINT8 Node.");
+                    }
+                    node->set((uint8)value);
+                    m_leaf.has_value = true;
+                }
+                else
+                {
+                    check_leaf_entry_type("bool");
+                }
+                break;
+            case VALUE_ARRAY:
+                invalid_value_entry();
+                break;
+            case VALUE_OBJECT:
+                // other entries are ignored
+                break;
+            default:
+                invalid_schema_type();
+                break;
+        }
+        return true;
+    }
+
+    bool Int(int value)
+    {
+        return Int64((int64_t)value);
+    }
+
+    bool Uint(unsigned value)
+    {
+        return Int64((int64_t)value);
+    }
+
+    bool Int64(int64_t value)
+    {
+        number(NumericSequence::INT64_VALUE,
+               (int64)value,
+               (float64)value);
+        return true;
+    }
+
+    bool Uint64(uint64_t value)
+    {
+        if(value <= (uint64_t)std::numeric_limits<int64>::max())
+        {
+            return Int64((int64_t)value);
+        }
+        number(NumericSequence::UINT64_VALUE,
+               (int64)value,
+               (float64)value);
+        return true;
+    }
+
+    bool Double(double value)
+    {
+        number(NumericSequence::FLOAT64_VALUE,
+               (int64)value,
+               (float64)value);
+        return true;
+    }
+
+    bool String(const char *str,
+                conduit_rapidjson::SizeType length,
+                bool /*copy*/)
+    {
+        if(m_skip_depth > 0)
+            return true;
+
+        std::string sval(str,length);
+
+        switch(top_type())
+        {
+            case LEAF:
+                leaf_string(sval);
+                break;
+            case VALUE_ARRAY:
+                // could be an inline string with nan,inf,etc
+                if(string_is_double(sval.c_str()))
+                {
+                    float64 value = string_to_double(sval.c_str());
+                    if(m_leaf.direct)
+                    {
+                        next_value_element(NumericSequence::FLOAT64_VALUE,
+                                           (int64)value,
+                                           value);
+                    }
+                    else
+                    {
+                        m_seq.append_string(sval,value);
+                        m_leaf.num_values++;
+                    }
+                }
+                else
+                {
+                    invalid_value_entry();
+                }
+                break;
+            case VALUE_OBJECT:
+                if(m_key == "base64")
+                {
+                    parse_base64_value(str,(index_t)length,*m_leaf.node);
+                }
+                // other entries are ignored
+                break;
+            default:
+            {
+                // Simplest case, handles "uint32", "float64", etc
+                Node *node = value_node();
+                index_t dtype_id = parse_leaf_dtype_name(sval);
+                index_t ele_size = DataType::default_bytes(dtype_id);
+                node->set(DataType(dtype_id,
+                                   1,
+                                   0,
+                                   ele_size,
+                                   ele_size,
+                                   Endianness::DEFAULT_ID));
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        if(m_skip_depth > 0)
+        {
+            m_skip_depth++;
+            return true;
+        }
+
+        if(start_nested_in_leaf(true))
+        {
+            return true;
+        }
+        push(value_node(),PENDING_OBJECT);
+        return true;
+    }
+
+    bool Key(const char *str,
+             conduit_rapidjson::SizeType length,
+             bool /*copy*/)
+    {
+        if(m_skip_depth > 0)
+            return true;
+
+        std::string key(str,length);
+        Frame &frame = m_stack.back();
+
+        if(frame.type == PENDING_OBJECT)
+        {
+            if(key == "dtype")
+            {
+                frame.type = LEAF;
+                m_leaf.reset();
+                m_leaf.key = key;
+                return true;
+            }
+            frame.node->schema_ptr()->set(DataType::object());
+            frame.type = OBJECT;
+        }
+
+        if(frame.type == LEAF)
+        {
+            if(m_leaf.has_value && is_dtype_entry(key))
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "streaming parsing requires 'value' to be"
+                              << " the last dtype entry of a leaf "
+                              << "(found '" << key << "' after 'value'"
+                              << " at path: " << frame.node->path() << ")");
+            }
+            m_leaf.key = key;
+        }
+        else if(frame.type == VALUE_OBJECT)
+        {
+            m_key = key;
+        }
+        else // OBJECT
+        {
+            if(key == "dtype")
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "streaming parsing requires 'dtype' to be"
+                              << " the first entry of a leaf "
+                              << "(at path: "
+                              << utils::join_path(frame.node->path(),key)
+                              << ")");
+            }
+
+            // json files may have duplicate object names
+            // however duplicate object names are most likely a
+            // typo, so it's best to throw an error
+            if(frame.node->schema_ptr()->has_child(key))
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "Duplicate JSON object name: "
+                              << utils::join_path(frame.node->path(),key));
+            }
+            m_key = key;
+        }
+        return true;
+    }
+
+    bool EndObject(conduit_rapidjson::SizeType /*count*/)
+    {
+        if(m_skip_depth > 0)
+        {
+            m_skip_depth--;
+            return true;
+        }
+
+        Frame &frame = m_stack.back();
+        if(frame.type == PENDING_OBJECT)
+        {
+            // empty object
+            frame.node->schema_ptr()->set(DataType::object());
+        }
+        else if(frame.type == LEAF)
+        {
+            if(m_leaf.dtype_name.empty())
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                               << "'dtype' must be a JSON string.");
+            }
+            // leaf without inline values, allocate it
+            create_leaf(false);
+        }
+        m_stack.pop_back();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if(m_skip_depth > 0)
+        {
+            m_skip_depth++;
+            return true;
+        }
+
+        if(start_nested_in_leaf(false))
+        {
+            return true;
+        }
+
+        Node *node = value_node();
+        node->schema_ptr()->set(DataType::list());
+        push(node,LIST);
+        return true;
+    }
+
+    bool EndArray(conduit_rapidjson::SizeType /*count*/)
+    {
+        if(m_skip_depth > 0)
+        {
+            m_skip_depth--;
+            return true;
+        }
+
+        if(top_type() == VALUE_ARRAY)
+        {
+            end_value_array();
+        }
+        m_stack.pop_back();
+        return true;
+    }
+
+private:
+    enum FrameType
+    {
+        NONE,
+        OBJECT,
+        LIST,
+        PENDING_OBJECT, // object with no entries yet
+        LEAF,           // object with dtype entries
+        VALUE_ARRAY,    // inline value array of a leaf
+        VALUE_OBJECT    // inline value object of a leaf ({"base64": ...})
+    };
+
+    struct Frame
+    {
+        Node *node;
+        int   type;
+    };
+
+    // dtype entries of the current leaf
+    struct LeafInfo
+    {
+        void reset()
+        {
+            key.clear();
+            dtype_name.clear();
+            num_eles = 0;
+            has_num_eles = false;
+            length = 0;
+            has_length = false;
+            ele_bytes = 0;
+            has_ele_bytes = false;
+            endianness = Endianness::DEFAULT_ID;
+            has_value = false;
+            node = NULL;
+            direct = false;
+            invalid = false;
+            num_values = 0;
+        }
+
+        // entry whose value is parsed next
+        std::string key;
+
+        std::string dtype_name;
+        index_t     num_eles;
+        bool        has_num_eles;
+        // DEPRECATE: length is the old schema style
+        index_t     length;
+        bool        has_length;
+        index_t     ele_bytes;
+        bool        has_ele_bytes;
+        index_t     endianness;
+
+        bool        has_value;
+        // allocated leaf
+        Node       *node;
+        // value array state
+        //  direct:  if values are written directly into the leaf
+        //  invalid: if the value array is not homogenous numeric
+        bool        direct;
+        bool        invalid;
+        index_t     num_values;
+    };
+
+    void push(Node *node, int type)
+    {
+        Frame frame;
+        frame.node = node;
+        frame.type = type;
+        m_stack.push_back(frame);
+    }
+
+    int top_type() const
+    {
+        return m_stack.empty() ? (int)NONE : m_stack.back().type;
+    }
+
+    // returns the node that holds the next schema entry
+    Node *value_node()
+    {
+        if(m_stack.empty())
+        {
+            return &m_root;
+        }
+
+        Frame &frame = m_stack.back();
+        if(frame.type == OBJECT)
+        {
+            return append_object_child(frame.node,m_key);
+        }
+        return append_list_child(frame.node);
+    }
+
+    static bool is_dtype_entry(const std::string &key)
+    {
+        return key == "dtype" ||
+               key == "number_of_elements" ||
+               key == "length" ||
+               key == "offset" ||
+               key == "stride" ||
+               key == "element_bytes" ||
+               key == "endianness" ||
+               key == "value";
+    }
+
+    void invalid_schema_type()
+    {
+        CONDUIT_ERROR("JSON Generator error:\n"
+                      << "Invalid JSON type for parsing Node."
+                      << " Expected: JSON Object, Array, or String");
+    }
+
+    // checks that a non numeric, non string leaf entry
+    // is not a known dtype entry
+    void check_leaf_entry_type(const std::string &json_type)
+    {
+        const std::string &key = m_leaf.key;
+        if(key == "dtype")
+        {
+            CONDUIT_ERROR("JSON Generator error:\n"
+                           << "'dtype' must be a JSON string.");
+        }
+        else if(key == "endianness")
+        {
+            CONDUIT_ERROR("JSON Generator error:\n"
+                          << "'endianness' must be a string"
+                          << " (\"big\" or \"little\")");
+        }
+        else if(is_dtype_entry(key) && key != "value")
+        {
+            CONDUIT_ERROR("JSON Generator error:\n"
+                           << "'" << key << "' must be a number "
+                           << "(found JSON " << json_type << ")");
+        }
+        // other entries are ignored
+    }
+
+    // handles objects and arrays that start inside of a leaf,
+    // returns true if the event was consumed
+    bool start_nested_in_leaf(bool is_object)
+    {
+        int type = top_type();
+        if(type == VALUE_OBJECT)
+        {
+            // ignored entry
+            m_skip_depth = 1;
+        }
+        else if(type == VALUE_ARRAY)
+        {
+            // non homogenous inline array, skip the nested value
+            invalid_value_entry();
+            m_skip_depth = 1;
+        }
+        else if(type == LEAF && m_leaf.key != "value")
+        {
+            if(is_object && m_leaf.key == "dtype")
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "streaming parsing does not support"
+                              << " 'list_of' style (JSON Object) dtypes"
+                              << " (at path: "
+                              << m_stack.back().node->path() << ")");
+            }
+            check_leaf_entry_type(is_object ? "object" : "array");
+            // ignored entry
+            m_skip_depth = 1;
+        }
+        else if(type == LEAF && is_object)
+        {
+            // JSON Object used as value, only a base64 entry sets values
+            create_leaf(false);
+            m_leaf.has_value = true;
+            m_key.clear();
+            push(m_stack.back().node,VALUE_OBJECT);
+        }
+        else if(type == LEAF)
+        {
+            begin_value_array();
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // allocates the current leaf using the parsed dtype entries
+    Node *create_leaf(bool value_is_array)
+    {
+        if(m_leaf.node != NULL)
+        {
+            return m_leaf.node;
+        }
+
+        if(m_leaf.dtype_name.empty())
+        {
+            CONDUIT_ERROR("JSON Generator error:\n"
+                           << "'dtype' must be a JSON string.");
+        }
+
+        index_t dtype_id = parse_leaf_dtype_name(m_leaf.dtype_name);
+        index_t ele_size = m_leaf.has_ele_bytes ?
+                           m_leaf.ele_bytes :
+                           DataType::default_bytes(dtype_id);
+        index_t length = 0;
+        if(m_leaf.has_num_eles)
+        {
+            length = m_leaf.num_eles;
+        }
+        else if(m_leaf.has_length)
+        {
+            length = m_leaf.length;
+        }
+
+        if(length == 0)
+        {
+            if(value_is_array)
+            {
+                length = m_leaf.num_values;
+            }
+            // support explicit length 0 in a schema
+            else if(!m_leaf.has_num_eles && !m_leaf.has_length)
+            {
+                length = 1;
+            }
+        }
+
+        Node *node = m_stack.back().node;
+        // leaves are created compact
+        node->set(DataType(dtype_id,
+                           length,
+                           0,
+                           ele_size,
+                           ele_size,
+                           m_leaf.endianness));
+        m_leaf.node = node;
+        return node;
+    }
+
+    // string entry of a leaf
+    void leaf_string(const std::string &sval)
+    {
+        const std::string &key = m_leaf.key;
+        if(key == "dtype")
+        {
+            m_leaf.dtype_name = sval;
+        }
+        else if(key == "endianness")
+        {
+            if(sval == "big")
+            {
+                m_leaf.endianness = Endianness::BIG_ID;
+            }
+            else if(sval == "little")
+            {
+                m_leaf.endianness = Endianness::LITTLE_ID;
+            }
+            else
+            {
+                CONDUIT_ERROR("JSON Generator error:\n"
+                          << "'endianness' must be a string"
+                          << " (\"big\" or \"little\")"
+                          << " parsed value: " << sval);
+            }
+        }
+        else if(key == "value")
+        {
+            Node *node = create_leaf(false);
+            if(node->dtype().id() != DataType::CHAR8_STR_ID)
+            {
+                 // only allow strings to be assigned to a char8_str type
+                CONDUIT_ERROR("JSON Generator error:\n"
+                               << "a JSON string can only be used as an inline"
+                               << " value for a Conduit CHAR8_STR Node.");
+            }
+            node->set(utils::unescape_special_chars(sval));
+            m_leaf.has_value = true;
+        }
+        else
+        {
+            check_leaf_entry_type("string");
+        }
+    }
+
+    // numeric event (json number)
+    void number(int kind, int64 ival, float64 dval)
+    {
+        if(m_skip_depth > 0)
+            return;
+
+        int type = top_type();
+        if(type == VALUE_OBJECT)
+        {
+            // other entries are ignored
+        }
+        else if(type == VALUE_ARRAY)
+        {
+            if(m_leaf.direct)
+            {
+                next_value_element(kind,ival,dval);
+            }
+            else
+            {
+                if(kind == NumericSequence::FLOAT64_VALUE)
+                {
+                    m_seq.append_float64(dval);
+                }
+                else if(kind == NumericSequence::UINT64_VALUE)
+                {
+                    m_seq.append_uint64((uint64)ival);
+                }
+                else
+                {
+                    m_seq.append_int64(ival);
+                }
+                m_leaf.num_values++;
+            }
+        }
+        else if(type == LEAF)
+        {
+            const std::string &key = m_leaf.key;
+            index_t value = (kind == NumericSequence::FLOAT64_VALUE) ?
+                            (index_t)dval : (index_t)ival;
+            if(key == "number_of_elements")
+            {
+                m_leaf.num_eles = value;
+                m_leaf.has_num_eles = true;
+            }
+            else if(key == "length")
+            {
+                m_leaf.length = value;
+                m_leaf.has_length = true;
+            }
+            else if(key == "element_bytes")
+            {
+                m_leaf.ele_bytes = value;
+                m_leaf.has_ele_bytes = true;
+            }
+            else if(key == "offset" || key == "stride")
+            {
+                // leaves are created compact, so these don't apply
+            }
+            else if(key == "value")
+            {
+                set_inline_number(*create_leaf(false),kind,ival,dval);
+                m_leaf.has_value = true;
+            }
+            else if(key == "dtype" || key == "endianness")
+            {
+                check_leaf_entry_type("number");
+            }
+        }
+        else
+        {
+            invalid_schema_type();
+        }
+    }
+
+    // sets a leaf from a single inline number
+    // (like parse_inline_leaf, this changes the leaf to a scalar)
+    static void set_inline_number(Node &node,
+                                  int kind,
+                                  int64 ival,
+                                  float64 dval)
+    {
+        if(kind == NumericSequence::FLOAT64_VALUE &&
+           !node.dtype().is_floating_point())
+        {
+            ival = (int64)dval;
+        }
+
+        switch(node.dtype().id())
+        {
+            // signed ints
+            case DataType::INT8_ID:
+                node.set((int8)ival);
+                break;
+            case DataType::INT16_ID:
+                node.set((int16)ival);
+                break;
+            case DataType::INT32_ID:
+                node.set((int32)ival);
+                break;
+            case DataType::INT64_ID:
+                node.set((int64)ival);
+                break;
+            // unsigned ints
+            case DataType::UINT8_ID:
+                node.set((uint8)ival);
+                break;
+            case DataType::UINT16_ID:
+                node.set((uint16)ival);
+                break;
+            case DataType::UINT32_ID:
+                node.set((uint32)ival);
+                break;
+            case DataType::UINT64_ID:
+                node.set((uint64)ival);
+                break;
+            //floats
+            case DataType::FLOAT32_ID:
+                node.set((float32)dval);
+                break;
+            case DataType::FLOAT64_ID:
+                node.set((float64)dval);
+                break;
+            default:
+                // only allow numeric to be assigned to a numeric type
+                CONDUIT_ERROR("JSON Generator error:\n"
+                              << "a JSON number can only be used as an inline"
+                              << " value for a Conduit Numeric Node.");
+                break;
+        }
+    }
+
+    void begin_value_array()
+    {
+        index_t length = 0;
+        if(m_leaf.has_num_eles)
+        {
+            length = m_leaf.num_eles;
+        }
+        else if(m_leaf.has_length)
+        {
+            length = m_leaf.length;
+        }
+
+        m_leaf.num_values = 0;
+        m_leaf.invalid    = false;
+        // when we know the number of elements, write directly into the leaf
+        m_leaf.direct     = length > 0;
+        if(m_leaf.direct)
+        {
+            create_leaf(true);
+        }
+        else
+        {
+            m_seq.reset();
+        }
+        push(m_stack.back().node,VALUE_ARRAY);
+    }
+
+    void check_value_array_size()
+    {
+        if(m_leaf.direct &&
+           m_leaf.num_values > m_leaf.node->dtype().number_of_elements())
+        {
+            CONDUIT_ERROR("JSON Generator error:\n"
+                          << "number of elements in JSON array is more"
+                          << "than dtype can hold");
+        }
+    }
+
+    // non numeric entry in an inline value array
+    void invalid_value_entry()
+    {
+        m_leaf.invalid = true;
+        m_leaf.num_values++;
+        check_value_array_size();
+    }
+
+    // writes the next inline array value directly into the leaf
+    void next_value_element(int kind, int64 ival, float64 dval)
+    {
+        index_t idx = m_leaf.num_values;
+        m_leaf.num_values++;
+        check_value_array_size();
+
+        if(m_leaf.invalid)
+            return;
+
+        Node &node = *m_leaf.node;
+        if(kind == NumericSequence::FLOAT64_VALUE)
+        {
+            set_numeric_element(node,idx,dval);
+        }
+        else if(node.dtype().is_unsigned_integer())
+        {
+            set_numeric_element(node,idx,(uint64)ival);
+        }
+        else
+        {
+            set_numeric_element(node,idx,ival);
+        }
+    }
+
+    void end_value_array()
+    {
+        Node *node = NULL;
+        if(m_leaf.direct)
+        {
+            node = m_leaf.node;
+            if(m_leaf.invalid)
+            {
+                // non homogenous arrays don't set values
+                utils::conduit_memset(node->element_ptr(0),
+                                      0,
+                                      (size_t)node->dtype().spanned_bytes(),
+                                      node->allocator());
+            }
+        }
+        else
+        {
+            node = create_leaf(true);
+            index_t num_vals = m_seq.size();
+            if(!m_leaf.invalid && num_vals > 0)
+            {
+                if(m_seq.has_float64())
+                {
+                    for(index_t i=0; i < num_vals; i++)
+                    {
+                        set_numeric_element(*node,i,m_seq.to_float64(i));
+                    }
+                }
+                else if(node->dtype().is_unsigned_integer())
+                {
+                    for(index_t i=0; i < num_vals; i++)
+                    {
+                        set_numeric_element(*node,i,m_seq.to_uint64(i));
+                    }
+                }
+                else
+                {
+                    for(index_t i=0; i < num_vals; i++)
+                    {
+                        set_numeric_element(*node,i,m_seq.to_int64(i));
+                    }
+                }
+            }
+            m_seq.reset();
+        }
+        m_leaf.has_value = true;
+    }
+
+    Node               &m_root;
+    std::vector<Frame>  m_stack;
+    // name of the next object entry
+    std::string         m_key;
+    // > 0 while skipping the contents of ignored entries
+    index_t             m_skip_depth;
+    LeafInfo            m_leaf;
+    // values of an inline value array with unknown length
+    NumericSequence     m_seq;
+};
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON::ConduitJSONHandler --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+template<typename Handler, typename InputStream>
+void
+Generator::Parser::JSON::parse_stream(InputStream &is,
+                                      Handler &handler)
+{
+    SanitizedStream<InputStream> sanitized_is(is);
+    conduit_rapidjson::Reader reader;
+    conduit_rapidjson::ParseResult res =
+        reader.Parse<RAPIDJSON_PARSE_OPTS>(sanitized_is,handler);
+
+    if(res.IsError())
+    {
+        CONDUIT_ERROR("JSON parse error: \n"
+                      << " parse error message:\n"
+                      << GetParseError_En(res.Code()) << "\n"
+                      << " offset: "    << res.Offset() << "\n"
+                      << " line: "      << sanitized_is.line() << "\n"
+                      << " character: " << sanitized_is.character() << "\n");
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<typename InputStream>
+void
+Generator::Parser::JSON::walk_json_stream(InputStream &is,
+                                          const std::string &protocol,
+                                          Node &node)
+{
+    if(protocol == "json")
+    {
+        PureJSONHandler handler(node);
+        parse_stream(is,handler);
+    }
+    else if(protocol == "conduit_json")
+    {
+        ConduitJSONHandler handler(node);
+        parse_stream(is,handler);
+    }
+    else
+    {
+        CONDUIT_ERROR("Generator streaming does not support protocol: "
+                      << protocol
+                      << " (supported: json, conduit_json, yaml)");
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML --
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML::YAMLParserWrapper --
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLParserWrapper::YAMLParserWrapper()
+: m_yaml_parser_is_valid(false),
+  m_yaml_doc_is_valid(false)
+{
+
+}
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLParserWrapper::~YAMLParserWrapper()
+{
+    // cleanup!
+    if(m_yaml_parser_is_valid)
+    {
+        yaml_parser_delete(&m_yaml_parser);
+    }
+
+    if(m_yaml_doc_is_valid)
+    {
+        yaml_document_delete(&m_yaml_doc);
+    }
+}
 
 //---------------------------------------------------------------------------//
 void
@@ -1974,136 +3840,585 @@ Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
     // List case
     else if( yaml_node->type == YAML_SEQUENCE_NODE )
     {
-        index_t seq_size  = -1;
-        index_t hval_type = check_homogenous_yaml_numeric_sequence(*node,
-                                                                   yaml_doc,
-                                                                   yaml_node,
-                                                                   seq_size);
+        index_t seq_size  = -1;
+        index_t hval_type = check_homogenous_yaml_numeric_sequence(*node,
+                                                                   yaml_doc,
+                                                                   yaml_node,
+                                                                   seq_size);
+
+        if(hval_type == DataType::INT64_ID)
+        {
+
+            node->set(DataType::int64(seq_size));
+            parse_yaml_int64_array(yaml_doc, yaml_node, *node);
+
+        }
+        else if(hval_type == DataType::FLOAT64_ID)
+        {
+            node->set(DataType::float64(seq_size));
+            parse_yaml_float64_array(yaml_doc, yaml_node, *node);
+        }
+        else
+        {
+            // general case (not a numeric array)
+            index_t cld_idx = 0;
+            while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
+            {
+                yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
+                                                        yaml_node->data.sequence.items.start[cld_idx]);
+            
+                if(yaml_child == NULL )
+                {
+                    CONDUIT_ERROR("YAML Generator error:\n"
+                                  << "Invalid sequence child at path: "
+                                  << node->path() << "[" << cld_idx << "]");
+                }
+
+                schema->append();
+                Schema *curr_schema = schema->child_ptr(cld_idx);
+                Node * curr_node = new Node();
+                curr_node->set_schema_ptr(curr_schema);
+                curr_node->set_parent(node);
+                node->append_node_ptr(curr_node);
+                walk_pure_yaml_schema(curr_node,
+                                      curr_schema,
+                                      yaml_doc,
+                                      yaml_child);
+                cld_idx++;
+            }
+        }
+    }
+    else if(yaml_node->type == YAML_SCALAR_NODE)// bytestr case
+    {
+        const char *yaml_value_str = (const char*)yaml_node->data.scalar.value;
+
+        if( yaml_value_str == NULL )
+        {
+            CONDUIT_ERROR("YAML Generator error:\n"
+                          << "Invalid yaml scalar value at path: "
+                          << node->path());
+        }
+
+        parse_yaml_inline_leaf(yaml_value_str,*node);
+    }
+    else // this will include unknown enum vals and YAML_NO_NODE
+    {
+        // not sure if can an even land here, but catch error just in case.
+        CONDUIT_ERROR("YAML Generator error:\n"
+                      << "Invalid YAML type for parsing Node from pure YAML."
+                      << " Expected: YAML Map, Sequence, String, Null,"
+                      << " Boolean, or Number");
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+void
+Generator::Parser::YAML::parse_error_details(yaml_parser_t *yaml_parser,
+                                             std::ostream &os)
+{
+    os << "YAML Parsing Error (";
+    switch (yaml_parser->error)
+    {
+        case YAML_NO_ERROR:
+            os << "YAML_NO_ERROR";
+            break;
+        case YAML_MEMORY_ERROR:
+            os << "YAML_MEMORY_ERROR";
+            break;
+        case YAML_READER_ERROR:
+            os << "YAML_MEMORY_ERROR";
+            break;
+        case YAML_SCANNER_ERROR:
+            os << "YAML_SCANNER_ERROR";
+            break;
+        case YAML_PARSER_ERROR:
+            os << "YAML_PARSER_ERROR";
+            break;
+        case YAML_COMPOSER_ERROR:
+            os << "YAML_COMPOSER_ERROR";
+            break;
+        case YAML_WRITER_ERROR:
+            os << "YAML_WRITER_ERROR";
+            break;
+        case YAML_EMITTER_ERROR:
+            os << "YAML_EMITTER_ERROR";
+            break;
+        default:
+            os << "[Unknown Error!]";
+            break;
+    }
+    
+    // Q: Is yaml_parser->problem_mark.index useful here?
+    //    that might be the only case where we need the yaml_doc
+    //    otherwise using yaml_parser is sufficient
+
+    if(yaml_parser->problem != NULL)
+    {
+        os << ")\n Problem:\n" << yaml_parser->problem << "\n"
+           << "  Problem Line: "   << yaml_parser->problem_mark.line << "\n"
+           << "  Problem Column: " << yaml_parser->problem_mark.column << "\n";
+    }
+    else
+    {
+        os << "unexpected: yaml_parser->problem is NULL (missing)\n";
+    }
+    if(yaml_parser->context != NULL)
+    {
+       os << " Context\n"         << yaml_parser->context << "\n"
+          << "  Context Line: "   << yaml_parser->context_mark.line << "\n"
+          << "  Context Column: " << yaml_parser->context_mark.column<< "\n";
+    }
+    os << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser::YAML::YAMLEventParserWrapper --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLEventParserWrapper::YAMLEventParserWrapper()
+: m_yaml_parser_is_valid(false),
+  m_yaml_event_is_valid(false)
+{
+
+}
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLEventParserWrapper::~YAMLEventParserWrapper()
+{
+    // cleanup!
+    if(m_yaml_event_is_valid)
+    {
+        yaml_event_delete(&m_yaml_event);
+    }
+
+    if(m_yaml_parser_is_valid)
+    {
+        yaml_parser_delete(&m_yaml_parser);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::YAMLEventParserWrapper::init()
+{
+    if(m_yaml_parser_is_valid)
+    {
+        CONDUIT_ERROR("YAMLEventParserWrapper input was already set");
+    }
+
+    // Initialize parser
+    if(yaml_parser_initialize(&m_yaml_parser) == 0)
+    {
+        // error!
+        CONDUIT_ERROR("yaml_parser_initialize failed");
+    }
+    else
+    {
+        m_yaml_parser_is_valid = true;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::YAMLEventParserWrapper::set_input(const char *yaml_txt)
+{
+    init();
+    yaml_parser_set_input_string(&m_yaml_parser,
+                                 (const unsigned char*)yaml_txt,
+                                 strlen(yaml_txt));
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::YAMLEventParserWrapper::set_input(FILE *yaml_file)
+{
+    init();
+    yaml_parser_set_input_file(&m_yaml_parser,
+                               yaml_file);
+}
+
+//---------------------------------------------------------------------------//
+yaml_event_t *
+Generator::Parser::YAML::YAMLEventParserWrapper::next_event()
+{
+    if(!m_yaml_parser_is_valid)
+    {
+        CONDUIT_ERROR("YAMLEventParserWrapper input was not set");
+    }
+
+    // release the previous event
+    if(m_yaml_event_is_valid)
+    {
+        yaml_event_delete(&m_yaml_event);
+        m_yaml_event_is_valid = false;
+    }
+
+    if(yaml_parser_parse(&m_yaml_parser, &m_yaml_event) == 0)
+    {
+        CONDUIT_YAML_PARSE_ERROR(NULL,
+                                 &m_yaml_parser);
+    }
+
+    m_yaml_event_is_valid = true;
+    return &m_yaml_event;
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::YAML::YAMLEventParserWrapper --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser::YAML::PureYAMLBuilder --
+//-----------------------------------------------------------------------------
+//
+// Builds a node tree from libyaml events, following the same rules
+// as walk_pure_yaml_schema.
+//
+// Sequences start out as numeric candidates, with values collected in
+// a NumericSequence. At the end of the sequence they become an int64 or
+// float64 leaf. If a non numeric entry shows up, the sequence is
+// converted to a list.
+//
+// Aliases are resolved by copying the anchored scalar or node.
+//
+//-----------------------------------------------------------------------------
+class Generator::Parser::YAML::PureYAMLBuilder
+{
+public:
+    PureYAMLBuilder(Node &node)
+    : m_root(node),
+      m_has_root(false),
+      m_stack(),
+      m_seq(),
+      m_scalar_anchors(),
+      m_node_anchors()
+    {}
+
+    bool has_root() const
+    {
+        return m_has_root;
+    }
+
+    void scalar(const char *yaml_value_str,
+                const char *anchor)
+    {
+        if(yaml_value_str == NULL)
+        {
+            CONDUIT_ERROR("YAML Generator error:\n"
+                          << "Invalid yaml scalar value at path: "
+                          << current_path());
+        }
+
+        if(anchor != NULL)
+        {
+            m_scalar_anchors[anchor] = yaml_value_str;
+        }
+
+        if(is_key_position())
+        {
+            set_key(yaml_value_str);
+            return;
+        }
+
+        if(in_numeric_seq())
+        {
+            // check for integers, then widen to floats
+            index_t dtype_id = yaml_leaf_to_numeric_dtype(yaml_value_str);
+            if(dtype_id == DataType::INT64_ID)
+            {
+                m_seq.append_int64((int64)string_to_long(yaml_value_str));
+                return;
+            }
+            else if(dtype_id == DataType::FLOAT64_ID)
+            {
+                m_seq.append_float64((float64)string_to_double(yaml_value_str));
+                return;
+            }
+        }
+
+        parse_yaml_inline_leaf(yaml_value_str,*value_node());
+    }
+
+    void alias(const char *anchor)
+    {
+        std::string anchor_name(anchor != NULL ? anchor : "");
 
-        if(hval_type == DataType::INT64_ID)
+        std::map<std::string,std::string>::const_iterator s_itr =
+            m_scalar_anchors.find(anchor_name);
+        if(s_itr != m_scalar_anchors.end())
+        {
+            // copy, since scalar() may add anchors
+            std::string yaml_value_str = s_itr->second;
+            scalar(yaml_value_str.c_str(),NULL);
+            return;
+        }
+
+        std::map<std::string,Node*>::const_iterator n_itr =
+            m_node_anchors.find(anchor_name);
+        if(n_itr == m_node_anchors.end())
         {
+            CONDUIT_ERROR("YAML Generator error:\n"
+                          << "Unknown alias \"" << anchor_name << "\""
+                          << " at path: " << current_path());
+        }
 
-            node->set(DataType::int64(seq_size));
-            parse_yaml_int64_array(yaml_doc, yaml_node, *node);
+        check_not_key("alias");
+        Node *src_node = n_itr->second;
+        value_node()->set(*src_node);
+    }
 
+    void start_mapping(const char *anchor)
+    {
+        check_not_key("mapping");
+        Node *node = value_node();
+        // if we make it here and have an empty yaml map
+        // we still want the conduit node to take on the
+        // object role
+        node->schema_ptr()->set(DataType::object());
+        push(node,MAPPING);
+        if(anchor != NULL)
+        {
+            m_node_anchors[anchor] = node;
         }
-        else if(hval_type == DataType::FLOAT64_ID)
+    }
+
+    void end_mapping()
+    {
+        m_stack.pop_back();
+    }
+
+    void start_sequence(const char *anchor)
+    {
+        check_not_key("sequence");
+        Node *node = value_node();
+        push(node,NUMERIC_SEQ);
+        m_seq.reset();
+        if(anchor != NULL)
         {
-            node->set(DataType::float64(seq_size));
-            parse_yaml_float64_array(yaml_doc, yaml_node, *node);
+            m_node_anchors[anchor] = node;
         }
-        else
+    }
+
+    void end_sequence()
+    {
+        Frame &frame = m_stack.back();
+        if(frame.type == NUMERIC_SEQ)
         {
-            // general case (not a numeric array)
-            index_t cld_idx = 0;
-            while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
+            Node *node = frame.node;
+            index_t num_vals = m_seq.size();
+            // empty sequences are left as empty nodes
+            if(num_vals > 0 && m_seq.has_float64())
             {
-                yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                        yaml_node->data.sequence.items.start[cld_idx]);
-            
-                if(yaml_child == NULL )
+                node->set(DataType::float64(num_vals));
+                float64 *vals_ptr = (float64*)node->element_ptr(0);
+                for(index_t i=0; i < num_vals; i++)
                 {
-                    CONDUIT_ERROR("YAML Generator error:\n"
-                                  << "Invalid sequence child at path: "
-                                  << node->path() << "[" << cld_idx << "]");
+                    vals_ptr[i] = m_seq.to_float64(i);
+                }
+            }
+            else if(num_vals > 0)
+            {
+                node->set(DataType::int64(num_vals));
+                int64 *vals_ptr = (int64*)node->element_ptr(0);
+                for(index_t i=0; i < num_vals; i++)
+                {
+                    vals_ptr[i] = m_seq.to_int64(i);
                 }
-
-                schema->append();
-                Schema *curr_schema = schema->child_ptr(cld_idx);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
-                node->append_node_ptr(curr_node);
-                walk_pure_yaml_schema(curr_node,
-                                      curr_schema,
-                                      yaml_doc,
-                                      yaml_child);
-                cld_idx++;
             }
+            m_seq.reset();
         }
+        m_stack.pop_back();
     }
-    else if(yaml_node->type == YAML_SCALAR_NODE)// bytestr case
+
+private:
+    enum FrameType
     {
-        const char *yaml_value_str = (const char*)yaml_node->data.scalar.value;
+        MAPPING,
+        LIST,
+        NUMERIC_SEQ
+    };
 
-        if( yaml_value_str == NULL )
+    struct Frame
+    {
+        Node        *node;
+        int          type;
+        // mapping state
+        bool         expect_key;
+        std::string  key;
+    };
+
+    void push(Node *node, int type)
+    {
+        Frame frame;
+        frame.node = node;
+        frame.type = type;
+        frame.expect_key = true;
+        m_stack.push_back(frame);
+    }
+
+    bool in_numeric_seq() const
+    {
+        return !m_stack.empty() && m_stack.back().type == NUMERIC_SEQ;
+    }
+
+    bool is_key_position() const
+    {
+        return !m_stack.empty() &&
+               m_stack.back().type == MAPPING &&
+               m_stack.back().expect_key;
+    }
+
+    std::string current_path() const
+    {
+        if(m_stack.empty())
+        {
+            return m_root.path();
+        }
+        return m_stack.back().node->path();
+    }
+
+    void check_not_key(const std::string &yaml_type)
+    {
+        if(is_key_position())
         {
+            const Node *node = m_stack.back().node;
             CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid yaml scalar value at path: "
-                          << node->path());
+                          << "Invalid mapping key type (" << yaml_type << ")"
+                          << " at path: "
+                          << node->path() << "["
+                          << node->number_of_children() << "]");
         }
+    }
 
-        parse_yaml_inline_leaf(yaml_value_str,*node);
+    void set_key(const char *yaml_key_str)
+    {
+        Frame &frame = m_stack.back();
+        frame.key = yaml_key_str;
+        frame.expect_key = false;
+
+        // yaml files may have duplicate object names
+        // however duplicate object names are most likely a
+        // typo, so it's best to throw an error
+        if(frame.node->schema_ptr()->has_child(frame.key))
+        {
+            CONDUIT_ERROR("YAML Generator error:\n"
+                          << "Duplicate YAML object name: "
+                          << utils::join_path(frame.node->path(),frame.key));
+        }
     }
-    else // this will include unknown enum vals and YAML_NO_NODE
+
+    // returns the node that holds the next value
+    Node *value_node()
     {
-        // not sure if can an even land here, but catch error just in case.
-        CONDUIT_ERROR("YAML Generator error:\n"
-                      << "Invalid YAML type for parsing Node from pure YAML."
-                      << " Expected: YAML Map, Sequence, String, Null,"
-                      << " Boolean, or Number");
+        if(m_stack.empty())
+        {
+            m_has_root = true;
+            return &m_root;
+        }
+
+        Frame &frame = m_stack.back();
+
+        if(frame.type == MAPPING)
+        {
+            // the next event is a key again
+            frame.expect_key = true;
+            return append_object_child(frame.node,frame.key);
+        }
+
+        if(frame.type == NUMERIC_SEQ)
+        {
+            to_list(frame);
+        }
+
+        return append_list_child(frame.node);
+    }
+
+    // converts a numeric candidate sequence into a list, adding a child for
+    // each value that was collected so far.
+    void to_list(Frame &frame)
+    {
+        Node *node = frame.node;
+        node->schema_ptr()->set(DataType::list());
+        index_t num_vals = m_seq.size();
+        for(index_t i=0; i < num_vals; i++)
+        {
+            Node *curr_node = append_list_child(node);
+            if(m_seq.kind(i) == NumericSequence::FLOAT64_VALUE)
+            {
+                curr_node->set(m_seq.to_float64(i));
+            }
+            else
+            {
+                curr_node->set(m_seq.to_int64(i));
+            }
+        }
+        m_seq.reset();
+        frame.type = LIST;
     }
-}
 
+    Node                                &m_root;
+    bool                                 m_has_root;
+    std::vector<Frame>                   m_stack;
+    // values of the current numeric candidate sequence
+    NumericSequence                      m_seq;
+    // anchors for alias support
+    std::map<std::string,std::string>    m_scalar_anchors;
+    std::map<std::string,Node*>          m_node_anchors;
+};
 
 //-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::YAML::PureYAMLBuilder --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Generator::Parser::YAML::parse_error_details(yaml_parser_t *yaml_parser,
-                                             std::ostream &os)
+Generator::Parser::YAML::walk_pure_yaml_events(Node *node,
+                                               YAMLEventParserWrapper &parser)
 {
-    os << "YAML Parsing Error (";
-    switch (yaml_parser->error)
-    {
-        case YAML_NO_ERROR:
-            os << "YAML_NO_ERROR";
-            break;
-        case YAML_MEMORY_ERROR:
-            os << "YAML_MEMORY_ERROR";
-            break;
-        case YAML_READER_ERROR:
-            os << "YAML_MEMORY_ERROR";
-            break;
-        case YAML_SCANNER_ERROR:
-            os << "YAML_SCANNER_ERROR";
-            break;
-        case YAML_PARSER_ERROR:
-            os << "YAML_PARSER_ERROR";
-            break;
-        case YAML_COMPOSER_ERROR:
-            os << "YAML_COMPOSER_ERROR";
-            break;
-        case YAML_WRITER_ERROR:
-            os << "YAML_WRITER_ERROR";
-            break;
-        case YAML_EMITTER_ERROR:
-            os << "YAML_EMITTER_ERROR";
-            break;
-        default:
-            os << "[Unknown Error!]";
-            break;
-    }
-    
-    // Q: Is yaml_parser->problem_mark.index useful here?
-    //    that might be the only case where we need the yaml_doc
-    //    otherwise using yaml_parser is sufficient
+    PureYAMLBuilder builder(*node);
 
-    if(yaml_parser->problem != NULL)
-    {
-        os << ")\n Problem:\n" << yaml_parser->problem << "\n"
-           << "  Problem Line: "   << yaml_parser->problem_mark.line << "\n"
-           << "  Problem Column: " << yaml_parser->problem_mark.column << "\n";
-    }
-    else
+    // like yaml_parser_load, we only parse the first document
+    bool done = false;
+    while(!done)
     {
-        os << "unexpected: yaml_parser->problem is NULL (missing)\n";
+        yaml_event_t *yaml_event = parser.next_event();
+
+        switch(yaml_event->type)
+        {
+            case YAML_SCALAR_EVENT:
+                builder.scalar((const char*)yaml_event->data.scalar.value,
+                               (const char*)yaml_event->data.scalar.anchor);
+                break;
+            case YAML_ALIAS_EVENT:
+                builder.alias((const char*)yaml_event->data.alias.anchor);
+                break;
+            case YAML_MAPPING_START_EVENT:
+                builder.start_mapping((const char*)yaml_event->data.mapping_start.anchor);
+                break;
+            case YAML_MAPPING_END_EVENT:
+                builder.end_mapping();
+                break;
+            case YAML_SEQUENCE_START_EVENT:
+                builder.start_sequence((const char*)yaml_event->data.sequence_start.anchor);
+                break;
+            case YAML_SEQUENCE_END_EVENT:
+                builder.end_sequence();
+                break;
+            case YAML_DOCUMENT_END_EVENT:
+            case YAML_STREAM_END_EVENT:
+                done = true;
+                break;
+            default: // stream and document start
+                break;
+        }
     }
-    if(yaml_parser->context != NULL)
+
+    if(!builder.has_root())
     {
-       os << " Context\n"         << yaml_parser->context << "\n"
-          << "  Context Line: "   << yaml_parser->context_mark.line << "\n"
-          << "  Context Column: " << yaml_parser->context_mark.column<< "\n";
+        CONDUIT_ERROR("failed to fetch yaml document root");
     }
-    os << std::endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -2199,6 +4514,23 @@ Generator::walk(Schema &schema) const
 void 
 Generator::walk(Node &node) const
 {
+    if(m_protocol == "conduit_base64_json")
+    {
+        // base64 data is decoded into memory owned by the node, in its
+        // compact layout
+        node.reset();
+        conduit_rapidjson::Document document;
+        std::string res = utils::json_sanitize(m_schema);
+
+        if(document.Parse<Parser::JSON::RAPIDJSON_PARSE_OPTS>(res.c_str()).HasParseError())
+        {
+            CONDUIT_JSON_PARSE_ERROR(res, document);
+        }
+
+        Parser::JSON::parse_base64(&node, document, true);
+        return;
+    }
+
     /// TODO: This is an inefficient code path, need better solution?
     Node n;
     walk_external(n);
@@ -2269,6 +4601,117 @@ Generator::walk_external(Node &node) const
 }
 
 
+//-----------------------------------------------------------------------------
+// Streaming Parsing interface
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Generator::walk_streaming(Node &node) const
+{
+    node.reset();
+
+    if(m_data != NULL)
+    {
+        CONDUIT_ERROR("Generator streaming does not support external data");
+    }
+
+    if(m_protocol == "yaml")
+    {
+        Parser::YAML::YAMLEventParserWrapper parser;
+        parser.set_input(m_schema.c_str());
+        // errors will flow up from this call
+        Parser::YAML::walk_pure_yaml_events(&node,parser);
+    }
+    else
+    {
+        conduit_rapidjson::StringStream is(m_schema.c_str());
+        Parser::JSON::walk_json_stream(is,m_protocol,node);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::walk_streaming_file(const std::string &path,
+                               const std::string &protocol,
+                               Node &node)
+{
+    node.reset();
+
+    FILE *fp = fopen(path.c_str(),"rb");
+    if(fp == NULL)
+    {
+        CONDUIT_ERROR("<Generator::walk_streaming_file> failed to open: "
+                      << path);
+    }
+
+    try
+    {
+        if(protocol == "yaml")
+        {
+            Parser::YAML::YAMLEventParserWrapper parser;
+            parser.set_input(fp);
+            Parser::YAML::walk_pure_yaml_events(&node,parser);
+        }
+        else
+        {
+            std::vector<char> buffer(65536);
+            conduit_rapidjson::FileReadStream is(fp,
+                                                 &buffer[0],
+                                                 buffer.size());
+            Parser::JSON::walk_json_stream(is,protocol,node);
+        }
+    }
+    catch(...)
+    {
+        fclose(fp);
+        throw;
+    }
+
+    fclose(fp);
+}
+
+
+//-----------------------------------------------------------------------------
+// Batch parsing interface
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Generator::parse_many(const std::vector<std::string> &texts,
+                      const std::string &protocol,
+                      Node &node,
+                      index_t num_threads)
+{
+    node.reset();
+
+    size_t num_texts = texts.size();
+    if(num_texts == 0)
+    {
+        return;
+    }
+
+    if(num_threads <= 0)
+    {
+        num_threads = (index_t)std::thread::hardware_concurrency();
+    }
+
+    // each text is parsed into its own independent tree, the results
+    // are moved into the output list after all workers finish
+    std::vector<Node> results(num_texts);
+    detail::parallel_for((index_t)num_texts, num_threads, [&](index_t idx)
+    {
+        Generator g(texts[(size_t)idx],protocol);
+        g.walk(results[(size_t)idx]);
+    });
+
+    for(size_t i=0; i < num_texts; i++)
+    {
+        node.append().move(results[i]);
+    }
+}
+
+
 //-----------------------------------------------------------------------------
 // -- end conduit::Generator --
 //-----------------------------------------------------------------------------
@@ -87,6 +87,53 @@ public:
     void walk(Node &ndest) const;
     void walk_external(Node &ndest) const;
 
+//-----------------------------------------------------------------------------
+// Streaming Parsing interface
+//-----------------------------------------------------------------------------
+    /// parse directly to a Node object using event based parsing
+    /// (RapidJSON's SAX reader for json, libyaml's event parser for yaml).
+    ///
+    /// No intermediate document tree is created and numeric arrays are
+    /// written into their leaf buffers as they are parsed. The resulting
+    /// tree has the same structure, types and values as walk(), however
+    /// each leaf owns its own allocation (the result is not compacted).
+    ///
+    /// supported protocols:
+    ///   "json"
+    ///   "conduit_json"
+    ///   "yaml"
+    ///
+    /// For "conduit_json", leaf entries must be laid out the way Conduit
+    /// writes them: "dtype" must be the first entry of a leaf and "value"
+    /// must follow the other dtype entries. "list_of" style dtypes and
+    /// external data pointers are not supported.
+    void walk_streaming(Node &ndest) const;
+
+    /// same as walk_streaming(), but incrementally reads the text
+    /// from the file at the given path.
+    static void walk_streaming_file(const std::string &path,
+                                    const std::string &protocol,
+                                    Node &ndest);
+
+//-----------------------------------------------------------------------------
+// Batch parsing interface
+//-----------------------------------------------------------------------------
+    /// parses each of the passed texts using the given protocol
+    /// (see walk()) concurrently on a pool of threads.
+    ///
+    /// ndest is reset to a list with one child per text, in the same
+    /// order as texts.
+    ///
+    /// num_threads <= 0 uses the hardware concurrency. The number
+    /// of threads used never exceeds the number of texts.
+    ///
+    /// If parsing any of the texts fails, the first error is thrown
+    /// after all threads finish and ndest is left empty.
+    static void parse_many(const std::vector<std::string> &texts,
+                           const std::string &protocol,
+                           Node &ndest,
+                           index_t num_threads = 0);
+
     // private class used to encapsulate RapidJSON logic. 
     class Parser;
 
@@ -9,6 +9,8 @@
 //-----------------------------------------------------------------------------
 #include "conduit_node.hpp"
 #include "conduit_log.hpp"
+#include "conduit_dispatch.hpp"
+#include "conduit_parallel.hpp"
 
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
 //
@@ -27,8 +29,12 @@
 // -- standard cpp lib includes --
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // -- standard c lib includes --
@@ -44,7 +50,9 @@
 //-----------------------------------------------------------------------------
 // -- conduit includes --
 //-----------------------------------------------------------------------------
+#include "conduit_compression.hpp"
 #include "conduit_error.hpp"
+#include "conduit_pack.hpp"
 #include "conduit_utils.hpp"
 
 // Easier access to the Conduit logging functions
@@ -78,1193 +86,2193 @@ using namespace conduit::utils;
 namespace conduit
 {
 
-//=============================================================================
 //-----------------------------------------------------------------------------
-//
-//
-// -- begin conduit::Node public methods --
-//
-//
+// -- begin conduit::detail --
 //-----------------------------------------------------------------------------
-//=============================================================================
-
+namespace detail
+{
 
 //-----------------------------------------------------------------------------
-//
-// -- begin definition of Node constructors + destructor --
-//
+///
+/// Checks if two trees have the same structure and identical compact
+/// leaf dtypes. Used by Node::update to detect when an update is
+/// equivalent to a single copy of contiguous memory.
+///
 //-----------------------------------------------------------------------------
+static bool
+same_compact_layout(const Node &a, const Node &b)
+{
+    const DataType &a_dt = a.dtype();
+    const DataType &b_dt = b.dtype();
+    index_t dtype_id = a_dt.id();
 
-//-----------------------------------------------------------------------------
-// -- basic constructor and destruction --
-//-----------------------------------------------------------------------------
+    if(dtype_id != b_dt.id())
+    {
+        return false;
+    }
 
-//---------------------------------------------------------------------------//
-Node::Node()
-{
-    init_defaults();
-}
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        index_t num_children = a.number_of_children();
+        if(num_children != b.number_of_children())
+        {
+            return false;
+        }
 
-//---------------------------------------------------------------------------//
-Node::Node(const Node &node)
-{
-    init_defaults();
-    set(node);
-}
+        if(dtype_id == DataType::OBJECT_ID)
+        {
+            const std::vector<std::string> &a_names = a.child_names();
+            const std::vector<std::string> &b_names = b.child_names();
+            if(a_names != b_names)
+            {
+                return false;
+            }
+        }
 
-//---------------------------------------------------------------------------//
-Node::~Node()
-{
-    cleanup();
-}
+        for(index_t i = 0; i < num_children; i++)
+        {
+            if(!same_compact_layout(*a.child_ptr(i),*b.child_ptr(i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    else if(dtype_id == DataType::EMPTY_ID)
+    {
+        return true;
+    }
 
-//---------------------------------------------------------------------------//
-void
-Node::reset()
-{
-    release();
-    m_schema->set(DataType::EMPTY_ID);
+    // leaf: stride must equal element bytes, so there are no striding
+    // holes that a bulk copy would overwrite
+    return a_dt.number_of_elements() == b_dt.number_of_elements() &&
+           a_dt.element_bytes()      == b_dt.element_bytes() &&
+           a_dt.endianness()         == b_dt.endianness() &&
+           ( a_dt.number_of_elements() <= 1 ||
+             ( a_dt.stride() == a_dt.element_bytes() &&
+               b_dt.stride() == b_dt.element_bytes() ) );
 }
 
 //-----------------------------------------------------------------------------
-// -- constructors for generic types --
-//-----------------------------------------------------------------------------
-
+///
+/// Helpers used by Node::endian_swap.
+///
+/// Leaves that need a swap are gathered first and then swapped with
+/// Endianness::swap_elements. Leaves with at least ENDIAN_SWAP_LARGE_LEAF
+/// elements are swapped one at a time (swap_elements splits large
+/// arrays across threads). When conduit is built with OpenMP support and
+/// the remaining leaves hold at least ENDIAN_SWAP_PARALLEL_THRESHOLD
+/// elements, they are swapped in parallel.
+///
 //-----------------------------------------------------------------------------
-Node::Node(const Schema &schema)
+static const index_t ENDIAN_SWAP_LARGE_LEAF = 1 << 20;
+static const index_t ENDIAN_SWAP_PARALLEL_THRESHOLD = 1 << 16;
 
+struct EndianSwapLeaf
 {
-    init_defaults();
-    set(schema);
-}
+    void    *data;
+    index_t  num_eles;
+    index_t  ele_bytes;
+    index_t  stride;
+};
 
 //---------------------------------------------------------------------------//
-Node::Node(const Generator &gen,
-           bool external)
+static void
+gather_endian_swap_leaves(Node &node,
+                          index_t dest_endian,
+                          std::vector<EndianSwapLeaf> &leaves)
 {
-    init_defaults();
-    if(external)
+    index_t dtype_id = node.dtype().id();
+
+    if (dtype_id == DataType::OBJECT_ID || dtype_id == DataType::LIST_ID )
     {
-        gen.walk_external(*this);
+        for(index_t i=0;i<node.number_of_children();i++)
+        {
+            gather_endian_swap_leaves(node.child(i),dest_endian,leaves);
+        }
+        return;
     }
-    else
+
+    DataType &dtype = node.schema_ptr()->dtype();
+
+    index_t src_endian = dtype.endianness();
+    if(src_endian == Endianness::DEFAULT_ID)
     {
-        gen.walk(*this);
+        src_endian = Endianness::machine_default();
+    }
+
+    //note: we always use the default bytes type for endian swap
+    index_t ele_bytes = DataType::default_bytes(dtype_id);
+    index_t num_ele   = dtype.number_of_elements();
+
+    if(src_endian != dest_endian && ele_bytes > 1 && num_ele > 0)
+    {
+        EndianSwapLeaf leaf;
+        leaf.data      = node.element_ptr(0);
+        leaf.num_eles  = num_ele;
+        leaf.ele_bytes = ele_bytes;
+        leaf.stride    = dtype.stride();
+        leaves.push_back(leaf);
     }
 
+    dtype.set_endianness(dest_endian);
 }
 
-//---------------------------------------------------------------------------//
-Node::Node(const std::string &schema,
-           void *data,
-           bool external)
+//-----------------------------------------------------------------------------
+///
+/// Streaming xxHash64, used by Node::hash.
+///
+//-----------------------------------------------------------------------------
+class XXHash64
 {
-    init_defaults();
-    Generator g(schema,"conduit_json",data);
-
-    if(external)
+public:
+    explicit XXHash64(uint64 seed = 0)
     {
-        g.walk_external(*this);
+        reset(seed);
     }
-    else
+
+    //-------------------------------------------------------------------------
+    void reset(uint64 seed)
     {
-        g.walk(*this);
+        m_seed   = seed;
+        m_acc[0] = seed + PRIME_1 + PRIME_2;
+        m_acc[1] = seed + PRIME_2;
+        m_acc[2] = seed;
+        m_acc[3] = seed - PRIME_1;
+        m_buffer_size = 0;
+        m_total_bytes = 0;
     }
 
-}
+    //-------------------------------------------------------------------------
+    void update(const void *data, index_t nbytes)
+    {
+        const uint8 *ptr = (const uint8*)data;
+        m_total_bytes += (uint64)nbytes;
+
+        // finish a partially filled stripe
+        if(m_buffer_size > 0)
+        {
+            index_t n = std::min(nbytes, STRIPE_BYTES - m_buffer_size);
+            memcpy(m_buffer + m_buffer_size, ptr, (size_t)n);
+            m_buffer_size += n;
+            ptr    += n;
+            nbytes -= n;
+            if(m_buffer_size < STRIPE_BYTES)
+            {
+                return;
+            }
+            consume_stripe(m_buffer);
+            m_buffer_size = 0;
+        }
 
-//---------------------------------------------------------------------------//
-Node::Node(const DataType &dtype)
-{
-    init_defaults();
-    set(dtype);
-}
+        // whole stripes are read directly from the input
+        for(; nbytes >= STRIPE_BYTES; nbytes -= STRIPE_BYTES)
+        {
+            consume_stripe(ptr);
+            ptr += STRIPE_BYTES;
+        }
 
-//---------------------------------------------------------------------------//
-Node::Node(const Schema &schema,
-           void *data,
-           bool external)
-{
-    init_defaults();
-    std::string json_schema =schema.to_json();
-    Generator g(json_schema,"conduit_json",data);
-    if(external)
+        if(nbytes > 0)
+        {
+            memcpy(m_buffer, ptr, (size_t)nbytes);
+            m_buffer_size = nbytes;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void update_word(uint64 value)
     {
-        g.walk_external(*this);
+        update(&value, sizeof(uint64));
     }
-    else
+
+    //-------------------------------------------------------------------------
+    uint64 digest() const
     {
-        g.walk(*this);
+        uint64 h = 0;
+        if(m_total_bytes >= (uint64)STRIPE_BYTES)
+        {
+            h = rotl(m_acc[0], 1)  + rotl(m_acc[1], 7) +
+                rotl(m_acc[2], 12) + rotl(m_acc[3], 18);
+            for(int i = 0; i < 4; i++)
+            {
+                h ^= round(0, m_acc[i]);
+                h  = h * PRIME_1 + PRIME_4;
+            }
+        }
+        else
+        {
+            h = m_seed + PRIME_5;
+        }
+
+        h += m_total_bytes;
+
+        const uint8 *ptr = m_buffer;
+        index_t nbytes = m_buffer_size;
+        for(; nbytes >= 8; nbytes -= 8, ptr += 8)
+        {
+            uint64 k = 0;
+            memcpy(&k, ptr, 8);
+            h ^= round(0, k);
+            h  = rotl(h, 27) * PRIME_1 + PRIME_4;
+        }
+
+        if(nbytes >= 4)
+        {
+            uint32 k = 0;
+            memcpy(&k, ptr, 4);
+            h ^= (uint64)k * PRIME_1;
+            h  = rotl(h, 23) * PRIME_2 + PRIME_3;
+            nbytes -= 4;
+            ptr    += 4;
+        }
+
+        for(; nbytes > 0; nbytes--, ptr++)
+        {
+            h ^= (uint64)(*ptr) * PRIME_5;
+            h  = rotl(h, 11) * PRIME_1;
+        }
+
+        h ^= h >> 33;
+        h *= PRIME_2;
+        h ^= h >> 29;
+        h *= PRIME_3;
+        h ^= h >> 32;
+        return h;
     }
-}
 
+private:
+    static const uint64  PRIME_1 = 0x9E3779B185EBCA87ULL;
+    static const uint64  PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64  PRIME_3 = 0x165667B19E3779F9ULL;
+    static const uint64  PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+    static const uint64  PRIME_5 = 0x27D4EB2F165667C5ULL;
+    static const index_t STRIPE_BYTES = 32;
 
-//---------------------------------------------------------------------------//
-Node::Node(const DataType &dtype,
-           void *data,
-           bool external)
-{
-    init_defaults();
-    if(external)
+    //-------------------------------------------------------------------------
+    static uint64 rotl(uint64 v, int r)
     {
-        set_external(dtype,data);
+        return (v << r) | (v >> (64 - r));
     }
-    else
+
+    //-------------------------------------------------------------------------
+    static uint64 round(uint64 acc, uint64 input)
     {
-        set(dtype,data);
+        acc += input * PRIME_2;
+        acc  = rotl(acc, 31);
+        acc *= PRIME_1;
+        return acc;
     }
-}
 
-//-----------------------------------------------------------------------------
-//
-// -- end definition of Node constructors + destructor --
-//
-//-----------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    void consume_stripe(const uint8 *ptr)
+    {
+        uint64 lanes[4];
+        memcpy(lanes, ptr, sizeof(lanes));
+        m_acc[0] = round(m_acc[0], lanes[0]);
+        m_acc[1] = round(m_acc[1], lanes[1]);
+        m_acc[2] = round(m_acc[2], lanes[2]);
+        m_acc[3] = round(m_acc[3], lanes[3]);
+    }
 
+    uint64  m_seed;
+    uint64  m_acc[4];
+    uint8   m_buffer[STRIPE_BYTES];
+    index_t m_buffer_size;
+    uint64  m_total_bytes;
+};
 
 //-----------------------------------------------------------------------------
-//
-// -- begin definition of Node generate methods --
-//
+///
+/// Helpers used by Node::hash.
+///
+/// Word w of a hash uses the seed (seed ^ HASH_WORD_SEEDS[w]), so the first
+/// word of a 128-bit hash is the 64-bit hash. Leaf values are hashed as
+/// compact bytes, strided leaves are gathered into a small staging buffer.
+/// Leaves with more than HASH_BLOCK_BYTES bytes are split into blocks that
+/// are hashed independently (optionally in parallel), and the leaf hash is
+/// the hash of the block hashes. The result does not depend on the number
+/// of threads.
+///
 //-----------------------------------------------------------------------------
+static const index_t HASH_MAX_WORDS  = 2;
+static const uint64  HASH_WORD_SEEDS[HASH_MAX_WORDS] = {0x0ULL,
+                                                        0x9e3779b97f4a7c15ULL};
+static const index_t HASH_BLOCK_BYTES   = 1 << 20;
+static const index_t HASH_STAGING_BYTES = 4096;
 
 //---------------------------------------------------------------------------//
-void
-Node::parse(const std::string &text,
-            const std::string &protocol)
+static void
+hash_elements(const uint8 *data,
+              index_t num_eles,
+              index_t ele_bytes,
+              index_t stride,
+              XXHash64 *hashers,
+              index_t num_words)
 {
-    Generator gen(text,protocol,NULL);
-    gen.walk(*this);
+    if(stride == ele_bytes || num_eles == 1)
+    {
+        for(index_t w = 0; w < num_words; w++)
+        {
+            hashers[w].update(data, num_eles * ele_bytes);
+        }
+        return;
+    }
+
+    uint8 staging[HASH_STAGING_BYTES];
+    index_t chunk_eles = std::max((index_t)1, HASH_STAGING_BYTES / ele_bytes);
+    for(index_t i = 0; i < num_eles; i += chunk_eles)
+    {
+        index_t n = std::min(chunk_eles, num_eles - i);
+        if(ele_bytes > HASH_STAGING_BYTES)
+        {
+            for(index_t w = 0; w < num_words; w++)
+            {
+                hashers[w].update(data + i * stride, ele_bytes);
+            }
+            continue;
+        }
+
+        for(index_t j = 0; j < n; j++)
+        {
+            memcpy(staging + j * ele_bytes,
+                   data + (i + j) * stride,
+                   (size_t)ele_bytes);
+        }
+
+        for(index_t w = 0; w < num_words; w++)
+        {
+            hashers[w].update(staging, n * ele_bytes);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::generate(const Generator &gen)
+static void
+hash_leaf_data(const uint8 *data,
+               index_t num_eles,
+               index_t ele_bytes,
+               index_t stride,
+               uint64 seed,
+               index_t num_words,
+               index_t num_threads,
+               uint64 *res)
 {
-    gen.walk(*this);
+    XXHash64 hashers[HASH_MAX_WORDS];
+    for(index_t w = 0; w < num_words; w++)
+    {
+        hashers[w].reset(seed ^ HASH_WORD_SEEDS[w]);
+    }
+
+    index_t nbytes = num_eles * ele_bytes;
+    if(nbytes <= HASH_BLOCK_BYTES)
+    {
+        hash_elements(data, num_eles, ele_bytes, stride, hashers, num_words);
+        for(index_t w = 0; w < num_words; w++)
+        {
+            res[w] = hashers[w].digest();
+        }
+        return;
+    }
+
+    index_t block_eles = std::max((index_t)1, HASH_BLOCK_BYTES / ele_bytes);
+    index_t num_blocks = (num_eles + block_eles - 1) / block_eles;
+    std::vector<uint64> block_hashes((size_t)(num_blocks * num_words));
+    detail::parallel_for(num_blocks, num_threads, [&](index_t b)
+    {
+        XXHash64 block_hashers[HASH_MAX_WORDS];
+        for(index_t w = 0; w < num_words; w++)
+        {
+            block_hashers[w].reset(seed ^ HASH_WORD_SEEDS[w]);
+        }
+        index_t begin = b * block_eles;
+        index_t n = std::min(block_eles, num_eles - begin);
+        hash_elements(data + begin * stride,
+                      n,
+                      ele_bytes,
+                      stride,
+                      block_hashers,
+                      num_words);
+        for(index_t w = 0; w < num_words; w++)
+        {
+            block_hashes[(size_t)(b * num_words + w)] =
+                block_hashers[w].digest();
+        }
+    });
+
+    for(index_t w = 0; w < num_words; w++)
+    {
+        for(index_t b = 0; b < num_blocks; b++)
+        {
+            hashers[w].update_word(block_hashes[(size_t)(b * num_words + w)]);
+        }
+        hashers[w].update_word((uint64)nbytes);
+        res[w] = hashers[w].digest();
+    }
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::generate_external(const Generator &gen)
+template <typename T>
+static bool
+leaf_has_diff(const DataArray<T> &t_array,
+              const DataArray<T> &n_array,
+              const float64 epsilon,
+              bool compatible)
 {
-    gen.walk_external(*this);
+    return compatible ? t_array.has_diff_compatible(n_array, epsilon)
+                      : t_array.has_diff(n_array, epsilon);
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::generate(const std::string &schema,
-               const std::string &protocol,
-               void *data)
-
+/// dispatch functor that checks two numeric leaves of the same type
+/// with leaf_has_diff
+struct LeafHasDiff
 {
-    Generator g(schema,protocol,data);
-    generate(g);
-}
+    LeafHasDiff(const Node &t, const Node &n, float64 epsilon,
+                bool compatible, bool &res)
+    : m_t(t), m_n(n), m_epsilon(epsilon), m_compatible(compatible), m_res(res)
+    {}
 
-//---------------------------------------------------------------------------//
-void
-Node::generate_external(const std::string &schema,
-                        const std::string &protocol,
-                        void *data)
+    template <typename T>
+    void operator()(const T *) const
+    {
+        DataArray<T> t_array(m_t.data_ptr(), m_t.dtype());
+        DataArray<T> n_array(m_n.data_ptr(), m_n.dtype());
+        m_res = leaf_has_diff(t_array, n_array, m_epsilon, m_compatible);
+    }
 
+    const Node &m_t;
+    const Node &m_n;
+    float64     m_epsilon;
+    bool        m_compatible;
+    bool       &m_res;
+};
+
+//---------------------------------------------------------------------------//
+/// dispatch functor that diffs two numeric leaves of the same type,
+/// for Node::diff and Node::diff_compatible
+struct LeafDiff
 {
-    Generator g(schema,protocol,data);
-    generate_external(g);
-}
+    LeafDiff(const Node &t, const Node &n, Node &info, float64 epsilon,
+             bool compatible, bool &res)
+    : m_t(t), m_n(n), m_info(info), m_epsilon(epsilon),
+      m_compatible(compatible), m_res(res)
+    {}
 
-/// TODO: missing def of several Node::generator methods
+    template <typename T>
+    void operator()(const T *) const
+    {
+        DataArray<T> t_array(m_t.data_ptr(), m_t.dtype());
+        DataArray<T> n_array(m_n.data_ptr(), m_n.dtype());
+        m_res |= m_compatible ?
+                 t_array.diff_compatible(n_array, m_info, m_epsilon) :
+                 t_array.diff(n_array, m_info, m_epsilon);
+    }
 
-
-//-----------------------------------------------------------------------------
-//
-// -- end definition of Node generate methods --
-//
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-//
-// -- begin definition of Node basic i/o methods --
-//
-//-----------------------------------------------------------------------------
+    const Node &m_t;
+    const Node &m_n;
+    Node       &m_info;
+    float64     m_epsilon;
+    bool        m_compatible;
+    bool       &m_res;
+};
 
 //---------------------------------------------------------------------------//
-void
-Node::load(const std::string &stream_path,
-           const Schema &schema)
+// computes the mean, min and max of a numeric leaf in one pass, and
+// writes them to the (already allocated) describe result entries.
+// With a sample step > 1, only every step-th element is visited.
+struct LeafDescribe
 {
-    // clear out any existing structure
-    reset();
-    index_t dsize = schema.spanned_bytes();
+    LeafDescribe(const Node &node, index_t sample_step, Node &res)
+    : m_node(node),
+      m_sample_step(sample_step),
+      m_mean(res["mean"].element_ptr(0)),
+      m_min(res["min"].element_ptr(0)),
+      m_max(res["max"].element_ptr(0))
+    {}
 
-    allocate(dsize);
-    std::ifstream ifs;
-    ifs.open(stream_path.c_str(), std::ios_base::binary);
-    if(!ifs.is_open())
+    template <typename T>
+    void operator()(const T *) const
     {
-        CONDUIT_ERROR("<Node::load> failed to open: " << stream_path);
+        const DataType &dt = m_node.dtype();
+        index_t num_eles = dt.number_of_elements();
+        index_t stride   = dt.stride();
+        if(m_sample_step > 1)
+        {
+            num_eles = (num_eles + m_sample_step - 1) / m_sample_step;
+            stride  *= m_sample_step;
+        }
+
+        DataArray<T> t_array(m_node.data_ptr(),
+                             DataType(dt.id(),
+                                      num_eles,
+                                      dt.offset(),
+                                      stride,
+                                      dt.element_bytes(),
+                                      dt.endianness()));
+        float64 mean = 0.0;
+        t_array.summary_stats(*(T*)m_min, *(T*)m_max, mean);
+        *(float64*)m_mean = mean;
     }
-    ifs.read((char *)m_data,dsize);
-    ifs.close();
 
-    //
-    // See Below
-    //
-    m_alloced = false;
+    const Node &m_node;
+    index_t     m_sample_step;
+    void       *m_mean;
+    void       *m_min;
+    void       *m_max;
+};
 
-    m_schema->set(schema);
-    walk_schema(this,m_schema,m_data,m_allocator_id);
+//---------------------------------------------------------------------------//
+struct LeafSummaryString
+{
+    LeafSummaryString(const Node &node, index_t thresh, Node &res)
+    : m_node(node), m_thresh(thresh), m_res(res)
+    {}
 
-    ///
-    /// TODO: Design Issue
-    ///
-    /// The bookkeeping here is not very intuitive
-    /// The walk process may reset the node, which would free
-    /// our data before we can set it up. So for now, we wait
-    /// to indicate ownership until after the node is fully setup
-    m_alloced = true;
-}
+    template <typename T>
+    void operator()(const T *) const
+    {
+        DataArray<T> t_array(m_node.data_ptr(), m_node.dtype());
+        m_res = t_array.to_summary_string(m_thresh);
+    }
 
+    const Node &m_node;
+    index_t     m_thresh;
+    Node       &m_res;
+};
 
 //---------------------------------------------------------------------------//
-void
-Node::load(const std::string &ibase,
-           const std::string &protocol)
+// builds the describe result of each node in the tree, and collects the
+// numeric leaves whose stats are computed afterwards
+static void
+describe_tree(const Node &node,
+              index_t thresh,
+              index_t sample,
+              Node &res,
+              std::vector<LeafDescribe> &leaves)
 {
-    std::string proto = protocol;
-    //auto detect protocol
-    if(proto == "")
+    res.reset();
+    const DataType &dt = node.dtype();
+    index_t dtype_id = dt.id();
+    if(dtype_id == DataType::OBJECT_ID)
     {
-        identify_protocol(ibase,proto);
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            const Node &cld = itr.next();
+            std::string cld_name = itr.name();
+            describe_tree(cld, thresh, sample, res[cld_name], leaves);
+        }
     }
-
-    if(proto == "conduit_bin")
+    else if(dtype_id == DataType::LIST_ID)
     {
-        Schema s;
-        std::string ifschema = ibase + "_json";
-        s.load(ifschema);
-        load(ibase,s);
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            const Node &cld = itr.next();
+            describe_tree(cld, thresh, sample, res.append(), leaves);
+        }
     }
-    // single file json and yaml cases
-    else
+    else // leaves!
     {
-        std::ifstream ifile;
-        ifile.open(ibase.c_str());
-        if(!ifile.is_open())
+        res["dtype"] = DataType::id_to_name(dtype_id);
+        // The term `count` is used in r and pandas world
+        // so we prefer it over `number_of_elements`
+        index_t count = dt.number_of_elements();
+        res["count"] = count;
+
+        if(dt.is_number())
         {
-            CONDUIT_ERROR("<Node::load> failed to open: " << ibase);
-        }
-        std::string data((std::istreambuf_iterator<char>(ifile)),
-                          std::istreambuf_iterator<char>());
+            index_t sample_step = 1;
+            if(sample > 0 && count > sample)
+            {
+                sample_step = (count + sample - 1) / sample;
+                res["sample_count"] = (count + sample_step - 1) / sample_step;
+            }
 
-        Generator g(data,proto);
-        g.walk(*this);
+            res["mean"].set(DataType::float64());
+            res["min"].set(DataType(dtype_id,1));
+            res["max"].set(DataType(dtype_id,1));
+            dispatch(node, LeafSummaryString(node, thresh, res["values"]));
+            leaves.push_back(LeafDescribe(node, sample_step, res));
+        }
+        else if(dt.is_char8_str())
+        {
+            res["values"].set_external(node);
+        }
     }
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::save(const std::string &obase,
-           const std::string &protocol) const
+///
+/// Shared implementation of Node::has_diff and Node::has_diff_compatible.
+/// Returns the same result as diff (or diff_compatible), but stops at the
+/// first difference.
+///
+//---------------------------------------------------------------------------//
+static bool
+node_has_diff(const Node &t,
+              const Node &n,
+              const float64 epsilon,
+              bool relaxint,
+              bool compatible)
 {
-    std::string proto = protocol;
-    //auto detect protocol
-    if(proto == "")
+    const DataType &t_dtype = t.dtype();
+    const DataType &n_dtype = n.dtype();
+    index_t t_dtid = t_dtype.id();
+    index_t n_dtid = n_dtype.id();
+
+    if(t_dtid != n_dtid)
     {
-        identify_protocol(obase,proto);
+        if(!relaxint)
+        {
+            return true;
+        }
+
+        if(t_dtype.is_signed_integer() && n_dtype.is_signed_integer())
+            return t.to_int64() != n.to_int64();
+        else if(t_dtype.is_unsigned_integer() && n_dtype.is_unsigned_integer())
+            return t.to_uint64() != n.to_uint64();
+        else if(t_dtype.is_integer() && n_dtype.is_integer())
+            return t.to_int64() != n.to_int64();
+
+        return true;
+    }
+    else if(t_dtid == DataType::EMPTY_ID)
+    {
+        return false;
     }
+    else if(t_dtid == DataType::OBJECT_ID)
+    {
+        // with equal child counts, every child of t existing in n means
+        // n has no extra children
+        if(!compatible &&
+           t.number_of_children() != n.number_of_children())
+        {
+            return true;
+        }
 
-    if(proto == "conduit_bin")
+        NodeConstIterator child_itr = t.children();
+        while(child_itr.has_next())
+        {
+            const Node &t_child = child_itr.next();
+            const std::string child_name = child_itr.name();
+            if(!n.has_child(child_name) ||
+               node_has_diff(t_child,
+                             n.child(child_name),
+                             epsilon,
+                             relaxint,
+                             compatible))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    else if(t_dtid == DataType::LIST_ID)
     {
-        Node res;
-        compact_to(res);
-        std::string ofschema = obase + "_json";
+        index_t t_nchild = t.number_of_children();
+        index_t n_nchild = n.number_of_children();
+        if(t_nchild > n_nchild || (!compatible && t_nchild != n_nchild))
+        {
+            return true;
+        }
 
-        res.schema().save(ofschema);
-        res.serialize(obase);
+        for(index_t i = 0; i < t_nchild; i++)
+        {
+            if(node_has_diff(t.child(i),
+                             n.child(i),
+                             epsilon,
+                             relaxint,
+                             compatible))
+            {
+                return true;
+            }
+        }
+        return false;
     }
-    else if( proto == "yaml")
+
+    // leaf node
+    if(t_dtype.is_number())
     {
-        to_yaml_stream(obase,proto);
+        bool res = false;
+        dispatch(t, LeafHasDiff(t, n, epsilon, compatible, res));
+        return res;
     }
-    else     // single file json cases
+    else if(t_dtype.is_char8_str())
     {
-        to_json_stream(obase,proto);
+        // NOTE: Can't use 'value' for characters since type aliasing can
+        // confuse the 'char' type on various platforms.
+        char_array t_array(t.data_ptr(), t_dtype);
+        char_array n_array(n.data_ptr(), n_dtype);
+        return leaf_has_diff(t_array, n_array, epsilon, compatible);
     }
+
+    CONDUIT_ERROR("<Node::has_diff> unrecognized data type");
+    return true;
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::mmap(const std::string &stream_path)
+static bool
+hash_option_flag(const Node &opts,
+                 const std::string &name,
+                 bool default_value)
 {
-    std::string ifschema = stream_path + "_json";
+    if(!opts.has_child(name))
+    {
+        return default_value;
+    }
 
-    Schema s;
-    s.load(ifschema);
-    mmap(stream_path,s);
-}
+    const Node &n_opt = opts[name];
+    if(n_opt.dtype().is_string())
+    {
+        return n_opt.as_string() == "true";
+    }
 
+    return n_opt.to_int() != 0;
+}
 
 //---------------------------------------------------------------------------//
-void
-Node::mmap(const std::string &stream_path,
-           const Schema &schema)
+// reads a num_threads option, values <= 0 select the hardware concurrency
+static index_t
+num_threads_option(const Node &opts)
 {
-    reset();
-    index_t dsize = schema.spanned_bytes();
-    Node::mmap(stream_path,dsize);
-
-    //
-    // See Below
-    //
-    m_mmaped = false;
-
-    m_schema->set(schema);
-
-    walk_schema(this,m_schema,m_data, m_allocator_id);
+    if(!opts.has_child("num_threads"))
+    {
+        return 1;
+    }
 
-    ///
-    /// TODO: Design Issue
-    ///
-    /// The bookkeeping here is not very intuitive
-    /// The walk process may reset the node, which would free
-    /// our data before we can set it up. So for now, we wait
-    /// to indicate ownership until after the node is fully setup
-    m_mmaped = true;
+    index_t res = opts["num_threads"].to_index_t();
+    if(res <= 0)
+    {
+        res = std::max((index_t)1,
+                       (index_t)std::thread::hardware_concurrency());
+    }
+    return res;
 }
 
-//-----------------------------------------------------------------------------
-//
-// -- end definition of Node basic i/o methods --
-//
-//-----------------------------------------------------------------------------
-
-
-//-----------------------------------------------------------------------------
-//
-// -- begin definition of Node set methods --
-//
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-// -- set for generic types --
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
-void
-Node::set_node(const Node &node)
+// shared implementation of the const and non-const Node::for_each_leaf
+template <typename NodeType, typename Func>
+static void
+for_each_leaf(NodeType &node,
+              const Func &func,
+              const Node &opts)
 {
-    if(node.dtype().id() == DataType::OBJECT_ID)
-    {
-        reset();
-        init(DataType::object());
+    typedef NodeLeafIteratorBase<NodeType> iterator_type;
+    typedef typename iterator_type::span_type span_type;
 
-        const std::vector<std::string> &cld_names = node.child_names();
+    bool    coalesce    = hash_option_flag(opts,"coalesce",false);
+    index_t num_threads = num_threads_option(opts);
 
-        for (std::vector<std::string>::const_iterator itr = cld_names.begin();
-             itr < cld_names.end(); ++itr)
-        {
-            Schema *curr_schema = &this->m_schema->add_child(*itr);
-            size_t idx = (size_t) this->m_schema->child_index(*itr);
-            Node *curr_node = new Node();
-            curr_node->set_allocator(m_allocator_id);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(this);
-            curr_node->set(*node.m_children[idx]);
-            this->append_node_ptr(curr_node);
-        }
-    }
-    else if(node.dtype().id() == DataType::LIST_ID)
+    iterator_type itr(node, coalesce);
+    if(num_threads == 1)
     {
-        reset();
-        init(DataType::list());
-        for(size_t i=0;i< node.m_children.size(); i++)
+        while(itr.has_next())
         {
-            this->m_schema->append();
-            Schema *curr_schema = this->m_schema->child_ptr(i);
-            Node *curr_node = new Node();
-            curr_node->set_allocator(m_allocator_id);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(this);
-            curr_node->set(*node.m_children[i]);
-            this->append_node_ptr(curr_node);
+            func(itr.next());
         }
+        return;
     }
-    else if (node.dtype().id() != DataType::EMPTY_ID)
+
+    std::vector<span_type> spans;
+    while(itr.has_next())
     {
-        node.compact_to(*this);
+        spans.push_back(itr.next());
     }
-    else
+
+    // errors from func are raised on the calling thread
+    detail::parallel_for((index_t)spans.size(), num_threads, [&](index_t i)
     {
-        // if passed node is empty -- reset this.
-        reset();
-    }
+        func(spans[(size_t)i]);
+    });
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set(const Node &node)
+// prefix tree of the paths passed to Node::build_from_paths, children are
+// kept in the order their names first appear
+struct PathTrieNode
 {
-    set_node(node);
-}
+    std::string           name;
+    index_t               entry;     // leaf entry index, or -1
+    std::vector<index_t>  children;
+    std::unordered_map<std::string,index_t> child_map;
+};
 
 //---------------------------------------------------------------------------//
-void
-Node::set_dtype(const DataType &dtype)
+static void
+build_path_trie(const std::vector<Node::PathEntry> &entries,
+                std::vector<PathTrieNode> &trie)
 {
-    init(dtype);
-}
+    trie.clear();
+    trie.push_back(PathTrieNode());
+    trie[0].entry = -1;
 
-//---------------------------------------------------------------------------//
-void
-Node::set(const DataType &dtype)
-{
-    set_dtype(dtype);
+    for(size_t i = 0; i < entries.size(); i++)
+    {
+        const std::string &path = entries[i].path;
+        index_t curr = 0;
+        size_t start = 0;
+        while(true)
+        {
+            size_t end = path.find('/', start);
+            if(end == std::string::npos)
+            {
+                end = path.size();
+            }
+
+            if(end == start)
+            {
+                CONDUIT_ERROR("Node::build_from_paths: invalid path \""
+                              << path << "\" (empty path component)");
+            }
+
+            std::string name = path.substr(start, end - start);
+            std::unordered_map<std::string,index_t>::iterator itr =
+                trie[(size_t)curr].child_map.find(name);
+            index_t next = -1;
+            if(itr == trie[(size_t)curr].child_map.end())
+            {
+                next = (index_t)trie.size();
+                trie.push_back(PathTrieNode());
+                PathTrieNode &t_next = trie.back();
+                t_next.name  = name;
+                t_next.entry = -1;
+                trie[(size_t)curr].child_map[name] = next;
+                trie[(size_t)curr].children.push_back(next);
+            }
+            else
+            {
+                next = itr->second;
+            }
+
+            if(trie[(size_t)next].entry >= 0 && end < path.size())
+            {
+                CONDUIT_ERROR("Node::build_from_paths: \""
+                              << entries[(size_t)trie[(size_t)next].entry].path
+                              << "\" is a leaf and a prefix of \""
+                              << path << "\"");
+            }
+            curr = next;
+
+            if(end == path.size())
+            {
+                break;
+            }
+            start = end + 1;
+        }
+
+        PathTrieNode &t_leaf = trie[(size_t)curr];
+        if(!t_leaf.children.empty())
+        {
+            CONDUIT_ERROR("Node::build_from_paths: \"" << path << "\""
+                          << " is a leaf and a prefix of another path");
+        }
+        // like repeated set_path calls, the last entry for a path wins
+        t_leaf.entry = (index_t)i;
+    }
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set_schema(const Schema &schema)
+// creates the compact schema of a trie level, leaves are placed in
+// depth-first order
+static void
+build_path_trie_schema(const std::vector<Node::PathEntry> &entries,
+                       const std::vector<PathTrieNode> &trie,
+                       index_t idx,
+                       Schema &schema,
+                       index_t &curr_offset)
 {
-    release();
-    m_schema->set(schema);
-    // allocate data
-    // for this case, we need the total bytes spanned by the schema
-    size_t nbytes =(size_t) m_schema->spanned_bytes();
-    allocate(nbytes);
-    utils::conduit_memset(m_data,0,nbytes);
-    // call walk w/ internal data pointer
-    walk_schema(this,m_schema,m_data,m_allocator_id);
+    const PathTrieNode &t_node = trie[(size_t)idx];
+    if(t_node.entry >= 0)
+    {
+        DataType dt;
+        entries[(size_t)t_node.entry].dtype.compact_to(dt);
+        dt.set_offset(curr_offset);
+        schema.set(dt);
+        curr_offset += dt.bytes_compact();
+        return;
+    }
+
+    schema.set(DataType::object());
+    schema.reserve_children((index_t)t_node.children.size());
+    for(size_t i = 0; i < t_node.children.size(); i++)
+    {
+        index_t cld_idx = t_node.children[i];
+        build_path_trie_schema(entries,
+                               trie,
+                               cld_idx,
+                               schema.add_child(trie[(size_t)cld_idx].name),
+                               curr_offset);
+    }
 }
 
+
 //---------------------------------------------------------------------------//
-void
-Node::set(const Schema &schema)
+// creates the children of a trie level, leaves point to the entries' data
+static void
+build_path_trie_external(const std::vector<Node::PathEntry> &entries,
+                         const std::vector<PathTrieNode> &trie,
+                         index_t idx,
+                         Node &node)
 {
-    set_schema(schema);
-}
+    const PathTrieNode &t_node = trie[(size_t)idx];
+    if(t_node.entry >= 0)
+    {
+        const Node::PathEntry &entry = entries[(size_t)t_node.entry];
+        node.set_external(entry.dtype, entry.data);
+        return;
+    }
 
+    node.set(DataType::object());
+    node.reserve_children((index_t)t_node.children.size());
+    for(size_t i = 0; i < t_node.children.size(); i++)
+    {
+        index_t cld_idx = t_node.children[i];
+        build_path_trie_external(entries,
+                                 trie,
+                                 cld_idx,
+                                 node.add_child(trie[(size_t)cld_idx].name));
+    }
+}
 
 //---------------------------------------------------------------------------//
-void
-Node::set_data_using_schema(const Schema &schema,
-                            void *data)
+// copies the entries' data into the leaves of a node created from
+// the trie's schema
+static void
+build_path_trie_copy(const std::vector<Node::PathEntry> &entries,
+                     const std::vector<PathTrieNode> &trie,
+                     index_t idx,
+                     Node &node)
 {
-    release();
-    m_schema->set(schema);
-    // for this case, we need the total bytes spanned by the schema
-    size_t nbytes = (size_t)m_schema->spanned_bytes();
-    allocate(nbytes);
-    utils::conduit_memcpy(m_data, data, nbytes);
-    walk_schema(this,m_schema,m_data,m_allocator_id);
+    const PathTrieNode &t_node = trie[(size_t)idx];
+    if(t_node.entry >= 0)
+    {
+        const Node::PathEntry &entry = entries[(size_t)t_node.entry];
+        if(entry.data != NULL)
+        {
+            const DataType &src_dt = entry.dtype;
+            size_t ele_bytes = (size_t) node.dtype().element_bytes();
+            utils::conduit_memcpy_strided_elements(node.element_ptr(0),
+                                   (size_t)src_dt.number_of_elements(),
+                                   ele_bytes,
+                                   ele_bytes,
+                                   (uint8*)entry.data + src_dt.offset(),
+                                   (size_t)src_dt.stride(),
+                                   node.allocator(),
+                                   0);
+        }
+        else
+        {
+            utils::conduit_memset(node.element_ptr(0),
+                                  0,
+                                  (size_t)node.dtype().bytes_compact(),
+                                  node.allocator());
+        }
+        return;
+    }
+
+    for(size_t i = 0; i < t_node.children.size(); i++)
+    {
+        build_path_trie_copy(entries,
+                             trie,
+                             t_node.children[i],
+                             node.child((index_t)i));
+    }
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set(const Schema &schema,
-          void *data)
+// where a leaf's bytes are read from and moved to by aligned loads
+struct LeafMove
 {
-    set_data_using_schema(schema,data);
-}
+    index_t src;
+    index_t dest;
+    index_t bytes;
+
+    bool operator<(const LeafMove &other) const
+    {
+        return src < other.src;
+    }
+};
 
 //---------------------------------------------------------------------------//
-void
-Node::set_data_using_dtype(const DataType &dtype,
-                           void *data)
+static void
+collect_leaf_schemas(Schema &schema,
+                     std::vector<Schema*> &leaves)
 {
-    release();
-    m_schema->set(dtype);
-    allocate(m_schema->spanned_bytes());
-    utils::conduit_memcpy(m_data,
-                          data,
-                          (size_t) m_schema->spanned_bytes());
-    walk_schema(this,m_schema,m_data,m_allocator_id);
+    index_t dt_id = schema.dtype().id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        for(index_t i = 0; i < nchildren; i++)
+        {
+            collect_leaf_schemas(schema.child(i), leaves);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        leaves.push_back(&schema);
+    }
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set(const DataType &dtype, void *data)
+// Moves the leaves of a schema to offsets that are multiples of alignment,
+// keeping their order in memory, and fills moves (sorted by src) with the
+// old and new offsets. Returns the bytes spanned by the new layout, or -1
+// (with the schema unchanged) if a leaf is strided or the leaves overlap.
+static index_t
+align_leaf_offsets(Schema &schema,
+                   index_t alignment,
+                   std::vector<LeafMove> &moves)
 {
-    set_data_using_dtype(dtype,data);
+    std::vector<Schema*> leaves;
+    collect_leaf_schemas(schema, leaves);
+
+    moves.clear();
+    moves.reserve(leaves.size());
+    std::vector<std::pair<index_t,Schema*> > order;
+    order.reserve(leaves.size());
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        const DataType &dt = leaves[i]->dtype();
+        // is_compact() counts the offset, check the leaf's own layout
+        if(dt.number_of_elements() > 1 &&
+           dt.stride() != dt.element_bytes())
+        {
+            return -1;
+        }
+        order.push_back(std::make_pair(dt.offset(), leaves[i]));
+    }
+    std::sort(order.begin(), order.end());
+
+    index_t src_end  = 0;
+    index_t dest_end = 0;
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        const DataType &dt = order[i].second->dtype();
+        LeafMove move;
+        move.src   = dt.offset();
+        move.bytes = dt.bytes_compact();
+        move.dest  = ((dest_end + alignment - 1) / alignment) * alignment;
+        if(move.src < src_end)
+        {
+            return -1;
+        }
+        src_end  = move.src + move.bytes;
+        dest_end = move.dest + move.bytes;
+        moves.push_back(move);
+    }
+
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        order[i].second->dtype().set_offset(moves[i].dest);
+    }
+    return dest_end;
 }
 
+}
 //-----------------------------------------------------------------------------
-// -- set for scalar types ---
+// -- end conduit::detail --
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer scalar types
+// Node::StatsCache helper class
 //-----------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------//
-void
-Node::set_int8(int8 data)
+// This private class holds the sizes of a subtree used by the total_*
+// methods. Like cached hashes, a node's sizes are only valid if the sizes
+// of all of its descendants are.
+//-----------------------------------------------------------------------------
+class Node::StatsCache
 {
-    init(DataType::int8());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(int8));
-}
+  public:
+      StatsCache()
+      : valid(false),
+        bytes_allocated(0),
+        bytes_mmaped(0),
+        bytes_shared(0),
+        bytes_compressed(0),
+        bytes_compact(0),
+        strided_bytes(0)
+      {}
+
+      //----------------------------------------------------------------------
+      void      add(const StatsCache &other)
+      {
+          bytes_allocated += other.bytes_allocated;
+          bytes_mmaped    += other.bytes_mmaped;
+          bytes_shared    += other.bytes_shared;
+          bytes_compressed += other.bytes_compressed;
+          bytes_compact   += other.bytes_compact;
+          strided_bytes   += other.strided_bytes;
+      }
+
+      bool      valid;
+      index_t   bytes_allocated;
+      index_t   bytes_mmaped;
+      index_t   bytes_shared;
+      index_t   bytes_compressed;
+      index_t   bytes_compact;
+      index_t   strided_bytes;
+};
+
+//=============================================================================
+//-----------------------------------------------------------------------------
+//
+//
+// -- begin conduit::Node public methods --
+//
+//
+//-----------------------------------------------------------------------------
+//=============================================================================
+
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node constructors + destructor --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- basic constructor and destruction --
+//-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-void
-Node::set(int8 data)
+Node::Node()
 {
-    set_int8(data);
+    init_defaults();
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set_int16(int16 data)
+Node::Node(const Node &node)
 {
-    init(DataType::int16());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(int16));
+    init_defaults();
+    set(node);
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set(int16 data)
+Node::Node(Node &&node) noexcept
 {
-    set_int16(data);
+    init_defaults();
+    // a child of a frozen tree can't be emptied (swap would raise an
+    // error), so it is copied instead
+    if(node.m_parent != NULL && node.m_parent->m_frozen)
+    {
+        set(node);
+    }
+    else
+    {
+        swap(node);
+    }
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set_int32(int32 data)
+Node::~Node()
 {
-    init(DataType::int32());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(int32));
+    cleanup();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(int32 data)
+Node::reset()
 {
-    set_int32(data);
+    release();
+    m_schema->set(DataType::EMPTY_ID);
 }
 
+//-----------------------------------------------------------------------------
+// -- pooled allocation --
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
-void
-Node::set_int64(int64 data)
+void *
+Node::operator new(size_t num_bytes)
 {
-    init(DataType::int64());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(int64));
+    return utils::metadata_allocate(num_bytes);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(int64 data)
+Node::operator delete(void *ptr, size_t num_bytes)
 {
-    set_int64(data);
+    utils::metadata_free(ptr, num_bytes);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer scalar types
+// -- constructors for generic types --
 //-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
-void
-Node::set_uint8(uint8 data)
-{
-    init(DataType::uint8());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(uint8));
-}
+//-----------------------------------------------------------------------------
+Node::Node(const Schema &schema)
 
-//---------------------------------------------------------------------------//
-void
-Node::set(uint8 data)
 {
-    set_uint8(data);
+    init_defaults();
+    set(schema);
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set_uint16(uint16 data)
+Node::Node(const Generator &gen,
+           bool external)
 {
-    init(DataType::uint16());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(uint16));
+    init_defaults();
+    if(external)
+    {
+        gen.walk_external(*this);
+    }
+    else
+    {
+        gen.walk(*this);
+    }
+
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set(uint16 data)
+Node::Node(const std::string &schema,
+           void *data,
+           bool external)
 {
-    set_uint16(data);
+    init_defaults();
+    Generator g(schema,"conduit_json",data);
+
+    if(external)
+    {
+        g.walk_external(*this);
+    }
+    else
+    {
+        g.walk(*this);
+    }
+
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set_uint32(uint32 data)
+Node::Node(const DataType &dtype)
 {
-    init(DataType::uint32());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(uint32));
+    init_defaults();
+    set(dtype);
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::set(uint32 data)
-{
-    set_uint32(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_uint64(uint64 data)
+Node::Node(const Schema &schema,
+           void *data,
+           bool external)
 {
-    init(DataType::uint64());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(uint64));
+    init_defaults();
+    std::string json_schema =schema.to_json();
+    Generator g(json_schema,"conduit_json",data);
+    if(external)
+    {
+        g.walk_external(*this);
+    }
+    else
+    {
+        g.walk(*this);
+    }
 }
 
+
 //---------------------------------------------------------------------------//
-void
-Node::set(uint64 data)
+Node::Node(const DataType &dtype,
+           void *data,
+           bool external)
 {
-    set_uint64(data);
+    init_defaults();
+    if(external)
+    {
+        set_external(dtype,data);
+    }
+    else
+    {
+        set(dtype,data);
+    }
 }
 
 //-----------------------------------------------------------------------------
-// floating point scalar types
+//
+// -- end definition of Node constructors + destructor --
+//
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node generate methods --
+//
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_float32(float32 data)
+Node::parse(const std::string &text,
+            const std::string &protocol)
 {
-    init(DataType::float32());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(float32));
+    Generator gen(text,protocol,NULL);
+    gen.walk(*this);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(float32 data)
+Node::generate(const Generator &gen)
 {
-    set_float32(data);
+    gen.walk(*this);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_float64(float64 data)
+Node::generate_external(const Generator &gen)
 {
-    init(DataType::float64());
-    utils::conduit_memcpy(element_ptr(0),
-                          &data,
-                          sizeof(float64));
+    gen.walk_external(*this);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(float64 data)
+Node::generate(const std::string &schema,
+               const std::string &protocol,
+               void *data)
+
 {
-    set_float64(data);
+    Generator g(schema,protocol,data);
+    generate(g);
 }
 
-
-//-----------------------------------------------------------------------------
-// set gap methods for c-native types
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(char data)
+Node::generate_external(const std::string &schema,
+                        const std::string &protocol,
+                        void *data)
+
 {
-    set((CONDUIT_NATIVE_CHAR)data);
+    Generator g(schema,protocol,data);
+    generate_external(g);
 }
 
+/// TODO: missing def of several Node::generator methods
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
-//-----------------------------------------------------------------------------
-void
-Node::set(signed char data)
-{
-    set((CONDUIT_NATIVE_SIGNED_CHAR)data);
-}
 
 //-----------------------------------------------------------------------------
-void
-Node::set(unsigned char data)
-{
-    set((CONDUIT_NATIVE_UNSIGNED_CHAR)data);
-}
-//-----------------------------------------------------------------------------
-#endif // end use char check
+//
+// -- end definition of Node generate methods --
+//
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
+//
+// -- begin definition of Node basic i/o methods --
+//
 //-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set(short data)
+Node::load(const std::string &stream_path,
+           const Schema &schema)
 {
-    set((CONDUIT_NATIVE_SHORT)data);
+    // clear out any existing structure
+    reset();
+    index_t dsize = schema.spanned_bytes();
+
+    // with an aligned allocator, the leaves are moved to aligned offsets
+    // after reading
+    const Schema *load_schema = &schema;
+    Schema aligned_schema;
+    std::vector<detail::LeafMove> moves;
+    index_t alloc_size = dsize;
+    index_t alignment = utils::allocator_alignment(m_allocator_id);
+    if(alignment > 1 && !utils::is_device_allocator(m_allocator_id))
+    {
+        aligned_schema.set(schema);
+        index_t aligned_size = detail::align_leaf_offsets(aligned_schema,
+                                                          alignment,
+                                                          moves);
+        if(aligned_size >= 0)
+        {
+            load_schema = &aligned_schema;
+            alloc_size  = std::max(aligned_size, dsize);
+        }
+        else
+        {
+            moves.clear();
+        }
+    }
+
+    allocate(alloc_size);
+    std::ifstream ifs;
+    ifs.open(stream_path.c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+    {
+        CONDUIT_ERROR("<Node::load> failed to open: " << stream_path);
+    }
+    ifs.read((char *)m_data,dsize);
+    ifs.close();
+
+    if(!moves.empty())
+    {
+        uint8 *bytes = (uint8*)m_data;
+        // leaves keep their order, so leaves that move down can go first to
+        // last and leaves that move up last to first without overwriting
+        // bytes that haven't moved yet
+        for(size_t i = 0; i < moves.size(); i++)
+        {
+            const detail::LeafMove &move = moves[i];
+            if(move.dest < move.src)
+            {
+                memmove(bytes + move.dest, bytes + move.src, (size_t)move.bytes);
+            }
+        }
+        for(size_t i = moves.size(); i-- > 0;)
+        {
+            const detail::LeafMove &move = moves[i];
+            if(move.dest > move.src)
+            {
+                memmove(bytes + move.dest, bytes + move.src, (size_t)move.bytes);
+            }
+        }
+        // zero the padding between the leaves
+        index_t end = 0;
+        for(size_t i = 0; i < moves.size(); i++)
+        {
+            memset(bytes + end, 0, (size_t)(moves[i].dest - end));
+            end = moves[i].dest + moves[i].bytes;
+        }
+        memset(bytes + end, 0, (size_t)(alloc_size - end));
+    }
+
+    //
+    // See Below
+    //
+    m_alloced = false;
+
+    m_schema->set(*load_schema);
+    walk_schema(this,m_schema,m_data,m_allocator_id);
+
+    ///
+    /// TODO: Design Issue
+    ///
+    /// The bookkeeping here is not very intuitive
+    /// The walk process may reset the node, which would free
+    /// our data before we can set it up. So for now, we wait
+    /// to indicate ownership until after the node is fully setup
+    m_alloced = true;
 }
 
-//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set(unsigned short data)
+Node::load(const std::string &ibase,
+           const std::string &protocol)
 {
-    set((CONDUIT_NATIVE_UNSIGNED_SHORT)data);
+    std::string proto = protocol;
+    //auto detect protocol
+    if(proto == "")
+    {
+        identify_protocol(ibase,proto);
+    }
+
+    if(proto == "conduit_bin")
+    {
+        Schema s;
+        std::string ifschema = ibase + "_json";
+        s.load(ifschema);
+        load(ibase,s);
+    }
+    else if(proto == "conduit_pack")
+    {
+        pack::load(ibase,*this);
+    }
+    // single file json and yaml cases
+    else
+    {
+        std::ifstream ifile;
+        ifile.open(ibase.c_str());
+        if(!ifile.is_open())
+        {
+            CONDUIT_ERROR("<Node::load> failed to open: " << ibase);
+        }
+        std::string data((std::istreambuf_iterator<char>(ifile)),
+                          std::istreambuf_iterator<char>());
+
+        Generator g(data,proto);
+        g.walk(*this);
+    }
 }
-//-----------------------------------------------------------------------------
-#endif // end use short check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_INT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(int data)
+Node::save(const std::string &obase,
+           const std::string &protocol) const
 {
-    set((CONDUIT_NATIVE_INT)data);
+    std::string proto = protocol;
+    //auto detect protocol
+    if(proto == "")
+    {
+        identify_protocol(obase,proto);
+    }
+
+    if(proto == "conduit_bin")
+    {
+        Node res;
+        compact_to(res);
+        std::string ofschema = obase + "_json";
+
+        res.schema().save(ofschema);
+        res.serialize(obase);
+    }
+    else if(proto == "conduit_pack")
+    {
+        pack::save(*this,obase);
+    }
+    else if( proto == "yaml")
+    {
+        to_yaml_stream(obase,proto);
+    }
+    else     // single file json cases
+    {
+        to_json_stream(obase,proto);
+    }
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(unsigned int data)
+Node::mmap(const std::string &stream_path)
 {
-    set((CONDUIT_NATIVE_UNSIGNED_INT)data);
+    mmap(stream_path,Node());
 }
-//-----------------------------------------------------------------------------
-#endif // end use int check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_LONG
-//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set(long data)
+Node::mmap(const std::string &stream_path,
+           const Schema &schema)
 {
-    set((CONDUIT_NATIVE_LONG)data);
-}
+    reset();
+    index_t dsize = schema.spanned_bytes();
+    Node::mmap(stream_path,dsize);
 
-//-----------------------------------------------------------------------------
-void
-Node::set(unsigned long data)
-{
-    set((CONDUIT_NATIVE_UNSIGNED_LONG)data);
+    //
+    // See Below
+    //
+    m_mmaped = false;
+
+    m_schema->set(schema);
+
+    walk_schema(this,m_schema,m_data, m_allocator_id);
+
+    ///
+    /// TODO: Design Issue
+    ///
+    /// The bookkeeping here is not very intuitive
+    /// The walk process may reset the node, which would free
+    /// our data before we can set it up. So for now, we wait
+    /// to indicate ownership until after the node is fully setup
+    m_mmaped = true;
 }
-//-----------------------------------------------------------------------------
-#endif // end use long check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(long long data)
+Node::mmap(const std::string &stream_path,
+           const Node &opts)
 {
-    set((CONDUIT_NATIVE_LONG_LONG)data);
+    Schema s;
+    // pack files hold their own schema, with offsets that
+    // describe the entire file
+    if(pack::is_pack_file(stream_path))
+    {
+        pack::load_schema(stream_path,s);
+    }
+    else
+    {
+        std::string ifschema = stream_path + "_json";
+        s.load(ifschema);
+    }
+    mmap(stream_path,s,opts);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(unsigned long long data)
+Node::mmap(const std::string &stream_path,
+           const Schema &schema,
+           const Node &opts)
 {
-    set((CONDUIT_NATIVE_UNSIGNED_LONG_LONG)data);
+    bool lazy = false;
+    std::string advice = "normal";
+
+    if(opts.has_child("lazy"))
+    {
+        const Node &n_lazy = opts["lazy"];
+        if(n_lazy.dtype().is_string())
+        {
+            lazy = n_lazy.as_string() == "true";
+        }
+        else if(n_lazy.dtype().is_number())
+        {
+            lazy = n_lazy.to_int() != 0;
+        }
+    }
+
+    if(opts.has_child("advice"))
+    {
+        advice = opts["advice"].as_string();
+        if(advice != "normal" && advice != "sequential" &&
+           advice != "random" && advice != "willneed")
+        {
+            CONDUIT_ERROR("<Node::mmap> unknown advice: \"" << advice << "\""
+                          " (expected: normal, sequential, random,"
+                          " or willneed)");
+        }
+    }
+
+    if(!lazy)
+    {
+        mmap(stream_path,schema);
+    }
+    else
+    {
+        reset();
+        index_t dsize = schema.spanned_bytes();
+        Node::mmap(stream_path,dsize);
+
+        // see notes in mmap(stream_path,schema) about m_mmaped
+        m_mmaped = false;
+        m_schema->set(schema);
+        m_children_pending = m_schema->number_of_children() > 0;
+        m_mmaped = true;
+    }
+
+    if(advice != "normal")
+    {
+        mmap_advise(advice);
+    }
 }
-//-----------------------------------------------------------------------------
-#endif // end use long long check
-//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_FLOAT
+//
+// -- end definition of Node basic i/o methods --
+//
 //-----------------------------------------------------------------------------
-void
-Node::set(float data)
-{
-    set((CONDUIT_NATIVE_FLOAT)data);
-}
+
+
 //-----------------------------------------------------------------------------
-#endif // end use float check
+//
+// -- begin definition of Node set methods --
+//
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_DOUBLE
+// -- set for generic types --
 //-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set(double data)
+Node::set_node(const Node &node)
 {
-    set((CONDUIT_NATIVE_DOUBLE)data);
-}
-//-----------------------------------------------------------------------------
-#endif // end use double check
-//-----------------------------------------------------------------------------
+    node.materialize_children();
 
+    if(node.dtype().id() == DataType::OBJECT_ID)
+    {
+        reset();
+        init(DataType::object());
 
-//-----------------------------------------------------------------------------
-// -- set for conduit::DataArray types ---
-//-----------------------------------------------------------------------------
+        const std::vector<std::string> &cld_names = node.child_names();
 
-//-----------------------------------------------------------------------------
-// signed integer array types via conduit::DataArray
-//-----------------------------------------------------------------------------
+        for (std::vector<std::string>::const_iterator itr = cld_names.begin();
+             itr < cld_names.end(); ++itr)
+        {
+            Schema *curr_schema = &this->m_schema->add_child(*itr);
+            size_t idx = (size_t) this->m_schema->child_index(*itr);
+            Node *curr_node = new Node();
+            curr_node->set_allocator(m_allocator_id);
+            curr_node->set_schema_ptr(curr_schema);
+            curr_node->set_parent(this);
+            curr_node->set(*node.m_children[idx]);
+            this->append_node_ptr(curr_node);
+        }
+    }
+    else if(node.dtype().id() == DataType::LIST_ID)
+    {
+        reset();
+        init(DataType::list());
+        for(size_t i=0;i< node.m_children.size(); i++)
+        {
+            this->m_schema->append();
+            Schema *curr_schema = this->m_schema->child_ptr(i);
+            Node *curr_node = new Node();
+            curr_node->set_allocator(m_allocator_id);
+            curr_node->set_schema_ptr(curr_schema);
+            curr_node->set_parent(this);
+            curr_node->set(*node.m_children[i]);
+            this->append_node_ptr(curr_node);
+        }
+    }
+    else if (node.dtype().id() != DataType::EMPTY_ID)
+    {
+        node.compact_to(*this);
+    }
+    else
+    {
+        // if passed node is empty -- reset this.
+        reset();
+    }
+}
 
 //---------------------------------------------------------------------------//
 void
-Node::set_int8_array(const int8_array &data)
+Node::set(const Node &node)
 {
-    init(DataType::int8(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set_node(node);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const int8_array &data)
+Node::set_cow(const Node &node)
 {
-    set_int8_array(data);
+    node.materialize_children();
+
+    // same structure as set_node, shares leaves where possible
+    if(node.dtype().id() == DataType::OBJECT_ID)
+    {
+        reset();
+        init(DataType::object());
+
+        const std::vector<std::string> &cld_names = node.child_names();
+
+        for (std::vector<std::string>::const_iterator itr = cld_names.begin();
+             itr < cld_names.end(); ++itr)
+        {
+            Schema *curr_schema = &this->m_schema->add_child(*itr);
+            size_t idx = (size_t) this->m_schema->child_index(*itr);
+            Node *curr_node = new Node();
+            curr_node->set_allocator(m_allocator_id);
+            curr_node->set_schema_ptr(curr_schema);
+            curr_node->set_parent(this);
+            curr_node->set_cow(*node.m_children[idx]);
+            this->append_node_ptr(curr_node);
+        }
+    }
+    else if(node.dtype().id() == DataType::LIST_ID)
+    {
+        reset();
+        init(DataType::list());
+        for(size_t i=0;i< node.m_children.size(); i++)
+        {
+            this->m_schema->append();
+            Schema *curr_schema = this->m_schema->child_ptr(i);
+            Node *curr_node = new Node();
+            curr_node->set_allocator(m_allocator_id);
+            curr_node->set_schema_ptr(curr_schema);
+            curr_node->set_parent(this);
+            curr_node->set_cow(*node.m_children[i]);
+            this->append_node_ptr(curr_node);
+        }
+    }
+    else if (node.dtype().id() != DataType::EMPTY_ID)
+    {
+        if(!share_data(node))
+        {
+            node.compact_to(*this);
+        }
+    }
+    else
+    {
+        // if passed node is empty -- reset this.
+        reset();
+    }
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_int16_array(const int16_array &data)
+Node::set_dtype(const DataType &dtype)
 {
-    init(DataType::int16(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(dtype);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const int16_array &data)
+Node::set(const DataType &dtype)
 {
-    set_int16_array(data);
+    set_dtype(dtype);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_int32_array(const int32_array &data)
+Node::set_schema(const Schema &schema)
 {
-    init(DataType::int32(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    release();
+    m_schema->set(schema);
+    // allocate data
+    // for this case, we need the total bytes spanned by the schema
+    size_t nbytes =(size_t) m_schema->spanned_bytes();
+    allocate(nbytes);
+    if(utils::allocator_init(m_allocator_id) == utils::ALLOCATOR_INIT_ZERO)
+    {
+        utils::conduit_memset(m_data,0,nbytes, m_allocator_id);
+    }
+    // call walk w/ internal data pointer
+    walk_schema(this,m_schema,m_data,m_allocator_id);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const int32_array &data)
+Node::set(const Schema &schema)
 {
-    set_int32_array(data);
+    set_schema(schema);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_int64_array(const int64_array &data)
+Node::allocate_using_schema(const Schema &schema)
 {
-    init(DataType::int64(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    release();
+    m_schema->set(schema);
+    allocate(m_schema->spanned_bytes());
+    walk_schema(this,m_schema,m_data,m_allocator_id);
 }
 
+
 //---------------------------------------------------------------------------//
 void
-Node::set(const int64_array &data)
+Node::set_data_using_schema(const Schema &schema,
+                            void *data)
 {
-    set_int64_array(data);
+    release();
+    m_schema->set(schema);
+    // for this case, we need the total bytes spanned by the schema
+    size_t nbytes = (size_t)m_schema->spanned_bytes();
+    allocate(nbytes);
+    utils::conduit_memcpy(m_data, data, nbytes, m_allocator_id, 0);
+    walk_schema(this,m_schema,m_data,m_allocator_id);
 }
 
-//-----------------------------------------------------------------------------
-// unsigned integer array types via conduit::DataArray
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_uint8_array(const uint8_array &data)
+Node::set(const Schema &schema,
+          void *data)
 {
-    init(DataType::uint8(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set_data_using_schema(schema,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const uint8_array &data)
+Node::set_data_using_dtype(const DataType &dtype,
+                           void *data)
 {
-    set_uint8_array(data);
+    release();
+    m_schema->set(dtype);
+    allocate(m_schema->spanned_bytes());
+    utils::conduit_memcpy(m_data,
+                          data,
+                          (size_t) m_schema->spanned_bytes(),
+                          m_allocator_id,
+                          0);
+    walk_schema(this,m_schema,m_data,m_allocator_id);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_uint16_array(const uint16_array &data)
+Node::set(const DataType &dtype, void *data)
 {
-    init(DataType::uint16(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set_data_using_dtype(dtype,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const uint16_array &data)
+Node::set_owned(void *data,
+                const DataType &dtype,
+                const std::function<void(void*)> &deleter)
 {
-    set_uint16_array(data);
+    // the buffer is released here when it can't be adopted, so callers
+    // (like set(std::vector<T>&&)) never leak it
+    index_t dt_id = dtype.id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID ||
+       dt_id == DataType::EMPTY_ID ||
+       !deleter)
+    {
+        if(deleter)
+        {
+            deleter(data);
+        }
+        CONDUIT_ERROR("Node::set_owned requires a leaf DataType and "
+                      "a deleter, passed DataType: " << dtype.name());
+    }
+
+    if(m_frozen)
+    {
+        deleter(data);
+        frozen_error("set_owned");
+    }
+
+    own_data(data, dtype, deleter);
 }
 
+//-----------------------------------------------------------------------------
+// -- set for scalar types ---
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// signed integer scalar types
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 void
-Node::set_uint32_array(const uint32_array  &data)
+Node::set_int8(int8 data)
 {
-    init(DataType::uint32(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::int8());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(int8),
+                          m_allocator_id,
+                          0);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const uint32_array &data)
+Node::set(int8 data)
 {
-    set_uint32_array(data);
+    set_int8(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_uint64_array(const uint64_array &data)
+Node::set_int16(int16 data)
 {
-    init(DataType::uint64(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::int16());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(int16),
+                          m_allocator_id,
+                          0);
 }
+
 //---------------------------------------------------------------------------//
 void
-Node::set(const uint64_array  &data)
+Node::set(int16 data)
 {
-    set_uint64_array(data);
+    set_int16(data);
 }
 
-
-//-----------------------------------------------------------------------------
-// floating point array types via conduit::DataArray
-//-----------------------------------------------------------------------------
 //---------------------------------------------------------------------------//
 void
-Node::set_float32_array(const float32_array &data)
+Node::set_int32(int32 data)
 {
-    init(DataType::float32(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::int32());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(int32),
+                          m_allocator_id,
+                          0);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const float32_array &data)
+Node::set(int32 data)
 {
-    set_float32_array(data);
+    set_int32(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_float64_array(const float64_array &data)
+Node::set_int64(int64 data)
 {
-    init(DataType::float64(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::int64());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(int64),
+                          m_allocator_id,
+                          0);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const float64_array &data)
+Node::set(int64 data)
 {
-    set_float64_array(data);
+    set_int64(data);
 }
 
-
 //-----------------------------------------------------------------------------
-// set array gap methods for c-native types
+// unsigned integer scalar types
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
 void
-Node::set(const char_array &data)
+Node::set_uint8(uint8 data)
 {
-    init(DataType::c_char(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::uint8());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(uint8),
+                          m_allocator_id,
+                          0);
 }
 
-
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const signed_char_array &data)
+Node::set(uint8 data)
 {
-    init(DataType::c_signed_char(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set_uint8(data);
 }
 
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const unsigned_char_array &data)
+Node::set_uint16(uint16 data)
 {
-    init(DataType::c_unsigned_char(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::uint16());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(uint16),
+                          m_allocator_id,
+                          0);
 }
-//-----------------------------------------------------------------------------
-#endif // end use char check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const short_array &data)
+Node::set(uint16 data)
 {
-    init(DataType::c_short(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set_uint16(data);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const unsigned_short_array&data)
+Node::set_uint32(uint32 data)
 {
-    init(DataType::c_unsigned_short(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::uint32());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(uint32),
+                          m_allocator_id,
+                          0);
 }
-//-----------------------------------------------------------------------------
-#endif // end use short check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_INT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const int_array &data)
+Node::set(uint32 data)
 {
-    init(DataType::c_int(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set_uint32(data);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const unsigned_int_array &data)
+Node::set_uint64(uint64 data)
 {
-    init(DataType::c_unsigned_int(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    init(DataType::uint64());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(uint64),
+                          m_allocator_id,
+                          0);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(uint64 data)
+{
+    set_uint64(data);
+}
+
+//-----------------------------------------------------------------------------
+// floating point scalar types
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::set_float32(float32 data)
+{
+    init(DataType::float32());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(float32),
+                          m_allocator_id,
+                          0);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(float32 data)
+{
+    set_float32(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_float64(float64 data)
+{
+    init(DataType::float64());
+    utils::conduit_memcpy(element_ptr(0),
+                          &data,
+                          sizeof(float64),
+                          m_allocator_id,
+                          0);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(float64 data)
+{
+    set_float64(data);
+}
+
+
+//-----------------------------------------------------------------------------
+// set gap methods for c-native types
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+Node::set(char data)
+{
+    set((CONDUIT_NATIVE_CHAR)data);
+}
+
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_CHAR
+//-----------------------------------------------------------------------------
+void
+Node::set(signed char data)
+{
+    set((CONDUIT_NATIVE_SIGNED_CHAR)data);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::set(unsigned char data)
+{
+    set((CONDUIT_NATIVE_UNSIGNED_CHAR)data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use char check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_SHORT
+//-----------------------------------------------------------------------------
+void
+Node::set(short data)
+{
+    set((CONDUIT_NATIVE_SHORT)data);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::set(unsigned short data)
+{
+    set((CONDUIT_NATIVE_UNSIGNED_SHORT)data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use short check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_INT
+//-----------------------------------------------------------------------------
+void
+Node::set(int data)
+{
+    set((CONDUIT_NATIVE_INT)data);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::set(unsigned int data)
+{
+    set((CONDUIT_NATIVE_UNSIGNED_INT)data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use int check
@@ -1274,32 +2282,16 @@ Node::set(const unsigned_int_array &data)
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set(const long_array &data)
+Node::set(long data)
 {
-    init(DataType::c_long(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set((CONDUIT_NATIVE_LONG)data);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const unsigned_long_array &data)
+Node::set(unsigned long data)
 {
-    init(DataType::c_unsigned_long(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set((CONDUIT_NATIVE_UNSIGNED_LONG)data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long check
@@ -1309,32 +2301,16 @@ Node::set(const unsigned_long_array &data)
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set(const long_long_array &data)
+Node::set(long long data)
 {
-    init(DataType::c_long_long(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set((CONDUIT_NATIVE_LONG_LONG)data);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const unsigned_long_long_array &data)
+Node::set(unsigned long long data)
 {
-    init(DataType::c_unsigned_long_long(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set((CONDUIT_NATIVE_UNSIGNED_LONG_LONG)data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long long check
@@ -1344,17 +2320,9 @@ Node::set(const unsigned_long_long_array &data)
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set(const float_array &data)
+Node::set(float data)
 {
-    init(DataType::c_float(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set((CONDUIT_NATIVE_FLOAT)data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -1364,357 +2332,368 @@ Node::set(const float_array &data)
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set(const double_array &data)
+Node::set(double data)
 {
-    init(DataType::c_double(data.number_of_elements()));
-    const DataType dest_dtype = dtype();
-    const DataType src_dtype  = data.dtype();
-    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
-            (size_t)dest_dtype.number_of_elements(), // num eles to copy
-            (size_t)dest_dtype.element_bytes(),      // bytes per element
-            (size_t)dest_dtype.stride(),             // dest stride per ele
-            data.element_ptr(0),                     // src
-            (size_t)src_dtype.stride());             // src stride per ele
+    set((CONDUIT_NATIVE_DOUBLE)data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
+
 //-----------------------------------------------------------------------------
-// -- set for string types --
+// -- set for conduit::DataArray types ---
 //-----------------------------------------------------------------------------
 
-
 //-----------------------------------------------------------------------------
-// char8_str use cases
+// signed integer array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_string(const std::string &data)
+Node::set_int8_array(const int8_array &data)
 {
-    // size including the null term
-    size_t str_size_with_term = data.length()+1;
-    DataType str_t(DataType::CHAR8_STR_ID,
-                   str_size_with_term,
-                   0,
-                   sizeof(char),
-                   sizeof(char),
-                   Endianness::DEFAULT_ID);
-    init(str_t);
+    init(DataType::int8(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
+}
 
-    // if already compatible, init won't realloc.
-    // so we need to follow a 'compact_elements_to' style
-    // of copying the data
+//---------------------------------------------------------------------------//
+void
+Node::set(const int8_array &data)
+{
+    set_int8_array(data);
+}
 
-    size_t ele_bytes = (size_t) dtype().element_bytes();
-    size_t stride    = (size_t) dtype().stride();
-    const char *data_ptr = data.c_str();
-    
-    // Note: 
-    // conduit_memcpy_strided_elements will use a single 
-    // conduit_memcpy for cases where src and dest are compactly strided.
-    //
-    // element_ptr(0) gets us to start of dest
-    utils::conduit_memcpy_strided_elements(element_ptr(0), // dest ptr
-                                str_size_with_term,        // num ele
-                                ele_bytes,                 // bytes per ele
-                                stride,                    // dest stride
-                                data_ptr,                  // src
-                                ele_bytes);                // stride
+//---------------------------------------------------------------------------//
+void
+Node::set_int16_array(const int16_array &data)
+{
+    init(DataType::int16(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::string &data)
+Node::set(const int16_array &data)
 {
-    set_string(data);
+    set_int16_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_char8_str(const char *data)
+Node::set_int32_array(const int32_array &data)
 {
-    // size including the null term
-    size_t str_size_with_term = strlen(data)+1;
-    DataType str_t(DataType::CHAR8_STR_ID,
-                   str_size_with_term,
-                   0,
-                   sizeof(char),
-                   sizeof(char),
-                   Endianness::DEFAULT_ID);
-    init(str_t);
-
-    // if already compatible, init won't realloc.
-    // so we need to follow a 'compact_elements_to' style
-    // of copying the data
-
-    size_t ele_bytes = (size_t) dtype().element_bytes();
-    size_t stride    = (size_t) dtype().stride();
-
-    // Note: 
-    // conduit_memcpy_strided_elements will use a single 
-    // conduit_memcpy for cases where src and dest are compactly strided.
-    //
-    // element_ptr(0) gets us to start of dest
-    utils::conduit_memcpy_strided_elements(element_ptr(0),     // dest ptr
-                                           str_size_with_term, // num ele
-                                           ele_bytes,          // bytes per ele
-                                           stride,             // dest stride
-                                           data,               // src ptr
-                                           ele_bytes);         // src stride
-
-}
-
-
-//-----------------------------------------------------------------------------
-// -- set for std::vector types ---
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-// signed integer array types via std::vector
-//-----------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------//
-void
-Node::set_int8_vector(const std::vector<int8> &data)
-{
-    init(DataType::int8(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(int8)*data.size());
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set(const std::vector<int8> &data)
-{
-    set_int8_vector(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_int16_vector(const std::vector<int16> &data)
-{
-    init(DataType::int16(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(int16)*data.size());
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set(const std::vector<int16> &data)
-{
-    set_int16_vector(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_int32_vector(const std::vector<int32> &data)
-{
-    init(DataType::int32(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(int32)*data.size());
+    init(DataType::int32(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<int32> &data)
+Node::set(const int32_array &data)
 {
-    set_int32_vector(data);
+    set_int32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_int64_vector(const std::vector<int64> &data)
+Node::set_int64_array(const int64_array &data)
 {
-    init(DataType::int64(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(int64)*data.size());
+    init(DataType::int64(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<int64> &data)
+Node::set(const int64_array &data)
 {
-    set_int64_vector(data);
+    set_int64_array(data);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer array types via std::vector
+// unsigned integer array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_uint8_vector(const std::vector<uint8> &data)
+Node::set_uint8_array(const uint8_array &data)
 {
-    init(DataType::uint8(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(uint8)*data.size());
+    init(DataType::uint8(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<uint8> &data)
+Node::set(const uint8_array &data)
 {
-    set_uint8_vector(data);
+    set_uint8_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_uint16_vector(const std::vector<uint16> &data)
+Node::set_uint16_array(const uint16_array &data)
 {
-    init(DataType::uint16(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(uint16)*data.size());
+    init(DataType::uint16(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<uint16> &data)
+Node::set(const uint16_array &data)
 {
-    set_uint16_vector(data);
+    set_uint16_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_uint32_vector(const std::vector<uint32> &data)
+Node::set_uint32_array(const uint32_array  &data)
 {
-    init(DataType::uint32(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(uint32)*data.size());
+    init(DataType::uint32(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<uint32> &data)
+Node::set(const uint32_array &data)
 {
-    set_uint32_vector(data);
+    set_uint32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_uint64_vector(const std::vector<uint64> &data)
+Node::set_uint64_array(const uint64_array &data)
 {
-    init(DataType::uint64(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(uint64)*data.size());
+    init(DataType::uint64(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
-
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<uint64> &data)
+Node::set(const uint64_array  &data)
 {
-     set_uint64_vector(data);
+    set_uint64_array(data);
 }
 
+
 //-----------------------------------------------------------------------------
-// floating point array types via std::vector
+// floating point array types via conduit::DataArray
 //-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_float32_vector(const std::vector<float32> &data)
+Node::set_float32_array(const float32_array &data)
 {
-    init(DataType::float32(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(float32)*data.size());
+    init(DataType::float32(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<float32> &data)
+Node::set(const float32_array &data)
 {
-    set_float32_vector(data);
+    set_float32_array(data);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_float64_vector(const std::vector<float64> &data)
+Node::set_float64_array(const float64_array &data)
 {
-    init(DataType::float64(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(float64)*data.size());
+    init(DataType::float64(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set(const std::vector<float64> &data)
+Node::set(const float64_array &data)
 {
-    set_float64_vector(data);
+    set_float64_array(data);
 }
 
 
 //-----------------------------------------------------------------------------
-// set vector gap methods for c-native types
+// set array gap methods for c-native types
 //-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<char> &data)
+Node::set(const char_array &data)
 {
-    init(DataType::c_char(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(char)*data.size());
+    init(DataType::c_char(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
+
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
-void
-Node::set(const std::vector<signed char> &data)
-{
-    init(DataType::c_char(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(signed char)*data.size());
-}
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<unsigned char> &data)
+Node::set(const signed_char_array &data)
 {
-    init(DataType::c_unsigned_char(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(unsigned char)*data.size());
+    init(DataType::c_signed_char(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
-//-----------------------------------------------------------------------------
-#endif // end use char check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
+
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<short> &data)
+Node::set(const unsigned_char_array &data)
 {
-    init(DataType::c_short(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(short)*data.size());
+    init(DataType::c_unsigned_char(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
+//-----------------------------------------------------------------------------
+#endif // end use char check
+//-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<unsigned short> &data)
+Node::set(const short_array &data)
 {
-    init(DataType::c_unsigned_short(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(unsigned short)*data.size());
+    init(DataType::c_short(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::set(const unsigned_short_array&data)
+{
+    init(DataType::c_unsigned_short(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 //-----------------------------------------------------------------------------
 #endif // end use short check
@@ -1724,22 +2703,36 @@ Node::set(const std::vector<unsigned short> &data)
 #ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<int> &data)
+Node::set(const int_array &data)
 {
-    init(DataType::c_int(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(int)*data.size());
+    init(DataType::c_int(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<unsigned int> &data)
+Node::set(const unsigned_int_array &data)
 {
-    init(DataType::c_unsigned_int(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(unsigned int)*data.size());
+    init(DataType::c_unsigned_int(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 //-----------------------------------------------------------------------------
 #endif // end use int check
@@ -1749,22 +2742,36 @@ Node::set(const std::vector<unsigned int> &data)
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<long> &data)
+Node::set(const long_array &data)
 {
-    init(DataType::c_long(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(long)*data.size());
+    init(DataType::c_long(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<unsigned long> &data)
+Node::set(const unsigned_long_array &data)
 {
-    init(DataType::c_unsigned_long(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(unsigned long)*data.size());
+    init(DataType::c_unsigned_long(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 //-----------------------------------------------------------------------------
 #endif // end use long check
@@ -1774,22 +2781,36 @@ Node::set(const std::vector<unsigned long> &data)
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<long long> &data)
+Node::set(const long_long_array &data)
 {
-    init(DataType::c_long_long(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(long long)*data.size());
+    init(DataType::c_long_long(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<unsigned long long> &data)
+Node::set(const unsigned_long_long_array &data)
 {
-    init(DataType::c_unsigned_long_long(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(unsigned long long)*data.size());
+    init(DataType::c_unsigned_long_long(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 //-----------------------------------------------------------------------------
 #endif // end use long long check
@@ -1799,12 +2820,19 @@ Node::set(const std::vector<unsigned long long> &data)
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<float> &data)
+Node::set(const float_array &data)
 {
-    init(DataType::c_float(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(float)*data.size());
+    init(DataType::c_float(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -1814,279 +2842,365 @@ Node::set(const std::vector<float> &data)
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::vector<double> &data)
+Node::set(const double_array &data)
 {
-    init(DataType::c_double(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          &data[0],
-                          sizeof(double)*data.size());
+    init(DataType::c_double(data.number_of_elements()));
+    const DataType dest_dtype = dtype();
+    const DataType src_dtype  = data.dtype();
+    utils::conduit_memcpy_strided_elements(element_ptr(0),   // dest
+            (size_t)dest_dtype.number_of_elements(), // num eles to copy
+            (size_t)dest_dtype.element_bytes(),      // bytes per element
+            (size_t)dest_dtype.stride(),             // dest stride per ele
+            data.element_ptr(0),                     // src
+            (size_t)src_dtype.stride(),              // src stride per ele
+            m_allocator_id,                          // dest allocator
+            0);                                      // src allocator
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
-
-
-
-//-----------------------------------------------------------------------------
-// -- std::initializer_list support --
-//-----------------------------------------------------------------------------
-//
-// When C++11 support is enabled, support std::initializer_lists
-//
-// Example:
-//   Node n;
-//   n.set({1,2,3,4,5,6});
-//
 //-----------------------------------------------------------------------------
-#ifdef CONDUIT_USE_CXX11
+// -- set for string types --
 //-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-// -- set for bitwidth style std::initializer_list types ---
-//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer array types via std::initializer_list
+// char8_str use cases
 //-----------------------------------------------------------------------------
 
-// -- int8 --
-
-//-----------------------------------------------------------------------------
-void
-Node::set_int8_initializer_list(const std::initializer_list<int8> &data)
-{
-    init(DataType::int8(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(int8) * data.size());
-}
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<int8> &data)
+Node::set_string(const std::string &data)
 {
-    set_int8_initializer_list(data);
-}
+    // size including the null term
+    size_t str_size_with_term = data.length()+1;
+    DataType str_t(DataType::CHAR8_STR_ID,
+                   str_size_with_term,
+                   0,
+                   sizeof(char),
+                   sizeof(char),
+                   Endianness::DEFAULT_ID);
+    init(str_t);
 
-// -- int16 --
+    // if already compatible, init won't realloc.
+    // so we need to follow a 'compact_elements_to' style
+    // of copying the data
 
-//-----------------------------------------------------------------------------
-void
-Node::set_int16_initializer_list(const std::initializer_list<int16> &data)
-{
-    init(DataType::int16(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(int16) * data.size());
+    size_t ele_bytes = (size_t) dtype().element_bytes();
+    size_t stride    = (size_t) dtype().stride();
+    const char *data_ptr = data.c_str();
+    
+    // Note: 
+    // conduit_memcpy_strided_elements will use a single 
+    // conduit_memcpy for cases where src and dest are compactly strided.
+    //
+    // element_ptr(0) gets us to start of dest
+    utils::conduit_memcpy_strided_elements(element_ptr(0), // dest ptr
+                                str_size_with_term,        // num ele
+                                ele_bytes,                 // bytes per ele
+                                stride,                    // dest stride
+                                data_ptr,                  // src
+                                ele_bytes,                 // stride
+                                m_allocator_id,            // dest allocator
+                                0);                        // src allocator
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<int16> &data)
+Node::set(const std::string &data)
 {
-    set_int16_initializer_list(data);
+    set_string(data);
 }
 
-// -- int32 --
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_int32_initializer_list(const std::initializer_list<int32> &data)
+Node::set_char8_str(const char *data)
 {
-    init(DataType::int32(data.size()));
-    utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(int32) * data.size());
-}
+    // size including the null term
+    size_t str_size_with_term = strlen(data)+1;
+    DataType str_t(DataType::CHAR8_STR_ID,
+                   str_size_with_term,
+                   0,
+                   sizeof(char),
+                   sizeof(char),
+                   Endianness::DEFAULT_ID);
+    init(str_t);
 
-//-----------------------------------------------------------------------------
-void
-Node::set(const std::initializer_list<int32> &data)
-{
-    set_int32_initializer_list(data);
-}
+    // if already compatible, init won't realloc.
+    // so we need to follow a 'compact_elements_to' style
+    // of copying the data
 
+    size_t ele_bytes = (size_t) dtype().element_bytes();
+    size_t stride    = (size_t) dtype().stride();
 
-// -- int64 --
+    // Note: 
+    // conduit_memcpy_strided_elements will use a single 
+    // conduit_memcpy for cases where src and dest are compactly strided.
+    //
+    // element_ptr(0) gets us to start of dest
+    utils::conduit_memcpy_strided_elements(element_ptr(0),     // dest ptr
+                                           str_size_with_term, // num ele
+                                           ele_bytes,          // bytes per ele
+                                           stride,             // dest stride
+                                           data,               // src ptr
+                                           ele_bytes,          // src stride
+                                           m_allocator_id,     // dest allocator
+                                           0);                 // src allocator
+
+}
+
+
+//-----------------------------------------------------------------------------
+// -- set for std::vector types ---
+//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
+// signed integer array types via std::vector
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set_int64_initializer_list(const std::initializer_list<int64> &data)
+Node::set_int8_vector(const std::vector<int8> &data)
 {
-    init(DataType::int64(data.size()));
+    init(DataType::int8(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(int64) * data.size());
+                          &data[0],
+                          sizeof(int8)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<int64> &data)
+Node::set(const std::vector<int8> &data)
 {
-    set_int64_initializer_list(data);
+    set_int8_vector(data);
 }
 
-//-----------------------------------------------------------------------------
-// unsigned integer array types via std::initializer_list
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
+void
+Node::set_int16_vector(const std::vector<int16> &data)
+{
+    init(DataType::int16(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          &data[0],
+                          sizeof(int16)*data.size(),
+                          m_allocator_id,
+                          0);
+}
 
+//---------------------------------------------------------------------------//
+void
+Node::set(const std::vector<int16> &data)
+{
+    set_int16_vector(data);
+}
 
-// -- uint8 --
+//---------------------------------------------------------------------------//
+void
+Node::set_int32_vector(const std::vector<int32> &data)
+{
+    init(DataType::int32(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          &data[0],
+                          sizeof(int32)*data.size(),
+                          m_allocator_id,
+                          0);
+}
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_uint8_initializer_list(const std::initializer_list<uint8> &data)
+Node::set(const std::vector<int32> &data)
 {
-    init(DataType::uint8(data.size()));
+    set_int32_vector(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_int64_vector(const std::vector<int64> &data)
+{
+    init(DataType::int64(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(uint8) * data.size());
+                          &data[0],
+                          sizeof(int64)*data.size(),
+                          m_allocator_id,
+                          0);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set(const std::vector<int64> &data)
+{
+    set_int64_vector(data);
 }
 
 //-----------------------------------------------------------------------------
+// unsigned integer array types via std::vector
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<uint8> &data)
+Node::set_uint8_vector(const std::vector<uint8> &data)
 {
-    set_uint8_initializer_list(data);
+    init(DataType::uint8(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          &data[0],
+                          sizeof(uint8)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-// -- uint16 --
+//---------------------------------------------------------------------------//
+void
+Node::set(const std::vector<uint8> &data)
+{
+    set_uint8_vector(data);
+}
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_uint16_initializer_list(const std::initializer_list<uint16> &data)
+Node::set_uint16_vector(const std::vector<uint16> &data)
 {
     init(DataType::uint16(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(uint16) * data.size());
+                          &data[0],
+                          sizeof(uint16)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<uint16> &data)
+Node::set(const std::vector<uint16> &data)
 {
-    set_uint16_initializer_list(data);
+    set_uint16_vector(data);
 }
 
-// -- uint32 --
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_uint32_initializer_list(const std::initializer_list<uint32> &data)
+Node::set_uint32_vector(const std::vector<uint32> &data)
 {
     init(DataType::uint32(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(uint32) * data.size());
+                          &data[0],
+                          sizeof(uint32)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<uint32> &data)
+Node::set(const std::vector<uint32> &data)
 {
-    set_uint32_initializer_list(data);
+    set_uint32_vector(data);
 }
 
-// -- uint64 --
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_uint64_initializer_list(const std::initializer_list<uint64> &data)
+Node::set_uint64_vector(const std::vector<uint64> &data)
 {
     init(DataType::uint64(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(uint64) * data.size());
+                          &data[0],
+                          sizeof(uint64)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<uint64> &data)
+Node::set(const std::vector<uint64> &data)
 {
-    set_uint64_initializer_list(data);
+     set_uint64_vector(data);
 }
 
-
 //-----------------------------------------------------------------------------
-// floating point array types via std::initializer_list
+// floating point array types via std::vector
 //-----------------------------------------------------------------------------
 
-// -- float32 --
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_float32_initializer_list(const std::initializer_list<float32> &data)
+Node::set_float32_vector(const std::vector<float32> &data)
 {
     init(DataType::float32(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(float32) * data.size());
+                          &data[0],
+                          sizeof(float32)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<float32> &data)
+Node::set(const std::vector<float32> &data)
 {
-    set_float32_initializer_list(data);
+    set_float32_vector(data);
 }
 
-// -- float64 --
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_float64_initializer_list(const std::initializer_list<float64> &data)
+Node::set_float64_vector(const std::vector<float64> &data)
 {
     init(DataType::float64(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(float64) * data.size());
+                          &data[0],
+                          sizeof(float64)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set(const std::initializer_list<float64> &data)
+Node::set(const std::vector<float64> &data)
 {
-    set_float64_initializer_list(data);
+    set_float64_vector(data);
 }
 
 
 //-----------------------------------------------------------------------------
-//  set initializer_list gap methods for c-native types
+// set vector gap methods for c-native types
 //-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<char> &data)
+Node::set(const std::vector<char> &data)
 {
     init(DataType::c_char(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(char) * data.size());
+                          &data[0],
+                          sizeof(char)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<signed char> &data)
+Node::set(const std::vector<signed char> &data)
 {
     init(DataType::c_char(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(signed char) * data.size());
+                          &data[0],
+                          sizeof(signed char)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<unsigned char> &data)
+Node::set(const std::vector<unsigned char> &data)
 {
     init(DataType::c_unsigned_char(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(unsigned char) * data.size());
+                          &data[0],
+                          sizeof(unsigned char)*data.size(),
+                          m_allocator_id,
+                          0);
 }
-
 //-----------------------------------------------------------------------------
 #endif // end use char check
 //-----------------------------------------------------------------------------
@@ -2095,24 +3209,27 @@ Node::set(const std::initializer_list<unsigned char> &data)
 #ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<short> &data)
+Node::set(const std::vector<short> &data)
 {
     init(DataType::c_short(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(short) * data.size());
+                          &data[0],
+                          sizeof(short)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<unsigned short> &data)
+Node::set(const std::vector<unsigned short> &data)
 {
     init(DataType::c_unsigned_short(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(unsigned short) * data.size());
+                          &data[0],
+                          sizeof(unsigned short)*data.size(),
+                          m_allocator_id,
+                          0);
 }
-
 //-----------------------------------------------------------------------------
 #endif // end use short check
 //-----------------------------------------------------------------------------
@@ -2121,24 +3238,27 @@ Node::set(const std::initializer_list<unsigned short> &data)
 #ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<int> &data)
+Node::set(const std::vector<int> &data)
 {
     init(DataType::c_int(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(int) * data.size());
+                          &data[0],
+                          sizeof(int)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<unsigned int> &data)
+Node::set(const std::vector<unsigned int> &data)
 {
     init(DataType::c_unsigned_int(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(unsigned int) * data.size());
+                          &data[0],
+                          sizeof(unsigned int)*data.size(),
+                          m_allocator_id,
+                          0);
 }
-
 //-----------------------------------------------------------------------------
 #endif // end use int check
 //-----------------------------------------------------------------------------
@@ -2147,24 +3267,27 @@ Node::set(const std::initializer_list<unsigned int> &data)
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<long> &data)
+Node::set(const std::vector<long> &data)
 {
     init(DataType::c_long(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(long) * data.size());
+                          &data[0],
+                          sizeof(long)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<unsigned long> &data)
+Node::set(const std::vector<unsigned long> &data)
 {
     init(DataType::c_unsigned_long(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(unsigned long) * data.size());
+                          &data[0],
+                          sizeof(unsigned long)*data.size(),
+                          m_allocator_id,
+                          0);
 }
-
 //-----------------------------------------------------------------------------
 #endif // end use long check
 //-----------------------------------------------------------------------------
@@ -2173,24 +3296,27 @@ Node::set(const std::initializer_list<unsigned long> &data)
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<long long> &data)
+Node::set(const std::vector<long long> &data)
 {
     init(DataType::c_long_long(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(long long) * data.size());
+                          &data[0],
+                          sizeof(long long)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<unsigned long long> &data)
+Node::set(const std::vector<unsigned long long> &data)
 {
     init(DataType::c_unsigned_long_long(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(unsigned long long) * data.size());
+                          &data[0],
+                          sizeof(unsigned long long)*data.size(),
+                          m_allocator_id,
+                          0);
 }
-
 //-----------------------------------------------------------------------------
 #endif // end use long long check
 //-----------------------------------------------------------------------------
@@ -2199,12 +3325,14 @@ Node::set(const std::initializer_list<unsigned long long> &data)
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<float> &data)
+Node::set(const std::vector<float> &data)
 {
     init(DataType::c_float(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(float) * data.size());
+                          &data[0],
+                          sizeof(float)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -2214,374 +3342,307 @@ Node::set(const std::initializer_list<float> &data)
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set(const std::initializer_list<double> &data)
+Node::set(const std::vector<double> &data)
 {
     init(DataType::c_double(data.size()));
     utils::conduit_memcpy(element_ptr(0),
-                          (void*)data.begin(),
-                          sizeof(double) * data.size());
+                          &data[0],
+                          sizeof(double)*data.size(),
+                          m_allocator_id,
+                          0);
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
+
+
+
 //-----------------------------------------------------------------------------
-#endif // end CONDUIT_USE_CXX11 (end of set for std::initializer_lists)
+// -- std::initializer_list support --
+//-----------------------------------------------------------------------------
+//
+// When C++11 support is enabled, support std::initializer_lists
+//
+// Example:
+//   Node n;
+//   n.set({1,2,3,4,5,6});
+//
+//-----------------------------------------------------------------------------
+#ifdef CONDUIT_USE_CXX11
 //-----------------------------------------------------------------------------
-
 
 //-----------------------------------------------------------------------------
-// -- set via pointers (scalar and array types) --
+// -- set for bitwidth style std::initializer_list types ---
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer pointer cases
+// signed integer array types via std::initializer_list
 //-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+// -- int8 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_int8_ptr(const int8 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_int8_initializer_list(const std::initializer_list<int8> &data)
 {
-    set(int8_array(data,DataType::int8(num_elements,
-                                       offset,
-                                       stride,
-                                       element_bytes,
-                                       endianness)));
+    init(DataType::int8(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(int8) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const int8 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<int8> &data)
 {
-    set_int8_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_int8_initializer_list(data);
 }
 
-//---------------------------------------------------------------------------//
+// -- int16 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_int16_ptr(const int16 *data,
-                    index_t num_elements,
-                    index_t offset,
-                    index_t stride,
-                    index_t element_bytes,
-                    index_t endianness)
+Node::set_int16_initializer_list(const std::initializer_list<int16> &data)
 {
-    set(int16_array(data,DataType::int16(num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness)));
+    init(DataType::int16(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(int16) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const int16 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<int16> &data)
 {
-    set_int16_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_int16_initializer_list(data);
 }
 
-//---------------------------------------------------------------------------//
+// -- int32 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_int32_ptr(const int32 *data,
-                    index_t num_elements,
-                    index_t offset,
-                    index_t stride,
-                    index_t element_bytes,
-                    index_t endianness)
+Node::set_int32_initializer_list(const std::initializer_list<int32> &data)
 {
-    set(int32_array(data,DataType::int32(num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness)));
+    init(DataType::int32(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(int32) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const int32 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<int32> &data)
 {
-    set_int32_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_int32_initializer_list(data);
 }
 
-//---------------------------------------------------------------------------//
+
+// -- int64 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_int64_ptr(const int64 *data,
-                    index_t num_elements,
-                    index_t offset,
-                    index_t stride,
-                    index_t element_bytes,
-                    index_t endianness)
+Node::set_int64_initializer_list(const std::initializer_list<int64> &data)
 {
-    set(int64_array(data,DataType::int64(num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness)));
+    init(DataType::int64(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(int64) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const int64 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<int64> &data)
 {
-    set_int64_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_int64_initializer_list(data);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer pointer cases
+// unsigned integer array types via std::initializer_list
 //-----------------------------------------------------------------------------
 
 
-//---------------------------------------------------------------------------//
+// -- uint8 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_uint8_ptr(const uint8 *data,
-                    index_t num_elements,
-                    index_t offset,
-                    index_t stride,
-                    index_t element_bytes,
-                    index_t endianness)
+Node::set_uint8_initializer_list(const std::initializer_list<uint8> &data)
 {
-    set(uint8_array(data,DataType::uint8(num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness)));
+    init(DataType::uint8(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(uint8) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const uint8 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<uint8> &data)
 {
-    set_uint8_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_uint8_initializer_list(data);
 }
 
-//---------------------------------------------------------------------------//
+// -- uint16 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_uint16_ptr(const uint16 *data,
-                     index_t num_elements,
-                     index_t offset,
-                     index_t stride,
-                     index_t element_bytes,
-                     index_t endianness)
+Node::set_uint16_initializer_list(const std::initializer_list<uint16> &data)
 {
-    set(uint16_array(data,DataType::uint16(num_elements,
-                                           offset,
-                                           stride,
-                                           element_bytes,
-                                           endianness)));
+    init(DataType::uint16(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(uint16) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const uint16 *data,
-         index_t num_elements,
-         index_t offset,
-         index_t stride,
-         index_t element_bytes,
-         index_t endianness)
+Node::set(const std::initializer_list<uint16> &data)
 {
-    set_uint16_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_uint16_initializer_list(data);
 }
-//---------------------------------------------------------------------------//
+
+// -- uint32 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_uint32_ptr(const uint32 *data,
-                     index_t num_elements,
-                     index_t offset,
-                     index_t stride,
-                     index_t element_bytes,
-                     index_t endianness)
+Node::set_uint32_initializer_list(const std::initializer_list<uint32> &data)
 {
-    set(uint32_array(data,DataType::uint32(num_elements,
-                                           offset,
-                                           stride,
-                                           element_bytes,
-                                           endianness)));
+    init(DataType::uint32(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(uint32) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const uint32 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<uint32> &data)
 {
-    set_uint32_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_uint32_initializer_list(data);
 }
 
-//---------------------------------------------------------------------------//
+// -- uint64 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_uint64_ptr(const uint64 *data,
-                     index_t num_elements,
-                     index_t offset,
-                     index_t stride,
-                     index_t element_bytes,
-                     index_t endianness)
+Node::set_uint64_initializer_list(const std::initializer_list<uint64> &data)
 {
-    set(uint64_array(data,DataType::uint64(num_elements,
-                                           offset,
-                                           stride,
-                                           element_bytes,
-                                           endianness)));
-
+    init(DataType::uint64(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(uint64) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const uint64 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<uint64> &data)
 {
-    set_uint64_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_uint64_initializer_list(data);
 }
 
+
 //-----------------------------------------------------------------------------
-// floating point pointer cases
+// floating point array types via std::initializer_list
 //-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+// -- float32 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_float32_ptr(const float32 *data,
-                      index_t num_elements,
-                      index_t offset,
-                      index_t stride,
-                      index_t element_bytes,
-                      index_t endianness)
+Node::set_float32_initializer_list(const std::initializer_list<float32> &data)
 {
-    set(float32_array(data,DataType::float32(num_elements,
-                                             offset,
-                                             stride,
-                                             element_bytes,
-                                             endianness)));
+    init(DataType::float32(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(float32) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const float32 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<float32> &data)
 {
-    set_float32_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_float32_initializer_list(data);
 }
 
-//---------------------------------------------------------------------------//
+// -- float64 --
+
+//-----------------------------------------------------------------------------
 void
-Node::set_float64_ptr(const float64 *data,
-                      index_t num_elements,
-                      index_t offset,
-                      index_t stride,
-                      index_t element_bytes,
-                      index_t endianness)
+Node::set_float64_initializer_list(const std::initializer_list<float64> &data)
 {
-    set(float64_array(data,DataType::float64(num_elements,
-                                             offset,
-                                             stride,
-                                             element_bytes,
-                                             endianness)));
+    init(DataType::float64(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(float64) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set(const float64 *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<float64> &data)
 {
-    set_float64_ptr(data,num_elements,offset,stride,element_bytes,endianness);
+    set_float64_initializer_list(data);
 }
 
 
 //-----------------------------------------------------------------------------
-// set pointer gap methods for c-native types
+//  set initializer_list gap methods for c-native types
+//-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------//
 void
-Node::set_char_ptr(const char *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set(const std::initializer_list<char> &data)
 {
-    set(char_array(data,DataType::c_char(num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness)));
+    init(DataType::c_char(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(char) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
-
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
-Node::set(const signed char *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<signed char> &data)
 {
-    set(signed_char_array(data,DataType::c_signed_char(num_elements,
-                                                       offset,
-                                                       stride,
-                                                       element_bytes,
-                                                       endianness)));
+    init(DataType::c_char(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(signed char) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const unsigned char *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<unsigned char> &data)
 {
-    set(unsigned_char_array(data,DataType::c_unsigned_char(num_elements,
-                                                           offset,
-                                                           stride,
-                                                           element_bytes,
-                                                           endianness)));
+    init(DataType::c_unsigned_char(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(unsigned char) * data.size(),
+                          m_allocator_id,
+                          0);
 }
+
 //-----------------------------------------------------------------------------
 #endif // end use char check
 //-----------------------------------------------------------------------------
@@ -2590,35 +3651,28 @@ Node::set(const unsigned char *data,
 #ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
-Node::set(const short *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<short> &data)
 {
-    set(short_array(data,DataType::c_short(num_elements,
-                                           offset,
-                                           stride,
-                                           element_bytes,
-                                           endianness)));
+    init(DataType::c_short(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(short) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const unsigned short *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<unsigned short> &data)
 {
-    set(unsigned_short_array(data,DataType::c_unsigned_short(num_elements,
-                                                             offset,
-                                                             stride,
-                                                             element_bytes,
-                                                             endianness)));
+    init(DataType::c_unsigned_short(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(unsigned short) * data.size(),
+                          m_allocator_id,
+                          0);
 }
+
 //-----------------------------------------------------------------------------
 #endif // end use short check
 //-----------------------------------------------------------------------------
@@ -2627,35 +3681,28 @@ Node::set(const unsigned short *data,
 #ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set(const int *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<int> &data)
 {
-    set(int_array(data,DataType::c_int(num_elements,
-                                       offset,
-                                       stride,
-                                       element_bytes,
-                                       endianness)));
+    init(DataType::c_int(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(int) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const unsigned int *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<unsigned int> &data)
 {
-    set(unsigned_int_array(data,DataType::c_unsigned_int(num_elements,
-                                                         offset,
-                                                         stride,
-                                                         element_bytes,
-                                                         endianness)));
+    init(DataType::c_unsigned_int(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(unsigned int) * data.size(),
+                          m_allocator_id,
+                          0);
 }
+
 //-----------------------------------------------------------------------------
 #endif // end use int check
 //-----------------------------------------------------------------------------
@@ -2664,35 +3711,28 @@ Node::set(const unsigned int *data,
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set(const long *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<long> &data)
 {
-    set(long_array(data,DataType::c_long(num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness)));
+    init(DataType::c_long(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(long) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const unsigned long *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<unsigned long> &data)
 {
-    set(unsigned_long_array(data,DataType::c_unsigned_long(num_elements,
-                                                           offset,
-                                                           stride,
-                                                           element_bytes,
-                                                           endianness)));
+    init(DataType::c_unsigned_long(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(unsigned long) * data.size(),
+                          m_allocator_id,
+                          0);
 }
+
 //-----------------------------------------------------------------------------
 #endif // end use long check
 //-----------------------------------------------------------------------------
@@ -2701,36 +3741,28 @@ Node::set(const unsigned long *data,
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set(const long long *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<long long> &data)
 {
-    set(long_array(data,DataType::c_long_long(num_elements,
-                                              offset,
-                                              stride,
-                                              element_bytes,
-                                              endianness)));
+    init(DataType::c_long_long(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(long long) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set(const unsigned long long *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<unsigned long long> &data)
 {
-    set(unsigned_long_long_array(data,
-                                 DataType::c_unsigned_long_long(num_elements,
-                                                                offset,
-                                                                stride,
-                                                                element_bytes,
-                                                                endianness)));
+    init(DataType::c_unsigned_long_long(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(unsigned long long) * data.size(),
+                          m_allocator_id,
+                          0);
 }
+
 //-----------------------------------------------------------------------------
 #endif // end use long long check
 //-----------------------------------------------------------------------------
@@ -2739,18 +3771,14 @@ Node::set(const unsigned long long *data,
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set(const float *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<float> &data)
 {
-    set(float_array(data,DataType::c_float(num_elements,
-                                           offset,
-                                           stride,
-                                           element_bytes,
-                                           endianness)));
+    init(DataType::c_float(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(float) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -2760,328 +3788,375 @@ Node::set(const float *data,
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set(const double *data,
-          index_t num_elements,
-          index_t offset,
-          index_t stride,
-          index_t element_bytes,
-          index_t endianness)
+Node::set(const std::initializer_list<double> &data)
 {
-    set(double_array(data,DataType::c_double(num_elements,
-                                             offset,
-                                             stride,
-                                             element_bytes,
-                                             endianness)));
+    init(DataType::c_double(data.size()));
+    utils::conduit_memcpy(element_ptr(0),
+                          (void*)data.begin(),
+                          sizeof(double) * data.size(),
+                          m_allocator_id,
+                          0);
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-//
-// -- end definition of Node set methods --
-//
+#endif // end CONDUIT_USE_CXX11 (end of set for std::initializer_lists)
 //-----------------------------------------------------------------------------
 
 
 //-----------------------------------------------------------------------------
-//
-// -- begin definition of Node set_path methods --
-//
+// -- set via pointers (scalar and array types) --
 //-----------------------------------------------------------------------------
 
-
 //-----------------------------------------------------------------------------
-// -- set_path for generic types --
+// signed integer pointer cases
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_node(const std::string &path,
-                    const Node& data)
-{
-    fetch(path).set_node(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path(const std::string &path,
-               const Node& data)
-{
-    set_path_node(path,data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path_dtype(const std::string &path,
-                     const DataType& dtype)
+Node::set_int8_ptr(const int8 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    fetch(path).set_dtype(dtype);
+    set(int8_array(data,DataType::int8(num_elements,
+                                       offset,
+                                       stride,
+                                       element_bytes,
+                                       endianness)));
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const DataType& dtype)
+Node::set(const int8 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path_dtype(path,dtype);
+    set_int8_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_schema(const std::string &path,
-                      const Schema &schema)
+Node::set_int16_ptr(const int16 *data,
+                    index_t num_elements,
+                    index_t offset,
+                    index_t stride,
+                    index_t element_bytes,
+                    index_t endianness)
 {
-    fetch(path).set_schema(schema);
+    set(int16_array(data,DataType::int16(num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const Schema &schema)
+Node::set(const int16 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path_schema(path,schema);
+    set_int16_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_data_using_schema(const std::string &path,
-                                 const Schema &schema,
-                                 void *data)
+Node::set_int32_ptr(const int32 *data,
+                    index_t num_elements,
+                    index_t offset,
+                    index_t stride,
+                    index_t element_bytes,
+                    index_t endianness)
 {
-    fetch(path).set_data_using_schema(schema,data);
+    set(int32_array(data,DataType::int32(num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const Schema &schema,
-               void *data)
+Node::set(const int32 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path_data_using_schema(path,schema,data);
+    set_int32_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_data_using_dtype(const std::string &path,
-                                const DataType &dtype,
-                                void *data)
+Node::set_int64_ptr(const int64 *data,
+                    index_t num_elements,
+                    index_t offset,
+                    index_t stride,
+                    index_t element_bytes,
+                    index_t endianness)
 {
-    fetch(path).set_data_using_dtype(dtype,data);
+    set(int64_array(data,DataType::int64(num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const DataType &dtype,
-               void *data)
+Node::set(const int64 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path_data_using_dtype(path,dtype,data);
+    set_int64_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //-----------------------------------------------------------------------------
-// -- set_path for scalar types ---
+// unsigned integer pointer cases
 //-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-// signed integer scalar types
-//-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int8(const std::string &path,
-                    int8 data)
+Node::set_uint8_ptr(const uint8 *data,
+                    index_t num_elements,
+                    index_t offset,
+                    index_t stride,
+                    index_t element_bytes,
+                    index_t endianness)
 {
-    fetch(path).set_int8(data);
+    set(uint8_array(data,DataType::uint8(num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               int8 data)
+Node::set(const uint8 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path_int8(path,data);
+    set_uint8_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int16(const std::string &path,
-                     int16 data)
+Node::set_uint16_ptr(const uint16 *data,
+                     index_t num_elements,
+                     index_t offset,
+                     index_t stride,
+                     index_t element_bytes,
+                     index_t endianness)
 {
-    fetch(path).set_int16(data);
+    set(uint16_array(data,DataType::uint16(num_elements,
+                                           offset,
+                                           stride,
+                                           element_bytes,
+                                           endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               int16 data)
+Node::set(const uint16 *data,
+         index_t num_elements,
+         index_t offset,
+         index_t stride,
+         index_t element_bytes,
+         index_t endianness)
 {
-    set_path_int16(path,data);
+    set_uint16_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
-
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int32(const std::string &path,
-                     int32 data)
+Node::set_uint32_ptr(const uint32 *data,
+                     index_t num_elements,
+                     index_t offset,
+                     index_t stride,
+                     index_t element_bytes,
+                     index_t endianness)
 {
-    fetch(path).set_int32(data);
+    set(uint32_array(data,DataType::uint32(num_elements,
+                                           offset,
+                                           stride,
+                                           element_bytes,
+                                           endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               int32 data)
+Node::set(const uint32 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path_int32(path,data);
+    set_uint32_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int64(const std::string &path,
-                     int64 data)
+Node::set_uint64_ptr(const uint64 *data,
+                     index_t num_elements,
+                     index_t offset,
+                     index_t stride,
+                     index_t element_bytes,
+                     index_t endianness)
 {
-    fetch(path).set_int64(data);
+    set(uint64_array(data,DataType::uint64(num_elements,
+                                           offset,
+                                           stride,
+                                           element_bytes,
+                                           endianness)));
+
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               int64 data)
+Node::set(const uint64 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    fetch(path).set(data);
+    set_uint64_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer scalar types
+// floating point pointer cases
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint8(const std::string &path,
-                     uint8 data)
+Node::set_float32_ptr(const float32 *data,
+                      index_t num_elements,
+                      index_t offset,
+                      index_t stride,
+                      index_t element_bytes,
+                      index_t endianness)
 {
-    fetch(path).set_uint8(data);
+    set(float32_array(data,DataType::float32(num_elements,
+                                             offset,
+                                             stride,
+                                             element_bytes,
+                                             endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               uint8 data)
+Node::set(const float32 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path_uint8(path,data);
+    set_float32_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint16(const std::string &path,
-                      uint16 data)
-{
-    fetch(path).set_uint16(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path(const std::string &path,
-               uint16 data)
-{
-    set_path_uint16(path,data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path_uint32(const std::string &path,
-                      uint32 data)
-{
-    fetch(path).set_uint32(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path(const std::string &path,
-               uint32 data)
+Node::set_float64_ptr(const float64 *data,
+                      index_t num_elements,
+                      index_t offset,
+                      index_t stride,
+                      index_t element_bytes,
+                      index_t endianness)
 {
-    set_path_uint32(path,data);
+    set(float64_array(data,DataType::float64(num_elements,
+                                             offset,
+                                             stride,
+                                             element_bytes,
+                                             endianness)));
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint64(const std::string &path,
-                      uint64 data)
+Node::set(const float64 *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    fetch(path).set_uint64(data);
+    set_float64_ptr(data,num_elements,offset,stride,element_bytes,endianness);
 }
 
-//---------------------------------------------------------------------------//
-void
-Node::set_path(const std::string &path,
-               uint64 data)
-{
-    set_path_uint64(path,data);
-}
 
 //-----------------------------------------------------------------------------
-// floating point scalar types
+// set pointer gap methods for c-native types
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_float32(const std::string &path,
-                       float32 data)
-{
-    fetch(path).set_float32(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path(const std::string &path,
-               float32 data)
-{
-    set_path_float32(path,data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path_float64(const std::string &path,
-                       float64 data)
-{
-    fetch(path).set_float64(data);
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_path(const std::string &path,
-               float64 data)
+Node::set_char_ptr(const char *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_path_float64(path,data);
+    set(char_array(data,DataType::c_char(num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness)));
 }
 
-//-----------------------------------------------------------------------------
-// set_path gap methods for c-native types
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-void
-Node::set_path(const std::string &path, char data)
-{
-    set_path(path,(CONDUIT_NATIVE_CHAR)data);
-}
 
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, signed char data)
+Node::set(const signed char *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_SIGNED_CHAR)data);
+    set(signed_char_array(data,DataType::c_signed_char(num_elements,
+                                                       offset,
+                                                       stride,
+                                                       element_bytes,
+                                                       endianness)));
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, unsigned char data)
+Node::set(const unsigned char *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_UNSIGNED_CHAR)data);
+    set(unsigned_char_array(data,DataType::c_unsigned_char(num_elements,
+                                                           offset,
+                                                           stride,
+                                                           element_bytes,
+                                                           endianness)));
 }
 //-----------------------------------------------------------------------------
 #endif // end use char check
@@ -3091,16 +4166,34 @@ Node::set_path(const std::string &path, unsigned char data)
 #ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, short data)
+Node::set(const short *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_SHORT)data);
+    set(short_array(data,DataType::c_short(num_elements,
+                                           offset,
+                                           stride,
+                                           element_bytes,
+                                           endianness)));
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, unsigned short data)
+Node::set(const unsigned short *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_UNSIGNED_SHORT)data);
+    set(unsigned_short_array(data,DataType::c_unsigned_short(num_elements,
+                                                             offset,
+                                                             stride,
+                                                             element_bytes,
+                                                             endianness)));
 }
 //-----------------------------------------------------------------------------
 #endif // end use short check
@@ -3110,16 +4203,34 @@ Node::set_path(const std::string &path, unsigned short data)
 #ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, int data)
+Node::set(const int *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_INT)data);
+    set(int_array(data,DataType::c_int(num_elements,
+                                       offset,
+                                       stride,
+                                       element_bytes,
+                                       endianness)));
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, unsigned int data)
+Node::set(const unsigned int *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_UNSIGNED_INT)data);
+    set(unsigned_int_array(data,DataType::c_unsigned_int(num_elements,
+                                                         offset,
+                                                         stride,
+                                                         element_bytes,
+                                                         endianness)));
 }
 //-----------------------------------------------------------------------------
 #endif // end use int check
@@ -3129,16 +4240,34 @@ Node::set_path(const std::string &path, unsigned int data)
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, long data)
+Node::set(const long *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_LONG)data);
+    set(long_array(data,DataType::c_long(num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness)));
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, unsigned long data)
+Node::set(const unsigned long *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_UNSIGNED_LONG)data);
+    set(unsigned_long_array(data,DataType::c_unsigned_long(num_elements,
+                                                           offset,
+                                                           stride,
+                                                           element_bytes,
+                                                           endianness)));
 }
 //-----------------------------------------------------------------------------
 #endif // end use long check
@@ -3148,16 +4277,35 @@ Node::set_path(const std::string &path, unsigned long data)
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, long long data)
+Node::set(const long long *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_LONG_LONG)data);
+    set(long_array(data,DataType::c_long_long(num_elements,
+                                              offset,
+                                              stride,
+                                              element_bytes,
+                                              endianness)));
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, unsigned long long data)
+Node::set(const unsigned long long *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_UNSIGNED_LONG_LONG)data);
+    set(unsigned_long_long_array(data,
+                                 DataType::c_unsigned_long_long(num_elements,
+                                                                offset,
+                                                                stride,
+                                                                element_bytes,
+                                                                endianness)));
 }
 //-----------------------------------------------------------------------------
 #endif // end use long long check
@@ -3167,9 +4315,18 @@ Node::set_path(const std::string &path, unsigned long long data)
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, float data)
+Node::set(const float *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path,(CONDUIT_NATIVE_FLOAT)data);
+    set(float_array(data,DataType::c_float(num_elements,
+                                           offset,
+                                           stride,
+                                           element_bytes,
+                                           endianness)));
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -3179,560 +4336,628 @@ Node::set_path(const std::string &path, float data)
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path, double data)
+Node::set(const double *data,
+          index_t num_elements,
+          index_t offset,
+          index_t stride,
+          index_t element_bytes,
+          index_t endianness)
 {
-    set_path(path, (CONDUIT_NATIVE_DOUBLE)data);
-}
-//-----------------------------------------------------------------------------
+    set(double_array(data,DataType::c_double(num_elements,
+                                             offset,
+                                             stride,
+                                             element_bytes,
+                                             endianness)));
+}
+//-----------------------------------------------------------------------------
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node set methods --
+//
+//-----------------------------------------------------------------------------
+
 
 //-----------------------------------------------------------------------------
-// -- set_path for conduit::DataArray types ---
+//
+// -- begin definition of Node set_path methods --
+//
 //-----------------------------------------------------------------------------
 
+
 //-----------------------------------------------------------------------------
-// signed integer array types via conduit::DataArray
+// -- set_path for generic types --
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int8_array(const std::string &path,
-                          const int8_array &data)
+Node::set_path_node(const std::string &path,
+                    const Node& data)
 {
-    fetch(path).set_int8_array(data);
+    fetch(path).set_node(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int8_array &data)
+               const Node& data)
 {
-    set_path_int8_array(path,data);
+    set_path_node(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int16_array(const std::string &path,
-                           const int16_array &data)
+Node::set_path_dtype(const std::string &path,
+                     const DataType& dtype)
 {
-    fetch(path).set_int16_array(data);
+    fetch(path).set_dtype(dtype);
 }
 
+
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int16_array &data)
+               const DataType& dtype)
 {
-    set_path_int16_array(path,data);
+    set_path_dtype(path,dtype);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int32_array(const std::string &path,
-                           const int32_array &data)
+Node::set_path_schema(const std::string &path,
+                      const Schema &schema)
 {
-    fetch(path).set_int32_array(data);
+    fetch(path).set_schema(schema);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int32_array &data)
+               const Schema &schema)
 {
-    set_path_int32_array(path,data);
+    set_path_schema(path,schema);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int64_array(const std::string &path,
-                           const int64_array &data)
+Node::set_path_data_using_schema(const std::string &path,
+                                 const Schema &schema,
+                                 void *data)
 {
-    fetch(path).set_int64_array(data);
+    fetch(path).set_data_using_schema(schema,data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int64_array &data)
+               const Schema &schema,
+               void *data)
 {
-    set_path_int64_array(path,data);
+    set_path_data_using_schema(path,schema,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_data_using_dtype(const std::string &path,
+                                const DataType &dtype,
+                                void *data)
+{
+    fetch(path).set_data_using_dtype(dtype,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path(const std::string &path,
+               const DataType &dtype,
+               void *data)
+{
+    set_path_data_using_dtype(path,dtype,data);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer array types via conduit::DataArray
+// -- set_path for scalar types ---
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// signed integer scalar types
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint8_array(const std::string &path,
-                           const uint8_array &data)
+Node::set_path_int8(const std::string &path,
+                    int8 data)
 {
-    fetch(path).set_uint8_array(data);
+    fetch(path).set_int8(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const uint8_array &data)
+               int8 data)
 {
-    set_path_uint8_array(path,data);
+    set_path_int8(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint16_array(const std::string &path,
-                            const uint16_array &data)
+Node::set_path_int16(const std::string &path,
+                     int16 data)
 {
-    fetch(path).set_uint16_array(data);
+    fetch(path).set_int16(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const uint16_array &data)
+               int16 data)
 {
-    set_path_uint16_array(path,data);
+    set_path_int16(path,data);
 }
 
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint32_array(const std::string &path,
-                            const uint32_array &data)
+Node::set_path_int32(const std::string &path,
+                     int32 data)
 {
-    fetch(path).set_uint32_array(data);
+    fetch(path).set_int32(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const uint32_array &data)
+               int32 data)
 {
-    set_path_uint32_array(path,data);
+    set_path_int32(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint64_array(const std::string &path,
-                            const uint64_array &data)
+Node::set_path_int64(const std::string &path,
+                     int64 data)
 {
-    fetch(path).set_uint64_array(data);
+    fetch(path).set_int64(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const uint64_array &data)
+               int64 data)
 {
-    set_path_uint64_array(path,data);
+    fetch(path).set(data);
 }
 
 //-----------------------------------------------------------------------------
-// floating point array types via conduit::DataArray
+// unsigned integer scalar types
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_float32_array(const std::string &path,
-                             const float32_array &data)
+Node::set_path_uint8(const std::string &path,
+                     uint8 data)
 {
-    fetch(path).set_float32_array(data);
+    fetch(path).set_uint8(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const float32_array &data)
+               uint8 data)
 {
-    set_path_float32_array(path,data);
+    set_path_uint8(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_float64_array(const std::string &path,
-                             const float64_array &data)
+Node::set_path_uint16(const std::string &path,
+                      uint16 data)
 {
-    fetch(path).set_float64_array(data);
+    fetch(path).set_uint16(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const float64_array &data)
+               uint16 data)
 {
-    set_path_float64_array(path,data);
+    set_path_uint16(path,data);
 }
 
-//-----------------------------------------------------------------------------
-// set_path array gap methods for c-native types
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
+void
+Node::set_path_uint32(const std::string &path,
+                      uint32 data)
+{
+    fetch(path).set_uint32(data);
+}
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const char_array &data)
+               uint32 data)
 {
-    fetch(path).set(data);
+    set_path_uint32(path,data);
 }
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const signed_char_array &data)
+Node::set_path_uint64(const std::string &path,
+                      uint64 data)
 {
-    fetch(path).set(data);
+    fetch(path).set_uint64(data);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const unsigned_char_array &data)
+               uint64 data)
 {
-    fetch(path).set(data);
+    set_path_uint64(path,data);
 }
-//-----------------------------------------------------------------------------
-#endif // end use char check
-//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
+// floating point scalar types
 //-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const short_array &data)
+Node::set_path_float32(const std::string &path,
+                       float32 data)
 {
-    fetch(path).set(data);
+    fetch(path).set_float32(data);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const unsigned_short_array &data)
+               float32 data)
 {
-    fetch(path).set(data);
+    set_path_float32(path,data);
 }
-//-----------------------------------------------------------------------------
-#endif // end use short check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_INT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const int_array &data)
+Node::set_path_float64(const std::string &path,
+                       float64 data)
 {
-    fetch(path).set(data);
+    fetch(path).set_float64(data);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const unsigned_int_array &data)
+               float64 data)
 {
-    fetch(path).set(data);
+    set_path_float64(path,data);
 }
+
 //-----------------------------------------------------------------------------
-#endif // end use int check
+// set_path gap methods for c-native types
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_LONG
+void
+Node::set_path(const std::string &path, char data)
+{
+    set_path(path,(CONDUIT_NATIVE_CHAR)data);
+}
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path,
-               const long_array &data)
+Node::set_path(const std::string &path, signed char data)
 {
-    fetch(path).set(data);
+    set_path(path,(CONDUIT_NATIVE_SIGNED_CHAR)data);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path,
-               const unsigned_long_array &data)
+Node::set_path(const std::string &path, unsigned char data)
 {
-    fetch(path).set(data);
+    set_path(path,(CONDUIT_NATIVE_UNSIGNED_CHAR)data);
 }
 //-----------------------------------------------------------------------------
-#endif // end use long check
+#endif // end use char check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
+#ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path,
-               const long_long_array &data)
+Node::set_path(const std::string &path, short data)
 {
-    fetch(path).set(data);
+    set_path(path,(CONDUIT_NATIVE_SHORT)data);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path,
-               const unsigned_long_long_array &data)
+Node::set_path(const std::string &path, unsigned short data)
 {
-    fetch(path).set(data);
+    set_path(path,(CONDUIT_NATIVE_UNSIGNED_SHORT)data);
 }
 //-----------------------------------------------------------------------------
-#endif // end use long long check
+#endif // end use short check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_FLOAT
+#ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path,
-               const float_array &data)
+Node::set_path(const std::string &path, int data)
 {
-    fetch(path).set(data);
+    set_path(path,(CONDUIT_NATIVE_INT)data);
 }
+
 //-----------------------------------------------------------------------------
-#endif // end use float check
+void
+Node::set_path(const std::string &path, unsigned int data)
+{
+    set_path(path,(CONDUIT_NATIVE_UNSIGNED_INT)data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use int check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_DOUBLE
+#ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path,
-               const double_array &data)
+Node::set_path(const std::string &path, long data)
 {
-    fetch(path).set(data);
+    set_path(path,(CONDUIT_NATIVE_LONG)data);
 }
+
 //-----------------------------------------------------------------------------
-#endif // end use double check
+void
+Node::set_path(const std::string &path, unsigned long data)
+{
+    set_path(path,(CONDUIT_NATIVE_UNSIGNED_LONG)data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use long check
 //-----------------------------------------------------------------------------
-
-
 
 //-----------------------------------------------------------------------------
-// -- set_path for string types --
+#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
+void
+Node::set_path(const std::string &path, long long data)
+{
+    set_path(path,(CONDUIT_NATIVE_LONG_LONG)data);
+}
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set_path_string(const std::string &path,
-                      const std::string &data)
+Node::set_path(const std::string &path, unsigned long long data)
 {
-    fetch(path).set_string(data);
+    set_path(path,(CONDUIT_NATIVE_UNSIGNED_LONG_LONG)data);
 }
+//-----------------------------------------------------------------------------
+#endif // end use long long check
+//-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_FLOAT
+//-----------------------------------------------------------------------------
 void
-Node::set_path(const std::string &path,
-               const std::string &data)
+Node::set_path(const std::string &path, float data)
 {
-    set_path_string(path,data);
+    set_path(path,(CONDUIT_NATIVE_FLOAT)data);
 }
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#endif // end use float check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_DOUBLE
+//-----------------------------------------------------------------------------
 void
-Node::set_path_char8_str(const std::string &path,
-                         const char* data)
+Node::set_path(const std::string &path, double data)
 {
-    fetch(path).set_char8_str(data);
+    set_path(path, (CONDUIT_NATIVE_DOUBLE)data);
 }
+//-----------------------------------------------------------------------------
+#endif // end use double check
+//-----------------------------------------------------------------------------
 
 
 //-----------------------------------------------------------------------------
-// -- set_path for std::vector types ---
+// -- set_path for conduit::DataArray types ---
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer array types via std::vector
+// signed integer array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int8_vector(const std::string &path,
-                           const std::vector<int8> &data)
+Node::set_path_int8_array(const std::string &path,
+                          const int8_array &data)
 {
-    fetch(path).set_int8_vector(data);
+    fetch(path).set_int8_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<int8> &data)
+               const int8_array &data)
 {
-    set_path_int8_vector(path,data);
+    set_path_int8_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int16_vector(const std::string &path,
-                            const std::vector<int16> &data)
+Node::set_path_int16_array(const std::string &path,
+                           const int16_array &data)
 {
-    fetch(path).set_int16_vector(data);
+    fetch(path).set_int16_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<int16> &data)
+               const int16_array &data)
 {
-    set_path_int16_vector(path,data);
+    set_path_int16_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int32_vector(const std::string &path,
-                            const std::vector<int32> &data)
+Node::set_path_int32_array(const std::string &path,
+                           const int32_array &data)
 {
-    fetch(path).set_int32_vector(data);
+    fetch(path).set_int32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<int32> &data)
+               const int32_array &data)
 {
-    set_path_int32_vector(path,data);
+    set_path_int32_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int64_vector(const std::string &path,
-                            const std::vector<int64> &data)
+Node::set_path_int64_array(const std::string &path,
+                           const int64_array &data)
 {
-    fetch(path).set_int64_vector(data);
+    fetch(path).set_int64_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<int64> &data)
+               const int64_array &data)
 {
-    set_path_int64_vector(path,data);
+    set_path_int64_array(path,data);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer array types via std::vector
+// unsigned integer array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint8_vector(const std::string &path,
-                            const std::vector<uint8> &data)
+Node::set_path_uint8_array(const std::string &path,
+                           const uint8_array &data)
 {
-    fetch(path).set_uint8_vector(data);
+    fetch(path).set_uint8_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<uint8> &data)
+               const uint8_array &data)
 {
-    set_path_uint8_vector(path,data);
+    set_path_uint8_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint16_vector(const std::string &path,
-                             const std::vector<uint16> &data)
+Node::set_path_uint16_array(const std::string &path,
+                            const uint16_array &data)
 {
-    fetch(path).set_uint16_vector(data);
+    fetch(path).set_uint16_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<uint16>  &data)
+               const uint16_array &data)
 {
-    set_path_uint16_vector(path,data);
+    set_path_uint16_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint32_vector(const std::string &path,
-                             const std::vector<uint32> &data)
+Node::set_path_uint32_array(const std::string &path,
+                            const uint32_array &data)
 {
-    fetch(path).set_uint32_vector(data);
+    fetch(path).set_uint32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<uint32>  &data)
+               const uint32_array &data)
 {
-    set_path_uint32_vector(path,data);
+    set_path_uint32_array(path,data);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint64_vector(const std::string &path,
-                             const std::vector<uint64> &data)
+Node::set_path_uint64_array(const std::string &path,
+                            const uint64_array &data)
 {
-    fetch(path).set_uint64_vector(data);
+    fetch(path).set_uint64_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const std::vector<uint64>  &data)
+               const uint64_array &data)
 {
-    set_path_uint64_vector(path,data);
+    set_path_uint64_array(path,data);
 }
 
 //-----------------------------------------------------------------------------
-// floating point array types via std::vector
+// floating point array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_float32_vector(const std::string &path,
-                              const std::vector<float32> &data)
+Node::set_path_float32_array(const std::string &path,
+                             const float32_array &data)
 {
-    fetch(path).set_float32_vector(data);
+    fetch(path).set_float32_array(data);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,const std::vector<float32> &data)
+Node::set_path(const std::string &path,
+               const float32_array &data)
 {
-    set_path_float32_vector(path,data);
+    set_path_float32_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_float64_vector(const std::string &path,
-                              const std::vector<float64> &data)
+Node::set_path_float64_array(const std::string &path,
+                             const float64_array &data)
 {
-    fetch(path).set_float64_vector(data);
+    fetch(path).set_float64_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,const std::vector<float64> &data)
+Node::set_path(const std::string &path,
+               const float64_array &data)
 {
-    set_path_float64_vector(path,data);
+    set_path_float64_array(path,data);
 }
 
-
 //-----------------------------------------------------------------------------
-// set_path vector gap methods for c-native types
+// set_path array gap methods for c-native types
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<char> &data)
+               const char_array &data)
 {
     fetch(path).set(data);
 }
 
-
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector(<signed char> &data)
+               const signed_char_array &data)
 {
     fetch(path).set(data);
 }
@@ -3740,7 +4965,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<unsigned char> &data)
+               const unsigned_char_array &data)
 {
     fetch(path).set(data);
 }
@@ -3753,7 +4978,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<short> &data)
+               const short_array &data)
 {
     fetch(path).set(data);
 }
@@ -3761,7 +4986,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<unsigned short> &data)
+               const unsigned_short_array &data)
 {
     fetch(path).set(data);
 }
@@ -3774,7 +4999,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<int> &data)
+               const int_array &data)
 {
     fetch(path).set(data);
 }
@@ -3782,7 +5007,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<unsigned int> &data)
+               const unsigned_int_array &data)
 {
     fetch(path).set(data);
 }
@@ -3795,7 +5020,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<long> &data)
+               const long_array &data)
 {
     fetch(path).set(data);
 }
@@ -3803,7 +5028,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<unsigned long> &data)
+               const unsigned_long_array &data)
 {
     fetch(path).set(data);
 }
@@ -3816,7 +5041,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<long long> &data)
+               const long_long_array &data)
 {
     fetch(path).set(data);
 }
@@ -3824,7 +5049,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<unsigned long long> &data)
+               const unsigned_long_long_array &data)
 {
     fetch(path).set(data);
 }
@@ -3837,7 +5062,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<float> &data)
+               const float_array &data)
 {
     fetch(path).set(data);
 }
@@ -3850,7 +5075,7 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const std::vector<double> &data)
+               const double_array &data)
 {
     fetch(path).set(data);
 }
@@ -3859,447 +5084,241 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 
 
-//-----------------------------------------------------------------------------
-// -- set_path via pointers (scalar and array types) --
-//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer pointer cases
+// -- set_path for string types --
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int8_ptr(const std::string &path,
-                        const int8 *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_path_string(const std::string &path,
+                      const std::string &data)
 {
-    fetch(path).set_int8_ptr(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    fetch(path).set_string(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int8 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::string &data)
 {
-    set_path_int8_ptr(path,
-                      data,
-                      num_elements,
-                      offset,
-                      stride,
-                      element_bytes,
-                      endianness);
+    set_path_string(path,data);
 }
+//---------------------------------------------------------------------------//
+void
+Node::set_path_char8_str(const std::string &path,
+                         const char* data)
+{
+    fetch(path).set_char8_str(data);
+}
+
+
+//-----------------------------------------------------------------------------
+// -- set_path for std::vector types ---
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// signed integer array types via std::vector
+//-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int16_ptr(const std::string &path,
-                         const int16 *data,
-                         index_t num_elements,
-                         index_t offset,
-                         index_t stride,
-                         index_t element_bytes,
-                         index_t endianness)
+Node::set_path_int8_vector(const std::string &path,
+                           const std::vector<int8> &data)
 {
-    fetch(path).set_int16_ptr(data,
-                              num_elements,
-                              offset,
-                              stride,
-                              element_bytes,
-                              endianness);
+    fetch(path).set_int8_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int16 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<int8> &data)
 {
-    set_path_int16_ptr(path,
-                       data,
-                       num_elements,
-                       offset,
-                       stride,
-                       element_bytes,
-                       endianness);
+    set_path_int8_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int32_ptr(const std::string &path,
-                         const int32 *data,
-                         index_t num_elements,
-                         index_t offset,
-                         index_t stride,
-                         index_t element_bytes,
-                         index_t endianness)
+Node::set_path_int16_vector(const std::string &path,
+                            const std::vector<int16> &data)
 {
-    fetch(path).set_int32_ptr(data,
-                              num_elements,
-                              offset,
-                              stride,
-                              element_bytes,
-                              endianness);
+    fetch(path).set_int16_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int32 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<int16> &data)
 {
-    set_path_int32_ptr(path,
-                       data,
-                       num_elements,
-                       offset,
-                       stride,
-                       element_bytes,
-                       endianness);
+    set_path_int16_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_int64_ptr(const std::string &path,
-                         const int64 *data,
-                         index_t num_elements,
-                         index_t offset,
-                         index_t stride,
-                         index_t element_bytes,
-                         index_t endianness)
+Node::set_path_int32_vector(const std::string &path,
+                            const std::vector<int32> &data)
 {
-    fetch(path).set_int64_ptr(data,
-                              num_elements,
-                              offset,
-                              stride,
-                              element_bytes,
-                              endianness);
+    fetch(path).set_int32_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const int64 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<int32> &data)
 {
-    set_path_int64_ptr(path,
-                       data,
-                       num_elements,
-                       offset,
-                       stride,
-                       element_bytes,
-                       endianness);
+    set_path_int32_vector(path,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_int64_vector(const std::string &path,
+                            const std::vector<int64> &data)
+{
+    fetch(path).set_int64_vector(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path(const std::string &path,
+               const std::vector<int64> &data)
+{
+    set_path_int64_vector(path,data);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer pointer cases
+// unsigned integer array types via std::vector
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const uint8 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+Node::set_path_uint8_vector(const std::string &path,
+                            const std::vector<uint8> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set_uint8_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint8_ptr(const std::string &path,
-                         const uint8  *data,
-                         index_t num_elements,
-                         index_t offset,
-                         index_t stride,
-                         index_t element_bytes,
-                         index_t endianness)
+Node::set_path(const std::string &path,
+               const std::vector<uint8> &data)
 {
-    fetch(path).set_uint8_ptr(data,
-                              num_elements,
-                              offset,
-                              stride,
-                              element_bytes,
-                              endianness);
+    set_path_uint8_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint16_ptr(const std::string &path,
-                          const uint16 *data,
-                          index_t num_elements,
-                          index_t offset,
-                          index_t stride,
-                          index_t element_bytes,
-                          index_t endianness)
+Node::set_path_uint16_vector(const std::string &path,
+                             const std::vector<uint16> &data)
 {
-    fetch(path).set_uint16_ptr(data,
-                               num_elements,
-                               offset,
-                               stride,
-                               element_bytes,
-                               endianness);
+    fetch(path).set_uint16_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const uint16 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<uint16>  &data)
 {
-    set_path_uint16_ptr(path,
-                        data,
-                        num_elements,
-                        offset,
-                        stride,
-                        element_bytes,
-                        endianness);
+    set_path_uint16_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint32_ptr(const std::string &path,
-                          const uint32 *data,
-                          index_t num_elements,
-                          index_t offset,
-                          index_t stride,
-                          index_t element_bytes,
-                          index_t endianness)
+Node::set_path_uint32_vector(const std::string &path,
+                             const std::vector<uint32> &data)
 {
-    fetch(path).set_uint32_ptr(data,
-                               num_elements,
-                               offset,
-                               stride,
-                               element_bytes,
-                               endianness);
+    fetch(path).set_uint32_vector(data);
 }
+
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const uint32 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<uint32>  &data)
 {
-    set_path_uint32_ptr(path,
-                        data,
-                        num_elements,
-                        offset,
-                        stride,
-                        element_bytes,
-                        endianness);
+    set_path_uint32_vector(path,data);
 }
 
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path_uint64_ptr(const std::string &path,
-                          const uint64 *data,
-                          index_t num_elements,
-                          index_t offset,
-                          index_t stride,
-                          index_t element_bytes,
-                          index_t endianness)
+Node::set_path_uint64_vector(const std::string &path,
+                             const std::vector<uint64> &data)
 {
-    fetch(path).set_uint64_ptr(data,
-                               num_elements,
-                               offset,
-                               stride,
-                               element_bytes,
-                               endianness);
+    fetch(path).set_uint64_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path(const std::string &path,
-               const uint64 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<uint64>  &data)
 {
-    set_path_uint64_ptr(path,
-                        data,
-                        num_elements,
-                        offset,
-                        stride,
-                        element_bytes,
-                        endianness);
+    set_path_uint64_vector(path,data);
 }
 
 //-----------------------------------------------------------------------------
-// floating point integer pointer cases
+// floating point array types via std::vector
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_float32_ptr(const std::string &path,
-                           const float32 *data,
-                           index_t num_elements,
-                           index_t offset,
-                           index_t stride,
-                           index_t element_bytes,
-                           index_t endianness)
+Node::set_path_float32_vector(const std::string &path,
+                              const std::vector<float32> &data)
 {
-    fetch(path).set_float32_ptr(data,
-                                num_elements,
-                                offset,
-                                stride,
-                                element_bytes,
-                                endianness);
+    fetch(path).set_float32_vector(data);
 }
 
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const float32 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+Node::set_path(const std::string &path,const std::vector<float32> &data)
 {
-    set_path_float32_ptr(path,
-                         data,
-                         num_elements,
-                         offset,
-                         stride,
-                         element_bytes,
-                         endianness);
+    set_path_float32_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_float64_ptr(const std::string &path,
-                           const float64 *data,
-                           index_t num_elements,
-                           index_t offset,
-                           index_t stride,
-                           index_t element_bytes,
-                           index_t endianness)
+Node::set_path_float64_vector(const std::string &path,
+                              const std::vector<float64> &data)
 {
-    fetch(path).set_float64_ptr(data,
-                                num_elements,
-                                offset,
-                                stride,
-                                element_bytes,
-                                endianness);
+    fetch(path).set_float64_vector(data);
 }
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path(const std::string &path,
-               const float64 *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+Node::set_path(const std::string &path,const std::vector<float64> &data)
 {
-    set_path_float64_ptr(path,
-                         data,
-                         num_elements,
-                         offset,
-                         stride,
-                         element_bytes,
-                         endianness);
+    set_path_float64_vector(path,data);
 }
 
+
 //-----------------------------------------------------------------------------
-// set_path pointer gap methods for c-native types
+// set_path vector gap methods for c-native types
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path_char_ptr(const std::string &path,
-                        const char *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_path(const std::string &path,
+               const std::vector<char> &data)
 {
-    fetch(path).set_char_ptr(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    fetch(path).set(data);
 }
 
+
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const signed char *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector(<signed char> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const unsigned char *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<unsigned char> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use char check
@@ -4310,37 +5329,17 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const short *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<short> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const unsigned short *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<unsigned short> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use short check
@@ -4351,37 +5350,17 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const int *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<int> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const unsigned int *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<unsigned int> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use int check
@@ -4392,37 +5371,17 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const long *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<long> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const unsigned long *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<unsigned long> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long check
@@ -4433,37 +5392,17 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const long long *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<long long> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const unsigned long long *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<unsigned long long> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long long check
@@ -4474,19 +5413,9 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const float *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<float> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -4497,19 +5426,9 @@ Node::set_path(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path(const std::string &path,
-               const double *data,
-               index_t num_elements,
-               index_t offset,
-               index_t stride,
-               index_t element_bytes,
-               index_t endianness)
+               const std::vector<double> &data)
 {
-    fetch(path).set(data,
-                    num_elements,
-                    offset,
-                    stride,
-                    element_bytes,
-                    endianness);
+    fetch(path).set(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
@@ -4517,667 +5436,610 @@ Node::set_path(const std::string &path,
 
 
 //-----------------------------------------------------------------------------
-//
-// -- end definition of Node set_path methods --
-//
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-//
-// -- begin definition of Node set_external methods --
-//
+// -- set_path via pointers (scalar and array types) --
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// -- set_external for generic types --
+// signed integer pointer cases
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_node(const Node &node)
+Node::set_path_int8_ptr(const std::string &path,
+                        const int8 *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    reset();
-    m_schema->set(node.schema());
-    mirror_node(this,m_schema,&node);
+    fetch(path).set_int8_ptr(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const Node &node)
+Node::set_path(const std::string &path,
+               const int8 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_node(node);
+    set_path_int8_ptr(path,
+                      data,
+                      num_elements,
+                      offset,
+                      stride,
+                      element_bytes,
+                      endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_data_using_schema(const Schema &schema,
-                                     void *data)
+Node::set_path_int16_ptr(const std::string &path,
+                         const int16 *data,
+                         index_t num_elements,
+                         index_t offset,
+                         index_t stride,
+                         index_t element_bytes,
+                         index_t endianness)
 {
-    reset();
-    m_schema->set(schema);
-    walk_schema(this,m_schema,data,m_allocator_id);
+    fetch(path).set_int16_ptr(data,
+                              num_elements,
+                              offset,
+                              stride,
+                              element_bytes,
+                              endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const Schema &schema,
-                   void *data)
+Node::set_path(const std::string &path,
+               const int16 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_data_using_schema(schema,data);
+    set_path_int16_ptr(path,
+                       data,
+                       num_elements,
+                       offset,
+                       stride,
+                       element_bytes,
+                       endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_data_using_dtype(const DataType &dtype,
-                                    void *data)
+Node::set_path_int32_ptr(const std::string &path,
+                         const int32 *data,
+                         index_t num_elements,
+                         index_t offset,
+                         index_t stride,
+                         index_t element_bytes,
+                         index_t endianness)
 {
-    reset();
-    m_data    = data;
-    m_schema->set(dtype);
+    fetch(path).set_int32_ptr(data,
+                              num_elements,
+                              offset,
+                              stride,
+                              element_bytes,
+                              endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const DataType &dtype,
-                   void *data)
+Node::set_path(const std::string &path,
+               const int32 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_data_using_dtype(dtype,data);
+    set_path_int32_ptr(path,
+                       data,
+                       num_elements,
+                       offset,
+                       stride,
+                       element_bytes,
+                       endianness);
 }
 
-//-----------------------------------------------------------------------------
-// -- set_external via pointers (scalar and array types) --
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-// signed integer pointer cases
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int8_ptr(int8 *data,
-                            index_t num_elements,
-                            index_t offset,
-                            index_t stride,
-                            index_t element_bytes,
-                            index_t endianness)
+Node::set_path_int64_ptr(const std::string &path,
+                         const int64 *data,
+                         index_t num_elements,
+                         index_t offset,
+                         index_t stride,
+                         index_t element_bytes,
+                         index_t endianness)
 {
-    release();
-    m_schema->set(DataType::int8(num_elements,
-                                 offset,
-                                 stride,
-                                 element_bytes,
-                                 endianness));
-    m_data  = data;
+    fetch(path).set_int64_ptr(data,
+                              num_elements,
+                              offset,
+                              stride,
+                              element_bytes,
+                              endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(int8 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const int64 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_int8_ptr(data,
-                          num_elements,
-                          offset,
-                          stride,
-                          element_bytes,
-                          endianness);
+    set_path_int64_ptr(path,
+                       data,
+                       num_elements,
+                       offset,
+                       stride,
+                       element_bytes,
+                       endianness);
 }
 
+//-----------------------------------------------------------------------------
+// unsigned integer pointer cases
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int16_ptr(int16 *data,
-                             index_t num_elements,
-                             index_t offset,
-                             index_t stride,
-                             index_t element_bytes,
-                             index_t endianness)
+Node::set_path(const std::string &path,
+               const uint8 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::int16(num_elements,
-                                  offset,
-                                  stride,
-                                  element_bytes,
-                                  endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(int16 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path_uint8_ptr(const std::string &path,
+                         const uint8  *data,
+                         index_t num_elements,
+                         index_t offset,
+                         index_t stride,
+                         index_t element_bytes,
+                         index_t endianness)
 {
-    set_external_int16_ptr(data,
-                           num_elements,
-                           offset,
-                           stride,
-                           element_bytes,
-                           endianness);
+    fetch(path).set_uint8_ptr(data,
+                              num_elements,
+                              offset,
+                              stride,
+                              element_bytes,
+                              endianness);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int32_ptr(int32 *data,
-                             index_t num_elements,
-                             index_t offset,
-                             index_t stride,
-                             index_t element_bytes,
-                             index_t endianness)
+Node::set_path_uint16_ptr(const std::string &path,
+                          const uint16 *data,
+                          index_t num_elements,
+                          index_t offset,
+                          index_t stride,
+                          index_t element_bytes,
+                          index_t endianness)
 {
-    release();
-    m_schema->set(DataType::int32(num_elements,
-                                  offset,
-                                  stride,
-                                  element_bytes,
-                                  endianness));
-    m_data  = data;
+    fetch(path).set_uint16_ptr(data,
+                               num_elements,
+                               offset,
+                               stride,
+                               element_bytes,
+                               endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(int32 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const uint16 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_int32_ptr(data,
-                           num_elements,
-                           offset,
-                           stride,
-                           element_bytes,
-                           endianness);
+    set_path_uint16_ptr(path,
+                        data,
+                        num_elements,
+                        offset,
+                        stride,
+                        element_bytes,
+                        endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int64_ptr(int64 *data,
-                             index_t num_elements,
-                             index_t offset,
-                             index_t stride,
-                             index_t element_bytes,
-                             index_t endianness)
+Node::set_path_uint32_ptr(const std::string &path,
+                          const uint32 *data,
+                          index_t num_elements,
+                          index_t offset,
+                          index_t stride,
+                          index_t element_bytes,
+                          index_t endianness)
 {
-    release();
-    m_schema->set(DataType::int64(num_elements,
-                                  offset,
-                                  stride,
-                                  element_bytes,
-                                  endianness));
-    m_data  = data;
+    fetch(path).set_uint32_ptr(data,
+                               num_elements,
+                               offset,
+                               stride,
+                               element_bytes,
+                               endianness);
 }
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external(int64 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const uint32 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_int64_ptr(data,
-                           num_elements,
-                           offset,
-                           stride,
-                           element_bytes,
-                           endianness);
+    set_path_uint32_ptr(path,
+                        data,
+                        num_elements,
+                        offset,
+                        stride,
+                        element_bytes,
+                        endianness);
 }
 
-
-//-----------------------------------------------------------------------------
-// unsigned integer pointer cases
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint8_ptr(uint8 *data,
-                             index_t num_elements,
-                             index_t offset,
-                             index_t stride,
-                             index_t element_bytes,
-                             index_t endianness)
+Node::set_path_uint64_ptr(const std::string &path,
+                          const uint64 *data,
+                          index_t num_elements,
+                          index_t offset,
+                          index_t stride,
+                          index_t element_bytes,
+                          index_t endianness)
 {
-    release();
-    m_schema->set(DataType::uint8(num_elements,
-                                          offset,
-                                          stride,
-                                          element_bytes,
-                                          endianness));
-    m_data  = data;
+    fetch(path).set_uint64_ptr(data,
+                               num_elements,
+                               offset,
+                               stride,
+                               element_bytes,
+                               endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(uint8 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const uint64 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_uint8_ptr(data,
-                           num_elements,
-                           offset,
-                           stride,
-                           element_bytes,
-                           endianness);
+    set_path_uint64_ptr(path,
+                        data,
+                        num_elements,
+                        offset,
+                        stride,
+                        element_bytes,
+                        endianness);
 }
 
-
+//-----------------------------------------------------------------------------
+// floating point integer pointer cases
+//-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint16_ptr(uint16 *data,
-                              index_t num_elements,
-                              index_t offset,
-                              index_t stride,
-                              index_t element_bytes,
-                              index_t endianness)
+Node::set_path_float32_ptr(const std::string &path,
+                           const float32 *data,
+                           index_t num_elements,
+                           index_t offset,
+                           index_t stride,
+                           index_t element_bytes,
+                           index_t endianness)
 {
-    release();
-    m_schema->set(DataType::uint16(num_elements,
-                                           offset,
-                                           stride,
-                                           element_bytes,
-                                           endianness));
-    m_data  = data;
+    fetch(path).set_float32_ptr(data,
+                                num_elements,
+                                offset,
+                                stride,
+                                element_bytes,
+                                endianness);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external(uint16 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const float32 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_uint16_ptr(data,
-                            num_elements,
-                            offset,
-                            stride,
-                            element_bytes,
-                            endianness);
+    set_path_float32_ptr(path,
+                         data,
+                         num_elements,
+                         offset,
+                         stride,
+                         element_bytes,
+                         endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint32_ptr(uint32 *data,
-                             index_t num_elements,
-                             index_t offset,
-                             index_t stride,
-                             index_t element_bytes,
-                             index_t endianness)
+Node::set_path_float64_ptr(const std::string &path,
+                           const float64 *data,
+                           index_t num_elements,
+                           index_t offset,
+                           index_t stride,
+                           index_t element_bytes,
+                           index_t endianness)
 {
-    release();
-    m_schema->set(DataType::uint32(num_elements,
-                                   offset,
-                                   stride,
-                                   element_bytes,
-                                   endianness));
-    m_data  = data;
+    fetch(path).set_float64_ptr(data,
+                                num_elements,
+                                offset,
+                                stride,
+                                element_bytes,
+                                endianness);
 }
-
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external(uint32 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const float64 *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_uint32_ptr(data,
-                            num_elements,
-                            offset,
-                            stride,
-                            element_bytes,
-                            endianness);
+    set_path_float64_ptr(path,
+                         data,
+                         num_elements,
+                         offset,
+                         stride,
+                         element_bytes,
+                         endianness);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+// set_path pointer gap methods for c-native types
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
 void
-Node::set_external_uint64_ptr(uint64 *data,
-                              index_t num_elements,
-                              index_t offset,
-                              index_t stride,
-                              index_t element_bytes,
-                              index_t endianness)
+Node::set_path_char_ptr(const std::string &path,
+                        const char *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    release();
-    m_schema->set(DataType::uint64(num_elements,
-                                   offset,
-                                   stride,
-                                   element_bytes,
-                                   endianness));
-    m_data  = data;
+    fetch(path).set_char_ptr(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 
-
-//---------------------------------------------------------------------------//
-void
-Node::set_external(uint64 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
-{
-    set_external_uint64_ptr(data,
-                            num_elements,
-                            offset,
-                            stride,
-                            element_bytes,
-                            endianness);
-}
 //-----------------------------------------------------------------------------
-// floating point pointer cases
+#ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------//
 void
-Node::set_external_float32_ptr(float32 *data,
-                               index_t num_elements,
-                               index_t offset,
-                               index_t stride,
-                               index_t element_bytes,
-                               index_t endianness)
+Node::set_path(const std::string &path,
+               const signed char *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::float32(num_elements,
-                                    offset,
-                                    stride,
-                                    element_bytes,
-                                    endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set_external(float32 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const unsigned char *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_float32_ptr(data,
-                            num_elements,
-                            offset,
-                            stride,
-                            element_bytes,
-                            endianness);
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
+//-----------------------------------------------------------------------------
+#endif // end use char check
+//-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_SHORT
+//-----------------------------------------------------------------------------
 void
-Node::set_external_float64_ptr(float64 *data,
-                               index_t num_elements,
-                               index_t offset,
-                               index_t stride,
-                               index_t element_bytes,
-                               index_t endianness)
+Node::set_path(const std::string &path,
+               const short *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::float64(num_elements,
-                                    offset,
-                                    stride,
-                                    element_bytes,
-                                    endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set_external(float64 *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const unsigned short *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    set_external_float64_ptr(data,
-                            num_elements,
-                            offset,
-                            stride,
-                            element_bytes,
-                            endianness);
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
-
 //-----------------------------------------------------------------------------
-// set pointer gap methods for c-native types
+#endif // end use short check
 //-----------------------------------------------------------------------------
-void
-Node::set_external_char_ptr(char *data,
-                            index_t num_elements,
-                            index_t offset,
-                            index_t stride,
-                            index_t element_bytes,
-                            index_t endianness)
-{
-    release();
-    m_schema->set(DataType::c_char(num_elements,
-                                   offset,
-                                   stride,
-                                   element_bytes,
-                                   endianness));
-    m_data  = data;
-}
-
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
+#ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set_external(signed char *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const int *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_signed_char(num_elements,
-                                          offset,
-                                          stride,
-                                          element_bytes,
-                                          endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(unsigned char *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const unsigned int *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_unsigned_char(num_elements,
-                                            offset,
-                                            stride,
-                                            element_bytes,
-                                            endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 //-----------------------------------------------------------------------------
-#endif // end use char check
+#endif // end use int check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
+#ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set_external(short *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const long *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_short(num_elements,
-                                    offset,
-                                    stride,
-                                    element_bytes,
-                                    endianness));
-    m_data  = data;
-}
-
-//-----------------------------------------------------------------------------
-void
-Node::set_external(unsigned short *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
-{
-    release();
-    m_schema->set(DataType::c_unsigned_short(num_elements,
-                                             offset,
-                                             stride,
-                                             element_bytes,
-                                             endianness));
-    m_data  = data;
-}
-//-----------------------------------------------------------------------------
-#endif // end use short check
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_INT
-//-----------------------------------------------------------------------------
-void
-Node::set_external(int *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
-{
-    release();
-    m_schema->set(DataType::c_int(num_elements,
-                                  offset,
-                                  stride,
-                                  element_bytes,
-                                  endianness));
-    m_data  = data;
-}
-
-//-----------------------------------------------------------------------------
-void
-Node::set_external(unsigned int *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
-{
-    release();
-    m_schema->set(DataType::c_unsigned_int(num_elements,
-                                           offset,
-                                           stride,
-                                           element_bytes,
-                                           endianness));
-    m_data  = data;
-}
-//-----------------------------------------------------------------------------
-#endif // end use int check
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_LONG
-//-----------------------------------------------------------------------------
-void
-Node::set_external(long *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
-{
-    release();
-    m_schema->set(DataType::c_long(num_elements,
-                                   offset,
-                                   stride,
-                                   element_bytes,
-                                   endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(unsigned long *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const unsigned long *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_unsigned_long(num_elements,
-                                            offset,
-                                            stride,
-                                            element_bytes,
-                                            endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long check
 //-----------------------------------------------------------------------------
 
-
 //-----------------------------------------------------------------------------
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set_external(long long *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const long long *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_long_long(num_elements,
-                                        offset,
-                                        stride,
-                                        element_bytes,
-                                        endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(unsigned long long *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const unsigned long long *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_unsigned_long_long(num_elements,
-                                                 offset,
-                                                 stride,
-                                                 element_bytes,
-                                                 endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long long check
@@ -5187,20 +6049,20 @@ Node::set_external(unsigned long long *data,
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set_external(float *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const float *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_float(num_elements,
-                                    offset,
-                                    stride,
-                                    element_bytes,
-                                    endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -5210,20 +6072,20 @@ Node::set_external(float *data,
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set_external(double *data,
-                   index_t num_elements,
-                   index_t offset,
-                   index_t stride,
-                   index_t element_bytes,
-                   index_t endianness)
+Node::set_path(const std::string &path,
+               const double *data,
+               index_t num_elements,
+               index_t offset,
+               index_t stride,
+               index_t element_bytes,
+               index_t endianness)
 {
-    release();
-    m_schema->set(DataType::c_double(num_elements,
-                                     offset,
-                                     stride,
-                                     element_bytes,
-                                     endianness));
-    m_data  = data;
+    fetch(path).set(data,
+                    num_elements,
+                    offset,
+                    stride,
+                    element_bytes,
+                    endianness);
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
@@ -5231,594 +6093,949 @@ Node::set_external(double *data,
 
 
 //-----------------------------------------------------------------------------
-// -- set_external for conduit::DataArray types ---
+//
+// -- end definition of Node set_path methods --
+//
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer array types via conduit::DataArray
+//
+// -- begin definition of Node set_external methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- set_external for generic types --
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int8_array(const int8_array &data)
+Node::set_external_node(const Node &node)
 {
-    release();
-    m_schema->set(data.dtype());
-    m_data   = data.data_ptr();
+    reset();
+    m_schema->set(node.schema());
+    mirror_node(this,m_schema,&node);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const int8_array &data)
+Node::set_external(const Node &node)
 {
-    set_external_int8_array(data);
+    set_external_node(node);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int16_array(const int16_array &data)
+Node::set_external_data_using_schema(const Schema &schema,
+                                     void *data)
 {
-    release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    reset();
+    m_schema->set(schema);
+    walk_schema(this,m_schema,data,m_allocator_id);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const int16_array &data)
+Node::set_external(const Schema &schema,
+                   void *data)
 {
-    set_external_int16_array(data);
+    set_external_data_using_schema(schema,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int32_array(const int32_array &data)
-{
-    release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::set_external(const int32_array &data)
+Node::set_external_data_using_dtype(const DataType &dtype,
+                                    void *data)
 {
-    set_external_int32_array(data);
+    reset();
+    m_data    = data;
+    m_schema->set(dtype);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int64_array(const int64_array &data)
+Node::set_external(const DataType &dtype,
+                   void *data)
 {
-    release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    set_external_data_using_dtype(dtype,data);
 }
 
-//---------------------------------------------------------------------------//
-void
-Node::set_external(const int64_array &data)
-{
-    set_external_int64_array(data);
-}
+//-----------------------------------------------------------------------------
+// -- set_external via pointers (scalar and array types) --
+//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// unsigned integer array types via conduit::DataArray
+// signed integer pointer cases
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint8_array(const uint8_array &data)
+Node::set_external_int8_ptr(int8 *data,
+                            index_t num_elements,
+                            index_t offset,
+                            index_t stride,
+                            index_t element_bytes,
+                            index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::int8(num_elements,
+                                 offset,
+                                 stride,
+                                 element_bytes,
+                                 endianness));
+    m_data  = data;
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const uint8_array &data)
+Node::set_external(int8 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_uint8_array(data);
+    set_external_int8_ptr(data,
+                          num_elements,
+                          offset,
+                          stride,
+                          element_bytes,
+                          endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint16_array(const uint16_array &data)
+Node::set_external_int16_ptr(int16 *data,
+                             index_t num_elements,
+                             index_t offset,
+                             index_t stride,
+                             index_t element_bytes,
+                             index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::int16(num_elements,
+                                  offset,
+                                  stride,
+                                  element_bytes,
+                                  endianness));
+    m_data  = data;
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const uint16_array &data)
+Node::set_external(int16 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_uint16_array(data);
+    set_external_int16_ptr(data,
+                           num_elements,
+                           offset,
+                           stride,
+                           element_bytes,
+                           endianness);
 }
 
+
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint32_array(const uint32_array &data)
+Node::set_external_int32_ptr(int32 *data,
+                             index_t num_elements,
+                             index_t offset,
+                             index_t stride,
+                             index_t element_bytes,
+                             index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::int32(num_elements,
+                                  offset,
+                                  stride,
+                                  element_bytes,
+                                  endianness));
+    m_data  = data;
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const uint32_array &data)
+Node::set_external(int32 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_uint32_array(data);
+    set_external_int32_ptr(data,
+                           num_elements,
+                           offset,
+                           stride,
+                           element_bytes,
+                           endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint64_array(const uint64_array &data)
+Node::set_external_int64_ptr(int64 *data,
+                             index_t num_elements,
+                             index_t offset,
+                             index_t stride,
+                             index_t element_bytes,
+                             index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::int64(num_elements,
+                                  offset,
+                                  stride,
+                                  element_bytes,
+                                  endianness));
+    m_data  = data;
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const uint64_array &data)
+Node::set_external(int64 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_uint64_array(data);
+    set_external_int64_ptr(data,
+                           num_elements,
+                           offset,
+                           stride,
+                           element_bytes,
+                           endianness);
 }
 
+
 //-----------------------------------------------------------------------------
-// floating point array types via conduit::DataArray
+// unsigned integer pointer cases
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_float32_array(const float32_array &data)
+Node::set_external_uint8_ptr(uint8 *data,
+                             index_t num_elements,
+                             index_t offset,
+                             index_t stride,
+                             index_t element_bytes,
+                             index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::uint8(num_elements,
+                                          offset,
+                                          stride,
+                                          element_bytes,
+                                          endianness));
+    m_data  = data;
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const float32_array &data)
+Node::set_external(uint8 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_float32_array(data);
+    set_external_uint8_ptr(data,
+                           num_elements,
+                           offset,
+                           stride,
+                           element_bytes,
+                           endianness);
 }
 
+
+
 //---------------------------------------------------------------------------//
 void
-Node::set_external_float64_array(const float64_array &data)
+Node::set_external_uint16_ptr(uint16 *data,
+                              index_t num_elements,
+                              index_t offset,
+                              index_t stride,
+                              index_t element_bytes,
+                              index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::uint16(num_elements,
+                                           offset,
+                                           stride,
+                                           element_bytes,
+                                           endianness));
+    m_data  = data;
 }
 
+
 //---------------------------------------------------------------------------//
 void
-Node::set_external(const float64_array &data)
+Node::set_external(uint16 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_float64_array(data);
+    set_external_uint16_ptr(data,
+                            num_elements,
+                            offset,
+                            stride,
+                            element_bytes,
+                            endianness);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external_char8_str(char *data)
+Node::set_external_uint32_ptr(uint32 *data,
+                             index_t num_elements,
+                             index_t offset,
+                             index_t stride,
+                             index_t element_bytes,
+                             index_t endianness)
 {
     release();
-
-    // size including the null term
-    index_t str_size_with_term = strlen(data)+1;
-    DataType str_t(DataType::CHAR8_STR_ID,
-                   str_size_with_term,
-                   0,
-                   sizeof(char),
-                   sizeof(char),
-                   Endianness::DEFAULT_ID);
-
-    m_schema->set(str_t);
+    m_schema->set(DataType::uint32(num_elements,
+                                   offset,
+                                   stride,
+                                   element_bytes,
+                                   endianness));
     m_data  = data;
 }
 
 
-//-----------------------------------------------------------------------------
-// set_external array gap methods for c-native types
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const char_array &data)
+Node::set_external(uint32 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
-}
-
-
+    set_external_uint32_ptr(data,
+                            num_elements,
+                            offset,
+                            stride,
+                            element_bytes,
+                            endianness);
+}
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const signed_char_array &data)
+Node::set_external_uint64_ptr(uint64 *data,
+                              index_t num_elements,
+                              index_t offset,
+                              index_t stride,
+                              index_t element_bytes,
+                              index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::uint64(num_elements,
+                                   offset,
+                                   stride,
+                                   element_bytes,
+                                   endianness));
+    m_data  = data;
 }
 
-//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const unsigned_char_array &data)
+Node::set_external(uint64 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    set_external_uint64_ptr(data,
+                            num_elements,
+                            offset,
+                            stride,
+                            element_bytes,
+                            endianness);
 }
 //-----------------------------------------------------------------------------
-#endif // end use char check
+// floating point pointer cases
 //-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const short_array &data)
+Node::set_external_float32_ptr(float32 *data,
+                               index_t num_elements,
+                               index_t offset,
+                               index_t stride,
+                               index_t element_bytes,
+                               index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::float32(num_elements,
+                                    offset,
+                                    stride,
+                                    element_bytes,
+                                    endianness));
+    m_data  = data;
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const unsigned_short_array &data)
+Node::set_external(float32 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    set_external_float32_ptr(data,
+                            num_elements,
+                            offset,
+                            stride,
+                            element_bytes,
+                            endianness);
 }
-//-----------------------------------------------------------------------------
-#endif // end use short check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_INT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const int_array &data)
+Node::set_external_float64_ptr(float64 *data,
+                               index_t num_elements,
+                               index_t offset,
+                               index_t stride,
+                               index_t element_bytes,
+                               index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::float64(num_elements,
+                                    offset,
+                                    stride,
+                                    element_bytes,
+                                    endianness));
+    m_data  = data;
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const unsigned_int_array &data)
+Node::set_external(float64 *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    set_external_float64_ptr(data,
+                            num_elements,
+                            offset,
+                            stride,
+                            element_bytes,
+                            endianness);
 }
+
 //-----------------------------------------------------------------------------
-#endif // end use int check
+// set pointer gap methods for c-native types
 //-----------------------------------------------------------------------------
+void
+Node::set_external_char_ptr(char *data,
+                            index_t num_elements,
+                            index_t offset,
+                            index_t stride,
+                            index_t element_bytes,
+                            index_t endianness)
+{
+    release();
+    m_schema->set(DataType::c_char(num_elements,
+                                   offset,
+                                   stride,
+                                   element_bytes,
+                                   endianness));
+    m_data  = data;
+}
+
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_LONG
+#ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const long_array &data)
+Node::set_external(signed char *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::c_signed_char(num_elements,
+                                          offset,
+                                          stride,
+                                          element_bytes,
+                                          endianness));
+    m_data  = data;
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const unsigned_long_array &data)
+Node::set_external(unsigned char *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::c_unsigned_char(num_elements,
+                                            offset,
+                                            stride,
+                                            element_bytes,
+                                            endianness));
+    m_data  = data;
 }
 //-----------------------------------------------------------------------------
-#endif // end use long check
+#endif // end use char check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
+#ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const long_long_array &data)
+Node::set_external(short *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::c_short(num_elements,
+                                    offset,
+                                    stride,
+                                    element_bytes,
+                                    endianness));
+    m_data  = data;
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const unsigned_long_long_array &data)
+Node::set_external(unsigned short *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::c_unsigned_short(num_elements,
+                                             offset,
+                                             stride,
+                                             element_bytes,
+                                             endianness));
+    m_data  = data;
 }
 //-----------------------------------------------------------------------------
-#endif // end use long long check
+#endif // end use short check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_FLOAT
+#ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const float_array &data)
+Node::set_external(int *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::c_int(num_elements,
+                                  offset,
+                                  stride,
+                                  element_bytes,
+                                  endianness));
+    m_data  = data;
 }
-//-----------------------------------------------------------------------------
-#endif // end use float check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const double_array &data)
+Node::set_external(unsigned int *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    m_schema->set(data.dtype());
-    m_data  = data.data_ptr();
+    m_schema->set(DataType::c_unsigned_int(num_elements,
+                                           offset,
+                                           stride,
+                                           element_bytes,
+                                           endianness));
+    m_data  = data;
 }
 //-----------------------------------------------------------------------------
-#endif // end use double check
+#endif // end use int check
 //-----------------------------------------------------------------------------
 
-
 //-----------------------------------------------------------------------------
-// -- set_external for std::vector types ---
+#ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
-
+void
+Node::set_external(long *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
+{
+    release();
+    m_schema->set(DataType::c_long(num_elements,
+                                   offset,
+                                   stride,
+                                   element_bytes,
+                                   endianness));
+    m_data  = data;
+}
+
 //-----------------------------------------------------------------------------
-// signed integer array types via std::vector
+void
+Node::set_external(unsigned long *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
+{
+    release();
+    m_schema->set(DataType::c_unsigned_long(num_elements,
+                                            offset,
+                                            stride,
+                                            element_bytes,
+                                            endianness));
+    m_data  = data;
+}
+//-----------------------------------------------------------------------------
+#endif // end use long check
 //-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
+//-----------------------------------------------------------------------------
 void
-Node::set_external_int8_vector(std::vector<int8> &data)
+Node::set_external(long long *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::int8(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(DataType::c_long_long(num_elements,
+                                        offset,
+                                        stride,
+                                        element_bytes,
+                                        endianness));
+    m_data  = data;
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set_external(std::vector<int8> &data)
+Node::set_external(unsigned long long *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_int8_vector(data);
+    release();
+    m_schema->set(DataType::c_unsigned_long_long(num_elements,
+                                                 offset,
+                                                 stride,
+                                                 element_bytes,
+                                                 endianness));
+    m_data  = data;
 }
+//-----------------------------------------------------------------------------
+#endif // end use long long check
+//-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_FLOAT
+//-----------------------------------------------------------------------------
 void
-Node::set_external_int16_vector(std::vector<int16> &data)
+Node::set_external(float *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::int16(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(DataType::c_float(num_elements,
+                                    offset,
+                                    stride,
+                                    element_bytes,
+                                    endianness));
+    m_data  = data;
 }
+//-----------------------------------------------------------------------------
+#endif // end use float check
+//-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_DOUBLE
+//-----------------------------------------------------------------------------
 void
-Node::set_external(std::vector<int16> &data)
+Node::set_external(double *data,
+                   index_t num_elements,
+                   index_t offset,
+                   index_t stride,
+                   index_t element_bytes,
+                   index_t endianness)
 {
-    set_external_int16_vector(data);
+    release();
+    m_schema->set(DataType::c_double(num_elements,
+                                     offset,
+                                     stride,
+                                     element_bytes,
+                                     endianness));
+    m_data  = data;
 }
+//-----------------------------------------------------------------------------
+#endif // end use double check
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// -- set_external for conduit::DataArray types ---
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// signed integer array types via conduit::DataArray
+//-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int32_vector(std::vector<int32> &data)
+Node::set_external_int8_array(const int8_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::int32(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data   = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<int32> &data)
+Node::set_external(const int8_array &data)
 {
-    set_external_int32_vector(data);
+    set_external_int8_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_int64_vector(std::vector<int64> &data)
+Node::set_external_int16_array(const int16_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::int64(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<int64> &data)
+Node::set_external(const int16_array &data)
 {
-    set_external_int64_vector(data);
+    set_external_int16_array(data);
 }
 
-//-----------------------------------------------------------------------------
-// unsigned integer array types via std::vector
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint8_vector(std::vector<uint8> &data)
+Node::set_external_int32_array(const int32_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::uint8(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<uint8> &data)
+Node::set_external(const int32_array &data)
 {
-    set_external_uint8_vector(data);
+    set_external_int32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint16_vector(std::vector<uint16> &data)
+Node::set_external_int64_array(const int64_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::uint16(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<uint16> &data)
+Node::set_external(const int64_array &data)
 {
-    set_external_uint16_vector(data);
+    set_external_int64_array(data);
 }
 
+//-----------------------------------------------------------------------------
+// unsigned integer array types via conduit::DataArray
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint32_vector(std::vector<uint32> &data)
+Node::set_external_uint8_array(const uint8_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::uint32(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<uint32> &data)
+Node::set_external(const uint8_array &data)
 {
-    set_external_uint32_vector(data);
+    set_external_uint8_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_uint64_vector(std::vector<uint64> &data)
+Node::set_external_uint16_array(const uint16_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::uint64(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<uint64> &data)
+Node::set_external(const uint16_array &data)
 {
-    set_external_uint64_vector(data);
+    set_external_uint16_array(data);
 }
 
-//-----------------------------------------------------------------------------
-// floating point array types via std::vector
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_external_float32_vector(std::vector<float32> &data)
+Node::set_external_uint32_array(const uint32_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::float32(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<float32> &data)
+Node::set_external(const uint32_array &data)
 {
-    set_external_float32_vector(data);
+    set_external_uint32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external_float64_vector(std::vector<float64> &data)
+Node::set_external_uint64_array(const uint64_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::float64(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_external(std::vector<float64> &data)
+Node::set_external(const uint64_array &data)
 {
-    set_external_float64_vector(data);
+    set_external_uint64_array(data);
 }
 
 //-----------------------------------------------------------------------------
-// set_external vector gap methods for c-native types
+// floating point array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const std::vector<char> &data)
+Node::set_external_float32_array(const float32_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_char(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_external(const std::vector<signed char> &data)
+Node::set_external(const float32_array &data)
+{
+    set_external_float32_array(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_external_float64_array(const float64_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_signed_char(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_external(const float64_array &data)
+{
+    set_external_float64_array(data);
+}
+
+
+//---------------------------------------------------------------------------//
+void
+Node::set_external_char8_str(char *data)
+{
+    release();
+
+    // size including the null term
+    index_t str_size_with_term = strlen(data)+1;
+    DataType str_t(DataType::CHAR8_STR_ID,
+                   str_size_with_term,
+                   0,
+                   sizeof(char),
+                   sizeof(char),
+                   Endianness::DEFAULT_ID);
+
+    m_schema->set(str_t);
+    m_data  = data;
 }
 
+
+//-----------------------------------------------------------------------------
+// set_external array gap methods for c-native types
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<unsigned char> &data)
+Node::set_external(const char_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_unsigned_char(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
+}
+
+
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_CHAR
+//-----------------------------------------------------------------------------
+void
+Node::set_external(const signed_char_array &data)
+{
+    release();
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::set_external(const unsigned_char_array &data)
+{
+    release();
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 //-----------------------------------------------------------------------------
 #endif // end use char check
@@ -5828,24 +7045,20 @@ Node::set_external(const std::vector<unsigned char> &data)
 #ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<short> &data)
+Node::set_external(const short_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_short(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<unsigned short> &data)
+Node::set_external(const unsigned_short_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_unsigned_short(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 //-----------------------------------------------------------------------------
 #endif // end use short check
@@ -5855,24 +7068,20 @@ Node::set_external(const std::vector<unsigned short> &data)
 #ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<int> &data)
+Node::set_external(const int_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_int(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<unsigned int> &data)
+Node::set_external(const unsigned_int_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_unsigned_int(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 //-----------------------------------------------------------------------------
 #endif // end use int check
@@ -5882,24 +7091,20 @@ Node::set_external(const std::vector<unsigned int> &data)
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<long> &data)
+Node::set_external(const long_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_long(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<unsigned long> &data)
+Node::set_external(const unsigned_long_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_unsigned_long(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 //-----------------------------------------------------------------------------
 #endif // end use long check
@@ -5909,41 +7114,34 @@ Node::set_external(const std::vector<unsigned long> &data)
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<long long> &data)
+Node::set_external(const long_long_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_long_long(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<unsigned long long> &data)
+Node::set_external(const unsigned_long_long_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_unsigned_long_long(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 //-----------------------------------------------------------------------------
 #endif // end use long long check
 //-----------------------------------------------------------------------------
 
-
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<float> &data)
+Node::set_external(const float_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_float(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -5953,13 +7151,11 @@ Node::set_external(const std::vector<float> &data)
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set_external(const std::vector<double> &data)
+Node::set_external(const double_array &data)
 {
     release();
-    index_t data_num_ele = (index_t)data.size();
-    m_schema->set(DataType::c_double(data_num_ele));
-    if(data_num_ele > 0)
-        m_data  = (void*)&data[0];
+    m_schema->set(data.dtype());
+    m_data  = data.data_ptr();
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
@@ -5967,711 +7163,363 @@ Node::set_external(const std::vector<double> &data)
 
 
 //-----------------------------------------------------------------------------
-//
-// -- end definition of Node set_external methods --
-//
-//-----------------------------------------------------------------------------
-
-
-//-----------------------------------------------------------------------------
-//
-// -- begin definition of Node set_path_external methods --
-//
+// -- set_external for std::vector types ---
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// -- set_external for generic types --
+// signed integer array types via std::vector
 //-----------------------------------------------------------------------------
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_node(const std::string &path,
-                             Node &node)
+Node::set_external_int8_vector(std::vector<int8> &data)
 {
-    fetch(path).set_external_node(node);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::int8(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        Node &node)
+Node::set_external(std::vector<int8> &data)
 {
-    set_path_external_node(path,node);
+    set_external_int8_vector(data);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_data_using_schema(const std::string &path,
-                                          const Schema &schema,
-                                          void *data)
+Node::set_external_int16_vector(std::vector<int16> &data)
 {
-    fetch(path).set_external_data_using_schema(schema,data);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::int16(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const Schema &schema,
-                        void *data)
+Node::set_external(std::vector<int16> &data)
 {
-    set_path_external_data_using_schema(path,schema,data);
+    set_external_int16_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_data_using_dtype(const std::string &path,
-                                         const DataType &dtype,
-                                         void *data)
+Node::set_external_int32_vector(std::vector<int32> &data)
 {
-    fetch(path).set_external_data_using_dtype(dtype,data);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::int32(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const DataType &dtype,
-                        void *data)
+Node::set_external(std::vector<int32> &data)
 {
-    set_path_external_data_using_dtype(path,dtype,data);
+    set_external_int32_vector(data);
 }
 
-//-----------------------------------------------------------------------------
-// -- set_path_external via pointers (scalar and array types) --
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-// signed integer pointer cases
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int8_ptr(const std::string &path,
-                                 int8  *data,
-                                 index_t num_elements,
-                                 index_t offset,
-                                 index_t stride,
-                                 index_t element_bytes,
-                                 index_t endianness)
+Node::set_external_int64_vector(std::vector<int64> &data)
 {
-    fetch(path).set_external_int8_ptr(data,
-                                      num_elements,
-                                      offset,
-                                      stride,
-                                      element_bytes,
-                                      endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::int64(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        int8  *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(std::vector<int64> &data)
 {
-    set_path_external_int8_ptr(path,
-                               data,
-                               num_elements,
-                               offset,
-                               stride,
-                               element_bytes,
-                               endianness);
+    set_external_int64_vector(data);
 }
 
+//-----------------------------------------------------------------------------
+// unsigned integer array types via std::vector
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int16_ptr(const std::string &path,
-                                  int16 *data,
-                                  index_t num_elements,
-                                  index_t offset,
-                                  index_t stride,
-                                  index_t element_bytes,
-                                  index_t endianness)
+Node::set_external_uint8_vector(std::vector<uint8> &data)
 {
-    fetch(path).set_external_int16_ptr(data,
-                                       num_elements,
-                                       offset,
-                                       stride,
-                                       element_bytes,
-                                       endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::uint8(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        int16 *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(std::vector<uint8> &data)
 {
-    set_path_external_int16_ptr(path,
-                                data,
-                                num_elements,
-                                offset,
-                                stride,
-                                element_bytes,
-                                endianness);
+    set_external_uint8_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int32_ptr(const std::string &path,
-                                  int32 *data,
-                                  index_t num_elements,
-                                  index_t offset,
-                                  index_t stride,
-                                  index_t element_bytes,
-                                  index_t endianness)
+Node::set_external_uint16_vector(std::vector<uint16> &data)
 {
-    fetch(path).set_external_int32_ptr(data,
-                                       num_elements,
-                                       offset,
-                                       stride,
-                                       element_bytes,
-                                       endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::uint16(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-           int32 *data,
-           index_t num_elements,
-           index_t offset,
-           index_t stride,
-           index_t element_bytes,
-           index_t endianness)
+Node::set_external(std::vector<uint16> &data)
 {
-    set_path_external_int32_ptr(path,
-                                data,
-                                num_elements,
-                                offset,
-                                stride,
-                                element_bytes,
-                                endianness);
+    set_external_uint16_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int64_ptr(const std::string &path,
-                                  int64 *data,
-                                  index_t num_elements,
-                                  index_t offset,
-                                  index_t stride,
-                                  index_t element_bytes,
-                                  index_t endianness)
+Node::set_external_uint32_vector(std::vector<uint32> &data)
 {
-    fetch(path).set_external_int64_ptr(data,
-                                       num_elements,
-                                       offset,
-                                       stride,
-                                       element_bytes,
-                                       endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::uint32(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        int64 *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(std::vector<uint32> &data)
 {
-    set_path_external_int64_ptr(path,
-                                data,
-                                num_elements,
-                                offset,
-                                stride,
-                                element_bytes,
-                                endianness);
+    set_external_uint32_vector(data);
 }
 
-//-----------------------------------------------------------------------------
-// unsigned integer pointer cases
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint8_ptr(const std::string &path,
-                                  uint8  *data,
-                                  index_t num_elements,
-                                  index_t offset,
-                                  index_t stride,
-                                  index_t element_bytes,
-                                  index_t endianness)
+Node::set_external_uint64_vector(std::vector<uint64> &data)
 {
-    fetch(path).set_external_uint8_ptr(data,
-                                       num_elements,
-                                       offset,
-                                       stride,
-                                       element_bytes,
-                                       endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::uint64(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        uint8  *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(std::vector<uint64> &data)
 {
-    set_path_external_uint8_ptr(path,
-                                data,
-                                num_elements,
-                                offset,
-                                stride,
-                                element_bytes,
-                                endianness);
+    set_external_uint64_vector(data);
 }
 
+//-----------------------------------------------------------------------------
+// floating point array types via std::vector
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint16_ptr(const std::string &path,
-                                   uint16 *data,
-                                   index_t num_elements,
-                                   index_t offset,
-                                   index_t stride,
-                                   index_t element_bytes,
-                                   index_t endianness)
+Node::set_external_float32_vector(std::vector<float32> &data)
 {
-    fetch(path).set_external_uint16_ptr(data,
-                                        num_elements,
-                                        offset,
-                                        stride,
-                                        element_bytes,
-                                        endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::float32(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        uint16 *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(std::vector<float32> &data)
 {
-    set_path_external_uint16_ptr(path,
-                                 data,
-                                 num_elements,
-                                 offset,
-                                 stride,
-                                 element_bytes,
-                                 endianness);
+    set_external_float32_vector(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint32_ptr(const std::string &path,
-                                   uint32 *data,
-                                   index_t num_elements,
-                                   index_t offset,
-                                   index_t stride,
-                                   index_t element_bytes,
-                                   index_t endianness)
+Node::set_external_float64_vector(std::vector<float64> &data)
 {
-    fetch(path).set_external_uint32_ptr(data,
-                                        num_elements,
-                                        offset,
-                                        stride,
-                                        element_bytes,
-                                        endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::float64(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        uint32 *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(std::vector<float64> &data)
 {
-    set_path_external_uint32_ptr(path,
-                                 data,
-                                 num_elements,
-                                 offset,
-                                 stride,
-                                 element_bytes,
-                                 endianness);
+    set_external_float64_vector(data);
 }
 
+//-----------------------------------------------------------------------------
+// set_external vector gap methods for c-native types
+//-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set_path_external_uint64_ptr(const std::string &path,
-                                   uint64 *data,
-                                   index_t num_elements,
-                                   index_t offset,
-                                   index_t stride,
-                                   index_t element_bytes,
-                                   index_t endianness)
+Node::set_external(const std::vector<char> &data)
 {
-    fetch(path).set_external_uint64_ptr(data,
-                                        num_elements,
-                                        offset,
-                                        stride,
-                                        element_bytes,
-                                        endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_char(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_CHAR
+//-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        uint64 *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<signed char> &data)
 {
-    set_path_external_uint64_ptr(path,
-                                 data,
-                                 num_elements,
-                                 offset,
-                                 stride,
-                                 element_bytes,
-                                 endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_signed_char(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //-----------------------------------------------------------------------------
-// floating point pointer cases
-//-----------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------//
 void
-Node::set_path_external_float32_ptr(const std::string &path,
-                                    float32 *data,
-                                    index_t num_elements,
-                                    index_t offset,
-                                    index_t stride,
-                                    index_t element_bytes,
-                                    index_t endianness)
+Node::set_external(const std::vector<unsigned char> &data)
 {
-    fetch(path).set_external_float32_ptr(data,
-                                         num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_unsigned_char(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
+//-----------------------------------------------------------------------------
+#endif // end use char check
+//-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_SHORT
+//-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                       float32 *data,
-                       index_t num_elements,
-                       index_t offset,
-                       index_t stride,
-                       index_t element_bytes,
-                       index_t endianness)
+Node::set_external(const std::vector<short> &data)
 {
-    set_path_external_float32_ptr(path,
-                                 data,
-                                 num_elements,
-                                 offset,
-                                 stride,
-                                 element_bytes,
-                                 endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_short(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
-
-
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
-Node::set_path_external_float64_ptr(const std::string &path,
-                                    float64 *data,
-                                    index_t num_elements,
-                                    index_t offset,
-                                    index_t stride,
-                                    index_t element_bytes,
-                                    index_t endianness)
+Node::set_external(const std::vector<unsigned short> &data)
 {
-    fetch(path).set_external_float64_ptr(data,
-                                         num_elements,
-                                         offset,
-                                         stride,
-                                         element_bytes,
-                                         endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_unsigned_short(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
+//-----------------------------------------------------------------------------
+#endif // end use short check
+//-----------------------------------------------------------------------------
 
-
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_INT
+//-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        float64 *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<int> &data)
 {
-    set_path_external_float64_ptr(path,
-                                 data,
-                                 num_elements,
-                                 offset,
-                                 stride,
-                                 element_bytes,
-                                 endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_int(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //-----------------------------------------------------------------------------
-// set_path_external pointer gap methods for c-native types
-//-----------------------------------------------------------------------------
-
 void
-Node::set_path_external_char_ptr(const std::string &path,
-                                 char *data,
-                                 index_t num_elements,
-                                 index_t offset,
-                                 index_t stride,
-                                 index_t element_bytes,
-                                 index_t endianness)
+Node::set_external(const std::vector<unsigned int> &data)
 {
-    fetch(path).set_external_char_ptr(data,
-                                      num_elements,
-                                      offset,
-                                      stride,
-                                      element_bytes,
-                                      endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_unsigned_int(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
-
+//-----------------------------------------------------------------------------
+#endif // end use int check
+//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
+#ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        signed char *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<long> &data)
 {
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_long(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        unsigned char *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<unsigned long> &data)
 {
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_unsigned_long(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 //-----------------------------------------------------------------------------
-#endif // end use char check
+#endif // end use long check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
+#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        short *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<long long> &data)
 {
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_long_long(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        unsigned short *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<unsigned long long> &data)
 {
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_unsigned_long_long(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 //-----------------------------------------------------------------------------
-#endif // end use short check
+#endif // end use long long check
 //-----------------------------------------------------------------------------
 
+
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_INT
+#ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        int *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<float> &data)
 {
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
-}
-
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        unsigned int *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
-{
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
-}
-//-----------------------------------------------------------------------------
-#endif // end use int check
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_LONG
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        long *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
-{
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
-}
-
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        unsigned long *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
-{
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
-}
-//-----------------------------------------------------------------------------
-#endif // end use long check
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        long long *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
-{
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
-}
-
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        unsigned long long *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
-{
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
-}
-//-----------------------------------------------------------------------------
-#endif // end use long long check
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_FLOAT
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        float *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
-{
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_float(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -6681,557 +7529,949 @@ Node::set_path_external(const std::string &path,
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
-Node::set_path_external(const std::string &path,
-                        double *data,
-                        index_t num_elements,
-                        index_t offset,
-                        index_t stride,
-                        index_t element_bytes,
-                        index_t endianness)
+Node::set_external(const std::vector<double> &data)
 {
-    fetch(path).set_external(data,
-                             num_elements,
-                             offset,
-                             stride,
-                             element_bytes,
-                             endianness);
+    release();
+    index_t data_num_ele = (index_t)data.size();
+    m_schema->set(DataType::c_double(data_num_ele));
+    if(data_num_ele > 0)
+        m_data  = (void*)&data[0];
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node set_external methods --
+//
+//-----------------------------------------------------------------------------
+
 
 //-----------------------------------------------------------------------------
-// -- set_path_external for conduit::DataArray types ---
+//
+// -- begin definition of Node set_path_external methods --
+//
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer array types via conduit::DataArray
+// -- set_external for generic types --
 //-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
-void
-Node::set_path_external_int8_array(const std::string &path,
-                                   const int8_array  &data)
-{
-    fetch(path).set_external_int8_array(data);
-}
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const int8_array  &data)
+Node::set_path_external_node(const std::string &path,
+                             Node &node)
 {
-    set_path_external_int8_array(path,data);
+    fetch(path).set_external_node(node);
 }
 
-//---------------------------------------------------------------------------//
-void
-Node::set_path_external_int16_array(const std::string &path,
-                                    const int16_array &data)
-{
-    fetch(path).set_external_int16_array(data);
-}
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const int16_array &data)
+                        Node &node)
 {
-    set_path_external_int16_array(path,data);
+    set_path_external_node(path,node);
 }
 
+
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int32_array(const std::string &path,
-                                    const int32_array &data)
+Node::set_path_external_data_using_schema(const std::string &path,
+                                          const Schema &schema,
+                                          void *data)
 {
-    fetch(path).set_external_int32_array(data);
+    fetch(path).set_external_data_using_schema(schema,data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const int32_array &data)
+                        const Schema &schema,
+                        void *data)
 {
-    set_path_external_int32_array(path,data);
+    set_path_external_data_using_schema(path,schema,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int64_array(const std::string &path,
-                                    const int64_array &data)
+Node::set_path_external_data_using_dtype(const std::string &path,
+                                         const DataType &dtype,
+                                         void *data)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external_data_using_dtype(dtype,data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const int64_array &data)
+                        const DataType &dtype,
+                        void *data)
 {
-    set_path_external_int64_array(path,data);
+    set_path_external_data_using_dtype(path,dtype,data);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer array types via conduit::DataArray
+// -- set_path_external via pointers (scalar and array types) --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// signed integer pointer cases
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint8_array(const std::string &path,
-                                    const uint8_array  &data)
+Node::set_path_external_int8_ptr(const std::string &path,
+                                 int8  *data,
+                                 index_t num_elements,
+                                 index_t offset,
+                                 index_t stride,
+                                 index_t element_bytes,
+                                 index_t endianness)
 {
-    fetch(path).set_external_uint8_array(data);
+    fetch(path).set_external_int8_ptr(data,
+                                      num_elements,
+                                      offset,
+                                      stride,
+                                      element_bytes,
+                                      endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const uint8_array  &data)
+                        int8  *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    set_path_external_uint8_array(path,data);
+    set_path_external_int8_ptr(path,
+                               data,
+                               num_elements,
+                               offset,
+                               stride,
+                               element_bytes,
+                               endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint16_array(const std::string &path,
-                                     const uint16_array &data)
+Node::set_path_external_int16_ptr(const std::string &path,
+                                  int16 *data,
+                                  index_t num_elements,
+                                  index_t offset,
+                                  index_t stride,
+                                  index_t element_bytes,
+                                  index_t endianness)
 {
-    fetch(path).set_external_uint16_array(data);
+    fetch(path).set_external_int16_ptr(data,
+                                       num_elements,
+                                       offset,
+                                       stride,
+                                       element_bytes,
+                                       endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const uint16_array &data)
+                        int16 *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    set_path_external_uint16_array(path,data);
+    set_path_external_int16_ptr(path,
+                                data,
+                                num_elements,
+                                offset,
+                                stride,
+                                element_bytes,
+                                endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint32_array(const std::string &path,
-                        const uint32_array &data)
+Node::set_path_external_int32_ptr(const std::string &path,
+                                  int32 *data,
+                                  index_t num_elements,
+                                  index_t offset,
+                                  index_t stride,
+                                  index_t element_bytes,
+                                  index_t endianness)
 {
-    fetch(path).set_external_uint32_array(data);
+    fetch(path).set_external_int32_ptr(data,
+                                       num_elements,
+                                       offset,
+                                       stride,
+                                       element_bytes,
+                                       endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const uint32_array &data)
+           int32 *data,
+           index_t num_elements,
+           index_t offset,
+           index_t stride,
+           index_t element_bytes,
+           index_t endianness)
 {
-    set_path_external_uint32_array(path,data);
+    set_path_external_int32_ptr(path,
+                                data,
+                                num_elements,
+                                offset,
+                                stride,
+                                element_bytes,
+                                endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint64_array(const std::string &path,
-                                     const uint64_array &data)
+Node::set_path_external_int64_ptr(const std::string &path,
+                                  int64 *data,
+                                  index_t num_elements,
+                                  index_t offset,
+                                  index_t stride,
+                                  index_t element_bytes,
+                                  index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external_int64_ptr(data,
+                                       num_elements,
+                                       offset,
+                                       stride,
+                                       element_bytes,
+                                       endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                       const uint64_array &data)
+                        int64 *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    set_path_external_uint64_array(path,data);
+    set_path_external_int64_ptr(path,
+                                data,
+                                num_elements,
+                                offset,
+                                stride,
+                                element_bytes,
+                                endianness);
 }
 
 //-----------------------------------------------------------------------------
-// floating point array types via conduit::DataArray
+// unsigned integer pointer cases
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_float32_array(const std::string &path,
-                                      const float32_array &data)
+Node::set_path_external_uint8_ptr(const std::string &path,
+                                  uint8  *data,
+                                  index_t num_elements,
+                                  index_t offset,
+                                  index_t stride,
+                                  index_t element_bytes,
+                                  index_t endianness)
 {
-    fetch(path).set_external_float32_array(data);
+    fetch(path).set_external_uint8_ptr(data,
+                                       num_elements,
+                                       offset,
+                                       stride,
+                                       element_bytes,
+                                       endianness);
 }
-
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const float32_array &data)
+                        uint8  *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    set_path_external_float32_array(path,data);
+    set_path_external_uint8_ptr(path,
+                                data,
+                                num_elements,
+                                offset,
+                                stride,
+                                element_bytes,
+                                endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_float64_array(const std::string &path,
-                                      const float64_array &data)
+Node::set_path_external_uint16_ptr(const std::string &path,
+                                   uint16 *data,
+                                   index_t num_elements,
+                                   index_t offset,
+                                   index_t stride,
+                                   index_t element_bytes,
+                                   index_t endianness)
 {
-    fetch(path).set_external_float64_array(data);
+    fetch(path).set_external_uint16_ptr(data,
+                                        num_elements,
+                                        offset,
+                                        stride,
+                                        element_bytes,
+                                        endianness);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const float64_array &data)
+                        uint16 *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    set_path_external_float64_array(path,data);
+    set_path_external_uint16_ptr(path,
+                                 data,
+                                 num_elements,
+                                 offset,
+                                 stride,
+                                 element_bytes,
+                                 endianness);
 }
 
-
-//-----------------------------------------------------------------------------
-// set_path_external array gap methods for c-native types
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const char_array &data)
+Node::set_path_external_uint32_ptr(const std::string &path,
+                                   uint32 *data,
+                                   index_t num_elements,
+                                   index_t offset,
+                                   index_t stride,
+                                   index_t element_bytes,
+                                   index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external_uint32_ptr(data,
+                                        num_elements,
+                                        offset,
+                                        stride,
+                                        element_bytes,
+                                        endianness);
 }
 
-
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_CHAR
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const signed_char_array &data)
+                        uint32 *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external(data);
+    set_path_external_uint32_ptr(path,
+                                 data,
+                                 num_elements,
+                                 offset,
+                                 stride,
+                                 element_bytes,
+                                 endianness);
 }
 
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        const unsigned_char_array &data)
-{
-    fetch(path).set_external(data);
-}
-//-----------------------------------------------------------------------------
-#endif // end use char check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_SHORT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const short_array &data)
+Node::set_path_external_uint64_ptr(const std::string &path,
+                                   uint64 *data,
+                                   index_t num_elements,
+                                   index_t offset,
+                                   index_t stride,
+                                   index_t element_bytes,
+                                   index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external_uint64_ptr(data,
+                                        num_elements,
+                                        offset,
+                                        stride,
+                                        element_bytes,
+                                        endianness);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const unsigned_short_array &data)
+                        uint64 *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external(data);
+    set_path_external_uint64_ptr(path,
+                                 data,
+                                 num_elements,
+                                 offset,
+                                 stride,
+                                 element_bytes,
+                                 endianness);
 }
-//-----------------------------------------------------------------------------
-#endif // end use short check
-//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_INT
+// floating point pointer cases
 //-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const int_array &data)
+Node::set_path_external_float32_ptr(const std::string &path,
+                                    float32 *data,
+                                    index_t num_elements,
+                                    index_t offset,
+                                    index_t stride,
+                                    index_t element_bytes,
+                                    index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external_float32_ptr(data,
+                                         num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness);
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const unsigned_int_array &data)
+                       float32 *data,
+                       index_t num_elements,
+                       index_t offset,
+                       index_t stride,
+                       index_t element_bytes,
+                       index_t endianness)
 {
-    fetch(path).set_external(data);
+    set_path_external_float32_ptr(path,
+                                 data,
+                                 num_elements,
+                                 offset,
+                                 stride,
+                                 element_bytes,
+                                 endianness);
 }
-//-----------------------------------------------------------------------------
-#endif // end use int check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_LONG
-//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const long_array &data)
+Node::set_path_external_float64_ptr(const std::string &path,
+                                    float64 *data,
+                                    index_t num_elements,
+                                    index_t offset,
+                                    index_t stride,
+                                    index_t element_bytes,
+                                    index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external_float64_ptr(data,
+                                         num_elements,
+                                         offset,
+                                         stride,
+                                         element_bytes,
+                                         endianness);
 }
 
-//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        const unsigned_long_array &data)
+                        float64 *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external(data);
+    set_path_external_float64_ptr(path,
+                                 data,
+                                 num_elements,
+                                 offset,
+                                 stride,
+                                 element_bytes,
+                                 endianness);
 }
+
 //-----------------------------------------------------------------------------
-#endif // end use long check
+// set_path_external pointer gap methods for c-native types
 //-----------------------------------------------------------------------------
 
+void
+Node::set_path_external_char_ptr(const std::string &path,
+                                 char *data,
+                                 index_t num_elements,
+                                 index_t offset,
+                                 index_t stride,
+                                 index_t element_bytes,
+                                 index_t endianness)
+{
+    fetch(path).set_external_char_ptr(data,
+                                      num_elements,
+                                      offset,
+                                      stride,
+                                      element_bytes,
+                                      endianness);
+}
+
 
 //-----------------------------------------------------------------------------
-#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
+#ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const long_long_array &data)
+                        signed char *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const unsigned_long_long_array &data)
+                        unsigned char *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 //-----------------------------------------------------------------------------
-#endif // end use long long check
+#endif // end use char check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_FLOAT
+#ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const float_array &data)
+                        short *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
-//-----------------------------------------------------------------------------
-#endif // end use float check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const double_array &data)
+                        unsigned short *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external(data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 //-----------------------------------------------------------------------------
-#endif // end use double check
+#endif // end use short check
 //-----------------------------------------------------------------------------
 
-
-
 //-----------------------------------------------------------------------------
-// -- set_external for string types ---
+#ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------//
 void
-Node::set_path_external_char8_str(const std::string &path,
-                                 char *data)
+Node::set_path_external(const std::string &path,
+                        int *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external_char8_str(data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 
 //-----------------------------------------------------------------------------
-// -- set_path_external for std::vector types ---
+void
+Node::set_path_external(const std::string &path,
+                        unsigned int *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
+{
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
+}
+//-----------------------------------------------------------------------------
+#endif // end use int check
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer array types via std::vector
+#ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
-
-//---------------------------------------------------------------------------//
 void
-Node::set_path_external_int8_vector(const std::string &path,
-                                   std::vector<int8> &data)
+Node::set_path_external(const std::string &path,
+                        long *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external_int8_vector(data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<int8> &data)
+                        unsigned long *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    set_path_external_int8_vector(path,data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
+//-----------------------------------------------------------------------------
+#endif // end use long check
+//-----------------------------------------------------------------------------
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
+//-----------------------------------------------------------------------------
 void
-Node::set_path_external_int16_vector(const std::string &path,
-                                     std::vector<int16> &data)
+Node::set_path_external(const std::string &path,
+                        long long *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    fetch(path).set_external_int16_vector(data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
 }
 
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<int16> &data)
+                        unsigned long long *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
 {
-    set_path_external_int16_vector(path,data);
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
+}
+//-----------------------------------------------------------------------------
+#endif // end use long long check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_FLOAT
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        float *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
+{
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
+}
+//-----------------------------------------------------------------------------
+#endif // end use float check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_DOUBLE
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        double *data,
+                        index_t num_elements,
+                        index_t offset,
+                        index_t stride,
+                        index_t element_bytes,
+                        index_t endianness)
+{
+    fetch(path).set_external(data,
+                             num_elements,
+                             offset,
+                             stride,
+                             element_bytes,
+                             endianness);
+}
+//-----------------------------------------------------------------------------
+#endif // end use double check
+//-----------------------------------------------------------------------------
+
+
+
+//-----------------------------------------------------------------------------
+// -- set_path_external for conduit::DataArray types ---
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// signed integer array types via conduit::DataArray
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external_int8_array(const std::string &path,
+                                   const int8_array  &data)
+{
+    fetch(path).set_external_int8_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int32_vector(const std::string &path,
-                                     std::vector<int32> &data)
+Node::set_path_external(const std::string &path,
+                        const int8_array  &data)
 {
-    fetch(path).set_external_int32_vector(data);
+    set_path_external_int8_array(path,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external_int16_array(const std::string &path,
+                                    const int16_array &data)
+{
+    fetch(path).set_external_int16_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<int32> &data)
+                        const int16_array &data)
 {
-    set_path_external_int32_vector(path,data);
+    set_path_external_int16_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_int64_vector(const std::string &path,
-                        std::vector<int64> &data)
+Node::set_path_external_int32_array(const std::string &path,
+                                    const int32_array &data)
 {
-    fetch(path).set_external_int64_vector(data);
+    fetch(path).set_external_int32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<int64> &data)
+                        const int32_array &data)
 {
-    set_path_external_int64_vector(path,data);
+    set_path_external_int32_array(path,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external_int64_array(const std::string &path,
+                                    const int64_array &data)
+{
+    fetch(path).set_external(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external(const std::string &path,
+                        const int64_array &data)
+{
+    set_path_external_int64_array(path,data);
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer array types via std::vector
+// unsigned integer array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint8_vector(const std::string &path,
-                                     std::vector<uint8> &data)
+Node::set_path_external_uint8_array(const std::string &path,
+                                    const uint8_array  &data)
 {
-    fetch(path).set_external_uint8_vector(data);
+    fetch(path).set_external_uint8_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<uint8> &data)
+                        const uint8_array  &data)
 {
-    set_path_external_uint8_vector(path,data);
+    set_path_external_uint8_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint16_vector(const std::string &path,
-                                      std::vector<uint16> &data)
+Node::set_path_external_uint16_array(const std::string &path,
+                                     const uint16_array &data)
 {
-    fetch(path).set_external_uint16_vector(data);
+    fetch(path).set_external_uint16_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<uint16> &data)
+                        const uint16_array &data)
 {
-    set_path_external_uint16_vector(path,data);
+    set_path_external_uint16_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint32_vector(const std::string &path,
-                                      std::vector<uint32> &data)
+Node::set_path_external_uint32_array(const std::string &path,
+                        const uint32_array &data)
 {
-    fetch(path).set_external_uint32_vector(data);
+    fetch(path).set_external_uint32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<uint32> &data)
+                        const uint32_array &data)
 {
-    set_path_external_uint32_vector(path,data);
+    set_path_external_uint32_array(path,data);
 }
 
-
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_uint64_vector(const std::string &path,
-                                      std::vector<uint64> &data)
+Node::set_path_external_uint64_array(const std::string &path,
+                                     const uint64_array &data)
 {
-    fetch(path).set_external_uint64_vector(data);
+    fetch(path).set_external(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<uint64> &data)
+                       const uint64_array &data)
 {
-    set_path_external_uint64_vector(path,data);
+    set_path_external_uint64_array(path,data);
 }
 
 //-----------------------------------------------------------------------------
-// floating point array types via std::vector
+// floating point array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_float32_vector(const std::string &path,
-                                       std::vector<float32> &data)
+Node::set_path_external_float32_array(const std::string &path,
+                                      const float32_array &data)
 {
-    fetch(path).set_external_float32_vector(data);
+    fetch(path).set_external_float32_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<float32> &data)
+                        const float32_array &data)
 {
-    set_path_external_float32_vector(path,data);
+    set_path_external_float32_array(path,data);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_path_external_float64_vector(const std::string &path,
-                                       std::vector<float64> &data)
+Node::set_path_external_float64_array(const std::string &path,
+                                      const float64_array &data)
 {
-    fetch(path).set_external_float64_vector(data);
+    fetch(path).set_external_float64_array(data);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::set_path_external(const std::string &path,
-                        std::vector<float64> &data)
+                        const float64_array &data)
 {
-    set_path_external_float64_vector(path,data);
+    set_path_external_float64_array(path,data);
 }
 
 
 //-----------------------------------------------------------------------------
-// set_path_external vector gap methods for c-native types
-//-----------------------------------------------------------------------------
-
+// set_path_external array gap methods for c-native types
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<char> &data)
+                        const char_array &data)
 {
     fetch(path).set_external(data);
 }
 
+
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<signed char> &data)
+                        const signed_char_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7239,7 +8479,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned char> &data)
+                        const unsigned_char_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7252,7 +8492,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<short> &data)
+                        const short_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7260,7 +8500,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned short> &data)
+                        const unsigned_short_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7273,7 +8513,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<int> &data)
+                        const int_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7281,7 +8521,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned int> &data)
+                        const unsigned_int_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7294,7 +8534,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<long> &data)
+                        const long_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7302,7 +8542,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned long> &data)
+                        const unsigned_long_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7310,12 +8550,13 @@ Node::set_path_external(const std::string &path,
 #endif // end use long check
 //-----------------------------------------------------------------------------
 
+
 //-----------------------------------------------------------------------------
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<long long> &data)
+                        const long_long_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7323,7 +8564,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned long long> &data)
+                        const unsigned_long_long_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7336,7 +8577,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<float> &data)
+                        const float_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7349,7 +8590,7 @@ Node::set_path_external(const std::string &path,
 //-----------------------------------------------------------------------------
 void
 Node::set_path_external(const std::string &path,
-                        const std::vector<double> &data)
+                        const double_array &data)
 {
     fetch(path).set_external(data);
 }
@@ -7360,175 +8601,224 @@ Node::set_path_external(const std::string &path,
 
 
 //-----------------------------------------------------------------------------
-//
-// -- end definition of Node set_path_external methods --
-//
+// -- set_external for string types ---
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external_char8_str(const std::string &path,
+                                 char *data)
+{
+    fetch(path).set_external_char8_str(data);
+}
+
 //-----------------------------------------------------------------------------
-//
-// -- begin definition of Node assignment operators --
-//
+// -- set_path_external for std::vector types ---
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// -- assignment operators for generic types --
+// signed integer array types via std::vector
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(const Node &node)
+void
+Node::set_path_external_int8_vector(const std::string &path,
+                                   std::vector<int8> &data)
 {
-    if(this != &node)
-    {
-        set(node);
-    }
-    return *this;
+    fetch(path).set_external_int8_vector(data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(const DataType &dtype)
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<int8> &data)
 {
-    set(dtype);
-    return *this;
+    set_path_external_int8_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(const Schema &schema)
+void
+Node::set_path_external_int16_vector(const std::string &path,
+                                     std::vector<int16> &data)
 {
-    set(schema);
-    return *this;
+    fetch(path).set_external_int16_vector(data);
 }
 
-//-----------------------------------------------------------------------------
-// --  assignment operators for scalar types ---
-//-----------------------------------------------------------------------------
-
-//-----------------------------------------------------------------------------
-// signed integer scalar types
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(int8 data)
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<int16> &data)
 {
-    set(data);
-    return *this;
+    set_path_external_int16_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(int16 data)
+void
+Node::set_path_external_int32_vector(const std::string &path,
+                                     std::vector<int32> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external_int32_vector(data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(int32 data)
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<int32> &data)
 {
-    set(data);
-    return *this;
+    set_path_external_int32_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(int64 data)
+void
+Node::set_path_external_int64_vector(const std::string &path,
+                        std::vector<int64> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external_int64_vector(data);
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<int64> &data)
+{
+    set_path_external_int64_vector(path,data);
+}
 
 //-----------------------------------------------------------------------------
-// unsigned integer scalar types
+// unsigned integer array types via std::vector
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(uint8 data)
+void
+Node::set_path_external_uint8_vector(const std::string &path,
+                                     std::vector<uint8> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external_uint8_vector(data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(uint16 data)
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<uint8> &data)
 {
-    set(data);
-    return *this;
+    set_path_external_uint8_vector(path,data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(uint32 data)
+void
+Node::set_path_external_uint16_vector(const std::string &path,
+                                      std::vector<uint16> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external_uint16_vector(data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(uint64 data)
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<uint16> &data)
 {
-    set(data);
-    return *this;
+    set_path_external_uint16_vector(path,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external_uint32_vector(const std::string &path,
+                                      std::vector<uint32> &data)
+{
+    fetch(path).set_external_uint32_vector(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<uint32> &data)
+{
+    set_path_external_uint32_vector(path,data);
+}
+
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external_uint64_vector(const std::string &path,
+                                      std::vector<uint64> &data)
+{
+    fetch(path).set_external_uint64_vector(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<uint64> &data)
+{
+    set_path_external_uint64_vector(path,data);
 }
 
 //-----------------------------------------------------------------------------
-// floating point scalar types
+// floating point array types via std::vector
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(float32 data)
+void
+Node::set_path_external_float32_vector(const std::string &path,
+                                       std::vector<float32> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external_float32_vector(data);
 }
 
 //---------------------------------------------------------------------------//
-Node &
-Node::operator=(float64 data)
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<float32> &data)
 {
-    set(data);
-    return *this;
+    set_path_external_float32_vector(path,data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external_float64_vector(const std::string &path,
+                                       std::vector<float64> &data)
+{
+    fetch(path).set_external_float64_vector(data);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_path_external(const std::string &path,
+                        std::vector<float64> &data)
+{
+    set_path_external_float64_vector(path,data);
 }
 
+
 //-----------------------------------------------------------------------------
-// assignment operator gap methods for scalar c-native types
+// set_path_external vector gap methods for c-native types
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(char data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<char> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(signed char data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<signed char> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(unsigned char data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned char> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
-
 //-----------------------------------------------------------------------------
 #endif // end use char check
 //-----------------------------------------------------------------------------
@@ -7536,19 +8826,19 @@ Node::operator=(unsigned char data)
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(short data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<short> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(unsigned short data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned short> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use short check
@@ -7557,19 +8847,19 @@ Node::operator=(unsigned short data)
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_INT
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(int data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<int> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(unsigned int data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned int> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use int check
@@ -7578,19 +8868,19 @@ Node::operator=(unsigned int data)
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(long data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<long> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(unsigned long data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned long> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long check
@@ -7599,19 +8889,19 @@ Node::operator=(unsigned long data)
 //-----------------------------------------------------------------------------
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(long long data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<long long> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(unsigned long long data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned long long> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use long long check
@@ -7620,11 +8910,11 @@ Node::operator=(unsigned long long data)
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(float data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<float> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use float check
@@ -7633,47 +8923,93 @@ Node::operator=(float data)
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
-Node &
-Node::operator=(double data)
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<double> &data)
 {
-    set(data);
-    return *this;
+    fetch(path).set_external(data);
 }
 //-----------------------------------------------------------------------------
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
+
+
 //-----------------------------------------------------------------------------
-// -- assignment operators for string types --
+//
+// -- end definition of Node set_path_external methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node assignment operators --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- assignment operators for generic types --
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::string &data)
+Node::operator=(const Node &node)
 {
-    set(data);
+    if(this != &node)
+    {
+        set(node);
+    }
     return *this;
 }
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const char *data)
+Node::operator=(Node &&node)
 {
-    set(data);
+    if(this == &node)
+    {
+        return *this;
+    }
+
+    // like the move constructor, a child of a frozen tree is copied
+    if(node.m_parent != NULL && node.m_parent->m_frozen)
+    {
+        set(node);
+    }
+    else
+    {
+        move(node);
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(const DataType &dtype)
+{
+    set(dtype);
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(const Schema &schema)
+{
+    set(schema);
     return *this;
 }
 
 //-----------------------------------------------------------------------------
-// -- assignment operators for conduit::DataArray types ---
+// --  assignment operators for scalar types ---
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer array types via conduit::DataArray
+// signed integer scalar types
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const int8_array &data)
+Node::operator=(int8 data)
 {
     set(data);
     return *this;
@@ -7681,7 +9017,7 @@ Node::operator=(const int8_array &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const int16_array &data)
+Node::operator=(int16 data)
 {
     set(data);
     return *this;
@@ -7689,7 +9025,7 @@ Node::operator=(const int16_array &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const int32_array &data)
+Node::operator=(int32 data)
 {
     set(data);
     return *this;
@@ -7697,19 +9033,20 @@ Node::operator=(const int32_array &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const int64_array &data)
+Node::operator=(int64 data)
 {
     set(data);
     return *this;
 }
 
+
 //-----------------------------------------------------------------------------
-// unsigned integer array types via conduit::DataArray
+// unsigned integer scalar types
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const uint8_array &data)
+Node::operator=(uint8 data)
 {
     set(data);
     return *this;
@@ -7717,7 +9054,7 @@ Node::operator=(const uint8_array &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const uint16_array &data)
+Node::operator=(uint16 data)
 {
     set(data);
     return *this;
@@ -7725,7 +9062,7 @@ Node::operator=(const uint16_array &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const uint32_array &data)
+Node::operator=(uint32 data)
 {
     set(data);
     return *this;
@@ -7733,19 +9070,19 @@ Node::operator=(const uint32_array &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const uint64_array &data)
+Node::operator=(uint64 data)
 {
     set(data);
     return *this;
 }
 
 //-----------------------------------------------------------------------------
-// floating point array types via conduit::DataArray
+// floating point scalar types
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const float32_array &data)
+Node::operator=(float32 data)
 {
     set(data);
     return *this;
@@ -7753,19 +9090,19 @@ Node::operator=(const float32_array &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const float64_array &data)
+Node::operator=(float64 data)
 {
     set(data);
     return *this;
 }
 
 //-----------------------------------------------------------------------------
-// assignment operator gap methods for data array c-native types
+// assignment operator gap methods for scalar c-native types
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const char_array &data)
+Node::operator=(char data)
 {
     set(data);
     return *this;
@@ -7775,7 +9112,7 @@ Node::operator=(const char_array &data)
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const signed_char_array &data)
+Node::operator=(signed char data)
 {
     set(data);
     return *this;
@@ -7783,11 +9120,12 @@ Node::operator=(const signed_char_array &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const unsigned_char_array &data)
+Node::operator=(unsigned char data)
 {
     set(data);
     return *this;
 }
+
 //-----------------------------------------------------------------------------
 #endif // end use char check
 //-----------------------------------------------------------------------------
@@ -7796,7 +9134,7 @@ Node::operator=(const unsigned_char_array &data)
 #ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const short_array &data)
+Node::operator=(short data)
 {
     set(data);
     return *this;
@@ -7804,7 +9142,7 @@ Node::operator=(const short_array &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const unsigned_short_array &data)
+Node::operator=(unsigned short data)
 {
     set(data);
     return *this;
@@ -7813,11 +9151,11 @@ Node::operator=(const unsigned_short_array &data)
 #endif // end use short check
 //-----------------------------------------------------------------------------
 
- //-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_INT
- //-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
 Node &
-Node::operator=(const int_array &data)
+Node::operator=(int data)
 {
     set(data);
     return *this;
@@ -7825,7 +9163,7 @@ Node::operator=(const int_array &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const unsigned_int_array &data)
+Node::operator=(unsigned int data)
 {
     set(data);
     return *this;
@@ -7838,7 +9176,7 @@ Node::operator=(const unsigned_int_array &data)
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const long_array &data)
+Node::operator=(long data)
 {
     set(data);
     return *this;
@@ -7846,7 +9184,7 @@ Node::operator=(const long_array &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const unsigned_long_array &data)
+Node::operator=(unsigned long data)
 {
     set(data);
     return *this;
@@ -7859,7 +9197,7 @@ Node::operator=(const unsigned_long_array &data)
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const long_long_array &data)
+Node::operator=(long long data)
 {
     set(data);
     return *this;
@@ -7867,7 +9205,7 @@ Node::operator=(const long_long_array &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const unsigned_long_long_array &data)
+Node::operator=(unsigned long long data)
 {
     set(data);
     return *this;
@@ -7880,7 +9218,7 @@ Node::operator=(const unsigned_long_long_array &data)
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const float_array &data)
+Node::operator=(float data)
 {
     set(data);
     return *this;
@@ -7893,7 +9231,7 @@ Node::operator=(const float_array &data)
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const double_array &data)
+Node::operator=(double data)
 {
     set(data);
     return *this;
@@ -7903,16 +9241,36 @@ Node::operator=(const double_array &data)
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// -- assignment operators for std::vector types ---
+// -- assignment operators for string types --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(const std::string &data)
+{
+    set(data);
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(const char *data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+// -- assignment operators for conduit::DataArray types ---
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// signed integer array types via std::vector
+// signed integer array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<int8> &data)
+Node::operator=(const int8_array &data)
 {
     set(data);
     return *this;
@@ -7920,7 +9278,7 @@ Node::operator=(const std::vector<int8> &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<int16> &data)
+Node::operator=(const int16_array &data)
 {
     set(data);
     return *this;
@@ -7928,7 +9286,7 @@ Node::operator=(const std::vector<int16> &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<int32> &data)
+Node::operator=(const int32_array &data)
 {
     set(data);
     return *this;
@@ -7936,19 +9294,19 @@ Node::operator=(const std::vector<int32> &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<int64> &data)
+Node::operator=(const int64_array &data)
 {
     set(data);
     return *this;
 }
 
 //-----------------------------------------------------------------------------
-// unsigned integer array types via std::vector
+// unsigned integer array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<uint8> &data)
+Node::operator=(const uint8_array &data)
 {
     set(data);
     return *this;
@@ -7956,7 +9314,7 @@ Node::operator=(const std::vector<uint8> &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<uint16> &data)
+Node::operator=(const uint16_array &data)
 {
     set(data);
     return *this;
@@ -7964,7 +9322,7 @@ Node::operator=(const std::vector<uint16> &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<uint32> &data)
+Node::operator=(const uint32_array &data)
 {
     set(data);
     return *this;
@@ -7972,19 +9330,19 @@ Node::operator=(const std::vector<uint32> &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<uint64> &data)
+Node::operator=(const uint64_array &data)
 {
     set(data);
     return *this;
 }
 
 //-----------------------------------------------------------------------------
-// floating point array types via std::vector
+// floating point array types via conduit::DataArray
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<float32> &data)
+Node::operator=(const float32_array &data)
 {
     set(data);
     return *this;
@@ -7992,19 +9350,19 @@ Node::operator=(const std::vector<float32> &data)
 
 //---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::vector<float64> &data)
+Node::operator=(const float64_array &data)
 {
     set(data);
     return *this;
 }
 
 //-----------------------------------------------------------------------------
-// assignment operator gap methods for vector c-native types
+// assignment operator gap methods for data array c-native types
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<char> &data)
+Node::operator=(const char_array &data)
 {
     set(data);
     return *this;
@@ -8014,7 +9372,7 @@ Node::operator=(const std::vector<char> &data)
 #ifndef CONDUIT_USE_CHAR
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<signed char> &data)
+Node::operator=(const signed_char_array &data)
 {
     set(data);
     return *this;
@@ -8022,7 +9380,7 @@ Node::operator=(const std::vector<signed char> &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<unsigned char> &data)
+Node::operator=(const unsigned_char_array &data)
 {
     set(data);
     return *this;
@@ -8035,7 +9393,7 @@ Node::operator=(const std::vector<unsigned char> &data)
 #ifndef CONDUIT_USE_SHORT
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<short> &data)
+Node::operator=(const short_array &data)
 {
     set(data);
     return *this;
@@ -8043,19 +9401,20 @@ Node::operator=(const std::vector<short> &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<unsigned short> &data)
+Node::operator=(const unsigned_short_array &data)
 {
     set(data);
     return *this;
-}//-----------------------------------------------------------------------------
+}
+//-----------------------------------------------------------------------------
 #endif // end use short check
 //-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
+ //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_INT
-//-----------------------------------------------------------------------------
+ //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<int> &data)
+Node::operator=(const int_array &data)
 {
     set(data);
     return *this;
@@ -8063,7 +9422,7 @@ Node::operator=(const std::vector<int> &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<unsigned int> &data)
+Node::operator=(const unsigned_int_array &data)
 {
     set(data);
     return *this;
@@ -8076,7 +9435,7 @@ Node::operator=(const std::vector<unsigned int> &data)
 #ifndef CONDUIT_USE_LONG
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<long> &data)
+Node::operator=(const long_array &data)
 {
     set(data);
     return *this;
@@ -8084,7 +9443,7 @@ Node::operator=(const std::vector<long> &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<unsigned long> &data)
+Node::operator=(const unsigned_long_array &data)
 {
     set(data);
     return *this;
@@ -8097,7 +9456,7 @@ Node::operator=(const std::vector<unsigned long> &data)
 #if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<long long> &data)
+Node::operator=(const long_long_array &data)
 {
     set(data);
     return *this;
@@ -8105,7 +9464,7 @@ Node::operator=(const std::vector<long long> &data)
 
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<unsigned long long> &data)
+Node::operator=(const unsigned_long_long_array &data)
 {
     set(data);
     return *this;
@@ -8114,12 +9473,11 @@ Node::operator=(const std::vector<unsigned long long> &data)
 #endif // end use long long check
 //-----------------------------------------------------------------------------
 
-
 //-----------------------------------------------------------------------------
 #ifndef CONDUIT_USE_FLOAT
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<float> &data)
+Node::operator=(const float_array &data)
 {
     set(data);
     return *this;
@@ -8132,7 +9490,7 @@ Node::operator=(const std::vector<float> &data)
 #ifndef CONDUIT_USE_DOUBLE
 //-----------------------------------------------------------------------------
 Node &
-Node::operator=(const std::vector<double> &data)
+Node::operator=(const double_array &data)
 {
     set(data);
     return *this;
@@ -8141,93 +9499,332 @@ Node::operator=(const std::vector<double> &data)
 #endif // end use double check
 //-----------------------------------------------------------------------------
 
-
-
-
-//-----------------------------------------------------------------------------
-// -- std::initializer_list support --
-
 //-----------------------------------------------------------------------------
-#ifdef CONDUIT_USE_CXX11
+// -- assignment operators for std::vector types ---
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// -- assignment operators for std::initializer_list types ---
+// signed integer array types via std::vector
 //-----------------------------------------------------------------------------
 
-
-// signed integer array types via std::initializer_list
-
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<int8> &data)
+Node::operator=(const std::vector<int8> &data)
 {
     set(data);
     return *this;
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<int16> &data)
+Node::operator=(const std::vector<int16> &data)
 {
     set(data);
     return *this;
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<int32> &data)
+Node::operator=(const std::vector<int32> &data)
 {
     set(data);
     return *this;
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<int64> &data)
+Node::operator=(const std::vector<int64> &data)
 {
     set(data);
     return *this;
 }
 
-// unsigned integer array types via std::initialize_list
-
 //-----------------------------------------------------------------------------
+// unsigned integer array types via std::vector
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<uint8> &data)
+Node::operator=(const std::vector<uint8> &data)
 {
     set(data);
     return *this;
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<uint16> &data)
+Node::operator=(const std::vector<uint16> &data)
 {
     set(data);
     return *this;
 }
-//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<uint32> &data)
+Node::operator=(const std::vector<uint32> &data)
 {
     set(data);
     return *this;
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<uint64> &data)
+Node::operator=(const std::vector<uint64> &data)
 {
     set(data);
     return *this;
 }
 
-// floating point array types via std::initializer_list
-
 //-----------------------------------------------------------------------------
+// floating point array types via std::vector
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 Node &
-Node::operator=(const std::initializer_list<float32> &data)
+Node::operator=(const std::vector<float32> &data)
+{
+    set(data);
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+Node::operator=(const std::vector<float64> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+// assignment operator gap methods for vector c-native types
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<char> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_CHAR
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<signed char> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<unsigned char> &data)
+{
+    set(data);
+    return *this;
+}
+//-----------------------------------------------------------------------------
+#endif // end use char check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_SHORT
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<short> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<unsigned short> &data)
+{
+    set(data);
+    return *this;
+}//-----------------------------------------------------------------------------
+#endif // end use short check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_INT
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<int> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<unsigned int> &data)
+{
+    set(data);
+    return *this;
+}
+//-----------------------------------------------------------------------------
+#endif // end use int check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_LONG
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<long> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<unsigned long> &data)
+{
+    set(data);
+    return *this;
+}
+//-----------------------------------------------------------------------------
+#endif // end use long check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<long long> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<unsigned long long> &data)
+{
+    set(data);
+    return *this;
+}
+//-----------------------------------------------------------------------------
+#endif // end use long long check
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_FLOAT
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<float> &data)
+{
+    set(data);
+    return *this;
+}
+//-----------------------------------------------------------------------------
+#endif // end use float check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_DOUBLE
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::vector<double> &data)
+{
+    set(data);
+    return *this;
+}
+//-----------------------------------------------------------------------------
+#endif // end use double check
+//-----------------------------------------------------------------------------
+
+
+
+
+//-----------------------------------------------------------------------------
+// -- std::initializer_list support --
+
+//-----------------------------------------------------------------------------
+#ifdef CONDUIT_USE_CXX11
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- assignment operators for std::initializer_list types ---
+//-----------------------------------------------------------------------------
+
+
+// signed integer array types via std::initializer_list
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<int8> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<int16> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<int32> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<int64> &data)
+{
+    set(data);
+    return *this;
+}
+
+// unsigned integer array types via std::initialize_list
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<uint8> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<uint16> &data)
+{
+    set(data);
+    return *this;
+}
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<uint32> &data)
+{
+    set(data);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<uint64> &data)
+{
+    set(data);
+    return *this;
+}
+
+// floating point array types via std::initializer_list
+
+//-----------------------------------------------------------------------------
+Node &
+Node::operator=(const std::initializer_list<float32> &data)
 {
     set(data);
     return *this;
@@ -8446,32 +10043,27 @@ Node::serialize(const std::string &stream_path) const
 void
 Node::serialize(std::ofstream &ofs) const
 {
-    index_t dtype_id = dtype().id();
-    if( dtype_id == DataType::OBJECT_ID ||
-        dtype_id == DataType::LIST_ID)
+    // runs of contiguous compact leaves are written with one call
+    NodeConstLeafIterator itr(*this, true);
+    while(itr.has_next())
     {
-        std::vector<Node*>::const_iterator itr;
-        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        const NodeConstLeafSpan &span = itr.next();
+        index_t nbytes = span.number_of_bytes();
+        if(nbytes <= 0)
         {
-            (*itr)->serialize(ofs);
+            continue;
         }
-    }
-    else if( dtype_id != DataType::EMPTY_ID)
-    {
-        if(is_compact())
+
+        if(span.is_compact())
         {
-            // ser as is. This copies stride * num_ele bytes
-            {
-                ofs.write((const char*)element_ptr(0),
-                          total_strided_bytes());
-            }
+            ofs.write((const char*)span.data(), nbytes);
         }
         else
         {
             // copy all elements
-            size_t c_num_bytes = (size_t) total_bytes_compact();
+            size_t c_num_bytes = (size_t) nbytes;
             uint8 *buffer = new uint8[c_num_bytes];
-            compact_elements_to(buffer);
+            span.leaf().compact_elements_to(buffer);
             ofs.write((const char*)buffer,c_num_bytes);
             delete [] buffer;
         }
@@ -8497,20 +10089,115 @@ Node::compact_to(Node &n_dest) const
 
     m_schema->compact_to(*n_dest.schema_ptr());
     uint8 *n_dest_data = (uint8*)n_dest.m_data;
-    compact_to(n_dest_data,0);
+    compact_to(n_dest_data,0,n_dest.m_allocator_id);
     // need node structure
-    walk_schema(&n_dest,n_dest.m_schema,n_dest_data,m_allocator_id);
+    walk_schema(&n_dest,n_dest.m_schema,n_dest_data,n_dest.m_allocator_id);
 }
 
 //-----------------------------------------------------------------------------
-// -- update methods ---
+// -- stream ordered copy methods ---
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-void
-Node::update(const Node &n_src)
+utils::AsyncCopyToken
+Node::set_async(const Node &n_src,
+                void *stream)
 {
-    // walk src and add it contents to this node
+    utils::AsyncCopyScope scope(stream);
+    set(n_src);
+    return scope.token();
+}
+
+//---------------------------------------------------------------------------//
+utils::AsyncCopyToken
+Node::compact_to_async(Node &n_dest,
+                       void *stream) const
+{
+    utils::AsyncCopyScope scope(stream);
+    compact_to(n_dest);
+    return scope.token();
+}
+
+//---------------------------------------------------------------------------//
+utils::AsyncCopyToken
+Node::update_async(const Node &n_src,
+                   void *stream)
+{
+    utils::AsyncCopyScope scope(stream);
+    update(n_src);
+    return scope.token();
+}
+
+//-----------------------------------------------------------------------------
+// -- update methods ---
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::update(const Node &n_src)
+{
+    check_not_frozen("update");
+    if(!update_contiguous(n_src))
+    {
+        update_tree(n_src);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::update_compatible(const Node &n_src)
+{
+    check_not_frozen("update_compatible");
+    if(!update_contiguous(n_src))
+    {
+        update_compatible_tree(n_src);
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::update_contiguous(const Node &n_src)
+{
+    // leaves already use a single (strided) copy
+    index_t dtype_id = n_src.dtype().id();
+    if( dtype_id != DataType::OBJECT_ID &&
+        dtype_id != DataType::LIST_ID)
+    {
+        return false;
+    }
+
+    // if both trees have the same layout of compact leaves and both are
+    // contiguous, updating each leaf is the same as one bulk copy
+    if(!detail::same_compact_layout(*this,n_src))
+    {
+        return false;
+    }
+
+    uint8 *dest_ptr = (uint8*)contiguous_data_ptr();
+    const uint8 *src_ptr = (const uint8*)n_src.contiguous_data_ptr();
+
+    if(dest_ptr == NULL || src_ptr == NULL)
+    {
+        return false;
+    }
+
+    if(dest_ptr != src_ptr)
+    {
+        invalidate_hash();
+        utils::conduit_memcpy(dest_ptr,
+                              src_ptr,
+                              (size_t)n_src.total_bytes_compact(),
+                              m_allocator_id,
+                              n_src.allocator());
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::update_tree(const Node &n_src)
+{
+    // walk src and add it contents to this node
     /// TODO:
     /// arrays and non empty leaves will simply overwrite the current
     /// node, these semantics seem sensible, but we could revisit this
@@ -8525,7 +10212,7 @@ Node::update(const Node &n_src)
             std::string ent_name = *itr;
             // note: this (add_child) will add or access existing child
             // ness b/c of keys with embedded slashes
-            add_child(ent_name).update(n_src.child(ent_name));
+            add_child(ent_name).update_tree(n_src.child(ent_name));
         }
     }
     else if( dtype_id == DataType::LIST_ID)
@@ -8541,7 +10228,7 @@ Node::update(const Node &n_src)
                 (idx < num_children && idx < src_num_children);
                 idx++)
             {
-                child(idx).update(n_src.child(idx));
+                child(idx).update_tree(n_src.child(idx));
                 src_idx++;
             }
         }
@@ -8549,7 +10236,7 @@ Node::update(const Node &n_src)
         // than the current node, use append to capture the nodes
         for(index_t idx = src_idx; idx < src_num_children;idx++)
         {
-            append().update(n_src.child(idx));
+            append().update_tree(n_src.child(idx));
         }
     }
     else if(dtype_id != DataType::EMPTY_ID) // TODO: Empty nodes not propagated?
@@ -8568,6 +10255,7 @@ Node::update(const Node &n_src)
             size_t stride     = (size_t) dtype().stride();
             size_t num_ele    = (size_t) n_src.dtype().number_of_elements();
             size_t src_stride = (size_t) n_src.dtype().stride();
+            invalidate_caches();
             //
             // Note: conduit_memcpy_strided_elements will use a single
             // memcpy when src and dest are compactly  strided
@@ -8576,7 +10264,9 @@ Node::update(const Node &n_src)
                                                    ele_bytes,            // dest bytes per ele
                                                    stride,               // dest stride
                                                    n_src.element_ptr(0), // src ptr
-                                                   src_stride);          // src stride
+                                                   src_stride,           // src stride
+                                                   m_allocator_id,       // dest allocator
+                                                   n_src.allocator());   // src allocator
         }
         else // not compatible
         {
@@ -8587,7 +10277,7 @@ Node::update(const Node &n_src)
 
 //---------------------------------------------------------------------------//
 void
-Node::update_compatible(const Node &n_src)
+Node::update_compatible_tree(const Node &n_src)
 {
     // walk src and copy contents to this node if their entries match
     index_t dtype_id = n_src.dtype().id();
@@ -8601,7 +10291,7 @@ Node::update_compatible(const Node &n_src)
             std::string ent_name = *itr;
             if(has_child(ent_name))
             {
-                child(ent_name).update_compatible(n_src.child(ent_name));
+                child(ent_name).update_compatible_tree(n_src.child(ent_name));
             }
         }
     }
@@ -8618,7 +10308,7 @@ Node::update_compatible(const Node &n_src)
                 (idx < num_children && idx < src_num_children);
                  idx++)
             {
-                child(idx).update_compatible(n_src.child(idx));
+                child(idx).update_compatible_tree(n_src.child(idx));
                 src_idx++;
             }
         }
@@ -8637,6 +10327,7 @@ Node::update_compatible(const Node &n_src)
             size_t stride     = (size_t) dtype().stride();
             size_t num_ele    = (size_t) n_src.dtype().number_of_elements();
             size_t src_stride = (size_t) n_src.dtype().stride();
+            invalidate_caches();
             //
             // Note: conduit_memcpy_strided_elements will use a single
             // memcpy when src and dest are compactly  strided
@@ -8645,7 +10336,9 @@ Node::update_compatible(const Node &n_src)
                                                    ele_bytes,            // dest bytes per ele
                                                    stride,               // dest stride
                                                    n_src.element_ptr(0), // src ptr
-                                                   src_stride);          // src stride
+                                                   src_stride,           // src stride
+                                                   m_allocator_id,       // dest allocator
+                                                   n_src.allocator());   // src allocator
         }
     }
 }
@@ -8700,6 +10393,45 @@ Node::update_external(Node &n_src)
     }
 }
 
+//---------------------------------------------------------------------------//
+ExternalLayout
+Node::bind_external_layout()
+{
+    ExternalLayout res;
+    res.m_root = this;
+
+    // depth-first walk, so leaves are bound in publish order
+    std::vector<Node*> stack;
+    stack.push_back(this);
+    while(!stack.empty())
+    {
+        Node *curr = stack.back();
+        stack.pop_back();
+
+        // skip subtrees that own, share, or map their data
+        if(curr->m_alloced || curr->m_mmaped || curr->m_shared != NULL ||
+           curr->m_compressed != NULL)
+        {
+            continue;
+        }
+
+        if(curr->dtype().is_object() || curr->dtype().is_list())
+        {
+            curr->materialize_children();
+            for(size_t i = curr->m_children.size(); i > 0; i--)
+            {
+                stack.push_back(curr->m_children[i-1]);
+            }
+        }
+        else if(!curr->dtype().is_empty() && curr->m_data != NULL)
+        {
+            res.m_leaves.push_back(curr);
+        }
+    }
+
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 // -- move and swap --
 //-----------------------------------------------------------------------------
@@ -8720,6 +10452,19 @@ Node::swap(Node &n_b)
     Schema *schema_a = m_schema;
     Schema *schema_b = n_b.m_schema;
 
+    // swapping a node inside a frozen tree would change that tree, swapping
+    // frozen root nodes is fine: the frozen state moves with the contents
+    if( (m_parent != NULL && m_parent->m_frozen) ||
+        (n_b.m_parent != NULL && n_b.m_parent->m_frozen) )
+    {
+        CONDUIT_ERROR("Cannot swap a child of a frozen Node");
+    }
+
+    // both nodes (and their ancestors) change content, the subtrees that
+    // trade places keep their cached hashes
+    invalidate_caches();
+    n_b.invalidate_caches();
+
     // check if node a has a parent Node
     if(this->parent() != NULL)
     {
@@ -8764,17 +10509,40 @@ Node::swap(Node &n_b)
     // if data is allocated or not
     // if data is memory mapped or not
     // memory map
+    // copy-on-write shared buffer
+    // compressed buffer
     // the allocator id
-    // any children
+    // any children (and if they are pending)
     std::swap(m_data,n_b.m_data);
     std::swap(m_data_size,n_b.m_data_size);
     std::swap(m_schema,n_b.m_schema);
     std::swap(m_alloced,n_b.m_alloced);
     std::swap(m_mmaped,n_b.m_mmaped);
     std::swap(m_mmap,n_b.m_mmap);
+    std::swap(m_shared,n_b.m_shared);
+    std::swap(m_compressed,n_b.m_compressed);
     std::swap(m_allocator_id,n_b.m_allocator_id);
+    // the schemas also trade places in their parent hierarchies
+    std::swap(schema_a->m_parent,schema_b->m_parent);
     // this should be an efficient O(1)
     std::swap(m_children,n_b.m_children);
+    std::swap(m_children_pending,n_b.m_children_pending);
+    std::swap(m_frozen,n_b.m_frozen);
+
+    // children need to point to their new parent
+    for(size_t i=0; i < m_children.size(); i++)
+    {
+        m_children[i]->m_parent = this;
+    }
+
+    for(size_t i=0; i < n_b.m_children.size(); i++)
+    {
+        n_b.m_children[i]->m_parent = &n_b;
+    }
+
+    // compressed buffers need to point to their new nodes
+    own_compressed_data();
+    n_b.own_compressed_data();
 
 }
 
@@ -8788,54 +10556,50 @@ Node::swap(Node &n_b)
 void
 Node::endian_swap(index_t endianness)
 {
-    index_t dtype_id = dtype().id();
-
-    if (dtype_id == DataType::OBJECT_ID || dtype_id == DataType::LIST_ID )
+    index_t dest_endian = endianness;
+    if(dest_endian == Endianness::DEFAULT_ID)
     {
-        for(index_t i=0;i<number_of_children();i++)
-        {
-            child(i).endian_swap(endianness);
-        }
+        dest_endian = Endianness::machine_default();
     }
-    else
-    {
-        index_t num_ele   = dtype().number_of_elements();
-        //note: we always use the default bytes type for endian swap
-        index_t ele_bytes = DataType::default_bytes(dtype_id);
 
-        index_t src_endian  = dtype().endianness();
-        index_t dest_endian = endianness;
+    check_not_frozen("endian_swap");
+    invalidate_hash();
 
-        if(src_endian == Endianness::DEFAULT_ID)
-        {
-            src_endian = Endianness::machine_default();
-        }
+    std::vector<detail::EndianSwapLeaf> leaves;
+    detail::gather_endian_swap_leaves(*this,dest_endian,leaves);
 
-        if(dest_endian == Endianness::DEFAULT_ID)
+    std::vector<detail::EndianSwapLeaf> small_leaves;
+    index_t small_leaves_eles = 0;
+    for(size_t i=0; i < leaves.size(); i++)
+    {
+        const detail::EndianSwapLeaf &leaf = leaves[i];
+        if(leaf.num_eles >= detail::ENDIAN_SWAP_LARGE_LEAF)
         {
-            dest_endian = Endianness::machine_default();
+            Endianness::swap_elements(leaf.data,
+                                      leaf.num_eles,
+                                      leaf.ele_bytes,
+                                      leaf.stride);
         }
-
-        if(src_endian != dest_endian)
+        else
         {
-            if(ele_bytes == 2)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap16(element_ptr(i));
-            }
-            else if(ele_bytes == 4)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap32(element_ptr(i));
-            }
-            else if(ele_bytes == 8)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap64(element_ptr(i));
-            }
+            small_leaves.push_back(leaf);
+            small_leaves_eles += leaf.num_eles;
         }
+    }
 
-        m_schema->dtype().set_endianness(dest_endian);
+    long num_small_leaves = (long)small_leaves.size();
+#if defined(CONDUIT_USE_OPENMP)
+    #pragma omp parallel for schedule(dynamic) \
+            if(num_small_leaves > 1 && \
+               small_leaves_eles >= detail::ENDIAN_SWAP_PARALLEL_THRESHOLD)
+#endif
+    for(long i=0; i < num_small_leaves; i++)
+    {
+        const detail::EndianSwapLeaf &leaf = small_leaves[(size_t)i];
+        Endianness::swap_elements(leaf.data,
+                                  leaf.num_eles,
+                                  leaf.ele_bytes,
+                                  leaf.stride);
     }
 }
 
@@ -12760,6 +14524,8 @@ Node::to_summary_string_stream(std::ostream &os,
                                const std::string &pad,
                                const std::string &eoe) const
 {
+    materialize_children();
+
     // rubber, say hello to the road:
 
     std::ios_base::fmtflags prev_stream_flags(os.flags());
@@ -13100,12 +14866,41 @@ Node::to_json_stream(std::ostream &os,
        eoe = opts["eoe"].as_string();
     }
 
-    to_json_stream(os,
-                   protocol,
-                   indent,
-                   depth,
-                   pad,
-                   eoe);
+    index_t float_precision = 15;
+    index_t base64_threshold = -1;
+
+    if(opts.has_child("float_precision") &&
+       opts["float_precision"].dtype().is_number())
+    {
+       float_precision = opts["float_precision"].to_index_t();
+    }
+
+    if(opts.has_child("base64_threshold") &&
+       opts["base64_threshold"].dtype().is_number())
+    {
+       base64_threshold = opts["base64_threshold"].to_index_t();
+    }
+
+    if(protocol == "json" || protocol == "conduit_json")
+    {
+        to_json_generic(os,
+                        protocol == "conduit_json",
+                        indent,
+                        depth,
+                        pad,
+                        eoe,
+                        float_precision,
+                        base64_threshold);
+    }
+    else
+    {
+        to_json_stream(os,
+                       protocol,
+                       indent,
+                       depth,
+                       pad,
+                       eoe);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -13246,12 +15041,33 @@ Node::to_yaml_stream(std::ostream &os,
        eoe = opts["eoe"].as_string();
     }
 
-    to_yaml_stream(os,
-                   protocol,
-                   indent,
-                   depth,
-                   pad,
-                   eoe);
+    index_t float_precision = 15;
+
+    if(opts.has_child("float_precision") &&
+       opts["float_precision"].dtype().is_number())
+    {
+       float_precision = opts["float_precision"].to_index_t();
+    }
+
+    if(protocol == "yaml")
+    {
+        to_yaml_generic(os,
+                        false,
+                        indent,
+                        depth,
+                        pad,
+                        eoe,
+                        float_precision);
+    }
+    else
+    {
+        to_yaml_stream(os,
+                       protocol,
+                       indent,
+                       depth,
+                       pad,
+                       eoe);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -13323,8 +15139,12 @@ Node::to_json_generic(std::ostream &os,
                       index_t indent,
                       index_t depth,
                       const std::string &pad,
-                      const std::string &eoe) const
+                      const std::string &eoe,
+                      index_t float_precision,
+                      index_t base64_threshold) const
 {
+    materialize_children();
+
     std::ios_base::fmtflags prev_stream_flags(os.flags());
     os.precision(15);
     if(dtype().id() == DataType::OBJECT_ID)
@@ -13343,7 +15163,9 @@ Node::to_json_generic(std::ostream &os,
                                            indent,
                                            depth+1,
                                            pad,
-                                           eoe);
+                                           eoe,
+                                           float_precision,
+                                           base64_threshold);
             if(i < nchildren-1)
                 os << ",";
             os << eoe;
@@ -13366,7 +15188,9 @@ Node::to_json_generic(std::ostream &os,
                                            indent,
                                            depth+1,
                                            pad,
-                                           eoe);
+                                           eoe,
+                                           float_precision,
+                                           base64_threshold);
             if(i < nchildren-1)
                 os << ",";
             os << eoe;
@@ -13399,52 +15223,63 @@ Node::to_json_generic(std::ostream &os,
             os << "\"value\": ";
         }
 
-        switch(dtype().id())
+        if(detailed &&
+           base64_threshold >= 0 &&
+           dtype().is_number() &&
+           dtype().bytes_compact() > base64_threshold)
         {
-            // ints
-            case DataType::INT8_ID:
-                as_int8_array().to_json_stream(os);
-                break;
-            case DataType::INT16_ID:
-                as_int16_array().to_json_stream(os);
-                break;
-            case DataType::INT32_ID:
-                as_int32_array().to_json_stream(os);
-                break;
-            case DataType::INT64_ID:
-                as_int64_array().to_json_stream(os);
-                break;
-            // uints
-            case DataType::UINT8_ID:
-                as_uint8_array().to_json_stream(os);
-                break;
-            case DataType::UINT16_ID:
-                as_uint16_array().to_json_stream(os);
-                break;
-            case DataType::UINT32_ID:
-                as_uint32_array().to_json_stream(os);
-                break;
-            case DataType::UINT64_ID:
-                as_uint64_array().to_json_stream(os);
-                break;
-            // floats
-            case DataType::FLOAT32_ID:
-                as_float32_array().to_json_stream(os);
-                break;
-            case DataType::FLOAT64_ID:
-                as_float64_array().to_json_stream(os);
-                break;
-            // char8_str
-            case DataType::CHAR8_STR_ID:
-                os << "\""
-                   << utils::escape_special_chars(as_string())
-                   << "\"";
-                break;
-            // empty
-            case DataType::EMPTY_ID:
-                os << "null";
-                break;
+            // large leaf, use a base64 encoded copy of the compact data
+            to_base64_json_value(os);
+        }
+        else
+        {
+            switch(dtype().id())
+            {
+                // ints
+                case DataType::INT8_ID:
+                    as_int8_array().to_json_stream(os,float_precision);
+                    break;
+                case DataType::INT16_ID:
+                    as_int16_array().to_json_stream(os,float_precision);
+                    break;
+                case DataType::INT32_ID:
+                    as_int32_array().to_json_stream(os,float_precision);
+                    break;
+                case DataType::INT64_ID:
+                    as_int64_array().to_json_stream(os,float_precision);
+                    break;
+                // uints
+                case DataType::UINT8_ID:
+                    as_uint8_array().to_json_stream(os,float_precision);
+                    break;
+                case DataType::UINT16_ID:
+                    as_uint16_array().to_json_stream(os,float_precision);
+                    break;
+                case DataType::UINT32_ID:
+                    as_uint32_array().to_json_stream(os,float_precision);
+                    break;
+                case DataType::UINT64_ID:
+                    as_uint64_array().to_json_stream(os,float_precision);
+                    break;
+                // floats
+                case DataType::FLOAT32_ID:
+                    as_float32_array().to_json_stream(os,float_precision);
+                    break;
+                case DataType::FLOAT64_ID:
+                    as_float64_array().to_json_stream(os,float_precision);
+                    break;
+                // char8_str
+                case DataType::CHAR8_STR_ID:
+                    os << "\""
+                       << utils::escape_special_chars(as_string())
+                       << "\"";
+                    break;
+                // empty
+                case DataType::EMPTY_ID:
+                    os << "null";
+                    break;
 
+            }
         }
 
         if(detailed)
@@ -13591,19 +15426,7 @@ Node::to_base64_json(std::ostream &os,
     Node n;
     compact_to(n);
 
-    // use libb64 to encode the data
     index_t nbytes = n.schema().spanned_bytes();
-    index_t enc_buff_size =  utils::base64_encode_buffer_size(nbytes);
-    Node bb64_data;
-    bb64_data.set(DataType::char8_str(enc_buff_size));
-
-    // since we use compact_to(n) above, the data will always compact
-    // and on the host, so we can use it directly in utils::base64_encode
-    const char *src_ptr = (const char*)n.data_ptr();
-    char *dest_ptr       = (char*)bb64_data.data_ptr();
-    utils::conduit_memset(dest_ptr,0,(size_t)enc_buff_size);
-
-    utils::base64_encode(src_ptr,nbytes,dest_ptr);
 
     // create the resulting json
 
@@ -13622,9 +15445,11 @@ Node::to_base64_json(std::ostream &os,
     utils::indent(os,indent,depth+1,pad);
     os << "{" << eoe;
     utils::indent(os,indent,depth+2,pad);
-    os << "\"base64\": ";
-    bb64_data.to_pure_json(os,0,0,"","");
-    os << eoe;
+    os << "\"base64\": \"";
+    // since we use compact_to(n) above, the data will always compact
+    // and on the host, so we can encode it directly to the stream
+    utils::base64_encode_stream(n.data_ptr(),nbytes,os);
+    os << "\"" << eoe;
     utils::indent(os,indent,depth+1,pad);
     os << "}" << eoe;
     utils::indent(os,indent,depth,pad);
@@ -13633,6 +15458,19 @@ Node::to_base64_json(std::ostream &os,
     os.flags(prev_stream_flags);
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::to_base64_json_value(std::ostream &os) const
+{
+    // encode a compact copy of this leaf's data
+    Node n;
+    compact_to(n);
+
+    os << "{\"base64\": \"";
+    utils::base64_encode_stream(n.data_ptr(),n.dtype().bytes_compact(),os);
+    os << "\"}";
+}
+
 //---------------------------------------------------------------------------//
 // Private to_yaml helpers
 //---------------------------------------------------------------------------//
@@ -13680,8 +15518,11 @@ Node::to_yaml_generic(std::ostream &os,
                       index_t indent,
                       index_t depth,
                       const std::string &pad,
-                      const std::string &eoe) const
+                      const std::string &eoe,
+                      index_t float_precision) const
 {
+    materialize_children();
+
     std::ios_base::fmtflags prev_stream_flags(os.flags());
     os.precision(15);
     if(dtype().id() == DataType::OBJECT_ID)
@@ -13697,7 +15538,8 @@ Node::to_yaml_generic(std::ostream &os,
                                            indent,
                                            depth+1,
                                            pad,
-                                           eoe);
+                                           eoe,
+                                           float_precision);
 
             // if the child is a leaf, we need eoe
             if(m_children[i]->number_of_children() == 0)
@@ -13717,7 +15559,8 @@ Node::to_yaml_generic(std::ostream &os,
                                            indent,
                                            depth+1,
                                            pad,
-                                           eoe);
+                                           eoe,
+                                           float_precision);
 
             // if the child is a leaf, we need eoe
             if(m_children[i]->number_of_children() == 0)
@@ -13730,36 +15573,36 @@ Node::to_yaml_generic(std::ostream &os,
         {
             // ints
             case DataType::INT8_ID:
-                as_int8_array().to_json_stream(os);
+                as_int8_array().to_json_stream(os,float_precision);
                 break;
             case DataType::INT16_ID:
-                as_int16_array().to_json_stream(os);
+                as_int16_array().to_json_stream(os,float_precision);
                 break;
             case DataType::INT32_ID:
-                as_int32_array().to_json_stream(os);
+                as_int32_array().to_json_stream(os,float_precision);
                 break;
             case DataType::INT64_ID:
-                as_int64_array().to_json_stream(os);
+                as_int64_array().to_json_stream(os,float_precision);
                 break;
             // uints
             case DataType::UINT8_ID:
-                as_uint8_array().to_json_stream(os);
+                as_uint8_array().to_json_stream(os,float_precision);
                 break;
             case DataType::UINT16_ID:
-                as_uint16_array().to_json_stream(os);
+                as_uint16_array().to_json_stream(os,float_precision);
                 break;
             case DataType::UINT32_ID:
-                as_uint32_array().to_json_stream(os);
+                as_uint32_array().to_json_stream(os,float_precision);
                 break;
             case DataType::UINT64_ID:
-                as_uint64_array().to_json_stream(os);
+                as_uint64_array().to_json_stream(os,float_precision);
                 break;
             // floats
             case DataType::FLOAT32_ID:
-                as_float32_array().to_json_stream(os);
+                as_float32_array().to_json_stream(os,float_precision);
                 break;
             case DataType::FLOAT64_ID:
-                as_float64_array().to_json_stream(os);
+                as_float64_array().to_json_stream(os,float_precision);
                 break;
             // char8_str
             case DataType::CHAR8_STR_ID:
@@ -13843,158 +15686,235 @@ Node::describe(Node &res) const
 void
 Node::describe(const Node &opts, Node &res) const
 {
-    res.reset();
-    index_t dtype_id = dtype().id();
-    if(dtype_id == DataType::OBJECT_ID)
+    index_t thresh = 5;
+    if(opts.has_child("threshold"))
     {
-        NodeConstIterator itr = children();
-        while(itr.has_next())
-        {
-            const Node &cld = itr.next();
-            std::string cld_name = itr.name();
-            Node &cld_des = res[cld_name];
-            cld.describe(opts,cld_des);
-        }
+        thresh = (index_t) opts["threshold"].to_int();
     }
-    else if(dtype_id == DataType::LIST_ID)
+
+    index_t sample = 0;
+    if(opts.has_child("sample"))
     {
-        NodeConstIterator itr = children();
-        while(itr.has_next())
-        {
-            const Node &cld = itr.next();
-            Node &cld_des = res.append();
-            cld.describe(opts,cld_des);
-        }
+        sample = opts["sample"].to_index_t();
     }
-    else // leaves!
-    {
-        index_t thresh = 5;
 
-        if(opts.has_child("threshold"))
-        {
-            thresh = (index_t) opts["threshold"].to_int();
-        }
+    index_t num_threads = detail::num_threads_option(opts);
 
-        res["dtype"] = DataType::id_to_name(dtype_id);
-        // The term `count` is used in r and pandas world
-        // so we prefer it over `number_of_elements`
-        res["count"] = dtype().number_of_elements();
+    // build the result tree, then fill in the stats of the numeric leaves
+    std::vector<detail::LeafDescribe> leaves;
+    detail::describe_tree(*this, thresh, sample, res, leaves);
 
-        if(dtype().is_int8())
-        {
-            int8_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_int16())
-        {
-            int16_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_int32())
-        {
-            int32_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_int64())
-        {
-            int64_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_uint8())
-        {
-            uint8_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_uint16())
-        {
-            uint16_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_uint32())
-        {
-            uint32_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_uint64())
-        {
-            uint64_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_float32())
-        {
-            float32_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_float64())
-        {
-            float64_array t_array = value();
-            res["mean"] = t_array.mean();
-            res["min"]  = t_array.min();
-            res["max"]  = t_array.max();
-            res["values"] = t_array.to_summary_string(thresh);
-        }
-        else if(dtype().is_char8_str())
-        {
-            res["values"].set_external(*this);
-        }
-    }
+    detail::parallel_for((index_t)leaves.size(), num_threads, [&](index_t i)
+    {
+        const detail::LeafDescribe &leaf = leaves[(size_t)i];
+        dispatch(leaf.m_node, leaf);
+    });
 }
 
 
-// NOTE: several other Node information methods are inlined in Node.h
-
 //---------------------------------------------------------------------------//
-void
-Node::info(Node &res) const
+uint64
+Node::hash() const
 {
-    res.reset();
-    info(res,std::string());
-
-    // add summary
-    res["total_bytes_allocated"] = total_bytes_allocated();
-    res["total_bytes_mmaped"]    = total_bytes_mmaped();
-    res["total_bytes_compact"]   = total_bytes_compact();
-    res["total_strided_bytes"]   = total_strided_bytes();
+    uint64 res = 0;
+    hash_tree(true,0,1,1,false,&res);
+    return res;
 }
 
 //---------------------------------------------------------------------------//
-Node
-Node::info()const
+uint64
+Node::hash(const Node &opts) const
 {
-    // NOTE: this very inefficient w/o move semantics!
     Node res;
-    info(res);
-    return res;
+    hash(opts,res);
+    return res.as_uint64_ptr()[0];
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
+void
+Node::hash(const Node &opts,
+           Node &res) const
+{
+    bool    data   = detail::hash_option_flag(opts,"data",true);
+    bool    cache  = detail::hash_option_flag(opts,"cache",false);
+    uint64  seed   = 0;
+    index_t num_words   = 1;
+    index_t num_threads = detail::num_threads_option(opts);
+
+    if(opts.has_child("seed"))
+    {
+        seed = opts["seed"].to_uint64();
+    }
+
+    if(opts.has_child("bits"))
+    {
+        index_t bits = opts["bits"].to_index_t();
+        if(bits != 64 && bits != 128)
+        {
+            CONDUIT_ERROR("<Node::hash> unsupported bits: " << bits
+                          << " (expected: 64 or 128)");
+        }
+        num_words = bits / 64;
+    }
+
+    uint64 words[detail::HASH_MAX_WORDS];
+    hash_tree(data,seed,num_words,num_threads,cache,words);
+
+    res.reset();
+    res.set(DataType::uint64(num_words));
+    uint64 *res_ptr = res.as_uint64_ptr();
+    for(index_t w = 0; w < num_words; w++)
+    {
+        res_ptr[w] = words[w];
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::invalidate_hash()
+{
+    invalidate_caches();
+    invalidate_hash_descendants();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::freeze()
+{
+    // create any pending children, so const access never creates nodes
+    materialize_children();
+    // reading compressed leaves updates the decompressed cache, so they
+    // are decompressed first (once, from the top of the frozen subtree)
+    if(m_parent == NULL || !m_parent->m_frozen)
+    {
+        decompress();
+    }
+    // compute the cached sizes, so they are available while frozen
+    StatsCache stats;
+    stats_tree(true,stats);
+    m_frozen = true;
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        m_children[i]->freeze();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::compress()
+{
+    Node opts;
+    compress(opts);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::compress(const Node &opts)
+{
+    check_not_frozen("compress");
+
+    std::string method = "lz";
+    if(opts.has_child("method"))
+    {
+        method = opts["method"].as_string();
+    }
+
+    if(!compression::supports_method(method))
+    {
+        CONDUIT_ERROR("<Node::compress> unsupported method '" << method
+                      << "' (supported methods: \"lz\")");
+    }
+
+    bool shuffle = detail::hash_option_flag(opts,"shuffle",true);
+
+    index_t threshold = 4096;
+    if(opts.has_child("threshold"))
+    {
+        threshold = opts["threshold"].to_index_t();
+    }
+
+    compress_tree(method, shuffle, threshold);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::decompress()
+{
+    // frozen nodes are never compressed, and decompressing doesn't
+    // change the data a node presents
+    if(m_compressed != NULL)
+    {
+        thaw_compressed_data();
+    }
+
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        m_children[i]->decompress();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::unfreeze()
+{
+    if(m_parent != NULL && m_parent->m_frozen)
+    {
+        CONDUIT_ERROR("Cannot unfreeze Node(" << path() << ")"
+                      << " because its parent is frozen");
+    }
+
+    m_frozen = false;
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        m_children[i]->unfreeze();
+    }
+}
+
+// NOTE: several other Node information methods are inlined in Node.h
+
+//---------------------------------------------------------------------------//
+void
+Node::info(Node &res) const
+{
+    Node opts;
+    info(opts,res);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::info(const Node &opts, Node &res) const
+{
+    bool summary = detail::hash_option_flag(opts,"summary",false);
+    bool cache   = detail::hash_option_flag(opts,"cache",false);
+
+    res.reset();
+    if(!summary)
+    {
+        info(res,std::string());
+    }
+
+    // add summary
+    StatsCache stats;
+    stats_tree(cache,stats);
+    res["total_bytes_allocated"] = stats.bytes_allocated;
+    res["total_bytes_mmaped"]    = stats.bytes_mmaped;
+    res["total_bytes_shared"]    = stats.bytes_shared;
+    res["total_bytes_compressed"] = stats.bytes_compressed;
+    res["total_bytes_compact"]   = stats.bytes_compact;
+    res["total_strided_bytes"]   = stats.strided_bytes;
+}
+
+//---------------------------------------------------------------------------//
+Node
+Node::info()const
+{
+    // returned by move (or elided), so no deep copy of the info tree
+    Node res;
+    info(res);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
 // -- stdout print methods ---
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -14041,21 +15961,71 @@ Node::children() const
     return NodeConstIterator(this);
 }
 
+//---------------------------------------------------------------------------//
+NodeLeafIterator
+Node::leaves(bool coalesce)
+{
+    return NodeLeafIterator(*this, coalesce);
+}
+
+//---------------------------------------------------------------------------//
+NodeConstLeafIterator
+Node::leaves(bool coalesce) const
+{
+    return NodeConstLeafIterator(*this, coalesce);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::for_each_leaf(const std::function<void(const NodeLeafSpan&)> &func)
+{
+    detail::for_each_leaf(*this, func, Node());
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::for_each_leaf(const std::function<void(const NodeLeafSpan&)> &func,
+                    const Node &opts)
+{
+    detail::for_each_leaf(*this, func, opts);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::for_each_leaf(
+    const std::function<void(const NodeConstLeafSpan&)> &func) const
+{
+    detail::for_each_leaf(*this, func, Node());
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::for_each_leaf(
+    const std::function<void(const NodeConstLeafSpan&)> &func,
+    const Node &opts) const
+{
+    detail::for_each_leaf(*this, func, opts);
+}
+
 //---------------------------------------------------------------------------//
 Node&
 Node::add_child(const std::string &name)
 {
+    materialize_children();
+
     if(has_child(name))
     {
         return child(name);
     }
 
+    check_not_frozen("add_child");
     Schema &child_schema = m_schema->add_child(name);
     Schema *child_ptr = &child_schema;
     Node *child_node = new Node();
     child_node->set_allocator(m_allocator_id);
     child_node->set_schema_ptr(child_ptr);
     child_node->m_parent = this;
+    invalidate_caches();
     m_children.push_back(child_node);
     return  *m_children[m_children.size() - 1];
 }
@@ -14064,6 +16034,8 @@ Node::add_child(const std::string &name)
 const Node&
 Node::child(const std::string &name) const
 {
+    materialize_children();
+
     if(!m_schema->has_child(name))
     {
         CONDUIT_ERROR("Cannot access non-existent "
@@ -14079,6 +16051,8 @@ Node::child(const std::string &name) const
 Node&
 Node::child(const std::string &name)
 {
+    materialize_children();
+
     if(!m_schema->has_child(name))
     {
         CONDUIT_ERROR("Cannot access non-existent "
@@ -14095,6 +16069,8 @@ Node::child(const std::string &name)
 const Node&
 Node::fetch_existing(const std::string &path) const
 {
+    materialize_children();
+
     // const fetch_existing w/ path requires object role
     if(!dtype().is_object())
     {
@@ -14144,6 +16120,8 @@ Node::fetch_existing(const std::string &path) const
 Node&
 Node::fetch_existing(const std::string &path)
 {
+    materialize_children();
+
     // fetch_existing w/ path requires object role
     if(!dtype().is_object())
     {
@@ -14198,6 +16176,8 @@ Node::fetch_existing(const std::string &path)
 Node&
 Node::fetch(const std::string &path)
 {
+    materialize_children();
+
     // fetch w/ path forces OBJECT_ID
     if(!dtype().is_object())
     {
@@ -14238,6 +16218,7 @@ Node::fetch(const std::string &path)
     size_t idx;
     if(!m_schema->has_child(p_curr))
     {
+        check_not_frozen("fetch");
         Schema *schema_ptr = m_schema->fetch_ptr(p_curr);
         Node *curr_node = new Node();
         curr_node->set_allocator(m_allocator_id);
@@ -14245,6 +16226,7 @@ Node::fetch(const std::string &path)
         curr_node->m_parent = this;
         // current allocator is inherited
         curr_node->set_allocator(m_allocator_id);
+        invalidate_caches();
         m_children.push_back(curr_node);
         idx = m_children.size() - 1;
     }
@@ -14271,11 +16253,128 @@ Node::fetch(const std::string &path) const
     return fetch_existing(path);
 }
 
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch(const Path &path)
+{
+    if(path.is_empty())
+    {
+        CONDUIT_ERROR("Cannot fetch empty path");
+    }
+
+    Node *curr = this;
+    index_t nsegs = path.number_of_segments();
+    for(index_t i=0; i < nsegs; i++)
+    {
+        // fetch w/ path forces OBJECT_ID
+        if(!curr->dtype().is_object())
+        {
+            curr->init(DataType::object());
+        }
+
+        const std::string &p_curr = path.m_segments[(size_t)i];
+
+        // check for parent
+        if(p_curr == "..")
+        {
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch from NULL parent"
+                              << path.to_string());
+            }
+            curr = curr->m_parent;
+            continue;
+        }
+
+        index_t idx = path.child_index(*curr->m_schema,i);
+
+        // if this node doesn't exist yet, we need to create it
+        if(idx < 0)
+        {
+            curr = &curr->add_child(p_curr);
+        }
+        else
+        {
+            curr->materialize_children();
+            curr = curr->m_children[(size_t)idx];
+        }
+    }
+
+    return *curr;
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch(const Path &path) const
+{
+    return fetch_existing(path);
+}
+
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch_existing(const Path &path)
+{
+    const Node &res = static_cast<const Node&>(*this).fetch_existing(path);
+    return const_cast<Node&>(res);
+}
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch_existing(const Path &path) const
+{
+    if(path.is_empty())
+    {
+        CONDUIT_ERROR("Cannot fetch_existing empty path");
+    }
+
+    const Node *curr = this;
+    index_t nsegs = path.number_of_segments();
+    for(index_t i=0; i < nsegs; i++)
+    {
+        // fetch_existing w/ path requires object role
+        if(!curr->dtype().is_object())
+        {
+            CONDUIT_ERROR("Cannot fetch_existing, Node(" << curr->path()
+                          << ") is not an object");
+        }
+
+        const std::string &p_curr = path.m_segments[(size_t)i];
+
+        // check for parent
+        if(p_curr == "..")
+        {
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch_existing from NULL parent"
+                              << path.to_string());
+            }
+            curr = curr->m_parent;
+            continue;
+        }
+
+        index_t idx = path.child_index(*curr->m_schema,i);
+        if(idx < 0)
+        {
+            CONDUIT_ERROR("Cannot fetch non-existent "
+                          << "child \"" << p_curr << "\" from Node("
+                          << curr->path()
+                          << ")");
+        }
+
+        curr->materialize_children();
+        curr = curr->m_children[(size_t)idx];
+    }
+
+    return *curr;
+}
+
 
 //---------------------------------------------------------------------------//
 Node&
 Node::child(index_t idx)
 {
+    materialize_children();
+
     if( ((size_t) idx) >= m_children.size())
     {
         CONDUIT_ERROR("Invalid child index: " << idx <<
@@ -14289,6 +16388,8 @@ Node::child(index_t idx)
 const Node&
 Node::child(index_t idx) const
 {
+    materialize_children();
+
     if( ((size_t) idx) >= m_children.size())
     {
         CONDUIT_ERROR("Invalid child index: " << idx <<
@@ -14397,6 +16498,39 @@ Node::has_path(const std::string &path) const
     return m_schema->has_path(path);
 }
 
+//---------------------------------------------------------------------------//
+bool
+Node::has_path(const Path &path) const
+{
+    // for consistency with the string case, empty paths don't exist
+    if(path.is_empty())
+    {
+        return false;
+    }
+
+    const Node *curr = this;
+    index_t nsegs = path.number_of_segments();
+    for(index_t i=0; i < nsegs; i++)
+    {
+        // for the non-object case, has_path simply returns false
+        if(!curr->dtype().is_object())
+        {
+            return false;
+        }
+
+        index_t idx = path.child_index(*curr->m_schema,i);
+        if(idx < 0)
+        {
+            return false;
+        }
+
+        curr->materialize_children();
+        curr = curr->m_children[(size_t)idx];
+    }
+
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 const std::vector<std::string>&
 Node::child_names() const
@@ -14408,6 +16542,9 @@ Node::child_names() const
 Node &
 Node::append()
 {
+    check_not_frozen("append");
+    materialize_children();
+
     init_list();
     index_t idx = m_children.size();
     //
@@ -14420,51 +16557,126 @@ Node::append()
     res_node->set_allocator(m_allocator_id);
     res_node->set_schema_ptr(schema_ptr);
     res_node->m_parent=this;
+    invalidate_caches();
     m_children.push_back(res_node);
     return *res_node;
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::remove(index_t idx)
+Node::build_from_paths(const std::vector<PathEntry> &entries,
+                       bool external)
 {
-    // note: we must remove the child pointer before the
-    // schema. b/c the child pointer uses the schema
-    // to cleanup
+    check_not_frozen("build_from_paths");
+    reset();
+    if(entries.empty())
+    {
+        return;
+    }
 
-    // remove the proper list entry
-    delete m_children[(size_t)idx];
-    m_schema->remove(idx);
-    m_children.erase(m_children.begin() + (size_t)idx);
+    std::vector<detail::PathTrieNode> trie;
+    detail::build_path_trie(entries, trie);
+
+    if(external)
+    {
+        detail::build_path_trie_external(entries, trie, 0, *this);
+        return;
+    }
+
+    // one allocation holds all leaves in their compact layout
+    Schema schema;
+    index_t curr_offset = 0;
+    detail::build_path_trie_schema(entries, trie, 0, schema, curr_offset);
+    allocate_using_schema(schema);
+    detail::build_path_trie_copy(entries, trie, 0, *this);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::remove(const std::string &path)
+Node::reserve_children(index_t num_children)
 {
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
+    check_not_frozen("reserve_children");
+    materialize_children();
 
-    if(!p_next.empty())
-    {
-        size_t idx= (size_t) m_schema->child_index(p_curr);
-        m_children[idx]->remove(p_next);
-    }
-    else
+    if(dtype().is_empty())
     {
-        remove_child(p_curr);
+        init_list();
     }
+
+    // the schema checks for object or list
+    m_schema->reserve_children(num_children);
+    m_children.reserve((size_t)num_children);
 }
 
 //---------------------------------------------------------------------------//
-void
-Node::remove_child(const std::string &name)
+index_t
+Node::values_capacity() const
 {
-   size_t idx= (size_t) m_schema->child_index(name);
+    const DataType &dt = dtype();
+    if(!dt.is_number() && !dt.is_string())
+    {
+        return 0;
+    }
+    // only compact leaves that own their allocation have spare capacity
+    if(m_alloced && dt.is_compact() && dt.offset() == 0 &&
+       dt.element_bytes() > 0)
+    {
+        return m_data_size / dt.element_bytes();
+    }
+    return dt.number_of_elements();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::remove(index_t idx)
+{
+    materialize_children();
+
+    // note: we must remove the child pointer before the
+    // schema. b/c the child pointer uses the schema
+    // to cleanup
+
+    // remove the proper list entry
+    check_not_frozen("remove");
+    invalidate_caches();
+    delete m_children[(size_t)idx];
+    m_schema->remove(idx);
+    m_children.erase(m_children.begin() + (size_t)idx);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::remove(const std::string &path)
+{
+    materialize_children();
+
+    std::string p_curr;
+    std::string p_next;
+    utils::split_path(path,p_curr,p_next);
+
+    if(!p_next.empty())
+    {
+        size_t idx= (size_t) m_schema->child_index(p_curr);
+        m_children[idx]->remove(p_next);
+    }
+    else
+    {
+        remove_child(p_curr);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::remove_child(const std::string &name)
+{
+    materialize_children();
+
+   size_t idx= (size_t) m_schema->child_index(name);
    // note: we must remove the child pointer before the
    // schema. b/c the child pointer uses the schema
    // to cleanup
+   check_not_frozen("remove_child");
+   invalidate_caches();
    delete m_children[idx];
    m_schema->remove_child(name);
    m_children.erase(m_children.begin() + idx);
@@ -14477,6 +16689,8 @@ Node::rename_child(const std::string &current_name,
 {
     // this is a pass through to the schema,
     // which handles all the book keeping related to child rename
+    check_not_frozen("rename_child");
+    invalidate_caches();
     m_schema->rename_child(current_name,new_name);
 }
 
@@ -14939,6 +17153,7 @@ Node::as_int8_array()
                         DataType::INT8_ID,
                         "as_int8_array()",
                         int8_array());
+    unshare_data();
     return int8_array(m_data,dtype());
 }
 
@@ -14950,6 +17165,7 @@ Node::as_int16_array()
                         DataType::INT16_ID,
                         "as_int16_array()",
                         int16_array());
+    unshare_data();
     return int16_array(m_data,dtype());
 }
 
@@ -14961,6 +17177,7 @@ Node::as_int32_array()
                         DataType::INT32_ID,
                         "as_int32_array()",
                         int32_array());
+    unshare_data();
     return int32_array(m_data,dtype());
 }
 
@@ -14972,6 +17189,7 @@ Node::as_int64_array()
                         DataType::INT64_ID,
                         "as_int64_array()",
                         int64_array());
+    unshare_data();
     return int64_array(m_data,dtype());
 }
 
@@ -14987,6 +17205,7 @@ Node::as_uint8_array()
                         DataType::UINT8_ID,
                         "as_uint8_array()",
                         uint8_array());
+    unshare_data();
     return uint8_array(m_data,dtype());
 }
 
@@ -14998,6 +17217,7 @@ Node::as_uint16_array()
                         DataType::UINT16_ID,
                         "as_uint16_array()",
                         uint16_array());
+    unshare_data();
     return uint16_array(m_data,dtype());
 }
 
@@ -15009,6 +17229,7 @@ Node::as_uint32_array()
                         DataType::UINT32_ID,
                         "as_uint32_array()",
                         uint32_array());
+    unshare_data();
     return uint32_array(m_data,dtype());
 }
 
@@ -15020,6 +17241,7 @@ Node::as_uint64_array()
                         DataType::UINT64_ID,
                         "as_uint64_array()",
                         uint64_array());
+    unshare_data();
     return uint64_array(m_data,dtype());
 }
 
@@ -15035,6 +17257,7 @@ Node::as_float32_array()
                         DataType::FLOAT32_ID,
                         "as_float32_array()",
                         float32_array());
+    unshare_data();
     return float32_array(m_data,dtype());
 }
 
@@ -15046,6 +17269,7 @@ Node::as_float64_array()
                         DataType::FLOAT64_ID,
                         "as_float64_array()",
                         float64_array());
+    unshare_data();
     return float64_array(m_data,dtype());
 }
 
@@ -15057,6 +17281,7 @@ Node::as_index_t_array() const
                         DataType::index_t(1).id(),
                         "as_index_t_array()",
                         index_t_array());
+    read_compressed_data();
     return index_t_array(m_data,dtype());
 }
 
@@ -15072,6 +17297,7 @@ Node::as_int8_array() const
                         DataType::INT8_ID,
                         "as_int8_array() const",
                         int8_array());
+    read_compressed_data();
     return int8_array(m_data,dtype());
 }
 
@@ -15083,6 +17309,7 @@ Node::as_int16_array() const
                         DataType::INT16_ID,
                         "as_int16_array() const",
                         int16_array());
+    read_compressed_data();
     return int16_array(m_data,dtype());
 }
 
@@ -15094,6 +17321,7 @@ Node::as_int32_array() const
                         DataType::INT32_ID,
                         "as_int32_array() const",
                         int32_array());
+    read_compressed_data();
     return int32_array(m_data,dtype());
 }
 
@@ -15105,6 +17333,7 @@ Node::as_int64_array() const
                         DataType::INT64_ID,
                         "as_int64_array() const",
                         int64_array());
+    read_compressed_data();
     return int64_array(m_data,dtype());
 }
 
@@ -15121,6 +17350,7 @@ Node::as_uint8_array() const
                         DataType::UINT8_ID,
                         "as_uint8_array() const",
                         uint8_array());
+    read_compressed_data();
     return uint8_array(m_data,dtype());
 }
 
@@ -15132,6 +17362,7 @@ Node::as_uint16_array() const
                         DataType::UINT16_ID,
                         "as_uint16_array() const",
                         uint16_array());
+    read_compressed_data();
     return uint16_array(m_data,dtype());
 }
 
@@ -15143,6 +17374,7 @@ Node::as_uint32_array() const
                         DataType::UINT32_ID,
                         "as_uint32_array() const",
                         uint32_array());
+    read_compressed_data();
     return uint32_array(m_data,dtype());
 }
 
@@ -15154,6 +17386,7 @@ Node::as_uint64_array() const
                         DataType::UINT64_ID,
                         "as_uint64_array() const",
                         uint64_array());
+    read_compressed_data();
     return uint64_array(m_data,dtype());
 }
 
@@ -15169,6 +17402,7 @@ Node::as_float32_array() const
                         DataType::FLOAT32_ID,
                         "as_float32_array() const",
                         float32_array());
+    read_compressed_data();
     return float32_array(m_data,dtype());
 }
 
@@ -15180,6 +17414,7 @@ Node::as_float64_array() const
                         DataType::FLOAT64_ID,
                         "as_float64_array() const",
                         float64_array());
+    read_compressed_data();
     return float64_array(m_data,dtype());
 }
 
@@ -15230,6 +17465,7 @@ Node::as_string() const
 int8_accessor
 Node::as_int8_accessor() const
 {
+    read_compressed_data();
     return int8_accessor(m_data,dtype());
 }
 
@@ -15237,6 +17473,7 @@ Node::as_int8_accessor() const
 int16_accessor
 Node::as_int16_accessor() const
 {
+    read_compressed_data();
     return int16_accessor(m_data,dtype());
 }
 
@@ -15244,6 +17481,7 @@ Node::as_int16_accessor() const
 int32_accessor
 Node::as_int32_accessor() const
 {
+    read_compressed_data();
     return int32_accessor(m_data,dtype());
 }
 
@@ -15251,6 +17489,7 @@ Node::as_int32_accessor() const
 int64_accessor
 Node::as_int64_accessor() const
 {
+    read_compressed_data();
     return int64_accessor(m_data,dtype());
 }
 
@@ -15262,6 +17501,7 @@ Node::as_int64_accessor() const
 uint8_accessor
 Node::as_uint8_accessor() const
 {
+    read_compressed_data();
     return uint8_accessor(m_data,dtype());
 }
 
@@ -15269,6 +17509,7 @@ Node::as_uint8_accessor() const
 uint16_accessor
 Node::as_uint16_accessor() const
 {
+    read_compressed_data();
     return uint16_accessor(m_data,dtype());
 }
 
@@ -15276,6 +17517,7 @@ Node::as_uint16_accessor() const
 uint32_accessor
 Node::as_uint32_accessor() const
 {
+    read_compressed_data();
     return uint32_accessor(m_data,dtype());
 }
 
@@ -15283,6 +17525,7 @@ Node::as_uint32_accessor() const
 uint64_accessor
 Node::as_uint64_accessor() const
 {
+    read_compressed_data();
     return uint64_accessor(m_data,dtype());
 }
 
@@ -15294,6 +17537,7 @@ Node::as_uint64_accessor() const
 float32_accessor
 Node::as_float32_accessor() const
 {
+    read_compressed_data();
     return float32_accessor(m_data,dtype());
 }
 
@@ -15301,6 +17545,7 @@ Node::as_float32_accessor() const
 float64_accessor
 Node::as_float64_accessor() const
 {
+    read_compressed_data();
     return float64_accessor(m_data,dtype());
 }
 
@@ -15308,6 +17553,7 @@ Node::as_float64_accessor() const
 index_t_accessor
 Node::as_index_t_accessor() const
 {
+    read_compressed_data();
     return index_t_accessor(m_data,dtype());
 }
 
@@ -15318,6 +17564,7 @@ Node::as_index_t_accessor() const
 void *
 Node::data_ptr()
 {
+    unshare_data();
     return m_data;
 }
 
@@ -15325,6 +17572,7 @@ Node::data_ptr()
 const void *
 Node::data_ptr() const
 {
+    read_compressed_data();
     return m_data;
 }
 
@@ -16074,6 +18322,7 @@ Node::as_char_array()
                         CONDUIT_NATIVE_CHAR_ID,
                         "as_char_array()",
                         char_array());
+    unshare_data();
     return char_array(m_data,dtype());
 }
 
@@ -16085,6 +18334,7 @@ Node::as_short_array()
                         CONDUIT_NATIVE_SHORT_ID,
                         "as_short_array()",
                         short_array());
+    unshare_data();
     return short_array(m_data,dtype());
 }
 
@@ -16096,6 +18346,7 @@ Node::as_int_array()
                         CONDUIT_NATIVE_INT_ID,
                         "as_int_array()",
                         int_array());
+    unshare_data();
     return int_array(m_data,dtype());
 }
 
@@ -16107,6 +18358,7 @@ Node::as_long_array()
                         CONDUIT_NATIVE_LONG_ID,
                         "as_long_array()",
                         long_array());
+    unshare_data();
     return long_array(m_data,dtype());
 }
 
@@ -16121,6 +18373,7 @@ Node::as_long_long_array()
                         CONDUIT_NATIVE_LONG_LONG_ID,
                         "as_long_long_array()",
                         long_long_array());
+    unshare_data();
     return long_long_array(m_data,dtype());
 }
 //---------------------------------------------------------------------------//
@@ -16140,6 +18393,7 @@ Node::as_signed_char_array()
                         CONDUIT_NATIVE_SIGNED_CHAR_ID,
                         "as_signed_char_array()",
                         signed_char_array());
+    unshare_data();
     return signed_char_array(m_data,dtype());
 }
 
@@ -16151,6 +18405,7 @@ Node::as_signed_short_array()
                         CONDUIT_NATIVE_SIGNED_SHORT_ID,
                         "as_signed_short_array()",
                         signed_short_array());
+    unshare_data();
     return signed_short_array(m_data,dtype());
 }
 
@@ -16162,6 +18417,7 @@ Node::as_signed_int_array()
                         CONDUIT_NATIVE_SIGNED_INT_ID,
                         "as_signed_int_array()",
                         int_array());
+    unshare_data();
     return signed_int_array(m_data,dtype());
 }
 
@@ -16173,6 +18429,7 @@ Node::as_signed_long_array()
                         CONDUIT_NATIVE_SIGNED_LONG_ID,
                         "as_signed_long_array()",
                         signed_long_array());
+    unshare_data();
     return signed_long_array(m_data,dtype());
 }
 
@@ -16187,6 +18444,7 @@ Node::as_signed_long_long_array()
                         CONDUIT_NATIVE_SIGNED_LONG_LONG_ID,
                         "as_signed_long_long_array()",
                         signed_long_long_array());
+    unshare_data();
     return signed_long_long_array(m_data,dtype());
 }
 //---------------------------------------------------------------------------//
@@ -16206,6 +18464,7 @@ Node::as_unsigned_char_array()
                         CONDUIT_NATIVE_UNSIGNED_CHAR_ID,
                         "as_unsigned_char_array()",
                         unsigned_char_array());
+    unshare_data();
     return unsigned_char_array(m_data,dtype());
 }
 
@@ -16217,6 +18476,7 @@ Node::as_unsigned_short_array()
                         CONDUIT_NATIVE_UNSIGNED_SHORT_ID,
                         "as_unsigned_short_array()",
                         unsigned_short_array());
+    unshare_data();
     return unsigned_short_array(m_data,dtype());
 }
 
@@ -16228,6 +18488,7 @@ Node::as_unsigned_int_array()
                         CONDUIT_NATIVE_UNSIGNED_INT_ID,
                         "as_unsigned_int_array()",
                         unsigned_int_array());
+    unshare_data();
     return unsigned_int_array(m_data,dtype());
 }
 
@@ -16239,6 +18500,7 @@ Node::as_unsigned_long_array()
                         CONDUIT_NATIVE_UNSIGNED_LONG_ID,
                         "as_unsigned_long_array()",
                         unsigned_long_array());
+    unshare_data();
     return unsigned_long_array(m_data,dtype());
 }
 
@@ -16253,6 +18515,7 @@ Node::as_unsigned_long_long_array()
                         CONDUIT_NATIVE_UNSIGNED_LONG_LONG_ID,
                         "as_unsigned_long_long_array()",
                         unsigned_long_long_array());
+    unshare_data();
     return unsigned_long_long_array(m_data,dtype());
 }
 
@@ -16273,6 +18536,7 @@ Node::as_float_array()
                         CONDUIT_NATIVE_FLOAT_ID,
                         "as_float_array()",
                         float_array());
+    unshare_data();
     return float_array(m_data,dtype());
 }
 
@@ -16284,6 +18548,7 @@ Node::as_double_array()
                         CONDUIT_NATIVE_DOUBLE_ID,
                         "as_double_array()",
                         double_array());
+    unshare_data();
     return double_array(m_data,dtype());
 }
 
@@ -16297,6 +18562,7 @@ Node::as_long_double_array()
                         CONDUIT_NATIVE_LONG_DOUBLE_ID,
                         "as_long_double_array()",
                         long_double_array());
+    unshare_data();
     return long_double_array(m_data,dtype());
 }
 //---------------------------------------------------------------------------//
@@ -16315,6 +18581,7 @@ Node::as_char_array() const
                         CONDUIT_NATIVE_CHAR_ID,
                         "as_char_array() const",
                         char_array());
+    read_compressed_data();
     return char_array(m_data,dtype());
 }
 
@@ -16326,6 +18593,7 @@ Node::as_short_array() const
                         CONDUIT_NATIVE_SHORT_ID,
                         "as_short_array() const",
                         short_array());
+    read_compressed_data();
     return short_array(m_data,dtype());
 }
 
@@ -16337,6 +18605,7 @@ Node::as_int_array() const
                         CONDUIT_NATIVE_INT_ID,
                         "as_int_array() const",
                         int_array());
+    read_compressed_data();
     return int_array(m_data,dtype());
 }
 
@@ -16348,6 +18617,7 @@ Node::as_long_array() const
                         CONDUIT_NATIVE_LONG_ID,
                         "as_long_array() const",
                         long_array());
+    read_compressed_data();
     return long_array(m_data,dtype());
 }
 
@@ -16361,6 +18631,7 @@ Node::as_long_long_array() const
                         CONDUIT_NATIVE_LONG_LONG_ID,
                         "as_long_long_array() const",
                         long_long_array());
+    read_compressed_data();
     return long_long_array(m_data,dtype());
 }
 //---------------------------------------------------------------------------//
@@ -16380,6 +18651,7 @@ Node::as_signed_char_array() const
                         CONDUIT_NATIVE_SIGNED_CHAR_ID,
                         "as_signed_char_array() const",
                         signed_char_array());
+    read_compressed_data();
     return signed_char_array(m_data,dtype());
 }
 
@@ -16391,6 +18663,7 @@ Node::as_signed_short_array() const
                         CONDUIT_NATIVE_SIGNED_SHORT_ID,
                         "as_signed_short_array() const",
                         signed_short_array());
+    read_compressed_data();
     return signed_short_array(m_data,dtype());
 }
 
@@ -16402,6 +18675,7 @@ Node::as_signed_int_array() const
                         CONDUIT_NATIVE_SIGNED_INT_ID,
                         "as_signed_int_array() const",
                         signed_int_array());
+    read_compressed_data();
     return signed_int_array(m_data,dtype());
 }
 
@@ -16413,6 +18687,7 @@ Node::as_signed_long_array() const
                         CONDUIT_NATIVE_SIGNED_LONG_ID,
                         "as_signed_long_array() const",
                         signed_long_array());
+    read_compressed_data();
     return signed_long_array(m_data,dtype());
 }
 
@@ -16426,6 +18701,7 @@ Node::as_signed_long_long_array() const
                         CONDUIT_NATIVE_SIGNED_LONG_LONG_ID,
                         "as_signed_long_long_array() const",
                         signed_long_long_array());
+    read_compressed_data();
     return signed_long_long_array(m_data,dtype());
 }
 //---------------------------------------------------------------------------//
@@ -16445,6 +18721,7 @@ Node::as_unsigned_char_array() const
                         CONDUIT_NATIVE_UNSIGNED_CHAR_ID,
                         "as_unsigned_char_array() const",
                         unsigned_char_array());
+    read_compressed_data();
     return unsigned_char_array(m_data,dtype());
 }
 
@@ -16456,6 +18733,7 @@ Node::as_unsigned_short_array() const
                         CONDUIT_NATIVE_UNSIGNED_SHORT_ID,
                         "as_unsigned_short_array() const",
                         unsigned_short_array());
+    read_compressed_data();
     return unsigned_short_array(m_data,dtype());
 }
 
@@ -16467,6 +18745,7 @@ Node::as_unsigned_int_array() const
                         CONDUIT_NATIVE_UNSIGNED_INT_ID,
                         "as_unsigned_int_array() const",
                         unsigned_int_array());
+    read_compressed_data();
     return unsigned_int_array(m_data,dtype());
 }
 
@@ -16478,6 +18757,7 @@ Node::as_unsigned_long_array() const
                         CONDUIT_NATIVE_UNSIGNED_LONG_ID,
                         "as_unsigned_long_array() const",
                         unsigned_long_array());
+    read_compressed_data();
     return unsigned_long_array(m_data,dtype());
 }
 
@@ -16492,6 +18772,7 @@ Node::as_unsigned_long_long_array() const
                         CONDUIT_NATIVE_UNSIGNED_LONG_LONG_ID,
                         "as_unsigned_long_long_array() const",
                         unsigned_long_long_array());
+    read_compressed_data();
     return unsigned_long_long_array(m_data,dtype());
 }
 //---------------------------------------------------------------------------//
@@ -16511,6 +18792,7 @@ Node::as_float_array() const
                         CONDUIT_NATIVE_FLOAT_ID,
                         "as_float_array() const",
                         float_array());
+    read_compressed_data();
     return float_array(m_data,dtype());
 }
 
@@ -16522,6 +18804,7 @@ Node::as_double_array() const
                         CONDUIT_NATIVE_DOUBLE_ID,
                         "as_double_array() const",
                         double_array());
+    read_compressed_data();
     return double_array(m_data,dtype());
 }
 //---------------------------------------------------------------------------//
@@ -16534,465 +18817,1373 @@ Node::as_long_double_array() const
                         CONDUIT_NATIVE_LONG_DOUBLE_ID,
                         "as_long_double_array() const",
                         long_double_array());
+    read_compressed_data();
     return long_double_array(m_data,dtype());
 }
 
-//---------------------------------------------------------------------------//
-#endif
-//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+#endif
+//---------------------------------------------------------------------------//
+
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node value access methods --
+//
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node allocator selection methods --
+//
+//-----------------------------------------------------------------------------
+void
+Node::set_allocator(index_t allocator_id)
+{
+  if(allocator_id != m_allocator_id)
+  {
+    reset();
+    // TODO: add check for allocator exists
+    m_allocator_id = allocator_id;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::reset_allocator()
+{
+  if(m_allocator_id != 0)
+  {
+    reset();
+    m_allocator_id = 0;
+  }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Node::allocator() const
+{
+  return m_allocator_id;
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node allocator selection methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node as accessor methods --
+//
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------------------------------------//
+// accessors
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+char_accessor
+Node::as_char_accessor() const
+{
+    read_compressed_data();
+    return char_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+short_accessor
+Node::as_short_accessor() const
+{
+    read_compressed_data();
+    return short_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+int_accessor
+Node::as_int_accessor() const
+{
+    read_compressed_data();
+    return int_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+long_accessor
+Node::as_long_accessor() const
+{
+    read_compressed_data();
+    return long_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+#ifdef CONDUIT_HAS_LONG_LONG
+//---------------------------------------------------------------------------//
+long_long_accessor
+Node::as_long_long_accessor() const
+{
+    read_compressed_data();
+    return long_long_accessor(m_data,dtype());
+}
+//---------------------------------------------------------------------------//
+#endif
+//---------------------------------------------------------------------------//
+
+
+//---------------------------------------------------------------------------//
+// signed integer accessors
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+signed_char_accessor
+Node::as_signed_char_accessor() const
+{
+    read_compressed_data();
+    return signed_char_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+signed_short_accessor
+Node::as_signed_short_accessor() const
+{
+    read_compressed_data();
+    return signed_short_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+signed_int_accessor
+Node::as_signed_int_accessor() const
+{
+    read_compressed_data();
+    return signed_int_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+signed_long_accessor
+Node::as_signed_long_accessor() const
+{
+    read_compressed_data();
+    return signed_long_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+#ifdef CONDUIT_HAS_LONG_LONG
+//---------------------------------------------------------------------------//
+signed_long_long_accessor
+Node::as_signed_long_long_accessor() const
+{
+    read_compressed_data();
+    return signed_long_long_accessor(m_data,dtype());
+}
+//---------------------------------------------------------------------------//
+#endif
+//---------------------------------------------------------------------------//
+
+
+//---------------------------------------------------------------------------//
+// unsigned integer accessors
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+unsigned_char_accessor
+Node::as_unsigned_char_accessor() const
+{
+    read_compressed_data();
+    return unsigned_char_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+unsigned_short_accessor
+Node::as_unsigned_short_accessor() const
+{
+    read_compressed_data();
+    return unsigned_short_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+unsigned_int_accessor
+Node::as_unsigned_int_accessor() const
+{
+    read_compressed_data();
+    return unsigned_int_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+unsigned_long_accessor
+Node::as_unsigned_long_accessor() const
+{
+    read_compressed_data();
+    return unsigned_long_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+#ifdef CONDUIT_HAS_LONG_LONG
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+unsigned_long_long_accessor
+Node::as_unsigned_long_long_accessor() const
+{
+    read_compressed_data();
+    return unsigned_long_long_accessor(m_data,dtype());
+
+}
+//---------------------------------------------------------------------------//
+#endif
+//---------------------------------------------------------------------------//
+
+
+//---------------------------------------------------------------------------//
+// floating point accessors
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+float_accessor
+Node::as_float_accessor() const
+{
+    read_compressed_data();
+    return float_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+double_accessor
+Node::as_double_accessor() const
+{
+    read_compressed_data();
+    return double_accessor(m_data,dtype());
+
+}
+//---------------------------------------------------------------------------//
+#ifdef CONDUIT_USE_LONG_DOUBLE
+//---------------------------------------------------------------------------//
+long_double_accessor
+Node::as_long_double_accessor() const
+{
+    read_compressed_data();
+    return long_double_accessor(m_data,dtype());
+}
+
+//---------------------------------------------------------------------------//
+#endif
+//---------------------------------------------------------------------------//
+
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node as accessor methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node typed view helpers --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::check_data_view(index_t dtype_id,
+                      bool require_compact,
+                      index_t stride,
+                      const index_t *extents,
+                      index_t rank,
+                      const char *method) const
+{
+    const DataType &dt = dtype();
+    if(dt.id() != dtype_id)
+    {
+        CONDUIT_ERROR("Node::" << method << " -- DataType "
+                      << DataType::id_to_name(dt.id())
+                      << " at path " << path()
+                      << " does not equal expected DataType "
+                      << DataType::id_to_name(dtype_id));
+    }
+
+    if(require_compact && !dt.is_compact() && dt.number_of_elements() > 1)
+    {
+        CONDUIT_ERROR("Node::" << method << " -- data at path " << path()
+                      << " is not compact (stride: " << dt.stride()
+                      << ", element bytes: " << dt.element_bytes() << ")");
+    }
+
+    if(stride > 0 && dt.stride() != stride && dt.number_of_elements() > 1)
+    {
+        CONDUIT_ERROR("Node::" << method << " -- stride " << dt.stride()
+                      << " at path " << path()
+                      << " does not equal expected stride " << stride);
+    }
+
+    if(extents != NULL)
+    {
+        index_t num_ele = 1;
+        for(index_t d = 0; d < rank; d++)
+        {
+            num_ele *= extents[d];
+        }
+
+        if(num_ele != dt.number_of_elements())
+        {
+            CONDUIT_ERROR("Node::" << method << " -- extents cover "
+                          << num_ele << " elements, but the node at path "
+                          << path() << " has "
+                          << dt.number_of_elements() << " elements");
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node typed view helpers --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Interface Warts --
+//
+//-----------------------------------------------------------------------------
+
+// NOTE: several other warts methods are inlined in Node.h
+
+//---------------------------------------------------------------------------//
+void
+Node::set_schema_ptr(Schema *schema_ptr)
+{
+    check_not_frozen("set_schema_ptr");
+    invalidate_caches();
+    // if(m_schema->is_root())
+    if(m_owns_schema)
+    {
+        delete m_schema;
+        m_owns_schema = false;
+    }
+    m_schema = schema_ptr;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::set_data_ptr(void *data)
+{
+    /// TODO: We need to audit where we actually need release
+    //release();
+    check_not_frozen("set_data_ptr");
+    invalidate_caches();
+    m_data    = data;
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Interface Warts --
+//
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//-----------------------------------------------------------------------------
+//
+//
+// -- end conduit::Node public methods --
+//
+//
+//-----------------------------------------------------------------------------
+//=============================================================================
+
+//=============================================================================
+//-----------------------------------------------------------------------------
+//
+//
+// -- begin conduit::Node private methods --
+//
+//
+//-----------------------------------------------------------------------------
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Node::MMap helper class
+//-----------------------------------------------------------------------------
+// This private class encapsulates specific logic for both unix and windows
+// style memory mapping.
+//-----------------------------------------------------------------------------
+class Node::MMap
+{
+  public:
+      MMap();
+      ~MMap();
+
+      //----------------------------------------------------------------------
+      void  open(const std::string &path,
+                 index_t data_size);
+
+      //----------------------------------------------------------------------
+      void  close();
+
+      //----------------------------------------------------------------------
+      // passes an access pattern hint to the os
+      // ("sequential", "random", or "willneed")
+      void  advise(const std::string &advice);
+
+      //----------------------------------------------------------------------
+      void *data_ptr() const
+          { return m_data; }
+
+  private:
+      void      *m_data;
+      index_t    m_data_size;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+      // memory-map file descriptor
+      int       m_mmap_fd;
+#else
+      // handles for windows mmap
+      HANDLE    m_file_hnd;
+      HANDLE    m_map_hnd;
+#endif
+
+};
+
+//-----------------------------------------------------------------------------
+Node::MMap::MMap()
+: m_data(NULL),
+  m_data_size(0),
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+  m_mmap_fd(-1)
+#else
+  // windows
+  m_file_hnd(INVALID_HANDLE_VALUE),
+  m_map_hnd(INVALID_HANDLE_VALUE)
+#endif
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+Node::MMap::~MMap()
+{
+    close();
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::MMap::open(const std::string &path,
+                 index_t data_size)
+{
+    if(m_data != NULL)
+    {
+        CONDUIT_ERROR("<Node::mmap> mmap already open");
+    }
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    m_mmap_fd   = ::open(path.c_str(),
+                         (O_RDWR | O_CREAT),
+                         (S_IRUSR | S_IWUSR));
+
+    m_data_size = data_size;
+
+    if (m_mmap_fd == -1)
+    {
+    {
+        CONDUIT_ERROR("<Node::mmap> failed to open file: "
+                     << "\"" << path << "\"");
+    }
+    }
+
+    m_data = ::mmap(0,
+                    m_data_size,
+                    (PROT_READ | PROT_WRITE),
+                    MAP_SHARED,
+                    m_mmap_fd, 0);
+
+    if (m_data == MAP_FAILED)
+        CONDUIT_ERROR("<Node::mmap> mmap data = MAP_FAILED" << path);
+#else
+    m_file_hnd = CreateFile(path.c_str(),
+                            (GENERIC_READ | GENERIC_WRITE),
+                            0,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_FLAG_RANDOM_ACCESS,
+                            NULL);
+
+    if (m_file_hnd == INVALID_HANDLE_VALUE)
+    {
+        CONDUIT_ERROR("<Node::mmap> CreateFile() Failed ");
+    }
+
+    m_map_hnd = CreateFileMapping(m_file_hnd,
+                                  NULL,
+                                  PAGE_READWRITE,
+                                  0, 0, 0);
+
+    if (m_map_hnd == NULL)
+    {
+        CloseHandle(m_file_hnd);
+        CONDUIT_ERROR("<Node::mmap> CreateFileMapping() failed with error" << GetLastError());
+    }
 
+    m_data = MapViewOfFile(m_map_hnd,
+                           FILE_MAP_ALL_ACCESS,
+                           0, 0, 0);
 
-//-----------------------------------------------------------------------------
-//
-// -- end definition of Node value access methods --
-//
-//-----------------------------------------------------------------------------
+    m_data_size = data_size;
 
+    if (m_data == NULL)
+    {
+        CloseHandle(m_map_hnd);
+        CloseHandle(m_file_hnd);
+        CONDUIT_ERROR("<Node::mmap> MapViewOfFile() failed with error" << GetLastError());
+    }
+#endif
+}
 
-//-----------------------------------------------------------------------------
-//
-// -- begin definition of Node allocator selection methods --
-//
 //-----------------------------------------------------------------------------
 void
-Node::set_allocator(index_t allocator_id)
+Node::MMap::close()
 {
-  if(allocator_id != m_allocator_id)
-  {
-    reset();
-    // TODO: add check for allocator exists
-    m_allocator_id = allocator_id;
-  }
+    // simple return if the mmap isn't active
+    if(m_data == NULL)
+        return;
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+
+    if(munmap(m_data, m_data_size) == -1)
+    {
+        CONDUIT_ERROR("<Node::mmap> failed to unmap mmap.");
+    }
+
+    if(::close(m_mmap_fd) == -1)
+    {
+        CONDUIT_ERROR("<Node::mmap> failed close mmap filed descriptor.");
+    }
+
+    m_mmap_fd   = -1;
+
+#else
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_map_hnd);
+    CloseHandle(m_file_hnd);
+    m_file_hnd = INVALID_HANDLE_VALUE;
+    m_map_hnd  = INVALID_HANDLE_VALUE;
+#endif
+
+    // clear data pointer and size member
+    m_data      = NULL;
+    m_data_size = 0;
+
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::reset_allocator()
+Node::MMap::advise(const std::string &advice)
 {
-  if(m_allocator_id != 0)
-  {
-    reset();
-    m_allocator_id = 0;
-  }
-}
+    if(m_data == NULL)
+        return;
 
-//-----------------------------------------------------------------------------
-index_t
-Node::allocator()
-{
-  return m_allocator_id;
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    int adv = MADV_NORMAL;
+    if(advice == "sequential")
+    {
+        adv = MADV_SEQUENTIAL;
+    }
+    else if(advice == "random")
+    {
+        adv = MADV_RANDOM;
+    }
+    else if(advice == "willneed")
+    {
+        adv = MADV_WILLNEED;
+    }
+
+    // this is only a hint, so failures are not errors
+    ::madvise(m_data, (size_t)m_data_size, adv);
+#endif
 }
 
 //-----------------------------------------------------------------------------
-//
-// -- end definition of Node allocator selection methods --
-//
+// Node::SharedBuffer helper class
 //-----------------------------------------------------------------------------
+// This private class holds an allocation shared by copy-on-write leaves.
+// Each Node that references the buffer holds one reference, the buffer is
+// freed with the allocator it was created with when the last reference is
+// released. Buffers adopted with set_owned are freed with their deleter.
+//-----------------------------------------------------------------------------
+class Node::SharedBuffer
+{
+  public:
+      SharedBuffer(void *data,
+                   index_t allocator_id)
+      : m_data(data),
+        m_allocator_id(allocator_id),
+        m_ref_count(1),
+        m_deleter()
+      {}
+
+      SharedBuffer(void *data,
+                   const std::function<void(void*)> &deleter)
+      : m_data(data),
+        m_allocator_id(0),
+        m_ref_count(1),
+        m_deleter(deleter)
+      {}
+
+      //----------------------------------------------------------------------
+      /// true for buffers adopted with set_owned
+      bool      has_deleter() const
+          { return static_cast<bool>(m_deleter); }
+
+      //----------------------------------------------------------------------
+      void      free_data()
+      {
+          if(m_deleter)
+          {
+              m_deleter(m_data);
+          }
+          else
+          {
+              utils::conduit_free(m_data, m_allocator_id);
+          }
+      }
+
+      //----------------------------------------------------------------------
+      void     *data_ptr() const
+          { return m_data; }
+
+      //----------------------------------------------------------------------
+      index_t   allocator_id() const
+          { return m_allocator_id; }
+
+      //----------------------------------------------------------------------
+      index_t   ref_count() const
+          { return m_ref_count.load(); }
+
+      //----------------------------------------------------------------------
+      void      add_ref()
+          { m_ref_count++; }
+
+      //----------------------------------------------------------------------
+      /// returns true if this was the last reference
+      bool      remove_ref()
+          { return (--m_ref_count) == 0; }
+
+  private:
+      void                       *m_data;
+      index_t                     m_allocator_id;
+      std::atomic<index_t>        m_ref_count;
+      std::function<void(void*)>  m_deleter;
+};
 
 //-----------------------------------------------------------------------------
-//
-// -- begin definition of Node as accessor methods --
-//
+// Node::CompressedBuffer helper class
 //-----------------------------------------------------------------------------
+// This private class holds the compressed data of a leaf (see
+// Node::compress) and the decompressed copy used for const access. The
+// decompressed copy is an entry of the process wide cache managed by
+// conduit::compression, which evicts it when over its budget. While cached,
+// the owning node's m_data points at the copy, evict resets it to NULL.
+//-----------------------------------------------------------------------------
+class Node::CompressedBuffer: public compression::detail::CacheEntry
+{
+  public:
+      CompressedBuffer(Node *owner,
+                       index_t data_size,
+                       index_t allocator_id)
+      : m_owner(owner),
+        m_block(),
+        m_data_size(data_size),
+        m_allocator_id(allocator_id),
+        m_cached(NULL)
+      {}
 
+      //----------------------------------------------------------------------
+      virtual ~CompressedBuffer()
+      {
+          compression::detail::cache_remove(this);
+          free_cached();
+      }
 
-//---------------------------------------------------------------------------//
-// accessors
-//---------------------------------------------------------------------------//
+      //----------------------------------------------------------------------
+      std::vector<uint8> &block()
+          { return m_block; }
 
-//---------------------------------------------------------------------------//
-char_accessor
-Node::as_char_accessor() const
-{
-    return char_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      const uint8 *block_ptr() const
+          { return m_block.data(); }
 
-//---------------------------------------------------------------------------//
-short_accessor
-Node::as_short_accessor() const
-{
-    return short_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      index_t   block_bytes() const
+          { return (index_t)m_block.size(); }
 
-//---------------------------------------------------------------------------//
-int_accessor
-Node::as_int_accessor() const
-{
-    return int_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      index_t   data_size() const
+          { return m_data_size; }
 
-//---------------------------------------------------------------------------//
-long_accessor
-Node::as_long_accessor() const
-{
-    return long_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      void      set_owner(Node *owner)
+          { m_owner = owner; }
 
-//---------------------------------------------------------------------------//
-#ifdef CONDUIT_HAS_LONG_LONG
-//---------------------------------------------------------------------------//
-long_long_accessor
-Node::as_long_long_accessor() const
-{
-    return long_long_accessor(m_data,dtype());
-}
-//---------------------------------------------------------------------------//
-#endif
-//---------------------------------------------------------------------------//
+      //----------------------------------------------------------------------
+      /// returns the decompressed data, decompressing it if it isn't cached
+      void     *cached_data()
+      {
+          if(m_cached == NULL)
+          {
+              m_cached = decompress_data();
+          }
+          compression::detail::cache_touch(this);
+          return m_cached;
+      }
 
+      //----------------------------------------------------------------------
+      /// returns the decompressed data and gives up ownership of it
+      void     *take_data()
+      {
+          compression::detail::cache_remove(this);
+          void *res = m_cached != NULL ? m_cached : decompress_data();
+          m_cached = NULL;
+          return res;
+      }
 
-//---------------------------------------------------------------------------//
-// signed integer accessors
-//---------------------------------------------------------------------------//
+      //----------------------------------------------------------------------
+      virtual index_t cached_bytes() const
+          { return m_data_size; }
 
-//---------------------------------------------------------------------------//
-signed_char_accessor
-Node::as_signed_char_accessor() const
-{
-    return signed_char_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      virtual void    evict()
+      {
+          free_cached();
+          m_owner->m_data = NULL;
+      }
 
-//---------------------------------------------------------------------------//
-signed_short_accessor
-Node::as_signed_short_accessor() const
-{
-    return signed_short_accessor(m_data,dtype());
-}
+  private:
+      //----------------------------------------------------------------------
+      void     *decompress_data() const
+      {
+          void *res = utils::conduit_allocate((size_t)m_data_size,
+                                              1,
+                                              m_allocator_id);
+          compression::decompress(m_block.data(),
+                                  (index_t)m_block.size(),
+                                  res);
+          return res;
+      }
 
-//---------------------------------------------------------------------------//
-signed_int_accessor
-Node::as_signed_int_accessor() const
-{
-    return signed_int_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      void      free_cached()
+      {
+          if(m_cached != NULL)
+          {
+              utils::conduit_free(m_cached, m_allocator_id);
+              m_cached = NULL;
+          }
+      }
+
+      Node               *m_owner;
+      std::vector<uint8>  m_block;
+      index_t             m_data_size;
+      index_t             m_allocator_id;
+      void               *m_cached;
+};
 
-//---------------------------------------------------------------------------//
-signed_long_accessor
-Node::as_signed_long_accessor() const
+//-----------------------------------------------------------------------------
+// Node::HashCache helper class
+//-----------------------------------------------------------------------------
+// This private class holds the hash of a subtree computed by Node::hash
+// with the cache option, and the options it was computed with.
+//-----------------------------------------------------------------------------
+class Node::HashCache
 {
-    return signed_long_accessor(m_data,dtype());
-}
+  public:
+      HashCache()
+      : m_valid(false),
+        m_data(false),
+        m_seed(0),
+        m_num_words(0)
+      {}
 
-//---------------------------------------------------------------------------//
-#ifdef CONDUIT_HAS_LONG_LONG
-//---------------------------------------------------------------------------//
-signed_long_long_accessor
-Node::as_signed_long_long_accessor() const
-{
-    return signed_long_long_accessor(m_data,dtype());
-}
-//---------------------------------------------------------------------------//
-#endif
-//---------------------------------------------------------------------------//
+      //----------------------------------------------------------------------
+      bool      is_valid() const
+          { return m_valid; }
 
+      //----------------------------------------------------------------------
+      void      invalidate()
+          { m_valid = false; }
 
-//---------------------------------------------------------------------------//
-// unsigned integer accessors
-//---------------------------------------------------------------------------//
+      //----------------------------------------------------------------------
+      /// true if the cached hash can answer a request with these options
+      bool      matches(bool data, uint64 seed, index_t num_words) const
+          { return m_valid && m_data == data && m_seed == seed &&
+                   m_num_words >= num_words; }
 
-//---------------------------------------------------------------------------//
-unsigned_char_accessor
-Node::as_unsigned_char_accessor() const
-{
-    return unsigned_char_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      const uint64 *words() const
+          { return m_words; }
 
-//---------------------------------------------------------------------------//
-unsigned_short_accessor
-Node::as_unsigned_short_accessor() const
-{
-    return unsigned_short_accessor(m_data,dtype());
-}
+      //----------------------------------------------------------------------
+      void      set(bool data,
+                    uint64 seed,
+                    index_t num_words,
+                    const uint64 *words)
+      {
+          m_valid = true;
+          m_data  = data;
+          m_seed  = seed;
+          m_num_words = num_words;
+          for(index_t w = 0; w < num_words; w++)
+          {
+              m_words[w] = words[w];
+          }
+      }
 
-//---------------------------------------------------------------------------//
-unsigned_int_accessor
-Node::as_unsigned_int_accessor() const
-{
-    return unsigned_int_accessor(m_data,dtype());
-}
+  private:
+      bool      m_valid;
+      bool      m_data;
+      uint64    m_seed;
+      index_t   m_num_words;
+      uint64    m_words[2];
+};
 
-//---------------------------------------------------------------------------//
-unsigned_long_accessor
-Node::as_unsigned_long_accessor() const
-{
-    return unsigned_long_accessor(m_data,dtype());
-}
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with frozen nodes --
+//
+//-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-#ifdef CONDUIT_HAS_LONG_LONG
-//---------------------------------------------------------------------------//
-//---------------------------------------------------------------------------//
-unsigned_long_long_accessor
-Node::as_unsigned_long_long_accessor() const
+void
+Node::frozen_error(const char *method) const
 {
-    return unsigned_long_long_accessor(m_data,dtype());
-
+    CONDUIT_ERROR("<Node::" << method << "> Cannot modify frozen Node("
+                  << path() << "), call unfreeze() first");
 }
-//---------------------------------------------------------------------------//
-#endif
-//---------------------------------------------------------------------------//
-
 
-//---------------------------------------------------------------------------//
-// floating point accessors
-//---------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with hashing --
+//
+//-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-float_accessor
-Node::as_float_accessor() const
+void
+Node::invalidate_hash_path()
 {
-    return float_accessor(m_data,dtype());
+    // a node's cached hash is only valid if the cached hashes of all of
+    // its descendants are, so we can stop at the first stale ancestor
+    Node *curr = this;
+    while(curr != NULL &&
+          curr->m_hash_cache != NULL &&
+          curr->m_hash_cache->is_valid())
+    {
+        curr->m_hash_cache->invalidate();
+        curr = curr->m_parent;
+    }
 }
 
 //---------------------------------------------------------------------------//
-double_accessor
-Node::as_double_accessor() const
+void
+Node::invalidate_stats_path()
 {
-    return double_accessor(m_data,dtype());
-
+    Node *curr = this;
+    while(curr != NULL &&
+          curr->m_stats_cache != NULL &&
+          curr->m_stats_cache->valid)
+    {
+        curr->m_stats_cache->valid = false;
+        curr = curr->m_parent;
+    }
 }
+
 //---------------------------------------------------------------------------//
-#ifdef CONDUIT_USE_LONG_DOUBLE
-//---------------------------------------------------------------------------//
-long_double_accessor
-Node::as_long_double_accessor() const
+void
+Node::invalidate_hash_descendants()
 {
-    return long_double_accessor(m_data,dtype());
+    for(size_t i = 0; i < m_children.size(); i++)
+    {
+        Node *chld = m_children[i];
+        if(chld->m_hash_cache != NULL)
+        {
+            chld->m_hash_cache->invalidate();
+        }
+        chld->invalidate_hash_descendants();
+    }
 }
 
 //---------------------------------------------------------------------------//
-#endif
-//---------------------------------------------------------------------------//
+void
+Node::hash_tree(bool data,
+                uint64 seed,
+                index_t num_words,
+                index_t num_threads,
+                bool cache,
+                uint64 *res) const
+{
+    if(cache &&
+       m_hash_cache != NULL &&
+       m_hash_cache->matches(data,seed,num_words))
+    {
+        for(index_t w = 0; w < num_words; w++)
+        {
+            res[w] = m_hash_cache->words()[w];
+        }
+        return;
+    }
 
+    materialize_children();
 
-//-----------------------------------------------------------------------------
-//
-// -- end definition of Node as accessor methods --
-//
-//-----------------------------------------------------------------------------
+    detail::XXHash64 hashers[detail::HASH_MAX_WORDS];
+    for(index_t w = 0; w < num_words; w++)
+    {
+        hashers[w].reset(seed ^ detail::HASH_WORD_SEEDS[w]);
+    }
 
-//-----------------------------------------------------------------------------
-//
-// -- begin definition of Interface Warts --
-//
-//-----------------------------------------------------------------------------
+    const DataType &dt = dtype();
+    index_t dtype_id = dt.id();
+    for(index_t w = 0; w < num_words; w++)
+    {
+        hashers[w].update_word((uint64)dtype_id);
+    }
 
-// NOTE: several other warts methods are inlined in Node.h
+    if(dtype_id == DataType::OBJECT_ID || dtype_id == DataType::LIST_ID)
+    {
+        index_t num_children = number_of_children();
+        for(index_t w = 0; w < num_words; w++)
+        {
+            hashers[w].update_word((uint64)num_children);
+        }
 
-//---------------------------------------------------------------------------//
-void
-Node::set_schema_ptr(Schema *schema_ptr)
-{
-    // if(m_schema->is_root())
-    if(m_owns_schema)
+        uint64 chld_res[detail::HASH_MAX_WORDS];
+        for(index_t i = 0; i < num_children; i++)
+        {
+            m_children[(size_t)i]->hash_tree(data,
+                                             seed,
+                                             num_words,
+                                             num_threads,
+                                             cache,
+                                             chld_res);
+            for(index_t w = 0; w < num_words; w++)
+            {
+                if(dtype_id == DataType::OBJECT_ID)
+                {
+                    const std::string &name = m_schema->object_order()[(size_t)i];
+                    hashers[w].update_word((uint64)name.size());
+                    hashers[w].update(name.c_str(),(index_t)name.size());
+                }
+                hashers[w].update_word(chld_res[w]);
+            }
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
     {
-        delete m_schema;
-        m_owns_schema = false;
+        index_t num_eles  = dt.number_of_elements();
+        index_t ele_bytes = dt.element_bytes();
+        index_t endianness = dt.endianness();
+        if(endianness == Endianness::DEFAULT_ID)
+        {
+            endianness = Endianness::machine_default();
+        }
+
+        for(index_t w = 0; w < num_words; w++)
+        {
+            hashers[w].update_word((uint64)num_eles);
+            hashers[w].update_word((uint64)ele_bytes);
+            hashers[w].update_word((uint64)endianness);
+        }
+
+        if(data && num_eles > 0 &&
+           (m_data != NULL || m_compressed != NULL))
+        {
+            uint64 data_res[detail::HASH_MAX_WORDS];
+            detail::hash_leaf_data((const uint8*)element_ptr(0),
+                                   num_eles,
+                                   ele_bytes,
+                                   dt.stride(),
+                                   seed,
+                                   num_words,
+                                   num_threads,
+                                   data_res);
+            for(index_t w = 0; w < num_words; w++)
+            {
+                hashers[w].update_word(data_res[w]);
+            }
+        }
+    }
+
+    for(index_t w = 0; w < num_words; w++)
+    {
+        res[w] = hashers[w].digest();
+    }
+
+    // frozen trees are shared by readers, so we don't store hashes
+    if(cache && !m_frozen)
+    {
+        Node *self = const_cast<Node*>(this);
+        if(self->m_hash_cache == NULL)
+        {
+            self->m_hash_cache = new HashCache();
+        }
+        self->m_hash_cache->set(data,seed,num_words,res);
     }
-    m_schema = schema_ptr;
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::set_data_ptr(void *data)
+Node::stats_tree(bool cache, StatsCache &res) const
 {
-    /// TODO: We need to audit where we actually need release
-    //release();
-    m_data    = data;
-}
+    if(m_stats_cache != NULL && m_stats_cache->valid)
+    {
+        res = *m_stats_cache;
+        return;
+    }
 
-//-----------------------------------------------------------------------------
-//
-// -- end definition of Interface Warts --
-//
-//-----------------------------------------------------------------------------
+    materialize_children();
 
-//=============================================================================
-//-----------------------------------------------------------------------------
-//
-//
-// -- end conduit::Node public methods --
-//
-//
-//-----------------------------------------------------------------------------
-//=============================================================================
+    res = StatsCache();
+    res.bytes_allocated = allocated_bytes();
+    res.bytes_mmaped    = mmaped_bytes();
+    res.bytes_shared    = shared_bytes();
+    res.bytes_compressed = compressed_bytes();
+
+    const DataType &dt = dtype();
+    if(dt.is_object() || dt.is_list())
+    {
+        StatsCache chld_res;
+        for(size_t i = 0; i < m_children.size(); i++)
+        {
+            m_children[i]->stats_tree(cache,chld_res);
+            res.add(chld_res);
+        }
+    }
+    else if(!dt.is_empty())
+    {
+        res.bytes_compact = dt.bytes_compact();
+        res.strided_bytes = dt.strided_bytes();
+    }
+    res.valid = true;
+
+    // const callers may share this tree with other threads, so sizes are
+    // only stored when asked for. frozen trees are shared by readers, so
+    // we don't store sizes there either (freeze stores them up front)
+    if(cache && !m_frozen)
+    {
+        Node *self = const_cast<Node*>(this);
+        if(self->m_stats_cache == NULL)
+        {
+            self->m_stats_cache = new StatsCache();
+        }
+        *self->m_stats_cache = res;
+    }
+}
 
-//=============================================================================
 //-----------------------------------------------------------------------------
 //
-//
-// -- begin conduit::Node private methods --
-//
+// -- private methods that help with copy-on-write sharing --
 //
 //-----------------------------------------------------------------------------
-//=============================================================================
 
-//-----------------------------------------------------------------------------
-// Node::MMap helper class
-//-----------------------------------------------------------------------------
-// This private class encapsulates specific logic for both unix and windows
-// style memory mapping.
-//-----------------------------------------------------------------------------
-class Node::MMap
+//---------------------------------------------------------------------------//
+bool
+Node::share_data(const Node &src)
 {
-  public:
-      MMap();
-      ~MMap();
-
-      //----------------------------------------------------------------------
-      void  open(const std::string &path,
-                 index_t data_size);
-
-      //----------------------------------------------------------------------
-      void  close();
+    // sharing changes how the source leaf refers to its data,
+    // but not the data it presents
+    Node &src_node = const_cast<Node&>(src);
 
-      //----------------------------------------------------------------------
-      void *data_ptr() const
-          { return m_data; }
+    if(src_node.m_shared == NULL)
+    {
+        // only leaves that own their entire allocation can be shared,
+        // and frozen leaves can't be converted to shared buffers
+        if(src_node.m_frozen ||
+           !src_node.m_alloced ||
+           src_node.m_data == NULL ||
+           !src_node.m_children.empty())
+        {
+            return false;
+        }
 
-  private:
-      void      *m_data;
-      int        m_data_size;
+        src_node.m_shared = new SharedBuffer(src_node.m_data,
+                                             src_node.m_allocator_id);
+        src_node.m_alloced = false;
+        // the source's bytes now count as shared
+        src_node.invalidate_caches();
+    }
 
-#if !defined(CONDUIT_PLATFORM_WINDOWS)
-      // memory-map file descriptor
-      int       m_mmap_fd;
-#else
-      // handles for windows mmap
-      HANDLE    m_file_hnd;
-      HANDLE    m_map_hnd;
-#endif
+    release();
 
-};
+    m_schema->set(src.dtype());
+    m_shared = src_node.m_shared;
+    m_shared->add_ref();
+    m_data      = m_shared->data_ptr();
+    m_data_size = src_node.m_data_size;
+    m_alloced   = false;
+    m_mmaped    = false;
 
-//-----------------------------------------------------------------------------
-Node::MMap::MMap()
-: m_data(NULL),
-  m_data_size(0),
-#if !defined(CONDUIT_PLATFORM_WINDOWS)
-  m_mmap_fd(-1)
-#else
-  // windows
-  m_file_hnd(INVALID_HANDLE_VALUE),
-  m_map_hnd(INVALID_HANDLE_VALUE)
-#endif
-{
-    // empty
+    return true;
 }
 
-//-----------------------------------------------------------------------------
-Node::MMap::~MMap()
+//---------------------------------------------------------------------------//
+void
+Node::own_data(void *data,
+               const DataType &dtype,
+               const std::function<void(void*)> &deleter)
 {
-    close();
+    release();
+    m_schema->set(dtype);
+    m_shared    = new SharedBuffer(data, deleter);
+    m_data      = data;
+    m_data_size = dtype.spanned_bytes();
+    m_alloced   = false;
+    m_mmaped    = false;
 }
 
 //-----------------------------------------------------------------------------
+//
+// -- private methods that help with growable leaves --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
 void
-Node::MMap::open(const std::string &path,
-                 index_t data_size)
+Node::append_leaf_values(const DataType &values_dtype,
+                         const void *values)
 {
-    if(m_data != NULL)
+    check_not_frozen("append_values");
+    invalidate_caches();
+
+    if(m_compressed != NULL)
     {
-        CONDUIT_ERROR("<Node::mmap> mmap already open");
+        thaw_compressed_data();
     }
 
-#if !defined(CONDUIT_PLATFORM_WINDOWS)
-    m_mmap_fd   = ::open(path.c_str(),
-                         (O_RDWR | O_CREAT),
-                         (S_IRUSR | S_IWUSR));
+    const index_t num_values = values_dtype.number_of_elements();
+    const index_t ele_bytes  = values_dtype.element_bytes();
 
-    m_data_size = data_size;
+    if(dtype().is_empty())
+    {
+        init(values_dtype);
+        utils::conduit_memcpy(m_data,
+                              values,
+                              (size_t)(num_values * ele_bytes),
+                              m_allocator_id,
+                              0);
+        return;
+    }
 
-    if (m_mmap_fd == -1)
+    const DataType &curr = dtype();
+    if(curr.id() != values_dtype.id() ||
+       curr.element_bytes() != ele_bytes ||
+       !curr.endianness_matches_machine())
     {
+        CONDUIT_ERROR("Node::append_values values of type "
+                      << values_dtype.name()
+                      << " can't be appended to a leaf of type "
+                      << curr.name()
+                      << " (with "
+                      << Endianness::id_to_name(curr.endianness())
+                      << " endianness)");
+    }
+
+    const index_t curr_len = curr.number_of_elements();
+    const index_t new_len  = curr_len + num_values;
+    const index_t curr_endianness = curr.endianness();
+
+    bool in_place = m_alloced &&
+                    curr.is_compact() &&
+                    curr.offset() == 0 &&
+                    m_data_size >= new_len * ele_bytes;
+
+    if(!in_place)
     {
-        CONDUIT_ERROR("<Node::mmap> failed to open file: "
-                     << "\"" << path << "\"");
+        // grow geometrically, and compact the current values
+        index_t capacity = std::max(new_len, 2 * curr_len);
+        void *data = utils::conduit_allocate((size_t)(capacity * ele_bytes),
+                                             (size_t)1,
+                                             m_allocator_id);
+        index_t src_allocator_id = m_shared != NULL ?
+                                   m_shared->allocator_id() :
+                                   m_allocator_id;
+        utils::conduit_memcpy_strided_elements(data,
+                                               (size_t)curr_len,
+                                               (size_t)ele_bytes,
+                                               (size_t)ele_bytes,
+                                               element_ptr(0),
+                                               (size_t)curr.stride(),
+                                               m_allocator_id,
+                                               src_allocator_id);
+        release();
+        m_data      = data;
+        m_data_size = capacity * ele_bytes;
+        m_alloced   = true;
+        m_mmaped    = false;
     }
+
+    utils::conduit_memcpy(static_cast<uint8*>(m_data) + curr_len * ele_bytes,
+                          values,
+                          (size_t)(num_values * ele_bytes),
+                          m_allocator_id,
+                          0);
+    m_schema->set(DataType(values_dtype.id(),
+                           new_len,
+                           0,
+                           ele_bytes,
+                           ele_bytes,
+                           curr_endianness));
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::unshare_shared_data()
+{
+    invalidate_caches();
+    if(m_shared->ref_count() == 1)
+    {
+        // no other node references the buffer, we can simply take
+        // ownership if it uses our allocator (adopted buffers stay
+        // with their deleter)
+        if(!m_shared->has_deleter() &&
+           m_shared->allocator_id() == m_allocator_id)
+        {
+            delete m_shared;
+            m_shared  = NULL;
+            m_alloced = true;
+        }
+        return;
     }
 
-    m_data = ::mmap(0,
-                    m_data_size,
-                    (PROT_READ | PROT_WRITE),
-                    MAP_SHARED,
-                    m_mmap_fd, 0);
+    void *data = utils::conduit_allocate((size_t)m_data_size,
+                                         (size_t)1,
+                                         m_allocator_id);
+    utils::conduit_memcpy(data,
+                          m_data,
+                          (size_t)m_data_size,
+                          m_allocator_id,
+                          m_shared->allocator_id());
+    release_shared();
+    m_data    = data;
+    m_alloced = true;
+}
 
-    if (m_data == MAP_FAILED)
-        CONDUIT_ERROR("<Node::mmap> mmap data = MAP_FAILED" << path);
-#else
-    m_file_hnd = CreateFile(path.c_str(),
-                            (GENERIC_READ | GENERIC_WRITE),
-                            0,
-                            NULL,
-                            OPEN_EXISTING,
-                            FILE_FLAG_RANDOM_ACCESS,
-                            NULL);
+//---------------------------------------------------------------------------//
+void
+Node::unshare_data_tree()
+{
+    materialize_children();
 
-    if (m_file_hnd == INVALID_HANDLE_VALUE)
+    unshare_data();
+    for (size_t i = 0; i < m_children.size(); i++)
     {
-        CONDUIT_ERROR("<Node::mmap> CreateFile() Failed ");
+        m_children[i]->unshare_data_tree();
     }
+}
 
-    m_map_hnd = CreateFileMapping(m_file_hnd,
-                                  NULL,
-                                  PAGE_READWRITE,
-                                  0, 0, 0);
-
-    if (m_map_hnd == NULL)
+//---------------------------------------------------------------------------//
+void
+Node::release_shared()
+{
+    if(m_shared->remove_ref())
     {
-        CloseHandle(m_file_hnd);
-        CONDUIT_ERROR("<Node::mmap> CreateFileMapping() failed with error" << GetLastError());
+        m_shared->free_data();
+        delete m_shared;
     }
+    m_shared = NULL;
+}
 
-    m_data = MapViewOfFile(m_map_hnd,
-                           FILE_MAP_ALL_ACCESS,
-                           0, 0, 0);
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with compressed leaves --
+//
+//-----------------------------------------------------------------------------
 
-    m_data_size = (int)data_size;
+//---------------------------------------------------------------------------//
+void
+Node::load_compressed_data() const
+{
+    // const access fills the cache, but presents the same data
+    Node *self = const_cast<Node*>(this);
+    self->m_data = self->m_compressed->cached_data();
+}
 
-    if (m_data == NULL)
+//---------------------------------------------------------------------------//
+void
+Node::thaw_compressed_data()
+{
+    invalidate_caches();
+    index_t data_size = m_compressed->data_size();
+    void *data = m_compressed->take_data();
+    delete m_compressed;
+    m_compressed = NULL;
+    m_data       = data;
+    m_data_size  = data_size;
+    m_alloced    = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::own_compressed_data()
+{
+    if(m_compressed != NULL)
     {
-        CloseHandle(m_map_hnd);
-        CloseHandle(m_file_hnd);
-        CONDUIT_ERROR("<Node::mmap> MapViewOfFile() failed with error" << GetLastError());
+        m_compressed->set_owner(this);
     }
-#endif
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::MMap::close()
+Node::compress_tree(const std::string &method,
+                    bool shuffle,
+                    index_t threshold)
 {
-    // simple return if the mmap isn't active
-    if(m_data == NULL)
+    // frozen subtrees are shared by readers, so they are left as is
+    if(m_frozen)
+    {
         return;
+    }
 
-#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    materialize_children();
 
-    if(munmap(m_data, m_data_size) == -1)
+    const DataType &dt = dtype();
+    if(dt.is_object() || dt.is_list())
     {
-        CONDUIT_ERROR("<Node::mmap> failed to unmap mmap.");
+        for(size_t i = 0; i < m_children.size(); i++)
+        {
+            m_children[i]->compress_tree(method, shuffle, threshold);
+        }
+        return;
     }
 
-    if(::close(m_mmap_fd) == -1)
+    // only compress host data this node allocated
+    if(!m_alloced ||
+       m_mmaped ||
+       m_shared != NULL ||
+       m_compressed != NULL ||
+       m_data == NULL ||
+       m_data_size < threshold ||
+       m_data_size <= 0 ||
+       utils::is_device_allocator(m_allocator_id))
     {
-        CONDUIT_ERROR("<Node::mmap> failed close mmap filed descriptor.");
+        return;
     }
 
-    m_mmap_fd   = -1;
-
-#else
-    UnmapViewOfFile(m_data);
-    CloseHandle(m_map_hnd);
-    CloseHandle(m_file_hnd);
-    m_file_hnd = INVALID_HANDLE_VALUE;
-    m_map_hnd  = INVALID_HANDLE_VALUE;
-#endif
+    CompressedBuffer *cbuff = new CompressedBuffer(this,
+                                                   m_data_size,
+                                                   m_allocator_id);
+    compression::compress(m_data,
+                          m_data_size,
+                          shuffle ? dt.element_bytes() : 1,
+                          method,
+                          cbuff->block());
+
+    // leave data that doesn't compress as is
+    if(cbuff->block_bytes() >= m_data_size)
+    {
+        delete cbuff;
+        return;
+    }
 
-    // clear data pointer and size member
-    m_data      = NULL;
-    m_data_size = 0;
+    // the compressed copy won't grow
+    cbuff->block().shrink_to_fit();
 
+    invalidate_caches();
+    utils::conduit_free(m_data, m_allocator_id);
+    m_compressed = cbuff;
+    m_data       = NULL;
+    m_data_size  = 0;
+    m_alloced    = false;
 }
 
 
@@ -17008,10 +20199,18 @@ Node::MMap::close()
 void
 Node::init(const DataType& dtype)
 {
+    check_not_frozen("set");
+    invalidate_caches();
+
     if(this->dtype().compatible(dtype))
+    {
+        // the caller will write to our existing data
+        unshare_data();
         return;
+    }
 
     if(m_data != NULL ||
+       m_compressed != NULL ||
        this->dtype().id() == DataType::OBJECT_ID ||
        this->dtype().id() == DataType::LIST_ID)
     {
@@ -17041,8 +20240,7 @@ Node::allocate(const DataType &dtype)
 void
 Node::allocate(index_t dsize)
 {
-    m_data = utils::conduit_allocate((size_t)dsize, (size_t)1, m_allocator_id);
-    //  calloc((size_t)dsize,(size_t)1);
+    m_data = utils::conduit_allocate_initialized((size_t)dsize, m_allocator_id);
     m_data_size = dsize;
     m_alloced   = true;
     m_mmaped    = false;
@@ -17053,6 +20251,7 @@ Node::allocate(index_t dsize)
 void
 Node::mmap(const std::string &stream_path, index_t data_size)
 {
+    invalidate_caches();
     m_mmap = new MMap();
     m_mmap->open(stream_path,data_size);
     m_data = m_mmap->data_ptr();
@@ -17061,11 +20260,24 @@ Node::mmap(const std::string &stream_path, index_t data_size)
     m_mmaped  = true;
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::mmap_advise(const std::string &advice)
+{
+    if(m_mmaped && m_mmap != NULL)
+    {
+        m_mmap->advise(advice);
+    }
+}
+
 
 //---------------------------------------------------------------------------//
 void
 Node::release()
 {
+    check_not_frozen("reset");
+    invalidate_caches();
+
     // delete all children
     for (size_t i = 0; i < m_children.size(); i++)
     {
@@ -17073,9 +20285,23 @@ Node::release()
         delete node;
     }
     m_children.clear();
+    m_children_pending = false;
 
-    // clean up any allocated or mmaped buffers
-    if(m_alloced && m_data)
+    // clean up any allocated, shared, compressed, or mmaped buffers
+    if(m_compressed != NULL)
+    {
+        delete m_compressed;
+        m_compressed = NULL;
+        m_data = NULL;
+        m_data_size = 0;
+    }
+    else if(m_shared != NULL)
+    {
+        release_shared();
+        m_data = NULL;
+        m_data_size = 0;
+    }
+    else if(m_alloced && m_data)
     {
         ///
         /// TODO: why do we need to check for empty here?
@@ -17103,6 +20329,8 @@ Node::release()
 void
 Node::cleanup()
 {
+    // frozen nodes can still be destroyed
+    m_frozen = false;
     release();
     // if(m_schema->is_root())
     if(m_owns_schema && m_schema != NULL)
@@ -17113,6 +20341,11 @@ Node::cleanup()
     m_schema = NULL;
     m_owns_schema = false;
 
+    delete m_hash_cache;
+    m_hash_cache = NULL;
+
+    delete m_stats_cache;
+    m_stats_cache = NULL;
 }
 
 
@@ -17144,11 +20377,21 @@ Node::init_defaults()
     m_mmaped    = false;
     m_mmap      = NULL;
 
+    m_shared    = NULL;
+    m_compressed = NULL;
+
+    m_children_pending = false;
+
     m_schema = new Schema(DataType::EMPTY_ID);
     m_owns_schema = true;
 
     m_parent = NULL;
     m_allocator_id = 0;
+
+    m_hash_cache = NULL;
+    m_stats_cache = NULL;
+
+    m_frozen = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -17201,6 +20444,10 @@ Node::identify_protocol(const std::string &path,
     {
         io_type = "yaml";
     }
+    else if(file_name_ext == "conduit_pack")
+    {
+        io_type = "conduit_pack";
+    }
 }
 
 
@@ -17253,12 +20500,42 @@ Node::walk_schema(Node    *node,
 
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::create_pending_children() const
+{
+    // lazy trees create their child nodes on first access, the
+    // children use the same data pointer and are pending as well
+    Node *self = const_cast<Node*>(this);
+    self->m_children_pending = false;
+
+    index_t num_children = m_schema->number_of_children();
+    self->m_children.reserve((size_t)num_children);
+    for(index_t i=0; i < num_children; i++)
+    {
+        Schema *curr_schema = m_schema->child_ptr(i);
+        Node *curr_node = new Node();
+        curr_node->set_allocator(m_allocator_id);
+        curr_node->set_schema_ptr(curr_schema);
+        curr_node->set_parent(self);
+        curr_node->set_data_ptr(m_data);
+        curr_node->m_children_pending = curr_schema->number_of_children() > 0;
+        self->append_node_ptr(curr_node);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::mirror_node(Node   *node,
                   Schema *schema,
                   const Node *src)
 {
+    // external data can't refer to a compressed leaf's cache
+    if(src->m_compressed != NULL)
+    {
+        const_cast<Node*>(src)->thaw_compressed_data();
+    }
+
     // we can have an object, list, or leaf
     node->set_data_ptr(src->m_data);
 
@@ -17305,24 +20582,49 @@ Node::mirror_node(Node   *node,
 
 //---------------------------------------------------------------------------//
 void
-Node::compact_to(uint8 *data, index_t curr_offset) const
+Node::compact_to(uint8 *data,
+                 index_t curr_offset,
+                 index_t dest_allocator_id) const
 {
     CONDUIT_ASSERT( (m_schema != NULL) , "Corrupt schema found in compact_to call");
 
-    index_t dtype_id = dtype().id();
-    if(dtype_id == DataType::OBJECT_ID ||
-       dtype_id == DataType::LIST_ID)
-    {
-            std::vector<Node*>::const_iterator itr;
-            for(itr = m_children.begin(); itr < m_children.end(); ++itr)
-            {
-                (*itr)->compact_to(data,curr_offset);
-                curr_offset +=  (*itr)->total_bytes_compact();
-            }
-    }
-    else
+    // runs of compact leaves that are adjacent in memory (and use the
+    // same allocator) are coalesced, and copied with one conduit_memcpy.
+    // If an entire tree is compact and contiguous, this is a single memcpy.
+    NodeConstLeafIterator itr(*this, true);
+    while(itr.has_next())
     {
-        compact_elements_to(&data[curr_offset]);
+        const NodeConstLeafSpan &span = itr.next();
+        index_t nbytes = span.number_of_bytes();
+        if(nbytes <= 0)
+        {
+            continue;
+        }
+
+        const Node &leaf = span.leaf();
+        if(span.is_compact())
+        {
+            utils::conduit_memcpy(data + curr_offset,
+                                  span.data(),
+                                  (size_t)nbytes,
+                                  dest_allocator_id,
+                                  leaf.allocator());
+        }
+        else
+        {
+            const DataType &dt = leaf.dtype();
+            // dest will be the expected compact rep, in terms of ele byte
+            size_t ele_bytes = (size_t) DataType::default_bytes(dt.id());
+            utils::conduit_memcpy_strided_elements(data + curr_offset,   // dest ptr
+                                                   (size_t)dt.number_of_elements(), // num ele
+                                                   ele_bytes,            // dest bytes per ele
+                                                   ele_bytes,            // dest stride
+                                                   span.data(),          // src ptr
+                                                   (size_t)dt.stride(),  // src stride
+                                                   dest_allocator_id,    // dest allocator
+                                                   leaf.allocator());    // src allocator
+        }
+        curr_offset += nbytes;
     }
 }
 
@@ -17356,7 +20658,9 @@ Node::compact_elements_to(uint8 *data) const
                                                ele_bytes,      // dest bytes per ele
                                                ele_bytes,      // dest stride
                                                element_ptr(0), // src ptr
-                                               src_stride);    // src stride
+                                               src_stride,     // src stride
+                                               0,              // dest allocator
+                                               m_allocator_id);// src allocator
 
     }
 }
@@ -17366,48 +20670,37 @@ Node::compact_elements_to(uint8 *data) const
 void
 Node::serialize(uint8 *data,index_t curr_offset) const
 {
-    if(dtype().id() == DataType::OBJECT_ID ||
-       dtype().id() == DataType::LIST_ID)
-    {
-        std::vector<Node*>::const_iterator itr;
-        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
-        {
-            (*itr)->serialize(&data[0],curr_offset);
-            curr_offset+=(*itr)->total_strided_bytes();
-        }
-    }
-    else
-    {
-        if(is_compact())
-        {
-          utils::conduit_memcpy(&data[curr_offset],
-                                element_ptr(0),
-                                (size_t)total_bytes_compact());
-        }
-        else // ser as is. This copies stride * num_ele bytes
-        {
-            // copy all elements
-            compact_elements_to(&data[curr_offset]);
-        }
-
-    }
+    // the serialized form is the compact form, leaves are packed in
+    // depth-first order (runs of contiguous leaves are copied at once)
+    compact_to(data,curr_offset,0);
 }
 
 
 //---------------------------------------------------------------------------//
 index_t
-Node::total_bytes_allocated() const
+Node::total_strided_bytes() const
 {
-    index_t res = allocated_bytes();
+    StatsCache stats;
+    stats_tree(false,stats);
+    return stats.strided_bytes;
+}
 
-    NodeConstIterator itr = children();
-    while(itr.has_next())
-    {
-        const Node &curr = itr.next();
-        res += curr.total_bytes_allocated();
-    }
+//---------------------------------------------------------------------------//
+index_t
+Node::total_bytes_compact() const
+{
+    StatsCache stats;
+    stats_tree(false,stats);
+    return stats.bytes_compact;
+}
 
-    return res;
+//---------------------------------------------------------------------------//
+index_t
+Node::total_bytes_allocated() const
+{
+    StatsCache stats;
+    stats_tree(false,stats);
+    return stats.bytes_allocated;
 }
 
 
@@ -17415,16 +20708,34 @@ Node::total_bytes_allocated() const
 index_t
 Node::total_bytes_mmaped() const
 {
-    index_t res = mmaped_bytes();
+    StatsCache stats;
+    stats_tree(false,stats);
+    return stats.bytes_mmaped;
+}
 
-    NodeConstIterator itr = children();
-    while(itr.has_next())
-    {
-        const Node &curr = itr.next();
-        res += curr.total_bytes_mmaped();
-    }
+//---------------------------------------------------------------------------//
+index_t
+Node::total_bytes_shared() const
+{
+    StatsCache stats;
+    stats_tree(false,stats);
+    return stats.bytes_shared;
+}
 
-    return res;
+//---------------------------------------------------------------------------//
+index_t
+Node::total_bytes_compressed() const
+{
+    StatsCache stats;
+    stats_tree(false,stats);
+    return stats.bytes_compressed;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Node::compressed_bytes() const
+{
+    return m_compressed != NULL ? m_compressed->block_bytes() : 0;
 }
 
 //---------------------------------------------------------------------------//
@@ -17470,6 +20781,8 @@ Node::contiguous_with(const Node &n) const
 bool
 Node::contiguous_with(uint8 *start_addy, uint8 *&end_addy) const
 {
+    materialize_children();
+
     bool res = true;
 
     index_t dtype_id = dtype().id();
@@ -17542,6 +20855,14 @@ Node::contiguous_data_ptr()
         return NULL;
     }
 
+    // copy-on-write leaves are separate allocations, if any are copied
+    // the tree may no longer be contiguous
+    unshare_data_tree();
+    if(!is_contiguous())
+    {
+        return NULL;
+    }
+
     // if contiguous, we simply need the first non null pointer.
     // Note: use const_cast so we can share the same helper func
     return const_cast<void*>(find_first_data_ptr());
@@ -17564,6 +20885,8 @@ Node::contiguous_data_ptr() const
 const void *
 Node::find_first_data_ptr() const
 {
+    materialize_children();
+
     const void *res = NULL;
 
     index_t dtype_id = dtype().id();
@@ -17697,70 +21020,16 @@ Node::diff(const Node &n, Node &info, const float64 epsilon, bool relaxint) cons
     }
     else // leaf node
     {
-        if(dtype().is_int8())
-        {
-            int8_array t_array = value();
-            int8_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_int16())
-        {
-            int16_array t_array = value();
-            int16_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_int32())
-        {
-            int32_array t_array = value();
-            int32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_int64())
-        {
-            int64_array t_array = value();
-            int64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint8())
-        {
-            uint8_array t_array = value();
-            uint8_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint16())
-        {
-            uint16_array t_array = value();
-            uint16_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint32())
-        {
-            uint32_array t_array = value();
-            uint32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint64())
-        {
-            uint64_array t_array = value();
-            uint64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_float32())
-        {
-            float32_array t_array = value();
-            float32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_float64())
+        if(dtype().is_number())
         {
-            float64_array t_array = value();
-            float64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
+            dispatch(*this, detail::LeafDiff(*this, n, info, epsilon, false, res));
         }
         else if(dtype().is_char8_str())
         {
             // NOTE: Can't use 'value' for characters since type aliasing can
             // confuse the 'char' type on various platforms.
+            read_compressed_data();
+            n.read_compressed_data();
             char_array t_array((const void*)m_data, dtype());
             char_array n_array((const void*)n.m_data, n.dtype());
             res |= t_array.diff(n_array, info, epsilon);
@@ -17865,70 +21134,16 @@ Node::diff_compatible(const Node &n, Node &info, const float64 epsilon,
     }
     else // leaf node
     {
-        if(dtype().is_int8())
-        {
-            int8_array t_array = value();
-            int8_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_int16())
-        {
-            int16_array t_array = value();
-            int16_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_int32())
-        {
-            int32_array t_array = value();
-            int32_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_int64())
-        {
-            int64_array t_array = value();
-            int64_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint8())
-        {
-            uint8_array t_array = value();
-            uint8_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint16())
-        {
-            uint16_array t_array = value();
-            uint16_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint32())
-        {
-            uint32_array t_array = value();
-            uint32_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint64())
-        {
-            uint64_array t_array = value();
-            uint64_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_float32())
-        {
-            float32_array t_array = value();
-            float32_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
-        }
-        else if(dtype().is_float64())
+        if(dtype().is_number())
         {
-            float64_array t_array = value();
-            float64_array n_array = n.value();
-            res |= t_array.diff_compatible(n_array, info, epsilon);
+            dispatch(*this, detail::LeafDiff(*this, n, info, epsilon, true, res));
         }
         else if(dtype().is_char8_str())
         {
             // NOTE: Can't use 'value' for characters since type aliasing can
             // confuse the 'char' type on various platforms.
+            read_compressed_data();
+            n.read_compressed_data();
             char_array t_array((const void*)m_data, dtype());
             char_array n_array((const void*)n.m_data, n.dtype());
             res |= t_array.diff_compatible(n_array, info, epsilon);
@@ -17945,15 +21160,43 @@ Node::diff_compatible(const Node &n, Node &info, const float64 epsilon,
     return res;
 }
 
+//---------------------------------------------------------------------------//
+bool
+Node::has_diff(const Node &n, const float64 epsilon, bool relaxint) const
+{
+    return detail::node_has_diff(*this, n, epsilon, relaxint, false);
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::has_diff_compatible(const Node &n, const float64 epsilon,
+    bool relaxint) const
+{
+    return detail::node_has_diff(*this, n, epsilon, relaxint, true);
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::info(Node &res, const std::string &curr_path) const
 {
+    materialize_children();
+
     // extract
     // mem_spaces:
-    //  node path, pointer, alloced, mmaped or external, bytes
+    //  node path, pointer, alloced, mmaped, shared, compressed or
+    //  external, bytes
 
-    if(m_data != NULL)
+    if(m_compressed != NULL)
+    {
+        // compressed leaves are keyed by their compressed block
+        std::string ptr_key = utils::to_hex_string(m_compressed->block_ptr());
+        Node &ptr_ref = res["mem_spaces"][ptr_key];
+        ptr_ref["path"]  = curr_path;
+        ptr_ref["type"]  = "compressed";
+        ptr_ref["bytes"] = m_compressed->block_bytes();
+        ptr_ref["decompressed_bytes"] = m_compressed->data_size();
+    }
+    else if(m_data != NULL)
     {
         std::string ptr_key = utils::to_hex_string(m_data);
 
@@ -17961,7 +21204,14 @@ Node::info(Node &res, const std::string &curr_path) const
         {
             Node &ptr_ref = res["mem_spaces"][ptr_key];
             ptr_ref["path"] = curr_path;
-            if(m_alloced)
+            if(m_shared != NULL)
+            {
+                ptr_ref["type"]  = "shared";
+                ptr_ref["bytes"] = m_data_size;
+                ptr_ref["allocator_id"] = m_shared->allocator_id();
+                ptr_ref["ref_count"] = m_shared->ref_count();
+            }
+            else if(m_alloced)
             {
                 ptr_ref["type"]  = "allocated";
                 ptr_ref["bytes"] = m_data_size;
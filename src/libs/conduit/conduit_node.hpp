@@ -17,6 +17,7 @@
 //-----------------------------------------------------------------------------
 #include <vector>
 #include <string>
+#include <functional>
 #include <fstream>
 #include <fstream>
 #include <sstream>
@@ -33,7 +34,10 @@
 #include "conduit_data_type.hpp"
 #include "conduit_data_array.hpp"
 #include "conduit_data_accessor.hpp"
+#include "conduit_data_view.hpp"
 #include "conduit_schema.hpp"
+#include "conduit_path.hpp"
+#include "conduit_external_layout.hpp"
 #include "conduit_generator.hpp"
 #include "conduit_node_iterator.hpp"
 #include "conduit_utils.hpp"
@@ -83,6 +87,8 @@ public:
     friend class NodeIterator;
     friend class NodeConstIterator;
     friend class Generator;
+    ///  ExternalLayout re-points the data of bound leaves
+    friend class ExternalLayout;
 
 //-----------------------------------------------------------------------------
 //
@@ -105,11 +111,23 @@ public:
 //-----------------------------------------------------------------------------
     Node();
     Node(const Node &node);
+    /// move constructor, takes ownership of the data and tree structure
+    /// of the passed Node (see move()), passed node is empty afterward.
+    /// A child of a frozen Node is copied and left unchanged.
+    Node(Node &&node) noexcept;
     ~Node();
 
     // returns any node to the empty state
     void reset();
 
+//-----------------------------------------------------------------------------
+// -- pooled allocation --
+//-----------------------------------------------------------------------------
+    /// Node instances are allocated from conduit's metadata pool
+    /// (see utils::metadata_allocate), not the leaf data allocators.
+    static void *operator new(size_t num_bytes);
+    static void  operator delete(void *ptr, size_t num_bytes);
+
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
 //-----------------------------------------------------------------------------
@@ -210,7 +228,9 @@ public:
 ///@{
 //-----------------------------------------------------------------------------
 /// description:
-///
+///  The "conduit_pack" protocol writes a single self-describing binary file
+///  (see conduit_pack.hpp). mmap() detects pack files and maps them
+///  without a separate schema file.
 //-----------------------------------------------------------------------------
     void load(const std::string &stream_path,
               const std::string &protocol="");
@@ -226,6 +246,28 @@ public:
     void mmap(const std::string &stream_path,
               const Schema &schema);
 
+    /// mmap with options
+    ///
+    /// opts:
+    ///   lazy: "true" | "false" (default: "false")
+    ///     when "true", child Nodes are created only when they are first
+    ///     accessed (via fetch, child, iterators, etc). The schema is
+    ///     still fully loaded and leaves point into the mapped region.
+    ///     Note: a lazy tree creates Nodes during const access, so it
+    ///     should not be read from multiple threads until the Nodes
+    ///     used by each thread exist. freeze() creates all of them.
+    ///
+    ///   advice: "normal" | "sequential" | "random" | "willneed"
+    ///     (default: "normal")
+    ///     access pattern hint passed to madvise(). This is ignored on
+    ///     platforms without madvise().
+    void mmap(const std::string &stream_path,
+              const Node &opts);
+
+    void mmap(const std::string &stream_path,
+              const Schema &schema,
+              const Node &opts);
+
 
 //-----------------------------------------------------------------------------
 ///@}
@@ -244,10 +286,15 @@ public:
 ///@{
 //-----------------------------------------------------------------------------
 /// description:
-///
+///  Selects the allocator used for the leaf data this Node allocates. See
+///  utils::pool_allocator_id and utils::aligned_allocator_id for the built
+///  in allocators. Loading a conduit_bin file (or a file with an explicit
+///  schema) into a Node with an aligned allocator places each leaf at an
+///  aligned offset. conduit_pack files keep their leaves 64 byte aligned,
+///  so they load aligned, and mmap() maps their leaves aligned as well.
 //-----------------------------------------------------------------------------
     void    set_allocator(index_t allocator_id);
-    index_t allocator();
+    index_t allocator() const;
     void    reset_allocator();
 //-----------------------------------------------------------------------------
 ///@}
@@ -275,6 +322,27 @@ public:
     void set_node(const Node &data);
     void set(const Node &data);
 
+    //-------------------------------------------------------------------------
+    /// copy-on-write variant of set(const Node &).
+    ///
+    /// Creates the same tree as set(const Node &), but leaves that own
+    /// their memory allocation share it with the passed node instead of
+    /// copying it. Shared buffers are reference counted. The first mutable
+    /// access to a shared leaf of either tree (through value(),
+    /// as_{type}_ptr(), as_{type}_array(), element_ptr(), data_ptr(), or
+    /// set() with a compatible dtype) copies that leaf's data, so it no
+    /// longer shares memory with any other Node. Const access never copies.
+    ///
+    /// Leaves that point to external or memory mapped data, or into an
+    /// allocation owned by a parent (for example after compact_to()) are
+    /// deep copied.
+    ///
+    /// Note: Pointers obtained with const access or external views created
+    /// with set_external() alias the shared memory and are not protected
+    /// by copy-on-write.
+    //-------------------------------------------------------------------------
+    void set_cow(const Node &data);
+
     void set_dtype(const DataType &dtype);
     void set(const DataType &dtype);
 
@@ -287,6 +355,27 @@ public:
     void set_data_using_dtype(const DataType &dtype, void *data);
     void set(const DataType &dtype, void *data);
 
+    //-------------------------------------------------------------------------
+    /// ownership transferring variants of set.
+    ///
+    /// set_owned() makes this node a leaf that adopts the buffer at data,
+    /// described by dtype, without copying it. The buffer is released by
+    /// calling deleter(data) when the last node referencing it lets go.
+    ///
+    /// set(std::vector<T> &&) takes over the storage of a vector of a
+    /// numeric type, the vector is left empty.
+    ///
+    /// Adopted buffers are reference counted like copy-on-write buffers
+    /// (is_data_shared() returns true), so set_cow() shares them without
+    /// copying.
+    //-------------------------------------------------------------------------
+    void set_owned(void *data,
+                   const DataType &dtype,
+                   const std::function<void(void*)> &deleter);
+
+    template <typename T>
+    void set(std::vector<T> &&data);
+
 //-----------------------------------------------------------------------------
 // -- set for bitwidth style scalar types ---
 //-----------------------------------------------------------------------------
@@ -2799,6 +2888,10 @@ public:
 // -- assignment operators for generic types --
 //-----------------------------------------------------------------------------
     Node &operator=(const Node &node);
+    /// move assignment uses move() semantics (a child of a frozen Node is
+    /// copied). Assigning to a frozen Node raises an Error, so unlike the
+    /// move constructor it isn't noexcept.
+    Node &operator=(Node &&node);
     Node &operator=(const DataType &dtype);
     Node &operator=(const Schema &schema);
 
@@ -3111,7 +3204,34 @@ public:
     /// update_external() sets this node to describe the data from the children
     //   in n_src.
     void        update_external(Node &n_src);
-    
+
+    /// bind_external_layout() returns a handle to the external leaves of
+    /// this node (in depth-first order), used to re-point them at new
+    /// data each cycle without rebuilding the schema (see
+    /// conduit::ExternalLayout). Leaves that own, share, or map their
+    /// data are not bound.
+    ExternalLayout bind_external_layout();
+
+//-----------------------------------------------------------------------------
+// -- stream ordered copy methods ---
+//-----------------------------------------------------------------------------
+    /// Variants of set(const Node &), compact_to() and update() that
+    /// enqueue leaf copies on an opaque stream or queue handle when an
+    /// async memcpy handler is bound to the allocators involved
+    /// (see utils::set_memcpy_async_handler). Other copies are done
+    /// synchronously.
+    ///
+    /// The returned token waits for the enqueued copies. n_src must stay
+    /// valid, and this Node's data must not be read, until they complete.
+    utils::AsyncCopyToken set_async(const Node &n_src,
+                                    void *stream);
+
+    utils::AsyncCopyToken compact_to_async(Node &n_dest,
+                                           void *stream) const;
+
+    utils::AsyncCopyToken update_async(const Node &n_src,
+                                       void *stream);
+
 //-----------------------------------------------------------------------------
 // -- move and swap ---
 //-----------------------------------------------------------------------------
@@ -3668,6 +3788,15 @@ public:
                                 const std::string &eoe="\n") const;
 
     /// accept formatting args via conduit node
+    ///
+    /// in addition to the args above, opts can contain:
+    ///  float_precision: max number of significant digits for floating
+    ///    point values (default: 15). Values <= 0 use the shortest
+    ///    representation that reads back as the same value.
+    ///  base64_threshold: ("conduit_json" only) numeric leaves with more
+    ///    than this many bytes are written with a base64 encoded value
+    ///    ({"base64": "..."}), which the Generator reads back.
+    ///    (default: -1, disabled)
     std::string         to_json(const conduit::Node &opts) const;
 
     void                to_json_stream(std::ostream &os,
@@ -3715,6 +3844,11 @@ public:
                                 const std::string &eoe="\n") const;
 
     /// accept formatting args via conduit node
+    ///
+    /// in addition to the args above, opts can contain:
+    ///  float_precision: max number of significant digits for floating
+    ///    point values (default: 15). Values <= 0 use the shortest
+    ///    representation that reads back as the same value.
     std::string         to_yaml(const conduit::Node &opts) const;
 
     void                to_yaml_stream(std::ostream &os,
@@ -3776,7 +3910,13 @@ public:
     // check if data owned by this node is externally
     // allocated.
     bool             is_data_external() const
-                        {return !m_alloced;}
+                        {return !m_alloced && m_shared == NULL &&
+                                m_compressed == NULL;}
+
+    // check if data referenced by this node is a copy-on-write
+    // buffer shared with other nodes (see set_cow)
+    bool             is_data_shared() const
+                        {return m_shared != NULL;}
 
     // check if this node is the root of a tree nodes.
     bool             is_root() const
@@ -3790,15 +3930,22 @@ public:
                         {return m_parent;}
 
     //memory space info
+    ///
+    /// The total_* methods sum over this node hierarchy. They reuse the
+    /// sums of subtrees cached by freeze() or by info with the cache
+    /// option, and don't store new sums, so concurrent calls on a shared
+    /// tree are race free. Cached sums are invalidated by Node methods
+    /// that change the hierarchy or its memory (set, update, remove,
+    /// reset, set_cow, ...), so later calls only revisit changed subtrees.
+    /// Changes made directly to a node's Schema are not tracked.
+    ///
 
     /// stride() * (num_elements()-1) + element_bytes() summed over all
     /// leaves
-    index_t          total_strided_bytes() const
-                        { return m_schema->total_strided_bytes();}
+    index_t          total_strided_bytes() const;
 
     /// num_elements() * element_bytes() summed over all leaves
-    index_t          total_bytes_compact() const
-                        { return m_schema->total_bytes_compact();}
+    index_t          total_bytes_compact() const;
 
 
     /// total number of bytes allocated in this node hierarchy
@@ -3807,6 +3954,11 @@ public:
     /// total number of bytes memory mapped in this node hierarchy
     index_t           total_bytes_mmaped() const;
 
+    /// total number of bytes in copy-on-write buffers shared with other
+    /// nodes in this node hierarchy (see set_cow). These are not included
+    /// in total_bytes_allocated()
+    index_t           total_bytes_shared() const;
+
     /// Is this node using a compact data layout?
     bool              is_compact() const
                          {return m_schema->is_compact();}
@@ -3865,10 +4017,135 @@ public:
                                      const float64 epsilon = CONDUIT_EPSILON,
                                      bool relaxint = false) const;
 
+    /// boolean versions of diff and diff_compatible, which return true at
+    //  the first difference found instead of building an info node.
+    //  Compact leaves are compared with memcmp before any epsilon test, and
+    //  if conduit is built with OpenMP, large leaves are compared in
+    //  parallel.
+    bool             has_diff(const Node &n,
+                              const float64 epsilon = CONDUIT_EPSILON,
+                              bool relaxint = false) const;
+
+    bool             has_diff_compatible(const Node &n,
+                                         const float64 epsilon = CONDUIT_EPSILON,
+                                         bool relaxint = false) const;
+
+    ///
+    /// hash() returns a 64-bit hash of this node's hierarchy (names, dtype
+    /// ids, number of elements, element bytes and endianness) and leaf
+    /// values. Offsets and strides are not included, so the same values
+    /// in compact and strided layouts have the same hash. The hash uses
+    /// xxHash64, leaves larger than 1 MiB are hashed in 1 MiB blocks.
+    ///
+    /// opts:
+    ///   data: "true"    include leaf values (default)
+    ///         "false"   only hash the hierarchy
+    ///   seed: integer   hash seed (default: 0)
+    ///   bits: 64 | 128  size of the hash written by hash(opts,res)
+    ///                   (default: 64), the first word of a 128-bit hash
+    ///                   is the 64-bit hash
+    ///   num_threads:    threads used to hash the blocks of large leaves
+    ///                   (default: 1, <= 0 uses the hardware concurrency)
+    ///   cache: "false"  (default)
+    ///          "true"   keep the hash of each subtree and reuse it in
+    ///                   later calls that use the same data and seed opts
+    ///
+    /// Cached hashes are invalidated by Node methods that change the
+    /// hierarchy or write leaf data (set, set_external, update, reset,
+    /// adding or removing children, etc). Writes through pointers,
+    /// arrays, or views obtained from a node, or to external data, are not
+    /// tracked: call invalidate_hash() after them.
+    uint64           hash() const;
+    uint64           hash(const Node &opts) const;
+    /// sets res to a uint64 array holding the (1 or 2 word) hash
+    void             hash(const Node &opts, Node &res) const;
+
+    /// drops cached hashes of this node, its descendants and its ancestors
+    void             invalidate_hash();
+
+    ///
+    /// freeze() makes this node and its descendants read-only, so the tree
+    /// can be shared by many reader threads. Children that have not been
+    /// created yet (see mmap with lazy) are created first.
+    ///
+    /// While frozen, const methods (fetch_existing, child, has_path,
+    /// value, as_{type}, to_{type}, iterators, diff, hash, to_json ...)
+    /// don't modify the tree, so concurrent calls from many threads are
+    /// race free and take no locks. Methods that change the hierarchy or
+    /// data (set, update, add_child, fetch of a new path, append, remove,
+    /// rename_child, reset, endian_swap, ...) raise an Error.
+    ///
+    /// Notes:
+    ///  - Non-const accessors of a frozen tree (non-const fetch of an
+    ///    existing path, value(), element_ptr, ...) do not unshare
+    ///    copy-on-write data. Writing through the pointers they return is
+    ///    not supported.
+    ///  - hash with the cache option uses existing cached hashes of a
+    ///    frozen tree, but does not store new ones.
+    ///  - conduit::Path objects cache lookup hints, so each thread should
+    ///    use its own Path instances.
+    ///
+    void             freeze();
+    /// restores normal behavior for this node and its descendants.
+    /// A node whose parent is frozen can't be unfrozen.
+    void             unfreeze();
+    bool             is_frozen() const
+                        { return m_frozen; }
+
+    ///
+    /// compress() stores the data of large leaves owned by this node
+    /// hierarchy compressed (see conduit::compression), to reduce the
+    /// memory used by cold data.
+    ///
+    /// opts:
+    ///   method:    "lz"     (default)
+    ///   shuffle:   "true"   (default) shuffle the bytes of each element
+    ///                       before compressing
+    ///              "false"
+    ///   threshold: integer  leaves with fewer bytes are left as is
+    ///                       (default: 4096)
+    ///
+    /// Only leaves whose memory is allocated by the node on the host are
+    /// compressed (external, mmaped, copy-on-write and device leaves are
+    /// left as is), and leaves that don't get smaller are left as is.
+    ///
+    /// Compressed leaves are read transparently: const access (value(),
+    /// as_{type}_ptr(), data_ptr(), arrays, to_json, diff, hash, ...)
+    /// decompresses into a process wide cache with a memory budget (see
+    /// conduit::compression::set_cache_budget), and the pointers returned
+    /// are valid until the leaf is evicted by access to other compressed
+    /// leaves. Non-const access decompresses the leaf permanently.
+    /// Compressed nodes can't be frozen, freeze() decompresses them first.
+    ///
+    void             compress();
+    void             compress(const Node &opts);
+    /// permanently decompresses all compressed leaves of this hierarchy
+    void             decompress();
+    /// true if this node's data is stored compressed
+    bool             is_data_compressed() const
+                        { return m_compressed != NULL; }
+    /// returns the number of compressed bytes held by this node
+    index_t          compressed_bytes() const;
+    /// total number of compressed bytes held in this node hierarchy
+    /// (compressed leaves are not included in total_bytes_allocated())
+    index_t          total_bytes_compressed() const;
+
     ///
     /// info() creates a node that contains metadata about the current
     /// node's memory properties
     void             info(Node &nres) const;
+    ///
+    /// opts:
+    ///   summary: "false"  (default) include the "mem_spaces" entry for
+    ///                     each data pointer in the hierarchy
+    ///            "true"   only include the total_* byte counts
+    ///   cache:   "false"  (default)
+    ///            "true"   keep the byte counts of each subtree for later
+    ///                     info and total_* calls (like hash, this writes
+    ///                     to the tree, so don't use it on a tree other
+    ///                     threads are reading)
+    ///
+    void             info(const Node &opts, Node &nres) const;
 
     /// TODO: this is inefficient w/o move semantics, but is very
     /// convenient for testing and example programs.
@@ -3878,6 +4155,14 @@ public:
     /// describe() creates a node that replaces each leaf with
     ///  descriptive statistics (count, mean, min, max) and a string repd 
     ///  values summary
+    ///
+    /// options:
+    ///   threshold:   number of values shown in the values summary (def: 5)
+    ///   num_threads: number of threads used to compute the leaf stats,
+    ///                <= 0 uses all hardware threads (def: 1)
+    ///   sample:      when > 0, leaves with more elements are summarized
+    ///                from an evenly strided sample of about `sample`
+    ///                elements (the result includes `sample_count`) (def: 0)
     void             describe(Node &nres) const;
     void             describe(const Node &opts, Node &nres) const;
 
@@ -3915,6 +4200,31 @@ public:
     NodeIterator        children();
     NodeConstIterator   children() const;
 
+    /// return a depth-first iterator over this node's leaves. With
+    /// coalesce, physically contiguous neighboring leaves are yielded as
+    /// a single span (see conduit::NodeLeafIteratorBase)
+    NodeLeafIterator        leaves(bool coalesce = false);
+    NodeConstLeafIterator   leaves(bool coalesce = false) const;
+
+    /// calls func for each leaf span of this node
+    ///
+    /// opts:
+    ///   coalesce: "true" | "false" (default: "false")
+    ///     when "true", contiguous neighboring leaves are passed as one span
+    ///   num_threads:  threads used to call func
+    ///                (default: 1, <= 0 uses the hardware concurrency)
+    ///
+    /// With more than one thread, spans are processed concurrently and in
+    /// no particular order (use leaf_index() to place results), so func
+    /// must be thread safe and must not change the tree. The first
+    /// exception thrown by func is rethrown on the calling thread.
+    void    for_each_leaf(const std::function<void(const NodeLeafSpan&)> &func);
+    void    for_each_leaf(const std::function<void(const NodeLeafSpan&)> &func,
+                          const Node &opts);
+    void    for_each_leaf(const std::function<void(const NodeConstLeafSpan&)> &func) const;
+    void    for_each_leaf(const std::function<void(const NodeConstLeafSpan&)> &func,
+                          const Node &opts) const;
+
     // When fetching, there is no absolute path construct, all paths are
     /// fetched relative to the current node (a leading "/" is ignored when
     /// fetching). Empty path names are also ignored, fetching "a///b" is
@@ -3931,6 +4241,15 @@ public:
     Node             &fetch_existing(const std::string &path);
     const Node       &fetch_existing(const std::string &path) const;
 
+    /// pre-parsed path variants of fetch and fetch_existing
+    /// (see conduit::Path). These avoid re-parsing the path string and
+    /// do not allocate when the path already exists.
+    Node             &fetch(const Path &path);
+    const Node       &fetch(const Path &path) const;
+
+    Node             &fetch_existing(const Path &path);
+    const Node       &fetch_existing(const Path &path) const;
+
     // add_child will not try to parse the name as a path. "foo/bar.png" is
     // a legal name.
     Node             &add_child(const std::string &name);
@@ -3975,6 +4294,8 @@ public:
     bool        has_child(const std::string &name) const;
     /// checks if given path exists in the Node hierarchy
     bool        has_path(const std::string &path) const;
+    /// checks if given pre-parsed path exists in the Node hierarchy
+    bool        has_path(const Path &path) const;
     /// returns the direct child names for this node
     const std::vector<std::string> &child_names() const;
 
@@ -3984,6 +4305,49 @@ public:
     //  for the term `append`.
     Node   &append();
 
+    /// reserves storage for num_children children, so appending
+    /// children up to that count doesn't reallocate the child vectors
+    /// (list and object interfaces, an empty node becomes a list)
+    void    reserve_children(index_t num_children);
+
+    /// a leaf passed to build_from_paths: its path (object names
+    /// separated by '/'), dtype, and data (as passed to set_external)
+    struct PathEntry
+    {
+        std::string  path;
+        DataType     dtype;
+        void        *data;
+    };
+
+    /// replaces this node with the tree described by a flat list of leaf
+    /// entries. Paths are split once and grouped by prefix, each object
+    /// level is created once with reserved children, and children keep the
+    /// order their names first appear (as with repeated set_path calls;
+    /// the last entry for a repeated path wins).
+    ///
+    /// When external is true, leaves point to the entries' data. Otherwise
+    /// all leaves are copied into one allocation, compacted and laid out
+    /// in depth-first order (entries with NULL data are zero filled).
+    ///
+    /// A path that is both a leaf and a prefix of another path is an
+    /// error.
+    void    build_from_paths(const std::vector<PathEntry> &entries,
+                             bool external = false);
+
+    /// appends num_values values to this leaf array (growable leaf
+    /// interface). The leaf's allocation grows geometrically and its
+    /// capacity is tracked separately from its dtype length, so repeated
+    /// appends are amortized O(1). An empty node becomes a compact array
+    /// of T. Non-empty leaves must hold T values, non-compact or
+    /// non-owned data is compacted into a new allocation on the first
+    /// append.
+    template <typename T>
+    void    append_values(const T *values, index_t num_values);
+
+    /// number of elements the leaf's allocation can hold before
+    /// append_values needs to grow it
+    index_t values_capacity() const;
+
     /// remove child at index (list and object interfaces)
     void    remove(index_t idx);
     /// remove child at given path (object interface)
@@ -4152,16 +4516,28 @@ public:
 
     /// returns the number of bytes allocated by this node
     index_t          allocated_bytes() const
-                        {return !m_mmaped ? m_data_size : 0;}
+                        {return (!m_mmaped && m_shared == NULL) ?
+                                 m_data_size : 0;}
 
     /// returns the number of bytes mmaped by this node
     index_t          mmaped_bytes() const
                         {return m_mmaped ? m_data_size : 0;}
 
+    /// returns the number of bytes in a copy-on-write buffer this node
+    /// shares with other nodes
+    index_t          shared_bytes() const
+                        {return m_shared != NULL ? m_data_size : 0;}
+
     void  *element_ptr(index_t idx)
-        {return static_cast<char*>(m_data) + dtype().element_index(idx);};
+        {
+            unshare_data();
+            return static_cast<char*>(m_data) + dtype().element_index(idx);
+        };
     const void  *element_ptr(index_t idx) const
-        {return static_cast<char*>(m_data) + dtype().element_index(idx);};
+        {
+            read_compressed_data();
+            return static_cast<char*>(m_data) + dtype().element_index(idx);
+        };
 
 //-----------------------------------------------------------------------------
 /// description:
@@ -4400,6 +4776,30 @@ public:
     long_double_accessor  as_long_double_accessor() const;
 #endif
 
+    // typed views (see conduit_data_view.hpp)
+    //
+    // T must be a bitwidth style type (int8, ..., float64) that matches
+    // the dtype of this node, or char for char8_str leaves.
+    //
+    // as_span() requires compact data, and errors otherwise.
+    template <typename T>
+    Span<T>              as_span();
+    template <typename T>
+    Span<const T>        as_span() const;
+
+    // with STRIDE > 0, the dtype stride must equal STRIDE
+    template <typename T, index_t STRIDE = 0>
+    StridedView<T,STRIDE>        as_strided_view();
+    template <typename T, index_t STRIDE = 0>
+    StridedView<const T,STRIDE>  as_strided_view() const;
+
+    // RANK extents, first index fastest. the product of the extents
+    // must equal the number of elements.
+    template <typename T, index_t RANK>
+    MDView<T,RANK>          as_mdview(const index_t *extents);
+    template <typename T, index_t RANK>
+    MDView<const T,RANK>    as_mdview(const index_t *extents) const;
+
 
 //-----------------------------------------------------------------------------
 ///@}
@@ -4429,7 +4829,7 @@ private:
     ///
     void             set_schema_ptr(Schema *schema_ptr);
     void             append_node_ptr(Node *node)
-                        {m_children.push_back(node);}
+                        {invalidate_caches(); m_children.push_back(node);}
 
     void             set_parent(Node *new_parent)
                         { m_parent = new_parent;}
@@ -4475,8 +4875,18 @@ private:
     // memory allocation and mapping routines
     void             allocate(index_t dsize);
     void             allocate(const DataType &dtype);
+    // sets the schema and allocates the bytes it spans, for callers that
+    // fill the data themselves (Generator decodes base64 data in place)
+    void             allocate_using_schema(const Schema &schema);
     void             mmap(const std::string &stream_path,
                           index_t dsize);
+    // passes an access pattern hint for the active memory map
+    void             mmap_advise(const std::string &advice);
+    // creates children for nodes whose children are pending
+    // (see lazy mmap)
+    void             materialize_children() const
+                        { if(m_children_pending) create_pending_children();}
+    void             create_pending_children() const;
     // release any alloced or memory mapped data
     void             release();
     // clean up everything (used by destructor)
@@ -4514,14 +4924,137 @@ private:
                                  Schema *schema,
                                  const Node *src);
 
+    /// used by the typed view methods, errors if this node isn't a leaf
+    /// of dtype_id, isn't compact when require_compact is true, or has a
+    /// stride other than stride (when stride > 0). the product of the
+    /// rank extents (if not NULL) must equal the number of elements.
+    void              check_data_view(index_t dtype_id,
+                                      bool require_compact,
+                                      index_t stride,
+                                      const index_t *extents,
+                                      index_t rank,
+                                      const char *method) const;
+
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with copy-on-write sharing --
+//
+//-----------------------------------------------------------------------------
+    /// makes this leaf reference the same data as the passed leaf,
+    /// converting the passed leaf's allocation to a shared buffer if
+    /// needed. returns false if the passed leaf's data can't be shared.
+    bool              share_data(const Node &src);
+    /// makes this leaf the first reference of a shared buffer that
+    /// adopts data (see set_owned)
+    void              own_data(void *data,
+                               const DataType &dtype,
+                               const std::function<void(void*)> &deleter);
+    /// if this node references a shared buffer that other nodes also
+    /// reference, copies its data to a new allocation owned by this node
+    /// (frozen nodes keep their shared buffers, see freeze())
+    void              unshare_data()
+                        { if(m_shared != NULL && !m_frozen)
+                            { unshare_shared_data(); }
+                          if(m_compressed != NULL)
+                            { thaw_compressed_data(); } }
+    void              unshare_shared_data();
+    /// calls unshare_data() on this node and all of its descendants
+    void              unshare_data_tree();
+    /// drops this node's reference to its shared buffer
+    void              release_shared();
+
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with growable leaves --
+//
+//-----------------------------------------------------------------------------
+    /// appends the values described by values_dtype (compact, offset 0)
+    /// to this leaf, growing its allocation geometrically when needed
+    void              append_leaf_values(const DataType &values_dtype,
+                                         const void *values);
+
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with compressed leaves --
+//
+//-----------------------------------------------------------------------------
+    /// if this leaf is compressed, points m_data at its cached
+    /// decompressed data (see compress())
+    void              read_compressed_data() const
+                        { if(m_compressed != NULL) load_compressed_data(); }
+    void              load_compressed_data() const;
+    /// if this leaf is compressed, decompresses it into a new allocation
+    /// owned by this node
+    void              thaw_compressed_data();
+    /// points this node's compressed buffer (if any) at this node,
+    /// used when nodes trade their data (see swap)
+    void              own_compressed_data();
+    /// recursive implementation of compress
+    void              compress_tree(const std::string &method,
+                                    bool shuffle,
+                                    index_t threshold);
+
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with update --
+//
+//-----------------------------------------------------------------------------
+    /// if this node and n_src have the same layout of compact leaves and
+    /// both are contiguous, copies all of n_src's data at once and
+    /// returns true. otherwise returns false and does nothing.
+    bool              update_contiguous(const Node &n_src);
+    /// recursive implementations of update and update_compatible
+    void              update_tree(const Node &n_src);
+    void              update_compatible_tree(const Node &n_src);
+
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with frozen nodes --
+//
+//-----------------------------------------------------------------------------
+    /// raises an error if this node is frozen, called by methods that
+    /// change this node's hierarchy or data
+    void              check_not_frozen(const char *method) const
+                        { if(m_frozen) frozen_error(method); }
+    void              frozen_error(const char *method) const;
+
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with hashing and cached sizes --
+//
+//-----------------------------------------------------------------------------
+    /// marks the cached hash and sizes of this node and its ancestors as
+    /// stale, called by methods that change this node's hierarchy or data
+    void              invalidate_caches()
+                        { if(m_hash_cache != NULL) invalidate_hash_path();
+                          if(m_stats_cache != NULL) invalidate_stats_path(); }
+    void              invalidate_stats_path();
+    void              invalidate_hash_path();
+    /// drops cached hashes of this node's descendants
+    void              invalidate_hash_descendants();
+    /// recursive implementation of hash, writes num_words words to res
+    void              hash_tree(bool data,
+                                uint64 seed,
+                                index_t num_words,
+                                index_t num_threads,
+                                bool cache,
+                                uint64 *res) const;
+    /// private class that holds the cached sizes of a subtree
+    class StatsCache;
+    /// recursive implementation of the total_* methods, sets res to the
+    /// sizes of this subtree, stores them in each node if cache is true
+    void              stats_tree(bool cache, StatsCache &res) const;
+
 //-----------------------------------------------------------------------------
 //
 // -- private methods that help with compaction, serialization, and info  --
 //
 //-----------------------------------------------------------------------------
+    /// copies dispatch using dest_allocator_id for the memory at data
     void              compact_to(uint8 *data,
-                                 index_t curr_offset) const;
-    /// compact helper for leaf types
+                                 index_t curr_offset,
+                                 index_t dest_allocator_id) const;
+    /// compact helper for leaf types, data is host memory
     void              compact_elements_to(uint8 *data) const;
 
 
@@ -4578,12 +5111,18 @@ private:
                                         const std::string &pad=" ",
                                         const std::string &eoe="\n") const;
 
+    /// float_precision: see DataArray::to_json_stream
+    /// base64_threshold: (detailed only) numeric leaves with more than
+    ///  this many bytes are written as base64 encoded values
+    ///  (< 0 disables base64 values)
     void                to_json_generic(std::ostream &os,
                                         bool detailed,
                                         index_t indent=2,
                                         index_t depth=0,
                                         const std::string &pad=" ",
-                                        const std::string &eoe="\n") const;
+                                        const std::string &eoe="\n",
+                                        index_t float_precision=15,
+                                        index_t base64_threshold=-1) const;
 
     //-------------------------------------------------------------------------
     // transforms the node to json without any conduit schema constructs
@@ -4645,6 +5184,12 @@ private:
                                     const std::string &pad=" ",
                                     const std::string &eoe="\n") const;
 
+    //-------------------------------------------------------------------------
+    // writes a leaf's value as a json object with the base64 encoded
+    // compact data: {"base64": "..."}
+    //-------------------------------------------------------------------------
+    void             to_base64_json_value(std::ostream &os) const;
+
 //-----------------------------------------------------------------------------
 //
 // -- private to_yaml helpers --
@@ -4672,7 +5217,8 @@ private:
                                         index_t indent=2,
                                         index_t depth=0,
                                         const std::string &pad=" ",
-                                        const std::string &eoe="\n") const;
+                                        const std::string &eoe="\n",
+                                        index_t float_precision=15) const;
     //-------------------------------------------------------------------------
     // transforms the node to yaml without any conduit schema constructs
     //-------------------------------------------------------------------------
@@ -4719,6 +5265,9 @@ private:
 
     /// collection of children
     std::vector<Node*>   m_children;
+    /// true if this node's schema has children that we have
+    /// not created Nodes for yet (see lazy mmap)
+    bool                 m_children_pending;
 
     // TODO: DataContainer?
     // pointer to the node's data
@@ -4741,13 +5290,185 @@ private:
     // simply knowing if this pointer is valid.
     MMap     *m_mmap;
 
+    // private class that implements a reference counted buffer used
+    // for copy-on-write leaves
+    class SharedBuffer;
+
+    // shared buffer referenced by this node (NULL unless this node's data
+    // is shared via set_cow). when set, m_data and m_data_size describe the
+    // shared buffer, and m_alloced is false
+    SharedBuffer *m_shared;
+
+    // private class that holds the compressed data of a leaf and its
+    // cached decompressed copy
+    class CompressedBuffer;
+
+    // compressed data of this node (NULL unless compress() compressed this
+    // leaf). when set, m_data points at the cached decompressed data
+    // (NULL while not cached), m_data_size is 0 and m_alloced is false
+    CompressedBuffer *m_compressed;
+
     // allocator id for memory
     index_t m_allocator_id;
+
+    // private class that holds the cached hash of this subtree
+    class HashCache;
+
+    // cached hash (NULL unless hash was called with the cache option)
+    HashCache *m_hash_cache;
+
+    // cached sizes of this subtree, see StatsCache above
+    // (NULL until freeze or info with the cache option is called)
+    StatsCache *m_stats_cache;
+
+    // true if this node is read-only (see freeze)
+    bool       m_frozen;
 };
 //-----------------------------------------------------------------------------
 // -- end conduit::Node --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// -- Node typed view template implementations --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+/// DataType of an array of c-native numeric type T
+//-----------------------------------------------------------------------------
+template <typename T> struct NativeDataType;
+
+template <> struct NativeDataType<char>
+{ static DataType dtype(index_t n) { return DataType::c_char(n); } };
+template <> struct NativeDataType<signed char>
+{ static DataType dtype(index_t n) { return DataType::c_signed_char(n); } };
+template <> struct NativeDataType<unsigned char>
+{ static DataType dtype(index_t n) { return DataType::c_unsigned_char(n); } };
+template <> struct NativeDataType<short>
+{ static DataType dtype(index_t n) { return DataType::c_short(n); } };
+template <> struct NativeDataType<unsigned short>
+{ static DataType dtype(index_t n) { return DataType::c_unsigned_short(n); } };
+template <> struct NativeDataType<int>
+{ static DataType dtype(index_t n) { return DataType::c_int(n); } };
+template <> struct NativeDataType<unsigned int>
+{ static DataType dtype(index_t n) { return DataType::c_unsigned_int(n); } };
+template <> struct NativeDataType<long>
+{ static DataType dtype(index_t n) { return DataType::c_long(n); } };
+template <> struct NativeDataType<unsigned long>
+{ static DataType dtype(index_t n) { return DataType::c_unsigned_long(n); } };
+#ifdef CONDUIT_HAS_LONG_LONG
+template <> struct NativeDataType<long long>
+{ static DataType dtype(index_t n) { return DataType::c_long_long(n); } };
+template <> struct NativeDataType<unsigned long long>
+{ static DataType dtype(index_t n) { return DataType::c_unsigned_long_long(n); } };
+#endif
+template <> struct NativeDataType<float>
+{ static DataType dtype(index_t n) { return DataType::c_float(n); } };
+template <> struct NativeDataType<double>
+{ static DataType dtype(index_t n) { return DataType::c_double(n); } };
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+Node::append_values(const T *values, index_t num_values)
+{
+    append_leaf_values(detail::NativeDataType<T>::dtype(num_values),
+                       values);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+void
+Node::set(std::vector<T> &&data)
+{
+    // the node owns a heap copy of the vector object, which
+    // holds the moved storage
+    std::vector<T> *owned = new std::vector<T>();
+    owned->swap(data);
+    set_owned(owned->empty() ? NULL : &(*owned)[0],
+              detail::NativeDataType<T>::dtype((index_t)owned->size()),
+              [owned](void *) { delete owned; });
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+Span<T>
+Node::as_span()
+{
+    check_data_view(detail::DataViewTypeId<T>::id,true,0,NULL,0,"as_span()");
+    return Span<T>((T*)element_ptr(0),
+                   dtype().number_of_elements());
+}
+
+//---------------------------------------------------------------------------//
+template <typename T>
+Span<const T>
+Node::as_span() const
+{
+    check_data_view(detail::DataViewTypeId<T>::id,true,0,NULL,0,
+                    "as_span() const");
+    return Span<const T>((const T*)element_ptr(0),
+                         dtype().number_of_elements());
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, index_t STRIDE>
+StridedView<T,STRIDE>
+Node::as_strided_view()
+{
+    check_data_view(detail::DataViewTypeId<T>::id,false,STRIDE,NULL,0,
+                    "as_strided_view()");
+    return StridedView<T,STRIDE>((T*)element_ptr(0),
+                                 dtype().number_of_elements(),
+                                 dtype().stride());
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, index_t STRIDE>
+StridedView<const T,STRIDE>
+Node::as_strided_view() const
+{
+    check_data_view(detail::DataViewTypeId<T>::id,false,STRIDE,NULL,0,
+                    "as_strided_view() const");
+    return StridedView<const T,STRIDE>((const T*)element_ptr(0),
+                                       dtype().number_of_elements(),
+                                       dtype().stride());
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, index_t RANK>
+MDView<T,RANK>
+Node::as_mdview(const index_t *extents)
+{
+    check_data_view(detail::DataViewTypeId<T>::id,false,0,extents,RANK,
+                    "as_mdview()");
+    return MDView<T,RANK>((T*)element_ptr(0),
+                          extents,
+                          dtype().stride());
+}
+
+//---------------------------------------------------------------------------//
+template <typename T, index_t RANK>
+MDView<const T,RANK>
+Node::as_mdview(const index_t *extents) const
+{
+    check_data_view(detail::DataViewTypeId<T>::id,false,0,extents,RANK,
+                    "as_mdview() const");
+    return MDView<const T,RANK>((const T*)element_ptr(0),
+                                extents,
+                                dtype().stride());
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
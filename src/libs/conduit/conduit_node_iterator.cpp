@@ -558,11 +558,232 @@ NodeConstChildIterator NodeConstIterator::cend() const {
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Begin NodeLeafSpanBase
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+const DataType &
+NodeLeafSpanBase<NodeType>::dtype() const
+{
+    return m_leaf->dtype();
+}
 
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+std::string
+NodeLeafSpanBase<NodeType>::path() const
+{
+    if(m_leaf == m_root)
+    {
+        return std::string();
+    }
+
+    std::string res = m_leaf->path();
+    std::string root_path = m_root->path();
+    // strip the iterated node's path (and the following "/")
+    if(!root_path.empty())
+    {
+        res = res.substr(root_path.size() + 1);
+    }
+    return res;
 }
+
+template class NodeLeafSpanBase<Node>;
+template class NodeLeafSpanBase<const Node>;
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// End NodeLeafSpanBase
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
-// -- end conduit:: --
 //-----------------------------------------------------------------------------
+// Begin NodeLeafIteratorBase
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
 
+//---------------------------------------------------------------------------//
+// sets nbytes to the compact size of a leaf, and returns true if the
+// leaf's data is already compact
+static bool
+leaf_compact_bytes(const Node &leaf, index_t &nbytes)
+{
+    const DataType &dt = leaf.dtype();
+    index_t num_ele   = dt.number_of_elements();
+    index_t ele_bytes = DataType::default_bytes(dt.id());
+    nbytes = num_ele * ele_bytes;
+    return dt.element_bytes() == ele_bytes &&
+           (dt.stride() == ele_bytes || num_ele <= 1);
+}
 
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+NodeLeafIteratorBase<NodeType>::NodeLeafIteratorBase()
+: m_root(NULL),
+  m_coalesce(false),
+  m_stack(),
+  m_pending(NULL),
+  m_leaf_index(0),
+  m_has_next(false),
+  m_next(),
+  m_curr()
+{}
+
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+NodeLeafIteratorBase<NodeType>::NodeLeafIteratorBase(NodeType &node,
+                                                     bool coalesce)
+: m_root(&node),
+  m_coalesce(coalesce),
+  m_stack(),
+  m_pending(NULL),
+  m_leaf_index(0),
+  m_has_next(false),
+  m_next(),
+  m_curr()
+{
+    to_front();
+}
+
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+const typename NodeLeafIteratorBase<NodeType>::span_type &
+NodeLeafIteratorBase<NodeType>::next()
+{
+    if(!m_has_next)
+    {
+        CONDUIT_ERROR("next() when has_next() == false");
+    }
+    m_curr = m_next;
+    advance();
+    return m_curr;
+}
+
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+void
+NodeLeafIteratorBase<NodeType>::to_front()
+{
+    m_stack.clear();
+    m_pending    = NULL;
+    m_leaf_index = 0;
+    m_has_next   = false;
+    if(m_root != NULL)
+    {
+        m_stack.push_back(m_root);
+        advance();
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+NodeType *
+NodeLeafIteratorBase<NodeType>::next_leaf()
+{
+    while(!m_stack.empty())
+    {
+        NodeType *curr = m_stack.back();
+        m_stack.pop_back();
+
+        const DataType &dt = curr->dtype();
+        if(dt.is_object() || dt.is_list())
+        {
+            // push in reverse, so children are visited in order
+            for(index_t i = curr->number_of_children(); i > 0; i--)
+            {
+                m_stack.push_back(curr->child_ptr(i-1));
+            }
+        }
+        else if(!dt.is_empty())
+        {
+            return curr;
+        }
+    }
+    return NULL;
+}
+
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+void
+NodeLeafIteratorBase<NodeType>::advance()
+{
+    NodeType *leaf = m_pending;
+    m_pending = NULL;
+    if(leaf == NULL)
+    {
+        leaf = next_leaf();
+    }
+
+    m_has_next = (leaf != NULL);
+    if(!m_has_next)
+    {
+        return;
+    }
+
+    span_type &span = m_next;
+    span.m_root       = m_root;
+    span.m_leaf       = leaf;
+    span.m_data       = leaf->element_ptr(0);
+    span.m_leaf_index = m_leaf_index++;
+    span.m_num_leaves = 1;
+    span.m_compact    = detail::leaf_compact_bytes(*leaf, span.m_num_bytes);
+
+    if(!m_coalesce || !span.m_compact || span.m_num_bytes == 0)
+    {
+        return;
+    }
+
+    // extend the span while the following leaves are compact and start
+    // where the span ends
+    const uint8 *span_end = (const uint8*)span.m_data + span.m_num_bytes;
+    NodeType *cand = next_leaf();
+    while(cand != NULL)
+    {
+        index_t nbytes = 0;
+        if(!detail::leaf_compact_bytes(*cand, nbytes) ||
+           nbytes == 0 ||
+           (const uint8*)cand->element_ptr(0) != span_end ||
+           cand->allocator() != leaf->allocator())
+        {
+            m_pending = cand;
+            break;
+        }
+        span.m_num_leaves++;
+        span.m_num_bytes += nbytes;
+        span_end += nbytes;
+        m_leaf_index++;
+        cand = next_leaf();
+    }
+}
+
+template class NodeLeafIteratorBase<Node>;
+template class NodeLeafIteratorBase<const Node>;
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// End NodeLeafIteratorBase
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
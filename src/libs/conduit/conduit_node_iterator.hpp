@@ -11,6 +11,13 @@
 #ifndef CONDUIT_NODE_ITERATOR_HPP
 #define CONDUIT_NODE_ITERATOR_HPP
 
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <string>
+#include <type_traits>
+#include <vector>
+
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
 //-----------------------------------------------------------------------------
@@ -23,6 +30,7 @@ namespace conduit
 {
 
 class Node;
+class DataType;
 
 /**
  * Class template for defining C++-style iterators for iterating over children
@@ -463,6 +471,157 @@ private:
 // -- end conduit::NodeIterator --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodeLeafSpanBase --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodeLeafSpanBase
+///
+/// description:
+///  A run of one or more leaves yielded by a leaf iterator.
+///
+///  Without coalescing each span holds a single leaf. With coalescing,
+///  compact leaves that directly follow each other in memory (and use the
+///  same allocator) are merged into one span, so data() and
+///  number_of_bytes() describe a single contiguous block that can be
+///  copied or written in one call.
+///
+///  leaf(), dtype() and path() describe the first leaf in the span.
+///
+///  NodeType is Node (NodeLeafSpan) or const Node (NodeConstLeafSpan).
+///
+//-----------------------------------------------------------------------------
+template <typename NodeType>
+class CONDUIT_API NodeLeafSpanBase
+{
+public:
+    typedef typename std::conditional<std::is_const<NodeType>::value,
+                                      const void *,
+                                      void *>::type data_pointer;
+
+    NodeLeafSpanBase()
+    : m_root(NULL),
+      m_leaf(NULL),
+      m_data(NULL),
+      m_leaf_index(0),
+      m_num_leaves(0),
+      m_num_bytes(0),
+      m_compact(false)
+    {}
+
+    /// first leaf in this span
+    NodeType       &leaf()             const { return *m_leaf; }
+    /// dtype of the first leaf in this span
+    const DataType &dtype()            const;
+    /// path of the first leaf, relative to the iterated node
+    std::string     path()             const;
+    /// pointer to the first element of the first leaf
+    data_pointer    data()             const { return m_data; }
+    /// depth-first index of the first leaf in this span
+    index_t         leaf_index()       const { return m_leaf_index; }
+    /// number of leaves in this span
+    index_t         number_of_leaves() const { return m_num_leaves; }
+    /// number of bytes covered by this span in compact form
+    index_t         number_of_bytes()  const { return m_num_bytes; }
+    /// true if the span's number_of_bytes() bytes are contiguous at data()
+    bool            is_compact()       const { return m_compact; }
+
+private:
+    template <typename> friend class NodeLeafIteratorBase;
+
+    NodeType      *m_root;
+    NodeType      *m_leaf;
+    data_pointer   m_data;
+    index_t        m_leaf_index;
+    index_t        m_num_leaves;
+    index_t        m_num_bytes;
+    bool           m_compact;
+};
+
+typedef NodeLeafSpanBase<Node>         NodeLeafSpan;
+typedef NodeLeafSpanBase<const Node>   NodeConstLeafSpan;
+
+//-----------------------------------------------------------------------------
+// -- end conduit::NodeLeafSpanBase --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodeLeafIteratorBase --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodeLeafIteratorBase
+///
+/// description:
+///  Depth-first iterator over the leaves of a Node tree (empty leaves are
+///  skipped), optionally coalescing physically contiguous neighboring
+///  leaves into a single span (see NodeLeafSpanBase).
+///
+///  Usage follows NodeIterator:
+///
+///     NodeConstLeafIterator itr = n.leaves(true);
+///     while(itr.has_next())
+///     {
+///         const NodeConstLeafSpan &span = itr.next();
+///         ...
+///     }
+///
+///  The tree must not change while it is iterated.
+///
+///  NodeType is Node (NodeLeafIterator) or const Node
+///  (NodeConstLeafIterator).
+///
+//-----------------------------------------------------------------------------
+template <typename NodeType>
+class CONDUIT_API NodeLeafIteratorBase
+{
+public:
+    typedef NodeLeafSpanBase<NodeType> span_type;
+
+//-----------------------------------------------------------------------------
+/// Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor, iterates nothing.
+    NodeLeafIteratorBase();
+    /// Primary iterator constructor.
+    explicit NodeLeafIteratorBase(NodeType &node, bool coalesce = false);
+
+//-----------------------------------------------------------------------------
+/// Iterator control.
+//-----------------------------------------------------------------------------
+    bool              has_next() const { return m_has_next; }
+    /// returns the next span, which stays valid until the following
+    /// call to next() or to_front()
+    const span_type  &next();
+    void              to_front();
+
+    /// true if contiguous leaves are coalesced
+    bool              coalesce() const { return m_coalesce; }
+
+private:
+    /// returns the next non-empty leaf of the walk, or NULL
+    NodeType         *next_leaf();
+    /// prepares m_next
+    void              advance();
+
+    NodeType                *m_root;
+    bool                     m_coalesce;
+    /// nodes still to visit, in reverse order
+    std::vector<NodeType*>   m_stack;
+    /// leaf found while looking for a span's end, starts the next span
+    NodeType                *m_pending;
+    index_t                  m_leaf_index;
+    bool                     m_has_next;
+    span_type                m_next;
+    span_type                m_curr;
+};
+
+typedef NodeLeafIteratorBase<Node>        NodeLeafIterator;
+typedef NodeLeafIteratorBase<const Node>  NodeConstLeafIterator;
+
+//-----------------------------------------------------------------------------
+// -- end conduit::NodeLeafIteratorBase --
+//-----------------------------------------------------------------------------
+
 template<typename Reference, typename Pointer, typename Iter>
 std::string NodeChildIteratorBase<Reference, Pointer, Iter>::name() const {
     return NodeConstIterator(m_parent, m_index + 1).name();
@@ -0,0 +1,756 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_pack.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_pack.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_endianness.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::pack --
+//-----------------------------------------------------------------------------
+namespace pack
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::pack::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// header layout (all values in the writer's endianness):
+//   [ 0, 8) magic string "CNDTPACK"
+//   [ 8,12) uint32 format version
+//   [12,16) uint32 endianness marker (0x01020304)
+//   [16,24) uint64 schema section offset
+//   [24,32) uint64 schema section bytes
+//   [32,40) uint64 data section offset
+//   [40,48) uint64 data section bytes
+//   [48,64) reserved (zeros)
+//-----------------------------------------------------------------------------
+static const char   PACK_MAGIC[8]     = {'C','N','D','T','P','A','C','K'};
+static const uint32 PACK_VERSION      = 1;
+static const uint32 PACK_ENDIAN_MARK  = 0x01020304;
+static const index_t PACK_HEADER_BYTES = 64;
+
+//-----------------------------------------------------------------------------
+struct Header
+{
+    uint32 version;
+    uint64 schema_offset;
+    uint64 schema_bytes;
+    uint64 data_offset;
+    uint64 data_bytes;
+};
+
+//---------------------------------------------------------------------------//
+index_t
+aligned(index_t offset)
+{
+    return ((offset + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT) * PACK_ALIGNMENT;
+}
+
+//-----------------------------------------------------------------------------
+/// helper used to walk the binary schema, with bounds checks
+//-----------------------------------------------------------------------------
+class Reader
+{
+public:
+    Reader(const uint8 *data, const uint8 *end)
+    : m_data(data),
+      m_end(end)
+    {}
+
+    template<typename T>
+    T read()
+    {
+        check(sizeof(T));
+        T res;
+        memcpy(&res, m_data, sizeof(T));
+        m_data += sizeof(T);
+        return res;
+    }
+
+    std::string read_string(size_t nbytes)
+    {
+        check(nbytes);
+        std::string res((const char*)m_data, nbytes);
+        m_data += nbytes;
+        return res;
+    }
+
+    void skip(uint64 nbytes)
+    {
+        check((size_t)nbytes);
+        m_data += nbytes;
+    }
+
+    const uint8 *ptr() const { return m_data; }
+
+private:
+    void check(size_t nbytes) const
+    {
+        if(m_data + nbytes > m_end)
+        {
+            CONDUIT_ERROR("<conduit::pack> corrupt schema section "
+                          "(unexpected end of schema data)");
+        }
+    }
+
+    const uint8 *m_data;
+    const uint8 *m_end;
+};
+
+//---------------------------------------------------------------------------//
+// builds the schema that describes the data section of a pack file.
+// each leaf is stored compactly at the next aligned offset.
+//---------------------------------------------------------------------------//
+void
+layout(const Node &node,
+       Schema &schema,
+       index_t &data_bytes,
+       std::vector<const Node*> &leaves)
+{
+    index_t dt_id = node.dtype().id();
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        schema.set(DataType::object());
+        const std::vector<std::string> &names = node.child_names();
+        for(size_t i=0; i < names.size(); i++)
+        {
+            layout(node.child((index_t)i),
+                   schema.add_child(names[i]),
+                   data_bytes,
+                   leaves);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        schema.set(DataType::list());
+        index_t nchildren = node.number_of_children();
+        for(index_t i=0; i < nchildren; i++)
+        {
+            layout(node.child(i), schema.append(), data_bytes, leaves);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        const DataType &dt = node.dtype();
+        index_t offset = aligned(data_bytes);
+        schema.set(DataType(dt_id,
+                            dt.number_of_elements(),
+                            offset,
+                            dt.element_bytes(),
+                            dt.element_bytes(),
+                            dt.endianness()));
+        data_bytes = offset + dt.bytes_compact();
+        leaves.push_back(&node);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+shift_offsets(Schema &schema,
+              index_t offset_bias)
+{
+    index_t dt_id = schema.dtype().id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        for(index_t i=0; i < nchildren; i++)
+        {
+            shift_offsets(schema.child(i), offset_bias);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        schema.dtype().set_offset(schema.dtype().offset() + offset_bias);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// moves the reader to the start of the encoded subtree at the given path
+// and sets nbytes to the size of the encoded subtree.
+// returns false if the path does not exist
+// (see Schema::serialize_binary for details of the encoding)
+//---------------------------------------------------------------------------//
+bool
+seek(Reader &reader,
+     const std::string &path,
+     uint64 &nbytes)
+{
+    std::string curr;
+    std::string next;
+    utils::split_path(path, curr, next);
+
+    if(curr.empty())
+    {
+        if(next.empty())
+        {
+            return true;
+        }
+        // skip any empty path segments
+        return seek(reader, next, nbytes);
+    }
+
+    index_t dt_id = (index_t) reader.read<uint8>();
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        uint64 nchildren = reader.read<uint64>();
+        for(uint64 i=0; i < nchildren; i++)
+        {
+            uint32 name_len = reader.read<uint32>();
+            std::string name = reader.read_string(name_len);
+            uint64 child_bytes = reader.read<uint64>();
+            if(name == curr)
+            {
+                nbytes = child_bytes;
+                return seek(reader, next, nbytes);
+            }
+            reader.skip(child_bytes);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        uint64 nchildren = reader.read<uint64>();
+        // list entries are selected by index
+        if(curr.find_first_not_of("0123456789") != std::string::npos)
+        {
+            return false;
+        }
+        uint64 idx = (uint64) utils::string_to_value<index_t>(curr);
+        for(uint64 i=0; i < nchildren; i++)
+        {
+            uint64 child_bytes = reader.read<uint64>();
+            if(i == idx)
+            {
+                nbytes = child_bytes;
+                return seek(reader, next, nbytes);
+            }
+            reader.skip(child_bytes);
+        }
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+// finds the range of data section bytes spanned by the leaves of a schema
+// returns false if the schema has no leaves
+//---------------------------------------------------------------------------//
+bool
+leaf_range(const Schema &schema,
+           index_t &start,
+           index_t &end)
+{
+    index_t dt_id = schema.dtype().id();
+    bool res = false;
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        for(index_t i=0; i < nchildren; i++)
+        {
+            res = leaf_range(schema.child(i), start, end) || res;
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        index_t leaf_start = schema.dtype().offset();
+        // note: spanned_bytes() includes the offset
+        index_t leaf_end   = schema.dtype().spanned_bytes();
+        if(leaf_start < start)
+        {
+            start = leaf_start;
+        }
+        if(leaf_end > end)
+        {
+            end = leaf_end;
+        }
+        res = true;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+write_header(index_t schema_offset,
+             index_t schema_bytes,
+             index_t data_offset,
+             index_t data_bytes,
+             uint8 *header)
+{
+    memset(header, 0, PACK_HEADER_BYTES);
+    uint64 vals[4] = { (uint64) schema_offset,
+                       (uint64) schema_bytes,
+                       (uint64) data_offset,
+                       (uint64) data_bytes };
+    memcpy(header, PACK_MAGIC, sizeof(PACK_MAGIC));
+    memcpy(header + 8, &PACK_VERSION, sizeof(uint32));
+    memcpy(header + 12, &PACK_ENDIAN_MARK, sizeof(uint32));
+    memcpy(header + 16, vals, sizeof(vals));
+}
+
+//---------------------------------------------------------------------------//
+bool
+parse_header(const uint8 *buff,
+             Header &header)
+{
+    if(memcmp(buff, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0)
+    {
+        return false;
+    }
+
+    uint32 endian_mark = 0;
+    memcpy(&header.version, buff + 8, sizeof(uint32));
+    memcpy(&endian_mark, buff + 12, sizeof(uint32));
+    memcpy(&header.schema_offset, buff + 16, sizeof(uint64));
+    memcpy(&header.schema_bytes, buff + 24, sizeof(uint64));
+    memcpy(&header.data_offset, buff + 32, sizeof(uint64));
+    memcpy(&header.data_bytes, buff + 40, sizeof(uint64));
+
+    if(endian_mark != PACK_ENDIAN_MARK)
+    {
+        CONDUIT_ERROR("<conduit::pack> reading pack files written with "
+                      "a different endianness is not supported");
+    }
+
+    if(header.version != PACK_VERSION)
+    {
+        CONDUIT_ERROR("<conduit::pack> unsupported pack file version: "
+                      << header.version
+                      << " (supported version: " << PACK_VERSION << ")");
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+bool
+read_header(std::ifstream &ifs,
+            Header &header)
+{
+    uint8 buff[PACK_HEADER_BYTES];
+    ifs.read((char*)buff, PACK_HEADER_BYTES);
+    if(ifs.gcount() != PACK_HEADER_BYTES)
+    {
+        return false;
+    }
+    return parse_header(buff, header);
+}
+
+//---------------------------------------------------------------------------//
+void
+open(const std::string &path,
+     std::ifstream &ifs,
+     Header &header,
+     std::vector<uint8> &schema_bytes)
+{
+    ifs.open(path.c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+    {
+        CONDUIT_ERROR("<conduit::pack> failed to open: " << path);
+    }
+
+    if(!read_header(ifs, header))
+    {
+        CONDUIT_ERROR("<conduit::pack> " << path << " is not a pack file");
+    }
+
+    schema_bytes.resize((size_t)header.schema_bytes);
+    ifs.seekg((std::streamoff)header.schema_offset);
+    if(header.schema_bytes > 0)
+    {
+        ifs.read((char*)&schema_bytes[0],
+                 (std::streamsize)header.schema_bytes);
+    }
+
+    if(!ifs.good())
+    {
+        CONDUIT_ERROR("<conduit::pack> failed to read schema section from: "
+                      << path);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+read_data(std::ifstream &ifs,
+          const std::string &path,
+          index_t offset,
+          index_t nbytes,
+          void *dest)
+{
+    if(nbytes == 0)
+    {
+        return;
+    }
+
+    ifs.seekg((std::streamoff)offset);
+    ifs.read((char*)dest, (std::streamsize)nbytes);
+
+    if(!ifs.good())
+    {
+        CONDUIT_ERROR("<conduit::pack> failed to read "
+                      << nbytes << " bytes at offset " << offset
+                      << " from: " << path);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+write_zeros(std::ofstream &ofs,
+            index_t nbytes)
+{
+    static const char zeros[PACK_ALIGNMENT] = {0};
+    while(nbytes > 0)
+    {
+        index_t n = nbytes < PACK_ALIGNMENT ? nbytes : PACK_ALIGNMENT;
+        ofs.write(zeros, (std::streamsize)n);
+        nbytes -= n;
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::pack::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+bool
+is_pack_file(const std::string &path)
+{
+    std::ifstream ifs;
+    ifs.open(path.c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+    {
+        return false;
+    }
+
+    char buff[sizeof(detail::PACK_MAGIC)];
+    ifs.read(buff, sizeof(buff));
+    return is_pack_data(buff, (index_t)ifs.gcount());
+}
+
+//---------------------------------------------------------------------------//
+bool
+is_pack_data(const void *data,
+             index_t data_size)
+{
+    return data != NULL &&
+           data_size >= (index_t)sizeof(detail::PACK_MAGIC) &&
+           memcmp(data, detail::PACK_MAGIC, sizeof(detail::PACK_MAGIC)) == 0;
+}
+
+//---------------------------------------------------------------------------//
+void
+save(const Node &node,
+     const std::string &path)
+{
+    Schema schema;
+    std::vector<const Node*> leaves;
+    index_t data_bytes = 0;
+    detail::layout(node, schema, data_bytes, leaves);
+
+    std::vector<uint8> schema_bytes;
+    schema.serialize_binary(schema_bytes);
+
+    index_t schema_offset = detail::PACK_HEADER_BYTES;
+    index_t data_offset   = detail::aligned(schema_offset +
+                                            (index_t)schema_bytes.size());
+
+    uint8 header[detail::PACK_HEADER_BYTES];
+    detail::write_header(schema_offset,
+                         (index_t)schema_bytes.size(),
+                         data_offset,
+                         data_bytes,
+                         header);
+
+    std::ofstream ofs;
+    ofs.open(path.c_str(), std::ios_base::binary);
+    if(!ofs.is_open())
+    {
+        CONDUIT_ERROR("<conduit::pack> failed to open: " << path);
+    }
+
+    ofs.write((const char*)header, sizeof(header));
+    if(!schema_bytes.empty())
+    {
+        ofs.write((const char*)&schema_bytes[0],
+                  (std::streamsize)schema_bytes.size());
+    }
+
+    index_t curr = schema_offset + (index_t)schema_bytes.size();
+    // leaf offsets follow the same rule used by layout()
+    index_t leaf_end = 0;
+    Node n_compact;
+    for(size_t i=0; i < leaves.size(); i++)
+    {
+        const Node &leaf = *leaves[i];
+        index_t leaf_offset = data_offset + detail::aligned(leaf_end);
+        detail::write_zeros(ofs, leaf_offset - curr);
+
+        index_t nbytes = leaf.dtype().bytes_compact();
+        const void *leaf_ptr = NULL;
+        if(leaf.dtype().is_compact())
+        {
+            leaf_ptr = leaf.element_ptr(0);
+        }
+        else
+        {
+            leaf.compact_to(n_compact);
+            leaf_ptr = n_compact.data_ptr();
+        }
+
+        ofs.write((const char*)leaf_ptr, (std::streamsize)nbytes);
+        curr = leaf_offset + nbytes;
+        leaf_end = curr - data_offset;
+    }
+
+    // pad out the schema section when there is no leaf data
+    if(curr < data_offset)
+    {
+        detail::write_zeros(ofs, data_offset - curr);
+    }
+
+    if(!ofs.good())
+    {
+        CONDUIT_ERROR("<conduit::pack> failed to write: " << path);
+    }
+}
+
+//---------------------------------------------------------------------------//
+index_t
+packed_bytes(const Node &node)
+{
+    Schema schema;
+    std::vector<const Node*> leaves;
+    index_t data_bytes = 0;
+    detail::layout(node, schema, data_bytes, leaves);
+
+    std::vector<uint8> schema_bytes;
+    schema.serialize_binary(schema_bytes);
+
+    return detail::aligned(detail::PACK_HEADER_BYTES +
+                           (index_t)schema_bytes.size()) + data_bytes;
+}
+
+//---------------------------------------------------------------------------//
+void
+save(const Node &node,
+     void *data,
+     index_t data_size)
+{
+    Schema schema;
+    std::vector<const Node*> leaves;
+    index_t data_bytes = 0;
+    detail::layout(node, schema, data_bytes, leaves);
+
+    std::vector<uint8> schema_bytes;
+    schema.serialize_binary(schema_bytes);
+
+    index_t schema_offset = detail::PACK_HEADER_BYTES;
+    index_t data_offset   = detail::aligned(schema_offset +
+                                            (index_t)schema_bytes.size());
+    if(data_size < data_offset + data_bytes)
+    {
+        CONDUIT_ERROR("<conduit::pack> buffer of " << data_size
+                      << " bytes is too small for pack data of "
+                      << (data_offset + data_bytes) << " bytes");
+    }
+
+    uint8 *dest = (uint8*)data;
+    // zero the padding between leaves
+    memset(dest, 0, (size_t)(data_offset + data_bytes));
+    detail::write_header(schema_offset,
+                         (index_t)schema_bytes.size(),
+                         data_offset,
+                         data_bytes,
+                         dest);
+    if(!schema_bytes.empty())
+    {
+        memcpy(dest + schema_offset, &schema_bytes[0], schema_bytes.size());
+    }
+
+    // leaf offsets follow the same rule used by layout()
+    index_t leaf_end = 0;
+    Node n_compact;
+    for(size_t i=0; i < leaves.size(); i++)
+    {
+        const Node &leaf = *leaves[i];
+        index_t leaf_offset = detail::aligned(leaf_end);
+        index_t nbytes = leaf.dtype().bytes_compact();
+        const void *leaf_ptr = NULL;
+        if(leaf.dtype().is_compact())
+        {
+            leaf_ptr = leaf.element_ptr(0);
+        }
+        else
+        {
+            leaf.compact_to(n_compact);
+            leaf_ptr = n_compact.data_ptr();
+        }
+
+        memcpy(dest + data_offset + leaf_offset, leaf_ptr, (size_t)nbytes);
+        leaf_end = leaf_offset + nbytes;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+load_schema(const void *data,
+            index_t data_size,
+            Schema &schema)
+{
+    const uint8 *src = (const uint8*)data;
+    detail::Header header;
+    if(data_size < detail::PACK_HEADER_BYTES ||
+       !detail::parse_header(src, header))
+    {
+        CONDUIT_ERROR("<conduit::pack> buffer does not hold pack data");
+    }
+
+    if((index_t)(header.schema_offset + header.schema_bytes) > data_size ||
+       (index_t)(header.data_offset + header.data_bytes) > data_size)
+    {
+        CONDUIT_ERROR("<conduit::pack> buffer of " << data_size
+                      << " bytes is smaller than its pack data");
+    }
+
+    schema.deserialize_binary(src + header.schema_offset,
+                              (index_t)header.schema_bytes);
+    detail::shift_offsets(schema, (index_t)header.data_offset);
+}
+
+//---------------------------------------------------------------------------//
+void
+load(const std::string &path,
+     Node &node)
+{
+    load(path, std::string(), node);
+}
+
+//---------------------------------------------------------------------------//
+void
+load(const std::string &path,
+     const std::string &sub_path,
+     Node &node)
+{
+    std::ifstream ifs;
+    detail::Header header;
+    std::vector<uint8> schema_bytes;
+    detail::open(path, ifs, header, schema_bytes);
+
+    const uint8 *sbegin = schema_bytes.empty() ? NULL : &schema_bytes[0];
+    detail::Reader reader(sbegin, sbegin + schema_bytes.size());
+
+    uint64 sub_bytes = (uint64)schema_bytes.size();
+    if(!detail::seek(reader, sub_path, sub_bytes))
+    {
+        CONDUIT_ERROR("<conduit::pack> " << path
+                      << " does not contain path: " << sub_path);
+    }
+
+    if(reader.ptr() + sub_bytes > sbegin + schema_bytes.size())
+    {
+        CONDUIT_ERROR("<conduit::pack> corrupt schema section in: " << path);
+    }
+
+    Schema schema;
+    schema.deserialize_binary(reader.ptr(), (index_t)sub_bytes);
+
+    // find which bytes of the data section we need
+    index_t start = (index_t)header.data_bytes;
+    index_t end   = 0;
+    if(!detail::leaf_range(schema, start, end))
+    {
+        node.set(schema);
+        return;
+    }
+
+    // shift offsets so the subtree data starts at zero
+    detail::shift_offsets(schema, -start);
+
+    node.set(schema);
+    detail::read_data(ifs,
+                      path,
+                      (index_t)header.data_offset + start,
+                      end - start,
+                      node.data_ptr());
+}
+
+//---------------------------------------------------------------------------//
+void
+load_schema(const std::string &path,
+            Schema &schema)
+{
+    std::ifstream ifs;
+    detail::Header header;
+    std::vector<uint8> schema_bytes;
+    detail::open(path, ifs, header, schema_bytes);
+
+    schema.deserialize_binary(schema_bytes);
+    detail::shift_offsets(schema, (index_t)header.data_offset);
+}
+
+//---------------------------------------------------------------------------//
+void
+about(const std::string &path,
+      Node &info)
+{
+    std::ifstream ifs;
+    ifs.open(path.c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+    {
+        CONDUIT_ERROR("<conduit::pack> failed to open: " << path);
+    }
+
+    detail::Header header;
+    if(!detail::read_header(ifs, header))
+    {
+        CONDUIT_ERROR("<conduit::pack> " << path << " is not a pack file");
+    }
+
+    info.reset();
+    info["version"] = (int64) header.version;
+    info["alignment"] = (int64) PACK_ALIGNMENT;
+    info["schema/offset"] = (int64) header.schema_offset;
+    info["schema/bytes"]  = (int64) header.schema_bytes;
+    info["data/offset"]   = (int64) header.data_offset;
+    info["data/bytes"]    = (int64) header.data_bytes;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::pack --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
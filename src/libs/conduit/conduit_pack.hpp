@@ -0,0 +1,144 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_pack.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_PACK_HPP
+#define CONDUIT_PACK_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::pack --
+//-----------------------------------------------------------------------------
+///
+/// The "conduit_pack" protocol is a single file, self-describing binary
+/// container:
+///
+///   [header (64 bytes)][binary schema][leaf data]
+///
+///  - The header holds a magic string, format version, an endianness
+///    marker and the offsets and sizes of the schema and data sections.
+///  - The binary schema records, for every object or list entry, the size
+///    of its encoded subtree, so a reader can skip to a sub path without
+///    decoding the rest of the schema (see Schema::serialize_binary).
+///  - Each leaf is stored compactly, starting at an offset that is a
+///    multiple of 64 bytes (PACK_ALIGNMENT).
+///
+/// Since leaf offsets are stored in the schema, Node::mmap() can map a
+/// pack file directly and only the pages of the leaves that are accessed
+/// are read.
+///
+/// Pack files are written in the machine's endianness, reading a file
+/// with a different endianness is an error.
+///
+//-----------------------------------------------------------------------------
+namespace pack
+{
+
+/// byte alignment of the data section and of each leaf in the data section
+static const index_t PACK_ALIGNMENT = 64;
+
+//-----------------------------------------------------------------------------
+/// returns true if the file at given path starts with a pack header
+//-----------------------------------------------------------------------------
+bool CONDUIT_API is_pack_file(const std::string &path);
+
+//-----------------------------------------------------------------------------
+/// returns true if the data_size bytes at data start with a pack header
+/// magic string (only the first 8 bytes are checked)
+//-----------------------------------------------------------------------------
+bool CONDUIT_API is_pack_data(const void *data,
+                              index_t data_size);
+
+//-----------------------------------------------------------------------------
+/// writes the passed node to a pack file.
+//-----------------------------------------------------------------------------
+void CONDUIT_API save(const Node &node,
+                      const std::string &path);
+
+//-----------------------------------------------------------------------------
+/// reads an entire pack file into the passed node.
+//-----------------------------------------------------------------------------
+void CONDUIT_API load(const std::string &path,
+                      Node &node);
+
+//-----------------------------------------------------------------------------
+/// reads the subtree at sub_path from a pack file into the passed node.
+/// only the schema entries along sub_path and the bytes spanned by the
+/// subtree are read.
+//-----------------------------------------------------------------------------
+void CONDUIT_API load(const std::string &path,
+                      const std::string &sub_path,
+                      Node &node);
+
+//-----------------------------------------------------------------------------
+/// reads the schema of a pack file. leaf offsets are relative to the start
+/// of the file, so the schema can be used to describe a memory map of the
+/// entire file (see Node::mmap)
+//-----------------------------------------------------------------------------
+void CONDUIT_API load_schema(const std::string &path,
+                             Schema &schema);
+
+//-----------------------------------------------------------------------------
+/// returns the number of bytes needed to hold the pack data of the passed
+/// node in memory (the size of the pack file save() would write)
+//-----------------------------------------------------------------------------
+index_t CONDUIT_API packed_bytes(const Node &node);
+
+//-----------------------------------------------------------------------------
+/// writes the pack data of the passed node to a buffer of data_size bytes,
+/// which must hold at least packed_bytes(node) bytes. The buffer holds the
+/// same bytes as a pack file, so it can be placed in a memory map or shared
+/// memory segment.
+//-----------------------------------------------------------------------------
+void CONDUIT_API save(const Node &node,
+                      void *data,
+                      index_t data_size);
+
+//-----------------------------------------------------------------------------
+/// reads the schema of pack data held in memory. leaf offsets are relative
+/// to the start of the buffer, so node.set_external(schema, data) describes
+/// the data without a copy.
+//-----------------------------------------------------------------------------
+void CONDUIT_API load_schema(const void *data,
+                             index_t data_size,
+                             Schema &schema);
+
+//-----------------------------------------------------------------------------
+/// provides header details of a pack file
+/// (version, schema and data offset and sizes)
+//-----------------------------------------------------------------------------
+void CONDUIT_API about(const std::string &path,
+                       Node &info);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::pack --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,122 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_parallel.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_PARALLEL_HPP
+#define CONDUIT_PARALLEL_HPP
+
+// Internal utility header
+
+//-----------------------------------------------------------------------------
+// std includes
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// conduit lib includes
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// Runs func(i) for i in [0, num_tasks) on up to num_threads threads (the
+// calling thread included), handing out tasks in order. The first error
+// raised by func stops the remaining tasks and is rethrown on the calling
+// thread.
+//---------------------------------------------------------------------------//
+template <typename Func>
+void
+parallel_for(index_t num_tasks,
+             index_t num_threads,
+             const Func &func)
+{
+    if(num_threads <= 1 || num_tasks <= 1)
+    {
+        for(index_t i = 0; i < num_tasks; i++)
+        {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<index_t> next_task(0);
+    std::atomic<bool>    failed(false);
+    std::exception_ptr   error;
+    std::mutex           error_mutex;
+
+    auto worker = [&]()
+    {
+        index_t i = next_task++;
+        while(i < num_tasks && !failed)
+        {
+            try
+            {
+                func(i);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!failed)
+                {
+                    error  = std::current_exception();
+                    failed = true;
+                }
+                return;
+            }
+            i = next_task++;
+        }
+    };
+
+    index_t num_workers = std::min(num_threads, num_tasks);
+    std::vector<std::thread> threads;
+    threads.reserve((size_t)(num_workers - 1));
+    for(index_t i = 1; i < num_workers; i++)
+    {
+        threads.push_back(std::thread(worker));
+    }
+    // the calling thread participates as well
+    worker();
+    for(size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    if(failed)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,163 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_path.hpp"
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_schema.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path public methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Path::Path()
+: m_segments(),
+  m_hints()
+{}
+
+//---------------------------------------------------------------------------//
+Path::Path(const std::string &path)
+: m_segments(),
+  m_hints()
+{
+    set(path);
+}
+
+//---------------------------------------------------------------------------//
+Path::Path(const char *path)
+: m_segments(),
+  m_hints()
+{
+    set(std::string(path));
+}
+
+//---------------------------------------------------------------------------//
+Path::Path(const Path &path)
+: m_segments(path.m_segments),
+  m_hints(path.m_hints)
+{}
+
+//---------------------------------------------------------------------------//
+Path::~Path()
+{}
+
+//---------------------------------------------------------------------------//
+Path &
+Path::operator=(const Path &path)
+{
+    if(this != &path)
+    {
+        m_segments = path.m_segments;
+        m_hints    = path.m_hints;
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+void
+Path::set(const std::string &path)
+{
+    m_segments.clear();
+
+    // same rules as string path fetch: split on "/" and cull empty segments
+    std::string::size_type start = 0;
+    std::string::size_type len   = path.size();
+    while(start <= len)
+    {
+        std::string::size_type end = path.find('/',start);
+        if(end == std::string::npos)
+        {
+            end = len;
+        }
+
+        if(end > start)
+        {
+            m_segments.push_back(path.substr(start, end - start));
+        }
+
+        start = end + 1;
+    }
+
+    m_hints.assign(m_segments.size(),-1);
+}
+
+//---------------------------------------------------------------------------//
+const std::string &
+Path::segment(index_t idx) const
+{
+    if(idx < 0 || (size_t)idx >= m_segments.size())
+    {
+        CONDUIT_ERROR("<Path::segment> Invalid segment index: " << idx
+                      << " (number of segments: " << m_segments.size()
+                      << ")");
+    }
+    return m_segments[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+std::string
+Path::to_string() const
+{
+    std::string res;
+    for(size_t i=0; i < m_segments.size(); i++)
+    {
+        if(i > 0)
+        {
+            res += "/";
+        }
+        res += m_segments[i];
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path private methods --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+index_t
+Path::child_index(const Schema &schema,
+                  index_t seg_idx) const
+{
+    const std::string &name = m_segments[(size_t)seg_idx];
+    const std::vector<std::string> &names = schema.object_order();
+
+    // check the cached index first
+    index_t hint = m_hints[(size_t)seg_idx];
+    if(hint >= 0 &&
+       (size_t)hint < names.size() &&
+       names[(size_t)hint] == name)
+    {
+        return hint;
+    }
+
+    index_t res = schema.find_child_index(name);
+    m_hints[(size_t)seg_idx] = res;
+    return res;
+}
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
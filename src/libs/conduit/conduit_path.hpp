@@ -0,0 +1,136 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_path.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_PATH_HPP
+#define CONDUIT_PATH_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+class Schema;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Path --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::Path
+///
+/// description:
+///  A pre-parsed path that can be used with Node::fetch,
+///  Node::fetch_existing, and Node::has_path.
+///
+///  The path string is tokenized once at construction, using the same rules
+///  as string path fetches (a leading "/" and empty path segments are
+///  ignored, ".." refers to the parent). Fetching with a Path does not
+///  allocate when the path already exists.
+///
+///  A Path also caches the child index found for each segment. When the
+///  same Path is used again on an unchanged tree, each segment is resolved
+///  by checking the cached index instead of a name lookup, making repeated
+///  fetches O(depth).
+///
+///  Note: Since lookups update the cached indices, a single Path instance
+///  should not be used concurrently from multiple threads.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API Path
+{
+public:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path public methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// create an empty path
+    Path();
+    /// create a path by parsing the given path string
+    explicit Path(const std::string &path);
+    /// create a path by parsing the given path c string
+    explicit Path(const char *path);
+    /// copy constructor
+    Path(const Path &path);
+    ~Path();
+
+    Path           &operator=(const Path &path);
+
+    /// parse the given path string, replacing any current segments
+    void            set(const std::string &path);
+
+//-----------------------------------------------------------------------------
+// Info and Access
+//-----------------------------------------------------------------------------
+    /// number of segments in this path
+    index_t             number_of_segments() const
+                            { return (index_t)m_segments.size(); }
+    /// true if this path has no segments
+    bool                is_empty() const
+                            { return m_segments.empty(); }
+    /// access the path segment at given index
+    const std::string  &segment(index_t idx) const;
+    /// access all path segments
+    const std::vector<std::string> &segments() const
+                            { return m_segments; }
+
+    /// returns the path joined with "/"
+    std::string         to_string() const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path private methods --
+//
+//-----------------------------------------------------------------------------
+    friend class Node;
+
+    /// finds the index of child named by the segment at seg_idx in the
+    /// given object schema, using (and updating) the cached index hint.
+    /// returns -1 if the child does not exist.
+    index_t             child_index(const Schema &schema,
+                                    index_t seg_idx) const;
+
+//-----------------------------------------------------------------------------
+//
+// -- conduit::Path private data members --
+//
+//-----------------------------------------------------------------------------
+    /// parsed path segments
+    std::vector<std::string>  m_segments;
+    /// last found child index for each segment (-1 when unknown)
+    mutable std::vector<index_t>  m_hints;
+
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::Path --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
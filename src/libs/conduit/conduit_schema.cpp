@@ -13,6 +13,13 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
@@ -30,6 +37,14 @@ namespace conduit
 
 std::vector<std::string> Schema::m_empty_child_names;
 
+// objects with more children than this keep a hashed name to index map,
+// below it a linear scan over the (contiguous) names is faster
+const index_t Schema::OBJECT_MAP_HASH_THRESHOLD = 32;
+
+// entry id used for references in the binary encoding, this is
+// larger than any DataType id
+const uint8 Schema::BINARY_REF_ID = 255;
+
 //=============================================================================
 //-----------------------------------------------------------------------------
 //
@@ -59,6 +74,13 @@ Schema::Schema(const Schema &schema)
     set(schema);
 }
 
+//---------------------------------------------------------------------------//
+Schema::Schema(Schema &&schema) noexcept
+{
+    init_defaults();
+    steal(schema);
+}
+
 //---------------------------------------------------------------------------//
 Schema::Schema(index_t dtype_id)
 {
@@ -100,6 +122,20 @@ Schema::reset()
     release();
 }
 
+//---------------------------------------------------------------------------//
+void *
+Schema::operator new(size_t num_bytes)
+{
+    return utils::metadata_allocate(num_bytes);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::operator delete(void *ptr, size_t num_bytes)
+{
+    utils::metadata_free(ptr, num_bytes);
+}
+
 //-----------------------------------------------------------------------------
 //
 // Schema set methods
@@ -195,6 +231,18 @@ Schema::operator=(const Schema &schema)
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+Schema &
+Schema::operator=(Schema &&schema) noexcept
+{
+    if(this != &schema)
+    {
+        release();
+        steal(schema);
+    }
+    return *this;
+}
+
 //---------------------------------------------------------------------------//
 Schema &
 Schema::operator=(const DataType &dtype)
@@ -314,20 +362,17 @@ Schema::compatible(const Schema &s) const
     if(dt_id == DataType::OBJECT_ID)
     {
         // each of s's entries that match paths must have dtypes that match
-        
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
+        const std::vector<std::string> &s_names = s.object_order();
+        for(size_t s_idx = 0; s_idx < s_names.size() && res; s_idx++)
         {
-            // make sure we actually have the path
-            if(has_path(itr->first))
+            // make sure we actually have the child
+            index_t idx = find_child_index(s_names[s_idx]);
+            if(idx >= 0)
             {
                 // use index to fetch the child from the other schema
-                const Schema &s_chld = s.child(itr->second);
-                // fetch our child by name
-                const Schema &chld = child(itr->first);
+                const Schema &s_chld = *s.children()[s_idx];
+                // use index to fetch our child
+                const Schema &chld = *children()[(size_t)idx];
                 // do compat check
                 res = chld.compatible(s_chld);
             }
@@ -372,39 +417,30 @@ Schema::equals(const Schema &s) const
     if(dt_id == DataType::OBJECT_ID)
     {
         // all entries must be equal
-        
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
+
+        // if the number of children differ, one side has an entry
+        // the other does not
+        if(s.object_order().size() != object_order().size())
         {
-            if(has_path(itr->first))
-            {
-                size_t s_idx = (size_t) itr->second;
-                res = s.children()[s_idx]->equals(child(itr->first));
-            }
-            else
-            {
-                res = false;
-            }
+            return false;
         }
-        
-        for(itr  = object_map().begin(); 
-            itr != object_map().end() && res;
-            itr++)
+
+        // with the same number of children, matching each of s's entries
+        // also covers all of our entries (names are unique)
+        const std::vector<std::string> &s_names = s.object_order();
+        for(size_t s_idx = 0; s_idx < s_names.size() && res; s_idx++)
         {
-            if(s.has_path(itr->first))
+            index_t idx = find_child_index(s_names[s_idx]);
+            if(idx >= 0)
             {
-                size_t idx = (size_t) itr->second;
-                res = children()[idx]->equals(s.child(itr->first));
+                res = s.children()[s_idx]->equals(*children()[(size_t)idx]);
             }
             else
             {
                 res = false;
             }
         }
-        
+
     }
     else if(dt_id == DataType::LIST_ID) 
     {
@@ -443,7 +479,8 @@ void
 Schema::compact_to(Schema &s_dest) const
 {
     s_dest.reset();
-    compact_to(s_dest,0);
+    index_t curr_offset = 0;
+    compact_to(s_dest,curr_offset);
 }
 
 
@@ -742,6 +779,623 @@ Schema::load(const std::string &ifname)
     set(res);
 }
 
+//-----------------------------------------------------------------------------
+//
+/// Structural comparison methods
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+static inline uint64
+schema_hash_mix(uint64 hash, uint64 value)
+{
+    // boost style hash combine, with a 64-bit constant
+    hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+//---------------------------------------------------------------------------//
+// computes the structural hash and base (smallest leaf offset, or -1
+// if there are no leaves) of a schema. if structure is not NULL, the
+// results for every object and list entry are recorded
+//---------------------------------------------------------------------------//
+static void
+schema_structure(const Schema &schema,
+                 uint64 &hash,
+                 index_t &base,
+                 std::unordered_map<const Schema*,
+                                    std::pair<uint64,index_t> > *structure)
+{
+    const DataType &dt = schema.dtype();
+    index_t dt_id = dt.id();
+    hash = schema_hash_mix(0, (uint64) dt_id);
+    base = -1;
+
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        hash = schema_hash_mix(hash, (uint64) nchildren);
+
+        std::vector<index_t> chld_bases((size_t)nchildren);
+        std::hash<std::string> str_hash;
+        for(index_t i=0; i < nchildren; i++)
+        {
+            if(dt_id == DataType::OBJECT_ID)
+            {
+                hash = schema_hash_mix(hash,
+                                       (uint64) str_hash(schema.child_names()[(size_t)i]));
+            }
+            uint64  chld_hash = 0;
+            index_t chld_base = -1;
+            schema_structure(schema.child(i), chld_hash, chld_base, structure);
+            hash = schema_hash_mix(hash, chld_hash);
+            chld_bases[(size_t)i] = chld_base;
+            if(chld_base >= 0 && (base < 0 || chld_base < base))
+            {
+                base = chld_base;
+            }
+        }
+
+        // the placement of each child relative to our base
+        for(index_t i=0; i < nchildren; i++)
+        {
+            index_t chld_base = chld_bases[(size_t)i];
+            hash = schema_hash_mix(hash,
+                                   chld_base < 0 ? (uint64) -1 :
+                                   (uint64)(chld_base - base));
+        }
+
+        if(structure != NULL)
+        {
+            (*structure)[&schema] = std::make_pair(hash, base);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        hash = schema_hash_mix(hash, (uint64) dt.number_of_elements());
+        hash = schema_hash_mix(hash, (uint64) dt.stride());
+        hash = schema_hash_mix(hash, (uint64) dt.element_bytes());
+        hash = schema_hash_mix(hash, (uint64) dt.endianness());
+        base = dt.offset();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// returns the smallest leaf offset of a schema, or -1 if it has no leaves
+//---------------------------------------------------------------------------//
+static index_t
+schema_base_offset(const Schema &schema)
+{
+    index_t dt_id = schema.dtype().id();
+    index_t res = -1;
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        for(index_t i=0; i < nchildren; i++)
+        {
+            index_t chld_base = schema_base_offset(schema.child(i));
+            if(chld_base >= 0 && (res < 0 || chld_base < res))
+            {
+                res = chld_base;
+            }
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        res = schema.dtype().offset();
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+static bool
+schema_equals_structure(const Schema &a,
+                        index_t a_base,
+                        const Schema &b,
+                        index_t b_base)
+{
+    const DataType &a_dt = a.dtype();
+    const DataType &b_dt = b.dtype();
+    index_t dt_id = a_dt.id();
+    if(dt_id != b_dt.id())
+    {
+        return false;
+    }
+
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = a.number_of_children();
+        if(nchildren != b.number_of_children())
+        {
+            return false;
+        }
+        if(dt_id == DataType::OBJECT_ID &&
+           a.child_names() != b.child_names())
+        {
+            return false;
+        }
+        for(index_t i=0; i < nchildren; i++)
+        {
+            if(!schema_equals_structure(a.child(i), a_base,
+                                        b.child(i), b_base))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    else if(dt_id == DataType::EMPTY_ID)
+    {
+        return true;
+    }
+
+    return a_dt.number_of_elements() == b_dt.number_of_elements() &&
+           a_dt.stride()             == b_dt.stride() &&
+           a_dt.element_bytes()      == b_dt.element_bytes() &&
+           a_dt.endianness()         == b_dt.endianness() &&
+           (a_dt.offset() - a_base)  == (b_dt.offset() - b_base);
+}
+
+//---------------------------------------------------------------------------//
+uint64
+Schema::structural_hash() const
+{
+    uint64  hash = 0;
+    index_t base = -1;
+    schema_structure(*this, hash, base, NULL);
+    return hash;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Schema::equals_structure(const Schema &s) const
+{
+    if(this == &s)
+    {
+        return true;
+    }
+    return schema_equals_structure(*this, schema_base_offset(*this),
+                                   s, schema_base_offset(s));
+}
+
+//---------------------------------------------------------------------------//
+// adds offset_bias to the offset of all leaves of a schema
+//---------------------------------------------------------------------------//
+static void
+schema_shift_offsets(Schema &schema,
+                     index_t offset_bias)
+{
+    index_t dt_id = schema.dtype().id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        for(index_t i=0; i < nchildren; i++)
+        {
+            schema_shift_offsets(schema.child(i), offset_bias);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        schema.dtype().set_offset(schema.dtype().offset() + offset_bias);
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+/// Binary serialization methods
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+template<typename T>
+static void
+schema_binary_append(std::vector<uint8> &data, T value)
+{
+    size_t pos = data.size();
+    data.resize(pos + sizeof(T));
+    memcpy(&data[pos], &value, sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+template<typename T>
+static T
+schema_binary_read(const uint8 *&data, const uint8 *data_end)
+{
+    if(data + sizeof(T) > data_end)
+    {
+        CONDUIT_ERROR("<Schema::deserialize_binary> unexpected end "
+                      "of binary schema data");
+    }
+    T res;
+    memcpy(&res, data, sizeof(T));
+    data += sizeof(T);
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// bookkeeping used to find repeated entries when encoding with dedup
+//---------------------------------------------------------------------------//
+struct SchemaBinaryDedup
+{
+    // the structural hash and base offset of each object and list entry
+    std::unordered_map<const Schema*,
+                       std::pair<uint64,index_t> > structure;
+    // encoded entries, in encoding order
+    std::vector<const Schema*>                     entries;
+    // encoded size of each entry, zero until the entry is complete
+    std::vector<uint64>                            entry_bytes;
+    // hash to entry index
+    std::unordered_multimap<uint64,size_t>         hashes;
+};
+
+// size of an encoded reference
+static const uint64 SCHEMA_BINARY_REF_BYTES = 1 + 2 * sizeof(uint64);
+
+//---------------------------------------------------------------------------//
+static void
+schema_binary_encode(const Schema &schema,
+                     std::vector<uint8> &data,
+                     SchemaBinaryDedup *dedup)
+{
+    index_t dt_id = schema.dtype().id();
+
+    size_t entry_idx  = 0;
+    size_t entry_pos  = data.size();
+
+    if(dedup != NULL &&
+       (dt_id == DataType::OBJECT_ID ||
+        dt_id == DataType::LIST_ID))
+    {
+        const std::pair<uint64,index_t> &info = dedup->structure[&schema];
+        typedef std::unordered_multimap<uint64,size_t>::const_iterator itr_t;
+        std::pair<itr_t,itr_t> cands = dedup->hashes.equal_range(info.first);
+        for(itr_t itr = cands.first; itr != cands.second; ++itr)
+        {
+            size_t cand_idx = itr->second;
+            const Schema *cand = dedup->entries[cand_idx];
+            if(dedup->entry_bytes[cand_idx] > SCHEMA_BINARY_REF_BYTES &&
+               cand->equals_structure(schema))
+            {
+                index_t cand_base = dedup->structure[cand].second;
+                int64 delta = (info.second < 0 || cand_base < 0) ?
+                              0 : (int64)(info.second - cand_base);
+                schema_binary_append<uint8>(data, Schema::BINARY_REF_ID);
+                schema_binary_append<uint64>(data, (uint64) cand_idx);
+                schema_binary_append<int64>(data, delta);
+                return;
+            }
+        }
+
+        entry_idx = dedup->entries.size();
+        dedup->entries.push_back(&schema);
+        dedup->entry_bytes.push_back(0);
+        dedup->hashes.insert(std::make_pair(info.first, entry_idx));
+    }
+
+    schema_binary_append<uint8>(data, (uint8) dt_id);
+
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = schema.number_of_children();
+        schema_binary_append<uint64>(data, (uint64) nchildren);
+        for(index_t i=0; i < nchildren; i++)
+        {
+            if(dt_id == DataType::OBJECT_ID)
+            {
+                const std::string &name = schema.child_names()[(size_t)i];
+                schema_binary_append<uint32>(data, (uint32) name.size());
+                data.insert(data.end(), name.begin(), name.end());
+            }
+            // reserve space for the encoded child size, fill in after
+            size_t size_pos = data.size();
+            schema_binary_append<uint64>(data, 0);
+            schema_binary_encode(schema.child(i), data, dedup);
+            uint64 chld_bytes = (uint64)(data.size() - size_pos - sizeof(uint64));
+            memcpy(&data[size_pos], &chld_bytes, sizeof(uint64));
+        }
+
+        if(dedup != NULL)
+        {
+            dedup->entry_bytes[entry_idx] = (uint64)(data.size() - entry_pos);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        const DataType &dt = schema.dtype();
+        schema_binary_append<int64>(data, (int64) dt.number_of_elements());
+        schema_binary_append<int64>(data, (int64) dt.offset());
+        schema_binary_append<int64>(data, (int64) dt.stride());
+        schema_binary_append<int64>(data, (int64) dt.element_bytes());
+        schema_binary_append<uint8>(data, (uint8) dt.endianness());
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::serialize_binary(std::vector<uint8> &data,
+                         bool dedup) const
+{
+    if(!dedup)
+    {
+        schema_binary_encode(*this, data, NULL);
+        return;
+    }
+
+    SchemaBinaryDedup dd;
+    uint64  hash = 0;
+    index_t base = -1;
+    schema_structure(*this, hash, base, &dd.structure);
+    schema_binary_encode(*this, data, &dd);
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// kinds of schema encodings held in the parse cache
+static const uint8 SCHEMA_CACHE_JSON   = 0;
+static const uint8 SCHEMA_CACHE_BINARY = 1;
+
+//---------------------------------------------------------------------------//
+// process wide LRU cache of parsed schemas, most recently used first
+class SchemaParseCache
+{
+public:
+    SchemaParseCache()
+    : m_max_entries(0), m_hits(0), m_misses(0)
+    {}
+
+    // lock free check for the parse paths, m_max_entries is only
+    // changed while holding the lock
+    bool enabled() const
+    {
+        return m_max_entries.load() > 0;
+    }
+
+    // copies the cached schema for the passed encoding into dest,
+    // returns false if it is not cached
+    bool lookup(uint8 kind, const char *text, index_t len, Schema &dest)
+    {
+        uint64 key = make_key(kind, text, len);
+        std::shared_ptr<const Schema> schema;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::pair<Index::iterator,Index::iterator> rng =
+                m_index.equal_range(key);
+            for(Index::iterator itr = rng.first; itr != rng.second; itr++)
+            {
+                Entries::iterator e = itr->second;
+                if(e->kind == kind && e->text.size() == (size_t)len &&
+                   memcmp(e->text.data(), text, (size_t)len) == 0)
+                {
+                    // move to the front of the lru order
+                    m_entries.splice(m_entries.begin(), m_entries, e);
+                    schema = e->schema;
+                    break;
+                }
+            }
+            if(schema)
+            {
+                m_hits++;
+            }
+            else
+            {
+                m_misses++;
+            }
+        }
+
+        if(!schema)
+        {
+            return false;
+        }
+        // cached schemas are immutable, so they are copied without the lock
+        dest.set(*schema);
+        return true;
+    }
+
+    void insert(uint8 kind, const char *text, index_t len, const Schema &src)
+    {
+        std::shared_ptr<Schema> schema(new Schema());
+        schema->set(src);
+
+        uint64 key = make_key(kind, text, len);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_max_entries <= 0)
+        {
+            return;
+        }
+        Entry entry;
+        entry.kind   = kind;
+        entry.key    = key;
+        entry.text.assign(text, (size_t)len);
+        entry.schema = schema;
+        m_entries.push_front(entry);
+        m_index.insert(std::make_pair(key, m_entries.begin()));
+        evict();
+    }
+
+    void set_max_entries(index_t max_entries)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_max_entries = max_entries > 0 ? max_entries : 0;
+        if(m_max_entries == 0)
+        {
+            clear_locked();
+        }
+        evict();
+    }
+
+    index_t max_entries()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_max_entries;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        clear_locked();
+    }
+
+    void stats(index_t &hits, index_t &misses)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        hits   = m_hits;
+        misses = m_misses;
+    }
+
+private:
+    struct Entry
+    {
+        uint8                         kind;
+        uint64                        key;
+        std::string                   text;
+        std::shared_ptr<const Schema> schema;
+    };
+
+    typedef std::list<Entry>                                  Entries;
+    typedef std::unordered_multimap<uint64,Entries::iterator> Index;
+
+    static uint64 make_key(uint8 kind, const char *text, index_t len)
+    {
+        // the length check makes collisions of the 32-bit hash unlikely,
+        // entries are still compared in full on lookup
+        uint64 hash = utils::hash(text, (unsigned int)len, kind);
+        return (hash << 32) ^ (uint64)len;
+    }
+
+    // requires the lock
+    void evict()
+    {
+        while((index_t)m_entries.size() > m_max_entries)
+        {
+            Entries::iterator last = --m_entries.end();
+            std::pair<Index::iterator,Index::iterator> rng =
+                m_index.equal_range(last->key);
+            for(Index::iterator itr = rng.first; itr != rng.second; itr++)
+            {
+                if(itr->second == last)
+                {
+                    m_index.erase(itr);
+                    break;
+                }
+            }
+            m_entries.erase(last);
+        }
+    }
+
+    // requires the lock
+    void clear_locked()
+    {
+        m_entries.clear();
+        m_index.clear();
+        m_hits   = 0;
+        m_misses = 0;
+    }
+
+    std::mutex           m_mutex;
+    Entries              m_entries;
+    Index                m_index;
+    std::atomic<index_t> m_max_entries;
+    index_t              m_hits;
+    index_t              m_misses;
+};
+
+//---------------------------------------------------------------------------//
+static SchemaParseCache &
+schema_parse_cache()
+{
+    static SchemaParseCache cache;
+    return cache;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Schema::deserialize_binary(const uint8 *data,
+                           index_t data_size)
+{
+    detail::SchemaParseCache &cache = detail::schema_parse_cache();
+    bool use_cache = cache.enabled();
+    if(use_cache && cache.lookup(detail::SCHEMA_CACHE_BINARY,
+                                 (const char*)data,
+                                 data_size,
+                                 *this))
+    {
+        return;
+    }
+
+    reset();
+    const uint8 *data_begin = data;
+    const uint8 *data_end = data + data_size;
+    std::vector<const Schema*> entries;
+    deserialize_binary_entry(data, data_end, entries);
+    if(data != data_end)
+    {
+        CONDUIT_ERROR("<Schema::deserialize_binary> binary schema data size ("
+                      << data_size << ") does not match encoded size ("
+                      << (data_size - (index_t)(data_end - data)) << ")");
+    }
+
+    if(use_cache)
+    {
+        cache.insert(detail::SCHEMA_CACHE_BINARY,
+                     (const char*)data_begin,
+                     data_size,
+                     *this);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::deserialize_binary(const std::vector<uint8> &data)
+{
+    if(data.empty())
+    {
+        CONDUIT_ERROR("<Schema::deserialize_binary> empty binary schema data");
+    }
+    deserialize_binary(&data[0], (index_t)data.size());
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::set_parse_cache_size(index_t max_entries)
+{
+    detail::schema_parse_cache().set_max_entries(max_entries);
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::parse_cache_size()
+{
+    return detail::schema_parse_cache().max_entries();
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::clear_parse_cache()
+{
+    detail::schema_parse_cache().clear();
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::parse_cache_stats(index_t &hits, index_t &misses)
+{
+    detail::schema_parse_cache().stats(hits, misses);
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -815,14 +1469,7 @@ Schema::remove(index_t idx)
 
     if(dtype_id == DataType::OBJECT_ID)
     {
-        // any index above the current needs to shift down by one
-        for (size_t i = (size_t)idx; i < object_order().size(); i++)
-        {
-            object_map()[object_order()[i]]--;
-        }
-        
-        object_map().erase(object_order()[(size_t)idx]);
-        object_order().erase(object_order().begin() + (size_t)idx);
+        object_index_remove(idx);
     }
 
     Schema* child = chldrn[(size_t)idx];
@@ -864,9 +1511,8 @@ Schema::add_child(const std::string &name)
     Schema* child = new Schema();
     child->m_parent = this;
     children().push_back(child);
-    object_map()[name] = children().size()-1;
-    object_order().push_back(name);
-    return *children()[child_index(name)];
+    object_index_append(name);
+    return *child;
 }
 
 
@@ -985,23 +1631,20 @@ Schema::fetch_existing(const std::string &path) const
 index_t
 Schema::child_index(const std::string &name) const
 {
-    index_t res=0;
+    index_t res = -1;
 
-    // find p_curr with an iterator
-    std::map<std::string, index_t>::const_iterator itr;
-    itr = object_map().find(name);
+    if(m_dtype.id() == DataType::OBJECT_ID)
+    {
+        res = find_child_index(name);
+    }
 
     // error if child does not exist. 
-    if(itr == object_map().end())
+    if(res < 0)
     {
         CONDUIT_ERROR("<Schema::child_index> Error: "
                       << "Schema(" << this->path() << ") "
                       << "attempt to access invalid child named:" << name);
     }
-    else
-    {
-        res = itr->second;
-    }
 
     return res;
 }
@@ -1056,18 +1699,10 @@ Schema::rename_child(const std::string &current_name,
                       " already exists.");
     }
 
-    std::map<std::string,index_t> &obj_map = object_map();
-    index_t idx = obj_map[current_name];
+    index_t idx = find_child_index(current_name);
 
-    // update string to index map
-
-    // remove current_name
-    obj_map.erase(current_name);
-    // link new_name to the idx
-    obj_map[new_name] = idx;
-
-    // update index to string lookup
-    object_order()[(size_t)idx] = new_name;
+    // update string to index map and index to string lookup
+    object_index_rename(idx,new_name);
 
     // we don't need to modify children(), we are not changing the
     // child schema 
@@ -1093,16 +1728,17 @@ Schema::fetch(const std::string &path)
            return m_parent->fetch(p_next);
     }
     
-    if (!has_path(p_curr)) 
+    index_t c_idx = find_child_index(p_curr);
+    if (c_idx < 0)
     {
         Schema* my_schema = new Schema();
         my_schema->m_parent = this;
         children().push_back(my_schema);
-        object_map()[p_curr] = children().size() - 1;
-        object_order().push_back(p_curr);
+        object_index_append(p_curr);
+        c_idx = (index_t)(children().size() - 1);
     }
 
-    size_t idx = (size_t) child_index(p_curr);
+    size_t idx = (size_t) c_idx;
     if(p_next.empty())
     {
         return *children()[idx];
@@ -1242,16 +1878,7 @@ Schema::has_child(const std::string &name) const
     if(m_dtype.id() != DataType::OBJECT_ID)
         return false;
 
-    const std::map<std::string,index_t> &ents = object_map();
-
-    if(ents.find(name) == ents.end())
-    {
-        return false;
-    }
-    else
-    {
-        return true;
-    }
+    return find_child_index(name) >= 0;
 }
 
 
@@ -1269,17 +1896,16 @@ Schema::has_path(const std::string &path) const
     
     // handle parent case (..)
     
-    const std::map<std::string,index_t> &ents = object_map();
+    index_t idx = find_child_index(p_curr);
 
-    if(ents.find(p_curr) == ents.end())
+    if(idx < 0)
     {
         return false;
     }
 
     if(!p_next.empty())
     {
-        size_t idx = (size_t) ents.find(p_curr)->second;
-        return children()[idx]->has_path(p_next);
+        return children()[(size_t)idx]->has_path(p_next);
     }
     else
     {
@@ -1345,13 +1971,7 @@ Schema::remove_child(const std::string &name)
 
     size_t idx = (size_t)child_index(name);
     Schema *child = children()[idx];
-    // any index above the current needs to shift down by one
-    for (size_t i = idx; i < object_order().size(); i++)
-    {
-        object_map()[object_order()[i]]--;
-    }
-    object_map().erase(name);
-    object_order().erase(object_order().begin() + idx);
+    object_index_remove((index_t)idx);
     children().erase(children().begin() + idx);
     delete child;
 }
@@ -1367,6 +1987,33 @@ Schema::append()
     return *sch;
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::reserve_children(index_t num_children)
+{
+    index_t dt_id = m_dtype.id();
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        children().reserve((size_t)num_children);
+        object_order().reserve((size_t)num_children);
+        if(num_children > OBJECT_MAP_HASH_THRESHOLD)
+        {
+            object_map().reserve((size_t)num_children);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        children().reserve((size_t)num_children);
+    }
+    else
+    {
+        CONDUIT_ERROR("<Schema::reserve_children> Error: "
+                      "Schema(" << this->path() << ") "
+                      "instance is not an Object or a List, and therefore "
+                      "does not have children.");
+    }
+}
+
 
 //=============================================================================
 //-----------------------------------------------------------------------------
@@ -1446,6 +2093,113 @@ Schema::release()
     m_hierarchy_data = NULL;
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::deserialize_binary_entry(const uint8 *&data,
+                                 const uint8 *data_end,
+                                 std::vector<const Schema*> &entries)
+{
+    uint8 entry_id = schema_binary_read<uint8>(data, data_end);
+
+    if(entry_id == BINARY_REF_ID)
+    {
+        uint64 ref_idx = schema_binary_read<uint64>(data, data_end);
+        int64  delta   = schema_binary_read<int64>(data, data_end);
+        // refs can only point to complete entries
+        if(ref_idx >= (uint64) entries.size() ||
+           entries[(size_t)ref_idx] == NULL)
+        {
+            CONDUIT_ERROR("<Schema::deserialize_binary> invalid binary "
+                          "schema reference: " << ref_idx);
+        }
+        set(*entries[(size_t)ref_idx]);
+        schema_shift_offsets(*this, (index_t) delta);
+        return;
+    }
+
+    index_t dt_id = (index_t) entry_id;
+
+    // object and list entries are numbered in encoding order
+    size_t entry_idx = entries.size();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        entries.push_back(NULL);
+    }
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        init_object();
+        uint64 nchildren = schema_binary_read<uint64>(data, data_end);
+        for(uint64 i=0; i < nchildren; i++)
+        {
+            uint32 name_len = schema_binary_read<uint32>(data, data_end);
+            if(data + name_len > data_end)
+            {
+                CONDUIT_ERROR("<Schema::deserialize_binary> unexpected end "
+                              "of binary schema data");
+            }
+            std::string name((const char*)data, name_len);
+            data += name_len;
+            // encoded child bytes, only needed to skip entries
+            schema_binary_read<uint64>(data, data_end);
+            add_child(name).deserialize_binary_entry(data, data_end, entries);
+        }
+        entries[entry_idx] = this;
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        init_list();
+        uint64 nchildren = schema_binary_read<uint64>(data, data_end);
+        for(uint64 i=0; i < nchildren; i++)
+        {
+            schema_binary_read<uint64>(data, data_end);
+            append().deserialize_binary_entry(data, data_end, entries);
+        }
+        entries[entry_idx] = this;
+    }
+    else if(dt_id == DataType::EMPTY_ID)
+    {
+        set(DataType::empty());
+    }
+    else
+    {
+        index_t num_ele   = (index_t) schema_binary_read<int64>(data, data_end);
+        index_t offset    = (index_t) schema_binary_read<int64>(data, data_end);
+        index_t stride    = (index_t) schema_binary_read<int64>(data, data_end);
+        index_t ele_bytes = (index_t) schema_binary_read<int64>(data, data_end);
+        index_t endianness = (index_t) schema_binary_read<uint8>(data, data_end);
+        set(DataType(dt_id,
+                     num_ele,
+                     offset,
+                     stride,
+                     ele_bytes,
+                     endianness));
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::steal(Schema &schema)
+{
+    m_dtype = schema.m_dtype;
+    m_hierarchy_data = schema.m_hierarchy_data;
+
+    schema.m_dtype = DataType::empty();
+    schema.m_hierarchy_data = NULL;
+
+    // re-parent any children we received
+    if(m_dtype.id() == DataType::OBJECT_ID ||
+       m_dtype.id() == DataType::LIST_ID)
+    {
+        std::vector<Schema*> &chld = children();
+        for(size_t i=0; i< chld.size(); i++)
+        {
+            chld[i]->m_parent = this;
+        }
+    }
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -1458,7 +2212,7 @@ Schema::release()
 
 //---------------------------------------------------------------------------//
 void    
-Schema::compact_to(Schema &s_dest, index_t curr_offset) const
+Schema::compact_to(Schema &s_dest, index_t &curr_offset) const
 {
     index_t dtype_id = m_dtype.id();
     
@@ -1471,7 +2225,6 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
             Schema  *cld_src = children()[i];
             Schema &cld_dest = s_dest.add_child(object_order()[i]);
             cld_src->compact_to(cld_dest,curr_offset);
-            curr_offset += cld_dest.total_bytes_compact();
         }
     }
     else if(dtype_id == DataType::LIST_ID)
@@ -1483,7 +2236,6 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
             Schema  *cld_src = children()[i];
             Schema &cld_dest = s_dest.append();
             cld_src->compact_to(cld_dest,curr_offset);
-            curr_offset += cld_dest.total_bytes_compact();
         }
     }
     else if (dtype_id != DataType::EMPTY_ID)
@@ -1491,6 +2243,7 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
         // create a compact data type
         m_dtype.compact_to(s_dest.m_dtype);
         s_dest.m_dtype.set_offset(curr_offset);
+        curr_offset += s_dest.m_dtype.bytes_compact();
     }
 }
 
@@ -1501,8 +2254,26 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
 void 
 Schema::walk_schema(const std::string &json_schema)
 {
+    detail::SchemaParseCache &cache = detail::schema_parse_cache();
+    bool use_cache = cache.enabled();
+    if(use_cache && cache.lookup(detail::SCHEMA_CACHE_JSON,
+                                 json_schema.data(),
+                                 (index_t)json_schema.size(),
+                                 *this))
+    {
+        return;
+    }
+
     Generator g(json_schema);
     g.walk(*this);
+
+    if(use_cache)
+    {
+        cache.insert(detail::SCHEMA_CACHE_JSON,
+                     json_schema.data(),
+                     (index_t)json_schema.size(),
+                     *this);
+    }
 }
 
 
@@ -1598,7 +2369,7 @@ Schema::children()
 }
 
 //---------------------------------------------------------------------------//
-std::map<std::string, index_t> &
+std::unordered_map<std::string, index_t> &
 Schema::object_map()
 {
     return object_hierarchy()->object_map;
@@ -1643,7 +2414,7 @@ Schema::child_index(Schema *schema_ptr) const
 }
 
 //---------------------------------------------------------------------------//
-const std::map<std::string, index_t> &
+const std::unordered_map<std::string, index_t> &
 Schema::object_map() const
 {
     return object_hierarchy()->object_map;
@@ -1677,15 +2448,123 @@ Schema::object_map_print() const
 void
 Schema::object_order_print() const
 {
-    std::map<std::string, index_t>::const_iterator itr; 
-        
-    for(itr = object_map().begin(); itr != object_map().end();itr++)
+    const std::vector<std::string> &obj_order = object_order();
+    for(size_t i=0; i < obj_order.size(); i++)
     {
-       std::cout << itr->first << ":" << itr->second << " ";
+       std::cout << obj_order[i] << ":" << find_child_index(obj_order[i])
+                 << " ";
     }
     std::cout << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+index_t
+Schema::find_child_index(const std::string &name) const
+{
+    const Schema_Object_Hierarchy *obj_h = object_hierarchy();
+
+    // hashed lookup, if the index has been built
+    if(!obj_h->object_map.empty())
+    {
+        std::unordered_map<std::string, index_t>::const_iterator itr;
+        itr = obj_h->object_map.find(name);
+        if(itr == obj_h->object_map.end())
+        {
+            return -1;
+        }
+        return itr->second;
+    }
+
+    // small objects: scan the names directly
+    const std::vector<std::string> &obj_order = obj_h->object_order;
+    size_t nchld = obj_order.size();
+    for(size_t i=0; i < nchld; i++)
+    {
+        if(obj_order[i] == name)
+        {
+            return (index_t)i;
+        }
+    }
+
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::object_index_append(const std::string &name)
+{
+    Schema_Object_Hierarchy *obj_h = object_hierarchy();
+    std::vector<std::string> &obj_order = obj_h->object_order;
+    std::unordered_map<std::string, index_t> &obj_map = obj_h->object_map;
+
+    obj_order.push_back(name);
+    index_t nchld = (index_t)obj_order.size();
+
+    if(!obj_map.empty())
+    {
+        obj_map[name] = nchld - 1;
+    }
+    else if(nchld > OBJECT_MAP_HASH_THRESHOLD)
+    {
+        // we crossed the threshold, build the hashed index
+        obj_map.reserve((size_t)nchld * 2);
+        for(index_t i=0; i < nchld; i++)
+        {
+            obj_map[obj_order[(size_t)i]] = i;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::object_index_remove(index_t idx)
+{
+    Schema_Object_Hierarchy *obj_h = object_hierarchy();
+    std::vector<std::string> &obj_order = obj_h->object_order;
+    std::unordered_map<std::string, index_t> &obj_map = obj_h->object_map;
+
+    if(!obj_map.empty())
+    {
+        if( (index_t)obj_order.size() - 1 <= OBJECT_MAP_HASH_THRESHOLD)
+        {
+            // we are back to a small object, drop the hashed index
+            obj_map.clear();
+        }
+        else
+        {
+            obj_map.erase(obj_order[(size_t)idx]);
+            // any index above the current needs to shift down by one
+            for (size_t i = (size_t)idx + 1; i < obj_order.size(); i++)
+            {
+                obj_map[obj_order[i]]--;
+            }
+        }
+    }
+
+    obj_order.erase(obj_order.begin() + (size_t)idx);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::object_index_rename(index_t idx,
+                            const std::string &new_name)
+{
+    Schema_Object_Hierarchy *obj_h = object_hierarchy();
+    std::vector<std::string> &obj_order = obj_h->object_order;
+    std::unordered_map<std::string, index_t> &obj_map = obj_h->object_map;
+
+    if(!obj_map.empty())
+    {
+        // remove current name
+        obj_map.erase(obj_order[(size_t)idx]);
+        // link new_name to the idx
+        obj_map[new_name] = idx;
+    }
+
+    // update index to string lookup
+    obj_order[(size_t)idx] = new_name;
+}
+
 
 }
 //-----------------------------------------------------------------------------
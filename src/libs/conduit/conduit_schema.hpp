@@ -15,6 +15,7 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -25,6 +26,7 @@
 #include "conduit_core.hpp"
 #include "conduit_endianness.hpp"
 #include "conduit_data_type.hpp"
+#include "conduit_utils.hpp"
 
 
 //-----------------------------------------------------------------------------
@@ -50,6 +52,7 @@ public:
 // -- friends of Schema --
 //-----------------------------------------------------------------------------
     friend class Node;
+    friend class Path;
     friend class NodeIterator;
     friend class NodeConstIterator;
 
@@ -69,6 +72,8 @@ public:
     Schema(); 
     /// schema copy constructor
     explicit Schema(const Schema &schema);
+    /// schema move constructor, leaves the passed schema empty
+    Schema(Schema &&schema) noexcept;
     /// create a schema for a leaf type given a data type id
     explicit Schema(index_t dtype_id);
     /// create a schema from a DataType
@@ -83,6 +88,11 @@ public:
     /// return a schema to the default (empty) state
     void  reset();
 
+    /// Schema instances are allocated from conduit's metadata pool
+    /// (see utils::metadata_allocate)
+    static void *operator new(size_t num_bytes);
+    static void  operator delete(void *ptr, size_t num_bytes);
+
 //-----------------------------------------------------------------------------
 //
 // Schema set methods
@@ -101,6 +111,9 @@ public:
 //
 //-----------------------------------------------------------------------------
     Schema &operator=(const Schema &schema);
+    /// move assignment, leaves the passed schema empty.
+    /// this schema keeps its current parent.
+    Schema &operator=(Schema &&schema) noexcept;
     Schema &operator=(index_t dtype_id);
     Schema &operator=(const DataType &dtype);
     Schema &operator=(const std::string &json_schema);
@@ -271,6 +284,84 @@ public:
 
     void            load(const std::string &stream_path);
 
+//-----------------------------------------------------------------------------
+//
+/// Structural comparison methods
+//
+//-----------------------------------------------------------------------------
+    /// Returns a hash of the structure of this schema: the hierarchy,
+    /// child names, and leaf dtypes. Leaf offsets are taken relative to
+    /// the smallest leaf offset in the schema, so schemas that describe
+    /// the same layout starting at different offsets have the same hash.
+    uint64          structural_hash() const;
+
+    /// Returns true if the passed schema has the same structure as this
+    /// schema, up to a constant shift of all leaf offsets.
+    bool            equals_structure(const Schema &s) const;
+
+//-----------------------------------------------------------------------------
+//
+/// Binary serialization methods
+//
+//-----------------------------------------------------------------------------
+    /// entry id used for references in the binary encoding
+    static const uint8 BINARY_REF_ID;
+
+    /// Appends a compact binary encoding of this schema to data.
+    ///
+    /// The binary encoding is much cheaper to create and parse than json
+    /// and is meant for transient uses (mpi messages, conduit_pack files).
+    /// Values are stored in the machine's native endianness.
+    ///
+    /// encoding:
+    ///  empty:  uint8 EMPTY_ID
+    ///  object: uint8 OBJECT_ID, uint64 number of children,
+    ///          then for each child:
+    ///            uint32 name length, name bytes,
+    ///            uint64 encoded child bytes, encoded child
+    ///  list:   uint8 LIST_ID, uint64 number of children,
+    ///          then for each child:
+    ///            uint64 encoded child bytes, encoded child
+    ///  leaf:   uint8 dtype id, int64 number of elements, int64 offset,
+    ///          int64 stride, int64 element bytes, uint8 endianness id
+    ///
+    /// When dedup is true, an object or list entry with the same
+    /// structure (see equals_structure()) as a previously encoded entry
+    /// is written as a reference to that entry:
+    ///  ref:    uint8 BINARY_REF_ID, uint64 index of the previous object
+    ///          or list entry (in encoding order), int64 offset delta
+    ///
+    /// Encodings that contain references can't be split into self
+    /// contained subtrees (as conduit_pack does), so dedup is off by
+    /// default.
+    void            serialize_binary(std::vector<uint8> &data,
+                                     bool dedup=false) const;
+
+    /// Sets this schema from a binary encoding created by serialize_binary.
+    /// Throws an Error if data_size does not match the encoded size.
+    void            deserialize_binary(const uint8 *data,
+                                       index_t data_size);
+    void            deserialize_binary(const std::vector<uint8> &data);
+
+//-----------------------------------------------------------------------------
+//
+/// Parsed schema cache
+//
+//-----------------------------------------------------------------------------
+    /// Opt-in, process wide LRU cache of parsed schemas, keyed by their
+    /// json or binary encoding. When enabled, set(json_schema), load()
+    /// (and so Node::load with conduit_bin) and deserialize_binary() (used
+    /// by the relay mpi *_using_schema methods) copy a cached schema for an
+    /// encoding seen before instead of parsing it again.
+    ///
+    /// max_entries <= 0 disables the cache (the default) and clears it.
+    static void     set_parse_cache_size(index_t max_entries);
+    static index_t  parse_cache_size();
+    static void     clear_parse_cache();
+    /// number of cached lookups that found / missed a parsed schema
+    /// since the cache was last cleared
+    static void     parse_cache_stats(index_t &hits, index_t &misses);
+
 
 //-----------------------------------------------------------------------------
 //
@@ -361,6 +452,10 @@ public:
 //-----------------------------------------------------------------------------
     Schema &append();
 
+    /// reserves storage for num_children children (list and object
+    /// interfaces)
+    void    reserve_children(index_t num_children);
+
 private:
 //-----------------------------------------------------------------------------
 //
@@ -375,6 +470,15 @@ private:
     void        init_object();
     // cleanup any allocated memory.
     void        release();
+    // decodes one binary encoded schema entry, advancing data
+    // entries holds the decoded object and list entries that
+    // references may refer to
+    void        deserialize_binary_entry(const uint8 *&data,
+                                         const uint8 *data_end,
+                                         std::vector<const Schema*> &entries);
+    /// takes the dtype and hierarchy from the passed schema, leaving
+    /// it empty (expects this schema to be released)
+    void        steal(Schema &schema);
 
     /// helps with proper alloc size for:
     /// Node::set_using_schema()and Node::set_data_using_schema
@@ -391,7 +495,9 @@ private:
 /// -- Private transform helpers -- 
 //
 //-----------------------------------------------------------------------------
-    void        compact_to(Schema &s_dest, index_t curr_offset) const ;
+    /// compacts into s_dest, starting at curr_offset. curr_offset is
+    /// advanced past the bytes used by the compacted schema.
+    void        compact_to(Schema &s_dest, index_t &curr_offset) const ;
     void        walk_schema(const std::string &json_schema);
 //-----------------------------------------------------------------------------
 //
@@ -402,13 +508,26 @@ private:
 /// Holds hierarchy data for schemas that describe an object.
 //-----------------------------------------------------------------------------
 
+    /// object_order is the source of truth for child names and their
+    /// iteration order. Small objects find children with a linear scan
+    /// of object_order. Once an object has more than
+    /// OBJECT_MAP_HASH_THRESHOLD children, object_map is populated as
+    /// a hashed name to index lookup (it is empty otherwise).
     struct Schema_Object_Hierarchy 
     {
-        std::vector<Schema*>            children;
-        std::vector<std::string>        object_order;
-        std::map<std::string, index_t>  object_map;
+        std::vector<Schema*>                      children;
+        std::vector<std::string>                  object_order;
+        std::unordered_map<std::string, index_t>  object_map;
+
+        static void *operator new(size_t num_bytes)
+            { return utils::metadata_allocate(num_bytes); }
+        static void  operator delete(void *ptr, size_t num_bytes)
+            { utils::metadata_free(ptr, num_bytes); }
     };
 
+    // number of object children above which we maintain a hashed index
+    static const index_t OBJECT_MAP_HASH_THRESHOLD;
+
     // this is used to return a ref to an empty list of strings as 
     // child names when the schema is not in the object role.
     static std::vector<std::string>     m_empty_child_names;
@@ -424,6 +543,11 @@ private:
     struct Schema_List_Hierarchy 
     {
         std::vector<Schema*> children;
+
+        static void *operator new(size_t num_bytes)
+            { return utils::metadata_allocate(num_bytes); }
+        static void  operator delete(void *ptr, size_t num_bytes)
+            { utils::metadata_free(ptr, num_bytes); }
     };
 
 //-----------------------------------------------------------------------------
@@ -432,13 +556,26 @@ private:
 //
 //-----------------------------------------------------------------------------
     // for obj and list interfaces
-    std::vector<Schema*>                   &children();
-    std::map<std::string, index_t>         &object_map();
-    std::vector<std::string>               &object_order();
-
-    const std::vector<Schema*>             &children()  const;    
-    const std::map<std::string, index_t>   &object_map()   const;
-    const std::vector<std::string>         &object_order() const;
+    std::vector<Schema*>                            &children();
+    std::unordered_map<std::string, index_t>        &object_map();
+    std::vector<std::string>                        &object_order();
+
+    const std::vector<Schema*>                      &children()  const;    
+    const std::unordered_map<std::string, index_t>  &object_map()   const;
+    const std::vector<std::string>                  &object_order() const;
+
+    /// name to index lookup for object children, returns -1 if a child
+    /// with the given name does not exist (does not throw)
+    index_t     find_child_index(const std::string &name) const;
+    /// adds a new named entry to the object bookkeeping data
+    /// (used after a new child schema is pushed onto children())
+    void        object_index_append(const std::string &name);
+    /// removes the named entry at idx from the object bookkeeping data
+    /// (does not modify children())
+    void        object_index_remove(index_t idx);
+    /// changes the name of the entry at idx in the object bookkeeping data
+    void        object_index_rename(index_t idx,
+                                    const std::string &new_name);
 
     void                                   object_map_print()   const;
     void                                   object_order_print() const;
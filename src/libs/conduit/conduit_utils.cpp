@@ -33,15 +33,27 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+// huge page mappings
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <sys/mman.h>
+#endif
+
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <fstream>
 #include <map>
+#include <mutex>
+#include <set>
+#include <vector>
 
+#if defined(CONDUIT_USE_OPENMP)
+#include <omp.h>
+#endif
 
 // define proper path sep
 #if defined(CONDUIT_PLATFORM_WINDOWS)
@@ -64,6 +76,15 @@ static const std::string file_path_sep_string(CONDUIT_UTILS_FILE_PATH_SEPARATOR)
 #include "b64/decode.h"
 using namespace base64;
 
+//-----------------------------------------------------------------------------
+// -- simd base64 kernel support --
+//-----------------------------------------------------------------------------
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define CONDUIT_BASE64_USE_AVX2
+#include <immintrin.h>
+#endif
+
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -84,6 +105,14 @@ default_alloc_handler(size_t items, size_t item_size)
   return calloc(items, item_size);
 }
 
+//-----------------------------------------------------------------------------
+// used by the default allocator when leaf data isn't zero filled
+static void *
+default_uninitialized_alloc_handler(size_t items, size_t item_size)
+{
+  return malloc(items * item_size);
+}
+
 //-----------------------------------------------------------------------------
 void
 default_free_handler(void *data_ptr)
@@ -136,6 +165,394 @@ set_memset_handler(void(*conduit_hnd_memset)(void*,
     conduit_handle_memset = conduit_hnd_memset;
 }
 
+namespace detail
+{
+    //
+    // MemoryHandlerRegistry: holds memcpy and memset handlers bound
+    // to allocator ids.
+    //
+    // `bound` lets the allocator aware dispatch skip the map lookups
+    // when no handlers are bound, which is the common case.
+    //
+    struct MemoryHandlerRegistry
+    {
+        typedef void (*memcpy_fn)(void *, const void *, size_t);
+        typedef void (*memset_fn)(void *, int, size_t);
+        typedef void (*memcpy_async_fn)(void *, const void *, size_t, void *);
+        typedef void (*stream_sync_fn)(void *);
+        typedef bool (*stream_query_fn)(void *);
+
+        std::map<std::pair<index_t,index_t>,memcpy_fn> pair_memcpy;
+        std::map<index_t,memcpy_fn>                    memcpy_fns;
+        std::map<index_t,memset_fn>                    memset_fns;
+        bool                                           bound;
+
+        std::map<std::pair<index_t,index_t>,memcpy_async_fn> pair_memcpy_async;
+        std::map<index_t,memcpy_async_fn>                    memcpy_async_fns;
+        stream_sync_fn                                       stream_sync;
+        stream_query_fn                                      stream_query;
+
+        MemoryHandlerRegistry()
+        : bound(false),
+          stream_sync(NULL),
+          stream_query(NULL)
+        {}
+
+        static MemoryHandlerRegistry &instance()
+        {
+            static MemoryHandlerRegistry inst;
+            return inst;
+        }
+
+        void update_bound()
+        {
+            bound = !pair_memcpy.empty() ||
+                    !memcpy_fns.empty()  ||
+                    !memset_fns.empty();
+        }
+
+        template<typename K, typename F>
+        static void bind(std::map<K,F> &fns, const K &key, F fn)
+        {
+            if(fn == NULL)
+            {
+                fns.erase(key);
+            }
+            else
+            {
+                fns[key] = fn;
+            }
+        }
+
+        memcpy_fn find_memcpy(index_t dest_id, index_t src_id) const
+        {
+            if(!bound)
+            {
+                return conduit_handle_memcpy;
+            }
+
+            std::map<std::pair<index_t,index_t>,memcpy_fn>::const_iterator pitr;
+            pitr = pair_memcpy.find(std::make_pair(dest_id,src_id));
+            if(pitr != pair_memcpy.end())
+            {
+                return pitr->second;
+            }
+
+            std::map<index_t,memcpy_fn>::const_iterator itr;
+            itr = memcpy_fns.find(dest_id);
+            if(itr != memcpy_fns.end())
+            {
+                return itr->second;
+            }
+
+            itr = memcpy_fns.find(src_id);
+            if(itr != memcpy_fns.end())
+            {
+                return itr->second;
+            }
+
+            return conduit_handle_memcpy;
+        }
+
+        memset_fn find_memset(index_t allocator_id) const
+        {
+            if(!bound)
+            {
+                return conduit_handle_memset;
+            }
+
+            std::map<index_t,memset_fn>::const_iterator itr;
+            itr = memset_fns.find(allocator_id);
+            if(itr != memset_fns.end())
+            {
+                return itr->second;
+            }
+
+            return conduit_handle_memset;
+        }
+
+        // returns NULL if no async handler applies
+        memcpy_async_fn find_memcpy_async(index_t dest_id,
+                                          index_t src_id) const
+        {
+            std::map<std::pair<index_t,index_t>,memcpy_async_fn>::const_iterator pitr;
+            pitr = pair_memcpy_async.find(std::make_pair(dest_id,src_id));
+            if(pitr != pair_memcpy_async.end())
+            {
+                return pitr->second;
+            }
+
+            std::map<index_t,memcpy_async_fn>::const_iterator itr;
+            itr = memcpy_async_fns.find(dest_id);
+            if(itr != memcpy_async_fns.end())
+            {
+                return itr->second;
+            }
+
+            itr = memcpy_async_fns.find(src_id);
+            if(itr != memcpy_async_fns.end())
+            {
+                return itr->second;
+            }
+
+            return NULL;
+        }
+    };
+
+    //
+    // AsyncCopyContext: per thread state of the active AsyncCopyScope
+    //
+    struct AsyncCopyContext
+    {
+        void    *stream;
+        index_t  num_async_copies;
+        bool     active;
+    };
+
+    static AsyncCopyContext &async_copy_context()
+    {
+        static thread_local AsyncCopyContext ctx = {NULL, 0, false};
+        return ctx;
+    }
+
+    // enqueues on the active scope's stream if an async handler applies
+    static bool memcpy_in_async_scope(void *destination,
+                                      const void *source,
+                                      size_t num,
+                                      index_t dest_allocator_id,
+                                      index_t src_allocator_id)
+    {
+        AsyncCopyContext &ctx = async_copy_context();
+        if(!ctx.active)
+        {
+            return false;
+        }
+
+        MemoryHandlerRegistry::memcpy_async_fn copy_fn =
+            MemoryHandlerRegistry::instance().find_memcpy_async(dest_allocator_id,
+                                                                src_allocator_id);
+        if(copy_fn == NULL)
+        {
+            return false;
+        }
+
+        copy_fn(destination, source, num, ctx.stream);
+        ctx.num_async_copies++;
+        return true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+set_memcpy_handler(index_t allocator_id,
+                   void(*conduit_hnd_copy)(void*,
+                                           const void *,
+                                           size_t))
+{
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    reg.bind(reg.memcpy_fns, allocator_id, conduit_hnd_copy);
+    reg.update_bound();
+}
+
+//-----------------------------------------------------------------------------
+void
+set_memcpy_handler(index_t dest_allocator_id,
+                   index_t src_allocator_id,
+                   void(*conduit_hnd_copy)(void*,
+                                           const void *,
+                                           size_t))
+{
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    reg.bind(reg.pair_memcpy,
+             std::make_pair(dest_allocator_id, src_allocator_id),
+             conduit_hnd_copy);
+    reg.update_bound();
+}
+
+//-----------------------------------------------------------------------------
+void
+set_memset_handler(index_t allocator_id,
+                   void(*conduit_hnd_memset)(void*,
+                                             int,
+                                             size_t))
+{
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    reg.bind(reg.memset_fns, allocator_id, conduit_hnd_memset);
+    reg.update_bound();
+}
+
+//-----------------------------------------------------------------------------
+void
+clear_allocator_memory_handlers()
+{
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    reg.pair_memcpy.clear();
+    reg.memcpy_fns.clear();
+    reg.memset_fns.clear();
+    reg.pair_memcpy_async.clear();
+    reg.memcpy_async_fns.clear();
+    reg.update_bound();
+}
+
+//-----------------------------------------------------------------------------
+void
+set_memcpy_async_handler(index_t allocator_id,
+                         void(*conduit_hnd_copy)(void*,
+                                                 const void *,
+                                                 size_t,
+                                                 void *))
+{
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    reg.bind(reg.memcpy_async_fns, allocator_id, conduit_hnd_copy);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_memcpy_async_handler(index_t dest_allocator_id,
+                         index_t src_allocator_id,
+                         void(*conduit_hnd_copy)(void*,
+                                                 const void *,
+                                                 size_t,
+                                                 void *))
+{
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    reg.bind(reg.pair_memcpy_async,
+             std::make_pair(dest_allocator_id, src_allocator_id),
+             conduit_hnd_copy);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_stream_handlers(void(*conduit_hnd_sync)(void *),
+                    bool(*conduit_hnd_query)(void *))
+{
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    reg.stream_sync  = conduit_hnd_sync;
+    reg.stream_query = conduit_hnd_query;
+}
+
+//-----------------------------------------------------------------------------
+bool
+conduit_memcpy_async(void *destination,
+                     const void *source,
+                     size_t num,
+                     index_t dest_allocator_id,
+                     index_t src_allocator_id,
+                     void *stream)
+{
+    detail::MemoryHandlerRegistry::memcpy_async_fn copy_fn =
+        detail::MemoryHandlerRegistry::instance().find_memcpy_async(dest_allocator_id,
+                                                                    src_allocator_id);
+    if(copy_fn == NULL)
+    {
+        conduit_memcpy(destination,
+                       source,
+                       num,
+                       dest_allocator_id,
+                       src_allocator_id);
+        return false;
+    }
+
+    copy_fn(destination, source, num, stream);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+AsyncCopyToken::AsyncCopyToken()
+: m_stream(NULL),
+  m_num_async_copies(0)
+{}
+
+//-----------------------------------------------------------------------------
+AsyncCopyToken::AsyncCopyToken(void *stream,
+                               index_t num_async_copies)
+: m_stream(stream),
+  m_num_async_copies(num_async_copies)
+{}
+
+//-----------------------------------------------------------------------------
+void *
+AsyncCopyToken::stream() const
+{
+    return m_stream;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+AsyncCopyToken::number_of_async_copies() const
+{
+    return m_num_async_copies;
+}
+
+//-----------------------------------------------------------------------------
+bool
+AsyncCopyToken::is_complete() const
+{
+    if(m_num_async_copies == 0)
+    {
+        return true;
+    }
+
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    if(reg.stream_query == NULL)
+    {
+        return false;
+    }
+
+    return reg.stream_query(m_stream);
+}
+
+//-----------------------------------------------------------------------------
+void
+AsyncCopyToken::wait()
+{
+    if(m_num_async_copies == 0)
+    {
+        return;
+    }
+
+    detail::MemoryHandlerRegistry &reg = detail::MemoryHandlerRegistry::instance();
+    if(reg.stream_sync == NULL)
+    {
+        CONDUIT_ERROR("AsyncCopyToken::wait: "
+                      << m_num_async_copies << " copies are pending, "
+                      << "but no stream synchronize handler is set "
+                      << "(see utils::set_stream_handlers)");
+    }
+
+    reg.stream_sync(m_stream);
+    m_num_async_copies = 0;
+}
+
+//-----------------------------------------------------------------------------
+AsyncCopyScope::AsyncCopyScope(void *stream)
+{
+    detail::AsyncCopyContext &ctx = detail::async_copy_context();
+    m_prev_stream           = ctx.stream;
+    m_prev_num_async_copies = ctx.num_async_copies;
+    m_prev_active           = ctx.active;
+    ctx.stream           = stream;
+    ctx.num_async_copies = 0;
+    ctx.active           = true;
+}
+
+//-----------------------------------------------------------------------------
+AsyncCopyScope::~AsyncCopyScope()
+{
+    detail::AsyncCopyContext &ctx = detail::async_copy_context();
+    ctx.stream           = m_prev_stream;
+    ctx.num_async_copies = m_prev_num_async_copies;
+    ctx.active           = m_prev_active;
+}
+
+//-----------------------------------------------------------------------------
+AsyncCopyToken
+AsyncCopyScope::token() const
+{
+    detail::AsyncCopyContext &ctx = detail::async_copy_context();
+    return AsyncCopyToken(ctx.stream, ctx.num_async_copies);
+}
+
 namespace detail
 {
     //
@@ -205,61 +622,1188 @@ namespace detail
               m_free_map[allocator_id](ptr);
           }
 
+          // device memory marks
+          void set_device(index_t allocator_id,
+                          bool value)
+          {
+              if(value)
+              {
+                  m_device_ids.insert(allocator_id);
+              }
+              else
+              {
+                  m_device_ids.erase(allocator_id);
+              }
+          }
+
+          bool is_device(index_t allocator_id) const
+          {
+              return !m_device_ids.empty() &&
+                     m_device_ids.find(allocator_id) != m_device_ids.end();
+          }
+
+          // recorded alignments
+          void set_alignment(index_t allocator_id,
+                             index_t alignment)
+          {
+              if(alignment > 0)
+              {
+                  m_alignment_map[allocator_id] = alignment;
+              }
+              else
+              {
+                  m_alignment_map.erase(allocator_id);
+              }
+          }
+
+          index_t alignment(index_t allocator_id) const
+          {
+              if(m_alignment_map.empty())
+              {
+                  return 0;
+              }
+              std::map<index_t,index_t>::const_iterator itr
+                  = m_alignment_map.find(allocator_id);
+              return itr != m_alignment_map.end() ? itr->second : 0;
+          }
+
+          // leaf data init modes
+          void set_init(index_t allocator_id,
+                        AllocatorInit init,
+                        index_t num_threads)
+          {
+              if(init == ALLOCATOR_INIT_ZERO)
+              {
+                  m_init_map.erase(allocator_id);
+              }
+              else
+              {
+                  m_init_map[allocator_id] = std::make_pair(init, num_threads);
+              }
+          }
+
+          AllocatorInit init(index_t allocator_id) const
+          {
+              if(m_init_map.empty())
+              {
+                  return ALLOCATOR_INIT_ZERO;
+              }
+              std::map<index_t,std::pair<AllocatorInit,index_t> >::const_iterator itr
+                  = m_init_map.find(allocator_id);
+              return itr != m_init_map.end() ? itr->second.first
+                                             : ALLOCATOR_INIT_ZERO;
+          }
+
+          void *allocate_initialized(size_t num_bytes,
+                                     index_t allocator_id)
+          {
+              AllocatorInit init_mode = init(allocator_id);
+              if(init_mode == ALLOCATOR_INIT_ZERO)
+              {
+                  return allocate(num_bytes, 1, allocator_id);
+              }
+
+              void *res = NULL;
+              if(allocator_id == 0)
+              {
+                  res = default_uninitialized_alloc_handler(num_bytes, 1);
+              }
+              else
+              {
+                  res = allocate(num_bytes, 1, allocator_id);
+              }
+
+              if(init_mode == ALLOCATOR_INIT_FIRST_TOUCH && res != NULL)
+              {
+                  if(is_device(allocator_id))
+                  {
+                      conduit_memset(res, 0, num_bytes, allocator_id);
+                  }
+                  else
+                  {
+                      parallel_zero_fill(res,
+                                         num_bytes,
+                                         m_init_map[allocator_id].second);
+                  }
+              }
+              return res;
+          }
+
      private:
           // constructor
           AllocManager()
           : m_allocator_map(),
-            m_free_map()
+            m_free_map(),
+            m_device_ids(),
+            m_init_map(),
+            m_alignment_map()
           {
               // register default handlers
               m_allocator_map[0] = &default_alloc_handler;
               m_free_map[0]      = &default_free_handler;
 
-              m_allocator_id = 1;
+              m_allocator_id = 1;
+
+          }
+
+          // destructor
+          ~AllocManager()
+          {
+
+          }
+
+          // vars
+          index_t                                    m_allocator_id;
+          std::map<index_t,void*(*)(size_t, size_t)> m_allocator_map;
+          std::map<index_t,void(*)(void*)>           m_free_map;
+          std::set<index_t>                          m_device_ids;
+          std::map<index_t,std::pair<AllocatorInit,index_t> > m_init_map;
+          std::map<index_t,index_t>                  m_alignment_map;
+
+    };
+}
+
+//-----------------------------------------------------------------------------
+index_t
+register_allocator(void*(*conduit_hnd_allocate) (size_t, size_t),
+                   void(*conduit_hnd_free)(void *))
+{
+    return detail::AllocManager::instance().register_allocator(conduit_hnd_allocate,
+                                                               conduit_hnd_free);
+}
+
+
+//-----------------------------------------------------------------------------
+void *
+conduit_allocate(size_t n_items,
+                 size_t item_size,
+                 index_t allocator_id)
+{
+    return detail::AllocManager::instance().allocate(n_items,
+                                                     item_size,
+                                                     allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_free(void *ptr,
+             index_t allocator_id)
+{
+    detail::AllocManager::instance().free(ptr,allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_device_allocator(index_t allocator_id,
+                     bool value)
+{
+    detail::AllocManager::instance().set_device(allocator_id,value);
+}
+
+//-----------------------------------------------------------------------------
+bool
+is_device_allocator(index_t allocator_id)
+{
+    return detail::AllocManager::instance().is_device(allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_allocator_alignment(index_t allocator_id,
+                        index_t alignment)
+{
+    detail::AllocManager::instance().set_alignment(allocator_id,alignment);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+allocator_alignment(index_t allocator_id)
+{
+    return detail::AllocManager::instance().alignment(allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_allocator_init(index_t allocator_id,
+                   AllocatorInit init,
+                   index_t num_threads)
+{
+    detail::AllocManager::instance().set_init(allocator_id,
+                                              init,
+                                              num_threads);
+}
+
+//-----------------------------------------------------------------------------
+AllocatorInit
+allocator_init(index_t allocator_id)
+{
+    return detail::AllocManager::instance().init(allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+void *
+conduit_allocate_initialized(size_t num_bytes,
+                             index_t allocator_id)
+{
+    return detail::AllocManager::instance().allocate_initialized(num_bytes,
+                                                                 allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+void
+parallel_zero_fill(void *ptr,
+                   size_t num_bytes,
+                   index_t num_threads)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    // ranges are whole pages, and small buffers aren't worth a thread
+    const size_t page_bytes = 4096;
+    const size_t min_thread_bytes = 64 * page_bytes;
+
+    if(num_threads <= 0)
+    {
+        num_threads = (index_t)omp_get_max_threads();
+    }
+
+    const size_t num_pages = (num_bytes + page_bytes - 1) / page_bytes;
+    const size_t num_workers = std::min((size_t)num_threads,
+                                        num_bytes / min_thread_bytes);
+    if(num_workers > 1 && !omp_in_parallel())
+    {
+        char *bytes = static_cast<char*>(ptr);
+        // with a static schedule, thread w of the team zeros the pages
+        // [w * num_pages / num_workers, (w+1) * num_pages / num_workers)
+        const long num_ranges = (long)num_workers;
+        #pragma omp parallel for schedule(static) num_threads(num_workers)
+        for(long w = 0; w < num_ranges; w++)
+        {
+            const size_t begin = std::min(num_bytes,
+                                          ((size_t)w * num_pages / num_workers) * page_bytes);
+            const size_t end = std::min(num_bytes,
+                                        (((size_t)w + 1) * num_pages / num_workers) * page_bytes);
+            memset(bytes + begin, 0, end - begin);
+        }
+        return;
+    }
+#else
+    (void)num_threads;
+#endif
+    memset(ptr, 0, num_bytes);
+}
+
+namespace detail
+{
+    //
+    // MetadataPool: A singleton that holds chunks and free lists used to
+    // allocate Node and Schema instances.
+    //
+    // NOTE: LIKE THE ALLOC MANAGER, THIS SINGLETON IS INTENTIONALLY LEAKED!
+    //
+    // Statically initialized Node objects return their blocks to the
+    // pool on exit, so the chunks need to outlive them.
+    //
+    // Blocks are binned by size (in multiples of BLOCK_ALIGN bytes). Each
+    // thread keeps its own free lists, so the common alloc and free cases
+    // don't require a lock. When a thread's free list for a bin is empty
+    // it takes up to a chunk's worth of free blocks returned to the pool
+    // by other threads, or carves a new chunk. A thread's free lists hold
+    // at most THREAD_CACHE_MAX_BYTES (like the data pool), past that they
+    // are returned to the pool, so blocks freed by a consumer thread can
+    // be reused by the producer. When a thread exits its free lists are
+    // returned to the pool.
+    //
+    class MetadataPool {
+
+     public:
+          static const size_t BLOCK_ALIGN = 16;
+          static const size_t NUM_BINS    = 16;
+          static const size_t MAX_BYTES   = BLOCK_ALIGN * NUM_BINS;
+          static const size_t CHUNK_BYTES = 64 * 1024;
+          static const size_t THREAD_CACHE_MAX_BYTES = 4 * 1024 * 1024;
+
+          struct FreeBlock
+          {
+              FreeBlock *next;
+          };
+
+          // per thread free lists, this is trivially destructible
+          // so it stays valid for any frees that happen after the
+          // thread's cache guard is destroyed
+          struct ThreadCache
+          {
+              FreeBlock *free_lists[NUM_BINS];
+              size_t     cached_bytes;
+              bool       released;
+          };
+
+          // returns the per thread cache to the pool on thread exit
+          struct ThreadCacheGuard
+          {
+              ~ThreadCacheGuard()
+              {
+                  MetadataPool::instance().release_thread_cache();
+              }
+          };
+
+          static MetadataPool& instance()
+          {
+            //
+            // NOTE: THIS IS INTENTIONALLY LEAKED
+            // See note above.
+            //
+            static MetadataPool *inst = new MetadataPool();
+            return *inst;
+          }
+
+          static size_t bin(size_t num_bytes)
+          {
+              if(num_bytes == 0)
+              {
+                  num_bytes = 1;
+              }
+              return (num_bytes - 1) / BLOCK_ALIGN;
+          }
+
+          static size_t bin_bytes(size_t b)
+          {
+              return (b + 1) * BLOCK_ALIGN;
+          }
+
+          void *allocate(size_t num_bytes)
+          {
+              if(num_bytes > MAX_BYTES)
+              {
+                  return ::operator new(num_bytes);
+              }
+
+              size_t b = bin(num_bytes);
+              ThreadCache &tc = thread_cache();
+
+              if(tc.free_lists[b] == NULL)
+              {
+                  refill(tc,b);
+              }
+
+              FreeBlock *res = tc.free_lists[b];
+              tc.free_lists[b] = res->next;
+              tc.cached_bytes -= bin_bytes(b);
+              return res;
+          }
+
+          void free(void *ptr, size_t num_bytes)
+          {
+              if(ptr == NULL)
+              {
+                  return;
+              }
+
+              if(num_bytes > MAX_BYTES)
+              {
+                  ::operator delete(ptr);
+                  return;
+              }
+
+              size_t b = bin(num_bytes);
+              FreeBlock *blk = static_cast<FreeBlock*>(ptr);
+              ThreadCache &tc = thread_cache();
+
+              if(tc.released)
+              {
+                  // this thread is exiting, give the block back to the pool
+                  std::lock_guard<std::mutex> lock(m_mutex);
+                  blk->next = m_free_lists[b];
+                  m_free_lists[b] = blk;
+                  return;
+              }
+
+              blk->next = tc.free_lists[b];
+              tc.free_lists[b] = blk;
+              tc.cached_bytes += bin_bytes(b);
+
+              if(tc.cached_bytes > THREAD_CACHE_MAX_BYTES)
+              {
+                  // this thread frees more than it allocates, let other
+                  // threads reuse its blocks
+                  std::lock_guard<std::mutex> lock(m_mutex);
+                  spill_thread_cache(tc);
+              }
+          }
+
+          index_t reserved_bytes()
+          {
+              std::lock_guard<std::mutex> lock(m_mutex);
+              return (index_t)(m_chunks.size() * CHUNK_BYTES);
+          }
+
+     private:
+          // constructor
+          MetadataPool()
+          : m_mutex(),
+            m_chunks()
+          {
+              for(size_t i=0; i < NUM_BINS; i++)
+              {
+                  m_free_lists[i] = NULL;
+              }
+          }
+
+          // destructor
+          ~MetadataPool()
+          {
+
+          }
+
+          static ThreadCache &thread_cache()
+          {
+              // zero initialized
+              static thread_local ThreadCache tc;
+              static thread_local ThreadCacheGuard tc_guard;
+              // odr-use the guard so it is constructed (and later
+              // destroyed) for each thread that uses the pool
+              (void) &tc_guard;
+              return tc;
+          }
+
+          void refill(ThreadCache &tc, size_t b)
+          {
+              std::lock_guard<std::mutex> lock(m_mutex);
+
+              size_t block_bytes = bin_bytes(b);
+              size_t num_blocks  = CHUNK_BYTES / block_bytes;
+
+              // use blocks returned by other threads when available
+              if(m_free_lists[b] != NULL)
+              {
+                  FreeBlock *head = m_free_lists[b];
+                  FreeBlock *tail = head;
+                  size_t count = 1;
+                  while(count < num_blocks && tail->next != NULL)
+                  {
+                      tail = tail->next;
+                      count++;
+                  }
+                  m_free_lists[b] = tail->next;
+                  tail->next = NULL;
+                  tc.free_lists[b] = head;
+                  tc.cached_bytes += count * block_bytes;
+                  return;
+              }
+
+              // carve a new chunk into blocks for this bin
+              char *chunk = static_cast<char*>(::operator new(CHUNK_BYTES));
+              m_chunks.push_back(chunk);
+
+              FreeBlock *head = NULL;
+              for(size_t i = num_blocks; i > 0; i--)
+              {
+                  FreeBlock *blk = reinterpret_cast<FreeBlock*>(
+                                        chunk + (i-1) * block_bytes);
+                  blk->next = head;
+                  head = blk;
+              }
+              tc.free_lists[b] = head;
+              tc.cached_bytes += num_blocks * block_bytes;
+          }
+
+          // moves a thread's free lists to the pool, m_mutex must be held
+          void spill_thread_cache(ThreadCache &tc)
+          {
+              for(size_t b=0; b < NUM_BINS; b++)
+              {
+                  FreeBlock *head = tc.free_lists[b];
+                  if(head == NULL)
+                  {
+                      continue;
+                  }
+                  FreeBlock *tail = head;
+                  while(tail->next != NULL)
+                  {
+                      tail = tail->next;
+                  }
+                  tail->next = m_free_lists[b];
+                  m_free_lists[b] = head;
+                  tc.free_lists[b] = NULL;
+              }
+              tc.cached_bytes = 0;
+          }
+
+          void release_thread_cache()
+          {
+              ThreadCache &tc = thread_cache();
+              std::lock_guard<std::mutex> lock(m_mutex);
+              spill_thread_cache(tc);
+              tc.released = true;
+          }
+
+          // vars
+          std::mutex          m_mutex;
+          FreeBlock          *m_free_lists[NUM_BINS];
+          std::vector<char*>  m_chunks;
+
+    };
+}
+
+//-----------------------------------------------------------------------------
+void *
+metadata_allocate(size_t num_bytes)
+{
+    return detail::MetadataPool::instance().allocate(num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+metadata_free(void *ptr,
+              size_t num_bytes)
+{
+    detail::MetadataPool::instance().free(ptr,num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+metadata_pool_reserved_bytes()
+{
+    return detail::MetadataPool::instance().reserved_bytes();
+}
+
+namespace detail
+{
+    //
+    // DataPool: A singleton size class pool used by the built-in pool
+    // allocators for leaf data.
+    //
+    // NOTE: LIKE THE ALLOC MANAGER, THIS SINGLETON IS INTENTIONALLY LEAKED!
+    //
+    // Each block is obtained from calloc with a small header that records
+    // its size class, since the free handler only receives the pointer.
+    // Freed blocks are kept on per size class free lists and handed out
+    // again (after zeroing, to match the default allocator) to requests
+    // in the same class. Size classes step by 1/4 of a power of two, so
+    // blocks are at most 25% larger than requested. Requests larger than
+    // MAX_POOLED_BYTES bypass the pool.
+    //
+    // When THREAD_CACHE is true, each thread keeps its own free lists
+    // (up to THREAD_CACHE_MAX_BYTES), like the metadata pool. Otherwise
+    // all threads share free lists protected by a mutex.
+    //
+    template<bool THREAD_CACHE>
+    class DataPool {
+
+     public:
+          static const size_t MIN_BLOCK_BYTES        = 64;
+          static const size_t MAX_POOLED_BYTES       = ((size_t)1) << 30;
+          // 1 bin for <= MIN_BLOCK_BYTES, 4 bins per power of two after
+          static const size_t NUM_BINS               = 1 + (30 - 6) * 4;
+          static const size_t HEADER_BYTES           = 16;
+          static const size_t THREAD_CACHE_MAX_BYTES = ((size_t)64) << 20;
+
+          struct Header
+          {
+              uint64 bin;
+              uint64 block_bytes;
+          };
+
+          struct FreeBlock
+          {
+              FreeBlock *next;
+          };
+
+          // per thread free lists, trivially destructible (see MetadataPool)
+          struct ThreadCache
+          {
+              FreeBlock *free_lists[NUM_BINS];
+              size_t     cached_bytes;
+              bool       released;
+          };
+
+          struct ThreadCacheGuard
+          {
+              ~ThreadCacheGuard()
+              {
+                  DataPool::instance().release_thread_cache();
+              }
+          };
+
+          static DataPool& instance()
+          {
+            //
+            // NOTE: THIS IS INTENTIONALLY LEAKED
+            // See note above.
+            //
+            static DataPool *inst = new DataPool();
+            return *inst;
+          }
+
+          // returns the size class of a request, NUM_BINS if the request
+          // is too large to pool
+          static size_t bin(size_t num_bytes)
+          {
+              if(num_bytes <= MIN_BLOCK_BYTES)
+              {
+                  return 0;
+              }
+              if(num_bytes > MAX_POOLED_BYTES)
+              {
+                  return NUM_BINS;
+              }
+              size_t nm1 = num_bytes - 1;
+              size_t k = 0;
+              while((nm1 >> (k+1)) != 0)
+              {
+                  k++;
+              }
+              size_t sub = (nm1 >> (k - 2)) & 3;
+              return 1 + (k - 6) * 4 + sub;
+          }
+
+          static size_t bin_bytes(size_t b)
+          {
+              if(b == 0)
+              {
+                  return MIN_BLOCK_BYTES;
+              }
+              size_t k   = 6 + (b - 1) / 4;
+              size_t sub = (b - 1) % 4;
+              return (5 + sub) << (k - 2);
+          }
+
+          void *allocate(size_t n_items, size_t item_size)
+          {
+              size_t num_bytes = n_items * item_size;
+              size_t b = bin(num_bytes);
+              size_t block_bytes = (b < NUM_BINS) ? bin_bytes(b) : num_bytes;
+
+              FreeBlock *blk = (b < NUM_BINS) ? pop(b) : NULL;
+              char *ptr = NULL;
+              if(blk != NULL)
+              {
+                  ptr = reinterpret_cast<char*>(blk);
+                  memset(ptr, 0, num_bytes > sizeof(FreeBlock) ?
+                                 num_bytes : sizeof(FreeBlock));
+                  m_num_hits++;
+                  m_bytes_cached -= (int64)block_bytes;
+              }
+              else
+              {
+                  char *raw = static_cast<char*>(calloc(1, HEADER_BYTES +
+                                                           block_bytes));
+                  if(raw == NULL)
+                  {
+                      return NULL;
+                  }
+                  Header *hdr = reinterpret_cast<Header*>(raw);
+                  hdr->bin = (uint64)b;
+                  hdr->block_bytes = (uint64)block_bytes;
+                  ptr = raw + HEADER_BYTES;
+              }
+
+              m_num_allocs++;
+              int64 live = (m_bytes_live += (int64)block_bytes);
+              int64 hwm  = m_high_water_mark.load();
+              while(live > hwm &&
+                    !m_high_water_mark.compare_exchange_weak(hwm, live))
+              {
+                  // hwm is updated by compare_exchange_weak
+              }
+              return ptr;
+          }
+
+          void free(void *ptr)
+          {
+              if(ptr == NULL)
+              {
+                  return;
+              }
+
+              char *raw = static_cast<char*>(ptr) - HEADER_BYTES;
+              const Header *hdr = reinterpret_cast<const Header*>(raw);
+              size_t b = (size_t)hdr->bin;
+              size_t block_bytes = (size_t)hdr->block_bytes;
+              m_bytes_live -= (int64)block_bytes;
+
+              if(b >= NUM_BINS)
+              {
+                  ::free(raw);
+                  return;
+              }
+
+              m_bytes_cached += (int64)block_bytes;
+              push(b, static_cast<FreeBlock*>(ptr), block_bytes);
+          }
+
+          // frees the cached blocks held by the pool (and the
+          // calling thread's cache)
+          void release_cached()
+          {
+              if(THREAD_CACHE)
+              {
+                  ThreadCache &tc = thread_cache();
+                  for(size_t b=0; b < NUM_BINS; b++)
+                  {
+                      free_list(tc.free_lists[b], b);
+                      tc.free_lists[b] = NULL;
+                  }
+                  tc.cached_bytes = 0;
+              }
+
+              std::lock_guard<std::mutex> lock(m_mutex);
+              for(size_t b=0; b < NUM_BINS; b++)
+              {
+                  free_list(m_free_lists[b], b);
+                  m_free_lists[b] = NULL;
+              }
+          }
+
+          void info(Node &res)
+          {
+              int64 num_allocs = m_num_allocs.load();
+              int64 num_hits   = m_num_hits.load();
+              res["thread_cache"] = THREAD_CACHE ? "true" : "false";
+              res["bytes_live"] = m_bytes_live.load();
+              res["high_water_mark"] = m_high_water_mark.load();
+              res["bytes_cached"] = m_bytes_cached.load();
+              res["num_allocations"] = num_allocs;
+              res["num_pool_hits"] = num_hits;
+              res["hit_rate"] = num_allocs > 0 ?
+                                (float64)num_hits / (float64)num_allocs : 0.0;
+          }
+
+     private:
+          // constructor
+          DataPool()
+          : m_mutex(),
+            m_bytes_live(0),
+            m_high_water_mark(0),
+            m_bytes_cached(0),
+            m_num_allocs(0),
+            m_num_hits(0)
+          {
+              for(size_t i=0; i < NUM_BINS; i++)
+              {
+                  m_free_lists[i] = NULL;
+              }
+          }
+
+          // destructor
+          ~DataPool()
+          {
+
+          }
+
+          static ThreadCache &thread_cache()
+          {
+              // zero initialized
+              static thread_local ThreadCache tc;
+              static thread_local ThreadCacheGuard tc_guard;
+              // odr-use the guard so it is constructed (and later
+              // destroyed) for each thread that uses the pool
+              (void) &tc_guard;
+              return tc;
+          }
+
+          FreeBlock *pop(size_t b)
+          {
+              if(THREAD_CACHE)
+              {
+                  ThreadCache &tc = thread_cache();
+                  FreeBlock *res = tc.released ? NULL : tc.free_lists[b];
+                  if(res != NULL)
+                  {
+                      tc.free_lists[b] = res->next;
+                      tc.cached_bytes -= bin_bytes(b);
+                      return res;
+                  }
+              }
+
+              std::lock_guard<std::mutex> lock(m_mutex);
+              FreeBlock *res = m_free_lists[b];
+              if(res != NULL)
+              {
+                  m_free_lists[b] = res->next;
+              }
+              return res;
+          }
 
+          void push(size_t b, FreeBlock *blk, size_t block_bytes)
+          {
+              if(THREAD_CACHE)
+              {
+                  ThreadCache &tc = thread_cache();
+                  if(!tc.released &&
+                     tc.cached_bytes + block_bytes <= THREAD_CACHE_MAX_BYTES)
+                  {
+                      blk->next = tc.free_lists[b];
+                      tc.free_lists[b] = blk;
+                      tc.cached_bytes += block_bytes;
+                      return;
+                  }
+              }
+
+              std::lock_guard<std::mutex> lock(m_mutex);
+              blk->next = m_free_lists[b];
+              m_free_lists[b] = blk;
           }
 
-          // destructor
-          ~AllocManager()
+          void free_list(FreeBlock *blk, size_t b)
           {
+              while(blk != NULL)
+              {
+                  FreeBlock *next = blk->next;
+                  m_bytes_cached -= (int64)bin_bytes(b);
+                  ::free(reinterpret_cast<char*>(blk) - HEADER_BYTES);
+                  blk = next;
+              }
+          }
 
+          void release_thread_cache()
+          {
+              ThreadCache &tc = thread_cache();
+              std::lock_guard<std::mutex> lock(m_mutex);
+              for(size_t b=0; b < NUM_BINS; b++)
+              {
+                  FreeBlock *blk = tc.free_lists[b];
+                  while(blk != NULL)
+                  {
+                      FreeBlock *next = blk->next;
+                      blk->next = m_free_lists[b];
+                      m_free_lists[b] = blk;
+                      blk = next;
+                  }
+                  tc.free_lists[b] = NULL;
+              }
+              tc.cached_bytes = 0;
+              tc.released = true;
           }
 
           // vars
-          index_t                                    m_allocator_id;
-          std::map<index_t,void*(*)(size_t, size_t)> m_allocator_map;
-          std::map<index_t,void(*)(void*)>           m_free_map;
-
+          std::mutex           m_mutex;
+          FreeBlock           *m_free_lists[NUM_BINS];
+          std::atomic<int64>   m_bytes_live;
+          std::atomic<int64>   m_high_water_mark;
+          std::atomic<int64>   m_bytes_cached;
+          std::atomic<int64>   m_num_allocs;
+          std::atomic<int64>   m_num_hits;
     };
+
+    //-------------------------------------------------------------------------
+    template<bool THREAD_CACHE>
+    void *
+    pool_alloc_handler(size_t items, size_t item_size)
+    {
+        return DataPool<THREAD_CACHE>::instance().allocate(items, item_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template<bool THREAD_CACHE>
+    void
+    pool_free_handler(void *data_ptr)
+    {
+        DataPool<THREAD_CACHE>::instance().free(data_ptr);
+    }
+
+    //-------------------------------------------------------------------------
+    // ids of the pool allocators, -1 until they are registered
+    static std::atomic<index_t> pool_allocator_ids[2] = {{-1}, {-1}};
 }
 
 //-----------------------------------------------------------------------------
 index_t
-register_allocator(void*(*conduit_hnd_allocate) (size_t, size_t),
-                   void(*conduit_hnd_free)(void *))
+pool_allocator_id(bool thread_cache)
 {
-    return detail::AllocManager::instance().register_allocator(conduit_hnd_allocate,
-                                                               conduit_hnd_free);
+    // registered on first use
+    if(thread_cache)
+    {
+        static index_t tc_id = register_allocator(
+                                    &detail::pool_alloc_handler<true>,
+                                    &detail::pool_free_handler<true>);
+        detail::pool_allocator_ids[1] = tc_id;
+        return tc_id;
+    }
+    else
+    {
+        static index_t id = register_allocator(
+                                    &detail::pool_alloc_handler<false>,
+                                    &detail::pool_free_handler<false>);
+        detail::pool_allocator_ids[0] = id;
+        return id;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+pool_allocator_release_cached()
+{
+    if(detail::pool_allocator_ids[0] >= 0)
+    {
+        detail::DataPool<false>::instance().release_cached();
+    }
+    if(detail::pool_allocator_ids[1] >= 0)
+    {
+        detail::DataPool<true>::instance().release_cached();
+    }
 }
 
+namespace detail
+{
+    //
+    // Aligned allocators: each registered setting gets a slot, and the
+    // allocate handler of the slot reads its settings. The settings of a
+    // slot don't change once its allocator is registered.
+    //
+    // A header before the returned pointer records the start and size of
+    // the underlying block, so one free handler serves all slots.
+    //
+    static const int     MAX_ALIGNED_ALLOCATORS = 16;
+    static const size_t  HUGE_PAGE_BYTES        = ((size_t)2) << 20;
+    static const size_t  PAGE_BYTES             = 4096;
+
+    struct AlignedAllocatorSettings
+    {
+        index_t              allocator_id;
+        size_t               alignment;
+        HugePages            huge_pages;
+        size_t               huge_page_threshold;
+        std::atomic<int64>   num_huge_page_allocs;
+    };
+
+    struct AlignedHeader
+    {
+        void   *base;
+        // bytes mapped with mmap, 0 for calloc'd blocks
+        size_t  mapped_bytes;
+    };
+
+    static AlignedAllocatorSettings aligned_settings[MAX_ALIGNED_ALLOCATORS];
+    static int                      num_aligned_settings = 0;
+    static std::mutex               aligned_settings_mutex;
+
+    //-------------------------------------------------------------------------
+    static size_t
+    round_up(size_t value, size_t multiple)
+    {
+        return ((value + multiple - 1) / multiple) * multiple;
+    }
+
+    //-------------------------------------------------------------------------
+    static void *
+    aligned_block_data(void *base,
+                       size_t alignment,
+                       size_t mapped_bytes)
+    {
+        size_t addr = round_up((size_t)base + sizeof(AlignedHeader),
+                               alignment);
+        AlignedHeader *header = ((AlignedHeader*)addr) - 1;
+        header->base = base;
+        header->mapped_bytes = mapped_bytes;
+        return (void*)addr;
+    }
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    //-------------------------------------------------------------------------
+    // maps num_bytes for a huge page allocation, returns NULL on failure
+    static void *
+    huge_page_allocate(const AlignedAllocatorSettings &settings,
+                       size_t num_bytes)
+    {
+        const size_t block_bytes = num_bytes +
+                                   settings.alignment +
+                                   sizeof(AlignedHeader);
+#if defined(MAP_HUGETLB)
+        if(settings.huge_pages == HUGE_PAGES_EXPLICIT)
+        {
+            size_t map_bytes = round_up(block_bytes, HUGE_PAGE_BYTES);
+            void *base = ::mmap(NULL,
+                                map_bytes,
+                                PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                                -1,
+                                0);
+            if(base != MAP_FAILED)
+            {
+                return aligned_block_data(base, settings.alignment, map_bytes);
+            }
+        }
+#endif
+        size_t map_bytes = round_up(block_bytes, PAGE_BYTES);
+        void *base = ::mmap(NULL,
+                            map_bytes,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS,
+                            -1,
+                            0);
+        if(base == MAP_FAILED)
+        {
+            return NULL;
+        }
+#if defined(MADV_HUGEPAGE)
+        // only a hint, kernels without transparent huge pages ignore it
+        ::madvise(base, map_bytes, MADV_HUGEPAGE);
+#endif
+        return aligned_block_data(base, settings.alignment, map_bytes);
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+    static void *
+    aligned_allocate(AlignedAllocatorSettings &settings,
+                     size_t num_bytes)
+    {
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+        if(settings.huge_pages != HUGE_PAGES_NONE &&
+           num_bytes >= settings.huge_page_threshold)
+        {
+            void *res = huge_page_allocate(settings, num_bytes);
+            if(res != NULL)
+            {
+                settings.num_huge_page_allocs++;
+                return res;
+            }
+        }
+#endif
+        // anonymous mappings are zero filled, match that with calloc
+        void *base = calloc(num_bytes + settings.alignment +
+                            sizeof(AlignedHeader), 1);
+        if(base == NULL)
+        {
+            return NULL;
+        }
+        return aligned_block_data(base, settings.alignment, 0);
+    }
+
+    //-------------------------------------------------------------------------
+    template<int SLOT>
+    void *
+    aligned_alloc_handler(size_t items, size_t item_size)
+    {
+        return aligned_allocate(aligned_settings[SLOT], items * item_size);
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    aligned_free_handler(void *data_ptr)
+    {
+        if(data_ptr == NULL)
+        {
+            return;
+        }
+        const AlignedHeader *header = ((const AlignedHeader*)data_ptr) - 1;
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+        if(header->mapped_bytes > 0)
+        {
+            ::munmap(header->base, header->mapped_bytes);
+            return;
+        }
+#endif
+        free(header->base);
+    }
+
+    typedef void *(*AllocHandler)(size_t, size_t);
+
+    static const AllocHandler aligned_alloc_handlers[MAX_ALIGNED_ALLOCATORS] =
+    {
+        &aligned_alloc_handler<0>,  &aligned_alloc_handler<1>,
+        &aligned_alloc_handler<2>,  &aligned_alloc_handler<3>,
+        &aligned_alloc_handler<4>,  &aligned_alloc_handler<5>,
+        &aligned_alloc_handler<6>,  &aligned_alloc_handler<7>,
+        &aligned_alloc_handler<8>,  &aligned_alloc_handler<9>,
+        &aligned_alloc_handler<10>, &aligned_alloc_handler<11>,
+        &aligned_alloc_handler<12>, &aligned_alloc_handler<13>,
+        &aligned_alloc_handler<14>, &aligned_alloc_handler<15>
+    };
+}
 
 //-----------------------------------------------------------------------------
-void *
-conduit_allocate(size_t n_items,
-                 size_t item_size,
-                 index_t allocator_id)
+index_t
+aligned_allocator_id(index_t alignment,
+                     HugePages huge_pages,
+                     index_t huge_page_threshold)
 {
-    return detail::AllocManager::instance().allocate(n_items,
-                                                     item_size,
-                                                     allocator_id);
+    if(alignment <= 0 || (alignment & (alignment - 1)) != 0)
+    {
+        CONDUIT_ERROR("aligned_allocator_id: alignment must be a power "
+                      "of two, given: " << alignment);
+    }
+
+    // the header before each block needs 16 bytes
+    size_t align = std::max((size_t)alignment,
+                            sizeof(detail::AlignedHeader));
+    size_t threshold = (size_t)std::max(huge_page_threshold, (index_t)0);
+    if(huge_pages == HUGE_PAGES_NONE)
+    {
+        threshold = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(detail::aligned_settings_mutex);
+    for(int i = 0; i < detail::num_aligned_settings; i++)
+    {
+        const detail::AlignedAllocatorSettings &settings
+            = detail::aligned_settings[i];
+        if(settings.alignment == align &&
+           settings.huge_pages == huge_pages &&
+           settings.huge_page_threshold == threshold)
+        {
+            return settings.allocator_id;
+        }
+    }
+
+    if(detail::num_aligned_settings == detail::MAX_ALIGNED_ALLOCATORS)
+    {
+        CONDUIT_ERROR("aligned_allocator_id: can't register more than "
+                      << detail::MAX_ALIGNED_ALLOCATORS
+                      << " aligned allocators");
+    }
+
+    int slot = detail::num_aligned_settings;
+    detail::AlignedAllocatorSettings &settings = detail::aligned_settings[slot];
+    settings.alignment = align;
+    settings.huge_pages = huge_pages;
+    settings.huge_page_threshold = threshold;
+    settings.num_huge_page_allocs = 0;
+    settings.allocator_id = register_allocator(
+                                detail::aligned_alloc_handlers[slot],
+                                &detail::aligned_free_handler);
+    set_allocator_alignment(settings.allocator_id, (index_t)align);
+    detail::num_aligned_settings++;
+    return settings.allocator_id;
 }
 
 //-----------------------------------------------------------------------------
 void
-conduit_free(void *ptr,
-             index_t allocator_id)
+allocator_info(Node &res)
 {
-    detail::AllocManager::instance().free(ptr,allocator_id);
+    res.reset();
+    res["metadata_pool/reserved_bytes"] = metadata_pool_reserved_bytes();
+
+    index_t id = detail::pool_allocator_ids[0];
+    if(id >= 0)
+    {
+        Node &pool_info = res["pool"];
+        pool_info["allocator_id"] = id;
+        detail::DataPool<false>::instance().info(pool_info);
+    }
+
+    id = detail::pool_allocator_ids[1];
+    if(id >= 0)
+    {
+        Node &pool_info = res["pool_thread_cache"];
+        pool_info["allocator_id"] = id;
+        detail::DataPool<true>::instance().info(pool_info);
+    }
+
+    std::lock_guard<std::mutex> lock(detail::aligned_settings_mutex);
+    for(int i = 0; i < detail::num_aligned_settings; i++)
+    {
+        const detail::AlignedAllocatorSettings &settings
+            = detail::aligned_settings[i];
+        Node &aligned_info = res["aligned"].append();
+        aligned_info["allocator_id"] = settings.allocator_id;
+        aligned_info["alignment"] = (int64) settings.alignment;
+        aligned_info["huge_pages"] = settings.huge_pages == HUGE_PAGES_NONE ?
+                                        "none" :
+                                     settings.huge_pages == HUGE_PAGES_TRANSPARENT ?
+                                        "transparent" : "explicit";
+        aligned_info["huge_page_threshold"] = (int64) settings.huge_page_threshold;
+        aligned_info["num_huge_page_allocations"] = (int64) settings.num_huge_page_allocs;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -313,6 +1857,103 @@ conduit_memcpy_strided_elements(void *dest,
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+conduit_memcpy(void *destination,
+               const void *source,
+               size_t num,
+               index_t dest_allocator_id,
+               index_t src_allocator_id)
+{
+    if(detail::memcpy_in_async_scope(destination,
+                                     source,
+                                     num,
+                                     dest_allocator_id,
+                                     src_allocator_id))
+    {
+        return;
+    }
+
+    detail::MemoryHandlerRegistry::instance().find_memcpy(dest_allocator_id,
+                                                          src_allocator_id)
+                                                         (destination,
+                                                          source,
+                                                          num);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_memset(void *ptr,
+               int value,
+               size_t num,
+               index_t allocator_id)
+{
+    detail::MemoryHandlerRegistry::instance().find_memset(allocator_id)
+                                                         (ptr,value,num);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_memcpy_strided_elements(void *dest,
+                                size_t num_elements,
+                                size_t ele_bytes,
+                                size_t dest_stride,
+                                const void *src,
+                                size_t src_stride,
+                                index_t dest_allocator_id,
+                                index_t src_allocator_id)
+{
+    // source and dest are compact, this may be enqueued on an active
+    // async copy scope
+    if( dest_stride == ele_bytes && src_stride == ele_bytes)
+    {
+        conduit_memcpy(dest,
+                       src,
+                       ele_bytes * num_elements,
+                       dest_allocator_id,
+                       src_allocator_id);
+        return;
+    }
+
+    detail::AsyncCopyContext &ctx = detail::async_copy_context();
+    if(ctx.active)
+    {
+        detail::MemoryHandlerRegistry::memcpy_async_fn async_fn =
+            detail::MemoryHandlerRegistry::instance().find_memcpy_async(dest_allocator_id,
+                                                                        src_allocator_id);
+        if(async_fn != NULL)
+        {
+            const char *src_data_ptr  = (const char*) src;
+            char *dest_data_ptr = (char*) dest;
+            for(size_t i=0; i< num_elements; i++)
+            {
+                async_fn(dest_data_ptr, src_data_ptr, ele_bytes, ctx.stream);
+                src_data_ptr  += src_stride;
+                dest_data_ptr += dest_stride;
+            }
+            ctx.num_async_copies += (index_t)num_elements;
+            return;
+        }
+    }
+
+    // resolve the handler once for all elements
+    detail::MemoryHandlerRegistry::memcpy_fn copy_fn =
+        detail::MemoryHandlerRegistry::instance().find_memcpy(dest_allocator_id,
+                                                              src_allocator_id);
+    // the source or dest are strided in a non compact way
+    const char *src_data_ptr  = (const char*) src;
+    char *dest_data_ptr = (char*) dest;
+    for(size_t i=0; i< num_elements; i++)
+    {
+        // copy next strided element
+        copy_fn(dest_data_ptr, src_data_ptr, ele_bytes);
+        // move by src stride
+        src_data_ptr  += src_stride;
+        // move by dest stride
+        dest_data_ptr += dest_stride;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // default info message handler callback, simply prints to std::cout.
 void
@@ -1261,29 +2902,338 @@ unescape_special_chars(const std::string &input)
 }
 
 
+namespace detail
+{
+    //
+    // Base64 kernels
+    //
+    // The scalar kernels encode 3 bytes and decode 4 chars at a time using
+    // lookup tables. On x86 with gcc or clang, AVX2 kernels (pshufb based
+    // translation, see Wojciech Mula's base64 SIMD work) are used when the
+    // cpu supports them, which is checked once at runtime.
+    //
+    // The decode kernels stop at the first char that is not part of the
+    // base64 alphabet (including '=' padding) and return the number of
+    // chars consumed, always a multiple of 4. libb64 decodes the rest,
+    // which keeps its lenient handling of padding and stray chars.
+    //
+
+    static const char base64_enc_table[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    // maps chars to 6-bit values, 0xFF for chars outside the alphabet
+    class Base64DecodeTable
+    {
+    public:
+        Base64DecodeTable()
+        {
+            memset(m_table,0xFF,256);
+            for(int i=0; i < 64; i++)
+            {
+                m_table[(unsigned char)base64_enc_table[i]] = (uint8)i;
+            }
+        }
+
+        uint8 operator[](unsigned char c) const
+        {
+            return m_table[c];
+        }
+
+    private:
+        uint8 m_table[256];
+    };
+
+    static const Base64DecodeTable base64_dec_table;
+
+    //-------------------------------------------------------------------------
+    // encodes all complete 3 byte groups of src, returns the number of
+    // bytes consumed
+    index_t
+    base64_encode_scalar(const uint8 *src,
+                         index_t src_nbytes,
+                         char *dest)
+    {
+        index_t ngroups = src_nbytes / 3;
+        for(index_t i=0; i < ngroups; i++)
+        {
+            uint32 v = ((uint32)src[0] << 16) |
+                       ((uint32)src[1] << 8)  |
+                        (uint32)src[2];
+            dest[0] = base64_enc_table[(v >> 18) & 0x3F];
+            dest[1] = base64_enc_table[(v >> 12) & 0x3F];
+            dest[2] = base64_enc_table[(v >> 6) & 0x3F];
+            dest[3] = base64_enc_table[v & 0x3F];
+            src  += 3;
+            dest += 4;
+        }
+        return ngroups * 3;
+    }
+
+    //-------------------------------------------------------------------------
+    // decodes complete 4 char groups of src, returns the number of chars
+    // consumed
+    index_t
+    base64_decode_scalar(const char *src,
+                         index_t src_nbytes,
+                         uint8 *dest)
+    {
+        index_t ngroups = src_nbytes / 4;
+        index_t i = 0;
+        for(; i < ngroups; i++)
+        {
+            uint8 a = base64_dec_table[(unsigned char)src[0]];
+            uint8 b = base64_dec_table[(unsigned char)src[1]];
+            uint8 c = base64_dec_table[(unsigned char)src[2]];
+            uint8 d = base64_dec_table[(unsigned char)src[3]];
+            if( (a | b | c | d) & 0x80 )
+            {
+                break;
+            }
+            uint32 v = ((uint32)a << 18) |
+                       ((uint32)b << 12) |
+                       ((uint32)c << 6)  |
+                        (uint32)d;
+            dest[0] = (uint8)(v >> 16);
+            dest[1] = (uint8)(v >> 8);
+            dest[2] = (uint8)v;
+            src  += 4;
+            dest += 3;
+        }
+        return i * 4;
+    }
+
+#if defined(CONDUIT_BASE64_USE_AVX2)
+    //-------------------------------------------------------------------------
+    // encodes 24 byte blocks, returns the number of bytes consumed
+    // (reads up to 4 bytes past the last block, so we always leave
+    //  at least 4 bytes for the scalar kernel)
+    __attribute__((target("avx2")))
+    index_t
+    base64_encode_avx2(const uint8 *src,
+                       index_t src_nbytes,
+                       char *dest)
+    {
+        // spreads each 3 byte group in a 128-bit lane to a 4 byte group
+        const __m256i shuf = _mm256_set_epi8(10, 11,  9, 10,
+                                              7,  8,  6,  7,
+                                              4,  5,  3,  4,
+                                              1,  2,  0,  1,
+                                             10, 11,  9, 10,
+                                              7,  8,  6,  7,
+                                              4,  5,  3,  4,
+                                              1,  2,  0,  1);
+        // offsets from 6-bit values to ascii
+        const __m256i shift_lut = _mm256_setr_epi8('a' - 26, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '+' - 62,
+                                                   '/' - 63, 'A', 0, 0,
+                                                   'a' - 26, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52,
+                                                   '0' - 52, '+' - 62,
+                                                   '/' - 63, 'A', 0, 0);
+        index_t consumed = 0;
+        while(src_nbytes - consumed >= 28)
+        {
+            const uint8 *curr = src + consumed;
+            __m256i in = _mm256_inserti128_si256(
+                            _mm256_castsi128_si256(
+                                _mm_loadu_si128((const __m128i*)curr)),
+                            _mm_loadu_si128((const __m128i*)(curr + 12)),
+                            1);
+            in = _mm256_shuffle_epi8(in,shuf);
+            // split each 24 bits into four 6-bit values
+            __m256i t0 = _mm256_and_si256(in,_mm256_set1_epi32(0x0fc0fc00));
+            __m256i t1 = _mm256_mulhi_epu16(t0,_mm256_set1_epi32(0x04000040));
+            __m256i t2 = _mm256_and_si256(in,_mm256_set1_epi32(0x003f03f0));
+            __m256i t3 = _mm256_mullo_epi16(t2,_mm256_set1_epi32(0x01000010));
+            __m256i idx = _mm256_or_si256(t1,t3);
+            // translate to ascii
+            __m256i res  = _mm256_subs_epu8(idx,_mm256_set1_epi8(51));
+            __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26),idx);
+            res = _mm256_or_si256(res,
+                                  _mm256_and_si256(less,
+                                                   _mm256_set1_epi8(13)));
+            res = _mm256_shuffle_epi8(shift_lut,res);
+            res = _mm256_add_epi8(res,idx);
+            _mm256_storeu_si256((__m256i*)dest,res);
+            dest     += 32;
+            consumed += 24;
+        }
+        return consumed;
+    }
+
+    //-------------------------------------------------------------------------
+    // decodes 32 char blocks, returns the number of chars consumed
+    // (writes 32 bytes per 24 decoded, so we stop while there are
+    //  enough chars left to guarantee room in dest)
+    __attribute__((target("avx2")))
+    index_t
+    base64_decode_avx2(const char *src,
+                       index_t src_nbytes,
+                       uint8 *dest)
+    {
+        const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x13, 0x1A,
+                                                0x1B, 0x1B, 0x1B, 0x1A,
+                                                0x15, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x13, 0x1A,
+                                                0x1B, 0x1B, 0x1B, 0x1A);
+        const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                                0x04, 0x08, 0x04, 0x08,
+                                                0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x01, 0x02,
+                                                0x04, 0x08, 0x04, 0x08,
+                                                0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x10, 0x10);
+        const __m256i lut_roll = _mm256_setr_epi8(0,  16,  19,   4,
+                                                  -65, -65, -71, -71,
+                                                  0,   0,   0,   0,
+                                                  0,   0,   0,   0,
+                                                  0,  16,  19,   4,
+                                                  -65, -65, -71, -71,
+                                                  0,   0,   0,   0,
+                                                  0,   0,   0,   0);
+        const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+        const __m256i pack_shuf = _mm256_setr_epi8( 2,  1,  0,  6,
+                                                    5,  4, 10,  9,
+                                                    8, 14, 13, 12,
+                                                   -1, -1, -1, -1,
+                                                    2,  1,  0,  6,
+                                                    5,  4, 10,  9,
+                                                    8, 14, 13, 12,
+                                                   -1, -1, -1, -1);
+        const __m256i pack_perm = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+        index_t consumed = 0;
+        while(src_nbytes - consumed >= 48)
+        {
+            __m256i in = _mm256_loadu_si256((const __m256i*)(src + consumed));
+            // validate and translate ascii to 6-bit values
+            __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in,4),
+                                                  mask_2f);
+            __m256i lo_nibbles = _mm256_and_si256(in,mask_2f);
+            __m256i hi = _mm256_shuffle_epi8(lut_hi,hi_nibbles);
+            __m256i lo = _mm256_shuffle_epi8(lut_lo,lo_nibbles);
+            if(!_mm256_testz_si256(lo,hi))
+            {
+                // found a char outside of the alphabet
+                break;
+            }
+            __m256i eq_2f = _mm256_cmpeq_epi8(in,mask_2f);
+            __m256i roll  = _mm256_shuffle_epi8(lut_roll,
+                                                _mm256_add_epi8(eq_2f,
+                                                                hi_nibbles));
+            in = _mm256_add_epi8(in,roll);
+            // pack four 6-bit values into 3 bytes
+            __m256i merged = _mm256_maddubs_epi16(in,
+                                            _mm256_set1_epi32(0x01400140));
+            in = _mm256_madd_epi16(merged,_mm256_set1_epi32(0x00011000));
+            in = _mm256_shuffle_epi8(in,pack_shuf);
+            in = _mm256_permutevar8x32_epi32(in,pack_perm);
+            _mm256_storeu_si256((__m256i*)dest,in);
+            dest     += 24;
+            consumed += 32;
+        }
+        return consumed;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    base64_use_avx2()
+    {
+        static const bool res = __builtin_cpu_supports("avx2") != 0;
+        return res;
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+    // encodes src into dest, including padding (but no null terminator),
+    // returns the number of chars written
+    index_t
+    base64_encode_chars(const uint8 *src,
+                        index_t src_nbytes,
+                        char *dest)
+    {
+        index_t consumed = 0;
+#if defined(CONDUIT_BASE64_USE_AVX2)
+        if(base64_use_avx2())
+        {
+            consumed = base64_encode_avx2(src,src_nbytes,dest);
+        }
+#endif
+        char *dest_curr = dest + (consumed / 3) * 4;
+        index_t res = base64_encode_scalar(src + consumed,
+                                           src_nbytes - consumed,
+                                           dest_curr);
+        consumed  += res;
+        dest_curr += (res / 3) * 4;
+
+        // last partial group
+        index_t rem = src_nbytes - consumed;
+        if(rem > 0)
+        {
+            uint32 v = (uint32)src[consumed] << 16;
+            if(rem > 1)
+            {
+                v |= (uint32)src[consumed + 1] << 8;
+            }
+            dest_curr[0] = base64_enc_table[(v >> 18) & 0x3F];
+            dest_curr[1] = base64_enc_table[(v >> 12) & 0x3F];
+            dest_curr[2] = rem > 1 ? base64_enc_table[(v >> 6) & 0x3F] : '=';
+            dest_curr[3] = '=';
+            dest_curr += 4;
+        }
+        return (index_t)(dest_curr - dest);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 base64_encode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    int nbytes = (int)src_nbytes;
-    base64_encodestate enc_state;
-    base64_init_encodestate(&enc_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr       = (char*)dest;
-    memset(des_ptr,0,(size_t)base64_encode_buffer_size(src_nbytes));
-
-    int code_len = base64_encode_block(src_ptr,
-                                       nbytes,
-                                       des_ptr,
-                                       &enc_state);
-    des_ptr += code_len;
-    code_len = base64_encode_blockend(des_ptr, &enc_state);
-    des_ptr += code_len;
+    char *des_ptr = (char*)dest;
+    index_t enc_nbytes = detail::base64_encode_chars((const uint8*)src,
+                                                     src_nbytes,
+                                                     des_ptr);
+    // null terminate, and zero the rest of the buffer
+    memset(des_ptr + enc_nbytes,
+           0,
+           (size_t)(base64_encode_buffer_size(src_nbytes) - enc_nbytes));
+}
 
-    // for some reason libb64 adds a newline
-    des_ptr[-1] = 0;
+//-----------------------------------------------------------------------------
+void
+base64_encode_stream(const void *src,
+                     index_t src_nbytes,
+                     std::ostream &os)
+{
+    // encode in chunks, chunk size is a multiple of 3 so only
+    // the last chunk can have padding
+    const index_t chunk_nbytes = 3 * 16384;
+    std::vector<char> enc_buff((size_t)(chunk_nbytes / 3) * 4);
+
+    const uint8 *src_ptr = (const uint8*)src;
+    index_t offset = 0;
+    while(offset < src_nbytes)
+    {
+        index_t curr_nbytes = std::min(chunk_nbytes,src_nbytes - offset);
+        index_t enc_nbytes = detail::base64_encode_chars(src_ptr + offset,
+                                                         curr_nbytes,
+                                                         &enc_buff[0]);
+        os.write(&enc_buff[0],(std::streamsize)enc_nbytes);
+        offset += curr_nbytes;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1307,15 +3257,73 @@ base64_decode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    base64_decodestate dec_state;
-    int src_len = (int)src_nbytes;
-    base64_init_decodestate(&dec_state);
     const char *src_ptr = (const char*)src;
-    char *des_ptr = (char*)dest;
-    base64_decode_block(src_ptr,
-                        src_len,
-                        des_ptr,
-                        &dec_state);
+    uint8 *des_ptr = (uint8*)dest;
+
+    index_t consumed = 0;
+#if defined(CONDUIT_BASE64_USE_AVX2)
+    if(detail::base64_use_avx2())
+    {
+        consumed = detail::base64_decode_avx2(src_ptr,src_nbytes,des_ptr);
+    }
+#endif
+    consumed += detail::base64_decode_scalar(src_ptr + consumed,
+                                             src_nbytes - consumed,
+                                             des_ptr + (consumed / 4) * 3);
+
+    if(consumed < src_nbytes)
+    {
+        // padding, partial groups, and any chars outside of the alphabet
+        base64_decodestate dec_state;
+        base64_init_decodestate(&dec_state);
+        base64_decode_block(src_ptr + consumed,
+                            (int)(src_nbytes - consumed),
+                            (char*)(des_ptr + (consumed / 4) * 3),
+                            &dec_state);
+    }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+base64_decode(const void *src,
+              index_t src_nbytes,
+              void *dest,
+              index_t dest_nbytes)
+{
+    const char *src_ptr = (const char*)src;
+    uint8 *des_ptr = (uint8*)dest;
+
+    // the complete groups that fit in dest are decoded in place
+    index_t direct_nbytes = std::min(src_nbytes, (dest_nbytes / 3) * 4);
+    index_t consumed = 0;
+#if defined(CONDUIT_BASE64_USE_AVX2)
+    if(detail::base64_use_avx2())
+    {
+        consumed = detail::base64_decode_avx2(src_ptr,direct_nbytes,des_ptr);
+    }
+#endif
+    consumed += detail::base64_decode_scalar(src_ptr + consumed,
+                                             direct_nbytes - consumed,
+                                             des_ptr + (consumed / 4) * 3);
+    index_t written = (consumed / 4) * 3;
+
+    if(consumed < src_nbytes && written < dest_nbytes)
+    {
+        // padding, partial groups, and any chars outside of the alphabet
+        // go through a small staging buffer so we never write past dest
+        std::vector<char> tail((size_t)
+            base64_decode_buffer_size(src_nbytes - consumed));
+        base64_decodestate dec_state;
+        base64_init_decodestate(&dec_state);
+        index_t tail_nbytes = base64_decode_block(src_ptr + consumed,
+                                                  (int)(src_nbytes - consumed),
+                                                  &tail[0],
+                                                  &dec_state);
+        tail_nbytes = std::min(tail_nbytes, dest_nbytes - written);
+        memcpy(des_ptr + written, &tail[0], (size_t)tail_nbytes);
+        written += tail_nbytes;
+    }
+    return written;
 }
 
 //-----------------------------------------------------------------------------
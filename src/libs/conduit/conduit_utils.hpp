@@ -269,16 +269,12 @@ namespace utils
 /// Primary interface used by the conduit API to move memory.
 //-----------------------------------------------------------------------------
 
-    // conduit uses a single pair of memset and memcpy functions to
+    // conduit uses a global pair of memset and memcpy functions to
     // manage data movement.
 
     // this strategy allows downstream users to support complex cases
     // like moving between memory spaces not accessible on the host.
     //
-    // These methods aren't bound to allocators b/c allocators
-    // won't be tied into all of the places where source and dest pointers
-    // need to be located.
-    //
     void CONDUIT_API set_memcpy_handler(void(*conduit_hnd_copy)(void*,
                                                                 const void *,
                                                                 size_t));
@@ -286,6 +282,40 @@ namespace utils
                                                                   int,
                                                                   size_t));
 
+    // handlers can also be bound to allocator ids, so host memory can keep
+    // using a fast memcpy while device allocators use device safe copies.
+    //
+    // allocator aware copies (the conduit_memcpy overloads that take
+    // allocator ids) select a handler in this order:
+    //   1) handler bound to the (dest, src) allocator pair
+    //   2) handler bound to the dest allocator
+    //   3) handler bound to the src allocator
+    //   4) the global handler
+    //
+    // allocator aware memsets use the handler bound to the allocator, or
+    // the global handler.
+    //
+    // Passing NULL removes a binding.
+    //
+    void CONDUIT_API set_memcpy_handler(index_t allocator_id,
+                                        void(*conduit_hnd_copy)(void*,
+                                                                const void *,
+                                                                size_t));
+
+    void CONDUIT_API set_memcpy_handler(index_t dest_allocator_id,
+                                        index_t src_allocator_id,
+                                        void(*conduit_hnd_copy)(void*,
+                                                                const void *,
+                                                                size_t));
+
+    void CONDUIT_API set_memset_handler(index_t allocator_id,
+                                        void(*conduit_hnd_memset)(void*,
+                                                                  int,
+                                                                  size_t));
+
+    // removes all allocator bound memcpy and memset handlers
+    void CONDUIT_API clear_allocator_memory_handlers();
+
     void CONDUIT_API default_memset_handler(void *ptr,
                                             int value,
                                             size_t num);
@@ -306,14 +336,131 @@ namespace utils
                                                      const void *src,
                                                      size_t src_stride);
 
+    // allocator aware memcpy interface, dispatches to the handler
+    // bound to the dest and src allocators
+    void CONDUIT_API conduit_memcpy(void *destination,
+                                    const void *source,
+                                    size_t num,
+                                    index_t dest_allocator_id,
+                                    index_t src_allocator_id);
+
+    void CONDUIT_API conduit_memcpy_strided_elements(void *dest,
+                                                     size_t num_elements,
+                                                     size_t ele_bytes,
+                                                     size_t dest_stride,
+                                                     const void *src,
+                                                     size_t src_stride,
+                                                     index_t dest_allocator_id,
+                                                     index_t src_allocator_id);
+
     // general memset interface used by conduit
     // NOTE (cyrush): The default memset returns the orig pointer, but
     // other allocators like cuda do not.
-    //    TODO: GIVEN THIS DO WE NEED TO PASS AN ALLOC_ID?
     void CONDUIT_API conduit_memset(void * ptr,
                                     int value,
                                     size_t num);
 
+    // allocator aware memset interface, dispatches to the handler
+    // bound to the allocator
+    void CONDUIT_API conduit_memset(void * ptr,
+                                    int value,
+                                    size_t num,
+                                    index_t allocator_id);
+
+//-----------------------------------------------------------------------------
+/// Stream ordered (asynchronous) copies.
+//-----------------------------------------------------------------------------
+
+    // async memcpy handlers enqueue a copy on an opaque stream or queue
+    // handle (for example a cudaStream_t or hipStream_t) and return
+    // without waiting for it to finish.
+    //
+    // They are bound like the synchronous allocator handlers, and
+    // selected in the same order: (dest, src) pair, dest, then src.
+    // If no async handler applies, the copy is done synchronously.
+    //
+    // Passing NULL removes a binding.
+    //
+    void CONDUIT_API set_memcpy_async_handler(index_t allocator_id,
+                                              void(*conduit_hnd_copy)(void*,
+                                                                      const void *,
+                                                                      size_t,
+                                                                      void *));
+
+    void CONDUIT_API set_memcpy_async_handler(index_t dest_allocator_id,
+                                              index_t src_allocator_id,
+                                              void(*conduit_hnd_copy)(void*,
+                                                                      const void *,
+                                                                      size_t,
+                                                                      void *));
+
+    // stream handlers used by AsyncCopyToken
+    //   synchronize: blocks until all work enqueued on the stream is done
+    //   query: returns true if all work enqueued on the stream is done
+    void CONDUIT_API set_stream_handlers(void(*conduit_hnd_sync)(void *),
+                                         bool(*conduit_hnd_query)(void *));
+
+    // enqueues the copy if an async handler applies, otherwise copies
+    // synchronously. Returns true if the copy was enqueued.
+    bool CONDUIT_API conduit_memcpy_async(void *destination,
+                                          const void *source,
+                                          size_t num,
+                                          index_t dest_allocator_id,
+                                          index_t src_allocator_id,
+                                          void *stream);
+
+//-----------------------------------------------------------------------------
+/// Completion token for stream ordered copies.
+///
+/// Holds the stream and the number of copies enqueued on it.
+/// A token with no enqueued copies is always complete.
+//-----------------------------------------------------------------------------
+    class CONDUIT_API AsyncCopyToken
+    {
+        public:
+            AsyncCopyToken();
+            AsyncCopyToken(void *stream,
+                           index_t num_async_copies);
+
+            void    *stream() const;
+            index_t  number_of_async_copies() const;
+
+            // uses the stream query handler, returns false for pending
+            // copies if no query handler is set
+            bool     is_complete() const;
+            // uses the stream synchronize handler
+            void     wait();
+
+        private:
+            void    *m_stream;
+            index_t  m_num_async_copies;
+    };
+
+//-----------------------------------------------------------------------------
+/// While an AsyncCopyScope is alive, the allocator aware conduit_memcpy
+/// and conduit_memcpy_strided_elements calls made on this thread are
+/// enqueued on its stream when an async handler applies.
+///
+/// Source memory must stay valid until the copies complete.
+//-----------------------------------------------------------------------------
+    class CONDUIT_API AsyncCopyScope
+    {
+        public:
+            explicit AsyncCopyScope(void *stream);
+                    ~AsyncCopyScope();
+
+            /// token for the copies enqueued in this scope so far
+            AsyncCopyToken token() const;
+
+        private:
+            AsyncCopyScope(const AsyncCopyScope &);
+            AsyncCopyScope &operator=(const AsyncCopyScope &);
+
+            void    *m_prev_stream;
+            index_t  m_prev_num_async_copies;
+            bool     m_prev_active;
+    };
+
 //-----------------------------------------------------------------------------
 /// Primary interface used by the conduit API to allocate memory.
 //-----------------------------------------------------------------------------
@@ -332,6 +479,160 @@ namespace utils
     void CONDUIT_API conduit_free(void *data_ptr,
                                   index_t allocator_id = 0);
 
+    // marks an allocator as returning device memory, which the host
+    // can't access directly (only with the allocator's memcpy handlers).
+    // libraries that hand data pointers to other code (for example
+    // relay::mpi) use this to find device resident leaves.
+    void CONDUIT_API set_device_allocator(index_t allocator_id,
+                                          bool value = true);
+
+    bool CONDUIT_API is_device_allocator(index_t allocator_id);
+
+    // records the alignment (in bytes) of the memory an allocator returns.
+    // loaders use it to place the leaves they read on aligned offsets.
+    // allocator_alignment returns 0 for allocators without a recorded
+    // alignment, including the default allocator (malloc alignment).
+    void CONDUIT_API set_allocator_alignment(index_t allocator_id,
+                                             index_t alignment);
+
+    index_t CONDUIT_API allocator_alignment(index_t allocator_id);
+
+    // how Nodes initialize the leaf data they allocate:
+    //
+    //  ALLOCATOR_INIT_ZERO (default): data is zero filled.
+    //  ALLOCATOR_INIT_NONE: data is left uninitialized, for callers that
+    //   overwrite every byte.
+    //  ALLOCATOR_INIT_FIRST_TOUCH: data is zero filled by a team of
+    //   num_threads OpenMP threads (<= 0 uses omp_get_max_threads()), each
+    //   one touching an equal, contiguous range of pages first. On NUMA
+    //   systems (with pinned threads) this places pages near the threads
+    //   that process the same ranges later in static schedule loops.
+    //   Without OpenMP support (CONDUIT_USE_OPENMP), data is zero filled
+    //   by the calling thread, like ALLOCATOR_INIT_ZERO.
+    //
+    // For the default allocator, the NONE and FIRST_TOUCH modes use malloc
+    // instead of calloc. Device allocators are zero filled with their
+    // memset handler for the FIRST_TOUCH mode.
+    enum AllocatorInit
+    {
+        ALLOCATOR_INIT_ZERO = 0,
+        ALLOCATOR_INIT_NONE,
+        ALLOCATOR_INIT_FIRST_TOUCH
+    };
+
+    void CONDUIT_API set_allocator_init(index_t allocator_id,
+                                        AllocatorInit init,
+                                        index_t num_threads = 0);
+
+    AllocatorInit CONDUIT_API allocator_init(index_t allocator_id);
+
+    // allocates num_bytes with the allocator and initializes them
+    // with the allocator's init mode
+    void CONDUIT_API * conduit_allocate_initialized(size_t num_bytes,
+                                                    index_t allocator_id = 0);
+
+    // zero fills num_bytes at ptr with a static schedule OpenMP loop over
+    // num_threads page ranges (<= 0 uses omp_get_max_threads()). Without
+    // OpenMP support, or when called from a parallel region, the fill is
+    // serial.
+    void CONDUIT_API parallel_zero_fill(void *ptr,
+                                        size_t num_bytes,
+                                        index_t num_threads = 0);
+
+//-----------------------------------------------------------------------------
+/// Pooled allocation of tree metadata.
+///
+/// Node and Schema instances (and their child bookkeeping data) are small
+/// objects that are created and destroyed in large numbers when building
+/// trees. Instead of a heap allocation per object, conduit allocates
+/// them from size-binned free lists that are carved out of large chunks.
+/// Freeing an object returns its block to the calling thread's free list,
+/// so rebuilding a tree reuses the same memory.
+///
+/// This is independent of the data allocators registered with
+/// `register_allocator`, which are only used for leaf data.
+//-----------------------------------------------------------------------------
+
+    // allocate a metadata block of at least the given size
+    void CONDUIT_API * metadata_allocate(size_t num_bytes);
+
+    // free a metadata block, num_bytes must match the allocated size
+    void CONDUIT_API metadata_free(void *ptr,
+                                   size_t num_bytes);
+
+    // total number of bytes reserved by the metadata pool
+    index_t CONDUIT_API metadata_pool_reserved_bytes();
+
+//-----------------------------------------------------------------------------
+/// Built-in pool allocators for leaf data.
+///
+/// The pool allocators keep freed blocks in size class free lists and
+/// reuse them for later requests of a similar size, so repeatedly
+/// building Nodes with the same shapes stops calling the system allocator
+/// after the first cycle. Like the default allocator, memory is returned
+/// zero initialized.
+///
+/// Use them by passing the id to `Node::set_allocator`, for example:
+///   n.set_allocator(utils::pool_allocator_id());
+//-----------------------------------------------------------------------------
+
+    // returns the allocator id of a pool allocator, registering it on
+    // first use. when thread_cache is true, each thread keeps its own
+    // free lists, otherwise all threads share free lists behind a lock.
+    // (the first call registers the allocator, which is not thread safe)
+    index_t CONDUIT_API pool_allocator_id(bool thread_cache=true);
+
+    // frees the unused blocks cached by the pool allocators
+    // (for thread caching pools, only the calling thread's cache
+    //  and the shared lists are freed)
+    void CONDUIT_API pool_allocator_release_cached();
+
+//-----------------------------------------------------------------------------
+/// Built-in aligned allocators for leaf data.
+///
+/// The aligned allocators return zero initialized memory that starts at a
+/// multiple of `alignment` bytes (a power of two, at least 16), so SIMD
+/// loads of Conduit owned arrays are aligned. Allocations of at least
+/// `huge_page_threshold` bytes can also be backed by huge pages, which
+/// cuts TLB misses on large arrays:
+///
+///  HUGE_PAGES_NONE: memory comes from calloc.
+///  HUGE_PAGES_TRANSPARENT: large allocations are mapped with mmap and
+///   marked with madvise(MADV_HUGEPAGE), for transparent huge pages.
+///  HUGE_PAGES_EXPLICIT: large allocations are mapped from the huge page
+///   pool (mmap with MAP_HUGETLB, in 2 MiB pages), falling back to the
+///   transparent mode when the pool has no free pages.
+///
+/// Huge pages are ignored on platforms without mmap. Use the allocators
+/// by passing the id to `Node::set_allocator`, for example:
+///   n.set_allocator(utils::aligned_allocator_id(64));
+//-----------------------------------------------------------------------------
+
+    enum HugePages
+    {
+        HUGE_PAGES_NONE = 0,
+        HUGE_PAGES_TRANSPARENT,
+        HUGE_PAGES_EXPLICIT
+    };
+
+    // returns the allocator id for the given settings, registering an
+    // allocator the first time they are used (which is not thread safe).
+    // up to 16 different settings can be registered.
+    index_t CONDUIT_API aligned_allocator_id(index_t alignment = 64,
+                                             HugePages huge_pages = HUGE_PAGES_NONE,
+                                             index_t huge_page_threshold = 2097152);
+
+    // reports allocator stats:
+    //   metadata_pool/reserved_bytes
+    //   pool and pool_thread_cache (if registered):
+    //     allocator_id, thread_cache, bytes_live, high_water_mark,
+    //     bytes_cached, num_allocations, num_pool_hits, hit_rate
+    //   aligned (if any are registered), a list with one entry per
+    //   aligned allocator:
+    //     allocator_id, alignment, huge_pages, huge_page_threshold,
+    //     num_huge_page_allocations
+    void CONDUIT_API allocator_info(conduit::Node &res);
+
 
 
 //-----------------------------------------------------------------------------
@@ -502,6 +803,12 @@ namespace utils
                                    index_t src_nbytes,
                                    void *dest);
 
+    /// encodes src and writes the result to os in chunks, without
+    /// creating the full encoded string (no null terminator is written)
+    void CONDUIT_API base64_encode_stream(const void *src,
+                                          index_t src_nbytes,
+                                          std::ostream &os);
+
     index_t CONDUIT_API base64_encode_buffer_size(index_t src_nbytes);
 
     index_t CONDUIT_API base64_decode_buffer_size(index_t encoded_nbytes);
@@ -511,6 +818,14 @@ namespace utils
                                    index_t src_nbytes,
                                    void *dest);
 
+    /// decodes src into dest, writing at most dest_nbytes bytes (so dest
+    /// can be the final, exactly sized buffer). returns the number of
+    /// bytes written.
+    index_t CONDUIT_API base64_decode(const void *src,
+                                      index_t src_nbytes,
+                                      void *dest,
+                                      index_t dest_nbytes);
+
 //-----------------------------------------------------------------------------
      std::string CONDUIT_API json_sanitize(const std::string &json);
 
@@ -0,0 +1,270 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_fortran_cdesc.cpp
+///
+/// C entry points for the conduit_cdesc fortran module, which passes
+/// Fortran arrays to conduit as C descriptors (CFI_cdesc_t) so strided
+/// array sections can be described without copies.
+///
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// fortran compiler includes
+//-----------------------------------------------------------------------------
+#include <ISO_Fortran_binding.h>
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_cpp_to_c.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// returns the conduit dtype id for an interoperable fortran type
+//---------------------------------------------------------------------------//
+index_t
+cfi_type_to_dtype_id(CFI_type_t type,
+                     size_t elem_len)
+{
+    if(type == CFI_type_float && elem_len == 4)
+    {
+        return DataType::FLOAT32_ID;
+    }
+    else if(type == CFI_type_double && elem_len == 8)
+    {
+        return DataType::FLOAT64_ID;
+    }
+    else if(type == CFI_type_signed_char ||
+            type == CFI_type_short       ||
+            type == CFI_type_int         ||
+            type == CFI_type_long        ||
+            type == CFI_type_long_long   ||
+            type == CFI_type_int8_t      ||
+            type == CFI_type_int16_t     ||
+            type == CFI_type_int32_t     ||
+            type == CFI_type_int64_t     ||
+            type == CFI_type_intptr_t    ||
+            type == CFI_type_ptrdiff_t)
+    {
+        switch(elem_len)
+        {
+            case 1: return DataType::INT8_ID;
+            case 2: return DataType::INT16_ID;
+            case 4: return DataType::INT32_ID;
+            case 8: return DataType::INT64_ID;
+        }
+    }
+
+    CONDUIT_ERROR("Unsupported Fortran array type (CFI type code: "
+                  << type << ", element bytes: " << elem_len << ")."
+                  " Supported types are integer(1,2,4,8) and real(4,8).");
+    return DataType::EMPTY_ID;
+}
+
+//---------------------------------------------------------------------------//
+// sets dtype to describe the elements of the array behind a descriptor,
+// in fortran array element order, starting at the returned address.
+//
+// conduit dtypes describe one stride, so the dimensions of arrays with
+// rank > 1 must nest: each dimension's byte stride must be the previous
+// dimension's byte stride times its extent (true for contiguous arrays
+// and for sections strided only in their first dimension).
+//---------------------------------------------------------------------------//
+void *
+cfi_cdesc_to_dtype(const CFI_cdesc_t *desc,
+                   DataType &dtype)
+{
+    if(desc == NULL || desc->base_addr == NULL)
+    {
+        CONDUIT_ERROR("Cannot set external Fortran array: "
+                      "array is not allocated or associated.");
+    }
+
+    index_t dtype_id = cfi_type_to_dtype_id(desc->type, desc->elem_len);
+    index_t elem_bytes = (index_t) desc->elem_len;
+
+    // scalars have rank 0
+    index_t num_elements = 1;
+    index_t stride = elem_bytes;
+    bool    stride_set = false;
+
+    for(CFI_rank_t r = 0; r < desc->rank; r++)
+    {
+        index_t extent = (index_t) desc->dim[r].extent;
+        index_t sm     = (index_t) desc->dim[r].sm;
+
+        if(extent == 0)
+        {
+            num_elements = 0;
+            break;
+        }
+
+        // dims with a single element don't change the layout
+        if(extent == 1)
+        {
+            continue;
+        }
+
+        if(sm <= 0)
+        {
+            CONDUIT_ERROR("Cannot set external Fortran array: "
+                          "arrays with negative strides are not supported.");
+        }
+
+        if(!stride_set)
+        {
+            stride = sm;
+            stride_set = true;
+        }
+        else if(sm != stride * num_elements)
+        {
+            CONDUIT_ERROR("Cannot set external Fortran array: "
+                          "dimension " << (r + 1) << " stride ("
+                          << sm << " bytes) does not follow the layout of "
+                          "the previous dimensions (expected "
+                          << stride * num_elements << " bytes). Publish "
+                          "sections of this array separately.");
+        }
+
+        num_elements *= extent;
+    }
+
+    dtype.set(dtype_id,
+              num_elements,
+              0,
+              stride,
+              elem_bytes,
+              Endianness::DEFAULT_ID);
+
+    return desc->base_addr;
+}
+
+//---------------------------------------------------------------------------//
+// an array recorded in an external batch, the path is parsed once and
+// its cached child indices make repeated publishes O(depth)
+//---------------------------------------------------------------------------//
+struct ExternalBatchEntry
+{
+    Path      path;
+    DataType  dtype;
+    void     *data;
+};
+
+//---------------------------------------------------------------------------//
+typedef std::vector<ExternalBatchEntry> ExternalBatch;
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+using namespace conduit;
+
+extern "C" {
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_set_external_cdesc(conduit_node *cnode,
+                                const CFI_cdesc_t *desc)
+{
+    DataType dtype;
+    void *data = detail::cfi_cdesc_to_dtype(desc,dtype);
+    cpp_node(cnode)->set_external(dtype,data);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_node_set_path_external_cdesc(conduit_node *cnode,
+                                     const char *path,
+                                     const CFI_cdesc_t *desc)
+{
+    DataType dtype;
+    void *data = detail::cfi_cdesc_to_dtype(desc,dtype);
+    cpp_node(cnode)->fetch(path).set_external(dtype,data);
+}
+
+//-----------------------------------------------------------------------------
+void *
+conduit_external_batch_create()
+{
+    return new detail::ExternalBatch();
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_external_batch_destroy(void *cbatch)
+{
+    delete static_cast<detail::ExternalBatch*>(cbatch);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_external_batch_add(void *cbatch,
+                           const char *path,
+                           const CFI_cdesc_t *desc)
+{
+    detail::ExternalBatch &batch = *static_cast<detail::ExternalBatch*>(cbatch);
+    batch.push_back(detail::ExternalBatchEntry());
+    detail::ExternalBatchEntry &entry = batch.back();
+    entry.path.set(path);
+    entry.data = detail::cfi_cdesc_to_dtype(desc,entry.dtype);
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_external_batch_clear(void *cbatch)
+{
+    static_cast<detail::ExternalBatch*>(cbatch)->clear();
+}
+
+//-----------------------------------------------------------------------------
+conduit_index_t
+conduit_external_batch_size(void *cbatch)
+{
+    return (conduit_index_t) static_cast<detail::ExternalBatch*>(cbatch)->size();
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_external_batch_publish(void *cbatch,
+                               conduit_node *cnode)
+{
+    detail::ExternalBatch &batch = *static_cast<detail::ExternalBatch*>(cbatch);
+    Node &node = cpp_node_ref(cnode);
+    for(size_t i = 0; i < batch.size(); i++)
+    {
+        detail::ExternalBatchEntry &entry = batch[i];
+        node.fetch(entry.path).set_external(entry.dtype,entry.data);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end extern C --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,150 @@
+!* Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+!* Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+!* other details. No copyright assignment is required to contribute to Conduit.
+
+!------------------------------------------------------------------------------
+! conduit_fortran_cdesc.f
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+!
+! set_external methods that take Fortran arrays of any rank as assumed-rank
+! (type(*), dimension(..)) arguments. The compiler passes them as C
+! descriptors (CFI_cdesc_t), so array sections are described with their
+! strides instead of being copied into contiguous temporaries.
+!
+! Supported types are integer(1,2,4,8) and real(4,8). Arrays with rank > 1
+! must have nesting dimensions (contiguous arrays, or sections that are
+! strided only in their first dimension). Negative strides are not
+! supported.
+!
+! As with the other set_external methods, the node refers to the array's
+! memory: the array (which should have the target attribute) must outlive
+! the node's use of it.
+!
+! External batches record a list of (path, array) pairs once, and then
+! publish all of them into a node, for example once per cycle. Paths are
+! parsed when they are added, not on each publish.
+!
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+module conduit_cdesc
+!------------------------------------------------------------------------------
+    use, intrinsic :: iso_c_binding, only : C_PTR
+    implicit none
+
+    !--------------------------------------------------------------------------
+    interface
+    !--------------------------------------------------------------------------
+
+    !--------------------------------------------------------------------------
+    subroutine conduit_node_set_external_array(cnode, data) &
+                   bind(C, name="conduit_node_set_external_cdesc")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cnode
+        type(*), dimension(..), target, intent(IN) :: data
+    end subroutine conduit_node_set_external_array
+
+    !--------------------------------------------------------------------------
+    subroutine c_conduit_node_set_path_external_array(cnode, path, data) &
+                   bind(C, name="conduit_node_set_path_external_cdesc")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cnode
+        character(kind=C_CHAR), intent(IN) :: path(*)
+        type(*), dimension(..), target, intent(IN) :: data
+    end subroutine c_conduit_node_set_path_external_array
+
+    !--------------------------------------------------------------------------
+    ! external batches
+    !--------------------------------------------------------------------------
+
+    !--------------------------------------------------------------------------
+    function conduit_external_batch_create() result(cbatch) &
+             bind(C, name="conduit_external_batch_create")
+        use iso_c_binding
+        implicit none
+        type(C_PTR) :: cbatch
+    end function conduit_external_batch_create
+
+    !--------------------------------------------------------------------------
+    subroutine conduit_external_batch_destroy(cbatch) &
+                   bind(C, name="conduit_external_batch_destroy")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cbatch
+    end subroutine conduit_external_batch_destroy
+
+    !--------------------------------------------------------------------------
+    subroutine c_conduit_external_batch_add(cbatch, path, data) &
+                   bind(C, name="conduit_external_batch_add")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cbatch
+        character(kind=C_CHAR), intent(IN) :: path(*)
+        type(*), dimension(..), target, intent(IN) :: data
+    end subroutine c_conduit_external_batch_add
+
+    !--------------------------------------------------------------------------
+    subroutine conduit_external_batch_clear(cbatch) &
+                   bind(C, name="conduit_external_batch_clear")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cbatch
+    end subroutine conduit_external_batch_clear
+
+    !--------------------------------------------------------------------------
+    pure function conduit_external_batch_size(cbatch) result(res) &
+             bind(C, name="conduit_external_batch_size")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cbatch
+        integer(C_SIZE_T) :: res
+    end function conduit_external_batch_size
+
+    !--------------------------------------------------------------------------
+    subroutine conduit_external_batch_publish(cbatch, cnode) &
+                   bind(C, name="conduit_external_batch_publish")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cbatch
+        type(C_PTR), value, intent(IN) :: cnode
+    end subroutine conduit_external_batch_publish
+
+    !--------------------------------------------------------------------------
+    end interface
+    !--------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+!
+contains
+!
+!------------------------------------------------------------------------------
+
+    !--------------------------------------------------------------------------
+    subroutine conduit_node_set_path_external_array(cnode, path, data)
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cnode
+        character(*), intent(IN) :: path
+        type(*), dimension(..), target, intent(IN) :: data
+        !---
+        call c_conduit_node_set_path_external_array(cnode, trim(path) // C_NULL_CHAR, data)
+    end subroutine conduit_node_set_path_external_array
+
+    !--------------------------------------------------------------------------
+    subroutine conduit_external_batch_add(cbatch, path, data)
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) :: cbatch
+        character(*), intent(IN) :: path
+        type(*), dimension(..), target, intent(IN) :: data
+        !---
+        call c_conduit_external_batch_add(cbatch, trim(path) // C_NULL_CHAR, data)
+    end subroutine conduit_external_batch_add
+
+!------------------------------------------------------------------------------
+end module conduit_cdesc
+!------------------------------------------------------------------------------
@@ -51,6 +51,7 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <iostream>
+#include <map>
 #include <vector>
 
 //---------------------------------------------------------------------------//
@@ -4979,6 +4980,421 @@ PyConduit_Fill_DataArray_From_PyArray(DataArray<T> &conduit_array,
     NpyIter_Deallocate(iter);
 }
 
+//---------------------------------------------------------------------------//
+// begin Node ownership and buffer protocol helpers
+//---------------------------------------------------------------------------//
+
+// Trees created from python are owned by the python Node that wraps their
+// root. Wrappers of child nodes don't own anything, so objects that need to
+// keep a tree alive (numpy arrays from value(), exported buffers) reference
+// the owning root wrapper instead.
+//
+// Buffers consumed by set_external are held (with PyObject_GetBuffer) until
+// the owning root wrapper is destroyed, or the same node is set_external
+// again. If a tree isn't owned by python (python_detach, or trees that
+// come from C++) held buffers are never released.
+
+//---------------------------------------------------------------------------//
+// root node -> python wrapper that owns it
+static std::map<const Node*, PyObject*> &
+PyConduit_Node_Owners()
+{
+    static std::map<const Node*, PyObject*> owners;
+    return owners;
+}
+
+//---------------------------------------------------------------------------//
+// root node -> (target node -> held buffer)
+typedef std::map<const Node*, Py_buffer*> PyConduit_Node_Buffer_Map;
+
+static std::map<const Node*, PyConduit_Node_Buffer_Map> &
+PyConduit_Node_Held_Buffers()
+{
+    static std::map<const Node*, PyConduit_Node_Buffer_Map> buffers;
+    return buffers;
+}
+
+//---------------------------------------------------------------------------//
+static const Node *
+PyConduit_Node_Root(const Node *node)
+{
+    while(node->parent() != NULL)
+    {
+        node = node->parent();
+    }
+    return node;
+}
+
+//---------------------------------------------------------------------------//
+// returns a borrowed reference to the python owner of node's tree, or NULL
+static PyObject *
+PyConduit_Node_Find_Owner(const Node *node)
+{
+    std::map<const Node*, PyObject*> &owners = PyConduit_Node_Owners();
+    std::map<const Node*, PyObject*>::iterator itr;
+    itr = owners.find(PyConduit_Node_Root(node));
+    if(itr == owners.end())
+    {
+        return NULL;
+    }
+    return itr->second;
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_Register_Owner(PyConduit_Node *self)
+{
+    if(self->python_owns && self->node != NULL)
+    {
+        PyConduit_Node_Owners()[self->node] = (PyObject*)self;
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_Unregister_Owner(PyConduit_Node *self)
+{
+    std::map<const Node*, PyObject*> &owners = PyConduit_Node_Owners();
+    std::map<const Node*, PyObject*>::iterator itr = owners.find(self->node);
+    if(itr != owners.end() && itr->second == (PyObject*)self)
+    {
+        owners.erase(itr);
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_Release_Held_Buffer(Py_buffer *view)
+{
+    PyBuffer_Release(view);
+    delete view;
+}
+
+//---------------------------------------------------------------------------//
+// releases all buffers held for the tree rooted at root
+static void
+PyConduit_Node_Release_Held_Buffers(const Node *root)
+{
+    std::map<const Node*, PyConduit_Node_Buffer_Map> &buffers =
+        PyConduit_Node_Held_Buffers();
+    std::map<const Node*, PyConduit_Node_Buffer_Map>::iterator itr;
+    itr = buffers.find(root);
+    if(itr == buffers.end())
+    {
+        return;
+    }
+
+    // move out first, releasing may run arbitrary python code
+    PyConduit_Node_Buffer_Map held;
+    held.swap(itr->second);
+    buffers.erase(itr);
+
+    PyConduit_Node_Buffer_Map::iterator bitr;
+    for(bitr = held.begin(); bitr != held.end(); ++bitr)
+    {
+        PyConduit_Node_Release_Held_Buffer(bitr->second);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// takes ownership of view, replaces any buffer held for node
+static void
+PyConduit_Node_Hold_Buffer(const Node *node,
+                           Py_buffer *view)
+{
+    PyConduit_Node_Buffer_Map &held =
+        PyConduit_Node_Held_Buffers()[PyConduit_Node_Root(node)];
+    Py_buffer *prev = NULL;
+    PyConduit_Node_Buffer_Map::iterator itr = held.find(node);
+    if(itr != held.end())
+    {
+        prev = itr->second;
+    }
+    held[node] = view;
+
+    if(prev != NULL)
+    {
+        PyConduit_Node_Release_Held_Buffer(prev);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// PEP 3118 format string for a leaf dtype, NULL if not supported.
+// Uses native sizes, with an explicit byte order when it differs from
+// the machine's.
+static const char *
+PyConduit_DataType_To_Buffer_Format(const DataType &dtype)
+{
+    bool swap = !dtype.endianness_matches_machine();
+    bool little = !Endianness::machine_is_little_endian();
+
+    switch(dtype.id())
+    {
+        case DataType::INT8_ID:    return "b";
+        case DataType::UINT8_ID:   return "B";
+        case DataType::INT16_ID:   return !swap ? "h" : (little ? "<h" : ">h");
+        case DataType::INT32_ID:   return !swap ? "i" : (little ? "<i" : ">i");
+        case DataType::INT64_ID:   return !swap ? "q" : (little ? "<q" : ">q");
+        case DataType::UINT16_ID:  return !swap ? "H" : (little ? "<H" : ">H");
+        case DataType::UINT32_ID:  return !swap ? "I" : (little ? "<I" : ">I");
+        case DataType::UINT64_ID:  return !swap ? "Q" : (little ? "<Q" : ">Q");
+        case DataType::FLOAT32_ID: return !swap ? "f" : (little ? "<f" : ">f");
+        case DataType::FLOAT64_ID: return !swap ? "d" : (little ? "<d" : ">d");
+        case DataType::CHAR8_STR_ID: return "c";
+        default: return NULL;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// maps a PEP 3118 single element format to a DataType id.
+// returns DataType::EMPTY_ID if the format isn't supported.
+static index_t
+PyConduit_Buffer_Format_To_DataType_Id(const char *format,
+                                       Py_ssize_t itemsize,
+                                       index_t &endianness)
+{
+    endianness = Endianness::DEFAULT_ID;
+
+    // NULL means unsigned bytes
+    if(format == NULL)
+    {
+        format = "B";
+    }
+
+    if(format[0] == '@' || format[0] == '=')
+    {
+        format++;
+    }
+    else if(format[0] == '<')
+    {
+        endianness = Endianness::LITTLE_ID;
+        format++;
+    }
+    else if(format[0] == '>' || format[0] == '!')
+    {
+        endianness = Endianness::BIG_ID;
+        format++;
+    }
+
+    // only single elements are supported
+    if(format[0] == 0 || format[1] != 0)
+    {
+        return DataType::EMPTY_ID;
+    }
+
+    switch(format[0])
+    {
+        case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+        {
+            if(itemsize == 1) return DataType::INT8_ID;
+            if(itemsize == 2) return DataType::INT16_ID;
+            if(itemsize == 4) return DataType::INT32_ID;
+            if(itemsize == 8) return DataType::INT64_ID;
+            break;
+        }
+        case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+        {
+            if(itemsize == 1) return DataType::UINT8_ID;
+            if(itemsize == 2) return DataType::UINT16_ID;
+            if(itemsize == 4) return DataType::UINT32_ID;
+            if(itemsize == 8) return DataType::UINT64_ID;
+            break;
+        }
+        case 'c':
+        {
+            if(itemsize == 1) return DataType::UINT8_ID;
+            break;
+        }
+        case 'f': case 'd':
+        {
+            if(itemsize == 4) return DataType::FLOAT32_ID;
+            if(itemsize == 8) return DataType::FLOAT64_ID;
+            break;
+        }
+        default:
+            break;
+    }
+
+    return DataType::EMPTY_ID;
+}
+
+//---------------------------------------------------------------------------//
+// sets node to externally describe the data of a buffer protocol object,
+// and holds the buffer. Returns -1 and sets a python error on failure.
+static int
+PyConduit_Node_Set_External_From_Buffer(Node &node,
+                                        PyObject *py_obj)
+{
+    Py_buffer *view = new Py_buffer;
+    if(PyObject_GetBuffer(py_obj, view, PyBUF_RECORDS_RO) != 0)
+    {
+        delete view;
+        return -1;
+    }
+
+    std::string err_msg;
+    index_t endianness = Endianness::DEFAULT_ID;
+    index_t dtype_id = PyConduit_Buffer_Format_To_DataType_Id(view->format,
+                                                              view->itemsize,
+                                                              endianness);
+    index_t num_ele = 1;
+    index_t stride  = (index_t)view->itemsize;
+
+    if(view->readonly)
+    {
+        err_msg = "set_external requires a writable buffer,"
+                  " use set to copy read-only data";
+    }
+    else if(dtype_id == DataType::EMPTY_ID)
+    {
+        err_msg = std::string("set_external does not support buffer format: ")
+                  + (view->format != NULL ? view->format : "B");
+    }
+    else if(view->ndim == 1)
+    {
+        num_ele = (index_t)view->shape[0];
+        if(view->strides != NULL)
+        {
+            stride = (index_t)view->strides[0];
+        }
+    }
+    else if(view->ndim > 1)
+    {
+        num_ele = (index_t)(view->len / view->itemsize);
+
+        if(!PyBuffer_IsContiguous(view,'A'))
+        {
+            // allow views that are effectively 1D-strided
+            int num_strided_dims = 0;
+            for(int d = 0; d < view->ndim; d++)
+            {
+                if(view->shape[d] > 1)
+                {
+                    stride = (index_t)view->strides[d];
+                    num_strided_dims++;
+                }
+            }
+
+            if(num_strided_dims > 1)
+            {
+                err_msg = "set_external does not handle multidimensional"
+                          " complex strided views. Contiguous arrays and"
+                          " views that are effectively 1D-strided are"
+                          " supported.";
+            }
+        }
+    }
+
+    if(err_msg.empty() && stride < 0)
+    {
+        err_msg = "set_external does not support negative strides";
+    }
+
+    if(!err_msg.empty())
+    {
+        PyBuffer_Release(view);
+        delete view;
+        PyErr_SetString(PyExc_TypeError, err_msg.c_str());
+        return -1;
+    }
+
+    node.set_external(DataType(dtype_id,
+                               num_ele,
+                               0,
+                               stride,
+                               (index_t)view->itemsize,
+                               endianness),
+                      view->buf);
+
+    PyConduit_Node_Hold_Buffer(&node, view);
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+// PEP 3118 export of leaf data
+static int
+PyConduit_Node_getbuffer(PyConduit_Node *self,
+                         Py_buffer *view,
+                         int flags)
+{
+    view->obj = NULL;
+
+    Node &node = *self->node;
+    const DataType &dtype = node.dtype();
+    const char *format = PyConduit_DataType_To_Buffer_Format(dtype);
+
+    if(format == NULL)
+    {
+        PyErr_SetString(PyExc_BufferError,
+                        "Node buffer export requires a numeric or string leaf");
+        return -1;
+    }
+
+    index_t num_ele = dtype.number_of_elements();
+    bool compact = num_ele < 2 || dtype.stride() == dtype.element_bytes();
+
+    // consumers that don't accept strides, or ask for contiguous data
+    bool needs_contiguous = (flags & PyBUF_STRIDES) != PyBUF_STRIDES ||
+                            (flags & (PyBUF_C_CONTIGUOUS |
+                                      PyBUF_F_CONTIGUOUS |
+                                      PyBUF_ANY_CONTIGUOUS) & ~PyBUF_STRIDES);
+    if(!compact && needs_contiguous)
+    {
+        PyErr_SetString(PyExc_BufferError,
+                        "Node data is strided, consumer requires contiguous data");
+        return -1;
+    }
+
+    // shape and strides live with the view
+    Py_ssize_t *shape_strides = new Py_ssize_t[2];
+    shape_strides[0] = (Py_ssize_t)num_ele;
+    shape_strides[1] = (Py_ssize_t)dtype.stride();
+
+    PyObject *owner = PyConduit_Node_Find_Owner(&node);
+    if(owner == NULL)
+    {
+        owner = (PyObject*)self;
+    }
+    Py_INCREF(owner);
+
+    view->obj        = owner;
+    view->buf        = node.element_ptr(0);
+    view->len        = (Py_ssize_t)(num_ele * dtype.element_bytes());
+    view->readonly   = 0;
+    view->itemsize   = (Py_ssize_t)dtype.element_bytes();
+    view->format     = (flags & PyBUF_FORMAT) ? const_cast<char*>(format) : NULL;
+    view->ndim       = 1;
+    view->shape      = (flags & PyBUF_ND) == PyBUF_ND ? &shape_strides[0] : NULL;
+    view->strides    = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &shape_strides[1] : NULL;
+    view->suboffsets = NULL;
+    view->internal   = shape_strides;
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_releasebuffer(PyConduit_Node * /*self*/,
+                             Py_buffer *view)
+{
+    delete [] (Py_ssize_t*)view->internal;
+}
+
+//---------------------------------------------------------------------------//
+static PyBufferProcs PyConduit_Node_as_buffer = {
+#if !defined(IS_PY3K)
+    0, /* bf_getreadbuffer */
+    0, /* bf_getwritebuffer */
+    0, /* bf_getsegcount */
+    0, /* bf_getcharbuffer */
+#endif
+    (getbufferproc)PyConduit_Node_getbuffer,         /* bf_getbuffer */
+    (releasebufferproc)PyConduit_Node_releasebuffer, /* bf_releasebuffer */
+};
+
+//---------------------------------------------------------------------------//
+// end Node ownership and buffer protocol helpers
+//---------------------------------------------------------------------------//
+
 //---------------------------------------------------------------------------//
 // begin Node python special methods
 //---------------------------------------------------------------------------//
@@ -5030,6 +5446,7 @@ PyConduit_Node_init(PyConduit_Node* self,
     
     self->node = new Node();
     self->python_owns = 1;
+    PyConduit_Node_Register_Owner(self);
 
     if (value)
     {
@@ -5047,6 +5464,8 @@ PyConduit_Node_dealloc(PyConduit_Node* self)
 {
     if(self->python_owns)
     {
+       PyConduit_Node_Unregister_Owner(self);
+       PyConduit_Node_Release_Held_Buffers(self->node);
        delete self->node;
     }
 
@@ -5123,6 +5542,8 @@ PyConduit_Node_python_owns(PyConduit_Node *self)
 static PyObject *
 PyConduit_Node_python_detach(PyConduit_Node *self)
 {
+    // held buffers stay alive, since the tree may still reference them
+    PyConduit_Node_Unregister_Owner(self);
     self->python_owns = 0;
     Py_RETURN_NONE;
 }
@@ -5132,6 +5553,7 @@ static PyObject *
 PyConduit_Node_python_attach(PyConduit_Node *self)
 {
     self->python_owns = 1;
+    PyConduit_Node_Register_Owner(self);
     Py_RETURN_NONE;
 }
 
@@ -5277,6 +5699,7 @@ PyConduit_Node_save(PyConduit_Node *self,
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         self->node->save(path_str,protocol_str);
     }
     catch(conduit::Error &e)
@@ -5336,6 +5759,7 @@ PyConduit_Node_load(PyConduit_Node *self,
 
         try
         {
+            PyConduit_Allow_Threads allow_threads;
             self->node->load(path_str,
                              *schema_ptr);
         }
@@ -5358,6 +5782,7 @@ PyConduit_Node_load(PyConduit_Node *self,
 
         try
         {
+            PyConduit_Allow_Threads allow_threads;
             self->node->load(path_str,
                              protocol_str);
         }
@@ -6145,10 +6570,14 @@ PyConduit_Node_set(PyConduit_Node* self,
         Schema &schema = *((PyConduit_Schema*)py_value)->schema;
 
         Py_buffer buff_view;
-        PyObject_GetBuffer(py_buff, &buff_view, PyBUF_WRITE);
+        if(PyObject_GetBuffer(py_buff, &buff_view, PyBUF_WRITE) != 0)
+        {
+            return NULL;
+        }
         unsigned char *ptr = reinterpret_cast<unsigned char*>(buff_view.buf);
 
         self->node->set(schema,ptr);
+        PyBuffer_Release(&buff_view);
         Py_RETURN_NONE;
     }
     
@@ -6174,10 +6603,10 @@ PyConduit_Node_set_external(PyConduit_Node* self,
     if( !PyArg_ParseTuple(args, "O|O", &py_value, &py_buff) ||
         ( !PyConduit_Node_Check(py_value) && // not a node
           !PyConduit_Schema_Check(py_value) && // not a schema
-          !PyArray_Check(py_value) ) ) // not a numpy array
+          !PyObject_CheckBuffer(py_value) ) ) // not a numpy array or buffer
     {
         PyErr_SetString(PyExc_TypeError,
-        "set_external requires a numpy array, conduit Node, or conduit Schema and Buffer");
+        "set_external requires a numpy array or buffer, conduit Node, or conduit Schema and Buffer");
         return NULL;
     }
 
@@ -6193,11 +6622,17 @@ PyConduit_Node_set_external(PyConduit_Node* self,
 
         Schema &schema = *((PyConduit_Schema*)py_value)->schema;
 
-        Py_buffer buff_view;
-        PyObject_GetBuffer(py_buff, &buff_view, PyBUF_WRITE);
-        unsigned char *ptr = reinterpret_cast<unsigned char*>(buff_view.buf);
+        Py_buffer *buff_view = new Py_buffer;
+        if(PyObject_GetBuffer(py_buff, buff_view, PyBUF_WRITE) != 0)
+        {
+            delete buff_view;
+            return NULL;
+        }
+        unsigned char *ptr = reinterpret_cast<unsigned char*>(buff_view->buf);
 
         self->node->set_external(schema,ptr);
+        // keep the buffer alive while the tree references it
+        PyConduit_Node_Hold_Buffer(self->node, buff_view);
         Py_RETURN_NONE;
     }
 
@@ -6209,100 +6644,255 @@ PyConduit_Node_set_external(PyConduit_Node* self,
         Py_RETURN_NONE;
     }
     
-    // buffer cases (scheam)
-
-    // numpy array case
-    PyArray_Descr *desc = PyArray_DESCR((PyArrayObject*)py_value);
-    PyArrayObject *py_arr = (PyArrayObject*)py_value;
-    npy_intp num_ele = PyArray_SIZE(py_arr);
-    index_t offset = 0;
-    index_t stride = (index_t) PyArray_STRIDE(py_arr, 0);
-    int nd = PyArray_NDIM(py_arr);
-
-    if (nd > 1)
+    // numpy array and buffer protocol cases, the buffer is held so
+    // its owner stays alive while the tree references it
+    if(PyConduit_Node_Set_External_From_Buffer(*self->node, py_value) != 0)
     {
-        PyErr_SetString(PyExc_TypeError,
-                        "set_external does not handle multidimensional numpy"
-                        " arrays or multidimensional complex strided views"
-                        " into numpy arrays."
-                        " Views that are effectively 1D-strided are"
-                        "supported.");
-        return (NULL);
+        return NULL;
     }
 
-    Node& node = *self->node;
+    Py_RETURN_NONE;
+
+}
 
-    switch (desc->type_num) 
+//---------------------------------------------------------------------------//
+// fills node from a (possibly nested) python dict in one pass.
+// numpy leaves are described externally when external is true, all
+// other values are copied. Returns -1 and sets a python error on failure.
+static int
+PyConduit_Node_Set_From_Python_Dict(Node &node,
+                                    PyObject *py_dict,
+                                    bool external)
+{
+    PyObject *py_key   = NULL;
+    PyObject *py_value = NULL;
+    Py_ssize_t pos = 0;
+
+    while(PyDict_Next(py_dict, &pos, &py_key, &py_value))
     {
-        case NPY_UINT8 :
+        if(!PyString_Check(py_key))
         {
-            uint8 *numpy_data = (uint8*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            PyErr_SetString(PyExc_TypeError,
+                            "set_from_dict requires string keys");
+            return -1;
         }
-        case NPY_UINT16 :
+
+        char *key_cstr = PyString_AsString(py_key);
+        if(key_cstr == NULL)
         {
-            uint16 *numpy_data = (uint16*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            PyErr_SetString(PyExc_TypeError,
+                            "set_from_dict could not convert key to string");
+            return -1;
         }
-        case NPY_UINT32 :
+        // keys are child names, they are not parsed as paths
+        Node &cld = node.add_child(std::string(key_cstr));
+        PyString_AsString_Cleanup(key_cstr);
+
+        int res = 0;
+        if(PyDict_Check(py_value))
         {
-            uint32 *numpy_data = (uint32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            cld.reset();
+            res = PyConduit_Node_Set_From_Python_Dict(cld, py_value, external);
         }
-        case NPY_UINT64 :
+        else if(py_value == Py_None)
         {
-            uint64 *numpy_data = (uint64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            cld.reset();
         }
-        case NPY_INT8 :
+        else if(external &&
+                PyArray_Check(py_value) &&
+                PyArray_ISWRITEABLE((PyArrayObject*)py_value))
         {
-            int8 *numpy_data = (int8*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            res = PyConduit_Node_Set_External_From_Buffer(cld, py_value);
         }
-        case NPY_INT16 :
+        else
         {
-            int16 *numpy_data = (int16*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            res = PyConduit_Node_Set_From_Python(cld, py_value);
         }
-        case NPY_INT32 :
+
+        if(res != 0)
         {
-            int32 *numpy_data = (int32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            return -1;
         }
-        case NPY_INT64 :
+    }
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_set_from_dict(PyConduit_Node* self,
+                             PyObject* args,
+                             PyObject* kwargs)
+{
+    PyObject *py_dict     = NULL;
+    PyObject *py_external = NULL;
+
+    static const char *kwlist[] = {"dict",
+                                   "external",
+                                   NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwargs,
+                                     "O|O",
+                                     const_cast<char**>(kwlist),
+                                     &py_dict,
+                                     &py_external))
+    {
+        return (NULL);
+    }
+
+    if(!PyDict_Check(py_dict))
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "set_from_dict requires a dict");
+        return (NULL);
+    }
+
+    bool external = true;
+    if(py_external != NULL)
+    {
+        int is_true = PyObject_IsTrue(py_external);
+        if(is_true < 0)
         {
-            int64 *numpy_data = (int64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            return (NULL);
         }
-        case NPY_FLOAT32 :
+        external = (is_true != 0);
+    }
+
+    Node &node = *self->node;
+    node.reset();
+
+    if(PyConduit_Node_Set_From_Python_Dict(node, py_dict, external) != 0)
+    {
+        return (NULL);
+    }
+
+    Py_RETURN_NONE;
+}
+
+//---------------------------------------------------------------------------//
+// converts node's tree to nested python dicts (objects) and lists (lists).
+// leaves are converted as in value(), numpy arrays are copied unless views
+// is true. Empty nodes become None.
+static PyObject *
+PyConduit_Node_Convert_To_Python_Dict(Node &node,
+                                      bool views)
+{
+    index_t dtype_id = node.dtype().id();
+    index_t num_children = node.number_of_children();
+
+    if(dtype_id == DataType::OBJECT_ID)
+    {
+        PyObject *py_dict = PyDict_New();
+        if(py_dict == NULL)
         {
-            float32 *numpy_data = (float32*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            return NULL;
         }
-        case NPY_FLOAT64 :
+
+        for(index_t i = 0; i < num_children; i++)
         {
-            float64 *numpy_data = (float64*)PyArray_BYTES(py_arr);
-            node.set_external(numpy_data, num_ele, offset, stride);
-            break;
+            Node &cld = node.child(i);
+            PyObject *py_cld = PyConduit_Node_Convert_To_Python_Dict(cld,
+                                                                     views);
+            if(py_cld == NULL ||
+               PyDict_SetItemString(py_dict, cld.name().c_str(), py_cld) != 0)
+            {
+                Py_XDECREF(py_cld);
+                Py_DECREF(py_dict);
+                return NULL;
+            }
+            Py_DECREF(py_cld);
+        }
+        return py_dict;
+    }
+    else if(dtype_id == DataType::LIST_ID)
+    {
+        PyObject *py_list = PyList_New((Py_ssize_t)num_children);
+        if(py_list == NULL)
+        {
+            return NULL;
         }
-        default :
+
+        for(index_t i = 0; i < num_children; i++)
+        {
+            PyObject *py_cld = PyConduit_Node_Convert_To_Python_Dict(
+                                                        node.child(i),
+                                                        views);
+            if(py_cld == NULL)
+            {
+                Py_DECREF(py_list);
+                return NULL;
+            }
+            // steals the reference
+            PyList_SET_ITEM(py_list, (Py_ssize_t)i, py_cld);
+        }
+        return py_list;
+    }
+    else if(dtype_id == DataType::EMPTY_ID)
+    {
+        Py_RETURN_NONE;
+    }
+
+    PyObject *retval = PyConduit_Convert_Node_To_Python(node);
+
+    if(retval != NULL && !views && PyArray_Check(retval))
+    {
+        PyObject *py_copy = PyArray_NewCopy((PyArrayObject*)retval,
+                                            NPY_ANYORDER);
+        Py_DECREF(retval);
+        retval = py_copy;
+    }
+
+    return retval;
+}
+
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_to_dict(PyConduit_Node* self,
+                       PyObject* args,
+                       PyObject* kwargs)
+{
+    PyObject *py_views = NULL;
+
+    static const char *kwlist[] = {"views",
+                                   NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwargs,
+                                     "|O",
+                                     const_cast<char**>(kwlist),
+                                     &py_views))
+    {
+        return (NULL);
+    }
+
+    bool views = true;
+    if(py_views != NULL)
+    {
+        int is_true = PyObject_IsTrue(py_views);
+        if(is_true < 0)
         {
-            PyErr_SetString(PyExc_TypeError, "Unsupported type");
             return (NULL);
         }
+        views = (is_true != 0);
     }
 
-    Py_RETURN_NONE;
+    Node &node = *self->node;
+    index_t dtype_id = node.dtype().id();
 
+    if(dtype_id == DataType::EMPTY_ID)
+    {
+        return PyDict_New();
+    }
+
+    if(dtype_id != DataType::OBJECT_ID)
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "to_dict requires an object or empty Node");
+        return (NULL);
+    }
+
+    return PyConduit_Node_Convert_To_Python_Dict(node, views);
 }
 
 //---------------------------------------------------------------------------//
@@ -6359,7 +6949,10 @@ PyConduit_Node_compact_to(PyConduit_Node* self,
     
     Node &n_dest = *PyConduit_Node_Get_Node_Ptr(py_node);
     
-    self->node->compact_to(n_dest);
+    {
+        PyConduit_Allow_Threads allow_threads;
+        self->node->compact_to(n_dest);
+    }
     Py_RETURN_NONE;
 }
 
@@ -6393,7 +6986,10 @@ PyConduit_Node_update(PyConduit_Node* self,
     
     Node &n_other = *PyConduit_Node_Get_Node_Ptr(py_node);
     
-    self->node->update(n_other);
+    {
+        PyConduit_Allow_Threads allow_threads;
+        self->node->update(n_other);
+    }
     Py_RETURN_NONE;
 }
 
@@ -6427,7 +7023,10 @@ PyConduit_Node_update_compatible(PyConduit_Node* self,
     
     Node &n_other = *PyConduit_Node_Get_Node_Ptr(py_node);
     
-    self->node->update_compatible(n_other);
+    {
+        PyConduit_Allow_Threads allow_threads;
+        self->node->update_compatible(n_other);
+    }
     Py_RETURN_NONE;
 }
 
@@ -6650,6 +7249,7 @@ PyConduit_Node_to_json(PyConduit_Node* self,
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         self->node->to_json_stream(oss,
                                    protocol,
                                    indent,
@@ -6725,6 +7325,7 @@ PyConduit_Node_to_yaml(PyConduit_Node* self,
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         self->node->to_yaml_stream(oss,
                                    protocol,
                                    indent,
@@ -6828,6 +7429,22 @@ static PyMethodDef PyConduit_Node_METHODS[] = {
      METH_VARARGS,
      "Sets the node's data to an external numpy array"},
     //-----------------------------------------------------------------------//
+    {"set_from_dict",
+     (PyCFunction)PyConduit_Node_set_from_dict,
+     METH_VARARGS | METH_KEYWORDS,
+     "Replaces the node's contents with a (nested) dict in one call. "
+     "When external is True (default) numpy leaves are described "
+     "externally (zero-copy), other values are copied. "
+     "Keys are used as child names and are not parsed as paths."},
+    //-----------------------------------------------------------------------//
+    {"to_dict",
+     (PyCFunction)PyConduit_Node_to_dict,
+     METH_VARARGS | METH_KEYWORDS,
+     "Converts the node's tree to nested dicts in one call. "
+     "When views is True (default) numpy leaves view the node's data, "
+     "otherwise they are copies. Lists become python lists and empty "
+     "nodes become None."},
+    //-----------------------------------------------------------------------//
     {"compact_to",
      (PyCFunction)PyConduit_Node_compact_to,
      METH_VARARGS | METH_KEYWORDS, 
@@ -7108,8 +7725,12 @@ static PyTypeObject PyConduit_Node_TYPE = {
    (reprfunc)PyConduit_Node_str,                         /* str */
    0, /* getattro */
    0, /* setattro */
-   0, /* asbuffer */
+   &PyConduit_Node_as_buffer, /* asbuffer */
+#if defined(IS_PY3K)
    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,     /* flags */
+#else
+   Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_NEWBUFFER,
+#endif
    "Conduit node objects",
    0, /* traverse */
    0, /* clear */
@@ -7215,6 +7836,7 @@ PyConduit_Node_Python_Wrap(Node *node, int python_owns)
     PyConduit_Node* retval = (PyConduit_Node*)type->tp_alloc(type, 0);
     retval->node = node;
     retval->python_owns = python_owns;
+    PyConduit_Node_Register_Owner(retval);
     return ((PyObject*)retval);
 }
 
@@ -7792,6 +8414,14 @@ PyConduit_Create_Numpy_Type(Node& node,
         // This should be OK since we only support 1D arrays currently.
         npy_intp * strides = PyArray_STRIDES((PyArrayObject*)retval);
         strides[0] = (npy_intp)dtype.stride();
+
+        // the array views the node's data, keep the tree alive
+        PyObject *owner = PyConduit_Node_Find_Owner(&node);
+        if(retval != NULL && owner != NULL)
+        {
+            Py_INCREF(owner);
+            PyArray_SetBaseObject((PyArrayObject*)retval, owner);
+        }
     }
     return (retval);
 }
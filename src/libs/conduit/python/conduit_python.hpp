@@ -23,6 +23,33 @@
 //---------------------------------------------------------------------------//
 #include "conduit.hpp"
 
+//---------------------------------------------------------------------------//
+// Releases the GIL for the lifetime of this object, so other python threads
+// can run while a long pure C++ call (io, mpi, copies) is in progress.
+// The GIL is restored when the object goes out of scope, including when
+// the wrapped call throws a conduit::Error.
+//
+// No python API calls are allowed while the GIL is released.
+//---------------------------------------------------------------------------//
+class PyConduit_Allow_Threads
+{
+public:
+    PyConduit_Allow_Threads()
+    : m_thread_state(PyEval_SaveThread())
+    {}
+
+    ~PyConduit_Allow_Threads()
+    {
+        PyEval_RestoreThread(m_thread_state);
+    }
+
+private:
+    PyConduit_Allow_Threads(const PyConduit_Allow_Threads &);
+    PyConduit_Allow_Threads &operator=(const PyConduit_Allow_Threads &);
+
+    PyThreadState *m_thread_state;
+};
+
 //---------------------------------------------------------------------------//
 // These methods are exposed via python capsule at conduit._C_API, 
 // which allows them called in other python C modules.
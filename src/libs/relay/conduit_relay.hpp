@@ -23,6 +23,7 @@
 #include "conduit_relay_io.hpp"
 #include "conduit_relay_io_handle.hpp"
 #include "conduit_relay_io_blueprint.hpp"
+#include "conduit_relay_io_shm.hpp"
 
 #ifdef CONDUIT_RELAY_WEBSERVER_ENABLED
 #include "conduit_relay_web.hpp"
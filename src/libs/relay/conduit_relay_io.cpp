@@ -13,7 +13,10 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <vector>
 
 // Include a helper function for figuring out protocols.
 #include "conduit_relay_io_identify_protocol.hpp"
@@ -31,8 +34,13 @@
 #include "conduit_relay_io_adios.hpp"
 #endif
 
+#ifdef CONDUIT_RELAY_IO_BIN_ZLIB_ENABLED
+#include "conduit_relay_io_bin_zlib.hpp"
+#endif
+
 #include "conduit_relay_io_handle.hpp"
 #include "conduit_relay_io_csv.hpp"
+#include "conduit_relay_io_shm.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -54,6 +62,654 @@ namespace io
 
 
 
+//---------------------------------------------------------------------------//
+// save, load and their merged variants for registered protocols go through
+// the protocol's IOHandle
+//---------------------------------------------------------------------------//
+static void
+registered_protocol_save(const Node &node,
+                         const std::string &path,
+                         const std::string &protocol,
+                         const Node &options,
+                         bool merged)
+{
+    std::string file_path;
+    std::string sub_path;
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    sub_path);
+
+    Node open_opts;
+    open_opts.set(options);
+    // whole file saves replace the file
+    open_opts["mode"] = (!merged && sub_path.empty()) ? "wt" : "rwa";
+
+    IOHandle hnd;
+    hnd.open(file_path, protocol, open_opts);
+    if(sub_path.empty())
+    {
+        hnd.write(node);
+    }
+    else
+    {
+        if(!merged && hnd.has_path(sub_path))
+        {
+            hnd.remove(sub_path);
+        }
+        hnd.write(node, sub_path);
+    }
+    hnd.close();
+}
+
+//---------------------------------------------------------------------------//
+static void
+registered_protocol_load(const std::string &path,
+                         const std::string &protocol,
+                         const Node &options,
+                         Node &node)
+{
+    std::string file_path;
+    std::string sub_path;
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    sub_path);
+
+    Node open_opts;
+    open_opts.set(options);
+    open_opts["mode"] = "r";
+
+    IOHandle hnd;
+    hnd.open(file_path, protocol, open_opts);
+    if(sub_path.empty())
+    {
+        hnd.read(node);
+    }
+    else
+    {
+        hnd.read(sub_path, node);
+    }
+    hnd.close();
+}
+
+//---------------------------------------------------------------------------//
+// merged saves and loads of conduit_bin and conduit_pack files only read
+// the file's schema, then write or read the leaves they touch in place
+//---------------------------------------------------------------------------//
+struct MergedWrite
+{
+    const Node *src;
+    index_t     offset;
+    index_t     stride;
+};
+
+//---------------------------------------------------------------------------//
+static bool
+is_dense(const DataType &dtype)
+{
+    return dtype.stride() == dtype.element_bytes();
+}
+
+//---------------------------------------------------------------------------//
+// plans the merged save of src into the file described by schema, following
+// the rules of Node::update: leaves with the same type and at least as many
+// elements are overwritten in place, other leaves are appended at data_end.
+// returns false if the save changes the file's structure and allow_append
+// is false.
+//---------------------------------------------------------------------------//
+static bool
+plan_merged_write(const Node &src,
+                  Schema &schema,
+                  bool allow_append,
+                  index_t &data_end,
+                  std::vector<MergedWrite> &writes,
+                  bool &schema_changed)
+{
+    index_t dtype_id = src.dtype().id();
+    if(dtype_id == DataType::OBJECT_ID)
+    {
+        NodeConstIterator itr = src.children();
+        while(itr.has_next())
+        {
+            const Node &src_child = itr.next();
+            std::string name = itr.name();
+            if(!schema.dtype().is_object() || !schema.has_child(name))
+            {
+                if(!allow_append)
+                {
+                    return false;
+                }
+                schema_changed = true;
+            }
+            if(!plan_merged_write(src_child,
+                                  schema.add_child(name),
+                                  allow_append,
+                                  data_end,
+                                  writes,
+                                  schema_changed))
+            {
+                return false;
+            }
+        }
+    }
+    else if(dtype_id == DataType::LIST_ID)
+    {
+        index_t src_num_children = src.number_of_children();
+        index_t num_children = schema.dtype().is_list() ?
+                                    schema.number_of_children() : 0;
+        if(num_children < src_num_children && !allow_append)
+        {
+            return false;
+        }
+
+        for(index_t idx = 0; idx < src_num_children; idx++)
+        {
+            if(idx >= num_children)
+            {
+                schema_changed = true;
+            }
+            Schema &child = idx < num_children ? schema.child(idx)
+                                               : schema.append();
+            if(!plan_merged_write(src.child(idx),
+                                  child,
+                                  allow_append,
+                                  data_end,
+                                  writes,
+                                  schema_changed))
+            {
+                return false;
+            }
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        const DataType &src_dtype = src.dtype();
+        const DataType &file_dtype = schema.dtype();
+        if(file_dtype.id() == dtype_id &&
+           file_dtype.number_of_elements() >= src_dtype.number_of_elements())
+        {
+            MergedWrite w = {&src, file_dtype.offset(), file_dtype.stride()};
+            writes.push_back(w);
+        }
+        else
+        {
+            if(!allow_append)
+            {
+                return false;
+            }
+            // new leaves are stored compact, at an 8 byte aligned offset
+            index_t ele_bytes = src_dtype.element_bytes();
+            data_end = (data_end + 7) & ~((index_t)7);
+            schema.set(DataType(dtype_id,
+                                src_dtype.number_of_elements(),
+                                data_end,
+                                ele_bytes,
+                                ele_bytes,
+                                src_dtype.endianness()));
+            MergedWrite w = {&src, data_end, ele_bytes};
+            writes.push_back(w);
+            data_end += src_dtype.number_of_elements() * ele_bytes;
+            schema_changed = true;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+static void
+write_merged(const std::string &path,
+             const std::vector<MergedWrite> &writes)
+{
+    std::fstream ofs;
+    ofs.open(path.c_str(),
+             std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    if(!ofs.is_open())
+    {
+        CONDUIT_ERROR("<relay::io::save_merged> failed to open: " << path);
+    }
+
+    Node n_compact;
+    for(size_t i = 0; i < writes.size(); i++)
+    {
+        const MergedWrite &w = writes[i];
+        const Node &src = *w.src;
+        index_t num_ele   = src.dtype().number_of_elements();
+        index_t ele_bytes = src.dtype().element_bytes();
+        if(num_ele == 0)
+        {
+            continue;
+        }
+
+        const char *src_ptr = NULL;
+        if(is_dense(src.dtype()) && src.allocator() == 0)
+        {
+            src_ptr = (const char*)src.element_ptr(0);
+        }
+        else
+        {
+            n_compact.reset();
+            src.compact_to(n_compact);
+            src_ptr = (const char*)n_compact.data_ptr();
+        }
+
+        if(w.stride == ele_bytes)
+        {
+            ofs.seekp((std::streamoff)w.offset);
+            ofs.write(src_ptr, (std::streamsize)(num_ele * ele_bytes));
+        }
+        else
+        {
+            for(index_t e = 0; e < num_ele; e++)
+            {
+                ofs.seekp((std::streamoff)(w.offset + e * w.stride));
+                ofs.write(src_ptr + e * ele_bytes, (std::streamsize)ele_bytes);
+            }
+        }
+    }
+
+    if(!ofs.good())
+    {
+        CONDUIT_ERROR("<relay::io::save_merged> failed to write: " << path);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// saves node into the existing conduit_bin or conduit_pack file at
+// file_path (under sub_path), writing only the leaves of node.
+// returns false if the file can't be updated in place, in which case
+// nothing was written.
+//---------------------------------------------------------------------------//
+static bool
+save_merged_in_place(const Node &node,
+                     const std::string &file_path,
+                     const std::string &sub_path,
+                     const std::string &protocol)
+{
+    bool is_bin = (protocol == "conduit_bin");
+    std::string schema_path = file_path + "_json";
+    if(!utils::is_file(file_path) ||
+       (is_bin && !utils::is_file(schema_path)) ||
+       (!is_bin && !pack::is_pack_file(file_path)))
+    {
+        return false;
+    }
+
+    Schema schema;
+    if(is_bin)
+    {
+        schema.load(schema_path);
+    }
+    else
+    {
+        pack::load_schema(file_path, schema);
+    }
+
+    // pack files keep their schema in a section ahead of the data, so
+    // only in place writes are possible
+    bool allow_append = is_bin;
+    bool schema_changed = !sub_path.empty() && !schema.has_path(sub_path);
+    if(schema_changed && !allow_append)
+    {
+        return false;
+    }
+    Schema &dest = sub_path.empty() ? schema : schema.fetch(sub_path);
+
+    index_t data_end = utils::file_size(file_path);
+    std::vector<MergedWrite> writes;
+    if(!plan_merged_write(node,
+                          dest,
+                          allow_append,
+                          data_end,
+                          writes,
+                          schema_changed))
+    {
+        return false;
+    }
+
+    // write the data before the schema that describes it
+    write_merged(file_path, writes);
+    if(schema_changed)
+    {
+        schema.save(schema_path);
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// reads the leaves described by schema from ifs into dest, following the
+// rules of Node::update. dest leaves with the same type, at least as many
+// elements and dense host data are read into directly.
+//---------------------------------------------------------------------------//
+static void
+read_merged(std::ifstream &ifs,
+            const std::string &path,
+            const Schema &schema,
+            std::vector<uint8> &buffer,
+            Node &dest)
+{
+    index_t dtype_id = schema.dtype().id();
+    if(dtype_id == DataType::OBJECT_ID)
+    {
+        for(index_t idx = 0; idx < schema.number_of_children(); idx++)
+        {
+            read_merged(ifs,
+                        path,
+                        schema.child(idx),
+                        buffer,
+                        dest.add_child(schema.child_name(idx)));
+        }
+    }
+    else if(dtype_id == DataType::LIST_ID)
+    {
+        index_t src_num_children = schema.number_of_children();
+        index_t num_children = dest.dtype().is_list() ?
+                                    dest.number_of_children() : 0;
+        for(index_t idx = 0; idx < src_num_children; idx++)
+        {
+            Node &child = idx < num_children ? dest.child(idx)
+                                             : dest.append();
+            read_merged(ifs, path, schema.child(idx), buffer, child);
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        const DataType &file_dtype = schema.dtype();
+        const DataType &dest_dtype = dest.dtype();
+        index_t num_ele = file_dtype.number_of_elements();
+        if(num_ele > 0 &&
+           dest_dtype.id() == dtype_id &&
+           dest_dtype.number_of_elements() >= num_ele &&
+           is_dense(dest_dtype) &&
+           is_dense(file_dtype) &&
+           dest.allocator() == 0)
+        {
+            ifs.seekg((std::streamoff)file_dtype.offset());
+            ifs.read((char*)dest.element_ptr(0),
+                     (std::streamsize)(num_ele * file_dtype.element_bytes()));
+            dest.invalidate_hash();
+        }
+        else
+        {
+            DataType view_dtype(file_dtype);
+            view_dtype.set_offset(0);
+            index_t nbytes = num_ele > 0 ? view_dtype.spanned_bytes() : 0;
+            buffer.resize((size_t)nbytes);
+            if(nbytes > 0)
+            {
+                ifs.seekg((std::streamoff)file_dtype.offset());
+                ifs.read((char*)&buffer[0], (std::streamsize)nbytes);
+            }
+            Node view;
+            view.set_external(view_dtype,
+                              buffer.empty() ? NULL : &buffer[0]);
+            dest.update(view);
+        }
+
+        if(!ifs.good())
+        {
+            CONDUIT_ERROR("<relay::io::load_merged> failed to read "
+                          << schema.path() << " from: " << path);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// incremental checkpoints (see save_incremental) hold the changed leaves of
+// a tree and an index entry:
+//  _conduit_delta/paths:   leaf paths in depth first order, "\n" separated
+//  _conduit_delta/hashes:  content hash of each leaf, stored as int64 so
+//                          text protocols read them back exactly
+//  _conduit_delta/sources: int32 index into files of the checkpoint that
+//                          holds each leaf, -1 for this file
+//  _conduit_delta/files:   list of {path, protocol} of other checkpoints
+//---------------------------------------------------------------------------//
+static const std::string INCREMENTAL_ENTRY("_conduit_delta");
+
+//---------------------------------------------------------------------------//
+struct IncrementalIndex
+{
+    // path, protocol of the checkpoints that hold leaves
+    std::vector<std::pair<std::string,std::string> > files;
+    // leaf path -> hash and index into files
+    std::map<std::string, std::pair<uint64,index_t> > leaves;
+};
+
+//---------------------------------------------------------------------------//
+// collects the leaves save_incremental compares, in depth first order.
+// lists, and objects with names that can't be used in paths, are treated
+// as leaves.
+//---------------------------------------------------------------------------//
+static void
+incremental_leaves(const Node &node,
+                   const std::string &path,
+                   std::vector<std::string> &paths,
+                   std::vector<const Node*> &leaves)
+{
+    bool descend = node.dtype().is_object() &&
+                   node.number_of_children() > 0;
+    for(index_t i = 0; descend && i < node.number_of_children(); i++)
+    {
+        descend = node.schema().child_name(i).find_first_of("/\n") ==
+                      std::string::npos;
+    }
+
+    if(!descend)
+    {
+        paths.push_back(path);
+        leaves.push_back(&node);
+        return;
+    }
+
+    for(index_t i = 0; i < node.number_of_children(); i++)
+    {
+        incremental_leaves(node.child(i),
+                           path + "/" + node.schema().child_name(i),
+                           paths,
+                           leaves);
+    }
+}
+
+//---------------------------------------------------------------------------//
+static void
+incremental_root_leaves(const Node &node,
+                        std::vector<std::string> &paths,
+                        std::vector<const Node*> &leaves)
+{
+    for(index_t i = 0; i < node.number_of_children(); i++)
+    {
+        const std::string &name = node.schema().child_name(i);
+        if(name.find_first_of("/\n") != std::string::npos)
+        {
+            CONDUIT_ERROR("<relay::io::save_incremental> unsupported child"
+                          " name: \"" << name << "\"");
+        }
+        incremental_leaves(node.child(i), name, paths, leaves);
+    }
+}
+
+//---------------------------------------------------------------------------//
+static index_t
+incremental_file_index(IncrementalIndex &index,
+                       const std::string &path,
+                       const std::string &protocol)
+{
+    for(size_t i = 0; i < index.files.size(); i++)
+    {
+        if(index.files[i].first == path)
+        {
+            return (index_t)i;
+        }
+    }
+    index.files.push_back(std::make_pair(path, protocol));
+    return (index_t)index.files.size() - 1;
+}
+
+//---------------------------------------------------------------------------//
+// reads the leaf hashes of the checkpoint at path, from its index entry
+// when it has one, otherwise by reading and hashing the checkpoint
+//---------------------------------------------------------------------------//
+static void
+read_incremental_index(const std::string &path,
+                       const std::string &protocol,
+                       IncrementalIndex &index)
+{
+    Node open_opts;
+    open_opts["mode"] = "r";
+    open_opts["incremental/resolve"] = "false";
+
+    IOHandle hnd;
+    hnd.open(path, protocol, open_opts);
+    index_t self_idx = incremental_file_index(index, path, protocol);
+
+    if(hnd.has_path(INCREMENTAL_ENTRY))
+    {
+        Node entry;
+        hnd.read(INCREMENTAL_ENTRY, entry);
+        hnd.close();
+
+        std::vector<std::string> paths;
+        utils::split_string(entry["paths"].as_string(), '\n', paths);
+        Node hashes;
+        Node sources;
+        entry["hashes"].to_int64_array(hashes);
+        entry["sources"].to_int64_array(sources);
+        int64_array hashes_vals  = hashes.value();
+        int64_array sources_vals = sources.value();
+        if(hashes_vals.number_of_elements() != (index_t)paths.size() ||
+           sources_vals.number_of_elements() != (index_t)paths.size())
+        {
+            CONDUIT_ERROR("<relay::io::save_incremental> invalid "
+                          << INCREMENTAL_ENTRY << " entry in: " << path);
+        }
+
+        // map the base's file indices to ours
+        std::vector<index_t> file_ids;
+        if(entry.has_child("files"))
+        {
+            NodeConstIterator itr = entry["files"].children();
+            while(itr.has_next())
+            {
+                const Node &file = itr.next();
+                file_ids.push_back(
+                    incremental_file_index(index,
+                                           file["path"].as_string(),
+                                           file["protocol"].as_string()));
+            }
+        }
+
+        for(size_t i = 0; i < paths.size(); i++)
+        {
+            int64 src = sources_vals[i];
+            if(src >= (int64)file_ids.size())
+            {
+                CONDUIT_ERROR("<relay::io::save_incremental> invalid "
+                              << INCREMENTAL_ENTRY << " entry in: " << path);
+            }
+            index.leaves[paths[i]] =
+                std::make_pair((uint64)hashes_vals[i],
+                               src < 0 ? self_idx : file_ids[(size_t)src]);
+        }
+    }
+    else
+    {
+        Node base;
+        hnd.read(base);
+        hnd.close();
+
+        std::vector<std::string> paths;
+        std::vector<const Node*> leaves;
+        incremental_root_leaves(base, paths, leaves);
+        for(size_t i = 0; i < paths.size(); i++)
+        {
+            index.leaves[paths[i]] = std::make_pair(leaves[i]->hash(),
+                                                    self_idx);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// reassembles the tree of an incremental checkpoint loaded into node,
+// reading unchanged leaves from the files that hold them
+//---------------------------------------------------------------------------//
+static void
+resolve_incremental(const std::string &path,
+                    Node &node)
+{
+    Node loaded;
+    loaded.swap(node);
+
+    Node entry;
+    entry.swap(loaded[INCREMENTAL_ENTRY]);
+    loaded.remove(INCREMENTAL_ENTRY);
+
+    std::vector<std::string> paths;
+    utils::split_string(entry["paths"].as_string(), '\n', paths);
+    Node sources;
+    entry["sources"].to_int64_array(sources);
+    int64_array sources_vals = sources.value();
+    if(sources_vals.number_of_elements() != (index_t)paths.size())
+    {
+        CONDUIT_ERROR("<relay::io::load> invalid " << INCREMENTAL_ENTRY
+                      << " entry in: " << path);
+    }
+
+    // handles to the files that hold unchanged leaves, opened on first use
+    index_t num_files = entry.has_child("files") ?
+                            entry["files"].number_of_children() : 0;
+    std::map<int64, IOHandle> handles;
+
+    Node open_opts;
+    open_opts["mode"] = "r";
+    open_opts["incremental/resolve"] = "false";
+
+    // leaves loaded as views of one buffer (conduit_bin) are copied,
+    // otherwise they are moved
+    bool copy_leaves = loaded.allocated_bytes() > 0;
+
+    // rebuild in the saved order
+    node.set(DataType::object());
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        int64 src = sources_vals[i];
+        if(src < 0)
+        {
+            if(copy_leaves)
+            {
+                node[paths[i]].set(loaded[paths[i]]);
+            }
+            else
+            {
+                node[paths[i]].swap(loaded[paths[i]]);
+            }
+            continue;
+        }
+
+        if(src >= num_files)
+        {
+            CONDUIT_ERROR("<relay::io::load> invalid " << INCREMENTAL_ENTRY
+                          << " entry in: " << path);
+        }
+
+        const Node &file = entry["files"][(index_t)src];
+        IOHandle &hnd = handles[src];
+        if(!hnd.is_open())
+        {
+            hnd.open(file["path"].as_string(),
+                     file["protocol"].as_string(),
+                     open_opts);
+        }
+
+        if(!hnd.has_path(paths[i]))
+        {
+            CONDUIT_ERROR("<relay::io::load> \"" << paths[i] << "\" of "
+                          << path << " is missing from its base checkpoint: "
+                          << file["path"].as_string());
+        }
+        hnd.read(paths[i], node[paths[i]]);
+    }
+}
+
 //---------------------------------------------------------------------------//
 std::string
 about()
@@ -80,6 +736,22 @@ about(Node &n)
 
     // standard binary io
     io_protos["conduit_bin"] = "enabled";
+    // single file binary container
+    io_protos["conduit_pack"] = "enabled";
+
+    // same node exchange through shared memory
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    io_protos["conduit_shm"] = "enabled";
+#else
+    io_protos["conduit_shm"] = "disabled";
+#endif
+
+    // block compressed binary io
+#ifdef CONDUIT_RELAY_IO_BIN_ZLIB_ENABLED
+    io_protos["conduit_bin_zlib"] = "enabled";
+#else
+    io_protos["conduit_bin_zlib"] = "disabled";
+#endif
 
     // write table blueprints to csv
     io_protos["csv"] = "enabled";
@@ -127,6 +799,14 @@ about(Node &n)
 #else
     io_protos["adios"] = "disabled";
 #endif
+
+    // protocols registered by the application
+    std::vector<std::string> reg_protos;
+    registered_protocols(reg_protos);
+    for(size_t i = 0; i < reg_protos.size(); i++)
+    {
+        io_protos[reg_protos[i]] = "enabled";
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -329,8 +1009,20 @@ save(const Node &node,
         identify_protocol(path,protocol);
     }
 
+    // node bytes are only counted when stats are enabled
+    StatsTimer stats_timer(protocol.c_str(),
+                           "save",
+                           stats_enabled() ?
+                               node.total_bytes_compact() : 0);
+
+    // protocols registered by the application
+    if(is_registered_protocol(protocol))
+    {
+        registered_protocol_save(node,path,protocol,options,false);
+    }
     // support conduit::Node's basic save cases
-    if(protocol == "conduit_bin" ||
+    else if(protocol == "conduit_bin" ||
+       protocol == "conduit_pack" ||
        protocol == "json" ||
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" ||
@@ -362,24 +1054,60 @@ save(const Node &node,
     {
         write_csv(node, path, options);
     }
-    else if( protocol == "hdf5")
+    else if(protocol == "conduit_shm")
     {
-#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        // hdf5 is the only protocol that currently takes "options"
-        Node prev_options;
-        if(options.has_child("hdf5"))
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        if(sub_path.size() == 0)
         {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
+            shm_write(node,file_path);
         }
-
-        hdf5_save(node,path,options);
-
-        if(!prev_options.dtype().is_empty())
+        else
         {
-            hdf5_set_options(prev_options);
+            Node n_load;
+            if(shm_generation(file_path) > 0)
+            {
+                shm_read(file_path,n_load);
+            }
+            n_load[sub_path] = node;
+            shm_write(n_load,file_path);
         }
-
+    }
+    else if(protocol == "conduit_bin_zlib")
+    {
+#ifdef CONDUIT_RELAY_IO_BIN_ZLIB_ENABLED
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        if(sub_path.size() == 0)
+        {
+            bin_zlib_save(node,path,options);
+        }
+        else
+        {
+            Node n_load;
+            bin_zlib_load(file_path,options,n_load);
+            n_load[sub_path] = node;
+            bin_zlib_save(n_load,file_path,options);
+        }
+#else
+        CONDUIT_ERROR("conduit_relay lacks zlib support: " <<
+                      "Failed to save conduit node to path " << path);
+#endif
+    }
+    else if( protocol == "hdf5")
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        // hdf5 is the only protocol that currently takes "options",
+        // options["hdf5"] applies to this call only
+        hdf5_save(node,path,options);
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " <<
                       "Failed to save conduit node to path " << path);
@@ -458,8 +1186,20 @@ save_merged(const Node &node,
         identify_protocol(path,protocol);
     }
 
+    // node bytes are only counted when stats are enabled
+    StatsTimer stats_timer(protocol.c_str(),
+                           "save_merged",
+                           stats_enabled() ?
+                               node.total_bytes_compact() : 0);
+
+    // protocols registered by the application
+    if(is_registered_protocol(protocol))
+    {
+        registered_protocol_save(node,path,protocol,options,true);
+    }
     // support conduit::Node's basic save cases
-    if(protocol == "conduit_bin" ||
+    else if(protocol == "conduit_bin" ||
+       protocol == "conduit_pack" ||
        protocol == "json" ||
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" ||
@@ -473,8 +1213,14 @@ save_merged(const Node &node,
                                         std::string(":"),
                                         file_path,
                                         sub_path);
-        // We load the entire node if no sub path is given.
-        // (most common case)
+        // binary files are updated in place when possible, so only the
+        // schema and the leaves of node are read and written
+        if((protocol == "conduit_bin" || protocol == "conduit_pack") &&
+           save_merged_in_place(node, file_path, sub_path, protocol))
+        {
+            return;
+        }
+        // otherwise we load the entire file, update it and save it
         if(sub_path.size() == 0)
         {
             Node n;
@@ -498,23 +1244,65 @@ save_merged(const Node &node,
             n.save(file_path,protocol);
         }
     }
-    else if( protocol == "hdf5")
+    else if(protocol == "conduit_shm")
     {
-#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        // hdf5 is the only protocol that currently takes "options"
-        Node prev_options;
-        if(options.has_child("hdf5"))
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        Node n;
+        // support case where nothing has been written yet
+        if(shm_generation(file_path) > 0)
         {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
+            shm_read(file_path,n);
         }
-
-        hdf5_append(node,path,options);
-
-        if(!prev_options.dtype().is_empty())
+        if(sub_path.size() == 0)
+        {
+            n.update(node);
+        }
+        else
         {
-            hdf5_set_options(prev_options);
+            n[sub_path].update(node);
         }
+        shm_write(n,file_path);
+    }
+    else if(protocol == "conduit_bin_zlib")
+    {
+#ifdef CONDUIT_RELAY_IO_BIN_ZLIB_ENABLED
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        Node n;
+        // support case where the path is initially empty
+        if(utils::is_file(file_path))
+        {
+            bin_zlib_load(file_path,options,n);
+        }
+        if(sub_path.size() == 0)
+        {
+            n.update(node);
+        }
+        else
+        {
+            n[sub_path].update(node);
+        }
+        bin_zlib_save(n,file_path,options);
+#else
+        CONDUIT_ERROR("conduit_relay lacks zlib support: " <<
+                      "Failed to save conduit node to path " << path);
+#endif
+    }
+    else if( protocol == "hdf5")
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        // hdf5 is the only protocol that currently takes "options",
+        // options["hdf5"] applies to this call only
+        hdf5_append(node,path,options);
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " <<
                       "Failed to save conduit node to path " << path);
@@ -573,6 +1361,120 @@ save_merged(const Node &node,
     }
 }
 
+//---------------------------------------------------------------------------//
+void
+save_incremental(const Node &node,
+                 const std::string &path,
+                 const std::string &base_path)
+{
+    Node options;
+    save_incremental(node, path, base_path, std::string(""), options);
+}
+
+//---------------------------------------------------------------------------//
+void
+save_incremental(const Node &node,
+                 const std::string &path,
+                 const std::string &base_path,
+                 const std::string &protocol_,
+                 const Node &options)
+{
+    std::string protocol = protocol_;
+    // allow empty protocol to be used for auto detect
+    if(protocol.empty())
+    {
+        identify_protocol(path,protocol);
+    }
+
+    std::string file_path;
+    std::string sub_path;
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    sub_path);
+    if(!sub_path.empty())
+    {
+        CONDUIT_ERROR("<relay::io::save_incremental> does not support "
+                      "sub paths: " << path);
+    }
+
+    if(!node.dtype().is_object() && !node.dtype().is_empty())
+    {
+        CONDUIT_ERROR("<relay::io::save_incremental> requires an object,"
+                      " passed DataType: " << node.dtype().name());
+    }
+
+    if(node.has_child(INCREMENTAL_ENTRY))
+    {
+        CONDUIT_ERROR("<relay::io::save_incremental> node can't have a "
+                      << INCREMENTAL_ENTRY << " child");
+    }
+
+    IncrementalIndex index;
+    if(!base_path.empty())
+    {
+        std::string base_protocol;
+        identify_protocol(base_path, base_protocol);
+        read_incremental_index(base_path, base_protocol, index);
+    }
+
+    std::vector<std::string> paths;
+    std::vector<const Node*> leaves;
+    incremental_root_leaves(node, paths, leaves);
+
+    // changed leaves are written as external views of node's data
+    Node delta(DataType::object());
+    std::vector<int64>  hashes(paths.size());
+    std::vector<int32>  sources(paths.size(), -1);
+    std::vector<index_t> file_ids(index.files.size(), -1);
+    index_t num_files = 0;
+    std::string paths_str;
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        hashes[i] = (int64)leaves[i]->hash();
+
+        std::map<std::string, std::pair<uint64,index_t> >::const_iterator
+            itr = index.leaves.find(paths[i]);
+        // empty objects are always written, they cost nothing and reads
+        // of them don't tell empty objects from empty nodes
+        bool empty_object = leaves[i]->dtype().is_object();
+        if(!empty_object &&
+           itr != index.leaves.end() &&
+           itr->second.first == (uint64)hashes[i])
+        {
+            // only list the files referenced
+            index_t &file_id = file_ids[(size_t)itr->second.second];
+            if(file_id < 0)
+            {
+                file_id = num_files++;
+                const std::pair<std::string,std::string> &file =
+                    index.files[(size_t)itr->second.second];
+                Node &n_file = delta[INCREMENTAL_ENTRY]["files"].append();
+                n_file["path"] = file.first;
+                n_file["protocol"] = file.second;
+            }
+            sources[i] = (int32)file_id;
+        }
+        else
+        {
+            delta[paths[i]].set_external(*leaves[i]);
+        }
+
+        if(i > 0)
+        {
+            paths_str += "\n";
+        }
+        paths_str += paths[i];
+    }
+
+    Node &entry = delta[INCREMENTAL_ENTRY];
+    entry["paths"] = paths_str;
+    entry["hashes"].set(hashes);
+    entry["sources"].set(sources);
+
+    save(delta, path, protocol, options);
+}
+
 
 //---------------------------------------------------------------------------//
 void
@@ -591,8 +1493,16 @@ load(const std::string &path,
         identify_protocol(path,protocol);
     }
 
+    StatsTimer stats_timer(protocol.c_str(), "load");
+
+    // protocols registered by the application
+    if(is_registered_protocol(protocol))
+    {
+        registered_protocol_load(path,protocol,options,node);
+    }
     // support conduit::Node's basic load cases
-    if(protocol == "conduit_bin" ||
+    else if(protocol == "conduit_bin" ||
+       protocol == "conduit_pack" ||
        protocol == "json" ||
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" ||
@@ -612,6 +1522,11 @@ load(const std::string &path,
         {
             node.load(path,protocol);
         }
+        else if(protocol == "conduit_pack")
+        {
+            // pack files support reading only the sub path
+            conduit::pack::load(file_path,sub_path,node);
+        }
         else
         {
             Node n_load;
@@ -623,6 +1538,32 @@ load(const std::string &path,
     {
         read_csv(path, options, node);
     }
+    else if(protocol == "conduit_shm")
+    {
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        shm_read(file_path,sub_path,node);
+    }
+    else if(protocol == "conduit_bin_zlib")
+    {
+#ifdef CONDUIT_RELAY_IO_BIN_ZLIB_ENABLED
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        // only the blocks spanned by the sub path are decompressed
+        bin_zlib_load(file_path,sub_path,options,node);
+#else
+        CONDUIT_ERROR("conduit_relay lacks zlib support: " <<
+                      "Failed to load conduit node from path " << path);
+#endif
+    }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
@@ -697,6 +1638,29 @@ load(const std::string &path,
         CONDUIT_ERROR("unknown conduit_relay protocol: " << protocol);
 
     }
+
+    // reassemble incremental checkpoints (see save_incremental)
+    if(node.dtype().is_object() &&
+       node.has_child(INCREMENTAL_ENTRY) &&
+       !(options.has_path("incremental/resolve") &&
+         options["incremental/resolve"].as_string() == "false"))
+    {
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        if(sub_path.empty())
+        {
+            resolve_incremental(path, node);
+        }
+    }
+
+    if(stats_enabled())
+    {
+        stats_timer.set_bytes(node.total_bytes_compact());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -755,8 +1719,19 @@ load_merged(const std::string &path,
         identify_protocol(path,protocol);
     }
 
+    StatsTimer stats_timer(protocol.c_str(), "load_merged");
+
+    // protocols registered by the application
+    if(is_registered_protocol(protocol))
+    {
+        Node n;
+        registered_protocol_load(path,protocol,options,n);
+        // update into dest
+        node.update(n);
+    }
     // support conduit::Node's basic load cases
-    if(protocol == "conduit_bin" ||
+    else if(protocol == "conduit_bin" ||
+       protocol == "conduit_pack" ||
        protocol == "json" ||
        protocol == "conduit_json" ||
        protocol == "conduit_base64_json" ||
@@ -770,10 +1745,56 @@ load_merged(const std::string &path,
                                         std::string(":"),
                                         file_path,
                                         sub_path);
+        // binary files are read leaf by leaf using their schema, directly
+        // into compatible leaves of node
+        if(protocol == "conduit_bin" || protocol == "conduit_pack")
+        {
+            Schema schema;
+            if(protocol == "conduit_bin")
+            {
+                schema.load(file_path + "_json");
+            }
+            else
+            {
+                pack::load_schema(file_path, schema);
+            }
+
+            const Schema *src_schema = &schema;
+            if(sub_path.size() > 0)
+            {
+                if(!schema.has_path(sub_path))
+                {
+                    if(protocol == "conduit_pack")
+                    {
+                        CONDUIT_ERROR("<conduit::pack> " << file_path
+                                      << " does not contain path: "
+                                      << sub_path);
+                    }
+                    // nothing to merge
+                    src_schema = NULL;
+                }
+                else
+                {
+                    src_schema = &schema.fetch_existing(sub_path);
+                }
+            }
+
+            if(src_schema != NULL)
+            {
+                std::ifstream ifs;
+                ifs.open(file_path.c_str(), std::ios_base::binary);
+                if(!ifs.is_open())
+                {
+                    CONDUIT_ERROR("<relay::io::load_merged> failed to open: "
+                                  << file_path);
+                }
+                std::vector<uint8> buffer;
+                read_merged(ifs, file_path, *src_schema, buffer, node);
+            }
+        }
         // We load the entire node if no sub path is given.
         // (most common case)
-
-        if(sub_path.size() == 0)
+        else if(sub_path.size() == 0)
         {
             Node n;
             n.load(path,protocol);
@@ -788,6 +1809,37 @@ load_merged(const std::string &path,
             node.update(n[sub_path]);
         }
     }
+    else if(protocol == "conduit_shm")
+    {
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        Node n;
+        shm_read(file_path,sub_path,n);
+        // update into dest
+        node.update(n);
+    }
+    else if(protocol == "conduit_bin_zlib")
+    {
+#ifdef CONDUIT_RELAY_IO_BIN_ZLIB_ENABLED
+        std::string file_path;
+        std::string sub_path;
+        conduit::utils::split_file_path(path,
+                                        std::string(":"),
+                                        file_path,
+                                        sub_path);
+        Node n;
+        bin_zlib_load(file_path,sub_path,options,n);
+        // update into dest
+        node.update(n);
+#else
+        CONDUIT_ERROR("relay lacks zlib support: " <<
+                      "Failed to load conduit node from path " << path);
+#endif
+    }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
@@ -831,6 +1883,10 @@ load_merged(const std::string &path,
 
     }
 
+    if(stats_enabled())
+    {
+        stats_timer.set_bytes(node.total_bytes_compact());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -869,6 +1925,46 @@ query_number_of_domains(const std::string &path)
     return ndoms;
 }
 
+//---------------------------------------------------------------------------//
+void
+query_number_of_steps(const std::vector<std::string> &paths,
+                      std::vector<int> &res)
+{
+    std::vector<std::string> protocols;
+    identify_protocols(paths, protocols);
+
+    res.assign(paths.size(), 1);
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        if(protocols[i] == "adios")
+        {
+#ifdef CONDUIT_RELAY_IO_ADIOS_ENABLED
+            res[i] = adios_query_number_of_steps(paths[i]);
+#endif
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+query_number_of_domains(const std::vector<std::string> &paths,
+                        std::vector<int> &res)
+{
+    std::vector<std::string> protocols;
+    identify_protocols(paths, protocols);
+
+    res.assign(paths.size(), 1);
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        if(protocols[i] == "adios")
+        {
+#ifdef CONDUIT_RELAY_IO_ADIOS_ENABLED
+            res[i] = adios_query_number_of_domains(paths[i]);
+#endif
+        }
+    }
+}
+
 
 }
 //-----------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #include "conduit_relay_exports.h"
 #include "conduit_relay_config.h"
 #include "conduit_relay_io_identify_protocol.hpp"
+#include "conduit_relay_io_stats.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -38,6 +39,25 @@ namespace relay
 namespace io
 {
 
+//-----------------------------------------------------------------------------
+///
+/// Thread safety:
+///
+///  save, save_merged, load, load_merged and IOHandles may be used from
+///  several threads at once, as long as no two threads write the same file
+///  (or write a file another thread reads) and each thread uses its own
+///  Nodes and handles. Options set with hdf5_set_options() are copied when
+///  each call starts.
+///
+///  The conduit_bin, json, yaml and conduit_base64_json protocols have no
+///  shared state. Calls into HDF5 are serialized on one lock inside relay,
+///  unless HDF5 is built thread-safe. Silo and ADIOS are not thread-safe:
+///  callers must serialize the silo and adios protocols themselves, and
+///  since silo files may be written through HDF5, silo calls must not
+///  overlap with hdf5 calls on other threads either.
+///
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 /// The about methods construct human readable info about how relay io was
 /// configured.
@@ -78,6 +98,12 @@ void CONDUIT_RELAY_API save(const Node &node,
 ///
 /// ``save_merged`` works like an update to the file.
 ///
+/// For existing conduit_bin files only the schema is read: leaves with the
+/// same type and enough elements are overwritten in place and other leaves
+/// are appended to the data file. conduit_pack files are updated in place
+/// when the file already has a compatible leaf for each leaf of node, and
+/// rewritten otherwise. hdf5 files are always updated in place.
+///
 
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API save_merged(const Node &node,
@@ -99,6 +125,42 @@ void CONDUIT_RELAY_API save_merged(const Node &node,
                                    const std::string &protocol,
                                    const Node &options);
 
+///
+/// ``save_incremental`` saves an object node as an incremental checkpoint
+/// of the checkpoint at base_path.
+///
+/// The leaves of node (lists, and objects with names containing "/", are
+/// treated as single leaves) are compared by content hash (Node::hash) to
+/// the leaves at the same paths in the base checkpoint. Only new or
+/// changed leaves are written, the file's "_conduit_delta" entry records
+/// the hashes of all leaves and which checkpoint file holds each
+/// unchanged leaf. References always name the file that holds the data,
+/// so loads never follow chains of checkpoints.
+///
+/// The base can be a checkpoint saved with save_incremental (only its
+/// "_conduit_delta" entry is read) or with save (it is read and hashed).
+/// An empty base_path writes all leaves, starting a new chain.
+///
+/// load() reassembles the full tree from incremental checkpoints, reading
+/// unchanged leaves from the files that hold them (set the load option
+/// "incremental/resolve" to "false" to read only the file's contents).
+/// Base checkpoint paths are recorded as given, so base files must stay
+/// reachable at the same paths. Loads of a sub path of an incremental
+/// checkpoint only read the file's contents.
+///
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API save_incremental(const Node &node,
+                                        const std::string &path,
+                                        const std::string &base_path);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API save_incremental(const Node &node,
+                                        const std::string &path,
+                                        const std::string &base_path,
+                                        const std::string &protocol,
+                                        const Node &options);
+
 
 ///
 /// ``add_step`` adds a new time step of data to the file.
@@ -164,6 +226,9 @@ void CONDUIT_RELAY_API load(const std::string &path,
 ///  into the node. If the node is already in the OBJECT_T role, children are
 ///  added
 ///
+/// conduit_bin and conduit_pack files are read leaf by leaf, directly into
+/// existing leaves of node with the same type and enough elements.
+///
 
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API load_merged(const std::string &path,
@@ -197,6 +262,20 @@ int CONDUIT_RELAY_API query_number_of_steps(const std::string &path);
 //-----------------------------------------------------------------------------
 int CONDUIT_RELAY_API query_number_of_domains(const std::string &path);
 
+///
+/// Batch versions of ``query_number_of_steps`` and
+/// ``query_number_of_domains``: res[i] is the result for paths[i]. The
+/// protocol of each path is identified once, and only files whose protocol
+/// holds steps or domains (adios) are opened.
+///
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API query_number_of_steps(const std::vector<std::string> &paths,
+                                             std::vector<int> &res);
+
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API query_number_of_domains(const std::vector<std::string> &paths,
+                                               std::vector<int> &res);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::io --
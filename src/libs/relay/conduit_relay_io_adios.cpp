@@ -51,6 +51,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_error.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_fmt/conduit_fmt.h"
 
 using std::cout;
 using std::endl;
@@ -383,6 +384,29 @@ string_vector_contains(const std::vector<std::string> &sv, const std::string &s)
     return std::find(sv.begin(), sv.end(), s) != sv.end();
 }
 
+//-----------------------------------------------------------------------------
+// Returns ADIOS "key=value;key=value" parameters, given as a string or
+// as an object with a child per parameter.
+//-----------------------------------------------------------------------------
+static std::string
+node_to_parameters(const Node &n)
+{
+    if(n.dtype().is_string())
+        return n.as_string();
+
+    std::string res;
+    NodeConstIterator itr = n.children();
+    while(itr.has_next())
+    {
+        const Node &p = itr.next();
+        if(!res.empty())
+            res += ";";
+        res += itr.name() + "=";
+        res += p.dtype().is_string() ? p.as_string() : p.to_string();
+    }
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 bool is_integer(const std::string &s, int &ivalue)
 {
@@ -556,7 +580,7 @@ public:
             }
 
             if(n.has_child("transport_options"))
-                transport_options = n["transport_options"].as_string();
+                transport_options = node_to_parameters(n["transport_options"]);
 
             if(n.has_child("transform_options"))
                 transform_options = n["transform_options"].as_string();
@@ -576,7 +600,7 @@ public:
             }
 
             if(n.has_child("parameters"))
-                read_parameters = n["parameters"].as_string();
+                read_parameters = node_to_parameters(n["parameters"]);
 
             if(n.has_child("lock_mode"))
             {
@@ -731,11 +755,15 @@ static void finalize_read_methods()
     }
 }
 
+//-----------------------------------------------------------------------------
+static void free_step_state();
+
 //-----------------------------------------------------------------------------
 static void finalize(
     CONDUIT_RELAY_COMMUNICATOR_ARG0(MPI_Comm comm)
     )
 {
+    free_step_state();
     cleanup_options();
     finalize_read_methods();
     // cout << "adios_finalize()" << endl;
@@ -818,9 +846,12 @@ static void iterate_conduit_node(
 //-----------------------------------------------------------------------------
 struct adios_save_state
 {
-    adios_save_state() : fid(0), gid(0), gSize(0), adios_path()
+    adios_save_state() : fid(0), gid(0), gSize(0), adios_path(),
+        write_domain_map(false), var_defs(), redefine(false)
     {
         memset(groupName, 0, 32 * sizeof(char));
+        memset(domain_map_name, 0, 32 * sizeof(char));
+        dm[0] = dm[1] = 0;
     }
 
     int64_t  fid;
@@ -828,6 +859,18 @@ struct adios_save_state
     uint64_t gSize;
     char        groupName[32];
     std::string adios_path;
+
+    // domain map written with each step, when enabled
+    bool         write_domain_map;
+    char         domain_map_name[32];
+    unsigned int dm[2];
+
+    // definition (type and dims) of each variable defined in the group,
+    // lets steps reuse the definitions of earlier steps
+    std::map<std::string, std::string> var_defs;
+    // set when a variable needs a definition that differs from its
+    // existing one
+    bool redefine;
 };
 
 //-----------------------------------------------------------------------------
@@ -1000,6 +1043,23 @@ static void define_variables(const Node &node,
         sprintf(global, "%d", internals::size);
         sprintf(local,  "%d", 1);   
     }
+
+    // reuse the definition from an earlier step if it still fits
+    char var_def[80];
+    sprintf(var_def, "%d;%s;%s;%s", static_cast<int>(dtype),
+            local, global, offset);
+    std::map<std::string, std::string>::const_iterator def_itr =
+        state->var_defs.find(adios_var);
+    if(def_itr != state->var_defs.end())
+    {
+        if(def_itr->second != var_def)
+        {
+            state->redefine = true;
+        }
+        return;
+    }
+    state->var_defs[adios_var] = var_def;
+
     DEBUG_PRINT_RANK("adios_define_var(gid, \"" << adios_var
                      << "\", \"\", " << adios_type_to_string(dtype)
                      << ", \"" << local << "\""
@@ -1234,6 +1294,190 @@ static void compute_nodehash(const Node &node, unsigned int &nodehash,
 #endif
 }
 
+//-----------------------------------------------------------------------------
+// Declares the group and defines the variables of node in it.
+static void
+define_group(adios_save_state &state, const Node &node,
+    unsigned int nodehash, int nodehash_rank, int nodehash_size,
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Comm comm
+#else
+    int comm
+#endif
+    )
+{
+    //
+    // Group
+    //
+    create_group_name(state.groupName);
+#if defined(CONDUIT_RELAY_IO_MPI_ENABLED) && defined(MAKE_SEPARATE_GROUPS)
+    MPI_Bcast(state.groupName, 32, MPI_CHAR, 0, comm);
+#endif
+    std::string timeIndex;
+    if(!declare_group(&state.gid, state.groupName, timeIndex))
+    {
+        CONDUIT_ERROR("ADIOS Error: failed to create group.");
+    }
+
+#ifdef DISPARATE_TREE_SUPPORT
+    //
+    // Define nodehash variable (if enabled and relevant)
+    //
+    state.write_domain_map = options()->enable_nodehash &&
+                             nodehash_size != internals::size; // >1 hashes
+    if(state.write_domain_map)
+    {
+        create_domain_map_name(state.domain_map_name);
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+        MPI_Bcast(state.domain_map_name, 32, MPI_CHAR, 0, comm);
+#endif
+        // Define a domainmap variable.
+        state.dm[0] = nodehash;
+        state.dm[1] = nodehash_rank;
+        DEBUG_PRINT_RANK("adios_define_var(gid, \"" << state.domain_map_name 
+            << "\", \"\", adios_unsigned_integer, \"2\", \"\", \"\")")
+        adios_define_var(state.gid, state.domain_map_name,
+                         "", adios_unsigned_integer,
+                         "2", ""/*global*/, ""/*offset*/);
+        state.gSize += 2 * sizeof(unsigned int);
+
+        // Save the number of writers.
+        adios_define_var(state.gid, NWRITERS_VAR,
+                     "", adios_integer,
+                     "", "", "");
+        state.gSize += sizeof(int);
+
+        // We'll prepend the nodehash onto the rest of the variables
+        // that we declare.
+        char nhprefix[12];
+        sprintf(nhprefix, "%010u", nodehash);
+        state.adios_path = conduit::utils::join_path(std::string(nhprefix), state.adios_path);
+    }
+#endif
+#ifdef ENCODE_TYPE_IN_PATH
+    // Define a scalar that indicates we're encoding types in the path.
+    adios_define_var(state.gid, ENCODE_TYPE_VAR,
+                     "", adios_integer,
+                     "", "", "");
+    state.gSize += sizeof(int);
+#endif
+
+    //
+    // Define variables.
+    //
+    iterate_conduit_node(node, define_variables, &state, comm);
+}
+
+//-----------------------------------------------------------------------------
+// Opens file_path with the group, writes the variables of node and closes it.
+static void
+write_group(adios_save_state &state, const Node &node,
+    const std::string &file_path, const char *flag,
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Comm comm
+#else
+    int comm
+#endif
+    )
+{
+    //
+    // Open the file
+    //
+    DEBUG_PRINT_RANK("adios_open(&fid, \"" << state.groupName 
+        << "\", \"" << file_path << "\", "
+        << "\"" << flag << "\", comm)")
+    if(adios_open(&state.fid, state.groupName, file_path.c_str(), 
+                  flag, comm) == 0)
+    {
+        // This is an optional call that lets ADIOS size its output buffers.
+        uint64_t total_size = 0;
+        DEBUG_PRINT_RANK("adios_group_size(fid, " << state.gSize << ", &total)")
+        if(adios_group_size(state.fid, state.gSize, &total_size) == 0)
+        {
+#ifdef DISPARATE_TREE_SUPPORT
+            if(state.write_domain_map)
+            {
+                // Write the domainmap variable.
+                DEBUG_PRINT_RANK("adios_write(fid, \"" << state.domain_map_name << "\", dm)")
+                adios_write(state.fid, state.domain_map_name, state.dm);
+
+                // Write the number of writers.
+                DEBUG_PRINT_RANK("adios_write(fid, \"" << NWRITERS_VAR << "\", size)")
+                adios_write(state.fid, NWRITERS_VAR, &internals::size);
+            }
+#endif
+#ifdef ENCODE_TYPE_IN_PATH
+            int etflag = 1;
+            DEBUG_PRINT_RANK("adios_write(fid, \"" << ENCODE_TYPE_VAR << "\", etflag)")
+            adios_write(state.fid, ENCODE_TYPE_VAR, &etflag);
+#endif
+            //
+            // Write Variables
+            //
+            iterate_conduit_node(node, write_variables, &state, comm);
+        }
+        else
+        {
+            CONDUIT_ERROR("ADIOS error: " << adios_get_last_errmsg());
+        }
+
+        //
+        // Close the file.
+        //
+        DEBUG_PRINT_RANK("adios_close(fid)")
+        if(adios_close(state.fid) != 0)
+        {
+//            CONDUIT_ERROR("ADIOS error: " << adios_get_last_errmsg());
+        }
+    }
+    else
+    {
+        CONDUIT_ERROR("ADIOS error: " << adios_get_last_errmsg());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Deletes the variable definitions from the group so we can define them
+// again the next time around. Frees the group too.
+static void
+free_group(adios_save_state &state)
+{
+    if(state.gid == 0)
+        return;
+
+    DEBUG_PRINT_RANK("adios_delete_vardefs(gid)")
+    adios_delete_vardefs(state.gid);
+    DEBUG_PRINT_RANK("adios_free_group(gid)")
+    adios_free_group(state.gid);
+
+    state = adios_save_state();
+}
+
+//-----------------------------------------------------------------------------
+// The group add_step() keeps defined between steps, and the settings it
+// was defined with. Steps with the same settings reuse its definitions and
+// only define the variables that are new to the step.
+//-----------------------------------------------------------------------------
+struct adios_step_state
+{
+    adios_save_state save_state;
+    std::string      key;
+};
+
+static adios_step_state *adiosState_step = NULL;
+
+//-----------------------------------------------------------------------------
+static void
+free_step_state()
+{
+    if(adiosState_step != NULL)
+    {
+        free_group(adiosState_step->save_state);
+        delete adiosState_step;
+        adiosState_step = NULL;
+    }
+}
+
 //-----------------------------------------------------------------------------
 static void
 save(const Node &node, const std::string &path, const char *flag,
@@ -1279,132 +1523,69 @@ save(const Node &node, const std::string &path, const char *flag,
                      << options()->buffer_size << ")")
     adios_set_max_buffer_size(static_cast<uint64_t>(options()->buffer_size));
 
+    if(strcmp(flag, "a") != 0)
+    {
+        // the groups share a name, so the add_step group can not stay
+        // defined while we use another one
+        free_step_state();
+
+        define_group(state, node, nodehash, nodehash_rank, nodehash_size, comm);
+        write_group(state, node, file_path, flag, comm);
+        free_group(state);
+        return;
+    }
+
     //
-    // Group
+    // add_step: reuse the group of the previous step when it was defined
+    // for the same path and settings.
     //
-    create_group_name(state.groupName);
-#if defined(CONDUIT_RELAY_IO_MPI_ENABLED) && defined(MAKE_SEPARATE_GROUPS)
-    MPI_Bcast(state.groupName, 32, MPI_CHAR, 0, comm);
-#endif
-    std::string timeIndex;
-    if(declare_group(&state.gid, state.groupName, timeIndex))
+    char key_values[64];
+    sprintf(key_values, ";%u;%d;%d;%d;%ld", nodehash, nodehash_rank,
+            nodehash_size, static_cast<int>(options()->statistics_flag),
+            options()->buffer_size);
+    std::string key = path + key_values + ";" +
+                      options()->transport + ";" +
+                      options()->transport_options + ";" +
+                      options()->transform + ";" +
+                      options()->transform_options;
+
+    if(adiosState_step != NULL && adiosState_step->key != key)
     {
-#ifdef DISPARATE_TREE_SUPPORT
-        //
-        // Define nodehash variable (if enabled and relevant)
-        //
-        char domain_map_name[32];
-        unsigned int dm[2] = {0,0};
-        bool write_domain_map = options()->enable_nodehash &&
-                                nodehash_size != internals::size; // >1 hashes
-        if(write_domain_map)
-        {
-            create_domain_map_name(domain_map_name);
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-            MPI_Bcast(domain_map_name, 32, MPI_CHAR, 0, comm);
-#endif
-            // Define a domainmap variable.
-            dm[0] = nodehash;
-            dm[1] = nodehash_rank;
-            DEBUG_PRINT_RANK("adios_define_var(gid, \"" << domain_map_name 
-                << "\", \"\", adios_unsigned_integer, \"2\", \"\", \"\")")
-            adios_define_var(state.gid, domain_map_name,
-                             "", adios_unsigned_integer,
-                             "2", ""/*global*/, ""/*offset*/);
-            state.gSize += 2 * sizeof(unsigned int);
-
-            // Save the number of writers.
-            adios_define_var(state.gid, NWRITERS_VAR,
-                         "", adios_integer,
-                         "", "", "");
-            state.gSize += sizeof(int);
-
-            // We'll prepend the nodehash onto the rest of the variables
-            // that we declare.
-            char nhprefix[12];
-            sprintf(nhprefix, "%010u", nodehash);
-            state.adios_path = conduit::utils::join_path(std::string(nhprefix), state.adios_path);
-        }
-#endif
-#ifdef ENCODE_TYPE_IN_PATH
-        // Define a scalar that indicates we're encoding types in the path.
-        adios_define_var(state.gid, ENCODE_TYPE_VAR,
-                         "", adios_integer,
-                         "", "", "");
-        state.gSize += sizeof(int);
-#endif
-
-        //
-        // Define variables.
-        //
-        iterate_conduit_node(node, define_variables, &state, comm);
+        free_step_state();
+    }
 
-        //
-        // Open the file
-        //
-        DEBUG_PRINT_RANK("adios_open(&fid, \"" << state.groupName 
-            << "\", \"" << path << "\", "
-            << "\"" << flag << "\", comm)")
-        if(adios_open(&state.fid, state.groupName, file_path.c_str(), 
-                      flag, comm) == 0)
+    try
+    {
+        if(adiosState_step != NULL)
         {
-            // This is an optional call that lets ADIOS size its output buffers.
-            uint64_t total_size = 0;
-            DEBUG_PRINT_RANK("adios_group_size(fid, " << state.gSize << ", &total)")
-            if(adios_group_size(state.fid, state.gSize, &total_size) == 0)
-            {
-#ifdef DISPARATE_TREE_SUPPORT
-                if(write_domain_map)
-                {
-                    // Write the domainmap variable.
-                    DEBUG_PRINT_RANK("adios_write(fid, \"" << domain_map_name << "\", dm)")
-                    adios_write(state.fid, domain_map_name, dm);
+            // define the variables that are new in this step
+            iterate_conduit_node(node, define_variables,
+                                 &adiosState_step->save_state, comm);
 
-                    // Write the number of writers.
-                    DEBUG_PRINT_RANK("adios_write(fid, \"" << NWRITERS_VAR << "\", size)")
-                    adios_write(state.fid, NWRITERS_VAR, &internals::size);
-                }
-#endif
-#ifdef ENCODE_TYPE_IN_PATH
-                int etflag = 1;
-                DEBUG_PRINT_RANK("adios_write(fid, \"" << ENCODE_TYPE_VAR << "\", etflag)")
-                adios_write(state.fid, ENCODE_TYPE_VAR, &etflag);
-#endif
-                //
-                // Write Variables
-                //
-                iterate_conduit_node(node, write_variables, &state, comm);
-            }
-            else
+            if(adiosState_step->save_state.redefine)
             {
-                CONDUIT_ERROR("ADIOS error: " << adios_get_last_errmsg());
-            }
-
-            //
-            // Close the file.
-            //
-            DEBUG_PRINT_RANK("adios_close(fid)")
-            if(adios_close(state.fid) != 0)
-            {
-//                CONDUIT_ERROR("ADIOS error: " << adios_get_last_errmsg());
+                // a variable changed its type or size, start over
+                free_step_state();
             }
         }
-        else
+
+        if(adiosState_step == NULL)
         {
-            CONDUIT_ERROR("ADIOS error: " << adios_get_last_errmsg());
+            adiosState_step = new adios_step_state;
+            adiosState_step->key = key;
+            adiosState_step->save_state.adios_path = state.adios_path;
+            define_group(adiosState_step->save_state, node,
+                         nodehash, nodehash_rank, nodehash_size, comm);
         }
+
+        write_group(adiosState_step->save_state, node, file_path, flag, comm);
     }
-    else
+    catch(...)
     {
-        CONDUIT_ERROR("ADIOS Error: failed to create group.");
+        // do not reuse a group left in an unknown state
+        free_step_state();
+        throw;
     }
-
-    // Delete the variable definitions from the group so we can define them
-    // again the next time around. Free the group too.
-    DEBUG_PRINT_RANK("adios_delete_vardefs(gid)")
-    adios_delete_vardefs(state.gid);
-    DEBUG_PRINT_RANK("adios_free_group(gid)")
-    adios_free_group(state.gid);
 }
 
 //-----------------------------------------------------------------------------
@@ -1476,7 +1657,7 @@ void read_conduit_type_attribute(ADIOS_FILE *afile,
 struct adios_load_state
 {
    adios_load_state() : filename(), time_step(CURRENT_TIME_STEP), domain(0),
-       subpaths()
+       subpaths(), time_steps(), domains(), selection()
    {
    }
 
@@ -1484,8 +1665,36 @@ struct adios_load_state
    int                      time_step;
    int                      domain; 
    std::vector<std::string> subpaths;
+   // when set, load() reads each of these steps and domains, see
+   // adios_load(path, opts, node)
+   std::vector<int>         time_steps;
+   std::vector<int>         domains;
+   // selection/{fields,topologies,matsets}/{name}
+   Node                     selection;
 };
 
+//-----------------------------------------------------------------------------
+// Returns true if the variable name passes the fields, topologies and
+// matsets selection: variables under "fields/{name}" are only read for
+// selected fields, and likewise for topologies and matsets. Other
+// variables are always read.
+//-----------------------------------------------------------------------------
+bool name_matches_selection(const std::string &name,
+    const Node &selection)
+{
+    if(selection.number_of_children() == 0)
+        return true;
+
+    std::string kind, rest;
+    conduit::utils::split_path(name, kind, rest);
+    if(rest.empty() || !selection.has_child(kind))
+        return true;
+
+    std::string entry, entry_rest;
+    conduit::utils::split_path(rest, entry, entry_rest);
+    return selection[kind].has_child(entry);
+}
+
 //-----------------------------------------------------------------------------
 void
 open_file_and_process(adios_load_state *state,
@@ -1668,21 +1877,20 @@ load_domain_map(ADIOS_FILE *afile, int ts, int domain,
 #endif
 
 //-----------------------------------------------------------------------------
-// Callback for load()
-static void
-load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
+// Schedules the reads of the variables of one time step and domain into
+// node, only the block of that domain is selected. Returns the number of
+// scheduled reads, which are done by the next adios_perform_reads().
+static int
+schedule_domain_reads(adios_load_state *state, ADIOS_FILE *afile,
+    int time_step, int domain, Node &node)
 {
-    // Convert cbdata back to Node * and get a reference.
-    Node *node_ptr = (Node *)cbdata;
-    Node &node = *node_ptr;
-
     int scheduled_reads = 0;
     std::vector<ADIOS_SELECTION *> sels;
 
 #ifdef DISPARATE_TREE_SUPPORT
     std::vector<std::string>  dmprefixes;
     std::vector<unsigned int> dmblocks;
-    load_domain_map(afile, state->time_step, state->domain, dmprefixes, dmblocks);
+    load_domain_map(afile, time_step, domain, dmprefixes, dmblocks);
 #endif
     int skip = 0;
 #ifdef ENCODE_TYPE_IN_PATH
@@ -1719,7 +1927,7 @@ load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
         {
             // The file did not contain domain map information so the trees
             // must have been the same.
-            search_domain = state->domain;
+            search_domain = domain;
             vname = std::string(var_no_prefix);
         }
         else
@@ -1742,12 +1950,13 @@ load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
                 continue;
         }
 #else
-        int search_domain = state->domain;
+        int search_domain = domain;
         vname = std::string(var_original);
 #endif
 
         // Test that the variable is something we want to read.
-        if(!internals::name_matches_subpaths(vname, state->subpaths))
+        if(!internals::name_matches_subpaths(vname, state->subpaths) ||
+           !internals::name_matches_selection(vname, state->selection))
             continue;
 
         DEBUG_PRINT_RANK("adios_inq_var(afile, \""
@@ -1761,8 +1970,8 @@ load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
             adios_inq_var_blockinfo(afile,v);
 
             // Check time step validity.
-            int ts = state->time_step;
-            if(state->time_step == CURRENT_TIME_STEP)
+            int ts = time_step;
+            if(time_step == CURRENT_TIME_STEP)
                 ts = afile->current_step;
 
 #if 0
@@ -1822,7 +2031,7 @@ load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
 //       and then offsets computed from it to make the bounding box selection.
 
 
-            DEBUG_PRINT_RANK("state->time_step = " << state->time_step
+            DEBUG_PRINT_RANK("time_step = " << time_step
                 << ", v->nsteps=" << v->nsteps
                 << ", ts=" << ts << ", ts1 = " << ts1 << endl
                 << "biOffset=" << biOffset << ", read_dom=" <<read_dom);
@@ -1960,7 +2169,7 @@ load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
             else if(internals::rank == 0)
             {
                 // We could not find the desired block.
-                cout << "No block for " << vname << " process_id=" << state->domain
+                cout << "No block for " << vname << " process_id=" << domain
                      << " time_index=" << (ts+1) << endl;
                 internals::print_varinfo(cout, afile, v);
             }
@@ -1969,6 +2178,71 @@ load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
         }           
     }
 
+#if 0
+    // Free the selections. (TODO: see if this still crashes ADIOS)
+    for(size_t s = 0; s < sels.size(); ++s)
+        adios_selection_delete(sels[s]);
+#endif
+    return scheduled_reads;
+}
+
+//-----------------------------------------------------------------------------
+// Callback for load()
+static void
+load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
+{
+    // Convert cbdata back to Node * and get a reference.
+    Node *node_ptr = (Node *)cbdata;
+    Node &node = *node_ptr;
+
+    int scheduled_reads = 0;
+    if(state->time_steps.empty() && state->domains.empty())
+    {
+        scheduled_reads = schedule_domain_reads(state, afile,
+            state->time_step, state->domain, node);
+    }
+    else
+    {
+        std::vector<int> time_steps(state->time_steps);
+        if(time_steps.empty())
+            time_steps.push_back(state->time_step);
+        std::vector<int> domains(state->domains);
+        if(domains.empty())
+            domains.push_back(state->domain);
+
+        bool streaming = !streamIsFileBased(options()->read_method);
+        if(streaming && time_steps.size() > 1)
+        {
+            CONDUIT_ERROR("ADIOS Error: only the current step can be read"
+                          " from a stream, " << time_steps.size()
+                          << " steps were requested");
+        }
+
+        // All the reads are scheduled before any is performed, so the
+        // file is read once for all the steps and domains.
+        for(size_t t = 0; t < time_steps.size(); ++t)
+        {
+            int ts = time_steps[t];
+            if(ts == CURRENT_TIME_STEP)
+                ts = afile->current_step;
+            else if(ts < 0 || ts > afile->last_step)
+            {
+                CONDUIT_ERROR("ADIOS Error: step " << ts << " is not in "
+                              << state->filename << ", it has "
+                              << (afile->last_step + 1) << " steps");
+            }
+
+            for(size_t d = 0; d < domains.size(); ++d)
+            {
+                Node &out = node[conduit_fmt::format("step_{:06d}", ts)]
+                                [conduit_fmt::format("domain_{:06d}",
+                                                     domains[d])];
+                scheduled_reads += schedule_domain_reads(state, afile,
+                    ts, domains[d], out);
+            }
+        }
+    }
+
     // Perform any outstanding reads, blocking until reads are done.
     if(scheduled_reads > 0)
     {
@@ -1976,11 +2250,6 @@ load_node(adios_load_state *state, ADIOS_FILE *afile, void *cbdata)
         DEBUG_PRINT_RANK("adios_perform_reads(afile, " << blocking << ")")
         adios_perform_reads(afile, blocking);
     }
-#if 0
-    // Free the selections. (TODO: see if this still crashes ADIOS)
-    for(size_t s = 0; s < sels.size(); ++s)
-        adios_selection_delete(sels[s]);
-#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -2293,6 +2562,71 @@ adios_load(const std::string &path, Node &node
 #endif
 }
 
+//-----------------------------------------------------------------------------
+void
+adios_load(const std::string &path,
+   const Node &opts,
+   Node &node
+   CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm comm)
+   )
+{
+    internals::adios_load_state state;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // Read the rank'th domain if no domains are given.
+    MPI_Comm_rank(comm, &state.domain);
+#endif
+
+    internals::splitpath(path, state.filename, state.time_step, state.domain, state.subpaths);
+
+    if(opts.has_child("steps"))
+    {
+        Node n_steps;
+        opts["steps"].to_int_array(n_steps);
+        int_array steps = n_steps.value();
+        for(index_t i = 0; i < steps.number_of_elements(); ++i)
+            state.time_steps.push_back(steps[i]);
+    }
+    if(opts.has_child("domains"))
+    {
+        Node n_doms;
+        opts["domains"].to_int_array(n_doms);
+        int_array doms = n_doms.value();
+        for(index_t i = 0; i < doms.number_of_elements(); ++i)
+            state.domains.push_back(doms[i]);
+    }
+    // always use the step/domain layout
+    if(state.time_steps.empty())
+        state.time_steps.push_back(state.time_step);
+    if(state.domains.empty())
+        state.domains.push_back(state.domain);
+
+    const char *kinds[3] = {"fields", "topologies", "matsets"};
+    for(int k = 0; k < 3; ++k)
+    {
+        if(!opts.has_child(kinds[k]))
+            continue;
+        const Node &names = opts[kinds[k]];
+        Node &sel = state.selection[kinds[k]];
+        sel.set(DataType::object());
+        if(names.dtype().is_string())
+        {
+            sel.add_child(names.as_string());
+        }
+        else
+        {
+            NodeConstIterator itr = names.children();
+            while(itr.has_next())
+                sel.add_child(itr.next().as_string());
+        }
+    }
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    internals::load(&state, &node, comm);
+#else
+    internals::load(&state, &node);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 int
 adios_query_number_of_steps(const std::string &path
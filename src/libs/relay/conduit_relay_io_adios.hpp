@@ -67,6 +67,11 @@ void CONDUIT_RELAY_API adios_save_merged(const Node &node,
 ///
 /// This methods supports a file system and adios path, joined using a ":"
 ///  ex: "/path/on/file/system.adios:/path/inside/adios/file"
+///
+/// Consecutive steps written with the same path and options reuse the
+/// adios group and its variable definitions; only variables that are new
+/// in a step are defined. With a staging transport (e.g. FLEXPATH) the
+/// call returns once the step is queued, not when a reader consumes it.
 /// 
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API adios_add_step(const Node &node,
@@ -95,8 +100,36 @@ void CONDUIT_RELAY_API adios_load(const std::string &path,
                                   int domain,
                                   Node &node);
 
+//-----------------------------------------------------------------------------
+/// Read selected steps, domains and fields of adios data from given path
+/// into the output node, with the file opened once for all of them.
+///
+/// This methods supports a file system and adios path, joined using a ":"
+///  ex: "/path/on/file/system.bp:/path/inside/adios/file"
+///
+/// opts:
+///      steps: [{step}, ...]      (default: the current step)
+///      domains: [{domain}, ...]  (default: domain 0)
+///      fields: "{name}" or ["{name}", ...]
+///      topologies: "{name}" or ["{name}", ...]
+///      matsets: "{name}" or ["{name}", ...]
+///          only read the variables under fields/{name} (and likewise
+///          topologies and matsets) of the listed names, like the
+///          read_mesh options of the same names.
+///
+/// Only the block of each listed domain is read. The output holds one
+/// child per step and domain: step_{step:06d}/domain_{domain:06d}.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API adios_load(const std::string &path,
+                                  const Node &opts,
+                                  Node &node);
+
 //-----------------------------------------------------------------------------
 /// Pass a Node to set adios i/o options.
+///
+/// "write/transport_options" and "read/parameters" may be given either as
+/// a string or as a Node of key/value children, which is joined into the
+/// "key=value;key=value" form adios expects.
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API adios_set_options(const Node &opts);
 
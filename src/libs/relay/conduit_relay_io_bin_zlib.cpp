@@ -0,0 +1,427 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_bin_zlib.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_relay_io_bin_zlib.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+
+#include "conduit_log.hpp"
+#include "conduit_relay_io_utils.hpp"
+
+using conduit::utils::log::quote;
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+// Static functions, internal types
+
+//-----------------------------------------------------------------------------
+// Number of threads used to (de)compress blocks, from options["threads"].
+// Values <= 0 (the default) select up to 8 based on the hardware.
+static index_t
+get_num_threads(const Node &opts)
+{
+    index_t res = 0;
+    if(opts.has_child("threads"))
+    {
+        res = opts["threads"].to_index_t();
+    }
+
+    if(res <= 0)
+    {
+        res = std::min((index_t)8,
+                       std::max((index_t)1,
+                                (index_t)std::thread::hardware_concurrency()));
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static std::string
+index_path(const std::string &path)
+{
+    return path + "_json";
+}
+
+//-----------------------------------------------------------------------------
+// Range of data bytes [begin, end) spanned by the leaves of schema.
+static void
+spanned_range(const Schema &schema, index_t &begin, index_t &end)
+{
+    if(schema.dtype().is_object() || schema.dtype().is_list())
+    {
+        for(index_t i = 0; i < schema.number_of_children(); i++)
+        {
+            spanned_range(schema.child(i), begin, end);
+        }
+    }
+    else if(!schema.dtype().is_empty())
+    {
+        // note: spanned_bytes includes the offset
+        const index_t leaf_begin = schema.dtype().offset();
+        const index_t leaf_end = schema.dtype().spanned_bytes();
+        if(begin >= end)
+        {
+            begin = leaf_begin;
+            end   = leaf_end;
+        }
+        else
+        {
+            begin = std::min(begin, leaf_begin);
+            end   = std::max(end, leaf_end);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Copies schema to dest with each leaf offset moved back by delta.
+static void
+shift_offsets(const Schema &schema, index_t delta, Schema &dest)
+{
+    if(schema.dtype().is_object())
+    {
+        dest.set(DataType::object());
+        const std::vector<std::string> &names = schema.child_names();
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            shift_offsets(schema.child((index_t)i), delta, dest[names[i]]);
+        }
+    }
+    else if(schema.dtype().is_list())
+    {
+        dest.set(DataType::list());
+        for(index_t i = 0; i < schema.number_of_children(); i++)
+        {
+            shift_offsets(schema.child(i), delta, dest.append());
+        }
+    }
+    else
+    {
+        DataType dtype(schema.dtype());
+        if(!dtype.is_empty())
+        {
+            dtype.set_offset(dtype.offset() - delta);
+        }
+        dest.set(dtype);
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Reads and decompresses blocks [first, last] of the data file into
+    "dest", which must hold the uncompressed bytes of those blocks.
+*/
+static void
+read_blocks(const std::string &path,
+            const Node &index,
+            index_t first,
+            index_t last,
+            index_t num_threads,
+            uint8 *dest)
+{
+    const index_t block_size  = index["block_size"].to_index_t();
+    const index_t total_bytes = index["total_bytes"].to_index_t();
+    uint64_array offsets = index["blocks/offsets"].value();
+    uint64_array nbytes  = index["blocks/bytes"].value();
+
+    if(first < 0 || last >= offsets.number_of_elements())
+    {
+        CONDUIT_ERROR("Blocks [" << first << ", " << last << "] are not "
+                      "in the block index of file " << quote(path) << ".");
+    }
+
+    const index_t read_begin = (index_t)offsets[first];
+    const index_t read_end   = (index_t)(offsets[last] + nbytes[last]);
+
+    std::vector<uint8> compressed((size_t)(read_end - read_begin));
+    std::ifstream ifs(path.c_str(), std::ios::binary);
+    if(!ifs.is_open())
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+    }
+    ifs.seekg((std::streamoff)read_begin);
+    if(!ifs.read((char*)compressed.data(),
+                 (std::streamsize)compressed.size()))
+    {
+        CONDUIT_ERROR("Unable to read " << compressed.size()
+                      << " bytes at offset " << read_begin
+                      << " from file " << quote(path) << ".");
+    }
+    ifs.close();
+
+    relay::io::detail::run_tasks(last - first + 1, num_threads, [&](index_t i)
+    {
+        const index_t block = first + i;
+        const index_t raw_bytes = std::min(block_size,
+                                           total_bytes - block * block_size);
+        uLongf dest_len = (uLongf)raw_bytes;
+        int res = uncompress((Bytef*)(dest + i * block_size),
+                             &dest_len,
+                             (const Bytef*)(compressed.data() +
+                                            (offsets[block] - read_begin)),
+                             (uLong)nbytes[block]);
+        if(res != Z_OK || (index_t)dest_len != raw_bytes)
+        {
+            CONDUIT_ERROR("Failed to decompress block " << block
+                          << " of file " << quote(path)
+                          << " (zlib error: " << res << ").");
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+static void
+load_index(const std::string &path, Node &index)
+{
+    if(!utils::is_file(path))
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+    }
+
+    const std::string idx_path = index_path(path);
+    if(!utils::is_file(idx_path))
+    {
+        CONDUIT_ERROR("Unable to open block index file "
+                      << quote(idx_path) << ".");
+    }
+
+    index.load(idx_path, "conduit_json");
+    if(!index.has_child("codec") || index["codec"].as_string() != "zlib")
+    {
+        CONDUIT_ERROR("File " << quote(idx_path)
+                      << " is not a conduit_bin_zlib block index.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+bin_zlib_save(const Node &node,
+              const std::string &path,
+              const Node &options)
+{
+    index_t block_size = 1 << 20;
+    if(options.has_child("block_size"))
+    {
+        block_size = options["block_size"].to_index_t();
+        if(block_size <= 0)
+        {
+            CONDUIT_ERROR("conduit_bin_zlib: block_size must be positive, "
+                          "given " << block_size);
+        }
+    }
+
+    int level = Z_DEFAULT_COMPRESSION;
+    if(options.has_child("level"))
+    {
+        level = options["level"].to_int();
+    }
+
+    const index_t num_threads = get_num_threads(options);
+
+    // the blocks split the bytes conduit_bin writes, compact the node
+    // unless it already is
+    Node compact;
+    const Node *src = &node;
+    if(!node.is_compact() || !node.is_contiguous())
+    {
+        node.compact_to(compact);
+        src = &compact;
+    }
+
+    Schema schema;
+    src->schema().compact_to(schema);
+    const index_t total_bytes = schema.total_bytes_compact();
+    const uint8 *data = (const uint8 *)src->contiguous_data_ptr();
+    const index_t nblocks = (total_bytes + block_size - 1) / block_size;
+
+    std::ofstream ofs(path.c_str(), std::ios::binary | std::ios::trunc);
+    if(!ofs.is_open())
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+    }
+
+    // blocks are compressed "num_threads" at a time and written in order
+    std::vector<uint64> offsets;
+    std::vector<uint64> nbytes;
+    std::vector<std::vector<uint8> > bufs((size_t)num_threads);
+    uint64 file_offset = 0;
+    for(index_t batch = 0; batch < nblocks; batch += num_threads)
+    {
+        const index_t batch_blocks = std::min(num_threads, nblocks - batch);
+        relay::io::detail::run_tasks(batch_blocks, num_threads, [&](index_t i)
+        {
+            const index_t block = batch + i;
+            const index_t raw_bytes = std::min(block_size,
+                                               total_bytes - block * block_size);
+            std::vector<uint8> &buf = bufs[(size_t)i];
+            uLongf buf_len = compressBound((uLong)raw_bytes);
+            buf.resize((size_t)buf_len);
+            int res = compress2((Bytef*)buf.data(),
+                                &buf_len,
+                                (const Bytef*)(data + block * block_size),
+                                (uLong)raw_bytes,
+                                level);
+            if(res != Z_OK)
+            {
+                CONDUIT_ERROR("Failed to compress block " << block
+                              << " for file " << quote(path)
+                              << " (zlib error: " << res << ").");
+            }
+            buf.resize((size_t)buf_len);
+        });
+
+        for(index_t i = 0; i < batch_blocks; i++)
+        {
+            const std::vector<uint8> &buf = bufs[(size_t)i];
+            ofs.write((const char*)buf.data(), (std::streamsize)buf.size());
+            offsets.push_back(file_offset);
+            nbytes.push_back((uint64)buf.size());
+            file_offset += (uint64)buf.size();
+        }
+    }
+
+    ofs.close();
+    if(!ofs)
+    {
+        CONDUIT_ERROR("Failed to write file " << quote(path) << ".");
+    }
+
+    Node index;
+    index["codec"] = "zlib";
+    index["block_size"].set((int64)block_size);
+    index["total_bytes"].set((int64)total_bytes);
+    index["schema"] = schema.to_json();
+    index["blocks/offsets"].set(DataType::uint64((index_t)offsets.size()));
+    index["blocks/bytes"].set(DataType::uint64((index_t)nbytes.size()));
+    if(!offsets.empty())
+    {
+        std::copy(offsets.begin(), offsets.end(),
+                  index["blocks/offsets"].as_uint64_ptr());
+        std::copy(nbytes.begin(), nbytes.end(),
+                  index["blocks/bytes"].as_uint64_ptr());
+    }
+    index.save(index_path(path), "conduit_json");
+}
+
+//-----------------------------------------------------------------------------
+void
+bin_zlib_load(const std::string &path,
+              const Node &options,
+              Node &node)
+{
+    Node index;
+    load_index(path, index);
+
+    Schema schema(index["schema"].as_string());
+    node.reset();
+    node.set(schema);
+
+    const index_t nblocks = index["blocks/offsets"].dtype().number_of_elements();
+    if(nblocks > 0)
+    {
+        read_blocks(path,
+                    index,
+                    0,
+                    nblocks - 1,
+                    get_num_threads(options),
+                    (uint8 *)node.contiguous_data_ptr());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+bin_zlib_load(const std::string &path,
+              const std::string &sub_path,
+              const Node &options,
+              Node &node)
+{
+    if(sub_path.empty())
+    {
+        bin_zlib_load(path, options, node);
+        return;
+    }
+
+    Node index;
+    load_index(path, index);
+
+    Schema schema(index["schema"].as_string());
+    if(!schema.has_path(sub_path))
+    {
+        CONDUIT_ERROR("Path " << quote(sub_path)
+                      << " does not exist in file " << quote(path) << ".");
+    }
+    const Schema &sub_schema = schema.fetch_existing(sub_path);
+
+    node.reset();
+    index_t begin = 0;
+    index_t end   = 0;
+    spanned_range(sub_schema, begin, end);
+    if(begin >= end)
+    {
+        // no leaves with data
+        node.set(sub_schema);
+        return;
+    }
+
+    // only decompress the blocks the subtree spans
+    const index_t block_size  = index["block_size"].to_index_t();
+    const index_t total_bytes = index["total_bytes"].to_index_t();
+    const index_t first = begin / block_size;
+    const index_t last  = (end - 1) / block_size;
+    const index_t base  = first * block_size;
+    std::vector<uint8> raw((size_t)(std::min(total_bytes,
+                                             (last + 1) * block_size) - base));
+    read_blocks(path,
+                index,
+                first,
+                last,
+                get_num_threads(options),
+                raw.data());
+
+    Schema view_schema;
+    shift_offsets(sub_schema, base, view_schema);
+    Node view;
+    view.set_external(view_schema, raw.data());
+    view.compact_to(node);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,95 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_bin_zlib.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_RELAY_IO_BIN_ZLIB_HPP
+#define CONDUIT_RELAY_IO_BIN_ZLIB_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib include
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_node.hpp"
+#include "conduit_relay_exports.h"
+#include "conduit_relay_config.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+/**
+@brief Saves a node using the "conduit_bin_zlib" protocol: the compact data
+    of the node (the bytes conduit_bin writes) is split into fixed size
+    blocks that are compressed independently with zlib, on multiple threads.
+    The compressed blocks are written to "path", the schema and the block
+    index (offset and size of each block) are written to "path" + "_json".
+@param options "block_size" sets the uncompressed bytes per block
+    (default: 1 MiB), "level" sets the zlib compression level (default: the
+    zlib default), "threads" sets the number of compression threads
+    (default <= 0, up to 8 based on the hardware concurrency).
+*/
+CONDUIT_RELAY_API void bin_zlib_save(const Node &node,
+                                     const std::string &path,
+                                     const Node &options);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Loads a node saved with bin_zlib_save. The blocks are decompressed
+    on multiple threads directly into the node's memory.
+@param options "threads" sets the number of decompression threads.
+*/
+CONDUIT_RELAY_API void bin_zlib_load(const std::string &path,
+                                     const Node &options,
+                                     Node &node);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Loads the subtree at "sub_path" of a node saved with bin_zlib_save.
+    Only the blocks spanned by the subtree's leaves are read and
+    decompressed.
+*/
+CONDUIT_RELAY_API void bin_zlib_load(const std::string &path,
+                                     const std::string &sub_path,
+                                     const Node &options,
+                                     Node &node);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
+
+
+#endif
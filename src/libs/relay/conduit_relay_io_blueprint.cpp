@@ -10,6 +10,7 @@
 
 #include "conduit_relay_io.hpp"
 #include "conduit_relay_io_handle.hpp"
+#include "conduit_relay_io_utils.hpp"
 #include "conduit_blueprint.hpp"
 
 #include "conduit_fmt/conduit_fmt.h"
@@ -19,6 +20,7 @@
     #include "conduit_relay_mpi_io_blueprint.hpp"
 #else
     #include "conduit_relay_io_blueprint.hpp"
+    #include "conduit_relay_io_csv.hpp"
 #endif
 
 
@@ -30,9 +32,29 @@
 #define CONDUIT_RELAY_COMMUNICATOR_ARG(ARG) 
 #endif
 
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    #include "conduit_relay_io_hdf5.hpp"
+#endif
+
+#ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+    #include "conduit_relay_io_silo.hpp"
+#endif
+
 // std includes
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <queue>
 #include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // standard lib includes
@@ -128,6 +150,206 @@ void gen_domain_to_file_map(index_t num_domains,
     }
 }
 
+//-----------------------------------------------------------------------------
+// resolves the number_of_aggregators option: one aggregator per file
+// by default, never more than the # of files or the # of ranks
+int number_of_aggregators(int opts_num_aggregators,
+                          int num_files,
+                          int par_size)
+{
+    int res = opts_num_aggregators;
+    if(res <= 0 || res > num_files)
+    {
+        res = num_files;
+    }
+
+    if(res > par_size)
+    {
+        res = par_size;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// aggregators are spread evenly over the ranks
+int aggregator_rank(int aggregator,
+                    int num_aggregators,
+                    int par_size)
+{
+    return (int)(((int64)aggregator * par_size) / num_aggregators);
+}
+
+//-----------------------------------------------------------------------------
+// adds the domains of a file_{:06d}/domain_{:06d} tree to out, externally
+void add_file_domains_external(Node &file_doms,
+                               Node &out)
+{
+    NodeIterator files_itr = file_doms.children();
+    while(files_itr.has_next())
+    {
+        Node &doms = files_itr.next();
+        std::string file_name = files_itr.name();
+        NodeIterator doms_itr = doms.children();
+        while(doms_itr.has_next())
+        {
+            Node &dom = doms_itr.next();
+            out[file_name][doms_itr.name()].set_external(dom);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// coordsets and topologies written by earlier write_mesh calls (with the
+// static_topology option), by "{path}:{mesh name}/domain_{id}/{comp}/{name}"
+struct StaticEntryInfo
+{
+    uint64      hash[2];
+    std::string file_path;
+};
+
+std::map<std::string, StaticEntryInfo> &
+static_entries()
+{
+    static std::map<std::string, StaticEntryInfo> res;
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// path of file_path relative to the directory dir, when they are in the
+// same directory or sibling directories (otherwise file_path)
+std::string relative_file_path(const std::string &dir,
+                               const std::string &file_path)
+{
+    std::string file_dir, file_name, dir_parent, dir_name,
+                file_dir_parent, file_dir_name;
+    utils::rsplit_file_path(file_path, file_name, file_dir);
+    if(file_dir == dir)
+    {
+        return file_name;
+    }
+
+    utils::rsplit_file_path(dir, dir_name, dir_parent);
+    utils::rsplit_file_path(file_dir, file_dir_name, file_dir_parent);
+    if(dir_parent == file_dir_parent && !file_dir_name.empty())
+    {
+        return utils::join_file_path(utils::join_file_path("..",
+                                                           file_dir_name),
+                                     file_name);
+    }
+    return file_path;
+}
+
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+//-----------------------------------------------------------------------------
+// writes a domain to an hdf5 file, replacing the coordsets and topologies
+// that an earlier call wrote to another file (for the same key_prefix)
+// with external links. use_hash only links entries whose contents have
+// not changed; otherwise they are assumed to be unchanged.
+void write_hdf5_domain_with_static_links(const Node &dom,
+                                         const std::string &output_file,
+                                         const std::string &mesh_name,
+                                         const std::string &key_prefix,
+                                         bool use_hash,
+                                         bool truncate)
+{
+    std::map<std::string, StaticEntryInfo> &entries = static_entries();
+
+    std::string output_dir, output_name;
+    utils::rsplit_file_path(output_file, output_name, output_dir);
+
+    Node to_write, hash_opts, hash_res;
+    hash_opts["bits"] = 128;
+    std::vector<std::string> link_paths, link_files;
+
+    NodeConstIterator comp_itr = dom.children();
+    while(comp_itr.has_next())
+    {
+        const Node &comp = comp_itr.next();
+        const std::string comp_name = comp_itr.name();
+        if((comp_name != "coordsets" && comp_name != "topologies") ||
+           !comp.dtype().is_object())
+        {
+            to_write[comp_name].set_external(comp);
+            continue;
+        }
+
+        NodeConstIterator entry_itr = comp.children();
+        while(entry_itr.has_next())
+        {
+            const Node &entry = entry_itr.next();
+            const std::string entry_path = comp_name + "/" + entry_itr.name();
+            const std::string key = key_prefix + "/" + entry_path;
+
+            StaticEntryInfo info;
+            info.hash[0] = 0;
+            info.hash[1] = 0;
+            if(use_hash)
+            {
+                entry.hash(hash_opts, hash_res);
+                uint64_array h = hash_res.value();
+                info.hash[0] = h[0];
+                info.hash[1] = h[1];
+            }
+
+            std::map<std::string, StaticEntryInfo>::const_iterator itr =
+                entries.find(key);
+            if(itr != entries.end() &&
+               itr->second.file_path != output_file &&
+               itr->second.hash[0] == info.hash[0] &&
+               itr->second.hash[1] == info.hash[1])
+            {
+                link_paths.push_back(entry_path);
+                link_files.push_back(relative_file_path(output_dir,
+                                                        itr->second.file_path));
+                continue;
+            }
+
+            to_write[entry_path].set_external(entry);
+            info.file_path = output_file;
+            entries[key] = info;
+        }
+    }
+
+    hid_t h5_id = -1;
+    if(truncate || !utils::is_file(output_file))
+    {
+        h5_id = relay::io::hdf5_create_file(output_file);
+    }
+    else
+    {
+        h5_id = relay::io::hdf5_open_file_for_read_write(output_file);
+    }
+
+    try
+    {
+        if(to_write.number_of_children() > 0)
+        {
+            relay::io::hdf5_write(to_write, h5_id, mesh_name);
+        }
+
+        for(size_t i = 0; i < link_paths.size(); i++)
+        {
+            const std::string link_path = mesh_name + "/" + link_paths[i];
+            if(relay::io::hdf5_has_path(h5_id, link_path))
+            {
+                relay::io::hdf5_remove_path(h5_id, link_path);
+            }
+            relay::io::hdf5_create_external_link(h5_id,
+                                                 link_files[i],
+                                                 "/" + link_path,
+                                                 link_path);
+        }
+    }
+    catch(...)
+    {
+        relay::io::hdf5_close_file(h5_id);
+        throw;
+    }
+    relay::io::hdf5_close_file(h5_id);
+}
+#endif
+
 
 class BlueprintTreePathGenerator
 {
@@ -502,71 +724,1513 @@ void filter_fields(const conduit::Node &input,
 }
 
 //---------------------------------------------------------------------------//
-std::string
-identify_protocol(const std::string &path)
+// Loads a mesh blueprint root file, picks the mesh to read (opts/mesh_name
+// or the first mesh in the index) and verifies that mesh's index.
+//---------------------------------------------------------------------------//
+void
+read_root_file(const std::string &root_file_path,
+               const Node &opts,
+               Node &root_node,
+               std::string &mesh_name)
 {
-    std::string file_path, obj_base;
-    conduit::utils::split_file_path(path,
-                                    std::string(":"),
-                                    file_path,
-                                    obj_base);
+    std::string root_fname = root_file_path;
 
-    std::string file_name_base, file_name_ext;
-    conduit::utils::rsplit_string(file_path,
-                                  std::string("."),
-                                  file_name_ext,
-                                  file_name_base);
+    // read the root file, it can be either json or hdf5
 
-    std::string io_type = "bin";
-    if(file_name_ext.find("blueprint_root") == 0)
+    // assume hdf5, but check for json file
+    std::string root_protocol = "hdf5";
+    // we will read the first 5 bytes, but
+    // make sure our buff is null termed, unless you
+    // want a random chance at sadness.
+    char buff[6] = {0,0,0,0,0,0};
+
+    // heuristic, if json, we expect to see "{" in the first 5 chars of the file.
+    std::ifstream ifs;
+    ifs.open(root_fname.c_str());
+    if(!ifs.is_open())
     {
-        std::string file_name_true_ext = file_name_ext.substr(
-            std::string("blueprint_root").length(), file_name_ext.length());
+        CONDUIT_ERROR("failed to open root file: " << root_fname);
+    }
 
-        // TODO: Add support for yaml protocol
-        if(file_name_true_ext == "")
+    if(!ifs.read((char *)buff,5))
+    {
+        CONDUIT_ERROR("failed to read starting bytes from root file: " << root_fname);
+    }
+    ifs.close();
+
+    std::string test_str(buff);
+
+    if(test_str.find("{") != std::string::npos)
+    {
+       root_protocol = "json";
+    }
+
+    root_node.reset();
+    relay::io::load(root_fname, root_protocol, root_node);
+
+
+    if(!root_node.has_child("file_pattern"))
+    {
+        CONDUIT_ERROR("Root file missing 'file_pattern'");
+    }
+
+    if(!root_node.has_child("blueprint_index"))
+    {
+        CONDUIT_ERROR("Root file missing 'blueprint_index'");
+    }
+
+    mesh_name ="";
+    if(opts.has_child("mesh_name") && opts["mesh_name"].dtype().is_string())
+    {
+        mesh_name = opts["mesh_name"].as_string();
+    }
+
+    if(mesh_name.empty())
+    {
+        NodeConstIterator itr = root_node["blueprint_index"].children();
+        itr.next();
+        mesh_name = itr.name();
+    }
+
+    if(!root_node["blueprint_index"].has_child(mesh_name))
+    {
+        // bad name, construct an error message that
+        // displays the valid options
+        std::ostringstream oss;
+        oss << "Mesh named '" << mesh_name << "' "
+            << " not found in " 
+            << root_file_path
+            << std::endl
+            << " Mesh names found blueprint index: " 
+            << std::endl;
+        NodeConstIterator itr = root_node["blueprint_index"].children();
+        while(itr.has_next())
         {
-            io_type = "json";
+            itr.next();
+            oss << " " << itr.name();
+            oss << std::endl;
         }
-        else if(file_name_true_ext == "_hdf5" || file_name_true_ext == "_h5")
+
+        CONDUIT_ERROR(oss.str());
+    }
+
+    // make sure we have a valid bp index
+    Node verify_info;
+    const Node &mesh_index = root_node["blueprint_index"][mesh_name];
+    if( !::conduit::blueprint::mesh::index::verify(mesh_index,
+                                                   verify_info[mesh_name]))
+    {
+        CONDUIT_ERROR("Mesh Blueprint index verify failed" << std::endl
+                      << verify_info.to_json());
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Parses the fields, topologies and matsets read options into selection,
+// as selection/{fields,topologies,matsets}/{name}. Each option is a name
+// or a list of names, and each name must be in mesh_index.
+//---------------------------------------------------------------------------//
+void
+parse_read_selection(const Node &opts,
+                     const Node &mesh_index,
+                     Node &selection)
+{
+    selection.reset();
+
+    const char *kinds[3] = {"fields", "topologies", "matsets"};
+    for(int k = 0; k < 3; k++)
+    {
+        const std::string kind = kinds[k];
+        if(!opts.has_child(kind))
         {
-            io_type = "hdf5";
+            continue;
         }
-        else if(file_name_true_ext == "_silo")
+
+        const Node &names = opts[kind];
+        std::vector<std::string> sel_names;
+        if(names.dtype().is_string())
         {
-            io_type = "silo";
+            sel_names.push_back(names.as_string());
+        }
+        else
+        {
+            NodeConstIterator itr = names.children();
+            while(itr.has_next())
+            {
+                const Node &name = itr.next();
+                if(!name.dtype().is_string())
+                {
+                    CONDUIT_ERROR("read_mesh option '" << kind << "'"
+                                  " must be a string or a list of strings");
+                }
+                sel_names.push_back(name.as_string());
+            }
         }
-    }
 
-    return io_type;
+        Node &sel_kind = selection[kind];
+        // an empty list selects nothing of this kind
+        sel_kind.set(DataType::object());
+        for(size_t i = 0; i < sel_names.size(); i++)
+        {
+            if(!mesh_index.has_child(kind) ||
+               !mesh_index[kind].has_child(sel_names[i]))
+            {
+                CONDUIT_ERROR("read_mesh: " << kind << " '"
+                              << sel_names[i] << "' not found in the"
+                              " mesh index");
+            }
+            sel_kind.add_child(sel_names[i]);
+        }
+    }
 }
 
+//---------------------------------------------------------------------------//
+// Resolves the domains and domain_range read options to the ids of the
+// domains to read, all num_domains domains by default.
+//---------------------------------------------------------------------------//
+void
+parse_read_domains(const Node &opts,
+                   index_t num_domains,
+                   std::vector<index_t> &domain_ids)
+{
+    domain_ids.clear();
 
-//-----------------------------------------------------------------------------
-// -- end conduit::relay::<mpi>::io_blueprint::detail --
-//-----------------------------------------------------------------------------
-};
+    if(opts.has_child("domains"))
+    {
+        Node n_ids;
+        opts["domains"].to_index_t_array(n_ids);
+        index_t_array ids = n_ids.value();
+        for(index_t i = 0; i < ids.number_of_elements(); i++)
+        {
+            domain_ids.push_back(ids[i]);
+        }
+    }
+    else if(opts.has_child("domain_range"))
+    {
+        Node n_range;
+        opts["domain_range"].to_index_t_array(n_range);
+        index_t_array range = n_range.value();
+        if(range.number_of_elements() != 2 || range[0] > range[1])
+        {
+            CONDUIT_ERROR("read_mesh option 'domain_range' must hold"
+                          " two values: [begin, end)");
+        }
 
+        for(index_t i = range[0]; i < range[1]; i++)
+        {
+            domain_ids.push_back(i);
+        }
+    }
+    else
+    {
+        for(index_t i = 0; i < num_domains; i++)
+        {
+            domain_ids.push_back(i);
+        }
+    }
 
-//-----------------------------------------------------------------------------
-// Sig variants of save_mesh
-//-----------------------------------------------------------------------------
+    for(size_t i = 0; i < domain_ids.size(); i++)
+    {
+        if(domain_ids[i] < 0 || domain_ids[i] >= num_domains)
+        {
+            CONDUIT_ERROR("read_mesh: domain " << domain_ids[i]
+                          << " is out of range, the mesh has "
+                          << num_domains << " domains");
+        }
+    }
+}
 
-//-----------------------------------------------------------------------------
-void save_mesh(const Node &mesh,
-                const std::string &path
-                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+//---------------------------------------------------------------------------//
+// Records the size of each local domain in root["domain_sizes"]:
+//   bytes:    compact bytes of the domain
+//   elements: number of elements over all of the domain's topologies
+// indexed by global domain id (read_mesh uses them to balance reads).
+//---------------------------------------------------------------------------//
+void
+gen_domain_sizes(const Node &multi_dom,
+                 index_t num_domains,
+                 Node &sizes)
 {
-    // empty opts
-    Node opts;
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    save_mesh(mesh,
-              path,
-              detail::identify_protocol(path),
-              opts,
-              mpi_comm);
-#else
-    save_mesh(mesh,
+    sizes.set(DataType::int64(2 * num_domains));
+    int64 *vals = sizes.value();
+    for(index_t i = 0; i < 2 * num_domains; i++)
+    {
+        vals[i] = 0;
+    }
+
+    NodeConstIterator itr = multi_dom.children();
+    while(itr.has_next())
+    {
+        const Node &dom = itr.next();
+        index_t domain = dom["state/domain_id"].to_index_t();
+        if(domain < 0 || domain >= num_domains)
+        {
+            continue;
+        }
+
+        int64 num_elements = 0;
+        if(dom.has_child("topologies"))
+        {
+            NodeConstIterator titr = dom["topologies"].children();
+            while(titr.has_next())
+            {
+                num_elements += ::conduit::blueprint::mesh::topology::length(
+                                                                titr.next());
+            }
+        }
+        vals[domain] = dom.total_bytes_compact();
+        vals[num_domains + domain] = num_elements;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// a group of read domains assigned to one rank
+struct ReadItem
+{
+    int64                weight;
+    std::vector<index_t> reads;
+};
+
+//---------------------------------------------------------------------------//
+// a rank's load while assigning read items, the least loaded rank (then
+// the one with the fewest items, then the lowest rank) is on top
+struct ReadRankLoad
+{
+    int64   load;
+    index_t num_items;
+    index_t rank;
+
+    bool operator<(const ReadRankLoad &other) const
+    {
+        if(load != other.load)
+        {
+            return load > other.load;
+        }
+        if(num_items != other.num_items)
+        {
+            return num_items > other.num_items;
+        }
+        return rank > other.rank;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Picks the entries of domain_ids (as indices into domain_ids) that rank
+// reads.
+//
+// By default (balance: "count") ranks read contiguous blocks of the same
+// number of domains. With balance "bytes" or "elements", domains are given
+// out largest first to the rank with the smallest load so far, using the
+// sizes write_mesh stores in the root file. With group_by_file: "true",
+// the domains of each data file are given out together, so each file is
+// opened by one rank (when there are at least as many files as ranks).
+//
+// All ranks compute the same assignment, no communication is needed.
+//---------------------------------------------------------------------------//
+void
+assign_read_domains(const Node &opts,
+                    const Node &root_node,
+                    const std::vector<index_t> &domain_ids,
+                    const std::vector<std::string> &domain_files,
+                    index_t rank,
+                    index_t num_ranks,
+                    std::vector<index_t> &reads)
+{
+    reads.clear();
+    index_t num_reads = (index_t)domain_ids.size();
+
+    std::string balance = "count";
+    if(opts.has_child("balance"))
+    {
+        balance = opts["balance"].as_string();
+        if(balance != "count" && balance != "bytes" && balance != "elements")
+        {
+            CONDUIT_ERROR("read_mesh invalid balance option: \""
+                          << balance << "\"\n"
+                          " expected: \"count\", \"bytes\", or \"elements\"");
+        }
+    }
+
+    // sidre data lives in the root file, there is nothing to group
+    bool group_by_file = opts.has_child("group_by_file") &&
+                         opts["group_by_file"].as_string() == "true" &&
+                         (index_t)domain_files.size() == num_reads;
+
+    // per domain weights
+    index_t num_domains = root_node["number_of_trees"].to_index_t();
+    std::vector<int64> weights((size_t)num_reads, 1);
+    if(balance != "count")
+    {
+        if(root_node.has_child("domain_sizes") &&
+           root_node["domain_sizes"].has_child(balance) &&
+           root_node["domain_sizes"][balance].dtype().number_of_elements()
+                == num_domains)
+        {
+            Node n_sizes;
+            root_node["domain_sizes"][balance].to_int64_array(n_sizes);
+            int64_array sizes = n_sizes.value();
+            for(index_t i = 0; i < num_reads; i++)
+            {
+                weights[(size_t)i] = sizes[domain_ids[(size_t)i]];
+            }
+        }
+        else
+        {
+            if(rank == 0)
+            {
+                CONDUIT_INFO("read_mesh: the root file has no domain "
+                             << balance << " sizes,"
+                             " balancing by domain count");
+            }
+            balance = "count";
+        }
+    }
+
+    // items to give out: one per file or one per domain
+    std::vector<ReadItem> items;
+    if(group_by_file)
+    {
+        std::map<std::string, index_t> file_items;
+        for(index_t i = 0; i < num_reads; i++)
+        {
+            const std::string &file = domain_files[(size_t)i];
+            std::map<std::string, index_t>::iterator fitr =
+                                                    file_items.find(file);
+            if(fitr == file_items.end())
+            {
+                fitr = file_items.insert(std::make_pair(file,
+                                            (index_t)items.size())).first;
+                items.push_back(ReadItem());
+                items.back().weight = 0;
+            }
+            ReadItem &item = items[(size_t)fitr->second];
+            item.weight += weights[(size_t)i];
+            item.reads.push_back(i);
+        }
+
+        // too few files to keep every rank busy
+        if((index_t)items.size() < num_ranks)
+        {
+            items.clear();
+        }
+    }
+
+    if(items.empty())
+    {
+        if(balance == "count")
+        {
+            index_t read_size = num_reads / num_ranks;
+            index_t rem = num_reads % num_ranks;
+            index_t start = rank * read_size + std::min(rank, rem);
+            if(rank < rem)
+            {
+                read_size++;
+            }
+            for(index_t i = start; i < start + read_size; i++)
+            {
+                reads.push_back(i);
+            }
+            return;
+        }
+
+        items.resize((size_t)num_reads);
+        for(index_t i = 0; i < num_reads; i++)
+        {
+            items[(size_t)i].weight = weights[(size_t)i];
+            items[(size_t)i].reads.push_back(i);
+        }
+    }
+
+    // largest first, ties keep domain order
+    std::vector<index_t> order(items.size());
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = (index_t)i;
+    }
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](index_t a, index_t b)
+                     {
+                         return items[(size_t)a].weight >
+                                items[(size_t)b].weight;
+                     });
+
+    std::priority_queue<ReadRankLoad> loads;
+    for(index_t r = 0; r < num_ranks; r++)
+    {
+        ReadRankLoad load = {0, 0, r};
+        loads.push(load);
+    }
+
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        const ReadItem &item = items[(size_t)order[i]];
+        ReadRankLoad load = loads.top();
+        loads.pop();
+        if(load.rank == rank)
+        {
+            reads.insert(reads.end(), item.reads.begin(), item.reads.end());
+        }
+        load.load += item.weight;
+        load.num_items++;
+        loads.push(load);
+    }
+
+    std::sort(reads.begin(), reads.end());
+}
+
+//---------------------------------------------------------------------------//
+// Checks if the mesh index entry outer_name/entry_name passes selection.
+// Besides the names selected explicitly, entries that refer to topologies
+// or matsets that were not selected, and coordsets that no selected
+// topology uses, are left out.
+//---------------------------------------------------------------------------//
+bool
+read_selection_includes(const Node &selection,
+                        const Node &mesh_index,
+                        const std::string &outer_name,
+                        const std::string &entry_name,
+                        const Node &entry)
+{
+    if(selection.number_of_children() == 0)
+    {
+        return true;
+    }
+
+    if(selection.has_child(outer_name) &&
+       !selection[outer_name].has_child(entry_name))
+    {
+        return false;
+    }
+
+    if(selection.has_child("topologies"))
+    {
+        const Node &sel_topos = selection["topologies"];
+        if(entry.has_child("topology") &&
+           entry["topology"].dtype().is_string() &&
+           !sel_topos.has_child(entry["topology"].as_string()))
+        {
+            return false;
+        }
+
+        if(outer_name == "coordsets")
+        {
+            NodeConstIterator itr = sel_topos.children();
+            while(itr.has_next())
+            {
+                itr.next();
+                const Node &topo = mesh_index["topologies"][itr.name()];
+                if(topo.has_child("coordset") &&
+                   topo["coordset"].as_string() == entry_name)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    if(selection.has_child("matsets") &&
+       entry.has_child("matset") &&
+       entry["matset"].dtype().is_string() &&
+       !selection["matsets"].has_child(entry["matset"].as_string()))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Narrowest signed integer type that holds [min_val, max_val], or
+// EMPTY_ID if none is narrower than int64.
+//---------------------------------------------------------------------------//
+index_t
+narrow_signed_dtype_id(int64 min_val,
+                       int64 max_val)
+{
+    if(min_val >= std::numeric_limits<int8>::min() &&
+       max_val <= std::numeric_limits<int8>::max())
+    {
+        return DataType::INT8_ID;
+    }
+    else if(min_val >= std::numeric_limits<int16>::min() &&
+            max_val <= std::numeric_limits<int16>::max())
+    {
+        return DataType::INT16_ID;
+    }
+    else if(min_val >= std::numeric_limits<int32>::min() &&
+            max_val <= std::numeric_limits<int32>::max())
+    {
+        return DataType::INT32_ID;
+    }
+    return DataType::EMPTY_ID;
+}
+
+//---------------------------------------------------------------------------//
+// Narrowest unsigned integer type that holds [0, max_val], or EMPTY_ID if
+// none is narrower than uint64.
+//---------------------------------------------------------------------------//
+index_t
+narrow_unsigned_dtype_id(uint64 max_val)
+{
+    if(max_val <= std::numeric_limits<uint8>::max())
+    {
+        return DataType::UINT8_ID;
+    }
+    else if(max_val <= std::numeric_limits<uint16>::max())
+    {
+        return DataType::UINT16_ID;
+    }
+    else if(max_val <= std::numeric_limits<uint32>::max())
+    {
+        return DataType::UINT32_ID;
+    }
+    return DataType::EMPTY_ID;
+}
+
+//---------------------------------------------------------------------------//
+// Encodes an integer array for the index_encoding write option, if that
+// makes it smaller. "narrow" stores the values in the narrowest signed
+// type that holds their range. With use_delta, the differences between
+// consecutive values are zigzag encoded (small negative and positive
+// differences map to small unsigned values) and stored in the narrowest
+// unsigned type instead, when that type is narrower. Differences start
+// from the first value, which is returned as delta_base.
+//---------------------------------------------------------------------------//
+bool
+encode_index_array(const Node &values,
+                   bool use_delta,
+                   Node &dest,
+                   std::string &encoding,
+                   int64 &delta_base)
+{
+    const DataType &dtype = values.dtype();
+    const index_t num_vals = dtype.number_of_elements();
+    // (single values, like shape map entries, aren't worth an entry)
+    if(!dtype.is_integer() || num_vals < 2)
+    {
+        return false;
+    }
+
+    int64_accessor vals = values.as_int64_accessor();
+    int64 min_val = vals[0];
+    int64 max_val = vals[0];
+    for(index_t i = 1; i < num_vals; i++)
+    {
+        min_val = std::min(min_val, vals[i]);
+        max_val = std::max(max_val, vals[i]);
+    }
+
+    // uint64 values past the int64 range read as negative values
+    if(dtype.is_unsigned_integer() && min_val < 0)
+    {
+        return false;
+    }
+
+    index_t narrow_id = narrow_signed_dtype_id(min_val, max_val);
+    index_t narrow_bytes = narrow_id == DataType::EMPTY_ID ?
+                               dtype.element_bytes() :
+                               DataType::default_bytes(narrow_id);
+
+    // (the range check keeps differences from overflowing)
+    const int64 delta_limit = ((int64)1) << 62;
+    if(use_delta && min_val > -delta_limit && max_val < delta_limit)
+    {
+        std::vector<uint64> zigzag((size_t)num_vals);
+        uint64 zigzag_max = 0;
+        int64 prev = vals[0];
+        for(index_t i = 0; i < num_vals; i++)
+        {
+            const int64 delta = vals[i] - prev;
+            prev = vals[i];
+            zigzag[(size_t)i] = (((uint64)delta) << 1) ^
+                                (delta < 0 ? ~((uint64)0) : (uint64)0);
+            zigzag_max = std::max(zigzag_max, zigzag[(size_t)i]);
+        }
+
+        const index_t delta_id = narrow_unsigned_dtype_id(zigzag_max);
+        if(delta_id != DataType::EMPTY_ID &&
+           DataType::default_bytes(delta_id) < narrow_bytes)
+        {
+            Node zigzag_node;
+            zigzag_node.set_external(&zigzag[0], num_vals);
+            zigzag_node.to_data_type(delta_id, dest);
+            encoding = "delta";
+            delta_base = vals[0];
+            return true;
+        }
+    }
+
+    if(narrow_bytes < dtype.element_bytes())
+    {
+        values.to_data_type(narrow_id, dest);
+        encoding = "narrow";
+        return true;
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+// Encodes the integer leaves under n (at path in the domain) in place,
+// recording them in entries.
+//---------------------------------------------------------------------------//
+void
+encode_index_leaves(Node &n,
+                    const std::string &path,
+                    bool use_delta,
+                    Node &entries)
+{
+    if(n.number_of_children() > 0)
+    {
+        NodeIterator itr = n.children();
+        while(itr.has_next())
+        {
+            Node &child = itr.next();
+            encode_index_leaves(child,
+                                utils::join_path(path, itr.name()),
+                                use_delta,
+                                entries);
+        }
+        return;
+    }
+
+    Node encoded;
+    std::string encoding;
+    int64 delta_base = 0;
+    if(encode_index_array(n, use_delta, encoded, encoding, delta_base))
+    {
+        Node &entry = entries.append();
+        entry["path"] = path;
+        entry["dtype"] = n.dtype().name();
+        entry["encoding"] = encoding;
+        if(encoding == "delta")
+        {
+            entry["base"] = delta_base;
+        }
+        // n is an external view of the source data, reset drops the
+        // reference without touching that data
+        n.reset();
+        n.set(encoded);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Creates dest, a view of domain with the integer arrays of its
+// topologies, adjsets and field values encoded for the index_encoding
+// write option. The original dtypes and the encodings are listed in
+// "state/index_encoding", decode_index_arrays reverts them.
+//---------------------------------------------------------------------------//
+void
+encode_index_arrays(Node &domain,
+                    bool use_delta,
+                    Node &dest)
+{
+    dest.set_external(domain);
+
+    Node entries(DataType::list());
+    const std::string groups[] = {"topologies", "adjsets"};
+    for(const std::string &group : groups)
+    {
+        if(dest.has_child(group))
+        {
+            encode_index_leaves(dest[group], group, use_delta, entries);
+        }
+    }
+
+    if(dest.has_child("fields"))
+    {
+        NodeIterator itr = dest["fields"].children();
+        while(itr.has_next())
+        {
+            Node &field = itr.next();
+            if(field.has_child("values"))
+            {
+                encode_index_leaves(field["values"],
+                                    "fields/" + itr.name() + "/values",
+                                    use_delta,
+                                    entries);
+            }
+        }
+    }
+
+    if(entries.number_of_children() > 0)
+    {
+        dest["state/index_encoding"].set(entries);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Restores the arrays encoded by encode_index_arrays (those that were
+// read) to their original dtypes.
+//---------------------------------------------------------------------------//
+void
+decode_index_arrays(Node &domain)
+{
+    if(!domain.has_path("state/index_encoding"))
+    {
+        return;
+    }
+
+    NodeConstIterator itr = domain["state/index_encoding"].children();
+    while(itr.has_next())
+    {
+        const Node &entry = itr.next();
+        const std::string path = entry["path"].as_string();
+        // entries may have been left out by a read selection
+        if(!domain.has_path(path))
+        {
+            continue;
+        }
+
+        Node &values = domain[path];
+        const index_t dtype_id = DataType::name_to_id(entry["dtype"].as_string());
+        Node decoded;
+        if(entry["encoding"].as_string() == "delta")
+        {
+            uint64_accessor zigzag = values.as_uint64_accessor();
+            const index_t num_vals = zigzag.number_of_elements();
+            std::vector<int64> vals((size_t)std::max(num_vals, (index_t)1));
+            int64 prev = entry["base"].to_int64();
+            for(index_t i = 0; i < num_vals; i++)
+            {
+                const uint64 z = zigzag[i];
+                prev += (int64)((z >> 1) ^ (((uint64)0) - (z & 1)));
+                vals[(size_t)i] = prev;
+            }
+            Node vals_node;
+            vals_node.set_external(&vals[0], num_vals);
+            vals_node.to_data_type(dtype_id, decoded);
+        }
+        else
+        {
+            values.to_data_type(dtype_id, decoded);
+        }
+        values.set(decoded);
+    }
+
+    domain["state"].remove("index_encoding");
+}
+
+//---------------------------------------------------------------------------//
+// Removes the components of a domain that selection leaves out, used
+// for protocols that read whole domains.
+//---------------------------------------------------------------------------//
+void
+prune_domain(const Node &selection,
+             const Node &mesh_index,
+             Node &dom)
+{
+    if(selection.number_of_children() == 0)
+    {
+        return;
+    }
+
+    NodeConstIterator outer_itr = mesh_index.children();
+    while(outer_itr.has_next())
+    {
+        const Node &outer = outer_itr.next();
+        std::string outer_name = outer_itr.name();
+        if(outer_name == "state" || !dom.has_child(outer_name))
+        {
+            continue;
+        }
+
+        Node &dom_outer = dom[outer_name];
+        NodeConstIterator itr = outer.children();
+        while(itr.has_next())
+        {
+            const Node &entry = itr.next();
+            std::string entry_name = itr.name();
+            if(dom_outer.has_child(entry_name) &&
+               !read_selection_includes(selection,
+                                        mesh_index,
+                                        outer_name,
+                                        entry_name,
+                                        entry))
+            {
+                dom_outer.remove(entry_name);
+            }
+        }
+
+        if(dom_outer.number_of_children() == 0)
+        {
+            dom.remove(outer_name);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Reads the components listed in mesh_index (and passing selection) for
+// the domain at tree_path in the file opened by hnd.
+//---------------------------------------------------------------------------//
+void
+read_domain(relay::io::IOHandle &hnd,
+            const std::string &tree_path_in,
+            const Node &mesh_index,
+            const Node &selection,
+            Node &mesh_out)
+{
+    // handles for the basic protocols (json, yaml, ...) look paths up
+    // in a node, which does not accept a leading "/"
+    std::string tree_path = tree_path_in;
+    while(!tree_path.empty() && tree_path[0] == '/')
+    {
+        tree_path = tree_path.substr(1);
+    }
+
+    // read components of the mesh according to the mesh index
+    // for each child in the index
+    NodeConstIterator outer_itr = mesh_index.children();
+    while(outer_itr.has_next())
+    {
+        const Node &outer = outer_itr.next();
+        std::string outer_name = outer_itr.name();
+
+        // special logic for state, since it was not included in the index
+        if(outer_name == "state" )
+        {
+            // we do need to read the state!
+            if(outer.has_child("path"))
+            {
+                hnd.read(utils::join_path(tree_path,outer["path"].as_string()),
+                         mesh_out[outer_name]);
+            }
+            else
+            { 
+                if(outer.has_child("cycle"))
+                {
+                     mesh_out[outer_name]["cycle"] = outer["cycle"];
+                }
+
+                if(outer.has_child("time"))
+                {
+                    mesh_out[outer_name]["time"] = outer["time"];
+                }
+             }
+        }
+
+        NodeConstIterator itr = outer.children();
+        while(itr.has_next())
+        {
+            const Node &entry = itr.next();
+            std::string entry_name = itr.name();
+            // check if it has a path, and if it was selected
+            if(entry.has_child("path") &&
+               read_selection_includes(selection,
+                                       mesh_index,
+                                       outer_name,
+                                       entry_name,
+                                       entry))
+            {
+                std::string entry_path = entry["path"].as_string();
+                std::string fetch_path = utils::join_path(tree_path,
+                                                          entry_path);
+                // some parts may not exist in all domains
+                // only read if they are there
+                if(hnd.has_path(fetch_path))
+                {
+                    hnd.read(fetch_path,
+                             mesh_out[outer_name][entry_name]);
+                }
+            }
+        }
+    }
+
+    // restore arrays written with the index_encoding option
+    decode_index_arrays(mesh_out);
+}
+
+//---------------------------------------------------------------------------//
+std::string
+identify_protocol(const std::string &path)
+{
+    std::string file_path, obj_base;
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    obj_base);
+
+    std::string file_name_base, file_name_ext;
+    conduit::utils::rsplit_string(file_path,
+                                  std::string("."),
+                                  file_name_ext,
+                                  file_name_base);
+
+    std::string io_type = "bin";
+    if(file_name_ext.find("blueprint_root") == 0)
+    {
+        std::string file_name_true_ext = file_name_ext.substr(
+            std::string("blueprint_root").length(), file_name_ext.length());
+
+        // TODO: Add support for yaml protocol
+        if(file_name_true_ext == "")
+        {
+            io_type = "json";
+        }
+        else if(file_name_true_ext == "_hdf5" || file_name_true_ext == "_h5")
+        {
+            io_type = "hdf5";
+        }
+        else if(file_name_true_ext == "_silo")
+        {
+            io_type = "silo";
+        }
+    }
+
+    return io_type;
+}
+
+//---------------------------------------------------------------------------//
+// Returns the number of threads read_mesh and write_mesh use to read or
+// write num_files data files of the given protocol. The "threads" option
+// defaults to the hardware concurrency (at most 8); <= 0 also selects the
+// default. Protocols whose libraries are not thread safe use one thread.
+//---------------------------------------------------------------------------//
+index_t
+mesh_io_threads(const Node &opts,
+                const std::string &protocol,
+                index_t num_files)
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // each rank reads its own domains
+    (void) opts; (void) protocol; (void) num_files;
+    return 1;
+#else
+    index_t res = 0;
+    if(opts.has_child("threads"))
+    {
+        res = opts["threads"].to_index_t();
+    }
+
+    if(res <= 0)
+    {
+        res = std::min((index_t)8,
+                       std::max((index_t)1,
+                                (index_t)std::thread::hardware_concurrency()));
+    }
+
+    if(protocol == "hdf5" || protocol == "sidre_hdf5")
+    {
+        // hdf5 can only be called from several threads when built
+        // thread safe (and then serializes its calls)
+#if !defined(CONDUIT_RELAY_IO_HDF5_ENABLED) || !defined(H5_HAVE_THREADSAFE)
+        res = 1;
+#endif
+    }
+    else if(protocol == "silo" || protocol == "adios")
+    {
+        res = 1;
+    }
+
+    return std::max((index_t)1, std::min(res, num_files));
+#endif
+}
+
+#ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+//-----------------------------------------------------------------------------
+// Opens a silo file for writing. The file is created (truncating an
+// existing file) when create is true, otherwise it is opened to append.
+//-----------------------------------------------------------------------------
+DBfile *
+open_silo_file(const std::string &path,
+               bool create)
+{
+    DBfile *dbfile = NULL;
+    if(create)
+    {
+        dbfile = DBCreate(path.c_str(),
+                          DB_CLOBBER,
+                          DB_LOCAL,
+                          NULL,
+                          DB_HDF5);
+    }
+    else
+    {
+        dbfile = DBOpen(path.c_str(), DB_UNKNOWN, DB_APPEND);
+    }
+
+    if(dbfile == NULL)
+    {
+        CONDUIT_ERROR("Error opening Silo file for writing: " << path);
+    }
+    return dbfile;
+}
+
+//-----------------------------------------------------------------------------
+void
+close_silo_file(DBfile *dbfile,
+                const std::string &path)
+{
+    if(DBClose(dbfile) != 0)
+    {
+        CONDUIT_ERROR("Error closing Silo file: " << path);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Writes each domain to the silo directory of the same index in
+// mesh_paths of the silo file at path.
+//-----------------------------------------------------------------------------
+void
+write_silo_domains(const std::string &path,
+                   bool create,
+                   const std::vector<const Node*> &doms,
+                   const std::vector<std::string> &mesh_paths)
+{
+    DBfile *dbfile = open_silo_file(path, create);
+    try
+    {
+        for(size_t i = 0; i < doms.size(); i++)
+        {
+            relay::io::silo_mesh_write(*doms[i], dbfile, mesh_paths[i]);
+        }
+    }
+    catch(...)
+    {
+        DBClose(dbfile);
+        throw;
+    }
+    close_silo_file(dbfile, path);
+}
+
+//-----------------------------------------------------------------------------
+// Writes the silo root file of a blueprint mesh: a multimesh per topology
+// and a multivar per field over all domains, plus the blueprint root info.
+// For root_only output the domains are already in the root file.
+//-----------------------------------------------------------------------------
+void
+write_silo_root(const std::string &root_filename,
+                const Node &root,
+                const std::string &mesh_name,
+                bool root_only,
+                const Node &sample_dom)
+{
+    Node mesh_index;
+    mesh_index.set(root["blueprint_index"][mesh_name]);
+
+    // the index does not record element shapes, silo needs them to
+    // tell point meshes from ucd meshes
+    if(sample_dom.has_child("topologies"))
+    {
+        NodeConstIterator itr = sample_dom["topologies"].children();
+        while(itr.has_next())
+        {
+            const Node &topo = itr.next();
+            if(topo.has_path("elements/shape") &&
+               topo["elements/shape"].dtype().is_string() &&
+               mesh_index["topologies"].has_child(itr.name()))
+            {
+                mesh_index["topologies"][itr.name()]["elements/shape"] =
+                    topo["elements/shape"].as_string();
+            }
+        }
+    }
+
+    index_t num_domains = root["number_of_trees"].to_index_t();
+    BlueprintTreePathGenerator gen(root["file_pattern"].as_string(),
+                                   root["tree_pattern"].as_string(),
+                                   root["number_of_files"].to_index_t(),
+                                   num_domains,
+                                   "silo",
+                                   mesh_index);
+
+    std::vector<std::string> block_paths((size_t)num_domains);
+    for(index_t d = 0; d < num_domains; d++)
+    {
+        std::string block_path = gen.GenerateTreePath(d) + mesh_name;
+        if(!root_only)
+        {
+            block_path = gen.GenerateFilePath(d) + ":" + block_path;
+        }
+        block_paths[(size_t)d] = block_path;
+    }
+
+    DBfile *dbfile = open_silo_file(root_filename, !root_only);
+    try
+    {
+        relay::io::silo_write_multimesh(mesh_index, block_paths, dbfile);
+        relay::io::silo_write(root, dbfile, "blueprint_root");
+    }
+    catch(...)
+    {
+        DBClose(dbfile);
+        throw;
+    }
+    close_silo_file(dbfile, root_filename);
+}
+
+//-----------------------------------------------------------------------------
+// Returns true if root_fname is a silo file, such as the root files
+// write_mesh writes for the silo protocol.
+//-----------------------------------------------------------------------------
+bool
+is_silo_root_file(const std::string &root_fname)
+{
+    // json roots start with "{" and are never silo files, other
+    // errors are reported when the root file is read
+    char buff[6] = {0,0,0,0,0,0};
+    std::ifstream ifs;
+    ifs.open(root_fname.c_str());
+    if(!ifs.is_open() || !ifs.read((char *)buff,5))
+    {
+        return false;
+    }
+    ifs.close();
+
+    if(std::string(buff).find("{") != std::string::npos)
+    {
+        return false;
+    }
+
+    return DBInqFile(root_fname.c_str()) > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Splits a multimesh or multivar block ("file:path", or "path" for objects
+// in the root file) into the file holding it and its path in that file.
+// Files are relative to the directory of the root file.
+//-----------------------------------------------------------------------------
+void
+split_silo_block(const std::string &block,
+                 const std::string &root_fname,
+                 const std::string &root_dir,
+                 std::string &file,
+                 std::string &obj_path)
+{
+    conduit::utils::split_file_path(block,
+                                    std::string(":"),
+                                    file,
+                                    obj_path);
+    if(obj_path.empty() || file.empty())
+    {
+        obj_path = obj_path.empty() ? block : obj_path;
+        file = root_fname;
+    }
+    else if(!root_dir.empty() && file[0] != '/')
+    {
+        file = utils::join_file_path(root_dir, file);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Reads a mesh from a silo root file. The multimeshes and multivars of the
+// root are read first, then only the blocks of the selected topologies and
+// fields of this rank's domains. Roots written by write_mesh hold the
+// blueprint index, other silo files are read using one topology per
+// multimesh and one field per multivar.
+//-----------------------------------------------------------------------------
+void
+read_silo_mesh(const std::string &root_fname,
+               const Node &opts,
+               index_t rank,
+               index_t num_ranks,
+               Node &mesh)
+{
+    Node toc;
+    Node root_node;
+
+    DBfile *root_file = DBOpen(root_fname.c_str(), DB_UNKNOWN, DB_READ);
+    if(root_file == NULL)
+    {
+        CONDUIT_ERROR("Error opening Silo file for reading: " << root_fname);
+    }
+    try
+    {
+        relay::io::silo_read_multimesh_toc(root_file, toc);
+        if(DBInqVarExists(root_file, "blueprint_root_conduit_json"))
+        {
+            relay::io::silo_read(root_file, "blueprint_root", root_node);
+        }
+    }
+    catch(...)
+    {
+        DBClose(root_file);
+        throw;
+    }
+    close_silo_file(root_file, root_fname);
+
+    Node mesh_index;
+    if(root_node.has_child("blueprint_index"))
+    {
+        std::string mesh_name;
+        if(opts.has_child("mesh_name") && opts["mesh_name"].dtype().is_string())
+        {
+            mesh_name = opts["mesh_name"].as_string();
+        }
+        else
+        {
+            NodeConstIterator itr = root_node["blueprint_index"].children();
+            itr.next();
+            mesh_name = itr.name();
+        }
+
+        if(!root_node["blueprint_index"].has_child(mesh_name))
+        {
+            CONDUIT_ERROR("Mesh named '" << mesh_name << "' "
+                          << " not found in " << root_fname);
+        }
+        mesh_index.set_external(root_node["blueprint_index"][mesh_name]);
+    }
+    else
+    {
+        NodeConstIterator itr = toc["multimeshes"].children();
+        while(itr.has_next())
+        {
+            itr.next();
+            mesh_index["topologies"].add_child(itr.name())["coordset"] =
+                itr.name();
+        }
+
+        itr = toc["multivars"].children();
+        while(itr.has_next())
+        {
+            itr.next();
+            mesh_index["fields"].add_child(itr.name()).set(DataType::object());
+        }
+    }
+
+    Node selection;
+    parse_read_selection(opts, mesh_index, selection);
+
+    // the topologies and fields to read, each with its blocks
+    std::vector<std::string> topo_names;
+    std::vector<std::string> field_names;
+    index_t num_domains = -1;
+    if(mesh_index.has_child("topologies"))
+    {
+        NodeConstIterator itr = mesh_index["topologies"].children();
+        while(itr.has_next())
+        {
+            const Node &entry = itr.next();
+            std::string name = itr.name();
+            if(!toc["multimeshes"].has_child(name) ||
+               !read_selection_includes(selection,
+                                        mesh_index,
+                                        "topologies",
+                                        name,
+                                        entry))
+            {
+                continue;
+            }
+
+            index_t num_blocks = toc["multimeshes"][name]["blocks"]
+                                    .number_of_children();
+            if(num_domains >= 0 && num_blocks != num_domains)
+            {
+                CONDUIT_ERROR("silo multimesh " << name << " has "
+                              << num_blocks << " blocks, expected "
+                              << num_domains);
+            }
+            num_domains = num_blocks;
+            topo_names.push_back(name);
+        }
+    }
+
+    if(topo_names.empty())
+    {
+        CONDUIT_ERROR("read_mesh: no topologies to read in " << root_fname);
+    }
+
+    if(mesh_index.has_child("fields"))
+    {
+        NodeConstIterator itr = mesh_index["fields"].children();
+        while(itr.has_next())
+        {
+            const Node &entry = itr.next();
+            std::string name = itr.name();
+            if(toc["multivars"].has_child(name) &&
+               toc["multivars"][name]["blocks"].number_of_children()
+                    == num_domains &&
+               read_selection_includes(selection,
+                                       mesh_index,
+                                       "fields",
+                                       name,
+                                       entry))
+            {
+                field_names.push_back(name);
+            }
+        }
+    }
+
+    if(!root_node.has_child("number_of_trees"))
+    {
+        root_node["number_of_trees"] = num_domains;
+    }
+
+    std::vector<index_t> domain_ids;
+    parse_read_domains(opts, num_domains, domain_ids);
+
+    std::string root_dir, root_base;
+    utils::rsplit_file_path(root_fname, root_base, root_dir);
+
+    // the silo objects of each domain, with paths relative to the file
+    // of the domain's first topology block
+    Node domain_objects;
+    std::vector<std::string> domain_files;
+    for(size_t d = 0; d < domain_ids.size(); d++)
+    {
+        Node &objects = domain_objects.append();
+        std::string dom_file;
+
+        for(int kind = 0; kind < 2; kind++)
+        {
+            const std::vector<std::string> &names = kind == 0 ? topo_names
+                                                              : field_names;
+            const Node &toc_kind = toc[kind == 0 ? "multimeshes"
+                                                 : "multivars"];
+            const char *index_kind = kind == 0 ? "topologies" : "fields";
+
+            for(size_t i = 0; i < names.size(); i++)
+            {
+                std::string block = toc_kind[names[i]]["blocks"]
+                                        .child(domain_ids[d]).as_string();
+                // silo marks blocks without data as "EMPTY"
+                if(block == "EMPTY")
+                {
+                    continue;
+                }
+
+                std::string file, obj_path;
+                split_silo_block(block, root_fname, root_dir, file, obj_path);
+                if(dom_file.empty())
+                {
+                    dom_file = file;
+                }
+
+                Node &n_obj = objects[index_kind].add_child(names[i]);
+                n_obj["path"] = file == dom_file ? obj_path
+                                                 : file + ":" + obj_path;
+
+                const Node &entry = mesh_index[index_kind][names[i]];
+                if(kind == 0 && entry.has_child("coordset"))
+                {
+                    n_obj["coordset"] = entry["coordset"].as_string();
+                }
+                else if(kind == 1 && entry.has_child("topology") &&
+                        entry["topology"].dtype().is_string())
+                {
+                    n_obj["topology"] = entry["topology"].as_string();
+                }
+            }
+        }
+
+        domain_files.push_back(dom_file.empty() ? root_fname : dom_file);
+    }
+
+    // the entries of domain_ids this rank reads
+    std::vector<index_t> reads;
+    assign_read_domains(opts,
+                        root_node,
+                        domain_ids,
+                        domain_files,
+                        rank,
+                        num_ranks,
+                        reads);
+
+    // group the domains by file, so each file is opened once
+    std::vector<std::string> files;
+    std::vector<std::vector<index_t> > file_domains;
+    std::map<std::string, index_t> file_ids;
+    std::vector<Node *> domain_nodes;
+    for(size_t r = 0; r < reads.size(); r++)
+    {
+        const std::string &domain_file = domain_files[(size_t)reads[r]];
+        std::map<std::string, index_t>::iterator fitr = file_ids.find(domain_file);
+        if(fitr == file_ids.end())
+        {
+            fitr = file_ids.insert(std::make_pair(domain_file,
+                                                  (index_t)files.size())).first;
+            files.push_back(domain_file);
+            file_domains.push_back(std::vector<index_t>());
+        }
+        file_domains[(size_t)fitr->second].push_back((index_t)r);
+
+        std::string mesh_path = conduit_fmt::format("domain_{:06d}",
+                                                    domain_ids[(size_t)reads[r]]);
+        domain_nodes.push_back(&mesh[mesh_path]);
+    }
+
+    // silo is not thread safe, this reads one file at a time
+    index_t num_threads = mesh_io_threads(opts,
+                                          "silo",
+                                          (index_t)files.size());
+
+    relay::io::detail::run_tasks((index_t)files.size(),
+                                 num_threads,
+                                 [&](index_t f)
+    {
+        DBfile *dbfile = DBOpen(files[(size_t)f].c_str(),
+                                DB_UNKNOWN,
+                                DB_READ);
+        if(dbfile == NULL)
+        {
+            CONDUIT_ERROR("Error opening Silo file for reading: "
+                          << files[(size_t)f]);
+        }
+
+        try
+        {
+            const std::vector<index_t> &doms = file_domains[(size_t)f];
+            for(size_t di = 0; di < doms.size(); di++)
+            {
+                index_t r = doms[di];
+                Node &dom = *domain_nodes[(size_t)r];
+                relay::io::silo_mesh_read(dbfile,
+                                          domain_objects.child(reads[(size_t)r]),
+                                          dom);
+
+                // prefer the state recorded in the index
+                if(mesh_index.has_child("state"))
+                {
+                    const Node &state = mesh_index["state"];
+                    if(state.has_child("cycle"))
+                    {
+                        dom["state/cycle"] = state["cycle"];
+                    }
+                    if(state.has_child("time"))
+                    {
+                        dom["state/time"] = state["time"];
+                    }
+                }
+            }
+        }
+        catch(...)
+        {
+            DBClose(dbfile);
+            throw;
+        }
+        close_silo_file(dbfile, files[(size_t)f]);
+    });
+}
+#endif
+
+
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::<mpi>::io_blueprint::detail --
+//-----------------------------------------------------------------------------
+};
+
+
+//-----------------------------------------------------------------------------
+// Sig variants of save_mesh
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void save_mesh(const Node &mesh,
+                const std::string &path
+                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    // empty opts
+    Node opts;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    save_mesh(mesh,
+              path,
+              detail::identify_protocol(path),
+              opts,
+              mpi_comm);
+#else
+    save_mesh(mesh,
               path,
               detail::identify_protocol(path),
               opts);
@@ -574,1089 +2238,2821 @@ void save_mesh(const Node &mesh,
 }
 
 //-----------------------------------------------------------------------------
-void save_mesh(const Node &mesh,
-                const std::string &path,
-                const std::string &protocol
-                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+void save_mesh(const Node &mesh,
+                const std::string &path,
+                const std::string &protocol
+                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    // empty opts
+    Node opts;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    save_mesh(mesh,
+              path,
+              protocol,
+              opts,
+              mpi_comm);
+#else
+    save_mesh(mesh,
+              path,
+              protocol,
+              opts);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Main Mesh Blueprint Save, taken from Ascent
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+/// The following options can be passed via the opts Node:
+//-----------------------------------------------------------------------------
+/// opts:
+///      file_style: "default", "root_only", "multi_file"
+///            when # of domains == 1,  "default"   ==> "root_only"
+///            else,                    "default"   ==> "multi_file"
+///
+///      suffix: "default", "cycle", "none" 
+///            when # of domains == 1,  "default"   ==> "none"
+///            else,                    "default"   ==> "cycle"
+///
+///      mesh_name:  (used if present, default ==> "mesh")
+///
+///      number_of_files:  {# of files}
+///            when "multi_file":
+///                 <= 0, use # of files == # of domains
+///                  > 0, # of files == number_of_files
+///
+///      static_topology: "none", "hash", "assume" (default ==> "none")
+///            with hdf5 and one file per domain, coordsets and topologies
+///            written by an earlier call (with the same path, to other
+///            files) are stored as external links to them.
+///                 "hash", only link entries whose contents are unchanged
+///                 "assume", link them without checking
+///
+///      index_encoding: "none", "narrow", "delta" (default ==> "none")
+///            integer arrays of topologies, adjsets and field values
+///            (connectivity, offsets, global ids, ...) are stored in the
+///            narrowest integer type that holds their values. read_mesh
+///            restores their original dtypes. (not used with silo)
+///                 "narrow", narrow the values
+///                 "delta", also try zigzag encoded differences of
+///                  consecutive values (small for sorted ids) and store
+///                  those when they are narrower
+///
+///      threads: {number of threads}
+///            when "multi_file", write this many data files at once, each
+///            on its own thread with its own handle (default: the hardware
+///            concurrency, at most 8). The root file is written after all
+///            data files. HDF5 files are written on one thread unless
+///            HDF5 was built thread safe, silo files and static_topology
+///            links always are. (without MPI only, with MPI each rank
+///            writes its files on one thread)
+///
+///      number_of_aggregators:  {# of ranks that write files}
+///            when "multi_file" and # of files < # of domains:
+///                 <= 0, use one aggregator rank per file
+///                  > 0, # of aggregators == number_of_aggregators
+///            (at most # of files and # of mpi tasks)
+///
+//-----------------------------------------------------------------------------
+void save_mesh(const Node &mesh,
+                const std::string &path,
+                const std::string &protocol,
+                const Node &opts
+                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    // we force overwrite to true, so we need a copy of the const opts passed.
+    Node save_opts;
+    save_opts.set(opts);
+    save_opts["truncate"] = "true";
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    write_mesh(mesh,
+               path,
+               protocol,
+               save_opts,
+               mpi_comm);
+#else
+    write_mesh(mesh,
+               path,
+               protocol,
+               save_opts);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Sig variants of write_mesh
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void write_mesh(const Node &mesh,
+                const std::string &path
+                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    // empty opts
+    Node opts;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    write_mesh(mesh,
+               path,
+               detail::identify_protocol(path),
+               opts,
+               mpi_comm);
+#else
+    write_mesh(mesh,
+               path,
+               detail::identify_protocol(path),
+               opts);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void write_mesh(const Node &mesh,
+                const std::string &path,
+                const std::string &protocol
+                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    // empty opts
+    Node opts;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    write_mesh(mesh,
+               path,
+               protocol,
+               opts,
+               mpi_comm);
+#else
+    write_mesh(mesh,
+               path,
+               protocol,
+               opts);
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// Main Mesh Blueprint Save, taken from Ascent
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+/// The following options can be passed via the opts Node:
+//-----------------------------------------------------------------------------
+/// opts:
+///      file_style: "default", "root_only", "multi_file"
+///            when # of domains == 1,  "default"   ==> "root_only"
+///            else,                    "default"   ==> "multi_file"
+///
+///      suffix: "default", "cycle", "none" 
+///            when # of domains == 1,  "default"   ==> "none"
+///            else,                    "default"   ==> "cycle"
+///
+///      mesh_name:  (used if present, default ==> "mesh")
+///
+///      number_of_files:  {# of files}
+///            when "multi_file":
+///                 <= 0, use # of files == # of domains
+///                  > 0, # of files == number_of_files
+///
+///      static_topology: "none", "hash", "assume" (default ==> "none")
+///            with hdf5 and one file per domain, coordsets and topologies
+///            written by an earlier call (with the same path, to other
+///            files) are stored as external links to them.
+///                 "hash", only link entries whose contents are unchanged
+///                 "assume", link them without checking
+///
+///      index_encoding: "none", "narrow", "delta" (default ==> "none")
+///            integer arrays of topologies, adjsets and field values
+///            (connectivity, offsets, global ids, ...) are stored in the
+///            narrowest integer type that holds their values. read_mesh
+///            restores their original dtypes. (not used with silo)
+///                 "narrow", narrow the values
+///                 "delta", also try zigzag encoded differences of
+///                  consecutive values (small for sorted ids) and store
+///                  those when they are narrower
+///
+///      threads: {number of threads}
+///            when "multi_file", write this many data files at once, each
+///            on its own thread with its own handle (default: the hardware
+///            concurrency, at most 8). The root file is written after all
+///            data files. HDF5 files are written on one thread unless
+///            HDF5 was built thread safe, silo files and static_topology
+///            links always are. (without MPI only, with MPI each rank
+///            writes its files on one thread)
+///
+///      number_of_aggregators:  {# of ranks that write files}
+///            when "multi_file" and # of files < # of domains:
+///                 <= 0, use one aggregator rank per file
+///                  > 0, # of aggregators == number_of_aggregators
+///            (at most # of files and # of mpi tasks)
+///
+//-----------------------------------------------------------------------------
+void write_mesh(const Node &mesh,
+                const std::string &path,
+                const std::string &file_protocol,
+                const Node &opts
+                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    CONDUIT_ANNOTATE_MARK_SCOPE("relay::io::blueprint::write_mesh");
+
+    // The assumption here is that everything is multi domain
+
+    std::string opts_file_style = "default";
+    std::string opts_suffix     = "default";
+    std::string opts_mesh_name  = "mesh";
+    int         opts_num_files  = -1;
+    int         opts_num_aggs   = -1;
+    bool        opts_truncate   = false;
+    std::string opts_static_topo = "none";
+    std::string opts_index_encoding = "none";
+
+    // check for + validate file_style option
+    if(opts.has_child("file_style") && opts["file_style"].dtype().is_string())
+    {
+        opts_file_style = opts["file_style"].as_string();
+
+        if(opts_file_style != "default" && 
+           opts_file_style != "root_only" &&
+           opts_file_style != "multi_file" )
+        {
+            CONDUIT_ERROR("write_mesh invalid file_style option: \"" 
+                          << opts_file_style << "\"\n"
+                          " expected: \"default\", \"root_only\", "
+                          "or \"multi_file\"");
+        }
+
+    }
+
+    // check for + validate suffix option
+    if(opts.has_child("suffix") && opts["suffix"].dtype().is_string())
+    {
+        opts_suffix = opts["suffix"].as_string();
+
+        if(opts_suffix != "default" && 
+           opts_suffix != "cycle" &&
+           opts_suffix != "none" )
+        {
+            CONDUIT_ERROR("write_mesh invalid suffix option: \"" 
+                          << opts_suffix << "\"\n"
+                          " expected: \"default\", \"cycle\", or \"none\"");
+        }
+    }
+    
+    // check for + validate suffix option
+    if(opts.has_child("mesh_name") && opts["mesh_name"].dtype().is_string())
+    {
+        opts_mesh_name = opts["mesh_name"].as_string();
+    }
+    
+
+    // check for number_of_files, 0 or -1 implies #files => # domains
+    if(opts.has_child("number_of_files") && opts["number_of_files"].dtype().is_integer())
+    {
+        opts_num_files = (int) opts["number_of_files"].to_int();
+    }
+
+    // check for number_of_aggregators, 0 or -1 implies one per file
+    if(opts.has_child("number_of_aggregators") &&
+       opts["number_of_aggregators"].dtype().is_integer())
+    {
+        opts_num_aggs = (int) opts["number_of_aggregators"].to_int();
+    }
+
+    // check for truncate (overwrite)
+    if(opts.has_child("truncate") && opts["truncate"].dtype().is_string())
+    {
+        const std::string ow_string = opts["truncate"].as_string();
+        if(ow_string == "true")
+            opts_truncate = true;
+    }
+
+    // check for + validate static_topology option
+    if(opts.has_child("static_topology") &&
+       opts["static_topology"].dtype().is_string())
+    {
+        opts_static_topo = opts["static_topology"].as_string();
+
+        if(opts_static_topo != "none" &&
+           opts_static_topo != "hash" &&
+           opts_static_topo != "assume")
+        {
+            CONDUIT_ERROR("write_mesh invalid static_topology option: \""
+                          << opts_static_topo << "\"\n"
+                          " expected: \"none\", \"hash\", or \"assume\"");
+        }
+    }
+
+    // check for + validate index_encoding option
+    if(opts.has_child("index_encoding") &&
+       opts["index_encoding"].dtype().is_string())
+    {
+        opts_index_encoding = opts["index_encoding"].as_string();
+
+        if(opts_index_encoding != "none" &&
+           opts_index_encoding != "narrow" &&
+           opts_index_encoding != "delta")
+        {
+            CONDUIT_ERROR("write_mesh invalid index_encoding option: \""
+                          << opts_index_encoding << "\"\n"
+                          " expected: \"none\", \"narrow\", or \"delta\"");
+        }
+    }
+
+    int num_files = opts_num_files;
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // nodes used for MPI comm (share them for many operations)
+    Node n_local, n_reduced;
+#endif
+
+    // -----------------------------------------------------------
+    // make sure some MPI taks has data
+    // -----------------------------------------------------------
+    Node multi_dom;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    bool is_valid = detail::clean_mesh(mesh, multi_dom, mpi_comm);
+#else
+    bool is_valid = detail::clean_mesh(mesh, multi_dom);
+#endif
+
+    // -----------------------------------------------------------
+    // encode index arrays (the encoded domains view the source
+    // domains for everything else, which are kept in source_doms)
+    // -----------------------------------------------------------
+    Node source_doms;
+    if(opts_index_encoding != "none" && file_protocol != "silo")
+    {
+        Node encoded_doms;
+        for(index_t i = 0; i < multi_dom.number_of_children(); i++)
+        {
+            detail::encode_index_arrays(multi_dom.child(i),
+                                        opts_index_encoding == "delta",
+                                        encoded_doms.append());
+        }
+        source_doms.swap(multi_dom);
+        multi_dom.swap(encoded_doms);
+    }
+
+    int par_rank = 0;
+    int par_size = 1;
+    // we may not have any domains so init to max
+    int cycle = std::numeric_limits<int>::max();
+
+    int local_boolean = is_valid ? 1 : 0;
+    int global_boolean = local_boolean;
+
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    par_rank = relay::mpi::rank(mpi_comm);
+    par_size = relay::mpi::size(mpi_comm);
+
+    // reduce to check to see if any valid data exists
+
+    n_local = (int)cycle;
+    relay::mpi::sum_all_reduce(n_local,
+                               n_reduced,
+                               mpi_comm);
+
+    global_boolean = n_reduced.as_int();
+
+#endif
+
+    if(global_boolean == 0)
+    {
+      CONDUIT_INFO("Blueprint save: no valid data exists. Skipping save");
+      return;
+    }
+
+    // -----------------------------------------------------------
+    // get the number of local domains and the cycle info
+    // -----------------------------------------------------------
+
+    int local_num_domains = (int)multi_dom.number_of_children();
+    // figure out what cycle we are
+    if(local_num_domains > 0 && is_valid)
+    {
+        const Node &dom = multi_dom.child(0);
+        if(!dom.has_path("state/cycle"))
+        {
+            if(opts_suffix == "cycle")
+            {
+                static std::map<std::string,int> counters;
+                CONDUIT_INFO("Blueprint save: no 'state/cycle' present."
+                             " Defaulting to counter");
+                cycle = counters[path];
+                counters[path]++;
+            }
+            else
+            {
+                opts_suffix = "none";
+            }
+        }
+        else if(opts_suffix == "default")
+        {
+            cycle = dom["state/cycle"].to_int();
+            opts_suffix = "cycle";
+        }
+    }
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // reduce to get the cycle (some tasks might not have domains)
+    n_local = (int)cycle;
+
+    relay::mpi::min_all_reduce(n_local,
+                               n_reduced,
+                               mpi_comm);
+
+    cycle = n_reduced.as_int();
+#endif
+    
+    // -----------------------------------------------------------
+    // find the # of global domains
+    // -----------------------------------------------------------
+    int global_num_domains = (int)local_num_domains;
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    n_local = local_num_domains;
+
+    relay::mpi::sum_all_reduce(n_local,
+                               n_reduced,
+                               mpi_comm);
+
+    global_num_domains = n_reduced.as_int();
+#endif
+
+    if(global_num_domains == 0)
+    {
+      if(par_rank == 0)
+      {
+          CONDUIT_WARN("There no data to save. Doing nothing.");
+      }
+      return;
+    }
+
+    std::string output_dir = "";
+
+    // resolve file_style == default
+    // 
+    // default implies multi_file if more than one domain
+    if(opts_file_style == "default")
+    {
+        if( global_num_domains > 1)
+        {
+            opts_file_style = "multi_file";
+        }
+        else // other wise, use root only
+        {
+            opts_file_style = "root_only";
+        }
+    }
+
+    // ----------------------------------------------------
+    // if using multi_file, create output dir
+    // ----------------------------------------------------
+    if(opts_file_style == "multi_file")
+    {
+        // setup the directory
+        output_dir = path;
+        // at this point for suffix, we should only see
+        // cycle or none -- default has been resolved
+        if(opts_suffix == "cycle")
+        {
+            output_dir += conduit_fmt::format(".cycle_{:06d}",cycle);
+        }
+
+        bool dir_ok = false;
+
+        // let rank zero handle dir creation
+        if(par_rank == 0)
+        {
+            // check of the dir exists
+            dir_ok = utils::is_directory(output_dir);
+            if(!dir_ok)
+            {
+                // if not try to let rank zero create it
+                dir_ok = utils::create_directory(output_dir);
+            }
+        }
+
+        // make sure everyone knows if dir creation was successful 
+
+        #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+        // use an mpi sum to check if the dir exists
+        n_local = dir_ok ? 1 : 0;
+
+        relay::mpi::sum_all_reduce(n_local,
+                                   n_reduced,
+                                   mpi_comm);
+
+        dir_ok = (n_reduced.as_int() == 1);
+        #endif
+
+        if(!dir_ok)
+        {
+            CONDUIT_ERROR("Error: failed to create directory " << output_dir);
+        }
+    }
+
+
+    // ----------------------------------------------------
+    // setup root file name
+    // ----------------------------------------------------
+    std::string root_filename = path;
+
+    // at this point for suffix, we should only see 
+    // cycle or none -- default has been resolved
+    if(opts_suffix == "cycle")
+    {
+        root_filename += conduit_fmt::format(".cycle_{:06d}",cycle);
+    }
+
+    root_filename += ".root";
+    // oss << ".root";
+
+    // std::string root_filename = oss.str();
+
+    // zero or negative (default cases), use one file per domain
+    if(num_files <= 0)
+    {
+        num_files = global_num_domains;
+    }
+
+    // if global domains > num_files, warn and use one file per domain
+    if(global_num_domains < num_files)
+    {
+        CONDUIT_INFO("Requested more files than actual domains, "
+                     "writing one file per domain");
+        num_files = global_num_domains;
+    }
+
+    // at this point for file_style,
+    // default has been resolved, we need to just handle:
+    //   root_only, multi_file
+    if(opts_file_style == "root_only")
+    {
+        // if truncate, first touch needs to open the file with
+        //          open_opts["mode"] = "wt";
+
+        // write out local domains, since all tasks will
+        // write to single file in this case, we need baton.
+        // the outer loop + par_rank == current_writer implements
+        // the baton.
+
+        
+        Node local_root_file_created;
+        Node global_root_file_created;
+        local_root_file_created.set((int)0);
+        global_root_file_created.set((int)0);
+
+        for(int current_writer=0; current_writer < par_size; current_writer++)
+        {
+            if(par_rank == current_writer)
+            {
+                relay::io::IOHandle hnd;
+            #ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+                std::vector<const Node*> silo_doms;
+                std::vector<std::string> silo_mesh_paths;
+            #endif
+
+                for(int i = 0; i < local_num_domains; ++i)
+                {
+                    const Node &dom = multi_dom.child(i);
+                    // figure out the proper mesh path the file
+                    std::string mesh_path = "";
+
+                    if(global_num_domains == 1)
+                    {
+                        // no domain prefix, write to mesh name
+                        mesh_path = opts_mesh_name;
+                    }
+                    else
+                    {
+                        // multiple domains, we need to use a domain prefix
+                        uint64 domain = dom["state/domain_id"].to_uint64();
+                        mesh_path = conduit_fmt::format("domain_{:06d}/{}",
+                                                        domain,
+                                                        opts_mesh_name);
+                    }
+
+                #ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+                    if(file_protocol == "silo")
+                    {
+                        silo_doms.push_back(&dom);
+                        silo_mesh_paths.push_back(mesh_path);
+                        continue;
+                    }
+                #endif
+
+                    // if truncate, first rank to touch the file needs
+                    // to open at
+                    if( !hnd.is_open()
+                        && (global_root_file_created.as_int() == 0)
+                        && opts_truncate)
+                    {
+                        Node open_opts;
+                        open_opts["mode"] = "wt";
+                        hnd.open(root_filename,file_protocol,open_opts);
+                        local_root_file_created.set((int)1);
+                    }
+                    
+                    if(!hnd.is_open())
+                    {
+                        hnd.open(root_filename,file_protocol);
+                    }
+
+                    hnd.write(dom,mesh_path);
+                }
+
+            #ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+                // silo files are not shared between writers, the first
+                // rank to touch the file creates it
+                if(!silo_doms.empty())
+                {
+                    bool create = (global_root_file_created.as_int() == 0) &&
+                                  (opts_truncate ||
+                                   !utils::is_file(root_filename));
+                    detail::write_silo_domains(root_filename,
+                                               create,
+                                               silo_doms,
+                                               silo_mesh_paths);
+                    local_root_file_created.set((int)1);
+                }
+            #endif
+                
+                // note: local file handle goes out of scope here
+                // and data is committed to file for handles that write
+                // on close
+            }
+
+        // Reduce to sync up (like a barrier) and solve first writer need
+        #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+            mpi::max_all_reduce(local_root_file_created,
+                                global_root_file_created,
+                                mpi_comm);
+        #else
+            global_root_file_created.set(local_root_file_created);
+        #endif
+        }
+    }
+    else if(global_num_domains == num_files)
+    {
+        // write out each domain
+        // writes are independent, so no baton here, and (without mpi)
+        // the domain files are written on several threads.
+        // static topology links share the entries of earlier calls,
+        // so they are written on one thread
+        index_t num_threads = detail::mesh_io_threads(opts,
+                                                      file_protocol,
+                                                      local_num_domains);
+        if(opts_static_topo != "none")
+        {
+            num_threads = 1;
+        }
+
+        relay::io::detail::run_tasks(local_num_domains,
+                                     num_threads,
+                                     [&](index_t i)
+        {
+            const Node &dom = multi_dom.child(i);
+            uint64 domain = dom["state/domain_id"].to_uint64();
+
+            std::string output_file  = conduit::utils::join_file_path(output_dir,
+                                                conduit_fmt::format("domain_{:06d}.{}",
+                                                                    domain,
+                                                                    file_protocol));
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+            // link the coordsets and topologies written by earlier calls
+            if(file_protocol == "hdf5" && opts_static_topo != "none")
+            {
+                detail::write_hdf5_domain_with_static_links(dom,
+                    output_file,
+                    opts_mesh_name,
+                    conduit_fmt::format("{}:{}/domain_{:06d}",
+                                        path,
+                                        opts_mesh_name,
+                                        domain),
+                    opts_static_topo == "hash",
+                    opts_truncate);
+                return;
+            }
+#endif
+
+#ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+            // each silo domain file is written in one go
+            if(file_protocol == "silo")
+            {
+                detail::write_silo_domains(output_file,
+                                           true,
+                                           std::vector<const Node*>(1, &dom),
+                                           std::vector<std::string>(1, opts_mesh_name));
+                return;
+            }
+#endif
+
+            // properly support truncate vs non truncate
+
+            relay::io::IOHandle hnd;
+            Node open_opts;
+            open_opts["mode"] = "w";
+            if(opts_truncate)
+            {
+               open_opts["mode"] = "wt";
+            }
+
+            // open our handle
+            hnd.open(output_file, open_opts);
+            // write to  mesh name subpath
+            hnd.write(dom, opts_mesh_name);
+        });
+    }
+    else // more complex case, N domains to M files
+    {
+        //
+        // recall: we have re-labeled domain ids from 0 - > N-1, however
+        // some mpi tasks may have no data.
+        //
+        // Each file is written by a single aggregator rank. The files
+        // are dealt round robin to the aggregators, which gather the
+        // domains of their files from all ranks and then write each of
+        // their files in one sweep. No rank waits on the writes of
+        // another rank.
+        //
+        Node books;
+        detail::gen_domain_to_file_map(global_num_domains,
+                                       num_files,
+                                       books);
+        index_t_accessor global_d2f = books["global_domain_to_file"].value();
+
+        int num_aggs = detail::number_of_aggregators(opts_num_aggs,
+                                                     num_files,
+                                                     par_size);
+
+        // domains this rank writes, as file_{:06d}/domain_{:06d}
+        Node agg_doms;
+    #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+        // holds the domains gathered by this rank
+        Node agg_gathered;
+    #endif
+
+        for(int a = 0; a < num_aggs; ++a)
+        {
+            // the local domains destined for the files of this aggregator
+            Node send_doms;
+            for(int d = 0; d < local_num_domains; ++d)
+            {
+                Node &dom = multi_dom.child(d);
+                uint64 domain_id = dom["state/domain_id"].to_uint64();
+                index_t f = global_d2f[domain_id];
+                if(f % num_aggs == a)
+                {
+                    std::string dom_path = conduit_fmt::format(
+                                                "file_{:06d}/domain_{:06d}",
+                                                f,
+                                                domain_id);
+                    send_doms[dom_path].set_external(dom);
+                }
+            }
+
+        #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+            int agg_rank = detail::aggregator_rank(a, num_aggs, par_size);
+            if(par_rank == agg_rank)
+            {
+                // one child per rank
+                Node &recv_doms = agg_gathered.append();
+                mpi::gather_using_schema(send_doms,
+                                         recv_doms,
+                                         agg_rank,
+                                         mpi_comm);
+                NodeIterator itr = recv_doms.children();
+                while(itr.has_next())
+                {
+                    detail::add_file_domains_external(itr.next(), agg_doms);
+                }
+            }
+            else
+            {
+                Node recv_doms;
+                mpi::gather_using_schema(send_doms,
+                                         recv_doms,
+                                         agg_rank,
+                                         mpi_comm);
+            }
+        #else
+            detail::add_file_domains_external(send_doms, agg_doms);
+        #endif
+        }
+
+        int local_all_is_good  = 1;
+        int global_all_is_good = 1;
+
+        books["local_all_is_good"].set_external(&local_all_is_good,1);
+        books["global_all_is_good"].set_external(&global_all_is_good,1);
+
+        std::string local_io_exception_msg = "";
+
+        // write each of our files in one sweep (without mpi, the files
+        // are written on several threads)
+        index_t num_threads = detail::mesh_io_threads(opts,
+                                                      file_protocol,
+                                                      agg_doms.number_of_children());
+        try
+        {
+            relay::io::detail::run_tasks(agg_doms.number_of_children(),
+                                         num_threads,
+                                         [&](index_t f)
+            {
+                const Node &file_doms = agg_doms.child(f);
+                // pattern is:
+                //  file_%06llu.{protocol}:/domain_%06llu/...
+                std::string output_file = conduit::utils::join_file_path(output_dir,
+                                                    file_doms.name() + "." +
+                                                    file_protocol);
+            #ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+                // each silo file is written in one go by its aggregator
+                if(file_protocol == "silo")
+                {
+                    std::vector<const Node*> silo_doms;
+                    std::vector<std::string> silo_mesh_paths;
+                    NodeConstIterator doms_itr = file_doms.children();
+                    while(doms_itr.has_next())
+                    {
+                        silo_doms.push_back(&doms_itr.next());
+                        silo_mesh_paths.push_back(doms_itr.name() + "/" +
+                                                  opts_mesh_name);
+                    }
+                    detail::write_silo_domains(output_file,
+                                               true,
+                                               silo_doms,
+                                               silo_mesh_paths);
+                    return;
+                }
+            #endif
+
+                Node open_opts;
+                if(opts_truncate)
+                {
+                    open_opts["mode"] = "wt";
+                }
+
+                relay::io::IOHandle hnd;
+                hnd.open(output_file, open_opts);
+
+                NodeConstIterator doms_itr = file_doms.children();
+                while(doms_itr.has_next())
+                {
+                    const Node &dom = doms_itr.next();
+                    hnd.write(dom, doms_itr.name() + "/" + opts_mesh_name);
+                }
+            });
+        }
+        catch(conduit::Error &e)
+        {
+            local_all_is_good = 0;
+            local_io_exception_msg = e.message();
+        }
+
+        // if any I/O errors happened stop and have all
+        // tasks bail out with an exception (to avoid hangs)
+        #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+            mpi::min_all_reduce(books["local_all_is_good"],
+                                books["global_all_is_good"],
+                                mpi_comm);
+        #else
+            global_all_is_good = local_all_is_good;
+        #endif
+
+        if(global_all_is_good == 0)
+        {
+            std::string emsg = "Failed to write mesh data on one more more ranks.";
+
+            if(!local_io_exception_msg.empty())
+            {
+                 emsg += conduit_fmt::format("Exception details from rank {}: {}.",
+                                             par_rank, local_io_exception_msg);
+            }
+            CONDUIT_ERROR(emsg);
+        }
+    }
+
+    int root_file_writer = 0;
+    if(local_num_domains == 0)
+    {
+        root_file_writer = -1;
+    }
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // Rank 0 could have an empty domain, so we have to check
+    // to find someone with a data set to write out the root file.
+    Node out;
+    out = local_num_domains;
+    Node rcv;
+
+    mpi::all_gather_using_schema(out, rcv, mpi_comm);
+    root_file_writer = -1;
+    int* res_ptr = (int*)rcv.data_ptr();
+    for(int i = 0; i < par_size; ++i)
+    {
+        if(res_ptr[i] != 0)
+        {
+            root_file_writer = i;
+            break;
+        }
+    }
+
+    MPI_Barrier(mpi_comm);
+#endif
+
+    if(root_file_writer == -1)
+    {
+        // this should not happen. global doms is already 0
+        CONDUIT_WARN("Relay: there are no domains to write out");
+    }
+
+    // generate the bp index
+    Node local_bp_idx, bp_idx;
+    if(local_num_domains > 0)
+    {
+        ::conduit::blueprint::mesh::generate_index(multi_dom,
+                                                   opts_mesh_name,
+                                                   global_num_domains,
+                                                   local_bp_idx);
+    }
+    // handle mpi case. 
+    // this logic is from the mpi ver of mesh index gen
+    // it is duplicated here b/c we dont want a circular dep
+    // between conduit_blueprint_mpi and conduit_relay_io_mpi
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // union all entries into final index that reps
+    // all domains, only the root file writer needs it
+    if(root_file_writer >= 0)
+    {
+        relay::mpi::union_using_schema(local_bp_idx,
+                                       bp_idx[opts_mesh_name],
+                                       root_file_writer,
+                                       mpi_comm);
+    }
+#else
+    bp_idx[opts_mesh_name] = local_bp_idx;
+#endif
+
+    // the size of each domain, so readers can balance their reads
+    Node domain_sizes;
+    detail::gen_domain_sizes(multi_dom, global_num_domains, domain_sizes);
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    if(root_file_writer >= 0)
+    {
+        relay::mpi::sum_reduce(domain_sizes,
+                               n_reduced,
+                               root_file_writer,
+                               mpi_comm);
+        domain_sizes.set(n_reduced);
+    }
+#endif
+
+    // root_file_writer will now write out the root file
+    if(par_rank == root_file_writer)
+    {
+        std::string output_dir_base, output_dir_path;
+        conduit::utils::rsplit_file_path(output_dir,
+                                         output_dir_base,
+                                         output_dir_path);
+
+        std::string output_tree_pattern;
+        std::string output_file_pattern;
+
+        // NOTE: 
+        // The file pattern needs to be relative to
+        // the root file. 
+        // reverse split the path
+
+
+        if(opts_file_style == "root_only")
+        {
+            // make sure this is relative to output dir
+            std::string tmp;
+            utils::rsplit_path(root_filename,
+                               output_file_pattern,
+                               tmp);
+
+            if(global_num_domains == 1)
+            {
+                output_tree_pattern = "/";
+            }
+            else
+            {
+                output_tree_pattern = "/domain_%06d/";
+            }
+        }
+        else if(global_num_domains == num_files)
+        {
+            std::string tmp;
+            utils::rsplit_path(output_dir_base,
+                               output_file_pattern,
+                               tmp);
+            output_file_pattern = conduit::utils::join_file_path(
+                                                output_file_pattern,
+                                                "domain_%06d." + file_protocol);
+            output_tree_pattern = "/";
+        }
+        else
+        {
+            std::string tmp;
+            utils::rsplit_path(output_dir_base,
+                               output_file_pattern,
+                               tmp);
+            output_file_pattern = conduit::utils::join_file_path(
+                                                output_file_pattern,
+                                                "file_%06d." + file_protocol);
+            output_tree_pattern = "/domain_%06d";
+        }
+
+        Node root;
+        root["blueprint_index"].set(bp_idx);
+
+
+        // work around conduit and manually add state fields
+        if(multi_dom.child(0).has_path("state/cycle"))
+        {
+          bp_idx[ opts_mesh_name + "/state/cycle"] = multi_dom.child(0)["state/cycle"].to_int32();
+        }
+
+        if(multi_dom.child(0).has_path("state/time"))
+        {
+          bp_idx[opts_mesh_name + "/state/time"] = multi_dom.child(0)["state/time"].to_double();
+        }
+
+        root["protocol/name"]    = file_protocol;
+        root["protocol/version"] = CONDUIT_VERSION;
+
+        root["number_of_files"]  = num_files;
+        root["number_of_trees"]  = global_num_domains;
+
+        root["file_pattern"] = output_file_pattern;
+        root["tree_pattern"] = output_tree_pattern;
+
+        int64 *sizes_ptr = domain_sizes.value();
+        root["domain_sizes/bytes"].set(sizes_ptr, global_num_domains);
+        root["domain_sizes/elements"].set(sizes_ptr + global_num_domains,
+                                          global_num_domains);
+
+    #ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+        if(file_protocol == "silo")
+        {
+            detail::write_silo_root(root_filename,
+                                    root,
+                                    opts_mesh_name,
+                                    opts_file_style == "root_only",
+                                    multi_dom.child(0));
+        }
+        else
+    #endif
+        {
+            relay::io::IOHandle hnd;
+
+            // if not root only, this is the first time we are writing 
+            // to the root file -- make sure to properly support truncate
+            Node open_opts;
+            if(opts_file_style != "root_only" && opts_truncate)
+            {
+                open_opts["mode"] = "wt";
+            }
+
+            hnd.open(root_filename, file_protocol, open_opts);
+            hnd.write(root);
+            hnd.close();
+        }
+    }
+
+    // barrier at end of work to avoid file system race
+    // (non root task could write the root file in write_mesh, 
+    // but root task is always the one to read the root file
+    // in read_mesh.
+
+    #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+        MPI_Barrier(mpi_comm);
+    #endif
+}
+
+//-----------------------------------------------------------------------------
+// The load semantics, the mesh node is reset before reading.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void load_mesh(const std::string &root_file_path,
+               conduit::Node &mesh
+               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    mesh.reset();
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    read_mesh(root_file_path,
+              mesh,
+              mpi_comm);
+#else
+    read_mesh(root_file_path,
+              mesh);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void load_mesh(const std::string &root_file_path,
+               const conduit::Node &opts,
+               conduit::Node &mesh
+               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    mesh.reset();
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    read_mesh(root_file_path,
+              opts,
+              mesh,
+              mpi_comm);
+#else
+    read_mesh(root_file_path,
+              opts,
+              mesh);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void read_mesh(const std::string &root_file_path,
+               Node &mesh
+               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    Node opts;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    read_mesh(root_file_path,
+              opts,
+              mesh,
+              mpi_comm);
+#else
+    read_mesh(root_file_path,
+              opts,
+              mesh);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void read_mesh(const std::string &root_file_path,
+               const Node &opts,
+               Node &mesh
+               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+{
+    CONDUIT_ANNOTATE_MARK_SCOPE("relay::io::blueprint::read_mesh");
+
+    std::string root_fname = root_file_path;
+
+    index_t rank = 0;
+    index_t total_size = 1;
+#if CONDUIT_RELAY_IO_MPI_ENABLED
+    rank = relay::mpi::rank(mpi_comm);
+    total_size = relay::mpi::size(mpi_comm);
+#endif
+
+#ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+    if(detail::is_silo_root_file(root_fname))
+    {
+        detail::read_silo_mesh(root_fname, opts, rank, total_size, mesh);
+        return;
+    }
+#endif
+
+    Node root_node;
+    std::string mesh_name;
+    detail::read_root_file(root_fname, opts, root_node, mesh_name);
+    const Node &mesh_index = root_node["blueprint_index"][mesh_name];
+
+    std::string data_protocol = "hdf5";
+
+    if(root_node.has_child("protocol"))
+    {
+        data_protocol = root_node["protocol/name"].as_string();
+    }
+
+    // NOTE: future cases (per mesh maps, won't need these)
+    // but they are needed for all current cases
+    if(!root_node.has_child("number_of_trees"))
+    {
+        CONDUIT_ERROR("Root missing `number_of_trees`");
+    }
+
+    if(!root_node.has_child("number_of_files"))
+    {
+        CONDUIT_ERROR("Root missing `number_of_files`");
+    }
+
+    // read all domains for given mesh
+    int num_domains = root_node["number_of_trees"].to_int();
+    int num_files   = root_node["number_of_files"].to_int();
+    detail::BlueprintTreePathGenerator gen(root_node["file_pattern"].as_string(),
+                                           root_node["tree_pattern"].as_string(),
+                                           num_files,
+                                           num_domains,
+                                           data_protocol,
+                                           mesh_index);
+
+    Node selection;
+    detail::parse_read_selection(opts, mesh_index, selection);
+
+    std::vector<index_t> domain_ids;
+    detail::parse_read_domains(opts, num_domains, domain_ids);
+    int num_read_domains = (int) domain_ids.size();
+
+    std::string current, next;
+    utils::rsplit_file_path (root_fname, current, next);
+
+    // the data file of each domain, used to group reads by file
+    std::vector<std::string> domain_files;
+    if(data_protocol != "sidre_hdf5")
+    {
+        for(int d = 0; d < num_read_domains; d++)
+        {
+            domain_files.push_back(utils::join_path(next,
+                                        gen.GenerateFilePath(domain_ids[d])));
+        }
+    }
+
+    // the entries of domain_ids this rank reads
+    std::vector<index_t> reads;
+    detail::assign_read_domains(opts,
+                                root_node,
+                                domain_ids,
+                                domain_files,
+                                rank,
+                                total_size,
+                                reads);
+
+    std::ostringstream oss;
+    if(data_protocol == "sidre_hdf5")
+    {
+        relay::io::IOHandle hnd;
+        Node open_opts;
+        open_opts["mode"] = "r";
+        hnd.open(root_fname, "sidre_hdf5", open_opts);
+        for(size_t r = 0; r < reads.size(); r++)
+        {
+            oss.str("");
+            oss << domain_ids[(size_t)reads[r]] << "/" << mesh_name;
+            hnd.read(oss.str(),mesh);
+        }
+        // sidre domains are read whole
+        detail::prune_domain(selection, mesh_index, mesh);
+    }
+    else
+    {
+        // group the domains by data file, so each file is opened once
+        std::vector<std::string> files;
+        std::vector<std::vector<index_t> > file_domains;
+        std::map<std::string, index_t> file_ids;
+        // create the output domains up front, since the tasks that
+        // read them may run on other threads
+        std::vector<Node *> domain_nodes;
+        for(size_t r = 0; r < reads.size(); r++)
+        {
+            index_t i = domain_ids[(size_t)reads[r]];
+            const std::string &domain_file = domain_files[(size_t)reads[r]];
+
+            std::map<std::string, index_t>::iterator fitr = file_ids.find(domain_file);
+            if(fitr == file_ids.end())
+            {
+                fitr = file_ids.insert(std::make_pair(domain_file,
+                                                      (index_t)files.size())).first;
+                files.push_back(domain_file);
+                file_domains.push_back(std::vector<index_t>());
+            }
+            file_domains[(size_t)fitr->second].push_back((index_t)r);
+
+            std::string mesh_path = conduit_fmt::format("domain_{:06d}",i);
+            domain_nodes.push_back(&mesh[mesh_path]);
+        }
+
+        index_t num_threads = detail::mesh_io_threads(opts,
+                                                      data_protocol,
+                                                      (index_t)files.size());
+
+        // one task per file
+        relay::io::detail::run_tasks((index_t)files.size(),
+                                     num_threads,
+                                     [&](index_t f)
+        {
+            relay::io::IOHandle hnd;
+            Node open_opts;
+            open_opts["mode"] = "r";
+            hnd.open(files[(size_t)f], data_protocol, open_opts);
+
+            const std::vector<index_t> &doms = file_domains[(size_t)f];
+            for(size_t di = 0; di < doms.size(); di++)
+            {
+                index_t i = domain_ids[(size_t)reads[(size_t)doms[di]]];
+                detail::read_domain(hnd,
+                                    gen.GenerateTreePath(i),
+                                    mesh_index,
+                                    selection,
+                                    *domain_nodes[(size_t)doms[di]]);
+            }
+            hnd.close();
+        });
+    }
+    
+}
+
+#ifndef CONDUIT_RELAY_IO_MPI_ENABLED
+//-----------------------------------------------------------------------------
+// LazyMesh
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+class LazyMesh::State
 {
-    // empty opts
-    Node opts;
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    save_mesh(mesh,
-              path,
-              protocol,
-              opts,
-              mpi_comm);
-#else
-    save_mesh(mesh,
-              path,
-              protocol,
-              opts);
-#endif
-}
+public:
+    State(const std::string &root_file_path,
+          const Node &opts)
+    : root_fname(root_file_path),
+      gen(NULL)
+    {
+        detail::read_root_file(root_fname, opts, root_node, mesh_name);
+
+        data_protocol = "hdf5";
+        if(root_node.has_child("protocol"))
+        {
+            data_protocol = root_node["protocol/name"].as_string();
+        }
+
+        if(!root_node.has_child("number_of_trees"))
+        {
+            CONDUIT_ERROR("Root missing `number_of_trees`");
+        }
+
+        if(!root_node.has_child("number_of_files"))
+        {
+            CONDUIT_ERROR("Root missing `number_of_files`");
+        }
+
+        const Node &index = root_node["blueprint_index"][mesh_name];
+        detail::parse_read_selection(opts, index, selection);
+
+        std::string tmp;
+        utils::rsplit_file_path(root_fname, tmp, root_dir);
+
+        num_domains = root_node["number_of_trees"].to_index_t();
+        gen = new detail::BlueprintTreePathGenerator(
+                                root_node["file_pattern"].as_string(),
+                                root_node["tree_pattern"].as_string(),
+                                root_node["number_of_files"].to_index_t(),
+                                num_domains,
+                                data_protocol,
+                                index);
+    }
+
+    ~State()
+    {
+        delete gen;
+    }
+
+    std::string  root_fname;
+    std::string  root_dir;
+    std::string  mesh_name;
+    std::string  data_protocol;
+    index_t      num_domains;
+    Node         root_node;
+    Node         selection;
+    Node         domains;
+    detail::BlueprintTreePathGenerator *gen;
+};
 
 //-----------------------------------------------------------------------------
-// Main Mesh Blueprint Save, taken from Ascent
+LazyMesh::LazyMesh()
+: m_state(NULL)
+{}
+
 //-----------------------------------------------------------------------------
+LazyMesh::LazyMesh(const std::string &root_file_path)
+: m_state(NULL)
+{
+    open(root_file_path);
+}
+
 //-----------------------------------------------------------------------------
-/// The following options can be passed via the opts Node:
+LazyMesh::LazyMesh(const std::string &root_file_path,
+                   const Node &opts)
+: m_state(NULL)
+{
+    open(root_file_path, opts);
+}
+
 //-----------------------------------------------------------------------------
-/// opts:
-///      file_style: "default", "root_only", "multi_file"
-///            when # of domains == 1,  "default"   ==> "root_only"
-///            else,                    "default"   ==> "multi_file"
-///
-///      suffix: "default", "cycle", "none" 
-///            when # of domains == 1,  "default"   ==> "none"
-///            else,                    "default"   ==> "cycle"
-///
-///      mesh_name:  (used if present, default ==> "mesh")
-///
-///      number_of_files:  {# of files}
-///            when "multi_file":
-///                 <= 0, use # of files == # of domains
-///                  > 0, # of files == number_of_files
-///
+LazyMesh::~LazyMesh()
+{
+    close();
+}
+
 //-----------------------------------------------------------------------------
-void save_mesh(const Node &mesh,
-                const std::string &path,
-                const std::string &protocol,
-                const Node &opts
-                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+void
+LazyMesh::open(const std::string &root_file_path)
 {
-    // we force overwrite to true, so we need a copy of the const opts passed.
-    Node save_opts;
-    save_opts.set(opts);
-    save_opts["truncate"] = "true";
+    Node opts;
+    open(root_file_path, opts);
+}
 
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    write_mesh(mesh,
-               path,
-               protocol,
-               save_opts,
-               mpi_comm);
-#else
-    write_mesh(mesh,
-               path,
-               protocol,
-               save_opts);
-#endif
+//-----------------------------------------------------------------------------
+void
+LazyMesh::open(const std::string &root_file_path,
+               const Node &opts)
+{
+    close();
+    m_state = new State(root_file_path, opts);
 }
 
 //-----------------------------------------------------------------------------
-// Sig variants of write_mesh
+bool
+LazyMesh::is_open() const
+{
+    return m_state != NULL;
+}
+
 //-----------------------------------------------------------------------------
+void
+LazyMesh::close()
+{
+    delete m_state;
+    m_state = NULL;
+}
 
 //-----------------------------------------------------------------------------
-void write_mesh(const Node &mesh,
-                const std::string &path
-                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+index_t
+LazyMesh::number_of_domains() const
 {
-    // empty opts
-    Node opts;
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    write_mesh(mesh,
-               path,
-               detail::identify_protocol(path),
-               opts,
-               mpi_comm);
-#else
-    write_mesh(mesh,
-               path,
-               detail::identify_protocol(path),
-               opts);
-#endif
+    if(!is_open())
+    {
+        CONDUIT_ERROR("LazyMesh is not open");
+    }
+    return m_state->num_domains;
 }
 
 //-----------------------------------------------------------------------------
-void write_mesh(const Node &mesh,
-                const std::string &path,
-                const std::string &protocol
-                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+const Node &
+LazyMesh::mesh_index() const
 {
-    // empty opts
-    Node opts;
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    write_mesh(mesh,
-               path,
-               protocol,
-               opts,
-               mpi_comm);
-#else
-    write_mesh(mesh,
-               path,
-               protocol,
-               opts);
-#endif
+    if(!is_open())
+    {
+        CONDUIT_ERROR("LazyMesh is not open");
+    }
+    return m_state->root_node["blueprint_index"][m_state->mesh_name];
 }
 
+//-----------------------------------------------------------------------------
+bool
+LazyMesh::is_loaded(index_t domain_id) const
+{
+    return is_open() &&
+           m_state->domains.has_child(conduit_fmt::format("domain_{:06d}",
+                                                          domain_id));
+}
 
 //-----------------------------------------------------------------------------
-// Main Mesh Blueprint Save, taken from Ascent
+Node &
+LazyMesh::domain(index_t domain_id)
+{
+    if(domain_id < 0 || domain_id >= number_of_domains())
+    {
+        CONDUIT_ERROR("LazyMesh: domain " << domain_id
+                      << " is out of range, the mesh has "
+                      << number_of_domains() << " domains");
+    }
+
+    const std::string dom_name = conduit_fmt::format("domain_{:06d}",
+                                                     domain_id);
+    if(m_state->domains.has_child(dom_name))
+    {
+        return m_state->domains[dom_name];
+    }
+
+    Node &dom = m_state->domains[dom_name];
+    try
+    {
+        relay::io::IOHandle hnd;
+        Node open_opts;
+        open_opts["mode"] = "r";
+        if(m_state->data_protocol == "sidre_hdf5")
+        {
+            hnd.open(m_state->root_fname, "sidre_hdf5", open_opts);
+            hnd.read(conduit_fmt::format("{}/{}",
+                                         domain_id,
+                                         m_state->mesh_name),
+                     dom);
+            // sidre domains are read whole
+            detail::prune_domain(m_state->selection, mesh_index(), dom);
+        }
+        else
+        {
+            std::string domain_file = utils::join_path(m_state->root_dir,
+                                m_state->gen->GenerateFilePath(domain_id));
+            hnd.open(domain_file, m_state->data_protocol, open_opts);
+            detail::read_domain(hnd,
+                                m_state->gen->GenerateTreePath(domain_id),
+                                mesh_index(),
+                                m_state->selection,
+                                dom);
+        }
+    }
+    catch(conduit::Error &)
+    {
+        // don't leave a partial domain behind
+        m_state->domains.remove(dom_name);
+        throw;
+    }
+
+    return dom;
+}
+
+//-----------------------------------------------------------------------------
+void
+LazyMesh::release(index_t domain_id)
+{
+    const std::string dom_name = conduit_fmt::format("domain_{:06d}",
+                                                     domain_id);
+    if(is_open() && m_state->domains.has_child(dom_name))
+    {
+        m_state->domains.remove(dom_name);
+    }
+}
+
 //-----------------------------------------------------------------------------
+const Node &
+LazyMesh::loaded_domains() const
+{
+    if(!is_open())
+    {
+        CONDUIT_ERROR("LazyMesh is not open");
+    }
+    return m_state->domains;
+}
+
 //-----------------------------------------------------------------------------
-/// The following options can be passed via the opts Node:
+// MeshWriter
 //-----------------------------------------------------------------------------
-/// opts:
-///      file_style: "default", "root_only", "multi_file"
-///            when # of domains == 1,  "default"   ==> "root_only"
-///            else,                    "default"   ==> "multi_file"
-///
-///      suffix: "default", "cycle", "none" 
-///            when # of domains == 1,  "default"   ==> "none"
-///            else,                    "default"   ==> "cycle"
-///
-///      mesh_name:  (used if present, default ==> "mesh")
-///
-///      number_of_files:  {# of files}
-///            when "multi_file":
-///                 <= 0, use # of files == # of domains
-///                  > 0, # of files == number_of_files
-///
+
 //-----------------------------------------------------------------------------
-void write_mesh(const Node &mesh,
-                const std::string &path,
-                const std::string &file_protocol,
-                const Node &opts
-                CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+class MeshWriter::State
 {
-    // The assumption here is that everything is multi domain
+public:
+    State(const std::string &path_in,
+          const std::string &protocol_in,
+          const Node &opts)
+    : path(path_in),
+      protocol(protocol_in),
+      mesh_name("mesh"),
+      num_domains(-1),
+      num_cycles(0)
+    {
+        if(protocol.empty())
+        {
+            protocol = "hdf5";
+        }
 
-    std::string opts_file_style = "default";
-    std::string opts_suffix     = "default";
-    std::string opts_mesh_name  = "mesh";
-    int         opts_num_files  = -1;
-    bool        opts_truncate   = false;
+#ifndef CONDUIT_RELAY_IO_HDF5_ENABLED
+        if(protocol == "hdf5")
+        {
+            CONDUIT_ERROR("MeshWriter: the hdf5 protocol is not enabled");
+        }
+#endif
 
-    // check for + validate file_style option
-    if(opts.has_child("file_style") && opts["file_style"].dtype().is_string())
-    {
-        opts_file_style = opts["file_style"].as_string();
+        if(opts.has_child("mesh_name") && opts["mesh_name"].dtype().is_string())
+        {
+            mesh_name = opts["mesh_name"].as_string();
+        }
 
-        if(opts_file_style != "default" && 
-           opts_file_style != "root_only" &&
-           opts_file_style != "multi_file" )
+        if(opts.has_child("static"))
         {
-            CONDUIT_ERROR("write_mesh invalid file_style option: \"" 
-                          << opts_file_style << "\"\n"
-                          " expected: \"default\", \"root_only\", "
-                          "or \"multi_file\"");
+            const Node &n_static = opts["static"];
+            if(n_static.dtype().is_string())
+            {
+                static_names.insert(n_static.as_string());
+            }
+            else
+            {
+                NodeConstIterator itr = n_static.children();
+                while(itr.has_next())
+                {
+                    static_names.insert(itr.next().as_string());
+                }
+            }
+        }
+        else
+        {
+            static_names.insert("coordsets");
+            static_names.insert("topologies");
         }
 
+        if(!utils::is_directory(path) && !utils::create_directory(path))
+        {
+            CONDUIT_ERROR("Error: failed to create directory " << path);
+        }
+
+        // the file pattern needs to be relative to the root files
+        std::string tmp;
+        utils::rsplit_file_path(path, output_dir_base, tmp);
     }
 
-    // check for + validate suffix option
-    if(opts.has_child("suffix") && opts["suffix"].dtype().is_string())
+    //-------------------------------------------------------------------//
+    ~State()
     {
-        opts_suffix = opts["suffix"].as_string();
-
-        if(opts_suffix != "default" && 
-           opts_suffix != "cycle" &&
-           opts_suffix != "none" )
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        for(size_t i = 0; i < files.size(); i++)
         {
-            CONDUIT_ERROR("write_mesh invalid suffix option: \"" 
-                          << opts_suffix << "\"\n"
-                          " expected: \"default\", \"cycle\", or \"none\"");
+            if(files[i] >= 0)
+            {
+                hdf5_close_file(files[i]);
+            }
         }
+#endif
     }
-    
-    // check for + validate suffix option
-    if(opts.has_child("mesh_name") && opts["mesh_name"].dtype().is_string())
+
+    //-------------------------------------------------------------------//
+    // names and string valued properties (type, association, ...) of the
+    // components of each domain: what the blueprint index depends on
+    //-------------------------------------------------------------------//
+    static std::string index_signature(const Node &multi_dom)
     {
-        opts_mesh_name = opts["mesh_name"].as_string();
+        std::ostringstream oss;
+        NodeConstIterator dom_itr = multi_dom.children();
+        while(dom_itr.has_next())
+        {
+            NodeConstIterator comp_itr = dom_itr.next().children();
+            while(comp_itr.has_next())
+            {
+                const Node &comp = comp_itr.next();
+                if(comp_itr.name() == "state" || !comp.dtype().is_object())
+                {
+                    continue;
+                }
+                NodeConstIterator entry_itr = comp.children();
+                while(entry_itr.has_next())
+                {
+                    const Node &entry = entry_itr.next();
+                    oss << comp_itr.name() << "/" << entry_itr.name() << ";";
+                    NodeConstIterator prop_itr = entry.children();
+                    while(prop_itr.has_next())
+                    {
+                        const Node &prop = prop_itr.next();
+                        if(prop.dtype().is_string())
+                        {
+                            oss << prop_itr.name() << "="
+                                << prop.as_string() << ";";
+                        }
+                        else if(prop.dtype().is_object() ||
+                                prop.dtype().is_list())
+                        {
+                            oss << prop_itr.name() << "("
+                                << prop.number_of_children() << ");";
+                        }
+                    }
+                }
+            }
+            oss << "|";
+        }
+        return oss.str();
     }
-    
 
-    // check for number_of_files, 0 or -1 implies #files => # domains
-    if(opts.has_child("number_of_files") && opts["number_of_files"].dtype().is_integer())
+    //-------------------------------------------------------------------//
+    void write_domain(const Node &dom, index_t domain_id, int cycle)
     {
-        opts_num_files = (int) opts["number_of_files"].to_int();
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        if(protocol == "hdf5")
+        {
+            write_hdf5_domain(dom, domain_id, cycle);
+            return;
+        }
+#endif
+        std::string output_file = utils::join_file_path(path,
+            conduit_fmt::format("cycle_{:06d}_domain_{:06d}.{}",
+                                cycle,
+                                domain_id,
+                                protocol));
+        relay::io::IOHandle hnd;
+        Node open_opts;
+        open_opts["mode"] = "wt";
+        hnd.open(output_file, protocol, open_opts);
+        hnd.write(dom, mesh_name);
+        hnd.close();
     }
 
-    // check for truncate (overwrite)
-    if(opts.has_child("truncate") && opts["truncate"].dtype().is_string())
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    //-------------------------------------------------------------------//
+    void write_hdf5_domain(const Node &dom, index_t domain_id, int cycle)
     {
-        const std::string ow_string = opts["truncate"].as_string();
-        if(ow_string == "true")
-            opts_truncate = true;
-    }
+        hid_t h5_id = files[(size_t)domain_id];
+        const std::string cycle_path = conduit_fmt::format("cycle_{:06d}",
+                                                           cycle);
+        const std::string mesh_path = cycle_path + "/" + mesh_name;
+        const std::string dom_key = conduit_fmt::format("domain_{:06d}",
+                                                        domain_id);
+
+        // a cycle written again replaces the old one, along with the
+        // static entries first written there
+        if(hdf5_has_path(h5_id, cycle_path))
+        {
+            hdf5_remove_path(h5_id, cycle_path);
 
-    int num_files = opts_num_files;
+            const std::string target_prefix = "/" + cycle_path + "/";
+            std::map<std::string, std::string>::iterator sitr =
+                static_targets.begin();
+            while(sitr != static_targets.end())
+            {
+                if(sitr->first.compare(0, dom_key.size() + 1, dom_key + "/") == 0 &&
+                   sitr->second.compare(0, target_prefix.size(), target_prefix) == 0)
+                {
+                    statics.remove(sitr->first);
+                    static_targets.erase(sitr++);
+                }
+                else
+                {
+                    ++sitr;
+                }
+            }
+        }
 
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    // nodes used for MPI comm (share them for many operations)
-    Node n_local, n_reduced;
-#endif
+        Node to_write;
+        std::vector<std::string> links, link_targets;
+        NodeConstIterator comp_itr = dom.children();
+        while(comp_itr.has_next())
+        {
+            const Node &comp = comp_itr.next();
+            const std::string comp_name = comp_itr.name();
+            if(static_names.count(comp_name) == 0 || !comp.dtype().is_object())
+            {
+                to_write[comp_name].set_external(comp);
+                continue;
+            }
 
-    // -----------------------------------------------------------
-    // make sure some MPI taks has data
-    // -----------------------------------------------------------
-    Node multi_dom;
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    bool is_valid = detail::clean_mesh(mesh, multi_dom, mpi_comm);
-#else
-    bool is_valid = detail::clean_mesh(mesh, multi_dom);
+            NodeConstIterator entry_itr = comp.children();
+            while(entry_itr.has_next())
+            {
+                const Node &entry = entry_itr.next();
+                const std::string entry_path = comp_name + "/" + entry_itr.name();
+                const std::string key = dom_key + "/" + entry_path;
+
+                if(dynamic.count(key) == 0)
+                {
+                    std::map<std::string, std::string>::const_iterator sitr =
+                        static_targets.find(key);
+                    if(sitr == static_targets.end())
+                    {
+                        // first write, keep a copy to compare against
+                        statics[key].set(entry);
+                        static_targets[key] = "/" + mesh_path + "/" + entry_path;
+                    }
+                    else
+                    {
+                        Node info;
+                        if(!statics[key].diff(entry, info))
+                        {
+                            links.push_back(mesh_path + "/" + entry_path);
+                            link_targets.push_back(sitr->second);
+                            continue;
+                        }
+                        // changed, write it every cycle from now on
+                        dynamic.insert(key);
+                        statics.remove(key);
+                        static_targets.erase(key);
+                    }
+                }
+                to_write[entry_path].set_external(entry);
+            }
+        }
+
+        if(to_write.number_of_children() > 0)
+        {
+            hdf5_write(to_write, h5_id, mesh_path);
+        }
+
+        for(size_t i = 0; i < links.size(); i++)
+        {
+            hdf5_create_link(h5_id, link_targets[i], links[i]);
+        }
+
+        // completed cycles are readable even if the run stops early
+        hdf5_flush_file(h5_id);
+    }
 #endif
 
-    int par_rank = 0;
-    int par_size = 1;
-    // we may not have any domains so init to max
-    int cycle = std::numeric_limits<int>::max();
+    //-------------------------------------------------------------------//
+    void write(const Node &mesh)
+    {
+        Node multi_dom;
+        if(!detail::clean_mesh(mesh, multi_dom))
+        {
+            CONDUIT_ERROR("MeshWriter: the mesh has no domains to write");
+        }
 
-    int local_boolean = is_valid ? 1 : 0;
-    int global_boolean = local_boolean;
+        const index_t ndoms = multi_dom.number_of_children();
+        if(num_domains < 0)
+        {
+            open_files(ndoms);
+        }
+        else if(ndoms != num_domains)
+        {
+            CONDUIT_ERROR("MeshWriter: the mesh has " << ndoms
+                          << " domains, expected " << num_domains
+                          << " domains (as in the first cycle)");
+        }
 
+        const Node &dom_0 = multi_dom.child(0);
+        int cycle = (int)num_cycles;
+        if(dom_0.has_path("state/cycle"))
+        {
+            cycle = dom_0["state/cycle"].to_int();
+        }
 
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    par_rank = relay::mpi::rank(mpi_comm);
-    par_size = relay::mpi::size(mpi_comm);
+        // the index only depends on the structure of the domains
+        std::string sig = index_signature(multi_dom);
+        if(sig != signature)
+        {
+            Node &idx = root["blueprint_index"][mesh_name];
+            ::conduit::blueprint::mesh::generate_index(multi_dom,
+                                                       mesh_name,
+                                                       ndoms,
+                                                       idx);
+            signature = sig;
+        }
 
-    // reduce to check to see if any valid data exists
+        Node &idx_state = root["blueprint_index"][mesh_name]["state"];
+        idx_state["cycle"] = cycle;
+        if(dom_0.has_path("state/time"))
+        {
+            idx_state["time"] = dom_0["state/time"].to_double();
+        }
+        else if(idx_state.has_child("time"))
+        {
+            idx_state.remove("time");
+        }
 
-    n_local = (int)cycle;
-    relay::mpi::sum_all_reduce(n_local,
-                               n_reduced,
-                               mpi_comm);
+        for(index_t i = 0; i < ndoms; i++)
+        {
+            write_domain(multi_dom.child(i), i, cycle);
+        }
 
-    global_boolean = n_reduced.as_int();
+        if(protocol == "hdf5")
+        {
+            root["tree_pattern"] = conduit_fmt::format("/cycle_{:06d}/",
+                                                       cycle);
+        }
+        else
+        {
+            root["file_pattern"] = utils::join_file_path(output_dir_base,
+                conduit_fmt::format("cycle_{:06d}_domain_%06d.{}",
+                                    cycle,
+                                    protocol));
+        }
 
-#endif
+        relay::io::IOHandle hnd;
+        Node open_opts;
+        open_opts["mode"] = "wt";
+        hnd.open(path + conduit_fmt::format(".cycle_{:06d}.root", cycle),
+                 protocol,
+                 open_opts);
+        hnd.write(root);
+        hnd.close();
 
-    if(global_boolean == 0)
-    {
-      CONDUIT_INFO("Blueprint save: no valid data exists. Skipping save");
-      return;
+        num_cycles++;
     }
 
-    // -----------------------------------------------------------
-    // get the number of local domains and the cycle info
-    // -----------------------------------------------------------
-
-    int local_num_domains = (int)multi_dom.number_of_children();
-    // figure out what cycle we are
-    if(local_num_domains > 0 && is_valid)
+    //-------------------------------------------------------------------//
+    // sets up the layout for ndoms domains
+    //-------------------------------------------------------------------//
+    void open_files(index_t ndoms)
     {
-        Node dom = multi_dom.child(0);
-        if(!dom.has_path("state/cycle"))
+        num_domains = ndoms;
+
+        root["protocol/name"]    = protocol;
+        root["protocol/version"] = CONDUIT_VERSION;
+        root["number_of_files"]  = num_domains;
+        root["number_of_trees"]  = num_domains;
+
+        if(protocol == "hdf5")
         {
-            if(opts_suffix == "cycle")
-            {
-                static std::map<std::string,int> counters;
-                CONDUIT_INFO("Blueprint save: no 'state/cycle' present."
-                             " Defaulting to counter");
-                cycle = counters[path];
-                counters[path]++;
-            }
-            else
+            root["file_pattern"] = utils::join_file_path(output_dir_base,
+                                                         "domain_%06d.hdf5");
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+            files.resize((size_t)num_domains, -1);
+            for(index_t i = 0; i < num_domains; i++)
             {
-                opts_suffix = "none";
+                files[(size_t)i] = hdf5_create_file(utils::join_file_path(path,
+                    conduit_fmt::format("domain_{:06d}.hdf5", i)));
             }
+#endif
         }
-        else if(opts_suffix == "default")
+        else
         {
-            cycle = dom["state/cycle"].to_int();
-            opts_suffix = "cycle";
+            root["tree_pattern"] = "/";
         }
     }
 
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    // reduce to get the cycle (some tasks might not have domains)
-    n_local = (int)cycle;
+    std::string path;
+    std::string protocol;
+    std::string mesh_name;
+    std::string output_dir_base;
+    std::set<std::string> static_names;
 
-    relay::mpi::min_all_reduce(n_local,
-                               n_reduced,
-                               mpi_comm);
+    index_t num_domains;
+    index_t num_cycles;
+
+    // root file contents, updated for each cycle
+    Node root;
+    std::string signature;
+
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    std::vector<hid_t> files;
+#endif
+    // copies of the static entries as first written ({domain}/{comp}/{name})
+    // and where they were written
+    Node statics;
+    std::map<std::string, std::string> static_targets;
+    // static entries that changed
+    std::set<std::string> dynamic;
+};
+
+//-----------------------------------------------------------------------------
+MeshWriter::MeshWriter()
+: m_state(NULL)
+{}
+
+//-----------------------------------------------------------------------------
+MeshWriter::MeshWriter(const std::string &path,
+                       const std::string &protocol)
+: m_state(NULL)
+{
+    open(path, protocol);
+}
+
+//-----------------------------------------------------------------------------
+MeshWriter::MeshWriter(const std::string &path,
+                       const std::string &protocol,
+                       const Node &opts)
+: m_state(NULL)
+{
+    open(path, protocol, opts);
+}
 
-    cycle = n_reduced.as_int();
-#endif
-    
-    // -----------------------------------------------------------
-    // find the # of global domains
-    // -----------------------------------------------------------
-    int global_num_domains = (int)local_num_domains;
+//-----------------------------------------------------------------------------
+MeshWriter::~MeshWriter()
+{
+    close();
+}
 
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    n_local = local_num_domains;
+//-----------------------------------------------------------------------------
+void
+MeshWriter::open(const std::string &path,
+                 const std::string &protocol)
+{
+    Node opts;
+    open(path, protocol, opts);
+}
 
-    relay::mpi::sum_all_reduce(n_local,
-                               n_reduced,
-                               mpi_comm);
+//-----------------------------------------------------------------------------
+void
+MeshWriter::open(const std::string &path,
+                 const std::string &protocol,
+                 const Node &opts)
+{
+    close();
+    m_state = new State(path, protocol, opts);
+}
 
-    global_num_domains = n_reduced.as_int();
-#endif
+//-----------------------------------------------------------------------------
+bool
+MeshWriter::is_open() const
+{
+    return m_state != NULL;
+}
 
-    if(global_num_domains == 0)
+//-----------------------------------------------------------------------------
+void
+MeshWriter::write(const Node &mesh)
+{
+    if(!is_open())
     {
-      if(par_rank == 0)
-      {
-          CONDUIT_WARN("There no data to save. Doing nothing.");
-      }
-      return;
+        CONDUIT_ERROR("MeshWriter is not open");
     }
+    m_state->write(mesh);
+}
 
-    std::string output_dir = "";
+//-----------------------------------------------------------------------------
+index_t
+MeshWriter::number_of_cycles() const
+{
+    if(!is_open())
+    {
+        CONDUIT_ERROR("MeshWriter is not open");
+    }
+    return m_state->num_cycles;
+}
 
-    // resolve file_style == default
-    // 
-    // default implies multi_file if more than one domain
-    if(opts_file_style == "default")
+//-----------------------------------------------------------------------------
+void
+MeshWriter::close()
+{
+    delete m_state;
+    m_state = NULL;
+}
+
+//-----------------------------------------------------------------------------
+// CheckpointManager
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+class CheckpointManager::State
+{
+public:
+    State(const Node &opts)
+    : name("checkpoint"),
+      protocol("hdf5"),
+      async(true),
+      keep(0),
+      num_written(0),
+      stop(false)
     {
-        if( global_num_domains > 1)
+        if(opts.has_child("tiers") && opts["tiers"].dtype().is_string())
         {
-            opts_file_style = "multi_file";
+            tiers.push_back(opts["tiers"].as_string());
         }
-        else // other wise, use root only
+        else if(opts.has_child("tiers"))
         {
-            opts_file_style = "root_only";
+            NodeConstIterator itr = opts["tiers"].children();
+            while(itr.has_next())
+            {
+                tiers.push_back(itr.next().as_string());
+            }
         }
-    }
 
-    // ----------------------------------------------------
-    // if using multi_file, create output dir
-    // ----------------------------------------------------
-    if(opts_file_style == "multi_file")
-    {
-        // setup the directory
-        output_dir = path;
-        // at this point for suffix, we should only see
-        // cycle or none -- default has been resolved
-        if(opts_suffix == "cycle")
+        if(tiers.empty())
         {
-            output_dir += conduit_fmt::format(".cycle_{:06d}",cycle);
+            CONDUIT_ERROR("CheckpointManager: no tiers given"
+                          " (expected opts/tiers: [\"{dir}\", ...])");
         }
 
-        bool dir_ok = false;
+        if(opts.has_child("name") && opts["name"].dtype().is_string())
+        {
+            name = opts["name"].as_string();
+        }
 
-        // let rank zero handle dir creation
-        if(par_rank == 0)
+        if(opts.has_child("protocol") && opts["protocol"].dtype().is_string())
         {
-            // check of the dir exists
-            dir_ok = utils::is_directory(output_dir);
-            if(!dir_ok)
-            {
-                // if not try to let rank zero create it
-                dir_ok = utils::create_directory(output_dir);
-            }
+            protocol = opts["protocol"].as_string();
         }
 
-        // make sure everyone knows if dir creation was successful 
+        if(protocol != "hdf5" && protocol != "json")
+        {
+            CONDUIT_ERROR("CheckpointManager: invalid protocol: \""
+                          << protocol << "\"\n"
+                          " expected: \"hdf5\" or \"json\"");
+        }
 
-        #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-        // use an mpi sum to check if the dir exists
-        n_local = dir_ok ? 1 : 0;
+#ifndef CONDUIT_RELAY_IO_HDF5_ENABLED
+        if(protocol == "hdf5")
+        {
+            CONDUIT_ERROR("CheckpointManager: the hdf5 protocol is not enabled");
+        }
+#endif
 
-        relay::mpi::sum_all_reduce(n_local,
-                                   n_reduced,
-                                   mpi_comm);
+        if(opts.has_child("drain") && opts["drain"].dtype().is_string())
+        {
+            const std::string drain = opts["drain"].as_string();
+            if(drain != "async" && drain != "sync")
+            {
+                CONDUIT_ERROR("CheckpointManager: invalid drain option: \""
+                              << drain << "\"\n"
+                              " expected: \"async\" or \"sync\"");
+            }
+            async = (drain == "async");
+        }
 
-        dir_ok = (n_reduced.as_int() == 1);
-        #endif
+        if(opts.has_child("keep") && opts["keep"].dtype().is_number())
+        {
+            keep = opts["keep"].to_index_t();
+        }
 
-        if(!dir_ok)
+        if(opts.has_child("write_options"))
         {
-            CONDUIT_ERROR("Error: failed to create directory " << output_dir);
+            write_opts.set(opts["write_options"]);
         }
-    }
+        // one directory of data files per checkpoint, so drains can copy
+        // it whole and the root file last
+        write_opts["file_style"] = "multi_file";
+        write_opts["suffix"]     = "none";
+        write_opts["truncate"]   = "true";
 
+        for(size_t i = 0; i < tiers.size(); i++)
+        {
+            if(!utils::is_directory(tiers[i]) &&
+               !utils::create_directory(tiers[i]))
+            {
+                CONDUIT_ERROR("Error: failed to create directory " << tiers[i]);
+            }
+        }
 
-    // ----------------------------------------------------
-    // setup root file name
-    // ----------------------------------------------------
-    std::string root_filename = path;
+        if(async && tiers.size() > 1)
+        {
+            worker = std::thread(&State::drain_loop, this);
+        }
+    }
 
-    // at this point for suffix, we should only see 
-    // cycle or none -- default has been resolved
-    if(opts_suffix == "cycle")
+    //-------------------------------------------------------------------//
+    ~State()
     {
-        root_filename += conduit_fmt::format(".cycle_{:06d}",cycle);
+        finish();
     }
 
-    root_filename += ".root";
-    // oss << ".root";
-
-    // std::string root_filename = oss.str();
-
-    // zero or negative (default cases), use one file per domain
-    if(num_files <= 0)
+    //-------------------------------------------------------------------//
+    // finishes the queued drains, stops the drain thread and returns the
+    // first error it hit (if any)
+    //-------------------------------------------------------------------//
+    std::string finish()
     {
-        num_files = global_num_domains;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        queued.notify_all();
+        if(worker.joinable())
+        {
+            worker.join();
+        }
+        std::string res = error;
+        error.clear();
+        return res;
     }
 
-    // if global domains > num_files, warn and use one file per domain
-    if(global_num_domains < num_files)
+    //-------------------------------------------------------------------//
+    std::string checkpoint_base(size_t tier, index_t cycle) const
     {
-        CONDUIT_INFO("Requested more files than actual domains, "
-                     "writing one file per domain");
-        num_files = global_num_domains;
+        return utils::join_file_path(tiers[tier],
+                                     name + conduit_fmt::format(".cycle_{:06d}",
+                                                                cycle));
     }
 
-    // at this point for file_style,
-    // default has been resolved, we need to just handle:
-    //   root_only, multi_file
-    if(opts_file_style == "root_only")
+    //-------------------------------------------------------------------//
+    void write(const Node &mesh)
     {
-        // if truncate, first touch needs to open the file with
-        //          open_opts["mode"] = "wt";
-
-        // write out local domains, since all tasks will
-        // write to single file in this case, we need baton.
-        // the outer loop + par_rank == current_writer implements
-        // the baton.
-
-        
-        Node local_root_file_created;
-        Node global_root_file_created;
-        local_root_file_created.set((int)0);
-        global_root_file_created.set((int)0);
+        index_t cycle = num_written;
+        if(mesh.has_path("state/cycle"))
+        {
+            cycle = mesh["state/cycle"].to_index_t();
+        }
+        else if(mesh.number_of_children() > 0 &&
+                mesh.child(0).has_path("state/cycle"))
+        {
+            cycle = mesh.child(0)["state/cycle"].to_index_t();
+        }
 
-        for(int current_writer=0; current_writer < par_size; current_writer++)
+        // don't overwrite a checkpoint that is being copied
         {
-            if(par_rank == current_writer)
+            std::unique_lock<std::mutex> lock(mutex);
+            drained.wait(lock, [this, cycle]
             {
-                relay::io::IOHandle hnd;
-
-                for(int i = 0; i < local_num_domains; ++i)
-                {
-                    // if truncate, first rank to touch the file needs
-                    // to open at
-                    if( !hnd.is_open()
-                        && (global_root_file_created.as_int() == 0)
-                        && opts_truncate)
-                    {
-                        Node open_opts;
-                        open_opts["mode"] = "wt";
-                        hnd.open(root_filename,file_protocol,open_opts);
-                        local_root_file_created.set((int)1);
-                    }
-                    
-                    if(!hnd.is_open())
-                    {
-                        hnd.open(root_filename,file_protocol);
-                    }
+                return std::find(queue.begin(),
+                                 queue.end(),
+                                 cycle) == queue.end();
+            });
+        }
 
-                    const Node &dom = multi_dom.child(i);
-                    // figure out the proper mesh path the file
-                    std::string mesh_path = "";
+        const std::string base = checkpoint_base(0, cycle);
+        relay::io::blueprint::write_mesh(mesh, base, protocol, write_opts);
+        mark_complete(base + ".root", cycle);
+        num_written++;
 
-                    if(global_num_domains == 1)
-                    {
-                        // no domain prefix, write to mesh name
-                        mesh_path = opts_mesh_name;
-                    }
-                    else
-                    {
-                        // multiple domains, we need to use a domain prefix
-                        uint64 domain = dom["state/domain_id"].to_uint64();
-                        mesh_path = conduit_fmt::format("domain_{:06d}/{}",
-                                                        domain,
-                                                        opts_mesh_name);
-                    }
-                    hnd.write(dom,mesh_path);
-                }
-                
-                // note: local file handle goes out of scope here
-                // and data is committed to file for handles that write
-                // on close
+        if(tiers.size() == 1)
+        {
+            prune(cycle);
+        }
+        else if(async)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push_back(cycle);
             }
-
-        // Reduce to sync up (like a barrier) and solve first writer need
-        #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-            mpi::max_all_reduce(local_root_file_created,
-                                global_root_file_created,
-                                mpi_comm);
-        #else
-            global_root_file_created.set(local_root_file_created);
-        #endif
+            queued.notify_one();
+        }
+        else
+        {
+            drain(cycle);
+            prune(cycle);
         }
     }
-    else if(global_num_domains == num_files)
+
+    //-------------------------------------------------------------------//
+    void wait()
     {
-        // write out each domain
-        // writes are independent, so no baton here
-        for(int i = 0; i < local_num_domains; ++i)
+        std::string msg;
         {
-            const Node &dom = multi_dom.child(i);
-            uint64 domain = dom["state/domain_id"].to_uint64();
-
-            std::string output_file  = conduit::utils::join_file_path(output_dir,
-                                                conduit_fmt::format("domain_{:06d}.{}",
-                                                                    domain,
-                                                                    file_protocol));
-            // properly support truncate vs non truncate
-
-            relay::io::IOHandle hnd;
-            Node open_opts;
-            open_opts["mode"] = "w";
-            if(opts_truncate)
-            {
-               open_opts["mode"] = "wt";
-            }
+            std::unique_lock<std::mutex> lock(mutex);
+            drained.wait(lock, [this]{ return queue.empty(); });
+            msg = error;
+            error.clear();
+        }
 
-            // open our handle
-            hnd.open(output_file, open_opts);
-            // write to  mesh name subpath
-            hnd.write(dom, opts_mesh_name);
+        if(!msg.empty())
+        {
+            CONDUIT_ERROR("CheckpointManager: drain failed: " << msg);
         }
     }
-    else // more complex case, N domains to M files
-    {
-        //
-        // recall: we have re-labeled domain ids from 0 - > N-1, however
-        // some mpi tasks may have no data.
-        //
-
-        // books we keep:
-        Node books;
-        books["local_domain_to_file"].set(DataType::index_t(local_num_domains));
-        books["local_domain_status"].set(DataType::index_t(local_num_domains));
 
-        // batons
-        books["local_file_batons"].set(DataType::index_t(num_files));
-        books["global_file_batons"].set(DataType::index_t(num_files));
+    //-------------------------------------------------------------------//
+    index_t pending_drains()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return (index_t)queue.size();
+    }
 
-        // used to track first touch
-        books["local_file_created"].set(DataType::index_t(num_files));
-        books["global_file_created"].set(DataType::index_t(num_files));
+    //-------------------------------------------------------------------//
+    // copies queued checkpoints until stopped and the queue is empty
+    //-------------------------------------------------------------------//
+    void drain_loop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            queued.wait(lock, [this]{ return stop || !queue.empty(); });
+            if(queue.empty())
+            {
+                return;
+            }
 
-        // size local # of domains
-        index_t_array local_domain_to_file = books["local_domain_to_file"].value();
-        index_t_array local_domain_status  = books["local_domain_status"].value();
+            index_t cycle = queue.front();
+            lock.unlock();
 
-        // size num total files
-        /// batons
-        index_t_array local_file_batons    = books["local_file_batons"].value();
-        index_t_array global_file_batons   = books["global_file_batons"].value();
-        /// file created flags
-        index_t_array local_file_created    = books["local_file_created"].value();
-        index_t_array global_file_created   = books["global_file_created"].value();
+            std::string msg;
+            try
+            {
+                drain(cycle);
+                prune(cycle);
+            }
+            catch(const conduit::Error &e)
+            {
+                msg = e.message();
+            }
 
+            lock.lock();
+            queue.pop_front();
+            if(!msg.empty() && error.empty())
+            {
+                error = msg;
+            }
+            drained.notify_all();
+        }
+    }
 
-        Node d2f_map;
-        detail::gen_domain_to_file_map(global_num_domains,
-                                       num_files,
-                                       books);
-        index_t_accessor global_d2f = books["global_domain_to_file"].value();
+    //-------------------------------------------------------------------//
+    // copies a checkpoint from the first tier to the other tiers, the root
+    // file (which marks the copy complete) goes last
+    //-------------------------------------------------------------------//
+    void drain(index_t cycle)
+    {
+        const std::string src_base = checkpoint_base(0, cycle);
 
-        // init our local map and status array
-        for(int d = 0; d < local_num_domains; ++d)
+        std::vector<std::string> src_files;
+        if(utils::is_directory(src_base))
         {
-            const Node &dom = multi_dom.child(d);
-            uint64 domain = dom["state/domain_id"].to_uint64();
-            // local domain index to file map
-            local_domain_to_file[d] = global_d2f[domain];
-            local_domain_status[d] = 1; // pending (1), vs done (0)
+            utils::list_directory_contents(src_base, src_files);
         }
 
-        //
-        // Round and round we go, will we deadlock I believe no :-)
-        //
-        // Here is how this works:
-        //  At each round, if a rank has domains pending to write to a file,
-        //  we put the rank id in the local file_batons vec.
-        //  This vec is then mpi max'ed, and the highest rank
-        //  that needs access to each file will write this round.
-        //
-        //  When a rank does not need to write to a file, we
-        //  put -1 for this rank.
-        //
-        //  During each round, max of # files writers are participating
-        //
-        //  We are done when the mpi max of the batons is -1 for all files.
-        //
+        for(size_t t = 1; t < tiers.size(); t++)
+        {
+            const std::string dest_base = checkpoint_base(t, cycle);
+            const std::string dest_root = dest_base + ".root";
 
-        bool another_twirl = true;
-        int twirls = 0;
+            // an older copy of this cycle is no longer complete
+            utils::remove_path_if_exists(dest_root);
 
-        int local_all_is_good  = 1;
-        int global_all_is_good = 1;
+            if(!utils::is_directory(dest_base) &&
+               !utils::create_directory(dest_base))
+            {
+                CONDUIT_ERROR("Error: failed to create directory "
+                              << dest_base);
+            }
 
-        books["local_all_is_good"].set_external(&local_all_is_good,1);
-        books["global_all_is_good"].set_external(&global_all_is_good,1);
+            for(size_t i = 0; i < src_files.size(); i++)
+            {
+                std::string fname, fdir;
+                utils::rsplit_file_path(src_files[i], fname, fdir);
+                copy_file(src_files[i],
+                          utils::join_file_path(dest_base, fname));
+            }
 
-        std::string local_io_exception_msg = "";
+            const std::string tmp_root = dest_root + ".tmp";
+            copy_file(src_base + ".root", tmp_root);
+            if(std::rename(tmp_root.c_str(), dest_root.c_str()) != 0)
+            {
+                CONDUIT_ERROR("CheckpointManager: failed to rename "
+                              << tmp_root << " to " << dest_root);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------//
+    // removes the oldest drained checkpoints from the first tier
+    //-------------------------------------------------------------------//
+    void prune(index_t cycle)
+    {
+        kept.erase(std::remove(kept.begin(), kept.end(), cycle), kept.end());
+        kept.push_back(cycle);
 
-        while(another_twirl)
+        while(keep > 0 && (index_t)kept.size() > keep)
         {
-            // update baton requests
-            for(int f = 0; f < num_files; ++f)
+            const std::string base = checkpoint_base(0, kept.front());
+            kept.pop_front();
+
+            // the root file goes first, so the copy is never seen as
+            // complete while its data files are removed
+            utils::remove_path_if_exists(base + ".root");
+            std::vector<std::string> files;
+            if(utils::list_directory_contents(base, files))
             {
-                for(int d = 0; d < local_num_domains; ++d)
+                for(size_t i = 0; i < files.size(); i++)
                 {
-                    if(local_domain_status[d] == 1)
-                        local_file_batons[f] = par_rank;
-                    else
-                        local_file_batons[f] = -1;
+                    utils::remove_path_if_exists(files[i]);
                 }
+                utils::remove_path_if_exists(base);
             }
+        }
+    }
 
-            // mpi max file batons array
-            #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-                mpi::max_all_reduce(books["local_file_batons"],
-                                    books["global_file_batons"],
-                                    mpi_comm);
-            #else
-                global_file_batons.set(local_file_batons);
-            #endif
+    //-------------------------------------------------------------------//
+    void mark_complete(const std::string &root_file_path, index_t cycle)
+    {
+        Node marker;
+        marker["complete"] = 1;
+        marker["cycle"] = cycle;
 
-            // mpi max file created array
-            #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-                mpi::max_all_reduce(books["local_file_created"],
-                                    books["global_file_created"],
-                                    mpi_comm);
-            #else
-                global_file_created.set(local_file_created);
-            #endif
+        relay::io::IOHandle hnd;
+        hnd.open(root_file_path, protocol);
+        hnd.write(marker, "checkpoint");
+        hnd.close();
+    }
 
+    //-------------------------------------------------------------------//
+    bool is_complete(const std::string &root_file_path) const
+    {
+        if(!utils::is_file(root_file_path))
+        {
+            return false;
+        }
 
-            // we now have valid batons (global_file_batons)
-            for(int f = 0; f < num_files && local_all_is_good == 1 ; ++f)
-            {
-                // check if this rank has the global baton for this file
-                if( global_file_batons[f] == par_rank )
-                {
-                    // check the domains this rank has pending
-                    for(int d = 0; d < local_num_domains && local_all_is_good == 1; ++d)
-                    {
-                        // reuse this handle for all domains in the file
-                        relay::io::IOHandle hnd;
-                        if(local_domain_status[d] == 1 &&  // pending
-                           local_domain_to_file[d] == f) // destined for this file
-                        {
-                            // now is the time to write!
-                            // pattern is:
-                            //  file_%06llu.{protocol}:/domain_%06llu/...
-                            const Node &dom = multi_dom.child(d);
-                            uint64 domain_id = dom["state/domain_id"].to_uint64();
-
-                            // construct file name
-                            std::string file_name = conduit_fmt::format(
-                                                        "file_{:06d}.{}",
-                                                        f,
-                                                        file_protocol);
-
-                            std::string output_file = conduit::utils::join_file_path(output_dir,
-                                                                                     file_name);
-
-                            // now the path in the file, and domain id
-                            std::string curr_path = conduit_fmt::format(
-                                                            "domain_{:06d}/{}",
-                                                             domain_id,
-                                                             opts_mesh_name);
-
-                            try
-                            {
-                                // if truncate == true check if this is the first time we are
-                                // touching file, and use wt
-                                Node open_opts;
-                                if(opts_truncate && global_file_created[f] == 0)
-                                {
-                                   open_opts["mode"] = "wt";
-
-                                   local_file_created[f]  = 1;
-                                   global_file_created[f] = 1;
-                                }
-
-                                if(!hnd.is_open())
-                                {
-                                    hnd.open(output_file, open_opts);
-                                }
-
-                                // CONDUIT_INFO("rank " << par_rank << " output_file"
-                                //              << output_file << " path " << path);
-
-                                hnd.write(dom, curr_path);
-                                
-                                // update status, we are done with this doman
-                                local_domain_status[d] = 0;
-                            }
-                            catch(conduit::Error &e)
-                            {
-                                local_all_is_good = 0;
-                                local_io_exception_msg = e.message();
-                            }
-                        }
-                    }
-                }
-            }
+        bool res = false;
+        try
+        {
+            Node open_opts;
+            open_opts["mode"] = "r";
+            relay::io::IOHandle hnd;
+            hnd.open(root_file_path, protocol, open_opts);
+            res = hnd.has_path("checkpoint/complete");
+            hnd.close();
+        }
+        catch(const conduit::Error &)
+        {
+            // a partial or damaged root file is not a complete copy
+            res = false;
+        }
+        return res;
+    }
 
-            // if any I/O errors happened stop and have all
-            // tasks bail out with an exception (to avoid hangs)
-            #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-                mpi::min_all_reduce(books["local_all_is_good"],
-                                    books["global_all_is_good"],
-                                    mpi_comm);
-            #else
-                global_all_is_good = local_all_is_good;
-            #endif
+    //-------------------------------------------------------------------//
+    bool latest(index_t &cycle, std::string &root_file_path) const
+    {
+        const std::string prefix = name + ".cycle_";
+        const std::string suffix = ".root";
 
-            if(global_all_is_good == 0)
+        bool found = false;
+        // tiers are checked fastest first, a slower tier is only used for
+        // a newer cycle
+        for(size_t t = 0; t < tiers.size(); t++)
+        {
+            std::vector<std::string> contents;
+            utils::list_directory_contents(tiers[t], contents);
+            for(size_t i = 0; i < contents.size(); i++)
             {
-                std::string emsg = "Failed to write mesh data on one more more ranks.";
-
-                if(!local_io_exception_msg.empty())
+                std::string fname, fdir;
+                utils::rsplit_file_path(contents[i], fname, fdir);
+                if(fname.size() <= prefix.size() + suffix.size() ||
+                   fname.compare(0, prefix.size(), prefix) != 0 ||
+                   fname.compare(fname.size() - suffix.size(),
+                                 suffix.size(),
+                                 suffix) != 0)
                 {
-                     emsg += conduit_fmt::format("Exception details from rank {}: {}.",
-                                                 par_rank, local_io_exception_msg);
+                    continue;
                 }
-                CONDUIT_ERROR(emsg);
-            }
-            // If you  need to debug the baton alog:
-            // std::cout << "[" << par_rank << "] "
-            //              << " twirls: " << twirls
-            //              << " details\n"
-            //              << books.to_yaml();
 
-            // check if we have another round
-            // stop when all batons are -1
-            another_twirl = false;
+                const std::string digits =
+                    fname.substr(prefix.size(),
+                                 fname.size() - prefix.size() - suffix.size());
+                if(digits.find_first_not_of("0123456789") != std::string::npos)
+                {
+                    continue;
+                }
 
-            for(int f = 0; f < num_files && !another_twirl; ++f)
-            {
-                // if any entry is not -1, we still have more work to do
-                if(global_file_batons[f] != -1)
+                index_t c = (index_t)std::strtoll(digits.c_str(), NULL, 10);
+                if((!found || c > cycle) && is_complete(contents[i]))
                 {
-                    another_twirl = true;
-                    twirls++;
+                    found = true;
+                    cycle = c;
+                    root_file_path = contents[i];
                 }
             }
         }
+        return found;
     }
 
-    int root_file_writer = 0;
-    if(local_num_domains == 0)
+    //-------------------------------------------------------------------//
+    static void copy_file(const std::string &src,
+                          const std::string &dest)
     {
-        root_file_writer = -1;
-    }
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    // Rank 0 could have an empty domain, so we have to check
-    // to find someone with a data set to write out the root file.
-    Node out;
-    out = local_num_domains;
-    Node rcv;
+        std::ifstream ifs(src.c_str(), std::ios::binary);
+        if(!ifs.is_open())
+        {
+            CONDUIT_ERROR("CheckpointManager: failed to open " << src);
+        }
 
-    mpi::all_gather_using_schema(out, rcv, mpi_comm);
-    root_file_writer = -1;
-    int* res_ptr = (int*)rcv.data_ptr();
-    for(int i = 0; i < par_size; ++i)
-    {
-        if(res_ptr[i] != 0)
+        std::ofstream ofs(dest.c_str(), std::ios::binary | std::ios::trunc);
+        if(!ofs.is_open())
         {
-            root_file_writer = i;
-            break;
+            CONDUIT_ERROR("CheckpointManager: failed to open " << dest);
+        }
+
+        if(utils::file_size(src) > 0)
+        {
+            ofs << ifs.rdbuf();
+        }
+        ofs.close();
+
+        if(ofs.fail())
+        {
+            CONDUIT_ERROR("CheckpointManager: failed to copy " << src
+                          << " to " << dest);
         }
     }
 
-    MPI_Barrier(mpi_comm);
-#endif
+    std::vector<std::string> tiers;
+    std::string name;
+    std::string protocol;
+    bool        async;
+    index_t     keep;
+    Node        write_opts;
+    index_t     num_written;
+
+    // cycles on the first tier, oldest first (only used by the thread that
+    // drains)
+    std::deque<index_t> kept;
+
+    // cycles waiting to be drained, the front one is being copied
+    std::mutex              mutex;
+    std::condition_variable queued;
+    std::condition_variable drained;
+    std::deque<index_t>     queue;
+    std::string             error;
+    bool                    stop;
+    std::thread             worker;
+};
 
-    if(root_file_writer == -1)
+//-----------------------------------------------------------------------------
+CheckpointManager::CheckpointManager()
+: m_state(NULL)
+{}
+
+//-----------------------------------------------------------------------------
+CheckpointManager::CheckpointManager(const Node &opts)
+: m_state(NULL)
+{
+    open(opts);
+}
+
+//-----------------------------------------------------------------------------
+CheckpointManager::~CheckpointManager()
+{
+    delete m_state;
+}
+
+//-----------------------------------------------------------------------------
+void
+CheckpointManager::open(const Node &opts)
+{
+    close();
+    m_state = new State(opts);
+}
+
+//-----------------------------------------------------------------------------
+bool
+CheckpointManager::is_open() const
+{
+    return m_state != NULL;
+}
+
+//-----------------------------------------------------------------------------
+void
+CheckpointManager::write(const Node &mesh)
+{
+    if(!is_open())
     {
-        // this should not happen. global doms is already 0
-        CONDUIT_WARN("Relay: there are no domains to write out");
+        CONDUIT_ERROR("CheckpointManager is not open");
     }
+    m_state->write(mesh);
+}
 
-    // generate the bp index
-    Node local_bp_idx, bp_idx;
-    if(local_num_domains > 0)
+//-----------------------------------------------------------------------------
+void
+CheckpointManager::wait()
+{
+    if(!is_open())
     {
-        ::conduit::blueprint::mesh::generate_index(multi_dom,
-                                                   opts_mesh_name,
-                                                   global_num_domains,
-                                                   local_bp_idx);
+        CONDUIT_ERROR("CheckpointManager is not open");
     }
-    // handle mpi case. 
-    // this logic is from the mpi ver of mesh index gen
-    // it is duplicated here b/c we dont want a circular dep
-    // between conduit_blueprint_mpi and conduit_relay_io_mpi
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    Node gather_bp_idx;
-    relay::mpi::all_gather_using_schema(local_bp_idx,
-                                        gather_bp_idx,
-                                        mpi_comm);
+    m_state->wait();
+}
 
-    // union all entries into final index that reps
-    // all domains
-    NodeConstIterator itr = gather_bp_idx.children();
-    while(itr.has_next())
+//-----------------------------------------------------------------------------
+index_t
+CheckpointManager::pending_drains() const
+{
+    if(!is_open())
     {
-        const Node &curr = itr.next();
-        bp_idx[opts_mesh_name].update(curr);
+        CONDUIT_ERROR("CheckpointManager is not open");
     }
-#else
-    bp_idx[opts_mesh_name] = local_bp_idx;
-#endif
+    return m_state->pending_drains();
+}
 
-    // root_file_writer will now write out the root file
-    if(par_rank == root_file_writer)
+//-----------------------------------------------------------------------------
+bool
+CheckpointManager::latest(index_t &cycle,
+                          std::string &root_file_path) const
+{
+    if(!is_open())
     {
-        std::string output_dir_base, output_dir_path;
-        conduit::utils::rsplit_file_path(output_dir,
-                                         output_dir_base,
-                                         output_dir_path);
+        CONDUIT_ERROR("CheckpointManager is not open");
+    }
+    return m_state->latest(cycle, root_file_path);
+}
 
-        std::string output_tree_pattern;
-        std::string output_file_pattern;
+//-----------------------------------------------------------------------------
+bool
+CheckpointManager::load_latest(Node &mesh) const
+{
+    index_t cycle = 0;
+    std::string root_file_path;
+    if(!latest(cycle, root_file_path))
+    {
+        return false;
+    }
 
-        // NOTE: 
-        // The file pattern needs to be relative to
-        // the root file. 
-        // reverse split the path
+    Node opts;
+    if(m_state->write_opts.has_child("mesh_name"))
+    {
+        opts["mesh_name"] = m_state->write_opts["mesh_name"];
+    }
+    load_mesh(root_file_path, opts, mesh);
+    return true;
+}
 
+//-----------------------------------------------------------------------------
+void
+CheckpointManager::close()
+{
+    if(m_state == NULL)
+    {
+        return;
+    }
 
-        if(opts_file_style == "root_only")
-        {
-            // make sure this is relative to output dir
-            std::string tmp;
-            utils::rsplit_path(root_filename,
-                               output_file_pattern,
-                               tmp);
+    State *state = m_state;
+    m_state = NULL;
+    std::string msg = state->finish();
+    delete state;
 
-            if(global_num_domains == 1)
-            {
-                output_tree_pattern = "/";
-            }
-            else
-            {
-                output_tree_pattern = "/domain_%06d/";
-            }
-        }
-        else if(global_num_domains == num_files)
+    if(!msg.empty())
+    {
+        CONDUIT_ERROR("CheckpointManager: drain failed: " << msg);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// TableWriter
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+class TableWriter::State
+{
+public:
+    State(const std::string &path,
+          const std::string &protocol_in,
+          const Node &opts)
+    : protocol(protocol_in),
+      num_groups(0),
+      num_rows(0)
+    {
+        if(protocol.empty())
         {
-            std::string tmp;
-            utils::rsplit_path(output_dir_base,
-                               output_file_pattern,
-                               tmp);
-            output_file_pattern = conduit::utils::join_file_path(
-                                                output_file_pattern,
-                                                "domain_%06d." + file_protocol);
-            output_tree_pattern = "/";
+            protocol = "hdf5";
         }
-        else
+
+#ifndef CONDUIT_RELAY_IO_HDF5_ENABLED
+        if(protocol == "hdf5")
         {
-            std::string tmp;
-            utils::rsplit_path(output_dir_base,
-                               output_file_pattern,
-                               tmp);
-            output_file_pattern = conduit::utils::join_file_path(
-                                                output_file_pattern,
-                                                "file_%06d." + file_protocol);
-            output_tree_pattern = "/domain_%06d";
+            CONDUIT_ERROR("TableWriter: the hdf5 protocol is not enabled");
         }
+#endif
 
-        Node root;
-        root["blueprint_index"].set(bp_idx);
-
-
-        // work around conduit and manually add state fields
-        if(multi_dom.child(0).has_path("state/cycle"))
+        if(protocol == "csv")
+        {
+            csv.open(path, opts);
+        }
+        else
         {
-          bp_idx[ opts_mesh_name + "/state/cycle"] = multi_dom.child(0)["state/cycle"].to_int32();
+            Node hnd_opts;
+            hnd_opts["mode"] = "wt";
+            hnd.open(path, protocol, hnd_opts);
         }
+    }
 
-        if(multi_dom.child(0).has_path("state/time"))
+    //-------------------------------------------------------------------//
+    // the names, components and types of the columns of values
+    static std::string column_signature(const Node &values)
+    {
+        std::ostringstream oss;
+        NodeConstIterator cols = values.children();
+        while(cols.has_next())
         {
-          bp_idx[opts_mesh_name + "/state/time"] = multi_dom.child(0)["state/time"].to_double();
+            const Node &col = cols.next();
+            oss << col.name() << ":";
+            if(col.number_of_children() == 0)
+            {
+                oss << col.dtype().name();
+            }
+            NodeConstIterator comps = col.children();
+            while(comps.has_next())
+            {
+                const Node &comp = comps.next();
+                oss << comp.name() << "=" << comp.dtype().name() << ",";
+            }
+            oss << ";";
         }
+        return oss.str();
+    }
 
-        root["protocol/name"]    = file_protocol;
-        root["protocol/version"] = CONDUIT_VERSION;
-
-        root["number_of_files"]  = num_files;
-        root["number_of_trees"]  = global_num_domains;
-
-        root["file_pattern"] = output_file_pattern;
-        root["tree_pattern"] = output_tree_pattern;
-
-        relay::io::IOHandle hnd;
-
-        // if not root only, this is the first time we are writing 
-        // to the root file -- make sure to properly support truncate
-        Node open_opts;
-        if(opts_file_style != "root_only" && opts_truncate)
+    //-------------------------------------------------------------------//
+    void write(const Node &row_group)
+    {
+        const index_t nrows = conduit::blueprint::table::number_of_rows(row_group);
+        if(protocol == "csv")
         {
-            open_opts["mode"] = "wt";
+            csv.write(row_group);
         }
-
-        hnd.open(root_filename, file_protocol, open_opts);
-        hnd.write(root);
-        hnd.close();
+        else
+        {
+            const std::string sig = column_signature(row_group["values"]);
+            if(num_groups == 0)
+            {
+                signature = sig;
+            }
+            else if(sig != signature)
+            {
+                CONDUIT_ERROR("TableWriter: the columns of the row group "
+                              "don't match the columns of the first row group");
+            }
+            hnd.write(row_group, "row_groups/" + std::to_string(num_groups));
+        }
+        num_groups++;
+        num_rows += nrows;
     }
 
-    // barrier at end of work to avoid file system race
-    // (non root task could write the root file in write_mesh, 
-    // but root task is always the one to read the root file
-    // in read_mesh.
-
-    #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-        MPI_Barrier(mpi_comm);
-    #endif
-}
+    std::string    protocol;
+    CSVTableWriter csv;
+    IOHandle       hnd;
+    std::string    signature;
+    index_t        num_groups;
+    index_t        num_rows;
+};
 
 //-----------------------------------------------------------------------------
-// The load semantics, the mesh node is reset before reading.
-//-----------------------------------------------------------------------------
+TableWriter::TableWriter()
+: m_state(NULL)
+{}
 
 //-----------------------------------------------------------------------------
-void load_mesh(const std::string &root_file_path,
-               conduit::Node &mesh
-               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+TableWriter::TableWriter(const std::string &path,
+                         const std::string &protocol)
+: m_state(NULL)
 {
-    mesh.reset();
-
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    read_mesh(root_file_path,
-              mesh,
-              mpi_comm);
-#else
-    read_mesh(root_file_path,
-              mesh);
-#endif
+    open(path, protocol);
 }
 
 //-----------------------------------------------------------------------------
-void load_mesh(const std::string &root_file_path,
-               const conduit::Node &opts,
-               conduit::Node &mesh
-               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+TableWriter::TableWriter(const std::string &path,
+                         const std::string &protocol,
+                         const Node &opts)
+: m_state(NULL)
 {
-    mesh.reset();
+    open(path, protocol, opts);
+}
 
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    read_mesh(root_file_path,
-              opts,
-              mesh,
-              mpi_comm);
-#else
-    read_mesh(root_file_path,
-              opts,
-              mesh);
-#endif
+//-----------------------------------------------------------------------------
+TableWriter::~TableWriter()
+{
+    close();
 }
 
 //-----------------------------------------------------------------------------
-void read_mesh(const std::string &root_file_path,
-               Node &mesh
-               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+void
+TableWriter::open(const std::string &path,
+                  const std::string &protocol)
 {
     Node opts;
-#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
-    read_mesh(root_file_path,
-              opts,
-              mesh,
-              mpi_comm);
-#else
-    read_mesh(root_file_path,
-              opts,
-              mesh);
-#endif
+    open(path, protocol, opts);
 }
 
 //-----------------------------------------------------------------------------
-void read_mesh(const std::string &root_file_path,
-               const Node &opts,
-               Node &mesh
-               CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm mpi_comm))
+void
+TableWriter::open(const std::string &path,
+                  const std::string &protocol,
+                  const Node &opts)
 {
-    std::string root_fname = root_file_path;
-
-    // read the root file, it can be either json or hdf5
-
-    // assume hdf5, but check for json file
-    std::string root_protocol = "hdf5";
-    // we will read the first 5 bytes, but
-    // make sure our buff is null termed, unless you
-    // want a random chance at sadness.
-    char buff[6] = {0,0,0,0,0,0};
-
-    // heuristic, if json, we expect to see "{" in the first 5 chars of the file.
-    std::ifstream ifs;
-    ifs.open(root_fname.c_str());
-    if(!ifs.is_open())
-    {
-        CONDUIT_ERROR("failed to open root file: " << root_fname);
-    }
-
-    if(!ifs.read((char *)buff,5))
-    {
-        CONDUIT_ERROR("failed to read starting bytes from root file: " << root_fname);
-    }
-    ifs.close();
+    close();
+    m_state = new State(path, protocol, opts);
+}
 
-    std::string test_str(buff);
+//-----------------------------------------------------------------------------
+bool
+TableWriter::is_open() const
+{
+    return m_state != NULL;
+}
 
-    if(test_str.find("{") != std::string::npos)
+//-----------------------------------------------------------------------------
+void
+TableWriter::write(const Node &table)
+{
+    if(!is_open())
     {
-       root_protocol = "json";
+        CONDUIT_ERROR("TableWriter is not open");
     }
 
-    Node root_node;
-    relay::io::load(root_fname, root_protocol, root_node);
-
-
-    if(!root_node.has_child("file_pattern"))
+    Node info;
+    if(!conduit::blueprint::table::verify(table, info) ||
+       (!table.has_child("values") && !table.has_child("row_groups")))
     {
-        CONDUIT_ERROR("Root file missing 'file_pattern'");
+        CONDUIT_ERROR("TableWriter: the node passed to write must be a "
+                      "valid blueprint table with \"values\" or "
+                      "\"row_groups\"");
     }
 
-    if(!root_node.has_child("blueprint_index"))
+    conduit::blueprint::table::iterate_row_groups(table,
+        [&](index_t, const Node &row_group)
     {
-        CONDUIT_ERROR("Root file missing 'blueprint_index'");
-    }
+        m_state->write(row_group);
+    });
+}
 
-    std::string mesh_name ="";
-    if(opts.has_child("mesh_name") && opts["mesh_name"].dtype().is_string())
+//-----------------------------------------------------------------------------
+index_t
+TableWriter::number_of_row_groups() const
+{
+    if(!is_open())
     {
-        mesh_name = opts["mesh_name"].as_string();
+        CONDUIT_ERROR("TableWriter is not open");
     }
+    return m_state->num_groups;
+}
 
-    if(mesh_name.empty())
+//-----------------------------------------------------------------------------
+index_t
+TableWriter::number_of_rows() const
+{
+    if(!is_open())
     {
-        NodeConstIterator itr = root_node["blueprint_index"].children();
-        itr.next();
-        mesh_name = itr.name();
+        CONDUIT_ERROR("TableWriter is not open");
     }
+    return m_state->num_rows;
+}
 
-    if(!root_node["blueprint_index"].has_child(mesh_name))
-    {
-        // bad name, construct an error message that
-        // displays the valid options
-        std::ostringstream oss;
-        oss << "Mesh named '" << mesh_name << "' "
-            << " not found in " 
-            << root_file_path
-            << std::endl
-            << " Mesh names found blueprint index: " 
-            << std::endl;
-        NodeConstIterator itr = root_node["blueprint_index"].children();
-        while(itr.has_next())
-        {
-            itr.next();
-            oss << " " << itr.name();
-            oss << std::endl;
-        }
-
-        CONDUIT_ERROR(oss.str());
-    }
+//-----------------------------------------------------------------------------
+void
+TableWriter::close()
+{
+    delete m_state;
+    m_state = NULL;
+}
 
-    // make sure we have a valid bp index
-    Node verify_info;
+//-----------------------------------------------------------------------------
+// Partitions the mesh behind a root file a batch of domains at a time,
+// writing each output domain as soon as its batch is done.
+//-----------------------------------------------------------------------------
+void partition_mesh(const std::string &root_file_path,
+                    const Node &partition_options,
+                    const std::string &path,
+                    const std::string &protocol,
+                    const Node &opts)
+{
+    Node root_node;
+    std::string mesh_name;
+    detail::read_root_file(root_file_path, opts, root_node, mesh_name);
     const Node &mesh_index = root_node["blueprint_index"][mesh_name];
-    if( !::conduit::blueprint::mesh::index::verify(mesh_index,
-                                                   verify_info[mesh_name]))
-    {
-        CONDUIT_ERROR("Mesh Blueprint index verify failed" << std::endl
-                      << verify_info.to_json());
-    }
 
     std::string data_protocol = "hdf5";
-
     if(root_node.has_child("protocol"))
     {
         data_protocol = root_node["protocol/name"].as_string();
     }
 
-    // NOTE: future cases (per mesh maps, won't need these)
-    // but they are needed for all current cases
     if(!root_node.has_child("number_of_trees"))
     {
         CONDUIT_ERROR("Root missing `number_of_trees`");
@@ -1667,7 +5063,6 @@ void read_mesh(const std::string &root_file_path,
         CONDUIT_ERROR("Root missing `number_of_files`");
     }
 
-    // read all domains for given mesh
     int num_domains = root_node["number_of_trees"].to_int();
     int num_files   = root_node["number_of_files"].to_int();
     detail::BlueprintTreePathGenerator gen(root_node["file_pattern"].as_string(),
@@ -1677,130 +5072,164 @@ void read_mesh(const std::string &root_file_path,
                                            data_protocol,
                                            mesh_index);
 
-    std::ostringstream oss;
-    int domain_start = 0;
-    int domain_end = num_domains;
-
-#if CONDUIT_RELAY_IO_MPI_ENABLED
-    int rank = relay::mpi::rank(mpi_comm);
-    int total_size = relay::mpi::size(mpi_comm);
-
-    int read_size = num_domains / total_size;
-    int rem = num_domains % total_size;
-    if(rank < rem)
+    // a budget of zero (the default) reads every domain in a single batch
+    index_t memory_budget = 0;
+    if(opts.has_child("memory_budget"))
     {
-        read_size++;
+        memory_budget = opts["memory_budget"].to_index_t();
     }
 
-    conduit::Node n_read_size;
-    conduit::Node n_doms_per_rank;
+    // output domains keep the name of the mesh we read
+    const std::string &opts_mesh_name = mesh_name;
 
-    n_read_size.set_int32(read_size);
+    // the requested target is spread over the batches in proportion to
+    // the number of input domains each batch holds.
+    index_t target = 0;
+    if(partition_options.has_child("target"))
+    {
+        target = partition_options["target"].to_index_t();
+    }
 
-    relay::mpi::all_gather_using_schema(n_read_size,
-                                        n_doms_per_rank,
-                                        mpi_comm);
-    int *counts = (int*)n_doms_per_rank.data_ptr();
+    std::string file_protocol = protocol;
+    if(file_protocol.empty())
+    {
+        file_protocol = "hdf5";
+    }
 
-    int rank_offset = 0;
-    for(int i = 0; i < rank; ++i)
+    std::string output_dir = path;
+    if(!utils::is_directory(output_dir) &&
+       !utils::create_directory(output_dir))
     {
-        rank_offset += counts[i];
+        CONDUIT_ERROR("Error: failed to create directory " << output_dir);
     }
 
-    domain_start = rank_offset;
-    domain_end = rank_offset + read_size;
-#endif
+    std::string root_dir, tmp;
+    utils::rsplit_file_path(root_file_path, tmp, root_dir);
 
-    if(data_protocol == "sidre_hdf5")
+    Node batch, batch_opts, part, bp_idx;
+    batch_opts.set(partition_options);
+    index_t num_output_domains = 0;
+    int batch_start = 0;
+
+    relay::io::IOHandle hnd;
+    Node open_opts;
+    open_opts["mode"] = "r";
+    for(int i = 0; i < num_domains; i++)
     {
-        relay::io::IOHandle hnd;
-        Node open_opts;
-        open_opts["mode"] = "r";
-        hnd.open(root_fname, "sidre_hdf5", open_opts);
-        for(int i = domain_start ; i < domain_end; i++)
+        Node &dom = batch[conduit_fmt::format("domain_{:06d}",i)];
+        if(data_protocol == "sidre_hdf5")
         {
-            oss.str("");
-            oss << i << "/" << mesh_name;
-            hnd.read(oss.str(),mesh);
+            if(!hnd.is_open())
+            {
+                hnd.open(root_file_path, "sidre_hdf5", open_opts);
+            }
+            hnd.read(conduit_fmt::format("{}/{}",i,mesh_name), dom);
         }
-    }
-    else
-    {
-        relay::io::IOHandle hnd;
-        Node open_opts;
-        open_opts["mode"] = "r";
-        for(int i = domain_start ; i < domain_end; i++)
+        else
         {
-            std::string current, next;
-            utils::rsplit_file_path (root_fname, current, next);
-            std::string domain_file = utils::join_path(next, gen.GenerateFilePath(i));
-
+            std::string domain_file = utils::join_path(root_dir,
+                                                       gen.GenerateFilePath(i));
             hnd.open(domain_file, data_protocol, open_opts);
+            detail::read_domain(hnd,
+                                gen.GenerateTreePath(i),
+                                mesh_index,
+                                Node(),
+                                dom);
+        }
 
-            // also need the tree path
-            std::string tree_path = gen.GenerateTreePath(i);
-
-            std::string mesh_path = conduit_fmt::format("domain_{:06d}",i);
-
-            Node &mesh_out = mesh[mesh_path];
+        // selections refer to domains by their domain_id
+        if(!dom.has_path("state/domain_id"))
+        {
+            dom["state/domain_id"] = i;
+        }
 
-            // read components of the mesh according to the mesh index
-            // for each child in the index
-            NodeConstIterator outer_itr = mesh_index.children();
-            while(outer_itr.has_next())
-            {
-                const Node &outer = outer_itr.next();
-                std::string outer_name = outer_itr.name();
+        if(i + 1 < num_domains &&
+           (memory_budget <= 0 || batch.total_bytes_compact() < memory_budget))
+        {
+            continue;
+        }
 
-                // special logic for state, since it was not included in the index
-                if(outer_name == "state" )
-                {
-                    // we do need to read the state!
-                    if(outer.has_child("path"))
-                    {
-                        hnd.read(utils::join_path(tree_path,outer["path"].as_string()),
-                                 mesh_out[outer_name]);
-                    }
-                    else
-                    { 
-                        if(outer.has_child("cycle"))
-                        {
-                             mesh_out[outer_name]["cycle"] = outer["cycle"];
-                        }
+        int batch_end = i + 1;
+        if(target > 0)
+        {
+            index_t t0 = (target * batch_start + num_domains / 2) / num_domains;
+            index_t t1 = (target * batch_end + num_domains / 2) / num_domains;
+            batch_opts["target"] = std::max(t1 - t0, index_t(1));
+        }
 
-                        if(outer.has_child("time"))
-                        {
-                            mesh_out[outer_name]["time"] = outer["time"];
-                        }
-                     }
-                }
+        ::conduit::blueprint::mesh::partition(batch, batch_opts, part);
+        batch.reset();
 
-                NodeConstIterator itr = outer.children();
-                while(itr.has_next())
-                {
-                    const Node &entry = itr.next();
-                    // check if it has a path
-                    if(entry.has_child("path"))
-                    {
-                        std::string entry_name = itr.name();
-                        std::string entry_path = entry["path"].as_string();
-                        std::string fetch_path = utils::join_path(tree_path,
-                                                                  entry_path);
-                        // some parts may not exist in all domains
-                        // only read if they are there
-                        if(hnd.has_path(fetch_path))
-                        {   
-                            hnd.read(fetch_path,
-                                     mesh_out[outer_name][entry_name]);
-                        }
-                    }
-                }
+        std::vector<Node *> out_doms = ::conduit::blueprint::mesh::domains(part);
+        for(size_t d = 0; d < out_doms.size(); d++)
+        {
+            Node &out_dom = *out_doms[d];
+            out_dom["state/domain_id"] = num_output_domains;
+
+            Node dom_idx;
+            ::conduit::blueprint::mesh::generate_index(out_dom,
+                                                       opts_mesh_name,
+                                                       1,
+                                                       dom_idx);
+            bp_idx[opts_mesh_name].update(dom_idx);
+
+            std::string output_file = utils::join_file_path(output_dir,
+                                        conduit_fmt::format("domain_{:06d}.{}",
+                                                            num_output_domains,
+                                                            file_protocol));
+            relay::io::IOHandle out_hnd;
+            Node out_opts;
+            out_opts["mode"] = "wt";
+            out_hnd.open(output_file, out_opts);
+            out_hnd.write(out_dom, opts_mesh_name);
+            out_hnd.close();
+
+            if(num_output_domains == 0 && out_dom.has_path("state/cycle"))
+            {
+                bp_idx[opts_mesh_name + "/state/cycle"] = out_dom["state/cycle"].to_int32();
+            }
+            if(num_output_domains == 0 && out_dom.has_path("state/time"))
+            {
+                bp_idx[opts_mesh_name + "/state/time"] = out_dom["state/time"].to_double();
             }
+
+            out_dom.reset();
+            num_output_domains++;
         }
+        part.reset();
+        batch_start = batch_end;
     }
-    
+
+    if(num_output_domains == 0)
+    {
+        CONDUIT_ERROR("Partitioning " << root_file_path
+                      << " did not produce any domains.");
+    }
+
+    bp_idx[opts_mesh_name + "/state/number_of_domains"] = num_output_domains;
+
+    // the file pattern needs to be relative to the root file
+    std::string output_dir_base, output_dir_path;
+    utils::rsplit_file_path(output_dir, output_dir_base, output_dir_path);
+
+    Node root;
+    root["blueprint_index"].set(bp_idx);
+    root["protocol/name"]    = file_protocol;
+    root["protocol/version"] = CONDUIT_VERSION;
+    root["number_of_files"]  = num_output_domains;
+    root["number_of_trees"]  = num_output_domains;
+    root["file_pattern"] = utils::join_file_path(output_dir_base,
+                                                 "domain_%06d." + file_protocol);
+    root["tree_pattern"] = "/";
+
+    relay::io::IOHandle root_hnd;
+    Node root_opts;
+    root_opts["mode"] = "wt";
+    root_hnd.open(path + ".root", file_protocol, root_opts);
+    root_hnd.write(root);
+    root_hnd.close();
 }
+#endif
 
 
 //-----------------------------------------------------------------------------
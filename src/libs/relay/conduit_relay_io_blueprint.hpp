@@ -84,6 +84,32 @@ void CONDUIT_RELAY_API save_mesh(const conduit::Node &mesh,
 ///                 <= 0, use # of files == # of domains
 ///                  > 0, # of files == number_of_files
 ///
+///      static_topology: "none", "hash", "assume" (default ==> "none")
+///            with hdf5 and one file per domain, coordsets and topologies
+///            written by an earlier call (with the same path, to other
+///            files) are stored as external links to them.
+///                 "hash", only link entries whose contents are unchanged
+///                 "assume", link them without checking
+///
+///      index_encoding: "none", "narrow", "delta" (default ==> "none")
+///            integer arrays of topologies, adjsets and field values
+///            (connectivity, offsets, global ids, ...) are stored in the
+///            narrowest integer type that holds their values. read_mesh
+///            restores their original dtypes. (not used with silo)
+///                 "narrow", narrow the values
+///                 "delta", also try zigzag encoded differences of
+///                  consecutive values (small for sorted ids) and store
+///                  those when they are narrower
+///
+///      threads: {number of threads}
+///            when "multi_file", write this many data files at once, each
+///            on its own thread with its own handle (default: the hardware
+///            concurrency, at most 8). The root file is written after all
+///            data files. HDF5 files are written on one thread unless
+///            HDF5 was built thread safe, silo files and static_topology
+///            links always are. (without MPI only, with MPI each rank
+///            writes its files on one thread)
+///
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API save_mesh(const conduit::Node &mesh,
                                  const std::string &path,
@@ -98,6 +124,11 @@ void CONDUIT_RELAY_API save_mesh(const conduit::Node &mesh,
 /// Note: These methods use "write" semantics, they will append to existing
 ///       files.
 ///
+/// Note: With the "silo" protocol, domains are written as silo mesh
+///       objects and the root file holds a multimesh per topology and a
+///       multivar per field over all domains. Silo data files are always
+///       written as a whole.
+///
 ///
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API write_mesh(const conduit::Node &mesh,
@@ -127,6 +158,32 @@ void CONDUIT_RELAY_API write_mesh(const conduit::Node &mesh,
 ///                 <= 0, use # of files == # of domains
 ///                  > 0, # of files == number_of_files
 ///
+///      static_topology: "none", "hash", "assume" (default ==> "none")
+///            with hdf5 and one file per domain, coordsets and topologies
+///            written by an earlier call (with the same path, to other
+///            files) are stored as external links to them.
+///                 "hash", only link entries whose contents are unchanged
+///                 "assume", link them without checking
+///
+///      index_encoding: "none", "narrow", "delta" (default ==> "none")
+///            integer arrays of topologies, adjsets and field values
+///            (connectivity, offsets, global ids, ...) are stored in the
+///            narrowest integer type that holds their values. read_mesh
+///            restores their original dtypes. (not used with silo)
+///                 "narrow", narrow the values
+///                 "delta", also try zigzag encoded differences of
+///                  consecutive values (small for sorted ids) and store
+///                  those when they are narrower
+///
+///      threads: {number of threads}
+///            when "multi_file", write this many data files at once, each
+///            on its own thread with its own handle (default: the hardware
+///            concurrency, at most 8). The root file is written after all
+///            data files. HDF5 files are written on one thread unless
+///            HDF5 was built thread safe, silo files and static_topology
+///            links always are. (without MPI only, with MPI each rank
+///            writes its files on one thread)
+///
 ///      truncate: "false", "true" (used if present, default ==> "false")
 ///           when "true" overwrites existing files (relay 'save' semantics)
 ///
@@ -152,6 +209,43 @@ void CONDUIT_RELAY_API read_mesh(const std::string &root_file_path,
 ///      mesh_name: "{name}"
 ///          provide explicit mesh name, for cases where bp data includes
 ///           more than one mesh.
+///
+///      fields: "{name}" or ["{name}", ...]
+///      topologies: "{name}" or ["{name}", ...]
+///      matsets: "{name}" or ["{name}", ...]
+///          only read the listed components. Fields, matsets and other
+///          components on topologies that are not listed are skipped, as
+///          are coordsets no listed topology uses. Names must be in the
+///          mesh index.
+///
+///      domains: [{domain id}, ...]
+///      domain_range: [{begin}, {end}]
+///          only read the listed domains, or the domains in [begin, end)
+///
+///      balance: "count", "bytes", "elements" (default: "count")
+///          how domains are split among MPI ranks. "count" gives each
+///          rank a contiguous block of the same number of domains.
+///          "bytes" and "elements" give out the largest domains first, each
+///          to the rank with the least data so far, using the domain sizes
+///          write_mesh stores in the root file ("count" is used for files
+///          without them).
+///
+///      group_by_file: "true", "false" (default: "false")
+///          keep the domains of each data file on one rank, so each file
+///          is opened once (ignored when there are fewer files than ranks)
+///
+///      threads: {number of threads}
+///          read this many data files at once, each on its own thread
+///          (default: the hardware concurrency, at most 8). HDF5 files
+///          are read on one thread unless HDF5 was built thread safe.
+///
+/// Silo root files (written with the silo protocol, or other silo files
+/// with multimeshes) are read from their multimesh and multivar table of
+/// contents: only the blocks of the selected topologies and fields are
+/// read, skipping silo arrays blueprint does not use. Silo files are read
+/// on one thread; with MPI each rank reads its own domain files. Silo
+/// files not written by write_mesh are read as one topology per multimesh
+/// and one field per multivar.
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API read_mesh(const std::string &root_file_path,
                                  const conduit::Node &opts,
@@ -169,14 +263,328 @@ void CONDUIT_RELAY_API load_mesh(const std::string &root_file_path,
 
 //-----------------------------------------------------------------------------
 ///
+/// opts: see read_mesh
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API load_mesh(const std::string &root_file_path,
+                                 const conduit::Node &opts,
+                                 conduit::Node &mesh);
+
+//-----------------------------------------------------------------------------
+// Partition a blueprint mesh from a root + file set without loading it whole
+//-----------------------------------------------------------------------------
+/// Reads the domains of the mesh described by root_file_path in batches,
+/// runs conduit::blueprint::mesh::partition on each batch with
+/// partition_options, and writes every output domain to
+/// {path}/domain_{id}.{protocol} before reading the next batch. The root
+/// file for the result is written to {path}.root and can be read with
+/// read_mesh.
+///
+/// Domains without a state/domain_id are given their index in the root file.
+/// A "target" in partition_options is shared among the batches in proportion
+/// to the number of input domains each batch holds (each batch makes at
+/// least one domain), so the output has more domains than the target when
+/// there are more batches than the target. Selections only apply to the
+/// domains of the batch that holds them.
+///
 /// opts:
 ///      mesh_name: "{name}"
 ///          provide explicit mesh name, for cases where bp data includes
 ///           more than one mesh.
+///
+///      memory_budget: {# of bytes}
+///          a batch is closed once its domains total at least this many
+///          bytes; <= 0 (default) reads all domains in one batch. Peak
+///          memory is about the budget plus one input domain plus the
+///          partitioned output of the batch.
+///
+void CONDUIT_RELAY_API partition_mesh(const std::string &root_file_path,
+                                      const conduit::Node &partition_options,
+                                      const std::string &path,
+                                      const std::string &protocol,
+                                      const conduit::Node &opts);
+
 //-----------------------------------------------------------------------------
-void CONDUIT_RELAY_API load_mesh(const std::string &root_file_path,
-                                 const conduit::Node &opts,
-                                 conduit::Node &mesh);
+// Read the domains of a blueprint mesh on first access
+//-----------------------------------------------------------------------------
+/// open() only reads the root file. domain(id) reads a domain the first
+/// time it is accessed and returns the same node after that, until it is
+/// released. The fields, topologies and matsets options of read_mesh
+/// apply to every domain read.
+///
+/// Example:
+///   LazyMesh lazy(root_file_path, opts);
+///   Node &dom = lazy.domain(3);
+///
+class CONDUIT_RELAY_API LazyMesh
+{
+public:
+    LazyMesh();
+    LazyMesh(const std::string &root_file_path);
+    LazyMesh(const std::string &root_file_path,
+             const conduit::Node &opts);
+    ~LazyMesh();
+
+    void open(const std::string &root_file_path);
+    void open(const std::string &root_file_path,
+              const conduit::Node &opts);
+
+    bool is_open() const;
+
+    /// releases all domains
+    void close();
+
+    /// the number of domains in the mesh, loaded or not
+    index_t number_of_domains() const;
+
+    /// the blueprint index of the mesh
+    const conduit::Node &mesh_index() const;
+
+    bool is_loaded(index_t domain_id) const;
+
+    /// reads the domain, if it wasn't already
+    conduit::Node &domain(index_t domain_id);
+
+    /// frees a loaded domain, it is read again on the next access
+    void release(index_t domain_id);
+
+    /// the loaded domains, as a multi domain mesh
+    const conduit::Node &loaded_domains() const;
+
+private:
+    LazyMesh(const LazyMesh &);
+    LazyMesh &operator=(const LazyMesh &);
+
+    class State;
+    State *m_state;
+};
+
+//-----------------------------------------------------------------------------
+// Write a blueprint mesh time series, one cycle at a time
+//-----------------------------------------------------------------------------
+/// write(mesh) writes one cycle and its root file,
+/// {path}.cycle_{cycle}.root, which can be read with read_mesh. The cycle
+/// is taken from state/cycle (default: the number of cycles written).
+/// Every cycle must have the same number of domains.
+///
+/// The blueprint index and file layout are computed on the first write and
+/// reused; the index is only regenerated when the names or types of the
+/// components of a domain change.
+///
+/// With the hdf5 protocol each domain has a single file,
+/// {path}/domain_{id}.hdf5, that stays open until close() and holds a
+/// group per cycle. Entries of the "static" components that are the same
+/// as when they were first written are stored once and linked into later
+/// cycles. The writer keeps a copy of these entries to compare against.
+/// An entry that changes is written every cycle from then on. Other
+/// protocols write {path}/cycle_{cycle}_domain_{id}.{protocol} files
+/// holding all of the domain's data each cycle.
+///
+/// opts:
+///      mesh_name: "{name}"
+///          name of the mesh in the root file (default: "mesh")
+///
+///      static: "{component}" or ["{component}", ...]
+///          top level components (such as "coordsets" or "fields") whose
+///          unchanged entries are linked instead of written again
+///          (default: ["coordsets", "topologies"])
+///
+/// Example:
+///   MeshWriter writer("out", "hdf5");
+///   for(...) { advance(mesh); writer.write(mesh); }
+///   writer.close();
+///
+class CONDUIT_RELAY_API MeshWriter
+{
+public:
+    MeshWriter();
+    MeshWriter(const std::string &path,
+               const std::string &protocol);
+    MeshWriter(const std::string &path,
+               const std::string &protocol,
+               const conduit::Node &opts);
+    ~MeshWriter();
+
+    void open(const std::string &path,
+              const std::string &protocol);
+    void open(const std::string &path,
+              const std::string &protocol,
+              const conduit::Node &opts);
+
+    bool is_open() const;
+
+    /// writes one cycle of the mesh
+    void write(const conduit::Node &mesh);
+
+    /// the number of cycles written since open
+    index_t number_of_cycles() const;
+
+    /// closes the data files
+    void close();
+
+private:
+    MeshWriter(const MeshWriter &);
+    MeshWriter &operator=(const MeshWriter &);
+
+    class State;
+    State *m_state;
+};
+
+//-----------------------------------------------------------------------------
+// Write blueprint mesh checkpoints to a fast storage tier and drain them
+// to slower tiers
+//-----------------------------------------------------------------------------
+/// write(mesh) writes a checkpoint with write_mesh to the first (fastest)
+/// tier and returns once it is complete there. The checkpoint is then
+/// copied to each of the other tiers in order, on a background thread
+/// unless the drain option is "sync".
+///
+/// The checkpoint of a cycle is {tier}/{name}.cycle_{cycle}.root and the
+/// data files in the {tier}/{name}.cycle_{cycle} directory. A copy is
+/// complete once its root file holds "checkpoint/complete": it is added
+/// to the root file after write_mesh returns, and drains copy the root
+/// file (under a temporary name that is then renamed) after all data files.
+/// The cycle is taken from state/cycle (default: the number of
+/// checkpoints written).
+///
+/// On restart, latest() and load_latest() find the newest cycle with a
+/// complete copy on any tier and read it from the fastest tier that has
+/// one.
+///
+/// opts:
+///      tiers: ["{dir}", ...]
+///          directories of the tiers, fastest first (required)
+///
+///      name: "{name}"
+///          prefix of the checkpoint files (default: "checkpoint")
+///
+///      protocol: "{protocol}"
+///          protocol of the data and root files, "hdf5" or "json"
+///          (default: "hdf5")
+///
+///      write_options:
+///          options passed to write_mesh, such as mesh_name and
+///          number_of_files (file_style, suffix and truncate are set by
+///          the manager)
+///
+///      drain: "async", "sync"
+///          copy to the slower tiers on a background thread or in
+///          write (default: "async")
+///
+///      keep: {# of checkpoints}
+///          once drained, only the newest this many checkpoints are kept
+///          on the first tier; <= 0 (default) keeps all of them
+///
+/// Example:
+///   Node opts;
+///   opts["tiers"].append().set("/nvme/run");
+///   opts["tiers"].append().set("/lustre/run");
+///   CheckpointManager ckpt(opts);
+///   for(...) { advance(mesh); ckpt.write(mesh); }
+///   ckpt.close();
+///
+class CONDUIT_RELAY_API CheckpointManager
+{
+public:
+    CheckpointManager();
+    CheckpointManager(const conduit::Node &opts);
+    /// waits for drains in progress, drain errors are dropped
+    ~CheckpointManager();
+
+    void open(const conduit::Node &opts);
+
+    bool is_open() const;
+
+    /// writes a checkpoint of the mesh to the first tier and queues its
+    /// copy to the other tiers
+    void write(const conduit::Node &mesh);
+
+    /// blocks until all queued copies are done, raises the first error
+    /// a copy hit since the last wait
+    void wait();
+
+    /// the number of checkpoints not yet copied to all tiers
+    index_t pending_drains() const;
+
+    /// finds the newest cycle with a complete copy on any tier and the
+    /// root file of that copy on the fastest tier holding one, returns
+    /// false if there is no complete checkpoint
+    bool latest(index_t &cycle,
+                std::string &root_file_path) const;
+
+    /// loads the checkpoint latest() finds, returns false if there is none
+    bool load_latest(conduit::Node &mesh) const;
+
+    /// waits for drains (raising their errors) and stops the drain thread
+    void close();
+
+private:
+    CheckpointManager(const CheckpointManager &);
+    CheckpointManager &operator=(const CheckpointManager &);
+
+    class State;
+    State *m_state;
+};
+
+//-----------------------------------------------------------------------------
+// Write a blueprint table one row group at a time
+//-----------------------------------------------------------------------------
+/// Each call to write passes one or more row groups (a table with "values"
+/// or "row_groups", see conduit::blueprint::table) whose columns match the
+/// ones written before them. They are written out as they arrive, so a
+/// table can be built and written without holding all of its rows.
+///
+/// protocol "csv": the rows are appended to the csv file at path (see
+///     relay::io::CSVTableWriter)
+///
+/// other protocols: the file at path holds a table with row groups, each
+///     row group is written to row_groups/{i} when it is passed to write.
+///     hdf5 (the default) writes each row group to the file right away.
+///
+/// opts:
+///      threads: {# of threads}
+///          csv formatting threads, as in write_csv
+///
+/// Example:
+///   TableWriter writer("table.hdf5", "hdf5");
+///   for(...) { fill(row_group); writer.write(row_group); }
+///   writer.close();
+///
+class CONDUIT_RELAY_API TableWriter
+{
+public:
+    TableWriter();
+    TableWriter(const std::string &path,
+                const std::string &protocol);
+    TableWriter(const std::string &path,
+                const std::string &protocol,
+                const conduit::Node &opts);
+    ~TableWriter();
+
+    void open(const std::string &path,
+              const std::string &protocol);
+    void open(const std::string &path,
+              const std::string &protocol,
+              const conduit::Node &opts);
+
+    bool is_open() const;
+
+    /// writes the row groups of a table
+    void write(const conduit::Node &table);
+
+    /// the number of row groups and rows written since open
+    index_t number_of_row_groups() const;
+    index_t number_of_rows() const;
+
+    /// closes the file
+    void close();
+
+private:
+    TableWriter(const TableWriter &);
+    TableWriter &operator=(const TableWriter &);
+
+    class State;
+    State *m_state;
+};
 
 
 //-----------------------------------------------------------------------------
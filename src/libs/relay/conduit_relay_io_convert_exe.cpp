@@ -13,7 +13,16 @@
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
 #include "conduit_relay_io_hdf5.hpp"
 #endif
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+#include "conduit_relay_mpi_io_blueprint.hpp"
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+#include "conduit_relay_mpi_io_hdf5.hpp"
+#endif
+#include <mpi.h>
+#endif
+#include <future>
 #include <iostream>
+#include <sstream>
 #include <stdlib.h>
 
 using namespace conduit;
@@ -25,13 +34,23 @@ void
 usage()
 {
     std::cout << "usage: conduit_relay_io_convert {input file} {output file}"
-              << std::endl << std::endl 
+              << std::endl << std::endl
               << " optional arguments:"
               << std::endl
-              << "  --read-proto  {relay protocol string used to read data file}"
+              << "  --read-protocol  {relay protocol string used to read data file}"
+              << std::endl
+              << "  --write-protocol {relay protocol string used to write data file}"
               << std::endl
-              << "  --write-proto {relay protocol string used to read data file}"
               << "  --opts  {options file}"
+              << std::endl
+              << "  --max-bytes {bytes of data read before it is written"
+              << " (default: 268435456)}"
+              << std::endl
+              << "  --mesh  {convert a blueprint mesh root file"
+              << " (with MPI, domains are spread across ranks)}"
+              << std::endl << std::endl
+              << " Protocols supported by relay::io::IOHandle are converted"
+              << " leaf by leaf, others are loaded whole."
               << std::endl << std::endl ;
 
 }
@@ -44,7 +63,9 @@ parse_args(int argc,
            std::string &output_file,
            std::string &read_proto,
            std::string &write_proto,
-           std::string &opts_file)
+           std::string &opts_file,
+           index_t &max_bytes,
+           bool &mesh)
 {
     for(int i=1; i < argc ; i++)
     {
@@ -79,6 +100,20 @@ parse_args(int argc,
             opts_file = std::string(argv[i+1]);
             i++;
         }
+        else if(arg_str == "--max-bytes")
+        {
+            if(i+1 >= argc || !utils::string_is_integer(argv[i+1]))
+            {
+                CONDUIT_ERROR("expected integer value following --max-bytes option");
+            }
+
+            max_bytes = utils::string_to_value<index_t>(std::string(argv[i+1]));
+            i++;
+        }
+        else if(arg_str == "--mesh")
+        {
+            mesh = true;
+        }
         else if(input_file == "")
         {
             input_file = arg_str;
@@ -90,7 +125,282 @@ parse_args(int argc,
     }
 }
 
+//-----------------------------------------------------------------------------
+// protocols IOHandle can read from or write to
+//-----------------------------------------------------------------------------
+bool
+handle_supports(const std::string &protocol,
+                bool write)
+{
+    if(protocol == "conduit_bin" ||
+       protocol == "json" ||
+       protocol == "conduit_json" ||
+       protocol == "conduit_base64_json" ||
+       protocol == "yaml")
+    {
+        return true;
+    }
+
+    if(protocol == "sidre_hdf5")
+    {
+        return !write;
+    }
+
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    if(protocol == "hdf5")
+    {
+        return true;
+    }
+#endif
 
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Copies an input handle to an output handle in batches of leaves.
+//
+// Leaves (and lists, which are copied whole) are read into a batch until it
+// holds max_bytes, then the batch is written and released. When both
+// libraries allow it, the batch is written on the output handle's background
+// thread while the next one is read, so at most two batches are in memory.
+//-----------------------------------------------------------------------------
+class HandleConverter
+{
+public:
+    HandleConverter(io::IOHandle &in,
+                    io::IOHandle &out,
+                    index_t max_bytes,
+                    bool async)
+    : m_in(in),
+      m_out(out),
+      m_max_bytes(max_bytes),
+      m_async(async),
+      m_curr(0),
+      m_batch_bytes(0)
+    {
+        // empty
+    }
+
+    void convert()
+    {
+        convert_subtree("");
+        flush();
+        if(m_pending.valid())
+        {
+            m_pending.get();
+        }
+    }
+
+private:
+
+    //-------------------------------------------------------------------------
+    static bool is_list_like(const std::vector<std::string> &names)
+    {
+        std::ostringstream oss;
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            oss.str("");
+            oss << i;
+            if(names[i] != oss.str())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    void convert_subtree(const std::string &path)
+    {
+        std::vector<std::string> names;
+        if(path.empty())
+        {
+            m_in.list_child_names(names);
+        }
+        else
+        {
+            m_in.list_child_names(path, names);
+        }
+
+        if(names.empty() || is_list_like(names))
+        {
+            // a leaf, an empty object or a list
+            Node &dest = path.empty() ? m_batch[m_curr]
+                                      : m_batch[m_curr][path];
+            if(path.empty())
+            {
+                m_in.read(dest);
+            }
+            else
+            {
+                m_in.read(path, dest);
+            }
+
+            m_batch_bytes += dest.total_bytes_compact();
+            if(m_batch_bytes >= m_max_bytes)
+            {
+                flush();
+            }
+            return;
+        }
+
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            convert_subtree(path.empty() ? names[i]
+                                         : utils::join_path(path, names[i]));
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void flush()
+    {
+        Node &batch = m_batch[m_curr];
+        if(batch.dtype().is_empty())
+        {
+            return;
+        }
+
+        if(m_async)
+        {
+            // the other batch is free to reuse once its write finishes
+            if(m_pending.valid())
+            {
+                m_pending.get();
+            }
+            Node opts;
+            opts["async/snapshot"] = "reference";
+            m_pending = m_out.write_async(batch, opts);
+            m_curr = 1 - m_curr;
+        }
+        else
+        {
+            m_out.write(batch);
+        }
+
+        m_batch[m_curr].reset();
+        m_batch_bytes = 0;
+    }
+
+    io::IOHandle     &m_in;
+    io::IOHandle     &m_out;
+    index_t           m_max_bytes;
+    bool              m_async;
+
+    Node              m_batch[2];
+    int               m_curr;
+    index_t           m_batch_bytes;
+    std::future<void> m_pending;
+};
+
+//-----------------------------------------------------------------------------
+void
+convert_file(const std::string &input_file,
+             const std::string &output_file,
+             std::string read_proto,
+             std::string write_proto,
+             index_t max_bytes)
+{
+    if(read_proto.empty())
+    {
+        io::identify_protocol(input_file, read_proto);
+    }
+
+    if(write_proto.empty())
+    {
+        io::identify_protocol(output_file, write_proto);
+    }
+
+    if(!handle_supports(read_proto, false) ||
+       !handle_supports(write_proto, true))
+    {
+        // load data from the file
+        Node data;
+        relay::io::load(input_file, read_proto, data);
+        relay::io::save(data, output_file, write_proto);
+        return;
+    }
+
+    // hdf5 calls from the output handle's background thread are only
+    // allowed when hdf5 is thread safe
+    bool async = true;
+#if !defined(CONDUIT_RELAY_IO_HDF5_ENABLED) || !defined(H5_HAVE_THREADSAFE)
+    if(read_proto == "hdf5" || read_proto == "sidre_hdf5" ||
+       write_proto == "hdf5")
+    {
+        async = false;
+    }
+#endif
+
+    Node in_opts;
+    in_opts["mode"] = "r";
+    io::IOHandle in;
+    in.open(input_file, read_proto, in_opts);
+
+    Node out_opts;
+    out_opts["mode"] = "w";
+    io::IOHandle out;
+    out.open(output_file, write_proto, out_opts);
+
+    HandleConverter converter(in, out, max_bytes, async);
+    converter.convert();
+
+    out.close();
+    in.close();
+}
+
+//-----------------------------------------------------------------------------
+void
+convert_mesh(const std::string &input_file,
+             const std::string &output_file,
+             const std::string &write_proto,
+             const Node &opts)
+{
+    Node read_opts;
+    if(opts.has_child("read_mesh"))
+    {
+        read_opts.set(opts["read_mesh"]);
+    }
+
+    Node write_opts;
+    write_opts["suffix"] = "none";
+    if(opts.has_child("write_mesh"))
+    {
+        write_opts.update(opts["write_mesh"]);
+    }
+
+    // write_mesh adds the ".root" extension
+    std::string output_base = output_file;
+    std::string ext = ".root";
+    if(output_base.size() > ext.size() &&
+       output_base.compare(output_base.size() - ext.size(),
+                           ext.size(),
+                           ext) == 0)
+    {
+        output_base = output_base.substr(0, output_base.size() - ext.size());
+    }
+
+    std::string protocol = write_proto.empty() ? "hdf5" : write_proto;
+
+    Node mesh;
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // each rank reads and writes its share of the domains
+    relay::mpi::io::blueprint::read_mesh(input_file,
+                                         read_opts,
+                                         mesh,
+                                         MPI_COMM_WORLD);
+    relay::mpi::io::blueprint::write_mesh(mesh,
+                                          output_base,
+                                          protocol,
+                                          write_opts,
+                                          MPI_COMM_WORLD);
+#else
+    relay::io::blueprint::read_mesh(input_file, read_opts, mesh);
+    relay::io::blueprint::write_mesh(mesh,
+                                     output_base,
+                                     protocol,
+                                     write_opts);
+#endif
+}
 
 //-----------------------------------------------------------------------------
 int
@@ -101,12 +411,20 @@ main(int argc, char* argv[])
         usage();
         return -1;
     }
-    
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Init(&argc, &argv);
+    int par_rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &par_rank);
+#endif
+
     std::string input_file("");
     std::string output_file("");
     std::string read_proto("");
     std::string write_proto("");
     std::string opts_file("");
+    index_t     max_bytes = 256 * 1024 * 1024;
+    bool        mesh = false;
 
     parse_args(argc,
                argv,
@@ -114,20 +432,28 @@ main(int argc, char* argv[])
                output_file,
                read_proto,
                write_proto,
-               opts_file);
+               opts_file,
+               max_bytes,
+               mesh);
 
+    Node opts;
     if(opts_file != "")
     {
-        Node opts;
         CONDUIT_INFO("Using opts file:" << opts_file);
         io::load(opts_file,opts);
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
         io::hdf5_set_options(opts["hdf5"]);
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+        relay::mpi::io::hdf5_set_options(opts["hdf5"]);
+#endif
 #endif
     }
-    
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    if(par_rank == 0)
+#endif
     relay::about();
-    
+
     if(input_file.empty())
     {
         CONDUIT_ERROR("no input file passed");
@@ -138,25 +464,26 @@ main(int argc, char* argv[])
         CONDUIT_ERROR("no output file passed");
     }
 
-    // load data from the file
-    Node data;
-    if(read_proto.empty())
+    if(mesh)
     {
-        relay::io::load(input_file,data);
+        convert_mesh(input_file, output_file, write_proto, opts);
     }
     else
     {
-        relay::io::load(input_file, read_proto, data);
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+        // only mesh conversion is spread across ranks
+        if(par_rank == 0)
+#endif
+        convert_file(input_file,
+                     output_file,
+                     read_proto,
+                     write_proto,
+                     max_bytes);
     }
 
-    if(write_proto.empty())
-    {
-        relay::io::save(data,output_file);
-    }
-    else
-    {
-        relay::io::save(data, output_file, write_proto);
-    }
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Finalize();
+#endif
 
     return 0;
 }
@@ -7,9 +7,23 @@
 /// file: conduit_relay_io_csv.cpp
 ///
 //-----------------------------------------------------------------------------
-#include "conduit_relay_io_csv.hpp"
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    #include "conduit_relay_mpi.hpp"
+    #include "conduit_relay_mpi_io_csv.hpp"
+#else
+    #include "conduit_relay_io_csv.hpp"
+#endif
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+// Define an argument macro that adds the communicator argument.
+#define CONDUIT_RELAY_COMMUNICATOR_ARG(ARG) ,ARG
+#else
+// Define an argument macro that does not add the communicator argument.
+#define CONDUIT_RELAY_COMMUNICATOR_ARG(ARG)
+#endif
 
 #include <algorithm>
+#include <cctype>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
@@ -18,9 +32,16 @@
 #include <utility>
 #include <type_traits>
 #include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
 
 #include "conduit_log.hpp"
+#include "conduit_fmt/conduit_fmt.h"
+#include "conduit_blueprint_mesh.hpp"
 #include "conduit_blueprint_table.hpp"
+#include "conduit_relay_io_utils.hpp"
 
 using conduit::utils::log::quote;
 
@@ -44,14 +65,43 @@ namespace conduit
 namespace relay
 {
 
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
 //-----------------------------------------------------------------------------
-// -- begin conduit::relay::io --
+// -- begin conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+#endif
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::<mpi>::io --
 //-----------------------------------------------------------------------------
 namespace io
 {
 
 // Static functions, internal types
 
+//-----------------------------------------------------------------------------
+// Number of threads used to parse or format rows, from options["threads"].
+// Values <= 0 (the default) select up to 8 based on the hardware.
+static index_t
+get_num_threads(const Node &opts)
+{
+    index_t res = 0;
+    if(opts.has_child("threads"))
+    {
+        res = opts["threads"].to_index_t();
+    }
+
+    if(res <= 0)
+    {
+        res = std::min((index_t)8,
+                       std::max((index_t)1,
+                                (index_t)std::thread::hardware_concurrency()));
+    }
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 static index_t
 get_nrows(const Node &table)
@@ -71,7 +121,7 @@ get_nrows(const Node &table)
 
 //-----------------------------------------------------------------------------
 static void
-write_header(const Node &values, std::ofstream &fout)
+write_header(const Node &values, std::ostream &fout)
 {
     const index_t ncols = values.number_of_children();
     for(index_t col = 0; col < ncols; col++)
@@ -99,37 +149,159 @@ write_header(const Node &values, std::ofstream &fout)
 }
 
 //-----------------------------------------------------------------------------
+// A column (or mcarray component) resolved once for formatting: the address
+// of its first value, the bytes between values and the formatter for its type.
+//-----------------------------------------------------------------------------
+struct CSVColumn
+{
+    typedef void (*FormatFunc)(const uint8 *, conduit_fmt::memory_buffer &);
+
+    const uint8 *data;
+    index_t      stride;
+    FormatFunc   format;
+};
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static void
+format_integer(const uint8 *ptr, conduit_fmt::memory_buffer &buf)
+{
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    const conduit_fmt::format_int f(value);
+    buf.append(f.data(), f.data() + f.size());
+}
+
+//-----------------------------------------------------------------------------
+// Floats are written like std::ostream does by default ("%g", 6 digits).
+template<typename T>
 static void
-write_element(const Node &e, std::ostream &fout)
+format_float(const uint8 *ptr, conduit_fmt::memory_buffer &buf)
 {
-    if(e.dtype().is_unsigned_integer())
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    conduit_fmt::format_to(buf, "{:g}", value);
+}
+
+//-----------------------------------------------------------------------------
+static void
+format_char(const uint8 *ptr, conduit_fmt::memory_buffer &buf)
+{
+    if(*ptr != 0)
     {
-        fout << e.to_uint64();
+        buf.push_back(static_cast<char>(*ptr));
     }
-    else if(e.dtype().is_integer())
+}
+
+//-----------------------------------------------------------------------------
+static void
+format_nothing(const uint8 *, conduit_fmt::memory_buffer &)
+{
+}
+
+//-----------------------------------------------------------------------------
+static CSVColumn
+make_column(const Node &n)
+{
+    CSVColumn col;
+    col.data = static_cast<const uint8*>(n.element_ptr(0));
+    col.stride = n.dtype().stride();
+    switch(n.dtype().id())
     {
-        fout << e.to_int64();
+        case DataType::INT8_ID:    col.format = format_integer<int8>;    break;
+        case DataType::INT16_ID:   col.format = format_integer<int16>;   break;
+        case DataType::INT32_ID:   col.format = format_integer<int32>;   break;
+        case DataType::INT64_ID:   col.format = format_integer<int64>;   break;
+        case DataType::UINT8_ID:   col.format = format_integer<uint8>;   break;
+        case DataType::UINT16_ID:  col.format = format_integer<uint16>;  break;
+        case DataType::UINT32_ID:  col.format = format_integer<uint32>;  break;
+        case DataType::UINT64_ID:  col.format = format_integer<uint64>;  break;
+        case DataType::FLOAT32_ID: col.format = format_float<float32>;   break;
+        case DataType::FLOAT64_ID: col.format = format_float<float64>;   break;
+        case DataType::CHAR8_STR_ID: col.format = format_char;           break;
+        default:                   col.format = format_nothing;          break;
     }
-    else if(e.dtype().is_float32())
+    return col;
+}
+
+//-----------------------------------------------------------------------------
+static void
+format_rows(const std::vector<CSVColumn> &cols, index_t row_begin,
+    index_t row_end, conduit_fmt::memory_buffer &buf)
+{
+    const char col_sep[] = ", ";
+    const size_t ncols = cols.size();
+    for(index_t row = row_begin; row < row_end; row++)
     {
-        fout << e.as_float32();
+        for(size_t c = 0; c < ncols; c++)
+        {
+            const CSVColumn &col = cols[c];
+            if(c != 0) buf.append(col_sep, col_sep + 2);
+            col.format(col.data + row * col.stride, buf);
+        }
+        buf.push_back('\n');
     }
-    else if(e.dtype().is_float64())
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Writes each row: col0, col1, col2, col3 ... The columns are resolved
+    once, then blocks of rows are formatted into reusable buffers (one per
+    thread, "num_threads" blocks at a time) and written in order.
+*/
+static void
+write_rows(const Node &values, index_t nrows, std::ostream &fout,
+    index_t num_threads = 1)
+{
+    std::vector<CSVColumn> cols;
+    const index_t ncols = values.number_of_children();
+    for(index_t col = 0; col < ncols; col++)
     {
-        fout << e.as_float64();
+        const Node &value = values[col];
+        const index_t nc = value.number_of_children();
+        if(nc > 0)
+        {
+            for(index_t c = 0; c < nc; c++)
+            {
+                cols.push_back(make_column(value[c]));
+            }
+        }
+        else
+        {
+            cols.push_back(make_column(value));
+        }
     }
-    else if(e.dtype().is_string())
+
+    const index_t block_rows = 65536;
+    num_threads = std::max((index_t)1, num_threads);
+    std::vector<conduit_fmt::memory_buffer> bufs((size_t)num_threads);
+    for(index_t batch = 0; batch < nrows; batch += block_rows * num_threads)
     {
-        fout << e.as_string();
+        const index_t nblocks = std::min(num_threads,
+            (nrows - batch + block_rows - 1) / block_rows);
+        relay::io::detail::run_tasks(nblocks, num_threads, [&](index_t i)
+        {
+            conduit_fmt::memory_buffer &buf = bufs[(size_t)i];
+            buf.clear();
+            const index_t row_begin = batch + i * block_rows;
+            format_rows(cols, row_begin,
+                std::min(nrows, row_begin + block_rows), buf);
+        });
+
+        for(index_t i = 0; i < nblocks; i++)
+        {
+            const conduit_fmt::memory_buffer &buf = bufs[(size_t)i];
+            fout.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        }
     }
 }
 
+#ifndef CONDUIT_RELAY_IO_MPI_ENABLED
 //-----------------------------------------------------------------------------
 static void
-write_row_based(const Node &table, const std::string &path)
+write_row_based(const Node &table, const std::string &path,
+    index_t num_threads)
 {
-    const Node &values = table["values"];
-
     // Open the file
     std::ofstream fout(path);
     if(!fout.is_open())
@@ -138,54 +310,31 @@ write_row_based(const Node &table, const std::string &path)
         return;
     }
 
-    // First line, column names
-    write_header(values, fout);
-
-    // Write each row: col0, col1, col2, col3 ...
-    const index_t nrows = get_nrows(table);
-    const index_t ncols = values.number_of_children();
-    Node temp;
-    for(index_t row = 0; row < nrows; row++)
+    // First line, column names, then the rows of each row group
+    blueprint::table::iterate_row_groups(table,
+        [&](index_t row_offset, const Node &row_group)
     {
-        for(index_t col = 0; col < ncols; col++)
+        const Node &values = row_group["values"];
+        if(row_offset == 0)
         {
-            const Node &value = values[col];
-            const index_t nc = value.number_of_children();
-            if(nc > 0)
-            {
-                for(index_t c = 0; c < nc; c++)
-                {
-                    const Node &comp = value[c];
-                    temp.set_external(DataType(comp.dtype().id(), 1),
-                        const_cast<void*>(comp.element_ptr(row)));
-                    write_element(temp, fout);
-                    if(c != (nc - 1)) fout << ", ";
-                }
-            }
-            else
-            {
-                temp.set_external(DataType(value.dtype().id(), 1),
-                    const_cast<void*>(value.element_ptr(row)));
-                write_element(temp, fout);
-            }
-
-            if(col != (ncols - 1)) fout << ", ";
+            write_header(values, fout);
         }
-        fout << "\n";
-    }
+        write_rows(values, get_nrows(row_group), fout, num_threads);
+    });
 }
 
 //-----------------------------------------------------------------------------
 static void
-write_single_table(const Node &table, const std::string &path)
+write_single_table(const Node &table, const std::string &path,
+    index_t num_threads)
 {
-    // IDEA: Write column based writer and benchmark performance
-    write_row_based(table, path);
+    write_row_based(table, path, num_threads);
 }
 
 //-----------------------------------------------------------------------------
 static void
-write_multiple_tables(const Node &all_tables, const std::string &base_path)
+write_multiple_tables(const Node &all_tables, const std::string &base_path,
+    index_t num_threads)
 {
     const index_t ntables = all_tables.number_of_children();
     if(ntables < 1)
@@ -201,7 +350,7 @@ write_multiple_tables(const Node &all_tables, const std::string &base_path)
             const Node &table = all_tables[i];
             const std::string full_path = base_path + utils::file_path_separator()
                 + table_list_prefix + std::to_string(i) + ".csv";
-            write_single_table(table, full_path);
+            write_single_table(table, full_path, num_threads);
         }
     }
     else // if(table.dtype().is_object())
@@ -211,11 +360,117 @@ write_multiple_tables(const Node &all_tables, const std::string &base_path)
             const Node &table = all_tables[i];
             const std::string full_path = base_path + utils::file_path_separator()
                 + table.name() + ".csv";
-            write_single_table(table, full_path);
+            write_single_table(table, full_path, num_threads);
         }
     }
 }
 
+#else
+//-----------------------------------------------------------------------------
+static void
+write_single_table(const Node &table, const std::string &path,
+    index_t num_threads, MPI_Comm comm)
+{
+    const int rank = relay::mpi::rank(comm);
+    const int size = relay::mpi::size(comm);
+    const index_t nrows = blueprint::table::number_of_rows(table);
+
+    // The first rank with rows writes the header in front of its rows, the
+    // ranks before it have nothing to write. Rank 0 writes the header when
+    // no rank has rows.
+    int my_first = (nrows > 0) ? rank : size;
+    int first = size;
+    MPI_Allreduce(&my_first, &first, 1, MPI_INT, MPI_MIN, comm);
+    if(first == size)
+    {
+        first = 0;
+    }
+
+    std::ostringstream oss;
+    blueprint::table::iterate_row_groups(table,
+        [&](index_t row_offset, const Node &row_group)
+    {
+        const Node &values = row_group["values"];
+        if(row_offset == 0 && rank == first)
+        {
+            write_header(values, oss);
+        }
+        write_rows(values, get_nrows(row_group), oss, num_threads);
+    });
+    const std::string buffer = oss.str();
+
+    // Each rank's text starts where the text of the ranks before it ends.
+    uint64 my_bytes = buffer.size();
+    uint64 offset = 0;
+    uint64 total = 0;
+    MPI_Exscan(&my_bytes, &offset, 1, MPI_UINT64_T, MPI_SUM, comm);
+    if(rank == 0)
+    {
+        // MPI_Exscan leaves the first rank's result undefined
+        offset = 0;
+    }
+    MPI_Allreduce(&my_bytes, &total, 1, MPI_UINT64_T, MPI_SUM, comm);
+
+    MPI_File fh;
+    char *c_path = const_cast<char*>(path.c_str());
+    if(MPI_File_open(comm, c_path, MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                     MPI_INFO_NULL, &fh) != MPI_SUCCESS)
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+    }
+    // Overwrite semantics, drop anything past the end of the new text.
+    MPI_File_set_size(fh, static_cast<MPI_Offset>(total));
+
+    // MPI counts are ints, so large buffers are written in pieces. The writes
+    // are collective, every rank makes the same number of calls.
+    const uint64 max_piece = static_cast<uint64>(std::numeric_limits<int>::max());
+    uint64 my_pieces = (my_bytes + max_piece - 1) / max_piece;
+    uint64 npieces = 0;
+    MPI_Allreduce(&my_pieces, &npieces, 1, MPI_UINT64_T, MPI_MAX, comm);
+    for(uint64 i = 0; i < npieces; i++)
+    {
+        const uint64 begin = std::min(i * max_piece, my_bytes);
+        const uint64 end = std::min(begin + max_piece, my_bytes);
+        MPI_File_write_at_all(fh, static_cast<MPI_Offset>(offset + begin),
+            const_cast<char*>(buffer.data() + begin),
+            static_cast<int>(end - begin), MPI_CHAR, MPI_STATUS_IGNORE);
+    }
+    MPI_File_close(&fh);
+}
+
+//-----------------------------------------------------------------------------
+static void
+write_multiple_tables(const Node &all_tables, const std::string &base_path,
+    index_t num_threads, MPI_Comm comm)
+{
+    const index_t ntables = all_tables.number_of_children();
+    if(ntables < 1)
+    {
+        return;
+    }
+
+    if(relay::mpi::rank(comm) == 0)
+    {
+        utils::create_directory(base_path);
+    }
+    MPI_Barrier(comm);
+
+    // Every rank has the same tables, in the same order.
+    for(index_t i = 0; i < ntables; i++)
+    {
+        const Node &table = all_tables[i];
+        const std::string name = all_tables.dtype().is_list()
+            ? table_list_prefix + std::to_string(i)
+            : table.name();
+        const std::string full_path = base_path + utils::file_path_separator()
+            + name + ".csv";
+        write_single_table(table, full_path, num_threads, comm);
+    }
+}
+
+#endif
+
+#ifndef CONDUIT_RELAY_IO_MPI_ENABLED
 //-----------------------------------------------------------------------------
 static Node &
 add_column(const std::string &name, Node &values)
@@ -246,8 +501,9 @@ add_column(const std::string &name, Node &values)
 //-----------------------------------------------------------------------------
 static void
 add_columns(Node &values, std::vector<std::string> &col_names,
-    index_t ncols, const DataType &dtype)
+    index_t ncols, const DataType &dtype, std::vector<Node*> &cols)
 {
+    cols.clear();
     if(col_names.empty())
     {
         for(index_t i = 0; i < ncols; i++)
@@ -255,6 +511,7 @@ add_columns(Node &values, std::vector<std::string> &col_names,
             Node &col = add_column("", values);
             col.set_dtype(dtype);
             col_names.push_back(col.name());
+            cols.push_back(&col);
         }
     }
     else
@@ -263,6 +520,7 @@ add_columns(Node &values, std::vector<std::string> &col_names,
         {
             Node &col = add_column(name, values);
             col.set_dtype(dtype);
+            cols.push_back(&col);
         }
     }
 }
@@ -323,122 +581,244 @@ read_column_names(const std::string &line, std::vector<std::string> &col_names,
 }
 
 //-----------------------------------------------------------------------------
-template<typename FloatType>
-void
-read_csv_data(std::ifstream &fin, const std::ifstream::pos_type &offset,
-    const std::vector<std::string> &col_names, Node &values,
-    const char sep = ',')
+/**
+@brief Maps the file into memory, the returned bytes are valid while "buffer"
+    is. Files that can not be mapped (the map is writable, so read-only files
+    can not be) are read into "buffer" instead.
+*/
+static const char *
+map_file(const std::string &path, Node &buffer, index_t &nbytes)
 {
-    static_assert(std::is_floating_point<FloatType>().value,
-        "Function can only read floating point types from CSV file.");
-    std::string line;
-    fin.clear();
-    fin.seekg(offset, fin.beg);
-    index_t row = 0;
-    while(std::getline(fin, line))
-    {
-        std::size_t icol = 0;
-        std::size_t start = 0;
-        std::size_t end = line.find(sep);
-        while(end != std::string::npos)
-        {
-            const auto len = end - start;
-            if(icol > col_names.size())
-            {
-                CONDUIT_ERROR("Error while reading file, row " << row << " contains too many column entries!");
-                return;
-            }
+    nbytes = utils::file_size(path);
+    if(nbytes <= 0)
+    {
+        nbytes = 0;
+        return nullptr;
+    }
 
-            Node *n = values.fetch_ptr(col_names[icol]);
-            if(!n)
-            {
-                CONDUIT_ERROR("The allocated output table does not contain the path " << quote(col_names[icol]) << ".");
-                return;
-            }
+    try
+    {
+        Node mmap_opts;
+        mmap_opts["advice"] = "sequential";
+        buffer.mmap(path, Schema(DataType::uint8(nbytes)), mmap_opts);
+    }
+    catch(const conduit::Error &)
+    {
+        buffer.set(DataType::uint8(nbytes));
+        std::ifstream fin(path, std::ios::binary);
+        if(!fin.read(static_cast<char*>(buffer.data_ptr()), nbytes))
+        {
+            CONDUIT_ERROR("Unable to read file " << quote(path) << ".");
+        }
+    }
+    return static_cast<const char*>(buffer.data_ptr());
+}
 
-            std::string data = line.substr(start, len);
-            try
-            {
-                if(std::is_same<float, FloatType>().value)
-                {
-                    float *d = static_cast<float*>(n->element_ptr(row));
-                    *d = std::stof(data);
-                }
-                else if(std::is_same<double, FloatType>().value)
-                {
-                    double *d = static_cast<double*>(n->element_ptr(row));
-                    *d = std::stod(data);
-                }
-#ifdef CONDUIT_HAS_LONG_DOUBLE
-                else if(std::is_same<long double, FloatType>().value)
-                {
-                    long double *d = static_cast<long double*>(n->element_ptr(row));
-                    *d = std::stold(data);
-                }
-#endif
-            }
-            catch (...)
-            {
-                CONDUIT_ERROR("Unable to parse row " << row << " in column " << icol << "."
-                    << " The string " << quote(data) << "is not a number.");
-            }
+//-----------------------------------------------------------------------------
+// Returns the end of the line that starts at "p" (its '\n' or "end").
+static const char *
+line_end(const char *p, const char *end)
+{
+    const void *eol = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    return eol ? static_cast<const char*>(eol) : end;
+}
 
-            // Update positions
-            icol++;
-            start = end + 1;
-            end = line.find(sep, start);
+//-----------------------------------------------------------------------------
+static bool
+is_blank(const char *begin, const char *end)
+{
+    for(const char *p = begin; p != end; p++)
+    {
+        if(!std::isspace(static_cast<unsigned char>(*p)))
+        {
+            return false;
         }
-        // Get the last name
-        if(icol > col_names.size())
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Number of rows (non-blank lines) in [begin, end).
+static index_t
+count_rows(const char *begin, const char *end)
+{
+    index_t nrows = 0;
+    for(const char *p = begin; p < end;)
+    {
+        const char *eol = line_end(p, end);
+        if(!is_blank(p, eol))
         {
-            CONDUIT_ERROR("Error while reading file, row " << row << " contains too many column entries!");
-            return;
+            nrows++;
         }
+        p = eol + 1;
+    }
+    return nrows;
+}
+
+//-----------------------------------------------------------------------------
+inline void
+parse_value(const char *s, char **s_end, float &value)
+{
+    value = std::strtof(s, s_end);
+}
+
+inline void
+parse_value(const char *s, char **s_end, double &value)
+{
+    value = std::strtod(s, s_end);
+}
+
+#ifdef CONDUIT_HAS_LONG_DOUBLE
+inline void
+parse_value(const char *s, char **s_end, long double &value)
+{
+    value = std::strtold(s, s_end);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+/**
+@brief Parses the field [begin, end) into "value". The field is copied so it
+    is null terminated, the mapped file is not.
+*/
+template<typename FloatType>
+void
+read_field(const char *begin, const char *end, index_t row, index_t icol,
+    FloatType &value)
+{
+    char small[64];
+    std::string large;
+    const size_t len = static_cast<size_t>(end - begin);
+    const char *field = small;
+    if(len < sizeof(small))
+    {
+        std::memcpy(small, begin, len);
+        small[len] = '\0';
+    }
+    else
+    {
+        large.assign(begin, len);
+        field = large.c_str();
+    }
 
-        Node *n = values.fetch_ptr(col_names[icol]);
-        if(!n)
+    char *field_end = nullptr;
+    parse_value(field, &field_end, value);
+    if(field_end == field)
+    {
+        CONDUIT_ERROR("Unable to parse row " << row << " in column " << icol << "."
+            << " The string " << quote(std::string(begin, len)) << " is not a number.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Parses the rows in [begin, end) into the columns, starting at row
+    "first_row".
+*/
+template<typename FloatType>
+void
+read_csv_rows(const char *begin, const char *end, index_t first_row,
+    const std::vector<FloatType*> &cols, const char sep = ',')
+{
+    static_assert(std::is_floating_point<FloatType>().value,
+        "Function can only read floating point types from CSV file.");
+    const size_t ncols = cols.size();
+    index_t row = first_row;
+    for(const char *p = begin; p < end;)
+    {
+        const char *eol = line_end(p, end);
+        if(is_blank(p, eol))
         {
-            CONDUIT_ERROR("The allocated output table does not contain the path " << quote(col_names[icol]) << ".");
-            return;
+            p = eol + 1;
+            continue;
         }
 
-        std::string data = line.substr(start);
-        try
+        size_t icol = 0;
+        const char *start = p;
+        while(true)
         {
-            if(std::is_same<float, FloatType>().value)
-            {
-                float *d = static_cast<float*>(n->element_ptr(row));
-                *d = std::stof(data);
-            }
-            else if(std::is_same<double, FloatType>().value)
+            const void *found = std::memchr(start, sep,
+                static_cast<size_t>(eol - start));
+            const char *field_end = found ? static_cast<const char*>(found) : eol;
+            if(icol >= ncols)
             {
-                double *d = static_cast<double*>(n->element_ptr(row));
-                *d = std::stod(data);
+                CONDUIT_ERROR("Error while reading file, row " << row << " contains too many column entries!");
             }
-#ifdef CONDUIT_HAS_LONG_DOUBLE
-            else if(std::is_same<long double, FloatType>().value)
+            read_field(start, field_end, row, static_cast<index_t>(icol),
+                cols[icol][row]);
+            icol++;
+            if(!found)
             {
-                long double *d = static_cast<long double*>(n->element_ptr(row));
-                *d = std::stold(data);
+                break;
             }
-#endif
+            start = field_end + 1;
         }
-        catch (...)
+
+        if(icol != ncols)
         {
-            CONDUIT_ERROR("Unable to parse row " << row << " in column " << icol << "."
-                << " The string " << quote(data) << "is not a number.");
+            CONDUIT_ERROR("Error while reading file, row " << row << " contains too few column entries!");
         }
         row++;
+        p = eol + 1;
     }
 }
 
+//-----------------------------------------------------------------------------
+/**
+@brief Splits [begin, end) into up to "nchunks" pieces that start at the
+    beginning of a line. Returns the nchunks + 1 chunk boundaries.
+*/
+static std::vector<const char*>
+split_lines(const char *begin, const char *end, index_t nchunks)
+{
+    std::vector<const char*> bounds(1, begin);
+    const index_t nbytes = static_cast<index_t>(end - begin);
+    for(index_t i = 1; i < nchunks; i++)
+    {
+        const char *p = std::max(begin + (nbytes * i) / nchunks, bounds.back());
+        if(p != begin && p < end && p[-1] != '\n')
+        {
+            p = line_end(p, end);
+            p = (p < end) ? p + 1 : end;
+        }
+        bounds.push_back(p);
+    }
+    bounds.push_back(end);
+    return bounds;
+}
+
+//-----------------------------------------------------------------------------
+template<typename FloatType>
+void
+read_csv_data(index_t num_threads, const std::vector<const char*> &bounds,
+    const std::vector<index_t> &chunk_rows, const std::vector<Node*> &cols)
+{
+    std::vector<FloatType*> col_ptrs;
+    for(Node *col : cols)
+    {
+        col_ptrs.push_back(static_cast<FloatType*>(col->data_ptr()));
+    }
+
+    const index_t nchunks = static_cast<index_t>(chunk_rows.size());
+    std::vector<index_t> first_rows(chunk_rows.size(), 0);
+    for(index_t i = 1; i < nchunks; i++)
+    {
+        first_rows[i] = first_rows[i-1] + chunk_rows[i-1];
+    }
+
+    relay::io::detail::run_tasks(nchunks, num_threads, [&](index_t i)
+    {
+        read_csv_rows<FloatType>(bounds[i], bounds[i+1], first_rows[i], col_ptrs);
+    });
+}
+
 //-----------------------------------------------------------------------------
 static void
-read_single_table(const std::string &path, const bool use_float64, Node &table)
+read_single_table(const std::string &path, const bool use_float64,
+    const index_t num_threads, Node &table)
 {
     table.reset();
-    std::ifstream fin(path);
-    if(!fin.is_open())
+    if(!utils::is_file(path))
     {
         CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
         return;
@@ -448,48 +828,71 @@ read_single_table(const std::string &path, const bool use_float64, Node &table)
     // Q: Need to support comment character?
 
     // Make sure the file has data
-    std::string first_line;
-    if(!std::getline(fin, first_line))
+    Node buffer;
+    index_t nbytes = 0;
+    const char *begin = map_file(path, buffer, nbytes);
+    if(nbytes == 0)
     {
         CONDUIT_ERROR("The file " << quote(path) << "appears to be empty.");
         return;
     }
+    const char *end = begin + nbytes;
 
+    const char *first_eol = line_end(begin, end);
+    const std::string first_line(begin, first_eol);
     std::vector<std::string> column_names;
-    const index_t ncols = read_column_names(first_line, column_names);
-    // If there was no header for the column names, seek back to start
-    if(column_names.empty())
+    index_t ncols = read_column_names(first_line, column_names);
+    // If there was no header for the column names, the data starts at the
+    //  first line and its entries give the number of columns
+    const char *data_start = begin;
+    if(!column_names.empty())
     {
-        fin.seekg(0, fin.beg);
+        data_start = (first_eol < end) ? first_eol + 1 : end;
     }
+    else
+    {
+        ncols = 1 + static_cast<index_t>(
+            std::count(first_line.begin(), first_line.end(), ','));
+    }
+
+    // Split the rows across the threads, each chunk is at least 1MB so small
+    //  files are read by one thread.
+    const index_t min_chunk_bytes = 1 << 20;
+    const index_t nchunks = std::max((index_t)1,
+        std::min(num_threads, static_cast<index_t>(end - data_start) / min_chunk_bytes));
+    const std::vector<const char*> bounds = split_lines(data_start, end, nchunks);
 
-    // Get number of rows in file
-    const auto data_start = fin.tellg();
-    std::string line;
+    // Get number of rows in each chunk
+    std::vector<index_t> chunk_rows(static_cast<size_t>(nchunks), 0);
+    relay::io::detail::run_tasks(nchunks, num_threads, [&](index_t i)
+    {
+        chunk_rows[i] = count_rows(bounds[i], bounds[i+1]);
+    });
     index_t nrows = 0;
-    while(std::getline(fin, line))
+    for(const index_t n : chunk_rows)
     {
-        nrows++;
+        nrows += n;
     }
 
     // Allocate the output table
     const DataType dtype((use_float64) ? DataType::FLOAT64_ID : DataType::FLOAT32_ID,
         nrows);
     Node &values = table["values"];
-    add_columns(values, column_names, ncols, dtype);
+    std::vector<Node*> cols;
+    add_columns(values, column_names, ncols, dtype, cols);
 
     if(dtype.is_float())
     {
-        read_csv_data<float>(fin, data_start, column_names, values);
+        read_csv_data<float>(num_threads, bounds, chunk_rows, cols);
     }
     else if(dtype.is_double())
     {
-        read_csv_data<double>(fin, data_start, column_names, values);
+        read_csv_data<double>(num_threads, bounds, chunk_rows, cols);
     }
 #ifdef CONDUIT_HAS_LONG_DOUBLE
     else if(dtype.is_long_double())
     {
-        read_csv_data<long double>(fin, data_start, column_names, values);
+        read_csv_data<long double>(num_threads, bounds, chunk_rows, cols);
     }
 #endif
     else
@@ -500,7 +903,8 @@ read_single_table(const std::string &path, const bool use_float64, Node &table)
 
 //-----------------------------------------------------------------------------
 static void
-read_many_tables(const std::string &path, const bool use_float64, Node &table)
+read_many_tables(const std::string &path, const bool use_float64,
+    const index_t num_threads, Node &table)
 {
     // Path must've been a directory
     std::vector<std::string> dir_contents;
@@ -560,7 +964,8 @@ read_many_tables(const std::string &path, const bool use_float64, Node &table)
         for(const auto &pair : list_idxs)
         {
             // std::cout << pair.first << " " << *pair.second << std::endl;
-            read_single_table(*pair.second, use_float64, table.append());
+            read_single_table(*pair.second, use_float64, num_threads,
+                table.append());
         }
     }
     else
@@ -570,7 +975,8 @@ read_many_tables(const std::string &path, const bool use_float64, Node &table)
             const auto no_ext = filename.size() - 4;
             const auto no_sep = filename.rfind(utils::file_path_separator()) + 1;
             const auto len = no_ext - no_sep;
-            read_single_table(filename, use_float64, table[filename.substr(no_sep, len)]);
+            read_single_table(filename, use_float64, num_threads,
+                table[filename.substr(no_sep, len)]);
         }
     }
 }
@@ -596,22 +1002,34 @@ read_csv(const std::string &path, const Node &opts, Node &table)
         }
     }
 
+    const index_t num_threads = get_num_threads(opts);
+
     if(!many_tables)
     {
-        read_single_table(path, use_float64, table);
+        read_single_table(path, use_float64, num_threads, table);
     }
     else
     {
-        read_many_tables(path, use_float64, table);
+        read_many_tables(path, use_float64, num_threads, table);
     }
 }
 
+#endif
+
 //-----------------------------------------------------------------------------
 void
-write_csv(const Node &table, const std::string &path, const Node &)
+write_csv(const Node &table, const std::string &path, const Node &options
+    CONDUIT_RELAY_COMMUNICATOR_ARG(MPI_Comm comm))
 {
     Node info;
-    const bool ok = blueprint::table::verify(table, info);
+    bool ok = blueprint::table::verify(table, info);
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    // Every rank has to fail together, the writes are collective.
+    int local_ok = ok ? 1 : 0;
+    int global_ok = 0;
+    MPI_Allreduce(&local_ok, &global_ok, 1, MPI_INT, MPI_MIN, comm);
+    ok = global_ok != 0;
+#endif
     if(!ok)
     {
         CONDUIT_ERROR("The node provided to write_csv must be a valid "
@@ -624,18 +1042,192 @@ write_csv(const Node &table, const std::string &path, const Node &)
 
     if(table.has_child("values"))
     {
-        write_single_table(table, path);
+        write_single_table(table, path, get_num_threads(options)
+            CONDUIT_RELAY_COMMUNICATOR_ARG(comm));
     }
     else
     {
-        write_multiple_tables(table, path);
+        write_multiple_tables(table, path, get_num_threads(options)
+            CONDUIT_RELAY_COMMUNICATOR_ARG(comm));
     }
 }
 
+#ifndef CONDUIT_RELAY_IO_MPI_ENABLED
+
+//-----------------------------------------------------------------------------
+void
+write_mesh_csv(const Node &mesh, const std::string &path, const Node &options)
+{
+    // One file per table, opened when its first batch arrives. Each table's
+    // batches arrive in row order, so rows are appended as they come.
+    std::map<std::string, std::unique_ptr<CSVTableWriter>> files;
+    const auto write_batch = [&](const std::string &table_name,
+                                 index_t, const Node &batch)
+    {
+        std::unique_ptr<CSVTableWriter> &writer = files[table_name];
+        if(!writer)
+        {
+            // the first table creates the output directory
+            if(files.size() == 1)
+            {
+                utils::create_directory(path);
+            }
+            const std::string full_path = path + utils::file_path_separator()
+                + table_name + ".csv";
+            writer.reset(new CSVTableWriter(full_path, options));
+        }
+        writer->write(batch);
+    };
+
+    blueprint::mesh::flatten_batches(mesh, options, write_batch);
+}
+
+//-----------------------------------------------------------------------------
+// CSVTableWriter
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+class CSVTableWriter::State
+{
+public:
+    State(const std::string &path_in, const Node &options)
+    : path(path_in),
+      fout(path_in),
+      num_threads(get_num_threads(options)),
+      num_rows(0)
+    {
+        if(!fout.is_open())
+        {
+            CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+        }
+    }
+
+    //-------------------------------------------------------------------//
+    void write(const Node &row_group)
+    {
+        const Node &values = row_group["values"];
+        std::ostringstream oss;
+        write_header(values, oss);
+        if(header.empty())
+        {
+            header = oss.str();
+            fout << header;
+        }
+        else if(header != oss.str())
+        {
+            CONDUIT_ERROR("CSVTableWriter: the columns of the row group "
+                          "don't match the columns written to "
+                          << quote(path));
+        }
+
+        const index_t nrows = get_nrows(row_group);
+        write_rows(values, nrows, fout, num_threads);
+        num_rows += nrows;
+        if(!fout)
+        {
+            CONDUIT_ERROR("CSVTableWriter: failed to write to " << quote(path));
+        }
+    }
+
+    std::string   path;
+    std::ofstream fout;
+    index_t       num_threads;
+    index_t       num_rows;
+    // the first line of the file, written with the first row group
+    std::string   header;
+};
+
+//-----------------------------------------------------------------------------
+CSVTableWriter::CSVTableWriter()
+: m_state(NULL)
+{}
+
+//-----------------------------------------------------------------------------
+CSVTableWriter::CSVTableWriter(const std::string &path,
+                               const Node &options)
+: m_state(NULL)
+{
+    open(path, options);
+}
+
+//-----------------------------------------------------------------------------
+CSVTableWriter::~CSVTableWriter()
+{
+    close();
 }
+
 //-----------------------------------------------------------------------------
-// -- end conduit::relay::io --
+void
+CSVTableWriter::open(const std::string &path,
+                     const Node &options)
+{
+    close();
+    m_state = new State(path, options);
+}
+
 //-----------------------------------------------------------------------------
+bool
+CSVTableWriter::is_open() const
+{
+    return m_state != NULL;
+}
+
+//-----------------------------------------------------------------------------
+void
+CSVTableWriter::write(const Node &table)
+{
+    if(!is_open())
+    {
+        CONDUIT_ERROR("CSVTableWriter is not open");
+    }
+
+    Node info;
+    if(!blueprint::table::verify(table, info) ||
+       (!table.has_child("values") && !table.has_child("row_groups")))
+    {
+        CONDUIT_ERROR("CSVTableWriter: the node passed to write must be a "
+                      "valid blueprint table with "
+                      << quote("values") << " or " << quote("row_groups"));
+    }
+
+    blueprint::table::iterate_row_groups(table,
+        [&](index_t, const Node &row_group)
+    {
+        m_state->write(row_group);
+    });
+}
+
+//-----------------------------------------------------------------------------
+index_t
+CSVTableWriter::number_of_rows() const
+{
+    if(!is_open())
+    {
+        CONDUIT_ERROR("CSVTableWriter is not open");
+    }
+    return m_state->num_rows;
+}
+
+//-----------------------------------------------------------------------------
+void
+CSVTableWriter::close()
+{
+    delete m_state;
+    m_state = NULL;
+}
+#endif
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::<mpi>::io --
+//-----------------------------------------------------------------------------
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+#endif
 
 
 }
@@ -38,6 +38,13 @@ namespace io
 {
 
 //-----------------------------------------------------------------------------
+/**
+@brief Reads a CSV file (or a directory of CSV files) into a blueprint table.
+    The file is memory mapped and its rows are split across threads.
+@param options "use_float64" reads float64 columns instead of float32,
+    "threads" sets the number of parsing threads (default <= 0, up to 8
+    based on the hardware concurrency).
+*/
 CONDUIT_RELAY_API void read_csv(const std::string &path,
                                 const Node &options,
                                 Node &table);
@@ -45,11 +52,69 @@ CONDUIT_RELAY_API void read_csv(const std::string &path,
 //-----------------------------------------------------------------------------
 /**
 @brief Accepts a blueprint table and writes it out to the given filename.
+@param options "threads" sets the number of threads that format rows
+    (default <= 0, up to 8 based on the hardware concurrency).
 */
 CONDUIT_RELAY_API void write_csv(const Node &table,
                                  const std::string &path,
                                  const Node &options);
 
+/**
+@brief Flattens the given blueprint mesh and writes its tables to
+    path/vertex_data.csv and path/element_data.csv, the same files that
+    write_csv writes for the output of blueprint::mesh::flatten. Rows are
+    written in batches as the mesh is flattened (see
+    blueprint::mesh::flatten_batches), so the full table is never built.
+@param options The flatten options, including "batch_rows".
+*/
+CONDUIT_RELAY_API void write_mesh_csv(const Node &mesh,
+                                      const std::string &path,
+                                      const Node &options);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Writes a blueprint table to a CSV file one row group at a time, so
+    the whole table is never held in memory. The header is written with the
+    first row group, and the rows of each row group are appended as it is
+    passed to write.
+
+Example:
+    CSVTableWriter writer("table.csv", Node());
+    for(...) { fill(row_group); writer.write(row_group); }
+    writer.close();
+*/
+class CONDUIT_RELAY_API CSVTableWriter
+{
+public:
+    CSVTableWriter();
+    /// @param options "threads" as in write_csv.
+    CSVTableWriter(const std::string &path,
+                   const Node &options);
+    ~CSVTableWriter();
+
+    void open(const std::string &path,
+              const Node &options);
+
+    bool is_open() const;
+
+    /// appends the rows of a table (with "values" or "row_groups") whose
+    /// columns match the columns of the tables written before it
+    void write(const Node &table);
+
+    /// the number of rows written since open
+    index_t number_of_rows() const;
+
+    /// closes the file
+    void close();
+
+private:
+    CSVTableWriter(const CSVTableWriter &);
+    CSVTableWriter &operator=(const CSVTableWriter &);
+
+    class State;
+    State *m_state;
+};
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::io --
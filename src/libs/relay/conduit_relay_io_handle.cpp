@@ -18,6 +18,7 @@
 #include "conduit_relay_io.hpp"
 
 #include "conduit_relay_io_handle_sidre.hpp"
+#include "conduit_relay_io_shm.hpp"
 
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
     #include "conduit_relay_io_hdf5.hpp"
@@ -27,6 +28,15 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -107,6 +117,125 @@ private:
 };
 
 
+//-----------------------------------------------------------------------------
+// MMapBinHandle -- IO Handle implementation for conduit_bin files that maps
+// the data file. Reads return external views into the mapping and writes of
+// new leaves are appended to the data file and its schema.
+//-----------------------------------------------------------------------------
+class MMapBinHandle: public IOHandle::HandleInterface
+{
+public:
+    MMapBinHandle(const std::string &path,
+                  const std::string &protocol,
+                  const Node &options);
+    virtual ~MMapBinHandle();
+
+    void open();
+
+    bool is_open() const;
+
+    // main interface methods
+    void read(Node &node);
+    void read(Node &node, const Node &opts);
+    void read(const std::string &path,
+              Node &node);
+    void read(const std::string &path,
+              Node &node,
+              const Node &opts);
+
+    void write(const Node &node);
+    void write(const Node &node, const Node &opts);
+    void write(const Node &node,
+               const std::string &path);
+    void write(const Node &node,
+               const std::string &path,
+               const Node &opts);
+
+    void remove(const std::string &path);
+
+    void list_child_names(std::vector<std::string> &res);
+    void list_child_names(const std::string &path,
+                          std::vector<std::string> &res);
+
+    bool has_path(const std::string &path);
+
+    void close();
+
+private:
+    std::string schema_path() const;
+    void        save_schema();
+    void        remap();
+    void        append(const Node &leaves);
+    void        release_maps();
+
+    // schema of the data file, with the file offset of each leaf
+    Schema               m_schema;
+    // bytes in the data file, new leaves are appended here
+    index_t              m_data_bytes;
+    // the current mapping, external views of it are handed out by read
+    Node                *m_node;
+    // earlier mappings with views handed out, kept until close
+    std::vector<Node*>   m_retired;
+    bool                 m_views_out;
+    bool                 m_open;
+};
+
+//-----------------------------------------------------------------------------
+// ShmHandle -- IO Handle implementation for conduit_shm segments. Reads
+// return external views of the mapped generation, writes are collected and
+// published as a new generation on close.
+//-----------------------------------------------------------------------------
+class ShmHandle: public IOHandle::HandleInterface
+{
+public:
+    ShmHandle(const std::string &path,
+              const std::string &protocol,
+              const Node &options);
+    virtual ~ShmHandle();
+
+    void open();
+
+    bool is_open() const;
+
+    // main interface methods
+    void read(Node &node);
+    void read(Node &node, const Node &opts);
+    void read(const std::string &path,
+              Node &node);
+    void read(const std::string &path,
+              Node &node,
+              const Node &opts);
+
+    void write(const Node &node);
+    void write(const Node &node, const Node &opts);
+    void write(const Node &node,
+               const std::string &path);
+    void write(const Node &node,
+               const std::string &path,
+               const Node &opts);
+
+    void remove(const std::string &path);
+
+    void list_child_names(std::vector<std::string> &res);
+    void list_child_names(const std::string &path,
+                          std::vector<std::string> &res);
+
+    bool has_path(const std::string &path);
+
+    void close();
+
+private:
+    const Node &current() const;
+    Node       &pending();
+
+    // the generation mapped at open
+    ShmSegment  m_segment;
+    // the tree to publish on close, once written to
+    Node        m_pending;
+    bool        m_dirty;
+    bool        m_open;
+};
+
 //-----------------------------------------------------------------------------
 // HDF5Handle -- IO Handle implementation for HDF5
 //-----------------------------------------------------------------------------
@@ -160,6 +289,38 @@ private:
 //-----------------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------------
+// Protocol Registry
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// factories of registered protocols and the file extensions mapped to them
+struct ProtocolRegistry
+{
+    std::mutex                          mtx;
+    std::map<std::string,HandleFactory> factories;
+    std::map<std::string,std::string>   extensions;
+};
+
+//-----------------------------------------------------------------------------
+static ProtocolRegistry &
+protocol_registry()
+{
+    static ProtocolRegistry registry;
+    return registry;
+}
+
+//-----------------------------------------------------------------------------
+static HandleFactory
+registered_protocol_factory(const std::string &protocol)
+{
+    ProtocolRegistry &registry = protocol_registry();
+    std::lock_guard<std::mutex> lock(registry.mtx);
+    std::map<std::string,HandleFactory>::const_iterator itr =
+        registry.factories.find(protocol);
+    return itr != registry.factories.end() ? itr->second : NULL;
+}
+
 //-----------------------------------------------------------------------------
 // HandleInterface Implementation
 //-----------------------------------------------------------------------------
@@ -319,14 +480,44 @@ IOHandle::HandleInterface::create(const std::string &path,
         conduit::relay::io::identify_protocol(path,protocol);
     }
 
-    if(protocol == "conduit_bin" ||
-       protocol == "json" ||
-       protocol == "conduit_json" ||
-       protocol == "conduit_base64_json" ||
-       protocol == "yaml" )
+    HandleFactory factory = registered_protocol_factory(protocol);
+    if(factory != NULL)
+    {
+        res = factory(path, protocol, options);
+        if(res == NULL)
+        {
+            CONDUIT_ERROR("Relay I/O Handle factory for registered protocol "
+                          << protocol << " did not create a handle for: "
+                          << path);
+        }
+        return res;
+    }
+
+    bool mmap = false;
+    if(options.has_child("mmap"))
+    {
+        const Node &n_mmap = options["mmap"];
+        mmap = n_mmap.dtype().is_string() ? n_mmap.as_string() == "true"
+                                          : n_mmap.to_int() != 0;
+    }
+
+    if(protocol == "conduit_bin" && mmap)
+    {
+        res = new MMapBinHandle(path, protocol, options);
+    }
+    else if(protocol == "conduit_bin" ||
+            protocol == "conduit_pack" ||
+            protocol == "json" ||
+            protocol == "conduit_json" ||
+            protocol == "conduit_base64_json" ||
+            protocol == "yaml" )
     {
         res = new BasicHandle(path, protocol, options);
     }
+    else if( protocol == "conduit_shm" )
+    {
+        res = new ShmHandle(path, protocol, options);
+    }
     else if( protocol == "sidre_hdf5" )
     {
         // magic interface
@@ -591,235 +782,1196 @@ BasicHandle::close()
 
 
 //-----------------------------------------------------------------------------
-// HDF5Handle Implementation
+// MMapBinHandle Implementation
 //-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
+// helpers for MMapBinHandle
 //-----------------------------------------------------------------------------
-#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+
+//-----------------------------------------------------------------------------
+// collects the leaves of node, with their paths below base_path
+static void
+mmap_bin_collect_leaves(const Node &node,
+                        const std::string &base_path,
+                        std::vector<std::pair<std::string,const Node*> > &res)
+{
+    if(node.dtype().is_list())
+    {
+        CONDUIT_ERROR("IOHandle: mmap conduit_bin handles do not support "
+                      "writing lists (path = '" << base_path << "')");
+    }
+    else if(node.dtype().is_object())
+    {
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            const Node &child = itr.next();
+            std::string child_path = base_path.empty() ? itr.name()
+                                     : base_path + "/" + itr.name();
+            mmap_bin_collect_leaves(child, child_path, res);
+        }
+    }
+    else if(!node.dtype().is_empty())
+    {
+        res.push_back(std::make_pair(base_path, &node));
+    }
+}
+
 //-----------------------------------------------------------------------------
+// adds the leaves of schema to dest, with offsets moved by base_offset
+static void
+mmap_bin_merge_schema(const Schema &schema,
+                      const std::string &base_path,
+                      index_t base_offset,
+                      Schema &dest)
+{
+    if(schema.dtype().is_object())
+    {
+        const std::vector<std::string> &names = schema.child_names();
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            std::string child_path = base_path.empty() ? names[i]
+                                     : base_path + "/" + names[i];
+            mmap_bin_merge_schema(schema.child((index_t)i),
+                                  child_path,
+                                  base_offset,
+                                  dest);
+        }
+    }
+    else if(!schema.dtype().is_empty())
+    {
+        DataType dtype(schema.dtype());
+        dtype.set_offset(dtype.offset() + base_offset);
+        dest[base_path].set(dtype);
+    }
+}
+
 //-----------------------------------------------------------------------------
+// bytes of the data file spanned by the leaves of schema
+static index_t
+mmap_bin_spanned_bytes(const Schema &schema)
+{
+    index_t res = 0;
+    if(schema.dtype().is_object() || schema.dtype().is_list())
+    {
+        for(index_t i = 0; i < schema.number_of_children(); i++)
+        {
+            res = std::max(res, mmap_bin_spanned_bytes(schema.child(i)));
+        }
+    }
+    else if(!schema.dtype().is_empty())
+    {
+        res = schema.dtype().offset() + schema.dtype().spanned_bytes();
+    }
+    return res;
+}
+
 //-----------------------------------------------------------------------------
-HDF5Handle::HDF5Handle(const std::string &path,
-                       const std::string &protocol,
-                       const Node &options)
+MMapBinHandle::MMapBinHandle(const std::string &path,
+                             const std::string &protocol,
+                             const Node &options)
 : HandleInterface(path,protocol,options),
-  m_h5_id(-1)
+  m_schema(),
+  m_data_bytes(0),
+  m_node(NULL),
+  m_retired(),
+  m_views_out(false),
+  m_open(false)
 {
     // empty
 }
+
 //-----------------------------------------------------------------------------
-HDF5Handle::~HDF5Handle()
+MMapBinHandle::~MMapBinHandle()
 {
     close();
 }
 
+//-----------------------------------------------------------------------------
+std::string
+MMapBinHandle::schema_path() const
+{
+    return path() + "_json";
+}
+
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::open()
+MMapBinHandle::open()
 {
     close();
-
     // call base class method, which does final sanity checks
-    // and processes standard options (mode = "rw", etc)
     HandleInterface::open();
 
-    if( utils::is_file( path() ) )
-    {
-        // check open mode to select proper hdf5 call
+    m_schema.reset();
+    m_data_bytes = 0;
 
-        if( open_mode_read_only() )
-        {
-            m_h5_id = hdf5_open_file_for_read( path() );
-        } // support write with append
-        else if ( open_mode_append() )
-        {
-            m_h5_id = hdf5_open_file_for_read_write( path() );
-        } // support write with truncate
-        else if ( open_mode_truncate() )
-        {
-            m_h5_id = hdf5_create_file( path() );
-        }
+    if( utils::is_file( path() ) &&
+        open_mode_read() && !open_mode_truncate() )
+    {
+        m_schema.load(schema_path());
+        m_data_bytes = utils::file_size(path());
     }
-    else if(  open_mode_read_only() )
+    else if( !utils::is_file( path() ) && open_mode_read_only() )
     {
+        // fail on read only if file doesn't exist
         CONDUIT_ERROR("path: \""
                       << path()
-                      << "\" does not exist, cannot open read only (mode = 'r')");
+                      << "\" does not exist, cannot open read only "
+                      << "(mode = '" << open_mode() << "')");
     }
     else
     {
-        m_h5_id = hdf5_create_file( path() );
+        // start out with an empty data file and schema, like the basic
+        // handle does for write only and truncate modes
+        std::ofstream ofs(path().c_str(),
+                          std::ios::binary | std::ios::trunc);
+        if(!ofs.is_open())
+        {
+            CONDUIT_ERROR("IOHandle: failed to create file: \""
+                          << path() << "\"");
+        }
+        ofs.close();
+        save_schema();
     }
-}
 
+    m_open = true;
+    remap();
+}
 
 //-----------------------------------------------------------------------------
 bool
-HDF5Handle::is_open() const
+MMapBinHandle::is_open() const
 {
-    return m_h5_id != -1;
+    return m_open;
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::read(Node &node)
+MMapBinHandle::save_schema()
 {
-    Node opts;
-    read(node, opts);
+    m_schema.save(schema_path());
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::read(Node &node,
-                 const Node &opts)
+MMapBinHandle::remap()
 {
-    // note: wrong mode errors are handled before dispatch to interface
+    // views of the current mapping may still be in use, keep it
+    if(m_node != NULL && m_views_out)
+    {
+        m_retired.push_back(m_node);
+        m_node = NULL;
+    }
+    if(m_node == NULL)
+    {
+        m_node = new Node();
+    }
+    m_views_out = false;
 
-    hdf5_read(m_h5_id,opts,node);
+    if(mmap_bin_spanned_bytes(m_schema) == 0)
+    {
+        // nothing to map
+        m_node->set(m_schema);
+        return;
+    }
+
+    try
+    {
+        m_node->mmap(path(), m_schema);
+    }
+    catch(const conduit::Error &)
+    {
+        // the mapping is writable, read only files are loaded instead
+        if(!open_mode_read_only())
+        {
+            throw;
+        }
+        m_node->load(path(), m_schema);
+    }
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::read(const std::string &path,
-                 Node &node)
+MMapBinHandle::release_maps()
 {
-    Node opts;
-    read(path, node, opts);
+    for(size_t i = 0; i < m_retired.size(); i++)
+    {
+        delete m_retired[i];
+    }
+    m_retired.clear();
+
+    if(m_node != NULL)
+    {
+        delete m_node;
+        m_node = NULL;
+    }
+    m_views_out = false;
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::read(const std::string &path,
-                 Node &node,
-                 const Node &opts)
+MMapBinHandle::append(const Node &leaves)
 {
-    // note: wrong mode errors are handled before dispatch to interface
+    Node compact;
+    leaves.compact_to(compact);
+    const index_t nbytes = compact.total_bytes_compact();
 
-    hdf5_read(m_h5_id,path,opts,node);
+    std::ofstream ofs(path().c_str(), std::ios::binary | std::ios::app);
+    if(!ofs.is_open())
+    {
+        CONDUIT_ERROR("IOHandle: failed to open file for append: \""
+                      << path() << "\"");
+    }
+    ofs.write(static_cast<const char*>(compact.contiguous_data_ptr()),
+              static_cast<std::streamsize>(nbytes));
+    ofs.close();
+    if(!ofs)
+    {
+        CONDUIT_ERROR("IOHandle: failed to append to file: \""
+                      << path() << "\"");
+    }
+
+    mmap_bin_merge_schema(compact.schema(), std::string(), m_data_bytes, m_schema);
+    m_data_bytes += nbytes;
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::write(const Node &node)
+MMapBinHandle::read(Node &node)
 {
     Node opts;
-    write(node, opts);
+    read(node, opts);
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::write(const Node &node,
-                  const Node &opts)
+MMapBinHandle::read(Node &node, const Node& opts)
 {
+    CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
-    // Options Push / Pop (only needed for write, since hdf5 only supports
-    // write options
-    Node prev_options;
-    if(options().has_child("hdf5"))
-    {
-        hdf5_options(prev_options);
-        hdf5_set_options(options()["hdf5"]);
-    }
-
-    hdf5_write(node,m_h5_id, opts);
-
-    if(!prev_options.dtype().is_empty())
-    {
-        hdf5_set_options(prev_options);
-    }
+    node.set_external(*m_node);
+    m_views_out = true;
 }
 
-
-
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::write(const Node &node,
-                  const std::string &path)
+MMapBinHandle::read(const std::string &path,
+                    Node &node)
 {
     Node opts;
-    write(node, path, opts);
+    read(path, node, opts);
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::write(const Node &node,
-                  const std::string &path,
-                  const Node &opts)
+MMapBinHandle::read(const std::string &path,
+                    Node &node,
+                    const Node &opts)
 {
+    CONDUIT_UNUSED(opts);
     // note: wrong mode errors are handled before dispatch to interface
 
-    // Options Push / Pop (only needed for write, since hdf5 only supports
-    // write options
-    Node prev_options;
-    if(options().has_child("hdf5"))
-    {
-        hdf5_options(prev_options);
-        hdf5_set_options(options()["hdf5"]);
-    }
-
-    hdf5_write(node,m_h5_id,path,opts);
-
-    if(!prev_options.dtype().is_empty())
+    if(m_node->has_path(path))
     {
-        hdf5_set_options(prev_options);
+        node.set_external(m_node->fetch_existing(path));
+        m_views_out = true;
     }
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::list_child_names(std::vector<std::string> &res)
+MMapBinHandle::write(const Node &node)
 {
-    // note: wrong mode errors are handled before dispatch to interface
-
-    hdf5_group_list_child_names(m_h5_id, "/", res);
+    Node opts;
+    write(node, opts);
 }
 
 //-----------------------------------------------------------------------------
 void
-HDF5Handle::list_child_names(const std::string &path,
-                             std::vector<std::string> &res)
+MMapBinHandle::write(const Node &node,
+                     const Node &opts)
 {
-    // note: wrong mode errors are handled before dispatch to interface
+    write(node, std::string(), opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+MMapBinHandle::write(const Node &node,
+                     const std::string &path)
+{
+    Node opts;
+    write(node, path, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+MMapBinHandle::write(const Node &node,
+                     const std::string &path,
+                     const Node& opts)
+{
+    CONDUIT_UNUSED(opts);
+    // note: wrong mode errors are handled before dispatch to interface
+
+    std::vector<std::pair<std::string,const Node*> > leaves;
+    mmap_bin_collect_leaves(node, path, leaves);
+
+    // leaves that match an existing leaf's type and size are written
+    // in place, the others are appended to the data file
+    Node new_leaves;
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        const std::string &leaf_path = leaves[i].first;
+        const Node &leaf = *leaves[i].second;
+
+        if(m_schema.has_path(leaf_path))
+        {
+            const DataType &dtype = m_schema.fetch_existing(leaf_path).dtype();
+            if(dtype.id() == leaf.dtype().id() &&
+               dtype.number_of_elements() == leaf.dtype().number_of_elements())
+            {
+                m_node->fetch_existing(leaf_path).update(leaf);
+                continue;
+            }
+            m_schema.remove(leaf_path);
+        }
+
+        // a leaf above this path can't hold children, replace it
+        std::string::size_type pos = leaf_path.find('/');
+        while(pos != std::string::npos)
+        {
+            std::string parent_path = leaf_path.substr(0, pos);
+            if(m_schema.has_path(parent_path) &&
+               !m_schema.fetch_existing(parent_path).dtype().is_object())
+            {
+                m_schema.remove(parent_path);
+                break;
+            }
+            pos = leaf_path.find('/', pos + 1);
+        }
+
+        new_leaves[leaf_path].set_external(const_cast<Node&>(leaf));
+    }
+
+    if(new_leaves.number_of_children() > 0)
+    {
+        append(new_leaves);
+        save_schema();
+        remap();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+MMapBinHandle::list_child_names(std::vector<std::string> &res)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    res = m_schema.child_names();
+}
+
+//-----------------------------------------------------------------------------
+void
+MMapBinHandle::list_child_names(const std::string &path,
+                                std::vector<std::string> &res)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    res.clear();
+    if(m_schema.has_path(path))
+        res = m_schema.fetch_existing(path).child_names();
+}
+
+//-----------------------------------------------------------------------------
+void
+MMapBinHandle::remove(const std::string &path)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    // the removed bytes stay in the data file, only the schema changes
+    m_schema.remove(path);
+    save_schema();
+    remap();
+}
+
+//-----------------------------------------------------------------------------
+bool
+MMapBinHandle::has_path(const std::string &path)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    return m_schema.has_path(path);
+}
+
+//-----------------------------------------------------------------------------
+void
+MMapBinHandle::close()
+{
+    // the data file and schema are kept up to date by write and remove
+    release_maps();
+    m_schema.reset();
+    m_data_bytes = 0;
+    m_open = false;
+}
+
+
+//-----------------------------------------------------------------------------
+// ShmHandle Implementation
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+ShmHandle::ShmHandle(const std::string &path,
+                     const std::string &protocol,
+                     const Node &options)
+: HandleInterface(path,protocol,options),
+  m_segment(),
+  m_pending(),
+  m_dirty(false),
+  m_open(false)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+ShmHandle::~ShmHandle()
+{
+    close();
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::open()
+{
+    close();
+    // call base class method, which does final sanity checks
+    HandleInterface::open();
+
+    bool found = false;
+    if( open_mode_read() && !open_mode_truncate() )
+    {
+        found = m_segment.open(path());
+    }
+
+    if( !found && open_mode_read_only() )
+    {
+        // fail on read only if nothing has been written
+        CONDUIT_ERROR("conduit_shm segment: \""
+                      << path()
+                      << "\" does not exist, cannot open read only "
+                      << "(mode = '" << open_mode() << "')");
+    }
+
+    // truncate publishes an empty tree unless it is written to
+    m_dirty = open_mode_truncate();
+    m_open = true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+ShmHandle::is_open() const
+{
+    return m_open;
+}
+
+//-----------------------------------------------------------------------------
+const Node &
+ShmHandle::current() const
+{
+    return m_dirty ? m_pending : m_segment.node();
+}
+
+//-----------------------------------------------------------------------------
+Node &
+ShmHandle::pending()
+{
+    if(!m_dirty)
+    {
+        // start from a copy of the mapped tree
+        m_pending.set(m_segment.node());
+        m_dirty = true;
+    }
+    return m_pending;
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::read(Node &node)
+{
+    Node opts;
+    read(node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::read(Node &node, const Node& opts)
+{
+    CONDUIT_UNUSED(opts);
+    // note: wrong mode errors are handled before dispatch to interface
+
+    node.set_external(const_cast<Node&>(current()));
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::read(const std::string &path,
+                Node &node)
+{
+    Node opts;
+    read(path, node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::read(const std::string &path,
+                Node &node,
+                const Node &opts)
+{
+    CONDUIT_UNUSED(opts);
+    // note: wrong mode errors are handled before dispatch to interface
+
+    const Node &curr = current();
+    if(curr.has_path(path))
+    {
+        node.set_external(const_cast<Node&>(curr.fetch_existing(path)));
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::write(const Node &node)
+{
+    Node opts;
+    write(node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::write(const Node &node,
+                 const Node &opts)
+{
+    CONDUIT_UNUSED(opts);
+    // note: wrong mode errors are handled before dispatch to interface
+
+    pending().update(node);
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::write(const Node &node,
+                 const std::string &path)
+{
+    Node opts;
+    write(node, path, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::write(const Node &node,
+                 const std::string &path,
+                 const Node& opts)
+{
+    CONDUIT_UNUSED(opts);
+    // note: wrong mode errors are handled before dispatch to interface
+
+    pending()[path].update(node);
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::list_child_names(std::vector<std::string> &res)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    res = current().child_names();
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::list_child_names(const std::string &path,
+                            std::vector<std::string> &res)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    res.clear();
+    const Node &curr = current();
+    if(curr.has_path(path))
+        res = curr.fetch_existing(path).child_names();
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::remove(const std::string &path)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    pending().remove(path);
+}
+
+//-----------------------------------------------------------------------------
+bool
+ShmHandle::has_path(const std::string &path)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    return current().has_path(path);
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmHandle::close()
+{
+    if(m_open && m_dirty && open_mode_write())
+    {
+        shm_write(m_pending, path());
+    }
+    m_segment.close();
+    m_pending.reset();
+    m_dirty = false;
+    m_open = false;
+}
+
+//-----------------------------------------------------------------------------
+// HDF5Handle Implementation
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+HDF5Handle::HDF5Handle(const std::string &path,
+                       const std::string &protocol,
+                       const Node &options)
+: HandleInterface(path,protocol,options),
+  m_h5_id(-1)
+{
+    // empty
+}
+//-----------------------------------------------------------------------------
+HDF5Handle::~HDF5Handle()
+{
+    close();
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::open()
+{
+    close();
+
+    // call base class method, which does final sanity checks
+    // and processes standard options (mode = "rw", etc)
+    HandleInterface::open();
+
+    // file access options (page buffer, metadata cache, etc)
+    Node h5_opts;
+    if(options().has_child("hdf5"))
+    {
+        h5_opts["hdf5"].set(options()["hdf5"]);
+    }
+
+    if( utils::is_file( path() ) )
+    {
+        // check open mode to select proper hdf5 call
+
+        if( open_mode_read_only() )
+        {
+            m_h5_id = hdf5_open_file_for_read( path(), h5_opts );
+        } // support write with append
+        else if ( open_mode_append() )
+        {
+            m_h5_id = hdf5_open_file_for_read_write( path(), h5_opts );
+        } // support write with truncate
+        else if ( open_mode_truncate() )
+        {
+            m_h5_id = hdf5_create_file( path(), h5_opts );
+        }
+    }
+    else if(  open_mode_read_only() )
+    {
+        CONDUIT_ERROR("path: \""
+                      << path()
+                      << "\" does not exist, cannot open read only (mode = 'r')");
+    }
+    else
+    {
+        m_h5_id = hdf5_create_file( path(), h5_opts );
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+bool
+HDF5Handle::is_open() const
+{
+    return m_h5_id != -1;
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read(Node &node)
+{
+    Node opts;
+    read(node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read(Node &node,
+                 const Node &opts)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    hdf5_read(m_h5_id,opts,node);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read(const std::string &path,
+                 Node &node)
+{
+    Node opts;
+    read(path, node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::read(const std::string &path,
+                 Node &node,
+                 const Node &opts)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    hdf5_read(m_h5_id,path,opts,node);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::write(const Node &node)
+{
+    Node opts;
+    write(node, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::write(const Node &node,
+                  const Node &opts)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    // the handle's hdf5 options apply to this write only, with the per
+    // call opts taking precedence
+    Node write_opts;
+    if(options().has_child("hdf5"))
+    {
+        write_opts["hdf5"].set(options()["hdf5"]);
+    }
+    write_opts.update(opts);
+
+    hdf5_write(node,m_h5_id, write_opts);
+}
+
+
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::write(const Node &node,
+                  const std::string &path)
+{
+    Node opts;
+    write(node, path, opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::write(const Node &node,
+                  const std::string &path,
+                  const Node &opts)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    // the handle's hdf5 options apply to this write only, with the per
+    // call opts taking precedence
+    Node write_opts;
+    if(options().has_child("hdf5"))
+    {
+        write_opts["hdf5"].set(options()["hdf5"]);
+    }
+    write_opts.update(opts);
+
+    hdf5_write(node,m_h5_id,path,write_opts);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::list_child_names(std::vector<std::string> &res)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    hdf5_group_list_child_names(m_h5_id, "/", res);
+}
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::list_child_names(const std::string &path,
+                             std::vector<std::string> &res)
+{
+    // note: wrong mode errors are handled before dispatch to interface
 
     hdf5_group_list_child_names(m_h5_id, path, res);
 }
 
-//-----------------------------------------------------------------------------
-void
-HDF5Handle::remove(const std::string &path)
-{
-    // note: wrong mode errors are handled before dispatch to interface
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::remove(const std::string &path)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    hdf5_remove_path(m_h5_id,path);
+}
+
+//-----------------------------------------------------------------------------
+bool
+HDF5Handle::has_path(const std::string &path)
+{
+    // note: wrong mode errors are handled before dispatch to interface
+
+    return hdf5_has_path(m_h5_id,path);
+}
+
+
+//-----------------------------------------------------------------------------
+void
+HDF5Handle::close()
+{
+    if(m_h5_id >= 0)
+    {
+        hdf5_close_file(m_h5_id);
+    }
+    m_h5_id = -1;
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+#endif
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// AsyncWriter -- runs the writes issued by IOHandle::write_async in order
+// on one background thread
+//-----------------------------------------------------------------------------
+class IOHandle::AsyncWriter
+{
+public:
+    AsyncWriter()
+    : m_pending(0),
+      m_stop(false)
+    {
+        m_thread = std::thread(&AsyncWriter::run, this);
+    }
+
+    //-------------------------------------------------------------------------
+    ~AsyncWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    //-------------------------------------------------------------------------
+    std::future<void> push(const std::function<void()> &func)
+    {
+        Task task;
+        task.func = func;
+        std::future<void> res = task.done.get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+            m_pending++;
+        }
+        m_cv.notify_all();
+        return res;
+    }
+
+    //-------------------------------------------------------------------------
+    // blocks until all queued tasks have finished
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]{ return m_pending == 0; });
+    }
+
+private:
+    struct Task
+    {
+        std::function<void()> func;
+        std::promise<void>    done;
+    };
+
+    //-------------------------------------------------------------------------
+    void run()
+    {
+        while(true)
+        {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this]{ return m_stop || !m_tasks.empty(); });
+                if(m_tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            try
+            {
+                task.func();
+                task.done.set_value();
+            }
+            catch(...)
+            {
+                task.done.set_exception(std::current_exception());
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_pending--;
+            }
+            m_cv.notify_all();
+        }
+    }
+
+    std::deque<Task>        m_tasks;
+    index_t                 m_pending;
+    bool                    m_stop;
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    std::thread             m_thread;
+};
+
+
+//-----------------------------------------------------------------------------
+// ReadCache -- keeps the results of has_path, list_child_names and leaf
+// reads, evicting the least recently used results past a byte budget
+//-----------------------------------------------------------------------------
+class IOHandle::ReadCache
+{
+public:
+    ReadCache(index_t max_bytes)
+    : m_max_bytes(max_bytes),
+      m_bytes(0),
+      m_evictions(0)
+    {
+        for(int i = 0; i < NUM_OPS; i++)
+        {
+            m_hits[i] = 0;
+            m_misses[i] = 0;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    bool find_has_path(const std::string &path, bool &res)
+    {
+        Entry *entry = find(HAS_PATH, path);
+        if(entry != NULL)
+        {
+            res = entry->exists;
+        }
+        return entry != NULL;
+    }
+
+    //-------------------------------------------------------------------------
+    void add_has_path(const std::string &path, bool res)
+    {
+        Entry &entry = insert(HAS_PATH, path);
+        entry.exists = res;
+        commit(entry, 0);
+    }
+
+    //-------------------------------------------------------------------------
+    bool find_child_names(const std::string &path,
+                          std::vector<std::string> &res)
+    {
+        Entry *entry = find(LIST_CHILD_NAMES, path);
+        if(entry != NULL)
+        {
+            res = entry->names;
+        }
+        return entry != NULL;
+    }
+
+    //-------------------------------------------------------------------------
+    void add_child_names(const std::string &path,
+                         const std::vector<std::string> &names)
+    {
+        Entry &entry = insert(LIST_CHILD_NAMES, path);
+        entry.names = names;
+        index_t bytes = 0;
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            bytes += (index_t)(sizeof(std::string) + names[i].size());
+        }
+        commit(entry, bytes);
+    }
+
+    //-------------------------------------------------------------------------
+    // reads use update semantics, like the backends
+    bool find_read(const std::string &path, Node &node)
+    {
+        Entry *entry = find(READ, path);
+        if(entry != NULL)
+        {
+            node.update(entry->data);
+        }
+        return entry != NULL;
+    }
+
+    //-------------------------------------------------------------------------
+    // only leaves are kept, object and list reads are not cached
+    void add_read(const std::string &path, const Node &node)
+    {
+        if(node.dtype().is_object() ||
+           node.dtype().is_list() ||
+           node.dtype().is_empty() ||
+           node.total_bytes_compact() > m_max_bytes)
+        {
+            return;
+        }
+        Entry &entry = insert(READ, path);
+        node.compact_to(entry.data);
+        commit(entry, entry.data.total_bytes_compact());
+    }
 
-    hdf5_remove_path(m_h5_id,path);
-}
+    //-------------------------------------------------------------------------
+    void clear()
+    {
+        m_entries.clear();
+        m_index.clear();
+        m_bytes = 0;
+    }
 
-//-----------------------------------------------------------------------------
-bool
-HDF5Handle::has_path(const std::string &path)
-{
-    // note: wrong mode errors are handled before dispatch to interface
+    //-------------------------------------------------------------------------
+    void info(Node &res) const
+    {
+        res["max_bytes"] = m_max_bytes;
+        res["bytes"] = m_bytes;
+        res["entries"] = (index_t)m_entries.size();
+        res["evictions"] = m_evictions;
+        for(int i = 0; i < NUM_OPS; i++)
+        {
+            Node &op = res[op_name(i)];
+            op["hits"] = m_hits[i];
+            op["misses"] = m_misses[i];
+        }
+    }
 
-    return hdf5_has_path(m_h5_id,path);
-}
+private:
+    enum Op
+    {
+        HAS_PATH = 0,
+        LIST_CHILD_NAMES,
+        READ,
+        NUM_OPS
+    };
 
+    struct Entry
+    {
+        std::string              key;
+        index_t                  bytes;
+        bool                     exists;
+        std::vector<std::string> names;
+        Node                     data;
+    };
 
-//-----------------------------------------------------------------------------
-void
-HDF5Handle::close()
-{
-    if(m_h5_id >= 0)
+    typedef std::list<Entry> EntryList;
+
+    //-------------------------------------------------------------------------
+    static const char *op_name(int op)
     {
-        hdf5_close_file(m_h5_id);
+        static const char *names[] = {"has_path", "list_child_names", "read"};
+        return names[op];
     }
-    m_h5_id = -1;
-}
 
-//-----------------------------------------------------------------------------
-//-----------------------------------------------------------------------------
-#endif
-//-----------------------------------------------------------------------------
-//-----------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    static std::string key(Op op, const std::string &path)
+    {
+        return std::string(op_name(op)) + ":" + path;
+    }
+
+    //-------------------------------------------------------------------------
+    // returns the entry for op and path (marking it most recently used),
+    // or NULL
+    Entry *find(Op op, const std::string &path)
+    {
+        std::map<std::string, EntryList::iterator>::iterator itr =
+            m_index.find(key(op, path));
+        if(itr == m_index.end())
+        {
+            m_misses[op]++;
+            return NULL;
+        }
+        m_hits[op]++;
+        m_entries.splice(m_entries.begin(), m_entries, itr->second);
+        return &m_entries.front();
+    }
+
+    //-------------------------------------------------------------------------
+    // adds a new most recently used entry for op and path, replacing any
+    // existing one. call commit once it is filled in.
+    Entry &insert(Op op, const std::string &path)
+    {
+        const std::string entry_key = key(op, path);
+        std::map<std::string, EntryList::iterator>::iterator itr =
+            m_index.find(entry_key);
+        if(itr != m_index.end())
+        {
+            m_bytes -= itr->second->bytes;
+            m_entries.erase(itr->second);
+            m_index.erase(itr);
+        }
+        m_entries.push_front(Entry());
+        Entry &entry = m_entries.front();
+        entry.key = entry_key;
+        entry.bytes = 0;
+        entry.exists = false;
+        m_index[entry_key] = m_entries.begin();
+        return entry;
+    }
+
+    //-------------------------------------------------------------------------
+    // charges the entry's bytes and evicts least recently used entries
+    // until the cache fits its budget
+    void commit(Entry &entry, index_t data_bytes)
+    {
+        entry.bytes = (index_t)(sizeof(Entry) + entry.key.size()) + data_bytes;
+        m_bytes += entry.bytes;
+        while(m_bytes > m_max_bytes && !m_entries.empty())
+        {
+            Entry &last = m_entries.back();
+            m_bytes -= last.bytes;
+            m_index.erase(last.key);
+            m_entries.pop_back();
+            m_evictions++;
+        }
+    }
+
+    EntryList                                  m_entries;
+    std::map<std::string, EntryList::iterator> m_index;
+    index_t                                    m_max_bytes;
+    index_t                                    m_bytes;
+    index_t                                    m_evictions;
+    index_t                                    m_hits[NUM_OPS];
+    index_t                                    m_misses[NUM_OPS];
+};
 
 
 //-----------------------------------------------------------------------------
@@ -828,7 +1980,9 @@ HDF5Handle::close()
 
 //-----------------------------------------------------------------------------
 IOHandle::IOHandle()
-: m_handle(NULL)
+: m_handle(NULL),
+  m_async(NULL),
+  m_cache(NULL)
 {
 
 }
@@ -875,6 +2029,7 @@ IOHandle::open(const std::string &path,
     {
         m_handle->open();
     }
+    init_cache(options);
 }
 
 //-----------------------------------------------------------------------------
@@ -889,6 +2044,21 @@ IOHandle::open(const std::string &path,
     {
         m_handle->open();
     }
+    init_cache(options);
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::init_cache(const Node &options)
+{
+    if(m_handle != NULL && options.has_path("cache/max_bytes"))
+    {
+        index_t max_bytes = options["cache/max_bytes"].to_index_t();
+        if(max_bytes > 0)
+        {
+            m_cache = new ReadCache(max_bytes);
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -918,6 +2088,7 @@ void
 IOHandle::read(Node &node,
                const Node &opts)
 {
+    wait();
     if(m_handle != NULL)
     {
         if( m_handle->open_mode_write_only() )
@@ -926,7 +2097,7 @@ IOHandle::read(Node &node,
                           " (mode = '" << m_handle->open_mode() << "')");
         }
 
-        m_handle->read(node,opts);
+        read_cached(std::string(), node, opts);
     }
     else
     {
@@ -949,6 +2120,7 @@ IOHandle::read(const std::string &path,
                Node &node,
                const Node &opts)
 {
+    wait();
     if(m_handle != NULL)
     {
         if( m_handle->open_mode_write_only() )
@@ -957,14 +2129,7 @@ IOHandle::read(const std::string &path,
                           " (mode = '" << m_handle->open_mode() << "')");
         }
 
-        if(path.empty())
-        {
-            m_handle->read(node, opts);
-        }
-        else
-        {
-            m_handle->read(path, node, opts);
-        }
+        read_cached(path, node, opts);
     }
     else
     {
@@ -972,6 +2137,36 @@ IOHandle::read(const std::string &path,
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+IOHandle::read_cached(const std::string &path,
+                      Node &node,
+                      const Node &opts)
+{
+    // reads with options (offsets, strides, etc) are not cached
+    bool use_cache = m_cache != NULL && opts.number_of_children() == 0;
+    if(use_cache && m_cache->find_read(path, node))
+    {
+        return;
+    }
+
+    if(path.empty())
+    {
+        m_handle->read(node, opts);
+    }
+    else
+    {
+        m_handle->read(path, node, opts);
+    }
+
+    // some backends leave the node as is when the path does not exist,
+    // so check it before keeping the result
+    if(use_cache && (path.empty() || has_path(path)))
+    {
+        m_cache->add_read(path, node);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 IOHandle::write(const Node &node)
@@ -985,6 +2180,7 @@ void
 IOHandle::write(const Node &node,
                 const Node &opts)
 {
+    wait();
     if(m_handle != NULL)
     {
         if( m_handle->open_mode_read_only() )
@@ -993,6 +2189,7 @@ IOHandle::write(const Node &node,
                           " (mode = '" << m_handle->open_mode() << "')");
         }
 
+        clear_cache();
         m_handle->write(node, opts);
     }
     else
@@ -1016,6 +2213,7 @@ IOHandle::write(const Node &node,
                 const std::string &path,
                 const Node &opts)
 {
+    wait();
     if(m_handle != NULL)
     {
         if( m_handle->open_mode_read_only() )
@@ -1024,6 +2222,7 @@ IOHandle::write(const Node &node,
                           " (mode = '" << m_handle->open_mode() << "')");
         }
 
+        clear_cache();
         m_handle->write(node, path, opts);
     }
     else
@@ -1033,10 +2232,110 @@ IOHandle::write(const Node &node,
 
 }
 
+//-----------------------------------------------------------------------------
+std::future<void>
+IOHandle::write_async(const Node &node)
+{
+    Node opts;
+    return write_async(node,opts);
+}
+
+//-----------------------------------------------------------------------------
+std::future<void>
+IOHandle::write_async(const Node &node,
+                      const Node &opts)
+{
+    return write_async(node,std::string(),opts);
+}
+
+//-----------------------------------------------------------------------------
+std::future<void>
+IOHandle::write_async(const Node &node,
+                      const std::string &path)
+{
+    Node opts;
+    return write_async(node,path,opts);
+}
+
+//-----------------------------------------------------------------------------
+std::future<void>
+IOHandle::write_async(const Node &node,
+                      const std::string &path,
+                      const Node &opts)
+{
+    if(m_handle == NULL)
+    {
+        CONDUIT_ERROR("Invalid or closed handle.");
+    }
+
+    if( m_handle->open_mode_read_only() )
+    {
+        CONDUIT_ERROR("IOHandle: cannot write, handle is read only"
+                      " (mode = '" << m_handle->open_mode() << "')");
+    }
+
+    std::string snapshot = "copy";
+    if(opts.has_path("async/snapshot"))
+    {
+        snapshot = opts["async/snapshot"].as_string();
+    }
+
+    // the task owns its node and options, shared pointers keep
+    // the node from being deep copied again when the task is copied
+    std::shared_ptr<Node> data(new Node());
+    if(snapshot == "copy")
+    {
+        data->set(node);
+    }
+    else if(snapshot == "reference")
+    {
+        // the caller guarantees the node outlives the write
+        data->set_external(const_cast<Node&>(node));
+    }
+    else
+    {
+        CONDUIT_ERROR("IOHandle: unsupported async/snapshot \""
+                      << snapshot << "\""
+                      " (expected \"copy\" or \"reference\")");
+    }
+    std::shared_ptr<Node> data_opts(new Node(opts));
+
+    clear_cache();
+
+    if(m_async == NULL)
+    {
+        m_async = new AsyncWriter();
+    }
+
+    HandleInterface *handle = m_handle;
+    return m_async->push([handle, data, path, data_opts]()
+    {
+        if(path.empty())
+        {
+            handle->write(*data, *data_opts);
+        }
+        else
+        {
+            handle->write(*data, path, *data_opts);
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::wait()
+{
+    if(m_async != NULL)
+    {
+        m_async->wait();
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 IOHandle::remove(const std::string &path)
 {
+    wait();
     if(m_handle != NULL)
     {
          if( m_handle->open_mode_read_only() )
@@ -1045,6 +2344,7 @@ IOHandle::remove(const std::string &path)
                            " (mode = '" << m_handle->open_mode() << "')");
          }
 
+        clear_cache();
         m_handle->remove(path);
     }
     else
@@ -1057,6 +2357,7 @@ IOHandle::remove(const std::string &path)
 void
 IOHandle::list_child_names(std::vector<std::string> &names)
 {
+    wait();
     names.clear();
     if(m_handle != NULL)
     {
@@ -1067,7 +2368,17 @@ IOHandle::list_child_names(std::vector<std::string> &names)
                            " (mode = '" << m_handle->open_mode() << "')");
          }
 
-        return m_handle->list_child_names(names);
+        if(m_cache != NULL && m_cache->find_child_names(std::string(), names))
+        {
+            return;
+        }
+
+        m_handle->list_child_names(names);
+
+        if(m_cache != NULL)
+        {
+            m_cache->add_child_names(std::string(), names);
+        }
     }
     else
     {
@@ -1081,6 +2392,7 @@ void
 IOHandle::list_child_names(const std::string &path,
                            std::vector<std::string> &names)
 {
+    wait();
     names.clear();
     if(m_handle != NULL)
     {
@@ -1091,7 +2403,17 @@ IOHandle::list_child_names(const std::string &path,
                            " (mode = '" << m_handle->open_mode() << "')");
          }
 
-        return m_handle->list_child_names(path, names);
+        if(m_cache != NULL && m_cache->find_child_names(path, names))
+        {
+            return;
+        }
+
+        m_handle->list_child_names(path, names);
+
+        if(m_cache != NULL)
+        {
+            m_cache->add_child_names(path, names);
+        }
     }
     else
     {
@@ -1103,6 +2425,7 @@ IOHandle::list_child_names(const std::string &path,
 bool
 IOHandle::has_path(const std::string &path)
 {
+    wait();
     if(m_handle != NULL)
     {
         if( m_handle->open_mode_write_only() )
@@ -1111,7 +2434,19 @@ IOHandle::has_path(const std::string &path)
                            " only"
                            " (mode = '" << m_handle->open_mode() << "')");
         }
-        return m_handle->has_path(path);
+        bool res = false;
+        if(m_cache != NULL && m_cache->find_has_path(path, res))
+        {
+            return res;
+        }
+
+        res = m_handle->has_path(path);
+
+        if(m_cache != NULL)
+        {
+            m_cache->add_has_path(path, res);
+        }
+        return res;
     }
     else
     {
@@ -1125,6 +2460,19 @@ IOHandle::has_path(const std::string &path)
 void
 IOHandle::close()
 {
+    // finish pending writes and stop the background thread
+    if(m_async != NULL)
+    {
+        delete m_async;
+        m_async = NULL;
+    }
+
+    if(m_cache != NULL)
+    {
+        delete m_cache;
+        m_cache = NULL;
+    }
+
     if(m_handle != NULL)
     {
         m_handle->close();
@@ -1134,6 +2482,155 @@ IOHandle::close()
     // else, ignore ...
 }
 
+//-----------------------------------------------------------------------------
+void
+IOHandle::clear_cache()
+{
+    if(m_cache != NULL)
+    {
+        m_cache->clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+IOHandle::cache_info(Node &info) const
+{
+    info.reset();
+    if(m_cache != NULL)
+    {
+        info["enabled"] = "true";
+        m_cache->info(info);
+    }
+    else
+    {
+        info["enabled"] = "false";
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// Protocol Registry Functions
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+register_protocol(const std::string &protocol,
+                  HandleFactory factory)
+{
+    std::vector<std::string> extensions;
+    register_protocol(protocol, extensions, factory);
+}
+
+//-----------------------------------------------------------------------------
+void
+register_protocol(const std::string &protocol,
+                  const std::vector<std::string> &extensions,
+                  HandleFactory factory)
+{
+    if(protocol.empty())
+    {
+        CONDUIT_ERROR("relay::io::register_protocol: protocol name is empty");
+    }
+
+    if(!factory)
+    {
+        CONDUIT_ERROR("relay::io::register_protocol: factory for protocol "
+                      << protocol << " is NULL");
+    }
+
+    ProtocolRegistry &registry = protocol_registry();
+    std::lock_guard<std::mutex> lock(registry.mtx);
+
+    // replace any previous registration
+    std::map<std::string,std::string>::iterator itr = registry.extensions.begin();
+    while(itr != registry.extensions.end())
+    {
+        if(itr->second == protocol)
+        {
+            registry.extensions.erase(itr++);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    registry.factories[protocol] = factory;
+    for(size_t i = 0; i < extensions.size(); i++)
+    {
+        std::string ext = extensions[i];
+        if(!ext.empty() && ext[0] == '.')
+        {
+            ext = ext.substr(1);
+        }
+        if(!ext.empty())
+        {
+            registry.extensions[ext] = protocol;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+unregister_protocol(const std::string &protocol)
+{
+    ProtocolRegistry &registry = protocol_registry();
+    std::lock_guard<std::mutex> lock(registry.mtx);
+
+    registry.factories.erase(protocol);
+    std::map<std::string,std::string>::iterator itr = registry.extensions.begin();
+    while(itr != registry.extensions.end())
+    {
+        if(itr->second == protocol)
+        {
+            registry.extensions.erase(itr++);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+is_registered_protocol(const std::string &protocol)
+{
+    return registered_protocol_factory(protocol) != NULL;
+}
+
+//-----------------------------------------------------------------------------
+void
+registered_protocols(std::vector<std::string> &res)
+{
+    res.clear();
+    ProtocolRegistry &registry = protocol_registry();
+    std::lock_guard<std::mutex> lock(registry.mtx);
+    std::map<std::string,HandleFactory>::const_iterator itr;
+    for(itr = registry.factories.begin(); itr != registry.factories.end(); ++itr)
+    {
+        res.push_back(itr->first);
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+identify_registered_protocol(const std::string &file_ext,
+                             std::string &protocol)
+{
+    ProtocolRegistry &registry = protocol_registry();
+    std::lock_guard<std::mutex> lock(registry.mtx);
+    std::map<std::string,std::string>::const_iterator itr =
+        registry.extensions.find(file_ext);
+    if(itr == registry.extensions.end())
+    {
+        return false;
+    }
+    protocol = itr->second;
+    return true;
+}
+
 
 }
 //-----------------------------------------------------------------------------
@@ -19,6 +19,11 @@
 #include "conduit_relay_exports.h"
 #include "conduit_relay_config.h"
 
+//-----------------------------------------------------------------------------
+// std lib includes
+//-----------------------------------------------------------------------------
+#include <future>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
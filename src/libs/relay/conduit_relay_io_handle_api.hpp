@@ -19,6 +19,10 @@
 ///
 /// Contract: Changes to backing (file on disk, etc) aren't guaranteed to
 //  be reflected until a call to close
+///
+/// Threads: an IOHandle is not thread-safe, each thread must use its own
+/// handle. Handles on different files may be used from different threads
+/// at the same time (see conduit_relay_io.hpp for the protocols).
 //-----------------------------------------------------------------------------
 class CONDUIT_RELAY_API IOHandle
 {
@@ -28,6 +32,23 @@ public:
     ~IOHandle();
 
     /// establish a handle
+    ///
+    /// options["cache/max_bytes"] (> 0) enables a read cache that keeps
+    /// has_path, list_child_names and leaf read results (for reads without
+    /// options), evicting the least recently used past max_bytes. Any
+    /// write or remove through the handle clears it.
+    ///
+    /// options["mmap"] ("true" or non-zero) with the conduit_bin protocol
+    /// maps the data file into memory: reads return external views of
+    /// the mapped file (valid until close), and changes made through them
+    /// change the file. Writes of leaves with the same type and size
+    /// update the file in place, other writes are appended. Lists are not
+    /// supported.
+    ///
+    /// options["sidre/external_views"] ("true" or non-zero) with the
+    /// sidre_hdf5 protocol makes reads of views into sidre buffers return
+    /// external views of the buffers cached by the handle (valid until
+    /// close) instead of copies.
     void open(const std::string &path);
 
     void open(const std::string &path,
@@ -64,6 +85,34 @@ public:
                const std::string &path,
                const Node &options);
 
+    /// write contents of passed node on a background thread, so the caller
+    /// can continue while the backend writes.
+    ///
+    /// The returned future is ready when the write finishes, and rethrows
+    /// any error raised by the write. Writes run in the order they were
+    /// issued, and all other handle methods (including close) first wait
+    /// for pending writes to finish.
+    ///
+    /// options["async/snapshot"] selects how the node's data is captured:
+    ///   "copy" (default): the node is copied before returning, the
+    ///                     caller may change or free it right away
+    ///   "reference": no copy is made, the caller must keep the node alive
+    ///                and unchanged until the write finishes
+    ///
+    /// Note: HDF5 builds without thread safety do not allow HDF5 calls
+    /// outside of this handle while its writes are pending.
+    std::future<void> write_async(const Node &node);
+    std::future<void> write_async(const Node &node, const Node &options);
+    /// async write of passed node to given subpath
+    std::future<void> write_async(const Node &node,
+                                  const std::string &path);
+    std::future<void> write_async(const Node &node,
+                                  const std::string &path,
+                                  const Node &options);
+
+    /// block until all pending async writes finish
+    void wait();
+
     /// list child names at root of handle
     void list_child_names(std::vector<std::string> &res);
     /// list child names at subpath
@@ -84,6 +133,14 @@ public:
     // void read_schema(const std::string &path,
     //                  Schema &schema);
 
+    /// report read cache counts: "enabled", "max_bytes", "bytes",
+    /// "entries", "evictions" and "hits" / "misses" for each of
+    /// "has_path", "list_child_names" and "read"
+    void cache_info(Node &info) const;
+
+    /// drop all cached read results
+    void clear_cache();
+
     /// close the handle
     void close();
 
@@ -173,9 +230,62 @@ public:
     };
 
 private:
+    // background thread and queue used by write_async
+    class AsyncWriter;
+
+    // least recently used cache of read results, enabled by open options
+    class ReadCache;
+
+    void init_cache(const Node &options);
+    void read_cached(const std::string &path,
+                     Node &node,
+                     const Node &opts);
+
     HandleInterface *m_handle;
+    AsyncWriter     *m_async;
+    ReadCache       *m_cache;
 
 };
 
+//-----------------------------------------------------------------------------
+///
+/// Registry of protocols implemented outside of relay.
+///
+/// A registered protocol is backed by a HandleInterface subclass created by
+/// its factory. IOHandle::open, relay::io::save, load, save_merged and
+/// load_merged use it for the protocol name, and identify_protocol maps its
+/// file extensions (given without the leading ".") to it. Registered
+/// protocols take precedence over built-in protocols with the same name or
+/// extension. Registration is thread safe.
+//-----------------------------------------------------------------------------
+
+/// creates a (not yet opened) handle for a registered protocol
+typedef IOHandle::HandleInterface *(*HandleFactory)(const std::string &path,
+                                                    const std::string &protocol,
+                                                    const Node &options);
+
+/// register (or replace) a protocol
+void CONDUIT_RELAY_API register_protocol(const std::string &protocol,
+                                         HandleFactory factory);
+
+/// register (or replace) a protocol and the file extensions it uses
+void CONDUIT_RELAY_API register_protocol(const std::string &protocol,
+                                         const std::vector<std::string> &extensions,
+                                         HandleFactory factory);
+
+/// remove a registered protocol and its file extensions
+void CONDUIT_RELAY_API unregister_protocol(const std::string &protocol);
+
+/// check if a protocol is registered
+bool CONDUIT_RELAY_API is_registered_protocol(const std::string &protocol);
+
+/// names of the registered protocols
+void CONDUIT_RELAY_API registered_protocols(std::vector<std::string> &res);
+
+/// find the registered protocol for a file extension,
+/// returns false if no registered protocol uses it
+bool CONDUIT_RELAY_API identify_registered_protocol(const std::string &file_ext,
+                                                    std::string &protocol);
+
 
 #endif
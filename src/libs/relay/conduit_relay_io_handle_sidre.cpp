@@ -62,7 +62,12 @@ namespace io
 SidreIOHandle::SidreIOHandle(const std::string &path,
                          const std::string &protocol,
                          const Node &options)
-: HandleInterface(path,protocol,options)
+: HandleInterface(path,protocol,options),
+  m_open(false),
+  m_has_spio_index(false),
+  m_external_views(false),
+  m_num_trees(0),
+  m_num_files(0)
 {
     // empty
 }
@@ -87,6 +92,15 @@ SidreIOHandle::open()
         CONDUIT_ERROR("SidreIOHandle does not support write mode "
                       "(open_mode = 'w')");
 
+    m_external_views = false;
+    if(options().has_path("sidre/external_views"))
+    {
+        const Node &n_ext = options()["sidre/external_views"];
+        m_external_views = n_ext.dtype().is_string() ?
+                                n_ext.as_string() == "true" :
+                                n_ext.to_int() != 0;
+    }
+
     // two cases,
     //  a standalone file with a sidre style hierarchy
     //  a collection of files with a spio generated root
@@ -157,6 +171,14 @@ SidreIOHandle::open()
         utils::split_string(m_file_protocol,"_",curr,next);
         m_file_protocol = next;
 
+        // the tree to file map only depends on the counts, create it once
+        if(m_num_trees != m_num_files && m_num_files > 1)
+        {
+            generate_domain_to_file_map(m_num_trees,
+                                        m_num_files,
+                                        m_domain_to_file);
+        }
+
         m_has_spio_index = true;
     }
     m_open = true;
@@ -271,6 +293,8 @@ SidreIOHandle::read(const std::string &path,
                              "",
                              path,
                              m_sidre_meta[0],
+                             m_sidre_buffers[0],
+                             m_external_views,
                              node);
     }
 }
@@ -462,7 +486,7 @@ SidreIOHandle::has_path(const std::string &path)
     else
     {
         // we use tree id zero for non index case
-        sidre_meta_tree_has_path(0,path);
+        res = sidre_meta_tree_has_path(0,path);
     }
 
     return res;
@@ -482,6 +506,8 @@ SidreIOHandle::close()
 
     m_file_handles.clear();
     m_sidre_meta.clear();
+    m_sidre_buffers.clear();
+    m_domain_to_file.reset();
 }
 
 //-----------------------------------------------------------------------------
@@ -571,12 +597,8 @@ SidreIOHandle::generate_file_id_for_tree(int tree_id) const
     }
     else
     {
-        // TODO: Cache the d2f_map
-        Node d2f_map;
-        generate_domain_to_file_map(m_num_trees,
-                                    m_num_files,
-                                    d2f_map);
-        int32_array v_domain_to_file = d2f_map["global_domain_to_file"].value();
+        // created in open()
+        int32_array v_domain_to_file = m_domain_to_file["global_domain_to_file"].value();
         file_id = v_domain_to_file[tree_id];
     }
 
@@ -611,7 +633,6 @@ SidreIOHandle::generate_tree_path(int tree_id) const
 //-----------------------------------------------------------------------------
 // This uses a mapping scheme created by ascent + conduit
 // Note: We will support explicit maps from the bp index in the future.
-// TODO: We should cache this, not regen every fetch
 //-----------------------------------------------------------------------------
 // adapted from VisIt, avtBlueprintTreeCache
 //-----------------------------------------------------------------------------
@@ -724,6 +745,54 @@ SidreIOHandle::generate_sidre_meta_view_path(const std::string &tree_path)
     return oss.str();
 }
 
+//----------------------------------------------------------------------------/
+// Group meta data is read with its whole subtree and marked "meta_loaded",
+// view meta data is complete once read. A group that only holds cached
+// children (from earlier subtree reads) is not loaded.
+//----------------------------------------------------------------------------/
+bool
+SidreIOHandle::sidre_meta_tree_is_loaded(const Node &sidre_meta,
+                                         const std::string &path)
+{
+    if(sidre_meta.has_child("meta_loaded"))
+    {
+        return true;
+    }
+
+    const Node *curr_meta = &sidre_meta;
+    std::string t_path = path;
+    std::string t_curr;
+    std::string t_next;
+
+    while(t_path != "")
+    {
+        conduit::utils::split_path(t_path,
+                                   t_curr,
+                                   t_next);
+
+        if(t_next == "" && curr_meta->has_path("views/" + t_curr))
+        {
+            return true;
+        }
+
+        if(!curr_meta->has_path("groups/" + t_curr))
+        {
+            return false;
+        }
+
+        curr_meta = curr_meta->fetch_ptr("groups/" + t_curr);
+
+        if(curr_meta->has_child("meta_loaded"))
+        {
+            return true;
+        }
+
+        t_path = t_next;
+    }
+
+    return false;
+}
+
 //----------------------------------------------------------------------------/
 bool
 SidreIOHandle::sidre_meta_tree_has_path(int tree_id,
@@ -827,6 +896,8 @@ SidreIOHandle::sidre_meta_tree_list_child_names(int tree_id,
 //----------------------------------------------------------------------------/
 void
 SidreIOHandle::load_sidre_tree(Node &sidre_meta,
+                               Node &sidre_buffers,
+                               bool external_views,
                                IOHandle &hnd,
                                const std::string &tree_prefix,
                                const std::string &tree_path,
@@ -851,6 +922,8 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
     {
             // we have the correct sidre meta node, now read
             load_sidre_group(sidre_meta,
+                             sidre_buffers,
+                             external_views,
                              hnd,
                              tree_prefix,
                              "",
@@ -863,6 +936,8 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
         {
             // we have the correct sidre meta node, now read
             load_sidre_group(sidre_meta["groups"][tree_curr],
+                             sidre_buffers,
+                             external_views,
                              hnd,
                              tree_prefix,
                              curr_path + tree_curr  + "/",
@@ -871,6 +946,8 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
         else // keep descending
         {
             load_sidre_tree(sidre_meta["groups"][tree_curr],
+                            sidre_buffers,
+                            external_views,
                             hnd,
                             tree_prefix,
                             tree_next,
@@ -889,6 +966,8 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
         else
         {
             load_sidre_view(sidre_meta["views"][tree_curr],
+                            sidre_buffers,
+                            external_views,
                             hnd,
                             tree_prefix,
                             curr_path + tree_curr  + "/",
@@ -907,6 +986,8 @@ SidreIOHandle::load_sidre_tree(Node &sidre_meta,
 //----------------------------------------------------------------------------/
 void
 SidreIOHandle::load_sidre_group(Node &sidre_meta,
+                                Node &sidre_buffers,
+                                bool external_views,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &group_path,
@@ -925,6 +1006,8 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
         //BP_PLUGIN_INFO("loading " << group_path << g_name << " as group");
         std::string cld_path = group_path + g_name;
         load_sidre_group(g,
+                         sidre_buffers,
+                         external_views,
                          hnd,
                          tree_prefix,
                          cld_path + "/",
@@ -939,6 +1022,8 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
         // BP_PLUGIN_INFO("loading " << group_path << v_name << " as view");
         std::string cld_path = group_path + v_name;
         load_sidre_view(v,
+                        sidre_buffers,
+                        external_views,
                         hnd,
                         tree_prefix,
                         cld_path,
@@ -949,6 +1034,8 @@ SidreIOHandle::load_sidre_group(Node &sidre_meta,
 //----------------------------------------------------------------------------/
 void
 SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
+                               Node &sidre_buffers,
+                               bool external_views,
                                IOHandle &hnd,
                                const std::string &tree_prefix,
                                const std::string &view_path,
@@ -988,20 +1075,28 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
         // we need to fetch the buffer
         int buffer_id = sidre_meta_view["buffer_id"].to_int();
 
-        std::ostringstream buffer_fetch_path_oss;
-        buffer_fetch_path_oss << tree_prefix << "/sidre/buffers/buffer_id_" << buffer_id;
+        std::ostringstream buffer_name_oss;
+        buffer_name_oss << "buffer_id_" << buffer_id;
+        std::string buffer_name = buffer_name_oss.str();
+
+        std::string buffer_fetch_path = tree_prefix + "/sidre/buffers/" + buffer_name;
 
         // buffer data path
-        std::string buffer_data_fetch_path   = buffer_fetch_path_oss.str() + "/data";
+        std::string buffer_data_fetch_path   = buffer_fetch_path + "/data";
 
         // we also need the buffer's schema
-        std::string buffer_schema_fetch_path = buffer_fetch_path_oss.str() + "/schema";
+        std::string buffer_schema_fetch_path = buffer_fetch_path + "/schema";
 
-        Node n_buffer_schema_str;
+        // buffers shared by several views are read once and cached
+        // (along with their schema) until the handle is closed
+        Node &buffer = sidre_buffers[buffer_name];
 
-        hnd.read(buffer_schema_fetch_path,n_buffer_schema_str);
+        if(!buffer.has_child("schema"))
+        {
+            hnd.read(buffer_schema_fetch_path,buffer["schema"]);
+        }
 
-        std::string buffer_schema_str = n_buffer_schema_str.as_string();
+        std::string buffer_schema_str = buffer["schema"].as_string();
         Schema buffer_schema(buffer_schema_str);
 
         //BP_PLUGIN_INFO("sidre buffer schema: " << buffer_schema.to_json());
@@ -1016,63 +1111,40 @@ SidreIOHandle::load_sidre_view(Node &sidre_meta_view,
 
         // if the schema isn't compact, or if we are reading
         // less elements than the entire buffer,
-        // we need to read a subset of the hdf5 dataset
+        // the view is a subset of the buffer
+        bool whole_buffer = view_schema.is_compact() &&
+                            ( view_schema.dtype().number_of_elements() >=
+                              buffer_schema.dtype().number_of_elements() );
 
-        if(   !view_schema.is_compact() ||
-            ( view_schema.dtype().number_of_elements() <
-              buffer_schema.dtype().number_of_elements() )
-          )
+        if( whole_buffer && !external_views && !buffer.has_child("data") )
         {
-            // BP_PLUGIN_INFO("Sidre View from Buffer Slab Fetch Case");
-            //
-            // Create a compact schema to describe our desired output data
-            //
-            Schema view_schema_compact;
-            view_schema.compact_to(view_schema_compact);
-            // setup and allocate the output node
-            out.set(view_schema_compact);
-
-            // TODO: Implement BUFFER-SLAB FETCH
-            // ---------------------------------------------------------------
-            // BUFFER-SLAB FETCH
-            // ---------------------------------------------------------------
-            //
-            // we can use hdf5 slab fetch if the the dtype.id() of the buffer
-            // and the view are the same.
-            //
-            //  otherwise, we will have to fetch the entire buffer since
-            //  hdf5 doesn't support byte level striding.
-
-            // if(
-            //     tree_cache.Read(tree_id,
-            //                     buffer_data_fetch_path,
-            //                     view_schema.dtype(),
-            //                     out)
-            //     )
-            // {
-                // BP_PLUGIN_INFO("Sidre View from Buffer Slab Fetch Case Failed");
-                // ---------------------------------------------------------------
-                // Fall back to Non BUFFER-SLAB FETCH
-                // ---------------------------------------------------------------
-                // this reads the entire buffer to get the proper subset
-                Node n_buff;
-                Node n_view;
+            // compact, and compat, we can just read
+            hnd.read(buffer_data_fetch_path,out);
+        }
+        else
+        {
+            // TODO: hdf5 slab fetch when the dtype.id() of the buffer and
+            // the view are the same, instead of reading the entire buffer
+            if(!buffer.has_child("data"))
+            {
+                hnd.read(buffer_data_fetch_path,buffer["data"]);
+            }
 
-                hnd.read(buffer_data_fetch_path,n_buff);
+            Node &n_buff = buffer["data"];
 
+            if(external_views)
+            {
+                // the view points into the cached buffer
+                out.set_external(view_schema,n_buff.data_ptr());
+            }
+            else
+            {
                 // create our view on the buffer
+                Node n_view;
                 n_view.set_external(view_schema,n_buff.data_ptr());
                 // compact the view to our output
                 n_view.compact_to(out);
-            // }
-            // else
-            // {
-            //     //BP_PLUGIN_INFO("Sidre View from Buffer Slab Fetch Case Successful");
-            // }
-        }
-        else // compact, and compat, we can just read
-        {
-            hnd.read(buffer_data_fetch_path,out);
+            }
         }
     }
     else if( view_state == "EXTERNAL" )
@@ -1135,7 +1207,11 @@ SidreIOHandle::prepare_sidre_meta_tree(IOHandle &hnd,
     {
         // only read the group + view structure, not buffers or external
         // since those aren't meta data (they are real data!)
-        hnd.read( tree_prefix + "/sidre/groups",sidre_meta["groups"]);
+        if(!sidre_meta_tree_is_loaded(sidre_meta,""))
+        {
+            hnd.read( tree_prefix + "/sidre/groups",sidre_meta["groups"]);
+            sidre_meta["meta_loaded"] = 1;
+        }
         // TODO - are there ever views at the root, I don't recall?
     }
     else // subtree read
@@ -1144,9 +1220,8 @@ SidreIOHandle::prepare_sidre_meta_tree(IOHandle &hnd,
         std::string sidre_mtree_group = generate_sidre_meta_group_path(path);
 
         // this path will either be a sidre group or a sidre view
-        // check if either exists cached
-        if( !sidre_meta.has_path(sidre_mtree_group) ||
-            !sidre_meta.has_path(sidre_mtree_view) )
+        // check if either is cached
+        if( !sidre_meta_tree_is_loaded(sidre_meta,path) )
         {
             // CONDUIT_INFO("sidre meta not loaded yet "
             //             << sidre_mtree_group << " or " << sidre_mtree_view);
@@ -1160,6 +1235,7 @@ SidreIOHandle::prepare_sidre_meta_tree(IOHandle &hnd,
                 // we have a group, read the meta data
                 hnd.read(tree_prefix + "sidre/" + sidre_mtree_group,
                          sidre_meta[sidre_mtree_group]);
+                sidre_meta[sidre_mtree_group]["meta_loaded"] = 1;
 
             }
             else if( hnd.has_path(tree_prefix + "sidre/" + sidre_mtree_view) )
@@ -1218,6 +1294,8 @@ SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
                                     const std::string &tree_prefix,
                                     const std::string &path,
                                     Node &sidre_meta,
+                                    Node &sidre_buffers,
+                                    bool external_views,
                                     Node &out)
 {
     // if we don't already have it cached, this will fetch
@@ -1228,6 +1306,8 @@ SidreIOHandle::read_from_sidre_tree(IOHandle &hnd,
                             sidre_meta);
 
     load_sidre_tree(sidre_meta,
+                    sidre_buffers,
+                    external_views,
                     hnd,
                     tree_prefix,
                     path,
@@ -1260,6 +1340,8 @@ SidreIOHandle::read_from_sidre_tree(int tree_id,
         // call load sidre variant that uses existing sidre meta tree
         Node &sidre_meta = m_sidre_meta[tree_id];
         load_sidre_tree(sidre_meta,
+                        m_sidre_buffers[tree_id],
+                        m_external_views,
                         m_file_handles[file_id],
                         generate_tree_path(tree_id),
                         path,
@@ -1272,6 +1354,8 @@ SidreIOHandle::read_from_sidre_tree(int tree_id,
         // call load sidre variant that uses existing sidre meta tree
         Node &sidre_meta = m_sidre_meta[tree_id];
         load_sidre_tree(sidre_meta,
+                        m_sidre_buffers[tree_id],
+                        m_external_views,
                         m_root_handle,
                         generate_tree_path(tree_id),
                         path,
@@ -76,10 +76,16 @@ private:
                                      const std::string &tree_prefix,
                                      const std::string &path,
                                      Node &sidre_meta,
+                                     Node &sidre_buffers,
+                                     bool external_views,
                                      Node &node);
 
     // basic sidre read logic that works at the handle level
+    // sidre_buffers caches buffers read for views that use part of
+    // a buffer, so views that share a buffer read it once
     static void load_sidre_tree(Node &sidre_meta,
+                                Node &sidre_buffers,
+                                bool external_views,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &tree_path,
@@ -87,17 +93,24 @@ private:
                                 Node &out);
 
     static void load_sidre_group(Node &sidre_meta,
+                                 Node &sidre_buffers,
+                                 bool external_views,
                                  IOHandle &hnd,
                                  const std::string &tree_prefix,
                                  const std::string &group_path,
                                  Node &out);
 
     static void load_sidre_view(Node &sidre_meta_view,
+                                Node &sidre_buffers,
+                                bool external_views,
                                 IOHandle &hnd,
                                 const std::string &tree_prefix,
                                 const std::string &view_path,
                                 Node &out);
 
+    static bool sidre_meta_tree_is_loaded(const Node &sidre_meta,
+                                          const std::string &path);
+
     bool sidre_meta_tree_has_path(const Node &sidre_meta,
                                   const std::string &path);
 
@@ -129,6 +142,8 @@ private:
 
     bool                     m_open;
     bool                     m_has_spio_index;
+    // reads of buffer views return external views of cached buffers
+    bool                     m_external_views;
 
     int                      m_num_trees;
     int                      m_num_files;
@@ -140,6 +155,9 @@ private:
     std::string              m_tree_pattern;
     std::string              m_file_protocol;
 
+    // tree id to file id map, used when trees and files don't match 1-1
+    Node                     m_domain_to_file;
+
     // io handle used to interacte with the sidre root file
     IOHandle                 m_root_handle;
 
@@ -147,5 +165,7 @@ private:
     std::map<int,IOHandle>   m_file_handles;
     // holds cached sidre meta date for each tree
     std::map<int,Node>       m_sidre_meta;
+    // holds cached sidre buffers for each tree
+    std::map<int,Node>       m_sidre_buffers;
 
 };
@@ -16,16 +16,39 @@
 
 #include "conduit_fmt/conduit_fmt.h"
 
+// i/o stats are accumulated by relay::io, for both serial and mpi builds
+#include "conduit_relay_io_stats.hpp"
+
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // external lib includes
 //-----------------------------------------------------------------------------
 #include <hdf5.h>
 
+#if defined(CONDUIT_RELAY_IO_HDF5_ZLIB_ENABLED)
+#include <zlib.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// relay filters gzip chunks on threads with direct chunk i/o, which needs
+// zlib and HDF5 1.10.2 or newer
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_RELAY_IO_HDF5_ZLIB_ENABLED) && H5_VERSION_GE(1, 10, 2)
+#define CONDUIT_RELAY_IO_HDF5_THREADED_CHUNKS
+#endif
+
 //-----------------------------------------------------------------------------
 /// macro used to check if an HDF5 object id is valid
 //-----------------------------------------------------------------------------
@@ -126,32 +149,114 @@ namespace io
 
 static std::string conduit_hdf5_list_attr_name = "__conduit_list";
 
+// small leaves of a group packed into one byte dataset, with attributes
+// that hold the layout version and the conduit schema of the leaves
+static std::string conduit_hdf5_packed_dset_name = "__conduit_packed";
+static std::string conduit_hdf5_packed_schema_attr_name = "__conduit_packed_schema";
+static std::string conduit_hdf5_packed_version_attr_name = "__conduit_packed_version";
+static const int   conduit_hdf5_packed_version = 1;
+
+//-----------------------------------------------------------------------------
+// checks if an options path (from "overrides" or "selections") applies to
+// the object at ref_path: a path matches itself and everything below it.
+// leading slashes are ignored, the empty path matches everything.
+//-----------------------------------------------------------------------------
+bool
+hdf5_options_path_matches(const std::string &opts_path,
+                          const std::string &ref_path)
+{
+    size_t pos = 0;
+    size_t len = opts_path.size();
+    if(len > 0 && opts_path[0] == '/')
+    {
+        pos = 1;
+        len--;
+    }
+    if(len > 0 && opts_path[pos + len - 1] == '/')
+    {
+        len--;
+    }
+    if(len == 0)
+    {
+        return true;
+    }
+
+    size_t ref_pos = (ref_path.size() > 0 && ref_path[0] == '/') ? 1 : 0;
+    return ref_path.compare(ref_pos, len, opts_path, pos, len) == 0 &&
+           (ref_path.size() == ref_pos + len || ref_path[ref_pos + len] == '/');
+}
+
 
 //-----------------------------------------------------------------------------
 // Private class used to hold options that control hdf5 i/o params.
 //
-// These values are read by about(), and are set by io::hdf5_set_options()
-//
+// The global defaults are read by about(), and are set by
+// io::hdf5_set_options(). Each write resolves its own copy, starting from
+// the defaults and applying the write's opts and any of the opts
+// "overrides" that match the dataset's path, so writes with different
+// options don't interfere.
 //
 //-----------------------------------------------------------------------------
 
 class HDF5Options
 {
 public:
-    static bool chunking_enabled;
-    static int  chunk_threshold;
-    static int  chunk_size;
+    bool chunking_enabled;
+    int  chunk_threshold;
+    int  chunk_size;
+
+    bool compact_storage_enabled;
+    int  compact_storage_threshold;
+
+    std::string compression_method;
+    int         compression_level;
+    // threads used to compress and decompress gzip chunks
+    // (values <= 0 select the hardware concurrency)
+    int         compression_threads;
+
+    // file space and metadata i/o settings, used when files are created
+    // or opened
+    bool        paged_file_space_enabled;
+    int         file_space_page_size;
+    // bytes, 0 disables the page buffer
+    index_t     page_buffer_size;
+    // bytes, 0 keeps hdf5's metadata cache defaults
+    index_t     metadata_cache_size;
+
+    // pack leaves up to packing_threshold bytes into one dataset per group
+    bool        packing_enabled;
+    int         packing_threshold;
 
-    static bool compact_storage_enabled;
-    static int  compact_storage_threshold;
+public:
 
-    static std::string compression_method;
-    static int         compression_level;
+    //------------------------------------------------------------------------
+    // copy of the global defaults
+    HDF5Options()
+    {
+        std::lock_guard<std::mutex> lock(global_mutex());
+        *this = global_options();
+    }
 
-public:
+    //------------------------------------------------------------------------
+    // global defaults with the per call options applied, from opts["hdf5"]
+    // (as passed by relay::io::save and IOHandle) and then from opts itself
+    HDF5Options(const Node &opts,
+                const std::string &ref_path)
+    {
+        {
+            std::lock_guard<std::mutex> lock(global_mutex());
+            *this = global_options();
+        }
+
+        if(opts.has_child("hdf5"))
+        {
+            set(opts["hdf5"], ref_path);
+        }
+        set(opts, ref_path);
+    }
 
     //------------------------------------------------------------------------
-    static void set(const Node &opts)
+    void set(const Node &opts)
     {
 
         if(opts.has_child("compact_storage"))
@@ -217,12 +322,96 @@ public:
                 {
                     compression_level = comp["level"].to_value();
                 }
+                if(comp.has_child("num_threads"))
+                {
+                    compression_threads = comp["num_threads"].to_value();
+                }
+            }
+        }
+
+        if(opts.has_child("paged_file_space"))
+        {
+            const Node &paged = opts["paged_file_space"];
+
+            if(paged.has_child("enabled"))
+            {
+                std::string enabled = paged["enabled"].as_string();
+                if(enabled == "false")
+                {
+                    paged_file_space_enabled = false;
+                }
+                else
+                {
+                    paged_file_space_enabled = true;
+                }
+            }
+
+            if(paged.has_child("page_size"))
+            {
+                file_space_page_size = paged["page_size"].to_value();
+            }
+        }
+
+        if(opts.has_path("page_buffer/size"))
+        {
+            page_buffer_size = opts["page_buffer/size"].to_index_t();
+        }
+
+        if(opts.has_path("metadata_cache/size"))
+        {
+            metadata_cache_size = opts["metadata_cache/size"].to_index_t();
+        }
+
+        if(opts.has_child("packing"))
+        {
+            const Node &packing = opts["packing"];
+
+            if(packing.has_child("enabled"))
+            {
+                std::string enabled = packing["enabled"].as_string();
+                if(enabled == "false")
+                {
+                    packing_enabled = false;
+                }
+                else
+                {
+                    packing_enabled = true;
+                }
+            }
+
+            if(packing.has_child("threshold"))
+            {
+                packing_threshold = packing["threshold"].to_value();
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // applies opts, then each entry of opts["overrides"] whose path is
+    // ref_path or a parent of ref_path
+    void set(const Node &opts,
+             const std::string &ref_path)
+    {
+        set(opts);
+
+        if(opts.has_child("overrides"))
+        {
+            NodeConstIterator itr = opts["overrides"].children();
+            while(itr.has_next())
+            {
+                const Node &ovr = itr.next();
+                if(ovr.has_child("path") &&
+                   hdf5_options_path_matches(ovr["path"].as_string(),
+                                             ref_path))
+                {
+                    set(ovr);
+                }
             }
         }
     }
 
     //------------------------------------------------------------------------
-    static void about(Node &opts)
+    void about(Node &opts) const
     {
         opts.reset();
 
@@ -253,35 +442,109 @@ public:
         if(compression_method == "gzip")
         {
             opts["chunking/compression/level"] = compression_level;
+            opts["chunking/compression/num_threads"] = compression_threads;
+        }
+
+        if(paged_file_space_enabled)
+        {
+            opts["paged_file_space/enabled"] = "true";
+        }
+        else
+        {
+            opts["paged_file_space/enabled"] = "false";
+        }
+
+        opts["paged_file_space/page_size"] = file_space_page_size;
+        opts["page_buffer/size"] = page_buffer_size;
+        opts["metadata_cache/size"] = metadata_cache_size;
+
+        if(packing_enabled)
+        {
+            opts["packing/enabled"] = "true";
+        }
+        else
+        {
+            opts["packing/enabled"] = "false";
         }
+
+        opts["packing/threshold"] = packing_threshold;
+    }
+
+    //------------------------------------------------------------------------
+    // number of threads to use for chunk compression
+    index_t num_compression_threads() const
+    {
+        if(compression_threads <= 0)
+        {
+            return std::max((index_t)1,
+                            (index_t)std::thread::hardware_concurrency());
+        }
+        return (index_t)compression_threads;
+    }
+
+    //------------------------------------------------------------------------
+    static void set_defaults(const Node &opts)
+    {
+        std::lock_guard<std::mutex> lock(global_mutex());
+        global_options().set(opts);
+    }
+
+    //------------------------------------------------------------------------
+    static void about_defaults(Node &opts)
+    {
+        HDF5Options defaults;
+        defaults.about(opts);
     }
-};
 
-// default hdf5 i/o settings
+private:
 
-bool HDF5Options::compact_storage_enabled   = true;
-int  HDF5Options::compact_storage_threshold = 1024;
+    //------------------------------------------------------------------------
+    // default hdf5 i/o settings
+    explicit HDF5Options(bool)
+    : chunking_enabled(true),
+      chunk_threshold(2000000), // 2 mb
+      chunk_size(1000000), // 1 mb
+      compact_storage_enabled(true),
+      compact_storage_threshold(1024),
+      compression_method("gzip"),
+      compression_level(5),
+      compression_threads(1),
+      paged_file_space_enabled(false),
+      file_space_page_size(65536), // 64 kb
+      page_buffer_size(0),
+      metadata_cache_size(0),
+      packing_enabled(false),
+      packing_threshold(1024)
+    {}
 
-bool        HDF5Options::chunking_enabled   = true;
-int         HDF5Options::chunk_size         = 1000000; // 1 mb
-int         HDF5Options::chunk_threshold    = 2000000; // 2 mb
+    //------------------------------------------------------------------------
+    static HDF5Options &global_options()
+    {
+        static HDF5Options res(true);
+        return res;
+    }
 
-std::string HDF5Options::compression_method = "gzip";
-int         HDF5Options::compression_level  = 5;
+    //------------------------------------------------------------------------
+    static std::mutex &global_mutex()
+    {
+        static std::mutex res;
+        return res;
+    }
+};
 
 
 //-----------------------------------------------------------------------------
 void
 hdf5_set_options(const Node &opts)
 {
-    HDF5Options::set(opts);
+    HDF5Options::set_defaults(opts);
 }
 
 //-----------------------------------------------------------------------------
 void
 hdf5_options(Node &opts)
 {
-    HDF5Options::about(opts);
+    HDF5Options::about_defaults(opts);
 }
 
 //-----------------------------------------------------------------------------
@@ -336,6 +599,120 @@ private:
     void         *herr_func_client_data;
 };
 
+//-----------------------------------------------------------------------------
+// Private classes used to serialize calls into HDF5.
+//
+// Unless HDF5 is built thread-safe, its library state may only be used by
+// one thread at a time. Every public hdf5 entry point holds an HDF5Lock for
+// its duration, so relay hdf5 calls from different threads are serialized
+// on one process wide mutex. The lock is re-entrant per thread, which lets
+// public functions call each other. HDF5Unlock releases the calling
+// thread's hold while it does work that does not touch HDF5 (e.g. waiting
+// on chunk filter threads), and takes it back when destroyed. It keeps the
+// lock inside HDF5 callbacks (marked with an HDF5CallbackScope), since the
+// HDF5 call that runs them is still in progress.
+//
+// With a thread-safe HDF5 the library does its own locking and both
+// classes are no-ops.
+//-----------------------------------------------------------------------------
+class HDF5Lock
+{
+public:
+    HDF5Lock()
+    {
+#if !defined(H5_HAVE_THREADSAFE)
+        if(depth()++ == 0)
+        {
+            mutex().lock();
+        }
+#endif
+    }
+
+   ~HDF5Lock()
+    {
+#if !defined(H5_HAVE_THREADSAFE)
+        if(--depth() == 0)
+        {
+            mutex().unlock();
+        }
+#endif
+    }
+
+    static std::mutex &mutex()
+    {
+        static std::mutex res;
+        return res;
+    }
+
+    // number of nested locks held by the calling thread
+    static index_t &depth()
+    {
+        static thread_local index_t res = 0;
+        return res;
+    }
+
+    // number of nested hdf5 callbacks running on the calling thread
+    static index_t &callback_depth()
+    {
+        static thread_local index_t res = 0;
+        return res;
+    }
+
+private:
+    HDF5Lock(const HDF5Lock &);
+    HDF5Lock &operator=(const HDF5Lock &);
+};
+
+//-----------------------------------------------------------------------------
+class HDF5Unlock
+{
+public:
+    HDF5Unlock()
+    : m_depth(0)
+    {
+        if(HDF5Lock::depth() > 0 && HDF5Lock::callback_depth() == 0)
+        {
+            m_depth = HDF5Lock::depth();
+            HDF5Lock::depth() = 0;
+            HDF5Lock::mutex().unlock();
+        }
+    }
+
+   ~HDF5Unlock()
+    {
+        if(m_depth > 0)
+        {
+            HDF5Lock::mutex().lock();
+            HDF5Lock::depth() = m_depth;
+        }
+    }
+
+private:
+    HDF5Unlock(const HDF5Unlock &);
+    HDF5Unlock &operator=(const HDF5Unlock &);
+
+    index_t m_depth;
+};
+
+//-----------------------------------------------------------------------------
+class HDF5CallbackScope
+{
+public:
+    HDF5CallbackScope()
+    {
+        HDF5Lock::callback_depth()++;
+    }
+
+   ~HDF5CallbackScope()
+    {
+        HDF5Lock::callback_depth()--;
+    }
+
+private:
+    HDF5CallbackScope(const HDF5CallbackScope &);
+    HDF5CallbackScope &operator=(const HDF5CallbackScope &);
+};
+
 //-----------------------------------------------------------------------------
 // helper method decls
 //-----------------------------------------------------------------------------
@@ -402,7 +779,8 @@ hid_t create_hdf5_dataset_for_conduit_leaf(const DataType &dt,
                                            const std::string &ref_path,
                                            hid_t hdf5_group_id,
                                            const std::string &hdf5_dset_name,
-                                           bool extendible);
+                                           bool extendible,
+                                           const HDF5Options &h5_opts);
 
 //-----------------------------------------------------------------------------
 hid_t create_hdf5_group_for_conduit_node(const Node &node,
@@ -431,6 +809,17 @@ void  write_conduit_node_children_to_hdf5_group(const Node &node,
                                                 hid_t hdf5_group_id,
                                                 const Node &opts);
 
+//-----------------------------------------------------------------------------
+// packs the small leaf children of an object (and those packed by earlier
+// writes) into the group's packed dataset, packed_leaves holds the leaves
+// that were packed
+//-----------------------------------------------------------------------------
+void  write_conduit_leaves_to_hdf5_packed_dataset(const Node &node,
+                                                  const std::string &ref_path,
+                                                  hid_t hdf5_group_id,
+                                                  const Node &opts,
+                                                  Node &packed_leaves);
+
 //-----------------------------------------------------------------------------
 void write_conduit_hdf5_list_attribute(hid_t hdf5_group_id,
                                        const std::string &ref_path);
@@ -457,6 +846,35 @@ void read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                                        const Node &opts,
                                        Node &dest);
 
+//-----------------------------------------------------------------------------
+// reads the leaves of a packed dataset into an object node
+//-----------------------------------------------------------------------------
+void read_hdf5_packed_dataset(hid_t hdf5_dset_id,
+                              const std::string &ref_path,
+                              Node &packed);
+
+//-----------------------------------------------------------------------------
+// reads the packed leaves of the group at hdf5_path, returns false
+// if the group has no packed dataset
+//-----------------------------------------------------------------------------
+bool read_hdf5_group_packed_leaves(hid_t hdf5_id,
+                                   const std::string &hdf5_path,
+                                   Node &packed);
+
+//-----------------------------------------------------------------------------
+void read_hdf5_packed_dataset_into_conduit_node(hid_t hdf5_dset_id,
+                                                const std::string &ref_path,
+                                                bool only_get_metadata,
+                                                const Node &opts,
+                                                Node &dest);
+
+//-----------------------------------------------------------------------------
+// reads a packed leaf given its path, returns false if there is none
+//-----------------------------------------------------------------------------
+bool read_hdf5_packed_leaf(hid_t hdf5_id,
+                           const std::string &hdf5_path,
+                           Node &leaf);
+
 //-----------------------------------------------------------------------------
 void read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
                                       const std::string &ref_path,
@@ -497,6 +915,7 @@ hid_t
 conduit_dtype_to_hdf5_dtype(const DataType &dt,
                             const std::string &ref_path)
 {
+    HDF5Lock hdf5_lock;
     hid_t res = -1;
 
     // // This code path enables writing strings in a way that is friendlier
@@ -614,6 +1033,7 @@ void
 conduit_dtype_to_hdf5_dtype_cleanup(hid_t hdf5_dtype_id,
                             const std::string &ref_path)
 {
+    HDF5Lock hdf5_lock;
     // NOTE: This cleanup won't be triggered when we use thee
     // based H5T_C_S1 with a data space that encodes # of elements
     // (Our current path, given our logic to encode string size in the
@@ -638,6 +1058,7 @@ hdf5_dtype_to_conduit_dtype(hid_t hdf5_dtype_id,
                             index_t num_elems,
                             const std::string &ref_path)
 {
+    HDF5Lock hdf5_lock;
     // TODO: there may be a more straight forward way to do this using
     // hdf5's data type introspection methods
 
@@ -833,6 +1254,50 @@ hdf5_ref_path_with_filename(hid_t hdf5_id,
     }
 }
 
+//---------------------------------------------------------------------------//
+// Fetches the type and address (or token) of an object. Only the basic
+// info is requested where hdf5 allows it, which avoids counting attributes
+// and sizing the object header of every object visited by a read.
+//---------------------------------------------------------------------------//
+herr_t
+hdf5_basic_obj_info(hid_t hdf5_id,
+                    H5O_info_t *h5_info)
+{
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+    return H5Oget_info(hdf5_id, h5_info, H5O_INFO_BASIC);
+#elif H5_VERSION_GE(1, 10, 3) && !defined(H5_USE_18_API)
+    return H5Oget_info2(hdf5_id, h5_info, H5O_INFO_BASIC);
+#else
+    return H5Oget_info(hdf5_id, h5_info);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+herr_t
+hdf5_basic_obj_info_by_name(hid_t hdf5_id,
+                            const char *hdf5_path,
+                            H5O_info_t *h5_info)
+{
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+    return H5Oget_info_by_name(hdf5_id,
+                               hdf5_path,
+                               h5_info,
+                               H5O_INFO_BASIC,
+                               H5P_DEFAULT);
+#elif H5_VERSION_GE(1, 10, 3) && !defined(H5_USE_18_API)
+    return H5Oget_info_by_name2(hdf5_id,
+                                hdf5_path,
+                                h5_info,
+                                H5O_INFO_BASIC,
+                                H5P_DEFAULT);
+#else
+    return H5Oget_info_by_name(hdf5_id,
+                               hdf5_path,
+                               h5_info,
+                               H5P_DEFAULT);
+#endif
+}
+
 
 //---------------------------------------------------------------------------//
 // Write Helpers
@@ -1241,7 +1706,9 @@ create_hdf5_compact_plist_for_conduit_leaf()
 
 //---------------------------------------------------------------------------//
 hid_t
-create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype)
+create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype,
+                                           bool extendible,
+                                           const HDF5Options &h5_opts)
 {
     hid_t h5_cprops_id = H5Pcreate(H5P_DATASET_CREATE);
 
@@ -1249,15 +1716,33 @@ create_hdf5_chunked_plist_for_conduit_leaf(const DataType &dtype)
 
     // hdf5 sets chunking in elements, not bytes,
     // our options are in bytes, so convert to # of elems
-    hsize_t h5_chunk_size =  (hsize_t) (HDF5Options::chunk_size / dtype.element_bytes());
+    hsize_t h5_chunk_size =  (hsize_t) (h5_opts.chunk_size / dtype.element_bytes());
+    if(h5_chunk_size == 0)
+    {
+        h5_chunk_size = 1;
+    }
+
+    // size the chunks to the dataset: split larger datasets into equal
+    // chunks (instead of leaving a mostly empty last chunk), and use one
+    // chunk for smaller datasets that are not written with an offset
+    hsize_t num_eles = (hsize_t) dtype.number_of_elements();
+    if(num_eles > h5_chunk_size)
+    {
+        hsize_t num_chunks = (num_eles + h5_chunk_size - 1) / h5_chunk_size;
+        h5_chunk_size = (num_eles + num_chunks - 1) / num_chunks;
+    }
+    else if(!extendible && num_eles > 0)
+    {
+        h5_chunk_size = num_eles;
+    }
 
     H5Pset_chunk(h5_cprops_id, 1, &h5_chunk_size);
 
-    if(HDF5Options::compression_method == "gzip" )
+    if(h5_opts.compression_method == "gzip" )
     {
         // Turn on compression
         H5Pset_shuffle(h5_cprops_id);
-        H5Pset_deflate(h5_cprops_id, HDF5Options::compression_level);
+        H5Pset_deflate(h5_cprops_id, h5_opts.compression_level);
     }
 
     return h5_cprops_id;
@@ -1270,8 +1755,11 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
                                      const std::string &ref_path,
                                      hid_t hdf5_group_id,
                                      const std::string &hdf5_dset_name,
-                                     bool extendible)
+                                     bool extendible,
+                                     const HDF5Options &h5_opts)
 {
+    conduit::relay::io::StatsTimer stats_timer("hdf5", "dataset_create");
+
     hid_t res = -1;
 
     hid_t h5_dtype = conduit_dtype_to_hdf5_dtype(dtype,ref_path);
@@ -1282,21 +1770,23 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
 
     bool unlimited_dim = false;
 
-    if (extendible && !HDF5Options::chunking_enabled)
+    if (extendible && !h5_opts.chunking_enabled)
     {
         CONDUIT_ERROR("Chunking must be enabled to create an extendible array.");
     }
 
     // if an offset is supplied, we will default to creating an extendible array
-    if( !extendible && HDF5Options::compact_storage_enabled &&
-        dtype.bytes_compact() <= HDF5Options::compact_storage_threshold)
+    if( !extendible && h5_opts.compact_storage_enabled &&
+        dtype.bytes_compact() <= h5_opts.compact_storage_threshold)
     {
         h5_cprops_id = create_hdf5_compact_plist_for_conduit_leaf();
     }
-    else if( extendible || (HDF5Options::chunking_enabled &&
-             dtype.bytes_compact() > HDF5Options::chunk_threshold))
+    else if( extendible || (h5_opts.chunking_enabled &&
+             dtype.bytes_compact() > h5_opts.chunk_threshold))
     {
-        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(dtype);
+        h5_cprops_id = create_hdf5_chunked_plist_for_conduit_leaf(dtype,
+                                                                  extendible,
+                                                                  h5_opts);
         unlimited_dim = true;
     }
 
@@ -1384,24 +1874,567 @@ create_hdf5_dataset_for_conduit_leaf(const DataType &dtype,
 
 
 //---------------------------------------------------------------------------//
-hid_t
-create_hdf5_dataset_for_conduit_empty(hid_t hdf5_group_id,
-                                      const std::string &ref_path,
-                                      const std::string &hdf5_dset_name)
+// Threaded chunk filtering
+//
+// HDF5 runs the filter pipeline serially inside H5Dwrite and H5Dread. When
+// a chunked dataset only uses the shuffle and deflate filters (the filters
+// relay sets up for gzip compression), relay can filter the chunks on
+// several threads and move them with direct chunk i/o (H5Dwrite_chunk and
+// H5Dread_chunk). All HDF5 calls stay on the calling thread.
+//---------------------------------------------------------------------------//
+#if defined(CONDUIT_RELAY_IO_HDF5_THREADED_CHUNKS)
+
+//---------------------------------------------------------------------------//
+struct HDF5ChunkLayout
 {
-    hid_t res = -1;
-    // for conduit empty, use an opaque data type with zero size;
-    hid_t h5_dtype_id  = H5Tcreate(H5T_OPAQUE, 1);
-    hid_t h5_dspace_id = H5Screate(H5S_NULL);
+    hsize_t num_eles;
+    hsize_t chunk_eles;
+    hsize_t num_chunks;
+    size_t  ele_bytes;
+    // H5Z_FILTER_SHUFFLE or H5Z_FILTER_DEFLATE, in pipeline order
+    std::vector<H5Z_filter_t> filters;
+    int     deflate_level;
+
+    size_t chunk_bytes() const
+    {
+        return (size_t)(chunk_eles * ele_bytes);
+    }
+};
 
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
-                                                    hdf5_group_id,
-                                                    ref_path,
-                                           "Failed to create HDF5 Dataspace");
+//---------------------------------------------------------------------------//
+// checks if relay can filter the chunks of a dataset read or written with
+// the given memory type, and if so returns the chunk layout
+bool
+hdf5_dataset_chunk_layout(hid_t hdf5_dset_id,
+                          hid_t h5_mem_dtype_id,
+                          HDF5ChunkLayout &res)
+{
+    HDF5ErrorStackSupressor supress_hdf5_errors;
 
-    // create new dataset
-    res = H5Dcreate(hdf5_group_id,
-                    hdf5_dset_name.c_str(),
+#if defined(H5_HAVE_PARALLEL)
+    // direct chunk i/o isn't supported by the mpio driver
+    hid_t h5_file_id = H5Iget_file_id(hdf5_dset_id);
+    hid_t h5_fa_props_id = H5Fget_access_plist(h5_file_id);
+    bool is_mpio = H5Pget_driver(h5_fa_props_id) == H5FD_MPIO;
+    H5Pclose(h5_fa_props_id);
+    H5Fclose(h5_file_id);
+    if(is_mpio)
+    {
+        return false;
+    }
+#endif
+
+    hid_t h5_dtype_id  = H5Dget_type(hdf5_dset_id);
+    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
+    hid_t h5_cprops_id = H5Dget_create_plist(hdf5_dset_id);
+
+    bool ok = CONDUIT_HDF5_VALID_ID(h5_dtype_id) &&
+              CONDUIT_HDF5_VALID_ID(h5_dspace_id) &&
+              CONDUIT_HDF5_VALID_ID(h5_cprops_id) &&
+              H5Pget_layout(h5_cprops_id) == H5D_CHUNKED &&
+              H5Sget_simple_extent_ndims(h5_dspace_id) == 1 &&
+              H5Tis_variable_str(h5_dtype_id) == 0 &&
+              // direct chunk i/o does no type conversion
+              H5Tequal(h5_dtype_id, h5_mem_dtype_id) > 0;
+
+    if(ok)
+    {
+        hsize_t chunk_dims[1] = {0};
+        H5Pget_chunk(h5_cprops_id, 1, chunk_dims);
+
+        res.num_eles      = (hsize_t) H5Sget_simple_extent_npoints(h5_dspace_id);
+        res.chunk_eles    = chunk_dims[0];
+        res.ele_bytes     = H5Tget_size(h5_dtype_id);
+        res.num_chunks    = 0;
+        res.deflate_level = -1;
+        res.filters.clear();
+
+        ok = res.chunk_eles > 0 && res.ele_bytes > 0;
+        if(ok)
+        {
+            res.num_chunks = (res.num_eles + res.chunk_eles - 1) /
+                             res.chunk_eles;
+        }
+
+        int num_filters = H5Pget_nfilters(h5_cprops_id);
+        for(int i = 0; ok && i < num_filters; i++)
+        {
+            unsigned int flags = 0;
+            size_t cd_nelmts = 1;
+            unsigned int cd_values[1] = {0};
+            H5Z_filter_t filter_id = H5Pget_filter2(h5_cprops_id,
+                                                    (unsigned int) i,
+                                                    &flags,
+                                                    &cd_nelmts,
+                                                    cd_values,
+                                                    0,
+                                                    NULL,
+                                                    NULL);
+            if(filter_id == H5Z_FILTER_DEFLATE && cd_nelmts > 0)
+            {
+                res.deflate_level = (int) cd_values[0];
+            }
+            else if(filter_id != H5Z_FILTER_SHUFFLE)
+            {
+                ok = false;
+            }
+            res.filters.push_back(filter_id);
+        }
+
+        // unfiltered chunks gain nothing from threads
+        ok = ok && res.deflate_level >= 0;
+    }
+
+    if(CONDUIT_HDF5_VALID_ID(h5_cprops_id))
+    {
+        H5Pclose(h5_cprops_id);
+    }
+    if(CONDUIT_HDF5_VALID_ID(h5_dspace_id))
+    {
+        H5Sclose(h5_dspace_id);
+    }
+    if(CONDUIT_HDF5_VALID_ID(h5_dtype_id))
+    {
+        H5Tclose(h5_dtype_id);
+    }
+
+    return ok;
+}
+
+//---------------------------------------------------------------------------//
+// applies (or with unshuffle = true, reverts) HDF5's shuffle filter, which
+// groups the i-th bytes of all elements together
+void
+hdf5_shuffle_chunk(const uint8 *src,
+                   size_t nbytes,
+                   size_t ele_bytes,
+                   bool unshuffle,
+                   uint8 *dest)
+{
+    size_t num_eles = nbytes / ele_bytes;
+    for(size_t b = 0; b < ele_bytes; b++)
+    {
+        for(size_t i = 0; i < num_eles; i++)
+        {
+            if(unshuffle)
+            {
+                dest[i * ele_bytes + b] = src[b * num_eles + i];
+            }
+            else
+            {
+                dest[b * num_eles + i] = src[i * ele_bytes + b];
+            }
+        }
+    }
+    // trailing bytes are left as is
+    size_t done = num_eles * ele_bytes;
+    memcpy(dest + done, src + done, nbytes - done);
+}
+
+//---------------------------------------------------------------------------//
+// runs the dataset's filters on a chunk's values (the last chunk is padded
+// to a full chunk, as HDF5 does)
+void
+hdf5_encode_chunk(const HDF5ChunkLayout &layout,
+                  const uint8 *src,
+                  size_t src_bytes,
+                  std::vector<uint8> &res)
+{
+    std::vector<uint8> buff(layout.chunk_bytes(), 0);
+    memcpy(&buff[0], src, src_bytes);
+
+    std::vector<uint8> tmp;
+    for(size_t f = 0; f < layout.filters.size(); f++)
+    {
+        if(layout.filters[f] == H5Z_FILTER_SHUFFLE)
+        {
+            tmp.resize(buff.size());
+            hdf5_shuffle_chunk(&buff[0], buff.size(), layout.ele_bytes,
+                               false, &tmp[0]);
+        }
+        else // H5Z_FILTER_DEFLATE
+        {
+            uLongf tmp_bytes = compressBound((uLong) buff.size());
+            tmp.resize(tmp_bytes);
+            int zstatus = compress2(&tmp[0],
+                                    &tmp_bytes,
+                                    &buff[0],
+                                    (uLong) buff.size(),
+                                    layout.deflate_level);
+            if(zstatus != Z_OK)
+            {
+                CONDUIT_ERROR("zlib compress2 failed with status "
+                              << zstatus);
+            }
+            tmp.resize(tmp_bytes);
+        }
+        buff.swap(tmp);
+    }
+
+    res.swap(buff);
+}
+
+//---------------------------------------------------------------------------//
+// reverts the filters applied to a chunk (skipping the filters set in
+// filter_mask), and copies the first dest_bytes to dest
+void
+hdf5_decode_chunk(const HDF5ChunkLayout &layout,
+                  std::vector<uint8> &buff,
+                  uint32_t filter_mask,
+                  uint8 *dest,
+                  size_t dest_bytes)
+{
+    std::vector<uint8> tmp;
+    for(size_t f = layout.filters.size(); f-- > 0; )
+    {
+        if(filter_mask & (1u << f))
+        {
+            continue;
+        }
+
+        if(layout.filters[f] == H5Z_FILTER_SHUFFLE)
+        {
+            tmp.resize(buff.size());
+            hdf5_shuffle_chunk(&buff[0], buff.size(), layout.ele_bytes,
+                               true, &tmp[0]);
+        }
+        else // H5Z_FILTER_DEFLATE
+        {
+            uLongf tmp_bytes = (uLongf) layout.chunk_bytes();
+            tmp.resize(tmp_bytes);
+            int zstatus = uncompress(&tmp[0],
+                                     &tmp_bytes,
+                                     &buff[0],
+                                     (uLong) buff.size());
+            if(zstatus != Z_OK)
+            {
+                CONDUIT_ERROR("zlib uncompress failed with status "
+                              << zstatus);
+            }
+            tmp.resize(tmp_bytes);
+        }
+        buff.swap(tmp);
+    }
+
+    if(buff.size() < dest_bytes)
+    {
+        CONDUIT_ERROR("HDF5 chunk holds " << buff.size() << " bytes,"
+                      " expected " << dest_bytes);
+    }
+    memcpy(dest, &buff[0], dest_bytes);
+}
+
+//---------------------------------------------------------------------------//
+// Runs filter(i) for each chunk on num_threads threads, and io(i) on the
+// calling thread in chunk order as the chunks are filtered. Filtering runs
+// at most a few chunks per thread ahead of io, which bounds the memory used
+// for filtered chunks. Errors are raised on the calling thread.
+template <typename Filter, typename IO>
+void
+hdf5_chunk_pipeline(index_t num_chunks,
+                    index_t num_threads,
+                    const Filter &filter,
+                    const IO &io)
+{
+    const index_t window = 4 * num_threads;
+
+    std::vector<char>       ready((size_t)num_chunks, 0);
+    index_t                 num_done = 0;
+    std::atomic<index_t>    next_chunk(0);
+    bool                    failed = false;
+    std::exception_ptr      error;
+    std::mutex              mtx;
+    std::condition_variable cv;
+
+    auto fail = [&]()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if(!failed)
+        {
+            error  = std::current_exception();
+            failed = true;
+        }
+    };
+
+    auto worker = [&]()
+    {
+        index_t i = next_chunk++;
+        while(i < num_chunks)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [&]() { return failed || i < num_done + window; });
+                if(failed)
+                {
+                    return;
+                }
+            }
+
+            try
+            {
+                filter(i);
+            }
+            catch(...)
+            {
+                fail();
+                cv.notify_all();
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                ready[(size_t)i] = 1;
+            }
+            cv.notify_all();
+            i = next_chunk++;
+        }
+    };
+
+    index_t num_workers = std::max((index_t)1,
+                                   std::min(num_threads, num_chunks));
+    std::vector<std::thread> threads;
+    threads.reserve((size_t)num_workers);
+    for(index_t i = 0; i < num_workers; i++)
+    {
+        threads.push_back(std::thread(worker));
+    }
+
+    for(index_t i = 0; i < num_chunks; i++)
+    {
+        {
+            // let other threads use hdf5 while this one waits on filters
+            HDF5Unlock hdf5_unlock;
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&]() { return failed || ready[(size_t)i] != 0; });
+            if(failed)
+            {
+                break;
+            }
+        }
+
+        try
+        {
+            io(i);
+        }
+        catch(...)
+        {
+            fail();
+            cv.notify_all();
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            num_done = i + 1;
+        }
+        cv.notify_all();
+    }
+
+    for(size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    if(failed)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Writes all num_eles values of a dataset from a compact buffer, filtering
+// the chunks on num_threads threads. Returns false (without writing) if
+// the dataset's chunks can't be filtered by relay.
+bool
+write_hdf5_dataset_chunks(hid_t hdf5_dset_id,
+                          hid_t h5_dtype_id,
+                          hsize_t num_eles,
+                          const void *data_ptr,
+                          index_t num_threads,
+                          const std::string &ref_path)
+{
+    HDF5ChunkLayout layout;
+    if(num_threads < 2 ||
+       !hdf5_dataset_chunk_layout(hdf5_dset_id, h5_dtype_id, layout) ||
+       layout.num_chunks < 2 ||
+       layout.num_eles != num_eles)
+    {
+        return false;
+    }
+
+    const uint8 *src   = (const uint8 *) data_ptr;
+    const size_t nbytes = (size_t)(layout.num_eles * layout.ele_bytes);
+    const size_t chunk_bytes = layout.chunk_bytes();
+
+    // includes writing the filtered chunks
+    conduit::relay::io::StatsTimer stats_timer("hdf5", "compress", (index_t) nbytes);
+
+    std::vector< std::vector<uint8> > chunks((size_t)layout.num_chunks);
+
+    hdf5_chunk_pipeline((index_t) layout.num_chunks,
+                        num_threads,
+                        [&](index_t i)
+    {
+        size_t begin = (size_t)i * chunk_bytes;
+        hdf5_encode_chunk(layout,
+                          src + begin,
+                          std::min(chunk_bytes, nbytes - begin),
+                          chunks[(size_t)i]);
+    },
+                        [&](index_t i)
+    {
+        std::vector<uint8> &chunk = chunks[(size_t)i];
+        hsize_t offset[1] = {(hsize_t)i * layout.chunk_eles};
+        herr_t h5_status = H5Dwrite_chunk(hdf5_dset_id,
+                                          H5P_DEFAULT,
+                                          0,
+                                          offset,
+                                          chunk.size(),
+                                          &chunk[0]);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                           "Failed to write HDF5 chunk "
+                                           << i << " of dataset "
+                                           << hdf5_dset_id);
+        std::vector<uint8>().swap(chunk);
+    });
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Reads all values of a dataset into a compact buffer, unfiltering the
+// chunks on num_threads threads. Returns false (without reading) if the
+// dataset's chunks can't be unfiltered by relay.
+bool
+read_hdf5_dataset_chunks(hid_t hdf5_dset_id,
+                         hid_t h5_dtype_id,
+                         index_t num_threads,
+                         const std::string &ref_path,
+                         void *data_ptr)
+{
+    HDF5ChunkLayout layout;
+    if(num_threads < 2 ||
+       !hdf5_dataset_chunk_layout(hdf5_dset_id, h5_dtype_id, layout) ||
+       layout.num_chunks < 2)
+    {
+        return false;
+    }
+
+    std::vector< std::vector<uint8> > chunks((size_t)layout.num_chunks);
+    std::vector<uint32_t> filter_masks((size_t)layout.num_chunks, 0);
+
+    for(hsize_t i = 0; i < layout.num_chunks; i++)
+    {
+        hsize_t offset[1] = {i * layout.chunk_eles};
+        hsize_t chunk_nbytes = 0;
+        {
+            HDF5ErrorStackSupressor supress_hdf5_errors;
+            if(H5Dget_chunk_storage_size(hdf5_dset_id,
+                                         offset,
+                                         &chunk_nbytes) < 0)
+            {
+                chunk_nbytes = 0;
+            }
+        }
+        // chunks that were never written hold fill values, leave those
+        // to H5Dread
+        if(chunk_nbytes == 0)
+        {
+            return false;
+        }
+
+        std::vector<uint8> &chunk = chunks[(size_t)i];
+        chunk.resize((size_t)chunk_nbytes);
+        herr_t h5_status = H5Dread_chunk(hdf5_dset_id,
+                                         H5P_DEFAULT,
+                                         offset,
+                                         &filter_masks[(size_t)i],
+                                         &chunk[0]);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                           "Failed to read HDF5 chunk "
+                                           << i << " of dataset "
+                                           << hdf5_dset_id);
+    }
+
+    uint8 *dest = (uint8 *) data_ptr;
+    const size_t nbytes = (size_t)(layout.num_eles * layout.ele_bytes);
+    const size_t chunk_bytes = layout.chunk_bytes();
+
+    conduit::relay::io::StatsTimer stats_timer("hdf5", "decompress", (index_t) nbytes);
+
+    // the chunks are in memory, unfiltering them does not touch hdf5
+    HDF5Unlock hdf5_unlock;
+    hdf5_chunk_pipeline((index_t) layout.num_chunks,
+                        num_threads,
+                        [&](index_t i)
+    {
+        size_t begin = (size_t)i * chunk_bytes;
+        hdf5_decode_chunk(layout,
+                          chunks[(size_t)i],
+                          filter_masks[(size_t)i],
+                          dest + begin,
+                          std::min(chunk_bytes, nbytes - begin));
+    },
+                        [&](index_t i)
+    {
+        // release the chunk's buffer
+        std::vector<uint8>().swap(chunks[(size_t)i]);
+    });
+
+    return true;
+}
+
+#else
+
+//---------------------------------------------------------------------------//
+// without zlib or direct chunk i/o, hdf5 filters the chunks
+bool
+write_hdf5_dataset_chunks(hid_t /*hdf5_dset_id*/,
+                          hid_t /*h5_dtype_id*/,
+                          hsize_t /*num_eles*/,
+                          const void * /*data_ptr*/,
+                          index_t /*num_threads*/,
+                          const std::string & /*ref_path*/)
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+bool
+read_hdf5_dataset_chunks(hid_t /*hdf5_dset_id*/,
+                         hid_t /*h5_dtype_id*/,
+                         index_t /*num_threads*/,
+                         const std::string & /*ref_path*/,
+                         void * /*data_ptr*/)
+{
+    return false;
+}
+
+#endif
+
+//---------------------------------------------------------------------------//
+hid_t
+create_hdf5_dataset_for_conduit_empty(hid_t hdf5_group_id,
+                                      const std::string &ref_path,
+                                      const std::string &hdf5_dset_name)
+{
+    hid_t res = -1;
+    // for conduit empty, use an opaque data type with zero size;
+    hid_t h5_dtype_id  = H5Tcreate(H5T_OPAQUE, 1);
+    hid_t h5_dspace_id = H5Screate(H5S_NULL);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Dataspace");
+
+    // create new dataset
+    res = H5Dcreate(hdf5_group_id,
+                    hdf5_dset_name.c_str(),
                     h5_dtype_id,
                     h5_dspace_id,
                     H5P_DEFAULT,
@@ -1526,6 +2559,8 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
 {
     DataType dt = node.dtype();
 
+    conduit::relay::io::StatsTimer stats_timer("hdf5", "dataset_write", dt.bytes_compact());
+
     hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(dt,ref_path);
     herr_t h5_status = -1;
 
@@ -1555,29 +2590,36 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
     // the entire array is overwriten
     if (dataset_max_dims[0] != H5S_UNLIMITED && offset == 0 && stride == 1)
     {
-
         // if the node is compact, we can write directly from its data ptr
-        if(dt.is_compact())
+        // otherwise, we need to compact our data first
+        Node n_compact;
+        const void *data_ptr = node.data_ptr();
+        if(!dt.is_compact())
         {
-            // write data
-            h5_status = H5Dwrite(hdf5_dset_id,
-                                 h5_dtype_id,
-                                 H5S_ALL,
-                                 H5S_ALL,
-                                 H5P_DEFAULT,
-                                 node.data_ptr());
+            node.compact_to(n_compact);
+            data_ptr = n_compact.data_ptr();
+        }
+
+        // compressed chunks can be filtered on threads
+        index_t num_threads = HDF5Options(opts, ref_path).num_compression_threads();
+        if(write_hdf5_dataset_chunks(hdf5_dset_id,
+                                     h5_dtype_id,
+                                     (hsize_t) dt.number_of_elements(),
+                                     data_ptr,
+                                     num_threads,
+                                     ref_path))
+        {
+            h5_status = 0;
         }
         else
         {
-            // otherwise, we need to compact our data first
-            Node n;
-            node.compact_to(n);
+            // write data
             h5_status = H5Dwrite(hdf5_dset_id,
                                  h5_dtype_id,
                                  H5S_ALL,
                                  H5S_ALL,
                                  H5P_DEFAULT,
-                                 n.data_ptr());
+                                 data_ptr);
         }
     }
 
@@ -1597,7 +2639,7 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
         if (dataset_max_dims[0] != H5S_UNLIMITED)
         {
 
-            if (!HDF5Options::chunking_enabled)
+            if (!HDF5Options(opts, ref_path).chunking_enabled)
             {
                 CONDUIT_ERROR("Chunking must be enabled to create an "
                     << "extendible array.");
@@ -1641,9 +2683,14 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
             // and not reclaimed)
             hdf5_remove_path(hdf5_id, hdf5_dset_path);
 
-            // create new extendible dset
+            // create new extendible dset (with the same storage options)
             Node opts_create;
+            opts_create.set(opts);
             opts_create["offset"] = 0;
+            if(opts_create.has_child("stride"))
+            {
+                opts_create.remove("stride");
+            }
             write_conduit_leaf_to_hdf5_group(dset_to_node,
                                              ref_path,
                                              hdf5_dset_parent_id,
@@ -1690,27 +2737,42 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
                 strides, node_size, NULL);
 
         // if the node is compact, we can write directly from its data ptr
-        if(dt.is_compact())
+        // otherwise, we need to compact our data first
+        Node n_compact;
+        const void *data_ptr = node.data_ptr();
+        if(!dt.is_compact())
         {
-            // write data
-            h5_status = H5Dwrite(hdf5_dset_id,
-                                 h5_dtype_id,
-                                 nodespace,
-                                 dataspace,
-                                 H5P_DEFAULT,
-                                 node.data_ptr());
+            node.compact_to(n_compact);
+            data_ptr = n_compact.data_ptr();
+        }
+
+        // when the node covers the whole dataset, compressed chunks can
+        // be filtered on threads
+        bool chunks_written = false;
+        if(offset == 0 && stride == 1)
+        {
+            index_t num_threads = HDF5Options(opts, ref_path).num_compression_threads();
+            chunks_written = write_hdf5_dataset_chunks(hdf5_dset_id,
+                                                       h5_dtype_id,
+                                                       node_size[0],
+                                                       data_ptr,
+                                                       num_threads,
+                                                       ref_path);
+        }
+
+        if(chunks_written)
+        {
+            h5_status = 0;
         }
         else
         {
-            // otherwise, we need to compact our data first
-            Node n;
-            node.compact_to(n);
+            // write data
             h5_status = H5Dwrite(hdf5_dset_id,
                                  h5_dtype_id,
                                  nodespace,
                                  dataspace,
                                  H5P_DEFAULT,
-                                 n.data_ptr());
+                                 data_ptr);
         }
 
         H5Dclose(nodespace);
@@ -1791,11 +2853,14 @@ write_conduit_leaf_to_hdf5_group(const Node &node,
         {
             extendible = true;
         }
+        // storage options for this dataset's path
+        HDF5Options h5_opts(opts, join_ref_paths(ref_path, hdf5_dset_name));
         h5_child_id = create_hdf5_dataset_for_conduit_leaf(node.dtype(),
                                                            ref_path,
                                                            hdf5_group_id,
                                                            hdf5_dset_name,
-                                                           extendible);
+                                                           extendible,
+                                                           h5_opts);
 
         CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_id,
                                                         hdf5_group_id,
@@ -1900,33 +2965,275 @@ setup_hdf5_group_atts_for_conduit_node(const Node &node,
 }
 
 
-//---------------------------------------------------------------------------//
-// assume this is called only if we know the hdf5 state is compatible
 //---------------------------------------------------------------------------//
 void
-write_conduit_node_children_to_hdf5_group(const Node &node,
-                                          const std::string &ref_path,
-                                          hid_t hdf5_group_id,
-                                          const Node &opts)
+write_conduit_leaves_to_hdf5_packed_dataset(const Node &node,
+                                            const std::string &ref_path,
+                                            hid_t hdf5_group_id,
+                                            const Node &opts,
+                                            Node &packed_leaves)
 {
-    // make sure our special atts are setup correctly
-    setup_hdf5_group_atts_for_conduit_node(node,
-                                           ref_path,
-                                           hdf5_group_id);
+    packed_leaves.reset();
 
-    NodeConstIterator itr = node.children();
+    // writes with an offset update part of existing datasets
+    if(!node.dtype().is_object() ||
+       opts.has_child("offset") || opts.has_child("stride"))
+    {
+        return;
+    }
 
-    // call on each child with expanded path
-    while(itr.has_next())
+    bool packing_enabled = HDF5Options(opts, ref_path).packing_enabled;
+    bool has_packed_dset = H5Lexists(hdf5_group_id,
+                                     conduit_hdf5_packed_dset_name.c_str(),
+                                     H5P_DEFAULT) > 0;
+
+    if(!packing_enabled && !has_packed_dset)
+    {
+        return;
+    }
+
+    NodeConstIterator itr = node.children();
+    while(packing_enabled && itr.has_next())
     {
         const Node &child = itr.next();
-        DataType dt = child.dtype();
+        const DataType &dt = child.dtype();
         std::string child_name = itr.name();
 
-        if(dt.is_number() || dt. is_string())
+        if( !(dt.is_number() || dt.is_string()) ||
+            dt.number_of_elements() == 0 )
         {
-            write_conduit_leaf_to_hdf5_group(child,
-                                             ref_path,
+            continue;
+        }
+
+        HDF5Options h5_opts(opts, join_ref_paths(ref_path, child_name));
+        if(h5_opts.packing_enabled &&
+           dt.bytes_compact() <= h5_opts.packing_threshold)
+        {
+            child.compact_to(packed_leaves[child_name]);
+        }
+    }
+
+    // packing one leaf doesn't save a dataset
+    if(!has_packed_dset && packed_leaves.number_of_children() < 2)
+    {
+        packed_leaves.reset();
+        return;
+    }
+
+    // merge with the leaves packed by earlier writes, children that are
+    // now written as their own objects replace them
+    Node packed;
+    if(has_packed_dset)
+    {
+        hid_t h5_dset_id = H5Dopen(hdf5_group_id,
+                                   conduit_hdf5_packed_dset_name.c_str(),
+                                   H5P_DEFAULT);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                       "Failed to open HDF5 packed Dataset");
+        read_hdf5_packed_dataset(h5_dset_id, ref_path, packed);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                        hdf5_group_id,
+                                                        ref_path,
+                                       "Failed to close HDF5 packed Dataset");
+    }
+
+    bool modified = packed_leaves.number_of_children() > 0;
+    itr = node.children();
+    while(itr.has_next())
+    {
+        itr.next();
+        std::string child_name = itr.name();
+        if(packed.has_child(child_name))
+        {
+            packed.remove(child_name);
+            modified = true;
+        }
+    }
+
+    if(!modified)
+    {
+        return;
+    }
+
+    itr = packed_leaves.children();
+    while(itr.has_next())
+    {
+        const Node &leaf = itr.next();
+        packed[itr.name()].set(leaf);
+    }
+
+    Node n_compact;
+    packed.compact_to(n_compact);
+    std::string schema_json = n_compact.schema().to_json();
+
+    // the schema must fit in an attribute (64 kb, minus header space)
+    if(schema_json.size() > 60000)
+    {
+        if(has_packed_dset)
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Cannot pack " << packed.number_of_children()
+                               << " leaves into one HDF5 Dataset, reduce "
+                               << "the \"packing/threshold\" option");
+        }
+        packed_leaves.reset();
+        return;
+    }
+
+    // replace the old packed dataset, and any datasets of the packed leaves
+    // (space is made inaccessible, lost, and not reclaimed)
+    if(has_packed_dset)
+    {
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                    H5Ldelete(hdf5_group_id,
+                                        conduit_hdf5_packed_dset_name.c_str(),
+                                        H5P_DEFAULT),
+                                    hdf5_group_id,
+                                    ref_path,
+                                    "Failed to remove HDF5 packed Dataset");
+    }
+
+    itr = packed_leaves.children();
+    while(itr.has_next())
+    {
+        itr.next();
+        std::string child_name = itr.name();
+        if(H5Lexists(hdf5_group_id, child_name.c_str(), H5P_DEFAULT) > 0)
+        {
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                    H5Ldelete(hdf5_group_id,
+                                              child_name.c_str(),
+                                              H5P_DEFAULT),
+                                    hdf5_group_id,
+                                    join_ref_paths(ref_path, child_name),
+                                    "Failed to remove HDF5 Dataset");
+        }
+    }
+
+    // all earlier packed leaves were replaced
+    if(packed.number_of_children() == 0)
+    {
+        return;
+    }
+
+    std::vector<uint8> bytes;
+    n_compact.serialize(bytes);
+    Node n_bytes;
+    n_bytes.set_external(DataType::uint8((index_t)bytes.size()), &bytes[0]);
+
+    write_conduit_leaf_to_hdf5_group(n_bytes,
+                                     ref_path,
+                                     hdf5_group_id,
+                                     conduit_hdf5_packed_dset_name,
+                                     opts);
+
+    hid_t h5_dset_id = H5Dopen(hdf5_group_id,
+                               conduit_hdf5_packed_dset_name.c_str(),
+                               H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                       "Failed to open HDF5 packed Dataset");
+
+    // version and schema attributes
+    hid_t h5_dspace_id = H5Screate(H5S_SCALAR);
+
+    hid_t h5_attr_id = H5Acreate(h5_dset_id,
+                                 conduit_hdf5_packed_version_attr_name.c_str(),
+                                 H5T_NATIVE_INT,
+                                 h5_dspace_id,
+                                 H5P_DEFAULT,
+                                 H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Attribute "
+                                           << conduit_hdf5_packed_version_attr_name);
+    herr_t h5_status = H5Awrite(h5_attr_id,
+                                H5T_NATIVE_INT,
+                                &conduit_hdf5_packed_version);
+    H5Aclose(h5_attr_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to write HDF5 Attribute "
+                                           << conduit_hdf5_packed_version_attr_name);
+
+    hid_t h5_str_dtype_id = H5Tcopy(H5T_C_S1);
+    H5Tset_size(h5_str_dtype_id, schema_json.size() + 1);
+
+    h5_attr_id = H5Acreate(h5_dset_id,
+                           conduit_hdf5_packed_schema_attr_name.c_str(),
+                           h5_str_dtype_id,
+                           h5_dspace_id,
+                           H5P_DEFAULT,
+                           H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Attribute "
+                                           << conduit_hdf5_packed_schema_attr_name);
+    h5_status = H5Awrite(h5_attr_id,
+                         h5_str_dtype_id,
+                         schema_json.c_str());
+    H5Aclose(h5_attr_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                           "Failed to write HDF5 Attribute "
+                                           << conduit_hdf5_packed_schema_attr_name);
+
+    H5Tclose(h5_str_dtype_id);
+    H5Sclose(h5_dspace_id);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                    hdf5_group_id,
+                                                    ref_path,
+                                       "Failed to close HDF5 packed Dataset");
+}
+
+//---------------------------------------------------------------------------//
+// assume this is called only if we know the hdf5 state is compatible
+//---------------------------------------------------------------------------//
+void
+write_conduit_node_children_to_hdf5_group(const Node &node,
+                                          const std::string &ref_path,
+                                          hid_t hdf5_group_id,
+                                          const Node &opts)
+{
+    // make sure our special atts are setup correctly
+    setup_hdf5_group_atts_for_conduit_node(node,
+                                           ref_path,
+                                           hdf5_group_id);
+
+    // small leaves may be packed into one dataset ("packing" option)
+    Node packed_leaves;
+    write_conduit_leaves_to_hdf5_packed_dataset(node,
+                                                ref_path,
+                                                hdf5_group_id,
+                                                opts,
+                                                packed_leaves);
+
+    NodeConstIterator itr = node.children();
+
+    // call on each child with expanded path
+    while(itr.has_next())
+    {
+        const Node &child = itr.next();
+        DataType dt = child.dtype();
+        std::string child_name = itr.name();
+
+        if(packed_leaves.has_child(child_name))
+        {
+            continue;
+        }
+
+        if(dt.is_number() || dt. is_string())
+        {
+            write_conduit_leaf_to_hdf5_group(child,
+                                             ref_path,
                                              hdf5_group_id,
                                              child_name.c_str(),
                                              opts);
@@ -1986,7 +3293,8 @@ write_conduit_node_children_to_hdf5_group(const Node &node,
 
             // traverse
             write_conduit_node_children_to_hdf5_group(child,
-                                                      ref_path,
+                                                      join_ref_paths(ref_path,
+                                                                     child_name),
                                                       h5_child_id,
                                                       opts);
 
@@ -2190,6 +3498,9 @@ struct h5_read_opdata
 
     // whether to only get metadata
     bool             metadata_only;
+
+    // error raised while reading a child, rethrown once H5Literate returns
+    std::exception_ptr error;
 };
 
 //---------------------------------------------------------------------------//
@@ -2316,10 +3627,9 @@ h5l_iterate_traverse_op_func_get_child(Node &node,
 //  circular path in the file.
 //---------------------------------------------------------------------------//
 herr_t
-h5l_iterate_traverse_op_func(hid_t hdf5_id,
-                             const char *hdf5_path,
-                             const H5L_info_t *,// hdf5_info -- unused
-                             void *hdf5_operator_data)
+h5l_iterate_traverse_child(hid_t hdf5_id,
+                           const char *hdf5_path,
+                           void *hdf5_operator_data)
 {
     herr_t h5_status = 0;
     herr_t h5_return_val = 0;
@@ -2334,18 +3644,9 @@ h5l_iterate_traverse_op_func(hid_t hdf5_id,
      * the Library.
      */
 
-#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
-    h5_status = H5Oget_info_by_name(hdf5_id,
-                                    hdf5_path,
-                                    &h5_info_buf,
-                                    H5O_INFO_ALL,
-                                    H5P_DEFAULT);
-#else
-    h5_status = H5Oget_info_by_name(hdf5_id,
-                                    hdf5_path,
-                                    &h5_info_buf,
-                                    H5P_DEFAULT);
-#endif
+    h5_status = hdf5_basic_obj_info_by_name(hdf5_id,
+                                            hdf5_path,
+                                            &h5_info_buf);
 
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
                                                     hdf5_id,
@@ -2425,6 +3726,34 @@ h5l_iterate_traverse_op_func(hid_t hdf5_id,
         }
         case H5O_TYPE_DATASET:
         {
+            // packed leaves are children of this group
+            if(conduit_hdf5_packed_dset_name == hdf5_path &&
+               h5_od->node->dtype().is_object())
+            {
+                hid_t h5_dset_id = H5Dopen(hdf5_id,
+                                           hdf5_path,
+                                           H5P_DEFAULT);
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                                hdf5_id,
+                                                                h5_od->ref_path,
+                                               "Error opening HDF5 packed "
+                                               << " Dataset: "
+                                               << " parent: "
+                                               << hdf5_id);
+                read_hdf5_packed_dataset_into_conduit_node(h5_dset_id,
+                                                           h5_od->ref_path,
+                                                           h5_od->metadata_only,
+                                                           *h5_od->opts,
+                                                           *h5_od->node);
+                CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                                hdf5_id,
+                                                                h5_od->ref_path,
+                                               "Error closing HDF5 "
+                                               << " Dataset: "
+                                               << h5_dset_id);
+                break;
+            }
+
             Node *chld_node_ptr = h5l_iterate_traverse_op_func_get_child(
                                                    *h5_od->node,
                                                    std::string(hdf5_path));
@@ -2467,6 +3796,33 @@ h5l_iterate_traverse_op_func(hid_t hdf5_id,
     return h5_return_val;
 }
 
+//---------------------------------------------------------------------------//
+// Exceptions must not unwind through H5Literate: thread safe hdf5 builds
+// would keep their api lock, and hang any other thread using hdf5. Errors
+// are kept in the operator data and rethrown after H5Literate returns.
+//---------------------------------------------------------------------------//
+herr_t
+h5l_iterate_traverse_op_func(hid_t hdf5_id,
+                             const char *hdf5_path,
+                             const H5L_info_t *,// hdf5_info -- unused
+                             void *hdf5_operator_data)
+{
+    HDF5CallbackScope callback_scope;
+    try
+    {
+        return h5l_iterate_traverse_child(hdf5_id,
+                                          hdf5_path,
+                                          hdf5_operator_data);
+    }
+    catch(...)
+    {
+        struct h5_read_opdata *h5_od = (struct h5_read_opdata*)hdf5_operator_data;
+        h5_od->error = std::current_exception();
+    }
+    // stop the iteration
+    return -1;
+}
+
 
 //---------------------------------------------------------------------------//
 void
@@ -2478,14 +3834,8 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
 {
     // get info, we need to get the obj addr for cycle tracking
     H5O_info_t h5_info_buf;
-#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
-    herr_t h5_status = H5Oget_info(hdf5_group_id,
-                                   &h5_info_buf,
-                                   H5O_INFO_ALL);
-#else
-    herr_t h5_status = H5Oget_info(hdf5_group_id,
-                                   &h5_info_buf);
-#endif 
+    herr_t h5_status = hdf5_basic_obj_info(hdf5_group_id,
+                                           &h5_info_buf);
 
     // Check if this is a list or an object case
     if(check_if_hdf5_group_has_conduit_list_attribute(hdf5_group_id,
@@ -2568,6 +3918,11 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                            h5l_iterate_traverse_op_func,
                            (void *) &h5_od);
 
+    if(h5_od.error)
+    {
+        std::rethrow_exception(h5_od.error);
+    }
+
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
                                                     hdf5_group_id,
                                                     ref_path,
@@ -2578,91 +3933,472 @@ read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
 }
 
 //---------------------------------------------------------------------------//
-void
-read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
-                                    const std::string &ref_path,
-                                    bool only_get_metadata,
-                                    const Node &opts,
-                                    Node &dest)
+// returns the selection options for the dataset at ref_path: the last
+// entry of opts["selections"] whose path matches ref_path, or opts itself
+//---------------------------------------------------------------------------//
+const Node &
+hdf5_read_selection_options(const Node &opts,
+                            const std::string &ref_path)
 {
-    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
-                                                    hdf5_dset_id,
-                                                    ref_path,
-                                           "Error reading HDF5 Dataspace: "
-                                           << hdf5_dset_id);
-
-    // check for empty case
-    if(H5Sget_simple_extent_type(h5_dspace_id) == H5S_NULL)
+    const Node *res = &opts;
+    if(opts.has_child("selections"))
     {
-        // change to empty
-        dest.reset();
+        NodeConstIterator itr = opts["selections"].children();
+        while(itr.has_next())
+        {
+            const Node &sel = itr.next();
+            if(sel.has_child("path") &&
+               hdf5_options_path_matches(sel["path"].as_string(), ref_path))
+            {
+                res = &sel;
+            }
+        }
     }
-    else
-    {
-        hid_t h5_dtype_id  = H5Dget_type(hdf5_dset_id);
-
-        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
-                                                        hdf5_dset_id,
-                                                        ref_path,
-                                               "Error reading HDF5 Datatype: "
-                                               << hdf5_dset_id);
+    return *res;
+}
 
-        hid_t h5_status    = 0;
+//---------------------------------------------------------------------------//
+// makes opts["selections"] paths relative to the hdf5 path a read starts
+// from, to match the ref paths of the datasets below it. res is only used
+// (and the result only differs from opts) when there are selections.
+//---------------------------------------------------------------------------//
+const Node &
+hdf5_read_options_for_path(const Node &opts,
+                           const std::string &hdf5_path,
+                           Node &res)
+{
+    if(!opts.has_child("selections"))
+    {
+        return opts;
+    }
 
-        index_t nelems     = H5Sget_simple_extent_npoints(h5_dspace_id);
+    size_t pos = hdf5_path.find_first_not_of('/');
+    size_t end = hdf5_path.find_last_not_of('/');
+    if(pos == std::string::npos)
+    {
+        return opts;
+    }
+    std::string prefix = hdf5_path.substr(pos, end - pos + 1);
 
-        hsize_t offset = 0;
-        if(opts.has_child("offset"))
+    res.set(opts);
+    NodeIterator itr = res["selections"].children();
+    while(itr.has_next())
+    {
+        Node &sel = itr.next();
+        if(sel.has_child("path"))
         {
-            offset = opts["offset"].to_value();
+            std::string sel_path = sel["path"].as_string();
+            size_t sel_pos = sel_path.find_first_not_of('/');
+            sel_path = sel_pos == std::string::npos ? std::string()
+                                                    : sel_path.substr(sel_pos);
+            sel["path"] = join_ref_paths(prefix, sel_path);
         }
+    }
+    return res;
+}
 
-        hsize_t stride = 1;
-        if(opts.has_child("stride"))
-        {
-            stride = opts["stride"].to_value();
-        }
+//---------------------------------------------------------------------------//
+// applies a "hyperslab" or "points" selection to a dataset's dataspace,
+// and returns the number of selected elements
+//
+//  hyperslab: offset, stride and size, each with one value per dimension
+//             (defaults: 0, 1, and the rest of the dimension)
+//  points:    the coordinates of each point (one value per dimension per
+//             point), in the order the values are read
+//---------------------------------------------------------------------------//
+hsize_t
+select_hdf5_dataspace_elements(hid_t h5_dspace_id,
+                               const Node &sel,
+                               const std::string &ref_path)
+{
+    int rank = H5Sget_simple_extent_ndims(h5_dspace_id);
+    if(rank < 1)
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Cannot select elements of a HDF5 Dataset "
+                           "without dimensions");
+    }
+    std::vector<hsize_t> dims((size_t)rank);
+    H5Sget_simple_extent_dims(h5_dspace_id, &dims[0], NULL);
 
-        if (stride == 0)
+    herr_t h5_status = 0;
+    hsize_t res = 0;
+
+    if(sel.has_child("points"))
+    {
+        index_t_accessor coords = sel["points"].as_index_t_accessor();
+        index_t ncoords = coords.number_of_elements();
+        if(ncoords < 1 || ncoords % rank != 0)
         {
             CONDUIT_HDF5_ERROR(ref_path,
                                "Error reading HDF5 Dataset with options:"
-                               << opts.to_yaml() <<
-                               "`stride` must be greater than zero.");
+                               << sel.to_yaml()
+                               << "`points` must hold " << rank
+                               << " coordinates for each point.");
         }
 
-        // get the number of elements in the dataset given the offset and stride
-        hsize_t nelems_from_offset = (nelems - offset) / stride;
-        if ((nelems - offset) % stride != 0)
+        std::vector<hsize_t> h5_coords((size_t)ncoords);
+        for(index_t i = 0; i < ncoords; i++)
         {
-            nelems_from_offset++;
+            index_t coord = coords[i];
+            if(coord < 0 || (hsize_t)coord >= dims[i % rank])
+            {
+                CONDUIT_HDF5_ERROR(ref_path,
+                                   "Error reading HDF5 Dataset with options:"
+                                   << sel.to_yaml()
+                                   << "point coordinate " << coord
+                                   << " is outside of dimension " << i % rank
+                                   << " (extent " << dims[i % rank] << ")");
+            }
+            h5_coords[i] = (hsize_t)coord;
         }
 
-        hsize_t nelems_to_read = nelems_from_offset;
-        if(opts.has_child("size"))
+        res = (hsize_t)(ncoords / rank);
+        h5_status = H5Sselect_elements(h5_dspace_id,
+                                       H5S_SELECT_SET,
+                                       (size_t)res,
+                                       &h5_coords[0]);
+    }
+    else
+    {
+        const Node &slab = sel["hyperslab"];
+        std::vector<hsize_t> offsets(dims.size(), 0);
+        std::vector<hsize_t> strides(dims.size(), 1);
+        std::vector<hsize_t> sizes(dims.size(), 0);
+
+        const char *keys[3] = {"offset", "stride", "size"};
+        std::vector<hsize_t> *vals[3] = {&offsets, &strides, &sizes};
+        for(int k = 0; k < 3; k++)
         {
-            nelems_to_read = opts["size"].to_value();
-            if (nelems_to_read < 1)
+            if(!slab.has_child(keys[k]))
+            {
+                continue;
+            }
+            index_t_accessor acc = slab[keys[k]].as_index_t_accessor();
+            if(acc.number_of_elements() != (index_t)rank)
             {
                 CONDUIT_HDF5_ERROR(ref_path,
                                    "Error reading HDF5 Dataset with options:"
-                                   << opts.to_yaml() <<
-                                   "`size` must be greater than zero.");
+                                   << sel.to_yaml()
+                                   << "`hyperslab/" << keys[k] << "` must"
+                                   << " have one value for each of the "
+                                   << rank << " dimensions.");
+            }
+            for(int d = 0; d < rank; d++)
+            {
+                if(acc[d] < 0)
+                {
+                    CONDUIT_HDF5_ERROR(ref_path,
+                                       "Error reading HDF5 Dataset with "
+                                       "options:" << sel.to_yaml()
+                                       << "`hyperslab/" << keys[k] << "`"
+                                       << " values cannot be negative.");
+                }
+                (*vals[k])[d] = (hsize_t)acc[d];
             }
         }
 
-        // copy metadata to the node under hard-coded keys
-        if (only_get_metadata)
-        {
-            dest["num_elements"] = nelems_from_offset;
-        }
-        else
+        res = 1;
+        for(int d = 0; d < rank; d++)
         {
-            // Note: string case is handed properly in hdf5_dtype_to_conduit_dtype
-            DataType dt        = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
-                                                             nelems_to_read,
-                                                             ref_path);
+            if(strides[d] == 0 || offsets[d] >= dims[d])
+            {
+                CONDUIT_HDF5_ERROR(ref_path,
+                                   "Error reading HDF5 Dataset with options:"
+                                   << sel.to_yaml()
+                                   << "dimension " << d << " (extent "
+                                   << dims[d] << ") needs an offset less"
+                                   << " than its extent and a stride"
+                                   << " greater than zero.");
+            }
+
+            hsize_t avail = (dims[d] - offsets[d] - 1) / strides[d] + 1;
+            if(sizes[d] == 0)
+            {
+                sizes[d] = avail;
+            }
+            else if(sizes[d] > avail)
+            {
+                CONDUIT_HDF5_ERROR(ref_path,
+                                   "Error reading HDF5 Dataset with options:"
+                                   << sel.to_yaml()
+                                   << "dimension " << d << " (extent "
+                                   << dims[d] << ") holds " << avail
+                                   << " entries from the given offset and"
+                                   << " stride, " << sizes[d]
+                                   << " were requested.");
+            }
+            res *= sizes[d];
+        }
+
+        h5_status = H5Sselect_hyperslab(h5_dspace_id,
+                                        H5S_SELECT_SET,
+                                        &offsets[0],
+                                        &strides[0],
+                                        &sizes[0],
+                                        NULL);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                             "Error selecting elements of HDF5 Dataset: "
+                             << ref_path);
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// true when opts ask to read into the memory of the leaves already in
+// the destination node ("existing_layout: true")
+//---------------------------------------------------------------------------//
+bool
+hdf5_read_into_existing_layout(const Node &opts)
+{
+    return opts.has_child("existing_layout") &&
+           opts["existing_layout"].dtype().is_string() &&
+           opts["existing_layout"].as_string() == "true";
+}
+
+//---------------------------------------------------------------------------//
+// reads the selected values of a dataset straight into the memory of an
+// existing numeric leaf (which may be external and strided), hdf5 only
+// converts values when the leaf's type differs from the dataset's type
+//---------------------------------------------------------------------------//
+herr_t
+read_hdf5_dataset_into_existing_leaf(hid_t hdf5_dset_id,
+                                     hid_t h5_dtype_id,
+                                     const DataType &dset_dt,
+                                     hid_t h5_dspace_id,
+                                     index_t num_threads,
+                                     const std::string &ref_path,
+                                     Node &dest)
+{
+    const DataType &dest_dt = dest.dtype();
+    hsize_t num_eles  = (hsize_t) dset_dt.number_of_elements();
+    hsize_t ele_bytes = (hsize_t) dest_dt.element_bytes();
+
+    if(dest_dt.number_of_elements() != dset_dt.number_of_elements())
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Cannot read HDF5 Dataset into existing layout:"
+                           << " the leaf holds "
+                           << dest_dt.number_of_elements()
+                           << " elements, the read selects "
+                           << num_eles);
+    }
+
+    if(num_eles == 0)
+    {
+        return 0;
+    }
+
+    bool same_type = dest_dt.id() == dset_dt.id() &&
+                     dest_dt.element_bytes() == dset_dt.element_bytes() &&
+                     dest_dt.endianness_matches_machine();
+
+    hid_t h5_mem_dtype_id = h5_dtype_id;
+    if(!same_type)
+    {
+        h5_mem_dtype_id = conduit_dtype_to_hdf5_dtype(
+                                        DataType(dest_dt.id(),
+                                                 1,
+                                                 0,
+                                                 dest_dt.element_bytes(),
+                                                 dest_dt.element_bytes(),
+                                                 dest_dt.endianness()),
+                                        ref_path);
+    }
+
+    herr_t h5_status = -1;
+    void *data_ptr = dest.element_ptr(0);
+
+    if(dest_dt.is_compact() || dest_dt.stride() % ele_bytes == 0)
+    {
+        // describe a strided leaf to hdf5 with a memory selection
+        hsize_t ele_stride = dest_dt.is_compact() ? 1 :
+                                (hsize_t) dest_dt.stride() / ele_bytes;
+        hsize_t mem_dims[1] = {(num_eles - 1) * ele_stride + 1};
+        hsize_t offsets[1]  = {0};
+        hsize_t strides[1]  = {ele_stride};
+        hsize_t counts[1]   = {num_eles};
+        hid_t h5_mspace_id = H5Screate_simple(1, mem_dims, NULL);
+        H5Sselect_hyperslab(h5_mspace_id,
+                            H5S_SELECT_SET,
+                            offsets,
+                            strides,
+                            counts,
+                            NULL);
+
+        if(same_type && ele_stride == 1 &&
+           read_hdf5_dataset_chunks(hdf5_dset_id,
+                                    h5_dtype_id,
+                                    num_threads,
+                                    ref_path,
+                                    data_ptr))
+        {
+            h5_status = 0;
+        }
+        else
+        {
+            h5_status = H5Dread(hdf5_dset_id,
+                                h5_mem_dtype_id,
+                                h5_mspace_id,
+                                h5_dspace_id,
+                                H5P_DEFAULT,
+                                data_ptr);
+        }
+        H5Sclose(h5_mspace_id);
+    }
+    else
+    {
+        // hdf5 can't describe strides that aren't a multiple of the
+        // element size, read compact values and copy them out
+        std::vector<uint8> vals((size_t) (num_eles * ele_bytes));
+        hsize_t mem_dims[1] = {num_eles};
+        hid_t h5_mspace_id = H5Screate_simple(1, mem_dims, NULL);
+        h5_status = H5Dread(hdf5_dset_id,
+                            h5_mem_dtype_id,
+                            h5_mspace_id,
+                            h5_dspace_id,
+                            H5P_DEFAULT,
+                            &vals[0]);
+        H5Sclose(h5_mspace_id);
+
+        for(hsize_t i = 0; i < num_eles; i++)
+        {
+            memcpy(dest.element_ptr((index_t) i),
+                   &vals[(size_t) (i * ele_bytes)],
+                   (size_t) ele_bytes);
+        }
+    }
+
+    if(!same_type)
+    {
+        conduit_dtype_to_hdf5_dtype_cleanup(h5_mem_dtype_id);
+    }
+
+    return h5_status;
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
+                                    const std::string &ref_path,
+                                    bool only_get_metadata,
+                                    const Node &opts,
+                                    Node &dest)
+{
+    conduit::relay::io::StatsTimer stats_timer("hdf5",
+                                               only_get_metadata ?
+                                                   "dataset_read_info" :
+                                                   "dataset_read");
+
+    hid_t h5_dspace_id = H5Dget_space(hdf5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Error reading HDF5 Dataspace: "
+                                           << hdf5_dset_id);
+
+    // check for empty case
+    if(H5Sget_simple_extent_type(h5_dspace_id) == H5S_NULL)
+    {
+        // change to empty
+        dest.reset();
+    }
+    else
+    {
+        hid_t h5_dtype_id  = H5Dget_type(hdf5_dset_id);
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dtype_id,
+                                                        hdf5_dset_id,
+                                                        ref_path,
+                                               "Error reading HDF5 Datatype: "
+                                               << hdf5_dset_id);
+
+        hid_t h5_status    = 0;
+
+        index_t nelems     = H5Sget_simple_extent_npoints(h5_dspace_id);
+
+        // selection for this dataset, from opts or opts["selections"]
+        const Node &sel = hdf5_read_selection_options(opts, ref_path);
+
+        // n-d "hyperslab" and "points" selections are applied to a
+        // dataspace up front, the 1d offset, stride and size options
+        // are handled below
+        bool nd_sel = sel.has_child("hyperslab") || sel.has_child("points");
+        hid_t h5_sel_dspace_id = -1;
+        hsize_t nelems_selected = 0;
+        if(nd_sel)
+        {
+            h5_sel_dspace_id = H5Dget_space(hdf5_dset_id);
+            nelems_selected = select_hdf5_dataspace_elements(h5_sel_dspace_id,
+                                                             sel,
+                                                             ref_path);
+        }
+
+        hsize_t offset = 0;
+        if(sel.has_child("offset"))
+        {
+            offset = sel["offset"].to_value();
+        }
+
+        hsize_t stride = 1;
+        if(sel.has_child("stride"))
+        {
+            stride = sel["stride"].to_value();
+        }
+
+        if (stride == 0)
+        {
+            CONDUIT_HDF5_ERROR(ref_path,
+                               "Error reading HDF5 Dataset with options:"
+                               << sel.to_yaml() <<
+                               "`stride` must be greater than zero.");
+        }
+
+        // get the number of elements in the dataset given the offset and stride
+        hsize_t nelems_from_offset = (nelems - offset) / stride;
+        if ((nelems - offset) % stride != 0)
+        {
+            nelems_from_offset++;
+        }
+
+        hsize_t nelems_to_read = nelems_from_offset;
+        if(sel.has_child("size"))
+        {
+            nelems_to_read = sel["size"].to_value();
+            if (nelems_to_read < 1)
+            {
+                CONDUIT_HDF5_ERROR(ref_path,
+                                   "Error reading HDF5 Dataset with options:"
+                                   << sel.to_yaml() <<
+                                   "`size` must be greater than zero.");
+            }
+        }
+
+        if(nd_sel)
+        {
+            offset = 0;
+            stride = 1;
+            nelems_from_offset = nelems_selected;
+            nelems_to_read = nelems_selected;
+        }
+
+        // copy metadata to the node under hard-coded keys
+        if (only_get_metadata)
+        {
+            dest["num_elements"] = nelems_from_offset;
+
+            if(nd_sel)
+            {
+                H5Sclose(h5_sel_dspace_id);
+            }
+        }
+        else
+        {
+            // Note: string case is handed properly in hdf5_dtype_to_conduit_dtype
+            DataType dt        = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
+                                                             nelems_to_read,
+                                                             ref_path);
 
             // if the endianness of the dset in the file doesn't
             // match the current machine we always want to convert it
@@ -2707,11 +4443,25 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
             hsize_t offsets[1] = {offset};
             hsize_t strides[1] = {stride};
             hid_t nodespace = H5Screate_simple(1,node_size,NULL);
-            hid_t dataspace = H5Dget_space(hdf5_dset_id);
+            hid_t dataspace = h5_sel_dspace_id;
 
-            // select hyperslab
-            H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offsets,
-                strides, node_size, NULL);
+            if(!nd_sel)
+            {
+                dataspace = H5Dget_space(hdf5_dset_id);
+                // select hyperslab
+                H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offsets,
+                    strides, node_size, NULL);
+            }
+
+            // compressed chunks of a whole dataset can be
+            // unfiltered on threads
+            index_t num_threads = 1;
+            if(!nd_sel &&
+               offset == 0 && stride == 1 &&
+               nelems_to_read == (hsize_t) nelems)
+            {
+                num_threads = HDF5Options(opts, ref_path).num_compression_threads();
+            }
 
             // check for string special case, H5T_VARIABLE string
             if( H5Tis_variable_str(h5_dtype_id) )
@@ -2741,39 +4491,66 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                    << " greater than the number of entries in"
                                    << " the HDF5 dataset (" << nelems << ")");
             }
-            else if(dest.dtype().is_compact() &&
-               dest.dtype().compatible(dt) )
+            // existing numeric leaves keep their memory (and type)
+            else if(hdf5_read_into_existing_layout(opts) &&
+                    dest.dtype().is_number() && dt.is_number())
             {
-                // we can read directly from hdf5 dataset if compact
-                // & compatible
-                h5_status = H5Dread(hdf5_dset_id,
-                                    h5_dtype_id,
-                                    nodespace,
-                                    dataspace,
-                                    H5P_DEFAULT,
-                                    dest.data_ptr());
+                h5_status = read_hdf5_dataset_into_existing_leaf(
+                                                        hdf5_dset_id,
+                                                        h5_dtype_id,
+                                                        dt,
+                                                        dataspace,
+                                                        num_threads,
+                                                        ref_path,
+                                                        dest);
             }
             else
             {
-                // we create a temp Node b/c we want read to work for
-                // strided data
+                // we can read directly from hdf5 dataset if compact
+                // & compatible
+                //
+                // otherwise we create a temp Node b/c we want read to work
+                // for strided data
                 //
                 // the hdf5 data will always be compact, source node we are
                 // reading will not unless it's already compatible and compact.
-                Node n_tmp(dt);
-                h5_status = H5Dread(hdf5_dset_id,
-                                    h5_dtype_id,
-                                    nodespace,
-                                    dataspace,
-                                    H5P_DEFAULT,
-                                    n_tmp.data_ptr());
+                bool read_into_dest = dest.dtype().is_compact() &&
+                                      dest.dtype().compatible(dt);
+                Node n_tmp;
+                if(!read_into_dest)
+                {
+                    n_tmp.set(dt);
+                }
+                void *data_ptr = read_into_dest ? dest.data_ptr()
+                                                : n_tmp.data_ptr();
+
+                if(read_hdf5_dataset_chunks(hdf5_dset_id,
+                                            h5_dtype_id,
+                                            num_threads,
+                                            ref_path,
+                                            data_ptr))
+                {
+                    h5_status = 0;
+                }
+                else
+                {
+                    h5_status = H5Dread(hdf5_dset_id,
+                                        h5_dtype_id,
+                                        nodespace,
+                                        dataspace,
+                                        H5P_DEFAULT,
+                                        data_ptr);
+                }
 
-                // copy out to our dest
-                dest.set(n_tmp);
+                if(!read_into_dest)
+                {
+                    // copy out to our dest
+                    dest.set(n_tmp);
+                }
             }
 
-            H5Dclose(nodespace);
-            H5Dclose(dataspace);
+            H5Sclose(nodespace);
+            H5Sclose(dataspace);
         }
 
         if(opts.dtype().is_empty())
@@ -2811,37 +4588,222 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                            "Error closing HDF5 Dataspace: "
                                            << h5_dspace_id);
 
+    if(!only_get_metadata && conduit::relay::io::stats_enabled())
+    {
+        stats_timer.set_bytes(dest.dtype().bytes_compact());
+    }
 }
 
 //---------------------------------------------------------------------------//
 void
-read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
-                                 const std::string &ref_path,
-                                 bool only_get_metadata,
-                                 const Node &opts,
-                                 Node &dest)
+read_hdf5_packed_dataset(hid_t hdf5_dset_id,
+                         const std::string &ref_path,
+                         Node &packed)
 {
-    H5O_info_t h5_info_buf;
-
-#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
-    herr_t h5_status = H5Oget_info(hdf5_id,&h5_info_buf,H5O_INFO_ALL);
-#else
-    herr_t h5_status = H5Oget_info(hdf5_id,&h5_info_buf);
-#endif 
+    // layout version
+    int version = -1;
+    hid_t h5_attr_id = H5Aopen(hdf5_dset_id,
+                               conduit_hdf5_packed_version_attr_name.c_str(),
+                               H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to open HDF5 Attribute "
+                                           << conduit_hdf5_packed_version_attr_name);
+    herr_t h5_status = H5Aread(h5_attr_id, H5T_NATIVE_INT, &version);
+    H5Aclose(h5_attr_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to read HDF5 Attribute "
+                                           << conduit_hdf5_packed_version_attr_name);
 
+    if(version != conduit_hdf5_packed_version)
+    {
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Unsupported packed leaves version: " << version
+                           << " (supported: "
+                           << conduit_hdf5_packed_version << ")");
+    }
 
+    // schema of the packed leaves
+    h5_attr_id = H5Aopen(hdf5_dset_id,
+                         conduit_hdf5_packed_schema_attr_name.c_str(),
+                         H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to open HDF5 Attribute "
+                                           << conduit_hdf5_packed_schema_attr_name);
+    hid_t h5_str_dtype_id = H5Aget_type(h5_attr_id);
+    std::vector<char> schema_json(H5Tget_size(h5_str_dtype_id) + 1, 0);
+    h5_status = H5Aread(h5_attr_id, h5_str_dtype_id, &schema_json[0]);
+    H5Tclose(h5_str_dtype_id);
+    H5Aclose(h5_attr_id);
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
-                                                    hdf5_id,
+                                                    hdf5_dset_id,
                                                     ref_path,
-                                           "Error fetching HDF5 object "
-                                           << "info from: "
-                                           << hdf5_id);
+                                           "Failed to read HDF5 Attribute "
+                                           << conduit_hdf5_packed_schema_attr_name);
 
-    switch (h5_info_buf.type)
+    std::string schema_str(&schema_json[0]);
+    Schema schema(schema_str);
+
+    Node n_bytes, opts_read;
+    read_hdf5_dataset_into_conduit_node(hdf5_dset_id,
+                                        ref_path,
+                                        false,
+                                        opts_read,
+                                        n_bytes);
+
+    if(n_bytes.dtype().number_of_elements() != schema.total_bytes_compact())
     {
-        // if hdf5_id + hdf5_path points to a group,
-        // use a H5Literate traversal
-        case H5O_TYPE_GROUP:
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "Packed leaves dataset holds "
+                           << n_bytes.dtype().number_of_elements()
+                           << " bytes, its schema describes "
+                           << schema.total_bytes_compact());
+    }
+
+    Node n_packed(schema, n_bytes.data_ptr(), true);
+    packed.set(n_packed);
+}
+
+//---------------------------------------------------------------------------//
+bool
+read_hdf5_group_packed_leaves(hid_t hdf5_id,
+                              const std::string &hdf5_path,
+                              Node &packed)
+{
+    std::string dset_path = conduit_hdf5_packed_dset_name;
+    if(!hdf5_path.empty())
+    {
+        dset_path = hdf5_path + "/" + dset_path;
+    }
+
+    if(H5Lexists(hdf5_id, dset_path.c_str(), H5P_DEFAULT) <= 0)
+    {
+        return false;
+    }
+
+    hid_t h5_dset_id = H5Dopen(hdf5_id, dset_path.c_str(), H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                    hdf5_id,
+                                                    hdf5_path,
+                                       "Failed to open HDF5 packed Dataset");
+    read_hdf5_packed_dataset(h5_dset_id, hdf5_path, packed);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                    hdf5_id,
+                                                    hdf5_path,
+                                       "Failed to close HDF5 packed Dataset");
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+bool
+read_hdf5_packed_leaf(hid_t hdf5_id,
+                      const std::string &hdf5_path,
+                      Node &leaf)
+{
+    std::string leaf_name;
+    std::string group_path;
+    conduit::utils::rsplit_path(hdf5_path, leaf_name, group_path);
+
+    Node packed;
+    if(leaf_name.empty() ||
+       !read_hdf5_group_packed_leaves(hdf5_id, group_path, packed) ||
+       !packed.has_child(leaf_name))
+    {
+        return false;
+    }
+
+    leaf.set(packed[leaf_name]);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// sets dest from a packed leaf, honoring the "existing_layout" option
+//---------------------------------------------------------------------------//
+void
+read_hdf5_packed_leaf_into_conduit_node(const Node &leaf,
+                                        bool only_get_metadata,
+                                        const Node &opts,
+                                        Node &dest)
+{
+    const DataType &dt = leaf.dtype();
+
+    if(only_get_metadata)
+    {
+        dest["num_elements"] = dt.number_of_elements();
+    }
+    else if(hdf5_read_into_existing_layout(opts) &&
+            dest.dtype().is_number() && dt.is_number() &&
+            dest.dtype().number_of_elements() == dt.number_of_elements())
+    {
+        // convert to the leaf's type, then copy into its memory
+        Node n_vals;
+        leaf.to_data_type(dest.dtype().id(), n_vals);
+        index_t ele_bytes = dest.dtype().element_bytes();
+        for(index_t i = 0; i < dt.number_of_elements(); i++)
+        {
+            memcpy(dest.element_ptr(i),
+                   n_vals.element_ptr(i),
+                   (size_t) ele_bytes);
+        }
+    }
+    else
+    {
+        dest.set(leaf);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_packed_dataset_into_conduit_node(hid_t hdf5_dset_id,
+                                           const std::string &ref_path,
+                                           bool only_get_metadata,
+                                           const Node &opts,
+                                           Node &dest)
+{
+    Node packed;
+    read_hdf5_packed_dataset(hdf5_dset_id, ref_path, packed);
+
+    NodeConstIterator itr = packed.children();
+    while(itr.has_next())
+    {
+        const Node &leaf = itr.next();
+        read_hdf5_packed_leaf_into_conduit_node(leaf,
+                                                only_get_metadata,
+                                                opts,
+                                                dest[itr.name()]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
+                                 const std::string &ref_path,
+                                 bool only_get_metadata,
+                                 const Node &opts,
+                                 Node &dest)
+{
+    H5O_info_t h5_info_buf;
+
+    herr_t h5_status = hdf5_basic_obj_info(hdf5_id,&h5_info_buf);
+
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    ref_path,
+                                           "Error fetching HDF5 object "
+                                           << "info from: "
+                                           << hdf5_id);
+
+    switch (h5_info_buf.type)
+    {
+        // if hdf5_id + hdf5_path points to a group,
+        // use a H5Literate traversal
+        case H5O_TYPE_GROUP:
         {
             read_hdf5_group_into_conduit_node(hdf5_id,
                                               ref_path,
@@ -2914,7 +4876,8 @@ read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
 
 //---------------------------------------------------------------------------//
 hid_t
-create_hdf5_file_access_plist()
+create_hdf5_file_access_plist(const HDF5Options &h5_opts,
+                              bool use_page_buffer)
 {
     // create property list and set use latest lib ver settings
     hid_t h5_fa_props = H5Pcreate(H5P_FILE_ACCESS);
@@ -2950,12 +4913,62 @@ create_hdf5_file_access_plist()
                                  << "property list " << h5_fa_props);
 
     }
+
+    // a larger metadata cache keeps the headers of many small objects
+    // (groups, attributes and compact datasets) in memory
+    if(h5_opts.metadata_cache_size > 0)
+    {
+        H5AC_cache_config_t mdc_config;
+        mdc_config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+        h5_status = H5Pget_mdc_config(h5_fa_props, &mdc_config);
+
+        CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                 "Failed to get metadata cache config of "
+                                 << "property list " << h5_fa_props);
+
+        size_t mdc_size = (size_t) h5_opts.metadata_cache_size;
+        mdc_config.set_initial_size = true;
+        mdc_config.initial_size = mdc_size;
+        mdc_config.min_size = std::min(mdc_config.min_size, mdc_size);
+        mdc_config.max_size = std::max(mdc_config.max_size, mdc_size);
+
+        h5_status = H5Pset_mdc_config(h5_fa_props, &mdc_config);
+
+        CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                 "Failed to set metadata cache config of "
+                                 << "property list " << h5_fa_props);
+    }
+
+#if H5_VERSION_GE(1, 10, 1)
+    // the page buffer reads and writes whole file space pages, so the
+    // metadata of many objects moves with one i/o call. hdf5 only allows
+    // it for files created with paged file space.
+    if(use_page_buffer && h5_opts.page_buffer_size > 0)
+    {
+        h5_status = H5Pset_page_buffer_size(h5_fa_props,
+                                            (size_t) h5_opts.page_buffer_size,
+                                            0,
+                                            0);
+
+        CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                 "Failed to set page buffer size of "
+                                 << "property list " << h5_fa_props);
+    }
+#endif
+
     return h5_fa_props;
 }
 
 //---------------------------------------------------------------------------//
 hid_t
-create_hdf5_file_create_plist()
+create_hdf5_file_access_plist()
+{
+    return create_hdf5_file_access_plist(HDF5Options(), false);
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+create_hdf5_file_create_plist(const HDF5Options &h5_opts)
 {
     // create property list and set it to preserve creation order
     hid_t h5_fc_props = H5Pcreate(H5P_FILE_CREATE);
@@ -2970,9 +4983,72 @@ create_hdf5_file_create_plist()
     CONDUIT_CHECK_HDF5_ERROR(h5_status,
                              "Failed to set creation order options for "
                              << "property list " << h5_fc_props);
+
+#if H5_VERSION_GE(1, 10, 1)
+    // paged aggregation places metadata and raw data in separate pages
+    if(h5_opts.paged_file_space_enabled)
+    {
+        h5_status = H5Pset_file_space_strategy(h5_fc_props,
+                                               H5F_FSPACE_STRATEGY_PAGE,
+                                               0,
+                                               1);
+
+        CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                 "Failed to set file space strategy of "
+                                 << "property list " << h5_fc_props);
+
+        h5_status = H5Pset_file_space_page_size(h5_fc_props,
+                                         (hsize_t) h5_opts.file_space_page_size);
+
+        CONDUIT_CHECK_HDF5_ERROR(h5_status,
+                                 "Failed to set file space page size of "
+                                 << "property list " << h5_fc_props);
+    }
+#endif
+
     return h5_fc_props;
 }
 
+//---------------------------------------------------------------------------//
+hid_t
+create_hdf5_file_create_plist()
+{
+    return create_hdf5_file_create_plist(HDF5Options());
+}
+
+//---------------------------------------------------------------------------//
+// opens an existing file, using a page buffer when one is requested and
+// the file has paged file space
+hid_t
+open_hdf5_file(const std::string &file_path,
+               unsigned int flags,
+               const HDF5Options &h5_opts)
+{
+    conduit::relay::io::StatsTimer stats_timer("hdf5", "file_open");
+
+    hid_t h5_file_id = -1;
+
+    if(h5_opts.page_buffer_size > 0)
+    {
+        hid_t h5_fa_plist = create_hdf5_file_access_plist(h5_opts, true);
+        h5_file_id = H5Fopen(file_path.c_str(), flags, h5_fa_plist);
+        H5Pclose(h5_fa_plist);
+    }
+
+    // no page buffer requested or the file isn't paged
+    if(h5_file_id < 0)
+    {
+        hid_t h5_fa_plist = create_hdf5_file_access_plist(h5_opts, false);
+        h5_file_id = H5Fopen(file_path.c_str(), flags, h5_fa_plist);
+
+        CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
+                                 "Failed to close HDF5 H5P_FILE_ACCESS "
+                                 << "property list: " << h5_fa_plist);
+    }
+
+    return h5_file_id;
+}
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
@@ -2985,11 +5061,26 @@ create_hdf5_file_create_plist()
 hid_t
 hdf5_create_file(const std::string &file_path)
 {
+    HDF5Lock hdf5_lock;
+    Node opts;
+    return hdf5_create_file(file_path, opts);
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+hdf5_create_file(const std::string &file_path,
+                 const Node &opts)
+{
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
-    hid_t h5_fc_plist = create_hdf5_file_create_plist();
-    hid_t h5_fa_plist = create_hdf5_file_access_plist();
+    conduit::relay::io::StatsTimer stats_timer("hdf5", "file_open");
+
+    HDF5Options h5_opts(opts, "");
+    hid_t h5_fc_plist = create_hdf5_file_create_plist(h5_opts);
+    hid_t h5_fa_plist = create_hdf5_file_access_plist(h5_opts,
+                                          h5_opts.paged_file_space_enabled);
 
     // open the hdf5 file for writing
     hid_t h5_file_id = H5Fcreate(file_path.c_str(),
@@ -3018,11 +5109,23 @@ hdf5_create_file(const std::string &file_path)
 void
 hdf5_close_file(hid_t hdf5_id)
 {
+    HDF5Lock hdf5_lock;
+    conduit::relay::io::StatsTimer stats_timer("hdf5", "file_close");
+
     // close the hdf5 file
     CONDUIT_CHECK_HDF5_ERROR(H5Fclose(hdf5_id),
                              "Error closing HDF5 file handle: " << hdf5_id);
 }
 
+//---------------------------------------------------------------------------//
+void
+hdf5_flush_file(hid_t hdf5_id)
+{
+    HDF5Lock hdf5_lock;
+    CONDUIT_CHECK_HDF5_ERROR(H5Fflush(hdf5_id, H5F_SCOPE_LOCAL),
+                             "Error flushing HDF5 file handle: " << hdf5_id);
+}
+
 
 
 //---------------------------------------------------------------------------//
@@ -3031,6 +5134,7 @@ hdf5_write(const Node &node,
            hid_t hdf5_id,
            const std::string &hdf5_path)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,hdf5_id,hdf5_path,opts);
 }
@@ -3044,6 +5148,7 @@ hdf5_write(const Node &node,
            const std::string &hdf5_path,
            const Node &opts)
 {
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3099,11 +5204,15 @@ hdf5_write(const Node &node,
 
     std::string incompat_details;
     // check compat
-    if(check_if_conduit_node_is_compatible_with_hdf5_tree(n,
-                                                          "",
-                                                          hdf5_id,
-                                                          opts,
-                                                          incompat_details))
+    conduit::relay::io::StatsTimer check_timer("hdf5", "compatibility_check");
+    bool compat = check_if_conduit_node_is_compatible_with_hdf5_tree(n,
+                                                                     "",
+                                                                     hdf5_id,
+                                                                     opts,
+                                                                     incompat_details);
+    check_timer.finish();
+
+    if(compat)
     {
         // write if we are compat
         write_conduit_node_to_hdf5_tree(n,"",hdf5_id,opts);
@@ -3132,6 +5241,7 @@ void
 hdf5_write(const Node &node,
            hid_t hdf5_id)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,hdf5_id,opts);
 }
@@ -3144,6 +5254,7 @@ hdf5_write(const Node &node,
            hid_t &hdf5_id,
            const Node &opts)
 {
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     // TODO: we may only need to use this in an outer level variant
     // of check_if_conduit_node_is_compatible_with_hdf5_tree
@@ -3152,11 +5263,15 @@ hdf5_write(const Node &node,
     std::string incompat_details;
 
     // check compat
-    if(check_if_conduit_node_is_compatible_with_hdf5_tree(node,
-                                                          "",
-                                                          hdf5_id,
-                                                          opts,
-                                                          incompat_details))
+    conduit::relay::io::StatsTimer check_timer("hdf5", "compatibility_check");
+    bool compat = check_if_conduit_node_is_compatible_with_hdf5_tree(node,
+                                                                     "",
+                                                                     hdf5_id,
+                                                                     opts,
+                                                                     incompat_details);
+    check_timer.finish();
+
+    if(compat)
     {
         // write if we are compat
         write_conduit_node_to_hdf5_tree(node,
@@ -3184,6 +5299,7 @@ void
 hdf5_save(const Node &node,
           const std::string &path)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,path,opts,false);
 }
@@ -3195,6 +5311,7 @@ hdf5_save(const Node &node,
           const std::string &path,
           const Node &opts)
 {
+    HDF5Lock hdf5_lock;
     hdf5_write(node,path,opts,false);
 }
 
@@ -3204,6 +5321,7 @@ hdf5_save(const Node &node,
           const std::string &file_path,
           const std::string &hdf5_path)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,file_path,hdf5_path,opts,false);
 }
@@ -3216,6 +5334,7 @@ hdf5_save(const Node &node,
           const std::string &hdf5_path,
           const Node &opts)
 {
+    HDF5Lock hdf5_lock;
     hdf5_write(node,file_path,hdf5_path,opts,false);
 }
 
@@ -3225,6 +5344,7 @@ void
 hdf5_append(const Node &node,
             const std::string &path)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,path,opts,true);
 }
@@ -3236,6 +5356,7 @@ hdf5_append(const Node &node,
             const std::string &path,
             const Node &opts)
 {
+    HDF5Lock hdf5_lock;
     hdf5_write(node,path,opts,true);
 }
 
@@ -3245,6 +5366,7 @@ hdf5_append(const Node &node,
             const std::string &file_path,
             const std::string &hdf5_path)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,file_path,hdf5_path,opts,true);
 }
@@ -3256,6 +5378,7 @@ hdf5_append(const Node &node,
             const std::string &hdf5_path,
             const Node &opts)
 {
+    HDF5Lock hdf5_lock;
     hdf5_write(node,file_path,hdf5_path,opts,true);
 }
 
@@ -3266,6 +5389,7 @@ hdf5_write(const  Node &node,
            const std::string &path,
            bool append)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,path,opts,append);
 }
@@ -3278,6 +5402,7 @@ hdf5_write(const  Node &node,
            const Node &opts,
            bool append)
 {
+    HDF5Lock hdf5_lock;
     // check for ":" split
     std::string file_path;
     std::string hdf5_path;
@@ -3309,6 +5434,7 @@ hdf5_write(const Node &node,
            const std::string &hdf5_path,
            bool append)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_write(node,file_path,hdf5_path,opts,append);
 }
@@ -3322,6 +5448,7 @@ hdf5_write(const Node &node,
            const Node &opts,
            bool append)
 {
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3329,12 +5456,12 @@ hdf5_write(const Node &node,
     if(append && utils::is_file(file_path))
     {
         // open existing hdf5 file for read + write
-        h5_file_id = hdf5_open_file_for_read_write(file_path);
+        h5_file_id = hdf5_open_file_for_read_write(file_path, opts);
     }
     else // trunc
     {
         // open the hdf5 file for writing
-        h5_file_id = hdf5_create_file(file_path);
+        h5_file_id = hdf5_create_file(file_path, opts);
     }
 
     hdf5_write(node,
@@ -3343,6 +5470,7 @@ hdf5_write(const Node &node,
                opts);
 
     // close the hdf5 file
+    conduit::relay::io::StatsTimer close_timer("hdf5", "file_close");
     CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
                              "Error closing HDF5 file: " << file_path);
 
@@ -3363,24 +5491,29 @@ hdf5_write(const Node &node,
 hid_t
 hdf5_open_file_for_read(const std::string &file_path)
 {
+    HDF5Lock hdf5_lock;
+    Node opts;
+    return hdf5_open_file_for_read(file_path, opts);
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+hdf5_open_file_for_read(const std::string &file_path,
+                        const Node &opts)
+{
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
-    hid_t h5_fa_plist = create_hdf5_file_access_plist();
-
     // open the hdf5 file for reading
-    hid_t h5_file_id = H5Fopen(file_path.c_str(),
-                               H5F_ACC_RDONLY,
-                               h5_fa_plist);
+    hid_t h5_file_id = open_hdf5_file(file_path,
+                                      H5F_ACC_RDONLY,
+                                      HDF5Options(opts, ""));
 
     CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
                              "Error opening HDF5 file for read only access: "
                               << file_path);
 
-    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
-                             "Failed to close HDF5 H5P_FILE_ACCESS "
-                             << "property list: " << h5_fa_plist);
-
     return h5_file_id;
 
     // restore hdf5 error stack
@@ -3390,24 +5523,29 @@ hdf5_open_file_for_read(const std::string &file_path)
 hid_t
 hdf5_open_file_for_read_write(const std::string &file_path)
 {
+    HDF5Lock hdf5_lock;
+    Node opts;
+    return hdf5_open_file_for_read_write(file_path, opts);
+}
+
+//---------------------------------------------------------------------------//
+hid_t
+hdf5_open_file_for_read_write(const std::string &file_path,
+                              const Node &opts)
+{
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
-    hid_t h5_fa_plist = create_hdf5_file_access_plist();
-
     // open the hdf5 file for read + write
-    hid_t h5_file_id = H5Fopen(file_path.c_str(),
-                               H5F_ACC_RDWR,
-                               h5_fa_plist);
+    hid_t h5_file_id = open_hdf5_file(file_path,
+                                      H5F_ACC_RDWR,
+                                      HDF5Options(opts, ""));
 
     CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
                              "Error opening HDF5 file for read + write access: "
                               << file_path);
 
-    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_fa_plist),
-                             "Failed to close HDF5 H5P_FILE_ACCESS "
-                             << "property list: " << h5_fa_plist);
-
     return h5_file_id;
 
     // restore hdf5 error stack
@@ -3420,6 +5558,7 @@ hdf5_read(hid_t hdf5_id,
           const std::string &hdf5_path,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read(hdf5_id,hdf5_path,opts,dest);
 }
@@ -3431,6 +5570,7 @@ hdf5_read(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3439,16 +5579,32 @@ hdf5_read(hid_t hdf5_id,
                                   hdf5_path.c_str(),
                                   H5P_DEFAULT);
 
+    // the path may name a packed leaf
+    Node packed_leaf;
+    if(h5_child_obj < 0 &&
+       read_hdf5_packed_leaf(hdf5_id, hdf5_path, packed_leaf))
+    {
+        read_hdf5_packed_leaf_into_conduit_node(packed_leaf,
+                                                false,
+                                                opts,
+                                                dest);
+        return;
+    }
+
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_child_obj,
                                                     hdf5_id,
                                                     hdf5_path,
                             "Failed to fetch HDF5 object from: "
                              << hdf5_id << ":" << hdf5_path);
 
+    // selections are given relative to hdf5_path
+    Node path_opts;
     read_hdf5_tree_into_conduit_node(h5_child_obj,
                                      hdf5_path,
                                      false,
-                                     opts,
+                                     hdf5_read_options_for_path(opts,
+                                                                hdf5_path,
+                                                                path_opts),
                                      dest);
 
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
@@ -3466,6 +5622,7 @@ hdf5_read(const std::string &file_path,
           const std::string &hdf5_path,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read(file_path,hdf5_path,opts,node);
 }
@@ -3477,10 +5634,11 @@ hdf5_read(const std::string &file_path,
           const Node &opts,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     // note: hdf5 error stack is suppressed in these calls
 
     // open the hdf5 file for reading
-    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path, opts);
 
     hdf5_read(h5_file_id,
               hdf5_path,
@@ -3488,6 +5646,7 @@ hdf5_read(const std::string &file_path,
               node);
 
     // close the hdf5 file
+    conduit::relay::io::StatsTimer close_timer("hdf5", "file_close");
     CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
                              "Error closing HDF5 file: " << file_path);
 }
@@ -3497,6 +5656,7 @@ void
 hdf5_read(const std::string &path,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read(path,opts,node);
 }
@@ -3507,6 +5667,7 @@ hdf5_read(const std::string &path,
           const Node &opts,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     // check for ":" split
     std::string file_path;
     std::string hdf5_path;
@@ -3535,6 +5696,7 @@ void
 hdf5_read(hid_t hdf5_id,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read(hdf5_id,opts,dest);
 }
@@ -3546,6 +5708,7 @@ hdf5_read(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3565,6 +5728,7 @@ hdf5_read_info(hid_t hdf5_id,
           const std::string &hdf5_path,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read_info(hdf5_id,hdf5_path,opts,dest);
 }
@@ -3576,6 +5740,7 @@ hdf5_read_info(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3590,10 +5755,14 @@ hdf5_read_info(hid_t hdf5_id,
                             "Failed to fetch HDF5 object from: "
                              << hdf5_id << ":" << hdf5_path);
 
+    // selections are given relative to hdf5_path
+    Node path_opts;
     read_hdf5_tree_into_conduit_node(h5_child_obj,
                                      hdf5_path,
                                      true,
-                                     opts,
+                                     hdf5_read_options_for_path(opts,
+                                                                hdf5_path,
+                                                                path_opts),
                                      dest);
 
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
@@ -3611,6 +5780,7 @@ hdf5_read_info(const std::string &file_path,
           const std::string &hdf5_path,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read_info(file_path,hdf5_path,opts,node);
 }
@@ -3622,10 +5792,11 @@ hdf5_read_info(const std::string &file_path,
           const Node &opts,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     // note: hdf5 error stack is suppressed in these calls
 
     // open the hdf5 file for reading
-    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path, opts);
 
     hdf5_read_info(h5_file_id,
               hdf5_path,
@@ -3633,6 +5804,7 @@ hdf5_read_info(const std::string &file_path,
               node);
 
     // close the hdf5 file
+    conduit::relay::io::StatsTimer close_timer("hdf5", "file_close");
     CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
                              "Error closing HDF5 file: " << file_path);
 }
@@ -3642,6 +5814,7 @@ void
 hdf5_read_info(const std::string &path,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read_info(path,opts,node);
 }
@@ -3652,6 +5825,7 @@ hdf5_read_info(const std::string &path,
           const Node &opts,
           Node &node)
 {
+    HDF5Lock hdf5_lock;
     // check for ":" split
     std::string file_path;
     std::string hdf5_path;
@@ -3680,6 +5854,7 @@ void
 hdf5_read_info(hid_t hdf5_id,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     Node opts;
     hdf5_read_info(hdf5_id,opts,dest);
 }
@@ -3691,6 +5866,7 @@ hdf5_read_info(hid_t hdf5_id,
           const Node &opts,
           Node &dest)
 {
+    HDF5Lock hdf5_lock;
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -3705,97 +5881,530 @@ hdf5_read_info(hid_t hdf5_id,
 
 
 //---------------------------------------------------------------------------//
-bool
-hdf5_has_path(hid_t hdf5_id,
-              const std::string &hdf5_path)
-{
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-
-    int res = H5Lexists(hdf5_id,hdf5_path.c_str(),H5P_DEFAULT);
-
-
-    // H5Lexists returns:
-    //  a positive value if the link exists.
-    //
-    //  0 if it doesn't exist
-    //
-    //  a negative # in some cases when it doesn't exist, and in some cases
-    //    where there is an error.
-    // For our cases, we treat 0 and negative as does not exist.
-
-    return (res > 0);
-    // restore hdf5 error stack
-}
+// hdf5_read_structure helpers
+//---------------------------------------------------------------------------//
 
 //---------------------------------------------------------------------------//
-void
-hdf5_remove_path(hid_t hdf5_id,
-                 const std::string &hdf5_path)
+// Operator data for h5l_read_structure_op_func, one per group listed.
+//---------------------------------------------------------------------------//
+struct h5_structure_opdata
 {
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-
-    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Ldelete(hdf5_id,
-                                                              hdf5_path.c_str(),
-                                                              H5P_DEFAULT),
-                                                    hdf5_id,
-                                                    hdf5_path,
-                             "Error deleting HDF5 path: "
-                              << hdf5_id << ":" << hdf5_path);
+    // path of the group being listed, for error messages
+    std::string                 group_path;
+    // depth of the group's children (the listing root's children are 1)
+    index_t                     depth;
+    // <= 0 means no limit
+    index_t                     max_depth;
+    // node that receives the group's children
+    Node                       *node;
+    // keys of the groups from the listing root down to this group
+    std::vector<std::string>   *ancestors;
+    // error raised while listing a child, rethrown once H5Literate returns
+    std::exception_ptr          error;
+};
 
-    // restore hdf5 error stack
+//---------------------------------------------------------------------------//
+// key that identifies an hdf5 object in its file (its token or address)
+//---------------------------------------------------------------------------//
+std::string
+h5_structure_obj_key(const H5O_info_t &h5_info)
+{
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+    return std::string((const char*)&h5_info.token, sizeof(H5O_token_t));
+#else
+    return std::string((const char*)&h5_info.addr, sizeof(haddr_t));
+#endif
 }
 
-
-
+void h5_read_structure_group(hid_t hdf5_id,
+                             const std::string &group_name,
+                             const std::string &group_path,
+                             index_t depth,
+                             index_t max_depth,
+                             std::vector<std::string> &ancestors,
+                             Node &dest);
 
 //---------------------------------------------------------------------------//
-bool
-is_hdf5_file(const std::string &file_path)
+herr_t
+h5l_read_structure_child(hid_t hdf5_id,
+                         const char *hdf5_name,
+                         const H5L_info_t *hdf5_info,
+                         h5_structure_opdata *h5_od)
 {
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
-
-    bool res = false;
-    // open the file for read to check if it is valid hdf5
-    //
-    // don't use H5F_ACC_RDWR, b/c if we already have a file handle open
-    // that is RDONLY, the open will fail
-    //
-    // use H5F_ACC_RDONLY b/c it will work with open file handles
-    hid_t h5_file_id = H5Fopen(file_path.c_str(),
-                               H5F_ACC_RDONLY,
-                               H5P_DEFAULT);
-
-    if( h5_file_id >= 0)
+    std::string chld_path = h5_od->group_path;
+    if(chld_path != std::string("/"))
     {
-        res = true;
-        H5Fclose(h5_file_id);
+        chld_path += std::string("/");
     }
+    chld_path += std::string(hdf5_name);
 
-    return res;
-    // restore hdf5 error stack
-}
+    Node &chld = h5_od->node->add_child(hdf5_name);
 
-//---------------------------------------------------------------------------//
-void hdf5_group_list_child_names(hid_t hdf5_id,
-                                 const std::string &hdf5_path,
-                                 std::vector<std::string> &res)
-{
-    // disable hdf5 error stack
-    HDF5ErrorStackSupressor supress_hdf5_errors;
+    if(hdf5_info->type == H5L_TYPE_SOFT ||
+       hdf5_info->type == H5L_TYPE_EXTERNAL)
+    {
+        // the link value holds the target, no need to follow it
+        std::vector<char> h5_link_val(hdf5_info->u.val_size + 1, 0);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                        H5Lget_val(hdf5_id,
+                                                   hdf5_name,
+                                                   &h5_link_val[0],
+                                                   hdf5_info->u.val_size,
+                                                   H5P_DEFAULT),
+                                        hdf5_id,
+                                        chld_path,
+                                        "Error fetching HDF5 link value: "
+                                        << chld_path);
 
-    res.clear();
-    // first, hdf5_id + path must be a group in order to have children
+        if(hdf5_info->type == H5L_TYPE_SOFT)
+        {
+            chld.set("soft link: " + std::string(&h5_link_val[0]));
+        }
+        else
+        {
+            const char *h5_file_name = NULL;
+            const char *h5_obj_path  = NULL;
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                        H5Lunpack_elink_val(&h5_link_val[0],
+                                                           hdf5_info->u.val_size,
+                                                           NULL,
+                                                           &h5_file_name,
+                                                           &h5_obj_path),
+                                        hdf5_id,
+                                        chld_path,
+                                        "Error unpacking HDF5 external link: "
+                                        << chld_path);
+            chld.set("external link: " + std::string(h5_file_name)
+                     + ":" + std::string(h5_obj_path));
+        }
+        return 0;
+    }
 
-    H5O_info_t h5_info_buf;
+    if(hdf5_info->type != H5L_TYPE_HARD)
+    {
+        chld.set("user defined link");
+        return 0;
+    }
 
+    H5O_info_t h5_info_buf;
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                    hdf5_basic_obj_info_by_name(hdf5_id,
+                                                                hdf5_name,
+                                                                &h5_info_buf),
+                                    hdf5_id,
+                                    chld_path,
+                                    "Error fetching HDF5 Object info: "
+                                    << chld_path);
 
-#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
-    herr_t h5_status = H5Oget_info_by_name(hdf5_id,
-                                           hdf5_path.c_str(),
-                                           &h5_info_buf,
+    switch (h5_info_buf.type)
+    {
+        case H5O_TYPE_GROUP:
+        {
+            std::string key = h5_structure_obj_key(h5_info_buf);
+            std::vector<std::string> &ancestors = *h5_od->ancestors;
+            if(std::find(ancestors.begin(), ancestors.end(), key)
+               != ancestors.end())
+            {
+                // skip cycles in the graph ...
+                chld.set("group (cycle)");
+            }
+            else if(h5_od->max_depth > 0 && h5_od->depth >= h5_od->max_depth)
+            {
+                chld.set("group");
+            }
+            else
+            {
+                ancestors.push_back(key);
+                h5_read_structure_group(hdf5_id,
+                                        hdf5_name,
+                                        chld_path,
+                                        h5_od->depth + 1,
+                                        h5_od->max_depth,
+                                        ancestors,
+                                        chld);
+                ancestors.pop_back();
+            }
+            break;
+        }
+        case H5O_TYPE_DATASET:
+        {
+            chld.set("dataset");
+            break;
+        }
+        case H5O_TYPE_NAMED_DATATYPE:
+        {
+            chld.set("datatype");
+            break;
+        }
+        default:
+        {
+            chld.set("unknown");
+        }
+    }
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+// Exceptions must not unwind through H5Literate, see
+// h5l_iterate_traverse_op_func.
+//---------------------------------------------------------------------------//
+herr_t
+h5l_read_structure_op_func(hid_t hdf5_id,
+                           const char *hdf5_name,
+                           const H5L_info_t *hdf5_info,
+                           void *hdf5_operator_data)
+{
+    HDF5CallbackScope callback_scope;
+    h5_structure_opdata *h5_od = (h5_structure_opdata*)hdf5_operator_data;
+    try
+    {
+        return h5l_read_structure_child(hdf5_id,
+                                        hdf5_name,
+                                        hdf5_info,
+                                        h5_od);
+    }
+    catch(...)
+    {
+        h5_od->error = std::current_exception();
+    }
+    // stop the iteration
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+// Lists the links in the group group_name (relative to hdf5_id) into dest,
+// by name order. The group is not opened, H5Literate_by_name finds it from
+// hdf5_id and passes it to the callback.
+//---------------------------------------------------------------------------//
+void
+h5_read_structure_group(hid_t hdf5_id,
+                        const std::string &group_name,
+                        const std::string &group_path,
+                        index_t depth,
+                        index_t max_depth,
+                        std::vector<std::string> &ancestors,
+                        Node &dest)
+{
+    dest.set(DataType::object());
+
+    h5_structure_opdata h5_od;
+    h5_od.group_path = group_path;
+    h5_od.depth      = depth;
+    h5_od.max_depth  = max_depth;
+    h5_od.node       = &dest;
+    h5_od.ancestors  = &ancestors;
+
+    herr_t h5_status = H5Literate_by_name(hdf5_id,
+                                          group_name.c_str(),
+                                          H5_INDEX_NAME,
+                                          H5_ITER_INC,
+                                          NULL,
+                                          h5l_read_structure_op_func,
+                                          (void *) &h5_od,
+                                          H5P_DEFAULT);
+
+    if(h5_od.error)
+    {
+        std::rethrow_exception(h5_od.error);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    group_path,
+                                           "Error calling H5Literate to "
+                                           << "list HDF5 group: "
+                                           << group_path);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_structure(hid_t hdf5_id,
+                    const std::string &hdf5_path,
+                    const Node &opts,
+                    Node &dest)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    index_t max_depth = 0;
+    if(opts.has_child("depth"))
+    {
+        max_depth = opts["depth"].to_index_t();
+    }
+
+    std::string path = hdf5_path.empty() ? std::string("/") : hdf5_path;
+
+    H5O_info_t h5_info_buf;
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                    hdf5_basic_obj_info_by_name(hdf5_id,
+                                                                path.c_str(),
+                                                                &h5_info_buf),
+                                    hdf5_id,
+                                    path,
+                                    "Failed to fetch HDF5 object from: "
+                                    << hdf5_id << ":" << path);
+
+    dest.reset();
+    if(h5_info_buf.type == H5O_TYPE_GROUP)
+    {
+        std::vector<std::string> ancestors;
+        ancestors.push_back(h5_structure_obj_key(h5_info_buf));
+        h5_read_structure_group(hdf5_id,
+                                path,
+                                path,
+                                1,
+                                max_depth,
+                                ancestors,
+                                dest);
+    }
+    else if(h5_info_buf.type == H5O_TYPE_DATASET)
+    {
+        dest.set("dataset");
+    }
+    else
+    {
+        dest.set("datatype");
+    }
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_structure(hid_t hdf5_id,
+                    const std::string &hdf5_path,
+                    Node &dest)
+{
+    HDF5Lock hdf5_lock;
+    Node opts;
+    hdf5_read_structure(hdf5_id,hdf5_path,opts,dest);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_structure(const std::string &path,
+                    const Node &opts,
+                    Node &dest)
+{
+    HDF5Lock hdf5_lock;
+    // check for ":" split
+    std::string file_path;
+    std::string hdf5_path;
+
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    hdf5_path);
+
+    // note: hdf5 error stack is suppressed in these calls
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path, opts);
+
+    try
+    {
+        hdf5_read_structure(h5_file_id, hdf5_path, opts, dest);
+    }
+    catch(...)
+    {
+        H5Fclose(h5_file_id);
+        throw;
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
+                             "Error closing HDF5 file: " << file_path);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_structure(const std::string &path,
+                    Node &dest)
+{
+    HDF5Lock hdf5_lock;
+    Node opts;
+    hdf5_read_structure(path,opts,dest);
+}
+
+//---------------------------------------------------------------------------//
+bool
+hdf5_has_path(hid_t hdf5_id,
+              const std::string &hdf5_path)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    int res = H5Lexists(hdf5_id,hdf5_path.c_str(),H5P_DEFAULT);
+
+
+    // H5Lexists returns:
+    //  a positive value if the link exists.
+    //
+    //  0 if it doesn't exist
+    //
+    //  a negative # in some cases when it doesn't exist, and in some cases
+    //    where there is an error.
+    // For our cases, we treat 0 and negative as does not exist.
+
+    if(res <= 0)
+    {
+        // check for a packed leaf
+        Node packed_leaf;
+        return read_hdf5_packed_leaf(hdf5_id, hdf5_path, packed_leaf);
+    }
+
+    return true;
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_remove_path(hid_t hdf5_id,
+                 const std::string &hdf5_path)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Ldelete(hdf5_id,
+                                                              hdf5_path.c_str(),
+                                                              H5P_DEFAULT),
+                                                    hdf5_id,
+                                                    hdf5_path,
+                             "Error deleting HDF5 path: "
+                              << hdf5_id << ":" << hdf5_path);
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_create_link(hid_t hdf5_id,
+                 const std::string &target_path,
+                 const std::string &link_path)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    hid_t h5_lcpl_id = H5Pcreate(H5P_LINK_CREATE);
+    CONDUIT_CHECK_HDF5_ERROR(h5_lcpl_id,
+                             "Failed to create HDF5 link creation property list");
+
+    herr_t h5_status = H5Pset_create_intermediate_group(h5_lcpl_id, 1);
+    if(h5_status >= 0)
+    {
+        h5_status = H5Lcreate_soft(target_path.c_str(),
+                                   hdf5_id,
+                                   link_path.c_str(),
+                                   h5_lcpl_id,
+                                   H5P_DEFAULT);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_lcpl_id),
+                             "Failed to close HDF5 link creation property list");
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    link_path,
+                             "Error creating HDF5 link: "
+                              << hdf5_id << ":" << link_path
+                              << " -> " << target_path);
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_create_external_link(hid_t hdf5_id,
+                          const std::string &target_file_path,
+                          const std::string &target_path,
+                          const std::string &link_path)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    hid_t h5_lcpl_id = H5Pcreate(H5P_LINK_CREATE);
+    CONDUIT_CHECK_HDF5_ERROR(h5_lcpl_id,
+                             "Failed to create HDF5 link creation property list");
+
+    herr_t h5_status = H5Pset_create_intermediate_group(h5_lcpl_id, 1);
+    if(h5_status >= 0)
+    {
+        h5_status = H5Lcreate_external(target_file_path.c_str(),
+                                       target_path.c_str(),
+                                       hdf5_id,
+                                       link_path.c_str(),
+                                       h5_lcpl_id,
+                                       H5P_DEFAULT);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_lcpl_id),
+                             "Failed to close HDF5 link creation property list");
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_id,
+                                                    link_path,
+                             "Error creating HDF5 external link: "
+                              << hdf5_id << ":" << link_path
+                              << " -> " << target_file_path
+                              << ":" << target_path);
+
+    // restore hdf5 error stack
+}
+
+
+
+
+//---------------------------------------------------------------------------//
+bool
+is_hdf5_file(const std::string &file_path)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    bool res = false;
+    // open the file for read to check if it is valid hdf5
+    //
+    // don't use H5F_ACC_RDWR, b/c if we already have a file handle open
+    // that is RDONLY, the open will fail
+    //
+    // use H5F_ACC_RDONLY b/c it will work with open file handles
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDONLY,
+                               H5P_DEFAULT);
+
+    if( h5_file_id >= 0)
+    {
+        res = true;
+        H5Fclose(h5_file_id);
+    }
+
+    return res;
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void hdf5_group_list_child_names(hid_t hdf5_id,
+                                 const std::string &hdf5_path,
+                                 std::vector<std::string> &res)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    res.clear();
+    // first, hdf5_id + path must be a group in order to have children
+
+    H5O_info_t h5_info_buf;
+
+
+#if H5_VERSION_GE(1, 12, 0) && !defined(H5_USE_18_API)
+    herr_t h5_status = H5Oget_info_by_name(hdf5_id,
+                                           hdf5_path.c_str(),
+                                           &h5_info_buf,
                                            H5O_INFO_ALL,
                                            H5P_DEFAULT);
 #else
@@ -3895,7 +6504,22 @@ void hdf5_group_list_child_names(hid_t hdf5_id,
                                        name_size,
                                        H5P_DEFAULT);
 
-        res.push_back(std::string(name_buff_ptr));
+        // list the packed leaves instead of their dataset
+        if(conduit_hdf5_packed_dset_name == name_buff_ptr)
+        {
+            Node packed;
+            read_hdf5_group_packed_leaves(h5_group_id, "", packed);
+            NodeConstIterator itr = packed.children();
+            while(itr.has_next())
+            {
+                itr.next();
+                res.push_back(itr.name());
+            }
+        }
+        else
+        {
+            res.push_back(std::string(name_buff_ptr));
+        }
 
         if(name_buff_tmp)
         {
@@ -3916,6 +6540,7 @@ void hdf5_group_list_child_names(hid_t hdf5_id,
 void
 hdf5_identifier_report(Node &out)
 {
+    HDF5Lock hdf5_lock;
     hdf5_identifier_report(H5F_OBJ_ALL,out);
 }
 
@@ -3923,6 +6548,7 @@ hdf5_identifier_report(Node &out)
 void
 hdf5_identifier_report(hid_t hdf5_id, Node &out)
 {
+    HDF5Lock hdf5_lock;
     out.reset();
     int h5_num_objs = H5Fget_obj_count(hdf5_id, H5F_OBJ_ALL);
 
@@ -4059,6 +6685,1335 @@ hdf5_identifier_report(hid_t hdf5_id, Node &out)
 }
 
 
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Buffered appends (HDF5Appender)
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+class HDF5Appender::State
+{
+public:
+    // values waiting to be written to one dataset
+    struct Buffer
+    {
+        hid_t              dset_id;
+        DataType           dtype;     // one compact element
+        hsize_t            size;      // number of values written
+        hsize_t            extent;    // current dataset extent
+        std::vector<uint8> pending;
+    };
+
+     State();
+    ~State();
+
+    void append_leaf(const Node &node, const std::string &hdf5_path);
+    void flush_buffer(const std::string &hdf5_path, Buffer &buff);
+    void close();
+
+    hid_t   h5_id;
+    bool    owns_file;
+    Node    opts;
+    hsize_t buffer_size;
+    double  growth_factor;
+
+    std::map<std::string,Buffer> buffers;
+};
+
+//---------------------------------------------------------------------------//
+HDF5Appender::State::State()
+: h5_id(-1),
+  owns_file(false),
+  buffer_size(65536),
+  growth_factor(2.0)
+{}
+
+//---------------------------------------------------------------------------//
+HDF5Appender::State::~State()
+{}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::State::append_leaf(const Node &node,
+                                 const std::string &hdf5_path)
+{
+    const DataType &dt = node.dtype();
+
+    if(dt.is_empty())
+    {
+        return;
+    }
+
+    if(dt.is_string())
+    {
+        CONDUIT_ERROR("HDF5Appender cannot append string leaf: "
+                      << hdf5_path);
+    }
+
+    std::map<std::string,Buffer>::iterator itr = buffers.find(hdf5_path);
+
+    if(itr == buffers.end())
+    {
+        Buffer buff;
+        buff.dset_id = -1;
+        buff.dtype   = DataType(dt.id(),
+                                1,
+                                0,
+                                dt.element_bytes(),
+                                dt.element_bytes(),
+                                dt.endianness());
+        buff.size    = 0;
+        buff.extent  = 0;
+
+        // continue an existing dataset
+        if(hdf5_has_path(h5_id, hdf5_path))
+        {
+            buff.dset_id = H5Dopen(h5_id, hdf5_path.c_str(), H5P_DEFAULT);
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(buff.dset_id,
+                                                            h5_id,
+                                                            hdf5_path,
+                                    "HDF5Appender failed to open dataset");
+
+            hid_t h5_dtype_id = H5Dget_type(buff.dset_id);
+            DataType dset_dt = hdf5_dtype_to_conduit_dtype(h5_dtype_id,
+                                                           1,
+                                                           hdf5_path);
+            H5Tclose(h5_dtype_id);
+
+            hid_t h5_dspace_id = H5Dget_space(buff.dset_id);
+            int rank = H5Sget_simple_extent_ndims(h5_dspace_id);
+            hsize_t dims[1]     = {0};
+            hsize_t max_dims[1] = {0};
+            if(rank == 1)
+            {
+                H5Sget_simple_extent_dims(h5_dspace_id, dims, max_dims);
+            }
+            H5Sclose(h5_dspace_id);
+
+            if(rank != 1 || max_dims[0] != H5S_UNLIMITED ||
+               dset_dt.id() != dt.id())
+            {
+                H5Dclose(buff.dset_id);
+                CONDUIT_ERROR("HDF5Appender cannot append "
+                              << dt.name() << " values to "
+                              << "dataset: " << hdf5_path
+                              << " (" << dset_dt.name() << ")."
+                              << " Datasets must be one dimensional, "
+                              << "extendible and of the same type.");
+            }
+
+            buff.size   = dims[0];
+            buff.extent = dims[0];
+        }
+
+        itr = buffers.insert(std::make_pair(hdf5_path, buff)).first;
+    }
+
+    Buffer &buff = itr->second;
+
+    if(buff.dtype.id() != dt.id())
+    {
+        CONDUIT_ERROR("HDF5Appender cannot append " << dt.name()
+                      << " values to " << buff.dtype.name()
+                      << " dataset: " << hdf5_path);
+    }
+
+    index_t num_bytes = dt.number_of_elements() * dt.element_bytes();
+    size_t  start     = buff.pending.size();
+    buff.pending.resize(start + (size_t) num_bytes);
+
+    if(dt.is_compact())
+    {
+        memcpy(&buff.pending[start], node.data_ptr(), (size_t) num_bytes);
+    }
+    else
+    {
+        Node n_compact;
+        node.compact_to(n_compact);
+        memcpy(&buff.pending[start],
+               n_compact.data_ptr(),
+               (size_t) num_bytes);
+    }
+
+    if(buff.pending.size() >= buffer_size)
+    {
+        flush_buffer(hdf5_path, buff);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::State::flush_buffer(const std::string &hdf5_path,
+                                  Buffer &buff)
+{
+    if(buff.pending.empty())
+    {
+        return;
+    }
+
+    hsize_t num_vals = (hsize_t) (buff.pending.size() /
+                                  buff.dtype.element_bytes());
+
+    // first values: create an extendible dataset holding them
+    if(buff.dset_id < 0)
+    {
+        Node n_vals;
+        n_vals.set_external(DataType(buff.dtype.id(),
+                                     (index_t) num_vals,
+                                     0,
+                                     buff.dtype.element_bytes(),
+                                     buff.dtype.element_bytes(),
+                                     buff.dtype.endianness()),
+                            &buff.pending[0]);
+
+        // chunks no larger than one batch of appends
+        Node opts_create;
+        opts_create.set(opts);
+        opts_create["offset"] = 0;
+        int chunk_size = HDF5Options(opts, hdf5_path).chunk_size;
+        if((hsize_t) chunk_size > buffer_size)
+        {
+            chunk_size = (int) buffer_size;
+        }
+        opts_create["chunking/chunk_size"] = chunk_size;
+
+        hdf5_write(n_vals, h5_id, hdf5_path, opts_create);
+
+        buff.dset_id = H5Dopen(h5_id, hdf5_path.c_str(), H5P_DEFAULT);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(buff.dset_id,
+                                                        h5_id,
+                                                        hdf5_path,
+                                "HDF5Appender failed to open dataset");
+        buff.size   = num_vals;
+        buff.extent = num_vals;
+        buff.pending.clear();
+        return;
+    }
+
+    hsize_t new_size = buff.size + num_vals;
+
+    // over allocate, so most appends don't extend the dataset
+    if(new_size > buff.extent)
+    {
+        hsize_t new_extent = (hsize_t) (buff.extent * growth_factor);
+        if(new_extent < new_size)
+        {
+            new_extent = new_size;
+        }
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                    H5Dset_extent(buff.dset_id, &new_extent),
+                                    h5_id,
+                                    hdf5_path,
+                                    "HDF5Appender failed to extend dataset");
+        buff.extent = new_extent;
+    }
+
+    conduit::relay::io::StatsTimer stats_timer("hdf5",
+                                               "dataset_write",
+                                               (index_t) buff.pending.size());
+
+    hid_t h5_dspace_id = H5Dget_space(buff.dset_id);
+    hsize_t offsets[1] = {buff.size};
+    hsize_t counts[1]  = {num_vals};
+    H5Sselect_hyperslab(h5_dspace_id,
+                        H5S_SELECT_SET,
+                        offsets,
+                        NULL,
+                        counts,
+                        NULL);
+    hid_t h5_mspace_id = H5Screate_simple(1, counts, NULL);
+
+    hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(buff.dtype, hdf5_path);
+
+    herr_t h5_status = H5Dwrite(buff.dset_id,
+                                h5_dtype_id,
+                                h5_mspace_id,
+                                h5_dspace_id,
+                                H5P_DEFAULT,
+                                &buff.pending[0]);
+
+    conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
+    H5Sclose(h5_mspace_id);
+    H5Sclose(h5_dspace_id);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    h5_id,
+                                                    hdf5_path,
+                                "HDF5Appender failed to write values");
+    buff.size = new_size;
+    buff.pending.clear();
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::State::close()
+{
+    std::map<std::string,Buffer>::iterator itr;
+
+    // write remaining values, then trim the over allocation
+    for(itr = buffers.begin(); itr != buffers.end(); ++itr)
+    {
+        flush_buffer(itr->first, itr->second);
+    }
+
+    for(itr = buffers.begin(); itr != buffers.end(); ++itr)
+    {
+        Buffer &buff = itr->second;
+        if(buff.dset_id < 0)
+        {
+            continue;
+        }
+
+        if(buff.extent > buff.size)
+        {
+            CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                    H5Dset_extent(buff.dset_id, &buff.size),
+                                    h5_id,
+                                    itr->first,
+                                    "HDF5Appender failed to trim dataset");
+        }
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                    H5Dclose(buff.dset_id),
+                                    h5_id,
+                                    itr->first,
+                                    "HDF5Appender failed to close dataset");
+        buff.dset_id = -1;
+    }
+
+    buffers.clear();
+
+    if(owns_file)
+    {
+        hdf5_close_file(h5_id);
+    }
+
+    h5_id = -1;
+    owns_file = false;
+}
+
+//---------------------------------------------------------------------------//
+HDF5Appender::HDF5Appender()
+: m_state(new State())
+{}
+
+//---------------------------------------------------------------------------//
+HDF5Appender::~HDF5Appender()
+{
+    close();
+    delete m_state;
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::open(const std::string &file_path)
+{
+    HDF5Lock hdf5_lock;
+    Node opts;
+    open(file_path, opts);
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::open(const std::string &file_path,
+                   const Node &opts)
+{
+    HDF5Lock hdf5_lock;
+    hid_t h5_file_id = -1;
+    if(utils::is_file(file_path))
+    {
+        h5_file_id = hdf5_open_file_for_read_write(file_path, opts);
+    }
+    else
+    {
+        h5_file_id = hdf5_create_file(file_path, opts);
+    }
+
+    open(h5_file_id, opts);
+    m_state->owns_file = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::open(hid_t hdf5_id,
+                   const Node &opts)
+{
+    HDF5Lock hdf5_lock;
+    close();
+
+    m_state->opts.set(opts);
+    m_state->buffer_size   = 65536;
+    m_state->growth_factor = 2.0;
+
+    if(opts.has_path("append/buffer_size"))
+    {
+        m_state->buffer_size = (hsize_t) opts["append/buffer_size"].to_uint64();
+    }
+
+    if(opts.has_path("append/growth_factor"))
+    {
+        m_state->growth_factor = opts["append/growth_factor"].to_float64();
+        if(m_state->growth_factor < 1.0)
+        {
+            CONDUIT_ERROR("HDF5Appender append/growth_factor must be "
+                          "at least 1.0 (passed: "
+                          << m_state->growth_factor << ")");
+        }
+    }
+
+    m_state->h5_id = hdf5_id;
+    m_state->owns_file = false;
+}
+
+//---------------------------------------------------------------------------//
+bool
+HDF5Appender::is_open() const
+{
+    return m_state->h5_id >= 0;
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::append(const Node &node)
+{
+    HDF5Lock hdf5_lock;
+    append(node, "");
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::append(const Node &node,
+                     const std::string &path)
+{
+    HDF5Lock hdf5_lock;
+    if(!is_open())
+    {
+        CONDUIT_ERROR("HDF5Appender: cannot append, appender is not open");
+    }
+
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    if(node.dtype().is_object() || node.dtype().is_list())
+    {
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            const Node &child = itr.next();
+            std::string child_name = itr.name();
+            if(node.dtype().is_list())
+            {
+                child_name = conduit_fmt::format("{:d}", itr.index());
+            }
+            append(child, utils::join_path(path, child_name));
+        }
+    }
+    else if(path.empty())
+    {
+        CONDUIT_ERROR("HDF5Appender: cannot append leaf without a path");
+    }
+    else
+    {
+        m_state->append_leaf(node, path);
+    }
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::flush()
+{
+    HDF5Lock hdf5_lock;
+    if(!is_open())
+    {
+        return;
+    }
+
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    std::map<std::string,State::Buffer>::iterator itr;
+    for(itr = m_state->buffers.begin(); itr != m_state->buffers.end(); ++itr)
+    {
+        m_state->flush_buffer(itr->first, itr->second);
+    }
+
+    // restore hdf5 error stack
+}
+
+//---------------------------------------------------------------------------//
+void
+HDF5Appender::close()
+{
+    HDF5Lock hdf5_lock;
+    if(!is_open())
+    {
+        return;
+    }
+
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    m_state->close();
+
+    // restore hdf5 error stack
+}
+
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+// Shared file i/o (all ranks write one file)
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// Layout of a shared file:
+//
+//  data/<leaf path>              values of the leaf from all ranks,
+//                                in rank order
+//  conduit_shared/schemas        compact json schemas of all ranks
+//  conduit_shared/schema_index   [num_ranks+1] offsets into schemas
+//  conduit_shared/leaf_offsets   offset of each rank's leaves (in schema
+//                                leaf order) into their data/ datasets
+//  conduit_shared/leaf_index     [num_ranks+1] offsets into leaf_offsets
+//---------------------------------------------------------------------------//
+static const std::string conduit_hdf5_shared_data_path = "data";
+static const std::string conduit_hdf5_shared_meta_path = "conduit_shared";
+
+//---------------------------------------------------------------------------//
+// Layout of the shared file and where the calling rank's values go.
+//---------------------------------------------------------------------------//
+struct SharedFileLayout
+{
+    // union of the leaf paths of all ranks (sorted), with their dtype ids
+    // and total number of elements
+    std::vector<std::string> paths;
+    std::vector<int64>       dtype_ids;
+    std::vector<int64>       totals;
+    // for each local leaf: index into paths and element offset
+    std::vector<int64>       leaf_ids;
+    std::vector<int64>       leaf_offsets;
+    // local offsets into, and sizes of, conduit_shared/schemas and
+    // conduit_shared/leaf_offsets
+    int64 schema_offset;
+    int64 schema_total;
+    int64 leaf_offsets_offset;
+    int64 leaf_offsets_total;
+    // rank 0 only: conduit_shared/schema_index and leaf_index
+    std::vector<int64>       schema_index;
+    std::vector<int64>       leaf_index;
+};
+
+//---------------------------------------------------------------------------//
+// Collects the non-empty leaves of a tree in depth first order. List
+// children use their index as path component.
+//---------------------------------------------------------------------------//
+template <typename NodeType>
+void
+shared_file_leaves(NodeType &node,
+                   const std::string &path,
+                   std::vector<NodeType*> &leaves,
+                   std::vector<std::string> &leaf_paths)
+{
+    const DataType &dt = node.dtype();
+    if(dt.is_object() || dt.is_list())
+    {
+        for(index_t i = 0; i < node.number_of_children(); i++)
+        {
+            std::string cname = dt.is_object() ?
+                                node.schema().child_name(i) :
+                                conduit_fmt::format("{}", i);
+            shared_file_leaves(node.child(i),
+                               path.empty() ? cname : path + "/" + cname,
+                               leaves,
+                               leaf_paths);
+        }
+    }
+    else if(!dt.is_empty() && dt.number_of_elements() > 0)
+    {
+        leaves.push_back(&node);
+        leaf_paths.push_back(path);
+    }
+}
+
+//---------------------------------------------------------------------------//
+std::string
+shared_file_data_path(const std::string &leaf_path)
+{
+    return leaf_path.empty() ? conduit_hdf5_shared_data_path :
+                               conduit_hdf5_shared_data_path + "/" + leaf_path;
+}
+
+//---------------------------------------------------------------------------//
+// Exchanges the leaf paths, dtypes and sizes of all ranks with rank 0,
+// which computes the union of the leaf paths and every rank's offsets.
+//---------------------------------------------------------------------------//
+void
+exchange_shared_file_layout(const std::vector<const Node*> &leaves,
+                            const std::vector<std::string> &leaf_paths,
+                            int64 schema_bytes,
+                            MPI_Comm comm,
+                            SharedFileLayout &layout)
+{
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    const int num_leaves = (int) leaves.size();
+
+    std::string local_paths;
+    std::vector<int64> local_info(2 * num_leaves);
+    for(int i = 0; i < num_leaves; i++)
+    {
+        local_paths += leaf_paths[i];
+        local_paths.push_back('\0');
+        local_info[2*i]   = leaves[i]->dtype().id();
+        local_info[2*i+1] = leaves[i]->dtype().number_of_elements();
+    }
+
+    // sizes first, then the paths and leaf info
+    int local_hdr[3] = {num_leaves, (int) local_paths.size(), (int) schema_bytes};
+    std::vector<int> hdrs(rank == 0 ? 3 * size : 0);
+    MPI_Gather(local_hdr, 3, MPI_INT, hdrs.data(), 3, MPI_INT, 0, comm);
+
+    std::vector<int> path_counts, path_displs, info_counts, info_displs;
+    std::vector<char> all_paths;
+    std::vector<int64> all_info;
+    if(rank == 0)
+    {
+        path_counts.resize(size);
+        path_displs.resize(size);
+        info_counts.resize(size);
+        info_displs.resize(size);
+        int path_total = 0;
+        int info_total = 0;
+        for(int r = 0; r < size; r++)
+        {
+            path_counts[r] = hdrs[3*r+1];
+            path_displs[r] = path_total;
+            path_total += path_counts[r];
+            info_counts[r] = 2 * hdrs[3*r];
+            info_displs[r] = info_total;
+            info_total += info_counts[r];
+        }
+        all_paths.resize(path_total);
+        all_info.resize(info_total);
+    }
+
+    MPI_Gatherv(local_paths.data(), (int) local_paths.size(), MPI_CHAR,
+                all_paths.data(), path_counts.data(), path_displs.data(),
+                MPI_CHAR, 0, comm);
+    MPI_Gatherv(local_info.data(), 2 * num_leaves, MPI_INT64_T,
+                all_info.data(), info_counts.data(), info_displs.data(),
+                MPI_INT64_T, 0, comm);
+
+    // rank 0 builds the layout and each rank's placement
+    std::string err_msg;
+    std::vector<int64> placements;
+    std::vector<int> place_counts, place_displs;
+    std::vector<int64> rank_offsets;
+    int64 sizes[4] = {0, 0, 0, 0};
+    if(rank == 0)
+    {
+        std::vector<std::string> rank_leaf_paths;
+        rank_leaf_paths.reserve(all_info.size() / 2);
+        for(size_t i = 0; i < all_paths.size(); )
+        {
+            rank_leaf_paths.push_back(std::string(&all_paths[i]));
+            i += rank_leaf_paths.back().size() + 1;
+        }
+
+        // union of the paths, with a dtype check
+        std::map<std::string, int64> path_dtypes;
+        std::map<std::string, int> path_ranks;
+        size_t li = 0;
+        for(int r = 0; r < size && err_msg.empty(); r++)
+        {
+            for(int i = 0; i < hdrs[3*r] && err_msg.empty(); i++, li++)
+            {
+                const std::string &p = rank_leaf_paths[li];
+                const int64 dtype_id = all_info[2*li];
+                std::map<std::string, int64>::iterator itr = path_dtypes.find(p);
+                if(itr == path_dtypes.end())
+                {
+                    path_dtypes[p] = dtype_id;
+                    path_ranks[p]  = r;
+                }
+                else if(itr->second != dtype_id)
+                {
+                    err_msg = conduit_fmt::format(
+                        "leaf \"{}\" has dtype {} on rank {} and dtype {} "
+                        "on rank {}",
+                        p, DataType::id_to_name(itr->second), path_ranks[p],
+                        DataType::id_to_name(dtype_id), r);
+                }
+            }
+        }
+
+        // a path can't be a leaf on one rank and an object on another
+        std::map<std::string, int64>::iterator pitr;
+        for(pitr = path_dtypes.begin();
+            pitr != path_dtypes.end() && err_msg.empty();
+            pitr++)
+        {
+            const std::string prefix = pitr->first.empty() ?
+                                       std::string() : pitr->first + "/";
+            std::map<std::string, int64>::iterator nitr =
+                path_dtypes.lower_bound(prefix);
+            if(nitr != path_dtypes.end() && nitr->first == pitr->first)
+            {
+                nitr++;
+            }
+            if(nitr != path_dtypes.end() &&
+               nitr->first.compare(0, prefix.size(), prefix) == 0)
+            {
+                err_msg = conduit_fmt::format(
+                    "\"{}\" is a leaf on some ranks and has children "
+                    "(\"{}\") on others",
+                    pitr->first, nitr->first);
+            }
+        }
+
+        if(err_msg.empty())
+        {
+            std::map<std::string, int64> path_ids;
+            for(pitr = path_dtypes.begin(); pitr != path_dtypes.end(); pitr++)
+            {
+                path_ids[pitr->first] = (int64) layout.paths.size();
+                layout.paths.push_back(pitr->first);
+                layout.dtype_ids.push_back(pitr->second);
+            }
+            layout.totals.resize(layout.paths.size(), 0);
+
+            // [leaf id, offset] for each leaf of each rank, and
+            // [schema offset, leaf offsets offset] for each rank
+            placements.resize(all_info.size());
+            place_counts.resize(size);
+            place_displs.resize(size);
+            rank_offsets.resize(2 * size);
+            layout.schema_index.resize(size + 1, 0);
+            layout.leaf_index.resize(size + 1, 0);
+            li = 0;
+            for(int r = 0; r < size; r++)
+            {
+                place_counts[r] = info_counts[r];
+                place_displs[r] = info_displs[r];
+                rank_offsets[2*r]   = layout.schema_index[r];
+                rank_offsets[2*r+1] = layout.leaf_index[r];
+                layout.schema_index[r+1] = layout.schema_index[r] + hdrs[3*r+2];
+                layout.leaf_index[r+1]   = layout.leaf_index[r] + hdrs[3*r];
+                for(int i = 0; i < hdrs[3*r]; i++, li++)
+                {
+                    const int64 id = path_ids[rank_leaf_paths[li]];
+                    placements[2*li]   = id;
+                    placements[2*li+1] = layout.totals[id];
+                    layout.totals[id] += all_info[2*li+1];
+                }
+            }
+
+            sizes[0] = (int64) layout.paths.size();
+            sizes[1] = (int64) all_paths.size();
+            sizes[2] = layout.schema_index[size];
+            sizes[3] = layout.leaf_index[size];
+        }
+    }
+
+    // all ranks raise errors found by rank 0
+    int err_len = (int) err_msg.size();
+    MPI_Bcast(&err_len, 1, MPI_INT, 0, comm);
+    if(err_len > 0)
+    {
+        err_msg.resize(err_len);
+        MPI_Bcast(&err_msg[0], err_len, MPI_CHAR, 0, comm);
+        CONDUIT_ERROR("hdf5_save_shared: " << err_msg);
+    }
+
+    // union of the leaves
+    MPI_Bcast(sizes, 4, MPI_INT64_T, 0, comm);
+    layout.schema_total       = sizes[2];
+    layout.leaf_offsets_total = sizes[3];
+
+    std::string union_paths;
+    std::vector<int64> union_info(2 * sizes[0]);
+    if(rank == 0)
+    {
+        for(size_t i = 0; i < layout.paths.size(); i++)
+        {
+            union_paths += layout.paths[i];
+            union_paths.push_back('\0');
+            union_info[2*i]   = layout.dtype_ids[i];
+            union_info[2*i+1] = layout.totals[i];
+        }
+    }
+    union_paths.resize(sizes[1]);
+    if(sizes[1] > 0)
+    {
+        MPI_Bcast(&union_paths[0], (int) sizes[1], MPI_CHAR, 0, comm);
+    }
+    MPI_Bcast(union_info.data(), (int) union_info.size(), MPI_INT64_T, 0, comm);
+    if(rank != 0)
+    {
+        for(size_t i = 0; i < union_paths.size(); )
+        {
+            layout.paths.push_back(std::string(&union_paths[i]));
+            i += layout.paths.back().size() + 1;
+        }
+        for(int64 i = 0; i < sizes[0]; i++)
+        {
+            layout.dtype_ids.push_back(union_info[2*i]);
+            layout.totals.push_back(union_info[2*i+1]);
+        }
+    }
+
+    // this rank's placements
+    std::vector<int64> local_place(2 * num_leaves);
+    MPI_Scatterv(placements.data(), place_counts.data(), place_displs.data(),
+                 MPI_INT64_T, local_place.data(), 2 * num_leaves,
+                 MPI_INT64_T, 0, comm);
+    int64 local_offsets[2] = {0, 0};
+    MPI_Scatter(rank_offsets.data(), 2, MPI_INT64_T,
+                local_offsets, 2, MPI_INT64_T, 0, comm);
+
+    layout.leaf_ids.resize(num_leaves);
+    layout.leaf_offsets.resize(num_leaves);
+    for(int i = 0; i < num_leaves; i++)
+    {
+        layout.leaf_ids[i]     = local_place[2*i];
+        layout.leaf_offsets[i] = local_place[2*i+1];
+    }
+    layout.schema_offset       = local_offsets[0];
+    layout.leaf_offsets_offset = local_offsets[1];
+}
+
+//---------------------------------------------------------------------------//
+// Creates the datasets of a shared file. With the MPI-IO driver, all ranks
+// call this with the same layout.
+//---------------------------------------------------------------------------//
+void
+create_shared_file_datasets(hid_t h5_file_id,
+                            const SharedFileLayout &layout,
+                            index_t num_ranks)
+{
+    // create parent groups as needed
+    hid_t h5_lc_props = H5Pcreate(H5P_LINK_CREATE);
+    CONDUIT_CHECK_HDF5_ERROR(h5_lc_props,
+                             "Failed to create H5P_LINK_CREATE property list");
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_create_intermediate_group(h5_lc_props, 1),
+                             "Failed to set intermediate group creation for "
+                             << "property list " << h5_lc_props);
+
+    std::vector<std::string> dset_paths;
+    std::vector<DataType>    dset_dtypes;
+    for(size_t i = 0; i < layout.paths.size(); i++)
+    {
+        dset_paths.push_back(shared_file_data_path(layout.paths[i]));
+        dset_dtypes.push_back(DataType(layout.dtype_ids[i], layout.totals[i]));
+    }
+    const std::string meta = conduit_hdf5_shared_meta_path + "/";
+    dset_paths.push_back(meta + "schemas");
+    dset_dtypes.push_back(DataType::char8_str(layout.schema_total));
+    dset_paths.push_back(meta + "schema_index");
+    dset_dtypes.push_back(DataType::int64(num_ranks + 1));
+    dset_paths.push_back(meta + "leaf_offsets");
+    dset_dtypes.push_back(DataType::int64(layout.leaf_offsets_total));
+    dset_paths.push_back(meta + "leaf_index");
+    dset_dtypes.push_back(DataType::int64(num_ranks + 1));
+
+    for(size_t i = 0; i < dset_paths.size(); i++)
+    {
+        const std::string &ref_path = dset_paths[i];
+        hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(dset_dtypes[i],
+                                                        ref_path);
+        hsize_t num_elems = (hsize_t) dset_dtypes[i].number_of_elements();
+        hid_t h5_dspace_id = H5Screate_simple(1, &num_elems, NULL);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                        h5_file_id,
+                                                        ref_path,
+                                             "Failed to create HDF5 data space");
+
+        hid_t h5_dset_id = H5Dcreate2(h5_file_id,
+                                      ref_path.c_str(),
+                                      h5_dtype_id,
+                                      h5_dspace_id,
+                                      h5_lc_props,
+                                      H5P_DEFAULT,
+                                      H5P_DEFAULT);
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                        h5_file_id,
+                                                        ref_path,
+                                             "Failed to create HDF5 Dataset");
+
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                        h5_file_id,
+                                                        ref_path,
+                                             "Failed to close HDF5 Dataset");
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                        h5_file_id,
+                                                        ref_path,
+                                             "Failed to close HDF5 data space");
+        conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id, ref_path);
+    }
+
+    CONDUIT_CHECK_HDF5_ERROR(H5Pclose(h5_lc_props),
+                             "Failed to close HDF5 H5P_LINK_CREATE "
+                             << "property list: " << h5_lc_props);
+}
+
+//---------------------------------------------------------------------------//
+// Writes (or, with write == false, reads) count elements at offset of a
+// 1D dataset. A count of 0 takes part in collective transfers without
+// selecting anything.
+//---------------------------------------------------------------------------//
+void
+shared_file_slab_io(hid_t h5_file_id,
+                    const std::string &ref_path,
+                    const DataType &mem_dtype,
+                    int64 offset,
+                    int64 count,
+                    void *data_ptr,
+                    hid_t h5_xfer_props,
+                    bool write)
+{
+    conduit::relay::io::StatsTimer stats_timer("hdf5",
+                                               write ? "dataset_write" :
+                                                       "dataset_read",
+                                               count *
+                                                 mem_dtype.element_bytes());
+
+    hid_t h5_dset_id = H5Dopen2(h5_file_id, ref_path.c_str(), H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to open HDF5 Dataset");
+
+    hid_t h5_dspace_id = H5Dget_space(h5_dset_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dspace_id,
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to get HDF5 data space");
+
+    hsize_t h5_offset = (hsize_t) offset;
+    hsize_t h5_count  = (hsize_t) count;
+    hid_t h5_mspace_id = H5Screate_simple(1, &h5_count, NULL);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_mspace_id,
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to create HDF5 data space");
+
+    herr_t h5_status = 0;
+    if(count > 0)
+    {
+        h5_status = H5Sselect_hyperslab(h5_dspace_id, H5S_SELECT_SET,
+                                        &h5_offset, NULL, &h5_count, NULL);
+    }
+    else
+    {
+        h5_status = H5Sselect_none(h5_dspace_id);
+        if(h5_status >= 0)
+        {
+            h5_status = H5Sselect_none(h5_mspace_id);
+        }
+    }
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to select HDF5 hyperslab");
+
+    hid_t h5_dtype_id = conduit_dtype_to_hdf5_dtype(mem_dtype, ref_path);
+    if(write)
+    {
+        h5_status = H5Dwrite(h5_dset_id, h5_dtype_id, h5_mspace_id,
+                             h5_dspace_id, h5_xfer_props, data_ptr);
+    }
+    else
+    {
+        h5_status = H5Dread(h5_dset_id, h5_dtype_id, h5_mspace_id,
+                            h5_dspace_id, h5_xfer_props, data_ptr);
+    }
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to " <<
+                                         (write ? "write" : "read") <<
+                                         " HDF5 Dataset");
+    conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id, ref_path);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_mspace_id),
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to close HDF5 data space");
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to close HDF5 data space");
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Dclose(h5_dset_id),
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to close HDF5 Dataset");
+}
+
+//---------------------------------------------------------------------------//
+// Writes the calling rank's values into a shared file. With collective
+// == true every rank takes part in the write of every dataset.
+//---------------------------------------------------------------------------//
+void
+write_shared_file_values(hid_t h5_file_id,
+                         const SharedFileLayout &layout,
+                         const std::vector<const Node*> &leaves,
+                         const std::string &schema_json,
+                         int rank,
+                         hid_t h5_xfer_props,
+                         bool collective)
+{
+    // leaf index for each dataset (-1 if this rank does not have it)
+    std::vector<index_t> local_leaf(layout.paths.size(), -1);
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        local_leaf[layout.leaf_ids[i]] = (index_t) i;
+    }
+
+    for(size_t id = 0; id < layout.paths.size(); id++)
+    {
+        const index_t li = local_leaf[id];
+        if(li < 0 && !collective)
+        {
+            continue;
+        }
+
+        const std::string ref_path = shared_file_data_path(layout.paths[id]);
+        if(li < 0)
+        {
+            DataType dt(layout.dtype_ids[id], 1);
+            shared_file_slab_io(h5_file_id, ref_path, dt, 0, 0, NULL,
+                                h5_xfer_props, true);
+            continue;
+        }
+
+        const Node &leaf = *leaves[li];
+        Node compact_leaf;
+        const Node *src = &leaf;
+        // leaves of compact trees have offsets, only strides need a copy
+        if(leaf.dtype().stride() != leaf.dtype().element_bytes())
+        {
+            leaf.compact_to(compact_leaf);
+            src = &compact_leaf;
+        }
+        shared_file_slab_io(h5_file_id, ref_path,
+                            src->dtype(),
+                            layout.leaf_offsets[li],
+                            src->dtype().number_of_elements(),
+                            const_cast<void*>(src->element_ptr(0)),
+                            h5_xfer_props, true);
+    }
+
+    const std::string meta = conduit_hdf5_shared_meta_path + "/";
+    const int64 num_leaves = (int64) leaves.size();
+    std::vector<int64> leaf_offsets(layout.leaf_offsets.begin(),
+                                    layout.leaf_offsets.end());
+
+    shared_file_slab_io(h5_file_id, meta + "schemas",
+                        DataType::char8_str(1),
+                        layout.schema_offset,
+                        (int64) schema_json.size(),
+                        const_cast<char*>(schema_json.data()),
+                        h5_xfer_props, true);
+    shared_file_slab_io(h5_file_id, meta + "leaf_offsets",
+                        DataType::int64(1),
+                        layout.leaf_offsets_offset,
+                        num_leaves,
+                        leaf_offsets.data(),
+                        h5_xfer_props, true);
+
+    // rank 0 writes the index arrays
+    if(rank == 0 || collective)
+    {
+        std::vector<int64> schema_index(layout.schema_index);
+        std::vector<int64> leaf_index(layout.leaf_index);
+        shared_file_slab_io(h5_file_id, meta + "schema_index",
+                            DataType::int64(1),
+                            0, (int64) schema_index.size(),
+                            schema_index.data(),
+                            h5_xfer_props, true);
+        shared_file_slab_io(h5_file_id, meta + "leaf_index",
+                            DataType::int64(1),
+                            0, (int64) leaf_index.size(),
+                            leaf_index.data(),
+                            h5_xfer_props, true);
+    }
+}
+
+//---------------------------------------------------------------------------//
+index_t
+shared_file_number_of_ranks(hid_t h5_file_id)
+{
+    const std::string ref_path = conduit_hdf5_shared_meta_path + "/schema_index";
+    hid_t h5_dset_id = H5Dopen2(h5_file_id, ref_path.c_str(), H5P_DEFAULT);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_dset_id,
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to open HDF5 Dataset "
+                                         "(not a shared file?)");
+    hid_t h5_dspace_id = H5Dget_space(h5_dset_id);
+    hssize_t num_elems = H5Sget_simple_extent_npoints(h5_dspace_id);
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(num_elems,
+                                                    h5_file_id,
+                                                    ref_path,
+                                         "Failed to get HDF5 data space size");
+    H5Sclose(h5_dspace_id);
+    H5Dclose(h5_dset_id);
+    return (index_t) num_elems - 1;
+}
+
+//---------------------------------------------------------------------------//
+// Reads the node a given rank wrote into a shared file.
+//---------------------------------------------------------------------------//
+void
+read_shared_file_values(hid_t h5_file_id,
+                        index_t rank,
+                        hid_t h5_xfer_props,
+                        Node &node)
+{
+    const index_t num_ranks = shared_file_number_of_ranks(h5_file_id);
+    if(rank < 0 || rank >= num_ranks)
+    {
+        CONDUIT_ERROR("Cannot read rank " << rank << " from HDF5 shared "
+                      "file written by " << num_ranks << " ranks");
+    }
+
+    const std::string meta = conduit_hdf5_shared_meta_path + "/";
+    int64 schema_range[2] = {0, 0};
+    int64 leaf_range[2]   = {0, 0};
+    shared_file_slab_io(h5_file_id, meta + "schema_index",
+                        DataType::int64(1), rank, 2,
+                        schema_range, h5_xfer_props, false);
+    shared_file_slab_io(h5_file_id, meta + "leaf_index",
+                        DataType::int64(1), rank, 2,
+                        leaf_range, h5_xfer_props, false);
+
+    std::string schema_json(schema_range[1] - schema_range[0], '\0');
+    shared_file_slab_io(h5_file_id, meta + "schemas",
+                        DataType::char8_str(1),
+                        schema_range[0], (int64) schema_json.size(),
+                        schema_json.empty() ? NULL : &schema_json[0],
+                        h5_xfer_props, false);
+
+    node.reset();
+    node.set(Schema(schema_json));
+
+    std::vector<Node*> leaves;
+    std::vector<std::string> leaf_paths;
+    shared_file_leaves(node, std::string(), leaves, leaf_paths);
+
+    const int64 num_leaves = leaf_range[1] - leaf_range[0];
+    if(num_leaves != (int64) leaves.size())
+    {
+        CONDUIT_ERROR("HDF5 shared file has " << num_leaves << " leaf "
+                      "offsets for rank " << rank << ", but its schema has "
+                      << leaves.size() << " leaves");
+    }
+
+    std::vector<int64> leaf_offsets(num_leaves);
+    shared_file_slab_io(h5_file_id, meta + "leaf_offsets",
+                        DataType::int64(1),
+                        leaf_range[0], num_leaves,
+                        leaf_offsets.data(), h5_xfer_props, false);
+
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        Node &leaf = *leaves[i];
+        shared_file_slab_io(h5_file_id,
+                            shared_file_data_path(leaf_paths[i]),
+                            leaf.dtype(),
+                            leaf_offsets[i],
+                            leaf.dtype().number_of_elements(),
+                            leaf.element_ptr(0),
+                            h5_xfer_props, false);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_save_shared(const Node &node,
+                 const std::string &file_path,
+                 MPI_Comm comm)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    std::vector<const Node*> leaves;
+    std::vector<std::string> leaf_paths;
+    shared_file_leaves(node, std::string(), leaves, leaf_paths);
+
+    Schema compact_schema;
+    node.schema().compact_to(compact_schema);
+    const std::string schema_json = compact_schema.to_json(0, 0, "", "");
+
+    SharedFileLayout layout;
+    exchange_shared_file_layout(leaves,
+                                leaf_paths,
+                                (int64) schema_json.size(),
+                                comm,
+                                layout);
+
+#ifdef H5_HAVE_PARALLEL
+    // all ranks create the file and its datasets, with collective metadata
+    // operations, and write with collective transfers
+    hid_t h5_fc_plist = create_hdf5_file_create_plist();
+    hid_t h5_fa_plist = create_hdf5_file_access_plist();
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_fapl_mpio(h5_fa_plist, comm, MPI_INFO_NULL),
+                             "Failed to set MPI-IO file access for "
+                             << "property list " << h5_fa_plist);
+#if H5_VERSION_GE(1, 10, 0)
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_all_coll_metadata_ops(h5_fa_plist, 1),
+                             "Failed to set collective metadata reads for "
+                             << "property list " << h5_fa_plist);
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_coll_metadata_write(h5_fa_plist, 1),
+                             "Failed to set collective metadata writes for "
+                             << "property list " << h5_fa_plist);
+#endif
+
+    hid_t h5_file_id = H5Fcreate(file_path.c_str(),
+                                 H5F_ACC_TRUNC,
+                                 h5_fc_plist,
+                                 h5_fa_plist);
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                             "Error opening HDF5 file for writing: "
+                             << file_path);
+    H5Pclose(h5_fc_plist);
+    H5Pclose(h5_fa_plist);
+
+    create_shared_file_datasets(h5_file_id, layout, size);
+
+    hid_t h5_xfer_props = H5Pcreate(H5P_DATASET_XFER);
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_dxpl_mpio(h5_xfer_props,
+                                              H5FD_MPIO_COLLECTIVE),
+                             "Failed to set collective transfers for "
+                             << "property list " << h5_xfer_props);
+
+    write_shared_file_values(h5_file_id, layout, leaves, schema_json,
+                             rank, h5_xfer_props, true);
+
+    H5Pclose(h5_xfer_props);
+    hdf5_close_file(h5_file_id);
+#else
+    // serial hdf5: rank 0 creates the file, then the ranks take turns
+    int token = 0;
+    if(rank == 0)
+    {
+        hid_t h5_file_id = hdf5_create_file(file_path);
+        create_shared_file_datasets(h5_file_id, layout, size);
+        write_shared_file_values(h5_file_id, layout, leaves, schema_json,
+                                 rank, H5P_DEFAULT, false);
+        hdf5_close_file(h5_file_id);
+    }
+    else
+    {
+        MPI_Recv(&token, 1, MPI_INT, rank - 1, 0, comm, MPI_STATUS_IGNORE);
+        hid_t h5_file_id = hdf5_open_file_for_read_write(file_path);
+        write_shared_file_values(h5_file_id, layout, leaves, schema_json,
+                                 rank, H5P_DEFAULT, false);
+        hdf5_close_file(h5_file_id);
+    }
+    if(rank + 1 < size)
+    {
+        MPI_Send(&token, 1, MPI_INT, rank + 1, 0, comm);
+    }
+    // the file is complete on all ranks when we return
+    MPI_Barrier(comm);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_load_shared(const std::string &file_path,
+                 Node &node,
+                 MPI_Comm comm)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+#ifdef H5_HAVE_PARALLEL
+    hid_t h5_fa_plist = create_hdf5_file_access_plist();
+    CONDUIT_CHECK_HDF5_ERROR(H5Pset_fapl_mpio(h5_fa_plist, comm, MPI_INFO_NULL),
+                             "Failed to set MPI-IO file access for "
+                             << "property list " << h5_fa_plist);
+    hid_t h5_file_id = H5Fopen(file_path.c_str(),
+                               H5F_ACC_RDONLY,
+                               h5_fa_plist);
+    CONDUIT_CHECK_HDF5_ERROR(h5_file_id,
+                             "Error opening HDF5 file for read only access: "
+                              << file_path);
+    H5Pclose(h5_fa_plist);
+#else
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+#endif
+
+    const index_t num_ranks = shared_file_number_of_ranks(h5_file_id);
+    if(num_ranks != size)
+    {
+        hdf5_close_file(h5_file_id);
+        CONDUIT_ERROR("HDF5 shared file " << file_path << " was written by "
+                      << num_ranks << " ranks, cannot load it with "
+                      << size << " ranks");
+    }
+
+    // each rank reads different datasets, so the reads are independent
+    read_shared_file_values(h5_file_id, rank, H5P_DEFAULT, node);
+    hdf5_close_file(h5_file_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+hdf5_read_shared(const std::string &file_path,
+                 index_t rank,
+                 Node &node)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+    read_shared_file_values(h5_file_id, rank, H5P_DEFAULT, node);
+    hdf5_close_file(h5_file_id);
+}
+
+//---------------------------------------------------------------------------//
+index_t
+hdf5_shared_number_of_ranks(const std::string &file_path)
+{
+    HDF5Lock hdf5_lock;
+    // disable hdf5 error stack
+    HDF5ErrorStackSupressor supress_hdf5_errors;
+
+    hid_t h5_file_id = hdf5_open_file_for_read(file_path);
+    index_t res = shared_file_number_of_ranks(h5_file_id);
+    hdf5_close_file(h5_file_id);
+    return res;
+}
+
+#endif
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::<mpi>::io --
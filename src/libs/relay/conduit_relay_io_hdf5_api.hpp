@@ -81,15 +81,107 @@
 
 
 //-----------------------------------------------------------------------------
+///
+/// Storage options:
+///
+///  The write, save and append methods that take an opts Node accept the
+///  same "compact_storage" and "chunking" entries as hdf5_set_options().
+///  They apply to the datasets created by that call only, on top of the
+///  defaults from hdf5_set_options(). They can also be given under
+///  opts["hdf5"] (as relay::io::save and IOHandle options do), in which
+///  case entries at the top level of opts take precedence.
+///
+///  opts["overrides"] is a list (or object) of entries with a "path" and
+///  "compact_storage" or "chunking" settings, applied to the datasets at or
+///  below that path (relative to the hdf5 id written to). Later entries
+///  take precedence. For example:
+///
+///    chunking:
+///      chunk_size: 4000000
+///    overrides:
+///      -
+///        path: "fields/pressure"
+///        chunking:
+///          compression:
+///            method: "none"
+///
+///  Chunked datasets are split into equal sized chunks of at most
+///  chunk_size bytes; datasets smaller than chunk_size that are not written
+///  with an offset use a single chunk.
+///
+///  "chunking/compression/num_threads" (default 1, values <= 0 select the
+///  hardware concurrency) sets the number of threads used to compress the
+///  gzip chunks of a whole dataset write, and to decompress them when a
+///  whole dataset is read (the read methods accept the same entry). This
+///  requires HDF5 1.10.2 or newer and zlib, otherwise HDF5 filters the
+///  chunks serially.
+///
+/// Packing options:
+///
+///  "packing/enabled" (default "false") packs the numeric and string leaves
+///  of an object that hold at most "packing/threshold" bytes (default 1024)
+///  into one byte dataset per group, named "__conduit_packed", instead of
+///  creating a dataset for each of them. Attributes on that dataset hold
+///  the layout version and the conduit schema of the leaves, so packed
+///  files are only readable with conduit. Groups with a single small leaf
+///  are not packed. Later writes to the group update the packed leaves,
+///  and leaves written as their own datasets replace them.
+///
+///  hdf5_read, hdf5_has_path and hdf5_group_list_child_names unpack these
+///  leaves transparently. Packed leaves are read whole (read selections
+///  don't apply to them), and are read together where the packed dataset
+///  is in the group's order.
+///
+/// File access options:
+///
+///  Files with many small objects (for example a root file with thousands
+///  of domains) spend most of their i/o on object metadata. These entries
+///  (also accepted by hdf5_set_options()) reduce that cost:
+///
+///  "paged_file_space/enabled" (default "false") creates new files with
+///  paged aggregation, which groups metadata and raw data into separate
+///  file space pages of "paged_file_space/page_size" bytes (default 65536).
+///  Paged files can only be read by HDF5 1.10.1 or newer.
+///
+///  "page_buffer/size" (default 0, disabled) is the size in bytes of the
+///  page buffer used when opening paged files, so the metadata of many
+///  objects is read with one i/o call. It must hold at least one page.
+///  Files without paged file space are opened without the page buffer.
+///
+///  "metadata_cache/size" (default 0, HDF5's default) is the initial size
+///  in bytes of the HDF5 metadata cache of opened and created files.
+///
+/// Thread safety:
+///
+///  The functions below (and HDF5Appender) may be called from several
+///  threads at once, as long as each thread uses its own file handles.
+///  Unless HDF5 is built thread-safe, relay serializes all of its calls
+///  into HDF5 on one process wide lock. Where it can, relay releases the
+///  lock for work that does not touch HDF5, such as filtering chunks with
+///  "chunking/compression/num_threads". The options set with hdf5_set_options() are copied
+///  when a call starts, so changing them does not affect calls already
+///  running. Code that calls the HDF5 API directly on the handles relay
+///  returns is not covered by the lock, and must not run concurrently
+///  with relay calls unless HDF5 is thread-safe.
+///
+
 /// Create a hdf5 file for read and write using conduit's selected hdf5 plists.
+/// The opts variant accepts the file access options above.
 //-----------------------------------------------------------------------------
 hid_t CONDUIT_RELAY_API hdf5_create_file(const std::string &file_path);
+hid_t CONDUIT_RELAY_API hdf5_create_file(const std::string &file_path,
+                                         const Node &opts);
 
 //-----------------------------------------------------------------------------
 /// Close hdf5 file handle
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API hdf5_close_file(hid_t hdf5_id);
 
+//-----------------------------------------------------------------------------
+/// Flush the buffers of the hdf5 file that holds the given object to disk
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_flush_file(hid_t hdf5_id);
+
 //-----------------------------------------------------------------------------
 /// Save node data to a given path.
 ///
@@ -228,9 +320,14 @@ void CONDUIT_RELAY_API hdf5_write(const Node &node,
 
 //-----------------------------------------------------------------------------
 /// Open a hdf5 file for reading, using conduit's selected hdf5 plists.
+/// The opts variants accept the file access options above.
 //-----------------------------------------------------------------------------
 hid_t CONDUIT_RELAY_API hdf5_open_file_for_read(const std::string &file_path);
+hid_t CONDUIT_RELAY_API hdf5_open_file_for_read(const std::string &file_path,
+                                                const Node &opts);
 hid_t CONDUIT_RELAY_API hdf5_open_file_for_read_write(const std::string &file_path);
+hid_t CONDUIT_RELAY_API hdf5_open_file_for_read_write(const std::string &file_path,
+                                                      const Node &opts);
 
 //-----------------------------------------------------------------------------
 /// Read hdf5 data from given path into the output node
@@ -238,6 +335,44 @@ hid_t CONDUIT_RELAY_API hdf5_open_file_for_read_write(const std::string &file_pa
 /// This methods supports a file system and hdf5 path, joined using a ":"
 ///  ex: "/path/on/file/system.hdf5:/path/inside/hdf5/file"
 ///
+/// Read selection options:
+///
+///  "offset", "stride" and "size" read part of one dimensional datasets.
+///
+///  "hyperslab" reads part of a dataset of any rank. Its "offset", "stride"
+///  and "size" entries hold one value per dimension (defaults: 0, 1, and
+///  as many entries as remain in the dimension). "points" reads the
+///  elements at the given coordinates (one value per dimension for each
+///  point). Both read into a one dimensional leaf, in row-major order for
+///  hyperslabs and in the given order for points.
+///
+///  opts["selections"] is a list (or object) of entries with a "path" and
+///  any of the options above, applied to the datasets at or below that
+///  path (relative to the hdf5 path read). Later entries take precedence,
+///  and replace the top level selection options. For example, to read
+///  rows 100 to 199 of two fields:
+///
+///    selections:
+///      -
+///        path: "fields"
+///        hyperslab:
+///          offset: [100, 0]
+///          size: [100, 3]
+///
+///  relay::mpi::io accepts the same options, so each rank can read its
+///  own slab of a shared file.
+///
+/// Existing layout option:
+///
+///  "existing_layout: true" reads datasets into the numeric leaves already
+///  in the output node, keeping their memory. Leaves set with set_external
+///  (for example simulation arrays or pinned host buffers) are filled by
+///  H5Dread directly, including strided leaves, with no intermediate
+///  buffer. Values are converted only when the leaf's type differs from
+///  the dataset's. Each leaf must have as many elements as its read
+///  selects. Datasets without a numeric leaf in the output are read as
+///  usual.
+///
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API hdf5_read(const std::string &path,
                                  Node &node);
@@ -332,6 +467,37 @@ void CONDUIT_RELAY_API hdf5_read_info(hid_t hdf5_id,
                                  const Node &opts,
                                  Node &node);
 
+//-----------------------------------------------------------------------------
+/// Read the hdf5 hierarchy at the given path into the output node, without
+/// opening or reading any datasets.
+///
+/// The path supports a file system and hdf5 path, joined using a ":"
+///  ex: "/path/on/file/system.hdf5:/path/inside/hdf5/file"
+///
+/// Groups become objects holding their children, other entries are
+/// strings: "dataset", "datatype", "soft link: {target}",
+/// "external link: {file}:{path}", and "group" for groups past the depth
+/// limit (or "group (cycle)" for groups that contain themselves).
+///
+/// opts:
+///   depth: number of levels listed (default: 0, all levels)
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_read_structure(const std::string &path,
+                                           Node &node);
+
+void CONDUIT_RELAY_API hdf5_read_structure(const std::string &path,
+                                           const Node &opts,
+                                           Node &node);
+
+void CONDUIT_RELAY_API hdf5_read_structure(hid_t hdf5_id,
+                                           const std::string &hdf5_path,
+                                           Node &node);
+
+void CONDUIT_RELAY_API hdf5_read_structure(hid_t hdf5_id,
+                                           const std::string &hdf5_path,
+                                           const Node &opts,
+                                           Node &node);
+
 //-----------------------------------------------------------------------------
 /// Helpers for converting between hdf5 dtypes and conduit dtypes
 ///
@@ -397,9 +563,30 @@ bool CONDUIT_RELAY_API hdf5_has_path(hid_t hdf5_id, const std::string &path);
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API hdf5_remove_path(hid_t hdf5_id, const std::string &path);
 
+//-----------------------------------------------------------------------------
+/// Create a soft link at link_path that refers to target_path, both relative
+/// to hdf5 id. Missing groups along link_path are created. Reading the link
+/// reads the target, so the target's data is stored once.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_create_link(hid_t hdf5_id,
+                                        const std::string &target_path,
+                                        const std::string &link_path);
+
+//-----------------------------------------------------------------------------
+/// Create an external link at link_path, relative to hdf5 id, that refers
+/// to target_path in the file target_file_path. Missing groups along
+/// link_path are created. A relative target_file_path is found relative
+/// to the directory of the file that holds the link.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API hdf5_create_external_link(hid_t hdf5_id,
+                                                 const std::string &target_file_path,
+                                                 const std::string &target_path,
+                                                 const std::string &link_path);
+
 
 //-----------------------------------------------------------------------------
-/// Pass a Node to set hdf5 i/o options.
+/// Pass a Node to set the default hdf5 i/o options.
+/// (Per write options can be passed in the opts of the write methods.)
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API hdf5_set_options(const Node &opts);
 
@@ -415,5 +602,64 @@ void CONDUIT_RELAY_API hdf5_identifier_report(Node &out);
 
 void CONDUIT_RELAY_API hdf5_identifier_report(hid_t hdf5_id, Node &out);
 
+//-----------------------------------------------------------------------------
+/// Buffered appends to one dimensional, extendible datasets, for time
+/// series that grow by a few values per cycle.
+///
+/// append(node, path) appends the values of each leaf of node to the
+/// dataset at path/<leaf path>, creating the dataset (and its groups) if
+/// needed. Values are kept in memory per dataset and written in batches,
+/// and the datasets grow geometrically so they are rarely extended.
+/// flush() writes all buffered values, close() also trims each dataset to
+/// its number of values. Until close(), datasets may hold extra entries.
+///
+/// Options (passed to open):
+///  "append/buffer_size" (default 65536): bytes buffered per dataset
+///      before its values are written. Also the largest chunk size used
+///      for the datasets created.
+///  "append/growth_factor" (default 2.0): extents grow to at least this
+///      factor times their current extent.
+///  The write storage options (see "Storage options" above) apply to the
+///  datasets created.
+///
+/// Existing datasets must be extendible (written with an "offset") and
+/// hold values of the same type as the appended leaves.
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API HDF5Appender
+{
+public:
+     HDF5Appender();
+    ~HDF5Appender();
+
+    /// open the file for appending, it is created if it doesn't exist
+    void open(const std::string &file_path);
+    void open(const std::string &file_path,
+              const Node &opts);
+    /// append relative to an open hdf5 id, which close() does not close
+    void open(hid_t hdf5_id,
+              const Node &opts);
+
+    bool is_open() const;
+
+    /// append the leaves of node to the datasets at the root, or below path
+    void append(const Node &node);
+    void append(const Node &node,
+                const std::string &path);
+
+    /// write all buffered values
+    void flush();
+
+    /// write all buffered values, trim datasets and release the file
+    void close();
+
+private:
+    HDF5Appender(const HDF5Appender &);
+    HDF5Appender &operator=(const HDF5Appender &);
+
+    // per dataset buffers and the hdf5 ids in use
+    class State;
+    State *m_state;
+};
+
 
 #endif
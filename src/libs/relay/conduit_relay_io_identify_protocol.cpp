@@ -10,7 +10,10 @@
 #include <string>
 #include <cstring>
 #include "conduit_utils.hpp"
+#include "conduit_pack.hpp"
 #include "conduit_relay_config.h"
+#include "conduit_relay_io_handle.hpp"
+#include "conduit_relay_io_utils.hpp"
 
 #ifdef CONDUIT_RELAY_IO_MPI_ENABLED
     #include "conduit_relay_mpi_io_identify_protocol.hpp"
@@ -23,7 +26,14 @@
 #include "conduit_relay_io_hdf5.hpp"
 #endif
 
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <sys/stat.h>
+#include <sys/types.h>
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -76,7 +86,14 @@ identify_protocol(const std::string &path,
                                   file_name_ext,
                                   file_name_base);
 
-    
+
+    // registered protocols take precedence
+    if(conduit::relay::io::identify_registered_protocol(file_name_ext,
+                                                        io_type))
+    {
+        return;
+    }
+
     if(file_name_ext == "hdf5" || 
        file_name_ext == "h5")
     {
@@ -111,58 +128,232 @@ identify_protocol(const std::string &path,
     {
         io_type = "csv";
     }
+    else if(file_name_ext == "conduit_pack")
+    {
+        io_type = "conduit_pack";
+    }
+    else if(file_name_ext == "conduit_bin_zlib")
+    {
+        io_type = "conduit_bin_zlib";
+    }
+    else if(file_name_ext == "conduit_shm")
+    {
+        io_type = "conduit_shm";
+    }
 
     // default to conduit_bin
 
 }
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::<mpi>::io::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// bytes read to identify a file: the text checks use the first 256 bytes,
+// the hdf5 signature is at the start of the file or after a 512 byte user
+// block
+static const std::streamsize FILE_TYPE_HEADER_BYTES = 520;
+
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+static const char HDF5_SIGNATURE[8] = {'\211','H','D','F','\r','\n','\032','\n'};
+#endif
+
+//-----------------------------------------------------------------------------
+// Identifies the file type from the first bytes of the file, read once.
+//-----------------------------------------------------------------------------
+std::string
+file_type_from_header(const std::string &path)
+{
+    std::string file_type = "unknown";
+
+    char buff[FILE_TYPE_HEADER_BYTES];
+    std::ifstream ifs;
+    ifs.open(path.c_str(), std::ios_base::binary);
+    if(!ifs.is_open())
+    {
+        return file_type;
+    }
+    ifs.read(buff, FILE_TYPE_HEADER_BYTES);
+    std::streamsize nbytes_read = ifs.gcount();
+    ifs.close();
+
+    // first check for hdf5
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    if( (nbytes_read >= 8 &&
+         memcmp(buff, HDF5_SIGNATURE, 8) == 0) ||
+        (nbytes_read >= 520 &&
+         memcmp(buff + 512, HDF5_SIGNATURE, 8) == 0) )
+    {
+        return "hdf5";
+    }
+#endif
+
+    if(conduit::pack::is_pack_data(buff, (index_t)nbytes_read))
+    {
+        return "conduit_pack";
+    }
+
+    std::string test_str(buff, (size_t)std::min(nbytes_read,
+                                                (std::streamsize)256));
+
+    // for json or yaml, lets make sure a new line exists
+    if(test_str.find("\n") != std::string::npos)
+    {
+        // for yaml look for ":"
+        // for json, look for "{"
+        if(test_str.find(":") != std::string::npos)
+        {
+           file_type = "yaml";
+        }
+        if(test_str.find("{") != std::string::npos)
+        {
+           file_type = "json";
+        }
+    }
+    return file_type;
+}
+
+//-----------------------------------------------------------------------------
+// Returns the number of threads to use, <= 0 picks one per core (at most 8).
+//-----------------------------------------------------------------------------
+index_t
+get_num_threads(int threads)
+{
+    index_t res = (index_t)threads;
+    if(res <= 0)
+    {
+        res = std::min((index_t)8,
+                       std::max((index_t)1,
+                                (index_t)std::thread::hardware_concurrency()));
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// identify_file_types cache: file type by path, valid while the file's
+// modification time and size are unchanged
+//-----------------------------------------------------------------------------
+struct FileTypeCacheEntry
+{
+    int64       mtime;
+    int64       size;
+    std::string file_type;
+};
+
+std::mutex &
+file_type_cache_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+std::map<std::string, FileTypeCacheEntry> &
+file_type_cache()
+{
+    static std::map<std::string, FileTypeCacheEntry> cache;
+    return cache;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::<mpi>::io::detail --
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 void
 identify_file_type(const std::string &path,
                   std::string &file_type)
 {
-    file_type = "unknown";
+    // goal: check for: hdf5, conduit_pack, json, or yaml
+    file_type = detail::file_type_from_header(path);
 
-    // goal: check for: hdf5, json, or yaml
-
-    // first check for hdf5
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-    if(conduit::relay::io::is_hdf5_file(path))
+    // hdf5 files with larger user blocks
+    if(file_type == "unknown" && conduit::relay::io::is_hdf5_file(path))
     {
         file_type = "hdf5";
     }
-    else
-#endif 
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+identify_protocols(const std::vector<std::string> &paths,
+                   std::vector<std::string> &io_types)
+{
+    io_types.resize(paths.size());
+    for(size_t i = 0; i < paths.size(); i++)
     {
-        // read up to 256 bytes
-        char buff[257];
-        std::memset(buff,0,257);
-        std::ifstream ifs;
-        ifs.open(path.c_str());
-        if(ifs.is_open())
+        identify_protocol(paths[i], io_types[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+identify_file_types(const std::vector<std::string> &file_paths,
+                    std::vector<std::string> &file_types,
+                    int threads)
+{
+    file_types.resize(file_paths.size());
+
+    relay::io::detail::run_tasks((index_t)file_paths.size(),
+                                 detail::get_num_threads(threads),
+                                 [&](index_t i)
+    {
+        const std::string &path = file_paths[(size_t)i];
+        std::string &file_type  = file_types[(size_t)i];
+
+        struct stat path_stat;
+        bool has_stat = stat(path.c_str(), &path_stat) == 0;
+
+        if(has_stat)
         {
-            ifs.read((char *)buff,256);
-            int nbytes_read = static_cast<int>(ifs.gcount());
-            ifs.close();
+            std::lock_guard<std::mutex> lock(detail::file_type_cache_mutex());
+            std::map<std::string, detail::FileTypeCacheEntry> &cache =
+                detail::file_type_cache();
+            std::map<std::string, detail::FileTypeCacheEntry>::const_iterator
+                itr = cache.find(path);
+            if(itr != cache.end() &&
+               itr->second.mtime == (int64)path_stat.st_mtime &&
+               itr->second.size  == (int64)path_stat.st_size)
+            {
+                file_type = itr->second.file_type;
+                return;
+            }
+        }
 
-            std::string test_str(buff,nbytes_read);
+        file_type = detail::file_type_from_header(path);
 
-            // for json or yaml, lets make sure a new line exists
-            if(test_str.find("\n") != std::string::npos)
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        // is_hdf5_file serializes its hdf5 calls
+        if(file_type == "unknown")
+        {
+            if(conduit::relay::io::is_hdf5_file(path))
             {
-                // for yaml look for ":" 
-                // for json, look for "{"
-                if(test_str.find(":") != std::string::npos)
-                {
-                   file_type = "yaml";
-                }
-                if(test_str.find("{") != std::string::npos)
-                {
-                   file_type = "json";
-                }
+                file_type = "hdf5";
             }
         }
-    }
+#endif
+
+        if(has_stat)
+        {
+            std::lock_guard<std::mutex> lock(detail::file_type_cache_mutex());
+            detail::FileTypeCacheEntry &entry = detail::file_type_cache()[path];
+            entry.mtime     = (int64)path_stat.st_mtime;
+            entry.size      = (int64)path_stat.st_size;
+            entry.file_type = file_type;
+        }
+    });
+}
+
+//---------------------------------------------------------------------------//
+void
+clear_file_type_cache()
+{
+    std::lock_guard<std::mutex> lock(detail::file_type_cache_mutex());
+    detail::file_type_cache().clear();
 }
 
 }
@@ -10,6 +10,7 @@
 #ifndef CONDUIT_RELAY_IO_IDENTIFY_PROTOCOL_HPP
 #define CONDUIT_RELAY_IO_IDENTIFY_PROTOCOL_HPP
 #include <string>
+#include <vector>
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 #ifndef CONDUIT_RELAY_IO_IDENTIFY_PROTOCOL_API_HPP
 #define CONDUIT_RELAY_IO_IDENTIFY_PROTOCOL_API_HPP
 #include <string>
+#include <vector>
 
 #include "conduit_relay_exports.h"
 
@@ -26,5 +27,28 @@ void CONDUIT_RELAY_API identify_protocol(const std::string &path,
 void CONDUIT_RELAY_API identify_file_type(const std::string &file_path,
                                           std::string &file_type);
 
+//-----------------------------------------------------------------------------
+/// Batch version of identify_protocol: io_types[i] is the protocol of
+/// paths[i].
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API identify_protocols(const std::vector<std::string> &paths,
+                                          std::vector<std::string> &io_types);
+
+//-----------------------------------------------------------------------------
+/// Batch version of identify_file_type: file_types[i] is the file type of
+/// file_paths[i]. Each file is opened once and its first bytes are read
+/// on up to "threads" threads (<= 0: the hardware concurrency, at most 8).
+/// Results are cached by path, modification time and size, so unchanged
+/// files are not opened again by later calls.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API identify_file_types(const std::vector<std::string> &file_paths,
+                                           std::vector<std::string> &file_types,
+                                           int threads = 0);
+
+//-----------------------------------------------------------------------------
+/// Clears the identify_file_types cache.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API clear_file_type_cache();
+
 
 #endif
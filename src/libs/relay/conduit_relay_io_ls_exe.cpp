@@ -10,6 +10,9 @@
 //-----------------------------------------------------------------------------
 
 #include <conduit_relay.hpp>
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+#include <conduit_relay_io_hdf5.hpp>
+#endif
 #include <iostream>
 
 using namespace conduit;
@@ -17,36 +20,140 @@ using std::cerr;
 using std::cout;
 using std::endl;
 
+//-----------------------------------------------------------------------------
+// lists the tree below path with an IOHandle, to depth levels (<= 0: all)
+void
+list_handle_tree(relay::io::IOHandle &hnd,
+                 const std::string &path,
+                 index_t depth,
+                 index_t max_depth,
+                 Node &out)
+{
+    std::vector<std::string> names;
+    if(path.empty())
+        hnd.list_child_names(names);
+    else
+        hnd.list_child_names(path, names);
+
+    if(names.empty())
+    {
+        out.set("data");
+        return;
+    }
+
+    for(size_t i = 0; i < names.size(); i++)
+    {
+        Node &chld = out.add_child(names[i]);
+        if(max_depth > 0 && depth >= max_depth)
+        {
+            chld.set("...");
+        }
+        else
+        {
+            list_handle_tree(hnd,
+                             path.empty() ? names[i]
+                                          : utils::join_path(path, names[i]),
+                             depth + 1,
+                             max_depth,
+                             chld);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// prints the tree of a file, hdf5 files are listed from their metadata
+// without reading datasets
+void
+print_tree(const std::string &path,
+           index_t max_depth)
+{
+    Node tree;
+    std::string ftype;
+    relay::io::identify_file_type(path, ftype);
+
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    if(ftype == "hdf5")
+    {
+        Node opts;
+        opts["depth"] = max_depth;
+        relay::io::hdf5_read_structure(path, opts, tree);
+    }
+    else
+#endif
+    {
+        Node opts;
+        opts["mode"] = "r";
+        relay::io::IOHandle hnd;
+        hnd.open(path, opts);
+        list_handle_tree(hnd, "", 1, max_depth, tree);
+        hnd.close();
+    }
+
+    cout << tree.to_yaml() << endl;
+}
+
 //-----------------------------------------------------------------------------
 int
 main(int argc, char *argv[])
 {
     int retval = 0;
-    if(argc < 2)
+
+    bool tree = false;
+    index_t max_depth = 0;
+    std::vector<std::string> paths;
+    for(int i = 1; i < argc; ++i)
     {
-        std::cerr << "Usage: " << argv[0] << " path [path2 ...]" << std::endl;
+        std::string arg_str(argv[i]);
+        if(arg_str == "--tree")
+        {
+            tree = true;
+        }
+        else if(arg_str == "--depth" && i + 1 < argc)
+        {
+            tree = true;
+            max_depth = utils::string_to_value<index_t>(std::string(argv[i+1]));
+            i++;
+        }
+        else
+        {
+            paths.push_back(arg_str);
+        }
+    }
+
+    if(paths.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " [--tree] [--depth N] path [path2 ...]" << std::endl;
         std::cerr << "\tThis program prints the number of steps and "
                      "domains in a file." << endl;
+        std::cerr << "\t--tree prints the names in the file (hdf5 files are "
+                     "listed without reading data), --depth limits the "
+                     "listing to N levels." << endl;
         retval = -1;
     }
     else
     {
-        for(int i = 1; i < argc; ++i)
+        for(size_t i = 0; i < paths.size(); ++i)
         {
+            const char *path = paths[i].c_str();
             try
             {
-                int nts  = relay::io::query_number_of_steps(argv[i]);
-                int ndom = relay::io::query_number_of_domains(argv[i]);
+                if(tree)
+                {
+                    cout << path << ":" << endl;
+                    print_tree(path, max_depth);
+                    continue;
+                }
 
-                cout << argv[i] << ":" << endl;
+                int nts  = relay::io::query_number_of_steps(path);
+                int ndom = relay::io::query_number_of_domains(path);
+
+                cout << path << ":" << endl;
                 cout << "\tnumber of steps = " << nts << endl;
                 cout << "\tnumber of domains = " << ndom << endl;
-
-                // TODO: print the node names.
             }
             catch(...)
             {
-                cerr << "Error reading " << argv[i] << endl;
+                cerr << "Error reading " << path << endl;
                 retval = -2;
                 break;
             }
@@ -0,0 +1,458 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_shm.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_relay_io_shm.hpp"
+#include "conduit_pack.hpp"
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+
+//-----------------------------------------------------------------------------
+// control segment layout:
+//   [ 0, 8) magic string "CNDTSHMC"
+//   [ 8,16) uint64 generation (accessed atomically)
+//   [16,64) reserved (zeros)
+//-----------------------------------------------------------------------------
+static const char    SHM_MAGIC[8]      = {'C','N','D','T','S','H','M','C'};
+static const index_t SHM_CONTROL_BYTES = 64;
+
+// readers retry when the generation they found is replaced before they
+// map it
+static const int     SHM_OPEN_TRIES    = 16;
+
+//-----------------------------------------------------------------------------
+// posix name of the control segment
+static std::string
+shm_control_name(const std::string &name)
+{
+    std::string res = name;
+    if(!res.empty() && res[0] == '/')
+    {
+        res = res.substr(1);
+    }
+
+    if(res.empty() || res.find('/') != std::string::npos)
+    {
+        CONDUIT_ERROR("conduit_shm: invalid segment name \"" << name << "\""
+                      << " (expected \"name\" or \"/name\")");
+    }
+    return "/" + res;
+}
+
+//-----------------------------------------------------------------------------
+// posix name of the segment that holds a generation's tree
+static std::string
+shm_data_name(const std::string &name, uint64 generation)
+{
+    std::ostringstream oss;
+    oss << shm_control_name(name) << "." << generation;
+    return oss.str();
+}
+
+//-----------------------------------------------------------------------------
+static std::atomic<uint64> *
+shm_generation_ptr(void *control)
+{
+    return reinterpret_cast<std::atomic<uint64>*>((uint8*)control + 8);
+}
+
+//-----------------------------------------------------------------------------
+// maps the control segment, returns NULL if it does not exist and
+// create is false
+static void *
+shm_map_control(const std::string &name, bool create)
+{
+    std::string ctrl_name = shm_control_name(name);
+    int fd = shm_open(ctrl_name.c_str(),
+                      create ? (O_RDWR | O_CREAT) : O_RDONLY,
+                      (S_IRUSR | S_IWUSR));
+    if(fd == -1)
+    {
+        if(!create && errno == ENOENT)
+        {
+            return NULL;
+        }
+        CONDUIT_ERROR("conduit_shm: failed to open segment \""
+                      << ctrl_name << "\": " << strerror(errno));
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        CONDUIT_ERROR("conduit_shm: failed to stat segment \""
+                      << ctrl_name << "\": " << strerror(errno));
+    }
+
+    if((index_t)st.st_size < SHM_CONTROL_BYTES)
+    {
+        if(!create)
+        {
+            // still being created by the writer
+            ::close(fd);
+            return NULL;
+        }
+        // new segments are zero filled, which is generation 0
+        if(ftruncate(fd, (off_t)SHM_CONTROL_BYTES) != 0)
+        {
+            ::close(fd);
+            CONDUIT_ERROR("conduit_shm: failed to size segment \""
+                          << ctrl_name << "\": " << strerror(errno));
+        }
+    }
+
+    void *res = ::mmap(0,
+                       (size_t)SHM_CONTROL_BYTES,
+                       create ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                       MAP_SHARED,
+                       fd,
+                       0);
+    ::close(fd);
+
+    if(res == MAP_FAILED)
+    {
+        CONDUIT_ERROR("conduit_shm: failed to map segment \""
+                      << ctrl_name << "\": " << strerror(errno));
+    }
+
+    if(memcmp(res, SHM_MAGIC, sizeof(SHM_MAGIC)) != 0)
+    {
+        bool zeros = ((const uint8*)res)[0] == 0;
+        if(create && zeros)
+        {
+            memcpy(res, SHM_MAGIC, sizeof(SHM_MAGIC));
+        }
+        else if(!zeros)
+        {
+            munmap(res, (size_t)SHM_CONTROL_BYTES);
+            CONDUIT_ERROR("conduit_shm: segment \"" << ctrl_name
+                          << "\" is not a conduit_shm control segment");
+        }
+    }
+
+    return res;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+uint64
+shm_write(const Node &node,
+          const std::string &name)
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    void *control = shm_map_control(name, true);
+    std::atomic<uint64> *gen_ptr = shm_generation_ptr(control);
+    uint64 generation = gen_ptr->load(std::memory_order_acquire) + 1;
+
+    // write the next generation's segment
+    std::string data_name = shm_data_name(name, generation);
+    // remove any leftover from an interrupted write
+    shm_unlink(data_name.c_str());
+    int fd = shm_open(data_name.c_str(),
+                      (O_RDWR | O_CREAT | O_EXCL),
+                      (S_IRUSR | S_IWUSR));
+    if(fd == -1)
+    {
+        munmap(control, (size_t)SHM_CONTROL_BYTES);
+        CONDUIT_ERROR("conduit_shm: failed to create segment \""
+                      << data_name << "\": " << strerror(errno));
+    }
+
+    index_t nbytes = conduit::pack::packed_bytes(node);
+    void *data = MAP_FAILED;
+    if(ftruncate(fd, (off_t)nbytes) == 0)
+    {
+        data = ::mmap(0,
+                      (size_t)nbytes,
+                      (PROT_READ | PROT_WRITE),
+                      MAP_SHARED,
+                      fd,
+                      0);
+    }
+    int err = errno;
+    ::close(fd);
+
+    if(data == MAP_FAILED)
+    {
+        shm_unlink(data_name.c_str());
+        munmap(control, (size_t)SHM_CONTROL_BYTES);
+        CONDUIT_ERROR("conduit_shm: failed to map segment \""
+                      << data_name << "\" (" << nbytes << " bytes): "
+                      << strerror(err));
+    }
+
+    try
+    {
+        conduit::pack::save(node, data, nbytes);
+    }
+    catch(...)
+    {
+        munmap(data, (size_t)nbytes);
+        shm_unlink(data_name.c_str());
+        munmap(control, (size_t)SHM_CONTROL_BYTES);
+        throw;
+    }
+    munmap(data, (size_t)nbytes);
+
+    // publish it, then drop the previous generation
+    uint64 prev = gen_ptr->exchange(generation, std::memory_order_acq_rel);
+    munmap(control, (size_t)SHM_CONTROL_BYTES);
+
+    if(prev > 0)
+    {
+        shm_unlink(shm_data_name(name, prev).c_str());
+    }
+
+    return generation;
+#else
+    CONDUIT_UNUSED(node);
+    CONDUIT_ERROR("conduit_shm: shared memory segments are not supported "
+                  "on Windows (name = \"" << name << "\")");
+    return 0;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+uint64
+shm_generation(const std::string &name)
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    void *control = shm_map_control(name, false);
+    if(control == NULL)
+    {
+        return 0;
+    }
+    uint64 res = shm_generation_ptr(control)->load(std::memory_order_acquire);
+    munmap(control, (size_t)SHM_CONTROL_BYTES);
+    return res;
+#else
+    CONDUIT_ERROR("conduit_shm: shared memory segments are not supported "
+                  "on Windows (name = \"" << name << "\")");
+    return 0;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+shm_read(const std::string &name,
+         Node &node)
+{
+    shm_read(name, std::string(), node);
+}
+
+//-----------------------------------------------------------------------------
+void
+shm_read(const std::string &name,
+         const std::string &sub_path,
+         Node &node)
+{
+    ShmSegment seg;
+    if(!seg.open(name))
+    {
+        CONDUIT_ERROR("conduit_shm: nothing has been written to segment \""
+                      << name << "\"");
+    }
+
+    if(sub_path.empty())
+    {
+        node.set(seg.node());
+    }
+    else
+    {
+        node.set(seg.node().fetch_existing(sub_path));
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+shm_remove(const std::string &name)
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    uint64 generation = shm_generation(name);
+    if(generation > 0)
+    {
+        shm_unlink(shm_data_name(name, generation).c_str());
+    }
+    shm_unlink(shm_control_name(name).c_str());
+#else
+    CONDUIT_ERROR("conduit_shm: shared memory segments are not supported "
+                  "on Windows (name = \"" << name << "\")");
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// ShmSegment Implementation
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+ShmSegment::ShmSegment()
+: m_data(NULL),
+  m_data_size(0),
+  m_generation(0),
+  m_node()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+ShmSegment::~ShmSegment()
+{
+    close();
+}
+
+//-----------------------------------------------------------------------------
+bool
+ShmSegment::open(const std::string &name)
+{
+    close();
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    for(int i = 0; i < SHM_OPEN_TRIES; i++)
+    {
+        uint64 generation = shm_generation(name);
+        if(generation == 0)
+        {
+            return false;
+        }
+
+        std::string data_name = shm_data_name(name, generation);
+        int fd = shm_open(data_name.c_str(), O_RDONLY, 0);
+        if(fd == -1)
+        {
+            if(errno == ENOENT)
+            {
+                // replaced by a newer generation, try again
+                continue;
+            }
+            CONDUIT_ERROR("conduit_shm: failed to open segment \""
+                          << data_name << "\": " << strerror(errno));
+        }
+
+        struct stat st;
+        if(fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            CONDUIT_ERROR("conduit_shm: failed to stat segment \""
+                          << data_name << "\": " << strerror(errno));
+        }
+
+        index_t nbytes = (index_t)st.st_size;
+        void *data = ::mmap(0,
+                            (size_t)nbytes,
+                            PROT_READ,
+                            MAP_SHARED,
+                            fd,
+                            0);
+        ::close(fd);
+        if(data == MAP_FAILED)
+        {
+            CONDUIT_ERROR("conduit_shm: failed to map segment \""
+                          << data_name << "\": " << strerror(errno));
+        }
+
+        m_data       = data;
+        m_data_size  = nbytes;
+        m_generation = generation;
+
+        Schema schema;
+        conduit::pack::load_schema(m_data, m_data_size, schema);
+        m_node.set_external(schema, m_data);
+        return true;
+    }
+
+    CONDUIT_ERROR("conduit_shm: segment \"" << name << "\" was replaced "
+                  << SHM_OPEN_TRIES << " times while opening it");
+    return false;
+#else
+    CONDUIT_ERROR("conduit_shm: shared memory segments are not supported "
+                  "on Windows (name = \"" << name << "\")");
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool
+ShmSegment::is_open() const
+{
+    return m_data != NULL;
+}
+
+//-----------------------------------------------------------------------------
+uint64
+ShmSegment::generation() const
+{
+    return m_generation;
+}
+
+//-----------------------------------------------------------------------------
+const Node &
+ShmSegment::node() const
+{
+    return m_node;
+}
+
+//-----------------------------------------------------------------------------
+void
+ShmSegment::close()
+{
+    m_node.reset();
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    if(m_data != NULL)
+    {
+        munmap(m_data, (size_t)m_data_size);
+    }
+#endif
+    m_data       = NULL;
+    m_data_size  = 0;
+    m_generation = 0;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,146 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_shm.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_RELAY_IO_SHM_HPP
+#define CONDUIT_RELAY_IO_SHM_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib include
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_node.hpp"
+#include "conduit_relay_exports.h"
+#include "conduit_relay_config.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+///
+/// The "conduit_shm" protocol exchanges trees between processes on the same
+/// node through named POSIX shared memory segments (not available on
+/// Windows).
+///
+/// A name ("name" or "/name", without other "/" characters) refers to a
+/// small control segment that holds the current generation, a counter that
+/// starts at 0 (nothing written) and grows by one with each write. Each
+/// generation's tree lives in its own segment, "/name.<generation>", which
+/// holds conduit_pack data (see conduit_pack.hpp). On Linux these segments
+/// are the files /dev/shm/name.<generation>, which Node::mmap can map
+/// directly.
+///
+/// A write creates the next generation's segment, publishes it in the
+/// control segment and then unlinks the previous generation. Readers that
+/// already mapped an older generation keep a valid mapping. Names are
+/// expected to have a single writer at a time.
+///
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/// writes the node to a new generation of the named segment,
+/// returns the new generation
+//-----------------------------------------------------------------------------
+CONDUIT_RELAY_API uint64 shm_write(const Node &node,
+                                   const std::string &name);
+
+//-----------------------------------------------------------------------------
+/// returns the current generation of the named segment
+/// (0 if nothing has been written)
+//-----------------------------------------------------------------------------
+CONDUIT_RELAY_API uint64 shm_generation(const std::string &name);
+
+//-----------------------------------------------------------------------------
+/// copies the current tree (or the subtree at sub_path) of the named segment
+//-----------------------------------------------------------------------------
+CONDUIT_RELAY_API void shm_read(const std::string &name,
+                                Node &node);
+
+CONDUIT_RELAY_API void shm_read(const std::string &name,
+                                const std::string &sub_path,
+                                Node &node);
+
+//-----------------------------------------------------------------------------
+/// unlinks the control segment and the current generation of the named
+/// segment, existing mappings stay valid
+//-----------------------------------------------------------------------------
+CONDUIT_RELAY_API void shm_remove(const std::string &name);
+
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::relay::io::ShmSegment
+///
+/// Read only, zero copy mapping of one generation of a named segment.
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API ShmSegment
+{
+public:
+    ShmSegment();
+    ~ShmSegment();
+
+    /// maps the current generation of the named segment,
+    /// returns false if nothing has been written to it
+    bool open(const std::string &name);
+
+    bool is_open() const;
+
+    /// generation that is mapped (0 if not open). Compare with
+    /// shm_generation(name) to check for new data.
+    uint64 generation() const;
+
+    /// external view of the mapped tree, valid until close. The mapping
+    /// is read only: changing its values is an error.
+    const Node &node() const;
+
+    void close();
+
+private:
+    ShmSegment(const ShmSegment &);
+    ShmSegment &operator=(const ShmSegment &);
+
+    void    *m_data;
+    index_t  m_data_size;
+    uint64   m_generation;
+    Node     m_node;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
+
+
+#endif
@@ -17,7 +17,9 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <cstring>
 #include <iostream>
+#include <map>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -269,13 +271,97 @@ silo_generate_state_optlist(const Node &n)
     return res;
 }
 
+//---------------------------------------------------------------------------//
+// Returns a buffer of at least num_bytes held by scratch. The buffer only
+// grows, so it is reused by later calls that need the same or fewer bytes.
+//---------------------------------------------------------------------------//
+void *
+silo_scratch_ptr(Node &scratch, index_t num_bytes)
+{
+    if(scratch.dtype().number_of_elements() < num_bytes)
+    {
+        scratch.set(DataType::uint8(num_bytes));
+    }
+    return scratch.data_ptr();
+}
+
+//---------------------------------------------------------------------------//
+// Returns a pointer to the compact values of the leaf n. Compact values are
+// used in place, strided values are copied into scratch.
+//---------------------------------------------------------------------------//
+void *
+silo_compact_values_ptr(const Node &n, Node &scratch)
+{
+    const DataType &dtype = n.dtype();
+    if(dtype.is_compact())
+    {
+        return const_cast<void*>(n.element_ptr(0));
+    }
+
+    const index_t num_eles = dtype.number_of_elements();
+    const index_t ele_bytes = dtype.element_bytes();
+    uint8 *res = (uint8*) silo_scratch_ptr(scratch, num_eles * ele_bytes);
+    for(index_t i = 0; i < num_eles; i++)
+    {
+        memcpy(res + i * ele_bytes, n.element_ptr(i), (size_t)ele_bytes);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// Sets coords_ptrs to the compact x, y (and z) values of a coordset and
+// returns their silo data type.
+//---------------------------------------------------------------------------//
+int
+silo_coords_ptrs(const Node &n_coord_vals,
+                 int num_coords,
+                 Node &scratch,
+                 void *coords_ptrs[3])
+{
+    const char* coordnames[3] = {"x", "y", "z"};
+
+    // silo expects x,y,z to all be the same type
+    DataType dtype = n_coord_vals["x"].dtype();
+
+    int coords_type = 0;
+    if( dtype.is_float() )
+    {
+        coords_type = DB_FLOAT;
+    }
+    else if( dtype.is_double() )
+    {
+        coords_type = DB_DOUBLE;
+    }
+    else
+    {
+        CONDUIT_ERROR("coords data type not implemented, found " <<
+                      dtype.name());
+    }
+
+    for(int i = 0; i < num_coords; i++)
+    {
+        const Node &n_axis = n_coord_vals[coordnames[i]];
+        if(n_axis.dtype().id() != dtype.id())
+        {
+            CONDUIT_ERROR("coords " << coordnames[i] << " type "
+                          << n_axis.dtype().name()
+                          << " does not match x type " << dtype.name());
+        }
+        coords_ptrs[i] = silo_compact_values_ptr(n_axis,
+                                                 scratch[coordnames[i]]);
+    }
+
+    return coords_type;
+}
+
 
 //---------------------------------------------------------------------------//
 void 
 silo_write_field(DBfile *dbfile, 
                  const std::string &var_name,
                  const Node &n_var,
-                 Node &n_mesh_info)
+                 Node &n_mesh_info,
+                 Node &scratch)
 {
 
 
@@ -349,50 +435,40 @@ silo_write_field(DBfile *dbfile,
                            << var_name << "/values");
         }
 
-        // we compact to support a strided array cases
-        Node n_values;
-        n_var["values"].compact_to(n_values);
+        const Node &n_values = n_var["values"];
 
         // create a name
         int vals_type = 0;
-        void *vals_ptr = NULL;
 
-        DataType dtype = n_var["values"].dtype();
+        DataType dtype = n_values.dtype();
 
         if( dtype.is_float() )
         {
             vals_type = DB_FLOAT;
-            vals_ptr = (void*)n_values.as_float_ptr();
         }
         else if( dtype.is_double() )
         {
             vals_type = DB_DOUBLE;
-            vals_ptr = (void*)n_values.as_double_ptr();
         }
         else if( dtype.is_int() )
         {
             vals_type = DB_INT;
-            vals_ptr = (void*)n_values.as_int_ptr();
         }
         else if( dtype.is_long() )
         {
             vals_type = DB_LONG;
-            vals_ptr = (void*)n_values.as_long_ptr();
         }
         else if( dtype.is_long_long() )
         {
             vals_type = DB_LONG_LONG;
-            vals_ptr = (void*)n_values.as_long_long_ptr();
         }
         else if( dtype.is_char() )
         {
             vals_type = DB_CHAR;
-            vals_ptr = (void*)n_values.as_char_ptr();
         }
         else if( dtype.is_short() )
         {
             vals_type = DB_SHORT;
-            vals_ptr = (void*)n_values.as_short_ptr();
         }
         else
         {
@@ -404,6 +480,10 @@ silo_write_field(DBfile *dbfile,
             continue;
         }
 
+        // compact values are passed to silo in place, strided values
+        // are compacted into scratch
+        void *vals_ptr = silo_compact_values_ptr(n_values, scratch);
+
         int silo_error = 0;
     
         if(mesh_type == "unstructured")
@@ -487,7 +567,8 @@ silo_write_pointmesh(DBfile *dbfile,
                      const std::string &topo_name,
                      const Node &n_coords,
                      DBoptlist *state_optlist,
-                     Node &n_mesh_info)
+                     Node &n_mesh_info,
+                     Node &scratch)
 {
     // expects explicit coords
     const Node &n_coord_vals = n_coords["values"];
@@ -506,49 +587,17 @@ silo_write_pointmesh(DBfile *dbfile,
         num_dims = 3;
     }
 
-    Node n_coords_compact;
-    // compaction is necessary to support ragged arrays
-    n_coord_vals.compact_to(n_coords_compact);
-
-    int num_pts = n_coords_compact["x"].dtype().number_of_elements();
+    int num_pts = n_coord_vals["x"].dtype().number_of_elements();
     
     n_mesh_info[topo_name]["num_pts"].set(num_pts);
     n_mesh_info[topo_name]["num_elems"].set(num_pts);
 
-    int coords_dtype = 0;
+    // strided (ragged or interleaved) coords are compacted into scratch
     void *coords_ptrs[3] = {NULL, NULL, NULL};
-
-    // assume x,y,z are all the same type
-    DataType dtype = n_coords_compact["x"].dtype();
-
-    if( dtype.is_float() )
-    {
-        coords_dtype = DB_FLOAT;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_float_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_float_ptr();
-        if(num_dims == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_float_ptr();
-        }
-    }
-    else if( dtype.is_double() )
-
-    {
-        coords_dtype = DB_DOUBLE;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_double_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_double_ptr();
-        if(num_dims == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_double_ptr();
-        }
-    }
-    else
-    {
-        // n_coords["x"].to_double_array(n_convert["x"]);
-        // n_coords["y"].to_double_array(n_convert["y"]);
-        CONDUIT_ERROR("coords data type not implemented, found " << 
-                      dtype.name());
-    }
+    int coords_dtype = silo_coords_ptrs(n_coord_vals,
+                                        num_dims,
+                                        scratch,
+                                        coords_ptrs);
     
 
     int silo_error = DBPutPointmesh(dbfile, // silo file ptr
@@ -563,225 +612,126 @@ silo_write_pointmesh(DBfile *dbfile,
                              " after saving DBPutPointmesh");
 }
 
-//---------------------------------------------------------------------------//
-template<typename T>
-void
-conduit_wedge_connectivity_to_silo(Node &n_mesh_conn)
-{
-    const int conn_size = n_mesh_conn.dtype().number_of_elements();
-    T *conn_ptr = n_mesh_conn.value();
-    for (int i = 0; i < conn_size; i += 6)
-    {
-        auto conn0 = conn_ptr[i + 0];
-        auto conn1 = conn_ptr[i + 1];
-        auto conn2 = conn_ptr[i + 2];
-        auto conn3 = conn_ptr[i + 3];
-        auto conn4 = conn_ptr[i + 4];
-        auto conn5 = conn_ptr[i + 5];
-        conn_ptr[i + 2] = conn0;
-        conn_ptr[i + 1] = conn1;
-        conn_ptr[i + 5] = conn2;
-        conn_ptr[i + 3] = conn3;
-        conn_ptr[i + 0] = conn4;
-        conn_ptr[i + 4] = conn5;
-    }
-}
-
 //---------------------------------------------------------------------------//
 void 
 silo_write_ucd_zonelist(DBfile *dbfile, 
                         const std::string &topo_name,
                         const Node &n_topo,
-                        Node &n_mesh_info)
+                        Node &n_mesh_info,
+                        Node &scratch)
 {
-    Node ucd_zlist;
-    
-    index_t num_shapes = 0;
-    ucd_zlist["shapetype"].set(DataType::c_int(1));
-    ucd_zlist["shapesize"].set(DataType::c_int(1));
-    ucd_zlist["shapecnt"].set(DataType::c_int(1));
-    
     const Node &n_elements = n_topo["elements"];
-    std::string coordset_name = n_topo["coordset"].as_string();
-    
-    bool shape_list = true;
-    
-    if(n_elements.dtype().is_object())
+
+    if(!n_elements.dtype().is_object())
+    {
+        CONDUIT_ERROR("Invalid elements for 'unstructured' case");
+    }
+
+    std::string topo_shape = n_elements["shape"].as_string();
+
+    int shapetype = 0;
+    int shapesize = 0;
+
+    if( topo_shape == "quad")
+    {
+        shapetype = DB_ZONETYPE_QUAD;
+        shapesize = 4;
+    }
+    else if( topo_shape == "tri")
+    {
+        shapetype = DB_ZONETYPE_TRIANGLE;
+        shapesize = 3;
+    }
+    else if( topo_shape == "hex")
+    {
+        shapetype = DB_ZONETYPE_HEX;
+        shapesize = 8;
+    }
+    else if( topo_shape == "wedge")
+    {
+        shapetype = DB_ZONETYPE_PRISM;
+        shapesize = 6;
+    }
+    else if( topo_shape == "pyramid")
+    {
+        shapetype = DB_ZONETYPE_PYRAMID;
+        shapesize = 5;
+    }
+    else if( topo_shape == "tet")
     {
-        // simple path case
-        num_shapes = 1;
+        shapetype = DB_ZONETYPE_TET;
+        shapesize = 4;
     }
-    else if(n_elements.dtype().is_list())
+    else if( topo_shape == "line")
     {
-        shape_list = false;
-        num_shapes = n_elements.number_of_children();
+        shapetype = DB_ZONETYPE_BEAM;
+        shapesize = 2;
     }
     else
     {
-        CONDUIT_ERROR("Invalid elements for 'unstructured' case");
+        CONDUIT_ERROR("Unsupported shape for 'unstructured' case: "
+                      << topo_shape);
     }
-    
-    
-    int *shapetype = ucd_zlist["shapetype"].value();
-    int *shapesize = ucd_zlist["shapesize"].value();
-    int *shapecnt  = ucd_zlist["shapecnt"].value();
-    
-    int total_num_elems = 0;
-    
-    
-    
-    const Node *shape_block = &n_elements;
-    Node n_conn;
-    
-    for(index_t i=0;i < num_shapes;i++)
+
+    const Node &n_mesh_conn = n_elements["connectivity"];
+    const DataType &conn_dtype = n_mesh_conn.dtype();
+
+    // TODO: check for explicit # of elems
+    int conn_len  = (int) conn_dtype.number_of_elements();
+    int num_elems = conn_len / shapesize;
+    int *conn_ptr = NULL;
+
+    // We are using the vtk ordering for our wedges; silo wedges (prisms)
+    // expect a different ordering. Compact int connectivity of other
+    // shapes is passed to silo in place, everything else is converted
+    // (and wedges reordered) into scratch.
+    if(topo_shape != "wedge" && conn_dtype.is_int() && conn_dtype.is_compact())
+    {
+        conn_ptr = (int*) const_cast<void*>(n_mesh_conn.element_ptr(0));
+    }
+    else
     {
-        if(shape_list)
+        conn_ptr = (int*) silo_scratch_ptr(scratch,
+                                           conn_len * (index_t)sizeof(int));
+        index_t_accessor conn = n_mesh_conn.as_index_t_accessor();
+        if(topo_shape == "wedge")
         {
-            // TODO: This is wrong, re work silo logic post bp verify merge
-            //const Node *shape_block = n_elements.child_ptr(i);
-        }
-       
-        std::string topo_shape = shape_block->fetch("shape").as_string();
-
-        Node n_mesh_conn;
-        
-        // We are using the vtk ordering for our wedges; silo wedges (prisms)
-        // expect a different ordering. Thus before we output to silo, we must
-        // change the ordering of each of our wedges.
-        if (topo_shape == "wedge")
-        {
-            n_mesh_conn.set(shape_block->fetch("connectivity"));
-            // swizzle the connectivity
-            if (n_mesh_conn.dtype().is_uint64())
-            {
-                conduit_wedge_connectivity_to_silo<uint64>(n_mesh_conn);
-            }
-            else if (n_mesh_conn.dtype().is_uint32())
-            {
-                conduit_wedge_connectivity_to_silo<uint32>(n_mesh_conn);
-            }
-            else if (n_mesh_conn.dtype().is_int64())
+            for(int i = 0; i + 5 < conn_len; i += 6)
             {
-                conduit_wedge_connectivity_to_silo<int64>(n_mesh_conn);
+                conn_ptr[i + 2] = (int) conn[i + 0];
+                conn_ptr[i + 1] = (int) conn[i + 1];
+                conn_ptr[i + 5] = (int) conn[i + 2];
+                conn_ptr[i + 3] = (int) conn[i + 3];
+                conn_ptr[i + 0] = (int) conn[i + 4];
+                conn_ptr[i + 4] = (int) conn[i + 5];
             }
-            else if (n_mesh_conn.dtype().is_int32())
-            {
-                conduit_wedge_connectivity_to_silo<int32>(n_mesh_conn);
-            }
-            else
-            {
-                CONDUIT_ERROR("Unsupported connectivity type in " << n_mesh_conn.dtype().to_yaml());
-            }
-        }
-        else
-        {
-            n_mesh_conn.set_external(shape_block->fetch("connectivity"));
-        }
-
-        // convert to compact ints ... 
-        if(shape_list)
-        {
-            n_mesh_conn.compact_to(n_conn.append());
         }
         else
         {
-            n_mesh_conn.compact_to(n_conn);
-        }
-
-
-        if( topo_shape == "quad")
-        {
-            // TODO: check for explicit # of elems
-            int num_elems    = n_mesh_conn.dtype().number_of_elements() / 4;
-            shapetype[i] = DB_ZONETYPE_QUAD;
-            shapesize[i] = 4;
-            shapecnt[i]  = num_elems;
-            total_num_elems  += num_elems;
-
-        }
-        else  if( topo_shape == "tri")
-        {
-            // TODO: check for explicit # of elems
-            int num_elems  = n_mesh_conn.dtype().number_of_elements() / 3;
-            shapetype[i]   = DB_ZONETYPE_TRIANGLE;
-            shapesize[i]   = 3;
-            shapecnt[i]    = num_elems;
-            total_num_elems += num_elems;
-        }
-        else if( topo_shape == "hex")
-        {
-            // TODO: check for explicit # of elems
-            int num_elems    = n_mesh_conn.dtype().number_of_elements() / 8;
-            shapetype[i] = DB_ZONETYPE_HEX;
-            shapesize[i] = 8;
-            shapecnt[i]  = num_elems;
-            total_num_elems  += num_elems;
-
-        }
-        else if( topo_shape == "wedge")
-        {
-            // TODO: check for explicit # of elems
-            int num_elems    = n_mesh_conn.dtype().number_of_elements() / 6;
-            shapetype[i] = DB_ZONETYPE_PRISM;
-            shapesize[i] = 6;
-            shapecnt[i]  = num_elems;
-            total_num_elems  += num_elems;
-        }
-        else if( topo_shape == "pyramid")
-        {
-            // TODO: check for explicit # of elems
-            int num_elems    = n_mesh_conn.dtype().number_of_elements() / 5;
-            shapetype[i] = DB_ZONETYPE_PYRAMID;
-            shapesize[i] = 5;
-            shapecnt[i]  = num_elems;
-            total_num_elems  += num_elems;
-        }
-        else  if( topo_shape == "tet")
-        {
-            // TODO: check for explicit # of elems
-            int num_elems  = n_mesh_conn.dtype().number_of_elements() / 4;
-            shapetype[i]   = DB_ZONETYPE_TET;
-            shapesize[i]   = 4;
-            shapecnt[i]    = num_elems;
-            total_num_elems += num_elems;
-        }
-        else  if( topo_shape == "line")
-        {
-            // TODO: check for explicit # of elems
-            int num_elems  = n_mesh_conn.dtype().number_of_elements() / 2;
-            shapetype[i]   = DB_ZONETYPE_BEAM;
-            shapesize[i]   = 2;
-            shapecnt[i]    = num_elems;
-            total_num_elems += num_elems;
+            for(int i = 0; i < conn_len; i++)
+            {
+                conn_ptr[i] = (int) conn[i];
+            }
         }
-        
     }
-    
-    // Final Compaction
-    Node n_conn_final;
-    n_conn.compact_to(n_conn_final);
-
-    int  conn_len = n_conn_final.total_bytes_compact() / sizeof(int);
-    int *conn_ptr = (int*) n_conn_final.data_ptr();
 
-
-    n_mesh_info[topo_name]["num_elems"].set(total_num_elems);
+    n_mesh_info[topo_name]["num_elems"].set(num_elems);
 
     std::string zlist_name = topo_name + "_connectivity";
 
     int silo_error = DBPutZonelist2(dbfile,  // silo file
                                     zlist_name.c_str() ,  // silo obj name
-                                    total_num_elems,  // number of elements
+                                    num_elems,  // number of elements
                                     2,  // spatial dims
                                     conn_ptr,  // connectivity array 
                                     conn_len, // len of connectivity array
                                     0,  // base offset
                                     0,  // # ghosts low
                                     0,  // # ghosts high
-                                    shapetype, // list of shapes ids
-                                    shapesize, // number of points per shape id
-                                    shapecnt,  // number of elements each shape id is used for
-                                    num_shapes,  // number of shapes ids
+                                    &shapetype, // list of shapes ids
+                                    &shapesize, // number of points per shape id
+                                    &num_elems,  // number of elements each shape id is used for
+                                    1,  // number of shapes ids
                                     NULL); // optlist
 
     CONDUIT_CHECK_SILO_ERROR(silo_error,
@@ -797,7 +747,8 @@ silo_write_ucd_mesh(DBfile *dbfile,
                     const std::string &topo_name,
                     const Node &n_coords,
                     DBoptlist *state_optlist,
-                    Node &n_mesh_info)
+                    Node &n_mesh_info,
+                    Node &scratch)
 {
     // also support interleaved:
     // xy, xyz 
@@ -821,49 +772,17 @@ silo_write_ucd_mesh(DBfile *dbfile,
 
     const char* coordnames[3] = {"x", "y", "z"};
 
-    Node n_coords_compact;
-    // compaction is necessary to support ragged arrays
-    n_coord_vals.compact_to(n_coords_compact);
-
-    int num_pts = n_coords_compact["x"].dtype().number_of_elements();
+    int num_pts = n_coord_vals["x"].dtype().number_of_elements();
     // TODO: check that y & z have the same number of points
 
     n_mesh_info[topo_name]["num_pts"].set(num_pts);
 
-    int coords_type = 0;
+    // strided (ragged or interleaved) coords are compacted into scratch
     void *coords_ptrs[3] = {NULL, NULL, NULL};
-
-    // assume x,y,z are all the same type
-    DataType dtype = n_coords_compact["x"].dtype();
-
-    if( dtype.is_float() )
-    {
-        coords_type = DB_FLOAT;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_float_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_float_ptr();
-        if(num_coords == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_float_ptr();
-        }
-    }
-    else if( dtype.is_double() )
-
-    {
-        coords_type = DB_DOUBLE;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_double_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_double_ptr();
-        if(num_coords == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_double_ptr();
-        }
-    }
-    else
-    {
-        // n_coords["x"].to_double_array(n_convert["x"]);
-        // n_coords["y"].to_double_array(n_convert["y"]);
-        CONDUIT_ERROR("coords data type not implemented, found " << 
-                      dtype.name());
-    }
+    int coords_type = silo_coords_ptrs(n_coord_vals,
+                                       num_coords,
+                                       scratch,
+                                       coords_ptrs);
 
     int num_elems = n_mesh_info[topo_name]["num_elems"].value();
     
@@ -893,7 +812,8 @@ silo_write_quad_rect_mesh(DBfile *dbfile,
                           const std::string &topo_name,
                           const Node &n_coords,
                           DBoptlist *state_optlist,
-                          Node &n_mesh_info)
+                          Node &n_mesh_info,
+                          Node &scratch)
 {
     // TODO: also support interleaved:
     // xy, xyz 
@@ -918,21 +838,16 @@ silo_write_quad_rect_mesh(DBfile *dbfile,
     const char* coordnames[3] = {"x", "y", "z"};
 
 
-    Node n_coords_compact;
-    // compaction is necessary to support ragged arrays
-    n_coord_vals.compact_to(n_coords_compact);
-
-
     int pts_dims[3];
-    pts_dims[0] = n_coords_compact["x"].dtype().number_of_elements();
-    pts_dims[1] = n_coords_compact["y"].dtype().number_of_elements();
+    pts_dims[0] = n_coord_vals["x"].dtype().number_of_elements();
+    pts_dims[1] = n_coord_vals["y"].dtype().number_of_elements();
     pts_dims[2] = 1;
     
     int num_pts = pts_dims[0]* pts_dims[1];
     int num_elems = (pts_dims[0]-1)*(pts_dims[1]-1);
     if(num_coords == 3)
     {
-        pts_dims[2] = n_coords_compact["z"].dtype().number_of_elements();
+        pts_dims[2] = n_coord_vals["z"].dtype().number_of_elements();
         num_pts   = num_pts * pts_dims[2];
         num_elems = num_elems * (pts_dims[2]-1);
     }
@@ -946,39 +861,12 @@ silo_write_quad_rect_mesh(DBfile *dbfile,
         n_mesh_info[topo_name]["elements/k"] = pts_dims[2]-1;
     }
     
-    int coords_dtype = 0;
+    // strided coords are compacted into scratch
     void *coords_ptrs[3] = {NULL, NULL, NULL};
-
-    // assume x,y,z are all the same type
-    DataType dtype = n_coords_compact["x"].dtype();
-
-    if( dtype.is_float() )
-    {
-        coords_dtype = DB_FLOAT;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_float_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_float_ptr();
-        if(num_coords == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_float_ptr();
-        }
-    }
-    else if( dtype.is_double() )
-    {
-        coords_dtype = DB_DOUBLE;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_double_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_double_ptr();
-        if(num_coords == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_double_ptr();
-        }
-    }
-    else
-    {
-        // n_coords["x"].to_double_array(n_convert["x"]);
-        // n_coords["y"].to_double_array(n_convert["y"]);
-        CONDUIT_ERROR("coords data type not implemented, found " << 
-                      dtype.name());
-    }
+    int coords_dtype = silo_coords_ptrs(n_coord_vals,
+                                        num_coords,
+                                        scratch,
+                                        coords_ptrs);
 
     int silo_error = DBPutQuadmesh(dbfile, // silo file ptr
                                    topo_name.c_str(), // mesh name
@@ -1000,7 +888,8 @@ silo_write_quad_uniform_mesh(DBfile *dbfile,
                              const std::string &topo_name,
                              const Node &n_coords,
                              DBoptlist *state_optlist,
-                             Node &n_mesh_info)
+                             Node &n_mesh_info,
+                             Node &scratch)
 {
     // TODO: USE XFORM expand uniform coords to rect-style
 
@@ -1135,7 +1024,8 @@ silo_write_quad_uniform_mesh(DBfile *dbfile,
                               topo_name,
                               n_rect_coords,
                               state_optlist,
-                              n_mesh_info);
+                              n_mesh_info,
+                              scratch);
 
 }
 
@@ -1147,7 +1037,8 @@ silo_write_structured_mesh(DBfile *dbfile,
                            const Node &n_topo,
                            const Node &n_coords,
                            DBoptlist *state_optlist,
-                           Node &n_mesh_info)
+                           Node &n_mesh_info,
+                           Node &scratch)
 {
     // also support interleaved:
     // xy, xyz 
@@ -1173,49 +1064,17 @@ silo_write_structured_mesh(DBfile *dbfile,
 
     const char* coordnames[3] = {"x", "y", "z"};
 
-    Node n_coords_compact;
-    // compaction is necessary to support ragged arrays
-    n_coords_vals.compact_to(n_coords_compact);
-
-    int num_pts = n_coords_compact["x"].dtype().number_of_elements();
+    int num_pts = n_coords_vals["x"].dtype().number_of_elements();
     // TODO: check that y & z have the same number of points
 
     n_mesh_info[topo_name]["num_pts"].set(num_pts);
 
-    int coords_dtype = 0;
+    // strided (ragged or interleaved) coords are compacted into scratch
     void *coords_ptrs[3] = {NULL, NULL, NULL};
-
-    // assume x,y,z are all the same type
-    DataType dtype = n_coords_compact["x"].dtype();
-
-    if( dtype.is_float() )
-    {
-        coords_dtype = DB_FLOAT;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_float_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_float_ptr();
-        if(num_coords == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_float_ptr();
-        }
-    }
-    else if( dtype.is_double() )
-
-    {
-        coords_dtype = DB_DOUBLE;
-        coords_ptrs[0] = (void*)n_coords_compact["x"].as_double_ptr();
-        coords_ptrs[1] = (void*)n_coords_compact["y"].as_double_ptr();
-        if(num_coords == 3)
-        {
-            coords_ptrs[2] = (void*)n_coords_compact["z"].as_double_ptr();
-        }
-    }
-    else
-    {
-        // n_coords["x"].to_double_array(n_convert["x"]);
-        // n_coords["y"].to_double_array(n_convert["y"]);
-        CONDUIT_ERROR("coords data type not implemented, found " << 
-                      dtype.name());
-    }
+    int coords_dtype = silo_coords_ptrs(n_coords_vals,
+                                        num_coords,
+                                        scratch,
+                                        coords_ptrs);
     
     int ele_dims[3];
     ele_dims[0] = n_topo["elements/dims/i"].to_value();
@@ -1266,6 +1125,49 @@ silo_write_structured_mesh(DBfile *dbfile,
 
 
 
+//---------------------------------------------------------------------------//
+// Creates each missing directory of path (relative to the current silo
+// directory) and changes to it.
+//---------------------------------------------------------------------------//
+void
+silo_make_and_set_dir(DBfile *dbfile,
+                      const std::string &path)
+{
+    std::string next = path;
+
+    // a leading "/" starts from the silo root dir, the empty path
+    // component it leaves is skipped below
+    if(!next.empty() && next[0] == '/')
+    {
+        CONDUIT_CHECK_SILO_ERROR(DBSetDir(dbfile,"/"),
+                                 " changing to silo root directory");
+    }
+
+    while(!next.empty())
+    {
+        std::string curr;
+        std::string rest;
+        conduit::utils::split_path(next, curr, rest);
+        next = rest;
+
+        if(curr.empty())
+        {
+            continue;
+        }
+
+        int silo_error = 0;
+        if(!DBInqVarExists(dbfile,curr.c_str()))
+        {
+            silo_error += DBMkDir(dbfile,curr.c_str());
+        }
+        silo_error += DBSetDir(dbfile,curr.c_str());
+
+        CONDUIT_CHECK_SILO_ERROR(silo_error,
+                                 " failed to make silo directory:"
+                                 << path);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void 
 silo_mesh_write(const Node &n,
@@ -1278,17 +1180,20 @@ silo_mesh_write(const Node &n,
     if(!silo_obj_path.empty())
     {
         silo_error += DBGetDir(dbfile,silo_prev_dir);
-        silo_error += DBMkDir(dbfile,silo_obj_path.c_str());
-        silo_error += DBSetDir(dbfile,silo_obj_path.c_str());
-    
+
         CONDUIT_CHECK_SILO_ERROR(silo_error,
-                                 " failed to make silo directory:"
-                                 << silo_obj_path);
+                                 " failed to get current silo directory");
+
+        silo_make_and_set_dir(dbfile,silo_obj_path);
     }
 
     DBoptlist *state_optlist = silo_generate_state_optlist(n);
     
     Node n_mesh_info; // helps with bookkeeping for all topos
+
+    // buffers for the data that has to be converted or compacted for
+    // silo, reused by all topologies and fields
+    Node scratch;
     
     NodeConstIterator topo_itr = n["topologies"].children();
     while(topo_itr.has_next())
@@ -1312,7 +1217,8 @@ silo_mesh_write(const Node &n,
                 silo_write_ucd_zonelist(dbfile,
                                         topo_name,
                                         n_topo,
-                                        n_mesh_info);
+                                        n_mesh_info,
+                                        scratch["connectivity"]);
             }
             else
             {
@@ -1350,7 +1256,8 @@ silo_mesh_write(const Node &n,
                                 topo_name,
                                 n_coords,
                                 state_optlist,
-                                n_mesh_info);
+                                n_mesh_info,
+                                scratch["coords"]);
         }
         else if (topo_type == "rectilinear")
         {
@@ -1358,7 +1265,8 @@ silo_mesh_write(const Node &n,
                                       topo_name,
                                       n_coords,
                                       state_optlist,
-                                      n_mesh_info);
+                                      n_mesh_info,
+                                      scratch["coords"]);
         }
         else if (topo_type == "uniform")
         {
@@ -1366,7 +1274,8 @@ silo_mesh_write(const Node &n,
                                          topo_name,
                                          n_coords,
                                          state_optlist,
-                                         n_mesh_info);
+                                         n_mesh_info,
+                                         scratch["coords"]);
 
         }
         else if (topo_type == "structured")
@@ -1376,7 +1285,8 @@ silo_mesh_write(const Node &n,
                                        n_topo,
                                        n_coords,
                                        state_optlist,
-                                       n_mesh_info);
+                                       n_mesh_info,
+                                       scratch["coords"]);
         }
         else if (topo_type == "points")
         {
@@ -1384,7 +1294,8 @@ silo_mesh_write(const Node &n,
                                  topo_name,
                                  n_coords,
                                  state_optlist,
-                                 n_mesh_info);
+                                 n_mesh_info,
+                                 scratch["coords"]);
         }
     }
 
@@ -1400,7 +1311,8 @@ silo_mesh_write(const Node &n,
             silo_write_field(dbfile,
                              var_name,
                              n_var,
-                             n_mesh_info);
+                             n_mesh_info,
+                             scratch["values"]);
             
         }
     }
@@ -1467,6 +1379,962 @@ void silo_mesh_write(const Node &node,
     }
 }
 
+//---------------------------------------------------------------------------//
+void
+silo_write_multimesh(const Node &mesh_index,
+                     const std::vector<std::string> &block_paths,
+                     DBfile *dbfile)
+{
+    int num_blocks = (int) block_paths.size();
+
+    // silo takes the cycle and time by pointer, keep them alive
+    // until the optlist is freed
+    int    cyc_value  = 0;
+    double time_value = 0.0;
+    int silo_error = 0;
+
+    DBoptlist *state_optlist = DBMakeOptlist(2);
+
+    if(mesh_index.has_path("state/cycle"))
+    {
+        cyc_value = mesh_index["state/cycle"].to_int();
+        silo_error += DBAddOption(state_optlist,
+                                  DBOPT_CYCLE,
+                                  &cyc_value);
+    }
+
+    if(mesh_index.has_path("state/time"))
+    {
+        time_value = mesh_index["state/time"].to_double();
+        silo_error += DBAddOption(state_optlist,
+                                  DBOPT_DTIME,
+                                  &time_value);
+    }
+
+    CONDUIT_CHECK_SILO_ERROR(silo_error,
+                             " creating state optlist (time, cycle) ");
+
+    std::vector<std::string> block_names(num_blocks);
+    std::vector<char*> block_name_ptrs(num_blocks);
+    std::vector<int> block_types(num_blocks);
+
+    // silo var type of each topology, used for the multivars
+    Node var_types;
+
+    NodeConstIterator topo_itr = mesh_index["topologies"].children();
+    while(topo_itr.has_next())
+    {
+        const Node &n_topo = topo_itr.next();
+        std::string topo_name = topo_itr.name();
+        std::string topo_type = n_topo["type"].as_string();
+
+        int mesh_type = 0;
+        int var_type  = 0;
+
+        if(topo_type == "points" ||
+           (topo_type == "unstructured" &&
+            n_topo.has_path("elements/shape") &&
+            n_topo["elements/shape"].as_string() == "point"))
+        {
+            mesh_type = DB_POINTMESH;
+            var_type  = DB_POINTVAR;
+        }
+        else if(topo_type == "unstructured")
+        {
+            mesh_type = DB_UCDMESH;
+            var_type  = DB_UCDVAR;
+        }
+        else if(topo_type == "uniform" || topo_type == "rectilinear")
+        {
+            mesh_type = DB_QUAD_RECT;
+            var_type  = DB_QUADVAR;
+        }
+        else if(topo_type == "structured")
+        {
+            mesh_type = DB_QUAD_CURV;
+            var_type  = DB_QUADVAR;
+        }
+        else
+        {
+            CONDUIT_ERROR("Unsupported topology type for silo multimesh: "
+                          << topo_type);
+        }
+
+        var_types[topo_name] = var_type;
+
+        for(int i = 0; i < num_blocks; i++)
+        {
+            block_names[i] = block_paths[i] + "/" + topo_name;
+            block_name_ptrs[i] = const_cast<char*>(block_names[i].c_str());
+            block_types[i] = mesh_type;
+        }
+
+        silo_error = DBPutMultimesh(dbfile,
+                                    topo_name.c_str(),
+                                    num_blocks,
+                                    &block_name_ptrs[0],
+                                    &block_types[0],
+                                    state_optlist);
+
+        CONDUIT_CHECK_SILO_ERROR(silo_error,
+                                 " DBPutMultimesh " << topo_name);
+    }
+
+    if(mesh_index.has_child("fields"))
+    {
+        NodeConstIterator field_itr = mesh_index["fields"].children();
+        while(field_itr.has_next())
+        {
+            const Node &n_field = field_itr.next();
+            std::string field_name = field_itr.name();
+            std::string topo_name  = n_field["topology"].as_string();
+
+            if(!var_types.has_child(topo_name))
+            {
+                CONDUIT_ERROR("Invalid linked topology! "
+                              << "fields/"
+                              << field_name << "/topology: "
+                              << topo_name);
+            }
+
+            int var_type = var_types[topo_name].to_int();
+
+            for(int i = 0; i < num_blocks; i++)
+            {
+                block_names[i] = block_paths[i] + "/" + field_name;
+                block_name_ptrs[i] = const_cast<char*>(block_names[i].c_str());
+                block_types[i] = var_type;
+            }
+
+            silo_error = DBPutMultivar(dbfile,
+                                       field_name.c_str(),
+                                       num_blocks,
+                                       &block_name_ptrs[0],
+                                       &block_types[0],
+                                       state_optlist);
+
+            CONDUIT_CHECK_SILO_ERROR(silo_error,
+                                     " DBPutMultivar " << field_name);
+        }
+    }
+
+    silo_error = DBFreeOptlist(state_optlist);
+
+    CONDUIT_CHECK_SILO_ERROR(silo_error,
+                             " freeing state optlist.");
+}
+
+//---------------------------------------------------------------------------//
+// Copies num_values values of silo data type silo_type at ptr into dest.
+//---------------------------------------------------------------------------//
+void
+silo_read_values(int silo_type,
+                 const void *ptr,
+                 index_t num_values,
+                 Node &dest)
+{
+    DataType dtype;
+    if(silo_type == DB_FLOAT)
+    {
+        dtype = DataType::c_float(num_values);
+    }
+    else if(silo_type == DB_DOUBLE)
+    {
+        dtype = DataType::c_double(num_values);
+    }
+    else if(silo_type == DB_INT)
+    {
+        dtype = DataType::c_int(num_values);
+    }
+    else if(silo_type == DB_LONG)
+    {
+        dtype = DataType::c_long(num_values);
+    }
+    else if(silo_type == DB_LONG_LONG)
+    {
+        dtype = DataType::c_long_long(num_values);
+    }
+    else if(silo_type == DB_CHAR)
+    {
+        dtype = DataType::c_char(num_values);
+    }
+    else if(silo_type == DB_SHORT)
+    {
+        dtype = DataType::c_short(num_values);
+    }
+    else
+    {
+        CONDUIT_ERROR("Unsupported silo data type: " << silo_type);
+    }
+
+    Node n_src;
+    n_src.set_external(dtype, const_cast<void*>(ptr));
+    dest.set(n_src);
+}
+
+//---------------------------------------------------------------------------//
+// Copies the coordinate arrays of a silo mesh into coordset values.
+// num_values holds the number of values of each axis.
+//---------------------------------------------------------------------------//
+void
+silo_read_coords(int silo_type,
+                 void **coords,
+                 int num_coords,
+                 const index_t num_values[3],
+                 Node &n_coord_vals)
+{
+    const char* coordnames[3] = {"x", "y", "z"};
+
+    for(int i = 0; i < num_coords && i < 3; i++)
+    {
+        silo_read_values(silo_type,
+                         coords[i],
+                         num_values[i],
+                         n_coord_vals[coordnames[i]]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Returns the blueprint shape of a silo zone shape. Older files may not
+// record shape types, those are inferred from the shape size.
+//---------------------------------------------------------------------------//
+std::string
+silo_shape_name(int shapetype,
+                int shapesize,
+                int num_dims)
+{
+    if(shapetype == DB_ZONETYPE_QUAD)
+    {
+        return "quad";
+    }
+    else if(shapetype == DB_ZONETYPE_TRIANGLE)
+    {
+        return "tri";
+    }
+    else if(shapetype == DB_ZONETYPE_HEX)
+    {
+        return "hex";
+    }
+    else if(shapetype == DB_ZONETYPE_PRISM)
+    {
+        return "wedge";
+    }
+    else if(shapetype == DB_ZONETYPE_PYRAMID)
+    {
+        return "pyramid";
+    }
+    else if(shapetype == DB_ZONETYPE_TET)
+    {
+        return "tet";
+    }
+    else if(shapetype == DB_ZONETYPE_BEAM)
+    {
+        return "line";
+    }
+    else if(shapetype == 0)
+    {
+        if(shapesize == 2)
+        {
+            return "line";
+        }
+        else if(shapesize == 3)
+        {
+            return "tri";
+        }
+        else if(shapesize == 4)
+        {
+            return num_dims == 3 ? "tet" : "quad";
+        }
+        else if(shapesize == 5)
+        {
+            return "pyramid";
+        }
+        else if(shapesize == 6)
+        {
+            return "wedge";
+        }
+        else if(shapesize == 8)
+        {
+            return "hex";
+        }
+    }
+
+    CONDUIT_ERROR("Unsupported silo zone shape: type " << shapetype
+                  << " size " << shapesize);
+    return "";
+}
+
+//---------------------------------------------------------------------------//
+// Sets mesh/state from the cycle and time of a silo mesh, unless the state
+// was already read from another topology.
+//---------------------------------------------------------------------------//
+void
+silo_read_state(int cycle,
+                double dtime,
+                Node &mesh)
+{
+    if(!mesh.has_child("state"))
+    {
+        mesh["state/cycle"] = cycle;
+        mesh["state/time"]  = dtime;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+silo_read_ucd_mesh(DBfile *dbfile,
+                   const std::string &obj_name,
+                   const std::string &topo_name,
+                   const std::string &coordset_name,
+                   Node &mesh)
+{
+    // only the coords and zones are needed, skip facelists, ghost and
+    // global node and zone ids
+    unsigned long long prev_mask = DBSetDataReadMask2(DBUMCoords |
+                                                      DBUMZonelist |
+                                                      DBZonelistInfo);
+    DBucdmesh *ucd = DBGetUcdmesh(dbfile, obj_name.c_str());
+    DBSetDataReadMask2(prev_mask);
+
+    if(ucd == NULL)
+    {
+        CONDUIT_ERROR("Error reading silo ucd mesh: " << obj_name);
+    }
+
+    DBzonelist *zones = ucd->zones;
+    if(zones == NULL || zones->nshapes != 1)
+    {
+        DBFreeUcdmesh(ucd);
+        CONDUIT_ERROR("silo ucd mesh " << obj_name << " must have a"
+                      " zonelist with a single shape type");
+    }
+
+    int shapetype = zones->shapetype != NULL ? zones->shapetype[0] : 0;
+    int shapesize = zones->shapesize[0];
+    int conn_len  = zones->shapecnt[0] * shapesize;
+
+    std::string shape;
+    try
+    {
+        shape = silo_shape_name(shapetype, shapesize, zones->ndims);
+    }
+    catch(...)
+    {
+        DBFreeUcdmesh(ucd);
+        throw;
+    }
+
+    Node &n_coords = mesh["coordsets"][coordset_name];
+    n_coords["type"] = "explicit";
+    index_t num_pts[3] = {ucd->nnodes, ucd->nnodes, ucd->nnodes};
+    silo_read_coords(ucd->datatype,
+                     ucd->coords,
+                     ucd->ndims,
+                     num_pts,
+                     n_coords["values"]);
+
+    Node &n_topo = mesh["topologies"][topo_name];
+    n_topo["type"] = "unstructured";
+    n_topo["coordset"] = coordset_name;
+    n_topo["elements/shape"] = shape;
+
+    Node &n_conn = n_topo["elements/connectivity"];
+    n_conn.set(DataType::c_int(conn_len));
+    int *conn = n_conn.value();
+    const int *silo_conn = zones->nodelist;
+    int origin = zones->origin;
+
+    // silo wedges (prisms) use a different ordering than our (vtk)
+    // wedges, undo the reordering silo_write_ucd_zonelist applies
+    if(shape == "wedge")
+    {
+        for(int i = 0; i + 5 < conn_len; i += 6)
+        {
+            conn[i + 0] = silo_conn[i + 2] - origin;
+            conn[i + 1] = silo_conn[i + 1] - origin;
+            conn[i + 2] = silo_conn[i + 5] - origin;
+            conn[i + 3] = silo_conn[i + 3] - origin;
+            conn[i + 4] = silo_conn[i + 0] - origin;
+            conn[i + 5] = silo_conn[i + 4] - origin;
+        }
+    }
+    else
+    {
+        for(int i = 0; i < conn_len; i++)
+        {
+            conn[i] = silo_conn[i] - origin;
+        }
+    }
+
+    silo_read_state(ucd->cycle, ucd->dtime, mesh);
+
+    DBFreeUcdmesh(ucd);
+}
+
+//---------------------------------------------------------------------------//
+void
+silo_read_quad_mesh(DBfile *dbfile,
+                    const std::string &obj_name,
+                    const std::string &topo_name,
+                    const std::string &coordset_name,
+                    Node &mesh)
+{
+    unsigned long long prev_mask = DBSetDataReadMask2(DBQMCoords);
+    DBquadmesh *quad = DBGetQuadmesh(dbfile, obj_name.c_str());
+    DBSetDataReadMask2(prev_mask);
+
+    if(quad == NULL)
+    {
+        CONDUIT_ERROR("Error reading silo quad mesh: " << obj_name);
+    }
+
+    int num_dims = quad->ndims;
+
+    Node &n_coords = mesh["coordsets"][coordset_name];
+    Node &n_topo = mesh["topologies"][topo_name];
+    n_topo["coordset"] = coordset_name;
+
+    index_t num_pts[3] = {1, 1, 1};
+    if(quad->coordtype == DB_COLLINEAR)
+    {
+        n_coords["type"] = "rectilinear";
+        n_topo["type"] = "rectilinear";
+        for(int i = 0; i < num_dims; i++)
+        {
+            num_pts[i] = quad->dims[i];
+        }
+    }
+    else
+    {
+        n_coords["type"] = "explicit";
+        n_topo["type"] = "structured";
+
+        const char* dimnames[3] = {"i", "j", "k"};
+        index_t total_pts = 1;
+        for(int i = 0; i < num_dims; i++)
+        {
+            total_pts *= quad->dims[i];
+            n_topo["elements/dims"][dimnames[i]] = quad->dims[i] - 1;
+        }
+        num_pts[0] = num_pts[1] = num_pts[2] = total_pts;
+    }
+
+    silo_read_coords(quad->datatype,
+                     quad->coords,
+                     num_dims,
+                     num_pts,
+                     n_coords["values"]);
+
+    silo_read_state(quad->cycle, quad->dtime, mesh);
+
+    DBFreeQuadmesh(quad);
+}
+
+//---------------------------------------------------------------------------//
+void
+silo_read_pointmesh(DBfile *dbfile,
+                    const std::string &obj_name,
+                    const std::string &topo_name,
+                    const std::string &coordset_name,
+                    Node &mesh)
+{
+    unsigned long long prev_mask = DBSetDataReadMask2(DBPMCoords);
+    DBpointmesh *pts = DBGetPointmesh(dbfile, obj_name.c_str());
+    DBSetDataReadMask2(prev_mask);
+
+    if(pts == NULL)
+    {
+        CONDUIT_ERROR("Error reading silo point mesh: " << obj_name);
+    }
+
+    Node &n_coords = mesh["coordsets"][coordset_name];
+    n_coords["type"] = "explicit";
+    index_t num_pts[3] = {pts->nels, pts->nels, pts->nels};
+    silo_read_coords(pts->datatype,
+                     pts->coords,
+                     pts->ndims,
+                     num_pts,
+                     n_coords["values"]);
+
+    Node &n_topo = mesh["topologies"][topo_name];
+    n_topo["type"] = "points";
+    n_topo["coordset"] = coordset_name;
+
+    silo_read_state(pts->cycle, pts->dtime, mesh);
+
+    DBFreePointmesh(pts);
+}
+
+//---------------------------------------------------------------------------//
+// Returns the name of the mesh of the silo var obj_name, reading only the
+// var's header.
+//---------------------------------------------------------------------------//
+std::string
+silo_var_mesh_name(DBfile *dbfile,
+                   int var_type,
+                   const std::string &obj_name)
+{
+    std::string res;
+
+    unsigned long long prev_mask = DBSetDataReadMask2(DBNone);
+    if(var_type == DB_UCDVAR)
+    {
+        DBucdvar *var = DBGetUcdvar(dbfile, obj_name.c_str());
+        if(var != NULL)
+        {
+            res = var->meshname;
+            DBFreeUcdvar(var);
+        }
+    }
+    else if(var_type == DB_QUADVAR)
+    {
+        DBquadvar *var = DBGetQuadvar(dbfile, obj_name.c_str());
+        if(var != NULL)
+        {
+            res = var->meshname;
+            DBFreeQuadvar(var);
+        }
+    }
+    else if(var_type == DB_POINTVAR)
+    {
+        DBmeshvar *var = DBGetPointvar(dbfile, obj_name.c_str());
+        if(var != NULL)
+        {
+            res = var->meshname;
+            DBFreeMeshvar(var);
+        }
+    }
+    DBSetDataReadMask2(prev_mask);
+
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// Reads the silo var obj_name as field field_name on topology topo_name.
+// When topo_name is empty, the var's mesh is looked up by its silo object
+// name in mesh_topos; vars on meshes that were not read are skipped
+// without reading their data.
+//---------------------------------------------------------------------------//
+void
+silo_read_field(DBfile *dbfile,
+                const std::string &obj_name,
+                const std::string &field_name,
+                const std::string &topo_name_in,
+                const Node &mesh_topos,
+                Node &mesh)
+{
+    int var_type = DBGetVarType(dbfile, obj_name.c_str());
+
+    unsigned long long data_mask = DBNone;
+    if(var_type == DB_UCDVAR)
+    {
+        data_mask = DBUVData;
+    }
+    else if(var_type == DB_QUADVAR)
+    {
+        data_mask = DBQVData;
+    }
+    else if(var_type == DB_POINTVAR)
+    {
+        data_mask = DBPVData;
+    }
+    else
+    {
+        CONDUIT_INFO("skipping field " << field_name
+                     << ", since its silo var type is not implemented,"
+                     " found " << var_type);
+        return;
+    }
+
+    std::string topo_name = topo_name_in;
+    if(topo_name.empty())
+    {
+        std::string mesh_obj, mesh_dir;
+        conduit::utils::rsplit_path(silo_var_mesh_name(dbfile,
+                                                       var_type,
+                                                       obj_name),
+                                    mesh_obj,
+                                    mesh_dir);
+        if(mesh_obj.empty() || !mesh_topos.has_child(mesh_obj))
+        {
+            return;
+        }
+        topo_name = mesh_topos[mesh_obj].as_string();
+    }
+
+    DBucdvar  *ucd_var  = NULL;
+    DBquadvar *quad_var = NULL;
+    DBmeshvar *pt_var   = NULL;
+
+    void *vals     = NULL;
+    int datatype   = 0;
+    int num_vals   = 0;
+    int num_comps  = 0;
+    int centering  = DB_NODECENT;
+
+    unsigned long long prev_mask = DBSetDataReadMask2(data_mask);
+    if(var_type == DB_UCDVAR)
+    {
+        ucd_var = DBGetUcdvar(dbfile, obj_name.c_str());
+        if(ucd_var != NULL)
+        {
+            vals      = ucd_var->vals != NULL ? ucd_var->vals[0] : NULL;
+            datatype  = ucd_var->datatype;
+            num_vals  = ucd_var->nels;
+            num_comps = ucd_var->nvals;
+            centering = ucd_var->centering;
+        }
+    }
+    else if(var_type == DB_QUADVAR)
+    {
+        quad_var = DBGetQuadvar(dbfile, obj_name.c_str());
+        if(quad_var != NULL)
+        {
+            vals      = quad_var->vals != NULL ? quad_var->vals[0] : NULL;
+            datatype  = quad_var->datatype;
+            num_vals  = quad_var->nels;
+            num_comps = quad_var->nvals;
+            // silo aligns zone centered quad vars at the zone centers (0.5)
+            centering = quad_var->align[0] == 0.0f ? DB_NODECENT
+                                                   : DB_ZONECENT;
+        }
+    }
+    else
+    {
+        pt_var = DBGetPointvar(dbfile, obj_name.c_str());
+        if(pt_var != NULL)
+        {
+            vals      = pt_var->vals != NULL ? pt_var->vals[0] : NULL;
+            datatype  = pt_var->datatype;
+            num_vals  = pt_var->nels;
+            num_comps = pt_var->nvals;
+        }
+    }
+    DBSetDataReadMask2(prev_mask);
+
+    bool read_ok = vals != NULL;
+    bool supported = num_comps == 1 &&
+                     (centering == DB_NODECENT || centering == DB_ZONECENT);
+
+    if(read_ok && supported)
+    {
+        Node &n_field = mesh["fields"][field_name];
+        n_field["topology"] = topo_name;
+        n_field["association"] = centering == DB_ZONECENT ? "element"
+                                                           : "vertex";
+        silo_read_values(datatype, vals, num_vals, n_field["values"]);
+    }
+
+    if(ucd_var != NULL)
+    {
+        DBFreeUcdvar(ucd_var);
+    }
+    if(quad_var != NULL)
+    {
+        DBFreeQuadvar(quad_var);
+    }
+    if(pt_var != NULL)
+    {
+        DBFreeMeshvar(pt_var);
+    }
+
+    if(!read_ok)
+    {
+        CONDUIT_ERROR("Error reading silo var: " << obj_name);
+    }
+
+    if(!supported)
+    {
+        CONDUIT_INFO("skipping field " << field_name
+                     << ", only scalar node and zone centered silo vars"
+                     " are supported");
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Changes to the silo directory of obj_path (relative to the current
+// directory, or absolute) and returns the object's name in it.
+//---------------------------------------------------------------------------//
+std::string
+silo_set_obj_dir(DBfile *dbfile,
+                 const std::string &obj_path)
+{
+    std::string obj_name, obj_dir;
+    conduit::utils::rsplit_path(obj_path, obj_name, obj_dir);
+
+    if(obj_dir.empty() && !obj_path.empty() && obj_path[0] == '/')
+    {
+        obj_dir = "/";
+    }
+
+    if(!obj_dir.empty())
+    {
+        CONDUIT_CHECK_SILO_ERROR(DBSetDir(dbfile, obj_dir.c_str()),
+                                 " changing to silo directory " << obj_dir);
+    }
+
+    return obj_name;
+}
+
+//---------------------------------------------------------------------------//
+// Returns the file of a silo object path: "file:path" objects are in
+// (already opened or newly opened) other_files, the others in dbfile.
+// obj_path receives the path of the object in its file.
+//---------------------------------------------------------------------------//
+DBfile *
+silo_obj_file(DBfile *dbfile,
+              const std::string &path,
+              std::map<std::string, DBfile*> &other_files,
+              std::string &obj_path)
+{
+    std::string file_path;
+    conduit::utils::split_file_path(path,
+                                    std::string(":"),
+                                    file_path,
+                                    obj_path);
+    if(obj_path.empty())
+    {
+        obj_path = path;
+        return dbfile;
+    }
+
+    std::map<std::string, DBfile*>::iterator itr = other_files.find(file_path);
+    if(itr != other_files.end())
+    {
+        return itr->second;
+    }
+
+    DBfile *res = DBOpen(file_path.c_str(), DB_UNKNOWN, DB_READ);
+    if(res == NULL)
+    {
+        CONDUIT_ERROR("Error opening Silo file for reading: " << file_path);
+    }
+    other_files[file_path] = res;
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+silo_read_multimesh_toc(DBfile *dbfile,
+                        Node &toc)
+{
+    toc.reset();
+
+    // the toc is only valid until the next silo call, copy the names
+    DBtoc *db_toc = DBGetToc(dbfile);
+    if(db_toc == NULL)
+    {
+        CONDUIT_ERROR("Error reading silo table of contents");
+    }
+
+    std::vector<std::string> mesh_names(db_toc->multimesh_names,
+                                        db_toc->multimesh_names +
+                                            db_toc->nmultimesh);
+    std::vector<std::string> var_names(db_toc->multivar_names,
+                                       db_toc->multivar_names +
+                                           db_toc->nmultivar);
+
+    Node &n_meshes = toc["multimeshes"];
+    n_meshes.set(DataType::object());
+    for(size_t i = 0; i < mesh_names.size(); i++)
+    {
+        DBmultimesh *mm = DBGetMultimesh(dbfile, mesh_names[i].c_str());
+        if(mm == NULL || mm->meshnames == NULL)
+        {
+            if(mm != NULL)
+            {
+                DBFreeMultimesh(mm);
+            }
+            CONDUIT_ERROR("Error reading silo multimesh: " << mesh_names[i]
+                          << " (multimeshes with name schemes are not"
+                          " supported)");
+        }
+
+        Node &n_mesh = n_meshes.add_child(mesh_names[i]);
+        Node &n_blocks = n_mesh["blocks"];
+        n_blocks.set(DataType::list());
+        for(int b = 0; b < mm->nblocks; b++)
+        {
+            n_blocks.append().set(std::string(mm->meshnames[b]));
+        }
+        if(mm->meshtypes != NULL)
+        {
+            n_mesh["types"].set(mm->meshtypes, mm->nblocks);
+        }
+
+        DBFreeMultimesh(mm);
+    }
+
+    Node &n_vars = toc["multivars"];
+    n_vars.set(DataType::object());
+    for(size_t i = 0; i < var_names.size(); i++)
+    {
+        DBmultivar *mv = DBGetMultivar(dbfile, var_names[i].c_str());
+        if(mv == NULL || mv->varnames == NULL)
+        {
+            if(mv != NULL)
+            {
+                DBFreeMultivar(mv);
+            }
+            CONDUIT_ERROR("Error reading silo multivar: " << var_names[i]
+                          << " (multivars with name schemes are not"
+                          " supported)");
+        }
+
+        Node &n_var = n_vars.add_child(var_names[i]);
+        Node &n_blocks = n_var["blocks"];
+        n_blocks.set(DataType::list());
+        for(int b = 0; b < mv->nvars; b++)
+        {
+            n_blocks.append().set(std::string(mv->varnames[b]));
+        }
+        if(mv->vartypes != NULL)
+        {
+            n_var["types"].set(mv->vartypes, mv->nvars);
+        }
+
+        DBFreeMultivar(mv);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+silo_mesh_read(DBfile *dbfile,
+               const Node &objects,
+               Node &mesh)
+{
+    // files of objects outside dbfile
+    std::map<std::string, DBfile*> other_files;
+
+    try
+    {
+        // silo object name -> topology name, to find the topology
+        // of fields read without one
+        Node mesh_topos;
+
+        if(objects.has_child("topologies"))
+        {
+            NodeConstIterator itr = objects["topologies"].children();
+            while(itr.has_next())
+            {
+                const Node &n_obj = itr.next();
+                std::string topo_name = itr.name();
+                std::string coordset_name = topo_name;
+                if(n_obj.has_child("coordset"))
+                {
+                    coordset_name = n_obj["coordset"].as_string();
+                }
+
+                std::string obj_path;
+                DBfile *obj_file = silo_obj_file(dbfile,
+                                                 n_obj["path"].as_string(),
+                                                 other_files,
+                                                 obj_path);
+                char prev_dir[256];
+                CONDUIT_CHECK_SILO_ERROR(DBGetDir(obj_file, prev_dir),
+                                     " failed to get current silo directory");
+                std::string obj_name = silo_set_obj_dir(obj_file, obj_path);
+                mesh_topos.add_child(obj_name).set(topo_name);
+
+                int mesh_type = DBGetVarType(obj_file, obj_name.c_str());
+                if(mesh_type == DB_UCDMESH)
+                {
+                    silo_read_ucd_mesh(obj_file,
+                                       obj_name,
+                                       topo_name,
+                                       coordset_name,
+                                       mesh);
+                }
+                else if(mesh_type == DB_QUADMESH ||
+                        mesh_type == DB_QUAD_RECT ||
+                        mesh_type == DB_QUAD_CURV)
+                {
+                    silo_read_quad_mesh(obj_file,
+                                        obj_name,
+                                        topo_name,
+                                        coordset_name,
+                                        mesh);
+                }
+                else if(mesh_type == DB_POINTMESH)
+                {
+                    silo_read_pointmesh(obj_file,
+                                        obj_name,
+                                        topo_name,
+                                        coordset_name,
+                                        mesh);
+                }
+                else
+                {
+                    CONDUIT_ERROR("Unsupported silo mesh type for "
+                                  << obj_path << ": " << mesh_type);
+                }
+
+                CONDUIT_CHECK_SILO_ERROR(DBSetDir(obj_file, prev_dir),
+                                 " changing silo directory to previous path");
+            }
+        }
+
+        if(objects.has_child("fields"))
+        {
+            NodeConstIterator itr = objects["fields"].children();
+            while(itr.has_next())
+            {
+                const Node &n_obj = itr.next();
+                std::string field_name = itr.name();
+                std::string topo_name;
+                if(n_obj.has_child("topology"))
+                {
+                    topo_name = n_obj["topology"].as_string();
+                    // skip fields on topologies that were not read
+                    if(!mesh.has_path("topologies") ||
+                       !mesh["topologies"].has_child(topo_name))
+                    {
+                        continue;
+                    }
+                }
+
+                std::string obj_path;
+                DBfile *obj_file = silo_obj_file(dbfile,
+                                                 n_obj["path"].as_string(),
+                                                 other_files,
+                                                 obj_path);
+                char prev_dir[256];
+                CONDUIT_CHECK_SILO_ERROR(DBGetDir(obj_file, prev_dir),
+                                     " failed to get current silo directory");
+                std::string obj_name = silo_set_obj_dir(obj_file, obj_path);
+
+                silo_read_field(obj_file,
+                                obj_name,
+                                field_name,
+                                topo_name,
+                                mesh_topos,
+                                mesh);
+
+                CONDUIT_CHECK_SILO_ERROR(DBSetDir(obj_file, prev_dir),
+                                 " changing silo directory to previous path");
+            }
+        }
+    }
+    catch(...)
+    {
+        std::map<std::string, DBfile*>::iterator itr;
+        for(itr = other_files.begin(); itr != other_files.end(); itr++)
+        {
+            DBClose(itr->second);
+        }
+        throw;
+    }
+
+    std::map<std::string, DBfile*>::iterator itr;
+    for(itr = other_files.begin(); itr != other_files.end(); itr++)
+    {
+        if(DBClose(itr->second) != 0)
+        {
+            CONDUIT_ERROR("Error closing Silo file: " << itr->first);
+        }
+    }
+}
+
 
 }
 //-----------------------------------------------------------------------------
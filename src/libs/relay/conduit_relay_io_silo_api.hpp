@@ -53,4 +53,51 @@ void CONDUIT_RELAY_API silo_mesh_write(const Node &mesh,
                                        DBfile *dbfile,
                                        const std::string &silo_obj_path);
 
+//-----------------------------------------------------------------------------
+/// Writes a multimesh for each topology and a multivar for each field of
+/// a blueprint mesh index to dbfile, tying together domains written with
+/// silo_mesh_write. block_paths holds the silo path of each domain
+/// ("file:dir", or "dir" for domains in dbfile), relative to dbfile.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API silo_write_multimesh(const Node &mesh_index,
+                                            const std::vector<std::string> &block_paths,
+                                            DBfile *dbfile);
+
+//-----------------------------------------------------------------------------
+/// Reads the multimeshes and multivars of the current silo directory of
+/// dbfile, without reading any of their blocks:
+///
+///   multimeshes/{name}/blocks: ["{block path}", ...]
+///   multimeshes/{name}/types: [{silo mesh type}, ...]
+///   multivars/{name}/blocks: ["{block path}", ...]
+///   multivars/{name}/types: [{silo var type}, ...]
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API silo_read_multimesh_toc(DBfile *dbfile,
+                                               Node &toc);
+
+//-----------------------------------------------------------------------------
+/// Reads the listed silo meshes and vars of one domain into a blueprint
+/// mesh. Only these objects are read, and only the arrays blueprint needs
+/// (coords, zonelists and var values, see DBSetDataReadMask2).
+///
+/// objects:
+///   topologies/{topo name}/path: "{silo mesh path}"
+///   topologies/{topo name}/coordset: "{coordset name}" (default: topo name)
+///   fields/{field name}/path: "{silo var path}"
+///   fields/{field name}/topology: "{topo name}" (optional)
+///
+/// Paths are relative to the current directory of dbfile, or
+/// "{file}:{path}" for objects in other files. Fields without a topology
+/// use the topology read from their silo mesh; fields on topologies that
+/// were not read are skipped without reading their values.
+///
+/// Quad meshes are read as rectilinear or structured topologies (uniform
+/// topologies written by silo_mesh_write come back as rectilinear), point
+/// meshes as points topologies. Only scalar node and zone centered vars
+/// are read.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API silo_mesh_read(DBfile *dbfile,
+                                      const Node &objects,
+                                      Node &mesh);
+
 #endif
@@ -0,0 +1,171 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_stats.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay_io_stats.hpp"
+
+//-----------------------------------------------------------------------------
+// standard lib includes
+//-----------------------------------------------------------------------------
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+// accumulated stats, shared by all threads
+//-----------------------------------------------------------------------------
+namespace
+{
+
+//---------------------------------------------------------------------------//
+bool
+stats_enabled_from_env()
+{
+    const char *env = std::getenv("CONDUIT_RELAY_IO_STATS");
+    return env != NULL && std::string(env) != "" && std::string(env) != "0";
+}
+
+//---------------------------------------------------------------------------//
+std::atomic<bool> &
+stats_enabled_flag()
+{
+    static std::atomic<bool> res(stats_enabled_from_env());
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+std::mutex &
+stats_mutex()
+{
+    static std::mutex res;
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+stats_node()
+{
+    static Node res;
+    return res;
+}
+
+}
+
+//---------------------------------------------------------------------------//
+void
+set_stats_enabled(bool value)
+{
+    stats_enabled_flag() = value;
+}
+
+//---------------------------------------------------------------------------//
+bool
+stats_enabled()
+{
+    return stats_enabled_flag();
+}
+
+//---------------------------------------------------------------------------//
+void
+stats(Node &out)
+{
+    std::lock_guard<std::mutex> lock(stats_mutex());
+    out.set(stats_node());
+}
+
+//---------------------------------------------------------------------------//
+void
+reset_stats()
+{
+    std::lock_guard<std::mutex> lock(stats_mutex());
+    stats_node().reset();
+}
+
+//---------------------------------------------------------------------------//
+void
+add_stats(const char *backend,
+          const char *operation,
+          double seconds,
+          index_t bytes)
+{
+    std::lock_guard<std::mutex> lock(stats_mutex());
+    Node &op = stats_node()[backend][operation];
+    if(!op.has_child("count"))
+    {
+        op["count"] = (int64) 0;
+        op["time"]  = 0.0;
+        op["bytes"] = (int64) 0;
+    }
+
+    op["count"].set((int64) (op["count"].as_int64() + 1));
+    op["time"].set(op["time"].as_float64() + seconds);
+    op["bytes"].set((int64) (op["bytes"].as_int64() + bytes));
+}
+
+//---------------------------------------------------------------------------//
+StatsTimer::StatsTimer(const char *backend,
+                       const char *operation,
+                       index_t bytes)
+: m_backend(backend),
+  m_operation(operation),
+  m_bytes(bytes),
+  m_active(stats_enabled()),
+  m_timer()
+{}
+
+//---------------------------------------------------------------------------//
+StatsTimer::~StatsTimer()
+{
+    finish();
+}
+
+//---------------------------------------------------------------------------//
+void
+StatsTimer::finish()
+{
+    if(m_active)
+    {
+        add_stats(m_backend, m_operation, m_timer.elapsed(), m_bytes);
+        m_active = false;
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
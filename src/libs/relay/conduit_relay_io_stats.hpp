@@ -0,0 +1,123 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_stats.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_RELAY_IO_STATS_HPP
+#define CONDUIT_RELAY_IO_STATS_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib include
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_relay_exports.h"
+#include "conduit_relay_config.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+/// I/O instrumentation
+///
+/// When enabled, relay accumulates the number of calls, elapsed seconds
+/// and bytes of its i/o operations, per backend and operation:
+///
+///   <backend>:
+///     <operation>:
+///       count: number of calls
+///       time:  elapsed seconds
+///       bytes: bytes of node data written or read
+///
+/// Backends are the relay protocols ("hdf5", "conduit_bin", ...).
+/// relay::io::save and load record "save" and "load" for each protocol,
+/// the hdf5 backend also records "file_open", "file_close",
+/// "compatibility_check", "dataset_create", "dataset_write",
+/// "dataset_read", "dataset_read_info", "compress" and "decompress"
+/// (threaded gzip chunk filtering). Operations may be nested
+/// (for example "save" includes "dataset_write"), so their times should
+/// not be summed.
+///
+/// Instrumentation is disabled by default. It is enabled by
+/// set_stats_enabled(true), or by setting the CONDUIT_RELAY_IO_STATS
+/// environment variable to a value other than "0" before relay is used.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API set_stats_enabled(bool value);
+bool CONDUIT_RELAY_API stats_enabled();
+
+/// copies the accumulated stats into out
+void CONDUIT_RELAY_API stats(Node &out);
+
+/// clears the accumulated stats
+void CONDUIT_RELAY_API reset_stats();
+
+/// adds one call of an operation, used by the relay backends
+void CONDUIT_RELAY_API add_stats(const char *backend,
+                                 const char *operation,
+                                 double seconds,
+                                 index_t bytes);
+
+//-----------------------------------------------------------------------------
+/// Times an operation from construction until destruction (or finish()),
+/// and adds it to the stats when they are enabled.
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API StatsTimer
+{
+public:
+    StatsTimer(const char *backend,
+               const char *operation,
+               index_t bytes = 0);
+    ~StatsTimer();
+
+    /// sets the bytes recorded for this operation
+    void set_bytes(index_t bytes) { m_bytes = bytes; }
+
+    /// records the operation now, instead of at destruction
+    void finish();
+
+private:
+    StatsTimer(const StatsTimer &);
+    StatsTimer &operator=(const StatsTimer &);
+
+    const char          *m_backend;
+    const char          *m_operation;
+    index_t              m_bytes;
+    bool                 m_active;
+    conduit::utils::Timer m_timer;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
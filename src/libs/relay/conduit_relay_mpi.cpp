@@ -9,8 +9,20 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_relay_mpi.hpp"
+
+// OpenMPI reports CUDA (and ROCm) aware builds in mpi-ext.h
+#if defined(OPEN_MPI) && OPEN_MPI
+#include <mpi-ext.h>
+#endif
+
 #include <iostream>
 #include <limits>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <mutex>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 /// The CONDUIT_CHECK_MPI_ERROR macro is used to check return values for 
@@ -35,25 +47,2741 @@
     }                                                               \
 }
 
-
-//-----------------------------------------------------------------------------
-// -- begin conduit:: --
-//-----------------------------------------------------------------------------
-namespace conduit
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// Messages larger than INT_MAX bytes.
+//
+// MPI counts are ints. A byte count that doesn't fit in an int is passed as
+// one element of a derived datatype instead: a struct with a block of
+// LARGE_MESSAGE_CHUNK_BYTES sized contiguous types and a block with the
+// remaining bytes, whose extent is the byte count. Its type signature is a
+// sequence of bytes, so it matches (num_bytes, MPI_BYTE) on the other side.
+// This only needs MPI-3, not the MPI-4 large count ("_c") functions.
+//
+// Tests lower the int limit and chunk size with set_large_count_limits to
+// run these paths with small messages.
+//---------------------------------------------------------------------------//
+
+// default size of the contiguous chunks of a large byte count datatype
+static const index_t LARGE_MESSAGE_CHUNK_BYTES = 1 << 30;
+
+// largest count passed to MPI as is, and the chunk size of large byte count
+// datatypes (see set_large_count_limits)
+static index_t large_count_max   = std::numeric_limits<int>::max();
+static index_t large_count_chunk = LARGE_MESSAGE_CHUNK_BYTES;
+
+//---------------------------------------------------------------------------//
+void
+set_large_count_limits(index_t max_count,
+                       index_t chunk_bytes)
+{
+    if(max_count < 1 ||
+       !conduit::utils::value_fits<index_t,int>(max_count) ||
+       chunk_bytes < 1 ||
+       chunk_bytes > max_count)
+    {
+        CONDUIT_ERROR("Invalid large count limits: max_count = " << max_count
+                      << ", chunk_bytes = " << chunk_bytes);
+    }
+    large_count_max   = max_count;
+    large_count_chunk = chunk_bytes;
+}
+
+//---------------------------------------------------------------------------//
+void
+reset_large_count_limits()
+{
+    large_count_max   = std::numeric_limits<int>::max();
+    large_count_chunk = LARGE_MESSAGE_CHUNK_BYTES;
+}
+
+//---------------------------------------------------------------------------//
+// true if value can be passed to MPI as a count
+//---------------------------------------------------------------------------//
+bool
+fits_count(index_t value)
+{
+    return value >= 0 && value <= large_count_max;
+}
+
+//---------------------------------------------------------------------------//
+// creates and commits a datatype for num_bytes contiguous bytes
+//---------------------------------------------------------------------------//
+int
+create_bytes_datatype(index_t num_bytes,
+                      MPI_Datatype &dtype)
+{
+    index_t num_chunks = num_bytes / large_count_chunk;
+    index_t rem_bytes  = num_bytes % large_count_chunk;
+
+    if(!fits_count(num_chunks))
+    {
+        return MPI_ERR_COUNT;
+    }
+
+    int          block_lens[2];
+    MPI_Aint     displs[2];
+    MPI_Datatype types[2];
+
+    int mpi_error = MPI_Type_contiguous(
+                        static_cast<int>(large_count_chunk),
+                        MPI_BYTE,
+                        &types[0]);
+    if(mpi_error != MPI_SUCCESS)
+    {
+        return mpi_error;
+    }
+
+    block_lens[0] = static_cast<int>(num_chunks);
+    displs[0]     = 0;
+    block_lens[1] = static_cast<int>(rem_bytes);
+    displs[1]     = (MPI_Aint)(num_chunks * large_count_chunk);
+    types[1]      = MPI_BYTE;
+
+    mpi_error = MPI_Type_create_struct(2,
+                                       block_lens,
+                                       displs,
+                                       types,
+                                       &dtype);
+    MPI_Type_free(&types[0]);
+
+    if(mpi_error == MPI_SUCCESS)
+    {
+        mpi_error = MPI_Type_commit(&dtype);
+    }
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// (count, type) pair for num_bytes contiguous bytes: (num_bytes, MPI_BYTE)
+// when it fits in an int, otherwise (1, large byte count datatype). The
+// datatype is freed with the ByteCount, operations that are still pending
+// are not affected.
+//---------------------------------------------------------------------------//
+class ByteCount
+{
+public:
+    explicit ByteCount(index_t num_bytes)
+    : m_count(0),
+      m_type(MPI_BYTE)
+    {
+        if(fits_count(num_bytes))
+        {
+            m_count = static_cast<int>(num_bytes);
+        }
+        else if(create_bytes_datatype(num_bytes, m_type) == MPI_SUCCESS)
+        {
+            m_count = 1;
+        }
+        else
+        {
+            m_type = MPI_BYTE;
+            CONDUIT_ERROR("Failed to create an MPI datatype for "
+                          << num_bytes << " bytes");
+        }
+    }
+
+    ~ByteCount()
+    {
+        if(m_type != MPI_BYTE)
+        {
+            MPI_Type_free(&m_type);
+        }
+    }
+
+    int          count() const { return m_count; }
+    MPI_Datatype type()  const { return m_type; }
+
+private:
+    ByteCount(const ByteCount &);
+    ByteCount &operator=(const ByteCount &);
+
+    int          m_count;
+    MPI_Datatype m_type;
+};
+
+//---------------------------------------------------------------------------//
+// Profiling
+//
+// Each public call opens a StatsScope. The outermost scope on a thread
+// owns the call: relay::mpi calls made inside it (staging, composed
+// collectives) add their messages and times to it instead of counting as
+// calls of their own. StatsTimers time individual MPI calls by phase.
+// When stats are disabled both only check a flag. Annotation callbacks (and
+// conduit's timing annotations, when compiled in) run for outermost scopes
+// whether stats are enabled or not.
+//---------------------------------------------------------------------------//
+enum StatsPhase
+{
+    STATS_SCHEMA,
+    STATS_DATA,
+    STATS_WAIT
+};
+
+//---------------------------------------------------------------------------//
+struct OpStats
+{
+    OpStats()
+    : calls(0),
+      messages(0),
+      bytes_sent(0),
+      bytes_received(0),
+      time(0.0),
+      schema_time(0.0),
+      data_time(0.0),
+      wait_time(0.0)
+    {}
+
+    void add(const OpStats &other)
+    {
+        calls          += other.calls;
+        messages       += other.messages;
+        bytes_sent     += other.bytes_sent;
+        bytes_received += other.bytes_received;
+        time           += other.time;
+        schema_time    += other.schema_time;
+        data_time      += other.data_time;
+        wait_time      += other.wait_time;
+    }
+
+    void to_node(Node &res) const
+    {
+        res["calls"]          = calls;
+        res["messages"]       = messages;
+        res["bytes_sent"]     = bytes_sent;
+        res["bytes_received"] = bytes_received;
+        res["time"]           = time;
+        res["schema_time"]    = schema_time;
+        res["data_time"]      = data_time;
+        res["wait_time"]      = wait_time;
+        // time spent outside of MPI calls: compaction, serialization,
+        // copies and bookkeeping
+        float64 conduit_time = time - schema_time - data_time - wait_time;
+        res["conduit_time"]   = conduit_time > 0.0 ? conduit_time : 0.0;
+    }
+
+    uint64  calls;
+    uint64  messages;
+    uint64  bytes_sent;
+    uint64  bytes_received;
+    float64 time;
+    float64 schema_time;
+    float64 data_time;
+    float64 wait_time;
+};
+
+//---------------------------------------------------------------------------//
+struct StatsRegistry
+{
+    StatsRegistry()
+    : enabled(false),
+      begin_callback(NULL),
+      end_callback(NULL)
+    {}
+
+    bool                            enabled;
+    annotation_callback             begin_callback;
+    annotation_callback             end_callback;
+    // keyed by the (literal) operation names
+    std::map<const char *, OpStats> ops;
+    std::mutex                      mutex;
+};
+
+//---------------------------------------------------------------------------//
+StatsRegistry &
+stats_registry()
+{
+    static StatsRegistry registry;
+    return registry;
+}
+
+//---------------------------------------------------------------------------//
+struct StatsThreadState
+{
+    int         depth;
+    bool        timing;
+    const char *op;
+    float64     start;
+    OpStats     current;
+};
+
+//---------------------------------------------------------------------------//
+StatsThreadState &
+stats_thread_state()
+{
+    static thread_local StatsThreadState state = {0, false, NULL, 0.0,
+                                                  OpStats()};
+    return state;
+}
+
+//---------------------------------------------------------------------------//
+class StatsScope
+{
+public:
+    explicit StatsScope(const char *op)
+    : m_outermost(false)
+    {
+        StatsThreadState &state = stats_thread_state();
+        if(state.depth++ > 0)
+        {
+            return;
+        }
+
+        m_outermost = true;
+        StatsRegistry &registry = stats_registry();
+        if(registry.begin_callback != NULL)
+        {
+            registry.begin_callback(op);
+        }
+        CONDUIT_ANNOTATE_MARK_BEGIN(op);
+
+        state.op     = op;
+        state.timing = registry.enabled;
+        if(state.timing)
+        {
+            state.current = OpStats();
+            state.start   = MPI_Wtime();
+        }
+    }
+
+    ~StatsScope()
+    {
+        StatsThreadState &state = stats_thread_state();
+        state.depth--;
+        if(!m_outermost)
+        {
+            return;
+        }
+
+        StatsRegistry &registry = stats_registry();
+        if(state.timing)
+        {
+            state.current.calls = 1;
+            state.current.time  = MPI_Wtime() - state.start;
+            state.timing = false;
+
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.ops[state.op].add(state.current);
+        }
+
+        CONDUIT_ANNOTATE_MARK_END(state.op);
+        if(registry.end_callback != NULL)
+        {
+            registry.end_callback(state.op);
+        }
+    }
+
+private:
+    StatsScope(const StatsScope &);
+    StatsScope &operator=(const StatsScope &);
+
+    bool m_outermost;
+};
+
+//---------------------------------------------------------------------------//
+// Times MPI calls from construction to stop() (or destruction) into the
+// current call's stats. Schema and data timers count one message with the
+// given bytes.
+//---------------------------------------------------------------------------//
+class StatsTimer
+{
+public:
+    explicit StatsTimer(StatsPhase phase,
+                        index_t bytes_sent = 0,
+                        index_t bytes_received = 0)
+    : m_phase(phase),
+      m_bytes_sent(bytes_sent),
+      m_bytes_received(bytes_received),
+      m_start(0.0),
+      m_active(stats_thread_state().timing)
+    {
+        if(m_active)
+        {
+            m_start = MPI_Wtime();
+        }
+    }
+
+    ~StatsTimer()
+    {
+        stop();
+    }
+
+    void stop()
+    {
+        if(!m_active)
+        {
+            return;
+        }
+        m_active = false;
+
+        OpStats &current = stats_thread_state().current;
+        float64 elapsed = MPI_Wtime() - m_start;
+        if(m_phase == STATS_WAIT)
+        {
+            current.wait_time += elapsed;
+            return;
+        }
+
+        if(m_phase == STATS_SCHEMA)
+        {
+            current.schema_time += elapsed;
+        }
+        else
+        {
+            current.data_time += elapsed;
+        }
+        current.messages++;
+        current.bytes_sent     += (uint64)m_bytes_sent;
+        current.bytes_received += (uint64)m_bytes_received;
+    }
+
+private:
+    StatsTimer(const StatsTimer &);
+    StatsTimer &operator=(const StatsTimer &);
+
+    StatsPhase m_phase;
+    index_t    m_bytes_sent;
+    index_t    m_bytes_received;
+    float64    m_start;
+    bool       m_active;
+};
+
+//---------------------------------------------------------------------------//
+// Derived datatypes for non-compact nodes.
+//
+// node_datatype() describes the leaves of a node with an MPI datatype whose
+// type map holds the same bytes, in the same order, as the compact form of
+// the node (see compact_to). Strided leaves use an hvector of their
+// elements, and the leaves are combined with a struct type whose
+// displacements are relative to the first leaf. Sends can use the datatype
+// on the node's own memory instead of a compact copy, and receives can
+// place data directly into a node that already has the sender's layout.
+//
+// Datatypes are cached by leaf layout (relative displacements, element
+// sizes, counts and strides), since the same node (or one laid out the same
+// way) is usually sent many times. Cached types are freed when MPI is
+// finalized.
+//---------------------------------------------------------------------------//
+
+// cached types, cleared once it holds this many
+static const size_t DATATYPE_CACHE_MAX_ENTRIES = 256;
+
+//---------------------------------------------------------------------------//
+struct DatatypeCache
+{
+    DatatypeCache()
+    : keyval(MPI_KEYVAL_INVALID)
+    {}
+
+    void free_types()
+    {
+        std::map<std::vector<int64>, MPI_Datatype>::iterator itr;
+        for(itr = types.begin(); itr != types.end(); itr++)
+        {
+            MPI_Type_free(&itr->second);
+        }
+        types.clear();
+    }
+
+    std::map<std::vector<int64>, MPI_Datatype> types;
+    int                                        keyval;
+    std::mutex                                 mutex;
+};
+
+//---------------------------------------------------------------------------//
+DatatypeCache &
+datatype_cache()
+{
+    static DatatypeCache cache;
+    return cache;
+}
+
+//---------------------------------------------------------------------------//
+// attribute delete callback on MPI_COMM_SELF, MPI_Finalize calls it before
+// it shuts down
+//---------------------------------------------------------------------------//
+int
+free_datatype_cache(MPI_Comm /*comm*/,
+                    int /*keyval*/,
+                    void * /*attr_val*/,
+                    void * /*extra_state*/)
+{
+    DatatypeCache &cache = datatype_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.free_types();
+    cache.keyval = MPI_KEYVAL_INVALID;
+    return MPI_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+struct LeafLayout
+{
+    const uint8 *ptr;
+    index_t      element_bytes;
+    index_t      num_elements;
+    index_t      stride;
+};
+
+//---------------------------------------------------------------------------//
+// collects the leaves of node in compact_to order, returns false if a leaf
+// with data has no memory
+//---------------------------------------------------------------------------//
+bool
+collect_leaves(const Node &node,
+               std::vector<LeafLayout> &leaves)
+{
+    const DataType &dt = node.dtype();
+    if(dt.is_object() || dt.is_list())
+    {
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            if(!collect_leaves(itr.next(), leaves))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if(dt.is_empty() || dt.number_of_elements() == 0)
+    {
+        return true;
+    }
+
+    LeafLayout leaf;
+    leaf.ptr           = (const uint8*)node.element_ptr(0);
+    leaf.element_bytes = dt.element_bytes();
+    leaf.num_elements  = dt.number_of_elements();
+    leaf.stride        = dt.stride();
+
+    if(leaf.ptr == NULL)
+    {
+        return false;
+    }
+
+    leaves.push_back(leaf);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// hash of the schema of node (names, dtypes and number of elements, not
+// offsets or strides), it matches the hash of its compact form
+//---------------------------------------------------------------------------//
+uint64
+schema_hash(const Node &node)
+{
+    Node opts;
+    opts["data"] = "false";
+    return node.hash(opts);
+}
+
+//---------------------------------------------------------------------------//
+// hash (64-bit FNV-1a) of the addresses, sizes and strides of the leaves of
+// node, persistent requests on node's memory are valid while it matches
+//---------------------------------------------------------------------------//
+uint64
+leaf_layout_hash(const Node &node)
+{
+    std::vector<LeafLayout> leaves;
+    if(!collect_leaves(node, leaves))
+    {
+        return 0;
+    }
+
+    std::vector<uint64> vals;
+    vals.reserve(leaves.size() * 4 + 1);
+    vals.push_back((uint64)leaves.size());
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        vals.push_back((uint64)(uintptr_t)leaves[i].ptr);
+        vals.push_back((uint64)leaves[i].element_bytes);
+        vals.push_back((uint64)leaves[i].num_elements);
+        vals.push_back((uint64)leaves[i].stride);
+    }
+
+    uint64 hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < vals.size(); i++)
+    {
+        for(int b = 0; b < 8; b++)
+        {
+            hash ^= (vals[i] >> (8 * b)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+//---------------------------------------------------------------------------//
+// Device memory.
+//
+// Leaves allocated with device allocators (see utils::set_device_allocator)
+// can't be handed to an MPI library that isn't device aware. Those nodes
+// are staged through compact host buffers (allocated with the staging
+// allocator); the copies use the allocators' memcpy handlers.
+//---------------------------------------------------------------------------//
+bool
+has_device_data(const Node &node)
+{
+    if(utils::is_device_allocator(node.allocator()))
+    {
+        return true;
+    }
+
+    index_t num_children = node.number_of_children();
+    for(index_t i = 0; i < num_children; i++)
+    {
+        if(has_device_data(node.child(i)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+bool
+needs_host_staging(const Node &node)
+{
+    return !mpi::device_aware() && has_device_data(node);
+}
+
+//---------------------------------------------------------------------------//
+// compact host copy of node
+//---------------------------------------------------------------------------//
+void
+stage_to_host(const Node &node,
+              Node &host)
+{
+    host.reset();
+    host.set_allocator(mpi::staging_allocator());
+    node.compact_to(host);
+}
+
+//---------------------------------------------------------------------------//
+// compact host buffer with the schema of node, for receives
+//---------------------------------------------------------------------------//
+void
+host_buffer(const Node &node,
+            Node &host)
+{
+    Schema s_compact;
+    node.schema().compact_to(s_compact);
+    host.reset();
+    host.set_allocator(mpi::staging_allocator());
+    host.set_schema(s_compact);
+}
+
+//---------------------------------------------------------------------------//
+// copies received host values to node, node gets the schema of host
+// (in its own memory space) if they aren't compatible
+//---------------------------------------------------------------------------//
+void
+stage_from_host(const Node &host,
+                Node &node)
+{
+    if(!node.dtype().is_empty() && node.compatible(host))
+    {
+        node.update(host);
+    }
+    else
+    {
+        node.set(host);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Buffer pools
+//
+// Blocks are kept in free lists by size (powers of two, at least
+// BUFFER_POOL_MIN_BLOCK_BYTES). A pool is attached to its comm as an
+// attribute. When the comm is freed (or the pool is replaced) while blocks
+// are in use, the pool is deleted when the last one is returned.
+//---------------------------------------------------------------------------//
+
+static const index_t BUFFER_POOL_MIN_BLOCK_BYTES = 4096;
+static const index_t BUFFER_POOL_DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+//---------------------------------------------------------------------------//
+class BufferPool
+{
+public:
+    BufferPool(index_t max_bytes,
+               index_t allocator_id,
+               bool mpi_alloc_mem)
+    : m_max_bytes(max_bytes),
+      m_allocator_id(allocator_id),
+      m_mpi_alloc_mem(mpi_alloc_mem),
+      m_idle_bytes(0),
+      m_in_use_bytes(0),
+      m_hits(0),
+      m_misses(0),
+      m_detached(false)
+    {}
+
+    ~BufferPool()
+    {
+        std::map<index_t, std::vector<void*> >::iterator itr;
+        for(itr = m_idle.begin(); itr != m_idle.end(); itr++)
+        {
+            for(size_t i = 0; i < itr->second.size(); i++)
+            {
+                free_block(itr->second[i]);
+            }
+        }
+    }
+
+    // returns a block of at least num_bytes
+    void *acquire(index_t num_bytes)
+    {
+        index_t block_bytes = BUFFER_POOL_MIN_BLOCK_BYTES;
+        while(block_bytes < num_bytes)
+        {
+            block_bytes <<= 1;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        void *block = NULL;
+        std::vector<void*> &idle = m_idle[block_bytes];
+        if(!idle.empty())
+        {
+            block = idle.back();
+            idle.pop_back();
+            m_idle_bytes -= block_bytes;
+            m_hits++;
+        }
+        else
+        {
+            block = allocate_block(block_bytes);
+            m_misses++;
+        }
+
+        m_in_use[block] = block_bytes;
+        m_in_use_bytes += block_bytes;
+        return block;
+    }
+
+    // returns a block to the pool, true if the pool should be deleted
+    bool release(void *block)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::map<void*, index_t>::iterator itr = m_in_use.find(block);
+        if(itr == m_in_use.end())
+        {
+            return false;
+        }
+
+        index_t block_bytes = itr->second;
+        m_in_use.erase(itr);
+        m_in_use_bytes -= block_bytes;
+
+        if(!m_detached && m_idle_bytes + block_bytes <= m_max_bytes)
+        {
+            m_idle[block_bytes].push_back(block);
+            m_idle_bytes += block_bytes;
+        }
+        else
+        {
+            free_block(block);
+        }
+
+        return m_detached && m_in_use.empty();
+    }
+
+    // called when the pool's comm drops it, true if the pool should be
+    // deleted now
+    bool detach()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_detached = true;
+        return m_in_use.empty();
+    }
+
+    void info(Node &res)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        res.reset();
+        res["max_bytes"]    = (int64)m_max_bytes;
+        res["idle_bytes"]   = (int64)m_idle_bytes;
+        res["in_use_bytes"] = (int64)m_in_use_bytes;
+        res["hits"]         = (int64)m_hits;
+        res["misses"]       = (int64)m_misses;
+    }
+
+private:
+    void *allocate_block(index_t block_bytes)
+    {
+        void *block = NULL;
+        if(m_mpi_alloc_mem)
+        {
+            if(MPI_Alloc_mem((MPI_Aint)block_bytes,
+                             MPI_INFO_NULL,
+                             &block) != MPI_SUCCESS)
+            {
+                CONDUIT_ERROR("MPI_Alloc_mem failed for a buffer pool block "
+                              "of " << block_bytes << " bytes");
+            }
+        }
+        else
+        {
+            block = utils::conduit_allocate((size_t)block_bytes,
+                                            1,
+                                            m_allocator_id);
+        }
+        return block;
+    }
+
+    void free_block(void *block)
+    {
+        if(m_mpi_alloc_mem)
+        {
+            MPI_Free_mem(block);
+        }
+        else
+        {
+            utils::conduit_free(block, m_allocator_id);
+        }
+    }
+
+    index_t                                 m_max_bytes;
+    index_t                                 m_allocator_id;
+    bool                                    m_mpi_alloc_mem;
+    std::map<index_t, std::vector<void*> >  m_idle;
+    std::map<void*, index_t>                m_in_use;
+    index_t                                 m_idle_bytes;
+    index_t                                 m_in_use_bytes;
+    uint64                                  m_hits;
+    uint64                                  m_misses;
+    bool                                    m_detached;
+    std::mutex                              m_mutex;
+};
+
+//---------------------------------------------------------------------------//
+// attribute delete callback, called when the comm is freed or its pool
+// is replaced
+//---------------------------------------------------------------------------//
+int
+free_buffer_pool(MPI_Comm /*comm*/,
+                 int /*keyval*/,
+                 void *attr_val,
+                 void * /*extra_state*/)
+{
+    BufferPool *pool = static_cast<BufferPool*>(attr_val);
+    if(pool->detach())
+    {
+        delete pool;
+    }
+    return MPI_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+int
+buffer_pool_keyval()
+{
+    static int keyval = MPI_KEYVAL_INVALID;
+    static std::mutex keyval_mutex;
+    std::lock_guard<std::mutex> lock(keyval_mutex);
+    if(keyval == MPI_KEYVAL_INVALID)
+    {
+        MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                               free_buffer_pool,
+                               &keyval,
+                               NULL);
+    }
+    return keyval;
+}
+
+//---------------------------------------------------------------------------//
+// the comm's pool, NULL if it has none
+//---------------------------------------------------------------------------//
+BufferPool *
+buffer_pool(MPI_Comm comm)
+{
+    BufferPool *pool = NULL;
+    int found = 0;
+    if(MPI_Comm_get_attr(comm,
+                         buffer_pool_keyval(),
+                         &pool,
+                         &found) != MPI_SUCCESS || found == 0)
+    {
+        return NULL;
+    }
+    return pool;
+}
+
+//---------------------------------------------------------------------------//
+// compact host buffer for a request with the schema of node, from the
+// comm's pool if it has one
+//---------------------------------------------------------------------------//
+void
+request_host_buffer(const Node &node,
+                    MPI_Comm comm,
+                    Request *request)
+{
+    Schema s_compact;
+    node.schema().compact_to(s_compact);
+
+    request->m_pool = NULL;
+    request->m_buffer.reset();
+
+    BufferPool *pool = buffer_pool(comm);
+    index_t num_bytes = s_compact.total_bytes_compact();
+    if(pool != NULL && num_bytes > 0)
+    {
+        request->m_pool_block = pool->acquire(num_bytes);
+        request->m_pool = pool;
+        request->m_buffer.set_external(s_compact, request->m_pool_block);
+    }
+    else
+    {
+        request->m_buffer.set_allocator(mpi::staging_allocator());
+        request->m_buffer.set_schema(s_compact);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// compact host copy of node for a request
+//---------------------------------------------------------------------------//
+void
+request_stage_to_host(const Node &node,
+                      MPI_Comm comm,
+                      Request *request)
+{
+    request_host_buffer(node, comm, request);
+    request->m_buffer.update(node);
+}
+
+//---------------------------------------------------------------------------//
+// releases a request's buffer, returning pool blocks to their pool
+//---------------------------------------------------------------------------//
+void
+release_request_buffer(Request *request)
+{
+    request->m_buffer.reset();
+    if(request->m_pool != NULL)
+    {
+        if(request->m_pool->release(request->m_pool_block))
+        {
+            delete request->m_pool;
+        }
+        request->m_pool = NULL;
+        request->m_pool_block = NULL;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Finds (or creates) the datatype for the leaves of node. On success, base
+// is the address the datatype is relative to: use (base, 1, dtype) as the
+// MPI buffer. Returns false if the node can't be described (no data, or
+// strided leaves with more than INT_MAX elements), callers then use a
+// compact copy.
+//---------------------------------------------------------------------------//
+bool
+node_datatype(const Node &node,
+              void *&base,
+              MPI_Datatype &dtype)
+{
+    std::vector<LeafLayout> leaves;
+    if(needs_host_staging(node) ||
+       !collect_leaves(node, leaves) ||
+       leaves.empty())
+    {
+        return false;
+    }
+
+    const uint8 *base_ptr = leaves[0].ptr;
+
+    std::vector<int64> key;
+    key.reserve(leaves.size() * 4);
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        const LeafLayout &leaf = leaves[i];
+        // contiguous leaves are described by their size in bytes
+        bool contig = leaf.stride == leaf.element_bytes ||
+                      leaf.num_elements == 1;
+        if(!contig &&
+           !fits_count(leaf.num_elements))
+        {
+            return false;
+        }
+
+        key.push_back((int64)(leaf.ptr - base_ptr));
+        key.push_back((int64)leaf.element_bytes);
+        key.push_back((int64)leaf.num_elements);
+        key.push_back(contig ? (int64)leaf.element_bytes : (int64)leaf.stride);
+    }
+
+    base = const_cast<uint8*>(base_ptr);
+
+    DatatypeCache &cache = datatype_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    std::map<std::vector<int64>, MPI_Datatype>::iterator itr =
+        cache.types.find(key);
+    if(itr != cache.types.end())
+    {
+        dtype = itr->second;
+        return true;
+    }
+
+    // free the cached types when MPI is finalized
+    if(cache.keyval == MPI_KEYVAL_INVALID)
+    {
+        if(MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                                  free_datatype_cache,
+                                  &cache.keyval,
+                                  NULL) != MPI_SUCCESS ||
+           MPI_Comm_set_attr(MPI_COMM_SELF,
+                             cache.keyval,
+                             NULL) != MPI_SUCCESS)
+        {
+            return false;
+        }
+    }
+
+    if(cache.types.size() >= DATATYPE_CACHE_MAX_ENTRIES)
+    {
+        // pending operations that use these types still complete
+        cache.free_types();
+    }
+
+    const int nleaves = static_cast<int>(leaves.size());
+    std::vector<int>          block_lens(leaves.size());
+    std::vector<MPI_Aint>     displs(leaves.size());
+    std::vector<MPI_Datatype> types(leaves.size());
+    std::vector<MPI_Datatype> to_free;
+
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        const LeafLayout &leaf = leaves[i];
+        displs[i] = (MPI_Aint)key[i*4];
+        if(key[i*4 + 3] == (int64)leaf.element_bytes)
+        {
+            index_t num_bytes = leaf.element_bytes * leaf.num_elements;
+            if(fits_count(num_bytes))
+            {
+                block_lens[i] = static_cast<int>(num_bytes);
+                types[i] = MPI_BYTE;
+            }
+            else
+            {
+                if(create_bytes_datatype(num_bytes, types[i]) != MPI_SUCCESS)
+                {
+                    for(size_t j = 0; j < to_free.size(); j++)
+                    {
+                        MPI_Type_free(&to_free[j]);
+                    }
+                    return false;
+                }
+                block_lens[i] = 1;
+                to_free.push_back(types[i]);
+            }
+        }
+        else
+        {
+            MPI_Datatype elem_type;
+            MPI_Type_contiguous(static_cast<int>(leaf.element_bytes),
+                                MPI_BYTE,
+                                &elem_type);
+            MPI_Type_create_hvector(static_cast<int>(leaf.num_elements),
+                                    1,
+                                    (MPI_Aint)leaf.stride,
+                                    elem_type,
+                                    &types[i]);
+            block_lens[i] = 1;
+            to_free.push_back(elem_type);
+            to_free.push_back(types[i]);
+        }
+    }
+
+    int mpi_error = MPI_Type_create_struct(nleaves,
+                                           &block_lens[0],
+                                           &displs[0],
+                                           &types[0],
+                                           &dtype);
+    if(mpi_error == MPI_SUCCESS)
+    {
+        mpi_error = MPI_Type_commit(&dtype);
+    }
+
+    // the struct keeps what it needs of its parts
+    for(size_t i = 0; i < to_free.size(); i++)
+    {
+        MPI_Type_free(&to_free[i]);
+    }
+
+    if(mpi_error != MPI_SUCCESS)
+    {
+        return false;
+    }
+
+    cache.types[key] = dtype;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Creates a (not cached) datatype for a message made of a compact header
+// buffer followed by the data of node, relative to MPI_BOTTOM. The caller
+// frees it. Returns false if node can't be described.
+//---------------------------------------------------------------------------//
+bool
+header_and_node_datatype(const void *header_ptr,
+                         index_t header_bytes,
+                         const Node &node,
+                         MPI_Datatype &dtype)
+{
+    int          block_lens[2];
+    MPI_Aint     displs[2];
+    MPI_Datatype types[2];
+
+    if(!fits_count(header_bytes) ||
+       needs_host_staging(node))
+    {
+        return false;
+    }
+
+    block_lens[0] = static_cast<int>(header_bytes);
+    types[0]      = MPI_BYTE;
+    MPI_Get_address(const_cast<void*>(header_ptr), &displs[0]);
+
+    // large byte count type of compact data, freed once the struct exists
+    MPI_Datatype data_type = MPI_DATATYPE_NULL;
+
+    const void *data_ptr = node.contiguous_data_ptr();
+    if(data_ptr != NULL && node.is_compact())
+    {
+        index_t data_bytes = node.total_bytes_compact();
+        if(fits_count(data_bytes))
+        {
+            block_lens[1] = static_cast<int>(data_bytes);
+            types[1]      = MPI_BYTE;
+        }
+        else
+        {
+            if(create_bytes_datatype(data_bytes, data_type) != MPI_SUCCESS)
+            {
+                return false;
+            }
+            block_lens[1] = 1;
+            types[1]      = data_type;
+        }
+        MPI_Get_address(const_cast<void*>(data_ptr), &displs[1]);
+    }
+    else
+    {
+        void *base = NULL;
+        if(!node_datatype(node, base, types[1]))
+        {
+            return false;
+        }
+        block_lens[1] = 1;
+        MPI_Get_address(base, &displs[1]);
+    }
+
+    int mpi_error = MPI_Type_create_struct(2,
+                                           block_lens,
+                                           displs,
+                                           types,
+                                           &dtype);
+    if(data_type != MPI_DATATYPE_NULL)
+    {
+        MPI_Type_free(&data_type);
+    }
+
+    if(mpi_error != MPI_SUCCESS)
+    {
+        return false;
+    }
+    return MPI_Type_commit(&dtype) == MPI_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+// copies (snd_ptr, snd_count, snd_type) to num_bytes contiguous bytes at
+// dest_ptr, with a message to self for derived types
+//---------------------------------------------------------------------------//
+int
+local_copy(const void *snd_ptr,
+           int snd_count,
+           MPI_Datatype snd_type,
+           void *dest_ptr,
+           index_t num_bytes)
+{
+    if(snd_type == MPI_BYTE)
+    {
+        if(num_bytes > 0)
+        {
+            utils::conduit_memcpy(dest_ptr, snd_ptr, (size_t)num_bytes);
+        }
+        return MPI_SUCCESS;
+    }
+
+    MPI_Comm self_comm;
+    int mpi_error = MPI_Comm_dup(MPI_COMM_SELF, &self_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    ByteCount dest_count(num_bytes);
+    mpi_error = MPI_Sendrecv(const_cast<void*>(snd_ptr),
+                             snd_count,
+                             snd_type,
+                             0,
+                             0,
+                             dest_ptr,
+                             dest_count.count(),
+                             dest_count.type(),
+                             0,
+                             0,
+                             self_comm,
+                             MPI_STATUS_IGNORE);
+    MPI_Comm_free(&self_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// Gathers the bytes described by (snd_ptr, snd_count, snd_type) from each
+// rank into rcv_ptr on root, at rcv_displs[i] for rank i. Every rank passes
+// all rcv_counts and rcv_displs. Uses MPI_Gatherv when the result fits in
+// an int count, otherwise root receives each rank's bytes with a
+// point-to-point message (on a duplicate of comm, so they can't match the
+// caller's messages).
+//---------------------------------------------------------------------------//
+int
+gatherv_bytes(const void *snd_ptr,
+              int snd_count,
+              MPI_Datatype snd_type,
+              void *rcv_ptr,
+              const std::vector<index_t> &rcv_counts,
+              const std::vector<index_t> &rcv_displs,
+              int root,
+              MPI_Comm comm)
+{
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    index_t total_bytes = rcv_displs[size-1] + rcv_counts[size-1];
+
+    int mpi_error = MPI_SUCCESS;
+
+    if(fits_count(total_bytes))
+    {
+        std::vector<int> counts(rcv_counts.begin(), rcv_counts.end());
+        std::vector<int> displs(rcv_displs.begin(), rcv_displs.end());
+
+        StatsTimer timer(STATS_DATA,
+                         rcv_counts[rank],
+                         (rank == root) ? total_bytes : 0);
+        mpi_error = MPI_Gatherv(const_cast<void*>(snd_ptr),
+                                snd_count,
+                                snd_type,
+                                rcv_ptr,
+                                &counts[0],
+                                &displs[0],
+                                MPI_BYTE,
+                                root,
+                                comm);
+        timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        return mpi_error;
+    }
+
+    MPI_Comm p2p_comm;
+    mpi_error = MPI_Comm_dup(comm, &p2p_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(rank == root)
+    {
+        for(int i = 0; i < size && mpi_error == MPI_SUCCESS; i++)
+        {
+            uint8 *dest_ptr = (uint8*)rcv_ptr + rcv_displs[i];
+            if(i == root)
+            {
+                mpi_error = local_copy(snd_ptr,
+                                       snd_count,
+                                       snd_type,
+                                       dest_ptr,
+                                       rcv_counts[i]);
+                continue;
+            }
+
+            ByteCount rcv_count(rcv_counts[i]);
+            StatsTimer timer(STATS_DATA, 0, rcv_counts[i]);
+            mpi_error = MPI_Recv(dest_ptr,
+                                 rcv_count.count(),
+                                 rcv_count.type(),
+                                 i,
+                                 0,
+                                 p2p_comm,
+                                 MPI_STATUS_IGNORE);
+            timer.stop();
+        }
+    }
+    else
+    {
+        StatsTimer timer(STATS_DATA, rcv_counts[rank]);
+        mpi_error = MPI_Send(const_cast<void*>(snd_ptr),
+                             snd_count,
+                             snd_type,
+                             root,
+                             0,
+                             p2p_comm);
+        timer.stop();
+    }
+
+    MPI_Comm_free(&p2p_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// all gather variant of gatherv_bytes: uses MPI_Allgatherv when the result
+// fits in an int count, otherwise each rank broadcasts its bytes.
+//---------------------------------------------------------------------------//
+int
+all_gatherv_bytes(const void *snd_ptr,
+                  int snd_count,
+                  MPI_Datatype snd_type,
+                  void *rcv_ptr,
+                  const std::vector<index_t> &rcv_counts,
+                  const std::vector<index_t> &rcv_displs,
+                  MPI_Comm comm)
+{
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    index_t total_bytes = rcv_displs[size-1] + rcv_counts[size-1];
+
+    int mpi_error = MPI_SUCCESS;
+
+    if(fits_count(total_bytes))
+    {
+        std::vector<int> counts(rcv_counts.begin(), rcv_counts.end());
+        std::vector<int> displs(rcv_displs.begin(), rcv_displs.end());
+
+        StatsTimer timer(STATS_DATA,
+                         rcv_counts[rank],
+                         total_bytes);
+        mpi_error = MPI_Allgatherv(const_cast<void*>(snd_ptr),
+                                   snd_count,
+                                   snd_type,
+                                   rcv_ptr,
+                                   &counts[0],
+                                   &displs[0],
+                                   MPI_BYTE,
+                                   comm);
+        timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        return mpi_error;
+    }
+
+    mpi_error = local_copy(snd_ptr,
+                           snd_count,
+                           snd_type,
+                           (uint8*)rcv_ptr + rcv_displs[rank],
+                           rcv_counts[rank]);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    for(int i = 0; i < size; i++)
+    {
+        ByteCount bcast_count(rcv_counts[i]);
+        StatsTimer timer(STATS_DATA,
+                         (i == rank) ? rcv_counts[i] : 0,
+                         (i == rank) ? 0 : rcv_counts[i]);
+        mpi_error = MPI_Bcast((uint8*)rcv_ptr + rcv_displs[i],
+                              bcast_count.count(),
+                              bcast_count.type(),
+                              i,
+                              comm);
+        timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// Tree reductions.
+//
+// The numeric leaves of a tree are packed into one buffer (each leaf's
+// values start at a multiple of 8 bytes) that is reduced as a single
+// element of a contiguous datatype, by a user defined MPI_Op that applies
+// each leaf's op. The op finds the leaf layout through an attribute of the
+// datatype.
+//---------------------------------------------------------------------------//
+
+// ops applied to the leaves of a tree reduction
+enum TreeReduceOp
+{
+    TREE_REDUCE_SUM,
+    TREE_REDUCE_MIN,
+    TREE_REDUCE_MAX,
+    TREE_REDUCE_PROD
+};
+
+//---------------------------------------------------------------------------//
+struct TreeReduceLeaf
+{
+    const Node *src;
+    // true for leaves that are reduced
+    bool        numeric;
+    index_t     offset;
+    index_t     num_elements;
+    index_t     dtype_id;
+    int         op;
+};
+
+//---------------------------------------------------------------------------//
+struct TreeReduceLayout
+{
+    index_t                     total_bytes;
+    std::vector<TreeReduceLeaf> leaves;
+};
+
+//---------------------------------------------------------------------------//
+bool
+tree_reduce_op_from_mpi_op(MPI_Op mpi_op,
+                           int &op)
+{
+    if(mpi_op == MPI_SUM)
+        op = TREE_REDUCE_SUM;
+    else if(mpi_op == MPI_MIN)
+        op = TREE_REDUCE_MIN;
+    else if(mpi_op == MPI_MAX)
+        op = TREE_REDUCE_MAX;
+    else if(mpi_op == MPI_PROD)
+        op = TREE_REDUCE_PROD;
+    else
+        return false;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+int
+tree_reduce_op_from_name(const std::string &name)
+{
+    if(name == "sum")
+        return TREE_REDUCE_SUM;
+    else if(name == "min")
+        return TREE_REDUCE_MIN;
+    else if(name == "max")
+        return TREE_REDUCE_MAX;
+    else if(name == "prod")
+        return TREE_REDUCE_PROD;
+
+    CONDUIT_ERROR("Unsupported tree reduction op: \"" << name << "\""
+                  " (expected \"sum\", \"min\", \"max\" or \"prod\")");
+    return TREE_REDUCE_SUM;
+}
+
+//---------------------------------------------------------------------------//
+bool
+tree_reduce_is_numeric(index_t dtype_id)
+{
+    return dtype_id == DataType::INT8_ID    ||
+           dtype_id == DataType::INT16_ID   ||
+           dtype_id == DataType::INT32_ID   ||
+           dtype_id == DataType::INT64_ID   ||
+           dtype_id == DataType::UINT8_ID   ||
+           dtype_id == DataType::UINT16_ID  ||
+           dtype_id == DataType::UINT32_ID  ||
+           dtype_id == DataType::UINT64_ID  ||
+           dtype_id == DataType::FLOAT32_ID ||
+           dtype_id == DataType::FLOAT64_ID;
+}
+
+//---------------------------------------------------------------------------//
+// collects the leaves of node in depth first order. the op of a leaf is
+// the op named in leaf_ops at its path or at the closest ancestor path.
+//---------------------------------------------------------------------------//
+void
+tree_reduce_collect(const Node &node,
+                    const std::string &path,
+                    const Node *leaf_ops,
+                    int op,
+                    TreeReduceLayout &layout)
+{
+    if(leaf_ops != NULL && !path.empty() &&
+       leaf_ops->has_path(path) &&
+       leaf_ops->fetch_existing(path).dtype().is_string())
+    {
+        op = tree_reduce_op_from_name(leaf_ops->fetch_existing(path).as_string());
+    }
+
+    const DataType &dt = node.dtype();
+    if(dt.is_object() || dt.is_list())
+    {
+        index_t num_children = node.number_of_children();
+        for(index_t i = 0; i < num_children; i++)
+        {
+            std::ostringstream oss;
+            if(dt.is_object())
+            {
+                oss << node.schema().child_name(i);
+            }
+            else
+            {
+                oss << i;
+            }
+            std::string child_path = oss.str();
+            if(!path.empty())
+            {
+                child_path = path + "/" + child_path;
+            }
+            tree_reduce_collect(node.child(i),
+                                child_path,
+                                leaf_ops,
+                                op,
+                                layout);
+        }
+        return;
+    }
+
+    if(dt.is_empty())
+    {
+        return;
+    }
+
+    TreeReduceLeaf leaf;
+    leaf.src          = &node;
+    leaf.numeric      = tree_reduce_is_numeric(dt.id());
+    leaf.offset       = layout.total_bytes;
+    leaf.num_elements = dt.number_of_elements();
+    leaf.dtype_id     = dt.id();
+    leaf.op           = op;
+
+    if(leaf.numeric)
+    {
+        index_t num_bytes = leaf.num_elements * dt.element_bytes();
+        layout.total_bytes += (num_bytes + 7) & ~((index_t)7);
+    }
+    layout.leaves.push_back(leaf);
+}
+
+//---------------------------------------------------------------------------//
+template<typename T>
+void
+tree_reduce_values(int op,
+                   const T *in,
+                   T *inout,
+                   index_t num_elements)
+{
+    switch(op)
+    {
+        case TREE_REDUCE_SUM:
+            for(index_t i = 0; i < num_elements; i++)
+                inout[i] += in[i];
+            break;
+        case TREE_REDUCE_MIN:
+            for(index_t i = 0; i < num_elements; i++)
+                inout[i] = in[i] < inout[i] ? in[i] : inout[i];
+            break;
+        case TREE_REDUCE_MAX:
+            for(index_t i = 0; i < num_elements; i++)
+                inout[i] = in[i] > inout[i] ? in[i] : inout[i];
+            break;
+        case TREE_REDUCE_PROD:
+            for(index_t i = 0; i < num_elements; i++)
+                inout[i] *= in[i];
+            break;
+        default:
+            break;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// datatype attribute that points to the TreeReduceLayout
+//---------------------------------------------------------------------------//
+int
+tree_reduce_keyval()
+{
+    static int keyval = MPI_KEYVAL_INVALID;
+    static std::mutex keyval_mutex;
+    std::lock_guard<std::mutex> lock(keyval_mutex);
+    if(keyval == MPI_KEYVAL_INVALID)
+    {
+        MPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN,
+                               MPI_TYPE_NULL_DELETE_FN,
+                               &keyval,
+                               NULL);
+    }
+    return keyval;
+}
+
+//---------------------------------------------------------------------------//
+// MPI_User_function for tree reductions
+//---------------------------------------------------------------------------//
+void
+tree_reduce_op(void *in,
+               void *inout,
+               int *len,
+               MPI_Datatype *dtype)
+{
+    TreeReduceLayout *layout = NULL;
+    int found = 0;
+    MPI_Type_get_attr(*dtype, tree_reduce_keyval(), &layout, &found);
+    if(!found || layout == NULL)
+    {
+        return;
+    }
+
+    for(int e = 0; e < *len; e++)
+    {
+        uint8 *in_ptr    = (uint8*)in    + e * layout->total_bytes;
+        uint8 *inout_ptr = (uint8*)inout + e * layout->total_bytes;
+
+        for(size_t i = 0; i < layout->leaves.size(); i++)
+        {
+            const TreeReduceLeaf &leaf = layout->leaves[i];
+            if(!leaf.numeric)
+            {
+                continue;
+            }
+
+            void *a = in_ptr    + leaf.offset;
+            void *b = inout_ptr + leaf.offset;
+            index_t n = leaf.num_elements;
+
+            switch(leaf.dtype_id)
+            {
+                case DataType::INT8_ID:
+                    tree_reduce_values(leaf.op, (int8*)a, (int8*)b, n);
+                    break;
+                case DataType::INT16_ID:
+                    tree_reduce_values(leaf.op, (int16*)a, (int16*)b, n);
+                    break;
+                case DataType::INT32_ID:
+                    tree_reduce_values(leaf.op, (int32*)a, (int32*)b, n);
+                    break;
+                case DataType::INT64_ID:
+                    tree_reduce_values(leaf.op, (int64*)a, (int64*)b, n);
+                    break;
+                case DataType::UINT8_ID:
+                    tree_reduce_values(leaf.op, (uint8*)a, (uint8*)b, n);
+                    break;
+                case DataType::UINT16_ID:
+                    tree_reduce_values(leaf.op, (uint16*)a, (uint16*)b, n);
+                    break;
+                case DataType::UINT32_ID:
+                    tree_reduce_values(leaf.op, (uint32*)a, (uint32*)b, n);
+                    break;
+                case DataType::UINT64_ID:
+                    tree_reduce_values(leaf.op, (uint64*)a, (uint64*)b, n);
+                    break;
+                case DataType::FLOAT32_ID:
+                    tree_reduce_values(leaf.op, (float32*)a, (float32*)b, n);
+                    break;
+                case DataType::FLOAT64_ID:
+                    tree_reduce_values(leaf.op, (float64*)a, (float64*)b, n);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// compact native view of the values of leaf at ptr
+//---------------------------------------------------------------------------//
+void
+tree_reduce_leaf_view(const TreeReduceLeaf &leaf,
+                      uint8 *ptr,
+                      Node &view)
+{
+    DataType dt(leaf.dtype_id, leaf.num_elements);
+    view.set_external(dt, ptr + leaf.offset);
+}
+
+//---------------------------------------------------------------------------//
+// reduces the leaves of snd_node (on root, or on all ranks when root < 0)
+//---------------------------------------------------------------------------//
+int
+tree_reduce(const Node &snd_node,
+            Node &rcv_node,
+            const Node *leaf_ops,
+            int op,
+            int root,
+            MPI_Comm comm)
+{
+    TreeReduceLayout layout;
+    layout.total_bytes = 0;
+    tree_reduce_collect(snd_node, "", leaf_ops, op, layout);
+
+    int rank = 0;
+    MPI_Comm_rank(comm, &rank);
+    bool have_result = root < 0 || rank == root;
+
+    // pack the numeric leaves
+    std::vector<uint8> snd_buff((size_t)layout.total_bytes);
+    std::vector<uint8> rcv_buff;
+    Node view;
+    for(size_t i = 0; i < layout.leaves.size(); i++)
+    {
+        const TreeReduceLeaf &leaf = layout.leaves[i];
+        if(leaf.numeric)
+        {
+            tree_reduce_leaf_view(leaf, &snd_buff[0], view);
+            view.update(*leaf.src);
+        }
+    }
+
+    int mpi_error = MPI_SUCCESS;
+
+    if(layout.total_bytes > 0)
+    {
+        if(have_result)
+        {
+            rcv_buff.resize((size_t)layout.total_bytes);
+        }
+
+        MPI_Datatype tree_type;
+        if(fits_count(layout.total_bytes))
+        {
+            mpi_error = MPI_Type_contiguous(static_cast<int>(layout.total_bytes),
+                                            MPI_BYTE,
+                                            &tree_type);
+            if(mpi_error == MPI_SUCCESS)
+            {
+                mpi_error = MPI_Type_commit(&tree_type);
+            }
+        }
+        else
+        {
+            mpi_error = create_bytes_datatype(layout.total_bytes, tree_type);
+        }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+        MPI_Op tree_op;
+        MPI_Type_set_attr(tree_type, tree_reduce_keyval(), &layout);
+        mpi_error = MPI_Op_create(tree_reduce_op, 1, &tree_op);
+        if(mpi_error == MPI_SUCCESS)
+        {
+            void *rcv_ptr = have_result ? &rcv_buff[0] : NULL;
+            if(root < 0)
+            {
+                StatsTimer timer(STATS_DATA,
+                                 layout.total_bytes,
+                                 layout.total_bytes);
+                mpi_error = MPI_Allreduce(&snd_buff[0],
+                                          rcv_ptr,
+                                          1,
+                                          tree_type,
+                                          tree_op,
+                                          comm);
+                timer.stop();
+            }
+            else
+            {
+                StatsTimer timer(STATS_DATA,
+                                 layout.total_bytes,
+                                 have_result ? layout.total_bytes : 0);
+                mpi_error = MPI_Reduce(&snd_buff[0],
+                                       rcv_ptr,
+                                       1,
+                                       tree_type,
+                                       tree_op,
+                                       root,
+                                       comm);
+                timer.stop();
+            }
+            MPI_Op_free(&tree_op);
+        }
+        MPI_Type_free(&tree_type);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    if(!have_result)
+    {
+        return mpi_error;
+    }
+
+    // unpack into rcv_node, which has the same hierarchy as snd_node
+    if(rcv_node.dtype().is_empty() ||
+       schema_hash(rcv_node) != schema_hash(snd_node))
+    {
+        snd_node.compact_to(rcv_node);
+    }
+
+    TreeReduceLayout rcv_layout;
+    rcv_layout.total_bytes = 0;
+    tree_reduce_collect(rcv_node, "", NULL, op, rcv_layout);
+
+    for(size_t i = 0; i < layout.leaves.size(); i++)
+    {
+        const TreeReduceLeaf &leaf = layout.leaves[i];
+        Node &rcv_leaf = const_cast<Node&>(*rcv_layout.leaves[i].src);
+        if(leaf.numeric)
+        {
+            tree_reduce_leaf_view(leaf, &rcv_buff[0], view);
+            rcv_leaf.update(view);
+        }
+        else
+        {
+            rcv_leaf.update(*leaf.src);
+        }
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// receive buffer for igather and iall_gather on ranks that get the result:
+// recv_node (a list of compact send_node schemas) or, for device memory, a
+// host copy in request's buffer that is copied out on wait. If send_node
+// needs host staging, its values are copied to this rank's entry and
+// gathered in place.
+//---------------------------------------------------------------------------//
+void *
+igather_recv_buffer(const Node &send_node,
+                    Node &recv_node,
+                    int rank,
+                    Request *request)
+{
+    Node *rcv_buffer = &recv_node;
+    if(needs_host_staging(recv_node))
+    {
+        request->m_buffer.reset();
+        request->m_buffer.set_allocator(mpi::staging_allocator());
+        request->m_buffer.list_of(recv_node.child(0).schema(),
+                                  recv_node.number_of_children());
+        request->m_rcv_ptr = &recv_node;
+        rcv_buffer = &request->m_buffer;
+    }
+
+    if(needs_host_staging(send_node))
+    {
+        rcv_buffer->child(rank).update(send_node);
+    }
+
+    return rcv_buffer->data_ptr();
+}
+
+//---------------------------------------------------------------------------//
+// Nonblocking collectives that take more than one MPI call (schema
+// negotiation) keep their state on the Request. Each stage is a single
+// nonblocking MPI call; when it completes, wait, wait_all or test call
+// advance() to post the next one.
+//
+// The first stage is posted on the caller's communicator. Later stages are
+// posted by advance(), which may happen in a different order on each rank,
+// so they use a private duplicate of the communicator (MPI_Comm_idup,
+// started with the first stage).
+//---------------------------------------------------------------------------//
+class NonblockingCollective
+{
+public:
+             NonblockingCollective(MPI_Comm comm);
+    virtual ~NonblockingCollective();
+
+    // posts the first stage
+    int      start(MPI_Request &request);
+    // called when the current stage completed, posts the next stage
+    // and returns false, or returns true when the collective is done
+    bool     advance(MPI_Request &request);
+
+protected:
+    // posts the given stage (0 is the first) into request, returns
+    // false when there are no stages left
+    virtual bool post(int stage, MPI_Request &request) = 0;
+
+    // communicator for stage 0
+    MPI_Comm     comm() const { return m_comm; }
+    // communicator for stages > 0
+    MPI_Comm     stage_comm() const { return m_stage_comm; }
+
+private:
+    NonblockingCollective(const NonblockingCollective &);
+    NonblockingCollective &operator=(const NonblockingCollective &);
+
+    MPI_Comm     m_comm;
+    MPI_Comm     m_stage_comm;
+    MPI_Request  m_dup_request;
+    int          m_stage;
+};
+
+//---------------------------------------------------------------------------//
+NonblockingCollective::NonblockingCollective(MPI_Comm comm)
+: m_comm(comm),
+  m_stage_comm(MPI_COMM_NULL),
+  m_dup_request(MPI_REQUEST_NULL),
+  m_stage(0)
+{}
+
+//---------------------------------------------------------------------------//
+NonblockingCollective::~NonblockingCollective()
+{
+    if(m_dup_request != MPI_REQUEST_NULL)
+    {
+        MPI_Wait(&m_dup_request, MPI_STATUS_IGNORE);
+    }
+
+    if(m_stage_comm != MPI_COMM_NULL)
+    {
+        MPI_Comm_free(&m_stage_comm);
+    }
+}
+
+//---------------------------------------------------------------------------//
+int
+NonblockingCollective::start(MPI_Request &request)
+{
+    int mpi_error = MPI_Comm_idup(m_comm, &m_stage_comm, &m_dup_request);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    m_stage = 0;
+    request = MPI_REQUEST_NULL;
+    post(m_stage, request);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+bool
+NonblockingCollective::advance(MPI_Request &request)
+{
+    if(m_dup_request != MPI_REQUEST_NULL)
+    {
+        // the duplicate only needs the other ranks to have started the
+        // collective, it doesn't depend on any other stage
+        StatsTimer timer(STATS_WAIT);
+        int mpi_error = MPI_Wait(&m_dup_request, MPI_STATUS_IGNORE);
+        timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    m_stage++;
+    request = MPI_REQUEST_NULL;
+    return !post(m_stage, request);
+}
+
+//---------------------------------------------------------------------------//
+// runs the next stage of request's collective, returns true when the
+// request is done
+//---------------------------------------------------------------------------//
+bool
+advance_collective(Request *request)
+{
+    if(request->m_collective == NULL)
+    {
+        return true;
+    }
+
+    if(request->m_collective->advance(request->m_request))
+    {
+        delete request->m_collective;
+        request->m_collective = NULL;
+        return true;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+// ibroadcast_using_schema:
+//  (0) schema size, (1) schema, (2) data, (3) copy out
+//---------------------------------------------------------------------------//
+class BroadcastUsingSchema : public NonblockingCollective
+{
+public:
+    BroadcastUsingSchema(Node &node,
+                         int root,
+                         MPI_Comm comm)
+    : NonblockingCollective(comm),
+      m_node(node),
+      m_root(root),
+      m_rank(mpi::rank(comm)),
+      m_schema_size(0),
+      m_data_ptr(NULL),
+      m_data_size(0),
+      m_cpy_out(false)
+    {}
+
+protected:
+    virtual bool post(int stage, MPI_Request &request);
+
+private:
+    Node    &m_node;
+    int      m_root;
+    int      m_rank;
+    Node     m_buffers;
+    int64    m_schema_size;
+    void    *m_data_ptr;
+    index_t  m_data_size;
+    bool     m_cpy_out;
+};
+
+//---------------------------------------------------------------------------//
+bool
+BroadcastUsingSchema::post(int stage,
+                           MPI_Request &request)
+{
+    int mpi_error = MPI_SUCCESS;
+
+    if(stage == 0)
+    {
+        // setup buffers for send
+        if(m_rank == m_root)
+        {
+            std::vector<uint8> schema_bytes;
+
+            m_data_ptr  = m_node.contiguous_data_ptr();
+            m_data_size = m_node.total_bytes_compact();
+
+            if(m_data_ptr != NULL &&
+               m_node.is_compact() &&
+               m_node.is_contiguous() &&
+               !needs_host_staging(m_node))
+            {
+                m_node.schema().serialize_binary(schema_bytes,true);
+            }
+            else
+            {
+                Node &data_compact = m_buffers["data"];
+                stage_to_host(m_node, data_compact);
+
+                m_data_ptr = data_compact.data_ptr();
+                data_compact.schema().serialize_binary(schema_bytes,true);
+            }
+
+            m_buffers["schema"].set(schema_bytes);
+            m_schema_size = (int64)schema_bytes.size();
+        }
+
+        StatsTimer timer(STATS_SCHEMA,
+                         (m_rank == m_root) ? 8 : 0,
+                         (m_rank == m_root) ? 0 : 8);
+        mpi_error = MPI_Ibcast(&m_schema_size,
+                               1,
+                               MPI_INT64_T,
+                               m_root,
+                               comm(),
+                               &request);
+        timer.stop();
+    }
+    else if(stage == 1)
+    {
+        // alloc for rcv for schema
+        if(m_rank != m_root)
+        {
+            m_buffers["schema"].set(DataType::uint8(m_schema_size));
+        }
+
+        StatsTimer timer(STATS_SCHEMA,
+                         (m_rank == m_root) ? m_schema_size : 0,
+                         (m_rank == m_root) ? 0 : m_schema_size);
+        mpi_error = MPI_Ibcast(m_buffers["schema"].data_ptr(),
+                               static_cast<int>(m_schema_size),
+                               MPI_BYTE,
+                               m_root,
+                               stage_comm(),
+                               &request);
+        timer.stop();
+    }
+    else if(stage == 2)
+    {
+        // setup buffers for receive, as in broadcast_using_schema
+        if(m_rank != m_root)
+        {
+            Schema bcast_schema;
+            bcast_schema.deserialize_binary(m_buffers["schema"].as_uint8_ptr(),
+                                            (index_t)m_schema_size);
+
+            if(needs_host_staging(m_node))
+            {
+                // receive on the host, copy out when done
+                Node &data_buffer = m_buffers["data"];
+                data_buffer.set_allocator(mpi::staging_allocator());
+                data_buffer.set_schema(bcast_schema);
+
+                m_data_ptr  = data_buffer.data_ptr();
+                m_data_size = data_buffer.total_bytes_compact();
+                m_cpy_out   = true;
+            }
+            else if( !(m_node.dtype().is_empty() ||
+                  m_node.dtype().is_object() ||
+                  m_node.dtype().is_list() ) &&
+                !(bcast_schema.dtype().is_empty() ||
+                  bcast_schema.dtype().is_object() ||
+                  bcast_schema.dtype().is_list() )
+                && bcast_schema.compatible(m_node.schema()))
+            {
+                m_data_ptr  = m_node.contiguous_data_ptr();
+                m_data_size = m_node.total_bytes_compact();
+
+                if( m_data_ptr == NULL ||
+                    ! m_node.is_compact() )
+                {
+                    Node &data_buffer = m_buffers["data"];
+                    data_buffer.set_schema(bcast_schema);
+
+                    m_data_ptr = data_buffer.data_ptr();
+                    m_cpy_out  = true;
+                }
+            }
+            else
+            {
+                m_node.set_schema(bcast_schema);
+
+                m_data_ptr  = m_node.data_ptr();
+                m_data_size = m_node.total_bytes_compact();
+            }
+        }
+
+        ByteCount bcast_count(m_data_size);
+
+        StatsTimer timer(STATS_DATA,
+                         (m_rank == m_root) ? m_data_size : 0,
+                         (m_rank == m_root) ? 0 : m_data_size);
+        mpi_error = MPI_Ibcast(m_data_ptr,
+                               bcast_count.count(),
+                               bcast_count.type(),
+                               m_root,
+                               stage_comm(),
+                               &request);
+        timer.stop();
+    }
+    else
+    {
+        // note: m_cpy_out will always be false when rank == root
+        if(m_cpy_out)
+        {
+            stage_from_host(m_buffers["data"], m_node);
+        }
+        return false;
+    }
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// igather_using_schema and iall_gather_using_schema:
+//  (0) schema and data sizes, (1) schemas, (2) data, (3) done
+//---------------------------------------------------------------------------//
+class GatherUsingSchema : public NonblockingCollective
+{
+public:
+    GatherUsingSchema(Node &send_node,
+                      Node &recv_node,
+                      int root,
+                      bool all,
+                      MPI_Comm comm)
+    : NonblockingCollective(comm),
+      m_send_node(send_node),
+      m_recv_node(recv_node),
+      m_root(root),
+      m_all(all),
+      m_rank(mpi::rank(comm)),
+      m_size(mpi::size(comm))
+    {}
+
+protected:
+    virtual bool post(int stage, MPI_Request &request);
+
+private:
+    // true for ranks that receive the gather result
+    bool has_result() const { return m_all || m_rank == m_root; }
+    // copies a result received on the host to the receive node
+    void finish();
+
+    Node                 &m_send_node;
+    Node                 &m_recv_node;
+    int                   m_root;
+    bool                  m_all;
+    int                   m_rank;
+    int                   m_size;
+    Node                  m_snd_compact;
+    Node                  m_rcv_host;
+    std::vector<uint8>    m_schema_bytes;
+    int64                 m_snd_sizes[2];
+    std::vector<int64>    m_rcv_sizes;
+    std::vector<int>      m_schema_counts;
+    std::vector<int>      m_schema_displs;
+    std::vector<uint8>    m_schema_buff;
+    std::vector<int>      m_data_counts;
+    std::vector<int>      m_data_displs;
+};
+
+//---------------------------------------------------------------------------//
+bool
+GatherUsingSchema::post(int stage,
+                        MPI_Request &request)
+{
+    int mpi_error = MPI_SUCCESS;
+
+    if(stage == 0)
+    {
+        stage_to_host(m_send_node, m_snd_compact);
+        m_snd_compact.schema().serialize_binary(m_schema_bytes,true);
+
+        m_snd_sizes[0] = (int64)m_schema_bytes.size();
+        m_snd_sizes[1] = (int64)m_snd_compact.total_bytes_compact();
+        m_rcv_sizes.resize(2 * m_size);
+
+        StatsTimer timer(STATS_SCHEMA, 16, 16 * m_size);
+        mpi_error = MPI_Iallgather(m_snd_sizes,
+                                   2,
+                                   MPI_INT64_T,
+                                   &m_rcv_sizes[0],
+                                   2,
+                                   MPI_INT64_T,
+                                   comm(),
+                                   &request);
+        timer.stop();
+    }
+    else if(stage == 1)
+    {
+        int schema_curr_displ = 0;
+        if(has_result())
+        {
+            m_schema_counts.resize(m_size);
+            m_schema_displs.resize(m_size);
+            for(int i = 0; i < m_size; i++)
+            {
+                m_schema_counts[i] = (int)m_rcv_sizes[2 * i];
+                m_schema_displs[i] = schema_curr_displ;
+                schema_curr_displ += m_schema_counts[i];
+            }
+            m_schema_buff.resize(schema_curr_displ);
+        }
+
+        uint8 *schema_rcv_buff = m_schema_buff.empty() ? NULL :
+                                 &m_schema_buff[0];
+        int   *schema_rcv_counts = m_schema_counts.empty() ? NULL :
+                                   &m_schema_counts[0];
+        int   *schema_rcv_displs = m_schema_displs.empty() ? NULL :
+                                   &m_schema_displs[0];
+
+        if(m_all)
+        {
+            StatsTimer timer(STATS_SCHEMA,
+                             m_snd_sizes[0],
+                             schema_curr_displ);
+            mpi_error = MPI_Iallgatherv(&m_schema_bytes[0],
+                                        static_cast<int>(m_snd_sizes[0]),
+                                        MPI_BYTE,
+                                        schema_rcv_buff,
+                                        schema_rcv_counts,
+                                        schema_rcv_displs,
+                                        MPI_BYTE,
+                                        stage_comm(),
+                                        &request);
+            timer.stop();
+        }
+        else
+        {
+            StatsTimer timer(STATS_SCHEMA,
+                             m_snd_sizes[0],
+                             schema_curr_displ);
+            mpi_error = MPI_Igatherv(&m_schema_bytes[0],
+                                     static_cast<int>(m_snd_sizes[0]),
+                                     MPI_BYTE,
+                                     schema_rcv_buff,
+                                     schema_rcv_counts,
+                                     schema_rcv_displs,
+                                     MPI_BYTE,
+                                     m_root,
+                                     stage_comm(),
+                                     &request);
+            timer.stop();
+        }
+    }
+    else if(stage == 2)
+    {
+        char *data_rcv_buff = NULL;
+
+        // build all schemas from their binary encodings, compact them.
+        if(has_result())
+        {
+            Schema s_tmp;
+            for(int i = 0; i < m_size; i++)
+            {
+                Schema &s_new = s_tmp.append();
+                s_new.deserialize_binary(&m_schema_buff[m_schema_displs[i]],
+                                         m_schema_counts[i]);
+            }
+
+            Schema rcv_schema;
+            s_tmp.compact_to(rcv_schema);
+            if(needs_host_staging(m_recv_node))
+            {
+                m_rcv_host.set_allocator(mpi::staging_allocator());
+                m_rcv_host.set(rcv_schema);
+                data_rcv_buff = (char*)m_rcv_host.data_ptr();
+            }
+            else
+            {
+                m_recv_node.set(rcv_schema);
+                data_rcv_buff = (char*)m_recv_node.data_ptr();
+            }
+        }
+
+        std::vector<index_t> data_counts(m_size);
+        std::vector<index_t> data_displs(m_size);
+        index_t data_curr_displ = 0;
+        for(int i = 0; i < m_size; i++)
+        {
+            data_counts[i]   = (index_t)m_rcv_sizes[2 * i + 1];
+            data_displs[i]   = data_curr_displ;
+            data_curr_displ += data_counts[i];
+        }
+
+        if(!fits_count(data_curr_displ))
+        {
+            // the gathered data exceeds int counts: gather with the
+            // blocking helpers on the private communicator
+            ByteCount data_count((index_t)m_snd_sizes[1]);
+            if(m_all)
+            {
+                mpi_error = all_gatherv_bytes(m_snd_compact.data_ptr(),
+                                              data_count.count(),
+                                              data_count.type(),
+                                              data_rcv_buff,
+                                              data_counts,
+                                              data_displs,
+                                              stage_comm());
+            }
+            else
+            {
+                mpi_error = gatherv_bytes(m_snd_compact.data_ptr(),
+                                          data_count.count(),
+                                          data_count.type(),
+                                          data_rcv_buff,
+                                          data_counts,
+                                          data_displs,
+                                          m_root,
+                                          stage_comm());
+            }
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
+            finish();
+            return false;
+        }
+
+        m_data_counts.resize(m_size);
+        m_data_displs.resize(m_size);
+        for(int i = 0; i < m_size; i++)
+        {
+            m_data_counts[i] = static_cast<int>(data_counts[i]);
+            m_data_displs[i] = static_cast<int>(data_displs[i]);
+        }
+
+        if(m_all)
+        {
+            StatsTimer timer(STATS_DATA,
+                             m_snd_sizes[1],
+                             data_curr_displ);
+            mpi_error = MPI_Iallgatherv(m_snd_compact.data_ptr(),
+                                        static_cast<int>(m_snd_sizes[1]),
+                                        MPI_BYTE,
+                                        data_rcv_buff,
+                                        &m_data_counts[0],
+                                        &m_data_displs[0],
+                                        MPI_BYTE,
+                                        stage_comm(),
+                                        &request);
+            timer.stop();
+        }
+        else
+        {
+            StatsTimer timer(STATS_DATA,
+                             m_snd_sizes[1],
+                             has_result() ? data_curr_displ : 0);
+            mpi_error = MPI_Igatherv(m_snd_compact.data_ptr(),
+                                     static_cast<int>(m_snd_sizes[1]),
+                                     MPI_BYTE,
+                                     data_rcv_buff,
+                                     &m_data_counts[0],
+                                     &m_data_displs[0],
+                                     MPI_BYTE,
+                                     m_root,
+                                     stage_comm(),
+                                     &request);
+            timer.stop();
+        }
+    }
+    else
+    {
+        finish();
+        return false;
+    }
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void
+GatherUsingSchema::finish()
+{
+    if(!m_rcv_host.dtype().is_empty())
+    {
+        stage_from_host(m_rcv_host, m_recv_node);
+        m_rcv_host.reset();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Hierarchical collectives
+//
+// The ranks of a comm are split into groups (the ranks that share a node,
+// or runs of consecutive ranks). Rank 0 of each group is its leader, and
+// the leaders have a comm of their own. Both comms are cached on the
+// parent comm, by group size, and freed with it.
+//
+// Gathered nodes travel as bundles: each distinct binary schema is stored
+// once, followed by the rank, schema index and data size of each entry,
+// and the entries' compact data.
+//---------------------------------------------------------------------------//
+struct HierarchyComms
+{
+    // ranks of the same group, ordered by their rank in the parent comm
+    MPI_Comm         group_comm;
+    // the group leaders (MPI_COMM_NULL on the other ranks)
+    MPI_Comm         leader_comm;
+    // for each parent rank: the leader_comm rank of its group's leader
+    std::vector<int> leader_of;
+    // for each parent rank: its group_comm rank
+    std::vector<int> group_rank_of;
+};
+
+typedef std::map<int, HierarchyComms> HierarchyCommsMap;
+
+//---------------------------------------------------------------------------//
+// attribute delete callback, called when the parent comm is freed
+//---------------------------------------------------------------------------//
+int
+free_hierarchy_comms(MPI_Comm /*comm*/,
+                     int /*keyval*/,
+                     void *attr_val,
+                     void * /*extra_state*/)
+{
+    HierarchyCommsMap *comms_map = static_cast<HierarchyCommsMap*>(attr_val);
+    HierarchyCommsMap::iterator itr;
+    for(itr = comms_map->begin(); itr != comms_map->end(); itr++)
+    {
+        MPI_Comm_free(&itr->second.group_comm);
+        if(itr->second.leader_comm != MPI_COMM_NULL)
+        {
+            MPI_Comm_free(&itr->second.leader_comm);
+        }
+    }
+    delete comms_map;
+    return MPI_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+int
+hierarchy_keyval()
+{
+    static int keyval = MPI_KEYVAL_INVALID;
+    static std::mutex keyval_mutex;
+    std::lock_guard<std::mutex> lock(keyval_mutex);
+    if(keyval == MPI_KEYVAL_INVALID)
+    {
+        MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                               free_hierarchy_comms,
+                               &keyval,
+                               NULL);
+    }
+    return keyval;
+}
+
+//---------------------------------------------------------------------------//
+// Finds (or creates) the group and leader comms of comm. group_size <= 0
+// groups the ranks that share a node. Collective over comm.
+//---------------------------------------------------------------------------//
+int
+hierarchy_comms(MPI_Comm comm,
+                int group_size,
+                HierarchyComms *&res)
+{
+    if(group_size < 0)
+    {
+        group_size = 0;
+    }
+
+    int keyval = hierarchy_keyval();
+    HierarchyCommsMap *comms_map = NULL;
+    int found = 0;
+    int mpi_error = MPI_Comm_get_attr(comm, keyval, &comms_map, &found);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(found == 0)
+    {
+        comms_map = new HierarchyCommsMap();
+        mpi_error = MPI_Comm_set_attr(comm, keyval, comms_map);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    HierarchyCommsMap::iterator itr = comms_map->find(group_size);
+    if(itr != comms_map->end())
+    {
+        res = &itr->second;
+        return MPI_SUCCESS;
+    }
+
+    int rank = mpi::rank(comm);
+    int size = mpi::size(comm);
+
+    HierarchyComms h;
+    h.group_comm  = MPI_COMM_NULL;
+    h.leader_comm = MPI_COMM_NULL;
+
+    if(group_size > 0)
+    {
+        mpi_error = MPI_Comm_split(comm,
+                                   rank / group_size,
+                                   rank,
+                                   &h.group_comm);
+    }
+    else
+    {
+        mpi_error = MPI_Comm_split_type(comm,
+                                        MPI_COMM_TYPE_SHARED,
+                                        rank,
+                                        MPI_INFO_NULL,
+                                        &h.group_comm);
+    }
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    int group_rank = mpi::rank(h.group_comm);
+    mpi_error = MPI_Comm_split(comm,
+                               group_rank == 0 ? 0 : MPI_UNDEFINED,
+                               rank,
+                               &h.leader_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // leaders share their leader_comm rank with their group, then every
+    // rank learns where the others live
+    int ids[2] = {-1, group_rank};
+    if(h.leader_comm != MPI_COMM_NULL)
+    {
+        ids[0] = mpi::rank(h.leader_comm);
+    }
+
+    mpi_error = MPI_Bcast(&ids[0], 1, MPI_INT, 0, h.group_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    std::vector<int> all_ids(2 * size);
+    mpi_error = MPI_Allgather(ids, 2, MPI_INT,
+                              &all_ids[0], 2, MPI_INT,
+                              comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    h.leader_of.resize(size);
+    h.group_rank_of.resize(size);
+    for(int i = 0; i < size; i++)
+    {
+        h.leader_of[i]     = all_ids[2 * i];
+        h.group_rank_of[i] = all_ids[2 * i + 1];
+    }
+
+    res = &((*comms_map)[group_size] = h);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// single entry bundle that holds (a view of) compact
+//---------------------------------------------------------------------------//
+void
+hierarchy_bundle(Node &compact,
+                 int rank,
+                 Node &bundle)
+{
+    std::vector<uint8> schema_bytes;
+    compact.schema().serialize_binary(schema_bytes,true);
+
+    index_t data_size = compact.total_bytes_compact();
+
+    bundle.reset();
+    bundle["ranks"].set((int64)rank);
+    bundle["schema_ids"].set((int64)0);
+    bundle["data_sizes"].set((int64)data_size);
+    bundle["schema_sizes"].set((int64)schema_bytes.size());
+    bundle["schemas"].set(schema_bytes);
+    if(data_size > 0)
+    {
+        bundle["data"].set_external(DataType::uint8(data_size),
+                                    compact.data_ptr());
+    }
+    else
+    {
+        bundle["data"].set(DataType::uint8(0));
+    }
+}
+
+//---------------------------------------------------------------------------//
+// merges a list of bundles (in order) into one, keeping one copy of each
+// distinct schema
+//---------------------------------------------------------------------------//
+void
+merge_hierarchy_bundles(const Node &bundles,
+                        Node &merged)
+{
+    std::map<std::string, int64> schema_ids;
+    std::vector<int64> ranks;
+    std::vector<int64> ids;
+    std::vector<int64> data_sizes;
+    std::vector<int64> schema_sizes;
+    std::vector<uint8> schemas;
+    index_t total_data_size = 0;
+
+    index_t num_bundles = bundles.number_of_children();
+    for(index_t i = 0; i < num_bundles; i++)
+    {
+        const Node &bundle = bundles.child(i);
+
+        // map the bundle's schemas to merged ids
+        const Node &b_schema_sizes = bundle["schema_sizes"];
+        const uint8 *b_schemas = bundle["schemas"].as_uint8_ptr();
+        index_t num_schemas = b_schema_sizes.dtype().number_of_elements();
+        std::vector<int64> b_ids(num_schemas);
+        index_t offset = 0;
+        for(index_t j = 0; j < num_schemas; j++)
+        {
+            index_t len = (index_t)b_schema_sizes.as_int64_ptr()[j];
+            std::string key((const char*)(b_schemas + offset), len);
+            std::map<std::string, int64>::iterator itr = schema_ids.find(key);
+            if(itr == schema_ids.end())
+            {
+                itr = schema_ids.insert(
+                          std::make_pair(key,
+                                         (int64)schema_sizes.size())).first;
+                schema_sizes.push_back(len);
+                schemas.insert(schemas.end(),
+                               b_schemas + offset,
+                               b_schemas + offset + len);
+            }
+            b_ids[j] = itr->second;
+            offset += len;
+        }
+
+        const Node &b_ranks = bundle["ranks"];
+        index_t num_entries = b_ranks.dtype().number_of_elements();
+        for(index_t j = 0; j < num_entries; j++)
+        {
+            int64 data_size = bundle["data_sizes"].as_int64_ptr()[j];
+            ranks.push_back(b_ranks.as_int64_ptr()[j]);
+            ids.push_back(b_ids[bundle["schema_ids"].as_int64_ptr()[j]]);
+            data_sizes.push_back(data_size);
+            total_data_size += (index_t)data_size;
+        }
+    }
+
+    merged.reset();
+    merged["ranks"].set(ranks);
+    merged["schema_ids"].set(ids);
+    merged["data_sizes"].set(data_sizes);
+    merged["schema_sizes"].set(schema_sizes);
+    merged["schemas"].set(schemas);
+    merged["data"].set(DataType::uint8(total_data_size));
+
+    uint8 *data_ptr = merged["data"].as_uint8_ptr();
+    for(index_t i = 0; i < num_bundles; i++)
+    {
+        const Node &b_data = bundles.child(i)["data"];
+        index_t data_size = b_data.dtype().number_of_elements();
+        if(data_size > 0)
+        {
+            memcpy(data_ptr, b_data.as_uint8_ptr(), (size_t)data_size);
+            data_ptr += data_size;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// sets recv_node to the list of entries in rank order, laid out as
+// gather_using_schema does
+//---------------------------------------------------------------------------//
+void
+unpack_hierarchy_bundle(const Node &bundle,
+                        int size,
+                        Node &recv_node)
 {
+    const int64 *ranks        = bundle["ranks"].as_int64_ptr();
+    const int64 *ids          = bundle["schema_ids"].as_int64_ptr();
+    const int64 *data_sizes   = bundle["data_sizes"].as_int64_ptr();
+    const int64 *schema_sizes = bundle["schema_sizes"].as_int64_ptr();
+    const uint8 *schema_bytes = bundle["schemas"].as_uint8_ptr();
+    const uint8 *data         = bundle["data"].as_uint8_ptr();
+
+    index_t num_entries = bundle["ranks"].dtype().number_of_elements();
+    index_t num_schemas = bundle["schema_sizes"].dtype().number_of_elements();
+
+    // each distinct schema is only deserialized once
+    std::vector<Schema> schemas(num_schemas);
+    index_t offset = 0;
+    for(index_t i = 0; i < num_schemas; i++)
+    {
+        schemas[i].deserialize_binary(schema_bytes + offset,
+                                      (index_t)schema_sizes[i]);
+        offset += (index_t)schema_sizes[i];
+    }
 
-//-----------------------------------------------------------------------------
-// -- begin conduit::relay --
-//-----------------------------------------------------------------------------
-namespace relay
-{
+    std::vector<index_t> entry_of(size, -1);
+    std::vector<index_t> data_offsets(num_entries);
+    offset = 0;
+    for(index_t i = 0; i < num_entries; i++)
+    {
+        entry_of[ranks[i]] = i;
+        data_offsets[i] = offset;
+        offset += (index_t)data_sizes[i];
+    }
+
+    Schema s_tmp;
+    for(int i = 0; i < size; i++)
+    {
+        s_tmp.append().set(schemas[ids[entry_of[i]]]);
+    }
 
+    Schema rcv_schema;
+    s_tmp.compact_to(rcv_schema);
+    recv_node.set(rcv_schema);
+
+    // the compact list holds each rank's data in turn
+    uint8 *rcv_ptr = (uint8*)recv_node.data_ptr();
+    for(int i = 0; i < size; i++)
+    {
+        index_t e = entry_of[i];
+        if(data_sizes[e] > 0)
+        {
+            memcpy(rcv_ptr, data + data_offsets[e], (size_t)data_sizes[e]);
+            rcv_ptr += data_sizes[e];
+        }
+    }
+}
 
+}
 //-----------------------------------------------------------------------------
-// -- begin conduit::relay::mpi --
+// -- end conduit::relay::mpi::detail --
 //-----------------------------------------------------------------------------
-namespace mpi
-{
 
 
 //-----------------------------------------------------------------------------
@@ -74,6 +2802,191 @@ rank(MPI_Comm mpi_comm)
     return res;
 }
 
+//-----------------------------------------------------------------------------
+// -1 until set or queried
+static int     device_aware_mode = -1;
+static index_t staging_allocator_id = 0;
+
+//-----------------------------------------------------------------------------
+void
+set_device_aware(bool value)
+{
+    device_aware_mode = value ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+bool
+device_aware()
+{
+    if(device_aware_mode < 0)
+    {
+        device_aware_mode = 0;
+#if defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
+        if(MPIX_Query_cuda_support())
+        {
+            device_aware_mode = 1;
+        }
+#endif
+#if defined(MPIX_ROCM_AWARE_SUPPORT) && MPIX_ROCM_AWARE_SUPPORT
+        if(MPIX_Query_rocm_support())
+        {
+            device_aware_mode = 1;
+        }
+#endif
+    }
+    return device_aware_mode == 1;
+}
+
+//-----------------------------------------------------------------------------
+void
+set_staging_allocator(index_t allocator_id)
+{
+    staging_allocator_id = allocator_id;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+staging_allocator()
+{
+    return staging_allocator_id;
+}
+
+//-----------------------------------------------------------------------------
+void
+set_buffer_pool(MPI_Comm comm,
+                const Node &options)
+{
+    index_t max_bytes    = detail::BUFFER_POOL_DEFAULT_MAX_BYTES;
+    index_t allocator_id = staging_allocator();
+    bool    use_mpi_alloc_mem = false;
+
+    if(options.has_child("max_bytes"))
+    {
+        max_bytes = options["max_bytes"].to_index_t();
+    }
+
+    if(options.has_child("allocator"))
+    {
+        allocator_id = options["allocator"].to_index_t();
+    }
+
+    if(options.has_child("mpi_alloc_mem"))
+    {
+        const Node &n_mem = options["mpi_alloc_mem"];
+        use_mpi_alloc_mem = n_mem.dtype().is_string() ?
+                                n_mem.as_string() == "true" :
+                                n_mem.to_int() != 0;
+    }
+
+    if(utils::is_device_allocator(allocator_id))
+    {
+        CONDUIT_ERROR("relay::mpi::set_buffer_pool: allocator "
+                      << allocator_id << " returns device memory, "
+                      "buffer pools hold host staging buffers");
+    }
+
+    detail::BufferPool *pool = new detail::BufferPool(max_bytes,
+                                                      allocator_id,
+                                                      use_mpi_alloc_mem);
+
+    // setting the attribute calls the delete callback for an existing pool
+    if(MPI_Comm_set_attr(comm,
+                         detail::buffer_pool_keyval(),
+                         pool) != MPI_SUCCESS)
+    {
+        delete pool;
+        CONDUIT_ERROR("relay::mpi::set_buffer_pool: MPI_Comm_set_attr "
+                      "failed");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+clear_buffer_pool(MPI_Comm comm)
+{
+    if(detail::buffer_pool(comm) != NULL)
+    {
+        MPI_Comm_delete_attr(comm, detail::buffer_pool_keyval());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+buffer_pool_info(MPI_Comm comm,
+                 Node &info)
+{
+    info.reset();
+    detail::BufferPool *pool = detail::buffer_pool(comm);
+    if(pool != NULL)
+    {
+        pool->info(info);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+set_stats_enabled(bool value)
+{
+    detail::stats_registry().enabled = value;
+}
+
+//-----------------------------------------------------------------------------
+bool
+stats_enabled()
+{
+    return detail::stats_registry().enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+reset_stats()
+{
+    detail::StatsRegistry &registry = detail::stats_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.ops.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+stats(Node &info)
+{
+    detail::StatsRegistry &registry = detail::stats_registry();
+    std::map<std::string, detail::OpStats> ops;
+    detail::OpStats total;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        std::map<const char *, detail::OpStats>::const_iterator itr;
+        for(itr = registry.ops.begin(); itr != registry.ops.end(); itr++)
+        {
+            std::string name(itr->first);
+            if(name.compare(0, 12, "relay::mpi::") == 0)
+            {
+                name = name.substr(12);
+            }
+            ops[name].add(itr->second);
+            total.add(itr->second);
+        }
+    }
+
+    info.reset();
+    std::map<std::string, detail::OpStats>::const_iterator itr;
+    for(itr = ops.begin(); itr != ops.end(); itr++)
+    {
+        itr->second.to_node(info.add_child(itr->first));
+    }
+    total.to_node(info["total"]);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_annotation_callbacks(annotation_callback begin,
+                         annotation_callback end)
+{
+    detail::StatsRegistry &registry = detail::stats_registry();
+    registry.begin_callback = begin;
+    registry.end_callback   = end;
+}
+
 //-----------------------------------------------------------------------------
 MPI_Datatype
 conduit_dtype_to_mpi_dtype(const DataType &dt)
@@ -261,6 +3174,15 @@ mpi_dtype_to_conduit_dtype_id(MPI_Datatype dt)
 int 
 send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
 {     
+    detail::StatsScope stats_scope("relay::mpi::send_using_schema");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        detail::stage_to_host(node, n_host);
+        return send_using_schema(n_host, dest, tag, comm);
+    }
+
     Schema s_data_compact;
     
     // schema will only be valid if compact and contig
@@ -273,11 +3195,46 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
         node.schema().compact_to(s_data_compact);
     }
     
-    std::string snd_schema_json = s_data_compact.to_json();
-        
+    std::vector<uint8> snd_schema_bytes;
+    s_data_compact.serialize_binary(snd_schema_bytes,true);
+
+    // the message is the schema header followed by the data, send it
+    // without copying the data if we can describe it
+    Schema s_hdr;
+    s_hdr["schema_len"].set(DataType::int64());
+    s_hdr["schema"].set(DataType::uint8(snd_schema_bytes.size()));
+
+    Schema s_hdr_compact;
+    s_hdr.compact_to(s_hdr_compact);
+
+    Node n_hdr(s_hdr_compact);
+    n_hdr["schema_len"].set((int64)snd_schema_bytes.size());
+    n_hdr["schema"].set(snd_schema_bytes);
+
+    MPI_Datatype msg_type;
+    if(detail::header_and_node_datatype(n_hdr.data_ptr(),
+                                        n_hdr.total_bytes_compact(),
+                                        node,
+                                        msg_type))
+    {
+        detail::StatsTimer timer(detail::STATS_DATA,
+                                 n_hdr.total_bytes_compact() +
+                                 node.total_bytes_compact());
+        int mpi_error = MPI_Send(MPI_BOTTOM,
+                                 1,
+                                 msg_type,
+                                 dest,
+                                 tag,
+                                 comm);
+        timer.stop();
+        MPI_Type_free(&msg_type);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        return mpi_error;
+    }
+
     Schema s_msg;
     s_msg["schema_len"].set(DataType::int64());
-    s_msg["schema"].set(DataType::char8_str(snd_schema_json.size()+1));
+    s_msg["schema"].set(DataType::uint8(snd_schema_bytes.size()));
     s_msg["data"].set(s_data_compact);
     
     // create a compact schema to use
@@ -286,26 +3243,22 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
     
     Node n_msg(s_msg_compact);
     // these sets won't realloc since schemas are compatible
-    n_msg["schema_len"].set((int64)snd_schema_json.length());
-    n_msg["schema"].set(snd_schema_json);
+    n_msg["schema_len"].set((int64)snd_schema_bytes.size());
+    n_msg["schema"].set(snd_schema_bytes);
     n_msg["data"].update(node);
 
     
-    index_t msg_data_size = n_msg.total_bytes_compact();
-    
-    if(!conduit::utils::value_fits<index_t,int>(msg_data_size))
-    {
-        CONDUIT_INFO("Warning size value (" << msg_data_size << ")"
-                     " exceeds the size of MPI_Send max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
-    }
+    detail::ByteCount msg_count(n_msg.total_bytes_compact());
 
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             n_msg.total_bytes_compact());
     int mpi_error = MPI_Send(const_cast<void*>(n_msg.data_ptr()),
-                             static_cast<int>(msg_data_size),
-                             MPI_BYTE,
+                             msg_count.count(),
+                             msg_count.type(),
                              dest,
                              tag,
                              comm);
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -317,41 +3270,54 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
 int
 recv_using_schema(Node &node, int src, int tag, MPI_Comm comm)
 {  
+    detail::StatsScope stats_scope("relay::mpi::recv_using_schema");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        int mpi_error = recv_using_schema(n_host, src, tag, comm);
+        node.update(n_host);
+        return mpi_error;
+    }
+
     MPI_Status status;
     
+    detail::StatsTimer probe_timer(detail::STATS_WAIT);
     int mpi_error = MPI_Probe(src, tag, comm, &status);
+    probe_timer.stop();
     
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
-    int buffer_size = 0;
-    MPI_Get_count(&status, MPI_BYTE, &buffer_size);
+    // elements (not count) gives the size of messages over INT_MAX bytes
+    MPI_Count buffer_size = 0;
+    MPI_Get_elements_x(&status, MPI_BYTE, &buffer_size);
 
-    Node n_buffer(DataType::uint8(buffer_size));
+    Node n_buffer(DataType::uint8((index_t)buffer_size));
+    detail::ByteCount buffer_count((index_t)buffer_size);
     
+    detail::StatsTimer timer(detail::STATS_DATA, 0, (index_t)buffer_size);
     mpi_error = MPI_Recv(n_buffer.data_ptr(),
-                         buffer_size,
-                         MPI_BYTE,
+                         buffer_count.count(),
+                         buffer_count.type(),
                          status.MPI_SOURCE,
                          status.MPI_TAG,
                          comm,
                          &status);
+    timer.stop();
 
     uint8 *n_buff_ptr = (uint8*)n_buffer.data_ptr();
 
     Node n_msg;
     // length of the schema is sent as a 64-bit signed int
-    // NOTE: we aren't using this value  ... 
-    n_msg["schema_len"].set_external((int64*)n_buff_ptr);
+    int64 schema_len = 0;
+    memcpy(&schema_len,n_buff_ptr,sizeof(int64));
     n_buff_ptr +=8;
-    // wrap the schema string
-    n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
-    // create the schema
+    // create the schema from its binary encoding
     Schema rcv_schema;
-    Generator gen(n_msg["schema"].as_char8_str());
-    gen.walk(rcv_schema);
+    rcv_schema.deserialize_binary(n_buff_ptr,(index_t)schema_len);
 
     // advance by the schema length
-    n_buff_ptr += n_msg["schema"].total_bytes_compact();
+    n_buff_ptr += schema_len;
     
     // apply the schema to the data
     n_msg["data"].set_external(rcv_schema,n_buff_ptr);
@@ -367,41 +3333,54 @@ recv_using_schema(Node &node, int src, int tag, MPI_Comm comm)
 int
 recv_using_schema(Node &node, MPI_Comm comm)
 {  
+    detail::StatsScope stats_scope("relay::mpi::recv_using_schema");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        int mpi_error = recv_using_schema(n_host, comm);
+        node.update(n_host);
+        return mpi_error;
+    }
+
     MPI_Status status;
 
+    detail::StatsTimer probe_timer(detail::STATS_WAIT);
     int mpi_error = MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &status);
+    probe_timer.stop();
     
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
-    int buffer_size = 0;
-    MPI_Get_count(&status, MPI_BYTE, &buffer_size);
+    // elements (not count) gives the size of messages over INT_MAX bytes
+    MPI_Count buffer_size = 0;
+    MPI_Get_elements_x(&status, MPI_BYTE, &buffer_size);
 
-    Node n_buffer(DataType::uint8(buffer_size));
+    Node n_buffer(DataType::uint8((index_t)buffer_size));
+    detail::ByteCount buffer_count((index_t)buffer_size);
     
+    detail::StatsTimer timer(detail::STATS_DATA, 0, (index_t)buffer_size);
     mpi_error = MPI_Recv(n_buffer.data_ptr(),
-                         buffer_size,
-                         MPI_BYTE,
+                         buffer_count.count(),
+                         buffer_count.type(),
                          status.MPI_SOURCE,
                          status.MPI_TAG,
                          comm,
                          &status);
+    timer.stop();
 
     uint8 *n_buff_ptr = (uint8*)n_buffer.data_ptr();
 
     Node n_msg;
     // length of the schema is sent as a 64-bit signed int
-    // NOTE: we aren't using this value  ... 
-    n_msg["schema_len"].set_external((int64*)n_buff_ptr);
+    int64 schema_len = 0;
+    memcpy(&schema_len,n_buff_ptr,sizeof(int64));
     n_buff_ptr +=8;
-    // wrap the schema string
-    n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
-    // create the schema
+    // create the schema from its binary encoding
     Schema rcv_schema;
-    Generator gen(n_msg["schema"].as_char8_str());
-    gen.walk(rcv_schema);
+    rcv_schema.deserialize_binary(n_buff_ptr,(index_t)schema_len);
 
     // advance by the schema length
-    n_buff_ptr += n_msg["schema"].total_bytes_compact();
+    n_buff_ptr += schema_len;
     
     // apply the schema to the data
     n_msg["data"].set_external(rcv_schema,n_buff_ptr);
@@ -416,6 +3395,15 @@ recv_using_schema(Node &node, MPI_Comm comm)
 int 
 send(const Node &node, int dest, int tag, MPI_Comm comm)
 { 
+    detail::StatsScope stats_scope("relay::mpi::send");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        detail::stage_to_host(node, n_host);
+        return send(n_host, dest, tag, comm);
+    }
+
     // assumes size and type are known on the other end
     
     Node snd_compact;
@@ -423,26 +3411,35 @@ send(const Node &node, int dest, int tag, MPI_Comm comm)
     const void *snd_ptr = node.contiguous_data_ptr();;
     index_t    snd_size = node.total_bytes_compact();;
     
+    detail::ByteCount snd_bytes(snd_size);
+    int          snd_count = snd_bytes.count();
+    MPI_Datatype snd_type  = snd_bytes.type();
+
     if( snd_ptr == NULL ||
         ! node.is_compact())
     {
-         node.compact_to(snd_compact);
-         snd_ptr = snd_compact.data_ptr();
-    }
-
-    if(!conduit::utils::value_fits<index_t,int>(snd_size))
-    {
-        CONDUIT_INFO("Warning size value (" << snd_size << ")"
-                     " exceeds the size of MPI_Send max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
+        // send directly from the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(node, base, snd_type))
+        {
+            snd_ptr   = base;
+            snd_count = 1;
+        }
+        else
+        {
+            node.compact_to(snd_compact);
+            snd_ptr = snd_compact.data_ptr();
+        }
     }
 
+    detail::StatsTimer timer(detail::STATS_DATA, snd_size);
     int mpi_error = MPI_Send(const_cast<void*>(snd_ptr),
-                             static_cast<int>(snd_size),
-                             MPI_BYTE,
+                             snd_count,
+                             snd_type,
                              dest,
                              tag,
                              comm);
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -453,6 +3450,17 @@ send(const Node &node, int dest, int tag, MPI_Comm comm)
 int
 recv(Node &node, int src, int tag, MPI_Comm comm)
 {  
+    detail::StatsScope stats_scope("relay::mpi::recv");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        detail::host_buffer(node, n_host);
+        int mpi_error = recv(n_host, src, tag, comm);
+        node.update(n_host);
+        return mpi_error;
+    }
+
 
     MPI_Status status;
     Node rcv_compact;
@@ -462,32 +3470,41 @@ recv(Node &node, int src, int tag, MPI_Comm comm)
     const void *rcv_ptr  = node.contiguous_data_ptr();
     index_t     rcv_size = node.total_bytes_compact();
 
+    detail::ByteCount rcv_bytes(rcv_size);
+    int          rcv_count = rcv_bytes.count();
+    MPI_Datatype rcv_type  = rcv_bytes.type();
+
     if( rcv_ptr == NULL  ||
         ! node.is_compact() )
     {
-        // we will need to update into rcv node
-        cpy_out = true;
-        Schema s_rcv_compact;
-        node.schema().compact_to(s_rcv_compact);
-        rcv_compact.set_schema(s_rcv_compact);
-        rcv_ptr  = rcv_compact.data_ptr();
-    }
-
-    if(!conduit::utils::value_fits<index_t,int>(rcv_size))
-    {
-        CONDUIT_INFO("Warning size value (" << rcv_size << ")"
-                     " exceeds the size of MPI_Recv max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
+        // receive directly into the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(node, base, rcv_type))
+        {
+            rcv_ptr   = base;
+            rcv_count = 1;
+        }
+        else
+        {
+            // we will need to update into rcv node
+            cpy_out = true;
+            Schema s_rcv_compact;
+            node.schema().compact_to(s_rcv_compact);
+            rcv_compact.set_schema(s_rcv_compact);
+            rcv_ptr  = rcv_compact.data_ptr();
+        }
     }
 
 
+    detail::StatsTimer timer(detail::STATS_DATA, 0, rcv_size);
     int mpi_error = MPI_Recv(const_cast<void*>(rcv_ptr),
-                             static_cast<int>(rcv_size),
-                             MPI_BYTE,
+                             rcv_count,
+                             rcv_type,
                              src,
                              tag,
                              comm,
                              &status);
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
@@ -504,6 +3521,17 @@ recv(Node &node, int src, int tag, MPI_Comm comm)
 int
 recv(Node &node, MPI_Comm comm)
 {  
+    detail::StatsScope stats_scope("relay::mpi::recv");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        detail::host_buffer(node, n_host);
+        int mpi_error = recv(n_host, comm);
+        node.update(n_host);
+        return mpi_error;
+    }
+
 
     MPI_Status status;
     Node rcv_compact;
@@ -513,32 +3541,41 @@ recv(Node &node, MPI_Comm comm)
     const void *rcv_ptr  = node.contiguous_data_ptr();
     index_t     rcv_size = node.total_bytes_compact();
 
+    detail::ByteCount rcv_bytes(rcv_size);
+    int          rcv_count = rcv_bytes.count();
+    MPI_Datatype rcv_type  = rcv_bytes.type();
+
     if( rcv_ptr == NULL  ||
         ! node.is_compact() )
     {
-        // we will need to update into rcv node
-        cpy_out = true;
-        Schema s_rcv_compact;
-        node.schema().compact_to(s_rcv_compact);
-        rcv_compact.set_schema(s_rcv_compact);
-        rcv_ptr  = rcv_compact.data_ptr();
-    }
-
-    if(!conduit::utils::value_fits<index_t,int>(rcv_size))
-    {
-        CONDUIT_INFO("Warning size value (" << rcv_size << ")"
-                     " exceeds the size of MPI_Recv max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
+        // receive directly into the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(node, base, rcv_type))
+        {
+            rcv_ptr   = base;
+            rcv_count = 1;
+        }
+        else
+        {
+            // we will need to update into rcv node
+            cpy_out = true;
+            Schema s_rcv_compact;
+            node.schema().compact_to(s_rcv_compact);
+            rcv_compact.set_schema(s_rcv_compact);
+            rcv_ptr  = rcv_compact.data_ptr();
+        }
     }
 
 
+    detail::StatsTimer timer(detail::STATS_DATA, 0, rcv_size);
     int mpi_error = MPI_Recv(const_cast<void*>(rcv_ptr),
-                             static_cast<int>(rcv_size),
-                             MPI_BYTE,
+                             rcv_count,
+                             rcv_type,
                              MPI_ANY_SOURCE,
                              MPI_ANY_TAG,
                              comm,
                              &status);
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
@@ -558,6 +3595,22 @@ reduce(const Node &snd_node,
        int root,
        MPI_Comm mpi_comm) 
 {
+    detail::StatsScope stats_scope("relay::mpi::reduce");
+
+    if(detail::needs_host_staging(snd_node) ||
+       detail::needs_host_staging(rcv_node))
+    {
+        Node n_snd_host;
+        Node n_rcv_host;
+        detail::stage_to_host(snd_node, n_snd_host);
+        int mpi_error = reduce(n_snd_host, n_rcv_host, mpi_op, root, mpi_comm);
+        if(mpi::rank(mpi_comm) == root)
+        {
+            detail::stage_from_host(n_rcv_host, rcv_node);
+        }
+        return mpi_error;
+    }
+
     MPI_Datatype mpi_dtype = conduit_dtype_to_mpi_dtype(snd_node.dtype());
     
     if(mpi_dtype == MPI_DATATYPE_NULL)
@@ -611,6 +3664,10 @@ reduce(const Node &snd_node,
 
     int num_eles = (int) snd_node.dtype().number_of_elements();
 
+    index_t num_bytes = snd_node.total_bytes_compact();
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             num_bytes,
+                             rank == root ? num_bytes : 0);
     int mpi_error = MPI_Reduce(snd_ptr,
                                rcv_ptr,
                                num_eles,
@@ -618,6 +3675,7 @@ reduce(const Node &snd_node,
                                mpi_op,
                                root,
                                mpi_comm);
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -636,6 +3694,19 @@ all_reduce(const Node &snd_node,
            MPI_Op mpi_op,
            MPI_Comm mpi_comm)
 {
+    detail::StatsScope stats_scope("relay::mpi::all_reduce");
+
+    if(detail::needs_host_staging(snd_node) ||
+       detail::needs_host_staging(rcv_node))
+    {
+        Node n_snd_host;
+        Node n_rcv_host;
+        detail::stage_to_host(snd_node, n_snd_host);
+        int mpi_error = all_reduce(n_snd_host, n_rcv_host, mpi_op, mpi_comm);
+        detail::stage_from_host(n_rcv_host, rcv_node);
+        return mpi_error;
+    }
+
     MPI_Datatype mpi_dtype = conduit_dtype_to_mpi_dtype(snd_node.dtype());
     
     if(mpi_dtype == MPI_DATATYPE_NULL)
@@ -685,12 +3756,16 @@ all_reduce(const Node &snd_node,
 
     int num_eles = (int) snd_node.dtype().number_of_elements();
 
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             snd_node.total_bytes_compact(),
+                             snd_node.total_bytes_compact());
     int mpi_error = MPI_Allreduce(snd_ptr,
                                   rcv_ptr,
                                   num_eles,
                                   mpi_dtype,
                                   mpi_op,
                                   mpi_comm);
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
@@ -824,6 +3899,78 @@ prod_all_reduce(const Node &snd_node,
 
 }
 
+//---------------------------------------------------------------------------//
+int
+tree_reduce(const Node &snd_node,
+            Node &rcv_node,
+            MPI_Op mpi_op,
+            int root,
+            MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::tree_reduce");
+
+    int op = 0;
+    if(!detail::tree_reduce_op_from_mpi_op(mpi_op, op))
+    {
+        CONDUIT_ERROR("Unsupported MPI_Op for mpi::tree_reduce"
+                      " (expected MPI_SUM, MPI_MIN, MPI_MAX or MPI_PROD)");
+    }
+    return detail::tree_reduce(snd_node, rcv_node, NULL, op, root, mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+tree_reduce(const Node &snd_node,
+            Node &rcv_node,
+            const Node &leaf_ops,
+            int root,
+            MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::tree_reduce");
+
+    return detail::tree_reduce(snd_node,
+                               rcv_node,
+                               &leaf_ops,
+                               detail::TREE_REDUCE_SUM,
+                               root,
+                               mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+tree_all_reduce(const Node &snd_node,
+                Node &rcv_node,
+                MPI_Op mpi_op,
+                MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::tree_all_reduce");
+
+    int op = 0;
+    if(!detail::tree_reduce_op_from_mpi_op(mpi_op, op))
+    {
+        CONDUIT_ERROR("Unsupported MPI_Op for mpi::tree_all_reduce"
+                      " (expected MPI_SUM, MPI_MIN, MPI_MAX or MPI_PROD)");
+    }
+    return detail::tree_reduce(snd_node, rcv_node, NULL, op, -1, mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+tree_all_reduce(const Node &snd_node,
+                Node &rcv_node,
+                const Node &leaf_ops,
+                MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::tree_all_reduce");
+
+    return detail::tree_reduce(snd_node,
+                               rcv_node,
+                               &leaf_ops,
+                               detail::TREE_REDUCE_SUM,
+                               -1,
+                               mpi_comm);
+}
+
 
 
 //---------------------------------------------------------------------------//
@@ -834,38 +3981,52 @@ isend(const Node &node,
       MPI_Comm mpi_comm,
       Request *request) 
 {
+    detail::StatsScope stats_scope("relay::mpi::isend");
+
 
     const void *data_ptr  = node.contiguous_data_ptr();
     index_t     data_size = node.total_bytes_compact();
 
-    // note: this checks for both compact and contig
-    if( data_ptr == NULL ||
-       !node.is_compact() )
-    {
-        node.compact_to(request->m_buffer);
-        data_ptr  = request->m_buffer.data_ptr();
-    }
+    detail::ByteCount data_bytes(data_size);
+    int          data_count = data_bytes.count();
+    MPI_Datatype data_type  = data_bytes.type();
 
     // for wait_all,  this must always be NULL except for
     // the irecv cases where copy out is necessary
     // isend case must always be NULL
     request->m_rcv_ptr = NULL;
+    request->m_collective = NULL;
+    request->m_pool = NULL;
 
-
-    if(!conduit::utils::value_fits<index_t,int>(data_size))
+    // note: this checks for both compact and contig
+    if( data_ptr == NULL ||
+       !node.is_compact() ||
+       detail::needs_host_staging(node))
     {
-        CONDUIT_INFO("Warning size value (" << data_size << ")"
-                     " exceeds the size of MPI_Isend max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
+        // send directly from the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(node, base, data_type))
+        {
+            data_ptr   = base;
+            data_count = 1;
+        }
+        else
+        {
+            detail::request_stage_to_host(node, mpi_comm, request);
+            data_ptr  = request->m_buffer.data_ptr();
+        }
     }
 
+
+    detail::StatsTimer timer(detail::STATS_DATA, data_size);
     int mpi_error =  MPI_Isend(const_cast<void*>(data_ptr), 
-                               static_cast<int>(data_size),
-                               MPI_BYTE, 
+                               data_count,
+                               data_type, 
                                dest, 
                                tag,
                                mpi_comm,
                                &(request->m_request));
+    timer.stop();
                                
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     return mpi_error;
@@ -879,41 +4040,53 @@ irecv(Node &node,
       MPI_Comm mpi_comm,
       Request *request) 
 {
+    detail::StatsScope stats_scope("relay::mpi::irecv");
+
     // if rcv is compact, we can write directly into recv
     // if it's not compact, we need a recv_buffer
 
     void    *data_ptr  = node.contiguous_data_ptr();
     index_t  data_size = node.total_bytes_compact();
 
-    // note: this checks for both compact and contig
-    if(data_ptr != NULL &&
-       node.is_compact() )
-    {
-        // for wait_all,  this must always be NULL except for
-        // the irecv cases where copy out is necessary
-        request->m_rcv_ptr = NULL;
-    }
-    else
-    {
-        node.compact_to(request->m_buffer);
-        data_ptr  = request->m_buffer.data_ptr();
-        request->m_rcv_ptr = &node;
-    }
+    detail::ByteCount data_bytes(data_size);
+    int          data_count = data_bytes.count();
+    MPI_Datatype data_type  = data_bytes.type();
+
+    // for wait_all,  this must always be NULL except for
+    // the irecv cases where copy out is necessary
+    request->m_rcv_ptr = NULL;
+    request->m_collective = NULL;
+    request->m_pool = NULL;
 
-    if(!conduit::utils::value_fits<index_t,int>(data_size))
+    // note: this checks for both compact and contig
+    if(data_ptr == NULL ||
+       !node.is_compact() ||
+       detail::needs_host_staging(node))
     {
-        CONDUIT_INFO("Warning size value (" << data_size << ")"
-                     " exceeds the size of MPI_Irecv max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
+        // receive directly into the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(node, base, data_type))
+        {
+            data_ptr   = base;
+            data_count = 1;
+        }
+        else
+        {
+            detail::request_host_buffer(node, mpi_comm, request);
+            data_ptr  = request->m_buffer.data_ptr();
+            request->m_rcv_ptr = &node;
+        }
     }
 
+    detail::StatsTimer timer(detail::STATS_DATA, 0, data_size);
     int mpi_error =  MPI_Irecv(data_ptr,
-                               static_cast<int>(data_size),
-                               MPI_BYTE,
+                               data_count,
+                               data_type,
                                src,
                                tag,
                                mpi_comm,
                                &(request->m_request));
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     return mpi_error;
@@ -926,41 +4099,53 @@ irecv(Node &node,
       MPI_Comm mpi_comm,
       Request *request) 
 {
+    detail::StatsScope stats_scope("relay::mpi::irecv");
+
     // if rcv is compact, we can write directly into recv
     // if it's not compact, we need a recv_buffer
 
     void    *data_ptr  = node.contiguous_data_ptr();
     index_t  data_size = node.total_bytes_compact();
 
-    // note: this checks for both compact and contig
-    if(data_ptr != NULL &&
-       node.is_compact() )
-    {
-        // for wait_all,  this must always be NULL except for
-        // the irecv cases where copy out is necessary
-        request->m_rcv_ptr = NULL;
-    }
-    else
-    {
-        node.compact_to(request->m_buffer);
-        data_ptr  = request->m_buffer.data_ptr();
-        request->m_rcv_ptr = &node;
-    }
+    detail::ByteCount data_bytes(data_size);
+    int          data_count = data_bytes.count();
+    MPI_Datatype data_type  = data_bytes.type();
+
+    // for wait_all,  this must always be NULL except for
+    // the irecv cases where copy out is necessary
+    request->m_rcv_ptr = NULL;
+    request->m_collective = NULL;
+    request->m_pool = NULL;
 
-    if(!conduit::utils::value_fits<index_t,int>(data_size))
+    // note: this checks for both compact and contig
+    if(data_ptr == NULL ||
+       !node.is_compact() ||
+       detail::needs_host_staging(node))
     {
-        CONDUIT_INFO("Warning size value (" << data_size << ")"
-                     " exceeds the size of MPI_Irecv max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
+        // receive directly into the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(node, base, data_type))
+        {
+            data_ptr   = base;
+            data_count = 1;
+        }
+        else
+        {
+            detail::request_host_buffer(node, mpi_comm, request);
+            data_ptr  = request->m_buffer.data_ptr();
+            request->m_rcv_ptr = &node;
+        }
     }
 
+    detail::StatsTimer timer(detail::STATS_DATA, 0, data_size);
     int mpi_error =  MPI_Irecv(data_ptr,
-                               static_cast<int>(data_size),
-                               MPI_BYTE,
+                               data_count,
+                               data_type,
                                MPI_ANY_SOURCE,
                                MPI_ANY_TAG,
                                mpi_comm,
                                &(request->m_request));
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     return mpi_error;
@@ -974,8 +4159,21 @@ int
 wait(Request *request,
      MPI_Status *status) 
 {
+    detail::StatsScope stats_scope("relay::mpi::wait");
+
+    detail::StatsTimer wait_timer(detail::STATS_WAIT);
     int mpi_error = MPI_Wait(&(request->m_request), status);
+    wait_timer.stop();
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // run the remaining stages of nonblocking collectives
+    while(!detail::advance_collective(request))
+    {
+        detail::StatsTimer wait_timer(detail::STATS_WAIT);
+        mpi_error = MPI_Wait(&(request->m_request), status);
+        wait_timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
     
     // we need to update if m_rcv_ptr was used
     // this will only be non NULL in the recv copy out case,
@@ -985,7 +4183,7 @@ wait(Request *request,
         request->m_rcv_ptr->update(request->m_buffer);
     }
 
-    request->m_buffer.reset();
+    detail::release_request_buffer(request);
     request->m_rcv_ptr = NULL;
 
     return mpi_error;
@@ -1015,6 +4213,8 @@ wait_all(int count,
          Request requests[],
          MPI_Status statuses[])
 {
+    detail::StatsScope stats_scope("relay::mpi::wait_all");
+
      MPI_Request *justrequests = new MPI_Request[count];
 
      for (int i = 0; i < count; ++i)
@@ -1023,45 +4223,475 @@ wait_all(int count,
          justrequests[i] = requests[i].m_request;
      }
 
+     detail::StatsTimer wait_timer(detail::STATS_WAIT);
      int mpi_error = MPI_Waitall(count, justrequests, statuses);
+     wait_timer.stop();
      CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-     for (int i = 0; i < count; ++i)
-     {
-         // if this request is a recv, we need to check for copy out
-         // m_rcv_ptr will always be NULL, unless we have done a
-         // irecv where we need to use the pointer.
-         if(requests[i].m_rcv_ptr != NULL)
-         {
-             requests[i].m_rcv_ptr->update(requests[i].m_buffer);
-             requests[i].m_rcv_ptr = NULL;
-         }
+     for (int i = 0; i < count; ++i)
+     {
+         // if this request is a recv, we need to check for copy out
+         // m_rcv_ptr will always be NULL, unless we have done a
+         // irecv where we need to use the pointer.
+         if(requests[i].m_rcv_ptr != NULL)
+         {
+             requests[i].m_rcv_ptr->update(requests[i].m_buffer);
+             requests[i].m_rcv_ptr = NULL;
+         }
+
+         requests[i].m_request = justrequests[i];
+         detail::release_request_buffer(&requests[i]);
+     }
+
+     delete [] justrequests;
+
+     // run the remaining stages of nonblocking collectives, a stage of
+     // each at a time
+     std::vector<int> pending;
+     for (int i = 0; i < count; ++i)
+     {
+         if(requests[i].m_collective != NULL)
+         {
+             pending.push_back(i);
+         }
+     }
+
+     while(!pending.empty())
+     {
+         std::vector<int> active;
+         for (size_t i = 0; i < pending.size(); ++i)
+         {
+             if(!detail::advance_collective(&requests[pending[i]]))
+             {
+                 active.push_back(pending[i]);
+             }
+         }
+
+         if(active.empty())
+         {
+             break;
+         }
+
+         std::vector<MPI_Request> active_requests(active.size());
+         std::vector<MPI_Status>  active_statuses(active.size());
+         for (size_t i = 0; i < active.size(); ++i)
+         {
+             active_requests[i] = requests[active[i]].m_request;
+         }
+
+         detail::StatsTimer wait_timer(detail::STATS_WAIT);
+         mpi_error = MPI_Waitall((int)active.size(),
+                                 &active_requests[0],
+                                 &active_statuses[0]);
+         wait_timer.stop();
+         CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+         for (size_t i = 0; i < active.size(); ++i)
+         {
+             requests[active[i]].m_request = active_requests[i];
+             if(statuses != MPI_STATUSES_IGNORE)
+             {
+                 statuses[active[i]] = active_statuses[i];
+             }
+         }
+
+         pending = active;
+     }
+
+     return mpi_error; 
+}
+
+//---------------------------------------------------------------------------//
+int
+wait_all_send(int count,
+              Request requests[],
+              MPI_Status statuses[]) 
+{
+    return wait_all(count,requests,statuses);
+}
+
+//---------------------------------------------------------------------------//
+int
+wait_all_recv(int count,
+              Request requests[],
+              MPI_Status statuses[])
+{
+   return  wait_all(count,requests,statuses);
+}
+
+//---------------------------------------------------------------------------//
+int
+test(Request *request,
+     int *flag,
+     MPI_Status *status)
+{
+    detail::StatsScope stats_scope("relay::mpi::test");
+
+    detail::StatsTimer wait_timer(detail::STATS_WAIT);
+    int mpi_error = MPI_Test(&(request->m_request), flag, status);
+    wait_timer.stop();
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // post the next stages of nonblocking collectives
+    while(*flag && !detail::advance_collective(request))
+    {
+        detail::StatsTimer wait_timer(detail::STATS_WAIT);
+        mpi_error = MPI_Test(&(request->m_request), flag, status);
+        wait_timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    if(*flag)
+    {
+        if(request->m_rcv_ptr)
+        {
+            request->m_rcv_ptr->update(request->m_buffer);
+        }
+
+        detail::release_request_buffer(request);
+        request->m_rcv_ptr = NULL;
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+ibroadcast(Node &node,
+           int root,
+           MPI_Comm comm,
+           Request *request)
+{
+    detail::StatsScope stats_scope("relay::mpi::ibroadcast");
+
+    int rank = mpi::rank(comm);
+
+    request->m_rcv_ptr    = NULL;
+    request->m_collective = NULL;
+    request->m_pool       = NULL;
+
+    void    *bcast_data_ptr  = node.contiguous_data_ptr();
+    index_t  bcast_data_size = node.total_bytes_compact();
+
+    if( bcast_data_ptr == NULL ||
+        ! node.is_compact() ||
+        detail::needs_host_staging(node))
+    {
+        if(rank == root)
+        {
+            detail::request_stage_to_host(node, comm, request);
+        }
+        else
+        {
+            // copy out on wait
+            detail::request_host_buffer(node, comm, request);
+            request->m_rcv_ptr = &node;
+        }
+        bcast_data_ptr = request->m_buffer.data_ptr();
+    }
+
+    detail::ByteCount bcast_count(bcast_data_size);
+
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             rank == root ? bcast_data_size : 0,
+                             rank == root ? 0 : bcast_data_size);
+    int mpi_error = MPI_Ibcast(bcast_data_ptr,
+                               bcast_count.count(),
+                               bcast_count.type(),
+                               root,
+                               comm,
+                               &(request->m_request));
+    timer.stop();
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+ibroadcast_using_schema(Node &node,
+                        int root,
+                        MPI_Comm comm,
+                        Request *request)
+{
+    detail::StatsScope stats_scope("relay::mpi::ibroadcast_using_schema");
+
+    request->m_rcv_ptr    = NULL;
+    request->m_pool       = NULL;
+    request->m_collective = new detail::BroadcastUsingSchema(node,
+                                                             root,
+                                                             comm);
+    return request->m_collective->start(request->m_request);
+}
+
+//---------------------------------------------------------------------------//
+int
+iall_reduce(const Node &snd_node,
+            Node &rcv_node,
+            MPI_Op mpi_op,
+            MPI_Comm mpi_comm,
+            Request *request)
+{
+    detail::StatsScope stats_scope("relay::mpi::iall_reduce");
+
+    MPI_Datatype mpi_dtype = conduit_dtype_to_mpi_dtype(snd_node.dtype());
+
+    if(mpi_dtype == MPI_DATATYPE_NULL)
+    {
+        CONDUIT_ERROR("Unsupported send DataType for mpi::iall_reduce"
+                      << snd_node.dtype().name());
+    }
+
+    request->m_rcv_ptr    = NULL;
+    request->m_collective = NULL;
+    request->m_pool       = NULL;
+
+    const void *snd_ptr = NULL;
+    void       *rcv_ptr = rcv_node.contiguous_data_ptr();
+
+    if(snd_node.is_compact() && !detail::needs_host_staging(snd_node))
+    {
+        snd_ptr = snd_node.data_ptr();
+    }
+
+    if( !snd_node.compatible(rcv_node) ||
+        rcv_ptr == NULL ||
+        !rcv_node.is_compact() ||
+        detail::needs_host_staging(rcv_node))
+    {
+        // reduce into a compact buffer, copy out on wait
+        if(snd_ptr == NULL)
+        {
+            detail::request_stage_to_host(snd_node, mpi_comm, request);
+        }
+        else
+        {
+            detail::request_host_buffer(snd_node, mpi_comm, request);
+        }
+        rcv_ptr = request->m_buffer.data_ptr();
+        request->m_rcv_ptr = &rcv_node;
+    }
+    else if(snd_ptr == NULL)
+    {
+        rcv_node.update(snd_node);
+    }
+
+    // non compact send values were copied to the receive buffer,
+    // they are reduced in place
+    if(snd_ptr == NULL)
+    {
+        snd_ptr = MPI_IN_PLACE;
+    }
+
+    int num_eles = (int) snd_node.dtype().number_of_elements();
+
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             snd_node.total_bytes_compact(),
+                             snd_node.total_bytes_compact());
+    int mpi_error = MPI_Iallreduce(snd_ptr,
+                                   rcv_ptr,
+                                   num_eles,
+                                   mpi_dtype,
+                                   mpi_op,
+                                   mpi_comm,
+                                   &(request->m_request));
+    timer.stop();
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+igather(Node &send_node,
+        Node &recv_node,
+        int root,
+        MPI_Comm mpi_comm,
+        Request *request)
+{
+    detail::StatsScope stats_scope("relay::mpi::igather");
+
+    Schema s_snd_compact;
+    send_node.schema().compact_to(s_snd_compact);
+
+    request->m_rcv_ptr    = NULL;
+    request->m_collective = NULL;
+    request->m_pool       = NULL;
+
+    const void *snd_ptr  = send_node.contiguous_data_ptr();
+    index_t     snd_size = send_node.total_bytes_compact();
+
+    detail::ByteCount snd_bytes(snd_size);
+    int          snd_count = snd_bytes.count();
+    MPI_Datatype snd_type  = snd_bytes.type();
+    void        *snd_base  = NULL;
+
+    int mpi_rank = mpi::rank(mpi_comm);
+    int mpi_size = mpi::size(mpi_comm);
+    bool staged  = detail::needs_host_staging(send_node);
+
+    void *rcv_ptr = NULL;
+    if(mpi_rank == root)
+    {
+        recv_node.list_of(s_snd_compact,
+                          mpi_size);
+        rcv_ptr = detail::igather_recv_buffer(send_node,
+                                              recv_node,
+                                              mpi_rank,
+                                              request);
+    }
+
+    if(rcv_ptr != NULL && staged)
+    {
+        // the send values were copied to the receive buffer
+        snd_ptr = MPI_IN_PLACE;
+    }
+    else if(snd_ptr != NULL &&
+            send_node.is_compact() &&
+            !staged)
+    {
+        snd_ptr  = send_node.data_ptr();
+    }
+    else if(detail::node_datatype(send_node, snd_base, snd_type))
+    {
+        // send directly from the node's memory
+        snd_ptr   = snd_base;
+        snd_count = 1;
+    }
+    else
+    {
+        detail::request_stage_to_host(send_node, mpi_comm, request);
+        snd_ptr  = request->m_buffer.data_ptr();
+    }
+
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             snd_size,
+                             mpi_rank == root ? snd_size * mpi_size : 0);
+    int mpi_error = MPI_Igather(const_cast<void*>(snd_ptr),
+                                snd_count,
+                                snd_type,
+                                rcv_ptr,
+                                snd_bytes.count(),
+                                snd_bytes.type(),
+                                root,
+                                mpi_comm,
+                                &(request->m_request));
+    timer.stop();
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+iall_gather(Node &send_node,
+            Node &recv_node,
+            MPI_Comm mpi_comm,
+            Request *request)
+{
+    detail::StatsScope stats_scope("relay::mpi::iall_gather");
+
+    Schema s_snd_compact;
+    send_node.schema().compact_to(s_snd_compact);
+
+    request->m_rcv_ptr    = NULL;
+    request->m_collective = NULL;
+    request->m_pool       = NULL;
+
+    const void *snd_ptr  = send_node.contiguous_data_ptr();
+    index_t     snd_size = send_node.total_bytes_compact();
+
+    detail::ByteCount snd_bytes(snd_size);
+    int          snd_count = snd_bytes.count();
+    MPI_Datatype snd_type  = snd_bytes.type();
+
+    int mpi_rank = mpi::rank(mpi_comm);
+    int mpi_size = mpi::size(mpi_comm);
+
+    recv_node.list_of(s_snd_compact,
+                      mpi_size);
+
+    void *rcv_ptr = detail::igather_recv_buffer(send_node,
+                                                recv_node,
+                                                mpi_rank,
+                                                request);
 
-         requests[i].m_request = justrequests[i];
-         requests[i].m_buffer.reset();
-     }
+    if(detail::needs_host_staging(send_node))
+    {
+        // the send values were copied to the receive buffer
+        snd_ptr = MPI_IN_PLACE;
+    }
+    else if( snd_ptr == NULL ||
+            !send_node.is_compact() )
+    {
+        // send directly from the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(send_node, base, snd_type))
+        {
+            snd_ptr   = base;
+            snd_count = 1;
+        }
+        else
+        {
+            detail::request_stage_to_host(send_node, mpi_comm, request);
+            snd_ptr  = request->m_buffer.data_ptr();
+        }
+    }
 
-     delete [] justrequests;
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             snd_size,
+                             snd_size * mpi_size);
+    int mpi_error = MPI_Iallgather(const_cast<void*>(snd_ptr),
+                                   snd_count,
+                                   snd_type,
+                                   rcv_ptr,
+                                   snd_bytes.count(),
+                                   snd_bytes.type(),
+                                   mpi_comm,
+                                   &(request->m_request));
+    timer.stop();
 
-     return mpi_error; 
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    return mpi_error;
 }
 
 //---------------------------------------------------------------------------//
 int
-wait_all_send(int count,
-              Request requests[],
-              MPI_Status statuses[]) 
+igather_using_schema(Node &send_node,
+                     Node &recv_node,
+                     int root,
+                     MPI_Comm mpi_comm,
+                     Request *request)
 {
-    return wait_all(count,requests,statuses);
+    detail::StatsScope stats_scope("relay::mpi::igather_using_schema");
+
+    request->m_rcv_ptr    = NULL;
+    request->m_pool       = NULL;
+    request->m_collective = new detail::GatherUsingSchema(send_node,
+                                                          recv_node,
+                                                          root,
+                                                          false,
+                                                          mpi_comm);
+    return request->m_collective->start(request->m_request);
 }
 
 //---------------------------------------------------------------------------//
 int
-wait_all_recv(int count,
-              Request requests[],
-              MPI_Status statuses[])
+iall_gather_using_schema(Node &send_node,
+                         Node &recv_node,
+                         MPI_Comm mpi_comm,
+                         Request *request)
 {
-   return  wait_all(count,requests,statuses);
+    detail::StatsScope stats_scope("relay::mpi::iall_gather_using_schema");
+
+    request->m_rcv_ptr    = NULL;
+    request->m_pool       = NULL;
+    request->m_collective = new detail::GatherUsingSchema(send_node,
+                                                          recv_node,
+                                                          0,
+                                                          true,
+                                                          mpi_comm);
+    return request->m_collective->start(request->m_request);
 }
 
 //---------------------------------------------------------------------------//
@@ -1071,26 +4701,50 @@ gather(Node &send_node,
        int root,
        MPI_Comm mpi_comm)
 {
+    detail::StatsScope stats_scope("relay::mpi::gather");
+
+    if(detail::needs_host_staging(send_node) ||
+       detail::needs_host_staging(recv_node))
+    {
+        Node n_snd_host;
+        Node n_rcv_host;
+        detail::stage_to_host(send_node, n_snd_host);
+        int mpi_error = gather(n_snd_host, n_rcv_host, root, mpi_comm);
+        if(mpi::rank(mpi_comm) == root)
+        {
+            detail::stage_from_host(n_rcv_host, recv_node);
+        }
+        return mpi_error;
+    }
+
     Node   n_snd_compact;
     Schema s_snd_compact;
     
     send_node.schema().compact_to(s_snd_compact);
     
     const void *snd_ptr = send_node.contiguous_data_ptr();
-    index_t    snd_size = 0;
-    
+    index_t    snd_size = send_node.total_bytes_compact();
+
+    detail::ByteCount snd_bytes(snd_size);
+    int          snd_count = snd_bytes.count();
+    MPI_Datatype snd_type  = snd_bytes.type();
+    void        *snd_base  = NULL;
     
     if(snd_ptr != NULL && 
        send_node.is_compact() )
     {
         snd_ptr  = send_node.data_ptr();
-        snd_size = send_node.total_bytes_compact();
+    }
+    else if(detail::node_datatype(send_node, snd_base, snd_type))
+    {
+        // send directly from the node's memory
+        snd_ptr   = snd_base;
+        snd_count = 1;
     }
     else
     {
         send_node.compact_to(n_snd_compact);
         snd_ptr  = n_snd_compact.data_ptr();
-        snd_size = n_snd_compact.total_bytes_compact();
     }
 
     int mpi_rank = mpi::rank(mpi_comm);
@@ -1103,21 +4757,18 @@ gather(Node &send_node,
                           mpi_size);
     }
 
-    if(!conduit::utils::value_fits<index_t,int>(snd_size))
-    {
-        CONDUIT_INFO("Warning size value (" << snd_size << ")"
-                     " exceeds the size of MPI_Gather max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
-    }
-
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             snd_size,
+                             (mpi_rank == root) ? snd_size * mpi_size : 0);
     int mpi_error = MPI_Gather( const_cast<void*>(snd_ptr), // local data
-                                static_cast<int>(snd_size), // local data len
-                                MPI_BYTE, // send chars
+                                snd_count, // local data len
+                                snd_type, // send chars
                                 recv_node.data_ptr(),  // rcv buffer
-                                static_cast<int>(snd_size), // data len 
-                                MPI_BYTE,  // rcv chars
+                                snd_bytes.count(), // data len
+                                snd_bytes.type(),  // rcv chars
                                 root,
                                 mpi_comm); // mpi com
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -1130,6 +4781,19 @@ all_gather(Node &send_node,
            Node &recv_node,
            MPI_Comm mpi_comm)
 {
+    detail::StatsScope stats_scope("relay::mpi::all_gather");
+
+    if(detail::needs_host_staging(send_node) ||
+       detail::needs_host_staging(recv_node))
+    {
+        Node n_snd_host;
+        Node n_rcv_host;
+        detail::stage_to_host(send_node, n_snd_host);
+        int mpi_error = all_gather(n_snd_host, n_rcv_host, mpi_comm);
+        detail::stage_from_host(n_rcv_host, recv_node);
+        return mpi_error;
+    }
+
     Node   n_snd_compact;
     Schema s_snd_compact;
     send_node.schema().compact_to(s_snd_compact);
@@ -1137,12 +4801,25 @@ all_gather(Node &send_node,
     const void *snd_ptr  = send_node.contiguous_data_ptr();
     index_t     snd_size = send_node.total_bytes_compact();
 
+    detail::ByteCount snd_bytes(snd_size);
+    int          snd_count = snd_bytes.count();
+    MPI_Datatype snd_type  = snd_bytes.type();
     
     if( snd_ptr == NULL ||
        !send_node.is_compact() )
     {
-        send_node.compact_to(n_snd_compact);
-        snd_ptr  = n_snd_compact.data_ptr();
+        // send directly from the node's memory if we can describe it
+        void *base = NULL;
+        if(detail::node_datatype(send_node, base, snd_type))
+        {
+            snd_ptr   = base;
+            snd_count = 1;
+        }
+        else
+        {
+            send_node.compact_to(n_snd_compact);
+            snd_ptr  = n_snd_compact.data_ptr();
+        }
     }
     // TODO: copy out support w/o always reallocing?
     // TODO: what about common case of scatter w/ leaf types?
@@ -1154,20 +4831,17 @@ all_gather(Node &send_node,
     recv_node.list_of(s_snd_compact,
                       mpi_size);
 
-    if(!conduit::utils::value_fits<index_t,int>(snd_size))
-    {
-        CONDUIT_INFO("Warning size value (" << snd_size << ")"
-                     " exceeds the size of MPI_Gather max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
-    }
-
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             snd_size,
+                             snd_size * mpi_size);
     int mpi_error = MPI_Allgather( const_cast<void*>(snd_ptr), // local data
-                                   static_cast<int>(snd_size), // local data len
-                                   MPI_BYTE, // send chars
+                                   snd_count, // local data len
+                                   snd_type, // send chars
                                    recv_node.data_ptr(),  // rcv buffer
-                                   static_cast<int>(snd_size), // data len 
-                                   MPI_BYTE,  // rcv chars
+                                   snd_bytes.count(), // data len
+                                   snd_bytes.type(),  // rcv chars
                                    mpi_comm); // mpi com
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -1183,40 +4857,56 @@ gather_using_schema(Node &send_node,
                     int root, 
                     MPI_Comm mpi_comm)
 {
+    detail::StatsScope stats_scope("relay::mpi::gather_using_schema");
+
+    if(detail::needs_host_staging(send_node) ||
+       detail::needs_host_staging(recv_node))
+    {
+        Node n_snd_host;
+        Node n_rcv_host;
+        detail::stage_to_host(send_node, n_snd_host);
+        int mpi_error = gather_using_schema(n_snd_host, n_rcv_host, root, mpi_comm);
+        if(mpi::rank(mpi_comm) == root)
+        {
+            detail::stage_from_host(n_rcv_host, recv_node);
+        }
+        return mpi_error;
+    }
+
     Node n_snd_compact;
     send_node.compact_to(n_snd_compact);
 
     int m_size = mpi::size(mpi_comm);
     int m_rank = mpi::rank(mpi_comm);
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    std::vector<uint8> schema_bytes;
+    n_snd_compact.schema().serialize_binary(schema_bytes,true);
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
-    int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
+    int64 schema_len = (int64)schema_bytes.size();
+    int64 data_len   = (int64)n_snd_compact.total_bytes_compact();
     
     // to do the conduit gatherv, first need a gather to get the 
-    // schema and data buffer sizes
+    // schema and data buffer sizes. all ranks get the data sizes, 
+    // they pick how the data is gathered (data may exceed int counts)
     
-    int snd_sizes[] = {schema_len, data_len};
+    int64 snd_sizes[] = {schema_len, data_len};
 
     Node n_rcv_sizes;
 
-    if( m_rank == root )
-    {
-        Schema s;
-        s["schema_len"].set(DataType::c_int());
-        s["data_len"].set(DataType::c_int());
-        n_rcv_sizes.list_of(s,m_size);
-    }
+    Schema s;
+    s["schema_len"].set(DataType::int64());
+    s["data_len"].set(DataType::int64());
+    n_rcv_sizes.list_of(s,m_size);
 
-    int mpi_error = MPI_Gather( snd_sizes, // local data
-                                2, // two ints per rank
-                                MPI_INT, // send ints
-                                n_rcv_sizes.data_ptr(),  // rcv buffer
-                                2,  // two ints per rank
-                                MPI_INT,  // rcv ints
-                                root,  // id of root for gather op
-                                mpi_comm); // mpi com
+    detail::StatsTimer sizes_timer(detail::STATS_SCHEMA, 16, 16 * m_size);
+    int mpi_error = MPI_Allgather( snd_sizes, // local data
+                                   2, // two int64s per rank
+                                   MPI_INT64_T, // send int64s
+                                   n_rcv_sizes.data_ptr(),  // rcv buffer
+                                   2,  // two int64s per rank
+                                   MPI_INT64_T,  // rcv int64s
+                                   mpi_comm); // mpi com
+    sizes_timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
                                 
@@ -1226,47 +4916,51 @@ gather_using_schema(Node &send_node,
     int  *schema_rcv_displs = NULL;
     char *schema_rcv_buff   = NULL;
 
-    int  *data_rcv_counts = NULL;
-    int  *data_rcv_displs = NULL;
+    std::vector<index_t> data_rcv_counts(m_size);
+    std::vector<index_t> data_rcv_displs(m_size);
     char *data_rcv_buff   = NULL;
 
-    // we only need rcv params on the gather root
+    index_t data_curr_displ = 0;
+    int schema_curr_displ = 0;
+    int i=0;
+
+    NodeIterator itr = n_rcv_sizes.children();
+    while(itr.has_next())
+    {
+        Node &curr = itr.next();
+        index_t data_curr_count = (index_t)curr["data_len"].as_int64();
+
+        data_rcv_counts[i] = data_curr_count;
+        data_rcv_displs[i] = data_curr_displ;
+        data_curr_displ   += data_curr_count;
+
+        i++;
+    }
+
+    // we only need schema rcv params on the gather root
     if( m_rank == root )
     {
         // alloc data for the mpi gather counts and displ arrays
         n_rcv_tmp["schemas/counts"].set(DataType::c_int(m_size));
         n_rcv_tmp["schemas/displs"].set(DataType::c_int(m_size));
 
-        n_rcv_tmp["data/counts"].set(DataType::c_int(m_size));
-        n_rcv_tmp["data/displs"].set(DataType::c_int(m_size));
-
         // get pointers to counts and displs
         schema_rcv_counts = n_rcv_tmp["schemas/counts"].value();
         schema_rcv_displs = n_rcv_tmp["schemas/displs"].value();
 
-        data_rcv_counts = n_rcv_tmp["data/counts"].value();
-        data_rcv_displs = n_rcv_tmp["data/displs"].value();
-
-        int schema_curr_displ = 0;
-        int data_curr_displ   = 0;
-        int i=0;
+        i=0;
         
-        NodeIterator itr = n_rcv_sizes.children();
+        itr = n_rcv_sizes.children();
         while(itr.has_next())
         {
             Node &curr = itr.next();
 
-            int schema_curr_count = curr["schema_len"].value();
-            int data_curr_count   = curr["data_len"].value();
+            int schema_curr_count = (int)curr["schema_len"].as_int64();
             
             schema_rcv_counts[i] = schema_curr_count;
             schema_rcv_displs[i] = schema_curr_displ;
             schema_curr_displ   += schema_curr_count;
             
-            data_rcv_counts[i] = data_curr_count;
-            data_rcv_displs[i] = data_curr_displ;
-            data_curr_displ   += data_curr_count;
-            
             i++;
         }
         
@@ -1274,8 +4968,11 @@ gather_using_schema(Node &send_node,
         schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
     }
 
-    mpi_error = MPI_Gatherv( const_cast <char*>(schema_str.c_str()),
-                             schema_len,
+    detail::StatsTimer schema_timer(detail::STATS_SCHEMA,
+                                    schema_len,
+                                    schema_curr_displ);
+    mpi_error = MPI_Gatherv( &schema_bytes[0],
+                             static_cast<int>(schema_len),
                              MPI_BYTE,
                              schema_rcv_buff,
                              schema_rcv_counts,
@@ -1283,10 +4980,11 @@ gather_using_schema(Node &send_node,
                              MPI_BYTE,
                              root,
                              mpi_comm);
+    schema_timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // build all schemas from JSON, compact them.
+    // build all schemas from their binary encodings, compact them.
     Schema rcv_schema;
     if( m_rank == root )
     {
@@ -1294,10 +4992,11 @@ gather_using_schema(Node &send_node,
         // TODO: Revisit, I think we can do this better
 
         Schema s_tmp;
-        for(int i=0;i < m_size; i++)
+        for(i=0;i < m_size; i++)
         {
-            Schema &s = s_tmp.append();
-            s.set(&schema_rcv_buff[schema_rcv_displs[i]]);
+            Schema &s_new = s_tmp.append();
+            s_new.deserialize_binary((uint8*)&schema_rcv_buff[schema_rcv_displs[i]],
+                                     schema_rcv_counts[i]);
         }
         
         s_tmp.compact_to(rcv_schema);
@@ -1312,152 +5011,491 @@ gather_using_schema(Node &send_node,
         data_rcv_buff = (char*)recv_node.data_ptr();
     }
     
-    mpi_error = MPI_Gatherv( n_snd_compact.data_ptr(),
-                             data_len,
-                             MPI_BYTE,
-                             data_rcv_buff,
-                             data_rcv_counts,
-                             data_rcv_displs,
-                             MPI_BYTE,
-                             root,
-                             mpi_comm);
+    detail::ByteCount data_count((index_t)data_len);
+
+    mpi_error = detail::gatherv_bytes(n_snd_compact.data_ptr(),
+                                      data_count.count(),
+                                      data_count.type(),
+                                      data_rcv_buff,
+                                      data_rcv_counts,
+                                      data_rcv_displs,
+                                      root,
+                                      mpi_comm);
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+all_gather_using_schema(Node &send_node,
+                        Node &recv_node,
+                        MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::all_gather_using_schema");
+
+    if(detail::needs_host_staging(send_node) ||
+       detail::needs_host_staging(recv_node))
+    {
+        Node n_snd_host;
+        Node n_rcv_host;
+        detail::stage_to_host(send_node, n_snd_host);
+        int mpi_error = all_gather_using_schema(n_snd_host, n_rcv_host, mpi_comm);
+        detail::stage_from_host(n_rcv_host, recv_node);
+        return mpi_error;
+    }
+
+    Node n_snd_compact;
+    send_node.compact_to(n_snd_compact);
+
+    int m_size = mpi::size(mpi_comm);
+
+    std::vector<uint8> schema_bytes;
+    n_snd_compact.schema().serialize_binary(schema_bytes,true);
+
+    int64 schema_len = (int64)schema_bytes.size();
+    int64 data_len   = (int64)n_snd_compact.total_bytes_compact();
+    
+    // to do the conduit gatherv, first need a gather to get the 
+    // schema and data buffer sizes
+    
+    int64 snd_sizes[] = {schema_len, data_len};
+
+    Node n_rcv_sizes;
+
+    Schema s;
+    s["schema_len"].set(DataType::int64());
+    s["data_len"].set(DataType::int64());
+    n_rcv_sizes.list_of(s,m_size);
+
+    detail::StatsTimer sizes_timer(detail::STATS_SCHEMA, 16, 16 * m_size);
+    int mpi_error = MPI_Allgather( snd_sizes, // local data
+                                   2, // two int64s per rank
+                                   MPI_INT64_T, // send int64s
+                                   n_rcv_sizes.data_ptr(),  // rcv buffer
+                                   2,  // two int64s per rank
+                                   MPI_INT64_T,  // rcv int64s
+                                   mpi_comm); // mpi com
+    sizes_timer.stop();
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+                                
+    Node n_rcv_tmp;
+    
+    int  *schema_rcv_counts = NULL;
+    int  *schema_rcv_displs = NULL;
+    char *schema_rcv_buff   = NULL;
+
+    std::vector<index_t> data_rcv_counts(m_size);
+    std::vector<index_t> data_rcv_displs(m_size);
+    char *data_rcv_buff   = NULL;
+
+
+    // alloc data for the mpi gather counts and displ arrays
+    n_rcv_tmp["schemas/counts"].set(DataType::c_int(m_size));
+    n_rcv_tmp["schemas/displs"].set(DataType::c_int(m_size));
+
+    // get pointers to counts and displs
+    schema_rcv_counts = n_rcv_tmp["schemas/counts"].value();
+    schema_rcv_displs = n_rcv_tmp["schemas/displs"].value();
+
+    int     schema_curr_displ = 0;
+    index_t data_curr_displ   = 0;
+    
+    NodeIterator itr = n_rcv_sizes.children();
+
+    index_t child_idx = 0;
+    
+    while(itr.has_next())
+    {
+        Node &curr = itr.next();
+
+        int     schema_curr_count = (int)curr["schema_len"].as_int64();
+        index_t data_curr_count   = (index_t)curr["data_len"].as_int64();
+        
+        schema_rcv_counts[child_idx] = schema_curr_count;
+        schema_rcv_displs[child_idx] = schema_curr_displ;
+        schema_curr_displ   += schema_curr_count;
+        
+        data_rcv_counts[child_idx] = data_curr_count;
+        data_rcv_displs[child_idx] = data_curr_displ;
+        data_curr_displ   += data_curr_count;
+        
+        child_idx+=1;
+    }
+    
+    n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
+    schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
+
+    detail::StatsTimer schema_timer(detail::STATS_SCHEMA,
+                                    schema_len,
+                                    schema_curr_displ);
+    mpi_error = MPI_Allgatherv( &schema_bytes[0],
+                                static_cast<int>(schema_len),
+                                MPI_BYTE,
+                                schema_rcv_buff,
+                                schema_rcv_counts,
+                                schema_rcv_displs,
+                                MPI_BYTE,
+                                mpi_comm);
+    schema_timer.stop();
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // build all schemas from their binary encodings, compact them.
+    Schema rcv_schema;
+    //TODO: should we make it easer to create a compact schema?
+    // TODO: Revisit, I think we can do this better
+    Schema s_tmp;
+    for(int s_idx=0; s_idx < m_size; s_idx++)
+    {
+        Schema &s_new = s_tmp.append();
+        s_new.deserialize_binary((uint8*)&schema_rcv_buff[schema_rcv_displs[s_idx]],
+                                 schema_rcv_counts[s_idx]);
+    }
+    
+    // TODO can we support copy out w/out realloc
+    s_tmp.compact_to(rcv_schema);
+
+    // allocate data to hold the gather result
+    recv_node.set(rcv_schema);
+    data_rcv_buff = (char*)recv_node.data_ptr();
+    
+    detail::ByteCount data_count((index_t)data_len);
+
+    mpi_error = detail::all_gatherv_bytes(n_snd_compact.data_ptr(),
+                                          data_count.count(),
+                                          data_count.type(),
+                                          data_rcv_buff,
+                                          data_rcv_counts,
+                                          data_rcv_displs,
+                                          mpi_comm);
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// bytes rounded up to a multiple of 8, keeps gathered data aligned
+static index_t
+gatherv_align(index_t num_bytes)
+{
+    return (num_bytes + 7) & ~((index_t)7);
+}
+
+//---------------------------------------------------------------------------//
+// gatherv and all_gatherv: each rank sends its binary schema (padded to 8
+// bytes) followed by its compact data, as one message
+//---------------------------------------------------------------------------//
+static int
+gatherv_schema_and_data(const Node &send_node,
+                        Node &recv_node,
+                        int root,
+                        bool all,
+                        MPI_Comm mpi_comm)
+{
+    // the send node is staged by the message datatype fallbacks
+    if(detail::needs_host_staging(recv_node))
+    {
+        Node n_rcv_host;
+        int mpi_error = gatherv_schema_and_data(send_node,
+                                                n_rcv_host,
+                                                root,
+                                                all,
+                                                mpi_comm);
+        if(all || mpi::rank(mpi_comm) == root)
+        {
+            detail::stage_from_host(n_rcv_host, recv_node);
+        }
+        return mpi_error;
+    }
+
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    Schema s_snd_compact;
+    if(send_node.is_compact() && send_node.is_contiguous())
+    {
+        s_snd_compact = send_node.schema();
+    }
+    else
+    {
+        send_node.schema().compact_to(s_snd_compact);
+    }
+
+    std::vector<uint8> hdr_bytes;
+    s_snd_compact.serialize_binary(hdr_bytes,true);
+
+    int64 snd_sizes[] = {(int64)hdr_bytes.size(),
+                         (int64)send_node.total_bytes_compact()};
+
+    hdr_bytes.resize((size_t)gatherv_align((index_t)hdr_bytes.size()), 0);
+
+    // all ranks get the sizes, they pick how the data is gathered
+    std::vector<int64> rcv_sizes(2 * m_size);
+    detail::StatsTimer timer(detail::STATS_SCHEMA, 16, 16 * m_size);
+    int mpi_error = MPI_Allgather(snd_sizes,
+                                  2,
+                                  MPI_INT64_T,
+                                  &rcv_sizes[0],
+                                  2,
+                                  MPI_INT64_T,
+                                  mpi_comm);
+    timer.stop();
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    std::vector<index_t> rcv_counts(m_size);
+    std::vector<index_t> rcv_displs(m_size);
+    index_t curr_displ = 0;
+    for(int i = 0; i < m_size; i++)
+    {
+        rcv_counts[i] = gatherv_align((index_t)rcv_sizes[2*i]) +
+                        (index_t)rcv_sizes[2*i+1];
+        rcv_displs[i] = curr_displ;
+        curr_displ   += gatherv_align(rcv_counts[i]);
+    }
+
+    // send the header and the data from send_node's memory if we can
+    // describe it, otherwise from a compact copy
+    index_t msg_size = (index_t)hdr_bytes.size() + (index_t)snd_sizes[1];
+    detail::ByteCount msg_count(msg_size);
+
+    const void  *snd_ptr   = MPI_BOTTOM;
+    int          snd_count = 1;
+    MPI_Datatype snd_type  = MPI_DATATYPE_NULL;
+    MPI_Datatype msg_type  = MPI_DATATYPE_NULL;
+    Node         n_msg;
+
+    if(detail::header_and_node_datatype(&hdr_bytes[0],
+                                        (index_t)hdr_bytes.size(),
+                                        send_node,
+                                        msg_type))
+    {
+        snd_type = msg_type;
+    }
+    else
+    {
+        msg_type = MPI_DATATYPE_NULL;
+        n_msg.set(DataType::uint8(msg_size));
+        uint8 *msg_ptr = n_msg.value();
+        memcpy(msg_ptr, &hdr_bytes[0], hdr_bytes.size());
+        if(snd_sizes[1] > 0)
+        {
+            Node n_msg_data;
+            n_msg_data.set_external(s_snd_compact,
+                                    msg_ptr + hdr_bytes.size());
+            n_msg_data.update(send_node);
+        }
+        snd_ptr   = msg_ptr;
+        snd_count = msg_count.count();
+        snd_type  = msg_count.type();
+    }
+
+    // on the receiving ranks, recv_node owns one buffer with a segment
+    // per rank
+    uint8 *rcv_ptr = NULL;
+    if(all || m_rank == root)
+    {
+        Schema s_segments;
+        for(int i = 0; i < m_size; i++)
+        {
+            s_segments.append().set(DataType::uint8(rcv_counts[i],
+                                                    rcv_displs[i]));
+        }
+        recv_node.set(s_segments);
+        rcv_ptr = (uint8*)recv_node.data_ptr();
+    }
+
+    if(all)
+    {
+        mpi_error = detail::all_gatherv_bytes(snd_ptr,
+                                              snd_count,
+                                              snd_type,
+                                              rcv_ptr,
+                                              rcv_counts,
+                                              rcv_displs,
+                                              mpi_comm);
+    }
+    else
+    {
+        mpi_error = detail::gatherv_bytes(snd_ptr,
+                                          snd_count,
+                                          snd_type,
+                                          rcv_ptr,
+                                          rcv_counts,
+                                          rcv_displs,
+                                          root,
+                                          mpi_comm);
+    }
 
+    if(msg_type != MPI_DATATYPE_NULL)
+    {
+        MPI_Type_free(&msg_type);
+    }
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
+    if(rcv_ptr != NULL)
+    {
+        // replace each segment with an external view of its data
+        for(int i = 0; i < m_size; i++)
+        {
+            uint8 *seg_ptr = rcv_ptr + rcv_displs[i];
+            Schema s_rank;
+            s_rank.deserialize_binary(seg_ptr, (index_t)rcv_sizes[2*i]);
+            uint8 *data_ptr = seg_ptr +
+                              gatherv_align((index_t)rcv_sizes[2*i]);
+            recv_node.child(i).set_external(s_rank, data_ptr);
+        }
+    }
+
     return mpi_error;
 }
 
 //---------------------------------------------------------------------------//
 int
-all_gather_using_schema(Node &send_node,
-                        Node &recv_node,
-                        MPI_Comm mpi_comm)
+gatherv(const Node &send_node,
+        Node &recv_node,
+        int root,
+        MPI_Comm mpi_comm)
 {
-    Node n_snd_compact;
-    send_node.compact_to(n_snd_compact);
-
-    int m_size = mpi::size(mpi_comm);
+    detail::StatsScope stats_scope("relay::mpi::gatherv");
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    return gatherv_schema_and_data(send_node,
+                                   recv_node,
+                                   root,
+                                   false,
+                                   mpi_comm);
+}
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
-    int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
-    
-    // to do the conduit gatherv, first need a gather to get the 
-    // schema and data buffer sizes
-    
-    int snd_sizes[] = {schema_len, data_len};
+//---------------------------------------------------------------------------//
+int
+all_gatherv(const Node &send_node,
+            Node &recv_node,
+            MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::all_gatherv");
 
-    Node n_rcv_sizes;
+    return gatherv_schema_and_data(send_node,
+                                   recv_node,
+                                   0,
+                                   true,
+                                   mpi_comm);
+}
 
-    Schema s;
-    s["schema_len"].set(DataType::c_int());
-    s["data_len"].set(DataType::c_int());
-    n_rcv_sizes.list_of(s,m_size);
+//---------------------------------------------------------------------------//
+// tags used by the union tree's messages
+static const int UNION_HASH_TAG = 8301;
+static const int UNION_NEED_TAG = 8302;
+static const int UNION_NODE_TAG = 8303;
 
-    int mpi_error = MPI_Allgather( snd_sizes, // local data
-                                   2, // two ints per rank
-                                   MPI_INT, // send ints
-                                   n_rcv_sizes.data_ptr(),  // rcv buffer
-                                   2,  // two ints per rank
-                                   MPI_INT,  // rcv ints
-                                   mpi_comm); // mpi com
+//---------------------------------------------------------------------------//
+int
+union_using_schema(const Node &send_node,
+                   Node &recv_node,
+                   int root,
+                   MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::union_using_schema");
 
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-                                
-    Node n_rcv_tmp;
-    
-    int  *schema_rcv_counts = NULL;
-    int  *schema_rcv_displs = NULL;
-    char *schema_rcv_buff   = NULL;
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
 
-    int  *data_rcv_counts = NULL;
-    int  *data_rcv_displs = NULL;
-    char *data_rcv_buff   = NULL;
+    // binomial tree rooted at root: at each step the ranks (relative to
+    // root) with the step bit set send their union to the rank step below
+    // them and drop out.
+    int vrank = (m_rank - root + m_size) % m_size;
 
+    Node n_union;
+    n_union.set(send_node);
 
-    // alloc data for the mpi gather counts and displ arrays
-    n_rcv_tmp["schemas/counts"].set(DataType::c_int(m_size));
-    n_rcv_tmp["schemas/displs"].set(DataType::c_int(m_size));
+    int mpi_error = MPI_SUCCESS;
+    for(int step = 1; step < m_size; step <<= 1)
+    {
+        if((vrank & step) != 0)
+        {
+            int dest = (vrank - step + root) % m_size;
+            // send the hash first, the tree itself is only needed when it
+            // would change the receiver's union
+            uint64 union_hash = n_union.hash();
+            detail::StatsTimer hash_timer(detail::STATS_SCHEMA, 8);
+            mpi_error = MPI_Send(&union_hash, 1, MPI_UINT64_T,
+                                 dest, UNION_HASH_TAG, mpi_comm);
+            hash_timer.stop();
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    n_rcv_tmp["data/counts"].set(DataType::c_int(m_size));
-    n_rcv_tmp["data/displs"].set(DataType::c_int(m_size));
+            int need = 0;
+            detail::StatsTimer need_timer(detail::STATS_SCHEMA, 0, 4);
+            mpi_error = MPI_Recv(&need, 1, MPI_INT,
+                                 dest, UNION_NEED_TAG, mpi_comm,
+                                 MPI_STATUS_IGNORE);
+            need_timer.stop();
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // get pointers to counts and displs
-    schema_rcv_counts = n_rcv_tmp["schemas/counts"].value();
-    schema_rcv_displs = n_rcv_tmp["schemas/displs"].value();
+            if(need != 0)
+            {
+                mpi_error = send_using_schema(n_union, dest,
+                                              UNION_NODE_TAG, mpi_comm);
+            }
+            break;
+        }
+        else if(vrank + step < m_size)
+        {
+            int src = (vrank + step + root) % m_size;
+            uint64 src_hash = 0;
+            detail::StatsTimer hash_timer(detail::STATS_SCHEMA, 0, 8);
+            mpi_error = MPI_Recv(&src_hash, 1, MPI_UINT64_T,
+                                 src, UNION_HASH_TAG, mpi_comm,
+                                 MPI_STATUS_IGNORE);
+            hash_timer.stop();
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    data_rcv_counts = n_rcv_tmp["data/counts"].value();
-    data_rcv_displs = n_rcv_tmp["data/displs"].value();
+            // an identical tree would not change the union. The ranks are
+            // merged in order, so the result matches updating with every
+            // rank's tree from root up.
+            int need = (src_hash != n_union.hash()) ? 1 : 0;
+            detail::StatsTimer need_timer(detail::STATS_SCHEMA, 4);
+            mpi_error = MPI_Send(&need, 1, MPI_INT,
+                                 src, UNION_NEED_TAG, mpi_comm);
+            need_timer.stop();
+            CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    int schema_curr_displ = 0;
-    int data_curr_displ   = 0;
-    
-    NodeIterator itr = n_rcv_sizes.children();
+            if(need != 0)
+            {
+                // recv_using_schema updates the passed node
+                mpi_error = recv_using_schema(n_union, src,
+                                              UNION_NODE_TAG, mpi_comm);
+            }
+        }
+    }
 
-    index_t child_idx = 0;
-    
-    while(itr.has_next())
+    if(m_rank == root)
     {
-        Node &curr = itr.next();
-
-        int schema_curr_count = curr["schema_len"].value();
-        int data_curr_count   = curr["data_len"].value();
-        
-        schema_rcv_counts[child_idx] = schema_curr_count;
-        schema_rcv_displs[child_idx] = schema_curr_displ;
-        schema_curr_displ   += schema_curr_count;
-        
-        data_rcv_counts[child_idx] = data_curr_count;
-        data_rcv_displs[child_idx] = data_curr_displ;
-        data_curr_displ   += data_curr_count;
-        
-        child_idx+=1;
+        recv_node.reset();
+        recv_node.move(n_union);
     }
-    
-    n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
-    schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
 
-    mpi_error = MPI_Allgatherv( const_cast <char*>(schema_str.c_str()),
-                                schema_len,
-                                MPI_BYTE,
-                                schema_rcv_buff,
-                                schema_rcv_counts,
-                                schema_rcv_displs,
-                                MPI_BYTE,
-                                mpi_comm);
+    return mpi_error;
+}
 
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+//---------------------------------------------------------------------------//
+int
+all_union_using_schema(const Node &send_node,
+                       Node &recv_node,
+                       MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope("relay::mpi::all_union_using_schema");
 
-    // build all schemas from JSON, compact them.
-    Schema rcv_schema;
-    //TODO: should we make it easer to create a compact schema?
-    // TODO: Revisit, I think we can do this better
-    Schema s_tmp;
-    for(int s_idx=0; s_idx < m_size; s_idx++)
+    int mpi_error = union_using_schema(send_node, recv_node, 0, mpi_comm);
+    if(mpi_error == MPI_SUCCESS)
     {
-        Schema &s_new = s_tmp.append();
-        s_new.set(&schema_rcv_buff[schema_rcv_displs[s_idx]]);
+        if(mpi::rank(mpi_comm) != 0)
+        {
+            recv_node.reset();
+        }
+        mpi_error = broadcast_using_schema(recv_node, 0, mpi_comm);
     }
-    
-    // TODO can we support copy out w/out realloc
-    s_tmp.compact_to(rcv_schema);
-
-    // allocate data to hold the gather result
-    recv_node.set(rcv_schema);
-    data_rcv_buff = (char*)recv_node.data_ptr();
-    
-    mpi_error = MPI_Allgatherv( n_snd_compact.data_ptr(),
-                                data_len,
-                                MPI_BYTE,
-                                data_rcv_buff,
-                                data_rcv_counts,
-                                data_rcv_displs,
-                                MPI_BYTE,
-                                mpi_comm);
-
-    CONDUIT_CHECK_MPI_ERROR(mpi_error);
-
     return mpi_error;
 }
 
@@ -1468,6 +5506,28 @@ broadcast(Node &node,
           int root,
           MPI_Comm comm)
 {
+    detail::StatsScope stats_scope("relay::mpi::broadcast");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        bool is_root = mpi::rank(comm) == root;
+        if(is_root)
+        {
+            detail::stage_to_host(node, n_host);
+        }
+        else
+        {
+            detail::host_buffer(node, n_host);
+        }
+        int mpi_error = broadcast(n_host, root, comm);
+        if(!is_root)
+        {
+            node.update(n_host);
+        }
+        return mpi_error;
+    }
+
     int rank = mpi::rank(comm);
 
     Node bcast_buffer;
@@ -1503,19 +5563,17 @@ broadcast(Node &node,
     }
 
 
-    if(!conduit::utils::value_fits<index_t,int>(bcast_data_size))
-    {
-        CONDUIT_INFO("Warning size value (" << bcast_data_size << ")"
-                     " exceeds the size of MPI_Bcast max value "
-                     "(" << std::numeric_limits<int>::max() << ")")
-    }
-
+    detail::ByteCount bcast_count(bcast_data_size);
 
+    detail::StatsTimer timer(detail::STATS_DATA,
+                             (rank == root) ? bcast_data_size : 0,
+                             (rank == root) ? 0 : bcast_data_size);
     int mpi_error = MPI_Bcast(bcast_data_ptr,
-                              static_cast<int>(bcast_data_size),
-                              MPI_BYTE,
+                              bcast_count.count(),
+                              bcast_count.type(),
                               root,
                               comm);
+    timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -1534,28 +5592,47 @@ broadcast_using_schema(Node &node,
                        int root,
                        MPI_Comm comm)
 {
+    detail::StatsScope stats_scope("relay::mpi::broadcast_using_schema");
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        bool is_root = mpi::rank(comm) == root;
+        if(is_root)
+        {
+            detail::stage_to_host(node, n_host);
+        }
+        int mpi_error = broadcast_using_schema(n_host, root, comm);
+        if(!is_root)
+        {
+            detail::stage_from_host(n_host, node);
+        }
+        return mpi_error;
+    }
+
     int rank = mpi::rank(comm);
 
     Node bcast_buffers;
 
-    void *bcast_data_ptr = NULL;
-    int   bcast_data_size = 0;
+    void    *bcast_data_ptr = NULL;
+    index_t  bcast_data_size = 0;
 
     int bcast_schema_size = 0;
     int rcv_bcast_schema_size = 0;
+    std::vector<uint8> schema_bytes;
 
     // setup buffers for send
     if(rank == root)
     {
         
         bcast_data_ptr  = node.contiguous_data_ptr();
-        bcast_data_size = static_cast<int>(node.total_bytes_compact());
+        bcast_data_size = node.total_bytes_compact();
         
         if(bcast_data_ptr != NULL &&
            node.is_compact() && 
            node.is_contiguous())
         {
-            bcast_buffers["schema"] = node.schema().to_json();
+            node.schema().serialize_binary(schema_bytes,true);
         }
         else
         {
@@ -1563,20 +5640,23 @@ broadcast_using_schema(Node &node,
             node.compact_to(bcast_data_compact);
             
             bcast_data_ptr  = bcast_data_compact.data_ptr();
-            bcast_buffers["schema"] =  bcast_data_compact.schema().to_json();
+            bcast_data_compact.schema().serialize_binary(schema_bytes,true);
         }
      
 
         
-        bcast_schema_size = static_cast<int>(bcast_buffers["schema"].dtype().number_of_elements());
+        bcast_buffers["schema"].set(schema_bytes);
+        bcast_schema_size = static_cast<int>(schema_bytes.size());
     }
 
+    detail::StatsTimer size_timer(detail::STATS_SCHEMA, 4, 4);
     int mpi_error = MPI_Allreduce(&bcast_schema_size,
                                   &rcv_bcast_schema_size,
                                   1,
                                   MPI_INT,
                                   MPI_MAX,
                                   comm);
+    size_timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
@@ -1585,15 +5665,19 @@ broadcast_using_schema(Node &node,
     // alloc for rcv for schema
     if(rank != root)
     {
-        bcast_buffers["schema"].set(DataType::char8_str(bcast_schema_size));
+        bcast_buffers["schema"].set(DataType::uint8(bcast_schema_size));
     }
 
     // broadcast the schema 
+    detail::StatsTimer schema_timer(detail::STATS_SCHEMA,
+                                    (rank == root) ? bcast_schema_size : 0,
+                                    (rank == root) ? 0 : bcast_schema_size);
     mpi_error = MPI_Bcast(bcast_buffers["schema"].data_ptr(),
                           bcast_schema_size,
-                          MPI_CHAR,
+                          MPI_BYTE,
                           root,
                           comm);
+    schema_timer.stop();
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
@@ -1602,58 +5686,254 @@ broadcast_using_schema(Node &node,
     // setup buffers for receive 
     if(rank != root)
     {
-        Schema bcast_schema;
-        Generator gen(bcast_buffers["schema"].as_char8_str());
-        gen.walk(bcast_schema);
-        
-        // only check compat for leaves
-        // there are more zero copy cases possible here, but
-        // we need a better way to identify them
-        // compatible won't work for object cases that
-        // have different named leaves
-        if( !(node.dtype().is_empty() ||
-              node.dtype().is_object() ||
-              node.dtype().is_list() ) && 
-            !(bcast_schema.dtype().is_empty() ||
-              bcast_schema.dtype().is_object() ||
-              bcast_schema.dtype().is_list() )
-            && bcast_schema.compatible(node.schema()))
+        Schema bcast_schema;
+        bcast_schema.deserialize_binary(bcast_buffers["schema"].as_uint8_ptr(),
+                                        bcast_schema_size);
+        
+        // only check compat for leaves
+        // there are more zero copy cases possible here, but
+        // we need a better way to identify them
+        // compatible won't work for object cases that
+        // have different named leaves
+        if( !(node.dtype().is_empty() ||
+              node.dtype().is_object() ||
+              node.dtype().is_list() ) && 
+            !(bcast_schema.dtype().is_empty() ||
+              bcast_schema.dtype().is_object() ||
+              bcast_schema.dtype().is_list() )
+            && bcast_schema.compatible(node.schema()))
+        {
+            
+            bcast_data_ptr  = node.contiguous_data_ptr();
+            bcast_data_size = node.total_bytes_compact();
+            
+            if( bcast_data_ptr == NULL ||
+                ! node.is_compact() )
+            {
+                Node &bcast_data_buffer = bcast_buffers["data"];
+                bcast_data_buffer.set_schema(bcast_schema);
+                
+                bcast_data_ptr  = bcast_data_buffer.data_ptr();
+                cpy_out = true;
+            }
+        }
+        else
+        {
+            node.set_schema(bcast_schema);
+
+            bcast_data_ptr  = node.data_ptr();
+            bcast_data_size = node.total_bytes_compact();
+        }
+    }
+    
+    detail::ByteCount bcast_count(bcast_data_size);
+
+    detail::StatsTimer data_timer(detail::STATS_DATA,
+                                  (rank == root) ? bcast_data_size : 0,
+                                  (rank == root) ? 0 : bcast_data_size);
+    mpi_error = MPI_Bcast(bcast_data_ptr,
+                          bcast_count.count(),
+                          bcast_count.type(),
+                          root,
+                          comm);
+    data_timer.stop();
+
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // note: cpy_out will always be false when rank == root
+    if( cpy_out )
+    {
+        node.update(bcast_buffers["data"]);
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+// tag used to hand the gathered bundle to a root that isn't a group leader
+static const int HIERARCHY_BUNDLE_TAG = 8311;
+
+//---------------------------------------------------------------------------//
+int
+hierarchical_gather_using_schema(const Node &send_node,
+                                 Node &recv_node,
+                                 int root,
+                                 MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope(
+        "relay::mpi::hierarchical_gather_using_schema");
+
+    return hierarchical_gather_using_schema(send_node,
+                                            recv_node,
+                                            root,
+                                            0,
+                                            mpi_comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+hierarchical_gather_using_schema(const Node &send_node,
+                                 Node &recv_node,
+                                 int root,
+                                 int group_size,
+                                 MPI_Comm mpi_comm)
+{
+    detail::StatsScope stats_scope(
+        "relay::mpi::hierarchical_gather_using_schema");
+
+    int m_rank = mpi::rank(mpi_comm);
+
+    if(detail::needs_host_staging(recv_node))
+    {
+        Node n_rcv_host;
+        int mpi_error = hierarchical_gather_using_schema(send_node,
+                                                         n_rcv_host,
+                                                         root,
+                                                         group_size,
+                                                         mpi_comm);
+        if(m_rank == root)
+        {
+            detail::stage_from_host(n_rcv_host, recv_node);
+        }
+        return mpi_error;
+    }
+
+    detail::HierarchyComms *h = NULL;
+    int mpi_error = detail::hierarchy_comms(mpi_comm, group_size, h);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    Node n_snd_compact;
+    if(detail::needs_host_staging(send_node))
+    {
+        detail::stage_to_host(send_node, n_snd_compact);
+    }
+    else
+    {
+        send_node.compact_to(n_snd_compact);
+    }
+
+    Node n_bundle;
+    detail::hierarchy_bundle(n_snd_compact, m_rank, n_bundle);
+
+    // gather within each group to its leader
+    Node n_gathered;
+    mpi_error = gatherv(n_bundle, n_gathered, 0, h->group_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    int root_leader     = h->leader_of[root];
+    int root_group_rank = h->group_rank_of[root];
+
+    if(h->leader_comm != MPI_COMM_NULL)
+    {
+        // then across the leaders, to the leader of root's group
+        detail::merge_hierarchy_bundles(n_gathered, n_bundle);
+        mpi_error = gatherv(n_bundle, n_gathered, root_leader, h->leader_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+        if(mpi::rank(h->leader_comm) == root_leader)
+        {
+            detail::merge_hierarchy_bundles(n_gathered, n_bundle);
+            if(root_group_rank != 0)
+            {
+                mpi_error = send_using_schema(n_bundle,
+                                              root_group_rank,
+                                              HIERARCHY_BUNDLE_TAG,
+                                              h->group_comm);
+                CONDUIT_CHECK_MPI_ERROR(mpi_error);
+            }
+        }
+    }
+    else if(m_rank == root)
+    {
+        n_bundle.reset();
+        mpi_error = recv_using_schema(n_bundle,
+                                      0,
+                                      HIERARCHY_BUNDLE_TAG,
+                                      h->group_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    if(m_rank == root)
+    {
+        detail::unpack_hierarchy_bundle(n_bundle,
+                                        mpi::size(mpi_comm),
+                                        recv_node);
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+hierarchical_broadcast_using_schema(Node &node,
+                                    int root,
+                                    MPI_Comm comm)
+{
+    detail::StatsScope stats_scope(
+        "relay::mpi::hierarchical_broadcast_using_schema");
+
+    return hierarchical_broadcast_using_schema(node, root, 0, comm);
+}
+
+//---------------------------------------------------------------------------//
+int
+hierarchical_broadcast_using_schema(Node &node,
+                                    int root,
+                                    int group_size,
+                                    MPI_Comm comm)
+{
+    detail::StatsScope stats_scope(
+        "relay::mpi::hierarchical_broadcast_using_schema");
+
+    int rank = mpi::rank(comm);
+
+    if(detail::needs_host_staging(node))
+    {
+        Node n_host;
+        if(rank == root)
         {
-            
-            bcast_data_ptr  = node.contiguous_data_ptr();
-            bcast_data_size = static_cast<int>(node.total_bytes_compact());
-            
-            if( bcast_data_ptr == NULL ||
-                ! node.is_compact() )
-            {
-                Node &bcast_data_buffer = bcast_buffers["data"];
-                bcast_data_buffer.set_schema(bcast_schema);
-                
-                bcast_data_ptr  = bcast_data_buffer.data_ptr();
-                cpy_out = true;
-            }
+            detail::stage_to_host(node, n_host);
         }
-        else
+        int mpi_error = hierarchical_broadcast_using_schema(n_host,
+                                                            root,
+                                                            group_size,
+                                                            comm);
+        if(rank != root)
         {
-            node.set_schema(bcast_schema);
-
-            bcast_data_ptr  = node.data_ptr();
-            bcast_data_size = static_cast<int>(node.total_bytes_compact());
+            detail::stage_from_host(n_host, node);
         }
+        return mpi_error;
     }
-    
-    mpi_error = MPI_Bcast(bcast_data_ptr,
-                          bcast_data_size,
-                          MPI_BYTE,
-                          root,
-                          comm);
 
+    detail::HierarchyComms *h = NULL;
+    int mpi_error = detail::hierarchy_comms(comm, group_size, h);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // note: cpy_out will always be false when rank == root
-    if( cpy_out )
+    int root_leader = h->leader_of[root];
+    bool in_root_group = h->leader_of[rank] == root_leader;
+
+    // root's group gets the node first (which includes its leader),
+    // then the leaders, then the other groups
+    if(in_root_group)
     {
-        node.update(bcast_buffers["data"]);
+        mpi_error = broadcast_using_schema(node,
+                                           h->group_rank_of[root],
+                                           h->group_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    if(h->leader_comm != MPI_COMM_NULL)
+    {
+        mpi_error = broadcast_using_schema(node,
+                                           root_leader,
+                                           h->leader_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+
+    if(!in_root_group)
+    {
+        mpi_error = broadcast_using_schema(node, 0, h->group_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
     }
 
     return mpi_error;
@@ -1666,7 +5946,8 @@ const int communicate_using_schema::OP_RECV = 2;
 
 //-----------------------------------------------------------------------------
 communicate_using_schema::communicate_using_schema(MPI_Comm c) :
-    comm(c), operations(), logging(false)
+    comm(c), operations(), logging(false), persistent(false), plans(),
+    notices(), requests(), recvs_to_post(), recvs_posted(), log(nullptr)
 {
 }
 
@@ -1674,6 +5955,7 @@ communicate_using_schema::communicate_using_schema(MPI_Comm c) :
 communicate_using_schema::~communicate_using_schema()
 {
     clear();
+    free_plans(false);
 }
 
 //-----------------------------------------------------------------------------
@@ -1686,8 +5968,20 @@ communicate_using_schema::clear()
             delete operations[i].node[0];
         if(operations[i].free[1])
             delete operations[i].node[1];
+        if(operations[i].dtype != MPI_DATATYPE_NULL)
+            MPI_Type_free(&operations[i].dtype);
     }
     operations.clear();
+    requests.clear();
+    notices.clear();
+    recvs_to_post.clear();
+    recvs_posted.clear();
+    if(log != nullptr)
+    {
+        log->close();
+        delete log;
+        log = nullptr;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1697,6 +5991,71 @@ communicate_using_schema::set_logging(bool val)
     logging = val;
 }
 
+//-----------------------------------------------------------------------------
+void
+communicate_using_schema::set_persistent(bool val)
+{
+    persistent = val;
+    if(!persistent)
+    {
+        free_plans(false);
+    }
+}
+
+//-----------------------------------------------------------------------------
+communicate_using_schema::plan *
+communicate_using_schema::find_plan(size_t i)
+{
+    const operation &work = operations[i];
+    for(size_t k = 0; k < plans.size(); k++)
+    {
+        plan *p = plans[k];
+        if(!p->used &&
+           p->op == work.op &&
+           p->rank == work.rank &&
+           p->tag == work.tag &&
+           p->node == work.node[0])
+        {
+            p->used = true;
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void
+communicate_using_schema::reset_plan(plan *p)
+{
+    // the request is inactive between exchanges
+    if(p->request != MPI_REQUEST_NULL)
+        MPI_Request_free(&p->request);
+    if(p->dtype != MPI_DATATYPE_NULL)
+        MPI_Type_free(&p->dtype);
+    p->buffer.reset();
+    p->layout_hash = 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+communicate_using_schema::free_plans(bool unused_only)
+{
+    size_t nkept = 0;
+    for(size_t k = 0; k < plans.size(); k++)
+    {
+        plan *p = plans[k];
+        if(unused_only && p->used)
+        {
+            p->used = false;
+            plans[nkept++] = p;
+            continue;
+        }
+        reset_plan(p);
+        delete p;
+    }
+    plans.resize(nkept);
+}
+
 //-----------------------------------------------------------------------------
 void
 communicate_using_schema::add_isend(const Node &node, int dest, int tag)
@@ -1710,6 +6069,8 @@ communicate_using_schema::add_isend(const Node &node, int dest, int tag)
     work.free[0] = false;
     work.node[1] = nullptr;
     work.free[1] = false;
+    work.dtype = MPI_DATATYPE_NULL;
+    work.pln = nullptr;
     operations.push_back(work);
 }
 
@@ -1726,6 +6087,8 @@ communicate_using_schema::add_irecv(Node &node, int src, int tag)
     work.free[0] = false; // Don't need to free it.
     work.node[1] = nullptr;
     work.free[1] = false;
+    work.dtype = MPI_DATATYPE_NULL;
+    work.pln = nullptr;
     operations.push_back(work);    
 }
 
@@ -1733,21 +6096,39 @@ communicate_using_schema::add_irecv(Node &node, int src, int tag)
 int
 communicate_using_schema::execute()
 {
+    detail::StatsScope stats_scope(
+        "relay::mpi::communicate_using_schema::execute");
+
+    start();
+    std::vector<Node *> received;
+    while(wait_some(received))
+    {
+    }
+    return finish();
+}
+
+//-----------------------------------------------------------------------------
+int
+communicate_using_schema::start()
+{
+    detail::StatsScope stats_scope(
+        "relay::mpi::communicate_using_schema::start");
+
     int mpi_error = 0;
-    std::vector<MPI_Request> requests(operations.size());
-    std::vector<MPI_Status>  statuses(operations.size());
+    requests.assign(operations.size(), MPI_REQUEST_NULL);
+    notices.clear();
+    recvs_to_post.clear();
+    recvs_posted.clear();
 
-    int rank, size;
+    int rank;
     MPI_Comm_rank(comm, &rank);
-    MPI_Comm_size(comm, &size);
-    std::ofstream log;
     double t0 = MPI_Wtime();
     if(logging)
     {
         char fn[128];
         sprintf(fn, "communicate_using_schema.%04d.log", rank);
-        log.open(fn, std::ofstream::out);
-        log << "* Log started on rank " << rank << " at " << t0 << std::endl;
+        log = new std::ofstream(fn, std::ofstream::out);
+        *log << "* Log started on rank " << rank << " at " << t0 << std::endl;
     }
 
     // Issue all the sends (so they are in flight by the time we probe them)
@@ -1755,8 +6136,65 @@ communicate_using_schema::execute()
     {
         if(operations[i].op == OP_SEND)
         {
-            Schema s_data_compact;
             const Node &node = *operations[i].node[0];
+
+            if(persistent)
+            {
+                uint64 schema_hash = detail::schema_hash(node);
+                plan *p = find_plan(i);
+                if(p != nullptr && p->schema_hash == schema_hash)
+                {
+                    operations[i].pln = p;
+                    mpi_error = start_planned_send(i, schema_hash);
+                    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+                    continue;
+                }
+
+                if(p != nullptr)
+                {
+                    // the receiver expects the planned message: send it the
+                    // new schema hash alone, the full message follows
+                    reset_plan(p);
+                    p->header = (int64)schema_hash;
+                    if(logging)
+                    {
+                        *log << "    MPI_Isend(<schema change notice>, "
+                             << operations[i].rank << ", "
+                             << operations[i].tag << ");" << std::endl;
+                    }
+                    MPI_Request notice;
+                    detail::StatsTimer timer(detail::STATS_SCHEMA,
+                                             (index_t)sizeof(int64));
+                    mpi_error = MPI_Isend(&p->header,
+                                          (int)sizeof(int64),
+                                          MPI_BYTE,
+                                          operations[i].rank,
+                                          operations[i].tag,
+                                          comm,
+                                          &notice);
+                    timer.stop();
+                    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+                    notices.push_back(notice);
+                }
+                else
+                {
+                    p = new plan();
+                    p->op      = OP_SEND;
+                    p->rank    = operations[i].rank;
+                    p->tag     = operations[i].tag;
+                    p->node    = operations[i].node[0];
+                    p->dtype   = MPI_DATATYPE_NULL;
+                    p->request = MPI_REQUEST_NULL;
+                    p->used    = true;
+                    plans.push_back(p);
+                }
+                // the next exchange creates the request
+                p->schema_hash = schema_hash;
+                p->layout_hash = 0;
+                operations[i].pln = p;
+            }
+
+            Schema s_data_compact;
             // schema will only be valid if compact and contig
             if( node.is_compact() && node.is_contiguous())
             {
@@ -1767,11 +6205,60 @@ communicate_using_schema::execute()
                 node.schema().compact_to(s_data_compact);
             }
     
-            std::string snd_schema_json = s_data_compact.to_json();
-        
+            std::vector<uint8> snd_schema_bytes;
+            s_data_compact.serialize_binary(snd_schema_bytes,true);
+
+            // the message is the schema header followed by the data, send
+            // it without copying the data if we can describe it
+            Schema s_hdr;
+            s_hdr["schema_len"].set(DataType::int64());
+            s_hdr["schema"].set(DataType::uint8(snd_schema_bytes.size()));
+
+            Schema s_hdr_compact;
+            s_hdr.compact_to(s_hdr_compact);
+
+            operations[i].node[1] = new Node(s_hdr_compact);
+            operations[i].free[1] = true;
+            Node &n_hdr = *operations[i].node[1];
+            n_hdr["schema_len"].set((int64)snd_schema_bytes.size());
+            n_hdr["schema"].set(snd_schema_bytes);
+
+            if(detail::header_and_node_datatype(n_hdr.data_ptr(),
+                                                n_hdr.total_bytes_compact(),
+                                                node,
+                                                operations[i].dtype))
+            {
+                if(logging)
+                {
+                    *log << "    MPI_Isend(MPI_BOTTOM, 1, "
+                         << "<header + data type>, "
+                         << operations[i].rank << ", "
+                         << operations[i].tag << ", "
+                         << "comm, &requests[" << i << "]);" << std::endl;
+                }
+
+                index_t msg_size = n_hdr.total_bytes_compact() +
+                                   node.total_bytes_compact();
+                detail::StatsTimer timer(detail::STATS_DATA, msg_size);
+                mpi_error = MPI_Isend(MPI_BOTTOM,
+                                      1,
+                                      operations[i].dtype,
+                                      operations[i].rank,
+                                      operations[i].tag,
+                                      comm,
+                                      &requests[i]);
+                timer.stop();
+                CONDUIT_CHECK_MPI_ERROR(mpi_error);
+                continue;
+            }
+
+            delete operations[i].node[1];
+            operations[i].node[1] = nullptr;
+            operations[i].free[1] = false;
+
             Schema s_msg;
             s_msg["schema_len"].set(DataType::int64());
-            s_msg["schema"].set(DataType::char8_str(snd_schema_json.size()+1));
+            s_msg["schema"].set(DataType::uint8(snd_schema_bytes.size()));
             s_msg["data"].set(s_data_compact);
     
             // create a compact schema to use
@@ -1782,162 +6269,466 @@ communicate_using_schema::execute()
             operations[i].free[1] = true;
             Node &n_msg = *operations[i].node[1];
             // these sets won't realloc since schemas are compatible
-            n_msg["schema_len"].set((int64)snd_schema_json.length());
-            n_msg["schema"].set(snd_schema_json);
+            n_msg["schema_len"].set((int64)snd_schema_bytes.size());
+            n_msg["schema"].set(snd_schema_bytes);
             n_msg["data"].update(node);
 
             // Send the serialized node data.
             index_t msg_data_size = operations[i].node[1]->total_bytes_compact();
             if(logging)
             {
-                log << "    MPI_Isend("
-                    << const_cast<void*>(operations[i].node[1]->data_ptr()) << ", "
-                    << msg_data_size << ", "
-                    << "MPI_BYTE, "
-                    << operations[i].rank << ", "
-                    << operations[i].tag << ", "
-                    << "comm, &requests[" << i << "]);" << std::endl;
-            }
-            
-            if(!conduit::utils::value_fits<index_t,int>(msg_data_size))
-            {
-                CONDUIT_INFO("Warning size value (" << msg_data_size << ")"
-                             " exceeds the size of MPI_Isend max value "
-                             "(" << std::numeric_limits<int>::max() << ")")
+                *log << "    MPI_Isend("
+                     << const_cast<void*>(operations[i].node[1]->data_ptr()) << ", "
+                     << msg_data_size << ", "
+                     << "MPI_BYTE, "
+                     << operations[i].rank << ", "
+                     << operations[i].tag << ", "
+                     << "comm, &requests[" << i << "]);" << std::endl;
             }
             
+            detail::ByteCount msg_count(msg_data_size);
+
+            detail::StatsTimer timer(detail::STATS_DATA, msg_data_size);
             mpi_error = MPI_Isend(const_cast<void*>(operations[i].node[1]->data_ptr()),
-                                  static_cast<int>(msg_data_size),
-                                  MPI_BYTE,
+                                  msg_count.count(),
+                                  msg_count.type(),
                                   operations[i].rank,
                                   operations[i].tag,
                                   comm,
                                   &requests[i]);
+            timer.stop();
             CONDUIT_CHECK_MPI_ERROR(mpi_error);
         }
+        else
+        {
+            plan *p = persistent ? find_plan(i) : nullptr;
+            if(p != nullptr)
+            {
+                operations[i].pln = p;
+                mpi_error = start_planned_recv(i);
+                CONDUIT_CHECK_MPI_ERROR(mpi_error);
+                recvs_posted.push_back(i);
+                continue;
+            }
+            recvs_to_post.push_back(i);
+        }
     }
-    double t1 = MPI_Wtime();
     if(logging)
     {
-        log << "* Time issuing MPI_Isend calls: " << (t1-t0) << std::endl;
+        *log << "* Time issuing MPI_Isend calls: " << (MPI_Wtime()-t0) << std::endl;
     }
 
-    // Issue all the recvs.
-    for(size_t i = 0; i < operations.size(); i++)
+    return post_arrived_recvs();
+}
+
+//-----------------------------------------------------------------------------
+int
+communicate_using_schema::start_planned_send(size_t i, uint64 schema_hash)
+{
+    int mpi_error = 0;
+    plan *p = operations[i].pln;
+    const Node &node = *operations[i].node[0];
+
+    // (re)create the request when the node's memory changed
+    uint64 layout_hash = detail::leaf_layout_hash(node);
+    if(p->request == MPI_REQUEST_NULL || p->layout_hash != layout_hash)
     {
-        if(operations[i].op == OP_RECV)
+        reset_plan(p);
+        if(!detail::header_and_node_datatype(&p->header,
+                                             (index_t)sizeof(int64),
+                                             node,
+                                             p->dtype))
         {
-            // Probe the message for its buffer size.
-            if(logging)
-            {
-                log << "    MPI_Probe("
-                    << operations[i].rank << ", "
-                    << operations[i].tag << ", "
-                    << "comm, &statuses[" << i << "]);" << std::endl;
-            }
-            mpi_error = MPI_Probe(operations[i].rank, operations[i].tag, comm, &statuses[i]);    
-            CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    
-            int buffer_size = 0;
-            MPI_Get_count(&statuses[i], MPI_BYTE, &buffer_size);
-            if(logging)
+            // send a compact copy
+            node.compact_to(p->buffer);
+            if(!detail::header_and_node_datatype(&p->header,
+                                                 (index_t)sizeof(int64),
+                                                 p->buffer,
+                                                 p->dtype))
             {
-                log << "    MPI_Get_count(&statuses[" << i << "], MPI_BYTE, &buffer_size); -> "
-                    << buffer_size << std::endl;
+                // no data, only the header is sent
+                p->dtype = MPI_DATATYPE_NULL;
             }
+        }
+        p->layout_hash = layout_hash;
 
-            // Allocate a node into which we'll receive the raw data.
-            operations[i].node[1] = new Node(DataType::uint8(buffer_size));
-            operations[i].free[1] = true;
+        if(p->dtype != MPI_DATATYPE_NULL)
+        {
+            mpi_error = MPI_Send_init(MPI_BOTTOM,
+                                      1,
+                                      p->dtype,
+                                      p->rank,
+                                      p->tag,
+                                      comm,
+                                      &p->request);
+        }
+        else
+        {
+            mpi_error = MPI_Send_init(&p->header,
+                                      (int)sizeof(int64),
+                                      MPI_BYTE,
+                                      p->rank,
+                                      p->tag,
+                                      comm,
+                                      &p->request);
+        }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+    else if(!p->buffer.dtype().is_empty())
+    {
+        p->buffer.update(node);
+    }
 
-            if(logging)
+    p->header = (int64)schema_hash;
+
+    if(logging)
+    {
+        *log << "    MPI_Start(<planned send>, "
+             << p->rank << ", "
+             << p->tag << ");" << std::endl;
+    }
+
+    index_t msg_size = (index_t)sizeof(int64);
+    if(p->dtype != MPI_DATATYPE_NULL)
+    {
+        msg_size += node.total_bytes_compact();
+    }
+    detail::StatsTimer timer(detail::STATS_DATA, msg_size);
+    mpi_error = MPI_Start(&p->request);
+    timer.stop();
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    requests[i] = p->request;
+    return mpi_error;
+}
+
+//-----------------------------------------------------------------------------
+int
+communicate_using_schema::start_planned_recv(size_t i)
+{
+    int mpi_error = 0;
+    plan *p = operations[i].pln;
+    Node &node = *operations[i].node[0];
+
+    // (re)create the request when the node's memory changed
+    uint64 layout_hash = detail::leaf_layout_hash(node);
+    if(p->request == MPI_REQUEST_NULL || p->layout_hash != layout_hash)
+    {
+        reset_plan(p);
+        // receive into the node when it has the negotiated schema
+        if(detail::schema_hash(node) != p->schema_hash ||
+           !detail::header_and_node_datatype(&p->header,
+                                             (index_t)sizeof(int64),
+                                             node,
+                                             p->dtype))
+        {
+            p->buffer.set(p->schema);
+            if(!detail::header_and_node_datatype(&p->header,
+                                                 (index_t)sizeof(int64),
+                                                 p->buffer,
+                                                 p->dtype))
             {
-                log << "    MPI_Irecv("
-                    << operations[i].node[1]->data_ptr() << ", "
-                    << buffer_size << ", "
-                    << "MPI_BYTE, "
-                    << operations[i].rank << ", "
-                    << operations[i].tag << ", "
-                    << "comm, &requests[" << i << "]);" << std::endl;
+                p->dtype = MPI_DATATYPE_NULL;
             }
+        }
+        p->layout_hash = layout_hash;
 
-            // Post the actual receive.
-            mpi_error = MPI_Irecv(operations[i].node[1]->data_ptr(),
-                                  buffer_size,
-                                  MPI_BYTE,
-                                  operations[i].rank,
-                                  operations[i].tag,
-                                  comm,
-                                  &requests[i]);
-            CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        if(p->dtype != MPI_DATATYPE_NULL)
+        {
+            mpi_error = MPI_Recv_init(MPI_BOTTOM,
+                                      1,
+                                      p->dtype,
+                                      p->rank,
+                                      p->tag,
+                                      comm,
+                                      &p->request);
+        }
+        else
+        {
+            mpi_error = MPI_Recv_init(&p->header,
+                                      (int)sizeof(int64),
+                                      MPI_BYTE,
+                                      p->rank,
+                                      p->tag,
+                                      comm,
+                                      &p->request);
         }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
     }
-    double t2 = MPI_Wtime();
+
     if(logging)
     {
-        log << "* Time issuing MPI_Irecv calls: " << (t2-t1) << std::endl;
+        *log << "    MPI_Start(<planned recv>, "
+             << p->rank << ", "
+             << p->tag << ");" << std::endl;
     }
 
-    // Wait for the requests to complete.
-    int n = static_cast<int>(operations.size());
-    if(logging)
+    index_t msg_size = (index_t)sizeof(int64);
+    if(p->dtype != MPI_DATATYPE_NULL)
     {
-        log << "    MPI_Waitall(" << n << ", &requests[0], &statuses[0]);" << std::endl;
+        msg_size += p->schema.total_bytes_compact();
     }
-    mpi_error = MPI_Waitall(n, &requests[0], &statuses[0]);
+    detail::StatsTimer timer(detail::STATS_DATA, 0, msg_size);
+    mpi_error = MPI_Start(&p->request);
+    timer.stop();
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
-    double t3 = MPI_Wtime();
-    if(logging)
-    {
-        log << "* Time in MPI_Waitall: " << (t3-t2) << std::endl;
-    }
+    requests[i] = p->request;
+    return mpi_error;
+}
 
-    // Finish building the nodes for which we received data.
-    for(size_t i = 0; i < operations.size(); i++)
+//-----------------------------------------------------------------------------
+int
+communicate_using_schema::post_arrived_recvs()
+{
+    // Post a receive for each message that has arrived, sized by its probe.
+    // The others wait for a later call.
+    int mpi_error = 0;
+    size_t nwaiting = 0;
+    for(size_t k = 0; k < recvs_to_post.size(); k++)
     {
-        if(operations[i].op == OP_RECV)
+        const size_t i = recvs_to_post[k];
+        int arrived = 0;
+        MPI_Status status;
+        mpi_error = MPI_Iprobe(operations[i].rank, operations[i].tag, comm,
+                               &arrived, &status);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        if(!arrived)
         {
-            // Get the buffer of the data we received.
-            uint8 *n_buff_ptr = (uint8*)operations[i].node[1]->data_ptr();
+            recvs_to_post[nwaiting++] = i;
+            continue;
+        }
 
-            Node n_msg;
-            // length of the schema is sent as a 64-bit signed int
-            // NOTE: we aren't using this value  ... 
-            n_msg["schema_len"].set_external((int64*)n_buff_ptr);
-            n_buff_ptr +=8;
-            // wrap the schema string
-            n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
-            // create the schema
-            Schema rcv_schema;
-            Generator gen(n_msg["schema"].as_char8_str());
-            gen.walk(rcv_schema);
+        // elements (not count) gives the size of messages over INT_MAX bytes
+        MPI_Count buffer_size = 0;
+        MPI_Get_elements_x(&status, MPI_BYTE, &buffer_size);
+        if(logging)
+        {
+            *log << "    MPI_Iprobe("
+                 << operations[i].rank << ", "
+                 << operations[i].tag << ") -> "
+                 << buffer_size << std::endl;
+        }
 
-            // advance by the schema length
-            n_buff_ptr += n_msg["schema"].total_bytes_compact();
-    
-            // apply the schema to the data
-            n_msg["data"].set_external(rcv_schema,n_buff_ptr);
-    
-            // copy out to our result node
-            operations[i].node[0]->update(n_msg["data"]);
+        // Allocate a node into which we'll receive the raw data.
+        operations[i].node[1] = new Node(DataType::uint8((index_t)buffer_size));
+        operations[i].free[1] = true;
+
+        if(logging)
+        {
+            *log << "    MPI_Irecv("
+                 << operations[i].node[1]->data_ptr() << ", "
+                 << buffer_size << ", "
+                 << "MPI_BYTE, "
+                 << operations[i].rank << ", "
+                 << operations[i].tag << ", "
+                 << "comm, &requests[" << i << "]);" << std::endl;
+        }
+
+        // Post the actual receive.
+        detail::ByteCount buffer_count((index_t)buffer_size);
+        detail::StatsTimer timer(detail::STATS_DATA, 0, (index_t)buffer_size);
+        mpi_error = MPI_Irecv(operations[i].node[1]->data_ptr(),
+                              buffer_count.count(),
+                              buffer_count.type(),
+                              operations[i].rank,
+                              operations[i].tag,
+                              comm,
+                              &requests[i]);
+        timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        recvs_posted.push_back(i);
+    }
+    recvs_to_post.resize(nwaiting);
+    return mpi_error;
+}
 
+//-----------------------------------------------------------------------------
+bool
+communicate_using_schema::build_recv(size_t i)
+{
+    plan *p = operations[i].pln;
+    if(p != nullptr && operations[i].node[1] == nullptr)
+    {
+        // a planned receive completed, a different schema hash means this
+        // was the sender's schema change notice
+        if((uint64)p->header != p->schema_hash)
+        {
             if(logging)
             {
-                log << "* Built output node " << i << std::endl;
+                *log << "* Schema changed for output node " << i << std::endl;
             }
+            reset_plan(p);
+            recvs_to_post.push_back(i);
+            return false;
+        }
+
+        if(!p->buffer.dtype().is_empty())
+        {
+            operations[i].node[0]->update(p->buffer);
+        }
+
+        if(logging)
+        {
+            *log << "* Received planned output node " << i << std::endl;
+        }
+        return true;
+    }
+
+    // Get the buffer of the data we received.
+    uint8 *n_buff_ptr = (uint8*)operations[i].node[1]->data_ptr();
+
+    Node n_msg;
+    // length of the schema is sent as a 64-bit signed int
+    int64 schema_len = 0;
+    memcpy(&schema_len,n_buff_ptr,sizeof(int64));
+    n_buff_ptr +=8;
+    // create the schema from its binary encoding
+    Schema rcv_schema;
+    rcv_schema.deserialize_binary(n_buff_ptr,(index_t)schema_len);
+
+    // advance by the schema length
+    n_buff_ptr += schema_len;
+
+    // apply the schema to the data
+    n_msg["data"].set_external(rcv_schema,n_buff_ptr);
+
+    // copy out to our result node
+    operations[i].node[0]->update(n_msg["data"]);
+
+    if(persistent)
+    {
+        // later exchanges use a planned receive
+        if(p == nullptr)
+        {
+            p = new plan();
+            p->op      = OP_RECV;
+            p->rank    = operations[i].rank;
+            p->tag     = operations[i].tag;
+            p->node    = operations[i].node[0];
+            p->dtype   = MPI_DATATYPE_NULL;
+            p->request = MPI_REQUEST_NULL;
+            p->used    = true;
+            plans.push_back(p);
+            operations[i].pln = p;
+        }
+        p->schema      = rcv_schema;
+        p->schema_hash = detail::schema_hash(n_msg["data"]);
+        p->layout_hash = 0;
+    }
+
+    // the raw data is no longer needed
+    delete operations[i].node[1];
+    operations[i].node[1] = nullptr;
+    operations[i].free[1] = false;
+
+    if(logging)
+    {
+        *log << "* Built output node " << i << std::endl;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+communicate_using_schema::wait_some(std::vector<Node *> &received)
+{
+    detail::StatsScope stats_scope(
+        "relay::mpi::communicate_using_schema::wait_some");
+
+    received.clear();
+    std::vector<MPI_Request> posted;
+    std::vector<int> completed;
+    while(received.empty() && !(recvs_to_post.empty() && recvs_posted.empty()))
+    {
+        post_arrived_recvs();
+        if(recvs_posted.empty())
+            continue;
+
+        // Block only when every receive has been posted, otherwise keep
+        // probing for the messages that have not arrived.
+        const int nposted = static_cast<int>(recvs_posted.size());
+        posted.resize(nposted);
+        completed.resize(nposted);
+        for(int k = 0; k < nposted; k++)
+            posted[k] = requests[recvs_posted[k]];
+        int ncompleted = 0;
+        int mpi_error = 0;
+        detail::StatsTimer wait_timer(detail::STATS_WAIT);
+        if(recvs_to_post.empty())
+        {
+            mpi_error = MPI_Waitsome(nposted, &posted[0], &ncompleted,
+                                     &completed[0], MPI_STATUSES_IGNORE);
+        }
+        else
+        {
+            mpi_error = MPI_Testsome(nposted, &posted[0], &ncompleted,
+                                     &completed[0], MPI_STATUSES_IGNORE);
+        }
+        wait_timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+        if(ncompleted == MPI_UNDEFINED || ncompleted == 0)
+            continue;
+
+        std::vector<bool> done(nposted, false);
+        for(int c = 0; c < ncompleted; c++)
+        {
+            const size_t i = recvs_posted[completed[c]];
+            requests[i] = MPI_REQUEST_NULL;
+            done[completed[c]] = true;
+            if(build_recv(i))
+                received.push_back(operations[i].node[0]);
+        }
+        size_t nremaining = 0;
+        for(int k = 0; k < nposted; k++)
+        {
+            if(!done[k])
+                recvs_posted[nremaining++] = recvs_posted[k];
         }
+        recvs_posted.resize(nremaining);
+    }
+    return !received.empty();
+}
+
+//-----------------------------------------------------------------------------
+int
+communicate_using_schema::finish()
+{
+    detail::StatsScope stats_scope(
+        "relay::mpi::communicate_using_schema::finish");
+
+    // Complete any receives the caller did not wait for.
+    std::vector<Node *> received;
+    while(wait_some(received))
+    {
+    }
+
+    double t0 = MPI_Wtime();
+    int mpi_error = 0;
+    if(!requests.empty())
+    {
+        detail::StatsTimer wait_timer(detail::STATS_WAIT);
+        mpi_error = MPI_Waitall(static_cast<int>(requests.size()), &requests[0],
+                                MPI_STATUSES_IGNORE);
+        wait_timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+    }
+    if(!notices.empty())
+    {
+        detail::StatsTimer wait_timer(detail::STATS_WAIT);
+        mpi_error = MPI_Waitall(static_cast<int>(notices.size()), &notices[0],
+                                MPI_STATUSES_IGNORE);
+        wait_timer.stop();
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
     }
-    double t4 = MPI_Wtime();
     if(logging)
     {
-        log << "* Time building output nodes " << (t4-t3) << std::endl;
-        log.close();
+        *log << "* Time in MPI_Waitall: " << (MPI_Wtime()-t0) << std::endl;
     }
 
     // Cleanup
     clear();
+    free_plans(true);
 
-    return 0;
+    return mpi_error;
 }
 
 //---------------------------------------------------------------------------//
@@ -17,6 +17,8 @@
 //-----------------------------------------------------------------------------
 #include <mpi.h>
 
+#include <iosfwd>
+
 //-----------------------------------------------------------------------------
 // conduit includes
 //-----------------------------------------------------------------------------
@@ -41,11 +43,35 @@ namespace relay
 namespace mpi
 {
 
+    namespace detail
+    {
+        class NonblockingCollective;
+        class BufferPool;
+
+        /// Byte counts larger than max_count (default INT_MAX) are sent
+        /// as derived datatypes built from chunk_bytes (default 1 GiB)
+        /// blocks, and gathers whose total is larger use point-to-point
+        /// or broadcast fallbacks. Lowering these lets tests exercise
+        /// those paths with small messages. All ranks must use the same
+        /// limits.
+        void CONDUIT_RELAY_API set_large_count_limits(index_t max_count,
+                                                      index_t chunk_bytes);
+        /// restores the default limits
+        void CONDUIT_RELAY_API reset_large_count_limits();
+    }
+
     struct Request
     {
         MPI_Request  m_request;
         Node         m_buffer;
         Node        *m_rcv_ptr;
+        // remaining stages of a nonblocking collective (owned, NULL
+        // for sends and receives)
+        detail::NonblockingCollective *m_collective;
+        // pool that owns the block m_buffer views (NULL if m_buffer
+        // owns its memory)
+        detail::BufferPool            *m_pool;
+        void                          *m_pool_block;
     };
 
 
@@ -56,6 +82,93 @@ namespace mpi
     
     int CONDUIT_RELAY_API rank(MPI_Comm mpi_comm);
 
+//-----------------------------------------------------------------------------
+/// Device memory
+//-----------------------------------------------------------------------------
+
+    /// Leaves allocated with device allocators (see
+    /// conduit::utils::set_device_allocator) are device resident.
+
+    /// If the MPI library is device aware (CUDA or ROCm aware), relay passes
+    /// the addresses of device resident leaves directly to MPI. Otherwise
+    /// nodes with device resident leaves are staged through compact host
+    /// buffers, copied with the allocators' memcpy handlers. This applies
+    /// to all send, receive and collective calls, and to
+    /// communicate_using_schema.
+
+    /// Defaults to OpenMPI's CUDA/ROCm aware support query where available,
+    /// otherwise false.
+    void    CONDUIT_RELAY_API set_device_aware(bool value);
+    bool    CONDUIT_RELAY_API device_aware();
+
+    /// Allocator for host staging buffers (default 0), for example a
+    /// registered pinned memory allocator for faster device copies.
+    void    CONDUIT_RELAY_API set_staging_allocator(index_t allocator_id);
+    index_t CONDUIT_RELAY_API staging_allocator();
+
+//-----------------------------------------------------------------------------
+/// Buffer pools
+//-----------------------------------------------------------------------------
+
+    /// isend, irecv and the single stage nonblocking collectives copy
+    /// through a compact buffer held by the Request when a node can't be
+    /// sent from (or received into) its own memory, for example when it is
+    /// staged from the device. With a buffer pool set on a comm, these
+    /// buffers are blocks of the pool (sizes rounded up to powers of two)
+    /// that return to it on wait or test, so repeated messages of similar
+    /// sizes reuse the same memory.
+    ///
+    /// options:
+    ///   max_bytes:     bytes of idle blocks the pool keeps (default 64 MiB)
+    ///   allocator:     conduit allocator id for the blocks (default: the
+    ///                  staging allocator), for example a pinned one
+    ///   mpi_alloc_mem: "true" allocates the blocks with MPI_Alloc_mem,
+    ///                  which may return memory registered for RDMA
+    ///
+    /// Replaces the comm's existing pool. Pools are freed with their comm.
+    void CONDUIT_RELAY_API set_buffer_pool(MPI_Comm comm,
+                                           const Node &options);
+
+    /// frees the comm's pool (blocks still in use are freed when they
+    /// are returned)
+    void CONDUIT_RELAY_API clear_buffer_pool(MPI_Comm comm);
+
+    /// max_bytes, idle_bytes, in_use_bytes, hits and misses of the comm's
+    /// pool (empty if the comm has no pool)
+    void CONDUIT_RELAY_API buffer_pool_info(MPI_Comm comm,
+                                            Node &info);
+
+//-----------------------------------------------------------------------------
+/// Profiling
+//-----------------------------------------------------------------------------
+
+    /// While enabled (default: false), each relay::mpi call records on the
+    /// calling rank: calls, messages (MPI sends, receives and collectives it
+    /// issued), bytes_sent and bytes_received, and the seconds spent in the
+    /// call (time), in MPI calls that negotiate schemas and sizes
+    /// (schema_time), in MPI calls that move data (data_time) and in waits
+    /// (wait_time). conduit_time is the rest of the call: compaction,
+    /// serialization and copies. A call made inside another relay::mpi
+    /// call (for example a send within send_using_schema) is counted as
+    /// part of the outer call.
+    void CONDUIT_RELAY_API set_stats_enabled(bool value);
+    bool CONDUIT_RELAY_API stats_enabled();
+
+    /// clears the recorded stats
+    void CONDUIT_RELAY_API reset_stats();
+
+    /// stats with a child per operation ("send", "gather_using_schema",
+    /// "communicate_using_schema::execute", ...) and their sum ("total")
+    void CONDUIT_RELAY_API stats(Node &info);
+
+    /// Region callbacks called with the operation's name (for example
+    /// "relay::mpi::send") at the start and end of each call, such as
+    /// Caliper's cali_begin_region and cali_end_region. NULL disables them.
+    typedef void (*annotation_callback)(const char *name);
+
+    void CONDUIT_RELAY_API set_annotation_callbacks(annotation_callback begin,
+                                                    annotation_callback end);
+
 //-----------------------------------------------------------------------------
 /// Helpers for converting between MPI data types  and conduit data types
 //-----------------------------------------------------------------------------
@@ -186,6 +299,54 @@ namespace mpi
                                           Node &recv_node,
                                           MPI_Comm comm);
 
+//-----------------------------------------------------------------------------
+/// MPI Tree Reduce
+//-----------------------------------------------------------------------------
+
+    /// Tree reductions reduce all numeric leaves of send_node (any
+    /// hierarchy, any mix of numeric types) with a single MPI_Reduce or
+    /// MPI_Allreduce: the leaves are packed into one buffer that is reduced
+    /// by a user defined MPI_Op.
+
+    /// All ranks must have the same hierarchy (names, dtypes and number of
+    /// elements), this is not checked.
+
+    /// recv_node gets a compact copy of send_node's hierarchy (it is reused
+    /// when it already has it). Non-numeric leaves (strings) are not
+    /// reduced, they hold the local values.
+
+    /// mpi_op must be MPI_SUM, MPI_MIN, MPI_MAX or MPI_PROD.
+
+    /// leaf_ops picks the op of each leaf: it holds op names ("sum", "min",
+    /// "max" or "prod") at the paths of leaves, or of subtrees for all of
+    /// their leaves. Leaves without an op use "sum".
+    /// For example: leaf_ops["timers"] = "max"; leaf_ops["dt"] = "min";
+    /// A subtree op can't be overridden for one of its leaves: setting
+    /// leaf_ops["timers/io"] after leaf_ops["timers"] turns "timers" into
+    /// an object, which drops its op (its other leaves use "sum").
+
+    int CONDUIT_RELAY_API tree_reduce(const Node &send_node,
+                                      Node &recv_node,
+                                      MPI_Op mpi_op,
+                                      int root,
+                                      MPI_Comm comm);
+
+    int CONDUIT_RELAY_API tree_reduce(const Node &send_node,
+                                      Node &recv_node,
+                                      const Node &leaf_ops,
+                                      int root,
+                                      MPI_Comm comm);
+
+    int CONDUIT_RELAY_API tree_all_reduce(const Node &send_node,
+                                          Node &recv_node,
+                                          MPI_Op mpi_op,
+                                          MPI_Comm comm);
+
+    int CONDUIT_RELAY_API tree_all_reduce(const Node &send_node,
+                                          Node &recv_node,
+                                          const Node &leaf_ops,
+                                          MPI_Comm comm);
+
 
 //-----------------------------------------------------------------------------
 /// Async MPI Send Recv
@@ -231,6 +392,67 @@ namespace mpi
                                         Request requests[],
                                         MPI_Status statuses[]);
 
+    // checks for completion of any request, sets flag to true when done
+    int CONDUIT_RELAY_API test(Request *request,
+                               int *flag,
+                               MPI_Status *status);
+
+//-----------------------------------------------------------------------------
+/// Nonblocking Collectives
+//-----------------------------------------------------------------------------
+
+    /// Nonblocking versions of broadcast, all_reduce, gather and all_gather
+    /// (and their _using_schema variants). They return a Request used with
+    /// wait, wait_all or test. The nodes must stay alive (and the send
+    /// nodes unchanged) until the request is done, as with isend and irecv.
+    /// As with all MPI collectives, every rank must start them in the same
+    /// order.
+
+    /// The _using_schema variants negotiate the schema in several stages.
+    /// The first stage starts right away, the next ones are posted when
+    /// wait, wait_all or test find the previous stage done: call test
+    /// while computing to keep them going. wait_all runs the stages of all
+    /// of its requests together. Waiting on these requests one at a time
+    /// needs the same wait order on all ranks.
+
+    int CONDUIT_RELAY_API ibroadcast(Node &node,
+                                     int root,
+                                     MPI_Comm comm,
+                                     Request *request);
+
+    int CONDUIT_RELAY_API ibroadcast_using_schema(Node &node,
+                                                  int root,
+                                                  MPI_Comm comm,
+                                                  Request *request);
+
+    int CONDUIT_RELAY_API iall_reduce(const Node &send_node,
+                                      Node &recv_node,
+                                      MPI_Op mpi_op,
+                                      MPI_Comm comm,
+                                      Request *request);
+
+    int CONDUIT_RELAY_API igather(Node &send_node,
+                                  Node &recv_node,
+                                  int root,
+                                  MPI_Comm comm,
+                                  Request *request);
+
+    int CONDUIT_RELAY_API iall_gather(Node &send_node,
+                                      Node &recv_node,
+                                      MPI_Comm comm,
+                                      Request *request);
+
+    int CONDUIT_RELAY_API igather_using_schema(Node &send_node,
+                                               Node &recv_node,
+                                               int root,
+                                               MPI_Comm comm,
+                                               Request *request);
+
+    int CONDUIT_RELAY_API iall_gather_using_schema(Node &send_node,
+                                                   Node &recv_node,
+                                                   MPI_Comm comm,
+                                                   Request *request);
+
 
 //-----------------------------------------------------------------------------
 /// MPI gather
@@ -256,6 +478,42 @@ namespace mpi
                                                   Node &recv_node,
                                                   MPI_Comm mpi_comm);
 
+    // Gathers nodes with different schemas in one MPI_Gatherv (or
+    // MPI_Allgatherv) after an exchange of sizes: each rank's binary schema
+    // and data travel together, the data directly from send_node's memory.
+    // recv_node becomes a list with a child per rank. The children are
+    // external views into a single receive buffer that recv_node owns, so
+    // they stay valid until recv_node is reset or changed.
+    int CONDUIT_RELAY_API gatherv(const Node &send_node,
+                                  Node &recv_node,
+                                  int root,
+                                  MPI_Comm mpi_comm);
+
+    int CONDUIT_RELAY_API all_gatherv(const Node &send_node,
+                                      Node &recv_node,
+                                      MPI_Comm mpi_comm);
+
+//-----------------------------------------------------------------------------
+/// MPI union
+//-----------------------------------------------------------------------------
+
+    // Merges the send_node of every rank into recv_node on root, as if root
+    // called recv_node.update() with each rank's tree in rank order
+    // (starting from root). The trees are merged up a binomial tree, so no
+    // rank holds more than its own union and the union of its children.
+    // A rank's union is only sent when its hash differs from the receiver's
+    // union, so ranks with identical trees exchange just the hash.
+    // recv_node is only set on root.
+    int CONDUIT_RELAY_API union_using_schema(const Node &send_node,
+                                             Node &recv_node,
+                                             int root,
+                                             MPI_Comm mpi_comm);
+
+    // union_using_schema followed by broadcast_using_schema of the result
+    int CONDUIT_RELAY_API all_union_using_schema(const Node &send_node,
+                                                 Node &recv_node,
+                                                 MPI_Comm mpi_comm);
+
 //-----------------------------------------------------------------------------
 /// MPI broadcast
 //-----------------------------------------------------------------------------
@@ -268,6 +526,44 @@ namespace mpi
                                                  int root,
                                                  MPI_Comm comm );
 
+//-----------------------------------------------------------------------------
+/// MPI hierarchical gather and broadcast
+//-----------------------------------------------------------------------------
+
+    // Two level versions of gather_using_schema and broadcast_using_schema
+    // for large runs. The ranks are split into groups: by default the ranks
+    // that share a node (MPI_Comm_split_type with MPI_COMM_TYPE_SHARED),
+    // or runs of group_size consecutive ranks. Messages move within each
+    // group and between one leader rank per group, so root only exchanges
+    // messages with the other leaders and with its own group. The group
+    // comms are created by the first call for a comm and group size, and
+    // freed with the comm.
+
+    // recv_node matches gather_using_schema's result. Each distinct schema
+    // is sent once per level, so ranks with identical schemas (e.g. the
+    // same Blueprint metadata) only add their data.
+    int CONDUIT_RELAY_API hierarchical_gather_using_schema(
+                                                  const Node &send_node,
+                                                  Node &recv_node,
+                                                  int root,
+                                                  MPI_Comm mpi_comm);
+
+    int CONDUIT_RELAY_API hierarchical_gather_using_schema(
+                                                  const Node &send_node,
+                                                  Node &recv_node,
+                                                  int root,
+                                                  int group_size,
+                                                  MPI_Comm mpi_comm);
+
+    int CONDUIT_RELAY_API hierarchical_broadcast_using_schema(Node &node,
+                                                              int root,
+                                                              MPI_Comm comm);
+
+    int CONDUIT_RELAY_API hierarchical_broadcast_using_schema(Node &node,
+                                                              int root,
+                                                              int group_size,
+                                                              MPI_Comm comm);
+
 //-----------------------------------------------------------------------------
 /// Communicate multiple nodes at once using schema
 //-----------------------------------------------------------------------------
@@ -291,6 +587,25 @@ public:
      */
     void set_logging(bool val);
 
+    /**
+     @brief Set whether exchanges are persistent, for callers that repeat the
+            same exchange (for example each time step). Both sides of each
+            exchange must use the same setting.
+
+            In persistent mode, each add_isend/add_irecv pair (matched by
+            node, rank and tag across calls) keeps a plan after its first
+            exchange: the negotiated schema and persistent MPI requests
+            (MPI_Send_init/MPI_Recv_init) on the nodes' memory. Later
+            exchanges start these requests, sending only a schema hash ahead
+            of the data. When a sent node's schema changes, the sender
+            tells the receiver and the schema is negotiated again. Plans that
+            are not used by an exchange are dropped at its end.
+     @param val If true, keep plans between exchanges. False drops them.
+     @note Plans hold MPI requests, destroy the object (or call
+           set_persistent(false)) before MPI_Finalize.
+     */
+    void set_persistent(bool val);
+
     /**
      @brief Schedule the node for movement to another rank.
      @param node The node to move to another rank.
@@ -317,8 +632,41 @@ public:
      @return The return value from MPI_Waitall.
      */
     int  execute();
+
+    /**
+     @brief Issue the sends and post the receives whose messages have
+            arrived. Together with wait_some() and finish() this does the
+            work of execute() in steps, so the caller can use each received
+            node while the other messages are still in flight.
+     @return The return value from the last MPI call.
+     */
+    int  start();
+
+    /**
+     @brief Wait until at least one more receive has completed. Receives are
+            posted as their messages arrive, in any order.
+     @param[out] received The nodes passed to add_irecv that were rebuilt by
+                          this call.
+     @return False, with received empty, once all receives have completed.
+     */
+    bool wait_some(std::vector<Node *> &received);
+
+    /**
+     @brief Wait for the sends to complete and clear the operations.
+     @return The return value from MPI_Waitall.
+     */
+    int  finish();
 private:
+    struct plan;
+
     void clear();
+    int  post_arrived_recvs();
+    bool build_recv(size_t i);
+    plan *find_plan(size_t i);
+    int  start_planned_send(size_t i, uint64 schema_hash);
+    int  start_planned_recv(size_t i);
+    void reset_plan(plan *p);
+    void free_plans(bool unused_only);
 
     static const int OP_SEND;
     static const int OP_RECV;
@@ -329,11 +677,49 @@ private:
         int   tag;
         Node *node[2];
         bool  free[2];
+        // send message type (header + data), when not sending a copy
+        MPI_Datatype dtype;
+        // persistent plan used for this exchange (or nullptr)
+        plan *pln;
+    };
+
+    // persistent exchange of one node (see set_persistent)
+    struct plan
+    {
+        int          op;
+        int          rank;
+        int          tag;
+        Node        *node;
+        // hash of the negotiated schema, sent ahead of the data
+        uint64       schema_hash;
+        // leaf layout of node when the request was created
+        uint64       layout_hash;
+        // received schema hash (or the schema hash to send)
+        int64        header;
+        // compact copy of the data when node can't be described
+        Node         buffer;
+        // negotiated schema (receives)
+        Schema       schema;
+        MPI_Datatype dtype;
+        MPI_Request  request;
+        bool         used;
     };
 
     MPI_Comm comm;
     std::vector<operation> operations;
     bool logging;
+    bool persistent;
+    std::vector<plan *> plans;
+    // schema change notices sent by start(), for persistent sends
+    std::vector<MPI_Request> notices;
+
+    // state between start() and finish()
+    std::vector<MPI_Request> requests;
+    // the receives whose messages have not arrived yet
+    std::vector<size_t> recvs_to_post;
+    // the operation index of each posted, incomplete receive
+    std::vector<size_t> recvs_posted;
+    std::ofstream *log;
 };
 
 //-----------------------------------------------------------------------------
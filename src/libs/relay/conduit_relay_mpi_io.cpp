@@ -13,6 +13,7 @@
 //-----------------------------------------------------------------------------
 // standard lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
 #include <iostream>
 
 // Include a helper function for figuring out protocols.
@@ -33,6 +34,8 @@
 
 
 #include "conduit_relay_io_handle.hpp"
+#include "conduit_relay_io_stats.hpp"
+#include "conduit_relay_mpi.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -89,11 +92,14 @@ about(Node &n, MPI_Comm comm)
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
     // straight hdf5 
     io_protos["hdf5"] = "enabled";
+    // all ranks write one hdf5 file
+    io_protos["hdf5_shared"] = "enabled";
     
     hdf5_options(n["io/options/hdf5"]);
 #else
     // straight hdf5 
     io_protos["hdf5"] = "disabled";
+    io_protos["hdf5_shared"] = "disabled";
 #endif
     
     // silo
@@ -123,6 +129,59 @@ about(Node &n, MPI_Comm comm)
 }
 
 
+//---------------------------------------------------------------------------//
+void
+stats(Node &out, MPI_Comm comm)
+{
+    out.reset();
+
+    Node local_stats, all_stats;
+    relay::io::stats(local_stats);
+    mpi::all_gather_using_schema(local_stats, all_stats, comm);
+
+    // every rank combines the gathered stats in the same order
+    NodeConstIterator ranks_itr = all_stats.children();
+    while(ranks_itr.has_next())
+    {
+        NodeConstIterator backends_itr = ranks_itr.next().children();
+        while(backends_itr.has_next())
+        {
+            const Node &backend = backends_itr.next();
+            const std::string backend_name = backends_itr.name();
+            NodeConstIterator ops_itr = backend.children();
+            while(ops_itr.has_next())
+            {
+                const Node &op = ops_itr.next();
+                Node &res = out[backend_name][ops_itr.name()];
+
+                int64   count = op["count"].to_int64();
+                float64 time  = op["time"].to_float64();
+                int64   bytes = op["bytes"].to_int64();
+
+                if(!res.has_child("count"))
+                {
+                    res["count"]     = count;
+                    res["time"]      = time;
+                    res["bytes"]     = bytes;
+                    res["time_min"]  = time;
+                    res["time_sum"]  = time;
+                    res["num_ranks"] = (int64) 1;
+                }
+                else
+                {
+                    res["count"].set(res["count"].as_int64() + count);
+                    res["time"].set(std::max(res["time"].as_float64(), time));
+                    res["bytes"].set(res["bytes"].as_int64() + bytes);
+                    res["time_min"].set(std::min(res["time_min"].as_float64(),
+                                                 time));
+                    res["time_sum"].set(res["time_sum"].as_float64() + time);
+                    res["num_ranks"].set(res["num_ranks"].as_int64() + 1);
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 initialize(MPI_Comm comm)
@@ -227,19 +286,17 @@ save(const Node &node,
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        Node prev_options;
-        if(options.has_child("hdf5"))
-        {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
-        }
-
-        hdf5_save(node,path);
-        
-        if(!prev_options.dtype().is_empty())
-        {
-            hdf5_set_options(prev_options);
-        }
+        // options["hdf5"] applies to this call only
+        hdf5_save(node,path,options);
+#else
+        CONDUIT_ERROR("conduit_relay_mpi_io lacks HDF5 support: " << 
+                      "Failed to save conduit node to path " << path);
+#endif
+    }
+    else if( protocol == "hdf5_shared")
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        hdf5_save_shared(node,path,comm);
 #else
         CONDUIT_ERROR("conduit_relay_mpi_io lacks HDF5 support: " << 
                       "Failed to save conduit node to path " << path);
@@ -332,22 +389,8 @@ save_merged(const Node &node,
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        
-        Node prev_options;
-        if(options.has_child("hdf5"))
-        {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
-        }
-        
-        hdf5_write(node,path);
-        
-        if(!prev_options.dtype().is_empty())
-        {
-            hdf5_set_options(prev_options);
-        }
-        
-        
+        // options["hdf5"] applies to this call only
+        hdf5_write(node,path,options);
 #else
         CONDUIT_ERROR("conduit_relay lacks HDF5 support: " << 
                       "Failed to save conduit node to path " << path);
@@ -507,19 +550,16 @@ load(const std::string &path,
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
         node.reset();
-        Node prev_options;
-        if(options.has_child("hdf5"))
-        {
-            hdf5_options(prev_options);
-            hdf5_set_options(options["hdf5"]);
-        }
-        
         hdf5_read(path,node);
-        
-        if(!prev_options.dtype().is_empty())
-        {
-            hdf5_set_options(prev_options);
-        }
+#else
+        CONDUIT_ERROR("conduit_relay_mpi_io lacks HDF5 support: " << 
+                      "Failed to load conduit node from path " << path);
+#endif
+    }
+    else if( protocol == "hdf5_shared")
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        hdf5_load_shared(path,node,comm);
 #else
         CONDUIT_ERROR("conduit_relay_mpi_io lacks HDF5 support: " << 
                       "Failed to load conduit node from path " << path);
@@ -635,6 +675,16 @@ load(const std::string &path,
 #else
         CONDUIT_ERROR("conduit_relay_mpi_io lacks HDF5 support: " << 
                       "Failed to load conduit node from path " << path);
+#endif
+    }
+    else if( protocol == "hdf5_shared")
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        // the domain selects the rank that wrote the node
+        hdf5_read_shared(path,domain,node);
+#else
+        CONDUIT_ERROR("conduit_relay_mpi_io lacks HDF5 support: " << 
+                      "Failed to load conduit node from path " << path);
 #endif
     }
     else if( protocol == "conduit_silo")
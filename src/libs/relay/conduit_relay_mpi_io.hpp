@@ -52,6 +52,15 @@ namespace io
 std::string CONDUIT_RELAY_API about(MPI_Comm comm);
 void        CONDUIT_RELAY_API about(conduit::Node &res, MPI_Comm comm);
 
+//-----------------------------------------------------------------------------
+/// Combines the relay::io stats (see conduit_relay_io_stats.hpp) of all
+/// ranks. Each <backend>/<operation> holds the sum of count and bytes,
+/// the max of time, and the time_min and time_sum over the ranks that
+/// recorded it, with the number of those ranks in num_ranks.
+/// All ranks receive the same result.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API stats(conduit::Node &out, MPI_Comm comm);
+
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API initialize(MPI_Comm comm);
 
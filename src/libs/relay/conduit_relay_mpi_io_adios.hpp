@@ -111,6 +111,31 @@ void CONDUIT_RELAY_API adios_load(const std::string &path,
                                   Node &node,
                                   MPI_Comm comm);
 
+//-----------------------------------------------------------------------------
+/// Read selected steps, domains and fields of adios data from given path
+/// into the output node, with the file opened once for all of them.
+///
+/// This methods supports a file system and adios path, joined using a ":"
+///  ex: "/path/on/file/system.bp:/path/inside/adios/file"
+///
+/// opts:
+///      steps: [{step}, ...]      (default: the current step)
+///      domains: [{domain}, ...]  (default: the rank's domain)
+///      fields: "{name}" or ["{name}", ...]
+///      topologies: "{name}" or ["{name}", ...]
+///      matsets: "{name}" or ["{name}", ...]
+///          only read the variables under fields/{name} (and likewise
+///          topologies and matsets) of the listed names, like the
+///          read_mesh options of the same names.
+///
+/// Only the block of each listed domain is read. The output holds one
+/// child per step and domain: step_{step:06d}/domain_{domain:06d}.
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API adios_load(const std::string &path,
+                                  const Node &opts,
+                                  Node &node,
+                                  MPI_Comm comm);
+
 //-----------------------------------------------------------------------------
 /// Pass a Node to set adios i/o options.
 //-----------------------------------------------------------------------------
@@ -92,6 +92,19 @@ void CONDUIT_RELAY_API save_mesh(const conduit::Node &mesh,
 ///                 <= 0, use # of files == # of domains
 ///                  > 0, # of files == number_of_files
 ///
+///      static_topology: "none", "hash", "assume" (default ==> "none")
+///            with hdf5 and one file per domain, coordsets and topologies
+///            written by an earlier call (with the same path, to other
+///            files) are stored as external links to them.
+///                 "hash", only link entries whose contents are unchanged
+///                 "assume", link them without checking
+///
+///      number_of_aggregators:  {# of ranks that write files}
+///            when "multi_file" and # of files < # of domains:
+///                 <= 0, use one aggregator rank per file
+///                  > 0, # of aggregators == number_of_aggregators
+///            (at most # of files and # of mpi tasks)
+///
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API save_mesh(const conduit::Node &mesh,
                                  const std::string &path,
@@ -106,6 +119,11 @@ void CONDUIT_RELAY_API save_mesh(const conduit::Node &mesh,
 /// Note: These methods use "write" semantics, they will append to existing
 ///       files. 
 ///
+/// Note: With the "silo" protocol, domains are written as silo mesh
+///       objects and the root file holds a multimesh per topology and a
+///       multivar per field over all domains. Silo data files are always
+///       written as a whole.
+///
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
@@ -139,6 +157,19 @@ void CONDUIT_RELAY_API write_mesh(const conduit::Node &mesh,
 ///                 <= 0, use # of files == # of domains
 ///                  > 0, # of files == number_of_files
 ///
+///      static_topology: "none", "hash", "assume" (default ==> "none")
+///            with hdf5 and one file per domain, coordsets and topologies
+///            written by an earlier call (with the same path, to other
+///            files) are stored as external links to them.
+///                 "hash", only link entries whose contents are unchanged
+///                 "assume", link them without checking
+///
+///      number_of_aggregators:  {# of ranks that write files}
+///            when "multi_file" and # of files < # of domains:
+///                 <= 0, use one aggregator rank per file
+///                  > 0, # of aggregators == number_of_aggregators
+///            (at most # of files and # of mpi tasks)
+///
 ///      truncate: "false", "true" (used if present, default ==> "false")
 ///           when "true" overwrites existing files (relay 'save' semantics)
 ///
@@ -165,6 +196,19 @@ void CONDUIT_RELAY_API read_mesh(const std::string &root_file_path,
 ///      mesh_name: "{name}"
 ///          provide explicit mesh name, for cases where bp data includes
 ///           more than one mesh.
+///
+///      fields: "{name}" or ["{name}", ...]
+///      topologies: "{name}" or ["{name}", ...]
+///      matsets: "{name}" or ["{name}", ...]
+///          only read the listed components. Fields, matsets and other
+///          components on topologies that are not listed are skipped, as
+///          are coordsets no listed topology uses. Names must be in the
+///          mesh index.
+///
+///      domains: [{domain id}, ...]
+///      domain_range: [{begin}, {end}]
+///          only read the listed domains, or the domains in [begin, end),
+///          the selected domains are spread over the mpi tasks
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API read_mesh(const std::string &root_file_path,
                                  const conduit::Node &opts,
@@ -179,10 +223,7 @@ void CONDUIT_RELAY_API load_mesh(const std::string &root_file_path,
 
 //-----------------------------------------------------------------------------
 ///
-/// opts:
-///      mesh_name: "{name}"
-///          provide explicit mesh name, for cases where bp data includes
-///           more than one mesh.
+/// opts: see read_mesh
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API load_mesh(const std::string &root_file_path,
                                  const conduit::Node &opts,
@@ -0,0 +1,87 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_mpi_io_csv.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_RELAY_MPI_IO_CSV_HPP
+#define CONDUIT_RELAY_MPI_IO_CSV_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib include
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_node.hpp"
+#include "conduit_relay_exports.h"
+#include "conduit_relay_config.h"
+
+#include <mpi.h>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+/**
+@brief Collectively writes the blueprint table held by each rank in comm to
+    the given filename, the same files that the serial write_csv writes.
+    Every rank provides a table with the same columns. Each rank's rows are
+    written with collective MPI-IO after the rows of the ranks before it, so
+    the file holds the tables of all ranks concatenated in rank order and no
+    rank gathers the others' data. The header is taken from the first rank
+    with rows.
+
+    The per rank tables written by blueprint::mpi::mesh::flatten with the
+    "gather" option set to 0 give the same file as writing its gathered table.
+*/
+CONDUIT_RELAY_API void write_csv(const Node &table,
+                                 const std::string &path,
+                                 const Node &options,
+                                 MPI_Comm comm);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi::io --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
+
+
+#endif
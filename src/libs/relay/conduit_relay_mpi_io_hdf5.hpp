@@ -15,6 +15,7 @@
 // external lib includes
 //-----------------------------------------------------------------------------
 #include <hdf5.h>
+#include <mpi.h>
 
 //-----------------------------------------------------------------------------
 // conduit lib include 
@@ -49,6 +50,48 @@ namespace io
 
 #include "conduit_relay_io_hdf5_api.hpp"
 
+///
+/// Shared file hdf5 i/o: every rank of comm writes its node into one hdf5
+/// file, instead of one file per rank.
+///
+/// Leaves with the same path on different ranks are stored in a single
+/// dataset (data/<path>) that concatenates the values of all ranks in rank
+/// order, so the number of hdf5 objects does not grow with the number of
+/// ranks. Leaves with the same path must have the same dtype on every rank.
+/// Each rank's offset into the datasets is computed up front from an
+/// exchange of leaf sizes with rank 0, which also lets all ranks create the
+/// file layout collectively. The compact schema of each rank and its leaf
+/// offsets are stored under conduit_shared/.
+///
+/// With a parallel hdf5 library (H5_HAVE_PARALLEL) the file is opened with
+/// the MPI-IO driver, metadata operations are collective and the dataset
+/// writes use H5FD_MPIO_COLLECTIVE transfers. With a serial hdf5 library,
+/// rank 0 creates the layout and the ranks write their values one at a time.
+///
+/// These calls are collective over comm.
+///
+
+/// Save each rank's node into file_path (an existing file is overwritten).
+void CONDUIT_RELAY_API hdf5_save_shared(const Node &node,
+                                        const std::string &file_path,
+                                        MPI_Comm comm);
+
+/// Read the node the calling rank saved with hdf5_save_shared.
+/// The size of comm must match the number of ranks that wrote the file.
+void CONDUIT_RELAY_API hdf5_load_shared(const std::string &file_path,
+                                        Node &node,
+                                        MPI_Comm comm);
+
+/// Read the node a given rank saved with hdf5_save_shared
+/// (not collective, can be used with any number of ranks).
+void CONDUIT_RELAY_API hdf5_read_shared(const std::string &file_path,
+                                        index_t rank,
+                                        Node &node);
+
+/// Returns the number of ranks that wrote a shared hdf5 file
+/// (not collective).
+index_t CONDUIT_RELAY_API hdf5_shared_number_of_ranks(const std::string &file_path);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::mpi::io --
@@ -12,6 +12,11 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <string.h>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -25,6 +30,7 @@
 #include "conduit_relay_config.h"
 #include "conduit_relay.hpp"
 #include "conduit_relay_web.hpp"
+#include "conduit_pack.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -110,6 +116,150 @@ WebRequestHandler::handle_get(WebServer * /*server*/,
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// -- Internal WebSocket Broadcast Queue -
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// a serialized message shared by the queues of all clients
+//-----------------------------------------------------------------------------
+struct WebSocketMessage
+{
+    int          opcode;
+    std::string  data;
+};
+
+//-----------------------------------------------------------------------------
+// bounded queue of broadcast messages for one websocket, written to the
+// connection by its own sender thread (started with the first message)
+//-----------------------------------------------------------------------------
+class WebSocketQueue
+{
+public:
+    typedef std::shared_ptr<const WebSocketMessage> Message;
+
+        //---------------------------------------------------------------------------//
+        WebSocketQueue()
+        : m_connection(NULL),
+          m_stopped(false),
+          m_dropped(0)
+        {
+            // empty
+        }
+
+        //---------------------------------------------------------------------------//
+        ~WebSocketQueue()
+        {
+            stop();
+        }
+
+        //---------------------------------------------------------------------------//
+        // queues a message, dropping the oldest queued messages to keep at
+        // most max_size messages
+        //---------------------------------------------------------------------------//
+        void
+        push(mg_connection *conn,
+             const Message &msg,
+             index_t max_size)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_stopped || conn == NULL)
+            {
+                return;
+            }
+
+            if(!m_thread.joinable())
+            {
+                m_connection = conn;
+                m_thread = std::thread(&WebSocketQueue::send_loop, this);
+            }
+
+            while(!m_messages.empty() &&
+                  (index_t)m_messages.size() >= max_size)
+            {
+                m_messages.pop_front();
+                m_dropped++;
+            }
+            m_messages.push_back(msg);
+            m_cond.notify_one();
+        }
+
+        //---------------------------------------------------------------------------//
+        // drops queued messages and waits for the sender thread to finish
+        // its current write
+        //---------------------------------------------------------------------------//
+        void
+        stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopped = true;
+                m_messages.clear();
+            }
+            m_cond.notify_one();
+
+            if(m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
+
+        //---------------------------------------------------------------------------//
+        index_t
+        dropped() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_dropped;
+        }
+
+  private:
+        //---------------------------------------------------------------------------//
+        void
+        send_loop()
+        {
+            while(true)
+            {
+                Message msg;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    while(!m_stopped && m_messages.empty())
+                    {
+                        m_cond.wait(lock);
+                    }
+
+                    if(m_stopped)
+                    {
+                        return;
+                    }
+
+                    msg = m_messages.front();
+                    m_messages.pop_front();
+                }
+
+                // civetweb locks the connection for the write
+                if(mg_websocket_write(m_connection,
+                                      msg->opcode,
+                                      msg->data.c_str(),
+                                      msg->data.size()) <= 0)
+                {
+                    // the connection failed, stop sending to it
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stopped = true;
+                    m_messages.clear();
+                    return;
+                }
+            }
+        }
+
+        mg_connection               *m_connection;
+        std::deque<Message>          m_messages;
+        bool                         m_stopped;
+        index_t                      m_dropped;
+        mutable std::mutex           m_mutex;
+        std::condition_variable      m_cond;
+        std::thread                  m_thread;
+};
+
 //-----------------------------------------------------------------------------
 // -- Internal Server Interface Classes -
 //-----------------------------------------------------------------------------
@@ -356,6 +506,28 @@ public:
             return res;
         }
 
+        //---------------------------------------------------------------------------//
+        // queues a message for all active websockets
+        //---------------------------------------------------------------------------//
+        void
+        broadcast(const WebSocketQueue::Message &msg,
+                  index_t max_queued)
+        {
+            m_server->lock_context();
+            {
+                for(size_t i=0; i < m_sockets.size(); i++)
+                {
+                    if(m_sockets[i]->is_connected())
+                    {
+                        m_sockets[i]->m_queue->push(m_sockets[i]->m_connection,
+                                                    msg,
+                                                    max_queued);
+                    }
+                }
+            }
+            m_server->unlock_context();
+        }
+
         //---------------------------------------------------------------------------//
         // returns the first active websocket. 
         // waits for a new websocket connection if none are active.
@@ -444,13 +616,277 @@ public:
       std::vector<WebSocket*>     m_sockets;
 };
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::web::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// delta frame layout, see BinaryFrameWriter in conduit_relay_web.hpp
+//-----------------------------------------------------------------------------
+static const char    DELTA_MAGIC[8]     = {'C','N','D','T','D','L','T','A'};
+static const index_t DELTA_HEADER_BYTES = 16;
+static const index_t DELTA_ALIGNMENT    = 8;
+
+//---------------------------------------------------------------------------//
+index_t
+delta_aligned(index_t offset)
+{
+    return ((offset + DELTA_ALIGNMENT - 1) / DELTA_ALIGNMENT) *
+           DELTA_ALIGNMENT;
+}
+
+//---------------------------------------------------------------------------//
+// collects the non empty leaves of node in depth first order
+// (the order conduit_pack stores them in)
+//---------------------------------------------------------------------------//
+template<typename NodeType>
+void
+frame_leaves(NodeType &node,
+             std::vector<NodeType*> &leaves)
+{
+    index_t dt_id = node.dtype().id();
+    if(dt_id == DataType::OBJECT_ID ||
+       dt_id == DataType::LIST_ID)
+    {
+        index_t nchildren = node.number_of_children();
+        for(index_t i=0; i < nchildren; i++)
+        {
+            frame_leaves(node.child(i), leaves);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        leaves.push_back(&node);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// dtype of the compact form of a leaf, starting at offset 0
+//---------------------------------------------------------------------------//
+DataType
+compact_leaf_dtype(const DataType &dt)
+{
+    return DataType(dt.id(),
+                    dt.number_of_elements(),
+                    0,
+                    dt.element_bytes(),
+                    dt.element_bytes(),
+                    dt.endianness());
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::web::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// BinaryFrameWriter Class Implementation
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+BinaryFrameWriter::BinaryFrameWriter()
+: m_schema(),
+  m_leaf_hashes()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+BinaryFrameWriter::~BinaryFrameWriter()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryFrameWriter::reset()
+{
+    m_schema.reset();
+    m_leaf_hashes.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryFrameWriter::update_hashes(const std::vector<const Node*> &leaves,
+                                 std::vector<index_t> *changed)
+{
+    m_leaf_hashes.resize(leaves.size(), 0);
+    for(size_t i=0; i < leaves.size(); i++)
+    {
+        uint64 leaf_hash = leaves[i]->hash();
+        if(changed != NULL && leaf_hash != m_leaf_hashes[i])
+        {
+            changed->push_back((index_t)i);
+        }
+        m_leaf_hashes[i] = leaf_hash;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+BinaryFrameWriter::write(const Node &data,
+                         std::vector<uint8> &frame)
+{
+    frame.resize((size_t)pack::packed_bytes(data));
+    pack::save(data, &frame[0], (index_t)frame.size());
+
+    data.schema().compact_to(m_schema);
+    std::vector<const Node*> leaves;
+    detail::frame_leaves(data, leaves);
+    m_leaf_hashes.clear();
+    update_hashes(leaves, NULL);
+}
+
+//-----------------------------------------------------------------------------
+bool
+BinaryFrameWriter::write_delta(const Node &data,
+                               std::vector<uint8> &frame)
+{
+    Schema s_compact;
+    data.schema().compact_to(s_compact);
+
+    if(m_leaf_hashes.empty() || !s_compact.equals(m_schema))
+    {
+        write(data, frame);
+        return false;
+    }
+
+    std::vector<const Node*> leaves;
+    detail::frame_leaves(data, leaves);
+    std::vector<index_t> changed;
+    update_hashes(leaves, &changed);
+
+    index_t data_offset = detail::DELTA_HEADER_BYTES +
+                          (index_t)(changed.size() * sizeof(uint64));
+    index_t frame_size  = data_offset;
+    for(size_t i=0; i < changed.size(); i++)
+    {
+        const Node &leaf = *leaves[(size_t)changed[i]];
+        frame_size = detail::delta_aligned(frame_size) +
+                     leaf.dtype().bytes_compact();
+    }
+
+    // zero the padding between leaves
+    frame.assign((size_t)frame_size, 0);
+    uint8 *dest = &frame[0];
+
+    uint64 num_changed = (uint64)changed.size();
+    memcpy(dest, detail::DELTA_MAGIC, sizeof(detail::DELTA_MAGIC));
+    memcpy(dest + 8, &num_changed, sizeof(uint64));
+
+    index_t leaf_offset = data_offset;
+    Node n_compact;
+    for(size_t i=0; i < changed.size(); i++)
+    {
+        uint64 leaf_idx = (uint64)changed[i];
+        memcpy(dest + detail::DELTA_HEADER_BYTES + i * sizeof(uint64),
+               &leaf_idx,
+               sizeof(uint64));
+
+        const Node &leaf = *leaves[(size_t)leaf_idx];
+        index_t nbytes = leaf.dtype().bytes_compact();
+        const void *leaf_ptr = NULL;
+        if(leaf.dtype().is_compact())
+        {
+            leaf_ptr = leaf.element_ptr(0);
+        }
+        else
+        {
+            leaf.compact_to(n_compact);
+            leaf_ptr = n_compact.data_ptr();
+        }
+
+        leaf_offset = detail::delta_aligned(leaf_offset);
+        memcpy(dest + leaf_offset, leaf_ptr, (size_t)nbytes);
+        leaf_offset += nbytes;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+is_delta_frame(const uint8 *frame,
+               index_t frame_size)
+{
+    return frame_size >= detail::DELTA_HEADER_BYTES &&
+           memcmp(frame,
+                  detail::DELTA_MAGIC,
+                  sizeof(detail::DELTA_MAGIC)) == 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+read_binary_frame(const uint8 *frame,
+                  index_t frame_size,
+                  Node &node)
+{
+    if(!is_delta_frame(frame, frame_size))
+    {
+        Schema schema;
+        pack::load_schema(frame, frame_size, schema);
+        Node n_frame;
+        n_frame.set_external(schema, const_cast<uint8*>(frame));
+        node.set(n_frame);
+        return;
+    }
+
+    uint64 num_changed = 0;
+    memcpy(&num_changed, frame + 8, sizeof(uint64));
+
+    index_t leaf_offset = detail::DELTA_HEADER_BYTES +
+                          (index_t)(num_changed * sizeof(uint64));
+    if(leaf_offset > frame_size)
+    {
+        CONDUIT_ERROR("<relay::web::read_binary_frame> delta frame of "
+                      << frame_size << " bytes is too small for "
+                      << num_changed << " changed leaves");
+    }
+
+    std::vector<Node*> leaves;
+    detail::frame_leaves(node, leaves);
+
+    Node n_leaf;
+    for(uint64 i=0; i < num_changed; i++)
+    {
+        uint64 leaf_idx = 0;
+        memcpy(&leaf_idx,
+               frame + detail::DELTA_HEADER_BYTES + i * sizeof(uint64),
+               sizeof(uint64));
+        if(leaf_idx >= (uint64)leaves.size())
+        {
+            CONDUIT_ERROR("<relay::web::read_binary_frame> delta frame "
+                          "leaf index " << leaf_idx << " is out of range,"
+                          " node has " << leaves.size() << " leaves");
+        }
+
+        Node &leaf = *leaves[(size_t)leaf_idx];
+        DataType dt = detail::compact_leaf_dtype(leaf.dtype());
+        leaf_offset = detail::delta_aligned(leaf_offset);
+        if(leaf_offset + dt.bytes_compact() > frame_size)
+        {
+            CONDUIT_ERROR("<relay::web::read_binary_frame> delta frame of "
+                          << frame_size << " bytes is too small for leaf "
+                          << leaf_idx);
+        }
+
+        n_leaf.set_external(dt, const_cast<uint8*>(frame + leaf_offset));
+        leaf.update_compatible(n_leaf);
+        leaf_offset += dt.bytes_compact();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // WebSocket Class Implementation
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 WebSocket::WebSocket()
-: m_connection(NULL)
+: m_connection(NULL),
+  m_frame_writer(),
+  m_queue(new WebSocketQueue())
 {
     // empty
 }
@@ -459,7 +895,7 @@ WebSocket::WebSocket()
 //-----------------------------------------------------------------------------
 WebSocket::~WebSocket()
 {
-    // empty
+    delete m_queue;
 }
 
 
@@ -467,7 +903,14 @@ WebSocket::~WebSocket()
 void
 WebSocket::set_connection(mg_connection *connection)
 {
+    if(connection == NULL)
+    {
+        // the connection is closing, stop broadcasting to it
+        m_queue->stop();
+    }
     m_connection = connection;
+    // deltas are relative to the frames this connection received
+    m_frame_writer.reset();
 }
 
 //-----------------------------------------------------------------------------
@@ -477,6 +920,13 @@ WebSocket::is_connected() const
     return m_connection != NULL;
 }
 
+//-----------------------------------------------------------------------------
+index_t
+WebSocket::dropped_messages() const
+{
+    return m_queue->dropped();
+}
+
 //-----------------------------------------------------------------------------
 mg_context *
 WebSocket::context()
@@ -541,6 +991,50 @@ WebSocket::send(const Node &data,
     unlock_context();
 }
 
+//-----------------------------------------------------------------------------
+void
+WebSocket::send_binary(const Node &data)
+{
+    if(m_connection == NULL)
+    {
+        CONDUIT_WARN("attempt to write to bad websocket connection");
+        return;
+    }
+
+    std::vector<uint8> frame;
+    m_frame_writer.write(data, frame);
+    send_frame(frame);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::send_delta(const Node &data)
+{
+    if(m_connection == NULL)
+    {
+        CONDUIT_WARN("attempt to write to bad websocket connection");
+        return;
+    }
+
+    std::vector<uint8> frame;
+    m_frame_writer.write_delta(data, frame);
+    send_frame(frame);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::send_frame(const std::vector<uint8> &frame)
+{
+    lock_context();
+    {
+        mg_websocket_write(m_connection,
+                           WEBSOCKET_OPCODE_BINARY,
+                           (const char*)&frame[0],
+                           frame.size());
+    }
+    unlock_context();
+}
+
 
 //-----------------------------------------------------------------------------
 // WebServer Class Implementation
@@ -559,6 +1053,7 @@ WebServer::WebServer()
   m_entangle_gateway(""),
   m_using_entangle(false),
   m_running(false),
+  m_websocket_queue_size(4),
   m_server(NULL),
   m_dispatch(NULL)
 {
@@ -801,6 +1296,60 @@ WebServer::websocket(index_t ms_poll,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+WebServer::broadcast(const Node &data,
+                     const std::string &protocol)
+{
+    if(m_dispatch == NULL)
+    {
+        return;
+    }
+
+    std::ostringstream oss;
+    data.to_json_stream(oss,protocol);
+
+    std::shared_ptr<WebSocketMessage> msg(new WebSocketMessage());
+    msg->opcode = WEBSOCKET_OPCODE_TEXT;
+    msg->data   = oss.str();
+    m_dispatch->broadcast(msg, m_websocket_queue_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebServer::broadcast_binary(const Node &data)
+{
+    if(m_dispatch == NULL)
+    {
+        return;
+    }
+
+    std::shared_ptr<WebSocketMessage> msg(new WebSocketMessage());
+    msg->opcode = WEBSOCKET_OPCODE_BINARY;
+    msg->data.resize((size_t)pack::packed_bytes(data));
+    pack::save(data, &msg->data[0], (index_t)msg->data.size());
+    m_dispatch->broadcast(msg, m_websocket_queue_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+WebServer::set_websocket_queue_size(index_t size)
+{
+    if(size < 1)
+    {
+        CONDUIT_ERROR("WebSocket queue size must be at least 1, "
+                      "got: " << size);
+    }
+    m_websocket_queue_size = size;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+WebServer::websocket_queue_size() const
+{
+    return m_websocket_queue_size;
+}
+
 //-----------------------------------------------------------------------------
 void
 WebServer::lock_context()
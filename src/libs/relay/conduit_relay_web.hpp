@@ -80,8 +80,9 @@ public:
 
 // forward declare websocket interface class
 class WebSocket;
-// forward declare internal handler class
+// forward declare internal handler and websocket queue classes
 class CivetDispatchHandler;
+class WebSocketQueue;
 
 class CONDUIT_RELAY_API WebServer
 {
@@ -155,6 +156,23 @@ public:
     WebSocket  *websocket(index_t ms_poll = 100,
                           index_t ms_timeout = 60000);
 
+    /// sends data to all connected websockets without blocking the caller.
+    /// The message is serialized once and queued for each client, and a
+    /// sender thread per client writes it. When a client's queue is full,
+    /// its oldest queued message is dropped (newer messages supersede it),
+    /// so slow clients skip messages instead of stalling the caller.
+    void        broadcast(const Node &data,
+                          const std::string &protocol="json");
+
+    /// broadcast variant that sends full binary frames
+    /// (see BinaryFrameWriter)
+    void        broadcast_binary(const Node &data);
+
+    /// max number of broadcast messages queued per client
+    ///   default: 4
+    void        set_websocket_queue_size(index_t size);
+    index_t     websocket_queue_size() const;
+
     /// returns the request handler used by this server instance
     WebRequestHandler *handler();
     
@@ -180,12 +198,74 @@ private:
     bool                    m_using_entangle;
 
     bool                    m_running;
+    index_t                 m_websocket_queue_size;
 
     CivetServer            *m_server;
     CivetDispatchHandler   *m_dispatch;
 
 };
 
+//-----------------------------------------------------------------------------
+/// -- Binary WebSocket Frames -
+//-----------------------------------------------------------------------------
+//
+/// A full binary frame holds the conduit_pack data of a node (see
+/// conduit_pack.hpp): a binary schema followed by the leaf data.
+///
+/// A delta frame holds only the leaves that changed since the previous
+/// frame, which must have had the same schema:
+///
+///   [ 0, 8) magic string "CNDTDLTA"
+///   [ 8,16) uint64 number of changed leaves (n)
+///   [16,16+8n) uint64 index of each changed leaf, counting the non empty
+///              leaves of the schema in depth first order
+///   followed by the compact data of each changed leaf, each starting at
+///   a multiple of 8 bytes
+///
+/// Frames use the writer's endianness. The node viewer's
+/// resources/conduit_frames.js decodes both kinds of frames.
+//
+class CONDUIT_RELAY_API BinaryFrameWriter
+{
+public:
+                   BinaryFrameWriter();
+                  ~BinaryFrameWriter();
+
+    /// writes a full frame
+    void           write(const Node &data,
+                         std::vector<uint8> &frame);
+
+    /// writes a delta frame against the previous frame, or a full frame
+    /// when there is no previous frame or the schema changed.
+    /// returns true if a delta frame was written
+    bool           write_delta(const Node &data,
+                               std::vector<uint8> &frame);
+
+    /// forgets the previous frame, the next write_delta writes a full frame
+    void           reset();
+
+private:
+    void           update_hashes(const std::vector<const Node*> &leaves,
+                                 std::vector<index_t> *changed);
+
+    Schema               m_schema;
+    std::vector<uint64>  m_leaf_hashes;
+};
+
+//-----------------------------------------------------------------------------
+/// returns true if the frame holds a delta
+//-----------------------------------------------------------------------------
+bool CONDUIT_RELAY_API is_delta_frame(const uint8 *frame,
+                                      index_t frame_size);
+
+//-----------------------------------------------------------------------------
+/// sets node from a full frame, or updates the changed leaves of node
+/// (which holds the result of the previous frames) from a delta frame
+//-----------------------------------------------------------------------------
+void CONDUIT_RELAY_API read_binary_frame(const uint8 *frame,
+                                         index_t frame_size,
+                                         Node &node);
+
 //-----------------------------------------------------------------------------
 /// -- WebSocket Connection Interface -
 //-----------------------------------------------------------------------------
@@ -201,10 +281,21 @@ public:
     void           send(const Node &data,
                         const std::string &protocol="json");
 
+    /// sends data as a full binary frame
+    void           send_binary(const Node &data);
+
+    /// sends the leaves of data that changed since the last binary frame
+    /// sent on this websocket (a full frame if the schema changed)
+    void           send_delta(const Node &data);
+
     // todo: receive? 
 
     bool           is_connected() const;
 
+    /// number of broadcast messages dropped because this client
+    /// did not keep up
+    index_t        dropped_messages() const;
+
     mg_context    *context();
     void           lock_context();
     void           unlock_context();
@@ -214,8 +305,11 @@ private:
     virtual       ~WebSocket();
 
     void           set_connection(mg_connection *connection);
+    void           send_frame(const std::vector<uint8> &frame);
 
-    mg_connection  *m_connection;
+    mg_connection      *m_connection;
+    BinaryFrameWriter   m_frame_writer;
+    WebSocketQueue     *m_queue;
 };
 
 
@@ -31,6 +31,9 @@ usage()
               << std::endl
               << "  --protocol {relay protocol string used to read data file}"
               << std::endl
+              << "  --lazy {read data on demand with an io handle instead of"
+              << " loading the whole file}"
+              << std::endl
               << "  --doc-root {path to http document root}"
               << std::endl
               << "  --htpasswd {htpasswd file for client authentication}"
@@ -51,6 +54,7 @@ parse_args(int argc,
            std::string &address,
            int &port,
            bool &entangle,
+           bool &lazy,
            std::string &doc_root,
            std::string &data_file,
            std::string &protocol,
@@ -136,6 +140,10 @@ parse_args(int argc,
         {
             entangle = true;
         }
+        else if(arg_str == "--lazy")
+        {
+            lazy = true;
+        }
         else if(data_file == "")
         {
             data_file = arg_str;
@@ -159,6 +167,7 @@ main(int argc, char* argv[])
         
         int port = 9000;
         bool entangle = false;
+        bool lazy = false;
         std::string doc_root("");
         std::string data_file("");
         std::string address("127.0.0.1");
@@ -172,6 +181,7 @@ main(int argc, char* argv[])
                    address,
                    port,
                    entangle,
+                   lazy,
                    doc_root,
                    data_file,
                    protocol,
@@ -184,22 +194,42 @@ main(int argc, char* argv[])
             CONDUIT_ERROR("no data file passed");
         }
 
-        // load data from the file
         Node data;
-        if(protocol.empty())
+        relay::io::IOHandle handle;
+
+        // setup our node viewer web server
+        web::NodeViewerServer svr;
+
+        if(lazy)
         {
-            relay::io::load(data_file,data);
+            // open the file, data is read as the client requests it
+            Node open_opts;
+            open_opts["mode"] = "r";
+            if(protocol.empty())
+            {
+                handle.open(data_file,open_opts);
+            }
+            else
+            {
+                handle.open(data_file,protocol,open_opts);
+            }
+            svr.set_io_handle(&handle);
         }
         else
         {
-            relay::io::load(data_file,protocol,data);
-        }
+            // load data from the file
+            if(protocol.empty())
+            {
+                relay::io::load(data_file,data);
+            }
+            else
+            {
+                relay::io::load(data_file,protocol,data);
+            }
 
-        // setup our node viewer web server
-        web::NodeViewerServer svr;
-        
-        // provide our data
-        svr.set_node(&data);
+            // provide our data
+            svr.set_node(&data);
+        }
         
         // set the address
         svr.set_bind_address(address);
@@ -12,6 +12,8 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <string.h>
+#include <sstream>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -44,13 +46,196 @@ namespace relay
 namespace web
 {
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::web::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// number of leaf values sent by get-leaf when no count is given
+static const index_t VIEWER_DEFAULT_LEAF_COUNT = 1000;
+
+//---------------------------------------------------------------------------//
+// returns the request's POST data followed by its query string
+//---------------------------------------------------------------------------//
+std::string
+viewer_request_vars(struct mg_connection *conn)
+{
+    std::string res;
+    char buff[2048];
+    int len = 0;
+    while( (len = mg_read(conn, buff, sizeof(buff))) > 0 )
+    {
+        res.append(buff,len);
+    }
+
+    const struct mg_request_info *req_info = mg_get_request_info(conn);
+    if(req_info->query_string != NULL)
+    {
+        if(!res.empty())
+        {
+            res += "&";
+        }
+        res += req_info->query_string;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+// returns the (url decoded) value of a request var, or the default value
+// if the request does not have it
+//---------------------------------------------------------------------------//
+std::string
+viewer_request_var(const std::string &vars,
+                   const std::string &name,
+                   const std::string &default_value = std::string())
+{
+    std::vector<char> buff(vars.size() + 1);
+    int len = mg_get_var(vars.c_str(),
+                         vars.size(),
+                         name.c_str(),
+                         &buff[0],
+                         buff.size());
+    if(len < 0)
+    {
+        return default_value;
+    }
+    return std::string(&buff[0],len);
+}
+
+//---------------------------------------------------------------------------//
+index_t
+viewer_request_index_var(const std::string &vars,
+                         const std::string &name,
+                         index_t default_value)
+{
+    std::string value = viewer_request_var(vars,name);
+    if(value.empty())
+    {
+        return default_value;
+    }
+
+    std::istringstream iss(value);
+    index_t res = 0;
+    if(!(iss >> res) || res < 0)
+    {
+        CONDUIT_ERROR("invalid value for request var \"" << name << "\": "
+                      << value);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+viewer_send(struct mg_connection *conn,
+            const std::string &content_type,
+            const void *data,
+            size_t data_size,
+            const std::string &extra_headers = std::string())
+{
+    mg_printf(conn,
+              "HTTP/1.1 200 OK\r\n"
+              "Content-Type: %s\r\n"
+              "Content-Length: %lu\r\n"
+              "%s\r\n",
+              content_type.c_str(),
+              (unsigned long) data_size,
+              extra_headers.c_str());
+    mg_write(conn, data, data_size);
+}
+
+//---------------------------------------------------------------------------//
+void
+viewer_send_json(struct mg_connection *conn,
+                 const std::string &json)
+{
+    viewer_send(conn, "application/json", json.c_str(), json.size());
+}
+
+//---------------------------------------------------------------------------//
+void
+viewer_send_bad_request(struct mg_connection *conn,
+                        const std::string &msg)
+{
+    mg_printf(conn,
+              "HTTP/1.1 400 Bad Request\r\n"
+              "Content-Type: text/plain\r\n"
+              "Content-Length: %lu\r\n\r\n",
+              (unsigned long) msg.size());
+    mg_write(conn, msg.c_str(), msg.size());
+}
+
+//---------------------------------------------------------------------------//
+// sets res to the structure of the tree at path behind the handle,
+// without reading leaves (they are described as empty)
+//---------------------------------------------------------------------------//
+void
+viewer_handle_structure(io::IOHandle &handle,
+                        const std::string &path,
+                        Node &res)
+{
+    std::vector<std::string> names;
+    if(path.empty())
+    {
+        handle.list_child_names(names);
+    }
+    else
+    {
+        handle.list_child_names(path,names);
+    }
+
+    res.reset();
+    for(size_t i=0; i < names.size(); i++)
+    {
+        std::string child_path = path.empty() ? names[i] :
+                                                path + "/" + names[i];
+        viewer_handle_structure(handle,
+                                child_path,
+                                res.add_child(names[i]));
+    }
+}
+
+//---------------------------------------------------------------------------//
+// sets res to a compact copy of count values of leaf, starting at offset
+//---------------------------------------------------------------------------//
+void
+viewer_leaf_slice(const Node &leaf,
+                  index_t offset,
+                  index_t count,
+                  Node &res)
+{
+    DataType dt(leaf.dtype());
+    index_t num_eles = dt.number_of_elements();
+    if(offset > num_eles)
+    {
+        offset = num_eles;
+    }
+    if(count > num_eles - offset)
+    {
+        count = num_eles - offset;
+    }
+
+    dt.set_offset(dt.offset() + offset * dt.stride());
+    dt.set_number_of_elements(count);
+
+    Node view;
+    view.set_external(dt,const_cast<void*>(leaf.data_ptr()));
+    view.compact_to(res);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::web::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // -- Viewer Request Handler  -
 //-----------------------------------------------------------------------------
 
 NodeViewerRequestHandler::NodeViewerRequestHandler()
 : WebRequestHandler(),
-  m_node(NULL)
+  m_node(NULL),
+  m_handle(NULL)
 {
     // empty
 }
@@ -99,6 +284,14 @@ NodeViewerRequestHandler::handle_request(WebServer *server,
     {
         return handle_get_value(conn);
     }
+    else if(uri_cmd == "get-subtree")
+    {
+        return handle_get_subtree(conn);
+    }
+    else if(uri_cmd == "get-leaf")
+    {
+        return handle_get_leaf(conn);
+    }
     else if(uri_cmd == "get-base64-json")
     {
         return handle_get_base64_json(conn);
@@ -123,17 +316,34 @@ NodeViewerRequestHandler::handle_request(WebServer *server,
 bool
 NodeViewerRequestHandler::handle_get_schema(struct mg_connection *conn)
 {
-    if(m_node != NULL)
-    {
-        mg_printf(conn,
-                  "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "%s",m_node->schema().to_json(true).c_str());
-    }
-    else
+    if(m_node == NULL && m_handle == NULL)
     {
         CONDUIT_WARN("rest request for schema of NULL Node");
         return false;
     }
+
+    std::string vars = detail::viewer_request_vars(conn);
+    std::string cpath = detail::viewer_request_var(vars,"cpath");
+
+    try
+    {
+        if(m_node != NULL)
+        {
+            const Node &n = cpath.empty() ? *m_node :
+                                            m_node->fetch_existing(cpath);
+            detail::viewer_send_json(conn,n.schema().to_json(true));
+        }
+        else
+        {
+            Node n;
+            detail::viewer_handle_structure(*m_handle,cpath,n);
+            detail::viewer_send_json(conn,n.schema().to_json(true));
+        }
+    }
+    catch(const conduit::Error &e)
+    {
+        detail::viewer_send_bad_request(conn,e.message());
+    }
     return true;
 }
 
@@ -143,22 +353,25 @@ NodeViewerRequestHandler::handle_get_schema(struct mg_connection *conn)
 bool
 NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn)
 {
-    if(m_node != NULL)
+    if(m_node != NULL || m_handle != NULL)
     {
-        // TODO size checks?
-        char post_data[2048];
-        char cpath[2048];
-
-        int post_data_len = mg_read(conn, post_data, sizeof(post_data));
-        
+        std::string vars = detail::viewer_request_vars(conn);
         // TODO: path instead of cpath?
-        
-        mg_get_var(post_data, post_data_len, "cpath", cpath, sizeof(cpath));
+        std::string cpath = detail::viewer_request_var(vars,"cpath");
+
+        Node value;
+        if(m_node != NULL)
+        {
+            value.set_external(m_node->fetch(cpath));
+        }
+        else if(m_handle->has_path(cpath))
+        {
+            m_handle->read(cpath,value);
+        }
+
         // TODO: value instead of datavalue
-        mg_printf(conn,
-                  "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "{ \"datavalue\": %s }",
-                  m_node->fetch(cpath).to_json().c_str());
+        detail::viewer_send_json(conn,
+                                 "{ \"datavalue\": " + value.to_json() + " }");
     }
     else
     {
@@ -168,6 +381,175 @@ NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn)
     return true;
 }
 
+//---------------------------------------------------------------------------//
+// Handles a request from the client for the data of a subtree.
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::handle_get_subtree(struct mg_connection *conn)
+{
+    if(m_node == NULL && m_handle == NULL)
+    {
+        CONDUIT_WARN("rest request for subtree of NULL Node");
+        return false;
+    }
+
+    std::string vars = detail::viewer_request_vars(conn);
+    std::string cpath = detail::viewer_request_var(vars,"cpath");
+    std::string protocol = detail::viewer_request_var(vars,
+                                                      "protocol",
+                                                      "conduit_base64_json");
+
+    try
+    {
+        std::ostringstream oss;
+        if(m_node != NULL)
+        {
+            const Node &n = cpath.empty() ? *m_node :
+                                            m_node->fetch_existing(cpath);
+            n.to_json_stream(oss,protocol);
+        }
+        else
+        {
+            Node n;
+            if(cpath.empty())
+            {
+                m_handle->read(n);
+            }
+            else
+            {
+                m_handle->read(cpath,n);
+            }
+            n.to_json_stream(oss,protocol);
+        }
+        detail::viewer_send_json(conn,oss.str());
+    }
+    catch(const conduit::Error &e)
+    {
+        detail::viewer_send_bad_request(conn,e.message());
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Handles a request from the client for a slice of a leaf.
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::handle_get_leaf(struct mg_connection *conn)
+{
+    if(m_node == NULL && m_handle == NULL)
+    {
+        CONDUIT_WARN("rest request for leaf of NULL Node");
+        return false;
+    }
+
+    std::string vars = detail::viewer_request_vars(conn);
+
+    try
+    {
+        std::string cpath = detail::viewer_request_var(vars,"cpath");
+        std::string encoding = detail::viewer_request_var(vars,
+                                                          "encoding",
+                                                          "json");
+        index_t offset = detail::viewer_request_index_var(vars,"offset",0);
+        index_t count  = detail::viewer_request_index_var(vars,
+                                        "count",
+                                        detail::VIEWER_DEFAULT_LEAF_COUNT);
+
+        if(encoding != "json" && encoding != "base64" && encoding != "binary")
+        {
+            CONDUIT_ERROR("unknown leaf encoding: \"" << encoding << "\""
+                          " (expected json, base64 or binary)");
+        }
+
+        Node slice;
+        // number of values of the leaf, unknown when only the slice is read
+        index_t num_eles = -1;
+        if(m_node != NULL)
+        {
+            const Node &leaf = m_node->fetch_existing(cpath);
+            if(leaf.dtype().is_object() || leaf.dtype().is_list())
+            {
+                CONDUIT_ERROR("\"" << cpath << "\" is not a leaf");
+            }
+            num_eles = leaf.dtype().number_of_elements();
+            detail::viewer_leaf_slice(leaf,offset,count,slice);
+        }
+        else
+        {
+            if(!m_handle->has_path(cpath))
+            {
+                CONDUIT_ERROR("\"" << cpath << "\" does not exist");
+            }
+
+            Node leaf;
+            if(count > 0)
+            {
+                Node opts;
+                opts["offset"] = offset;
+                opts["size"]   = count;
+                m_handle->read(cpath,leaf,opts);
+            }
+            if(leaf.dtype().is_object() || leaf.dtype().is_list())
+            {
+                CONDUIT_ERROR("\"" << cpath << "\" is not a leaf");
+            }
+
+            if(leaf.dtype().number_of_elements() > count)
+            {
+                // the handle read the full leaf
+                num_eles = leaf.dtype().number_of_elements();
+                detail::viewer_leaf_slice(leaf,offset,count,slice);
+            }
+            else
+            {
+                slice.swap(leaf);
+            }
+        }
+
+        if(encoding == "binary")
+        {
+            std::ostringstream headers;
+            headers << "X-Conduit-DType: " << slice.dtype().name() << "\r\n"
+                    << "X-Conduit-Count: "
+                    << slice.dtype().number_of_elements() << "\r\n";
+            detail::viewer_send(conn,
+                                "application/octet-stream",
+                                slice.data_ptr(),
+                                (size_t)slice.total_bytes_compact(),
+                                headers.str());
+            return true;
+        }
+
+        std::ostringstream oss;
+        oss << "{\"cpath\": \""
+            << utils::escape_special_chars(cpath) << "\", "
+            << "\"offset\": " << offset << ", "
+            << "\"count\": " << slice.dtype().number_of_elements() << ", ";
+        if(num_eles >= 0)
+        {
+            oss << "\"number_of_elements\": " << num_eles << ", ";
+        }
+
+        if(encoding == "json")
+        {
+            oss << "\"datavalue\": ";
+            slice.to_json_stream(oss,"json");
+        }
+        else
+        {
+            oss << "\"data\": ";
+            slice.to_json_stream(oss,"conduit_base64_json");
+        }
+        oss << "}";
+        detail::viewer_send_json(conn,oss.str());
+    }
+    catch(const conduit::Error &e)
+    {
+        detail::viewer_send_bad_request(conn,e.message());
+    }
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 // Handles a request from the client for a compact, base64 encoded version
 // of the node.
@@ -175,10 +557,20 @@ NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn)
 bool
 NodeViewerRequestHandler::handle_get_base64_json(struct mg_connection *conn)
 {
-    if(m_node != NULL)
+    if(m_node != NULL || m_handle != NULL)
     {
         std::ostringstream oss;
-        m_node->to_json_stream(oss,"conduit_base64_json");
+        if(m_node != NULL)
+        {
+            m_node->to_json_stream(oss,"conduit_base64_json");
+        }
+        else
+        {
+            // reads the whole tree, clients should prefer get-subtree
+            Node n;
+            m_handle->read(n);
+            n.to_json_stream(oss,"conduit_base64_json");
+        }
         
         mg_printf(conn,
                   "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
@@ -210,6 +602,17 @@ void
 NodeViewerRequestHandler::set_node(Node *node)
 {
     m_node = node;
+    m_handle = NULL;
+}
+
+//---------------------------------------------------------------------------//
+// Sets the IO Handle used to read the data to view
+//---------------------------------------------------------------------------//
+void
+NodeViewerRequestHandler::set_io_handle(io::IOHandle *handle)
+{
+    m_handle = handle;
+    m_node = NULL;
 }
 
 
@@ -241,6 +644,14 @@ NodeViewerServer::set_node(Node *data)
     req_handler->set_node(data);
 }
 
+//---------------------------------------------------------------------------//
+void
+NodeViewerServer::set_io_handle(io::IOHandle *handle)
+{
+    NodeViewerRequestHandler *req_handler=(NodeViewerRequestHandler*)handler();
+    req_handler->set_io_handle(handle);
+}
+
 
 }
 //-----------------------------------------------------------------------------
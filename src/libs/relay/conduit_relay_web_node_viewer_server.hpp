@@ -18,6 +18,7 @@
 
 #include "conduit_relay_exports.h"
 #include "conduit_relay_web.hpp"
+#include "conduit_relay_io_handle.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -40,6 +41,28 @@ namespace web
 //-----------------------------------------------------------------------------
 // -- Viewer Web Request Handler  -
 //-----------------------------------------------------------------------------
+//
+// REST api (POST data or GET query variables):
+//
+//  /api/get-schema       schema of the tree, or of the subtree at "cpath".
+//                        With an io handle, leaves are not read and are
+//                        described as empty.
+//  /api/get-subtree      data of the subtree at "cpath", in the given
+//                        "protocol" (default: conduit_base64_json)
+//  /api/get-leaf         "count" values (default: 1000) of the leaf at
+//                        "cpath" starting at "offset" (default: 0), with
+//                        "encoding" json (default), base64 or binary.
+//                        Binary responses hold the compact values, and
+//                        describe them with the X-Conduit-DType and
+//                        X-Conduit-Count headers.
+//  /api/get-value        full value of the leaf at "cpath"
+//  /api/get-base64-json  data of the whole tree
+//  /api/kill-server      shuts down the server
+//
+// With an io handle set, data is read on demand, and leaf slices are read
+// using the "offset" and "size" read options (honored by hdf5 handles,
+// other handles read the full leaf, which is then sliced).
+//
 class CONDUIT_RELAY_API NodeViewerRequestHandler : public WebRequestHandler
 {
 public:
@@ -53,6 +76,8 @@ public:
                               struct mg_connection *conn);
                               
     void           set_node(Node *node);
+    /// serve the data behind an open io handle (instead of a node)
+    void           set_io_handle(io::IOHandle *handle);
 
 private:
     // catch all, used for any post or get
@@ -61,11 +86,15 @@ private:
     // handlers for specific commands 
     bool           handle_get_schema(struct mg_connection *conn);
     bool           handle_get_value(struct mg_connection *conn);
+    bool           handle_get_subtree(struct mg_connection *conn);
+    bool           handle_get_leaf(struct mg_connection *conn);
     bool           handle_get_base64_json(struct mg_connection *conn);
     bool           handle_shutdown(WebServer *server);
 
     // holds the node to visualize 
     Node          *m_node;
+    // or the handle used to read it
+    io::IOHandle  *m_handle;
 };
 
 //-----------------------------------------------------------------------------
@@ -80,6 +109,7 @@ public:
     virtual ~NodeViewerServer();
 
     void    set_node(Node *node);
+    void    set_io_handle(io::IOHandle *handle);
 
 };
 
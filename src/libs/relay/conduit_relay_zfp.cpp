@@ -127,6 +127,99 @@ wrap_zfparray(const zfp::array *arr,
     return 0;
 }
 
+//-----------------------------------------------------------------------------
+// Reads arr[idx] for each index through the array's block cache, so each
+// touched block is decoded once while it stays cached.
+template<typename ArrayType, typename T>
+int
+gather_typed_zfparray_values(const ArrayType &arr,
+                             const index_t_accessor &idxs,
+                             T *dest_ptr)
+{
+    const index_t arr_size = (index_t)arr.size();
+    const index_t num_idxs = idxs.number_of_elements();
+    for(index_t i = 0; i < num_idxs; i++)
+    {
+        const index_t idx = idxs[i];
+        if(idx < 0 || idx >= arr_size)
+        {
+            return 2;
+        }
+        dest_ptr[i] = arr[(uint)idx];
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+int
+gather_zfparray_values(const zfp::array *arr,
+                       const index_t_accessor &idxs,
+                       T *dest_ptr)
+{
+    switch(arr->dimensionality())
+    {
+        case 1:
+            return gather_typed_zfparray_values(
+                *static_cast<const zfp::array1<T>*>(arr), idxs, dest_ptr);
+        case 2:
+            return gather_typed_zfparray_values(
+                *static_cast<const zfp::array2<T>*>(arr), idxs, dest_ptr);
+        case 3:
+            return gather_typed_zfparray_values(
+                *static_cast<const zfp::array3<T>*>(arr), idxs, dest_ptr);
+        default:
+            return 1;
+    }
+}
+
+//-----------------------------------------------------------------------------
+int
+unwrap_zfparray_values(const Node &node,
+                       const Node &indices,
+                       Node &dest)
+{
+    zfp::array *arr = unwrap_zfparray(node);
+    if(arr == NULL)
+    {
+        return 1;
+    }
+
+    const index_t_accessor idxs = indices.as_index_t_accessor();
+    const index_t num_idxs = idxs.number_of_elements();
+
+    int res = 1;
+    if(arr->scalar_type() == zfp_type_float)
+    {
+        dest.set(DataType::float32(num_idxs));
+        res = gather_zfparray_values(arr, idxs, dest.as_float32_ptr());
+    }
+    else if(arr->scalar_type() == zfp_type_double)
+    {
+        dest.set(DataType::float64(num_idxs));
+        res = gather_zfparray_values(arr, idxs, dest.as_float64_ptr());
+    }
+
+    delete arr;
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+int
+unwrap_zfparray_range(const Node &node,
+                      index_t offset,
+                      index_t count,
+                      Node &dest)
+{
+    Node indices(DataType::index_t(count));
+    index_t *indices_ptr = indices.value();
+    for(index_t i = 0; i < count; i++)
+    {
+        indices_ptr[i] = offset + i;
+    }
+    return unwrap_zfparray_values(node, indices, dest);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::io --
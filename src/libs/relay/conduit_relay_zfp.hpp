@@ -49,6 +49,30 @@ zfp::array* CONDUIT_RELAY_API unwrap_zfparray(const Node &node);
 int CONDUIT_RELAY_API wrap_zfparray(const zfp::array* arr,
                                     Node &node);
 
+//-----------------------------------------------------------------------------
+/// Decompresses selected values of a wrapped zfparray into dest, without
+/// decompressing the whole array. zfp compressed arrays are fixed-rate, so
+/// only the blocks holding the selected values are decoded. This is meant
+/// for slicing compressed fields, for example to the elements of one
+/// partition.
+///
+/// indices holds flat (x fastest) value indices, dest is set to a float32
+/// or float64 array (matching the zfparray scalar type) with one value per
+/// index.
+///
+/// Returns 0 on success, 1 if node can't be unwrapped, and 2 if an index is
+/// out of range.
+//-----------------------------------------------------------------------------
+int CONDUIT_RELAY_API unwrap_zfparray_values(const Node &node,
+                                             const Node &indices,
+                                             Node &dest);
+
+/// Same as above, for the values with flat indices [offset, offset + count).
+int CONDUIT_RELAY_API unwrap_zfparray_range(const Node &node,
+                                            index_t offset,
+                                            index_t count,
+                                            Node &dest);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::io --
@@ -104,6 +104,7 @@ PyRelay_io_blueprint_write_mesh(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::io::blueprint::write_mesh(node,
                                          std::string(path),
                                          protocol_str,
@@ -189,6 +190,7 @@ PyRelay_io_blueprint_save_mesh(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::io::blueprint::save_mesh(node,
                                         std::string(path),
                                         protocol_str,
@@ -266,6 +268,7 @@ PyRelay_io_blueprint_read_mesh(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::io::blueprint::read_mesh(std::string(path),
                                         *opts_ptr,
                                         node);
@@ -340,6 +343,7 @@ PyRelay_io_blueprint_load_mesh(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::io::blueprint::load_mesh(std::string(path),
                                         *opts_ptr,
                                         node);
@@ -200,6 +200,7 @@ PyRelay_IOHandle_open(PyRelay_IOHandle *self,
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         self->handle->open(std::string(path),
                            protocol_str,
                            *opts_ptr);
@@ -284,6 +285,7 @@ PyRelay_IOHandle_read(PyRelay_IOHandle *self,
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         if(path == NULL)
         {
             self->handle->read(*node_ptr,
@@ -361,6 +363,7 @@ PyRelay_IOHandle_write(PyRelay_IOHandle *self,
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         if(path == NULL)
         {
             self->handle->write(*node_ptr,
@@ -509,6 +512,41 @@ PyRelay_IOHandle_remove(PyRelay_IOHandle *self,
     Py_RETURN_NONE; 
 }
 
+//-----------------------------------------------------------------------------
+static PyObject *
+PyRelay_IOHandle_cache_info(PyRelay_IOHandle *self,
+                            PyObject *args,
+                            PyObject *kwargs)
+{
+
+    static const char *kwlist[] = {"info", NULL};
+
+    PyObject *py_info = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwargs,
+                                     "O",
+                                     const_cast<char**>(kwlist),
+                                     &py_info))
+    {
+        return NULL;
+    }
+
+    if(!PyConduit_Node_Check(py_info))
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "IOHandle.cache_info 'info' argument must "
+                        "be a conduit.Node");
+        return NULL;
+    }
+
+    Node *info_ptr = PyConduit_Node_Get_Node_Ptr(py_info);
+
+    self->handle->cache_info(*info_ptr);
+
+    Py_RETURN_NONE;
+}
+
 //-----------------------------------------------------------------------------
 static PyObject *
 PyRelay_IOHandle_close(PyRelay_IOHandle *self)
@@ -561,6 +599,10 @@ static PyMethodDef PyRelay_IOHandle_METHODS[] = {
      (PyCFunction)PyRelay_IOHandle_has_path,
      METH_VARARGS | METH_KEYWORDS,
      "Checks if a path exists"},
+    {"cache_info",
+     (PyCFunction)PyRelay_IOHandle_cache_info,
+     METH_VARARGS | METH_KEYWORDS,
+     "Fills a Node with read cache settings and hit / miss counts"},
     {"close",
      (PyCFunction)PyRelay_IOHandle_close,
       METH_NOARGS,
@@ -714,6 +756,7 @@ PyRelay_io_save(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
     
         relay::io::save(node,
                         std::string(path),
@@ -800,6 +843,7 @@ PyRelay_io_save_merged(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::io::save_merged(node,
                                std::string(path),
                                protocol_str,
@@ -861,6 +905,7 @@ PyRelay_io_load(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::io::load(std::string(path),
                         protocol_str,
                         node);
@@ -923,6 +968,7 @@ PyRelay_io_load_merged(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::io::load_merged(std::string(path),
                                protocol_str,
                                node);
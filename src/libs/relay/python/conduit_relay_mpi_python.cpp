@@ -350,6 +350,7 @@ PyRelay_MPI_send(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::send(node, dest, tag, comm);
     }
     catch(conduit::Error &e)
@@ -411,6 +412,7 @@ PyRelay_MPI_recv(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::recv(node, source, tag, comm);
     }
     catch(conduit::Error &e)
@@ -471,6 +473,7 @@ PyRelay_MPI_send_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::send_using_schema(node, dest, tag, comm);
     }
     catch(conduit::Error &e)
@@ -531,6 +534,7 @@ PyRelay_MPI_recv_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::recv_using_schema(node, source, tag, comm);
     }
     catch(conduit::Error &e)
@@ -647,6 +651,7 @@ PyRelay_MPI_sum_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::sum_reduce(send_node,
                                recv_node,
                                root,
@@ -722,6 +727,7 @@ PyRelay_MPI_min_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::min_reduce(send_node,
                                recv_node,
                                root,
@@ -798,6 +804,7 @@ PyRelay_MPI_max_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::max_reduce(send_node,
                                recv_node,
                                root,
@@ -874,6 +881,7 @@ PyRelay_MPI_prod_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::prod_reduce(send_node,
                                recv_node,
                                root,
@@ -946,6 +954,7 @@ PyRelay_MPI_sum_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::sum_all_reduce(send_node,
                                    recv_node,
                                    comm);
@@ -1018,6 +1027,7 @@ PyRelay_MPI_min_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::min_all_reduce(send_node,
                                    recv_node,
                                    comm);
@@ -1089,6 +1099,7 @@ PyRelay_MPI_max_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::max_all_reduce(send_node,
                                    recv_node,
                                    comm);
@@ -1160,6 +1171,7 @@ PyRelay_MPI_prod_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::prod_all_reduce(send_node,
                                     recv_node,
                                     comm);
@@ -1424,6 +1436,7 @@ PyRelay_MPI_gather(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::gather(send_node,
                            recv_node,
                            root,
@@ -1496,6 +1509,7 @@ PyRelay_MPI_gather_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::gather_using_schema(send_node,
                                         recv_node,
                                         root,
@@ -1565,6 +1579,7 @@ PyRelay_MPI_all_gather(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::all_gather(send_node,
                                recv_node,
                                comm);
@@ -1633,6 +1648,7 @@ PyRelay_MPI_all_gather_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::all_gather_using_schema(send_node,
                                             recv_node,
                                             comm);
@@ -1696,6 +1712,7 @@ PyRelay_MPI_broadcast(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::broadcast(node, root, comm);
     }
     catch(conduit::Error &e)
@@ -1753,6 +1770,7 @@ PyRelay_MPI_broadcast_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads;
         relay::mpi::broadcast_using_schema(node, root, comm);
     }
     catch(conduit::Error &e)
@@ -0,0 +1,229 @@
+/*
+# Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+# Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+# other details. No copyright assignment is required to contribute to Conduit.
+*/
+
+//
+// Decodes the binary WebSocket frames sent by
+// conduit::relay::web::WebSocket::send_binary and send_delta
+// (see conduit_relay_web.hpp for the frame layouts).
+//
+// Full frames hold conduit_pack data: a 64 byte header, a binary schema and
+// the leaf data. Delta frames hold new values for some of the leaves of the
+// tree decoded from the previous frames.
+//
+// Decoded trees use js objects for conduit objects, arrays for conduit lists,
+// typed arrays for numeric leaves and strings for char8_str leaves.
+//
+
+var CONDUIT_PACK_MAGIC  = "CNDTPACK";
+var CONDUIT_DELTA_MAGIC = "CNDTDLTA";
+var CONDUIT_ENDIAN_MARK = 0x01020304;
+
+// conduit dtype ids (see conduit_data_type.hpp)
+var CONDUIT_EMPTY_ID     = 0;
+var CONDUIT_OBJECT_ID    = 1;
+var CONDUIT_LIST_ID      = 2;
+var CONDUIT_CHAR8_STR_ID = 13;
+
+var conduitLeafTypes = {
+  3:  { name: "int8",    array: Int8Array,    get: "getInt8"    },
+  4:  { name: "int16",   array: Int16Array,   get: "getInt16"   },
+  5:  { name: "int32",   array: Int32Array,   get: "getInt32"   },
+  6:  { name: "int64",   array: null,         get: "getInt64"   },
+  7:  { name: "uint8",   array: Uint8Array,   get: "getUint8"   },
+  8:  { name: "uint16",  array: Uint16Array,  get: "getUint16"  },
+  9:  { name: "uint32",  array: Uint32Array,  get: "getUint32"  },
+  10: { name: "uint64",  array: null,         get: "getUint64"  },
+  11: { name: "float32", array: Float32Array, get: "getFloat32" },
+  12: { name: "float64", array: Float64Array, get: "getFloat64" }
+};
+
+var conduitHostLittleEndian = (new Uint8Array(new Uint32Array([1]).buffer))[0] === 1;
+
+// reads a 64-bit integer as a js number (exact up to 2^53)
+var conduitGetInt64 = function (view, offset, little, signed) {
+  var lo = view.getUint32(offset + (little ? 0 : 4), little);
+  var hi = signed ? view.getInt32(offset + (little ? 4 : 0), little)
+                  : view.getUint32(offset + (little ? 4 : 0), little);
+  return hi * 4294967296 + lo;
+};
+
+var conduitReadString = function (bytes, offset, length) {
+  var res = "";
+  for (var i = 0; i < length; i++) {
+    res += String.fromCharCode(bytes[offset + i]);
+  }
+  return res;
+};
+
+function ConduitFrameDecoder() {
+  // decoded tree, null until the first full frame
+  this.root = null;
+  // non empty leaves of root in depth first order:
+  //   {path, dtype, values, parent, key}
+  this.leaves = [];
+}
+
+// decodes a frame (an ArrayBuffer) and returns the list of leaf paths it set
+ConduitFrameDecoder.prototype.decode = function (buffer) {
+  var magic = conduitReadString(new Uint8Array(buffer, 0, 8), 0, 8);
+  if (magic === CONDUIT_PACK_MAGIC) {
+    return this.decodeFull(buffer);
+  } else if (magic === CONDUIT_DELTA_MAGIC) {
+    return this.decodeDelta(buffer);
+  }
+  throw new Error("Unknown conduit frame: " + magic);
+};
+
+ConduitFrameDecoder.prototype.decodeFull = function (buffer) {
+  var view = new DataView(buffer);
+  // the endianness mark tells us the writer's endianness
+  this.little = view.getUint32(12, true) === CONDUIT_ENDIAN_MARK;
+  var version = view.getUint32(8, this.little);
+  if (version !== 1) {
+    throw new Error("Unsupported conduit_pack version: " + version);
+  }
+  var schemaOffset = conduitGetInt64(view, 16, this.little, false);
+  var dataOffset   = conduitGetInt64(view, 32, this.little, false);
+
+  this.buffer = buffer;
+  this.view   = view;
+  this.bytes  = new Uint8Array(buffer);
+  this.pos    = schemaOffset;
+  this.dataOffset = dataOffset;
+
+  this.leaves = [];
+  var holder = { root: null };
+  this.decodeEntry("", holder, "root");
+  this.root = holder.root;
+
+  return this.leaves.map(function (leaf) { return leaf.path; });
+};
+
+// decodes a binary schema entry (see Schema::serialize_binary) and sets
+// parent[key] to its value
+ConduitFrameDecoder.prototype.decodeEntry = function (path, parent, key) {
+  var view = this.view;
+  var little = this.little;
+  var dtypeId = view.getUint8(this.pos);
+  this.pos += 1;
+
+  if (dtypeId === CONDUIT_OBJECT_ID || dtypeId === CONDUIT_LIST_ID) {
+    var nchildren = conduitGetInt64(view, this.pos, little, false);
+    this.pos += 8;
+    var res = (dtypeId === CONDUIT_OBJECT_ID) ? {} : [];
+    parent[key] = res;
+    for (var i = 0; i < nchildren; i++) {
+      var childKey = i;
+      if (dtypeId === CONDUIT_OBJECT_ID) {
+        var nameLength = view.getUint32(this.pos, little);
+        this.pos += 4;
+        childKey = conduitReadString(this.bytes, this.pos, nameLength);
+        this.pos += nameLength;
+      }
+      // skip the encoded child size
+      this.pos += 8;
+      var childPath = (path === "") ? String(childKey) : path + "/" + childKey;
+      this.decodeEntry(childPath, res, childKey);
+    }
+  } else if (dtypeId === CONDUIT_EMPTY_ID) {
+    parent[key] = null;
+  } else {
+    var dtype = {
+      id:               dtypeId,
+      numberOfElements: conduitGetInt64(view, this.pos,      little, true),
+      offset:           conduitGetInt64(view, this.pos + 8,  little, true),
+      stride:           conduitGetInt64(view, this.pos + 16, little, true),
+      elementBytes:     conduitGetInt64(view, this.pos + 24, little, true)
+    };
+    this.pos += 33;
+    var leaf = { path: path, dtype: dtype, parent: parent, key: key };
+    leaf.values = this.readLeaf(dtype, this.dataOffset + dtype.offset,
+                                dtype.stride);
+    parent[key] = leaf.values;
+    this.leaves.push(leaf);
+  }
+};
+
+// returns the values of a leaf stored at offset with the given stride.
+// Compact, aligned leaves written in the host's endianness are views of
+// the frame, other leaves are copied.
+ConduitFrameDecoder.prototype.readLeaf = function (dtype, offset, stride) {
+  var count = dtype.numberOfElements;
+  if (dtype.id === CONDUIT_CHAR8_STR_ID) {
+    var str = conduitReadString(this.bytes, offset, count);
+    var end = str.indexOf("\0");
+    return (end >= 0) ? str.substring(0, end) : str;
+  }
+
+  var type = conduitLeafTypes[dtype.id];
+  if (type === undefined) {
+    throw new Error("Unsupported conduit dtype id: " + dtype.id);
+  }
+
+  if (type.array !== null &&
+      stride === dtype.elementBytes &&
+      offset % dtype.elementBytes === 0 &&
+      this.little === conduitHostLittleEndian) {
+    return new type.array(this.buffer, offset, count);
+  }
+
+  var res = (type.array !== null) ? new type.array(count) : new Float64Array(count);
+  for (var i = 0; i < count; i++) {
+    var elemOffset = offset + i * stride;
+    if (type.get === "getInt64" || type.get === "getUint64") {
+      res[i] = conduitGetInt64(this.view, elemOffset, this.little,
+                               type.get === "getInt64");
+    } else {
+      res[i] = this.view[type.get](elemOffset, this.little);
+    }
+  }
+  return res;
+};
+
+ConduitFrameDecoder.prototype.decodeDelta = function (buffer) {
+  if (this.root === null) {
+    throw new Error("Received a conduit delta frame before a full frame");
+  }
+
+  var view = new DataView(buffer);
+  var little = this.little;
+  var numChanged = conduitGetInt64(view, 8, little, false);
+
+  // leaf values are read from the delta frame
+  var previous = { buffer: this.buffer, view: this.view, bytes: this.bytes };
+  this.buffer = buffer;
+  this.view   = view;
+  this.bytes  = new Uint8Array(buffer);
+
+  var changed = [];
+  var offset = 16 + 8 * numChanged;
+  for (var i = 0; i < numChanged; i++) {
+    var leafIdx = conduitGetInt64(view, 16 + 8 * i, little, false);
+    var leaf = this.leaves[leafIdx];
+    if (leaf === undefined) {
+      throw new Error("Conduit delta frame leaf index out of range: " + leafIdx);
+    }
+    offset = Math.ceil(offset / 8) * 8;
+    var values = this.readLeaf(leaf.dtype, offset, leaf.dtype.elementBytes);
+    if (typeof values === "string") {
+      leaf.values = values;
+      leaf.parent[leaf.key] = values;
+    } else {
+      leaf.values.set(values);
+    }
+    offset += leaf.dtype.numberOfElements * leaf.dtype.elementBytes;
+    changed.push(leaf.path);
+  }
+
+  this.buffer = previous.buffer;
+  this.view   = previous.view;
+  this.bytes  = previous.bytes;
+  return changed;
+};
+
+if (typeof module !== "undefined" && module.exports) {
+  module.exports = ConduitFrameDecoder;
+}
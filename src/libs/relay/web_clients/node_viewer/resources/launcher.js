@@ -23,35 +23,23 @@ request.onerror = function () {
 
 request.send();
 
-var b64_req = new XMLHttpRequest();
-b64_req.open('POST', '/api/get-base64-json', true);
-b64_req.onload = function ()
-{
-    if (b64_req.status >= 200 && b64_req.status < 400) 
-    {
-        var node = JSON.parse(b64_req.response);
-        console.log("base64-json result:", b64_req.response);
-    }
-    else 
-    {
-      console.log("Server responded with error code: ", b64_req.status);
-    }
-};
-
-b64_req.onerror = function ()
-{
-  console.log("Connection error");
-};
-
-b64_req.send();
+// tree sent with WebSocket::send_binary and send_delta
+var live_node = new ConduitFrameDecoder();
 
 function websocket_test()
 {
     var wsproto = (location.protocol === 'https:') ? 'wss:' : 'ws:';
     connection = new WebSocket(wsproto + '//' + window.location.host + '/websocket');
+    connection.binaryType = 'arraybuffer';
     
     connection.onmessage = function (msg) 
     {
+        if(msg.data instanceof ArrayBuffer)
+        {
+            var changed = live_node.decode(msg.data);
+            console.log('WebSocket binary frame, updated leaves:', changed);
+            return;
+        }
         console.log('WebSocket message' + msg.data);
         connection.send('{"type":"info","message":"response from browser"}');
     }
@@ -18,7 +18,9 @@ var bytesToString = function (bytes) {
 var nodeSize = function (d) {
 	if (!d.size) {
 		if (d.leaf) {
-			d.size = d.number_of_elements * d.element_bytes;
+			// leaves served from an io handle are not read up front and
+			// have no size
+			d.size = (d.number_of_elements || 0) * (d.element_bytes || 0);
 		} else {
       var kids = d.children ? d.children : d._children;
       d.size = kids.map(nodeSize).reduce(function (a, b) { return a + b; });
@@ -58,10 +60,14 @@ var nodeOffset = function (d) {
 	return d.offset;
 };
 
+// max number of leaf values fetched for display, large leaves are
+// not sent in full
+var leafValueLimit = 100000;
+
 var getNodeValue = function (d, callback) {
 	if (!d.datavalue && d.leaf && d.length !== 0) {
     var request = new XMLHttpRequest();
-    request.open('POST', '/api/get-value', true);
+    request.open('POST', '/api/get-leaf', true);
     request.onload = function () {
       if (request.status >= 200 && request.status < 400) {
         json = JSON.parse(request.response.replace(/nan/ig, "null"));
@@ -76,7 +82,8 @@ var getNodeValue = function (d, callback) {
       callback("Server connection error");
     };
 
-    request.send("cpath=" + d.cpath);
+    request.send("cpath=" + encodeURIComponent(d.cpath) +
+                 "&offset=0&count=" + leafValueLimit);
 	} else {
     callback(d.datavalue);
   }
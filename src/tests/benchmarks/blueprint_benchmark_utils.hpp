@@ -0,0 +1,153 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: blueprint_benchmark_utils.hpp
+///
+//-----------------------------------------------------------------------------
+///
+/// Helpers shared by the blueprint benchmark executables:
+///
+///  - benchmark sizes and thread counts, read from the environment so the
+///    same binaries can be swept without rebuilding:
+///      BLUEPRINT_BENCHMARK_SIZES    points per axis  (default "16,32,64")
+///      BLUEPRINT_BENCHMARK_THREADS  num_threads      (default "1,4")
+///
+///  - peak resident memory of the process. On Linux the peak is reset
+///    before each benchmark (through /proc/self/clear_refs), so the reported
+///    peak covers that benchmark only; elsewhere it is the process peak.
+///
+//-----------------------------------------------------------------------------
+
+#ifndef BLUEPRINT_BENCHMARK_UTILS_HPP
+#define BLUEPRINT_BENCHMARK_UTILS_HPP
+
+#include "conduit.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+//-----------------------------------------------------------------------------
+// -- benchmark arguments --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+inline std::vector<int64_t>
+env_int_list(const char *name, const char *default_value)
+{
+    const char *env = std::getenv(name);
+    std::istringstream iss((env != NULL && env[0] != '\0') ? env : default_value);
+
+    std::vector<int64_t> res;
+    std::string tok;
+    while(std::getline(iss, tok, ','))
+    {
+        if(!tok.empty())
+        {
+            res.push_back(std::atoll(tok.c_str()));
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+inline std::vector<int64_t>
+benchmark_sizes()
+{
+    return env_int_list("BLUEPRINT_BENCHMARK_SIZES", "16,32,64");
+}
+
+//-----------------------------------------------------------------------------
+inline std::vector<int64_t>
+benchmark_threads()
+{
+    return env_int_list("BLUEPRINT_BENCHMARK_THREADS", "1,4");
+}
+
+//-----------------------------------------------------------------------------
+// Registers {size} args.
+inline void
+size_args(benchmark::internal::Benchmark *b)
+{
+    b->ArgNames({"n"});
+    std::vector<int64_t> sizes = benchmark_sizes();
+    for(size_t si = 0; si < sizes.size(); si++)
+    {
+        b->Args({sizes[si]});
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Registers {size, num_threads} args.
+inline void
+size_thread_args(benchmark::internal::Benchmark *b)
+{
+    b->ArgNames({"n", "threads"});
+    std::vector<int64_t> sizes = benchmark_sizes();
+    std::vector<int64_t> threads = benchmark_threads();
+    for(size_t si = 0; si < sizes.size(); si++)
+    {
+        for(size_t ti = 0; ti < threads.size(); ti++)
+        {
+            b->Args({sizes[si], threads[ti]});
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- memory --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Resets the peak resident set size to the current one, when supported.
+inline void
+reset_peak_memory()
+{
+#if defined(__linux__)
+    std::ofstream ofs("/proc/self/clear_refs");
+    ofs << "5";
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Returns the peak resident set size in bytes (0 if unknown).
+inline double
+peak_memory_bytes()
+{
+#if defined(__linux__)
+    std::ifstream ifs("/proc/self/status");
+    std::string line;
+    while(std::getline(ifs, line))
+    {
+        if(line.compare(0, 6, "VmHWM:") == 0)
+        {
+            return 1024.0 * std::atof(line.c_str() + 6);
+        }
+    }
+#endif
+#if !defined(_WIN32)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined(__APPLE__)
+        return (double) usage.ru_maxrss;
+#else
+        return 1024.0 * usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0.0;
+}
+
+#endif
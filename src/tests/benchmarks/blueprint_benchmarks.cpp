@@ -0,0 +1,397 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: blueprint_benchmarks.cpp
+///
+//-----------------------------------------------------------------------------
+///
+/// Google Benchmark based end-to-end benchmarks for blueprint mesh
+/// operations on the standard example meshes.
+///
+/// Meshes used by these benchmarks, for a size argument n:
+///   braid_hexs:  examples::braid("hexs", n, n, n)
+///   braid_quads: examples::braid("quads", 8n, 8n, 0)
+///   grid_hexs:   examples::grid("hexs", n/2+1, n/2+1, n/2+1, 2, 2, 2),
+///                eight domains with a vertex adjset
+///   polytess:    examples::polytess(n/2, n/4), polyhedra
+///   venn:        examples::venn("full", 4n, 4n, 0.25)
+///
+/// Each benchmark reports its time, the elements processed per second
+/// (items_per_second) and the peak resident memory while it ran
+/// (peak_memory_bytes, see blueprint_benchmark_utils.hpp). Sizes and thread
+/// counts come from BLUEPRINT_BENCHMARK_SIZES and BLUEPRINT_BENCHMARK_THREADS.
+///
+/// Run with --benchmark_out=<file> --benchmark_out_format=json to create
+/// machine readable results (the run_blueprint_benchmarks target does this).
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+
+#include "blueprint_benchmark_utils.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- mesh creation helpers --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+create_mesh(const std::string &kind, index_t n, Node &res)
+{
+    res.reset();
+    if(kind == "braid_hexs")
+    {
+        blueprint::mesh::examples::braid("hexs", n, n, n, res);
+    }
+    else if(kind == "braid_quads")
+    {
+        blueprint::mesh::examples::braid("quads", 8 * n, 8 * n, 0, res);
+    }
+    else if(kind == "grid_hexs")
+    {
+        const index_t dom_n = n / 2 + 1;
+        blueprint::mesh::examples::grid("hexs", dom_n, dom_n, dom_n,
+                                        2, 2, 2, res);
+    }
+    else if(kind == "polytess")
+    {
+        blueprint::mesh::examples::polytess(std::max((index_t)2, n / 2),
+                                            std::max((index_t)2, n / 4),
+                                            res);
+    }
+    else if(kind == "venn")
+    {
+        blueprint::mesh::examples::venn("full", 4 * n, 4 * n, 0.25, res);
+    }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+number_of_elements(const Node &mesh)
+{
+    index_t res = 0;
+    std::vector<const Node *> doms = blueprint::mesh::domains(mesh);
+    for(size_t di = 0; di < doms.size(); di++)
+    {
+        res += blueprint::mesh::topology::length((*doms[di])["topologies"].child(0));
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// Starts the peak memory measurement of a benchmark.
+void
+begin_benchmark(benchmark::State &/*state*/)
+{
+    reset_peak_memory();
+}
+
+//-----------------------------------------------------------------------------
+// Sets the throughput and peak memory counters of a benchmark.
+void
+end_benchmark(benchmark::State &state, index_t items_per_iteration)
+{
+    state.SetItemsProcessed(state.iterations() * items_per_iteration);
+    state.counters["peak_memory_bytes"] = peak_memory_bytes();
+}
+
+//-----------------------------------------------------------------------------
+Node
+thread_options(benchmark::State &state)
+{
+    Node opts;
+    opts["num_threads"] = (index_t) state.range(1);
+    return opts;
+}
+
+//-----------------------------------------------------------------------------
+// -- example generation --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_braid(benchmark::State &state, const std::string &mesh_type)
+{
+    const index_t n = state.range(0);
+    Node opts = thread_options(state);
+
+    begin_benchmark(state);
+    Node mesh;
+    for(auto _ : state)
+    {
+        blueprint::mesh::examples::braid(mesh_type, n, n, n, opts, mesh);
+        benchmark::DoNotOptimize(mesh.data_ptr());
+    }
+    end_benchmark(state, number_of_elements(mesh));
+}
+BENCHMARK_CAPTURE(BM_braid, hexs, std::string("hexs"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_braid, tets, std::string("tets"))
+    ->Apply(size_thread_args)->UseRealTime();
+
+//-----------------------------------------------------------------------------
+// -- verify --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_verify(benchmark::State &state, const std::string &kind)
+{
+    Node mesh, info;
+    create_mesh(kind, state.range(0), mesh);
+    Node opts = thread_options(state);
+
+    begin_benchmark(state);
+    for(auto _ : state)
+    {
+        bool ok = blueprint::mesh::verify(mesh, info, opts);
+        benchmark::DoNotOptimize(ok);
+    }
+    end_benchmark(state, number_of_elements(mesh));
+}
+BENCHMARK_CAPTURE(BM_verify, braid_hexs, std::string("braid_hexs"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_verify, grid_hexs, std::string("grid_hexs"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_verify, polytess, std::string("polytess"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_verify, venn, std::string("venn"))
+    ->Apply(size_thread_args)->UseRealTime();
+
+//-----------------------------------------------------------------------------
+// -- derived topologies --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+generate_entities(const std::string &entity,
+                  const Node &topo,
+                  const Node &opts,
+                  Node &res)
+{
+    namespace unstructured = blueprint::mesh::topology::unstructured;
+    Node &s2d = res["s2dmap"];
+    Node &d2s = res["d2smap"];
+    if(entity == "points")
+    {
+        unstructured::generate_points(topo, res["topo"], s2d, d2s, opts);
+    }
+    else if(entity == "lines")
+    {
+        unstructured::generate_lines(topo, res["topo"], s2d, d2s, opts);
+    }
+    else if(entity == "faces")
+    {
+        unstructured::generate_faces(topo, res["topo"], s2d, d2s, opts);
+    }
+    else if(entity == "centroids")
+    {
+        unstructured::generate_centroids(topo, res["topo"], res["coords"],
+                                         s2d, d2s, opts);
+    }
+    else if(entity == "sides")
+    {
+        Node fields;
+        unstructured::generate_sides(topo, res["topo"], res["coords"],
+                                     fields, s2d, d2s, opts);
+    }
+    else if(entity == "corners")
+    {
+        unstructured::generate_corners(topo, res["topo"], res["coords"],
+                                       s2d, d2s, opts);
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+BM_generate(benchmark::State &state,
+            const std::string &kind,
+            const std::string &entity)
+{
+    Node mesh;
+    create_mesh(kind, state.range(0), mesh);
+    const Node *topo_ptr = mesh["topologies"].child_ptr(0);
+    if(entity == "sides")
+    {
+        // (the options variant of generate_sides needs a polytopal topology)
+        Node &poly_topo = mesh["topologies/poly"];
+        blueprint::mesh::topology::unstructured::to_polytopal(*topo_ptr, poly_topo);
+        topo_ptr = &poly_topo;
+    }
+    const Node &topo = *topo_ptr;
+    Node opts = thread_options(state);
+
+    begin_benchmark(state);
+    for(auto _ : state)
+    {
+        Node res;
+        generate_entities(entity, topo, opts, res);
+        benchmark::DoNotOptimize(res.data_ptr());
+    }
+    end_benchmark(state, blueprint::mesh::topology::length(topo));
+}
+BENCHMARK_CAPTURE(BM_generate, braid_hexs_points,
+                  std::string("braid_hexs"), std::string("points"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_generate, braid_hexs_lines,
+                  std::string("braid_hexs"), std::string("lines"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_generate, braid_hexs_faces,
+                  std::string("braid_hexs"), std::string("faces"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_generate, braid_hexs_centroids,
+                  std::string("braid_hexs"), std::string("centroids"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_generate, braid_hexs_sides,
+                  std::string("braid_hexs"), std::string("sides"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_generate, braid_hexs_corners,
+                  std::string("braid_hexs"), std::string("corners"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_generate, polytess_faces,
+                  std::string("polytess"), std::string("faces"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_generate, polytess_centroids,
+                  std::string("polytess"), std::string("centroids"))
+    ->Apply(size_thread_args)->UseRealTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_to_polytopal(benchmark::State &state, const std::string &kind)
+{
+    Node mesh;
+    create_mesh(kind, state.range(0), mesh);
+    const Node &topo = mesh["topologies"].child(0);
+
+    begin_benchmark(state);
+    for(auto _ : state)
+    {
+        Node res;
+        blueprint::mesh::topology::unstructured::to_polytopal(topo, res);
+        benchmark::DoNotOptimize(res.data_ptr());
+    }
+    end_benchmark(state, blueprint::mesh::topology::length(topo));
+}
+BENCHMARK_CAPTURE(BM_to_polytopal, polygonal, std::string("braid_quads"))
+    ->Apply(size_args);
+BENCHMARK_CAPTURE(BM_to_polytopal, polyhedral, std::string("braid_hexs"))
+    ->Apply(size_args);
+
+//-----------------------------------------------------------------------------
+// -- partition, point merge and flatten --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_partition(benchmark::State &state,
+             const std::string &kind,
+             index_t target)
+{
+    Node mesh;
+    create_mesh(kind, state.range(0), mesh);
+    // partition only accepts pairwise adjsets, the shared points are merged
+    // by coordinate instead
+    NodeIterator ditr = mesh.children();
+    while(ditr.has_next())
+    {
+        Node &dom = ditr.next();
+        if(dom.has_child("adjsets"))
+        {
+            dom.remove("adjsets");
+        }
+    }
+    Node opts = thread_options(state);
+    opts["target"] = target;
+
+    begin_benchmark(state);
+    for(auto _ : state)
+    {
+        Node res;
+        blueprint::mesh::partition(mesh, opts, res);
+        benchmark::DoNotOptimize(res.data_ptr());
+    }
+    end_benchmark(state, number_of_elements(mesh));
+}
+BENCHMARK_CAPTURE(BM_partition, split, std::string("braid_hexs"), 8)
+    ->Apply(size_thread_args)->UseRealTime();
+// combining the eight grid domains into one merges their shared points
+BENCHMARK_CAPTURE(BM_partition, point_merge, std::string("grid_hexs"), 1)
+    ->Apply(size_thread_args)->UseRealTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_flatten(benchmark::State &state, const std::string &kind)
+{
+    Node mesh;
+    create_mesh(kind, state.range(0), mesh);
+    Node opts = thread_options(state);
+
+    begin_benchmark(state);
+    for(auto _ : state)
+    {
+        Node res;
+        blueprint::mesh::flatten(mesh, opts, res);
+        benchmark::DoNotOptimize(res.data_ptr());
+    }
+    end_benchmark(state, number_of_elements(mesh));
+}
+BENCHMARK_CAPTURE(BM_flatten, grid_hexs, std::string("grid_hexs"))
+    ->Apply(size_thread_args)->UseRealTime();
+
+//-----------------------------------------------------------------------------
+// -- matset conversions --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_matset_convert(benchmark::State &state, const std::string &flavor)
+{
+    namespace matset = blueprint::mesh::matset;
+
+    Node mesh;
+    create_mesh("venn", state.range(0), mesh);
+    const Node &src = mesh["matsets"].child(0);
+    Node opts = thread_options(state);
+
+    begin_benchmark(state);
+    for(auto _ : state)
+    {
+        Node res;
+        if(flavor == "multi_buffer_by_material")
+        {
+            matset::to_multi_buffer_by_material(src, res, opts);
+        }
+        else if(flavor == "sparse_by_element")
+        {
+            matset::to_sparse_by_element(src, res, opts);
+        }
+        else if(flavor == "uni_buffer_by_material")
+        {
+            matset::to_uni_buffer_by_material(src, res, opts);
+        }
+        benchmark::DoNotOptimize(res.data_ptr());
+    }
+    end_benchmark(state, number_of_elements(mesh));
+}
+BENCHMARK_CAPTURE(BM_matset_convert, multi_buffer_by_material,
+                  std::string("multi_buffer_by_material"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_matset_convert, sparse_by_element,
+                  std::string("sparse_by_element"))
+    ->Apply(size_thread_args)->UseRealTime();
+BENCHMARK_CAPTURE(BM_matset_convert, uni_buffer_by_material,
+                  std::string("uni_buffer_by_material"))
+    ->Apply(size_thread_args)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,315 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: blueprint_mpi_benchmarks.cpp
+///
+//-----------------------------------------------------------------------------
+///
+/// Google Benchmark based scaling benchmarks for the blueprint::mpi::mesh
+/// operations, run with mpiexec.
+///
+/// The meshes come from blueprint::mpi::mesh::examples::grid, with two
+/// hex domains per rank stacked along x. For a size argument n:
+///   strong scaling: the global grid has n points per axis, split across
+///                   the ranks
+///   weak scaling:   every domain has n points per axis
+///
+/// Every iteration is timed with MPI_Wtime between barriers and reports the
+/// slowest rank's time, so all ranks run the same number of iterations.
+/// Counters are the number of ranks (ranks), the global elements processed
+/// per second (items_per_second) and the largest peak resident memory of
+/// any rank (peak_memory_bytes). Only rank 0 writes reports, so
+/// --benchmark_out=<file> --benchmark_out_format=json creates one JSON file
+/// (the run_blueprint_mpi_benchmarks target does this).
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+#include "conduit_blueprint_mpi.hpp"
+#include "conduit_blueprint_mpi_mesh_examples.hpp"
+#include "conduit_relay_mpi.hpp"
+
+#include "blueprint_benchmark_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+#include <benchmark/benchmark.h>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- mesh creation helpers --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+create_grid(const std::string &scaling,
+            const std::string &mesh_type,
+            index_t n,
+            Node &res)
+{
+    // two domains per rank, so every domain has an adjset even on one rank
+    const index_t ndoms_x = 2 * relay::mpi::size(MPI_COMM_WORLD);
+
+    index_t npts_x = n;
+    if(scaling == "strong")
+    {
+        npts_x = std::max((index_t)2, (n - 1) / ndoms_x + 1);
+    }
+
+    res.reset();
+    blueprint::mpi::mesh::examples::grid(mesh_type,
+                                         npts_x, n, n,
+                                         ndoms_x, 1, 1,
+                                         res,
+                                         MPI_COMM_WORLD);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+global_number_of_elements(const Node &mesh)
+{
+    Node n_local, n_global;
+    index_t local = 0;
+    NodeConstIterator ditr = mesh.children();
+    while(ditr.has_next())
+    {
+        local += blueprint::mesh::topology::length(ditr.next()["topologies/mesh"]);
+    }
+    n_local.set_int64(local);
+    relay::mpi::sum_all_reduce(n_local, n_global, MPI_COMM_WORLD);
+    return n_global.to_index_t();
+}
+
+//-----------------------------------------------------------------------------
+double
+max_all_ranks(double value)
+{
+    double res = value;
+    MPI_Allreduce(&value, &res, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// Runs the benchmark loop. Each iteration applies op to a copy of mesh
+// (made outside the timed region) and records the slowest rank's time.
+template <typename Op>
+void
+run_benchmark(benchmark::State &state, const Node &mesh, Op op)
+{
+    reset_peak_memory();
+    for(auto _ : state)
+    {
+        Node work(mesh);
+        MPI_Barrier(MPI_COMM_WORLD);
+        const double start = MPI_Wtime();
+        op(work);
+        const double elapsed = MPI_Wtime() - start;
+        state.SetIterationTime(max_all_ranks(elapsed));
+    }
+
+    state.SetItemsProcessed(state.iterations() * global_number_of_elements(mesh));
+    state.counters["ranks"] = relay::mpi::size(MPI_COMM_WORLD);
+    state.counters["peak_memory_bytes"] = max_all_ranks(peak_memory_bytes());
+}
+
+//-----------------------------------------------------------------------------
+// Registers a benchmark for strong and weak scaling.
+#define BLUEPRINT_MPI_BENCHMARK(func, name, ...)                              \
+    BENCHMARK_CAPTURE(func, name##_strong, std::string("strong"), __VA_ARGS__) \
+        ->Apply(size_args)->UseManualTime();                                   \
+    BENCHMARK_CAPTURE(func, name##_weak, std::string("weak"), __VA_ARGS__)     \
+        ->Apply(size_args)->UseManualTime()
+
+//-----------------------------------------------------------------------------
+// -- verify --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_mpi_verify(benchmark::State &state,
+              const std::string &scaling,
+              const std::string &mesh_type)
+{
+    Node mesh;
+    create_grid(scaling, mesh_type, state.range(0), mesh);
+
+    run_benchmark(state, mesh, [](Node &work)
+    {
+        Node info;
+        bool ok = blueprint::mpi::mesh::verify(work, info, MPI_COMM_WORLD);
+        benchmark::DoNotOptimize(ok);
+    });
+}
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_verify, hexs, std::string("hexs"));
+
+//-----------------------------------------------------------------------------
+// -- derived topologies --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_mpi_generate(benchmark::State &state,
+                const std::string &scaling,
+                const std::string &entity)
+{
+    namespace mpi_mesh = blueprint::mpi::mesh;
+
+    Node mesh;
+    create_grid(scaling, "hexs", state.range(0), mesh);
+
+    run_benchmark(state, mesh, [&entity](Node &work)
+    {
+        Node s2d, d2s;
+        if(entity == "points")
+        {
+            mpi_mesh::generate_points(work, "mesh_adj", "ent_adj", "ent",
+                                      s2d, d2s, MPI_COMM_WORLD);
+        }
+        else if(entity == "lines")
+        {
+            mpi_mesh::generate_lines(work, "mesh_adj", "ent_adj", "ent",
+                                     s2d, d2s, MPI_COMM_WORLD);
+        }
+        else if(entity == "faces")
+        {
+            mpi_mesh::generate_faces(work, "mesh_adj", "ent_adj", "ent",
+                                     s2d, d2s, MPI_COMM_WORLD);
+        }
+        else if(entity == "centroids")
+        {
+            mpi_mesh::generate_centroids(work, "mesh_adj", "ent_adj", "ent",
+                                         "ent_coords", s2d, d2s,
+                                         MPI_COMM_WORLD);
+        }
+        else if(entity == "sides")
+        {
+            mpi_mesh::generate_sides(work, "mesh_adj", "ent_adj", "ent",
+                                     "ent_coords", s2d, d2s,
+                                     MPI_COMM_WORLD);
+        }
+        else if(entity == "corners")
+        {
+            mpi_mesh::generate_corners(work, "mesh_adj", "ent_adj", "ent",
+                                       "ent_coords", s2d, d2s,
+                                       MPI_COMM_WORLD);
+        }
+        benchmark::DoNotOptimize(work.data_ptr());
+    });
+}
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_generate, points, std::string("points"));
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_generate, lines, std::string("lines"));
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_generate, faces, std::string("faces"));
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_generate, centroids, std::string("centroids"));
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_generate, sides, std::string("sides"));
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_generate, corners, std::string("corners"));
+
+//-----------------------------------------------------------------------------
+// -- partition, point merge and flatten --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_mpi_partition(benchmark::State &state,
+                 const std::string &scaling,
+                 index_t domains_per_rank)
+{
+    Node mesh;
+    create_grid(scaling, "hexs", state.range(0), mesh);
+    // partition only accepts pairwise adjsets, the shared points are merged
+    // by coordinate instead
+    NodeIterator ditr = mesh.children();
+    while(ditr.has_next())
+    {
+        ditr.next().remove("adjsets");
+    }
+
+    Node opts;
+    opts["target"] = (domains_per_rank > 0) ?
+        domains_per_rank * relay::mpi::size(MPI_COMM_WORLD) : 1;
+
+    run_benchmark(state, mesh, [&opts](Node &work)
+    {
+        Node res;
+        blueprint::mpi::mesh::partition(work, opts, res, MPI_COMM_WORLD);
+        benchmark::DoNotOptimize(res.data_ptr());
+    });
+}
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_partition, split, 4);
+// combining all domains into one merges the points they share
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_partition, point_merge, 0);
+
+//-----------------------------------------------------------------------------
+static void
+BM_mpi_flatten(benchmark::State &state,
+               const std::string &scaling,
+               const std::string &mesh_type)
+{
+    Node mesh;
+    create_grid(scaling, mesh_type, state.range(0), mesh);
+
+    run_benchmark(state, mesh, [](Node &work)
+    {
+        Node opts, res;
+        blueprint::mpi::mesh::flatten(work, opts, res, MPI_COMM_WORLD);
+        benchmark::DoNotOptimize(res.data_ptr());
+    });
+}
+BLUEPRINT_MPI_BENCHMARK(BM_mpi_flatten, hexs, std::string("hexs"));
+
+//-----------------------------------------------------------------------------
+// -- main --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Reporter for the non-root ranks, which run the benchmarks in lockstep
+// with rank 0 but don't report.
+class NullReporter : public benchmark::BenchmarkReporter
+{
+public:
+    virtual bool ReportContext(const Context &) { return true; }
+    virtual void ReportRuns(const std::vector<Run> &) {}
+};
+
+//-----------------------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    const int rank = relay::mpi::rank(MPI_COMM_WORLD);
+
+    // only rank 0 writes the output file
+    std::vector<char *> args;
+    for(int i = 0; i < argc; i++)
+    {
+        if(rank != 0 && std::strncmp(argv[i], "--benchmark_out", 15) == 0)
+        {
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+    int nargs = (int) args.size();
+
+    benchmark::Initialize(&nargs, args.data());
+    if(rank == 0)
+    {
+        benchmark::RunSpecifiedBenchmarks();
+    }
+    else
+    {
+        NullReporter reporter;
+        benchmark::RunSpecifiedBenchmarks(&reporter);
+    }
+    benchmark::Shutdown();
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,817 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_benchmarks.cpp
+///
+//-----------------------------------------------------------------------------
+///
+/// Google Benchmark based micro-benchmarks for core conduit operations.
+///
+/// Tree shapes used by these benchmarks:
+///   wide: a single object with N float64 leaves
+///   deep: a chain of N nested objects ending in a float64 leaf
+///   mesh: N domains, each with coordset and field arrays of
+///         len elements (float64)
+///
+/// Run with --benchmark_out=<file> --benchmark_out_format=json to create
+/// machine readable results (the run_conduit_benchmarks target does this).
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- tree creation helpers --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+std::string
+leaf_name(index_t idx)
+{
+    std::ostringstream oss;
+    oss << "c" << idx;
+    return oss.str();
+}
+
+//-----------------------------------------------------------------------------
+void
+create_wide_tree(index_t num_children, Node &res)
+{
+    res.reset();
+    for(index_t i = 0; i < num_children; i++)
+    {
+        res[leaf_name(i)] = (float64) i;
+    }
+}
+
+//-----------------------------------------------------------------------------
+std::string
+deep_path(index_t depth)
+{
+    std::string res;
+    for(index_t i = 0; i < depth; i++)
+    {
+        if(i > 0)
+        {
+            res += "/";
+        }
+        res += leaf_name(i);
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+create_deep_tree(index_t depth, Node &res)
+{
+    res.reset();
+    res[deep_path(depth)] = (float64) depth;
+}
+
+//-----------------------------------------------------------------------------
+void
+create_mesh_tree(index_t num_domains, index_t len, Node &res)
+{
+    const char *fields[] = {"pressure", "density", "energy", "velocity"};
+    res.reset();
+    for(index_t d = 0; d < num_domains; d++)
+    {
+        Node &dom = res.append();
+        dom["coordsets/coords/type"] = "explicit";
+        dom["coordsets/coords/values/x"].set(DataType::float64(len));
+        dom["coordsets/coords/values/y"].set(DataType::float64(len));
+        dom["coordsets/coords/values/z"].set(DataType::float64(len));
+        for(index_t f = 0; f < 4; f++)
+        {
+            Node &fld = dom["fields"][fields[f]];
+            fld["association"] = "vertex";
+            fld["topology"] = "mesh";
+            fld["values"].set(DataType::float64(len));
+            float64_array vals = fld["values"].value();
+            for(index_t i = 0; i < len; i++)
+            {
+                vals[i] = (float64)(i + f);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- fetch --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_fetch_wide(benchmark::State &state)
+{
+    index_t num_children = state.range(0);
+    Node n;
+    create_wide_tree(num_children, n);
+    std::vector<std::string> names;
+    for(index_t i = 0; i < num_children; i++)
+    {
+        names.push_back(leaf_name(i));
+    }
+
+    size_t idx = 0;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(&n.fetch_existing(names[idx]));
+        idx = (idx + 1) % names.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_fetch_wide)->RangeMultiplier(8)->Range(8, 32768);
+
+//-----------------------------------------------------------------------------
+static void
+BM_fetch_deep(benchmark::State &state)
+{
+    index_t depth = state.range(0);
+    Node n;
+    create_deep_tree(depth, n);
+    std::string path = deep_path(depth);
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(&n.fetch_existing(path));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_fetch_deep)->RangeMultiplier(4)->Range(4, 256);
+
+//-----------------------------------------------------------------------------
+static void
+BM_fetch_deep_path_object(benchmark::State &state)
+{
+    index_t depth = state.range(0);
+    Node n;
+    create_deep_tree(depth, n);
+    Path path(deep_path(depth));
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(&n.fetch_existing(path));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_fetch_deep_path_object)->RangeMultiplier(4)->Range(4, 256);
+
+//-----------------------------------------------------------------------------
+// -- set_path and set_external --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_set_path_wide(benchmark::State &state)
+{
+    index_t num_children = state.range(0);
+    std::vector<std::string> paths;
+    for(index_t i = 0; i < num_children; i++)
+    {
+        paths.push_back("a/b/" + leaf_name(i));
+    }
+
+    for(auto _ : state)
+    {
+        Node n;
+        for(index_t i = 0; i < num_children; i++)
+        {
+            n.set_path(paths[(size_t)i], (float64) i);
+        }
+        benchmark::DoNotOptimize(n.number_of_children());
+    }
+    state.SetItemsProcessed(state.iterations() * num_children);
+}
+BENCHMARK(BM_set_path_wide)->RangeMultiplier(8)->Range(8, 4096);
+
+//-----------------------------------------------------------------------------
+static void
+BM_set_external_mesh(benchmark::State &state)
+{
+    index_t num_domains = state.range(0);
+    index_t len = state.range(1);
+    Node n_src;
+    create_mesh_tree(num_domains, len, n_src);
+
+    for(auto _ : state)
+    {
+        Node n;
+        n.set_external(n_src);
+        benchmark::DoNotOptimize(n.number_of_children());
+    }
+    state.SetItemsProcessed(state.iterations() * num_domains);
+}
+BENCHMARK(BM_set_external_mesh)->Args({1, 1000})->Args({64, 1000})
+                               ->Args({512, 100});
+
+//-----------------------------------------------------------------------------
+// -- compact_to, update, serialize --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_compact_to_mesh(benchmark::State &state)
+{
+    index_t num_domains = state.range(0);
+    index_t len = state.range(1);
+    Node n_src;
+    create_mesh_tree(num_domains, len, n_src);
+
+    for(auto _ : state)
+    {
+        Node n;
+        n_src.compact_to(n);
+        benchmark::DoNotOptimize(n.data_ptr());
+    }
+    state.SetBytesProcessed(state.iterations() * n_src.total_bytes_compact());
+}
+BENCHMARK(BM_compact_to_mesh)->Args({1, 1000000})->Args({64, 1000})
+                             ->Args({512, 100});
+
+//-----------------------------------------------------------------------------
+static void
+BM_compact_to_wide(benchmark::State &state)
+{
+    Node n_src;
+    create_wide_tree(state.range(0), n_src);
+
+    for(auto _ : state)
+    {
+        Node n;
+        n_src.compact_to(n);
+        benchmark::DoNotOptimize(n.data_ptr());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_compact_to_wide)->RangeMultiplier(8)->Range(8, 32768);
+
+//-----------------------------------------------------------------------------
+static void
+BM_update_mesh(benchmark::State &state)
+{
+    index_t num_domains = state.range(0);
+    index_t len = state.range(1);
+    Node n_src;
+    create_mesh_tree(num_domains, len, n_src);
+    Node n_dest;
+    n_dest.set(n_src);
+
+    for(auto _ : state)
+    {
+        n_dest.update(n_src);
+    }
+    state.SetBytesProcessed(state.iterations() * n_src.total_bytes_compact());
+}
+BENCHMARK(BM_update_mesh)->Args({1, 1000000})->Args({64, 1000})
+                         ->Args({512, 100});
+
+//-----------------------------------------------------------------------------
+static void
+BM_serialize_mesh(benchmark::State &state)
+{
+    index_t num_domains = state.range(0);
+    index_t len = state.range(1);
+    Node n_src;
+    create_mesh_tree(num_domains, len, n_src);
+
+    std::vector<uint8> data;
+    for(auto _ : state)
+    {
+        n_src.serialize(data);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n_src.total_bytes_compact());
+}
+BENCHMARK(BM_serialize_mesh)->Args({1, 1000000})->Args({64, 1000})
+                            ->Args({512, 100});
+
+//-----------------------------------------------------------------------------
+// -- to_json, to_yaml, and generator parsing --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_to_json_mesh(benchmark::State &state)
+{
+    Node n_src;
+    create_mesh_tree(state.range(0), state.range(1), n_src);
+
+    size_t nbytes = 0;
+    for(auto _ : state)
+    {
+        std::string json = n_src.to_json();
+        nbytes = json.size();
+        benchmark::DoNotOptimize(json.data());
+    }
+    state.SetBytesProcessed(state.iterations() * nbytes);
+}
+BENCHMARK(BM_to_json_mesh)->Args({1, 100000})->Args({64, 100});
+
+//-----------------------------------------------------------------------------
+static void
+BM_to_yaml_mesh(benchmark::State &state)
+{
+    Node n_src;
+    create_mesh_tree(state.range(0), state.range(1), n_src);
+
+    size_t nbytes = 0;
+    for(auto _ : state)
+    {
+        std::string yaml = n_src.to_yaml();
+        nbytes = yaml.size();
+        benchmark::DoNotOptimize(yaml.data());
+    }
+    state.SetBytesProcessed(state.iterations() * nbytes);
+}
+BENCHMARK(BM_to_yaml_mesh)->Args({1, 100000})->Args({64, 100});
+
+//-----------------------------------------------------------------------------
+static void
+BM_generator_parse(benchmark::State &state, const std::string &protocol)
+{
+    Node n_src;
+    create_mesh_tree(state.range(0), state.range(1), n_src);
+    std::string text;
+    if(protocol == "yaml")
+    {
+        text = n_src.to_yaml();
+    }
+    else
+    {
+        text = n_src.to_json(protocol);
+    }
+
+    for(auto _ : state)
+    {
+        Generator g(text, protocol);
+        Node n;
+        g.walk(n);
+        benchmark::DoNotOptimize(n.number_of_children());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK_CAPTURE(BM_generator_parse, json, std::string("json"))
+    ->Args({1, 100000})->Args({64, 100});
+BENCHMARK_CAPTURE(BM_generator_parse, conduit_json, std::string("conduit_json"))
+    ->Args({1, 100000})->Args({64, 100});
+BENCHMARK_CAPTURE(BM_generator_parse, yaml, std::string("yaml"))
+    ->Args({1, 100000})->Args({64, 100});
+
+//-----------------------------------------------------------------------------
+static void
+BM_generator_parse_many(benchmark::State &state)
+{
+    Node n_src;
+    create_mesh_tree(1, 1000, n_src);
+    std::vector<std::string> texts((size_t)state.range(0),
+                                   n_src.to_json("conduit_json"));
+
+    for(auto _ : state)
+    {
+        Node n;
+        Generator::parse_many(texts, "conduit_json", n, state.range(1));
+        benchmark::DoNotOptimize(n.number_of_children());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_generator_parse_many)->Args({256, 1})->Args({256, 0})
+    ->UseRealTime();
+
+//-----------------------------------------------------------------------------
+// -- allocators --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_rebuild_mesh_allocator(benchmark::State &state, const std::string &alloc)
+{
+    index_t allocator_id = 0;
+    if(alloc == "pool")
+    {
+        allocator_id = utils::pool_allocator_id(false);
+    }
+    else if(alloc == "pool_thread_cache")
+    {
+        allocator_id = utils::pool_allocator_id(true);
+    }
+
+    Node n_src;
+    create_mesh_tree(state.range(0), state.range(1), n_src);
+
+    for(auto _ : state)
+    {
+        Node n;
+        n.set_allocator(allocator_id);
+        n.set(n_src);
+        benchmark::DoNotOptimize(n.data_ptr());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_rebuild_mesh_allocator, default, std::string("default"))
+    ->Args({64, 1000})->Args({1024, 16});
+BENCHMARK_CAPTURE(BM_rebuild_mesh_allocator, pool, std::string("pool"))
+    ->Args({64, 1000})->Args({1024, 16});
+BENCHMARK_CAPTURE(BM_rebuild_mesh_allocator, pool_thread_cache,
+                  std::string("pool_thread_cache"))
+    ->Args({64, 1000})->Args({1024, 16});
+
+//-----------------------------------------------------------------------------
+// -- mmap --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_mmap_fetch_three(benchmark::State &state, const std::string &lazy)
+{
+    Node n_src;
+    create_mesh_tree(state.range(0), 16, n_src);
+    std::string fname = "tout_bench_mmap_fetch_three.conduit_pack";
+    n_src.save(fname);
+
+    Node opts;
+    opts["lazy"] = lazy;
+
+    for(auto _ : state)
+    {
+        Node n;
+        n.mmap(fname, opts);
+        benchmark::DoNotOptimize(n[0]["fields/pressure/values"].to_float64());
+        benchmark::DoNotOptimize(n[1]["fields/density/values"].to_float64());
+        benchmark::DoNotOptimize(n[2]["fields/energy/values"].to_float64());
+    }
+}
+BENCHMARK_CAPTURE(BM_mmap_fetch_three, eager, std::string("false"))
+    ->Arg(1000);
+BENCHMARK_CAPTURE(BM_mmap_fetch_three, lazy, std::string("true"))
+    ->Arg(1000);
+
+//-----------------------------------------------------------------------------
+// -- data array reductions --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_data_array_reduce(benchmark::State &state, const std::string &op)
+{
+    index_t num_eles = state.range(0);
+    index_t stride = state.range(1);
+    Node n;
+    n.set(DataType::float64(num_eles * stride));
+    float64_array all_vals = n.value();
+    for(index_t i = 0; i < num_eles * stride; i++)
+    {
+        all_vals[i] = (float64)(i % 1024);
+    }
+
+    float64_array vals(n.data_ptr(),
+                       DataType::float64(num_eles,
+                                         0,
+                                         stride * sizeof(float64)));
+
+    for(auto _ : state)
+    {
+        if(op == "sum")
+        {
+            benchmark::DoNotOptimize(vals.sum());
+        }
+        else if(op == "min_max")
+        {
+            float64 min_val, max_val;
+            vals.min_max(min_val, max_val);
+            benchmark::DoNotOptimize(min_val);
+            benchmark::DoNotOptimize(max_val);
+        }
+        else
+        {
+            benchmark::DoNotOptimize(vals.mean());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * num_eles);
+}
+BENCHMARK_CAPTURE(BM_data_array_reduce, sum, std::string("sum"))
+    ->Args({1000, 1})->Args({1000000, 1})->Args({1000000, 3});
+BENCHMARK_CAPTURE(BM_data_array_reduce, min_max, std::string("min_max"))
+    ->Args({1000, 1})->Args({1000000, 1})->Args({1000000, 3});
+BENCHMARK_CAPTURE(BM_data_array_reduce, mean, std::string("mean"))
+    ->Args({1000000, 1});
+
+//-----------------------------------------------------------------------------
+// -- typed views --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// user style loop (axpy) over a compact leaf through different access paths
+static void
+BM_user_loop_axpy(benchmark::State &state, const std::string &view)
+{
+    index_t num_eles = state.range(0);
+    Node n;
+    n["x"].set(DataType::float64(num_eles));
+    n["y"].set(DataType::float64(num_eles));
+    float64 a = 2.0;
+
+    for(auto _ : state)
+    {
+        if(view == "data_array")
+        {
+            float64_array x = n["x"].value();
+            float64_array y = n["y"].value();
+            for(index_t i = 0; i < num_eles; i++)
+            {
+                y[i] = a * x[i] + y[i];
+            }
+        }
+        else if(view == "span")
+        {
+            Span<float64> x = n["x"].as_span<float64>();
+            Span<float64> y = n["y"].as_span<float64>();
+            for(index_t i = 0; i < num_eles; i++)
+            {
+                y[i] = a * x[i] + y[i];
+            }
+        }
+        else
+        {
+            CompactView<float64> x = n["x"].as_strided_view<float64,sizeof(float64)>();
+            CompactView<float64> y = n["y"].as_strided_view<float64,sizeof(float64)>();
+            for(index_t i = 0; i < num_eles; i++)
+            {
+                y[i] = a * x[i] + y[i];
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * num_eles);
+}
+BENCHMARK_CAPTURE(BM_user_loop_axpy, data_array, std::string("data_array"))
+    ->Arg(1000000);
+BENCHMARK_CAPTURE(BM_user_loop_axpy, span, std::string("span"))
+    ->Arg(1000000);
+BENCHMARK_CAPTURE(BM_user_loop_axpy, compact_view, std::string("compact_view"))
+    ->Arg(1000000);
+
+//-----------------------------------------------------------------------------
+// -- base64 --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_base64_encode(benchmark::State &state)
+{
+    index_t nbytes = state.range(0);
+    std::vector<uint8> src((size_t)nbytes);
+    for(index_t i = 0; i < nbytes; i++)
+    {
+        src[(size_t)i] = (uint8)(i % 251);
+    }
+    std::vector<char> dest((size_t)utils::base64_encode_buffer_size(nbytes));
+
+    for(auto _ : state)
+    {
+        utils::base64_encode(&src[0], nbytes, &dest[0]);
+        benchmark::DoNotOptimize(dest.data());
+    }
+    state.SetBytesProcessed(state.iterations() * nbytes);
+}
+BENCHMARK(BM_base64_encode)->RangeMultiplier(32)->Range(1024, 1 << 25);
+
+//-----------------------------------------------------------------------------
+static void
+BM_base64_decode(benchmark::State &state)
+{
+    index_t nbytes = state.range(0);
+    std::vector<uint8> src((size_t)nbytes);
+    for(index_t i = 0; i < nbytes; i++)
+    {
+        src[(size_t)i] = (uint8)(i % 251);
+    }
+    index_t enc_size = utils::base64_encode_buffer_size(nbytes);
+    std::vector<char> enc((size_t)enc_size);
+    utils::base64_encode(&src[0], nbytes, &enc[0]);
+    index_t enc_len = (index_t)strlen(&enc[0]);
+    std::vector<uint8> dest((size_t)utils::base64_decode_buffer_size(enc_len));
+
+    for(auto _ : state)
+    {
+        utils::base64_decode(&enc[0], enc_len, &dest[0]);
+        benchmark::DoNotOptimize(dest.data());
+    }
+    state.SetBytesProcessed(state.iterations() * enc_len);
+}
+BENCHMARK(BM_base64_decode)->RangeMultiplier(32)->Range(1024, 1 << 25);
+
+//-----------------------------------------------------------------------------
+// -- endian swap --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_endian_swap(benchmark::State &state, const DataType &leaf_dtype)
+{
+    index_t num_leaves = state.range(0);
+    index_t num_eles   = state.range(1);
+    Node n;
+    for(index_t i = 0; i < num_leaves; i++)
+    {
+        DataType dt(leaf_dtype.id(), num_eles);
+        n.append().set(dt);
+    }
+
+    for(auto _ : state)
+    {
+        // alternate so every iteration does a full swap
+        n.endian_swap_to_big();
+        n.endian_swap_to_little();
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * num_leaves *
+                            num_eles * leaf_dtype.element_bytes());
+}
+BENCHMARK_CAPTURE(BM_endian_swap, float32, DataType::float32())
+    ->Args({1, 1 << 22})->Args({4096, 1024});
+BENCHMARK_CAPTURE(BM_endian_swap, float64, DataType::float64())
+    ->Args({1, 1 << 22})->Args({4096, 1024});
+BENCHMARK_CAPTURE(BM_endian_swap, int16, DataType::int16())
+    ->Args({1, 1 << 22});
+
+//-----------------------------------------------------------------------------
+static void
+BM_node_hash(benchmark::State &state)
+{
+    index_t num_leaves  = state.range(0);
+    index_t num_eles    = state.range(1);
+    index_t num_threads = state.range(2);
+    Node n;
+    for(index_t i = 0; i < num_leaves; i++)
+    {
+        n.append().set(DataType::float64(num_eles));
+    }
+
+    Node opts;
+    opts["num_threads"] = num_threads;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(n.hash(opts));
+    }
+    state.SetBytesProcessed(state.iterations() * num_leaves *
+                            num_eles * (index_t)sizeof(float64));
+}
+BENCHMARK(BM_node_hash)
+    ->Args({1, 1 << 22, 1})->Args({1, 1 << 22, 0})->Args({4096, 1024, 1});
+
+//-----------------------------------------------------------------------------
+static void
+BM_node_diff(benchmark::State &state, bool boolean_mode)
+{
+    index_t num_leaves = state.range(0);
+    index_t num_eles   = state.range(1);
+    Node n;
+    for(index_t i = 0; i < num_leaves; i++)
+    {
+        n.append().set(DataType::float64(num_eles));
+    }
+    Node o(n);
+
+    Node info;
+    for(auto _ : state)
+    {
+        if(boolean_mode)
+        {
+            benchmark::DoNotOptimize(n.has_diff(o));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(n.diff(o,info));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * num_leaves *
+                            num_eles * (index_t)sizeof(float64));
+}
+BENCHMARK_CAPTURE(BM_node_diff, info, false)
+    ->Args({1, 1 << 22})->Args({4096, 1024});
+BENCHMARK_CAPTURE(BM_node_diff, has_diff, true)
+    ->Args({1, 1 << 22})->Args({4096, 1024});
+
+//-----------------------------------------------------------------------------
+static void
+BM_node_republish_external(benchmark::State &state, bool use_layout)
+{
+    index_t num_leaves = state.range(0);
+    std::vector<std::string> paths;
+    std::vector< std::vector<float64> > vals(num_leaves,
+                                            std::vector<float64>(16, 1.0));
+    for(index_t i = 0; i < num_leaves; i++)
+    {
+        std::ostringstream oss;
+        oss << "fields/f" << i << "/values";
+        paths.push_back(oss.str());
+    }
+
+    Node n;
+    for(index_t i = 0; i < num_leaves; i++)
+    {
+        n.set_path_external(paths[i], vals[i]);
+    }
+
+    ExternalLayout layout = n.bind_external_layout();
+    std::vector<void*> ptrs(num_leaves);
+    for(index_t i = 0; i < num_leaves; i++)
+    {
+        ptrs[i] = vals[i].data();
+    }
+
+    for(auto _ : state)
+    {
+        if(use_layout)
+        {
+            layout.rebind(ptrs);
+        }
+        else
+        {
+            for(index_t i = 0; i < num_leaves; i++)
+            {
+                n.set_path_external(paths[i], vals[i]);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * num_leaves);
+}
+BENCHMARK_CAPTURE(BM_node_republish_external, set_path_external, false)
+    ->Arg(16)->Arg(1024);
+BENCHMARK_CAPTURE(BM_node_republish_external, rebind, true)
+    ->Arg(16)->Arg(1024);
+
+//-----------------------------------------------------------------------------
+static void
+BM_node_leaf_spans(benchmark::State &state, bool coalesce)
+{
+    // many small leaves that describe one contiguous buffer,
+    // packed with one memcpy per span
+    index_t num_leaves = state.range(0);
+    std::vector<float64> vals(num_leaves * 8, 1.0);
+    Node n;
+    for(index_t i = 0; i < num_leaves; i++)
+    {
+        n.append().set_external(&vals[i * 8], 8);
+    }
+    std::vector<uint8> dest(vals.size() * sizeof(float64));
+
+    const Node &cn = n;
+    for(auto _ : state)
+    {
+        uint8 *dest_ptr = &dest[0];
+        NodeConstLeafIterator itr = cn.leaves(coalesce);
+        while(itr.has_next())
+        {
+            const NodeConstLeafSpan &span = itr.next();
+            memcpy(dest_ptr, span.data(), (size_t)span.number_of_bytes());
+            dest_ptr += span.number_of_bytes();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * (index_t)dest.size());
+}
+BENCHMARK_CAPTURE(BM_node_leaf_spans, per_leaf, false)->Arg(4096);
+BENCHMARK_CAPTURE(BM_node_leaf_spans, coalesced, true)->Arg(4096);
+
+//-----------------------------------------------------------------------------
+static void
+BM_node_to_data_type(benchmark::State &state,
+                     index_t src_id,
+                     index_t dst_id)
+{
+    index_t num_eles = state.range(0);
+    Node n;
+    n.set(DataType(src_id, num_eles));
+    memset(n.data_ptr(), 0, (size_t)n.total_bytes_allocated());
+
+    Node res;
+    for(auto _ : state)
+    {
+        n.to_data_type(dst_id, res);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * num_eles);
+}
+BENCHMARK_CAPTURE(BM_node_to_data_type, int32_to_int64,
+                  DataType::INT32_ID, DataType::INT64_ID)
+    ->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK_CAPTURE(BM_node_to_data_type, float32_to_float64,
+                  DataType::FLOAT32_ID, DataType::FLOAT64_ID)
+    ->Arg(1 << 16)->Arg(1 << 22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,702 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: relay_io_benchmarks.cpp
+///
+//-----------------------------------------------------------------------------
+///
+/// Google Benchmark based throughput benchmarks for relay i/o.
+///
+/// Blueprint meshes are written and read with
+/// relay::io::blueprint::write_mesh / read_mesh, and single domains with
+/// relay::io::IOHandle (and relay::io::save / load for adios). Each domain
+/// is examples::braid("hexs", n, n, n). The sweeps come from the
+/// environment, so the same binaries can be run on different file systems
+/// without rebuilding:
+///   RELAY_IO_BENCHMARK_SIZES    points per axis        (default "16,32")
+///   RELAY_IO_BENCHMARK_DOMAINS  domains (per rank)     (default "1,8")
+///   RELAY_IO_BENCHMARK_FILES    number_of_files for
+///                               "multi_file", <= 0 is
+///                               one file per domain    (default "0,2")
+///   RELAY_IO_BENCHMARK_DIR      output directory       (default
+///                               "relay_io_benchmarks_out")
+///   RELAY_IO_BENCHMARK_SIDRE_ROOT  an existing sidre_hdf5 root file to
+///                               read (relay can't write sidre_hdf5)
+///
+/// Benchmarks are named by operation, protocol and file style, with args
+/// {n, domains, files, compress}. compress=1 writes hdf5 with gzip chunk
+/// compression (through hdf5_set_options).
+///
+/// Counters:
+///   bytes_per_second   node data bytes written or read per second
+///   MB_per_second      the same in MB (1e6 bytes)
+///   metadata_ops       relay i/o metadata operations per iteration (hdf5
+///                      file opens/closes, compatibility checks, dataset
+///                      creates and info reads), from relay::io::stats
+///   file_ops           whole file saves and loads per iteration
+///   peak_memory_bytes  peak resident memory (largest of any rank)
+///
+/// When built with CONDUIT_RELAY_IO_MPI_ENABLED (the relay_io_mpi_benchmarks
+/// target) the same benchmarks run weak scaling: every rank writes and
+/// reads its own domains through relay::mpi::io, iterations are timed
+/// between barriers, and the slowest rank's time and the global bytes are
+/// reported. Only rank 0 writes reports.
+///
+/// Run with --benchmark_out=<file> --benchmark_out_format=json to create
+/// machine readable results (the run_relay_io_benchmarks target does this).
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+#include "conduit_relay.hpp"
+#include "conduit_relay_io_stats.hpp"
+
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+#include "conduit_relay_io_hdf5.hpp"
+#endif
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+#include "conduit_relay_mpi.hpp"
+#include "conduit_relay_mpi_io.hpp"
+#include "conduit_relay_mpi_io_blueprint.hpp"
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+#include "conduit_relay_mpi_io_hdf5.hpp"
+#endif
+#include <mpi.h>
+#endif
+
+#include "blueprint_benchmark_utils.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- parallel helpers --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+int
+benchmark_rank()
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    return relay::mpi::rank(MPI_COMM_WORLD);
+#else
+    return 0;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+int
+benchmark_size()
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    return relay::mpi::size(MPI_COMM_WORLD);
+#else
+    return 1;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+double
+max_all_ranks(double value)
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    double res = value;
+    MPI_Allreduce(&value, &res, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return res;
+#else
+    return value;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+double
+sum_all_ranks(double value)
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    double res = value;
+    MPI_Allreduce(&value, &res, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    return res;
+#else
+    return value;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Times op, returns the slowest rank's seconds.
+template <typename Op>
+double
+timed(Op op)
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double start = MPI_Wtime();
+    op();
+    return max_all_ranks(MPI_Wtime() - start);
+#else
+    utils::Timer timer;
+    op();
+    return timer.elapsed();
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// -- benchmark arguments --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+std::string
+output_dir()
+{
+    const char *env = std::getenv("RELAY_IO_BENCHMARK_DIR");
+    std::string res = (env != NULL && env[0] != '\0') ?
+                      env : "relay_io_benchmarks_out";
+    if(benchmark_rank() == 0 && !utils::is_directory(res))
+    {
+        utils::create_directory(res);
+    }
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// Registers {n, domains, files, compress} args. Only "multi_file" sweeps
+// the number of files, only hdf5 sweeps compression.
+void
+register_args(benchmark::internal::Benchmark *b,
+              bool sweep_files,
+              bool sweep_compress)
+{
+    b->ArgNames({"n", "domains", "files", "compress"});
+    std::vector<int64_t> sizes = env_int_list("RELAY_IO_BENCHMARK_SIZES", "16,32");
+    std::vector<int64_t> doms  = env_int_list("RELAY_IO_BENCHMARK_DOMAINS", "1,8");
+    std::vector<int64_t> files = sweep_files ?
+        env_int_list("RELAY_IO_BENCHMARK_FILES", "0,2") :
+        std::vector<int64_t>(1, 0);
+    std::vector<int64_t> compress(1, 0);
+#ifdef CONDUIT_RELAY_IO_HDF5_ZLIB_ENABLED
+    if(sweep_compress)
+    {
+        compress.push_back(1);
+    }
+#else
+    (void) sweep_compress;
+#endif
+
+    for(size_t si = 0; si < sizes.size(); si++)
+    {
+        for(size_t di = 0; di < doms.size(); di++)
+        {
+            for(size_t fi = 0; fi < files.size(); fi++)
+            {
+                for(size_t ci = 0; ci < compress.size(); ci++)
+                {
+                    b->Args({sizes[si], doms[di], files[fi], compress[ci]});
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+root_only_args(benchmark::internal::Benchmark *b)
+{
+    register_args(b, false, false);
+}
+
+//-----------------------------------------------------------------------------
+void
+multi_file_args(benchmark::internal::Benchmark *b)
+{
+    register_args(b, true, false);
+}
+
+//-----------------------------------------------------------------------------
+void
+hdf5_root_only_args(benchmark::internal::Benchmark *b)
+{
+    register_args(b, false, true);
+}
+
+//-----------------------------------------------------------------------------
+void
+hdf5_multi_file_args(benchmark::internal::Benchmark *b)
+{
+    register_args(b, true, true);
+}
+
+//-----------------------------------------------------------------------------
+// Registers {n} args, with domains = 1, files = 0, compress = 0.
+void
+handle_args(benchmark::internal::Benchmark *b)
+{
+    b->ArgNames({"n", "domains", "files", "compress"});
+    std::vector<int64_t> sizes = env_int_list("RELAY_IO_BENCHMARK_SIZES", "16,32");
+    for(size_t si = 0; si < sizes.size(); si++)
+    {
+        b->Args({sizes[si], 1, 0, 0});
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- mesh and option helpers --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// This rank's domains, numbered globally.
+void
+create_mesh(index_t n, index_t ndomains, Node &res)
+{
+    res.reset();
+    const index_t rank = benchmark_rank();
+    for(index_t d = 0; d < ndomains; d++)
+    {
+        Node &dom = res.append();
+        blueprint::mesh::examples::braid("hexs", n, n, n, dom);
+        dom["state/domain_id"] = rank * ndomains + d;
+        dom["state/cycle"] = 0;
+    }
+}
+
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+// write_mesh uses the hdf5 options of the relay library it belongs to
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+namespace mesh_io = conduit::relay::mpi::io;
+#else
+namespace mesh_io = conduit::relay::io;
+#endif
+#endif
+
+//-----------------------------------------------------------------------------
+// Sets gzip chunk compression as the default hdf5 options, restoring the
+// previous options when destroyed.
+class HDF5CompressionScope
+{
+public:
+    HDF5CompressionScope(bool compress)
+    : m_active(false)
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        if(compress)
+        {
+            mesh_io::hdf5_options(m_prev);
+            Node opts;
+            opts["chunking/enabled"] = "true";
+            opts["chunking/compression/method"] = "gzip";
+            mesh_io::hdf5_set_options(opts);
+            m_active = true;
+        }
+#else
+        (void) compress;
+#endif
+    }
+
+    ~HDF5CompressionScope()
+    {
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+        if(m_active)
+        {
+            mesh_io::hdf5_set_options(m_prev);
+        }
+#endif
+    }
+
+private:
+    bool m_active;
+    Node m_prev;
+};
+
+//-----------------------------------------------------------------------------
+// Counts relay i/o operations in the accumulated stats.
+void
+count_stats_ops(index_t &metadata_ops, index_t &file_ops)
+{
+    static const char *metadata_names[] = {"file_open",
+                                           "file_close",
+                                           "compatibility_check",
+                                           "dataset_create",
+                                           "dataset_read_info",
+                                           NULL};
+    metadata_ops = 0;
+    file_ops = 0;
+
+    Node n_stats;
+    relay::io::stats(n_stats);
+    NodeConstIterator bitr = n_stats.children();
+    while(bitr.has_next())
+    {
+        const Node &n_backend = bitr.next();
+        for(int i = 0; metadata_names[i] != NULL; i++)
+        {
+            if(n_backend.has_child(metadata_names[i]))
+            {
+                metadata_ops += n_backend[metadata_names[i]]["count"].to_index_t();
+            }
+        }
+        if(n_backend.has_child("save"))
+        {
+            file_ops += n_backend["save"]["count"].to_index_t();
+        }
+        if(n_backend.has_child("load"))
+        {
+            file_ops += n_backend["load"]["count"].to_index_t();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+begin_benchmark()
+{
+    reset_peak_memory();
+    relay::io::set_stats_enabled(true);
+    relay::io::reset_stats();
+}
+
+//-----------------------------------------------------------------------------
+// Reports the counters, bytes is this rank's bytes per iteration.
+void
+end_benchmark(benchmark::State &state, index_t bytes)
+{
+    index_t metadata_ops = 0;
+    index_t file_ops = 0;
+    count_stats_ops(metadata_ops, file_ops);
+    relay::io::set_stats_enabled(false);
+
+    const double iters = (double) std::max((int64_t)1, (int64_t)state.iterations());
+    const double global_bytes = sum_all_ranks((double) bytes);
+    state.SetBytesProcessed((int64_t)(global_bytes * state.iterations()));
+    state.counters["MB_per_second"] =
+        benchmark::Counter(global_bytes * state.iterations() / 1e6,
+                           benchmark::Counter::kIsRate);
+    state.counters["metadata_ops"] = sum_all_ranks((double) metadata_ops) / iters;
+    state.counters["file_ops"] = sum_all_ranks((double) file_ops) / iters;
+    state.counters["ranks"] = benchmark_size();
+    state.counters["peak_memory_bytes"] = max_all_ranks(peak_memory_bytes());
+}
+
+//-----------------------------------------------------------------------------
+std::string
+benchmark_path(const std::string &name,
+               const std::string &protocol,
+               const std::string &file_style,
+               benchmark::State &state)
+{
+    std::ostringstream oss;
+    oss << output_dir() << "/" << name << "_" << protocol << "_" << file_style
+        << "_n" << state.range(0) << "_d" << state.range(1)
+        << "_f" << state.range(2) << "_c" << state.range(3);
+    return oss.str();
+}
+
+//-----------------------------------------------------------------------------
+void
+write_mesh_opts(const std::string &file_style,
+                benchmark::State &state,
+                Node &opts)
+{
+    opts["file_style"] = file_style;
+    opts["suffix"] = "none";
+    opts["truncate"] = "true";
+    if(file_style == "multi_file" && state.range(2) > 0)
+    {
+        opts["number_of_files"] = state.range(2);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+do_write_mesh(const Node &mesh,
+              const std::string &path,
+              const std::string &protocol,
+              const Node &opts)
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    relay::mpi::io::blueprint::write_mesh(mesh, path, protocol, opts,
+                                          MPI_COMM_WORLD);
+#else
+    relay::io::blueprint::write_mesh(mesh, path, protocol, opts);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void
+do_read_mesh(const std::string &root_path, Node &mesh)
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    relay::mpi::io::blueprint::read_mesh(root_path, mesh, MPI_COMM_WORLD);
+#else
+    relay::io::blueprint::read_mesh(root_path, mesh);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// -- blueprint write_mesh / read_mesh --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_write_mesh(benchmark::State &state,
+              const std::string &protocol,
+              const std::string &file_style)
+{
+    Node mesh;
+    create_mesh(state.range(0), state.range(1), mesh);
+    const std::string path = benchmark_path("write", protocol, file_style, state);
+    Node opts;
+    write_mesh_opts(file_style, state, opts);
+    HDF5CompressionScope compression(state.range(3) != 0);
+
+    begin_benchmark();
+    for(auto _ : state)
+    {
+        state.SetIterationTime(timed([&]()
+        {
+            do_write_mesh(mesh, path, protocol, opts);
+        }));
+    }
+    end_benchmark(state, mesh.total_bytes_compact());
+}
+
+//-----------------------------------------------------------------------------
+static void
+BM_read_mesh(benchmark::State &state,
+             const std::string &protocol,
+             const std::string &file_style)
+{
+    Node mesh;
+    create_mesh(state.range(0), state.range(1), mesh);
+    const std::string path = benchmark_path("read", protocol, file_style, state);
+    Node opts;
+    write_mesh_opts(file_style, state, opts);
+    {
+        HDF5CompressionScope compression(state.range(3) != 0);
+        do_write_mesh(mesh, path, protocol, opts);
+    }
+    const std::string root_path = path + ".root";
+
+    index_t bytes = 0;
+    begin_benchmark();
+    for(auto _ : state)
+    {
+        Node res;
+        state.SetIterationTime(timed([&]()
+        {
+            do_read_mesh(root_path, res);
+        }));
+        bytes = res.total_bytes_compact();
+    }
+    end_benchmark(state, bytes);
+}
+
+#define RELAY_IO_MESH_BENCHMARKS(op, protocol, root_args, multi_args)        \
+    BENCHMARK_CAPTURE(BM_##op##_mesh, protocol##_root_only,                   \
+                      std::string(#protocol), std::string("root_only"))       \
+        ->Apply(root_args)->UseManualTime();                                  \
+    BENCHMARK_CAPTURE(BM_##op##_mesh, protocol##_multi_file,                  \
+                      std::string(#protocol), std::string("multi_file"))      \
+        ->Apply(multi_args)->UseManualTime()
+
+// write_mesh writes the root file with the mesh protocol, and read_mesh
+// only reads json and hdf5 root files, so conduit_bin is write only
+RELAY_IO_MESH_BENCHMARKS(write, conduit_bin, root_only_args, multi_file_args);
+RELAY_IO_MESH_BENCHMARKS(write, json, root_only_args, multi_file_args);
+RELAY_IO_MESH_BENCHMARKS(read, json, root_only_args, multi_file_args);
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+RELAY_IO_MESH_BENCHMARKS(write, hdf5, hdf5_root_only_args, hdf5_multi_file_args);
+RELAY_IO_MESH_BENCHMARKS(read, hdf5, hdf5_root_only_args, hdf5_multi_file_args);
+#endif
+#ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+RELAY_IO_MESH_BENCHMARKS(write, silo, root_only_args, multi_file_args);
+RELAY_IO_MESH_BENCHMARKS(read, silo, root_only_args, multi_file_args);
+#endif
+
+//-----------------------------------------------------------------------------
+static void
+BM_read_mesh_sidre(benchmark::State &state)
+{
+    const char *root_path = std::getenv("RELAY_IO_BENCHMARK_SIDRE_ROOT");
+    if(root_path == NULL || root_path[0] == '\0')
+    {
+        state.SkipWithError("RELAY_IO_BENCHMARK_SIDRE_ROOT is not set");
+        return;
+    }
+
+    index_t bytes = 0;
+    begin_benchmark();
+    for(auto _ : state)
+    {
+        Node res;
+        state.SetIterationTime(timed([&]()
+        {
+            do_read_mesh(root_path, res);
+        }));
+        bytes = res.total_bytes_compact();
+    }
+    end_benchmark(state, bytes);
+}
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+BENCHMARK(BM_read_mesh_sidre)->UseManualTime();
+#endif
+
+//-----------------------------------------------------------------------------
+// -- IOHandle and save / load, one domain (per rank) --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_handle_write(benchmark::State &state, const std::string &protocol)
+{
+    Node mesh;
+    create_mesh(state.range(0), 1, mesh);
+    const Node &dom = mesh[0];
+    std::ostringstream oss;
+    oss << benchmark_path("handle", protocol, "file", state)
+        << "_r" << benchmark_rank() << "." << protocol;
+    const std::string path = oss.str();
+    Node open_opts;
+    open_opts["mode"] = "wt";
+
+    begin_benchmark();
+    for(auto _ : state)
+    {
+        state.SetIterationTime(timed([&]()
+        {
+            if(protocol == "adios")
+            {
+                relay::io::save(dom, path, protocol);
+            }
+            else
+            {
+                relay::io::IOHandle hnd;
+                hnd.open(path, protocol, open_opts);
+                hnd.write(dom);
+                hnd.close();
+            }
+        }));
+    }
+    end_benchmark(state, dom.total_bytes_compact());
+}
+
+//-----------------------------------------------------------------------------
+static void
+BM_handle_read(benchmark::State &state, const std::string &protocol)
+{
+    Node mesh;
+    create_mesh(state.range(0), 1, mesh);
+    const Node &dom = mesh[0];
+    std::ostringstream oss;
+    oss << benchmark_path("handle", protocol, "file", state)
+        << "_r" << benchmark_rank() << "." << protocol;
+    const std::string path = oss.str();
+    relay::io::save(dom, path, protocol);
+
+    index_t bytes = 0;
+    begin_benchmark();
+    for(auto _ : state)
+    {
+        Node res;
+        state.SetIterationTime(timed([&]()
+        {
+            if(protocol == "adios")
+            {
+                relay::io::load(path, protocol, res);
+            }
+            else
+            {
+                relay::io::IOHandle hnd;
+                hnd.open(path, protocol);
+                hnd.read(res);
+                hnd.close();
+            }
+        }));
+        bytes = res.total_bytes_compact();
+    }
+    end_benchmark(state, bytes);
+}
+
+#define RELAY_IO_HANDLE_BENCHMARKS(protocol)                                  \
+    BENCHMARK_CAPTURE(BM_handle_write, protocol, std::string(#protocol))      \
+        ->Apply(handle_args)->UseManualTime();                                \
+    BENCHMARK_CAPTURE(BM_handle_read, protocol, std::string(#protocol))       \
+        ->Apply(handle_args)->UseManualTime()
+
+RELAY_IO_HANDLE_BENCHMARKS(conduit_bin);
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+RELAY_IO_HANDLE_BENCHMARKS(hdf5);
+#endif
+#ifdef CONDUIT_RELAY_IO_ADIOS_ENABLED
+RELAY_IO_HANDLE_BENCHMARKS(adios);
+#endif
+
+//-----------------------------------------------------------------------------
+// -- main --
+//-----------------------------------------------------------------------------
+
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+//-----------------------------------------------------------------------------
+// Reporter for the non-root ranks, which run the benchmarks in lockstep
+// with rank 0 but don't report.
+class NullReporter : public benchmark::BenchmarkReporter
+{
+public:
+    virtual bool ReportContext(const Context &) { return true; }
+    virtual void ReportRuns(const std::vector<Run> &) {}
+};
+#endif
+
+//-----------------------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+#ifdef CONDUIT_RELAY_IO_MPI_ENABLED
+    MPI_Init(&argc, &argv);
+    const int rank = relay::mpi::rank(MPI_COMM_WORLD);
+
+    // only rank 0 writes the output file
+    std::vector<char *> args;
+    for(int i = 0; i < argc; i++)
+    {
+        if(rank != 0 && std::strncmp(argv[i], "--benchmark_out", 15) == 0)
+        {
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+    int nargs = (int) args.size();
+
+    benchmark::Initialize(&nargs, args.data());
+    if(rank == 0)
+    {
+        benchmark::RunSpecifiedBenchmarks();
+    }
+    else
+    {
+        NullReporter reporter;
+        benchmark::RunSpecifiedBenchmarks(&reporter);
+    }
+    benchmark::Shutdown();
+
+    MPI_Finalize();
+#else
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+#endif
+    return 0;
+}
@@ -0,0 +1,523 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: relay_mpi_benchmarks.cpp
+///
+//-----------------------------------------------------------------------------
+///
+/// Google Benchmark based latency and bandwidth benchmarks for relay::mpi,
+/// run with mpiexec.
+///
+/// Each payload is an object with `leaves` float64 arrays holding `bytes`
+/// bytes in total. With compact=0 every leaf is strided (every other
+/// float64 of a larger buffer), so relay has to describe or compact it.
+/// The sweeps come from the environment:
+///   RELAY_MPI_BENCHMARK_BYTES   payload bytes  (default "8,1024,1048576")
+///   RELAY_MPI_BENCHMARK_LEAVES  leaf counts    (default "1,16")
+///
+/// Point to point benchmarks ping-pong between rank pairs (0,1), (2,3), ...
+/// and report the one way time (half the round trip), so Time is the
+/// latency. Collectives use all ranks. Every operation has a raw MPI
+/// counterpart (BM_raw_*) moving the same compact bytes, so the difference
+/// between the two is relay's per-message overhead: schema exchange,
+/// compaction and allocation.
+///
+/// Iterations are timed with MPI_Wtime between barriers and report the
+/// slowest rank's time. Counters:
+///   bytes_per_second  payload bytes moved per second (per rank pair for
+///                     point to point)
+///   ranks             number of ranks
+///   messages          MPI messages relay issued per iteration on rank 0
+///   conduit_fraction  share of relay's time spent outside MPI (compaction,
+///                     serialization, copies) on rank 0
+///   peak_memory_bytes largest peak resident memory of any rank
+/// messages and conduit_fraction come from relay::mpi::stats, recorded in
+/// extra untimed calls after the timed loop, and are left out of the raw
+/// MPI baselines. Only rank 0 writes reports.
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_relay_mpi.hpp"
+
+#include "blueprint_benchmark_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+#include <benchmark/benchmark.h>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- payload helpers --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Registers {bytes, leaves, compact} args.
+void
+payload_args(benchmark::internal::Benchmark *b)
+{
+    b->ArgNames({"bytes", "leaves", "compact"});
+    std::vector<int64_t> bytes  = env_int_list("RELAY_MPI_BENCHMARK_BYTES",
+                                               "8,1024,1048576");
+    std::vector<int64_t> leaves = env_int_list("RELAY_MPI_BENCHMARK_LEAVES",
+                                               "1,16");
+    for(size_t bi = 0; bi < bytes.size(); bi++)
+    {
+        for(size_t li = 0; li < leaves.size(); li++)
+        {
+            b->Args({bytes[bi], leaves[li], 1});
+            b->Args({bytes[bi], leaves[li], 0});
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Registers {bytes} args for the raw MPI baselines.
+void
+raw_args(benchmark::internal::Benchmark *b)
+{
+    b->ArgNames({"bytes"});
+    std::vector<int64_t> bytes = env_int_list("RELAY_MPI_BENCHMARK_BYTES",
+                                              "8,1024,1048576");
+    for(size_t bi = 0; bi < bytes.size(); bi++)
+    {
+        b->Args({bytes[bi]});
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Creates the payload described by the benchmark args. A non-compact
+// payload is external to storage, which must outlive it.
+void
+create_payload(benchmark::State &state, Node &storage, Node &payload)
+{
+    const index_t nleaves = std::max((int64_t)1, (int64_t)state.range(1));
+    const bool compact = state.range(2) != 0;
+    const index_t nvals = std::max((index_t)1,
+                                   (index_t)(state.range(0) / (8 * nleaves)));
+
+    storage.reset();
+    payload.reset();
+    for(index_t i = 0; i < nleaves; i++)
+    {
+        std::string name = "f" + std::to_string(i);
+        if(compact)
+        {
+            payload[name].set(DataType::float64(nvals));
+            float64_array vals = payload[name].value();
+            vals.fill(1.0 + i);
+        }
+        else
+        {
+            storage[name].set(DataType::float64(2 * nvals));
+            float64_array vals = storage[name].value();
+            vals.fill(1.0 + i);
+            payload[name].set_external(DataType::float64(nvals,
+                                                         0,
+                                                         2 * sizeof(float64)),
+                                       storage[name].data_ptr());
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- timing helpers --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+int
+world_rank()
+{
+    return relay::mpi::rank(MPI_COMM_WORLD);
+}
+
+//-----------------------------------------------------------------------------
+int
+world_size()
+{
+    return relay::mpi::size(MPI_COMM_WORLD);
+}
+
+//-----------------------------------------------------------------------------
+double
+max_all_ranks(double value)
+{
+    double res = value;
+    MPI_Allreduce(&value, &res, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// This rank's ping-pong partner, or -1 for the last rank of an odd count.
+int
+partner_rank()
+{
+    const int rank = world_rank();
+    const int partner = (rank % 2 == 0) ? rank + 1 : rank - 1;
+    return partner < world_size() ? partner : -1;
+}
+
+//-----------------------------------------------------------------------------
+// Runs the benchmark loop. op is called on every rank each iteration and
+// the slowest rank's time, divided by time_divisor, is recorded. The
+// relay::mpi stats of a few extra calls give the messages and
+// conduit_fraction counters.
+template <typename Op>
+void
+run_benchmark(benchmark::State &state,
+              index_t bytes,
+              double time_divisor,
+              Op op)
+{
+    reset_peak_memory();
+    for(auto _ : state)
+    {
+        MPI_Barrier(MPI_COMM_WORLD);
+        const double start = MPI_Wtime();
+        op();
+        const double elapsed = MPI_Wtime() - start;
+        state.SetIterationTime(max_all_ranks(elapsed) / time_divisor);
+    }
+
+    const int stats_calls = 4;
+    relay::mpi::set_stats_enabled(true);
+    relay::mpi::reset_stats();
+    for(int i = 0; i < stats_calls; i++)
+    {
+        op();
+    }
+    relay::mpi::set_stats_enabled(false);
+
+    Node n_stats;
+    relay::mpi::stats(n_stats);
+    if(n_stats.has_path("total/calls") &&
+       n_stats["total/calls"].to_index_t() > 0)
+    {
+        const Node &n_total = n_stats["total"];
+        state.counters["messages"] = n_total["messages"].to_float64() /
+                                     stats_calls;
+        const float64 time = n_total["time"].to_float64();
+        state.counters["conduit_fraction"] =
+            time > 0.0 ? n_total["conduit_time"].to_float64() / time : 0.0;
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.counters["ranks"] = world_size();
+    state.counters["peak_memory_bytes"] = max_all_ranks(peak_memory_bytes());
+}
+
+//-----------------------------------------------------------------------------
+// Skips point to point benchmarks on a single rank.
+bool
+check_pairs(benchmark::State &state)
+{
+    if(world_size() < 2)
+    {
+        state.SkipWithError("point to point benchmarks need at least 2 ranks");
+        return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// -- raw MPI baselines --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_raw_send_recv(benchmark::State &state)
+{
+    if(!check_pairs(state))
+    {
+        return;
+    }
+    const int partner = partner_rank();
+    const bool ping = world_rank() % 2 == 0;
+    std::vector<char> buff(std::max((int64_t)1, (int64_t)state.range(0)));
+    const int count = (int) state.range(0);
+
+    run_benchmark(state, state.range(0), 2.0, [&]()
+    {
+        if(partner < 0)
+        {
+            return;
+        }
+        if(ping)
+        {
+            MPI_Send(buff.data(), count, MPI_BYTE, partner, 0, MPI_COMM_WORLD);
+            MPI_Recv(buff.data(), count, MPI_BYTE, partner, 0, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+        }
+        else
+        {
+            MPI_Recv(buff.data(), count, MPI_BYTE, partner, 0, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+            MPI_Send(buff.data(), count, MPI_BYTE, partner, 0, MPI_COMM_WORLD);
+        }
+    });
+}
+BENCHMARK(BM_raw_send_recv)->Apply(raw_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_raw_gather(benchmark::State &state)
+{
+    const int count = (int) state.range(0);
+    std::vector<char> buff(std::max((int64_t)1, (int64_t)state.range(0)));
+    std::vector<char> res(buff.size() * world_size());
+
+    run_benchmark(state, state.range(0) * world_size(), 1.0, [&]()
+    {
+        MPI_Gather(buff.data(), count, MPI_BYTE,
+                   res.data(), count, MPI_BYTE,
+                   0, MPI_COMM_WORLD);
+    });
+}
+BENCHMARK(BM_raw_gather)->Apply(raw_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_raw_all_reduce(benchmark::State &state)
+{
+    const int count = std::max((int)1, (int)(state.range(0) / sizeof(float64)));
+    std::vector<float64> vals(count, 1.0);
+    std::vector<float64> res(count, 0.0);
+
+    run_benchmark(state, count * sizeof(float64), 1.0, [&]()
+    {
+        MPI_Allreduce(vals.data(), res.data(), count, MPI_DOUBLE, MPI_SUM,
+                      MPI_COMM_WORLD);
+    });
+}
+BENCHMARK(BM_raw_all_reduce)->Apply(raw_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+// -- relay::mpi point to point --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_send_recv(benchmark::State &state)
+{
+    if(!check_pairs(state))
+    {
+        return;
+    }
+    Node storage, payload;
+    create_payload(state, storage, payload);
+    // the receiver's node has the payload's layout
+    Node rcv_storage, rcv;
+    create_payload(state, rcv_storage, rcv);
+    const int partner = partner_rank();
+    const bool ping = world_rank() % 2 == 0;
+
+    run_benchmark(state, payload.total_bytes_compact(), 2.0, [&]()
+    {
+        if(partner < 0)
+        {
+            return;
+        }
+        if(ping)
+        {
+            relay::mpi::send(payload, partner, 0, MPI_COMM_WORLD);
+            relay::mpi::recv(rcv, partner, 0, MPI_COMM_WORLD);
+        }
+        else
+        {
+            relay::mpi::recv(rcv, partner, 0, MPI_COMM_WORLD);
+            relay::mpi::send(payload, partner, 0, MPI_COMM_WORLD);
+        }
+    });
+}
+BENCHMARK(BM_send_recv)->Apply(payload_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_send_using_schema(benchmark::State &state)
+{
+    if(!check_pairs(state))
+    {
+        return;
+    }
+    Node storage, payload;
+    create_payload(state, storage, payload);
+    const int partner = partner_rank();
+    const bool ping = world_rank() % 2 == 0;
+
+    run_benchmark(state, payload.total_bytes_compact(), 2.0, [&]()
+    {
+        if(partner < 0)
+        {
+            return;
+        }
+        // a new node every time, as a receiver without the schema would
+        Node rcv;
+        if(ping)
+        {
+            relay::mpi::send_using_schema(payload, partner, 0, MPI_COMM_WORLD);
+            relay::mpi::recv_using_schema(rcv, partner, 0, MPI_COMM_WORLD);
+        }
+        else
+        {
+            relay::mpi::recv_using_schema(rcv, partner, 0, MPI_COMM_WORLD);
+            relay::mpi::send_using_schema(payload, partner, 0, MPI_COMM_WORLD);
+        }
+    });
+}
+BENCHMARK(BM_send_using_schema)->Apply(payload_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_isend_irecv(benchmark::State &state)
+{
+    if(!check_pairs(state))
+    {
+        return;
+    }
+    Node storage, payload;
+    create_payload(state, storage, payload);
+    Node rcv_storage, rcv;
+    create_payload(state, rcv_storage, rcv);
+    const int partner = partner_rank();
+
+    // both ranks of a pair exchange at once, so an iteration is one
+    // one way transfer
+    run_benchmark(state, payload.total_bytes_compact(), 1.0, [&]()
+    {
+        if(partner < 0)
+        {
+            return;
+        }
+        relay::mpi::Request reqs[2];
+        relay::mpi::irecv(rcv, partner, 0, MPI_COMM_WORLD, &reqs[0]);
+        relay::mpi::isend(payload, partner, 0, MPI_COMM_WORLD, &reqs[1]);
+        relay::mpi::wait_recv(&reqs[0], MPI_STATUS_IGNORE);
+        relay::mpi::wait_send(&reqs[1], MPI_STATUS_IGNORE);
+    });
+}
+BENCHMARK(BM_isend_irecv)->Apply(payload_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_communicate_using_schema(benchmark::State &state)
+{
+    if(!check_pairs(state))
+    {
+        return;
+    }
+    Node storage, payload;
+    create_payload(state, storage, payload);
+    const int partner = partner_rank();
+
+    run_benchmark(state, payload.total_bytes_compact(), 1.0, [&]()
+    {
+        if(partner < 0)
+        {
+            return;
+        }
+        Node rcv;
+        relay::mpi::communicate_using_schema C(MPI_COMM_WORLD);
+        C.add_isend(payload, partner, 0);
+        C.add_irecv(rcv, partner, 0);
+        C.execute();
+    });
+}
+BENCHMARK(BM_communicate_using_schema)->Apply(payload_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+// -- relay::mpi collectives --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static void
+BM_gather_using_schema(benchmark::State &state)
+{
+    Node storage, payload;
+    create_payload(state, storage, payload);
+
+    run_benchmark(state, payload.total_bytes_compact() * world_size(), 1.0, [&]()
+    {
+        Node res;
+        relay::mpi::gather_using_schema(payload, res, 0, MPI_COMM_WORLD);
+    });
+}
+BENCHMARK(BM_gather_using_schema)->Apply(payload_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+static void
+BM_all_reduce(benchmark::State &state)
+{
+    Node storage, payload;
+    create_payload(state, storage, payload);
+
+    // all_reduce takes leaves, so objects are reduced one leaf at a time
+    run_benchmark(state, payload.total_bytes_compact(), 1.0, [&]()
+    {
+        Node res;
+        NodeConstIterator itr = payload.children();
+        while(itr.has_next())
+        {
+            const Node &leaf = itr.next();
+            relay::mpi::all_reduce(leaf, res[itr.name()], MPI_SUM,
+                                   MPI_COMM_WORLD);
+        }
+    });
+}
+BENCHMARK(BM_all_reduce)->Apply(payload_args)->UseManualTime();
+
+//-----------------------------------------------------------------------------
+// -- main --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Reporter for the non-root ranks, which run the benchmarks in lockstep
+// with rank 0 but don't report.
+class NullReporter : public benchmark::BenchmarkReporter
+{
+public:
+    virtual bool ReportContext(const Context &) { return true; }
+    virtual void ReportRuns(const std::vector<Run> &) {}
+};
+
+//-----------------------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    const int rank = relay::mpi::rank(MPI_COMM_WORLD);
+
+    // only rank 0 writes the output file
+    std::vector<char *> args;
+    for(int i = 0; i < argc; i++)
+    {
+        if(rank != 0 && std::strncmp(argv[i], "--benchmark_out", 15) == 0)
+        {
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+    int nargs = (int) args.size();
+
+    benchmark::Initialize(&nargs, args.data());
+    if(rank == 0)
+    {
+        benchmark::RunSpecifiedBenchmarks();
+    }
+    else
+    {
+        NullReporter reporter;
+        benchmark::RunSpecifiedBenchmarks(&reporter);
+    }
+    benchmark::Shutdown();
+
+    MPI_Finalize();
+    return 0;
+}
@@ -297,3 +297,151 @@ TEST(conduit_blueprint_mcarray_examples, mcarray_xyz)
         // TODO: tests!
     }
 }
+
+//-----------------------------------------------------------------------------
+// fills 'n' with 'ncomps' separate components of type 'dtype_id' holding
+// comp * 10 + tuple % 10
+static void
+make_separate_mcarray(index_t ncomps,
+                      index_t ntuples,
+                      index_t dtype_id,
+                      Node &n)
+{
+    n.reset();
+    for(index_t c = 0; c < ncomps; c++)
+    {
+        Node vals;
+        vals.set(DataType::float64(ntuples));
+        float64 *vals_ptr = vals.value();
+        for(index_t t = 0; t < ntuples; t++)
+        {
+            vals_ptr[t] = (float64)(c * 10 + t % 10);
+        }
+        vals.to_data_type(dtype_id, n.append());
+    }
+}
+
+//-----------------------------------------------------------------------------
+static bool
+check_mcarray_values(const Node &n, index_t ncomps, index_t ntuples)
+{
+    if(n.number_of_children() != ncomps)
+    {
+        return false;
+    }
+    for(index_t c = 0; c < ncomps; c++)
+    {
+        Node vals;
+        n.child(c).to_float64_array(vals);
+        float64_array vals_arr = vals.value();
+        if(vals_arr.number_of_elements() != ntuples)
+        {
+            return false;
+        }
+        for(index_t t = 0; t < ntuples; t++)
+        {
+            if(vals_arr[t] != (float64)(c * 10 + t % 10))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mcarray_examples, mcarray_transpose_kernels)
+{
+    const index_t dtype_ids[] = {DataType::INT8_ID,
+                                 DataType::INT16_ID,
+                                 DataType::FLOAT32_ID,
+                                 DataType::FLOAT64_ID};
+    const index_t ntuples = 150001;
+
+    Node opts;
+    opts["num_threads"] = 4;
+
+    for(index_t di = 0; di < 4; di++)
+    {
+        for(index_t ncomps = 1; ncomps <= 5; ncomps++)
+        {
+            Node n, n_inter, n_contig;
+            make_separate_mcarray(ncomps, ntuples, dtype_ids[di], n);
+
+            blueprint::mcarray::to_interleaved(n, n_inter, opts);
+            EXPECT_TRUE(blueprint::mcarray::is_interleaved(n_inter));
+            EXPECT_TRUE(check_mcarray_values(n_inter, ncomps, ntuples));
+
+            blueprint::mcarray::to_contiguous(n_inter, n_contig, opts);
+            EXPECT_TRUE(n_contig.is_contiguous());
+            EXPECT_TRUE(check_mcarray_values(n_contig, ncomps, ntuples));
+
+            // serial results match the threaded ones
+            Node n_inter_serial;
+            blueprint::mcarray::to_interleaved(n_contig, n_inter_serial);
+            EXPECT_EQ(memcmp(n_inter_serial.child(0).element_ptr(0),
+                             n_inter.child(0).element_ptr(0),
+                             (size_t)(ncomps * ntuples *
+                                      n.child(0).dtype().element_bytes())), 0);
+        }
+    }
+
+    // mixed element sizes still go through Node updates
+    Node n, n_out;
+    blueprint::mcarray::examples::xyz("interleaved_mixed", 10, n);
+    blueprint::mcarray::to_contiguous(n, n_out, opts);
+    EXPECT_TRUE(n_out.is_contiguous());
+    EXPECT_FALSE(n.diff(n_out, opts, 0.0, true));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mcarray_examples, mcarray_in_place)
+{
+    for(index_t ncomps = 1; ncomps <= 4; ncomps++)
+    {
+        const index_t ntuples = 1003;
+        Node n, n_contig;
+        make_separate_mcarray(ncomps, ntuples, DataType::FLOAT32_ID, n);
+        blueprint::mcarray::to_contiguous(n, n_contig);
+        const void *data_ptr = n_contig.data_ptr();
+
+        // the transposes reuse the block owned by n_contig
+        blueprint::mcarray::to_interleaved_in_place(n_contig);
+        EXPECT_EQ(n_contig.data_ptr(), data_ptr);
+        EXPECT_EQ(n_contig.child(0).element_ptr(0), data_ptr);
+        EXPECT_TRUE(blueprint::mcarray::is_interleaved(n_contig));
+        EXPECT_TRUE(check_mcarray_values(n_contig, ncomps, ntuples));
+
+        blueprint::mcarray::to_contiguous_in_place(n_contig);
+        EXPECT_EQ(n_contig.data_ptr(), data_ptr);
+        EXPECT_TRUE(n_contig.is_contiguous());
+        EXPECT_TRUE(check_mcarray_values(n_contig, ncomps, ntuples));
+
+        // components that own their data are replaced by a copy
+        blueprint::mcarray::to_interleaved_in_place(n);
+        EXPECT_TRUE(blueprint::mcarray::is_interleaved(n));
+        EXPECT_TRUE(check_mcarray_values(n, ncomps, ntuples));
+    }
+
+    // external interleaved data is transposed where it lives
+    float64 vals[12];
+    for(index_t t = 0; t < 4; t++)
+    {
+        vals[t * 3 + 0] = (float64)t;
+        vals[t * 3 + 1] = (float64)(10 + t);
+        vals[t * 3 + 2] = (float64)(20 + t);
+    }
+    Node n;
+    n["x"].set_external(&vals[0], 4, 0, 3 * sizeof(float64));
+    n["y"].set_external(&vals[1], 4, 0, 3 * sizeof(float64));
+    n["z"].set_external(&vals[2], 4, 0, 3 * sizeof(float64));
+    blueprint::mcarray::to_contiguous_in_place(n);
+    EXPECT_EQ(n["x"].element_ptr(0), (void*)&vals[0]);
+    EXPECT_EQ(n["y"].element_ptr(0), (void*)&vals[4]);
+    EXPECT_EQ(n["z"].element_ptr(0), (void*)&vals[8]);
+    EXPECT_TRUE(check_mcarray_values(n, 3, 4));
+    for(index_t i = 0; i < 12; i++)
+    {
+        EXPECT_EQ(vals[i], (float64)((i / 4) * 10 + i % 4));
+    }
+}
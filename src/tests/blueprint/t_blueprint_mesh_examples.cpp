@@ -634,6 +634,55 @@ TEST(conduit_blueprint_mesh_examples, 2d_braid_zero_z_check)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_examples, braid_num_threads)
+{
+    // sized so each fill loop is split into several chunks
+    Node opts;
+    opts["num_threads"] = 4;
+
+    const std::string types_2d[] = {"uniform", "rectilinear", "structured",
+                                    "points", "points_implicit",
+                                    "tris", "quads"};
+    const std::string types_3d[] = {"uniform", "rectilinear", "structured",
+                                    "points", "tets", "hexs", "wedges",
+                                    "pyramids"};
+
+    Node serial, threaded, info;
+    for(const std::string &mesh_type : types_2d)
+    {
+        blueprint::mesh::examples::braid(mesh_type, 201, 101, 0, serial);
+        blueprint::mesh::examples::braid(mesh_type, 201, 101, 0, opts, threaded);
+        EXPECT_FALSE(serial.diff(threaded, info)) << mesh_type << " 2d";
+    }
+
+    for(const std::string &mesh_type : types_3d)
+    {
+        blueprint::mesh::examples::braid(mesh_type, 41, 31, 21, serial);
+        blueprint::mesh::examples::braid(mesh_type, 41, 31, 21, opts, threaded);
+        EXPECT_FALSE(serial.diff(threaded, info)) << mesh_type << " 3d";
+    }
+
+    serial.reset();
+    threaded.reset();
+    blueprint::mesh::examples::basic("hexs", 41, 31, 21, serial);
+    blueprint::mesh::examples::basic("hexs", 41, 31, 21, opts, threaded);
+    EXPECT_FALSE(serial.diff(threaded, info));
+
+    serial.reset();
+    threaded.reset();
+    blueprint::mesh::examples::grid("quads", 101, 101, 0, 2, 2, 1, serial);
+    blueprint::mesh::examples::grid("quads", 101, 101, 0, 2, 2, 1, opts, threaded);
+    EXPECT_FALSE(serial.diff(threaded, info));
+
+    serial.reset();
+    threaded.reset();
+    blueprint::mesh::examples::spiral(14, serial);
+    blueprint::mesh::examples::spiral(14, opts, threaded);
+    EXPECT_FALSE(serial.diff(threaded, info));
+    EXPECT_TRUE(blueprint::mesh::verify(threaded, info));
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_examples, mesh_misc)
 {
@@ -1384,6 +1433,169 @@ TEST(conduit_blueprint_mesh_examples, oneDtostrip_fullfeatured)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_examples, oneDtostrip_many_fields)
+{
+    Node mesh;
+    blueprint::mesh::examples::basic("rectilinear", 1001, 0, 0, mesh);
+    const index_t num_elems = 1000;
+
+    // probe fields, the odd ones are strided views of an interleaved array
+    const index_t num_probes = 64;
+    std::vector<float64> interleaved(num_elems * 2);
+    for(index_t i = 0; i < num_elems * 2; i++)
+    {
+        interleaved[i] = 0.5 * i;
+    }
+    for(index_t p = 0; p < num_probes; p++)
+    {
+        Node &field = mesh["fields"]["probe_" + std::to_string(p)];
+        field["association"] = "element";
+        field["topology"] = "mesh";
+        if(p % 2 == 0)
+        {
+            field["values"].set(DataType::float32(num_elems));
+            float32 *vals = field["values"].value();
+            for(index_t i = 0; i < num_elems; i++)
+            {
+                vals[i] = (float32)(p * num_elems + i);
+            }
+        }
+        else
+        {
+            field["values"].set_external(DataType::float64(num_elems, 0, 2 * sizeof(float64)),
+                                         interleaved.data());
+        }
+    }
+
+    Node info;
+    EXPECT_TRUE(blueprint::mesh::can_generate_strip(mesh, "mesh", info));
+
+    // copies, on threads
+    Node options;
+    options["field_prefix"] = "strip_";
+    options["num_threads"] = 4;
+    blueprint::mesh::generate_strip(mesh["topologies/mesh"],
+        mesh["topologies/strip_mesh"],
+        mesh["coordsets/strip_coords"],
+        mesh["fields"],
+        options);
+
+    // external views
+    Node &fields = mesh["fields"];
+    Node ext_options;
+    ext_options["num_threads"] = 4;
+    ext_options["external"] = 1;
+    blueprint::mesh::field::generate_strip(fields, "mesh", "ext_mesh", ext_options);
+
+    for(index_t p = 0; p < num_probes; p++)
+    {
+        const std::string name = "probe_" + std::to_string(p);
+        const Node &src = fields[name];
+        const Node &copy = fields["strip_" + name];
+        const Node &ext = fields["ext_mesh_" + name];
+
+        EXPECT_EQ(copy["topology"].as_string(), "strip_mesh");
+        EXPECT_EQ(ext["topology"].as_string(), "ext_mesh");
+        EXPECT_FALSE(copy["values"].diff(src["values"], info, 0.0));
+        EXPECT_FALSE(ext["values"].diff(src["values"], info, 0.0));
+        EXPECT_TRUE(copy["values"].dtype().is_compact());
+        EXPECT_FALSE(copy["values"].is_data_external());
+        EXPECT_EQ(ext["values"].element_ptr(0), src["values"].element_ptr(0));
+    }
+
+    mesh["topologies/ext_mesh"].set(mesh["topologies/strip_mesh"]);
+    info.reset();
+    EXPECT_TRUE(blueprint::mesh::verify(mesh, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_examples, braid_schema_binary_vs_json_timing)
+{
+    // multi domain braid mesh with ~10k leaves, compare the cost
+    // of moving its schema as json vs the binary encoding
+    Node mesh;
+    index_t num_leaves = 0;
+    index_t dom_id = 0;
+    while(num_leaves < 10000)
+    {
+        Node &dom = mesh.append();
+        blueprint::mesh::examples::braid("hexs",3,3,3,dom);
+        dom["state/domain_id"] = dom_id;
+        dom_id++;
+
+        // count the leaves of the new domain
+        std::vector<const Schema*> stack(1, &dom.schema());
+        while(!stack.empty())
+        {
+            const Schema *curr = stack.back();
+            stack.pop_back();
+            index_t nchld = curr->number_of_children();
+            if(nchld == 0)
+            {
+                num_leaves++;
+            }
+            for(index_t i=0; i < nchld; i++)
+            {
+                stack.push_back(&curr->child(i));
+            }
+        }
+    }
+
+    Schema s_compact;
+    mesh.schema().compact_to(s_compact);
+
+    index_t nreps = 5;
+
+    std::string json_str;
+    Timer t_json_gen;
+    for(index_t r=0; r < nreps; r++)
+    {
+        json_str = s_compact.to_json();
+    }
+    float t_json_gen_val = t_json_gen.elapsed();
+
+    Schema s_json;
+    Timer t_json_parse;
+    for(index_t r=0; r < nreps; r++)
+    {
+        s_json.reset();
+        Generator g(json_str);
+        g.walk(s_json);
+    }
+    float t_json_parse_val = t_json_parse.elapsed();
+
+    std::vector<uint8> bin;
+    Timer t_bin_gen;
+    for(index_t r=0; r < nreps; r++)
+    {
+        bin.clear();
+        s_compact.serialize_binary(bin);
+    }
+    float t_bin_gen_val = t_bin_gen.elapsed();
+
+    Schema s_bin;
+    Timer t_bin_parse;
+    for(index_t r=0; r < nreps; r++)
+    {
+        s_bin.deserialize_binary(bin);
+    }
+    float t_bin_parse_val = t_bin_parse.elapsed();
+
+    EXPECT_TRUE(s_compact.equals(s_bin));
+    EXPECT_EQ(s_compact.number_of_children(),s_json.number_of_children());
+    EXPECT_LT(bin.size(), json_str.size());
+
+    std::cout << "domains:               " << dom_id << std::endl;
+    std::cout << "leaves:                " << num_leaves << std::endl;
+    std::cout << "json schema bytes:     " << json_str.size() << std::endl;
+    std::cout << "binary schema bytes:   " << bin.size() << std::endl;
+    std::cout << "json generate time:    " << t_json_gen_val / nreps << std::endl;
+    std::cout << "json parse time:       " << t_json_parse_val / nreps << std::endl;
+    std::cout << "binary generate time:  " << t_bin_gen_val / nreps << std::endl;
+    std::cout << "binary parse time:     " << t_bin_parse_val / nreps << std::endl;
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
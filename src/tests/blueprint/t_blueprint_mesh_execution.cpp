@@ -0,0 +1,443 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_blueprint_mesh_execution.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+namespace bpexec = conduit::blueprint::mesh::execution;
+
+//-----------------------------------------------------------------------------
+// A fake device: host memory from an allocator that is marked as a device
+// allocator, with host implementations of the device kernels that count
+// their calls. Copies from and to it count the bytes that were staged.
+//-----------------------------------------------------------------------------
+static index_t fake_device_copy_bytes = 0;
+static index_t fake_min_max_calls = 0;
+static index_t fake_scan_calls = 0;
+static index_t fake_centroid_calls = 0;
+
+//-----------------------------------------------------------------------------
+void *
+fake_device_alloc(size_t items, size_t item_size)
+{
+    return calloc(items, item_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+fake_device_free(void *ptr)
+{
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+void
+fake_device_memcpy(void *dest, const void *src, size_t num)
+{
+    fake_device_copy_bytes += (index_t)num;
+    memcpy(dest, src, num);
+}
+
+//-----------------------------------------------------------------------------
+bool
+fake_min_max(const Node &values, float64 &min, float64 &max)
+{
+    fake_min_max_calls++;
+    float64_accessor vals = values.as_float64_accessor();
+    min = vals.min();
+    max = vals.max();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+fake_exclusive_scan(const Node &sizes, Node &offsets)
+{
+    if(!offsets.dtype().is_int32() && !offsets.dtype().is_int64())
+    {
+        return false;
+    }
+
+    fake_scan_calls++;
+    index_t_accessor size_vals = sizes.as_index_t_accessor();
+    index_t offset = 0;
+    for(index_t i = 0; i < size_vals.number_of_elements(); i++)
+    {
+        if(offsets.dtype().is_int32())
+        {
+            offsets.as_int32_ptr()[i] = (int32)offset;
+        }
+        else
+        {
+            offsets.as_int64_ptr()[i] = (int64)offset;
+        }
+        offset += size_vals[i];
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+fake_fixed_centroids(const Node &connectivity,
+                     index_t indices,
+                     const Node &coord_values,
+                     Node &centroid_values)
+{
+    if(!centroid_values.child(0).dtype().is_float64())
+    {
+        return false;
+    }
+
+    fake_centroid_calls++;
+    index_t_accessor conn = connectivity.as_index_t_accessor();
+    const index_t num_elems = conn.number_of_elements() / indices;
+    NodeConstIterator itr = coord_values.children();
+    while(itr.has_next())
+    {
+        float64_accessor coords = itr.next().as_float64_accessor();
+        float64 *res = centroid_values[itr.name()].as_float64_ptr();
+        for(index_t ei = 0; ei < num_elems; ei++)
+        {
+            float64 sum = 0.0;
+            index_t num_unique = 0;
+            for(index_t pi = 0; pi < indices; pi++)
+            {
+                bool is_repeat = false;
+                for(index_t pj = 0; pj < pi; pj++)
+                {
+                    is_repeat |= conn[ei * indices + pj] == conn[ei * indices + pi];
+                }
+                if(!is_repeat)
+                {
+                    sum += coords[conn[ei * indices + pi]];
+                    num_unique++;
+                }
+            }
+            res[ei] = sum / num_unique;
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+fake_device_allocator()
+{
+    static index_t id = -1;
+    if(id < 0)
+    {
+        id = utils::register_allocator(fake_device_alloc, fake_device_free);
+        utils::set_device_allocator(id);
+        utils::set_memcpy_handler(id, fake_device_memcpy);
+    }
+    return id;
+}
+
+//-----------------------------------------------------------------------------
+void
+bind_fake_kernels()
+{
+    bpexec::DeviceKernels kernels;
+    kernels.min_max = fake_min_max;
+    kernels.exclusive_scan = fake_exclusive_scan;
+    kernels.fixed_centroids = fake_fixed_centroids;
+    bpexec::set_device_kernels(fake_device_allocator(), kernels);
+}
+
+//-----------------------------------------------------------------------------
+void
+reset_counters()
+{
+    fake_device_copy_bytes = 0;
+    fake_min_max_calls = 0;
+    fake_scan_calls = 0;
+    fake_centroid_calls = 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+to_fake_device(const Node &src, Node &dest)
+{
+    dest.reset();
+    dest.set_allocator(fake_device_allocator());
+    dest.set(src);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_execution, select_backend)
+{
+    Node mesh, dev_mesh;
+    blueprint::mesh::examples::braid("hexs", 3, 3, 3, mesh);
+    EXPECT_EQ(bpexec::select_backend(mesh), bpexec::BACKEND_HOST);
+    EXPECT_EQ(bpexec::device_allocator(mesh), -1);
+
+    bpexec::clear_device_kernels(fake_device_allocator());
+    to_fake_device(mesh, dev_mesh);
+    EXPECT_EQ(bpexec::device_allocator(dev_mesh), fake_device_allocator());
+    EXPECT_EQ(bpexec::select_backend(dev_mesh), bpexec::BACKEND_HOST_STAGED);
+    EXPECT_EQ(bpexec::device_kernels(fake_device_allocator()), (const bpexec::DeviceKernels*)NULL);
+
+    bind_fake_kernels();
+    EXPECT_EQ(bpexec::select_backend(dev_mesh), bpexec::BACKEND_DEVICE);
+    EXPECT_EQ(bpexec::select_backend(mesh, dev_mesh), bpexec::BACKEND_DEVICE);
+    EXPECT_EQ(bpexec::backend_name(bpexec::BACKEND_DEVICE), "device");
+
+    // host leaves mixed with device leaves
+    Node mixed;
+    mixed["host"].set(mesh["fields/braid/values"]);
+    mixed["device"].set_allocator(fake_device_allocator());
+    mixed["device"].set(mesh["fields/braid/values"]);
+    EXPECT_EQ(bpexec::device_allocator(mixed), -1);
+    EXPECT_EQ(bpexec::device_allocator(mixed["device"]), fake_device_allocator());
+
+    // leaves from two device allocators are staged
+    index_t other_id = utils::register_allocator(fake_device_alloc, fake_device_free);
+    utils::set_device_allocator(other_id);
+    mixed["other"].set_allocator(other_id);
+    mixed["other"].set(mesh["fields/braid/values"]);
+    EXPECT_EQ(bpexec::select_backend(mixed), bpexec::BACKEND_HOST_STAGED);
+    EXPECT_EQ(bpexec::backend_name(bpexec::select_backend(mixed)), "host_staged");
+
+    // to_host only copies device resident nodes
+    Node host;
+    EXPECT_EQ(&bpexec::to_host(mesh, host), &mesh);
+    const Node &host_mesh = bpexec::to_host(dev_mesh, host);
+    EXPECT_EQ(&host_mesh, &host);
+    EXPECT_EQ(bpexec::select_backend(host_mesh), bpexec::BACKEND_HOST);
+    Node info;
+    EXPECT_FALSE(host_mesh.diff(mesh, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_execution, extents)
+{
+    Node mesh, dev_mesh;
+    blueprint::mesh::examples::braid("hexs", 5, 6, 7, mesh);
+    const std::vector<float64> exts =
+        blueprint::mesh::utils::coordset::extents(mesh["coordsets/coords"]);
+    to_fake_device(mesh, dev_mesh);
+
+    // staged
+    bpexec::clear_device_kernels(fake_device_allocator());
+    reset_counters();
+    EXPECT_EQ(blueprint::mesh::utils::coordset::extents(dev_mesh["coordsets/coords"]),
+              exts);
+    EXPECT_GT(fake_device_copy_bytes, 0);
+    EXPECT_EQ(fake_min_max_calls, 0);
+
+    // device kernels
+    bind_fake_kernels();
+    reset_counters();
+    EXPECT_EQ(blueprint::mesh::utils::coordset::extents(dev_mesh["coordsets/coords"]),
+              exts);
+    EXPECT_EQ(fake_min_max_calls, 3);
+    EXPECT_EQ(fake_device_copy_bytes, 0);
+
+    // device values aren't hashed for the cache
+    EXPECT_EQ(blueprint::mesh::utils::coordset::cached_extents(dev_mesh["coordsets/coords"]),
+              exts);
+    EXPECT_FALSE(dev_mesh["coordsets/coords"].has_child("state"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_execution, generate_offsets)
+{
+    bind_fake_kernels();
+
+    // polygonal and polyhedral offsets are scanned on the device
+    for(index_t nz = 1; nz <= 2; nz++)
+    {
+        Node mesh, dev_mesh;
+        blueprint::mesh::examples::polytess(2, nz, mesh);
+        Node &topo = mesh["topologies"][0];
+        if(topo.has_path("elements/offsets"))
+        {
+            topo["elements"].remove_child("offsets");
+        }
+        if(topo.has_path("subelements/offsets"))
+        {
+            topo["subelements"].remove_child("offsets");
+        }
+        // the kernels only scan int32 and int64 sizes
+        const std::string groups[] = {"elements", "subelements"};
+        for(const std::string &group : groups)
+        {
+            if(topo.has_child(group))
+            {
+                Node &group_node = topo[group];
+                Node int64_sizes, int64_conn;
+                group_node["sizes"].to_int64_array(int64_sizes);
+                group_node["connectivity"].to_int64_array(int64_conn);
+                group_node["sizes"].set(int64_sizes);
+                group_node["connectivity"].set(int64_conn);
+            }
+        }
+        to_fake_device(mesh, dev_mesh);
+        const Node &dev_topo = dev_mesh["topologies"][0];
+
+        Node offsets, subele_offsets, dev_offsets, dev_subele_offsets;
+        blueprint::mesh::topology::unstructured::generate_offsets(topo,
+                                                                  offsets,
+                                                                  subele_offsets);
+        reset_counters();
+        blueprint::mesh::topology::unstructured::generate_offsets(dev_topo,
+                                                                  dev_offsets,
+                                                                  dev_subele_offsets);
+        EXPECT_EQ(fake_scan_calls, nz);
+        EXPECT_EQ(dev_offsets.allocator(), fake_device_allocator());
+
+        Node info;
+        EXPECT_FALSE(dev_offsets.diff(offsets, info));
+        EXPECT_FALSE(dev_subele_offsets.diff(subele_offsets, info));
+    }
+
+    // fixed shape offsets are copied to the device
+    Node mesh, dev_mesh, offsets, dev_offsets;
+    blueprint::mesh::examples::braid("tets", 3, 3, 3, mesh);
+    to_fake_device(mesh, dev_mesh);
+    blueprint::mesh::utils::topology::unstructured::generate_offsets(
+        mesh["topologies/mesh"], offsets);
+    blueprint::mesh::utils::topology::unstructured::generate_offsets(
+        dev_mesh["topologies/mesh"], dev_offsets);
+    EXPECT_EQ(dev_offsets.allocator(), fake_device_allocator());
+    Node info;
+    EXPECT_FALSE(dev_offsets.diff(offsets, info));
+
+    // staged without kernels
+    bpexec::clear_device_kernels(fake_device_allocator());
+    reset_counters();
+    Node staged_offsets;
+    blueprint::mesh::utils::topology::unstructured::generate_offsets(
+        dev_mesh["topologies/mesh"], staged_offsets);
+    EXPECT_EQ(staged_offsets.allocator(), 0);
+    EXPECT_FALSE(staged_offsets.diff(offsets, info));
+    EXPECT_GT(fake_device_copy_bytes, 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_execution, generate_centroids)
+{
+    const std::string shapes[] = {"tets", "hexs", "quads"};
+    for(const std::string &shape : shapes)
+    {
+        Node mesh, dev_mesh;
+        blueprint::mesh::examples::braid(shape, 4, 4, shape == "quads" ? 0 : 4, mesh);
+        to_fake_device(mesh, dev_mesh);
+
+        Node topo, coords, s2d, d2s;
+        blueprint::mesh::topology::unstructured::generate_centroids(
+            mesh["topologies/mesh"], topo, coords, s2d, d2s);
+
+        // device kernels
+        bind_fake_kernels();
+        reset_counters();
+        Node dev_topo, dev_coords, dev_s2d, dev_d2s, info;
+        blueprint::mesh::topology::unstructured::generate_centroids(
+            dev_mesh["topologies/mesh"], dev_topo, dev_coords, dev_s2d, dev_d2s);
+        EXPECT_EQ(fake_centroid_calls, 1);
+        EXPECT_EQ(dev_coords["values/x"].allocator(), fake_device_allocator());
+        EXPECT_EQ(dev_topo["elements/connectivity"].allocator(), fake_device_allocator());
+        EXPECT_EQ(dev_s2d.allocator(), fake_device_allocator());
+        EXPECT_FALSE(dev_topo.diff(topo, info));
+        EXPECT_FALSE(dev_coords.diff(coords, info));
+        EXPECT_FALSE(dev_s2d.diff(s2d, info));
+        EXPECT_FALSE(dev_d2s.diff(d2s, info));
+
+        // measures aren't computed on the device
+        reset_counters();
+        Node measures, dev_measures, opts;
+        blueprint::mesh::topology::unstructured::generate_centroids(
+            mesh["topologies/mesh"], topo, coords, s2d, d2s, measures, opts);
+        blueprint::mesh::topology::unstructured::generate_centroids(
+            dev_mesh["topologies/mesh"], dev_topo, dev_coords, dev_s2d, dev_d2s,
+            dev_measures, opts);
+        EXPECT_EQ(fake_centroid_calls, 0);
+        EXPECT_GT(fake_device_copy_bytes, 0);
+        EXPECT_FALSE(dev_measures.diff(measures, info));
+        EXPECT_FALSE(dev_coords.diff(coords, info));
+
+        // staged without kernels
+        bpexec::clear_device_kernels(fake_device_allocator());
+        reset_counters();
+        blueprint::mesh::topology::unstructured::generate_centroids(
+            dev_mesh["topologies/mesh"], dev_topo, dev_coords, dev_s2d, dev_d2s);
+        EXPECT_EQ(fake_centroid_calls, 0);
+        EXPECT_EQ(dev_coords["values/x"].allocator(), 0);
+        EXPECT_FALSE(dev_coords.diff(coords, info));
+        EXPECT_FALSE(dev_s2d.diff(s2d, info));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_execution, staged_algorithms)
+{
+    bind_fake_kernels();
+    Node info;
+
+    // to_unstructured
+    {
+        Node mesh, dev_mesh;
+        blueprint::mesh::examples::braid("uniform", 4, 4, 4, mesh);
+        to_fake_device(mesh, dev_mesh);
+
+        Node topo, coords, dev_topo, dev_coords;
+        blueprint::mesh::topology::uniform::to_unstructured(
+            mesh["topologies/mesh"], topo, coords);
+        reset_counters();
+        blueprint::mesh::topology::uniform::to_unstructured(
+            dev_mesh["topologies/mesh"], dev_topo, dev_coords);
+        EXPECT_GT(fake_device_copy_bytes, 0);
+        EXPECT_FALSE(dev_topo.diff(topo, info));
+        EXPECT_FALSE(dev_coords.diff(coords, info));
+    }
+
+    // partition
+    {
+        Node mesh, dev_mesh, opts;
+        blueprint::mesh::examples::braid("hexs", 5, 5, 5, mesh);
+        to_fake_device(mesh, dev_mesh);
+        opts["target"] = 2;
+
+        Node parts, dev_parts;
+        blueprint::mesh::partition(mesh, opts, parts);
+        reset_counters();
+        blueprint::mesh::partition(dev_mesh, opts, dev_parts);
+        EXPECT_GT(fake_device_copy_bytes, 0);
+        EXPECT_EQ(bpexec::select_backend(dev_parts), bpexec::BACKEND_HOST);
+        EXPECT_FALSE(dev_parts.diff(parts, info));
+    }
+
+    // matset conversions
+    {
+        Node mesh, dev_mesh;
+        blueprint::mesh::examples::venn("full", 8, 8, 0.25, mesh);
+        to_fake_device(mesh, dev_mesh);
+
+        Node matset, dev_matset;
+        blueprint::mesh::matset::to_sparse_by_element(mesh["matsets/matset"],
+                                                      matset);
+        reset_counters();
+        blueprint::mesh::matset::to_sparse_by_element(dev_mesh["matsets/matset"],
+                                                      dev_matset);
+        EXPECT_GT(fake_device_copy_bytes, 0);
+        EXPECT_FALSE(dev_matset.diff(matset, info));
+
+        Node silo, dev_silo;
+        blueprint::mesh::matset::to_silo(mesh["matsets/matset"], silo);
+        blueprint::mesh::matset::to_silo(dev_mesh["matsets/matset"], dev_silo);
+        EXPECT_FALSE(dev_silo.diff(silo, info));
+    }
+}
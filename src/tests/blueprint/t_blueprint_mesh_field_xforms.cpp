@@ -0,0 +1,264 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_blueprint_mesh_field_xforms.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+#include "conduit_blueprint_mesh_utils.hpp"
+#include "conduit_log.hpp"
+
+#include <vector>
+#include <string>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+namespace bputils = conduit::blueprint::mesh::utils;
+
+//-----------------------------------------------------------------------------
+// Recenters 'values' of a single shape unstructured topology the slow way.
+static std::vector<float64>
+expected_recenter(const Node &topo,
+                  index_t num_verts,
+                  const Node &values,
+                  bool to_element)
+{
+    const bputils::ShapeType shape(topo);
+    const index_t_accessor conn = topo["elements/connectivity"].as_index_t_accessor();
+    const float64_accessor vals = values.as_float64_accessor();
+    const index_t num_elems = conn.number_of_elements() / shape.indices;
+
+    std::vector<float64> res(to_element ? num_elems : num_verts, 0.0);
+    std::vector<float64> counts(res.size(), 0.0);
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        for(index_t pi = 0; pi < shape.indices; pi++)
+        {
+            const index_t vi = conn[ei * shape.indices + pi];
+            if(to_element)
+            {
+                res[ei] += vals[vi];
+                counts[ei] += 1.0;
+            }
+            else
+            {
+                res[vi] += vals[ei];
+                counts[vi] += 1.0;
+            }
+        }
+    }
+    for(size_t i = 0; i < res.size(); i++)
+    {
+        res[i] = counts[i] > 0.0 ? res[i] / counts[i] : 0.0;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+static void
+check_values(const std::vector<float64> &expected, const Node &values)
+{
+    const float64_accessor vals = values.as_float64_accessor();
+    ASSERT_EQ((index_t)expected.size(), vals.number_of_elements());
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_NEAR(expected[i], vals[(index_t)i], 1e-10);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Adds an element field "ids" with the element ids of the "mesh" topology.
+static void
+add_element_id_field(Node &mesh)
+{
+    const index_t num_elems = blueprint::mesh::topology::length(mesh["topologies/mesh"]);
+    Node &field = mesh["fields/ids"];
+    field["association"] = "element";
+    field["topology"] = "mesh";
+    field["values"].set(DataType::float64(num_elems));
+    float64 *vals = field["values"].value();
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        vals[ei] = (float64)ei;
+    }
+}
+
+/// Test Cases ///
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field_xforms, recenter_vertex_to_element)
+{
+    const std::string shapes[] = {"tris", "quads", "tets", "hexs", "wedges", "pyramids"};
+    for(const std::string &shape : shapes)
+    {
+        Node mesh;
+        blueprint::mesh::examples::braid(shape, 4, 5, 3, mesh);
+        const index_t num_verts = mesh["fields/braid/values"].dtype().number_of_elements();
+
+        Node field;
+        blueprint::mesh::field::recenter(mesh, "braid", "element", field);
+        EXPECT_EQ(field["association"].as_string(), "element");
+        EXPECT_EQ(field["topology"].as_string(), "mesh");
+        check_values(expected_recenter(mesh["topologies/mesh"], num_verts,
+                                       mesh["fields/braid/values"], true),
+                     field["values"]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field_xforms, recenter_element_to_vertex)
+{
+    const std::string shapes[] = {"tris", "quads", "tets", "hexs"};
+    for(const std::string &shape : shapes)
+    {
+        Node mesh;
+        blueprint::mesh::examples::braid(shape, 4, 5, 3, mesh);
+        const index_t num_verts = mesh["fields/braid/values"].dtype().number_of_elements();
+
+        Node field;
+        blueprint::mesh::field::recenter(mesh, "radial", "vertex", field);
+        EXPECT_EQ(field["association"].as_string(), "vertex");
+        check_values(expected_recenter(mesh["topologies/mesh"], num_verts,
+                                       mesh["fields/radial/values"], false),
+                     field["values"]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field_xforms, recenter_structured_and_poly)
+{
+    // the structured and polytopal braid meshes number their elements and
+    // vertices like the single shape ones
+    Node quads, hexs;
+    blueprint::mesh::examples::braid("quads", 5, 4, 0, quads);
+    blueprint::mesh::examples::braid("hexs", 4, 3, 3, hexs);
+    add_element_id_field(quads);
+    add_element_id_field(hexs);
+
+    Node quads_elem, quads_vert, hexs_elem, hexs_vert;
+    blueprint::mesh::field::recenter(quads, "braid", "element", quads_elem);
+    blueprint::mesh::field::recenter(quads, "ids", "vertex", quads_vert);
+    blueprint::mesh::field::recenter(hexs, "braid", "element", hexs_elem);
+    blueprint::mesh::field::recenter(hexs, "ids", "vertex", hexs_vert);
+
+    const std::string types_2d[] = {"uniform", "rectilinear", "structured", "quads_poly"};
+    for(const std::string &type : types_2d)
+    {
+        Node mesh, elem, vert, info;
+        blueprint::mesh::examples::braid(type, 5, 4, 0, mesh);
+        add_element_id_field(mesh);
+        blueprint::mesh::field::recenter(mesh, "braid", "element", elem);
+        blueprint::mesh::field::recenter(mesh, "ids", "vertex", vert);
+        EXPECT_FALSE(elem["values"].diff(quads_elem["values"], info, 1e-10)) << type;
+        EXPECT_FALSE(vert["values"].diff(quads_vert["values"], info, 1e-10)) << type;
+    }
+
+    const std::string types_3d[] = {"uniform", "structured", "hexs_poly"};
+    for(const std::string &type : types_3d)
+    {
+        Node mesh, elem, vert, info;
+        blueprint::mesh::examples::braid(type, 4, 3, 3, mesh);
+        add_element_id_field(mesh);
+        blueprint::mesh::field::recenter(mesh, "braid", "element", elem);
+        blueprint::mesh::field::recenter(mesh, "ids", "vertex", vert);
+        EXPECT_FALSE(elem["values"].diff(hexs_elem["values"], info, 1e-10)) << type;
+        EXPECT_FALSE(vert["values"].diff(hexs_vert["values"], info, 1e-10)) << type;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field_xforms, recenter_components_and_types)
+{
+    Node mesh;
+    blueprint::mesh::examples::braid("quads", 4, 4, 0, mesh);
+
+    // multi-component
+    Node vel;
+    blueprint::mesh::field::recenter(mesh, "vel", "element", vel);
+    EXPECT_TRUE(vel["values"].has_child("u"));
+    EXPECT_TRUE(vel["values"].has_child("v"));
+    check_values(expected_recenter(mesh["topologies/mesh"], 16,
+                                   mesh["fields/vel/values/u"], true),
+                 vel["values/u"]);
+
+    // float32 values stay float32, integer values become float64
+    Node &f32 = mesh["fields/braid32"];
+    f32["association"] = "vertex";
+    f32["topology"] = "mesh";
+    mesh["fields/braid/values"].to_float32_array(f32["values"]);
+    Node &ids = mesh["fields/ids"];
+    ids["association"] = "vertex";
+    ids["topology"] = "mesh";
+    ids["values"].set(DataType::int32(16));
+    int32 *ids_ptr = ids["values"].value();
+    for(int32 i = 0; i < 16; i++)
+    {
+        ids_ptr[i] = i;
+    }
+
+    Node res;
+    blueprint::mesh::field::recenter(mesh, "braid32", "element", res);
+    EXPECT_TRUE(res["values"].dtype().is_float32());
+    blueprint::mesh::field::recenter(mesh, "ids", "element", res);
+    EXPECT_TRUE(res["values"].dtype().is_float64());
+    // element 0 uses vertices 0, 1, 5 and 4
+    EXPECT_NEAR(res["values"].as_float64_ptr()[0], 2.5, 1e-10);
+
+    // recentering to the field's association copies the values
+    Node info;
+    blueprint::mesh::field::recenter(mesh, "radial", "element", res);
+    EXPECT_FALSE(res["values"].diff(mesh["fields/radial/values"], info, 0.0));
+
+    EXPECT_THROW(blueprint::mesh::field::recenter(mesh, "radial", "face", res),
+                 conduit::Error);
+    EXPECT_THROW(blueprint::mesh::field::recenter(mesh, "missing", "vertex", res),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field_xforms, recenter_threads)
+{
+    const std::string types[] = {"hexs", "uniform", "quads_poly"};
+    for(const std::string &type : types)
+    {
+        Node mesh;
+        blueprint::mesh::examples::braid(type, 30, 30, type == "quads_poly" ? 0 : 20, mesh);
+
+        Node opts;
+        opts["num_threads"] = 1;
+        Node elem_1, vert_1;
+        blueprint::mesh::field::recenter(mesh, "braid", "element", elem_1, opts);
+        blueprint::mesh::field::recenter(mesh, "radial", "vertex", vert_1, opts);
+
+        opts["num_threads"] = 4;
+        Node elem_4, vert_4, info;
+        blueprint::mesh::field::recenter(mesh, "braid", "element", elem_4, opts);
+        blueprint::mesh::field::recenter(mesh, "radial", "vertex", vert_4, opts);
+        EXPECT_FALSE(elem_1.diff(elem_4, info, 0.0)) << type;
+        EXPECT_FALSE(vert_1.diff(vert_4, info, 0.0)) << type;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field_xforms, invert_adjacency)
+{
+    // 3 elements over 5 vertices, vertex 4 is unused
+    const std::vector<index_t> offsets = {0, 3, 6, 8};
+    const std::vector<index_t> verts = {0, 1, 2, 2, 1, 3, 3, 0};
+
+    for(index_t num_threads = 1; num_threads <= 4; num_threads++)
+    {
+        std::vector<index_t> res_offsets, res_elems;
+        bputils::topology::invert_adjacency(offsets, verts, 5, num_threads,
+                                            res_offsets, res_elems);
+        const std::vector<index_t> exp_offsets = {0, 2, 4, 6, 8, 8};
+        const std::vector<index_t> exp_elems = {0, 2, 0, 1, 0, 1, 1, 2};
+        EXPECT_EQ(res_offsets, exp_offsets);
+        EXPECT_EQ(res_elems, exp_elems);
+    }
+}
@@ -9,6 +9,7 @@
 //-----------------------------------------------------------------------------
 #include <array>
 #include <iostream>
+#include <map>
 #include <string>
 
 #include <conduit.hpp>
@@ -437,3 +438,82 @@ TEST(blueprint_mesh_flatten, domains_missing_fields)
         table::compare_to_baseline(table, baseline);
     }
 }
+
+TEST(blueprint_mesh_flatten, num_threads)
+{
+    // Flattening domains concurrently gives the same table.
+    Node mesh;
+    blueprint::mesh::examples::spiral(7, mesh);
+
+    Node table, threaded_table, opts, info;
+    blueprint::mesh::flatten(mesh, opts, table);
+    opts["num_threads"] = 4;
+    blueprint::mesh::flatten(mesh, opts, threaded_table);
+    ASSERT_TRUE(blueprint::table::verify(threaded_table, info)) << info.to_json();
+    EXPECT_FALSE(table.diff(threaded_table, info)) << info.to_json();
+}
+
+TEST(blueprint_mesh_flatten, batches)
+{
+    // The batches hold the rows of the full table, in order.
+    Node mesh;
+    blueprint::mesh::examples::spiral(5, mesh);
+
+    Node table, opts;
+    blueprint::mesh::flatten(mesh, opts, table);
+
+    const index_t batch_rows = 7;
+    opts["batch_rows"] = batch_rows;
+    std::map<std::string, index_t> next_row;
+    blueprint::mesh::flatten_batches(mesh, opts,
+        [&](const std::string &table_name, index_t row_offset, const Node &batch)
+    {
+        Node info;
+        EXPECT_TRUE(blueprint::table::verify(batch, info)) << info.to_json();
+        EXPECT_EQ(row_offset, next_row[table_name]);
+
+        const Node &full_values = table[table_name]["values"];
+        const Node &batch_values = batch["values"];
+        ASSERT_EQ(full_values.number_of_children(), batch_values.number_of_children());
+        index_t nrows = 0;
+        for(index_t i = 0; i < batch_values.number_of_children(); i++)
+        {
+            const Node &batch_col = batch_values[i];
+            const Node &full_col = full_values[batch_col.name()];
+            std::vector<const Node *> batch_leaves, full_leaves;
+            if(batch_col.number_of_children() > 0)
+            {
+                for(index_t j = 0; j < batch_col.number_of_children(); j++)
+                {
+                    batch_leaves.push_back(&batch_col[j]);
+                    full_leaves.push_back(&full_col[j]);
+                }
+            }
+            else
+            {
+                batch_leaves.push_back(&batch_col);
+                full_leaves.push_back(&full_col);
+            }
+
+            for(size_t j = 0; j < batch_leaves.size(); j++)
+            {
+                nrows = batch_leaves[j]->dtype().number_of_elements();
+                Node expected;
+                expected.set_external(DataType(full_leaves[j]->dtype().id(), nrows,
+                    full_leaves[j]->dtype().element_index(row_offset),
+                    full_leaves[j]->dtype().element_bytes(),
+                    full_leaves[j]->dtype().element_bytes(),
+                    full_leaves[j]->dtype().endianness()),
+                    const_cast<void *>(full_leaves[j]->data_ptr()));
+                EXPECT_FALSE(expected.diff(*batch_leaves[j], info)) << info.to_json();
+            }
+        }
+        EXPECT_LE(nrows, batch_rows);
+        next_row[table_name] += nrows;
+    });
+
+    EXPECT_EQ(next_row["vertex_data"],
+        table["vertex_data/values/domain_id"].dtype().number_of_elements());
+    EXPECT_EQ(next_row["element_data"],
+        table["element_data/values/domain_id"].dtype().number_of_elements());
+}
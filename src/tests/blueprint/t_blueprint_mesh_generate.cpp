@@ -1005,6 +1005,137 @@ TEST(conduit_blueprint_generate_unstructured, generate_offsets_poly)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, generate_offsets_int32)
+{
+    // int32 topologies should produce int32 offsets and polytopal
+    // conversions, rather than widening to index_t
+    Node mesh;
+    mesh::examples::braid("hexs", 3, 3, 3, mesh);
+    Node &topo = mesh["topologies"].child(0);
+    Node conn;
+    topo["elements/connectivity"].to_int32_array(conn);
+    topo["elements/connectivity"].set(conn);
+
+    Node offsets;
+    mesh::topology::unstructured::generate_offsets(topo, offsets);
+    EXPECT_TRUE(offsets.dtype().is_int32());
+    int32_array offsets_vals = offsets.value();
+    for(index_t oi = 0; oi < offsets_vals.number_of_elements(); oi++)
+    {
+        EXPECT_EQ(offsets_vals[oi], oi * 8);
+    }
+
+    Node poly_topo;
+    mesh::topology::unstructured::to_polygonal(topo, poly_topo);
+    EXPECT_TRUE(poly_topo["elements/connectivity"].dtype().is_int32());
+    EXPECT_TRUE(poly_topo["elements/sizes"].dtype().is_int32());
+    EXPECT_TRUE(poly_topo["elements/offsets"].dtype().is_int32());
+    EXPECT_TRUE(poly_topo["subelements/connectivity"].dtype().is_int32());
+    EXPECT_TRUE(poly_topo["subelements/sizes"].dtype().is_int32());
+    EXPECT_TRUE(poly_topo["subelements/offsets"].dtype().is_int32());
+
+    // the int32 polyhedral result matches the int64 one
+    Node topo64, poly_topo64;
+    topo64.set(topo);
+    topo["elements/connectivity"].to_int64_array(conn);
+    topo64["elements/connectivity"].set(conn);
+    mesh::topology::unstructured::to_polygonal(topo64, poly_topo64);
+    EXPECT_TRUE(poly_topo64["subelements/offsets"].dtype().is_int64());
+
+    Node info;
+    const std::string paths[] = {"elements/connectivity",
+                                 "elements/sizes",
+                                 "elements/offsets",
+                                 "subelements/connectivity",
+                                 "subelements/sizes",
+                                 "subelements/offsets"};
+    for(const std::string &path : paths)
+    {
+        Node path_cast;
+        poly_topo[path].to_int64_array(path_cast);
+        EXPECT_FALSE(path_cast.diff(poly_topo64[path], info)) << path;
+    }
+
+    Node poly_offsets, poly_subele_offsets;
+    poly_topo["elements"].remove("offsets");
+    mesh::topology::unstructured::generate_offsets(poly_topo,
+                                                   poly_offsets,
+                                                   poly_subele_offsets);
+    EXPECT_TRUE(poly_offsets.dtype().is_int32());
+    EXPECT_TRUE(poly_subele_offsets.dtype().is_int32());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, generate_offsets_num_threads)
+{
+    // large enough for the prefix sum to be split over several threads
+    const index_t num_elems = 100003;
+    Node topo;
+    topo["type"] = "unstructured";
+    topo["coordset"] = "coords";
+    topo["elements/shape"] = "polyhedral";
+    topo["subelements/shape"] = "polygonal";
+    std::vector<int32> sizes(num_elems), subsizes(num_elems);
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        sizes[ei] = static_cast<int32>(4 + ei % 5);
+        subsizes[ei] = static_cast<int32>(3 + ei % 3);
+    }
+    topo["elements/connectivity"].set(DataType::int32(0));
+    topo["elements/sizes"].set(sizes);
+    topo["subelements/connectivity"].set(DataType::int32(0));
+    topo["subelements/sizes"].set(subsizes);
+
+    Node offsets_serial, suboffsets_serial;
+    mesh::topology::unstructured::generate_offsets(topo,
+                                                   offsets_serial,
+                                                   suboffsets_serial);
+    EXPECT_TRUE(offsets_serial.dtype().is_int32());
+
+    int32_array offsets_vals = offsets_serial.value();
+    int32 expected_offset = 0;
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        ASSERT_EQ(offsets_vals[ei], expected_offset);
+        expected_offset += sizes[ei];
+    }
+
+    const int thread_counts[] = {2, 3, 8, -1};
+    for(const int num_threads : thread_counts)
+    {
+        Node opts;
+        opts["num_threads"] = num_threads;
+
+        Node offsets, suboffsets, info;
+        mesh::topology::unstructured::generate_offsets(topo,
+                                                       offsets,
+                                                       suboffsets,
+                                                       opts);
+        EXPECT_FALSE(offsets.diff(offsets_serial, info)) << num_threads;
+        EXPECT_FALSE(suboffsets.diff(suboffsets_serial, info)) << num_threads;
+
+        Node topo_inline;
+        topo_inline.set(topo);
+        mesh::topology::unstructured::generate_offsets_inline(topo_inline, opts);
+        EXPECT_FALSE(topo_inline["elements/offsets"].diff(offsets_serial, info));
+        EXPECT_FALSE(topo_inline["subelements/offsets"].diff(suboffsets_serial, info));
+    }
+
+    // single shape offsets
+    Node hex_mesh;
+    mesh::examples::braid("hexs", 40, 40, 40, hex_mesh);
+    const Node &hex_topo = hex_mesh["topologies"].child(0);
+    Node hex_offsets_serial, hex_offsets, hex_suboffsets, opts, info;
+    mesh::topology::unstructured::generate_offsets(hex_topo, hex_offsets_serial);
+    opts["num_threads"] = 4;
+    mesh::topology::unstructured::generate_offsets(hex_topo,
+                                                   hex_offsets,
+                                                   hex_suboffsets,
+                                                   opts);
+    EXPECT_FALSE(hex_offsets.diff(hex_offsets_serial, info));
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_generate_unstructured, generate_centroids)
 {
@@ -1085,6 +1216,212 @@ TEST(conduit_blueprint_generate_unstructured, generate_centroids)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, generate_centroids_options)
+{
+    const std::string mesh_types[] = {"uniform", "rectilinear", "structured",
+        "tris", "quads", "tets", "hexs", "wedges", "pyramids"};
+    for(const std::string &mesh_type : mesh_types)
+    {
+        for(index_t dim = 2; dim <= 3; dim++)
+        {
+            const bool is_2d_type = mesh_type == "tris" || mesh_type == "quads";
+            const bool is_3d_type = mesh_type == "tets" || mesh_type == "hexs" ||
+                mesh_type == "wedges" || mesh_type == "pyramids";
+            if((dim == 2 && is_3d_type) || (dim == 3 && is_2d_type)) { continue; }
+
+            // large enough for the elements to be split over several threads
+            const index_t npts = dim == 3 ? 21 : 81;
+            Node mesh;
+            mesh::examples::braid(mesh_type, npts, npts, dim == 3 ? npts : 0, mesh);
+            const Node &topo = mesh["topologies"].child(0);
+            const Node &coords = mesh["coordsets"].child(0);
+            const index_t num_elems = bputils::topology::length(topo);
+
+            // reference centroids from the unstructured form of the topology
+            Node utopo, ucoords;
+            const std::string topo_type = topo["type"].as_string();
+            if(topo_type == "uniform")
+            {
+                mesh::topology::uniform::to_unstructured(topo, utopo, ucoords);
+            }
+            else if(topo_type == "rectilinear")
+            {
+                mesh::topology::rectilinear::to_unstructured(topo, utopo, ucoords);
+            }
+            else if(topo_type == "structured")
+            {
+                mesh::topology::structured::to_unstructured(topo, utopo, ucoords);
+            }
+            else
+            {
+                utopo.set_external(topo);
+                ucoords.set_external(coords);
+            }
+            const std::vector<std::string> axes = bputils::coordset::axes(coords);
+            const index_t elem_indices =
+                bputils::ShapeType(utopo).indices;
+            index_t_accessor uconn = utopo["elements/connectivity"].value();
+
+            Node opts;
+            opts["num_threads"] = 4;
+            Node cent_topo, cent_coords, s2dmap, d2smap, measures;
+            mesh::topology::unstructured::generate_centroids(
+                topo, cent_topo, cent_coords, s2dmap, d2smap, measures, opts);
+
+            Node info;
+            EXPECT_TRUE(mesh::coordset::_explicit::verify(cent_coords, info));
+            EXPECT_TRUE(mesh::topology::unstructured::verify(cent_topo, info));
+            EXPECT_EQ(cent_topo["elements/connectivity"].dtype().number_of_elements(),
+                      num_elems);
+            EXPECT_EQ(s2dmap.dtype().number_of_elements(), 2 * num_elems);
+
+            for(index_t ai = 0; ai < (index_t)axes.size(); ai++)
+            {
+                float64_accessor uaxis = ucoords["values"][axes[ai]].value();
+                float64_accessor caxis = cent_coords["values"][axes[ai]].value();
+                ASSERT_EQ(caxis.number_of_elements(), num_elems);
+                for(index_t ei = 0; ei < num_elems; ei++)
+                {
+                    float64 expected = 0.0;
+                    for(index_t pi = 0; pi < elem_indices; pi++)
+                    {
+                        expected += uaxis[uconn[ei * elem_indices + pi]];
+                    }
+                    expected /= elem_indices;
+                    EXPECT_NEAR(caxis[ei], expected, 1e-10) << mesh_type;
+                }
+            }
+
+            // braid elements tile the [-10,10]^dim box
+            EXPECT_EQ(measures["topology"].as_string(), topo.name());
+            EXPECT_EQ(measures["association"].as_string(), "element");
+            float64_array measure_vals = measures["values"].value();
+            EXPECT_EQ(measure_vals.number_of_elements(), num_elems);
+            EXPECT_NEAR(measure_vals.sum(), dim == 3 ? 8000.0 : 400.0, 1e-8)
+                << mesh_type;
+
+            // results don't depend on the number of threads
+            Node cent_topo1, cent_coords1, s2dmap1, d2smap1, measures1;
+            mesh::topology::unstructured::generate_centroids(
+                topo, cent_topo1, cent_coords1, s2dmap1, d2smap1);
+            EXPECT_FALSE(cent_coords1.diff(cent_coords, info));
+            EXPECT_FALSE(cent_topo1.diff(cent_topo, info));
+            EXPECT_FALSE(s2dmap1.diff(s2dmap, info));
+        }
+    }
+
+    // element measures aren't supported for polytopal topologies
+    Node poly_mesh;
+    mesh::examples::braid("quads_poly", 3, 3, 0, poly_mesh);
+    Node cent_topo, cent_coords, s2dmap, d2smap, measures, opts;
+    EXPECT_THROW(mesh::topology::unstructured::generate_centroids(
+        poly_mesh["topologies"].child(0), cent_topo, cent_coords,
+        s2dmap, d2smap, measures, opts), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, coord_accessor)
+{
+    const std::string mesh_types[] = {"uniform", "rectilinear", "structured"};
+    for(const std::string &mesh_type : mesh_types)
+    {
+        for(index_t dim = 2; dim <= 3; dim++)
+        {
+            Node mesh;
+            mesh::examples::braid(mesh_type, 4, 5, dim > 2 ? 3 : 0, mesh);
+            const Node &coords = mesh["coordsets"].child(0);
+            const std::string cset_type = coords["type"].as_string();
+
+            Node ecoords;
+            if(cset_type == "uniform")
+            {
+                mesh::coordset::uniform::to_explicit(coords, ecoords);
+            }
+            else if(cset_type == "rectilinear")
+            {
+                mesh::coordset::rectilinear::to_explicit(coords, ecoords);
+            }
+            else
+            {
+                ecoords.set_external(coords);
+            }
+
+            const bputils::coordset::CoordAccessor acc(coords);
+            const std::vector<std::string> axes = bputils::coordset::axes(coords);
+            EXPECT_EQ(acc.dims(), (index_t)axes.size());
+            EXPECT_EQ(acc.size(), bputils::coordset::length(coords));
+            EXPECT_EQ(acc.is_implicit(), cset_type != "explicit");
+
+            std::vector<float32> batch((size_t)acc.size());
+            for(index_t ai = 0; ai < acc.dims(); ai++)
+            {
+                float64_accessor evals = ecoords["values"][axes[ai]].value();
+                ASSERT_EQ(evals.number_of_elements(), acc.size());
+                acc.values(ai, 0, acc.size(), batch.data());
+                for(index_t pi = 0; pi < acc.size(); pi++)
+                {
+                    EXPECT_EQ(acc.axis(ai)[pi], evals[pi]) << mesh_type;
+                    EXPECT_EQ(batch[pi], (float32)evals[pi]);
+                }
+
+                const int32 ids[] = {3, 0, 2};
+                float64 gathered[3];
+                acc.gather(ai, ids, 3, gathered);
+                for(index_t i = 0; i < 3; i++)
+                {
+                    EXPECT_EQ(gathered[i], evals[ids[i]]);
+                }
+            }
+
+            float64 p[3];
+            acc.point(acc.size() - 1, p);
+            EXPECT_EQ(p[0], acc.x(acc.size() - 1));
+            EXPECT_EQ(p[1], dim > 1 ? acc.y(acc.size() - 1) : 0.0);
+            EXPECT_EQ(p[2], dim > 2 ? acc.z(acc.size() - 1) : 0.0);
+        }
+    }
+
+    // uniform coordsets with origin and spacing, and the centroids of an
+    // unstructured topology that refers to one
+    Node mesh;
+    mesh::examples::basic("uniform", 4, 3, 0, mesh);
+    mesh["coordsets/coords/origin/x"] = -2.0;
+    mesh["coordsets/coords/origin/y"] = 5.0;
+    mesh["coordsets/coords/spacing/dx"] = 0.5;
+    mesh["coordsets/coords/spacing/dy"] = 2.0;
+    Node &ucoords = mesh["coordsets/coords"];
+    Node ecoords;
+    mesh::coordset::uniform::to_explicit(ucoords, ecoords);
+    const bputils::coordset::CoordAccessor acc(ucoords);
+    float64_accessor ex = ecoords["values/x"].value();
+    float64_accessor ey = ecoords["values/y"].value();
+    for(index_t pi = 0; pi < acc.size(); pi++)
+    {
+        EXPECT_EQ(acc.x(pi), ex[pi]);
+        EXPECT_EQ(acc.y(pi), ey[pi]);
+    }
+
+    Node utopo, ucset_tmp;
+    mesh::topology::uniform::to_unstructured(mesh["topologies/mesh"], utopo, ucset_tmp);
+    Node &impl_mesh = mesh;
+    impl_mesh["topologies/umesh"].set(utopo);
+    impl_mesh["topologies/umesh/coordset"] = "coords";
+    Node expl_mesh;
+    expl_mesh["coordsets/coords"].set(ecoords);
+    expl_mesh["topologies/umesh"].set(utopo);
+    expl_mesh["topologies/umesh/coordset"] = "coords";
+
+    Node cent_topo, cent_coords, s2dmap, d2smap;
+    mesh::topology::unstructured::generate_centroids(
+        impl_mesh["topologies/umesh"], cent_topo, cent_coords, s2dmap, d2smap);
+    Node ecent_topo, ecent_coords, es2dmap, ed2smap;
+    mesh::topology::unstructured::generate_centroids(
+        expl_mesh["topologies/umesh"], ecent_topo, ecent_coords, es2dmap, ed2smap);
+    Node info;
+    EXPECT_FALSE(cent_coords.diff(ecent_coords, info, 1e-12));
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_generate_unstructured, generate_points)
 {
@@ -1320,6 +1657,229 @@ TEST(conduit_blueprint_generate_unstructured, generate_faces)
     }
 }
 
+//-----------------------------------------------------------------------------
+static std::vector<index_t>
+span_to_vector(const Span<const index_t> &span)
+{
+    return std::vector<index_t>(span.begin(), span.end());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, topology_metadata)
+{
+    // two quads, numbered as in the 'TopologyMetadata' example:
+    //
+    //   p3      l2      p4      l6      p5
+    //   +---------------+---------------+
+    //   |               |               |
+    // l3|      f0       |l1    f1       |l5
+    //   |               |               |
+    //   +---------------+---------------+
+    //   p0      l0      p1      l4      p2
+    Node mesh;
+    mesh["coordsets/coords/type"] = "explicit";
+    mesh["coordsets/coords/values/x"].set(std::vector<float64>{0, 1, 2, 0, 1, 2});
+    mesh["coordsets/coords/values/y"].set(std::vector<float64>{0, 0, 0, 1, 1, 1});
+    mesh["topologies/mesh/type"] = "unstructured";
+    mesh["topologies/mesh/coordset"] = "coords";
+    mesh["topologies/mesh/elements/shape"] = "quad";
+    mesh["topologies/mesh/elements/connectivity"].set(
+        std::vector<int32>{0, 1, 4, 3, 1, 2, 5, 4});
+
+    typedef bputils::TopologyMetadata TM;
+    TM topo_data(mesh["topologies/mesh"], mesh["coordsets/coords"]);
+
+    EXPECT_EQ(topo_data.get_length(0), 6);
+    EXPECT_EQ(topo_data.get_length(1), 7);
+    EXPECT_EQ(topo_data.get_length(2), 2);
+    EXPECT_EQ(topo_data.dim_le2ge_maps[1],
+              std::vector<index_t>({0, 1, 2, 3, 4, 5, 6, 1}));
+    // 6 topology points and 2 points for each of the 8 local lines
+    EXPECT_EQ(topo_data.dim_le2ge_maps[0].size(), 22);
+
+    // global associations are unique and in cascade order
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::GLOBAL, 1, 2, 1)),
+              std::vector<index_t>({4, 5, 6, 1}));
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::GLOBAL, 0, 2, 0)),
+              std::vector<index_t>({0, 1, 4, 3}));
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::GLOBAL, 1, 1, 2)),
+              std::vector<index_t>({0, 1}));
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::GLOBAL, 4, 0, 1)),
+              std::vector<index_t>({1, 2, 6}));
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::GLOBAL, 3, 1, 1)),
+              std::vector<index_t>({3}));
+
+    // local associations follow each entity's cascade
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::LOCAL, 1, 2, 1)),
+              std::vector<index_t>({4, 5, 6, 7}));
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::LOCAL, 0, 2, 0)),
+              std::vector<index_t>({6, 7, 8, 9, 10, 11, 12, 13}));
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::LOCAL, 15, 0, 1)),
+              std::vector<index_t>({4}));
+    EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::LOCAL, 15, 0, 2)),
+              std::vector<index_t>({1}));
+    EXPECT_TRUE(topo_data.get_entity_assocs(TM::LOCAL, 0, 0, 1).empty());
+
+    Node l2f_map;
+    topo_data.get_dim_map(TM::GLOBAL, 1, 2, l2f_map);
+    index_t_accessor l2f_sizes = l2f_map["sizes"].value();
+    index_t_accessor l2f_values = l2f_map["values"].value();
+    const index_t l2f_sizes_exp[] = {1, 2, 1, 1, 1, 1, 1};
+    const index_t l2f_values_exp[] = {0, 0, 1, 0, 0, 1, 1, 1};
+    ASSERT_EQ(l2f_sizes.number_of_elements(), 7);
+    ASSERT_EQ(l2f_values.number_of_elements(), 8);
+    for(index_t i = 0; i < 7; i++)
+    {
+        EXPECT_EQ(l2f_sizes[i], l2f_sizes_exp[i]);
+    }
+    for(index_t i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(l2f_values[i], l2f_values_exp[i]);
+    }
+
+    Node f2p_map;
+    topo_data.get_dim_map(TM::LOCAL, 2, 0, f2p_map);
+    EXPECT_EQ(f2p_map["sizes"].dtype().number_of_elements(), 2);
+    EXPECT_EQ(f2p_map["values"].dtype().number_of_elements(), 16);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, topology_metadata_options)
+{
+    // the two quads of the 'topology_metadata' test
+    Node mesh;
+    mesh["coordsets/coords/type"] = "explicit";
+    mesh["coordsets/coords/values/x"].set(std::vector<float64>{0, 1, 2, 0, 1, 2});
+    mesh["coordsets/coords/values/y"].set(std::vector<float64>{0, 0, 0, 1, 1, 1});
+    mesh["topologies/mesh/type"] = "unstructured";
+    mesh["topologies/mesh/coordset"] = "coords";
+    mesh["topologies/mesh/elements/shape"] = "quad";
+    mesh["topologies/mesh/elements/connectivity"].set(
+        std::vector<int32>{0, 1, 4, 3, 1, 2, 5, 4});
+    const Node &topo = mesh["topologies/mesh"];
+    const Node &coords = mesh["coordsets/coords"];
+
+    typedef bputils::TopologyMetadata TM;
+    const TM full_data(topo, coords);
+
+    // only the lines, with the face <-> line maps built up front
+    Node opts;
+    opts["dims"].set(1);
+    opts["associations"].set(std::vector<index_t>{2, 1, 1, 2});
+    {
+        const TM topo_data(topo, coords, opts);
+        EXPECT_EQ(topo_data.get_length(0), 0);
+        EXPECT_EQ(topo_data.get_length(1), 7);
+        EXPECT_EQ(topo_data.get_length(2), 2);
+        EXPECT_EQ(topo_data.dim_le2ge_maps[1], full_data.dim_le2ge_maps[1]);
+        EXPECT_FALSE(topo_data.dim_gassoc_offsets[2 * 3 + 1].empty());
+
+        for(index_t li = 0; li < 7; li++)
+        {
+            EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::GLOBAL, li, 1, 2)),
+                      span_to_vector(full_data.get_entity_assocs(TM::GLOBAL, li, 1, 2)));
+        }
+
+        // the lines are unbuilt, so queries on them fail
+        EXPECT_THROW(topo_data.get_entity_assocs(TM::GLOBAL, 0, 2, 0), conduit::Error);
+        Node map;
+        EXPECT_THROW(topo_data.get_dim_map(TM::GLOBAL, 0, 1, map), conduit::Error);
+    }
+
+    // unrequested pairs are built on their first query
+    opts["dims"].set(std::vector<index_t>{2, 0});
+    opts["associations"].set(std::vector<index_t>{2, 0});
+    {
+        const TM topo_data(topo, coords, opts);
+        EXPECT_TRUE(topo_data.dim_gassoc_offsets[0 * 3 + 1].empty());
+        Node map, full_map, info;
+        topo_data.get_dim_map(TM::GLOBAL, 0, 1, map);
+        full_data.get_dim_map(TM::GLOBAL, 0, 1, full_map);
+        EXPECT_FALSE(map.diff(full_map, info));
+        EXPECT_FALSE(topo_data.dim_gassoc_offsets[0 * 3 + 1].empty());
+    }
+
+    // without local associations, only the requested pairs can be queried
+    opts["local"].set(0);
+    {
+        const TM topo_data(topo, coords, opts);
+        EXPECT_TRUE(topo_data.dim_lancestors.empty());
+        EXPECT_EQ(span_to_vector(topo_data.get_entity_assocs(TM::GLOBAL, 1, 2, 0)),
+                  std::vector<index_t>({1, 2, 5, 4}));
+        EXPECT_THROW(topo_data.get_entity_assocs(TM::GLOBAL, 0, 0, 2), conduit::Error);
+        EXPECT_THROW(topo_data.get_entity_assocs(TM::LOCAL, 0, 2, 1), conduit::Error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, generate_num_threads)
+{
+    // results must not depend on the number of threads
+    const std::string mesh_types[] = {"tets", "hexs", "quads"};
+    for(const std::string &mesh_type : mesh_types)
+    {
+        Node mesh;
+        const index_t npts = (mesh_type == "quads") ? 40 : 7;
+        mesh::examples::braid(mesh_type, npts, npts,
+            (mesh_type == "quads") ? 0 : npts, mesh);
+        const Node &topo = mesh["topologies"].child(0);
+        const index_t topo_dim = bputils::ShapeType(topo).dim;
+
+        Node serial_opts, threaded_opts, info;
+        serial_opts["num_threads"] = 1;
+        threaded_opts["num_threads"] = 4;
+        for(index_t di = 0; di < topo_dim; di++)
+        {
+            Node res[2], s2d[2], d2s[2];
+            for(index_t ri = 0; ri < 2; ri++)
+            {
+                const Node &opts = (ri == 0) ? serial_opts : threaded_opts;
+                if(di == 0)
+                {
+                    mesh::topology::unstructured::generate_points(topo, res[ri], s2d[ri], d2s[ri], opts);
+                }
+                else if(di == 1)
+                {
+                    mesh::topology::unstructured::generate_lines(topo, res[ri], s2d[ri], d2s[ri], opts);
+                }
+                else
+                {
+                    mesh::topology::unstructured::generate_faces(topo, res[ri], s2d[ri], d2s[ri], opts);
+                }
+            }
+            EXPECT_FALSE(res[0].diff(res[1], info));
+            EXPECT_FALSE(s2d[0].diff(s2d[1], info));
+            EXPECT_FALSE(d2s[0].diff(d2s[1], info));
+        }
+
+        Node corner_topo[2], corner_coords[2], s2d[2], d2s[2];
+        mesh::topology::unstructured::generate_corners(topo,
+            corner_topo[0], corner_coords[0], s2d[0], d2s[0], serial_opts);
+        mesh::topology::unstructured::generate_corners(topo,
+            corner_topo[1], corner_coords[1], s2d[1], d2s[1], threaded_opts);
+        EXPECT_FALSE(corner_topo[0].diff(corner_topo[1], info));
+        EXPECT_FALSE(corner_coords[0].diff(corner_coords[1], info));
+        EXPECT_FALSE(d2s[0].diff(d2s[1], info));
+
+        // (field mapping needs a polytopal topology)
+        Node &poly_topo = mesh["topologies/poly"];
+        mesh::topology::unstructured::to_polytopal(topo, poly_topo);
+        mesh["fields/poly_radial"].set(mesh["fields/radial"]);
+        mesh["fields/poly_radial/topology"] = "poly";
+        serial_opts["field_names"] = "poly_radial";
+        threaded_opts["field_names"] = "poly_radial";
+
+        Node side_topo[2], side_coords[2], side_fields[2];
+        mesh::topology::unstructured::generate_sides(poly_topo,
+            side_topo[0], side_coords[0], side_fields[0], s2d[0], d2s[0], serial_opts);
+        mesh::topology::unstructured::generate_sides(poly_topo,
+            side_topo[1], side_coords[1], side_fields[1], s2d[1], d2s[1], threaded_opts);
+        EXPECT_FALSE(side_topo[0].diff(side_topo[1], info));
+        EXPECT_FALSE(side_fields[0].diff(side_fields[1], info));
+        EXPECT_FALSE(s2d[0].diff(s2d[1], info));
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_generate_unstructured, generate_sides)
 {
@@ -1670,3 +2230,129 @@ TEST(conduit_blueprint_generate_unstructured, generate_corners)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+// Returns the sorted point ids of each entity of an unstructured topology.
+std::vector<std::vector<index_t>>
+entity_point_sets(const Node &topo)
+{
+    const index_t indices = bputils::ShapeType(topo).indices;
+    index_t_accessor conn = topo["elements/connectivity"].value();
+    std::vector<std::vector<index_t>> res(conn.number_of_elements() / indices);
+    for(index_t ei = 0; ei < (index_t)res.size(); ei++)
+    {
+        for(index_t pi = 0; pi < indices; pi++)
+        {
+            res[ei].push_back(conn[ei * indices + pi]);
+        }
+        std::sort(res[ei].begin(), res[ei].end());
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// Returns the sorted (and mapped through 'id_map') ids of each one to many
+// map entry.
+std::vector<std::vector<index_t>>
+map_sets(const Node &map, const std::vector<index_t> &id_map)
+{
+    index_t_accessor values = map["values"].value();
+    index_t_accessor sizes = map["sizes"].value();
+    index_t_accessor offsets = map["offsets"].value();
+    std::vector<std::vector<index_t>> res(sizes.number_of_elements());
+    for(index_t i = 0; i < (index_t)res.size(); i++)
+    {
+        for(index_t j = 0; j < sizes[i]; j++)
+        {
+            const index_t value = values[offsets[i] + j];
+            res[i].push_back(id_map.empty() ? value : id_map[value]);
+        }
+        std::sort(res[i].begin(), res[i].end());
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_structured, generate_entities)
+{
+    typedef void (*GenerateFun)(const conduit::Node&, conduit::Node&,
+        conduit::Node&, conduit::Node&, const conduit::Node&);
+    const GenerateFun gen_funs[] = {
+        mesh::topology::unstructured::generate_points,
+        mesh::topology::unstructured::generate_lines,
+        mesh::topology::unstructured::generate_faces};
+
+    const std::string mesh_types[] = {"uniform", "rectilinear", "structured"};
+    for(const std::string &mesh_type : mesh_types)
+    {
+        for(index_t dim = 2; dim <= 3; dim++)
+        {
+            Node mesh;
+            mesh::examples::braid(mesh_type, 4, 3, dim == 3 ? 5 : 0, mesh);
+            const Node &topo = mesh["topologies"].child(0);
+
+            // reference entities from the unstructured form of the topology
+            Node &utopo = mesh["topologies/utopo"];
+            Node &ucoords = mesh["coordsets/ucoords"];
+            if(mesh_type == "uniform")
+            {
+                mesh::topology::uniform::to_unstructured(topo, utopo, ucoords);
+            }
+            else if(mesh_type == "rectilinear")
+            {
+                mesh::topology::rectilinear::to_unstructured(topo, utopo, ucoords);
+            }
+            else
+            {
+                mesh::topology::structured::to_unstructured(topo, utopo, ucoords);
+            }
+            utopo["coordset"] = "ucoords";
+
+            for(index_t edim = 0; edim < dim; edim++)
+            {
+                Node opts;
+                opts["num_threads"] = 2;
+                Node ents, s2dmap, d2smap, uents, us2dmap, ud2smap, info;
+                gen_funs[edim](topo, ents, s2dmap, d2smap, opts);
+                gen_funs[edim](utopo, uents, us2dmap, ud2smap, opts);
+
+                EXPECT_TRUE(mesh::topology::unstructured::verify(ents, info));
+                EXPECT_EQ(ents["coordset"].as_string(), topo["coordset"].as_string());
+
+                // the same entities (up to numbering)
+                const std::vector<std::vector<index_t>> pts = entity_point_sets(ents);
+                const std::vector<std::vector<index_t>> upts = entity_point_sets(uents);
+                ASSERT_EQ(pts.size(), upts.size()) << mesh_type << " " << edim;
+                std::map<std::vector<index_t>, index_t> upts_ids;
+                for(index_t ui = 0; ui < (index_t)upts.size(); ui++)
+                {
+                    upts_ids[upts[ui]] = ui;
+                }
+                std::vector<index_t> ent_to_uent(pts.size());
+                for(index_t ei = 0; ei < (index_t)pts.size(); ei++)
+                {
+                    ASSERT_EQ(upts_ids.count(pts[ei]), 1u);
+                    ent_to_uent[ei] = upts_ids[pts[ei]];
+                }
+
+                // the same associations
+                const std::vector<index_t> no_map;
+                EXPECT_EQ(map_sets(s2dmap, ent_to_uent), map_sets(us2dmap, no_map));
+                std::vector<std::vector<index_t>> d2s = map_sets(d2smap, no_map);
+                const std::vector<std::vector<index_t>> ud2s = map_sets(ud2smap, no_map);
+                ASSERT_EQ(d2s.size(), ud2s.size());
+                for(index_t ei = 0; ei < (index_t)d2s.size(); ei++)
+                {
+                    EXPECT_EQ(d2s[ei], ud2s[ent_to_uent[ei]]);
+                }
+
+                // results don't depend on the number of threads
+                Node ents1, s2dmap1, d2smap1, opts1;
+                gen_funs[edim](topo, ents1, s2dmap1, d2smap1, opts1);
+                EXPECT_FALSE(ents1.diff(ents, info));
+                EXPECT_FALSE(s2dmap1.diff(s2dmap, info));
+                EXPECT_FALSE(d2smap1.diff(d2smap, info));
+            }
+        }
+    }
+}
@@ -253,3 +253,342 @@ TEST(conduit_blueprint_mesh_matset_xforms, mesh_util_venn_to_silo_matset_values)
     }
 
 }
+
+
+//-----------------------------------------------------------------------------
+// Converts 'node' to float64 and checks it against 'expected'
+static void
+check_values(const Node &node, const std::vector<float64> &expected)
+{
+    Node vals;
+    node.to_float64_array(vals);
+    float64_array vals_arr = vals.value();
+    ASSERT_EQ(vals_arr.number_of_elements(), (index_t)expected.size());
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(vals_arr[i], expected[i]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+check_values(const Node &node, const Node &expected)
+{
+    Node expected_vals;
+    expected.to_float64_array(expected_vals);
+    const float64 *expected_ptr = expected_vals.value();
+    check_values(node, std::vector<float64>(expected_ptr,
+        expected_ptr + expected_vals.dtype().number_of_elements()));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, matset_conversions_o2m_indices)
+{
+    // the uni-buffer example from the blueprint docs, which uses indices
+    Node mset;
+    mset["topology"] = "topo";
+    mset["material_map/a"] = 1;
+    mset["material_map/b"] = 2;
+    mset["material_map/c"] = 0;
+    const int32 mids[] = {0, 1, 2, 2, 2, 0, 1, 0};
+    const float64 vfs[] = {0., 0.6, 1., 0.7, 0.4, 0., 0.3, 0.};
+    const int32 sizes[] = {2, 2, 1};
+    const int32 offsets[] = {0, 2, 4};
+    const int32 indices[] = {1, 4, 6, 3, 2};
+    mset["material_ids"].set(mids, 8);
+    mset["volume_fractions"].set(vfs, 8);
+    mset["sizes"].set(sizes, 3);
+    mset["offsets"].set(offsets, 3);
+    mset["indices"].set(indices, 5);
+
+    Node res, info;
+    blueprint::mesh::matset::to_sparse_by_element(mset, res);
+    EXPECT_TRUE(blueprint::mesh::matset::verify(res, info));
+    check_values(res["volume_fractions"], {0.6, 0.4, 0.3, 0.7, 1.});
+    check_values(res["material_ids"], {1, 2, 1, 2, 2});
+    check_values(res["sizes"], {2, 2, 1});
+    check_values(res["offsets"], {0, 2, 4});
+
+    blueprint::mesh::matset::to_multi_buffer_full(mset, res);
+    EXPECT_TRUE(blueprint::mesh::matset::verify(res, info));
+    check_values(res["volume_fractions/a"], {0.6, 0.3, 0.});
+    check_values(res["volume_fractions/b"], {0.4, 0.7, 1.});
+    check_values(res["volume_fractions/c"], {0., 0., 0.});
+
+    blueprint::mesh::matset::to_multi_buffer_by_material(mset, res);
+    EXPECT_TRUE(blueprint::mesh::matset::verify(res, info));
+    check_values(res["volume_fractions/a"], {0.6, 0.3});
+    check_values(res["element_ids/a"], {0, 1});
+    check_values(res["volume_fractions/b"], {0.4, 0.7, 1.});
+    check_values(res["element_ids/b"], {0, 1, 2});
+    EXPECT_EQ(res["volume_fractions/c"].dtype().number_of_elements(), 0);
+    EXPECT_EQ(res["element_ids/c"].dtype().number_of_elements(), 0);
+
+    blueprint::mesh::matset::to_uni_buffer_by_material(mset, res);
+    EXPECT_TRUE(blueprint::mesh::matset::verify(res, info));
+    check_values(res["volume_fractions"], {0.6, 0.3, 0.4, 0.7, 1.});
+    check_values(res["material_ids"], {1, 1, 2, 2, 2});
+    check_values(res["element_ids"], {0, 1, 0, 1, 2});
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, matset_conversions_venn)
+{
+    const int nx = 4, ny = 4;
+    const double radius = 0.25;
+
+    Node baseline_mesh, baseline_silo, baseline_field_silo;
+    blueprint::mesh::examples::venn("full", nx, ny, radius, baseline_mesh);
+    blueprint::mesh::matset::to_silo(baseline_mesh["matsets/matset"], baseline_silo);
+    blueprint::mesh::field::to_silo(baseline_mesh["fields/mat_check"],
+                                    baseline_mesh["matsets/matset"],
+                                    baseline_field_silo);
+
+    // every source flavor converted to every destination flavor should
+    // describe the same materials
+    const std::vector<std::string> venn_types = {"full",
+                                                 "sparse_by_material",
+                                                 "sparse_by_element",
+                                                 "uni_buffer_by_material"};
+    for(const std::string &venn_type : venn_types)
+    {
+        Node mesh;
+        if(venn_type == "uni_buffer_by_material")
+        {
+            blueprint::mesh::examples::venn("sparse_by_element", nx, ny, radius, mesh);
+            convert_to_material_based(mesh["topologies/topo"], mesh["matsets/matset"]);
+        }
+        else
+        {
+            blueprint::mesh::examples::venn(venn_type, nx, ny, radius, mesh);
+        }
+        const Node &mset = mesh["matsets/matset"];
+        const Node &field = mesh["fields/mat_check"];
+
+        for(int flavor = 0; flavor < 4; flavor++)
+        {
+            CONDUIT_INFO("venn " << venn_type << " to flavor " << flavor);
+            Node res_mset, res_field, info;
+            if(flavor == 0)
+            {
+                blueprint::mesh::matset::to_multi_buffer_full(mset, res_mset);
+                blueprint::mesh::field::to_multi_buffer_full(mset, field, "res", res_field);
+            }
+            else if(flavor == 1)
+            {
+                blueprint::mesh::matset::to_multi_buffer_by_material(mset, res_mset);
+                blueprint::mesh::field::to_multi_buffer_by_material(mset, field, "res", res_field);
+            }
+            else if(flavor == 2)
+            {
+                blueprint::mesh::matset::to_sparse_by_element(mset, res_mset);
+                blueprint::mesh::field::to_sparse_by_element(mset, field, "res", res_field);
+            }
+            else
+            {
+                blueprint::mesh::matset::to_uni_buffer_by_material(mset, res_mset);
+                blueprint::mesh::field::to_uni_buffer_by_material(mset, field, "res", res_field);
+            }
+
+            EXPECT_TRUE(blueprint::mesh::matset::verify(res_mset, info));
+            EXPECT_EQ(res_field["matset"].as_string(), "res");
+
+            Node res_silo, res_field_silo;
+            blueprint::mesh::matset::to_silo(res_mset, res_silo);
+            EXPECT_FALSE(res_silo.diff(baseline_silo, info));
+            blueprint::mesh::field::to_silo(res_field, res_mset, res_field_silo);
+            EXPECT_FALSE(res_field_silo.diff(baseline_field_silo, info));
+        }
+    }
+
+    // the element-dominant conversions of the full venn match the
+    // sparse venn flavors
+    Node full_mesh, sbe_mesh, sbm_mesh;
+    blueprint::mesh::examples::venn("full", nx, ny, radius, full_mesh);
+    blueprint::mesh::examples::venn("sparse_by_element", nx, ny, radius, sbe_mesh);
+    blueprint::mesh::examples::venn("sparse_by_material", nx, ny, radius, sbm_mesh);
+    const Node &full_mset = full_mesh["matsets/matset"];
+
+    Node res;
+    blueprint::mesh::matset::to_sparse_by_element(full_mset, res);
+    const std::vector<std::string> sbe_paths = {"volume_fractions", "material_ids",
+                                                "sizes", "offsets"};
+    for(const std::string &path : sbe_paths)
+    {
+        check_values(res[path], sbe_mesh["matsets/matset"][path]);
+    }
+
+    blueprint::mesh::matset::to_multi_buffer_by_material(full_mset, res);
+    NodeConstIterator mat_itr = sbm_mesh["matsets/matset/volume_fractions"].children();
+    while(mat_itr.has_next())
+    {
+        mat_itr.next();
+        const std::string mat_name = mat_itr.name();
+        for(const std::string &group : {std::string("volume_fractions"), std::string("element_ids")})
+        {
+            check_values(res[group][mat_name], sbm_mesh["matsets/matset"][group][mat_name]);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, matset_conversions_threads)
+{
+    Node mesh;
+    blueprint::mesh::examples::venn("sparse_by_element", 200, 200, 0.25, mesh);
+    const Node &mset = mesh["matsets/matset"];
+    const Node &field = mesh["fields/area"];
+
+    Node opts_1, opts_4;
+    opts_1["num_threads"] = 1;
+    opts_4["num_threads"] = 4;
+    for(int flavor = 0; flavor < 4; flavor++)
+    {
+        Node res_1, res_4, field_1, field_4, info;
+        if(flavor == 0)
+        {
+            blueprint::mesh::matset::to_multi_buffer_full(mset, res_1, opts_1);
+            blueprint::mesh::matset::to_multi_buffer_full(mset, res_4, opts_4);
+            blueprint::mesh::field::to_multi_buffer_full(mset, field, "res", field_1, opts_1);
+            blueprint::mesh::field::to_multi_buffer_full(mset, field, "res", field_4, opts_4);
+        }
+        else if(flavor == 1)
+        {
+            blueprint::mesh::matset::to_multi_buffer_by_material(mset, res_1, opts_1);
+            blueprint::mesh::matset::to_multi_buffer_by_material(mset, res_4, opts_4);
+            blueprint::mesh::field::to_multi_buffer_by_material(mset, field, "res", field_1, opts_1);
+            blueprint::mesh::field::to_multi_buffer_by_material(mset, field, "res", field_4, opts_4);
+        }
+        else if(flavor == 2)
+        {
+            blueprint::mesh::matset::to_sparse_by_element(mset, res_1, opts_1);
+            blueprint::mesh::matset::to_sparse_by_element(mset, res_4, opts_4);
+            blueprint::mesh::field::to_sparse_by_element(mset, field, "res", field_1, opts_1);
+            blueprint::mesh::field::to_sparse_by_element(mset, field, "res", field_4, opts_4);
+        }
+        else
+        {
+            blueprint::mesh::matset::to_uni_buffer_by_material(mset, res_1, opts_1);
+            blueprint::mesh::matset::to_uni_buffer_by_material(mset, res_4, opts_4);
+            blueprint::mesh::field::to_uni_buffer_by_material(mset, field, "res", field_1, opts_1);
+            blueprint::mesh::field::to_uni_buffer_by_material(mset, field, "res", field_4, opts_4);
+        }
+        EXPECT_FALSE(res_1.diff(res_4, info));
+        EXPECT_FALSE(field_1.diff(field_4, info));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, matset_reduce_by_material)
+{
+    // the uni-buffer example from the blueprint docs, which uses indices
+    Node mset;
+    mset["topology"] = "topo";
+    mset["material_map/a"] = 1;
+    mset["material_map/b"] = 2;
+    mset["material_map/c"] = 0;
+    const int32 mids[] = {0, 1, 2, 2, 2, 0, 1, 0};
+    const float64 vfs[] = {0., 0.6, 1., 0.7, 0.4, 0., 0.3, 0.};
+    const int32 sizes[] = {2, 2, 1};
+    const int32 offsets[] = {0, 2, 4};
+    const int32 indices[] = {1, 4, 6, 3, 2};
+    mset["material_ids"].set(mids, 8);
+    mset["volume_fractions"].set(vfs, 8);
+    mset["sizes"].set(sizes, 3);
+    mset["offsets"].set(offsets, 3);
+    mset["indices"].set(indices, 5);
+
+    Node field;
+    field["association"] = "element";
+    field["topology"] = "topo";
+    field["matset"] = "matset";
+    const float64 mvals[] = {0., 10., 20., 30., 40., 50., 60., 70.};
+    field["matset_values"].set(mvals, 8);
+
+    Node res;
+    blueprint::mesh::matset::reduce_by_material(mset, field, "sum", res);
+    EXPECT_EQ(res.number_of_children(), 2);
+    EXPECT_FALSE(res.has_child("c"));
+    EXPECT_EQ(res["a"].as_float64(), 70.);
+    EXPECT_EQ(res["b"].as_float64(), 90.);
+
+    blueprint::mesh::matset::reduce_by_material(mset, field, "min", res);
+    EXPECT_EQ(res["a"].as_float64(), 10.);
+    EXPECT_EQ(res["b"].as_float64(), 20.);
+
+    blueprint::mesh::matset::reduce_by_material(mset, field, "max", res);
+    EXPECT_EQ(res["a"].as_float64(), 60.);
+    EXPECT_EQ(res["b"].as_float64(), 40.);
+
+    blueprint::mesh::matset::reduce_by_material(mset, field, "average", res);
+    EXPECT_NEAR(res["a"].as_float64(), 24. / 0.9, 1e-12);
+    EXPECT_NEAR(res["b"].as_float64(), 57. / 2.1, 1e-12);
+
+    Node opts;
+    const float64 weights[] = {1., 2., 1.};
+    opts["element_weights"].set(weights, 3);
+    blueprint::mesh::matset::reduce_by_material(mset, field, "average", res, opts);
+    EXPECT_NEAR(res["a"].as_float64(), 42. / 1.2, 1e-12);
+    EXPECT_NEAR(res["b"].as_float64(), 78. / 2.8, 1e-12);
+
+    // entries at or below epsilon are skipped
+    opts.reset();
+    opts["epsilon"] = 0.5;
+    blueprint::mesh::matset::reduce_by_material(mset, field, "sum", res, opts);
+    EXPECT_EQ(res["a"].as_float64(), 10.);
+    EXPECT_EQ(res["b"].as_float64(), 50.);
+
+    EXPECT_THROW(blueprint::mesh::matset::reduce_by_material(mset, field, "median", res),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, matset_reduce_by_material_venn)
+{
+    const int nx = 20, ny = 20;
+    const double radius = 0.25;
+
+    // every matset flavor reduces to the same per material results
+    Node baseline;
+    const std::vector<std::string> venn_types = {"full",
+                                                 "sparse_by_material",
+                                                 "sparse_by_element"};
+    const std::vector<std::string> ops = {"sum", "min", "max", "average"};
+    for(const std::string &venn_type : venn_types)
+    {
+        Node mesh;
+        blueprint::mesh::examples::venn(venn_type, nx, ny, radius, mesh);
+        const Node &mset = mesh["matsets/matset"];
+        const Node &field = mesh["fields/importance"];
+
+        Node opts;
+        opts["num_threads"] = 4;
+        opts["element_weights"].set_external(mesh["fields/area/values"]);
+        Node res;
+        for(const std::string &op : ops)
+        {
+            blueprint::mesh::matset::reduce_by_material(mset, field, op,
+                                                        res[op], opts);
+        }
+
+        if(baseline.dtype().is_empty())
+        {
+            baseline.set(res);
+            EXPECT_EQ(baseline["sum"].number_of_children(), 4);
+            continue;
+        }
+
+        for(const std::string &op : ops)
+        {
+            NodeConstIterator mat_itr = baseline[op].children();
+            while(mat_itr.has_next())
+            {
+                const Node &expected = mat_itr.next();
+                EXPECT_NEAR(res[op][mat_itr.name()].as_float64(),
+                            expected.as_float64(), 1e-10);
+            }
+            EXPECT_EQ(res[op].number_of_children(),
+                      baseline[op].number_of_children());
+        }
+    }
+}
@@ -12,6 +12,7 @@
 #include "conduit_relay.hpp"
 #include "conduit_blueprint.hpp"
 #include "conduit_blueprint_mesh_partition.hpp"
+#include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_relay.hpp"
 #include "conduit_log.hpp"
 
@@ -2265,6 +2266,99 @@ TEST(conduit_blueprint_mesh_partition, matset_uni_by_material)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Matset values of fields are partitioned along with the matset, for each
+// matset flavor. Sums of the matset values by material are preserved.
+TEST(conduit_blueprint_mesh_partition, matset_field_values)
+{
+    namespace bpmesh = conduit::blueprint::mesh;
+    conduit::Node venn;
+    bpmesh::examples::venn("full", 7, 5, 0.33f, venn);
+    const conduit::Node &src_matset = venn["matsets/matset"];
+    const conduit::Node &src_field = venn["fields/area"];
+
+    for(int flavor = 0; flavor < 4; flavor++)
+    {
+        conduit::Node mesh;
+        mesh["coordsets"].set(venn["coordsets"]);
+        mesh["topologies"].set(venn["topologies"]);
+        conduit::Node &matset = mesh["matsets/matset"];
+        conduit::Node &field = mesh["fields/area"];
+        switch(flavor)
+        {
+        case 0:
+            bpmesh::matset::to_multi_buffer_full(src_matset, matset);
+            bpmesh::field::to_multi_buffer_full(src_matset, src_field, "matset", field);
+            break;
+        case 1:
+            bpmesh::matset::to_multi_buffer_by_material(src_matset, matset);
+            bpmesh::field::to_multi_buffer_by_material(src_matset, src_field, "matset", field);
+            break;
+        case 2:
+            bpmesh::matset::to_sparse_by_element(src_matset, matset);
+            bpmesh::field::to_sparse_by_element(src_matset, src_field, "matset", field);
+            break;
+        default:
+            // Lists each element once per material
+            bpmesh::matset::to_uni_buffer_by_material(src_matset, matset);
+            bpmesh::field::to_uni_buffer_by_material(src_matset, src_field, "matset", field);
+            break;
+        }
+
+        conduit::Node expected;
+        bpmesh::matset::reduce_by_material(matset, field, "sum", expected);
+
+        conduit::Node part, opts;
+        opts["target"].set(3);
+        bpmesh::partition(mesh, opts, part);
+        ASSERT_EQ(part.number_of_children(), 3);
+
+        std::map<std::string, double> sums;
+        for(conduit::index_t d = 0; d < part.number_of_children(); d++)
+        {
+            const conduit::Node &dom = part[d];
+            ASSERT_TRUE(dom.has_path("fields/area/matset_values")) << "Flavor " << flavor;
+            EXPECT_EQ(dom["fields/area/matset"].as_string(), "matset");
+
+            // Materials missing from a domain are left empty
+            conduit::Node dom_matset, dom_field;
+            dom_matset.set(dom["matsets/matset"]);
+            dom_field.set(dom["fields/area"]);
+            if(dom_matset["volume_fractions"].dtype().is_object())
+            {
+                const std::vector<std::string> names =
+                    dom_matset["volume_fractions"].child_names();
+                for(const std::string &name : names)
+                {
+                    if(dom_matset["volume_fractions"][name].dtype().is_empty())
+                    {
+                        EXPECT_TRUE(dom_field["matset_values"][name].dtype().is_empty());
+                        dom_matset["volume_fractions"].remove(name);
+                        dom_field["matset_values"].remove(name);
+                        if(dom_matset.has_child("element_ids"))
+                        {
+                            dom_matset["element_ids"].remove(name);
+                        }
+                    }
+                }
+            }
+
+            conduit::Node dom_sums;
+            bpmesh::matset::reduce_by_material(dom_matset, dom_field, "sum", dom_sums);
+            for(conduit::index_t i = 0; i < dom_sums.number_of_children(); i++)
+            {
+                sums[dom_sums[i].name()] += dom_sums[i].to_float64();
+            }
+        }
+
+        for(conduit::index_t i = 0; i < expected.number_of_children(); i++)
+        {
+            EXPECT_NEAR(sums[expected[i].name()], expected[i].to_float64(), 1e-9)
+                << "Flavor " << flavor << ", material " << expected[i].name();
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_partition, matset_mixed_topology)
 {
@@ -2671,3 +2765,565 @@ TEST(conduit_blueprint_mesh_partition, threshold_example)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_utils_kdtree, find_point)
+{
+    // Points on a jittered grid, with every 7th point repeated (within a
+    // tolerance) at the end.
+    const conduit::index_t n = 20;
+    const double tol = 1.e-6;
+    std::vector<double> coords;
+    for(conduit::index_t k = 0; k < n; k++)
+    for(conduit::index_t j = 0; j < n; j++)
+    for(conduit::index_t i = 0; i < n; i++)
+    {
+        coords.push_back(i + 0.1 * std::sin(double(i * j + k)));
+        coords.push_back(j + 0.1 * std::cos(double(j * k + i)));
+        coords.push_back(0.5 * k);
+    }
+    const conduit::index_t nunique = n * n * n;
+    for(conduit::index_t p = 0; p < nunique; p += 7)
+    {
+        coords.push_back(coords[p * 3] + 0.1 * tol);
+        coords.push_back(coords[p * 3 + 1]);
+        coords.push_back(coords[p * 3 + 2] - 0.1 * tol);
+    }
+    const conduit::index_t npts = (conduit::index_t)coords.size() / 3;
+
+    conduit::blueprint::mesh::utils::kdtree<double, 3> tree, tree4;
+    tree.set_bucket_size(8);
+    tree.build(coords.data(), npts);
+    tree4.set_bucket_size(8);
+    tree4.build(coords.data(), npts, 4);
+    EXPECT_EQ(tree.size(), npts);
+    EXPECT_EQ(tree.nodes(), tree4.nodes());
+    EXPECT_EQ(tree.depth(), tree4.depth());
+    EXPECT_GT(tree.depth(), 1);
+
+    std::vector<conduit::index_t> ids(npts), ids4(npts), neighbors;
+    tree.find_point(coords.data(), npts, tol, ids.data());
+    tree4.find_point(coords.data(), npts, tol, ids4.data(), 4);
+    EXPECT_EQ(ids, ids4);
+    for(conduit::index_t p = 0; p < npts; p++)
+    {
+        const conduit::index_t expected = (p < nunique) ? p : (p - nunique) * 7;
+        EXPECT_EQ(ids[p], expected);
+
+        tree.find_points(&coords[p * 3], tol, neighbors);
+        const bool repeated = (p < nunique) ? (p % 7 == 0) : true;
+        ASSERT_EQ(neighbors.size(), repeated ? 2u : 1u);
+        EXPECT_EQ(neighbors[0], expected);
+    }
+
+    // points away from the input
+    const double outside[] = {0.5, 0.5, 0.25};
+    EXPECT_EQ(tree.find_point(outside, tol),
+              (conduit::blueprint::mesh::utils::kdtree<double, 3>::NOT_FOUND));
+    EXPECT_EQ(tree.find_point(outside, 1.), 0);
+
+    conduit::blueprint::mesh::utils::kdtree<double, 3> empty;
+    empty.build(coords.data(), 0);
+    EXPECT_EQ(empty.find_point(outside, 1.),
+              (conduit::blueprint::mesh::utils::kdtree<double, 3>::NOT_FOUND));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_combine, num_threads)
+{
+    conduit::Node braid, split;
+    // large enough for the merge to split the points into chunks
+    conduit::blueprint::mesh::examples::braid("hexs", 21, 21, 21, braid);
+    conduit::Node opts;
+    opts["target"] = 8;
+    conduit::blueprint::mesh::partition(braid, opts, split);
+
+    // Combining with several threads gives the same mesh.
+    conduit::Node combine1, combine4, info;
+    opts["target"] = 1;
+    conduit::blueprint::mesh::partition(split, opts, combine1);
+    opts["num_threads"] = 4;
+    conduit::blueprint::mesh::partition(split, opts, combine4);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(combine4, info));
+    EXPECT_FALSE(combine1.diff(combine4, info, CONDUIT_EPSILON, true));
+    EXPECT_EQ(conduit::blueprint::mesh::coordset::length(combine4["coordsets"][0]),
+              conduit::blueprint::mesh::coordset::length(braid["coordsets/coords"]));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, num_threads)
+{
+    // Extracting selections and assembling domains on several threads gives
+    // the same output.
+    const std::string mesh_types[] = {"uniform", "structured", "hexs"};
+    for(const std::string &mesh_type : mesh_types)
+    {
+        conduit::Node braid;
+        conduit::blueprint::mesh::examples::braid(mesh_type, 11, 11, 11, braid);
+
+        conduit::Node opts, split1, split4, info;
+        opts["target"] = 7;
+        conduit::blueprint::mesh::partition(braid, opts, split1);
+        opts["num_threads"] = 4;
+        conduit::blueprint::mesh::partition(braid, opts, split4);
+        EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(split4), 7);
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(split4, info));
+        EXPECT_FALSE(split1.diff(split4, info, CONDUIT_EPSILON, true)) << mesh_type;
+
+        // Combine into fewer domains than threads.
+        conduit::Node combine1, combine4;
+        opts["target"] = 3;
+        conduit::blueprint::mesh::partition(split4, opts, combine4);
+        opts["num_threads"] = 1;
+        conduit::blueprint::mesh::partition(split4, opts, combine1);
+        EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(combine4), 3);
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(combine4, info));
+        EXPECT_FALSE(combine1.diff(combine4, info, CONDUIT_EPSILON, true)) << mesh_type;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, map_back)
+{
+    // Fields computed on a repartitioned mesh are scattered back to the
+    // elements and vertices of the original domains.
+    conduit::Node input;
+    conduit::blueprint::mesh::examples::grid("quads", 11, 11, 0, 2, 1, 1, input);
+    const conduit::index_t nelem = 100, nvert = 121;
+    for(conduit::index_t d = 0; d < 2; d++)
+    {
+        conduit::Node &dom = input[d];
+        dom["state/domain_id"] = d;
+        conduit::Node &n_gvids = dom["fields/global_vertex_ids"];
+        n_gvids["association"] = "vertex";
+        n_gvids["topology"] = "mesh";
+        n_gvids["values"].set(conduit::DataType::index_t(nvert));
+        conduit::index_t_array gvids = n_gvids["values"].value();
+        for(conduit::index_t i = 0; i < nvert; i++)
+            gvids[i] = d * nvert + i;
+    }
+
+    conduit::Node opts, output;
+    opts["target"] = 3;
+    conduit::blueprint::mesh::partition(input, opts, output);
+
+    // Element fields are the (domain, element) of the original element, as an
+    // mcarray of int32. The vertex field is twice the global vertex id.
+    for(conduit::Node *out_dom : conduit::blueprint::mesh::domains(output))
+    {
+        const conduit::Node &orig = (*out_dom)["fields/original_element_ids/values"];
+        const conduit::index_t_accessor orig_doms = orig["domains"].value();
+        const conduit::index_t_accessor orig_ids = orig["ids"].value();
+        const conduit::index_t n = orig_ids.number_of_elements();
+        conduit::Node &n_elem = (*out_dom)["fields/elem_src"];
+        n_elem["association"] = "element";
+        n_elem["topology"] = "mesh";
+        n_elem["values/dom"].set(conduit::DataType::int32(n));
+        n_elem["values/id"].set(conduit::DataType::int32(n));
+        conduit::int32_array e_dom = n_elem["values/dom"].value();
+        conduit::int32_array e_id = n_elem["values/id"].value();
+        for(conduit::index_t i = 0; i < n; i++)
+        {
+            e_dom[i] = (conduit::int32)orig_doms[i];
+            e_id[i] = (conduit::int32)orig_ids[i];
+        }
+
+        const conduit::index_t_accessor out_gvids =
+            (*out_dom)["fields/global_vertex_ids/values"].value();
+        conduit::Node &n_vert = (*out_dom)["fields/vert_gvid"];
+        n_vert["association"] = "vertex";
+        n_vert["topology"] = "mesh";
+        n_vert["values"].set(conduit::DataType::float64(out_gvids.number_of_elements()));
+        conduit::float64_array v = n_vert["values"].value();
+        for(conduit::index_t i = 0; i < out_gvids.number_of_elements(); i++)
+            v[i] = 2. * out_gvids[i];
+    }
+
+    conduit::Node mapback_opts;
+    mapback_opts["fields"].append().set("elem_src");
+    mapback_opts["fields"].append().set("vert_gvid");
+    for(conduit::index_t num_threads = 1; num_threads <= 4; num_threads += 3)
+    {
+        mapback_opts["num_threads"] = num_threads;
+        for(conduit::index_t d = 0; d < 2; d++)
+        {
+            if(input[d]["fields"].has_child("elem_src"))
+                input[d]["fields"].remove_child("elem_src");
+            if(input[d]["fields"].has_child("vert_gvid"))
+                input[d]["fields"].remove_child("vert_gvid");
+        }
+        conduit::blueprint::mesh::partition_map_back(output, mapback_opts, input);
+
+        for(conduit::index_t d = 0; d < 2; d++)
+        {
+            const conduit::Node &dom = input[d];
+            ASSERT_TRUE(dom["fields"].has_child("elem_src"));
+            EXPECT_EQ(dom["fields/elem_src/association"].as_string(), "element");
+            conduit::int32_array e_dom = dom["fields/elem_src/values/dom"].value();
+            conduit::int32_array e_id = dom["fields/elem_src/values/id"].value();
+            ASSERT_EQ(e_dom.number_of_elements(), nelem);
+            for(conduit::index_t i = 0; i < nelem; i++)
+            {
+                EXPECT_EQ(e_dom[i], d);
+                EXPECT_EQ(e_id[i], i);
+            }
+
+            conduit::float64_array v = dom["fields/vert_gvid/values"].value();
+            ASSERT_EQ(v.number_of_elements(), nvert);
+            for(conduit::index_t i = 0; i < nvert; i++)
+                EXPECT_EQ(v[i], 2. * (d * nvert + i));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, external)
+{
+    // Repartitioning whole domains with external output references the input
+    // arrays and otherwise gives the same output as a copy.
+    conduit::Node braid, split, opts, info;
+    conduit::blueprint::mesh::examples::braid("hexs", 11, 11, 11, braid);
+    opts["target"] = 4;
+    conduit::blueprint::mesh::partition(braid, opts, split);
+    for(index_t i = 0; i < split.number_of_children(); i++)
+        split[i]["state/domain_id"] = 10 + i;
+
+    const std::string cs_path("coordsets/coords/values/x");
+    for(int mapping = 0; mapping < 2; mapping++)
+    {
+        conduit::Node copied, referenced;
+        opts["mapping"] = mapping;
+        opts["external"] = 0;
+        conduit::blueprint::mesh::partition(split, opts, copied);
+        opts["external"] = 1;
+        conduit::blueprint::mesh::partition(split, opts, referenced);
+
+        EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(referenced), 4);
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(referenced, info));
+        EXPECT_FALSE(copied.diff(referenced, info, CONDUIT_EPSILON, true));
+        for(index_t i = 0; i < split.number_of_children(); i++)
+        {
+            const void *input = split[i][cs_path].data_ptr();
+            EXPECT_NE(copied[i][cs_path].data_ptr(), input);
+            EXPECT_EQ(referenced[i][cs_path].data_ptr(), input);
+            // Setting the output domain ids leaves the input untouched.
+            EXPECT_EQ(split[i]["state/domain_id"].to_index_t(), 10 + i);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+sfc_domain_lengths(const conduit::Node &mesh, std::vector<index_t> &lengths)
+{
+    lengths.clear();
+    for(const conduit::Node *dom : conduit::blueprint::mesh::domains(mesh))
+        lengths.push_back(conduit::blueprint::mesh::topology::length((*dom)["topologies"][0]));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, sfc)
+{
+    // Cut a single domain into balanced parts along each curve.
+    const std::string curves[] = {"hilbert", "morton"};
+    for(const std::string &curve : curves)
+    {
+        conduit::Node braid, opts, output, info;
+        conduit::blueprint::mesh::examples::braid("hexs", 10, 10, 10, braid);
+        conduit::Node &sel = opts["selections"].append();
+        sel["type"] = "sfc";
+        sel["curve"] = curve;
+        sel["parts"] = 4;
+        conduit::blueprint::mesh::partition(braid, opts, output);
+        EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(output), 4);
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info)) << info.to_yaml();
+
+        std::vector<index_t> lengths;
+        sfc_domain_lengths(output, lengths);
+        for(const index_t len : lengths)
+        {
+            EXPECT_GE(len, 729 / 4);
+            EXPECT_LE(len, 729 / 4 + 1);
+        }
+    }
+
+    // Without parts, the target gives the number of pieces.
+    conduit::Node braid, opts, output, info;
+    conduit::blueprint::mesh::examples::braid("uniform", 10, 10, 1, braid);
+    conduit::Node &sel = opts["selections"].append();
+    sel["type"] = "sfc";
+    opts["target"] = 3;
+    conduit::blueprint::mesh::partition(braid, opts, output);
+    EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(output), 3);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info)) << info.to_yaml();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, sfc_any_domain)
+{
+    // Repartition the domains of a mesh along a curve that passes through
+    // all of their elements.
+    conduit::Node braid, split, opts, output, info;
+    conduit::blueprint::mesh::examples::braid("hexs", 11, 11, 11, braid);
+    opts["target"] = 8;
+    conduit::blueprint::mesh::partition(braid, opts, split);
+    ASSERT_EQ(conduit::blueprint::mesh::number_of_domains(split), 8);
+
+    opts.reset();
+    conduit::Node &sel = opts["selections"].append();
+    sel["type"] = "sfc";
+    sel["domain_id"] = "any";
+    opts["target"] = 3;
+    conduit::blueprint::mesh::partition(split, opts, output);
+    EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(output), 3);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info)) << info.to_yaml();
+
+    std::vector<index_t> lengths;
+    sfc_domain_lengths(output, lengths);
+    index_t total = 0;
+    for(const index_t len : lengths)
+    {
+        EXPECT_GE(len, 1000 / 3);
+        EXPECT_LE(len, 1000 / 3 + 1);
+        total += len;
+    }
+    EXPECT_EQ(total, 1000);
+
+    // The parts are spatially compact: hilbert cuts of a cube into 8 are its
+    // octants, so each part has 5^3 elements and 6^3 points.
+    sel["parts"] = 8;
+    conduit::blueprint::mesh::partition(split, opts, output);
+    EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(output), 8);
+    for(const conduit::Node *dom : conduit::blueprint::mesh::domains(output))
+    {
+        EXPECT_EQ(conduit::blueprint::mesh::topology::length((*dom)["topologies"][0]), 125);
+        EXPECT_EQ(conduit::blueprint::mesh::coordset::length((*dom)["coordsets"][0]), 216);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, slice_fields)
+{
+    // Fields with interleaved, strided, and small integer values are sliced
+    // through runs of consecutive ids and through scattered ids.
+    conduit::Node mesh, opts, output, info;
+    conduit::blueprint::mesh::examples::braid("quads", 21, 21, 0, mesh);
+    const index_t nelem = conduit::blueprint::mesh::topology::length(mesh["topologies/mesh"]);
+    const index_t nverts = conduit::blueprint::mesh::coordset::length(mesh["coordsets/coords"]);
+
+    std::vector<float64> ivec(2 * nelem);
+    std::vector<float32> strided(2 * nverts);
+    std::vector<int8> small(nelem);
+    for(index_t e = 0; e < nelem; e++)
+    {
+        ivec[2 * e] = e;
+        ivec[2 * e + 1] = -e;
+        small[e] = static_cast<int8>(e % 100);
+    }
+    for(index_t v = 0; v < nverts; v++)
+        strided[2 * v] = 0.5f * v;
+
+    conduit::Node &n_ivec = mesh["fields/ivec"];
+    n_ivec["association"] = "element";
+    n_ivec["topology"] = "mesh";
+    n_ivec["values/u"].set_external(ivec.data(), nelem, 0, 2 * sizeof(float64));
+    n_ivec["values/v"].set_external(ivec.data(), nelem, sizeof(float64), 2 * sizeof(float64));
+    conduit::Node &n_small = mesh["fields/small"];
+    n_small["association"] = "element";
+    n_small["topology"] = "mesh";
+    n_small["values"].set(small);
+    conduit::Node &n_strided = mesh["fields/strided"];
+    n_strided["association"] = "vertex";
+    n_strided["topology"] = "mesh";
+    n_strided["values"].set_external(strided.data(), nverts, 0, 2 * sizeof(float32));
+
+    // A long run of elements followed by every third element.
+    std::vector<index_t> elements;
+    for(index_t e = 0; e < 150; e++)
+        elements.push_back(e);
+    for(index_t e = 150; e < nelem; e += 3)
+        elements.push_back(e);
+    conduit::Node &sel = opts["selections"].append();
+    sel["type"] = "explicit";
+    sel["domain_id"] = 0;
+    sel["elements"].set(elements);
+    opts["mapping"] = 1;
+    conduit::blueprint::mesh::partition(mesh, opts, output);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info));
+
+    const conduit::Node &fields = output["fields"];
+    int64_array eids = fields["original_element_ids/values/ids"].value();
+    float64_array u = fields["ivec/values/u"].value();
+    float64_array v = fields["ivec/values/v"].value();
+    int8_array s = fields["small/values"].value();
+    ASSERT_EQ(eids.number_of_elements(), static_cast<index_t>(elements.size()));
+    for(index_t i = 0; i < eids.number_of_elements(); i++)
+    {
+        EXPECT_EQ(eids[i], elements[i]);
+        EXPECT_EQ(u[i], static_cast<float64>(eids[i]));
+        EXPECT_EQ(v[i], -static_cast<float64>(eids[i]));
+        EXPECT_EQ(s[i], static_cast<int8>(eids[i] % 100));
+    }
+
+    int64_array vids = fields["original_vertex_ids/values/ids"].value();
+    float32_array sv = fields["strided/values"].value();
+    ASSERT_EQ(vids.number_of_elements(), sv.number_of_elements());
+    for(index_t i = 0; i < vids.number_of_elements(); i++)
+        EXPECT_EQ(sv[i], 0.5f * vids[i]);
+}
+
+//-----------------------------------------------------------------------------
+// Returns the ids of the elements of the "mesh" topology whose vertex average
+// passes 'inside'.
+template <typename Func>
+static std::vector<index_t>
+spatial_expected_ids(const conduit::Node &mesh, Func &&inside)
+{
+    namespace bputils = conduit::blueprint::mesh::utils;
+    const conduit::Node &topo = mesh["topologies/mesh"];
+    std::vector<index_t> offsets, verts, ids;
+    bputils::topology::element_vertices(topo, 1, offsets, verts);
+    const bputils::coordset::CoordAccessor coords(bputils::topology::coordset(topo));
+    for(size_t ei = 0; ei + 1 < offsets.size(); ei++)
+    {
+        float64 c[3] = {0., 0., 0.};
+        for(index_t vi = offsets[ei]; vi < offsets[ei + 1]; vi++)
+        {
+            float64 p[3];
+            coords.point(verts[vi], p);
+            for(int d = 0; d < 3; d++)
+                c[d] += p[d] / (offsets[ei + 1] - offsets[ei]);
+        }
+        if(inside(c))
+            ids.push_back(static_cast<index_t>(ei));
+    }
+    return ids;
+}
+
+//-----------------------------------------------------------------------------
+static std::vector<index_t>
+spatial_selected_ids(const conduit::Node &mesh, const conduit::Node &sel)
+{
+    conduit::Node opts, output, info;
+    opts["selections"].append().set(sel);
+    opts["mapping"] = 1;
+    conduit::blueprint::mesh::partition(mesh, opts, output);
+    std::vector<index_t> ids;
+    if(output.dtype().is_empty())
+        return ids;
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info)) << info.to_yaml();
+    const conduit::Node &n_ids = output["fields/original_element_ids/values/ids"];
+    const index_t_accessor eids = n_ids.as_index_t_accessor();
+    for(index_t i = 0; i < eids.number_of_elements(); i++)
+        ids.push_back(eids[i]);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, spatial_selections)
+{
+    // Cell centers are at odd coordinates, none are on the region bounds.
+    const std::string types[] = {"uniform", "rectilinear", "structured",
+                                 "hexs", "tets", "hexs_poly"};
+    for(const std::string &type : types)
+    {
+        conduit::Node mesh;
+        conduit::blueprint::mesh::examples::braid(type, 11, 11, 11, mesh);
+
+        conduit::Node box;
+        box["type"] = "box";
+        box["min"].set(std::vector<float64>{-4.5, -20., -3.5});
+        box["max"].set(std::vector<float64>{5., 2., 20.});
+        EXPECT_EQ(spatial_selected_ids(mesh, box),
+                  spatial_expected_ids(mesh, [](const float64 *c)
+                  {
+                      return c[0] >= -4.5 && c[0] <= 5. && c[1] <= 2. && c[2] >= -3.5;
+                  })) << type;
+
+        conduit::Node sphere;
+        sphere["type"] = "sphere";
+        sphere["center"].set(std::vector<float64>{1., 0., -1.});
+        sphere["radius"] = 6.3;
+        const std::vector<index_t> sphere_ids = spatial_selected_ids(mesh, sphere);
+        EXPECT_FALSE(sphere_ids.empty());
+        EXPECT_EQ(sphere_ids,
+                  spatial_expected_ids(mesh, [](const float64 *c)
+                  {
+                      const float64 dx = c[0] - 1., dy = c[1], dz = c[2] + 1.;
+                      return dx * dx + dy * dy + dz * dz <= 6.3 * 6.3;
+                  })) << type;
+
+        conduit::Node plane;
+        plane["type"] = "plane";
+        plane["origin"].set(std::vector<float64>{0.5, 0.5, 0.5});
+        plane["normal"].set(std::vector<float64>{1., 2., -1.});
+        EXPECT_EQ(spatial_selected_ids(mesh, plane),
+                  spatial_expected_ids(mesh, [](const float64 *c)
+                  {
+                      return (c[0] - 0.5) + 2. * (c[1] - 0.5) - (c[2] - 0.5) >= 0.;
+                  })) << type;
+
+        // A region that misses the mesh selects nothing.
+        sphere["center"].set(std::vector<float64>{100., 0., 0.});
+        EXPECT_TRUE(spatial_selected_ids(mesh, sphere).empty()) << type;
+    }
+
+    // 2D meshes, with a box that leaves out the y axis.
+    const std::string types_2d[] = {"uniform", "quads", "tris"};
+    for(const std::string &type : types_2d)
+    {
+        conduit::Node mesh;
+        conduit::blueprint::mesh::examples::braid(type, 11, 11, 0, mesh);
+        conduit::Node box;
+        box["type"] = "box";
+        box["min"].set(std::vector<float64>{-2.5});
+        box["max"].set(std::vector<float64>{6.5});
+        EXPECT_EQ(spatial_selected_ids(mesh, box),
+                  spatial_expected_ids(mesh, [](const float64 *c)
+                  {
+                      return c[0] >= -2.5 && c[0] <= 6.5;
+                  })) << type;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, spatial_selection_any_domain)
+{
+    // A box over the domains of a split mesh selects the same elements
+    // as over the whole mesh, and is split further to reach the target.
+    conduit::Node braid, split, opts, output, info;
+    conduit::blueprint::mesh::examples::braid("hexs", 11, 11, 11, braid);
+    opts["target"] = 8;
+    conduit::blueprint::mesh::partition(braid, opts, split);
+    ASSERT_EQ(conduit::blueprint::mesh::number_of_domains(split), 8);
+
+    opts.reset();
+    conduit::Node &sel = opts["selections"].append();
+    sel["type"] = "box";
+    sel["domain_id"] = "any";
+    sel["min"].set(std::vector<float64>{-10., -10., -10.});
+    sel["max"].set(std::vector<float64>{2., 10., 10.});
+    opts["target"] = 1;
+    conduit::blueprint::mesh::partition(split, opts, output);
+    EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(output), 1);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info)) << info.to_yaml();
+    EXPECT_EQ(conduit::blueprint::mesh::topology::length(output["topologies"][0]),
+              6 * 10 * 10);
+
+    opts["target"] = 4;
+    conduit::blueprint::mesh::partition(split, opts, output);
+    EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(output), 4);
+    index_t total = 0;
+    for(const conduit::Node *dom : conduit::blueprint::mesh::domains(output))
+        total += conduit::blueprint::mesh::topology::length((*dom)["topologies"][0]);
+    EXPECT_EQ(total, 6 * 10 * 10);
+
+    // Bad options are rejected.
+    sel.remove("max");
+    conduit::blueprint::mesh::Partitioner p;
+    EXPECT_FALSE(p.initialize(split, opts));
+    sel["max"].set(std::vector<float64>{2., 10., 10.});
+    sel["type"] = "plane";
+    EXPECT_FALSE(p.initialize(split, opts));
+}
@@ -10,8 +10,11 @@
 
 #include "conduit.hpp"
 #include "conduit_blueprint.hpp"
+#include "conduit_blueprint_mesh_utils_iterate_elements.hpp"
 #include "conduit_log.hpp"
 
+#include <cmath>
+#include <limits>
 #include <set>
 #include <vector>
 #include <string>
@@ -24,6 +27,39 @@ using namespace conduit::utils;
 
 /// Testing Helpers ///
 
+namespace bptopo = conduit::blueprint::mesh::utils::topology;
+
+// stores the point ids of each element given by iterate_fixed_elements
+struct CollectFixedElements
+{
+    std::vector<std::vector<index_t>> *ids;
+
+    template<bptopo::ShapeId S>
+    void operator()(const bptopo::fixed_entity<S> &e) const
+    {
+        (*ids)[e.entity_id].assign(e.element_ids.begin(), e.element_ids.end());
+    }
+};
+
+// checks the compile-time traits of shape 'S' against its ShapeType
+template<bptopo::ShapeId S>
+void check_shape_traits()
+{
+    typedef bptopo::shape_traits<S> traits;
+    // copied so that gtest doesn't bind references to the constants
+    const index_t id = traits::id, dim = traits::dim, indices = traits::indices,
+        embed_id = traits::embed_id, embed_count = traits::embed_count;
+    const bool is_poly = traits::is_poly;
+
+    const blueprint::mesh::utils::ShapeType shape((index_t)S);
+    EXPECT_EQ(id, shape.id);
+    EXPECT_EQ(dim, shape.dim);
+    EXPECT_EQ(indices, shape.indices);
+    EXPECT_EQ(embed_id, shape.embed_id);
+    EXPECT_EQ(embed_count, shape.embed_count);
+    EXPECT_EQ(is_poly, shape.is_poly());
+}
+
 /// Test Cases ///
 
 //-----------------------------------------------------------------------------
@@ -78,6 +114,50 @@ TEST(conduit_blueprint_mesh_query, mesh_domains)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, mesh_for_each_domain)
+{
+    { // Empty Test //
+        Node mesh;
+        index_t count = 0;
+        blueprint::mesh::for_each_domain(mesh, [&](Node &) { count++; });
+        EXPECT_EQ(count, 0);
+    }
+
+    { // Uni-Domain Test //
+        Node mesh;
+        blueprint::mesh::examples::braid("quads",10,10,0,mesh);
+
+        std::vector<const Node *> visited;
+        const Node &cmesh = mesh;
+        blueprint::mesh::for_each_domain(cmesh, [&](const Node &dom)
+        {
+            visited.push_back(&dom);
+        });
+        ASSERT_EQ(visited.size(), 1);
+        EXPECT_EQ(visited[0], &mesh);
+
+        // the multi domain view references the input's data
+        Node multi;
+        blueprint::mesh::to_multi_domain(mesh, multi);
+        ASSERT_EQ(multi.number_of_children(), 1);
+        EXPECT_EQ(multi.child(0)["coordsets/coords/values/x"].data_ptr(),
+                  mesh["coordsets/coords/values/x"].data_ptr());
+    }
+
+    { // Multi-Domain Test //
+        Node mesh;
+        blueprint::mesh::examples::grid("quads",10,10,0,2,2,1,mesh);
+
+        std::vector<Node *> visited;
+        blueprint::mesh::for_each_domain(mesh, [&](Node &dom)
+        {
+            visited.push_back(&dom);
+        });
+        EXPECT_EQ(visited, blueprint::mesh::domains(mesh));
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_query, adjset_formats)
@@ -187,3 +267,475 @@ TEST(conduit_blueprint_mesh_query, adjset_formats)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, iterate_fixed_elements)
+{
+    const std::string mesh_types_2d[] = {"uniform", "rectilinear", "structured",
+        "tris", "quads"};
+    const std::string mesh_types_3d[] = {"uniform", "structured",
+        "tets", "hexs", "wedges", "pyramids"};
+
+    std::vector<Node> meshes;
+    for(const std::string &mesh_type : mesh_types_2d)
+    {
+        meshes.push_back(Node());
+        blueprint::mesh::examples::braid(mesh_type, 4, 5, 0, meshes.back());
+    }
+    for(const std::string &mesh_type : mesh_types_3d)
+    {
+        meshes.push_back(Node());
+        blueprint::mesh::examples::braid(mesh_type, 4, 3, 5, meshes.back());
+    }
+
+    for(const Node &mesh : meshes)
+    {
+        const Node &topo = mesh["topologies/mesh"];
+        std::vector<std::vector<index_t>> ids;
+        bptopo::iterate_elements(topo, [&](const bptopo::entity &e) {
+            ids.push_back(e.element_ids);
+        });
+        ASSERT_FALSE(ids.empty());
+
+        for(index_t nthreads : {1, 4})
+        {
+            std::vector<std::vector<index_t>> fixed_ids(ids.size());
+            CollectFixedElements collect = {&fixed_ids};
+            if(nthreads == 1)
+            {
+                bptopo::iterate_fixed_elements(topo, collect);
+            }
+            else
+            {
+                bptopo::iterate_fixed_elements_parallel(topo, nthreads, collect);
+            }
+            EXPECT_EQ(ids, fixed_ids);
+        }
+    }
+
+    // typed iteration, with 32-bit, 64-bit and strided connectivity
+    Node mesh;
+    blueprint::mesh::examples::braid("hexs", 4, 3, 5, mesh);
+    Node &topo = mesh["topologies/mesh"];
+    const index_t num_ids = topo["elements/connectivity"].dtype().number_of_elements();
+
+    Node conns;
+    topo["elements/connectivity"].to_int32_array(conns["int32"]);
+    topo["elements/connectivity"].to_int64_array(conns["int64"]);
+    conns["padded"].set(DataType::int32(2 * num_ids));
+    int32_array padded = conns["padded"].value();
+    int32_array conn32 = conns["int32"].value();
+    for(index_t i = 0; i < num_ids; i++)
+    {
+        padded[2 * i] = conn32[i];
+        padded[2 * i + 1] = -1;
+    }
+    conns["int32_strided"].set_external(
+        DataType::int32(num_ids, 0, 2 * sizeof(int32)), padded.data_ptr());
+
+    std::vector<index_t> sums;
+    NodeConstIterator itr = conns.children();
+    while(itr.has_next())
+    {
+        const Node &conn = itr.next();
+        if(itr.name() == "padded")
+        {
+            continue;
+        }
+
+        Node v_topo;
+        v_topo["type"] = "unstructured";
+        v_topo["coordset"] = "coords";
+        v_topo["elements/shape"] = "hex";
+        v_topo["elements/connectivity"].set_external(conn);
+
+        index_t num_hexs = 0, id_sum = 0;
+        bptopo::iterate_fixed_elements<bptopo::ShapeId::Hex>(v_topo,
+            [&](const bptopo::fixed_entity<bptopo::ShapeId::Hex> &e) {
+                num_hexs++;
+                for(index_t id : e.element_ids)
+                {
+                    id_sum += id;
+                }
+            });
+        EXPECT_EQ(num_hexs, num_ids / 8);
+        sums.push_back(id_sum);
+    }
+    ASSERT_EQ(sums.size(), 3);
+    EXPECT_EQ(sums[0], sums[1]);
+    EXPECT_EQ(sums[0], sums[2]);
+
+    // the shape must match the topology
+    EXPECT_THROW(bptopo::iterate_fixed_elements<bptopo::ShapeId::Tet>(topo,
+        [](const bptopo::fixed_entity<bptopo::ShapeId::Tet> &) {}),
+        conduit::Error);
+    Node poly;
+    blueprint::mesh::examples::braid("quads_poly", 4, 4, 0, poly);
+    EXPECT_THROW(bptopo::iterate_fixed_elements(poly["topologies/mesh"],
+        CollectFixedElements()), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, coordset_extents)
+{
+    namespace bpcset = conduit::blueprint::mesh::utils::coordset;
+
+    Node ucset;
+    ucset["type"] = "uniform";
+    ucset["dims/i"] = 11;
+    ucset["dims/j"] = 5;
+    ucset["origin/x"] = -0.5;
+    ucset["origin/y"] = 2.0;
+    ucset["spacing/dx"] = 0.1;
+    ucset["spacing/dy"] = -1.0;
+    std::vector<float64> exts = bpcset::extents(ucset);
+    ASSERT_EQ(exts.size(), 4);
+    EXPECT_NEAR(exts[0], -0.5, 1e-12);
+    EXPECT_NEAR(exts[1], 0.5, 1e-12);
+    EXPECT_EQ(exts[2], -2.0);
+    EXPECT_EQ(exts[3], 2.0);
+
+    Node rcset;
+    rcset["type"] = "rectilinear";
+    rcset["values/x"].set(std::vector<float32>{-1.f, 0.f, 3.f});
+    rcset["values/y"].set(std::vector<int32>{9, 5, 1, 0});
+    exts = bpcset::extents(rcset);
+    ASSERT_EQ(exts.size(), 4);
+    EXPECT_EQ(exts[0], -1.0);
+    EXPECT_EQ(exts[1], 3.0);
+    EXPECT_EQ(exts[2], 0.0);
+    EXPECT_EQ(exts[3], 9.0);
+
+    Node mesh;
+    blueprint::mesh::examples::braid("tets", 10, 10, 10, mesh);
+    Node &ecset = mesh["coordsets/coords"];
+    exts = bpcset::extents(ecset);
+    ASSERT_EQ(exts.size(), 6);
+    for(size_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(exts[2 * i], -10.0);
+        EXPECT_EQ(exts[2 * i + 1], 10.0);
+    }
+
+    // cached extents are stored with the hash of the values
+    EXPECT_EQ(bpcset::cached_extents(ecset), exts);
+    EXPECT_TRUE(ecset.has_path("state/extents"));
+    EXPECT_TRUE(ecset.has_path("state/extents_hash"));
+    Node info;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh, info));
+
+    // the cache is used while the hash matches
+    ecset["state/extents"].as_float64_ptr()[0] = -100.0;
+    EXPECT_EQ(bpcset::cached_extents(ecset)[0], -100.0);
+
+    // changing the values through Node methods invalidates it
+    ecset["values/x"].set(std::vector<float64>(1000, 4.0));
+    exts = bpcset::cached_extents(ecset);
+    EXPECT_EQ(exts[0], 4.0);
+    EXPECT_EQ(exts[1], 4.0);
+
+    // and so do writes through data arrays and raw pointers
+    float64_array x_vals = ecset["values/x"].value();
+    x_vals[0] = 1000.0;
+    EXPECT_EQ(bpcset::cached_extents(ecset)[1], 1000.0);
+    ecset["values/x"].as_float64_ptr()[0] = -4.0;
+    EXPECT_EQ(bpcset::cached_extents(ecset)[0], -4.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, reindex_coords)
+{
+    namespace bptopo = conduit::blueprint::mesh::utils::topology;
+
+    // two triangles on a 4 point coordset
+    Node mesh;
+    mesh["coordsets/old/type"] = "explicit";
+    mesh["coordsets/old/values/x"].set(std::vector<float64>{0, 1, 1, 0});
+    mesh["coordsets/old/values/y"].set(std::vector<float64>{0, 0, 1, 1});
+    mesh["coordsets/new/type"] = "explicit";
+    mesh["coordsets/new/values/x"].set(std::vector<float64>{0, 1, 1, 0, 2});
+    mesh["coordsets/new/values/y"].set(std::vector<float64>{0, 0, 1, 1, 2});
+    Node &topo = mesh["topologies/tris"];
+    topo["type"] = "unstructured";
+    topo["coordset"] = "old";
+    topo["elements/shape"] = "tri";
+    topo["elements/connectivity"].set(std::vector<int32>{0, 1, 2, 0, 2, 3});
+    const index_t expected[] = {4, 2, 0, 4, 0, 3};
+
+    // a dense and a sparse global numbering of the same points
+    const index_t strides[] = {1, 100000};
+    for(index_t si = 0; si < 2; si++)
+    {
+        const index_t stride = strides[si];
+        Node old_gvids, new_gvids;
+        old_gvids["values"].set(std::vector<index_t>{
+            7 * stride, 3 * stride, 5 * stride, 9 * stride});
+        new_gvids["values"].set(std::vector<index_t>{
+            5 * stride, 11 * stride, 3 * stride, 9 * stride, 7 * stride});
+
+        for(index_t num_threads = 1; num_threads <= 4; num_threads += 3)
+        {
+            Node res;
+            bptopo::reindex_coords(topo, mesh["coordsets/new"],
+                                   old_gvids, new_gvids, res, num_threads);
+            EXPECT_EQ(res["coordset"].as_string(), "new");
+            index_t_accessor conn = res["elements/connectivity"].value();
+            ASSERT_EQ(conn.number_of_elements(), 6);
+            for(index_t i = 0; i < 6; i++)
+            {
+                EXPECT_EQ(conn[i], expected[i]);
+            }
+        }
+
+        // ids missing from the new coordset are an error
+        Node bad_gvids, res;
+        bad_gvids["values"].set(std::vector<index_t>{
+            5 * stride, 3 * stride, 11 * stride, 7 * stride});
+        EXPECT_THROW(bptopo::reindex_coords(topo, mesh["coordsets/new"],
+                                            old_gvids, bad_gvids, res),
+                     conduit::Error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, shape_type_lookup)
+{
+    namespace bputils = conduit::blueprint::mesh::utils;
+    const std::string names[] = {"point", "line", "tri", "quad", "tet", "hex",
+        "wedge", "pyramid", "polygonal", "polyhedral", "mixed"};
+    for(index_t si = 0; si < 11; si++)
+    {
+        EXPECT_EQ(bputils::ShapeType::id_from_name(names[si]), si);
+        const bputils::ShapeType shape(names[si]);
+        EXPECT_EQ(shape.id, si);
+        EXPECT_EQ(shape.type, names[si]);
+    }
+    const std::string bad_names[] = {"", "p", "points", "quads", "poly", "Hex"};
+    for(const std::string &name : bad_names)
+    {
+        EXPECT_EQ(bputils::ShapeType::id_from_name(name), -1) << name;
+        EXPECT_FALSE(bputils::ShapeType(name).is_valid()) << name;
+    }
+
+    // cascades, from the cached tables
+    const bputils::ShapeCascade hex_cascade(bputils::ShapeType("hex"));
+    EXPECT_EQ(hex_cascade.dim, 3);
+    EXPECT_EQ(hex_cascade.get_shape().type, "hex");
+    EXPECT_EQ(hex_cascade.get_shape(2).type, "quad");
+    EXPECT_EQ(hex_cascade.get_shape(1).type, "line");
+    EXPECT_EQ(hex_cascade.get_shape(0).type, "point");
+    EXPECT_EQ(hex_cascade.get_num_embedded(0), 6 * 4 * 2);
+    const bputils::ShapeCascade ph_cascade(bputils::ShapeType("polyhedral"));
+    EXPECT_EQ(ph_cascade.get_shape(2).type, "polygonal");
+    EXPECT_EQ(ph_cascade.get_shape(1).type, "line");
+
+    check_shape_traits<bptopo::ShapeId::Point>();
+    check_shape_traits<bptopo::ShapeId::Line>();
+    check_shape_traits<bptopo::ShapeId::Tri>();
+    check_shape_traits<bptopo::ShapeId::Quad>();
+    check_shape_traits<bptopo::ShapeId::Tet>();
+    check_shape_traits<bptopo::ShapeId::Hex>();
+    check_shape_traits<bptopo::ShapeId::Wedge>();
+    check_shape_traits<bptopo::ShapeId::Pyramid>();
+    check_shape_traits<bptopo::ShapeId::Polygonal>();
+    check_shape_traits<bptopo::ShapeId::Polyhedral>();
+}
+
+//-----------------------------------------------------------------------------
+// Sets 'centroids' to the vertex averages of the elements of 'topo' (3
+// values per element).
+static void
+element_centroids(const Node &topo, std::vector<float64> &centroids)
+{
+    namespace bputils = conduit::blueprint::mesh::utils;
+    std::vector<index_t> offsets, verts;
+    bptopo::element_vertices(topo, 1, offsets, verts);
+    const bputils::coordset::CoordAccessor coords(bptopo::coordset(topo));
+    const index_t num_elems = (index_t)offsets.size() - 1;
+    centroids.assign((size_t)(3 * num_elems), 0.0);
+    for(index_t ei = 0; ei < num_elems; ei++)
+    {
+        for(index_t vi = offsets[ei]; vi < offsets[ei + 1]; vi++)
+        {
+            float64 p[3];
+            coords.point(verts[vi], p);
+            for(int d = 0; d < 3; d++)
+            {
+                centroids[3 * ei + d] += p[d] / (offsets[ei + 1] - offsets[ei]);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, spatial_index_find_element)
+{
+    namespace bputils = conduit::blueprint::mesh::utils;
+    const std::string types[] = {"uniform", "rectilinear", "structured",
+        "tris", "quads", "quads_poly", "hexs", "tets", "wedges", "pyramids",
+        "hexs_poly"};
+    for(const std::string &type : types)
+    {
+        const bool is_3d = type == "hexs" || type == "tets" || type == "wedges" ||
+            type == "pyramids" || type == "hexs_poly";
+        Node mesh;
+        blueprint::mesh::examples::braid(type, 6, 5, is_3d ? 4 : 0, mesh);
+        const Node &topo = mesh["topologies/mesh"];
+
+        bputils::SpatialIndex index;
+        index.build(topo);
+        const index_t num_elems = bptopo::length(topo);
+        EXPECT_EQ(index.number_of_elements(), num_elems) << type;
+        EXPECT_EQ(index.dimension(), is_3d ? 3 : 2) << type;
+        EXPECT_GT(index.depth(), 1) << type;
+
+        // each element contains its centroid
+        std::vector<float64> centroids;
+        element_centroids(topo, centroids);
+        for(index_t ei = 0; ei < num_elems; ei++)
+        {
+            EXPECT_EQ(index.find_element(&centroids[3 * ei]), ei) << type;
+        }
+
+        // the elements tile the box [-10, 10]^d, the quads and hexes are
+        // numbered like the uniform mesh's
+        const bool is_grid = type == "uniform" || type == "rectilinear" ||
+            type == "structured" || type == "quads" || type == "quads_poly" ||
+            type == "hexs" || type == "hexs_poly";
+        const index_t dims[3] = {5, 4, 3};
+        const index_t num_axes = is_3d ? 3 : 2;
+        for(index_t i = 0; i < 200; i++)
+        {
+            float64 p[3];
+            index_t expected = 0;
+            for(index_t d = num_axes - 1; d >= 0; d--)
+            {
+                p[d] = -10.0 + 20.0 * std::fmod(0.6180339887 * (i + 1) * (d + 3), 1.0);
+                const index_t cell = std::min(dims[d] - 1,
+                    (index_t)((p[d] + 10.0) / (20.0 / dims[d])));
+                expected = expected * dims[d] + cell;
+            }
+            const index_t found = index.find_element(p);
+            if(is_grid)
+            {
+                EXPECT_EQ(found, expected) << type;
+            }
+            else
+            {
+                EXPECT_NE(found, bputils::SpatialIndex::NOT_FOUND) << type;
+            }
+
+            float64 distance = -1.0;
+            EXPECT_EQ(index.find_nearest_element(p, distance), found) << type;
+            EXPECT_EQ(distance, 0.0) << type;
+        }
+
+        const float64 outside[3] = {-10.5, 30.0, 0.0};
+        EXPECT_EQ(index.find_element(outside), bputils::SpatialIndex::NOT_FOUND);
+
+        // nearest centroid, by brute force
+        index_t nearest = 0;
+        float64 nearest_dist2 = std::numeric_limits<float64>::max();
+        for(index_t ei = 0; ei < num_elems; ei++)
+        {
+            float64 dist2 = 0.0;
+            for(index_t d = 0; d < 3; d++)
+            {
+                const float64 diff = centroids[3 * ei + d] - outside[d];
+                dist2 += diff * diff;
+            }
+            if(dist2 < nearest_dist2)
+            {
+                nearest = ei;
+                nearest_dist2 = dist2;
+            }
+        }
+        float64 distance = 0.0;
+        EXPECT_EQ(index.find_nearest_element(outside, distance), nearest) << type;
+        EXPECT_NEAR(distance, std::sqrt(nearest_dist2), 1e-10) << type;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, spatial_index_batches)
+{
+    namespace bputils = conduit::blueprint::mesh::utils;
+    Node mesh;
+    blueprint::mesh::examples::braid("tets", 20, 20, 20, mesh);
+    const Node &topo = mesh["topologies/mesh"];
+
+    // points on a grid that extends past the mesh
+    const index_t n = 23;
+    Node coords;
+    coords["x"].set(DataType::float64(n * n * n));
+    coords["y"].set(DataType::float64(n * n * n));
+    coords["z"].set(DataType::float64(n * n * n));
+    float64 *x = coords["x"].value();
+    float64 *y = coords["y"].value();
+    float64 *z = coords["z"].value();
+    std::vector<float64> points;
+    for(index_t i = 0; i < n * n * n; i++)
+    {
+        x[i] = -11.0 + 22.0 * (i % n) / (n - 1) + 0.01;
+        y[i] = -11.0 + 22.0 * ((i / n) % n) / (n - 1) + 0.02;
+        z[i] = -11.0 + 22.0 * (i / (n * n)) / (n - 1) + 0.03;
+        points.push_back(x[i]);
+        points.push_back(y[i]);
+        points.push_back(z[i]);
+    }
+
+    bputils::SpatialIndex serial;
+    serial.build(topo);
+    std::vector<index_t> ids_1(n * n * n);
+    std::vector<float64> dists_1(n * n * n);
+    serial.find_elements(points.data(), n * n * n, ids_1.data());
+
+    Node opts;
+    opts["num_threads"] = 4;
+    opts["leaf_size"] = 4;
+    bputils::SpatialIndex threaded;
+    threaded.build(topo, opts);
+    EXPECT_GT(threaded.depth(), serial.depth());
+
+    Node ids_4;
+    threaded.find_elements(coords, ids_4, 4);
+    const index_t *ids_4_ptr = ids_4.value();
+    index_t num_found = 0;
+    for(index_t i = 0; i < n * n * n; i++)
+    {
+        EXPECT_EQ(ids_1[i], ids_4_ptr[i]);
+        const bool inside = std::abs(x[i]) < 10.0 && std::abs(y[i]) < 10.0 &&
+                            std::abs(z[i]) < 10.0;
+        EXPECT_EQ(ids_1[i] != bputils::SpatialIndex::NOT_FOUND, inside);
+        num_found += inside ? 1 : 0;
+    }
+    EXPECT_GT(num_found, 0);
+
+    // nearest elements, with and without threads
+    std::vector<index_t> near_1(n * n * n), near_4(n * n * n);
+    std::vector<float64> dists_4(n * n * n);
+    serial.find_nearest_elements(points.data(), n * n * n, near_1.data(),
+                                 dists_1.data());
+    threaded.find_nearest_elements(points.data(), n * n * n, near_4.data(),
+                                   dists_4.data(), 4);
+    EXPECT_EQ(near_1, near_4);
+    EXPECT_EQ(dists_1, dists_4);
+    for(index_t i = 0; i < n * n * n; i++)
+    {
+        EXPECT_NE(near_1[i], bputils::SpatialIndex::NOT_FOUND);
+        EXPECT_EQ(dists_1[i] == 0.0, ids_1[i] != bputils::SpatialIndex::NOT_FOUND);
+    }
+
+    // queries need the index's dimension
+    Node coords_2d, ids;
+    coords_2d["x"].set(coords["x"]);
+    coords_2d["y"].set(coords["y"]);
+    EXPECT_THROW(threaded.find_elements(coords_2d, ids), conduit::Error);
+
+    // an empty index finds nothing
+    bputils::SpatialIndex empty;
+    float64 distance = 0.0;
+    EXPECT_EQ(empty.find_element(points.data()), bputils::SpatialIndex::NOT_FOUND);
+    EXPECT_EQ(empty.find_nearest_element(points.data(), distance),
+              bputils::SpatialIndex::NOT_FOUND);
+}
@@ -528,6 +528,813 @@ TEST(conduit_blueprint_mesh_relay, save_multi_domain_json_yaml)
     EXPECT_TRUE(is_file( tout_base + "yaml/domain_000002.yaml"));
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, save_strided_structured)
+{
+    // the root file stores domain sizes, strided structured dims also
+    // hold offsets and strides (6 x 5 (x 3) points)
+    for(index_t nz = 0; nz <= 3; nz += 3)
+    {
+        Node data, desc;
+        blueprint::mesh::examples::strided_structured(desc, 6, 5, nz, data);
+        const Node &topo = data["topologies"][0];
+        EXPECT_EQ(blueprint::mesh::utils::topology::length(topo),
+                  nz == 0 ? 5 * 4 : 5 * 4 * 2);
+
+        std::string tout_base = "tout_relay_bp_mesh_strided_structured_" +
+                                std::to_string(nz);
+        Node opts;
+        opts["suffix"] = "none";
+        opts["truncate"] = "true";
+        relay::io::blueprint::save_mesh(data, tout_base, "json", opts);
+
+        Node n_read, info;
+        relay::io::blueprint::read_mesh(tout_base + ".root", n_read);
+        EXPECT_EQ(n_read.number_of_children(), 1);
+        EXPECT_EQ(n_read[0]["topologies"][0]["elements/dims/i"].to_index_t(), 5);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, partition_mesh)
+{
+    Node data;
+    // use spiral , with 8 domains
+    conduit::blueprint::mesh::examples::spiral(8,data);
+
+    index_t num_elems = 0;
+    for(index_t i = 0; i < data.number_of_children(); i++)
+    {
+        num_elems += conduit::blueprint::mesh::topology::length(
+                         data[i]["topologies"][0]);
+    }
+
+    Node opts;
+    opts["suffix"] = "none";
+    std::string tout_base = "tout_relay_bp_mesh_partition_mesh";
+    relay::io::blueprint::save_mesh(data, tout_base, "json", opts);
+
+    // all domains in one batch, one domain per batch, and two or so batches
+    index_t budgets[3] = {0, 1, data.total_bytes_compact() / 2};
+    for(int b = 0; b < 3; b++)
+    {
+        CONDUIT_INFO("test memory_budget = " << budgets[b]);
+        std::string out_base = conduit_fmt::format("{}_out_{}", tout_base, b);
+        Node part_opts, io_opts;
+        part_opts["target"] = 4;
+        io_opts["memory_budget"] = budgets[b];
+        relay::io::blueprint::partition_mesh(tout_base + ".root",
+                                             part_opts,
+                                             out_base,
+                                             "json",
+                                             io_opts);
+        EXPECT_TRUE(is_file(out_base + ".root"));
+
+        Node n_load, info;
+        relay::io::blueprint::read_mesh(out_base + ".root", n_load);
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(n_load, info));
+
+        index_t ndoms = conduit::blueprint::mesh::number_of_domains(n_load);
+        if(b == 0)
+        {
+            // one batch makes exactly the target
+            EXPECT_EQ(ndoms, 4);
+        }
+        else if(b == 1)
+        {
+            // one domain per batch, each batch makes at least one domain
+            EXPECT_EQ(ndoms, 8);
+        }
+        else
+        {
+            EXPECT_GE(ndoms, 4);
+        }
+
+        index_t out_elems = 0;
+        for(index_t i = 0; i < ndoms; i++)
+        {
+            EXPECT_EQ(n_load[i]["state/domain_id"].to_index_t(), i);
+            out_elems += conduit::blueprint::mesh::topology::length(
+                             n_load[i]["topologies"][0]);
+        }
+        EXPECT_EQ(out_elems, num_elems);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, read_mesh_selections)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    std::vector<std::string> protocols;
+    protocols.push_back("json");
+    if(io_protos["io/protocols/hdf5"].as_string() == "enabled")
+    {
+        protocols.push_back("hdf5");
+    }
+
+    // 4 domains with a second (points) topology and a field on it
+    Node data;
+    for(int i = 0; i < 4; i++)
+    {
+        Node &dom = data.append();
+        blueprint::mesh::examples::braid("uniform", 3, 3, 0, dom);
+        dom["state/domain_id"] = i;
+        dom["topologies/pts/type"] = "points";
+        dom["topologies/pts/coordset"] = "coords";
+        dom["fields/pts_field/association"] = "vertex";
+        dom["fields/pts_field/topology"] = "pts";
+        dom["fields/pts_field/values"].set(DataType::float64(9));
+    }
+
+    for(size_t p = 0; p < protocols.size(); p++)
+    {
+        std::string tout_base = "tout_relay_bp_mesh_read_selections_" +
+                                protocols[p];
+        Node opts;
+        opts["suffix"] = "none";
+        opts["truncate"] = "true";
+        relay::io::blueprint::write_mesh(data, tout_base, protocols[p], opts);
+        std::string tout_root = tout_base + ".root";
+
+        // no selection reads everything (json changes integer types,
+        // so compare the fields)
+        Node n_read, info;
+        relay::io::blueprint::read_mesh(tout_root, n_read);
+        EXPECT_EQ(n_read.number_of_children(), 4);
+        EXPECT_EQ(n_read[1]["topologies"].number_of_children(), 2);
+        EXPECT_FALSE(data[1]["fields"].diff(n_read[1]["fields"], info));
+
+        // one field
+        Node read_opts;
+        read_opts["fields"] = "braid";
+        n_read.reset();
+        relay::io::blueprint::read_mesh(tout_root, read_opts, n_read);
+        EXPECT_EQ(n_read.number_of_children(), 4);
+        EXPECT_EQ(n_read[0]["fields"].number_of_children(), 1);
+        EXPECT_TRUE(n_read[0].has_path("fields/braid"));
+        EXPECT_TRUE(n_read[0].has_path("topologies/mesh"));
+        EXPECT_TRUE(n_read[0].has_path("topologies/pts"));
+        EXPECT_FALSE(data[0]["fields/braid"].diff(n_read[0]["fields/braid"],
+                                                  info));
+
+        // one topology, leaves out the fields on other topologies
+        read_opts.reset();
+        read_opts["topologies"].append().set("pts");
+        n_read.reset();
+        relay::io::blueprint::read_mesh(tout_root, read_opts, n_read);
+        EXPECT_TRUE(n_read[0].has_path("coordsets/coords"));
+        EXPECT_TRUE(n_read[0].has_path("topologies/pts"));
+        EXPECT_FALSE(n_read[0].has_path("topologies/mesh"));
+        EXPECT_TRUE(n_read[0].has_path("fields/pts_field"));
+        EXPECT_FALSE(n_read[0].has_path("fields/braid"));
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(n_read, info));
+
+        // domains
+        read_opts.reset();
+        int64 dom_ids[2] = {1, 3};
+        read_opts["domains"].set(dom_ids, 2);
+        n_read.reset();
+        relay::io::blueprint::read_mesh(tout_root, read_opts, n_read);
+        EXPECT_EQ(n_read.number_of_children(), 2);
+        EXPECT_TRUE(n_read.has_child("domain_000001"));
+        EXPECT_TRUE(n_read.has_child("domain_000003"));
+
+        read_opts.reset();
+        int64 dom_range[2] = {2, 4};
+        read_opts["domain_range"].set(dom_range, 2);
+        read_opts["fields"].append().set("radial");
+        n_read.reset();
+        relay::io::blueprint::read_mesh(tout_root, read_opts, n_read);
+        EXPECT_EQ(n_read.number_of_children(), 2);
+        EXPECT_TRUE(n_read.has_path("domain_000002/fields/radial"));
+        EXPECT_FALSE(n_read.has_path("domain_000002/fields/braid"));
+
+        // bad selections
+        read_opts.reset();
+        read_opts["fields"] = "bananas";
+        EXPECT_THROW(relay::io::blueprint::read_mesh(tout_root,
+                                                     read_opts,
+                                                     n_read),
+                     conduit::Error);
+        read_opts.reset();
+        read_opts["domains"] = 4;
+        EXPECT_THROW(relay::io::blueprint::read_mesh(tout_root,
+                                                     read_opts,
+                                                     n_read),
+                     conduit::Error);
+
+        // lazy
+        relay::io::blueprint::LazyMesh lazy(tout_root);
+        EXPECT_TRUE(lazy.is_open());
+        EXPECT_EQ(lazy.number_of_domains(), 4);
+        EXPECT_TRUE(lazy.mesh_index().has_path("fields/braid"));
+        EXPECT_FALSE(lazy.is_loaded(2));
+        EXPECT_EQ(lazy.loaded_domains().number_of_children(), 0);
+
+        Node &dom = lazy.domain(2);
+        EXPECT_TRUE(lazy.is_loaded(2));
+        EXPECT_FALSE(data[2]["fields"].diff(dom["fields"], info));
+        EXPECT_EQ(&lazy.domain(2), &dom);
+        EXPECT_EQ(lazy.loaded_domains().number_of_children(), 1);
+
+        lazy.release(2);
+        EXPECT_FALSE(lazy.is_loaded(2));
+        EXPECT_THROW(lazy.domain(4), conduit::Error);
+
+        read_opts.reset();
+        read_opts["fields"] = "pts_field";
+        lazy.open(tout_root, read_opts);
+        EXPECT_EQ(lazy.domain(0)["fields"].number_of_children(), 1);
+        lazy.close();
+        EXPECT_FALSE(lazy.is_open());
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, read_mesh_threads)
+{
+    Node data;
+    for(int i = 0; i < 9; i++)
+    {
+        Node &dom = data.append();
+        blueprint::mesh::examples::braid("uniform", 3, 3, 0, dom);
+        dom["state/domain_id"] = i;
+    }
+
+    // one file per domain, and several domains per file
+    int nfiles[2] = {9, 4};
+    for(int f = 0; f < 2; f++)
+    {
+        std::string tout_base = "tout_relay_bp_mesh_read_threads_" +
+                                std::to_string(nfiles[f]);
+        Node opts;
+        opts["suffix"] = "none";
+        opts["truncate"] = "true";
+        opts["number_of_files"] = nfiles[f];
+        relay::io::blueprint::write_mesh(data, tout_base, "json", opts);
+        std::string tout_root = tout_base + ".root";
+
+        Node n_serial, n_threads, read_opts, info;
+        read_opts["threads"] = 1;
+        relay::io::blueprint::read_mesh(tout_root, read_opts, n_serial);
+        read_opts["threads"] = 4;
+        relay::io::blueprint::read_mesh(tout_root, read_opts, n_threads);
+
+        EXPECT_FALSE(n_serial.diff(n_threads, info)) << info.to_yaml();
+        EXPECT_EQ(n_threads.number_of_children(), 9);
+        for(int i = 0; i < 9; i++)
+        {
+            EXPECT_FALSE(data[i]["fields"].diff(n_threads[i]["fields"], info));
+        }
+
+        // errors on the worker threads reach the caller
+        std::string fprefix = nfiles[f] == 9 ? "domain_" : "file_";
+        remove_path_if_exists(conduit_fmt::format("{}/{}{:06d}.json",
+                                                  tout_base, fprefix, 2));
+        n_threads.reset();
+        EXPECT_THROW(relay::io::blueprint::read_mesh(tout_root,
+                                                     read_opts,
+                                                     n_threads),
+                     conduit::Error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, write_mesh_threads)
+{
+    Node data;
+    for(int i = 0; i < 9; i++)
+    {
+        Node &dom = data.append();
+        blueprint::mesh::examples::braid("quads", 4, 4, 0, dom);
+        dom["state/domain_id"] = i;
+    }
+
+    // one file per domain, and several domains per file
+    int nfiles[2] = {9, 4};
+    for(int f = 0; f < 2; f++)
+    {
+        Node n_read[2], info;
+        int threads[2] = {1, 4};
+        for(int t = 0; t < 2; t++)
+        {
+            std::string tout_base = conduit_fmt::format("tout_relay_bp_mesh_write_threads_{}_{}",
+                                                        nfiles[f],
+                                                        threads[t]);
+            Node opts;
+            opts["suffix"] = "none";
+            opts["truncate"] = "true";
+            opts["number_of_files"] = nfiles[f];
+            opts["threads"] = threads[t];
+            relay::io::blueprint::write_mesh(data, tout_base, "json", opts);
+            relay::io::blueprint::read_mesh(tout_base + ".root", n_read[t]);
+        }
+
+        EXPECT_FALSE(n_read[0].diff(n_read[1], info)) << info.to_yaml();
+        EXPECT_EQ(n_read[1].number_of_children(), 9);
+        for(int i = 0; i < 9; i++)
+        {
+            EXPECT_FALSE(data[i]["fields"].diff(n_read[1][i]["fields"], info));
+        }
+
+        // errors on the worker threads reach the caller
+        std::string tout_base = conduit_fmt::format("tout_relay_bp_mesh_write_threads_{}_bad",
+                                                    nfiles[f]);
+        std::string fprefix = nfiles[f] == 9 ? "domain_" : "file_";
+        create_directory(tout_base);
+        create_directory(conduit_fmt::format("{}/{}{:06d}.json",
+                                             tout_base, fprefix, 2));
+        Node opts;
+        opts["suffix"] = "none";
+        opts["truncate"] = "true";
+        opts["number_of_files"] = nfiles[f];
+        opts["threads"] = 4;
+        EXPECT_THROW(relay::io::blueprint::write_mesh(data, tout_base, "json", opts),
+                     conduit::Error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, mesh_writer)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    std::vector<std::string> protocols;
+    protocols.push_back("json");
+    if(io_protos["io/protocols/hdf5"].as_string() == "enabled")
+    {
+        protocols.push_back("hdf5");
+    }
+
+    for(size_t p = 0; p < protocols.size(); p++)
+    {
+        const std::string &protocol = protocols[p];
+        std::string tout_base = "tout_relay_bp_mesh_writer_" + protocol;
+        remove_path_if_exists(tout_base + "/domain_000000.hdf5");
+        remove_path_if_exists(tout_base + "/domain_000001.hdf5");
+
+        Node data;
+        for(int i = 0; i < 2; i++)
+        {
+            blueprint::mesh::examples::braid("hexs", 6, 6, 6, data.append());
+        }
+
+        relay::io::blueprint::MeshWriter writer(tout_base, protocol);
+        EXPECT_TRUE(writer.is_open());
+        std::vector<Node> written(4);
+        for(int c = 0; c < 4; c++)
+        {
+            for(int i = 0; i < 2; i++)
+            {
+                Node &dom = data[i];
+                dom["state/cycle"] = 10 * c;
+                dom["state/time"] = 0.5 * c;
+                float64_array vals = dom["fields/braid/values"].value();
+                vals.fill(c + i);
+                // the mesh moves at cycle 20
+                if(c == 2)
+                {
+                    float64_array x = dom["coordsets/coords/values/x"].value();
+                    x[0] = -100.0;
+                }
+                // a field added at cycle 30 refreshes the index
+                if(c == 3)
+                {
+                    dom["fields/extra/association"] = "element";
+                    dom["fields/extra/topology"] = "mesh";
+                    dom["fields/extra/values"].set(DataType::float64(125));
+                }
+            }
+            writer.write(data);
+            written[c].set(data);
+        }
+        EXPECT_EQ(writer.number_of_cycles(), 4);
+        EXPECT_THROW(writer.write(data[0]), conduit::Error);
+        writer.close();
+        EXPECT_FALSE(writer.is_open());
+
+        for(int c = 0; c < 4; c++)
+        {
+            std::string tout_root = tout_base +
+                                    conduit_fmt::format(".cycle_{:06d}.root",
+                                                        10 * c);
+            Node n_read, info;
+            relay::io::blueprint::read_mesh(tout_root, n_read);
+            EXPECT_EQ(n_read.number_of_children(), 2);
+            for(int i = 0; i < 2; i++)
+            {
+                EXPECT_FALSE(written[c][i]["fields"].diff(n_read[i]["fields"],
+                                                         info)) << c;
+                EXPECT_FALSE(written[c][i]["coordsets"].diff(n_read[i]["coordsets"],
+                                                            info)) << c;
+                EXPECT_EQ(n_read[i]["state/cycle"].to_int(), 10 * c);
+            }
+            EXPECT_EQ(n_read[0]["fields"].number_of_children(),
+                      c == 3 ? 4 : 3);
+        }
+    }
+
+    if(io_protos["io/protocols/hdf5"].as_string() != "enabled")
+    {
+        return;
+    }
+
+    // linking the static data takes less space than writing it each cycle
+    index_t sizes[2];
+    for(int s = 0; s < 2; s++)
+    {
+        std::string tout_base = conduit_fmt::format("tout_relay_bp_mesh_writer_static_{}",
+                                                    s);
+        remove_path_if_exists(tout_base + "/domain_000000.hdf5");
+        Node data, opts;
+        blueprint::mesh::examples::braid("hexs", 10, 10, 10, data);
+        if(s == 1)
+        {
+            opts["static"].set(DataType::list());
+        }
+        relay::io::blueprint::MeshWriter writer(tout_base, "hdf5", opts);
+        for(int c = 0; c < 5; c++)
+        {
+            data["state/cycle"] = c;
+            writer.write(data);
+        }
+        writer.close();
+        sizes[s] = file_size(tout_base + "/domain_000000.hdf5");
+    }
+    EXPECT_LT(sizes[0], sizes[1]);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, write_mesh_static_topology)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    if(io_protos["io/protocols/hdf5"].as_string() != "enabled")
+    {
+        CONDUIT_INFO("HDF5 disabled, skipping write_mesh_static_topology test");
+        return;
+    }
+
+    std::string styles[2] = {"hash", "assume"};
+    for(int s = 0; s < 2; s++)
+    {
+        std::string tout_base = "tout_relay_bp_mesh_static_topo_" + styles[s];
+        Node data;
+        for(int i = 0; i < 2; i++)
+        {
+            blueprint::mesh::examples::braid("hexs", 8, 8, 8, data.append());
+        }
+
+        Node opts;
+        opts["truncate"] = "true";
+        opts["static_topology"] = styles[s];
+        std::vector<Node> written(3);
+        for(int c = 0; c < 3; c++)
+        {
+            for(int i = 0; i < 2; i++)
+            {
+                data[i]["state/cycle"] = c;
+                float64_array vals = data[i]["fields/braid/values"].value();
+                vals.fill(c + i);
+            }
+            // domain 1 moves at cycle 2
+            if(c == 2)
+            {
+                float64_array x = data[1]["coordsets/coords/values/x"].value();
+                x[0] = -100.0;
+            }
+            relay::io::blueprint::write_mesh(data, tout_base, "hdf5", opts);
+            written[c].set(data);
+        }
+
+        // cycles after the first link to the first cycle's files
+        index_t size_0 = file_size(tout_base + ".cycle_000000/domain_000000.hdf5");
+        index_t size_1 = file_size(tout_base + ".cycle_000001/domain_000000.hdf5");
+        EXPECT_LT(size_1, size_0 / 2);
+
+        for(int c = 0; c < 3; c++)
+        {
+            Node n_read, info;
+            relay::io::blueprint::read_mesh(tout_base +
+                                            conduit_fmt::format(".cycle_{:06d}.root",
+                                                                c),
+                                            n_read);
+            for(int i = 0; i < 2; i++)
+            {
+                EXPECT_FALSE(written[c][i]["fields"].diff(n_read[i]["fields"],
+                                                         info));
+                EXPECT_FALSE(written[c][i]["topologies"].diff(n_read[i]["topologies"],
+                                                             info));
+            }
+
+            // hash notices the change, assume does not
+            float64_accessor x = n_read[1]["coordsets/coords/values/x"].value();
+            float64 x_0 = x[0];
+            if(c == 2 && s == 0)
+            {
+                EXPECT_EQ(x_0, -100.0);
+            }
+            else
+            {
+                EXPECT_NE(x_0, -100.0);
+            }
+        }
+    }
+
+    Node opts;
+    opts["static_topology"] = "bananas";
+    Node data;
+    blueprint::mesh::examples::braid("hexs", 2, 2, 2, data);
+    EXPECT_THROW(relay::io::blueprint::write_mesh(data,
+                                                  "tout_relay_bp_mesh_static_topo_bad",
+                                                  "hdf5",
+                                                  opts),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, write_mesh_index_encoding)
+{
+    Node data;
+    blueprint::mesh::examples::braid("hexs", 12, 12, 12, data);
+    Node &conn = data["topologies/mesh/elements/connectivity"];
+    Node conn_int64;
+    conn.to_int64_array(conn_int64);
+    conn.set(conn_int64);
+    // sorted global vertex ids
+    const index_t num_verts = data["coordsets/coords/values/x"].dtype().number_of_elements();
+    data["fields/gvids/association"] = "vertex";
+    data["fields/gvids/topology"] = "mesh";
+    data["fields/gvids/values"].set(DataType::int64(num_verts));
+    int64_array gvids = data["fields/gvids/values"].value();
+    for(index_t i = 0; i < num_verts; i++)
+    {
+        gvids[i] = 1000000000 + 3 * i;
+    }
+
+    std::string encodings[3] = {"none", "narrow", "delta"};
+    index_t sizes[3];
+    for(int e = 0; e < 3; e++)
+    {
+        std::string tout_base = "tout_relay_bp_mesh_index_encoding_" + encodings[e];
+        Node opts;
+        opts["suffix"] = "none";
+        opts["file_style"] = "multi_file";
+        opts["truncate"] = "true";
+        opts["index_encoding"] = encodings[e];
+        relay::io::blueprint::write_mesh(data, tout_base, "conduit_bin", opts);
+        sizes[e] = file_size(tout_base + "/domain_000000.conduit_bin");
+
+        // (json roots can be read without hdf5)
+        relay::io::blueprint::write_mesh(data, tout_base + "_json", "json", opts);
+        Node n_read, info;
+        relay::io::blueprint::read_mesh(tout_base + "_json.root", n_read);
+        EXPECT_FALSE(data["topologies"].diff(n_read[0]["topologies"], info));
+        EXPECT_FALSE(data["fields"].diff(n_read[0]["fields"], info));
+        EXPECT_FALSE(n_read[0].has_path("state/index_encoding"));
+        EXPECT_TRUE(n_read[0]["topologies/mesh/elements/connectivity"].dtype().is_int64());
+    }
+
+    // the ids don't fit in 16 bits, their differences do
+    EXPECT_LT(sizes[1], sizes[0]);
+    EXPECT_LT(sizes[2], sizes[1]);
+
+    // the source mesh is untouched
+    EXPECT_TRUE(data["topologies/mesh/elements/connectivity"].dtype().is_int64());
+    EXPECT_TRUE(data["fields/gvids/values"].dtype().is_int64());
+
+    Node opts;
+    opts["index_encoding"] = "bananas";
+    EXPECT_THROW(relay::io::blueprint::write_mesh(data,
+                                                  "tout_relay_bp_mesh_index_encoding_bad",
+                                                  "json",
+                                                  opts),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+void
+remove_checkpoint_tier(const std::string &tier)
+{
+    std::vector<std::string> contents;
+    if(!list_directory_contents(tier, contents))
+    {
+        return;
+    }
+
+    for(size_t i = 0; i < contents.size(); i++)
+    {
+        std::vector<std::string> files;
+        if(is_directory(contents[i]) &&
+           list_directory_contents(contents[i], files))
+        {
+            for(size_t j = 0; j < files.size(); j++)
+            {
+                remove_path_if_exists(files[j]);
+            }
+        }
+        remove_path_if_exists(contents[i]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, checkpoint_manager)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    std::vector<std::string> protocols;
+    protocols.push_back("json");
+    if(io_protos["io/protocols/hdf5"].as_string() == "enabled")
+    {
+        protocols.push_back("hdf5");
+    }
+
+    std::string drains[2] = {"async", "sync"};
+
+    for(size_t p = 0; p < protocols.size(); p++)
+    {
+        for(int d = 0; d < 2; d++)
+        {
+            const std::string &protocol = protocols[p];
+            std::string tout_base = "tout_relay_bp_ckpt_" + protocol +
+                                    "_" + drains[d];
+            std::string fast = tout_base + "_fast";
+            std::string slow = tout_base + "_slow";
+            remove_checkpoint_tier(fast);
+            remove_checkpoint_tier(slow);
+
+            Node opts;
+            opts["tiers"].append().set(fast);
+            opts["tiers"].append().set(slow);
+            opts["protocol"] = protocol;
+            opts["drain"] = drains[d];
+            opts["keep"] = 2;
+
+            Node data;
+            for(int i = 0; i < 2; i++)
+            {
+                blueprint::mesh::examples::braid("hexs", 5, 5, 5, data.append());
+            }
+
+            relay::io::blueprint::CheckpointManager ckpt(opts);
+            EXPECT_TRUE(ckpt.is_open());
+
+            index_t cycle = -1;
+            std::string root_file;
+            EXPECT_FALSE(ckpt.latest(cycle, root_file));
+
+            for(int c = 0; c < 3; c++)
+            {
+                for(int i = 0; i < 2; i++)
+                {
+                    data[i]["state/cycle"] = 10 * c;
+                    float64_array vals = data[i]["fields/braid/values"].value();
+                    vals.fill(c + i);
+                }
+                ckpt.write(data);
+            }
+            ckpt.wait();
+            EXPECT_EQ(ckpt.pending_drains(), 0);
+
+            // all cycles are on the slow tier, the fast tier keeps two
+            for(int c = 0; c < 3; c++)
+            {
+                std::string fname = conduit_fmt::format("checkpoint.cycle_{:06d}",
+                                                        10 * c);
+                EXPECT_TRUE(is_file(join_file_path(slow, fname + ".root")));
+                EXPECT_EQ(is_file(join_file_path(fast, fname + ".root")),
+                          c > 0);
+            }
+
+            // the newest cycle is read from the fast tier
+            EXPECT_TRUE(ckpt.latest(cycle, root_file));
+            EXPECT_EQ(cycle, 20);
+            EXPECT_EQ(root_file,
+                      join_file_path(fast, "checkpoint.cycle_000020.root"));
+
+            Node n_read, info;
+            EXPECT_TRUE(ckpt.load_latest(n_read));
+            EXPECT_EQ(n_read.number_of_children(), 2);
+            for(int i = 0; i < 2; i++)
+            {
+                EXPECT_FALSE(data[i]["fields"].diff(n_read[i]["fields"], info));
+            }
+            ckpt.close();
+            EXPECT_FALSE(ckpt.is_open());
+
+            // a root file without the completion marker is skipped
+            Node write_opts;
+            write_opts["suffix"] = "none";
+            relay::io::blueprint::write_mesh(data,
+                                             join_file_path(slow,
+                                                            "checkpoint.cycle_000030"),
+                                             protocol,
+                                             write_opts);
+            EXPECT_TRUE(is_file(join_file_path(slow,
+                                               "checkpoint.cycle_000030.root")));
+
+            // on restart, a lost fast copy is read from the slow tier
+            remove_path_if_exists(join_file_path(fast,
+                                                 "checkpoint.cycle_000020.root"));
+            relay::io::blueprint::CheckpointManager restart(opts);
+            EXPECT_TRUE(restart.latest(cycle, root_file));
+            EXPECT_EQ(cycle, 20);
+            EXPECT_EQ(root_file,
+                      join_file_path(slow, "checkpoint.cycle_000020.root"));
+            n_read.reset();
+            EXPECT_TRUE(restart.load_latest(n_read));
+            for(int i = 0; i < 2; i++)
+            {
+                EXPECT_FALSE(data[i]["fields"].diff(n_read[i]["fields"], info));
+            }
+        }
+    }
+
+    relay::io::blueprint::CheckpointManager ckpt;
+    EXPECT_FALSE(ckpt.is_open());
+    Node data;
+    EXPECT_THROW(ckpt.write(data), conduit::Error);
+
+    Node opts;
+    EXPECT_THROW(ckpt.open(opts), conduit::Error);
+    opts["tiers"] = "tout_relay_bp_ckpt_bad";
+    opts["protocol"] = "yaml";
+    EXPECT_THROW(ckpt.open(opts), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_relay, write_mesh_silo)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    bool silo_enabled = io_protos["io/protocols/conduit_silo_mesh"].as_string() == "enabled";
+    if(!silo_enabled)
+    {
+        CONDUIT_INFO("Silo disabled, skipping write_mesh_silo test");
+        return;
+    }
+
+    Node data;
+    blueprint::mesh::examples::spiral(5,data);
+
+    // one file per domain, N domains to M files, and root only
+    for(int nfiles = 0; nfiles < 3; nfiles++)
+    {
+        std::string output_base = conduit_fmt::format("tout_relay_bp_mesh_silo_nfiles_{}",
+                                                      nfiles);
+        std::string output_dir  = output_base + ".cycle_000000";
+        std::string output_root = output_base + ".cycle_000000.root";
+
+        Node opts;
+        opts["truncate"] = "true";
+        if(nfiles == 1)
+        {
+            opts["file_style"] = "root_only";
+        }
+        else
+        {
+            opts["number_of_files"] = nfiles;
+        }
+
+        relay::io::blueprint::write_mesh(data,
+                                         output_base,
+                                         "silo",
+                                         opts);
+
+        EXPECT_TRUE(is_file(output_root));
+
+        int expected_files = 1;
+        if(nfiles == 0)
+        {
+            expected_files = 5;
+            for(int i = 0; i < 5; i++)
+            {
+                std::string fname = conduit_fmt::format("domain_{:06d}.silo",i);
+                EXPECT_TRUE(is_file(join_file_path(output_dir,fname)));
+            }
+        }
+        else if(nfiles == 2)
+        {
+            expected_files = 2;
+            for(int i = 0; i < 2; i++)
+            {
+                std::string fname = conduit_fmt::format("file_{:06d}.silo",i);
+                EXPECT_TRUE(is_file(join_file_path(output_dir,fname)));
+            }
+        }
+
+        // the blueprint root info is kept next to the multimeshes
+        Node n_root;
+        relay::io::load(output_root + ":blueprint_root",
+                        "conduit_silo",
+                        n_root);
+        EXPECT_EQ(n_root["number_of_trees"].to_int(), 5);
+        EXPECT_EQ(n_root["number_of_files"].to_int(), expected_files);
+        EXPECT_EQ(n_root["protocol/name"].as_string(), "silo");
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_relay, save_with_subdir)
 {
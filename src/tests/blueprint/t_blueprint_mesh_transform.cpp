@@ -403,6 +403,116 @@ TEST(conduit_blueprint_mesh_transform, topology_transform_dtypes)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, to_unstructured_threaded)
+{
+    XformTopoFun xform_funs[3] = {
+        blueprint::mesh::topology::uniform::to_unstructured,
+        blueprint::mesh::topology::rectilinear::to_unstructured,
+        blueprint::mesh::topology::structured::to_unstructured};
+    const std::string braid_types[3] = {"uniform", "rectilinear", "structured"};
+
+    Node opts;
+    opts["num_threads"] = 4;
+
+    for(index_t npts_z = 0; npts_z <= 9; npts_z += 9)
+    {
+        for(index_t xi = 0; xi < 3; xi++)
+        {
+            Node mesh;
+            blueprint::mesh::examples::braid(braid_types[xi], 65, 33, npts_z, mesh);
+            const Node &topo = mesh["topologies"].child(0);
+
+            Node topo_serial, coords_serial, topo_threaded, coords_threaded, info;
+            xform_funs[xi](topo, topo_serial, coords_serial);
+            if(xi == 0)
+            {
+                blueprint::mesh::topology::uniform::to_unstructured(topo,
+                    topo_threaded, coords_threaded, opts);
+            }
+            else if(xi == 1)
+            {
+                blueprint::mesh::topology::rectilinear::to_unstructured(topo,
+                    topo_threaded, coords_threaded, opts);
+            }
+            else
+            {
+                blueprint::mesh::topology::structured::to_unstructured(topo,
+                    topo_threaded, coords_threaded, opts);
+            }
+
+            EXPECT_FALSE(topo_serial.diff(topo_threaded, info));
+            EXPECT_FALSE(coords_serial.diff(coords_threaded, info));
+
+            // last element, in the default blueprint vertex order
+            const index_t last_elem[8] = {2078, 2079, 2144, 2143,
+                                          4223, 4224, 4289, 4288};
+            const index_t npe = (npts_z == 0) ? 4 : 8;
+            index_t_accessor conn =
+                topo_threaded["elements/connectivity"].as_index_t_accessor();
+            const index_t first = conn.number_of_elements() - npe;
+            const index_t base = (npts_z == 0) ? 0 : 2145 * 7;
+            for(index_t i = 0; i < npe; i++)
+            {
+                EXPECT_EQ(conn[first + i], base + last_elem[i]);
+            }
+        }
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, to_unstructured_strided)
+{
+    for(index_t nz = 0; nz <= 2; nz += 2)
+    {
+        Node desc, mesh;
+        blueprint::mesh::examples::strided_structured(desc, 3, 2, nz, mesh);
+        const Node &topo = mesh["topologies/mesh"];
+        const Node &dims = topo["elements/dims"];
+
+        Node utopo, ucoords, info;
+        blueprint::mesh::topology::structured::to_unstructured(topo, utopo, ucoords);
+        EXPECT_TRUE(blueprint::mesh::topology::unstructured::verify(utopo, info));
+
+        // the connectivity indexes the padded coordset, which is kept as is
+        EXPECT_FALSE(mesh["coordsets/coords"].diff(ucoords, info));
+
+        const index_t ndims = (nz == 0) ? 2 : 3;
+        const index_t npe = (ndims == 2) ? 4 : 8;
+        index_t_accessor offsets = dims["offsets"].as_index_t_accessor();
+        index_t_accessor strides = dims["strides"].as_index_t_accessor();
+        index_t_accessor conn = utopo["elements/connectivity"].as_index_t_accessor();
+
+        const index_t edims[3] = {dims["i"].to_index_t(),
+                                  dims["j"].to_index_t(),
+                                  ndims == 3 ? dims["k"].to_index_t() : 1};
+        ASSERT_EQ(conn.number_of_elements(), edims[0] * edims[1] * edims[2] * npe);
+
+        index_t ei = 0;
+        for(index_t k = 0; k < edims[2]; k++)
+        {
+            for(index_t j = 0; j < edims[1]; j++)
+            {
+                for(index_t i = 0; i < edims[0]; i++, ei++)
+                {
+                    index_t v0 = (offsets[0] + i) * strides[0] +
+                                 (offsets[1] + j) * strides[1];
+                    if(ndims == 3)
+                    {
+                        v0 += (offsets[2] + k) * strides[2];
+                    }
+                    EXPECT_EQ(conn[ei * npe], v0);
+                    EXPECT_EQ(conn[ei * npe + 1], v0 + strides[0]);
+                    EXPECT_EQ(conn[ei * npe + 2], v0 + strides[0] + strides[1]);
+                    EXPECT_EQ(conn[ei * npe + 3], v0 + strides[1]);
+                }
+            }
+        }
+    }
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_transform, polygonal_transforms)
 {
@@ -557,6 +667,37 @@ TEST(conduit_blueprint_mesh_transform, polygonal_transforms)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, to_polyhedral_threaded)
+{
+    const std::string mesh_types[4] = {"hexs", "tets", "wedges", "pyramids"};
+
+    Node opts;
+    opts["num_threads"] = 4;
+
+    for(index_t mi = 0; mi < 4; mi++)
+    {
+        Node mesh;
+        blueprint::mesh::examples::braid(mesh_types[mi], 6, 7, 8, mesh);
+        const Node &topo = mesh["topologies/mesh"];
+
+        Node poly_serial, poly_threaded, info;
+        blueprint::mesh::topology::unstructured::to_polytopal(topo, poly_serial);
+        blueprint::mesh::topology::unstructured::to_polytopal(topo, poly_threaded, opts);
+
+        EXPECT_TRUE(blueprint::mesh::topology::unstructured::verify(poly_threaded, info));
+        EXPECT_FALSE(poly_serial.diff(poly_threaded, info)) << mesh_types[mi];
+
+        if(mesh_types[mi] == "hexs")
+        {
+            // 5 x 6 x 7 hexs share their interior faces
+            const index_t num_faces = 6 * 6 * 7 + 5 * 7 * 7 + 5 * 6 * 8;
+            EXPECT_EQ(poly_threaded["subelements/sizes"].dtype().number_of_elements(),
+                      num_faces);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_transform, to_poly_alias_call)
 {
@@ -647,6 +788,40 @@ TEST(conduit_blueprint_mesh_transform, adjset_transforms)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_transform, adjset_mesh_transforms)
+{
+    // the mesh variants match converting each domain's adjset
+    Node mesh, info;
+    blueprint::mesh::examples::grid("hexs",3,3,3,2,2,2,mesh);
+    const std::string adjset_name = mesh.child(0)["adjsets"].child(0).name();
+    Node orig = mesh;
+
+    Node opts;
+    opts["num_threads"] = 4;
+    blueprint::mesh::adjset::to_pairwise(mesh, adjset_name, "pairwise", opts);
+    blueprint::mesh::adjset::to_maxshare(mesh, "pairwise", "maxshare", opts);
+    opts["num_threads"] = 1;
+    blueprint::mesh::adjset::to_pairwise(mesh, adjset_name, adjset_name, opts);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh, info));
+
+    for(const std::string &domain_name : mesh.child_names())
+    {
+        Node &adjsets = mesh[domain_name]["adjsets"];
+        Node &orig_adjsets = orig[domain_name]["adjsets"];
+        EXPECT_TRUE(blueprint::mesh::adjset::is_pairwise(adjsets["pairwise"]));
+        EXPECT_TRUE(blueprint::mesh::adjset::is_maxshare(adjsets["maxshare"]));
+
+        Node &ref_pairwise = orig_adjsets["pairwise"];
+        blueprint::mesh::adjset::to_pairwise(orig_adjsets[adjset_name], ref_pairwise);
+        EXPECT_FALSE(adjsets["pairwise"].diff(ref_pairwise, info));
+        EXPECT_FALSE(adjsets[adjset_name].diff(ref_pairwise, info));
+        Node &ref_maxshare = orig_adjsets["maxshare"];
+        blueprint::mesh::adjset::to_maxshare(ref_pairwise, ref_maxshare);
+        EXPECT_FALSE(adjsets["maxshare"].diff(ref_maxshare, info));
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_transform, adjset_transform_dtypes)
 {
@@ -2761,3 +2761,86 @@ TEST(conduit_blueprint_mesh_verify, empty_mesh_vs_gen_index)
     
 }
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, mesh_verify_options)
+{
+    Node mesh, info, opts;
+    blueprint::mesh::examples::braid("mixed_2d",5,5,0,mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts));
+
+    // an invalid shape id is only found by the full level
+    int32_array shapes = mesh["topologies/mesh/elements/shapes"].value();
+    shapes[0] = 99;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    opts["level"] = "shallow";
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts));
+    opts["level"] = "bogus";
+    EXPECT_THROW(blueprint::mesh::verify(mesh,info,opts),conduit::Error);
+
+    // cached results are reused until the mesh changes
+    mesh["topologies/mesh/elements/shapes"].invalidate_hash();
+    opts["level"] = "full";
+    opts["cache"] = "true";
+    Node cached_info, diff_info;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,cached_info,opts));
+    EXPECT_FALSE(info.diff(cached_info,diff_info));
+
+    // writes through the array aren't tracked until the hash is invalidated
+    shapes[0] = mesh["topologies/mesh/elements/shape_map/quad"].to_int32();
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    mesh["topologies/mesh/elements/shapes"].invalidate_hash();
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts));
+
+    // Node methods that change the mesh invalidate the cached result
+    mesh["coordsets/coords/type"] = "bogus";
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    mesh["coordsets/coords/type"] = "explicit";
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts));
+
+    // multi domain meshes use the same levels
+    Node multi;
+    multi.append().set_external(mesh);
+    opts["level"] = "shallow";
+    EXPECT_TRUE(blueprint::mesh::verify(multi,info,opts));
+    EXPECT_TRUE(blueprint::mesh::is_multi_domain(multi));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, mesh_verify_num_threads)
+{
+    Node mesh;
+    for(index_t di = 0; di < 6; di++)
+    {
+        Node &dom = mesh.append();
+        blueprint::mesh::examples::braid(di % 2 == 0 ? "quads" : "hexs",
+                                         4,4,di % 2 == 0 ? 0 : 4,dom);
+        dom["state/domain_id"] = di;
+        dom["fields/radial_copy"].set(dom["fields/radial"]);
+    }
+    // one invalid field reference
+    mesh[3]["fields/radial_copy/topology"] = "bogus";
+
+    Node info, opts;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+
+    for(index_t nt : {2, 4, 16})
+    {
+        Node nt_info, diff_info;
+        opts["num_threads"] = nt;
+        EXPECT_FALSE(blueprint::mesh::verify(mesh,nt_info,opts));
+        EXPECT_FALSE(info.diff(nt_info,diff_info));
+        EXPECT_EQ(info.to_json(),nt_info.to_json());
+    }
+
+    // fields of a single domain
+    mesh[3]["fields/radial_copy/topology"] = "mesh";
+    opts["num_threads"] = 1;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh[3],info,opts));
+    Node nt_info;
+    opts["num_threads"] = 3;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh[3],nt_info,opts));
+    EXPECT_EQ(info.to_json(),nt_info.to_json());
+}
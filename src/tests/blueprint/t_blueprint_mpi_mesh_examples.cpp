@@ -0,0 +1,176 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_blueprint_mpi_mesh_examples.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+#include "conduit_blueprint_mpi.hpp"
+#include "conduit_blueprint_mpi_mesh_examples.hpp"
+#include "conduit_relay_mpi.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// Maps each adjset group's set of domains (including the owning domain) to
+// its sorted vertex ids, so adjsets can be compared independent of group
+// names and value order.
+typedef std::map<std::set<index_t>, std::vector<index_t> > adjset_map;
+
+adjset_map
+adjset_by_domains(const Node &dom)
+{
+    adjset_map res;
+    if(!dom.has_path("adjsets/mesh_adj/groups"))
+    {
+        return res;
+    }
+
+    const index_t dom_id = dom["state/domain_id"].to_index_t();
+    NodeConstIterator gitr = dom["adjsets/mesh_adj/groups"].children();
+    while(gitr.has_next())
+    {
+        const Node &group = gitr.next();
+        std::set<index_t> doms;
+        doms.insert(dom_id);
+        index_t_accessor nbrs = group["neighbors"].as_index_t_accessor();
+        for(index_t i = 0; i < nbrs.number_of_elements(); i++)
+        {
+            doms.insert(nbrs[i]);
+        }
+
+        std::vector<index_t> &vals = res[doms];
+        index_t_accessor gvals = group["values"].as_index_t_accessor();
+        for(index_t i = 0; i < gvals.number_of_elements(); i++)
+        {
+            vals.push_back(gvals[i]);
+        }
+        std::sort(vals.begin(), vals.end());
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+check_grid_matches_serial(const std::string &mesh_type,
+                          index_t npts_x, index_t npts_y, index_t npts_z,
+                          index_t ndoms_x, index_t ndoms_y, index_t ndoms_z)
+{
+    Node opts;
+    opts["num_threads"] = 2;
+
+    Node mesh;
+    blueprint::mpi::mesh::examples::grid(mesh_type,
+                                         npts_x, npts_y, npts_z,
+                                         ndoms_x, ndoms_y, ndoms_z,
+                                         opts,
+                                         mesh,
+                                         MPI_COMM_WORLD);
+
+    // every domain is created exactly once across the ranks
+    const index_t ndoms = ndoms_x * ndoms_y * ndoms_z;
+    Node n_local, n_global;
+    n_local.set_int64(mesh.number_of_children());
+    relay::mpi::sum_all_reduce(n_local, n_global, MPI_COMM_WORLD);
+    EXPECT_EQ(n_global.to_index_t(), ndoms);
+
+    Node info;
+    EXPECT_TRUE(blueprint::mpi::verify("mesh", mesh, info, MPI_COMM_WORLD));
+
+    // the local domains match the serial grid example
+    Node serial;
+    blueprint::mesh::examples::grid(mesh_type,
+                                    npts_x, npts_y, npts_z,
+                                    ndoms_x, ndoms_y, ndoms_z,
+                                    serial);
+
+    NodeConstIterator ditr = mesh.children();
+    while(ditr.has_next())
+    {
+        const Node &dom = ditr.next();
+        const std::string dom_name = ditr.name();
+        ASSERT_TRUE(serial.has_child(dom_name)) << dom_name;
+        const Node &sdom = serial[dom_name];
+
+        EXPECT_FALSE(dom["coordsets"].diff(sdom["coordsets"], info)) << dom_name;
+        EXPECT_FALSE(dom["topologies"].diff(sdom["topologies"], info)) << dom_name;
+        EXPECT_FALSE(dom["fields"].diff(sdom["fields"], info)) << dom_name;
+        EXPECT_EQ(dom["state/domain_id"].to_index_t(),
+                  sdom["state/domain_id"].to_index_t());
+
+        EXPECT_EQ(adjset_by_domains(dom), adjset_by_domains(sdom)) << dom_name;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_examples, grid_2d)
+{
+    check_grid_matches_serial("uniform", 5, 4, 0, 3, 2, 1);
+    check_grid_matches_serial("quads", 4, 5, 0, 2, 3, 1);
+    check_grid_matches_serial("tris", 3, 3, 0, 1, 4, 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_examples, grid_3d)
+{
+    check_grid_matches_serial("rectilinear", 4, 3, 3, 2, 2, 2);
+    check_grid_matches_serial("hexs", 3, 4, 3, 3, 2, 2);
+    check_grid_matches_serial("tets", 3, 3, 3, 1, 2, 3);
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_examples, grid_single_domain)
+{
+    Node mesh;
+    blueprint::mpi::mesh::examples::grid("structured", 4, 4, 0, 1, 1, 1,
+                                         mesh, MPI_COMM_WORLD);
+
+    Node info;
+    EXPECT_TRUE(blueprint::mpi::verify("mesh", mesh, info, MPI_COMM_WORLD));
+
+    if(relay::mpi::rank(MPI_COMM_WORLD) == relay::mpi::size(MPI_COMM_WORLD) - 1)
+    {
+        EXPECT_EQ(mesh.number_of_children(), 1);
+        EXPECT_FALSE(mesh["domain0"].has_child("adjsets"));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_examples, grid_bad_args)
+{
+    Node mesh;
+    // mesh type without lattice vertices
+    EXPECT_THROW(blueprint::mpi::mesh::examples::grid("mixed", 3, 3, 3, 2, 1, 1,
+                                                      mesh, MPI_COMM_WORLD),
+                 conduit::Error);
+    // 2D domains can't be stacked in z
+    EXPECT_THROW(blueprint::mpi::mesh::examples::grid("quads", 3, 3, 0, 2, 1, 2,
+                                                      mesh, MPI_COMM_WORLD),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
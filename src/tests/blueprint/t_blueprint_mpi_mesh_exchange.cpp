@@ -0,0 +1,393 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_blueprint_mpi_mesh_exchange.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+#include "conduit_blueprint_mpi.hpp"
+#include "conduit_relay_mpi.hpp"
+#include "conduit_fmt/conduit_fmt.h"
+
+#include <vector>
+#include <string>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+/// Test Helpers ///
+
+// domains of NVERTS entries in a chain, domain d shares its last two
+// entries with the first two of domain d + 1, and entry 2 of every domain
+// is shared by all of them
+static const index_t NVERTS = 6;
+static const index_t DOMS_PER_RANK = 3;
+
+//-----------------------------------------------------------------------------
+static void
+make_chain(Node &mesh, int par_rank, int par_size)
+{
+    const int64 ndoms = DOMS_PER_RANK * par_size;
+    for(int64 d = DOMS_PER_RANK * par_rank; d < DOMS_PER_RANK * (par_rank + 1); d++)
+    {
+        Node &dom = mesh[conduit_fmt::format("domain_{:06d}", d)];
+        dom["state/domain_id"] = d;
+
+        Node &field = dom["fields/f"];
+        field["association"] = "vertex";
+        field["topology"] = "topo";
+        field["values/a"].set(DataType::float64(NVERTS));
+        field["values/b"].set(DataType::int32(NVERTS));
+        float64_array a = field["values/a"].value();
+        int32_array b = field["values/b"].value();
+        for(index_t k = 0; k < NVERTS; k++)
+        {
+            a[k] = 1000.0 * d + k;
+            b[k] = (int32)(-1000 * d - k);
+        }
+
+        Node &adjset = dom["adjsets/adj"];
+        adjset["association"] = "vertex";
+        adjset["topology"] = "topo";
+        Node &groups = adjset["groups"];
+        if(d > 0)
+        {
+            Node &group = groups["prev"];
+            group["neighbors"].set(std::vector<int64>{d - 1});
+            group["values"].set(std::vector<int64>{0, 1});
+        }
+        if(d < ndoms - 1)
+        {
+            Node &group = groups["next"];
+            group["neighbors"].set(std::vector<int64>{d + 1});
+            group["values"].set(std::vector<int64>{NVERTS - 2, NVERTS - 1});
+        }
+        if(ndoms > 1)
+        {
+            std::vector<int64> others;
+            for(int64 o = 0; o < ndoms; o++)
+            {
+                if(o != d)
+                {
+                    others.push_back(o);
+                }
+            }
+            Node &group = groups["all"];
+            group["neighbors"].set(others);
+            group["values"].set(std::vector<int64>{2});
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// the owner's value of entry k of domain d after an exchange
+static float64
+expected_value(int64 d, index_t k)
+{
+    if(d > 0 && k < 2)
+    {
+        return 1000.0 * (d - 1) + (NVERTS - 2 + k);
+    }
+    if(d > 0 && k == 2)
+    {
+        return 2.0;
+    }
+    return 1000.0 * d + k;
+}
+
+/// Test Cases ///
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, chain_field)
+{
+    int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    Node mesh;
+    make_chain(mesh, par_rank, par_size);
+
+    blueprint::mpi::mesh::AdjsetExchange plan;
+    EXPECT_FALSE(plan.is_built());
+    plan.build(mesh, "adj", MPI_COMM_WORLD);
+    EXPECT_TRUE(plan.is_built());
+
+    // the same plan is used for several cycles
+    for(int cycle = 0; cycle < 3; cycle++)
+    {
+        plan.exchange(mesh, "f");
+
+        NodeIterator itr = mesh.children();
+        while(itr.has_next())
+        {
+            Node &dom = itr.next();
+            const int64 d = dom["state/domain_id"].to_int64();
+            float64_array a = dom["fields/f/values/a"].value();
+            int32_array b = dom["fields/f/values/b"].value();
+            for(index_t k = 0; k < NVERTS; k++)
+            {
+                const float64 expected = expected_value(d, k) + cycle;
+                EXPECT_EQ(a[k], expected) << "domain " << d << " entry " << k;
+                EXPECT_EQ(b[k], (int32)(-expected));
+                // move every value for the next cycle
+                a[k] += 1.0;
+                b[k] -= 1;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, chain_values)
+{
+    int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    Node mesh;
+    make_chain(mesh, par_rank, par_size);
+
+    blueprint::mpi::mesh::AdjsetExchange plan;
+    plan.build(mesh, "adj", MPI_COMM_WORLD);
+
+    // every domain but the first receives its two chain entries and entry 2
+    const index_t ndoms = DOMS_PER_RANK * par_size;
+    index_t expected_recv = 0;
+    for(int64 d = DOMS_PER_RANK * par_rank; d < DOMS_PER_RANK * (par_rank + 1); d++)
+    {
+        if(d > 0)
+        {
+            expected_recv += 3;
+        }
+    }
+    EXPECT_EQ(plan.number_of_recv_entries(), expected_recv);
+    index_t total_sent = 0, total_recv = 0;
+    const index_t local_sent = plan.number_of_send_entries();
+    const index_t local_recv = plan.number_of_recv_entries();
+    MPI_Allreduce(&local_sent, &total_sent, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&local_recv, &total_recv, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(total_sent, total_recv);
+    EXPECT_EQ(total_recv, 3 * (ndoms - 1));
+
+    // a separate array per domain
+    std::vector<Node> ids(DOMS_PER_RANK);
+    std::vector<Node *> values;
+    for(index_t i = 0; i < DOMS_PER_RANK; i++)
+    {
+        const int64 d = DOMS_PER_RANK * par_rank + i;
+        ids[i].set(DataType::int64(NVERTS));
+        int64_array vals = ids[i].value();
+        for(index_t k = 0; k < NVERTS; k++)
+        {
+            vals[k] = 1000 * d + k;
+        }
+        values.push_back(&ids[i]);
+    }
+    plan.exchange(values);
+    for(index_t i = 0; i < DOMS_PER_RANK; i++)
+    {
+        const int64 d = DOMS_PER_RANK * par_rank + i;
+        int64_array vals = ids[i].value();
+        for(index_t k = 0; k < NVERTS; k++)
+        {
+            EXPECT_EQ(vals[k], (int64)expected_value(d, k));
+        }
+    }
+
+    // one value array per domain is required
+    values.pop_back();
+    EXPECT_THROW(plan.exchange(values), conduit::Error);
+
+    plan.reset();
+    EXPECT_FALSE(plan.is_built());
+    EXPECT_THROW(plan.exchange(mesh, "f"), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, mismatched_groups)
+{
+    int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    Node mesh;
+    make_chain(mesh, par_rank, par_size);
+
+    // the last domain lists one more shared entry than its owner
+    const int64 last = DOMS_PER_RANK * par_size - 1;
+    if(par_rank == par_size - 1)
+    {
+        Node &group = mesh[conduit_fmt::format("domain_{:06d}", last)]
+                          ["adjsets/adj/groups/prev"];
+        group["values"].set(std::vector<int64>{0, 1, 3});
+    }
+
+    blueprint::mpi::mesh::AdjsetExchange plan;
+    EXPECT_THROW(plan.build(mesh, "adj", MPI_COMM_WORLD), conduit::Error);
+    EXPECT_FALSE(plan.is_built());
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, exchange_fields)
+{
+    int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    Node mesh;
+    make_chain(mesh, par_rank, par_size);
+    NodeIterator itr = mesh.children();
+    while(itr.has_next())
+    {
+        Node &dom = itr.next();
+        const int64 d = dom["state/domain_id"].to_int64();
+        Node &field = dom["fields/g"];
+        field["association"] = "vertex";
+        field["topology"] = "topo";
+        field["values"].set(DataType::int64(NVERTS));
+        int64_array vals = field["values"].value();
+        for(index_t k = 0; k < NVERTS; k++)
+        {
+            vals[k] = 7 * (1000 * d + k);
+        }
+        // provides no values for the shared entries
+        Node &elem_field = dom["fields/e"];
+        elem_field["association"] = "element";
+        elem_field["topology"] = "topo";
+        elem_field["values"].set(DataType::float64(1));
+    }
+
+    std::vector<std::string> fields = {"f", "g"};
+    blueprint::mpi::mesh::exchange_fields(mesh, "adj", fields, MPI_COMM_WORLD);
+
+    itr = mesh.children();
+    while(itr.has_next())
+    {
+        Node &dom = itr.next();
+        const int64 d = dom["state/domain_id"].to_int64();
+        float64_array a = dom["fields/f/values/a"].value();
+        int32_array b = dom["fields/f/values/b"].value();
+        int64_array g = dom["fields/g/values"].value();
+        for(index_t k = 0; k < NVERTS; k++)
+        {
+            const float64 expected = expected_value(d, k);
+            EXPECT_EQ(a[k], expected);
+            EXPECT_EQ(b[k], (int32)(-expected));
+            EXPECT_EQ(g[k], 7 * (int64)expected);
+        }
+    }
+
+    // the element field doesn't match the vertex adjset
+    fields.push_back("e");
+    EXPECT_THROW(blueprint::mpi::mesh::exchange_fields(mesh, "adj", fields,
+                                                       MPI_COMM_WORLD),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, generate_maxshare_adjset)
+{
+    int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    Node mesh;
+    make_chain(mesh, par_rank, par_size);
+    // the chain entries are listed in descending order on both sides
+    NodeIterator itr = mesh.children();
+    while(itr.has_next())
+    {
+        Node &groups = itr.next()["adjsets/adj/groups"];
+        if(groups.has_child("prev"))
+        {
+            groups["prev/values"].set(std::vector<int64>{1, 0});
+        }
+        if(groups.has_child("next"))
+        {
+            groups["next/values"].set(std::vector<int64>{NVERTS - 1, NVERTS - 2});
+        }
+    }
+
+    blueprint::mpi::mesh::generate_maxshare_adjset(mesh, "adj", "max",
+                                                   MPI_COMM_WORLD);
+
+    const int64 ndoms = DOMS_PER_RANK * par_size;
+    itr = mesh.children();
+    while(itr.has_next())
+    {
+        Node &dom = itr.next();
+        const int64 d = dom["state/domain_id"].to_int64();
+        const Node &adjset = dom["adjsets/max"];
+        EXPECT_EQ(adjset["association"].as_string(), "vertex");
+        EXPECT_EQ(adjset["topology"].as_string(), "topo");
+
+        // the chain entries and entry 2 are in separate groups
+        const index_t expected_groups = 1 + (d > 0 ? 1 : 0) + (d < ndoms - 1 ? 1 : 0);
+        EXPECT_EQ(adjset["groups"].number_of_children(), expected_groups);
+        NodeConstIterator gitr = adjset["groups"].children();
+        while(gitr.has_next())
+        {
+            const Node &group = gitr.next();
+            const int64_accessor nbrs = group["neighbors"].as_int64_accessor();
+            const int64_accessor vals = group["values"].as_int64_accessor();
+            if(nbrs.number_of_elements() > 1)
+            {
+                EXPECT_EQ(vals.number_of_elements(), 1);
+                EXPECT_EQ(vals[0], 2);
+            }
+            else if(nbrs[0] == d + 1)
+            {
+                // owned by this domain, ascending
+                EXPECT_EQ(vals[0], NVERTS - 2);
+                EXPECT_EQ(vals[1], NVERTS - 1);
+            }
+            else
+            {
+                // in the order of the matching entries of domain d - 1
+                EXPECT_EQ(nbrs[0], d - 1);
+                EXPECT_EQ(vals[0], 0);
+                EXPECT_EQ(vals[1], 1);
+            }
+        }
+    }
+
+    blueprint::mpi::mesh::AdjsetExchange plan;
+    plan.build(mesh, "max", MPI_COMM_WORLD);
+    plan.exchange(mesh, "f");
+    itr = mesh.children();
+    while(itr.has_next())
+    {
+        Node &dom = itr.next();
+        const int64 d = dom["state/domain_id"].to_int64();
+        float64_array a = dom["fields/f/values/a"].value();
+        for(index_t k = 0; k < NVERTS; k++)
+        {
+            EXPECT_EQ(a[k], expected_value(d, k)) << "domain " << d << " entry " << k;
+        }
+    }
+
+    // the last domain lists one more shared entry than its owner
+    const int64 last = ndoms - 1;
+    if(par_rank == par_size - 1)
+    {
+        Node &group = mesh[conduit_fmt::format("domain_{:06d}", last)]
+                          ["adjsets/adj/groups/prev"];
+        group["values"].set(std::vector<int64>{0, 1, 3});
+    }
+    EXPECT_THROW(blueprint::mpi::mesh::generate_maxshare_adjset(mesh, "adj",
+                     "max", MPI_COMM_WORLD), conduit::Error);
+}
+
+/// Test Driver ///
+
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
@@ -8,7 +8,9 @@
 ///
 //-----------------------------------------------------------------------------
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include <conduit.hpp>
@@ -17,6 +19,8 @@
 #include <conduit_relay.hpp>
 #include <conduit_relay_mpi.hpp>
 #include <conduit_relay_mpi_io_blueprint.hpp>
+#include <conduit_relay_io_csv.hpp>
+#include <conduit_relay_mpi_io_csv.hpp>
 
 #include <mpi.h>
 #include "gtest/gtest.h"
@@ -346,6 +350,67 @@ TEST(t_blueprint_mpi_mesh_flatten, spiral_select_fields_empty_root)
     }
 }
 
+//-----------------------------------------------------------------------------
+std::string
+read_text_file(const std::string &path)
+{
+    std::ifstream fin(path);
+    std::stringstream ss;
+    ss << fin.rdbuf();
+    return ss.str();
+}
+
+TEST(t_blueprint_mpi_mesh_flatten, spiral_collective_csv)
+{
+    const MPI_Comm comm = MPI_COMM_WORLD;
+    const int no_data = 1;
+
+    int rank = -1;
+    MPI_Comm_rank(comm, &rank);
+
+    Node mesh;
+    blueprint::mpi::mesh::examples::spiral_round_robin(4, mesh, comm);
+    if(rank == no_data)
+    {
+        mesh.reset();
+    }
+
+    // The gathered table written by root
+    Node table, opts;
+    opts["add_rank"] = 1;
+    blueprint::mpi::mesh::flatten(mesh, opts, table, comm);
+    const std::string gathered_path = "tout_mpi_flatten_gathered_csv";
+    if(rank == 0)
+    {
+        relay::io::write_csv(table, gathered_path, Node());
+    }
+
+    // Each rank keeps its own rows and they are written collectively
+    Node local_table;
+    opts["gather"] = 0;
+    blueprint::mpi::mesh::flatten(mesh, opts, local_table, comm);
+    if(rank != no_data)
+    {
+        EXPECT_TRUE(local_table.has_path("vertex_data/values"));
+    }
+    const std::string collective_path = "tout_mpi_flatten_collective_csv";
+    relay::mpi::io::write_csv(local_table, collective_path, Node(), comm);
+    barrier();
+
+    if(rank == 0)
+    {
+        for(const std::string name : {"vertex_data", "element_data"})
+        {
+            const std::string gathered = read_text_file(gathered_path
+                + sep + name + ".csv");
+            const std::string collective = read_text_file(collective_path
+                + sep + name + ".csv");
+            EXPECT_FALSE(gathered.empty());
+            EXPECT_EQ(gathered, collective);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -522,6 +522,135 @@ TEST(blueprint_mpi_parmetis, empty_mesh_on_non_root_rank)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_parmetis, weights)
+{
+    int par_size, par_rank;
+
+    MPI_Comm_size(MPI_COMM_WORLD, &par_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &par_rank);
+
+    Node mesh;
+    conduit::blueprint::mesh::examples::braid("quads",11,11,0,mesh.append());
+    Node &dom = mesh[0];
+    dom["state/domain_id"] = par_rank;
+
+    // on each mpi task, shift all the coords over,
+    // so domains don't overlap
+    float64_array xvals = dom["coordsets/coords/values/x"].value();
+    for(index_t i=0;i<xvals.number_of_elements();i++)
+    {
+        xvals[i] += 25.0 * par_rank;
+    }
+
+    // the elements with x < 0 are ten times as expensive, every element
+    // uses the same memory
+    const index_t num_eles = 100;
+    Node &work = dom["fields/work"];
+    work["association"] = "element";
+    work["topology"] = "mesh";
+    work["values"].set(DataType::float64(num_eles));
+    float64_array work_vals = work["values"].value();
+    for(index_t i=0;i<num_eles;i++)
+    {
+        work_vals[i] = ((i % 10) < 5) ? 10.0 : 1.0;
+    }
+    Node &mem = dom["fields/mem"];
+    mem["association"] = "vertex";
+    mem["topology"] = "mesh";
+    mem["values"].set(DataType::int32(121));
+    int32_array mem_vals = mem["values"].value();
+    for(index_t i=0;i<mem_vals.number_of_elements();i++)
+    {
+        mem_vals[i] = 4;
+    }
+
+    Node part_opts;
+    part_opts["partitions"] = 2;
+    part_opts["topology"] = "mesh";
+    part_opts["element_weights"] = "work";
+    part_opts["vertex_weights"].append().set("mem");
+    part_opts["imbalance"].set(std::vector<float64>{1.05, 1.2});
+    conduit::blueprint::mpi::mesh::generate_partition_field(mesh,
+                                                            part_opts,
+                                                            MPI_COMM_WORLD);
+
+    // each partition gets about half of the work
+    int64_array part = dom["fields/parmetis_result/values"].value();
+    EXPECT_EQ(part.number_of_elements(), num_eles);
+    float64 local_work[2] = {0.0, 0.0};
+    float64 global_work[2] = {0.0, 0.0};
+    for(index_t i=0;i<num_eles;i++)
+    {
+        ASSERT_TRUE(part[i] == 0 || part[i] == 1);
+        local_work[part[i]] += work_vals[i];
+    }
+    MPI_Allreduce(local_work, global_work, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    const float64 total_work = global_work[0] + global_work[1];
+    EXPECT_LT(global_work[0], 0.6 * total_work);
+    EXPECT_LT(global_work[1], 0.6 * total_work);
+
+    // every rank fails when a weight field doesn't match the topology
+    part_opts["element_weights"] = (par_rank == 0) ? "mem" : "work";
+    EXPECT_THROW(conduit::blueprint::mpi::mesh::generate_partition_field(mesh,
+                     part_opts, MPI_COMM_WORLD), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_parmetis, repartition)
+{
+    int par_size, par_rank;
+
+    MPI_Comm_size(MPI_COMM_WORLD, &par_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &par_rank);
+
+    Node mesh;
+    conduit::blueprint::mesh::examples::braid("quads",11,11,0,mesh.append());
+    Node &dom = mesh[0];
+    dom["state/domain_id"] = par_rank;
+
+    // on each mpi task, shift all the coords over,
+    // so domains don't overlap
+    float64_array xvals = dom["coordsets/coords/values/x"].value();
+    for(index_t i=0;i<xvals.number_of_elements();i++)
+    {
+        xvals[i] += 20.0 * par_rank;
+    }
+
+    // the mesh is already balanced, so most elements keep the rank
+    // that holds them
+    Node part_opts;
+    part_opts["topology"] = "mesh";
+    part_opts["repartition"] = 1;
+    conduit::blueprint::mpi::mesh::generate_partition_field(mesh,
+                                                            part_opts,
+                                                            MPI_COMM_WORLD);
+    int64_array part = dom["fields/parmetis_result/values"].value();
+    EXPECT_EQ(part.number_of_elements(), 100);
+    index_t kept = 0;
+    for(index_t i=0;i<part.number_of_elements();i++)
+    {
+        ASSERT_TRUE(part[i] >= 0 && part[i] < par_size);
+        kept += (part[i] == par_rank) ? 1 : 0;
+    }
+    EXPECT_GT(kept, 50);
+
+    // repartition again from that result
+    part_opts["current_partition"] = "parmetis_result";
+    part_opts["field_prefix"] = "next_";
+    conduit::blueprint::mpi::mesh::generate_partition_field(mesh,
+                                                            part_opts,
+                                                            MPI_COMM_WORLD);
+    EXPECT_TRUE(dom.has_path("fields/next_parmetis_result"));
+
+    // every rank fails when the current partition is out of range
+    part_opts["partitions"] = 1;
+    part_opts["current_partition"] = "global_element_ids";
+    part_opts["field_prefix"] = "";
+    EXPECT_THROW(conduit::blueprint::mpi::mesh::generate_partition_field(mesh,
+                     part_opts, MPI_COMM_WORLD), conduit::Error);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
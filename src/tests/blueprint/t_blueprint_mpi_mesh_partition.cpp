@@ -801,6 +801,173 @@ TEST(blueprint_mesh_mpi_partition, field_selection)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+TEST(blueprint_mesh_mpi_partition, sfc_selection)
+{
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // Split a mesh into 8 domains and give each rank 2 of them.
+    conduit::Node braid, split, input, options, output, serial_output;
+    conduit::blueprint::mesh::examples::braid("hexs", 11, 11, 11, braid);
+    options["target"] = 8;
+    conduit::blueprint::mesh::partition(braid, options, split);
+    for(conduit::index_t i = 0; i < split.number_of_children(); i++)
+    {
+        split[i]["state/domain_id"] = i;
+        if(i / 2 == rank)
+            input.append().set_external(split[i]);
+    }
+
+    // Cutting the curve through the domains on all ranks gives the same
+    // domains as cutting it through all of the domains on one rank.
+    const char *opts =
+"selections:\n"
+"   -\n"
+"     type: sfc\n"
+"     domain_id: any\n"
+"target: 3\n";
+    options.reset(); options.parse(opts, "yaml");
+    conduit::blueprint::mpi::mesh::partition(input, options, output, MPI_COMM_WORLD);
+    conduit::blueprint::mesh::partition(split, options, serial_output);
+
+    std::vector<conduit::int64> lengths(3, 0);
+    for(const conduit::Node *dom : conduit::blueprint::mesh::domains(output))
+    {
+        conduit::index_t domid = (*dom)["state/domain_id"].to_index_t();
+        ASSERT_LT(domid, 3);
+        lengths[domid] = conduit::blueprint::mesh::topology::length((*dom)["topologies"][0]);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, lengths.data(), 3, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+    for(const conduit::Node *dom : conduit::blueprint::mesh::domains(serial_output))
+    {
+        conduit::index_t domid = (*dom)["state/domain_id"].to_index_t();
+        EXPECT_EQ(lengths[domid],
+                  conduit::blueprint::mesh::topology::length((*dom)["topologies"][0]));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mesh_mpi_partition, minimize_migration)
+{
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // Each rank sends 90 of its elements to the next domain and 10 to the
+    // one after that, the way a small rebalance would.
+    conduit::Node input, options, output;
+    conduit::Node &dom = input.append();
+    conduit::blueprint::mesh::examples::braid("quads", 11, 11, 0, dom);
+    dom["state/domain_id"] = rank;
+    conduit::float64_array xvals = dom["coordsets/coords/values/x"].value();
+    for(conduit::index_t i = 0; i < xvals.number_of_elements(); i++)
+        xvals[i] += 25. * rank;
+    const int nelem = 100;
+    conduit::Node &n_field = dom["fields/part"];
+    n_field["association"] = "element";
+    n_field["topology"] = "mesh";
+    n_field["values"].set(conduit::DataType::int32(nelem));
+    conduit::int32_array part = n_field["values"].value();
+    for(int i = 0; i < nelem; i++)
+        part[i] = (i < 90) ? ((rank + 1) % size) : ((rank + 2) % size);
+
+    const char *opts =
+"selections:\n"
+"   -\n"
+"     type: field\n"
+"     domain_id: any\n"
+"     field: part\n"
+"minimize_migration: 1\n";
+    options.parse(opts, "yaml");
+    conduit::blueprint::mpi::mesh::partition(input, options, output, MPI_COMM_WORLD);
+
+    // The domain made mostly from this rank's elements stays here, so only
+    // the other 10 elements were sent.
+    ASSERT_EQ(conduit::blueprint::mesh::number_of_domains(output), 1);
+    const conduit::Node &out_dom = *conduit::blueprint::mesh::domains(output)[0];
+    EXPECT_EQ(out_dom["state/domain_id"].to_int(), (rank + 1) % size);
+    EXPECT_EQ(conduit::blueprint::mesh::topology::length(out_dom["topologies/mesh"]), nelem);
+    conduit::Node n_domains;
+    out_dom["fields/original_element_ids/values/domains"].to_int32_array(n_domains);
+    conduit::int32_array orig_domains = n_domains.value();
+    int from_here = 0;
+    for(conduit::index_t i = 0; i < orig_domains.number_of_elements(); i++)
+        from_here += (orig_domains[i] == rank) ? 1 : 0;
+    EXPECT_EQ(from_here, 90);
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mesh_mpi_partition, map_back_vertex_fields)
+{
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // Split each rank's domain between the next two ranks so every output
+    // domain needs the global vertex ids of domains that live elsewhere.
+    conduit::Node input, options, output;
+    conduit::Node &dom = input.append();
+    conduit::blueprint::mesh::examples::braid("quads", 11, 11, 0, dom);
+    dom["state/domain_id"] = rank;
+    conduit::float64_array xvals = dom["coordsets/coords/values/x"].value();
+    for(conduit::index_t i = 0; i < xvals.number_of_elements(); i++)
+        xvals[i] += 25. * rank;
+    const int nelem = 100, nvert = 121;
+    conduit::Node &n_field = dom["fields/part"];
+    n_field["association"] = "element";
+    n_field["topology"] = "mesh";
+    n_field["values"].set(conduit::DataType::int32(nelem));
+    conduit::int32_array part = n_field["values"].value();
+    for(int i = 0; i < nelem; i++)
+        part[i] = (i < 50) ? ((rank + 1) % size) : ((rank + 2) % size);
+    conduit::Node &n_gvids = dom["fields/global_vertex_ids"];
+    n_gvids["association"] = "vertex";
+    n_gvids["topology"] = "mesh";
+    n_gvids["values"].set(conduit::DataType::index_t(nvert));
+    conduit::index_t_array gvids = n_gvids["values"].value();
+    for(int i = 0; i < nvert; i++)
+        gvids[i] = rank * nvert + i;
+
+    const char *opts =
+"selections:\n"
+"   -\n"
+"     type: field\n"
+"     domain_id: any\n"
+"     field: part\n";
+    options.parse(opts, "yaml");
+    conduit::blueprint::mpi::mesh::partition(input, options, output, MPI_COMM_WORLD);
+
+    // Make a vertex field on the output from its global vertex ids.
+    for(conduit::Node *out_dom : conduit::blueprint::mesh::domains(output))
+    {
+        conduit::Node n_out_gvids;
+        (*out_dom)["fields/global_vertex_ids/values"].to_int64_array(n_out_gvids);
+        conduit::int64_array out_gvids = n_out_gvids.value();
+        conduit::Node &n_mapback = (*out_dom)["fields/mapback"];
+        n_mapback["association"] = "vertex";
+        n_mapback["topology"] = "mesh";
+        n_mapback["values"].set(conduit::DataType::float64(out_gvids.number_of_elements()));
+        conduit::float64_array mapback = n_mapback["values"].value();
+        for(conduit::index_t i = 0; i < out_gvids.number_of_elements(); i++)
+            mapback[i] = 2. * out_gvids[i];
+    }
+
+    conduit::Node mapback_opts;
+    mapback_opts["fields"].append().set("mapback");
+    conduit::blueprint::mpi::mesh::partition_map_back(output,
+                                                      mapback_opts,
+                                                      input,
+                                                      MPI_COMM_WORLD);
+
+    ASSERT_TRUE(dom["fields"].has_child("mapback"));
+    conduit::float64_array mapback = dom["fields/mapback/values"].value();
+    ASSERT_EQ(mapback.number_of_elements(), nvert);
+    for(int i = 0; i < nvert; i++)
+        EXPECT_EQ(mapback[i], 2. * gvids[i]);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
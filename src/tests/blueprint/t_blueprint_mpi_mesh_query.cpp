@@ -14,6 +14,7 @@
 #include "conduit_relay_mpi.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 #include <string>
@@ -65,6 +66,84 @@ TEST(conduit_blueprint_mpi_mesh_transform, find_delegate_domain)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mpi_mesh_query, reduce_by_material)
+{
+    const int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    const int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    Node domain;
+    blueprint::mesh::examples::venn("sparse_by_material", 10, 10, 0.25, domain);
+    const Node &mset = domain["matsets/matset"];
+    const Node &field = domain["fields/importance"];
+
+    // rank 0 has no domains when there are other ranks, the others one
+    // copy of the domain each
+    Node mesh;
+    const int num_holders = (par_size > 1) ? par_size - 1 : 1;
+    if(par_size == 1 || par_rank > 0)
+    {
+        mesh.set_external(domain);
+    }
+
+    Node opts, dom_opts;
+    opts["weights_field"] = "area";
+    dom_opts["element_weights"].set_external(domain["fields/area/values"]);
+
+    const std::vector<std::string> ops = {"sum", "min", "max", "average"};
+    for(const std::string &op : ops)
+    {
+        Node expected, res;
+        blueprint::mesh::matset::reduce_by_material(mset, field, op, expected, dom_opts);
+        blueprint::mpi::mesh::reduce_by_material(mesh, "matset", "importance",
+                                                 op, res, opts, MPI_COMM_WORLD);
+        EXPECT_EQ(res.number_of_children(), expected.number_of_children());
+
+        NodeConstIterator mat_itr = expected.children();
+        while(mat_itr.has_next())
+        {
+            const float64 expected_val = mat_itr.next().as_float64();
+            const float64 scale = (op == "sum") ? num_holders : 1.0;
+            EXPECT_NEAR(res[mat_itr.name()].as_float64(), scale * expected_val,
+                        1e-10 * std::max(1.0, std::abs(scale * expected_val)));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mpi_mesh_query, coordset_extents)
+{
+    const int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    const int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    // each rank has a unit square shifted by its rank along x, and the
+    // last rank has no domains when there are other ranks
+    Node mesh;
+    if(par_size == 1 || par_rank < par_size - 1)
+    {
+        Node &dom = mesh["domain_0"];
+        dom["state/domain_id"] = par_rank;
+        dom["coordsets/coords/type"] = "uniform";
+        dom["coordsets/coords/dims/i"] = 2;
+        dom["coordsets/coords/dims/j"] = 2;
+        dom["coordsets/coords/origin/x"] = (float64)par_rank;
+        dom["coordsets/coords/origin/y"] = 0.0;
+    }
+
+    const std::vector<float64> exts =
+        blueprint::mpi::mesh::coordset_extents(mesh, "coords", MPI_COMM_WORLD);
+    const int num_holders = (par_size > 1) ? par_size - 1 : 1;
+    ASSERT_EQ(exts.size(), 4);
+    EXPECT_EQ(exts[0], 0.0);
+    EXPECT_EQ(exts[1], (float64)num_holders);
+    EXPECT_EQ(exts[2], 0.0);
+    EXPECT_EQ(exts[3], 1.0);
+
+    const std::vector<float64> none_exts =
+        blueprint::mpi::mesh::coordset_extents(mesh, "missing", MPI_COMM_WORLD);
+    EXPECT_TRUE(none_exts.empty());
+}
+
 /// Test Driver ///
 
 int main(int argc, char* argv[])
@@ -724,6 +724,151 @@ TEST(blueprint_mpi_relay, test_write_error_hang)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_relay, write_mesh_aggregators)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    bool hdf5_enabled = io_protos["io/protocols/hdf5"].as_string() == "enabled";
+
+    // only run this test if hdf5 is enabled
+    if(!hdf5_enabled)
+    {
+        CONDUIT_INFO("hdf5 is disabled, skipping hdf5 dependent test");
+        return;
+    }
+
+    MPI_Comm comm = MPI_COMM_WORLD;
+    int par_rank = mpi::rank(comm);
+    int par_size = mpi::size(comm);
+
+    // 3 doms per mpi task
+    Node data;
+    for(int i = 0; i < 3; i++)
+    {
+        Node &dom = data.append();
+        blueprint::mesh::examples::braid("uniform", 3, 3, 0, dom);
+        dom["state/domain_id"] = 3 * par_rank + i;
+        dom["state/cycle"] = 100;
+    }
+
+    // the # of aggregators is clamped to the # of files
+    for(int naggs = -1; naggs < 5; naggs++)
+    {
+        std::string output_base = conduit_fmt::format(
+                                    "tout_relay_mpi_mesh_aggregators_{}",
+                                    naggs);
+        Node opts;
+        opts["number_of_files"] = 2;
+        opts["number_of_aggregators"] = naggs;
+        opts["truncate"] = "true";
+
+        conduit::relay::mpi::io::blueprint::write_mesh(data,
+                                                       output_base,
+                                                       "hdf5",
+                                                       opts,
+                                                       comm);
+
+        std::string output_dir = output_base + ".cycle_000100";
+        for(int f = 0; f < 2; f++)
+        {
+            std::string fcheck = join_file_path(output_dir,
+                                    conduit_fmt::format("file_{:06d}.hdf5", f));
+            EXPECT_TRUE(conduit::utils::is_file(fcheck));
+        }
+
+        Node n_read, info;
+        relay::mpi::io::blueprint::read_mesh(output_base +
+                                                ".cycle_000100.root",
+                                             n_read,
+                                             comm);
+
+        EXPECT_EQ(conduit::blueprint::mpi::mesh::number_of_domains(n_read,
+                                                                   comm),
+                  3 * par_size);
+
+        for(int dom_idx = 0; dom_idx < 3; dom_idx++)
+        {
+            EXPECT_FALSE(data.child(dom_idx).diff(n_read.child(dom_idx),
+                                                  info));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_relay, read_mesh_balance)
+{
+    MPI_Comm comm = MPI_COMM_WORLD;
+    int par_rank = mpi::rank(comm);
+    int par_size = mpi::size(comm);
+
+    // 2 doms per mpi task, domain 0 is much larger than the others
+    Node data;
+    for(int i = 0; i < 2; i++)
+    {
+        int domain_id = 2 * par_rank + i;
+        int dim = domain_id == 0 ? 40 : 4;
+        Node &dom = data.append();
+        blueprint::mesh::examples::braid("uniform", dim, dim, 0, dom);
+        dom["state/domain_id"] = domain_id;
+        dom["state/cycle"] = 100;
+    }
+
+    std::string output_base = "tout_relay_mpi_mesh_read_balance";
+    Node opts;
+    opts["number_of_files"] = par_size;
+    opts["truncate"] = "true";
+    conduit::relay::mpi::io::blueprint::write_mesh(data,
+                                                   output_base,
+                                                   "json",
+                                                   opts,
+                                                   comm);
+    std::string output_root = output_base + ".cycle_000100.root";
+
+    Node root;
+    if(par_rank == 0)
+    {
+        relay::io::load(output_root, "json", root);
+        EXPECT_EQ(root["domain_sizes/elements"].dtype().number_of_elements(),
+                  2 * par_size);
+        int64_array elements = root["domain_sizes/elements"].value();
+        EXPECT_EQ(elements[0], 39 * 39);
+        EXPECT_EQ(elements[1], 3 * 3);
+        EXPECT_GT(root["domain_sizes/bytes"].to_int64(), 0);
+    }
+
+    std::vector<std::string> balances = {"elements", "bytes"};
+    for(size_t b = 0; b < balances.size(); b++)
+    {
+        Node read_opts, n_read;
+        read_opts["balance"] = balances[b];
+        relay::mpi::io::blueprint::read_mesh(output_root,
+                                             read_opts,
+                                             n_read,
+                                             comm);
+
+        EXPECT_EQ(conduit::blueprint::mpi::mesh::number_of_domains(n_read,
+                                                                   comm),
+                  2 * par_size);
+        // the large domain is read alone
+        if(par_size > 1 && n_read.has_child("domain_000000"))
+        {
+            EXPECT_EQ(n_read.number_of_children(), 1);
+        }
+    }
+
+    // each rank reads the two domains of one file
+    Node read_opts, n_read;
+    read_opts["group_by_file"] = "true";
+    relay::mpi::io::blueprint::read_mesh(output_root,
+                                         read_opts,
+                                         n_read,
+                                         comm);
+    ASSERT_EQ(n_read.number_of_children(), 2);
+    EXPECT_EQ(n_read[0]["state/domain_id"].to_int() / 2,
+              n_read[1]["state/domain_id"].to_int() / 2);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
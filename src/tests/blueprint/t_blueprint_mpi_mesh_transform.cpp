@@ -569,6 +569,105 @@ TEST(conduit_blueprint_mpi_mesh_transform, generate_corners)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mpi_mesh_transform, generate_adjsets)
+{
+    const int par_rank = relay::mpi::rank(MPI_COMM_WORLD);
+    const int par_size = relay::mpi::size(MPI_COMM_WORLD);
+
+    const std::string ELEM_TYPES[2] = {"quads", "hexs"};
+    for(index_t ti = 0; ti < 2; ti++)
+    {
+        const bool is_3d = ELEM_TYPES[ti] == "hexs";
+        Node full_mesh;
+        conduit::blueprint::mesh::examples::grid(ELEM_TYPES[ti],
+            3, 3, is_3d ? 3 : 0, 2, 2, is_3d ? 2 : 1, full_mesh);
+
+        // every rank keeps some of the domains, without their adjsets
+        Node rank_mesh, expected;
+        for(index_t di = 0; di < full_mesh.number_of_children(); di++)
+        {
+            if(di % par_size != par_rank)
+            {
+                continue;
+            }
+            const std::string &domain_name = full_mesh.child(di).name();
+            Node &domain = rank_mesh[domain_name];
+            domain.set(full_mesh[domain_name]);
+            conduit::blueprint::mesh::adjset::to_pairwise(
+                domain["adjsets/mesh_adj"], expected[domain_name]);
+            domain.remove("adjsets");
+
+            // a value that identifies each point
+            const index_t npts = conduit::blueprint::mesh::coordset::length(domain["coordsets/coords"]);
+            float64_accessor x = domain["coordsets/coords/values/x"].value();
+            float64_accessor y = domain["coordsets/coords/values/y"].value();
+            Node &field = domain["fields/pos"];
+            field["association"] = "vertex";
+            field["topology"] = "mesh";
+            field["values"].set(DataType::float64(npts));
+            float64_array pos = field["values"].value();
+            for(index_t pi = 0; pi < npts; pi++)
+            {
+                pos[pi] = 1000.0 * x[pi] + y[pi];
+                if(is_3d)
+                {
+                    pos[pi] += 1.0e6 * domain["coordsets/coords/values/z"].as_float64_accessor()[pi];
+                }
+            }
+        }
+
+        Node opts;
+        opts["num_threads"] = 2;
+        conduit::blueprint::mpi::mesh::generate_adjsets(rank_mesh, "mesh", "gen",
+                                                         1.0e-8, opts,
+                                                         MPI_COMM_WORLD);
+
+        NodeIterator itr = rank_mesh.children();
+        while(itr.has_next())
+        {
+            Node &domain = itr.next();
+            Node info;
+            const Node &gen = domain["adjsets/gen"];
+            EXPECT_TRUE(conduit::blueprint::mesh::adjset::verify(gen, info));
+            EXPECT_TRUE(conduit::blueprint::mesh::adjset::is_pairwise(gen));
+
+            // the same points are shared with the same neighbors
+            const Node &exp_groups = expected[domain.name()]["groups"];
+            ASSERT_EQ(gen["groups"].number_of_children(),
+                      exp_groups.number_of_children());
+            for(index_t gi = 0; gi < exp_groups.number_of_children(); gi++)
+            {
+                const Node &exp_group = exp_groups[gi];
+                const Node &gen_group = gen["groups"][gi];
+                EXPECT_EQ(gen_group["neighbors"].to_int64(),
+                          exp_group["neighbors"].to_int64());
+                std::vector<int64> exp_vals, gen_vals;
+                for(index_t vi = 0; vi < exp_group["values"].dtype().number_of_elements(); vi++)
+                {
+                    exp_vals.push_back(exp_group["values"].as_int64_accessor()[vi]);
+                }
+                for(index_t vi = 0; vi < gen_group["values"].dtype().number_of_elements(); vi++)
+                {
+                    gen_vals.push_back(gen_group["values"].as_int64_accessor()[vi]);
+                }
+                std::sort(exp_vals.begin(), exp_vals.end());
+                std::sort(gen_vals.begin(), gen_vals.end());
+                EXPECT_EQ(gen_vals, exp_vals);
+            }
+        }
+
+        // both sides list the shared points in the same order
+        Node before;
+        before.set(rank_mesh);
+        std::vector<std::string> fields = {"pos"};
+        conduit::blueprint::mpi::mesh::exchange_fields(rank_mesh, "gen", fields,
+                                                       MPI_COMM_WORLD);
+        Node diff_info;
+        EXPECT_FALSE(rank_mesh.diff(before, diff_info));
+    }
+}
+
 /// Test Driver ///
 
 int main(int argc, char* argv[])
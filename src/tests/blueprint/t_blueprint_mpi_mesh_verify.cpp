@@ -217,6 +217,155 @@ TEST(blueprint_mpi_smoke, multi_domain)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_smoke, generate_index_root_and_summaries)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &par_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &par_size);
+
+    // one domain per rank, the last rank's domain has an extra field and
+    // rank 0 has no domains
+    conduit::Node mesh;
+    if(par_rank > 0 || par_size == 1)
+    {
+        conduit::Node &domain = mesh["domain_0"];
+        conduit::blueprint::mesh::examples::braid("uniform", 5, 5, 0, domain);
+        domain["state/domain_id"] = par_rank;
+        if(par_rank == par_size - 1)
+        {
+            domain["fields/extra"].set(domain["fields/braid"]);
+        }
+    }
+
+    conduit::Node all_index;
+    conduit::blueprint::mpi::mesh::generate_index(mesh,
+                                                  "",
+                                                  all_index,
+                                                  MPI_COMM_WORLD);
+    EXPECT_TRUE(all_index.has_path("fields/extra"));
+    EXPECT_EQ(all_index["state/number_of_domains"].to_index_t(),
+              (par_size == 1) ? 1 : par_size - 1);
+
+    // only root gets the index
+    const int root = par_size - 1;
+    conduit::Node root_index, info;
+    conduit::blueprint::mpi::mesh::generate_index(mesh,
+                                                  "",
+                                                  root_index,
+                                                  root,
+                                                  MPI_COMM_WORLD);
+    if(par_rank == root)
+    {
+        EXPECT_FALSE(root_index.diff(all_index, info));
+    }
+    else
+    {
+        EXPECT_TRUE(root_index.dtype().is_empty());
+    }
+
+    // per domain summaries give the same index
+    conduit::Node summaries;
+    conduit::NodeConstIterator itr = mesh.children();
+    while(itr.has_next())
+    {
+        conduit::blueprint::mesh::generate_index_for_single_domain(itr.next(),
+                                                                   "",
+                                                                   summaries.append());
+    }
+
+    conduit::Node summary_index;
+    conduit::blueprint::mpi::mesh::generate_index_from_summaries(summaries,
+                                                                 summary_index,
+                                                                 0,
+                                                                 MPI_COMM_WORLD);
+    if(par_rank == 0)
+    {
+        EXPECT_FALSE(summary_index.diff(all_index, info));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_smoke, domain_to_rank_map_directory)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &par_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &par_size);
+
+    // rank r holds domains 2r and 2r+1, each one's adjset references the
+    // previous and next domain
+    const conduit::int64 num_domains = 2 * par_size;
+    conduit::Node mesh;
+    for(conduit::int64 dom = 2 * par_rank; dom < 2 * par_rank + 2; dom++)
+    {
+        conduit::Node &domain = mesh[conduit_fmt::format("domain_{:d}", dom)];
+        domain["state/domain_id"] = dom;
+        std::vector<conduit::int64> nbrs;
+        if(dom > 0)
+        {
+            nbrs.push_back(dom - 1);
+        }
+        if(dom < num_domains - 1)
+        {
+            nbrs.push_back(dom + 1);
+        }
+        for(size_t i = 0; i < nbrs.size(); i++)
+        {
+            conduit::Node &group = domain["adjsets/adj/groups"].append();
+            group["neighbors"].set(std::vector<conduit::int64>{dom, nbrs[i]});
+        }
+    }
+
+    conduit::Node dense;
+    conduit::blueprint::mpi::mesh::generate_domain_to_rank_map(mesh,
+                                                               dense,
+                                                               MPI_COMM_WORLD);
+    conduit::int64_array dense_array = dense.as_int64_array();
+
+    // query every domain, unordered with repeats, plus one that doesn't exist
+    std::vector<conduit::int64> ids;
+    for(conduit::int64 dom = num_domains; dom >= 0; dom--)
+    {
+        ids.push_back(dom);
+        ids.push_back(dom);
+    }
+    conduit::Node n_ids, sparse;
+    n_ids.set(ids);
+    conduit::blueprint::mpi::mesh::generate_domain_to_rank_map(mesh,
+                                                               n_ids,
+                                                               sparse,
+                                                               MPI_COMM_WORLD);
+    ASSERT_EQ(sparse["domain_ids"].dtype().number_of_elements(), num_domains + 1);
+    conduit::int64_array sparse_ids = sparse["domain_ids"].as_int64_array();
+    conduit::int64_array sparse_ranks = sparse["ranks"].as_int64_array();
+    for(conduit::int64 dom = 0; dom < num_domains; dom++)
+    {
+        EXPECT_EQ(sparse_ids[dom], dom);
+        EXPECT_EQ(sparse_ranks[dom], dense_array[dom]);
+    }
+    EXPECT_EQ(sparse_ids[num_domains], num_domains);
+    EXPECT_EQ(sparse_ranks[num_domains], -1);
+
+    // the neighbors of the adjsets, which include the local domains
+    conduit::Node nbr_map;
+    conduit::blueprint::mpi::mesh::generate_neighbor_domain_to_rank_map(mesh,
+                                                                        nbr_map,
+                                                                        MPI_COMM_WORLD);
+    conduit::int64_array nbr_ids = nbr_map["domain_ids"].as_int64_array();
+    conduit::int64_array nbr_ranks = nbr_map["ranks"].as_int64_array();
+    const conduit::int64 first = std::max<conduit::int64>(2 * par_rank - 1, 0);
+    const conduit::int64 last = std::min<conduit::int64>(2 * par_rank + 2,
+                                                         num_domains - 1);
+    ASSERT_EQ(nbr_ids.number_of_elements(), last - first + 1);
+    for(conduit::index_t i = 0; i < nbr_ids.number_of_elements(); i++)
+    {
+        EXPECT_EQ(nbr_ids[i], first + i);
+        EXPECT_EQ(nbr_ranks[i], (first + i) / 2);
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
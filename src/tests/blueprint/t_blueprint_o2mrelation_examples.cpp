@@ -339,3 +339,125 @@ TEST(conduit_blueprint_o2mrelation_examples, o2mrelation_iterator_iteration)
         EXPECT_EQ(ref_data, n_data);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Collects the data values of an o2mrelation through an O2MView.
+struct O2MViewCollector
+{
+    const float32_array &data;
+    std::vector<float> &res;
+
+    template <typename IndexT>
+    void operator()(const blueprint::o2mrelation::O2MView<IndexT> &view) const
+    {
+        for(const auto &one : view)
+        {
+            for(const index_t d : one)
+            {
+                res.push_back(data[d]);
+            }
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_o2mrelation_examples, o2mrelation_view)
+{
+    Node n, ref, info;
+
+    { // Offsets Tests //
+        // o2m:
+        //   data: [1.0, 2.0, -1.0, -1.0, 3.0, 4.0, -1.0, -1.0, 5.0, 6.0, -1.0, -1.0]
+        //   sizes: [2, 2, 2]
+        //   offsets: [0, 4, 8]
+        blueprint::o2mrelation::examples::uniform(n, 3, 2, 4);
+        blueprint::o2mrelation::O2MView<uint32> view(n);
+        EXPECT_EQ(view.size(), 3);
+        EXPECT_EQ(view.size(1), 2);
+        EXPECT_EQ(view.index(1, 1), 5);
+        EXPECT_EQ(view[2].id(), 2);
+        EXPECT_EQ(view[2].size(), 2);
+        EXPECT_EQ(view[2][0], 8);
+        EXPECT_EQ(view.end() - view.begin(), 3);
+        EXPECT_EQ((*(view.begin() + 1))[1], 5);
+
+        EXPECT_FALSE(blueprint::o2mrelation::O2MView<int32>::is_compatible(n));
+        EXPECT_THROW(blueprint::o2mrelation::O2MView<int32> bad_view(n), conduit::Error);
+    }
+
+    { // Forward/Backward Indices Tests //
+        const std::vector<std::string> index_types = {"unspecified", "default", "reversed"};
+        for(const std::string &index_type : index_types)
+        {
+            blueprint::o2mrelation::examples::uniform(n, 3, 2, 4, index_type);
+            blueprint::o2mrelation::examples::uniform(ref, 3, 2);
+            EXPECT_TRUE(blueprint::o2mrelation::verify(n,info));
+
+            std::vector<float> ref_data = get_o2m_raw(ref, true);
+            if(index_type == "reversed")
+            {
+                // the ones are reversed, the items of each one aren't
+                std::vector<float> rev_data;
+                for(index_t i = 2; i >= 0; i--)
+                {
+                    rev_data.push_back(ref_data[2 * i]);
+                    rev_data.push_back(ref_data[2 * i + 1]);
+                }
+                ref_data = rev_data;
+            }
+
+            std::vector<float> view_data;
+            const float32_array n_array = n["data"].value();
+            const O2MViewCollector collector = {n_array, view_data};
+            blueprint::o2mrelation::dispatch_view(n, collector);
+            EXPECT_EQ(ref_data, view_data);
+        }
+    }
+
+    { // Index Type Tests //
+        Node n_int32;
+        blueprint::o2mrelation::examples::uniform(n, 4, 3, 5, "default");
+        n_int32["data"].set_external(n["data"]);
+        n["sizes"].to_int32_array(n_int32["sizes"]);
+        n["offsets"].to_int32_array(n_int32["offsets"]);
+        n["indices"].to_int32_array(n_int32["indices"]);
+
+        std::vector<float> uint32_data, int32_data;
+        const float32_array n_array = n["data"].value();
+        const O2MViewCollector uint32_collector = {n_array, uint32_data};
+        const O2MViewCollector int32_collector = {n_array, int32_data};
+        blueprint::o2mrelation::dispatch_view(n, uint32_collector);
+        blueprint::o2mrelation::dispatch_view(n_int32, int32_collector);
+        EXPECT_EQ(uint32_data, get_o2m_iter(n, true));
+        EXPECT_EQ(int32_data, uint32_data);
+    }
+
+    { // Number Array Tests //
+        n.reset();
+        n.set(DataType::float64(7));
+        blueprint::o2mrelation::O2MView<index_t> view(n);
+        EXPECT_EQ(view.size(), 7);
+        EXPECT_EQ(view[4].size(), 1);
+        EXPECT_EQ(view[4][0], 4);
+    }
+
+    { // Parallel Tests //
+        blueprint::o2mrelation::examples::uniform(n, 10000, 3, 4);
+        blueprint::o2mrelation::O2MView<uint32> view(n);
+        const float32_array n_array = n["data"].value();
+        std::vector<float> sums((size_t)view.size(), 0.0f);
+        blueprint::o2mrelation::parallel_for_ones(view, 4,
+            [&](const blueprint::o2mrelation::O2MView<uint32>::One &one)
+        {
+            for(const index_t d : one)
+            {
+                sums[(size_t)one.id()] += n_array[d];
+            }
+        }, 100);
+
+        for(index_t i = 0; i < view.size(); i++)
+        {
+            EXPECT_EQ(sums[(size_t)i], (float)(9 * i + 6));
+        }
+    }
+}
@@ -9,6 +9,8 @@
 //-----------------------------------------------------------------------------
 #include <algorithm>
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -17,6 +19,7 @@
 #include <conduit_blueprint_mesh_examples.hpp>
 #include <conduit_blueprint_table_examples.hpp>
 #include <conduit_relay_io.hpp>
+#include <conduit_relay_io_blueprint.hpp>
 #include <conduit_relay_io_csv.hpp>
 
 #include "blueprint_test_helpers.hpp"
@@ -194,3 +197,224 @@ TEST(t_blueprint_table_relay, read_write_table_with_list_values)
 
     table::compare_to_baseline(read_table, table);
 }
+
+TEST(t_blueprint_table_relay, write_mesh_csv)
+{
+    // Writes the same files as flatten + write_csv
+    const std::string flat_dir = "t_blueprint_table_relay_write_mesh_csv_flat";
+    const std::string fused_dir = "t_blueprint_table_relay_write_mesh_csv_fused";
+    ASSERT_EQ(0, cleanup_dir(flat_dir));
+    ASSERT_EQ(0, cleanup_dir(fused_dir));
+
+    Node mesh;
+    blueprint::mesh::examples::spiral(4, mesh);
+
+    Node opts, table;
+    blueprint::mesh::flatten(mesh, opts, table);
+    relay::io::write_csv(table, flat_dir, opts);
+
+    opts["batch_rows"] = 5;
+    relay::io::write_mesh_csv(mesh, fused_dir, opts);
+
+    const std::string sep = utils::file_path_separator();
+    for(const std::string name : {"vertex_data.csv", "element_data.csv"})
+    {
+        std::ifstream flat(flat_dir + sep + name), fused(fused_dir + sep + name);
+        ASSERT_TRUE(flat.is_open());
+        ASSERT_TRUE(fused.is_open());
+        std::stringstream flat_text, fused_text;
+        flat_text << flat.rdbuf();
+        fused_text << fused.rdbuf();
+        EXPECT_EQ(flat_text.str(), fused_text.str()) << name;
+    }
+}
+
+TEST(t_blueprint_table_relay, read_csv_threads)
+{
+    // Large enough to be split into several chunks
+    const std::string filename = "t_blueprint_table_relay_read_csv_threads.csv";
+    const index_t nrows = 200000;
+    {
+        std::ofstream fout(filename);
+        fout << "a, b/x, b/y\n";
+        for(index_t i = 0; i < nrows; i++)
+        {
+            fout << i << ", " << (i % 7) * 0.5 << ", " << -i << "\n";
+        }
+        // trailing blank lines are not rows
+        fout << "\n\n";
+    }
+
+    Node opts, serial_table, threaded_table, info;
+    opts["use_float64"] = 1;
+    opts["threads"] = 1;
+    relay::io::read_csv(filename, opts, serial_table);
+    opts["threads"] = 4;
+    relay::io::read_csv(filename, opts, threaded_table);
+
+    EXPECT_FALSE(serial_table.diff(threaded_table, info)) << info.to_yaml();
+    ASSERT_TRUE(blueprint::table::verify(threaded_table, info)) << info.to_yaml();
+
+    const Node &values = threaded_table["values"];
+    ASSERT_EQ(values["a"].dtype().number_of_elements(), nrows);
+    const float64_array a = values["a"].value();
+    const float64_array x = values["b/x"].value();
+    const float64_array y = values["b/y"].value();
+    for(index_t i = 0; i < nrows; i += 9973)
+    {
+        EXPECT_EQ(a[i], double(i));
+        EXPECT_EQ(x[i], (i % 7) * 0.5);
+        EXPECT_EQ(y[i], -double(i));
+    }
+}
+
+TEST(t_blueprint_table_relay, read_csv_errors)
+{
+    const std::string filename = "t_blueprint_table_relay_read_csv_errors.csv";
+    Node opts, table;
+
+    {
+        std::ofstream fout(filename);
+        fout << "a, b\n1, 2\n3\n";
+    }
+    EXPECT_THROW(relay::io::read_csv(filename, opts, table), conduit::Error);
+
+    {
+        std::ofstream fout(filename);
+        fout << "a, b\n1, 2\n3, 4, 5\n";
+    }
+    EXPECT_THROW(relay::io::read_csv(filename, opts, table), conduit::Error);
+
+    {
+        std::ofstream fout(filename);
+        fout << "a, b\n1, 2\n3, four\n";
+    }
+    EXPECT_THROW(relay::io::read_csv(filename, opts, table), conduit::Error);
+}
+
+TEST(t_blueprint_table_relay, write_csv_threads)
+{
+    // Enough rows for several formatting blocks
+    const index_t nrows = 150000;
+    Node table;
+    Node &values = table["values"];
+    values["a"].set(DataType::int64(nrows));
+    values["b/x"].set(DataType::float32(nrows));
+    values["b/y"].set(DataType::float64(nrows));
+    int64_array a = values["a"].value();
+    float32_array x = values["b/x"].value();
+    float64_array y = values["b/y"].value();
+    for(index_t i = 0; i < nrows; i++)
+    {
+        a[i] = -i;
+        x[i] = 0.25f * i;
+        y[i] = 1.0 / (i + 1);
+    }
+
+    const std::string serial_name = "t_blueprint_table_relay_write_csv_threads_1.csv";
+    const std::string threaded_name = "t_blueprint_table_relay_write_csv_threads_4.csv";
+    Node opts;
+    opts["threads"] = 1;
+    relay::io::write_csv(table, serial_name, opts);
+    opts["threads"] = 4;
+    relay::io::write_csv(table, threaded_name, opts);
+
+    std::ifstream serial(serial_name), threaded(threaded_name);
+    std::stringstream serial_text, threaded_text;
+    serial_text << serial.rdbuf();
+    threaded_text << threaded.rdbuf();
+    EXPECT_EQ(serial_text.str(), threaded_text.str());
+
+    Node read_table;
+    opts["use_float64"] = 1;
+    relay::io::read_csv(threaded_name, opts, read_table);
+    const float64_array read_a = read_table["values/a"].value();
+    ASSERT_EQ(read_a.number_of_elements(), nrows);
+    EXPECT_EQ(read_a[nrows - 1], -double(nrows - 1));
+}
+
+TEST(t_blueprint_table_relay, row_groups)
+{
+    const std::string flat_dir = "t_blueprint_table_relay_row_groups_flat";
+    const std::string grouped_dir = "t_blueprint_table_relay_row_groups_grouped";
+    const std::string streamed_file = "t_blueprint_table_relay_row_groups_streamed.csv";
+    const std::string bin_file = "t_blueprint_table_relay_row_groups.conduit_bin";
+    ASSERT_EQ(0, cleanup_dir(flat_dir));
+    ASSERT_EQ(0, cleanup_dir(grouped_dir));
+
+    Node mesh;
+    blueprint::mesh::examples::spiral(4, mesh);
+
+    // flatten into row groups, the rows match the flattened table
+    Node opts, table, grouped, info;
+    blueprint::mesh::flatten(mesh, opts, table);
+    opts["row_group_rows"] = 7;
+    blueprint::mesh::flatten(mesh, opts, grouped);
+    EXPECT_TRUE(blueprint::table::verify(grouped, info)) << info.to_json();
+    const Node &elems = grouped["element_data"];
+    EXPECT_EQ(blueprint::table::number_of_row_groups(elems),
+        (blueprint::table::number_of_rows(table["element_data"]) + 6) / 7);
+
+    Node concat;
+    blueprint::table::concatenate_row_groups(elems, concat);
+    EXPECT_FALSE(concat.diff(table["element_data"], info, 0.0)) << info.to_json();
+
+    // write_csv writes the same files for both
+    Node write_opts;
+    relay::io::write_csv(table, flat_dir, write_opts);
+    relay::io::write_csv(grouped, grouped_dir, write_opts);
+    const std::string sep = utils::file_path_separator();
+    std::stringstream flat_text;
+    for(const std::string name : {"vertex_data.csv", "element_data.csv"})
+    {
+        std::ifstream flat(flat_dir + sep + name), grouped_in(grouped_dir + sep + name);
+        ASSERT_TRUE(flat.is_open());
+        ASSERT_TRUE(grouped_in.is_open());
+        std::stringstream grouped_text;
+        flat_text.str("");
+        flat_text << flat.rdbuf();
+        grouped_text << grouped_in.rdbuf();
+        EXPECT_EQ(flat_text.str(), grouped_text.str()) << name;
+    }
+
+    // streamed one row group at a time
+    {
+        relay::io::CSVTableWriter writer(streamed_file, write_opts);
+        NodeConstIterator itr = elems["row_groups"].children();
+        while(itr.has_next())
+        {
+            writer.write(itr.next());
+        }
+        EXPECT_EQ(writer.number_of_rows(),
+                  blueprint::table::number_of_rows(elems));
+
+        Node other;
+        other["values/a"].set(DataType::float64(3));
+        EXPECT_THROW(writer.write(other), conduit::Error);
+    }
+    std::ifstream streamed(streamed_file);
+    std::stringstream streamed_text;
+    streamed_text << streamed.rdbuf();
+    EXPECT_EQ(flat_text.str(), streamed_text.str());
+
+    // other protocols write a table with row groups
+    {
+        relay::io::blueprint::TableWriter writer(bin_file, "conduit_bin");
+        NodeConstIterator itr = elems["row_groups"].children();
+        while(itr.has_next())
+        {
+            writer.write(itr.next());
+        }
+        EXPECT_EQ(writer.number_of_row_groups(),
+                  blueprint::table::number_of_row_groups(elems));
+        EXPECT_EQ(writer.number_of_rows(),
+                  blueprint::table::number_of_rows(elems));
+    }
+    Node read_table, read_concat;
+    relay::io::load(bin_file, "conduit_bin", read_table);
+    EXPECT_TRUE(blueprint::table::verify(read_table, info)) << info.to_json();
+    blueprint::table::concatenate_row_groups(read_table, read_concat);
+    EXPECT_EQ(blueprint::table::number_of_rows(read_concat),
+              blueprint::table::number_of_rows(concat));
+    EXPECT_FALSE(read_concat.diff(concat, info, 0.0)) << info.to_json();
+}
@@ -300,3 +300,90 @@ TEST(conduit_blueprint_table_verify, empty_column)
     bool res = blueprint::table::verify(table, info);
     EXPECT_FALSE(res) << info.to_json();
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_table_verify, row_groups)
+{
+    Node table, group;
+    make_mixed_table(group);
+    blueprint::table::append_row_group(group, table);
+    blueprint::table::append_row_group(group, table);
+
+    Node info;
+    bool res = blueprint::table::verify(table, info);
+    EXPECT_TRUE(res) << info.to_json();
+    EXPECT_EQ(info["rows"].to_index_t(), 2 * mixed_num_rows);
+    EXPECT_EQ(info["columns"].to_index_t(), mixed_num_cols);
+
+    // row groups are allowed in a collection of tables
+    Node tables;
+    tables["grouped"].set_external(table);
+    make_flat_table(tables["flat"]);
+    res = blueprint::table::verify(tables, info);
+    EXPECT_TRUE(res) << info.to_json();
+
+    // every row group needs the columns of the first one
+    Node flat;
+    make_flat_table(flat);
+    table["row_groups"].append().set(flat);
+    res = blueprint::table::verify(table, info);
+    EXPECT_FALSE(res) << info.to_json();
+    EXPECT_THROW(blueprint::table::append_row_group(flat, table), conduit::Error);
+
+    // as do the types of the columns
+    Node other;
+    make_flat_table(other);
+    other["values/col1"].set(DataType::float64(flat_num_rows));
+    Node flat_groups;
+    blueprint::table::append_row_group(flat, flat_groups);
+    EXPECT_THROW(blueprint::table::append_row_group(other, flat_groups), conduit::Error);
+
+    // no row groups
+    Node empty;
+    empty["row_groups"].set(DataType::list());
+    res = blueprint::table::verify(empty, info);
+    EXPECT_FALSE(res) << info.to_json();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_table_verify, row_group_iteration)
+{
+    Node table, group;
+    make_mixed_table(group);
+    for(int i = 0; i < 3; i++)
+    {
+        blueprint::table::append_row_group(group, table);
+    }
+    EXPECT_EQ(blueprint::table::number_of_rows(table), 3 * mixed_num_rows);
+    EXPECT_EQ(blueprint::table::number_of_row_groups(table), 3);
+    EXPECT_EQ(blueprint::table::number_of_rows(group), mixed_num_rows);
+    EXPECT_EQ(blueprint::table::number_of_row_groups(group), 1);
+
+    std::vector<index_t> offsets;
+    blueprint::table::iterate_row_groups(table,
+        [&](index_t row_offset, const Node &row_group)
+    {
+        offsets.push_back(row_offset);
+        EXPECT_TRUE(row_group.has_child("values"));
+    });
+    const std::vector<index_t> expected = {0, mixed_num_rows, 2 * mixed_num_rows};
+    EXPECT_EQ(offsets, expected);
+
+    // the concatenated table has compact columns with the rows of each group
+    Node concat, info;
+    blueprint::table::concatenate_row_groups(table, concat);
+    EXPECT_TRUE(blueprint::table::verify(concat, info)) << info.to_json();
+    EXPECT_EQ(blueprint::table::number_of_rows(concat), 3 * mixed_num_rows);
+    for(int i = 0; i < 3; i++)
+    {
+        for(index_t r = 0; r < mixed_num_rows; r++)
+        {
+            const index_t row = i * mixed_num_rows + r;
+            EXPECT_EQ(concat["values/scalar1"].as_double_ptr()[row],
+                      group["values/scalar1"].as_double_ptr()[r]);
+            EXPECT_EQ(concat["values/vector0/y"].as_float64_ptr()[row],
+                      group["values/vector0/y"].as_float64_accessor()[r]);
+        }
+    }
+    EXPECT_TRUE(concat["values/vector0/y"].dtype().is_compact());
+}
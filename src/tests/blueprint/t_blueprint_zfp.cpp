@@ -146,3 +146,38 @@ TEST(conduit_blueprint_zfp, zfp_verify_invalid_zfparray_with_incorrect_compresse
     delete [] compressed_data;
 }
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_zfp, zfp_mesh_verify_zfparray_field)
+{
+    Node mesh, info;
+    blueprint::mesh::examples::braid("uniform", 5, 5, 0, mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh, info));
+
+    size_t n_header = 4;
+    uint8 * header = new uint8[n_header]();
+
+    size_t n_compressed_data = 4;
+    uint8 * compressed_data = new uint8[n_compressed_data]();
+
+    // replace the braid values with (dummy) compressed values
+    Node &field = mesh["fields/braid"];
+    field["values"].reset();
+    set_zfparray_node_entries(field["values"], header, n_header, compressed_data, n_compressed_data);
+
+    EXPECT_TRUE(blueprint::mesh::field::verify(field, info));
+    EXPECT_TRUE(blueprint::mesh::verify(mesh, info));
+
+    Node index;
+    blueprint::mesh::generate_index(mesh, "", 1, index);
+    EXPECT_EQ(index["fields/braid/number_of_components"].to_index_t(), 1);
+
+    // an invalid zfparray is not accepted as an mcarray either
+    double dummy = 4.4;
+    field["values"][blueprint::zfparray::ZFP_HEADER_FIELD_NAME] = dummy;
+    EXPECT_FALSE(blueprint::mesh::field::verify(field, info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh, info));
+
+    delete [] header;
+    delete [] compressed_data;
+}
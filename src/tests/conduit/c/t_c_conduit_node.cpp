@@ -626,3 +626,135 @@ TEST(c_conduit_node, c_move_and_swap)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(c_conduit_node, c_batch_set_external_and_fetch)
+{
+    conduit_node *n = conduit_node_create();
+
+    conduit_float64 u_vals[4] = {0.0, 1.0, 2.0, 3.0};
+    conduit_int32   id_vals[2] = {10, 20};
+    conduit_float32 v_vals[3] = {5.0f, 6.0f, 7.0f};
+
+    const char *paths[3] = {"fields/u", "state/ids", "fields/v"};
+    void *data[3] = {u_vals, id_vals, v_vals};
+    conduit_index_t dtype_ids[3] = {CONDUIT_FLOAT64_ID,
+                                    CONDUIT_INT32_ID,
+                                    CONDUIT_FLOAT32_ID};
+    conduit_index_t num_eles[3] = {4, 2, 3};
+
+    conduit_node_set_path_external_batch(n,3,paths,data,dtype_ids,num_eles);
+
+    EXPECT_EQ(conduit_node_fetch_path_as_float64_ptr(n,"fields/u"),u_vals);
+    EXPECT_EQ(conduit_node_fetch_path_as_int32_ptr(n,"state/ids"),id_vals);
+    EXPECT_EQ(conduit_node_fetch_path_as_float32_ptr(n,"fields/v"),v_vals);
+    EXPECT_TRUE(conduit_node_is_data_external(
+                    conduit_node_fetch(n,"fields/u")));
+
+    void *res_data[3];
+    conduit_index_t res_ids[3];
+    conduit_index_t res_num_eles[3];
+    conduit_index_t res_strides[3];
+    conduit_node_fetch_path_data_batch(n,3,paths,
+                                       res_data,res_ids,
+                                       res_num_eles,res_strides);
+    for(int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(res_data[i],data[i]);
+        EXPECT_EQ(res_ids[i],dtype_ids[i]);
+        EXPECT_EQ(res_num_eles[i],num_eles[i]);
+    }
+    EXPECT_EQ(res_strides[0],8);
+    EXPECT_EQ(res_strides[1],4);
+
+    // outputs are optional
+    conduit_node_fetch_path_data_batch(n,3,paths,res_data,NULL,NULL,NULL);
+    EXPECT_EQ(res_data[2],data[2]);
+
+    // pre-parsed path handles
+    const conduit_path *hpaths[3];
+    for(int i = 0; i < 3; i++)
+    {
+        hpaths[i] = conduit_path_create(paths[i]);
+    }
+
+    conduit_node *n_h = conduit_node_create();
+    conduit_node_set_path_handle_external_batch(n_h,3,hpaths,data,
+                                                dtype_ids,num_eles);
+    void *res_h_data[3];
+    conduit_node_fetch_path_handle_data_batch(n_h,3,hpaths,res_h_data,
+                                              NULL,NULL,NULL);
+    for(int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(res_h_data[i],data[i]);
+        conduit_path_destroy((conduit_path*)hpaths[i]);
+    }
+
+    conduit_node_destroy(n_h);
+    conduit_node_destroy(n);
+}
+
+//-----------------------------------------------------------------------------
+TEST(c_conduit_node, c_batch_set_and_copy_with_conversion)
+{
+    conduit_node *n = conduit_node_create();
+
+    conduit_float64 u_vals[4] = {0.5, 1.5, 2.5, 3.5};
+    conduit_int32   id_vals[2] = {10, 20};
+
+    const char *paths[2] = {"fields/u", "state/ids"};
+    const void *data[2] = {u_vals, id_vals};
+    conduit_index_t dtype_ids[2] = {CONDUIT_FLOAT64_ID, CONDUIT_INT32_ID};
+    conduit_index_t num_eles[2] = {4, 2};
+
+    // copy, converting the ids to int64
+    conduit_index_t dest_ids[2] = {CONDUIT_FLOAT64_ID, CONDUIT_INT64_ID};
+    conduit_node_set_path_batch(n,2,paths,data,dtype_ids,num_eles,dest_ids);
+
+    EXPECT_FALSE(conduit_node_is_data_external(
+                    conduit_node_fetch(n,"fields/u")));
+    EXPECT_NE(conduit_node_fetch_path_as_float64_ptr(n,"fields/u"),u_vals);
+    EXPECT_EQ(conduit_node_fetch_path_as_float64_ptr(n,"fields/u")[3],3.5);
+    EXPECT_EQ(conduit_node_fetch_path_as_int64_ptr(n,"state/ids")[1],20);
+
+    // without dest ids the types are kept
+    conduit_node *n_same = conduit_node_create();
+    conduit_node_set_path_batch(n_same,2,paths,data,dtype_ids,num_eles,NULL);
+    EXPECT_EQ(conduit_node_fetch_path_as_int32_ptr(n_same,"state/ids")[0],10);
+
+    // copy out, converting to float32 and int16
+    conduit_float32 u_out[8];
+    conduit_int16   ids_out[2];
+    void *dest[2] = {u_out, ids_out};
+    conduit_index_t out_ids[2] = {CONDUIT_FLOAT32_ID, CONDUIT_INT16_ID};
+    conduit_index_t capacity[2] = {8, 2};
+    conduit_node_fetch_path_copy_batch(n,2,paths,dest,out_ids,capacity);
+    EXPECT_EQ(capacity[0],4);
+    EXPECT_EQ(capacity[1],2);
+    EXPECT_EQ(u_out[2],2.5f);
+    EXPECT_EQ(ids_out[1],20);
+
+    // the same with path handles
+    const conduit_path *hpaths[2] = {conduit_path_create(paths[0]),
+                                     conduit_path_create(paths[1])};
+    conduit_float64 u_out_h[4];
+    conduit_int32   ids_out_h[2];
+    void *dest_h[2] = {u_out_h, ids_out_h};
+    conduit_index_t capacity_h[2] = {4, 2};
+    conduit_node_fetch_path_handle_copy_batch(n,2,hpaths,dest_h,
+                                              dtype_ids,capacity_h);
+    EXPECT_EQ(u_out_h[0],0.5);
+    EXPECT_EQ(ids_out_h[0],10);
+
+    conduit_node *n_h = conduit_node_create();
+    conduit_node_set_path_handle_batch(n_h,2,hpaths,data,dtype_ids,
+                                       num_eles,dest_ids);
+    EXPECT_EQ(conduit_node_fetch_path_as_int64_ptr(n_h,"state/ids")[0],10);
+
+    conduit_path_destroy((conduit_path*)hpaths[0]);
+    conduit_path_destroy((conduit_path*)hpaths[1]);
+
+    conduit_node_destroy(n_h);
+    conduit_node_destroy(n_same);
+    conduit_node_destroy(n);
+}
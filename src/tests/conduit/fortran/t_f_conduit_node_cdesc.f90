@@ -0,0 +1,203 @@
+!* Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+!* Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+!* other details. No copyright assignment is required to contribute to Conduit.
+
+!------------------------------------------------------------------------------
+!
+! t_f_conduit_node_cdesc.f
+!
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+module f_conduit_node_cdesc
+!------------------------------------------------------------------------------
+
+  use iso_c_binding
+  use fruit
+  use conduit
+  use conduit_cdesc
+  implicit none
+
+!------------------------------------------------------------------------------
+contains
+!------------------------------------------------------------------------------
+
+    !--------------------------------------------------------------------------
+    subroutine t_node_set_external_array_contiguous
+        type(C_PTR) cnode
+        real(8), dimension(5), target :: data
+        real(8), pointer :: f_arr(:)
+        integer i
+
+        !----------------------------------------------------------------------
+        call set_case_name("t_node_set_external_array_contiguous")
+        !----------------------------------------------------------------------
+
+        do i = 1,5
+            data(i) = i
+        enddo
+
+        cnode = conduit_node_create()
+        call conduit_node_set_external_array(cnode,data)
+        ! change an element to check the external semantics
+        data(1) = 3.1415d+0
+        call conduit_node_print_detailed(cnode)
+        call assert_equals(5,int(conduit_node_number_of_elements(cnode)))
+        call assert_true(logical(conduit_node_is_data_external(cnode) .eqv. .true. ))
+        call conduit_node_as_float64_ptr(cnode,f_arr)
+        call assert_equals(3.1415d+0,f_arr(1))
+        call assert_equals(5.0d+0,f_arr(5))
+        call conduit_node_destroy(cnode)
+
+    end subroutine t_node_set_external_array_contiguous
+
+    !--------------------------------------------------------------------------
+    subroutine t_node_set_path_external_array_section
+        type(C_PTR) cnode
+        type(C_PTR) ccompact
+        integer(4), dimension(10), target :: data
+        integer(4), pointer :: f_arr(:)
+        integer i
+
+        !----------------------------------------------------------------------
+        call set_case_name("t_node_set_path_external_array_section")
+        !----------------------------------------------------------------------
+
+        do i = 1,10
+            data(i) = i
+        enddo
+
+        cnode = conduit_node_create()
+        ! every other element, described with a stride (no temporary copy)
+        call conduit_node_set_path_external_array(cnode,"fields/odd",data(1:10:2))
+        data(3) = 42
+        call conduit_node_print_detailed(cnode)
+        call assert_equals(5,int(conduit_node_number_of_elements(conduit_node_fetch(cnode,"fields/odd"))))
+        call assert_true(logical(conduit_node_is_compact(cnode) .eqv. .false. ))
+
+        ccompact = conduit_node_create()
+        call conduit_node_compact_to(conduit_node_fetch(cnode,"fields/odd"),ccompact)
+        call conduit_node_as_int32_ptr(ccompact,f_arr)
+        call assert_equals(1,f_arr(1))
+        call assert_equals(42,f_arr(2))
+        call assert_equals(9,f_arr(5))
+        call conduit_node_destroy(ccompact)
+        call conduit_node_destroy(cnode)
+
+    end subroutine t_node_set_path_external_array_section
+
+    !--------------------------------------------------------------------------
+    subroutine t_node_set_path_external_array_2d
+        type(C_PTR) cnode
+        type(C_PTR) ccompact
+        real(4), dimension(4,3), target :: data
+        real(4), pointer :: f_arr(:)
+        integer i, j
+
+        !----------------------------------------------------------------------
+        call set_case_name("t_node_set_path_external_array_2d")
+        !----------------------------------------------------------------------
+
+        do j = 1,3
+            do i = 1,4
+                data(i,j) = i + 10 * j
+            enddo
+        enddo
+
+        cnode = conduit_node_create()
+        ! whole 2d array: 12 values in array element order
+        call conduit_node_set_path_external_array(cnode,"full",data)
+        call assert_equals(12,int(conduit_node_number_of_elements(conduit_node_fetch(cnode,"full"))))
+        ! one row: 3 values, strided by the column length
+        call conduit_node_set_path_external_array(cnode,"row",data(2,:))
+        call conduit_node_print_detailed(cnode)
+
+        ccompact = conduit_node_create()
+        call conduit_node_compact_to(conduit_node_fetch(cnode,"row"),ccompact)
+        call conduit_node_as_float32_ptr(ccompact,f_arr)
+        call assert_equals(3,size(f_arr))
+        call assert_equals(12.0,f_arr(1))
+        call assert_equals(22.0,f_arr(2))
+        call assert_equals(32.0,f_arr(3))
+        call conduit_node_destroy(ccompact)
+        call conduit_node_destroy(cnode)
+
+    end subroutine t_node_set_path_external_array_2d
+
+    !--------------------------------------------------------------------------
+    subroutine t_external_batch_publish
+        type(C_PTR) cnode
+        type(C_PTR) cbatch
+        real(8), dimension(6), target :: pressure
+        integer(8), dimension(3), target :: ids
+        integer i, cycle
+
+        !----------------------------------------------------------------------
+        call set_case_name("t_external_batch_publish")
+        !----------------------------------------------------------------------
+
+        do i = 1,6
+            pressure(i) = i
+        enddo
+        do i = 1,3
+            ids(i) = 100 + i
+        enddo
+
+        cbatch = conduit_external_batch_create()
+        call conduit_external_batch_add(cbatch,"fields/pressure",pressure)
+        call conduit_external_batch_add(cbatch,"fields/pressure_even",pressure(2:6:2))
+        call conduit_external_batch_add(cbatch,"ids",ids)
+        call assert_equals(3,int(conduit_external_batch_size(cbatch)))
+
+        cnode = conduit_node_create()
+        ! publish every cycle, the node refers to the arrays
+        do cycle = 1,3
+            pressure(1) = cycle
+            call conduit_external_batch_publish(cbatch,cnode)
+            call assert_equals(real(cycle,8), &
+                               conduit_node_fetch_path_as_float64(cnode,"fields/pressure"))
+        enddo
+        call conduit_node_print_detailed(cnode)
+        call assert_equals(3,int(conduit_node_number_of_elements(conduit_node_fetch(cnode,"fields/pressure_even"))))
+        call assert_equals(101_8,conduit_node_fetch_path_as_int64(cnode,"ids"))
+
+        call conduit_external_batch_clear(cbatch)
+        call assert_equals(0,int(conduit_external_batch_size(cbatch)))
+        call conduit_external_batch_destroy(cbatch)
+        call conduit_node_destroy(cnode)
+
+    end subroutine t_external_batch_publish
+
+!------------------------------------------------------------------------------
+end module f_conduit_node_cdesc
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+program fortran_test
+!------------------------------------------------------------------------------
+  use fruit
+  use f_conduit_node_cdesc
+  implicit none
+  logical ok
+
+  call init_fruit
+
+  !----------------------------------------------------------------------------
+  ! call our test routines
+  !----------------------------------------------------------------------------
+  call t_node_set_external_array_contiguous
+  call t_node_set_path_external_array_section
+  call t_node_set_path_external_array_2d
+  call t_external_batch_publish
+
+  call fruit_summary
+  call fruit_finalize
+  call is_all_successful(ok)
+
+  if (.not. ok) then
+     call exit(1)
+  endif
+
+!------------------------------------------------------------------------------
+end program fortran_test
+!------------------------------------------------------------------------------
@@ -250,6 +250,95 @@ class Test_Conduit_Node(unittest.TestCase):
             for i in range(len(ext_data)):
                 self.assertEqual(n.value()[i], ext_data[i])
 
+    def test_set_external_retains_owner(self):
+        n = Node()
+        n["a"].set_external(np.arange(100, dtype=np.float64))
+        # the array is only referenced by the tree
+        import gc
+        gc.collect()
+        self.assertEqual(n["a"][99], 99.0)
+        # setting the same node again releases the first array
+        ext_data = np.arange(10, dtype=np.int32)
+        refs = sys.getrefcount(ext_data)
+        n["a"].set_external(ext_data)
+        self.assertEqual(sys.getrefcount(ext_data), refs + 1)
+        n["a"].set_external(np.zeros(5))
+        self.assertEqual(sys.getrefcount(ext_data), refs)
+        del n
+        self.assertEqual(sys.getrefcount(ext_data), refs)
+
+    def test_set_external_buffer_protocol(self):
+        import array
+        # any writable buffer can be used
+        arr = array.array('i', range(10))
+        n = Node()
+        n.set_external(arr)
+        self.assertTrue(n.dtype().is_int32())
+        arr[3] = 42
+        self.assertEqual(n.value()[3], 42)
+        n.value()[4] = 43
+        self.assertEqual(arr[4], 43)
+        # memoryview slices keep their strides
+        mv = memoryview(bytearray(range(20)))[1:20:4]
+        n.set_external(mv)
+        self.assertTrue(n.dtype().is_uint8())
+        self.assertEqual(n.dtype().number_of_elements(), 5)
+        self.assertEqual(n.dtype().stride(), 4)
+        self.assertEqual(n.value()[1], 5)
+        # read-only buffers can't be described externally
+        with self.assertRaises(TypeError):
+            n.set_external(b"abcd")
+        ro = np.arange(10)
+        ro.flags.writeable = False
+        with self.assertRaises(TypeError):
+            n.set_external(ro)
+        # contiguous multi-dimensional arrays are flattened
+        md = np.arange(12, dtype=np.float32).reshape(3, 4)
+        n.set_external(md)
+        self.assertEqual(n.dtype().number_of_elements(), 12)
+        md[2, 3] = -1
+        self.assertEqual(n.value()[11], -1)
+        # effectively 1D strided views are supported
+        n.set_external(md[:, 1])
+        self.assertEqual(n.dtype().number_of_elements(), 3)
+        self.assertEqual(n.value()[2], 9)
+        with self.assertRaises(TypeError):
+            n.set_external(md[:, 1:3])
+        # non native byte order
+        be = np.arange(4, dtype='>i8')
+        n.set_external(be)
+        self.assertTrue(n.dtype().is_int64())
+        self.assertFalse(n.dtype().endianness_matches_machine())
+
+    def test_buffer_export(self):
+        n = Node()
+        n["a"].set(np.arange(10, dtype=np.float64))
+        mv = memoryview(n["a"])
+        self.assertEqual(mv.format, 'd')
+        self.assertEqual(mv.shape, (10,))
+        self.assertFalse(mv.readonly)
+        # views are zero copy
+        arr = np.asarray(n["a"])
+        arr[5] = -5.0
+        self.assertEqual(n["a"][5], -5.0)
+        # strided leaves export strides
+        n["b"].set_external(arr[::2])
+        arr_b = np.asarray(n["b"])
+        self.assertEqual(arr_b.strides, (16,))
+        self.assertEqual(arr_b[2], 4.0)
+        # contiguous requests of strided data fail
+        with self.assertRaises((BufferError, TypeError)):
+            (ctypes.c_double * 5).from_buffer(n["b"])
+        # non leaves can't be exported
+        with self.assertRaises(BufferError):
+            memoryview(n)
+        # exports and value() keep the tree alive
+        v = n["a"].value()
+        mv = memoryview(n["a"])
+        del n
+        self.assertEqual(v[5], -5.0)
+        self.assertEqual(mv[5], -5.0)
+
     def test_diff(self):
         n1 = Node()
         n2 = Node()
@@ -316,6 +405,27 @@ class Test_Conduit_Node(unittest.TestCase):
         print(n4)
         self.assertEqual(n4["data"],10)
 
+    def test_threaded_copies(self):
+        # update, compact_to and to_json release the GIL,
+        # make sure they are safe to call from a thread pool
+        import threading
+        n = Node()
+        n["data"] = np.array(range(10000), dtype='float64')
+        results = [None] * 4
+        def work(idx):
+            n_upd = Node()
+            n_upd.update(n)
+            n_cpt = Node()
+            n_upd.compact_to(n_cpt)
+            results[idx] = (n_cpt["data"][9999], len(n_cpt.to_json()) > 0)
+        threads = [threading.Thread(target=work, args=(i,)) for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for r in results:
+            self.assertEqual(r, (9999.0, True))
+
 
     def test_reset(self):
         n = Node()
@@ -741,6 +851,55 @@ g: [2.0, 4.0]
         print(np_c_arr[20:])
         self.assertEqual(sum(np_c_arr[20:]), 100 * 10)
 
+    def test_set_from_dict_and_to_dict(self):
+        vals = np.arange(10, dtype=np.float64)
+        d = {"a": vals,
+             "b": {"c": np.arange(5, dtype=np.int32),
+                   "d": "hello",
+                   "e": 42},
+             "f/g": np.zeros(3)}
+        n = Node()
+        n.set_from_dict(d)
+        self.assertTrue(n["a"].dtype().is_float64())
+        self.assertTrue(n["b/c"].dtype().is_int32())
+        self.assertEqual(n["b/d"], "hello")
+        self.assertEqual(n["b/e"], 42)
+        # keys are child names, not paths
+        self.assertTrue(n.has_child("f/g"))
+        # numpy leaves are zero-copy by default
+        vals[3] = -1.0
+        self.assertEqual(n["a"][3], -1.0)
+        # views from to_dict see the node's data
+        res = n.to_dict()
+        self.assertEqual(sorted(res.keys()), ["a", "b", "f/g"])
+        self.assertEqual(res["b"]["d"], "hello")
+        self.assertEqual(res["b"]["e"], 42)
+        res["b"]["c"][2] = 99
+        self.assertEqual(d["b"]["c"][2], 99)
+        # copies are independent
+        res = n.to_dict(views=False)
+        res["a"][0] = 123.0
+        self.assertEqual(vals[0], 0.0)
+        # external=False copies the arrays
+        n.set_from_dict(d, external=False)
+        vals[4] = -2.0
+        self.assertEqual(n["a"][4], 4.0)
+        # read-only arrays are copied instead of described externally
+        ro = np.arange(4)
+        ro.flags.writeable = False
+        n.set_from_dict({"ro": ro, "empty": None})
+        self.assertEqual(n["ro"][3], 3)
+        self.assertTrue(n["empty"].dtype().is_empty())
+        self.assertEqual(n.to_dict()["empty"], None)
+        # empty nodes convert to empty dicts
+        self.assertEqual(Node().to_dict(), {})
+        with self.assertRaises(TypeError):
+            n.set_from_dict([1, 2, 3])
+        with self.assertRaises(TypeError):
+            n.set_from_dict({1: 2})
+        with self.assertRaises(TypeError):
+            n.fetch("ro").to_dict()
+
     def test_move_and_swap(self):
         n_a = Node()
         n_b = Node()
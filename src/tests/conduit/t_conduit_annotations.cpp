@@ -0,0 +1,116 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_annotations.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <thread>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+namespace annotations = conduit::utils::annotations;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_annotations, nested_regions)
+{
+    annotations::reset();
+
+    annotations::begin("outer");
+    for(int i = 0; i < 3; i++)
+    {
+        annotations::ScopedRegion inner("inner");
+    }
+    annotations::end("outer");
+    annotations::begin("outer");
+    annotations::end("outer");
+
+    Node res;
+    annotations::timings(res);
+    res.print();
+
+    EXPECT_EQ(res["outer/count"].to_index_t(), 2);
+    EXPECT_EQ(res["outer/inner/count"].to_index_t(), 3);
+    EXPECT_FALSE(res.has_child("inner"));
+    EXPECT_GE(res["outer/total_time"].to_float64(),
+              res["outer/inner/total_time"].to_float64());
+    EXPECT_LE(res["outer/min_time"].to_float64(),
+              res["outer/max_time"].to_float64());
+
+    annotations::reset();
+    annotations::timings(res);
+    EXPECT_EQ(res.number_of_children(), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_annotations, unbalanced_regions)
+{
+    annotations::reset();
+
+    // ending a region that is not open is ignored
+    annotations::end("missing");
+
+    // ending an outer region closes the regions left open inside it,
+    // without recording them
+    annotations::begin("a");
+    annotations::begin("b");
+    annotations::end("a");
+    annotations::begin("c");
+    annotations::end("c");
+
+    Node res;
+    annotations::timings(res);
+    EXPECT_TRUE(res.has_path("a/count"));
+    EXPECT_FALSE(res.has_path("a/b"));
+    EXPECT_TRUE(res.has_path("c/count"));
+    EXPECT_FALSE(res.has_child("missing"));
+    annotations::reset();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_annotations, threads)
+{
+    annotations::reset();
+
+    // regions are nested per thread
+    annotations::ScopedRegion outer("main");
+    std::thread worker([]()
+    {
+        annotations::ScopedRegion region("worker");
+    });
+    worker.join();
+
+    Node res;
+    annotations::timings(res);
+    EXPECT_TRUE(res.has_path("worker/count"));
+    EXPECT_FALSE(res.has_path("main/worker"));
+    annotations::reset();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_annotations, library_regions)
+{
+    annotations::reset();
+    std::cout << "annotations supported: " << annotations::supported()
+              << " caliper: " << annotations::caliper_supported()
+              << std::endl;
+
+    // the library's regions are only recorded when they are compiled in
+    {
+        CONDUIT_ANNOTATE_MARK_SCOPE("test_scope");
+        CONDUIT_ANNOTATE_MARK_BEGIN("test_region");
+        CONDUIT_ANNOTATE_MARK_END("test_region");
+    }
+
+    Node res;
+    annotations::timings(res);
+    EXPECT_EQ(res.has_path("test_scope/test_region"),
+              annotations::supported());
+    annotations::reset();
+}
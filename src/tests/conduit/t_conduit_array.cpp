@@ -11,6 +11,8 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <algorithm>
+#include <limits>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -770,6 +772,107 @@ TEST(conduit_array, summary_stats)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_array, summary_stats_strided)
+{
+    // interleave two fields, stats should only see every other value
+    std::vector<float64> v_float64(22,0.0);
+    for(index_t i=0; i < 11; i++)
+    {
+        v_float64[2*i]   = (float64)(i - 5);
+        v_float64[2*i+1] = 1000.0;
+    }
+
+    float64_array va_float64(&v_float64[0],
+                             DataType::float64(11,0,2*sizeof(float64)));
+
+    EXPECT_EQ(va_float64.min(),-5.0);
+    EXPECT_EQ(va_float64.max(),5.0);
+    EXPECT_EQ(va_float64.sum(),0.0);
+    EXPECT_EQ(va_float64.mean(),0.0);
+
+    float64 min_val = 0;
+    float64 max_val = 0;
+    va_float64.min_max(min_val,max_val);
+    EXPECT_EQ(min_val,-5.0);
+    EXPECT_EQ(max_val,5.0);
+
+    // strided + offset
+    std::vector<int32> v_int32(30,-100);
+    for(index_t i=0; i < 10; i++)
+    {
+        v_int32[3*i+1] = (int32)i;
+    }
+
+    int32_array va_int32(&v_int32[0],
+                         DataType::int32(10,sizeof(int32),3*sizeof(int32)));
+
+    EXPECT_EQ(va_int32.min(),0);
+    EXPECT_EQ(va_int32.max(),9);
+    EXPECT_EQ(va_int32.sum(),45);
+    EXPECT_EQ(va_int32.mean(),4.5);
+
+    // empty
+    int32 v_empty = 0;
+    int32_array va_empty(&v_empty,DataType::int32(0));
+    int32 min_empty = 0;
+    int32 max_empty = 0;
+    va_empty.min_max(min_empty,max_empty);
+    EXPECT_EQ(min_empty,std::numeric_limits<int32>::max());
+    EXPECT_EQ(max_empty,std::numeric_limits<int32>::lowest());
+    EXPECT_EQ(va_empty.sum(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, summary_stats_large)
+{
+    // large enough to use the parallel path when built with OpenMP
+    index_t num_eles = (1 << 21) + 13;
+    Node n;
+    n.set(DataType::int64(num_eles));
+    int64_array vals = n.value();
+    for(index_t i=0; i < num_eles; i++)
+    {
+        vals[i] = (i * 7919) % 100003 - 50000;
+    }
+
+    int64 exp_min = std::numeric_limits<int64>::max();
+    int64 exp_max = std::numeric_limits<int64>::lowest();
+    int64 exp_sum = 0;
+    for(index_t i=0; i < num_eles; i++)
+    {
+        exp_min = std::min(exp_min,vals[i]);
+        exp_max = std::max(exp_max,vals[i]);
+        exp_sum += vals[i];
+    }
+
+    EXPECT_EQ(vals.min(),exp_min);
+    EXPECT_EQ(vals.max(),exp_max);
+    EXPECT_EQ(vals.sum(),exp_sum);
+    EXPECT_NEAR(vals.mean(),exp_sum / (float64)num_eles,1e-6);
+
+    int64 min_val = 0;
+    int64 max_val = 0;
+    vals.min_max(min_val,max_val);
+    EXPECT_EQ(min_val,exp_min);
+    EXPECT_EQ(max_val,exp_max);
+
+    // every other value
+    int64_array vals_strided(n.data_ptr(),
+                             DataType::int64(num_eles/2,0,2*sizeof(int64)));
+    exp_min = std::numeric_limits<int64>::max();
+    exp_max = std::numeric_limits<int64>::lowest();
+    for(index_t i=0; i < num_eles/2; i++)
+    {
+        exp_min = std::min(exp_min,vals[2*i]);
+        exp_max = std::max(exp_max,vals[2*i]);
+    }
+    vals_strided.min_max(min_val,max_val);
+    EXPECT_EQ(min_val,exp_min);
+    EXPECT_EQ(max_val,exp_max);
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_array, summary_print)
 {
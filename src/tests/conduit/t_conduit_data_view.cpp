@@ -0,0 +1,167 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_data_view.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <numeric>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_view, span)
+{
+    Node n;
+    n.set(DataType::float64(10));
+
+    Span<float64> s = n.as_span<float64>();
+    EXPECT_EQ(s.size(),10);
+    EXPECT_EQ(s.size_bytes(),80);
+    EXPECT_FALSE(s.empty());
+    EXPECT_EQ((void*)s.data(),n.data_ptr());
+
+    for(index_t i=0; i < s.size(); i++)
+    {
+        s[i] = (float64) i;
+    }
+
+    EXPECT_EQ(n.as_float64_ptr()[9],9.0);
+
+    const Node &n_const = n;
+    Span<const float64> cs = n_const.as_span<float64>();
+    EXPECT_EQ(std::accumulate(cs.begin(),cs.end(),0.0),45.0);
+
+    Span<const float64> cs2 = s;
+    EXPECT_EQ(cs2[3],3.0);
+
+    float64 total = 0.0;
+    for(float64 v : n.as_span<float64>())
+    {
+        total += v;
+    }
+    EXPECT_EQ(total,45.0);
+
+    // char8_str
+    n.set("hello");
+    EXPECT_EQ(n.as_span<char>().size(),6);
+    EXPECT_EQ(n.as_span<char>()[1],'e');
+
+    // wrong type
+    n.set(DataType::int32(4));
+    EXPECT_THROW(n.as_span<float64>(),conduit::Error);
+    EXPECT_EQ(n.as_span<int32>().size(),4);
+
+    // strided data can't be viewed as a span
+    int32 strided_vals[8] = {0,1,2,3,4,5,6,7};
+    n.set_external(DataType::int32(4,0,8),strided_vals);
+    EXPECT_THROW(n.as_span<int32>(),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_view, strided_view)
+{
+    // interleaved xy values
+    std::vector<float64> xy(20);
+    for(size_t i=0; i < 10; i++)
+    {
+        xy[2*i]   = (float64)i;
+        xy[2*i+1] = (float64)(10*i);
+    }
+
+    Node n;
+    n["x"].set_external(DataType::float64(10,0,16),xy.data());
+    n["y"].set_external(DataType::float64(10,8,16),xy.data());
+
+    StridedView<float64> x = n["x"].as_strided_view<float64>();
+    StridedView<float64> y = n["y"].as_strided_view<float64>();
+    EXPECT_EQ(x.size(),10);
+    EXPECT_EQ(x.stride(),16);
+    EXPECT_FALSE(x.is_compact());
+    EXPECT_EQ(x[3],3.0);
+    EXPECT_EQ(y[3],30.0);
+
+    y[4] = -1.0;
+    EXPECT_EQ(xy[9],-1.0);
+
+    float64 total = 0.0;
+    for(float64 v : x)
+    {
+        total += v;
+    }
+    EXPECT_EQ(total,45.0);
+
+    // compile time stride
+    StridedView<float64,16> x16 = n["x"].as_strided_view<float64,16>();
+    EXPECT_EQ(x16.stride(),16);
+    EXPECT_EQ(x16[9],9.0);
+    EXPECT_THROW((n["x"].as_strided_view<float64,8>()),conduit::Error);
+
+    const Node &n_const = n;
+    StridedView<const float64> cy = n_const["y"].as_strided_view<float64>();
+    EXPECT_EQ(cy[1],10.0);
+
+    // compact data
+    Node n_compact;
+    n_compact.set(xy);
+    CompactView<float64> c = n_compact.as_strided_view<float64,sizeof(float64)>();
+    EXPECT_TRUE(c.is_compact());
+    EXPECT_EQ(c.size(),20);
+    EXPECT_EQ(c[18],9.0);
+    EXPECT_EQ(sizeof(c),sizeof(float64*) + sizeof(index_t));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_view, mdview)
+{
+    Node n;
+    n.set(DataType::int64(4*3*2));
+    int64 *vals = n.as_int64_ptr();
+    for(int64 i=0; i < 24; i++)
+    {
+        vals[i] = i;
+    }
+
+    index_t dims[3] = {4,3,2};
+    MDView<int64,3> v = n.as_mdview<int64,3>(dims);
+    EXPECT_EQ(v.rank(),3);
+    EXPECT_EQ(v.size(),24);
+    EXPECT_EQ(v.extent(1),3);
+    EXPECT_EQ(v.stride(0),8);
+    EXPECT_EQ(v.stride(1),32);
+    EXPECT_EQ(v.stride(2),96);
+
+    // first index fastest
+    EXPECT_EQ(v(1,0,0),1);
+    EXPECT_EQ(v(0,1,0),4);
+    EXPECT_EQ(v(3,2,1),23);
+    v(2,1,1) = -1;
+    EXPECT_EQ(vals[2 + 4 + 12],-1);
+
+    const Node &n_const = n;
+    MDView<const int64,3> cv = n_const.as_mdview<int64,3>(dims);
+    EXPECT_EQ(cv(3,2,0),11);
+
+    index_t bad_dims[2] = {5,5};
+    EXPECT_THROW((n.as_mdview<int64,2>(bad_dims)),conduit::Error);
+
+    // strided leaf
+    std::vector<int32> pairs(12,0);
+    for(int32 i=0; i < 6; i++)
+    {
+        pairs[2*i] = i;
+    }
+    Node n_strided;
+    n_strided.set_external(DataType::int32(6,0,8),pairs.data());
+    index_t dims2[2] = {3,2};
+    MDView<int32,2> v2 = n_strided.as_mdview<int32,2>(dims2);
+    EXPECT_EQ(v2(2,1),5);
+    EXPECT_EQ(v2.stride(1),24);
+}
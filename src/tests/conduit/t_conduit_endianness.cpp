@@ -462,3 +462,135 @@ TEST(conduit_endianness, node_swap_using_explicit_funcs)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, swap_elements)
+{
+    // sizes that cover the simd blocks and the scalar tail
+    index_t num_eles = 1000 + 3;
+
+    std::vector<uint16> v16(num_eles);
+    std::vector<uint32> v32(num_eles);
+    std::vector<uint64> v64(num_eles);
+    for(index_t i=0; i < num_eles; i++)
+    {
+        v16[i] = (uint16) i;
+        v32[i] = (uint32) i;
+        v64[i] = (uint64) i;
+    }
+
+    Endianness::swap_elements(&v16[0],num_eles,2);
+    Endianness::swap_elements(&v32[0],num_eles,4);
+    Endianness::swap_elements(&v64[0],num_eles,8);
+
+    for(index_t i=0; i < num_eles; i++)
+    {
+        uint16 e16 = (uint16) i;
+        uint32 e32 = (uint32) i;
+        uint64 e64 = (uint64) i;
+        Endianness::swap16(&e16);
+        Endianness::swap32(&e32);
+        Endianness::swap64(&e64);
+        EXPECT_EQ(e16,v16[i]);
+        EXPECT_EQ(e32,v32[i]);
+        EXPECT_EQ(e64,v64[i]);
+    }
+
+    // strided, only every other element is swapped
+    std::vector<uint32> vs(num_eles * 2);
+    for(index_t i=0; i < num_eles * 2; i++)
+    {
+        vs[i] = (uint32) i;
+    }
+    Endianness::swap_elements(&vs[0],num_eles,4,8);
+    for(index_t i=0; i < num_eles * 2; i++)
+    {
+        uint32 e32 = (uint32) i;
+        if(i % 2 == 0)
+        {
+            Endianness::swap32(&e32);
+        }
+        EXPECT_EQ(e32,vs[i]);
+    }
+
+    // unsupported sizes
+    uint8 bad[6];
+    EXPECT_THROW(Endianness::swap_elements(bad,2,3),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, copy_and_swap_elements)
+{
+    index_t num_eles = 517;
+
+    std::vector<float64> src(num_eles);
+    for(index_t i=0; i < num_eles; i++)
+    {
+        src[i] = (float64) i + 0.5;
+    }
+
+    // compact copy, then swap back in place
+    std::vector<float64> dest(num_eles);
+    Endianness::copy_and_swap_elements(&src[0],&dest[0],num_eles,8);
+    Endianness::swap_elements(&dest[0],num_eles,8);
+    EXPECT_TRUE(src == dest);
+
+    // compact to strided (staging buffer to an interleaved leaf)
+    std::vector<float64> strided(num_eles * 3, -1.0);
+    Endianness::copy_and_swap_elements(&src[0],
+                                       &strided[0],
+                                       num_eles,
+                                       8,
+                                       0,
+                                       3 * sizeof(float64));
+    Endianness::swap_elements(&strided[0],num_eles,8,3 * sizeof(float64));
+    for(index_t i=0; i < num_eles; i++)
+    {
+        EXPECT_EQ(src[i],strided[i*3]);
+        EXPECT_EQ(-1.0,strided[i*3+1]);
+        EXPECT_EQ(-1.0,strided[i*3+2]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, node_swap_many_leaves)
+{
+    Node n;
+    index_t num_leaves = 16;
+    for(index_t i=0; i < num_leaves; i++)
+    {
+        Node &leaf = n.append();
+        leaf["vals"].set(DataType::int32(1000 + i));
+        leaf["ids"].set(DataType::uint16(10));
+        leaf["name"] = "leaf";
+        int32_array vals = leaf["vals"].value();
+        for(index_t j=0; j < vals.number_of_elements(); j++)
+        {
+            vals[j] = (int32)(i * 10000 + j);
+        }
+    }
+
+    Node n_orig;
+    n_orig.set(n);
+
+    if(Endianness::machine_is_little_endian())
+    {
+        n.endian_swap_to_big();
+    }
+    else
+    {
+        n.endian_swap_to_little();
+    }
+
+    int32 v = (int32)3 * 10000 + 7;
+    Endianness::swap32(&v);
+    EXPECT_EQ(v,n[3]["vals"].as_int32_array()[7]);
+    EXPECT_FALSE(n[3]["vals"].dtype().endianness() ==
+                 Endianness::machine_default());
+    EXPECT_EQ(std::string("leaf"),n[3]["name"].as_string());
+
+    n.endian_swap_to_machine_default();
+
+    Node info;
+    EXPECT_FALSE(n.diff(n_orig,info));
+}
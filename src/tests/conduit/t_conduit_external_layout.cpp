@@ -0,0 +1,202 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_external_layout.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+static void
+publish(Node &n,
+        std::vector<float64> &u,
+        std::vector<int32> &conn,
+        std::vector<float64> &xyz)
+{
+    n["state/cycle"] = (int64) 0;
+    n.set_path_external("fields/u/values", u);
+    n.set_path_external("topologies/mesh/elements/connectivity", conn);
+    // interleaved x and y
+    n["coordsets/coords/values/x"].set_external(xyz.data(),
+                                                (index_t)xyz.size() / 2,
+                                                0,
+                                                2 * sizeof(float64));
+    n["coordsets/coords/values/y"].set_external(xyz.data(),
+                                                (index_t)xyz.size() / 2,
+                                                sizeof(float64),
+                                                2 * sizeof(float64));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_external_layout, bind_and_rebind)
+{
+    std::vector<float64> u0(10, 1.0), u1(10, 2.0);
+    std::vector<int32> conn0(8, 3), conn1(8, 4);
+    std::vector<float64> xyz0(6), xyz1(6);
+    for(int i = 0; i < 6; i++)
+    {
+        xyz0[i] = i;
+        xyz1[i] = 10 + i;
+    }
+
+    Node n;
+    publish(n, u0, conn0, xyz0);
+
+    ExternalLayout layout = n.bind_external_layout();
+    // state/cycle owns its data, so it is not bound
+    EXPECT_EQ(layout.number_of_leaves(), 4);
+    EXPECT_EQ(layout.leaf_path(0), "fields/u/values");
+    EXPECT_EQ(layout.leaf_path(1), "topologies/mesh/elements/connectivity");
+    EXPECT_EQ(layout.leaf_path(2), "coordsets/coords/values/x");
+    EXPECT_EQ(layout.leaf_path(3), "coordsets/coords/values/y");
+    EXPECT_EQ(&layout.leaf(0), &n["fields/u/values"]);
+
+    std::string schema_before = n.schema().to_json();
+
+    std::vector<void*> ptrs;
+    ptrs.push_back(u1.data());
+    ptrs.push_back(conn1.data());
+    ptrs.push_back(xyz1.data());
+    ptrs.push_back(xyz1.data());
+    layout.rebind(ptrs);
+
+    // schema is unchanged
+    EXPECT_EQ(n.schema().to_json(), schema_before);
+
+    EXPECT_EQ(n["fields/u/values"].as_float64_ptr(), u1.data());
+    EXPECT_EQ(n["fields/u/values"].as_float64_array()[9], 2.0);
+    EXPECT_EQ(n["topologies/mesh/elements/connectivity"].as_int32_array()[0],
+              4);
+    // offsets and strides are kept
+    float64_array x = n["coordsets/coords/values/x"].value();
+    float64_array y = n["coordsets/coords/values/y"].value();
+    EXPECT_EQ(x.number_of_elements(), 3);
+    EXPECT_EQ(x[1], 12.0);
+    EXPECT_EQ(y[1], 13.0);
+    EXPECT_TRUE(n["coordsets/coords/values/x"].is_data_external());
+
+    // single leaf rebind
+    layout.rebind(0, u0.data());
+    EXPECT_EQ(n["fields/u/values"].as_float64_array()[0], 1.0);
+
+    // same result as a full republish
+    Node n_ref;
+    publish(n_ref, u0, conn1, xyz1);
+    Node info;
+    EXPECT_FALSE(n.diff(n_ref, info));
+
+    // raw pointer array variant
+    void *raw[4] = {u1.data(), conn0.data(), xyz0.data(), xyz0.data()};
+    layout.rebind(raw);
+    EXPECT_EQ(n["topologies/mesh/elements/connectivity"].as_int32_array()[0],
+              3);
+    EXPECT_EQ(n["coordsets/coords/values/y"].as_float64_array()[2], 5.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_external_layout, subtree_and_list)
+{
+    std::vector<float64> a0(4, 1.0), a1(4, 2.0);
+    std::vector<float64> b0(4, 3.0), b1(4, 4.0);
+
+    Node n;
+    n["meta/name"] = "mesh";
+    n["data"].append().set_external(a0);
+    n["data"].append().set_external(b0);
+
+    ExternalLayout layout = n["data"].bind_external_layout();
+    EXPECT_EQ(layout.number_of_leaves(), 2);
+    EXPECT_EQ(layout.leaf_path(0), "[0]");
+    EXPECT_EQ(layout.leaf_path(1), "[1]");
+
+    std::vector<void*> ptrs;
+    ptrs.push_back(a1.data());
+    ptrs.push_back(b1.data());
+    layout.rebind(ptrs);
+    EXPECT_EQ(n["data"][0].as_float64_array()[0], 2.0);
+    EXPECT_EQ(n["data"][1].as_float64_array()[0], 4.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_external_layout, owned_data_not_bound)
+{
+    std::vector<float64> vals(4, 1.0);
+
+    Node src;
+    src["a"].set_external(vals);
+    src["b"] = 42;
+
+    // children of a compacted (allocated) tree don't own their data,
+    // but are skipped along with their parent
+    Node n_compact;
+    src.compact_to(n_compact);
+    EXPECT_EQ(n_compact.bind_external_layout().number_of_leaves(), 0);
+
+    Node n_set;
+    n_set.set(src);
+    EXPECT_EQ(n_set.bind_external_layout().number_of_leaves(), 0);
+
+    Node n_ext;
+    n_ext.set_external(src);
+    EXPECT_EQ(n_ext.bind_external_layout().number_of_leaves(), 2);
+
+    ExternalLayout empty;
+    EXPECT_TRUE(empty.is_empty());
+    empty.rebind(std::vector<void*>());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_external_layout, errors)
+{
+    std::vector<float64> vals(4, 1.0);
+
+    Node n;
+    n["a"].set_external(vals);
+    n["b"].set_external(vals);
+
+    ExternalLayout layout = n.bind_external_layout();
+    EXPECT_EQ(layout.number_of_leaves(), 2);
+
+    std::vector<void*> ptrs(1, vals.data());
+    EXPECT_THROW(layout.rebind(ptrs), conduit::Error);
+    EXPECT_THROW(layout.rebind(2, vals.data()), conduit::Error);
+    EXPECT_THROW(layout.leaf_path(-1), conduit::Error);
+    EXPECT_THROW(layout.rebind((void * const *)NULL), conduit::Error);
+
+    // frozen trees can't be rebound
+    n.freeze();
+    EXPECT_THROW(layout.rebind(0, vals.data()), conduit::Error);
+    n.unfreeze();
+    layout.rebind(0, vals.data());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_external_layout, rebind_invalidates_hash_cache)
+{
+    std::vector<float64> a(4, 1.0), b(4, 2.0);
+
+    Node n;
+    n["a"].set_external(a);
+
+    Node opts;
+    opts["cache"] = "true";
+    uint64 h_a = n.hash(opts);
+
+    ExternalLayout layout = n.bind_external_layout();
+    layout.rebind(0, b.data());
+    uint64 h_b = n.hash(opts);
+    EXPECT_NE(h_a, h_b);
+
+    layout.rebind(0, a.data());
+    EXPECT_EQ(n.hash(opts), h_a);
+}
@@ -466,3 +466,269 @@ TEST(conduit_generator, yaml_parsing_errors)
 }
 
 
+
+//-----------------------------------------------------------------------------
+// checks that walk_streaming() creates the same tree as walk()
+void
+check_streaming_matches_walk(const std::string &txt,
+                             const std::string &protocol)
+{
+    Generator g(txt,protocol);
+    Node n_walk, n_stream, info;
+    g.walk(n_walk);
+    g.walk_streaming(n_stream);
+    EXPECT_FALSE(n_walk.diff(n_stream,info,0.0)) << protocol << ":\n"
+                                                 << txt << "\n"
+                                                 << info.to_yaml();
+    EXPECT_EQ(n_walk.to_json(),n_stream.to_json());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, streaming_json)
+{
+    const char *json_txts[] = {
+        "{\"a\": 10, \"b\": -3.5, \"c\": \"hi\", \"d\": true, \"e\": null}",
+        "{\"a\": [1, 2, 3], \"b\": [1, 2.5, 3], \"c\": [\"nan\", 1, 2]}",
+        "{\"a\": [], \"b\": {}, \"c\": [[1, 2], [3.0, 4], []]}",
+        "{\"a\": [1, \"two\", 3.0, [4], {\"five\": 5}, null, true, \"nan\"]}",
+        "{\"a\": 18446744073709551615, \"b\": -9223372036854775807}",
+        "// comment\n{a: 1, // another\n \"b\": [nan, inf, 1]}",
+        "[1, 2, 3]",
+        "[{\"a\": 1}, {\"a\": 2}]",
+        "42"
+    };
+
+    for(size_t i=0; i < sizeof(json_txts)/sizeof(json_txts[0]); i++)
+    {
+        check_streaming_matches_walk(json_txts[i],"json");
+    }
+
+    Node n;
+    Generator g("{\"a\": [1, 2, 3], \"b\": [1, 2.5], \"c\": {\"d\": \"e\"}}",
+                "json");
+    g.walk_streaming(n);
+    EXPECT_EQ(n["a"].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["a"].dtype().number_of_elements(),3);
+    EXPECT_EQ(n["a"].as_int64_ptr()[2],3);
+    EXPECT_EQ(n["b"].dtype().id(),DataType::FLOAT64_ID);
+    EXPECT_EQ(n["b"].as_float64_ptr()[1],2.5);
+    EXPECT_EQ(n["c/d"].as_string(),"e");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, streaming_conduit_json)
+{
+    Node n_src;
+    n_src["a"] = (int8)-4;
+    n_src["b"].set(DataType::uint16(4));
+    uint16_array b_vals = n_src["b"].value();
+    for(index_t i=0; i < 4; i++)
+    {
+        b_vals[i] = (uint16)(i * 100);
+    }
+    n_src["c/d"].set(DataType::float32(3));
+    float32_array d_vals = n_src["c/d"].value();
+    d_vals[0] = 1.5f;
+    d_vals[1] = -2.25f;
+    d_vals[2] = 1e10f;
+    n_src["c/e"] = "my string";
+    n_src["f"].append() = (float64)3.25;
+    n_src["f"].append() = (uint64)7;
+    n_src["g"].set(DataType::object());
+
+    check_streaming_matches_walk(n_src.to_json("conduit_json"),
+                                 "conduit_json");
+
+    Node n, info;
+    Generator g(n_src.to_json("conduit_json"),"conduit_json");
+    g.walk_streaming(n);
+    EXPECT_FALSE(n_src.diff(n,info,0.0));
+
+    // inline values with and without explicit lengths
+    const char *json_txts[] = {
+        "{\"a\": \"int32\", \"b\": {\"dtype\": \"float64\"}}",
+        "{\"a\": {\"dtype\": \"int32\", \"value\": [1, 2, 3]}}",
+        "{\"a\": {\"dtype\": \"uint8\", \"number_of_elements\": 5,"
+        " \"value\": [1, 2.5, 3]}}",
+        "{\"a\": {\"dtype\": \"float64\", \"length\": 2,"
+        " \"value\": [\"nan\", 2]}}",
+        "{\"a\": {\"dtype\": \"int64\", \"value\": 5},"
+        " \"b\": {\"dtype\": \"uint8\", \"value\": true},"
+        " \"c\": {\"dtype\": \"char8_str\", \"number_of_elements\": 4,"
+        " \"value\": \"abc\"}}",
+        "{\"a\": {\"dtype\": \"int32\", \"number_of_elements\": 3,"
+        " \"value\": [1, \"x\", 3]}}",
+        "{\"a\": {\"dtype\": \"int32\", \"number_of_elements\": 0}}",
+        "{\"a\": {\"dtype\": \"int32\", \"number_of_elements\": 2,"
+        " \"endianness\": \"big\"}}",
+        "[\"int32\", {\"dtype\": \"float32\", \"value\": [1.5]}, []]"
+    };
+
+    for(size_t i=0; i < sizeof(json_txts)/sizeof(json_txts[0]); i++)
+    {
+        check_streaming_matches_walk(json_txts[i],"conduit_json");
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, streaming_yaml)
+{
+    const char *yaml_txts[] = {
+        "a: 10\nb: -3.5\nc: hi\nd: true\ne: \n",
+        "a: [1, 2, 3]\nb: [1, 2.5, 3]\nc: [1, two, 3]\n",
+        "a: []\nb: {}\nc:\n  - [1, 2]\n  - [3.0, 4]\n  - d: 1\n",
+        "a: &anc\n  b: [1, 2]\n  c: 3\nd: *anc\ne: &s 4.5\nf: [*s, 1]\n",
+        "- 1\n- 2\n- 3\n",
+        "42"
+    };
+
+    for(size_t i=0; i < sizeof(yaml_txts)/sizeof(yaml_txts[0]); i++)
+    {
+        check_streaming_matches_walk(yaml_txts[i],"yaml");
+    }
+
+    Node n;
+    Generator g("a: &anc [1,2]\nb: *anc\n","yaml");
+    g.walk_streaming(n);
+    EXPECT_EQ(n["b"].dtype().id(),DataType::INT64_ID);
+    EXPECT_EQ(n["b"].as_int64_ptr()[1],2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, streaming_file)
+{
+    Node n_src;
+    n_src["a"].set(DataType::float64(1000));
+    float64_array a_vals = n_src["a"].value();
+    for(index_t i=0; i < 1000; i++)
+    {
+        a_vals[i] = i * 0.5;
+    }
+    n_src["b/c"] = (int64)10;
+    n_src["b/d"] = "value";
+
+    std::string protocols[] = {"json", "conduit_json", "yaml"};
+    for(size_t i=0; i < 3; i++)
+    {
+        const std::string &protocol = protocols[i];
+        std::string path = "tout_generator_streaming_file." + protocol;
+        n_src.save(path,protocol);
+
+        Node n_load, n_stream, info;
+        n_load.load(path,protocol);
+        Generator::walk_streaming_file(path,protocol,n_stream);
+        EXPECT_FALSE(n_load.diff(n_stream,info,0.0)) << protocol;
+        EXPECT_FALSE(n_src.diff(n_stream,info,0.0)) << protocol;
+    }
+
+    Node n;
+    EXPECT_THROW(Generator::walk_streaming_file("tout_generator_missing.json",
+                                                "json",
+                                                n),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, streaming_errors)
+{
+    Node n;
+    // parse errors
+    EXPECT_THROW(Generator("{\"a\": [1, 2}","json").walk_streaming(n),
+                 conduit::Error);
+    EXPECT_THROW(Generator("a: 10\ns","yaml").walk_streaming(n),
+                 conduit::Error);
+    EXPECT_THROW(Generator("","yaml").walk_streaming(n),
+                 conduit::Error);
+    // duplicate names
+    EXPECT_THROW(Generator("{\"a\": 1, \"a\": 2}","json").walk_streaming(n),
+                 conduit::Error);
+    EXPECT_THROW(Generator("a: 1\na: 2\n","yaml").walk_streaming(n),
+                 conduit::Error);
+    // invalid conduit_json
+    EXPECT_THROW(Generator("{\"a\": 10}","conduit_json").walk_streaming(n),
+                 conduit::Error);
+    EXPECT_THROW(Generator("{\"a\": \"bad\"}","conduit_json").walk_streaming(n),
+                 conduit::Error);
+    EXPECT_THROW(Generator("{\"a\": {\"dtype\": \"int32\","
+                           " \"number_of_elements\": 2,"
+                           " \"value\": [1, 2, 3]}}",
+                           "conduit_json").walk_streaming(n),
+                 conduit::Error);
+    // unsupported layouts
+    EXPECT_THROW(Generator("{\"a\": {\"number_of_elements\": 2,"
+                           " \"dtype\": \"int32\"}}",
+                           "conduit_json").walk_streaming(n),
+                 conduit::Error);
+    EXPECT_THROW(Generator("{\"a\": {\"dtype\": \"int32\","
+                           " \"value\": [1, 2],"
+                           " \"number_of_elements\": 2}}",
+                           "conduit_json").walk_streaming(n),
+                 conduit::Error);
+    EXPECT_THROW(Generator("{\"dtype\": {\"a\": \"int32\"}, \"length\": 2}",
+                           "conduit_json").walk_streaming(n),
+                 conduit::Error);
+    // unsupported protocol
+    EXPECT_THROW(Generator("{}","conduit_base64_json").walk_streaming(n),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_generator, parse_many)
+{
+    std::vector<std::string> texts;
+    std::vector<Node> expected(37);
+    for(index_t i=0; i < 37; i++)
+    {
+        Node &e = expected[(size_t)i];
+        e["domain_id"] = (int64) i;
+        e["coords/values/x"].set(DataType::float64(i+1));
+        float64_array vals = e["coords/values/x"].value();
+        for(index_t j=0; j < i+1; j++)
+        {
+            vals[j] = 0.5 * j;
+        }
+        texts.push_back(e.to_json("conduit_json"));
+    }
+
+    index_t num_threads[] = {0, 1, 4, 64};
+    for(int t=0; t < 4; t++)
+    {
+        Node res;
+        Generator::parse_many(texts,"conduit_json",res,num_threads[t]);
+        EXPECT_TRUE(res.dtype().is_list());
+        EXPECT_EQ(res.number_of_children(),37);
+        for(index_t i=0; i < 37; i++)
+        {
+            Node info;
+            EXPECT_FALSE(res[i].diff(expected[(size_t)i],info));
+            EXPECT_TRUE(res[i].is_compact());
+        }
+    }
+
+    // yaml and json
+    std::vector<std::string> yaml_texts;
+    yaml_texts.push_back("a: 10\nb: [1, 2, 3]\n");
+    yaml_texts.push_back("c: \"here\"\n");
+    Node res;
+    Generator::parse_many(yaml_texts,"yaml",res,2);
+    EXPECT_EQ(res[0]["a"].to_int64(),10);
+    EXPECT_EQ(res[0]["b"].dtype().number_of_elements(),3);
+    EXPECT_EQ(res[1]["c"].as_string(),"here");
+
+    std::vector<std::string> json_texts(1,"{\"a\": 1.5}");
+    Generator::parse_many(json_texts,"json",res);
+    EXPECT_EQ(res.number_of_children(),1);
+    EXPECT_EQ(res[0]["a"].to_float64(),1.5);
+
+    // empty input
+    Generator::parse_many(std::vector<std::string>(),"json",res);
+    EXPECT_TRUE(res.dtype().is_empty());
+
+    // errors from any text propagate, output is left empty
+    texts[20] = "{\"a\": [1, 2}";
+    EXPECT_THROW(Generator::parse_many(texts,"conduit_json",res,4),
+                 conduit::Error);
+    EXPECT_TRUE(res.dtype().is_empty());
+    EXPECT_THROW(Generator::parse_many(yaml_texts,"bad_protocol",res,2),
+                 conduit::Error);
+}
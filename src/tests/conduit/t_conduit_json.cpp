@@ -469,6 +469,58 @@ TEST(conduit_json, to_base64_json_2)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_json, to_base64_json_layouts)
+{
+    Node n;
+    n["a"].set(DataType::float64(1000));
+    n["b/c"].set(DataType::int16(7));
+    float64_array a_vals = n["a"].value();
+    for(index_t i=0;i<1000;i++)
+    {
+        a_vals[i] = 0.5 * i;
+    }
+    int16_array c_vals = n["b/c"].value();
+    for(index_t i=0;i<7;i++)
+    {
+        c_vals[i] = (int16)(-3 * i);
+    }
+
+    // compact layout, decoded straight into the result
+    std::string base64_json = n.to_json("conduit_base64_json");
+    Node nparse;
+    Generator g(base64_json,"conduit_base64_json");
+    g.walk(nparse);
+    Node info;
+    EXPECT_FALSE(n.diff(nparse,info));
+    EXPECT_TRUE(nparse.is_compact());
+
+    g.walk_external(nparse);
+    EXPECT_FALSE(n.diff(nparse,info));
+
+    // strided layout, walk compacts the result while walk_external
+    // keeps the schema's layout
+    float64 vals[6] = {1.0, -1.0, 2.0, -1.0, 3.0, -1.0};
+    Node n_strided;
+    n_strided["x"].set_external(DataType::float64(3,0,16),vals);
+    std::vector<char> b64_buff((size_t)utils::base64_encode_buffer_size(48),0);
+    utils::base64_encode(vals,48,&b64_buff[0]);
+    base64_json = "{\"schema\": {\"x\": {\"dtype\": \"float64\", "
+                  "\"number_of_elements\": 3, \"offset\": 0, "
+                  "\"stride\": 16}}, "
+                  "\"data\": {\"base64\": \"" +
+                  std::string(&b64_buff[0]) + "\"}}";
+    Generator g_strided(base64_json,"conduit_base64_json");
+
+    g_strided.walk(nparse);
+    EXPECT_TRUE(nparse.is_compact());
+    EXPECT_FALSE(n_strided.diff(nparse,info));
+
+    g_strided.walk_external(nparse);
+    EXPECT_EQ(nparse["x"].dtype().stride(),16);
+    EXPECT_FALSE(n_strided.diff(nparse,info));
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_json, check_empty)
 {
@@ -896,3 +948,94 @@ TEST(conduit_json, to_json_opts)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, to_json_float_precision)
+{
+    Node n;
+    n["a"] = 1.0 / 3.0;
+    n["b"] = 0.1f;
+    n["c"].set(DataType::float64(3));
+    float64_array c_vals = n["c"].value();
+    c_vals[0] = 2.0;
+    c_vals[1] = 1e20;
+    c_vals[2] = std::numeric_limits<float64>::infinity();
+
+    Node opts;
+    opts["indent"] = 0;
+    opts["eoe"] = "";
+
+    // default precision
+    EXPECT_EQ(n.to_json(opts),
+              "{\"a\": 0.333333333333333,"
+              "\"b\": 0.100000001490116,"
+              "\"c\": [2.0, 1e+20, \"inf\"]}");
+
+    opts["float_precision"] = 3;
+    EXPECT_EQ(n.to_json(opts),
+              "{\"a\": 0.333,"
+              "\"b\": 0.1,"
+              "\"c\": [2.0, 1e+20, \"inf\"]}");
+
+    // shortest round trip
+    opts["float_precision"] = 0;
+    std::string res = n.to_json(opts);
+    EXPECT_EQ(res,
+              "{\"a\": 0.3333333333333333,"
+              "\"b\": 0.1,"
+              "\"c\": [2.0, 1e+20, \"inf\"]}");
+
+    Node n_rt, info;
+    n_rt.parse(res,"json");
+    EXPECT_EQ(n_rt["a"].as_float64(),n["a"].as_float64());
+    EXPECT_EQ((float32)n_rt["b"].as_float64(),n["b"].as_float32());
+
+    // yaml uses the same rules
+    opts["float_precision"] = 3;
+    EXPECT_EQ(n["a"].to_yaml(opts),"0.333");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, to_json_base64_threshold)
+{
+    Node n;
+    n["small"].set(DataType::int32(2));
+    n["big"].set(DataType::float64(100));
+    float64_array big_vals = n["big"].value();
+    for(index_t i=0; i < 100; i++)
+    {
+        big_vals[i] = i / 7.0;
+    }
+    n["str"] = "a string that is longer than the threshold";
+    // strided leaf
+    std::vector<int16> vals(20);
+    for(int i=0; i < 20; i++)
+    {
+        vals[i] = (int16)i;
+    }
+    n["strided"].set_external(DataType::int16(10,0,4),&vals[0]);
+
+    Node opts;
+    opts["protocol"] = "conduit_json";
+    opts["base64_threshold"] = 16;
+    std::string res = n.to_json(opts);
+    std::cout << res << std::endl;
+
+    EXPECT_NE(res.find("\"base64\""),std::string::npos);
+    // the small leaf and the string are written inline
+    EXPECT_NE(res.find("[0, 0]"),std::string::npos);
+    EXPECT_NE(res.find(n["str"].as_string()),std::string::npos);
+
+    Node n_parse, n_stream, info;
+    n_parse.parse(res,"conduit_json");
+    EXPECT_FALSE(n.diff(n_parse,info,0.0));
+
+    Generator g(res,"conduit_json");
+    g.walk_streaming(n_stream);
+    EXPECT_FALSE(n.diff(n_stream,info,0.0));
+
+    // base64 only applies to conduit_json
+    opts["protocol"] = "json";
+    res = n.to_json(opts);
+    EXPECT_EQ(res.find("\"base64\""),std::string::npos);
+}
@@ -10,7 +10,14 @@
 
 #include "conduit.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <fstream>
 #include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 
 
@@ -251,3 +258,721 @@ TEST(conduit_memory_allocator, test_strange)
     EXPECT_EQ(buff[1],0);
     EXPECT_EQ(buff[2],1);
 }
+
+//-----------------------------------------------------------------------------
+void
+build_metadata_test_tree(conduit::Node &n)
+{
+    for(int d=0; d < 10; d++)
+    {
+        conduit::Node &dom = n.append();
+        for(int f=0; f < 100; f++)
+        {
+            std::ostringstream oss;
+            oss << "fields/field_" << f;
+            conduit::Node &fld = dom[oss.str()];
+            fld["association"] = "element";
+            fld["values"].set(conduit::DataType::float64(4));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_metadata_pool)
+{
+    // raw block alloc and free
+    void *blk_a = conduit::utils::metadata_allocate(24);
+    void *blk_b = conduit::utils::metadata_allocate(24);
+    EXPECT_TRUE(blk_a != NULL);
+    EXPECT_TRUE(blk_b != NULL);
+    EXPECT_NE(blk_a,blk_b);
+    conduit::utils::metadata_free(blk_a,24);
+    conduit::utils::metadata_free(blk_b,24);
+
+    // blocks larger than the pooled sizes are also supported
+    void *blk_big = conduit::utils::metadata_allocate(4096);
+    EXPECT_TRUE(blk_big != NULL);
+    conduit::utils::metadata_free(blk_big,4096);
+
+    // rebuilding the same trees should reuse pooled metadata
+    {
+        conduit::Node n;
+        build_metadata_test_tree(n);
+        conduit::Node n_cpy(n);
+    }
+    conduit::index_t reserved = conduit::utils::metadata_pool_reserved_bytes();
+    EXPECT_GT(reserved,0);
+
+    for(int i=0; i < 5; i++)
+    {
+        conduit::Node n;
+        build_metadata_test_tree(n);
+        conduit::Node n_cpy(n);
+        EXPECT_EQ(n_cpy.number_of_children(),10);
+        EXPECT_EQ(n_cpy[0]["fields"].number_of_children(),100);
+    }
+    EXPECT_EQ(reserved,conduit::utils::metadata_pool_reserved_bytes());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_metadata_pool_producer_consumer)
+{
+    // one thread allocates, another frees. the freeing thread's cache is
+    // capped, so the producer reuses its blocks instead of carving
+    // new chunks
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque< std::vector<void*> > batches;
+    bool done = false;
+
+    std::thread consumer([&]()
+    {
+        while(true)
+        {
+            std::vector<void*> batch;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [&]{ return done || !batches.empty(); });
+                if(batches.empty())
+                {
+                    return;
+                }
+                batch.swap(batches.front());
+                batches.pop_front();
+            }
+            for(size_t i=0; i < batch.size(); i++)
+            {
+                conduit::utils::metadata_free(batch[i],24);
+            }
+            cv.notify_all();
+        }
+    });
+
+    conduit::index_t reserved = conduit::utils::metadata_pool_reserved_bytes();
+    for(int r=0; r < 200; r++)
+    {
+        // 20000 blocks of 32 bytes per batch, 128 MiB over all batches
+        std::vector<void*> batch(20000);
+        for(size_t i=0; i < batch.size(); i++)
+        {
+            batch[i] = conduit::utils::metadata_allocate(24);
+        }
+        std::unique_lock<std::mutex> lock(mtx);
+        batches.push_back(std::vector<void*>());
+        batches.back().swap(batch);
+        cv.notify_all();
+        // keep at most a couple of batches in flight
+        cv.wait(lock, [&]{ return batches.size() < 2; });
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        done = true;
+    }
+    cv.notify_all();
+    consumer.join();
+
+    conduit::index_t growth = conduit::utils::metadata_pool_reserved_bytes() -
+                              reserved;
+    std::cout << "metadata pool growth: " << growth << std::endl;
+    EXPECT_LT(growth,(conduit::index_t)(32 * 1024 * 1024));
+}
+
+//-----------------------------------------------------------------------------
+void
+build_pool_test_tree(conduit::Node &n,
+                     conduit::index_t allocator_id)
+{
+    n.reset();
+    n.set_allocator(allocator_id);
+    for(int i=0; i < 8; i++)
+    {
+        conduit::Node &dom = n.append();
+        dom["coords/x"].set(conduit::DataType::float64(100 + i));
+        dom["coords/y"].set(conduit::DataType::float64(100 + i));
+        dom["conn"].set(conduit::DataType::int32(1000));
+        dom["big"].set(conduit::DataType::uint8(1 << 20));
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+check_pool_allocator(bool thread_cache)
+{
+    // other tests install custom handlers
+    conduit::utils::set_memcpy_handler(conduit::utils::default_memcpy_handler);
+    conduit::utils::set_memset_handler(conduit::utils::default_memset_handler);
+
+    conduit::index_t pool_id = conduit::utils::pool_allocator_id(thread_cache);
+    EXPECT_GT(pool_id,0);
+    EXPECT_EQ(pool_id,conduit::utils::pool_allocator_id(thread_cache));
+
+    std::string pool_name = thread_cache ? "pool_thread_cache" : "pool";
+
+    conduit::Node info;
+    conduit::utils::allocator_info(info);
+    info.print();
+    EXPECT_TRUE(info.has_path(pool_name));
+    EXPECT_EQ(info[pool_name]["allocator_id"].to_index_t(),pool_id);
+    conduit::int64 allocs_start = info[pool_name]["num_allocations"].to_int64();
+    conduit::int64 hits_start   = info[pool_name]["num_pool_hits"].to_int64();
+    conduit::int64 live_start   = info[pool_name]["bytes_live"].to_int64();
+
+    // first cycle fills the pool
+    {
+        conduit::Node n;
+        build_pool_test_tree(n,pool_id);
+        EXPECT_EQ(n[3]["coords/x"].allocator(),pool_id);
+        // memory is zero initialized
+        conduit::float64_array x_vals = n[3]["coords/x"].value();
+        EXPECT_EQ(x_vals.max(),0.0);
+        x_vals.fill(42.0);
+    }
+
+    // later cycles reuse pooled blocks
+    for(int i=0; i < 4; i++)
+    {
+        conduit::Node n;
+        build_pool_test_tree(n,pool_id);
+        conduit::float64_array x_vals = n[3]["coords/x"].value();
+        EXPECT_EQ(x_vals.max(),0.0);
+        EXPECT_EQ(n[7]["big"].as_uint8_ptr()[1000],0);
+
+        conduit::Node n_cpy;
+        n_cpy.set_allocator(pool_id);
+        n_cpy.set(n);
+        EXPECT_EQ(n_cpy[7]["conn"].dtype().number_of_elements(),1000);
+    }
+
+    conduit::utils::allocator_info(info);
+    conduit::int64 allocs = info[pool_name]["num_allocations"].to_int64()
+                            - allocs_start;
+    conduit::int64 hits   = info[pool_name]["num_pool_hits"].to_int64()
+                            - hits_start;
+    // 32 leaves in the first tree, then 64 per cycle
+    EXPECT_EQ(allocs,32 + 4 * 64);
+    // only the copies in the first of the later cycles miss
+    EXPECT_EQ(hits,allocs - 64);
+    EXPECT_EQ(info[pool_name]["bytes_live"].to_int64(),live_start);
+    EXPECT_GE(info[pool_name]["high_water_mark"].to_int64(),
+              (conduit::int64)(2 * 8 * (1 << 20)));
+    EXPECT_GT(info[pool_name]["bytes_cached"].to_int64(),0);
+    EXPECT_GT(info[pool_name]["hit_rate"].to_float64(),0.5);
+
+    // large requests bypass the pool
+    void *big = conduit::utils::conduit_allocate(1,
+                                                 ((size_t)1 << 30) + 1,
+                                                 pool_id);
+    if(big != NULL)
+    {
+        conduit::utils::conduit_free(big,pool_id);
+    }
+
+    conduit::utils::pool_allocator_release_cached();
+    conduit::utils::allocator_info(info);
+    EXPECT_EQ(info[pool_name]["bytes_cached"].to_int64(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_pool_allocator)
+{
+    check_pool_allocator(false);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_pool_allocator_thread_cache)
+{
+    check_pool_allocator(true);
+}
+
+//-----------------------------------------------------------------------------
+struct DispatchCounts
+{
+    static size_t m_global_copy;
+    static size_t m_global_set;
+    static size_t m_device_copy;
+    static size_t m_device_set;
+    static size_t m_d2h_copy;
+
+    static void reset()
+    {
+        m_global_copy = 0;
+        m_global_set  = 0;
+        m_device_copy = 0;
+        m_device_set  = 0;
+        m_d2h_copy    = 0;
+    }
+
+    static void global_copy(void *dest, const void *src, size_t num)
+    {
+        m_global_copy++;
+        memcpy(dest,src,num);
+    }
+
+    static void global_set(void *ptr, int value, size_t num)
+    {
+        m_global_set++;
+        memset(ptr,value,num);
+    }
+
+    static void device_copy(void *dest, const void *src, size_t num)
+    {
+        m_device_copy++;
+        memcpy(dest,src,num);
+    }
+
+    static void device_set(void *ptr, int value, size_t num)
+    {
+        m_device_set++;
+        memset(ptr,value,num);
+    }
+
+    static void d2h_copy(void *dest, const void *src, size_t num)
+    {
+        m_d2h_copy++;
+        memcpy(dest,src,num);
+    }
+
+    static void *device_alloc(size_t items, size_t item_size)
+    {
+        return calloc(items, item_size);
+    }
+
+    static void device_free(void *data_ptr)
+    {
+        free(data_ptr);
+    }
+};
+
+size_t DispatchCounts::m_global_copy = 0;
+size_t DispatchCounts::m_global_set  = 0;
+size_t DispatchCounts::m_device_copy = 0;
+size_t DispatchCounts::m_device_set  = 0;
+size_t DispatchCounts::m_d2h_copy    = 0;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_allocator_memory_handlers)
+{
+    conduit::utils::set_memcpy_handler(DispatchCounts::global_copy);
+    conduit::utils::set_memset_handler(DispatchCounts::global_set);
+
+    conduit::index_t dev_id
+     = conduit::utils::register_allocator(DispatchCounts::device_alloc,
+                                          DispatchCounts::device_free);
+
+    conduit::utils::set_memcpy_handler(dev_id, DispatchCounts::device_copy);
+    conduit::utils::set_memset_handler(dev_id, DispatchCounts::device_set);
+
+    std::vector<conduit::float64> vals(100,3.0);
+
+    DispatchCounts::reset();
+
+    // host to host uses the global handler
+    conduit::Node n_host;
+    n_host.set(vals);
+    EXPECT_EQ(DispatchCounts::m_global_copy,1);
+    EXPECT_EQ(DispatchCounts::m_device_copy,0);
+
+    // copies into device memory use the device handler
+    conduit::Node n_dev;
+    n_dev.set_allocator(dev_id);
+    n_dev.set(vals);
+    EXPECT_EQ(DispatchCounts::m_global_copy,1);
+    EXPECT_EQ(DispatchCounts::m_device_copy,1);
+
+    conduit::Schema s(conduit::DataType::float64(10));
+    n_dev.set_schema(s);
+    EXPECT_EQ(DispatchCounts::m_device_set,1);
+    EXPECT_EQ(DispatchCounts::m_global_set,0);
+    n_dev.set(vals);
+
+    // device to host falls back to the src allocator's handler
+    conduit::Node n_res;
+    n_res.set(vals);
+    DispatchCounts::reset();
+    n_res.update(n_dev);
+    EXPECT_EQ(DispatchCounts::m_device_copy,1);
+    EXPECT_EQ(DispatchCounts::m_global_copy,0);
+
+    // pair handlers take precedence
+    conduit::utils::set_memcpy_handler(0, dev_id, DispatchCounts::d2h_copy);
+    DispatchCounts::reset();
+    n_res.update(n_dev);
+    n_dev.compact_to(n_res);
+    EXPECT_EQ(DispatchCounts::m_d2h_copy,2);
+    EXPECT_EQ(DispatchCounts::m_device_copy,0);
+    EXPECT_EQ(DispatchCounts::m_global_copy,0);
+    EXPECT_EQ(n_res.as_float64_ptr()[99],3.0);
+
+    // trees with mixed leaves dispatch per leaf
+    conduit::Node n_tree;
+    n_tree["host"].set(vals);
+    n_tree["dev"].set_allocator(dev_id);
+    n_tree["dev"].set(vals);
+    conduit::Node n_copy;
+    DispatchCounts::reset();
+    n_copy.set(n_tree);
+    EXPECT_EQ(DispatchCounts::m_global_copy,1);
+    EXPECT_EQ(DispatchCounts::m_d2h_copy,1);
+
+    // compact_to never merges leaves from two allocators into one copy
+    DispatchCounts::reset();
+    n_tree.compact_to(n_copy);
+    EXPECT_EQ(DispatchCounts::m_global_copy,1);
+    EXPECT_EQ(DispatchCounts::m_d2h_copy,1);
+    EXPECT_EQ(n_copy["dev"].as_float64_ptr()[0],3.0);
+
+    // unbinding falls back to the global handler
+    conduit::utils::set_memcpy_handler(0, dev_id, NULL);
+    conduit::utils::set_memcpy_handler(dev_id, NULL);
+    DispatchCounts::reset();
+    n_res.update(n_dev);
+    EXPECT_EQ(DispatchCounts::m_global_copy,1);
+
+    conduit::utils::clear_allocator_memory_handlers();
+    DispatchCounts::reset();
+    n_dev.set_schema(s);
+    EXPECT_EQ(DispatchCounts::m_global_set,1);
+    EXPECT_EQ(DispatchCounts::m_device_set,0);
+
+    conduit::utils::set_memcpy_handler(conduit::utils::default_memcpy_handler);
+    conduit::utils::set_memset_handler(conduit::utils::default_memset_handler);
+}
+
+//-----------------------------------------------------------------------------
+// fake stream: async copies are queued and run on synchronize
+struct FakeStream
+{
+    struct Copy
+    {
+        void       *dest;
+        const void *src;
+        size_t      num;
+    };
+
+    std::vector<Copy> pending;
+
+    static void copy_async(void *dest, const void *src, size_t num, void *stream)
+    {
+        Copy c = {dest, src, num};
+        ((FakeStream*)stream)->pending.push_back(c);
+    }
+
+    static void synchronize(void *stream)
+    {
+        FakeStream *s = (FakeStream*)stream;
+        for(size_t i=0; i < s->pending.size(); i++)
+        {
+            memcpy(s->pending[i].dest, s->pending[i].src, s->pending[i].num);
+        }
+        s->pending.clear();
+    }
+
+    static bool query(void *stream)
+    {
+        return ((FakeStream*)stream)->pending.empty();
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_async_copies)
+{
+    conduit::utils::set_memcpy_handler(conduit::utils::default_memcpy_handler);
+    conduit::utils::set_memset_handler(conduit::utils::default_memset_handler);
+
+    conduit::index_t dev_id
+     = conduit::utils::register_allocator(DispatchCounts::device_alloc,
+                                          DispatchCounts::device_free);
+
+    conduit::utils::set_memcpy_async_handler(dev_id, FakeStream::copy_async);
+
+    FakeStream stream;
+
+    std::vector<conduit::float64> vals(100,3.0);
+    conduit::Node n_dev;
+    n_dev.set_allocator(dev_id);
+    n_dev["a"].set(vals);
+    n_dev["b"].set(vals);
+
+    // no stream handlers yet
+    conduit::Node n_host;
+    conduit::utils::AsyncCopyToken tok = n_dev.compact_to_async(n_host,&stream);
+    EXPECT_EQ(tok.number_of_async_copies(),2);
+    EXPECT_EQ(tok.stream(),(void*)&stream);
+    EXPECT_FALSE(tok.is_complete());
+    EXPECT_THROW(tok.wait(),conduit::Error);
+
+    conduit::utils::set_stream_handlers(FakeStream::synchronize,
+                                        FakeStream::query);
+    // nothing has been copied yet
+    EXPECT_EQ(n_host["b"].as_float64_ptr()[0],0.0);
+    EXPECT_FALSE(tok.is_complete());
+    tok.wait();
+    EXPECT_TRUE(tok.is_complete());
+    EXPECT_EQ(n_host["b"].as_float64_ptr()[99],3.0);
+
+    // update with a strided dest enqueues per element copies
+    n_dev["a"].set(std::vector<conduit::float64>(100,4.0));
+    conduit::Node n_strided;
+    n_strided["a"].set(conduit::DataType::float64(100,0,16));
+    tok = n_strided.update_async(n_dev,&stream);
+    EXPECT_EQ(tok.number_of_async_copies(),101);
+    EXPECT_EQ(n_strided["a"].as_float64_ptr()[0],0.0);
+    tok.wait();
+    EXPECT_EQ(n_strided["a"].as_float64_array()[99],4.0);
+    EXPECT_EQ(n_strided["b"].as_float64_ptr()[99],3.0);
+
+    // host only copies are synchronous
+    conduit::Node n_copy;
+    tok = n_copy.set_async(n_host,&stream);
+    EXPECT_EQ(tok.number_of_async_copies(),0);
+    EXPECT_TRUE(tok.is_complete());
+    EXPECT_EQ(n_copy["a"].as_float64_ptr()[0],3.0);
+
+    // set_async into device memory
+    conduit::Node n_dev2;
+    n_dev2.set_allocator(dev_id);
+    tok = n_dev2.set_async(n_host,&stream);
+    EXPECT_EQ(tok.number_of_async_copies(),2);
+    tok.wait();
+    EXPECT_EQ(n_dev2["a"].as_float64_ptr()[10],3.0);
+
+    // outside of a scope, copies are synchronous
+    n_dev2.set(n_host);
+    EXPECT_TRUE(stream.pending.empty());
+
+    conduit::utils::clear_allocator_memory_handlers();
+    conduit::utils::set_stream_handlers(NULL,NULL);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_device_allocator_marks)
+{
+    conduit::index_t dev_id
+     = conduit::utils::register_allocator(DispatchCounts::device_alloc,
+                                          DispatchCounts::device_free);
+
+    EXPECT_FALSE(conduit::utils::is_device_allocator(0));
+    EXPECT_FALSE(conduit::utils::is_device_allocator(dev_id));
+
+    conduit::utils::set_device_allocator(dev_id);
+    EXPECT_TRUE(conduit::utils::is_device_allocator(dev_id));
+    EXPECT_FALSE(conduit::utils::is_device_allocator(0));
+
+    // children of a node use its allocator
+    conduit::Node n;
+    n.set_allocator(dev_id);
+    conduit::Schema s;
+    s["a"].set(conduit::DataType::float64(10));
+    n.set(s);
+    EXPECT_TRUE(conduit::utils::is_device_allocator(n["a"].allocator()));
+
+    conduit::utils::set_device_allocator(dev_id, false);
+    EXPECT_FALSE(conduit::utils::is_device_allocator(dev_id));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_allocator_init_modes)
+{
+    EXPECT_EQ(conduit::utils::allocator_init(0),
+              conduit::utils::ALLOCATOR_INIT_ZERO);
+
+    conduit::index_t alloc_id
+     = conduit::utils::register_allocator(TestAllocator::banana_alloc,
+                                          TestAllocator::free_bananas);
+
+    // without zero fill, schema leaves aren't memset
+    conduit::utils::set_memset_handler(alloc_id, TestAllocator::banana_memset);
+    conduit::utils::set_allocator_init(alloc_id,
+                                       conduit::utils::ALLOCATOR_INIT_NONE);
+    EXPECT_EQ(conduit::utils::allocator_init(alloc_id),
+              conduit::utils::ALLOCATOR_INIT_NONE);
+
+    conduit::Schema s;
+    s["a"].set(conduit::DataType::float64(100));
+    s["b"].set(conduit::DataType::int32(10));
+
+    size_t memset_count = TestAllocator::m_memset_count;
+    conduit::Node n;
+    n.set_allocator(alloc_id);
+    n.set(s);
+    EXPECT_EQ(TestAllocator::m_memset_count, memset_count);
+    n["a"].as_float64_ptr()[99] = 1.0;
+    EXPECT_EQ(n["a"].as_float64_ptr()[99], 1.0);
+
+    // zero fill (the default) is restored
+    conduit::utils::set_allocator_init(alloc_id,
+                                       conduit::utils::ALLOCATOR_INIT_ZERO);
+    conduit::Node n_zero;
+    n_zero.set_allocator(alloc_id);
+    n_zero.set(s);
+    EXPECT_EQ(TestAllocator::m_memset_count, memset_count + 1);
+
+    // first touch zero fills in parallel, also for the default allocator
+    const conduit::index_t num_vals = 1000000;
+    conduit::utils::set_allocator_init(0,
+                                       conduit::utils::ALLOCATOR_INIT_FIRST_TOUCH,
+                                       4);
+    EXPECT_EQ(conduit::utils::allocator_init(0),
+              conduit::utils::ALLOCATOR_INIT_FIRST_TOUCH);
+    conduit::Node n_ft;
+    n_ft["a"].set(conduit::DataType::float64(num_vals));
+    n_ft["b"].set(conduit::DataType::int8(7));
+    const conduit::float64 *a_ptr = n_ft["a"].as_float64_ptr();
+    const conduit::int8 *b_ptr = n_ft["b"].as_int8_ptr();
+    conduit::float64 sum = 0.0;
+    for(conduit::index_t i = 0; i < num_vals; i++)
+    {
+        sum += a_ptr[i];
+    }
+    for(conduit::index_t i = 0; i < 7; i++)
+    {
+        sum += b_ptr[i];
+    }
+    EXPECT_EQ(sum, 0.0);
+
+    // uninitialized default allocations
+    conduit::utils::set_allocator_init(0,
+                                       conduit::utils::ALLOCATOR_INIT_NONE);
+    conduit::Node n_none;
+    n_none.set(conduit::DataType::float64(num_vals));
+    conduit::float64 *none_ptr = n_none.value();
+    none_ptr[num_vals - 1] = 3.0;
+    EXPECT_EQ(n_none.as_float64_array()[num_vals - 1], 3.0);
+
+    conduit::utils::set_allocator_init(0,
+                                       conduit::utils::ALLOCATOR_INIT_ZERO);
+    EXPECT_EQ(conduit::utils::allocator_init(0),
+              conduit::utils::ALLOCATOR_INIT_ZERO);
+
+    // direct parallel zero fill, with sizes that aren't whole pages
+    std::vector<unsigned char> buff(5 * 1024 * 1024 + 13, 7);
+    conduit::utils::parallel_zero_fill(&buff[0], buff.size(), 3);
+    size_t num_non_zero = 0;
+    for(size_t i = 0; i < buff.size(); i++)
+    {
+        num_non_zero += buff[i] != 0 ? 1 : 0;
+    }
+    EXPECT_EQ(num_non_zero, (size_t)0);
+
+    conduit::utils::clear_allocator_memory_handlers();
+}
+
+//-----------------------------------------------------------------------------
+static bool
+is_aligned(const void *ptr, size_t alignment)
+{
+    return ((size_t)ptr) % alignment == 0;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memory_allocator, test_aligned_allocator)
+{
+    EXPECT_EQ(conduit::utils::allocator_alignment(0), 0);
+
+    conduit::index_t aligned_id = conduit::utils::aligned_allocator_id(64);
+    EXPECT_GT(aligned_id, 0);
+    EXPECT_EQ(aligned_id, conduit::utils::aligned_allocator_id(64));
+    EXPECT_EQ(conduit::utils::allocator_alignment(aligned_id), 64);
+
+    conduit::index_t aligned_256_id = conduit::utils::aligned_allocator_id(256);
+    EXPECT_NE(aligned_id, aligned_256_id);
+
+    EXPECT_THROW(conduit::utils::aligned_allocator_id(48), conduit::Error);
+
+    // each leaf is aligned and zero initialized
+    conduit::Node n;
+    n.set_allocator(aligned_id);
+    n["a"].set(conduit::DataType::int8(3));
+    n["b"].set(conduit::DataType::float64(100));
+    n["c"].set(conduit::DataType::int32(7));
+    EXPECT_TRUE(is_aligned(n["a"].element_ptr(0), 64));
+    EXPECT_TRUE(is_aligned(n["b"].element_ptr(0), 64));
+    EXPECT_TRUE(is_aligned(n["c"].element_ptr(0), 64));
+    EXPECT_EQ(n["b"].as_float64_array().max(), 0.0);
+
+    conduit::Node n_256;
+    n_256.set_allocator(aligned_256_id);
+    n_256.set(n);
+    EXPECT_TRUE(is_aligned(n_256["b"].element_ptr(0), 256));
+
+    // loading conduit_bin files places the leaves at aligned offsets
+    conduit::float64_array b_vals = n["b"].value();
+    for(conduit::index_t i = 0; i < 100; i++)
+    {
+        b_vals[i] = i * 0.5;
+    }
+    n["c"].as_int32_ptr()[6] = 42;
+    n.save("tout_mem_allocator_aligned_load.conduit_bin");
+
+    conduit::Node n_load;
+    n_load.set_allocator(aligned_id);
+    n_load.load("tout_mem_allocator_aligned_load.conduit_bin");
+    EXPECT_TRUE(is_aligned(n_load["a"].element_ptr(0), 64));
+    EXPECT_TRUE(is_aligned(n_load["b"].element_ptr(0), 64));
+    EXPECT_TRUE(is_aligned(n_load["c"].element_ptr(0), 64));
+    conduit::Node info;
+    EXPECT_FALSE(n.diff(n_load, info));
+
+    // explicit schemas with gaps move leaves both up and down
+    conduit::Schema gapped;
+    gapped["a"].set(conduit::DataType::int8(3, 0));
+    gapped["b"].set(conduit::DataType::float64(4, 300));
+    gapped["c"].set(conduit::DataType::int32(2, 8));
+    std::vector<conduit::uint8> raw(300 + 4 * sizeof(conduit::float64), 0);
+    conduit::Node gapped_src;
+    gapped_src.set_external(gapped, &raw[0]);
+    gapped_src["a"].as_int8_ptr()[2] = 5;
+    for(conduit::index_t i = 0; i < 4; i++)
+    {
+        gapped_src["b"].as_float64_ptr()[i] = i + 0.25;
+    }
+    gapped_src["c"].as_int32_ptr()[0] = 7;
+    gapped_src["c"].as_int32_ptr()[1] = 9;
+    std::ofstream ofs("tout_mem_allocator_aligned_load_gapped.bin",
+                      std::ios_base::binary);
+    ofs.write((const char*)&raw[0], (std::streamsize)raw.size());
+    ofs.close();
+
+    conduit::Node n_gapped;
+    n_gapped.set_allocator(aligned_id);
+    n_gapped.load("tout_mem_allocator_aligned_load_gapped.bin", gapped);
+    EXPECT_TRUE(is_aligned(n_gapped["a"].element_ptr(0), 64));
+    EXPECT_TRUE(is_aligned(n_gapped["b"].element_ptr(0), 64));
+    EXPECT_TRUE(is_aligned(n_gapped["c"].element_ptr(0), 64));
+    EXPECT_FALSE(gapped_src.diff(n_gapped, info));
+
+    // large allocations with transparent huge pages
+    conduit::index_t huge_id
+        = conduit::utils::aligned_allocator_id(64,
+                                               conduit::utils::HUGE_PAGES_TRANSPARENT,
+                                               1 << 20);
+    conduit::Node n_huge;
+    n_huge.set_allocator(huge_id);
+    n_huge["small"].set(conduit::DataType::float64(10));
+    n_huge["big"].set(conduit::DataType::float64(1 << 19));
+    EXPECT_TRUE(is_aligned(n_huge["big"].element_ptr(0), 64));
+    conduit::float64_array big_vals = n_huge["big"].value();
+    EXPECT_EQ(big_vals.max(), 0.0);
+    big_vals.fill(1.0);
+    EXPECT_EQ(big_vals.sum(), (conduit::float64)(1 << 19));
+
+    // explicit huge pages fall back when none are reserved
+    conduit::index_t explicit_id
+        = conduit::utils::aligned_allocator_id(64,
+                                               conduit::utils::HUGE_PAGES_EXPLICIT,
+                                               1 << 20);
+    conduit::Node n_explicit;
+    n_explicit.set_allocator(explicit_id);
+    n_explicit.set(conduit::DataType::uint8(3 << 20));
+    EXPECT_TRUE(is_aligned(n_explicit.data_ptr(), 64));
+    n_explicit.as_uint8_ptr()[(3 << 20) - 1] = 1;
+
+    conduit::utils::allocator_info(info);
+    info.print();
+    EXPECT_EQ(info["aligned"].number_of_children(), 4);
+    EXPECT_EQ(info["aligned"][2]["allocator_id"].to_index_t(), huge_id);
+    EXPECT_EQ(info["aligned"][2]["huge_pages"].as_string(), "transparent");
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    EXPECT_EQ(info["aligned"][2]["num_huge_page_allocations"].to_int64(), 1);
+#endif
+}
@@ -1302,6 +1302,57 @@ TEST(conduit_node, describe)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node, describe_threads_and_sample)
+{
+    Node n;
+    n["a"].set(DataType::int32(1000));
+    n["b/c"].set(DataType::float64(100));
+    n["l"].append() = {4.0,-2.0,8.0};
+    n["s"] = "text";
+    int32 *a_vals = n["a"].value();
+    for(int i = 0; i < 1000; i++)
+    {
+        a_vals[i] = i;
+    }
+    float64_array c_vals = n["b/c"].value();
+    for(int i = 0; i < 100; i++)
+    {
+        c_vals[i] = 0.5 * i;
+    }
+
+    Node d_serial, d;
+    n.describe(d_serial);
+
+    Node opts;
+    opts["num_threads"] = 4;
+    n.describe(opts,d);
+    d.print();
+    Node info;
+    EXPECT_FALSE(d.diff(d_serial,info));
+
+    EXPECT_EQ(d["a/min"].dtype().id(),DataType::INT32_ID);
+    EXPECT_EQ(d["a/min"].to_int(),0);
+    EXPECT_EQ(d["a/max"].to_int(),999);
+    EXPECT_EQ(d["a/mean"].to_float64(),499.5);
+    EXPECT_EQ(d["b/c/max"].to_float64(),49.5);
+    EXPECT_EQ(d["l"][0]["min"].to_float64(),-2.0);
+    EXPECT_EQ(d["s/values"].as_string(),"text");
+    EXPECT_FALSE(d["a"].has_child("sample_count"));
+
+    // sampled leaves visit every 10th element of "a"
+    opts["sample"] = 100;
+    n.describe(opts,d);
+    EXPECT_EQ(d["a/count"].to_int(),1000);
+    EXPECT_EQ(d["a/sample_count"].to_int(),100);
+    EXPECT_EQ(d["a/min"].to_int(),0);
+    EXPECT_EQ(d["a/max"].to_int(),990);
+    EXPECT_EQ(d["a/mean"].to_float64(),495.0);
+    // leaves at or below the sample size are scanned fully
+    EXPECT_FALSE(d["b/c"].has_child("sample_count"));
+    EXPECT_EQ(d["b/c/max"].to_float64(),49.5);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_node, avoid_crazy_town)
 {
@@ -1321,3 +1372,193 @@ TEST(conduit_node, avoid_crazy_town)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, reserve_children)
+{
+    Node n;
+    n.reserve_children(100);
+    EXPECT_TRUE(n.dtype().is_list());
+    for(int i = 0; i < 100; i++)
+    {
+        n.append().set_int32(i);
+    }
+    EXPECT_EQ(n.number_of_children(), 100);
+    EXPECT_EQ(n[99].as_int32(), 99);
+
+    Node n_obj;
+    n_obj["a"] = 1;
+    n_obj.reserve_children(64);
+    for(int i = 0; i < 64; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        n_obj[oss.str()] = i;
+    }
+    EXPECT_EQ(n_obj.number_of_children(), 65);
+    EXPECT_EQ(n_obj["child_63"].to_int64(), 63);
+
+    Node n_leaf;
+    n_leaf.set_float64(1.0);
+    EXPECT_THROW(n_leaf.reserve_children(10), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, build_from_paths)
+{
+    float64 x[4] = {0.0, 1.0, 2.0, 3.0};
+    float64 y[4] = {4.0, 5.0, 6.0, 7.0};
+    int32   conn[6] = {0, 1, 2, 1, 2, 3};
+    // every other value of a strided array
+    float64 u[4] = {10.0, -1.0, 20.0, -1.0};
+
+    std::vector<Node::PathEntry> entries(6);
+    entries[0].path  = "coordsets/coords/values/x";
+    entries[0].dtype = DataType::float64(4);
+    entries[0].data  = x;
+    entries[1].path  = "topologies/mesh/elements/connectivity";
+    entries[1].dtype = DataType::int32(6);
+    entries[1].data  = conn;
+    entries[2].path  = "coordsets/coords/values/y";
+    entries[2].dtype = DataType::float64(4);
+    entries[2].data  = y;
+    entries[3].path  = "fields/u/values";
+    entries[3].dtype = DataType::float64(2,0,16);
+    entries[3].data  = u;
+    entries[4].path  = "fields/v/values";
+    entries[4].dtype = DataType::int64(3);
+    entries[4].data  = NULL;
+    // the last entry for a path wins
+    entries[5].path  = "topologies/mesh/elements/connectivity";
+    entries[5].dtype = DataType::int32(3);
+    entries[5].data  = conn + 3;
+
+    // the expected tree
+    Node n_expected;
+    n_expected["coordsets/coords/values/x"].set(x,4);
+    n_expected["topologies/mesh/elements/connectivity"].set(conn + 3,3);
+    n_expected["coordsets/coords/values/y"].set(y,4);
+    n_expected["fields/u/values"].set(DataType::float64(2,0,16),u);
+    n_expected["fields/v/values"].set(DataType::int64(3));
+
+    Node n;
+    n["old"] = 1;
+    n.build_from_paths(entries);
+    n.print();
+    Node info;
+    EXPECT_FALSE(n.diff(n_expected,info));
+    EXPECT_FALSE(n.has_child("old"));
+    EXPECT_EQ(n.child_names(),n_expected.child_names());
+    EXPECT_EQ(n["coordsets/coords/values"].child_names(),
+              n_expected["coordsets/coords/values"].child_names());
+    // all leaves share one compact allocation
+    EXPECT_TRUE(n.is_compact());
+    EXPECT_TRUE(n.is_contiguous());
+    EXPECT_EQ(n["fields/u/values"].dtype().stride(),8);
+    EXPECT_EQ(n.total_bytes_allocated(),n.total_bytes_compact());
+
+    // external leaves point to the passed data
+    int64 v[3] = {0, 0, 0};
+    entries[4].data = v;
+    Node n_ext;
+    n_ext.build_from_paths(entries,true);
+    EXPECT_FALSE(n_ext.diff(n_expected,info));
+    EXPECT_EQ(n_ext["coordsets/coords/values/x"].data_ptr(),(void*)x);
+    EXPECT_EQ(n_ext["fields/v/values"].data_ptr(),(void*)v);
+    EXPECT_EQ(n_ext["fields/u/values"].dtype().stride(),16);
+    EXPECT_EQ(n_ext.total_bytes_allocated(),0);
+
+    // many siblings
+    std::vector<Node::PathEntry> many(100);
+    for(int i = 0; i < 100; i++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << (i % 10) << "/field_" << i;
+        many[i].path  = oss.str();
+        many[i].dtype = DataType::float64(4);
+        many[i].data  = x;
+    }
+    n.build_from_paths(many);
+    EXPECT_EQ(n.number_of_children(),10);
+    EXPECT_EQ(n["domain_3"].number_of_children(),10);
+    EXPECT_EQ(n["domain_3/field_93"].as_float64_ptr()[3],3.0);
+
+    // a leaf can't also be a prefix
+    std::vector<Node::PathEntry> bad(2);
+    bad[0].path  = "a/b";
+    bad[0].dtype = DataType::float64(4);
+    bad[0].data  = x;
+    bad[1].path  = "a/b/c";
+    bad[1].dtype = DataType::float64(4);
+    bad[1].data  = x;
+    EXPECT_THROW(n.build_from_paths(bad),conduit::Error);
+    std::swap(bad[0],bad[1]);
+    EXPECT_THROW(n.build_from_paths(bad),conduit::Error);
+    bad[1].path = "a//b";
+    EXPECT_THROW(n.build_from_paths(bad),conduit::Error);
+
+    std::vector<Node::PathEntry> none;
+    n.build_from_paths(none);
+    EXPECT_TRUE(n.dtype().is_empty());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, append_values)
+{
+    Node n;
+    float64 vals[3] = {1.0, 2.0, 3.0};
+    n["hist"].append_values(vals, 3);
+    EXPECT_TRUE(n["hist"].dtype().is_float64());
+    EXPECT_EQ(n["hist"].dtype().number_of_elements(), 3);
+    EXPECT_EQ(n["hist"].values_capacity(), 3);
+
+    // capacity grows geometrically
+    index_t num_reallocs = 0;
+    const void *prev_ptr = n["hist"].data_ptr();
+    for(int i = 0; i < 1000; i++)
+    {
+        float64 v = 4.0 + i;
+        n["hist"].append_values(&v, 1);
+        if(n["hist"].data_ptr() != prev_ptr)
+        {
+            num_reallocs++;
+            prev_ptr = n["hist"].data_ptr();
+        }
+    }
+    EXPECT_LT(num_reallocs, 12);
+    EXPECT_EQ(n["hist"].dtype().number_of_elements(), 1003);
+    EXPECT_GE(n["hist"].values_capacity(), 1003);
+    float64_array hist = n["hist"].value();
+    for(index_t i = 0; i < 1003; i++)
+    {
+        EXPECT_EQ(hist[i], (float64)(i + 1));
+    }
+
+    // the tree with the grown leaf compacts and serializes as usual
+    Node n_compact, info;
+    n.compact_to(n_compact);
+    EXPECT_FALSE(n.diff(n_compact, info));
+    EXPECT_EQ(n_compact["hist"].dtype().number_of_elements(), 1003);
+
+    // strided external data is compacted into an owned allocation
+    int32 ext[6] = {0, -1, 1, -1, 2, -1};
+    Node n_ext;
+    n_ext.set_external(DataType::int32(3, 0, 2 * sizeof(int32)), ext);
+    int32 more[2] = {3, 4};
+    n_ext.append_values(more, 2);
+    EXPECT_FALSE(n_ext.is_data_external());
+    EXPECT_TRUE(n_ext.dtype().is_compact());
+    int32_array ext_vals = n_ext.value();
+    EXPECT_EQ(ext_vals.number_of_elements(), 5);
+    for(index_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(ext_vals[i], (int32)i);
+    }
+    EXPECT_EQ(ext[2], 1);
+
+    // values must match the leaf's type
+    EXPECT_THROW(n_ext.append_values(vals, 3), conduit::Error);
+    Node n_obj;
+    n_obj["a"] = 1;
+    EXPECT_THROW(n_obj.append_values(vals, 3), conduit::Error);
+}
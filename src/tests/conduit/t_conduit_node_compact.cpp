@@ -104,3 +104,44 @@ TEST(conduit_node_compact, compact_3)
         EXPECT_EQ(n_arr[i],nc_arr[i]);
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compact, compact_mixed_runs)
+{
+    // a contiguous block of compact leaves, followed by a strided leaf,
+    // an empty leaf, and a leaf from a separate allocation
+    float64 vals[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+    int32   ivals[] = { -1, 10, -2, 20, -3, 30};
+    int64   ext = 42;
+
+    Node n;
+    n["a"].set_external(DataType::float64(3),vals);
+    n["b"].set_external(DataType::float64(2,3*sizeof(float64)),vals);
+    n["sub/c"].set_external(DataType::float64(3,5*sizeof(float64)),vals);
+    n["d"].set_external(DataType::int32(3,sizeof(int32),2*sizeof(int32)),
+                        ivals);
+    n["e"];
+    n["f"].set_external(&ext,1);
+    n["g"].set_external(vals,2);
+
+    Node nc;
+    n.compact_to(nc);
+
+    EXPECT_EQ(nc.total_bytes_compact(),n.total_bytes_compact());
+    EXPECT_TRUE(nc.is_compact());
+    EXPECT_TRUE(nc.is_contiguous());
+    Node info;
+    EXPECT_FALSE(n.diff(nc,info));
+
+    float64_array c_arr = nc["sub/c"].value();
+    EXPECT_EQ(c_arr[0],6.0);
+    EXPECT_EQ(c_arr[2],8.0);
+
+    int32_array d_arr = nc["d"].value();
+    EXPECT_EQ(d_arr[0],10);
+    EXPECT_EQ(d_arr[1],20);
+    EXPECT_EQ(d_arr[2],30);
+
+    EXPECT_EQ(nc["f"].as_int64(),42);
+    EXPECT_EQ(nc["g"].as_float64_ptr()[1],2.0);
+}
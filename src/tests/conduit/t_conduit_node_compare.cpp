@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <vector>
 #include <string>
 #include <string.h>
@@ -484,3 +485,136 @@ TEST(conduit_yaml, check_string_diffs)
     
     
 }
+
+//-----------------------------------------------------------------------------
+// checks that has_diff and has_diff_compatible agree with diff and
+// diff_compatible in both directions
+void check_has_diff(const Node &n, const Node &o,
+                    float64 epsilon = CONDUIT_EPSILON,
+                    bool relaxint = false)
+{
+    Node info;
+    EXPECT_EQ(n.has_diff(o, epsilon, relaxint),
+              n.diff(o, info, epsilon, relaxint));
+    EXPECT_EQ(o.has_diff(n, epsilon, relaxint),
+              o.diff(n, info, epsilon, relaxint));
+    EXPECT_EQ(n.has_diff_compatible(o, epsilon, relaxint),
+              n.diff_compatible(o, info, epsilon, relaxint));
+    EXPECT_EQ(o.has_diff_compatible(n, epsilon, relaxint),
+              o.diff_compatible(n, info, epsilon, relaxint));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, has_diff_matches_diff)
+{
+    Node n_ref;
+    n_ref["a"] = (int32)10;
+    n_ref["b/c"] = 3.5;
+    n_ref["b/d"] = "text";
+    n_ref["l"].append() = (float32)1.0;
+    n_ref["l"].append() = (uint16)2;
+    float64 vals[4] = {1.0, 2.0, 3.0, 4.0};
+    n_ref["v"].set(vals,4);
+
+    { // equal //
+        Node o(n_ref);
+        check_has_diff(n_ref, o);
+        EXPECT_FALSE(n_ref.has_diff(o));
+    }
+
+    { // value //
+        Node o(n_ref);
+        o["b/c"] = 3.6;
+        check_has_diff(n_ref, o);
+        EXPECT_TRUE(n_ref.has_diff(o));
+        // within epsilon
+        check_has_diff(n_ref, o, 0.5);
+        EXPECT_FALSE(n_ref.has_diff(o, 0.5));
+    }
+
+    { // string //
+        Node o(n_ref);
+        o["b/d"] = "texT";
+        check_has_diff(n_ref, o);
+        o["b/d"] = "text and more";
+        check_has_diff(n_ref, o);
+    }
+
+    { // dtype, with and without relaxint //
+        Node o(n_ref);
+        o["a"] = (int64)10;
+        check_has_diff(n_ref, o);
+        check_has_diff(n_ref, o, CONDUIT_EPSILON, true);
+        EXPECT_FALSE(n_ref.has_diff(o, CONDUIT_EPSILON, true));
+    }
+
+    { // extra and missing children //
+        Node o(n_ref);
+        o["e"] = 1;
+        check_has_diff(n_ref, o);
+        o.remove("a");
+        check_has_diff(n_ref, o);
+        Node o_list(n_ref);
+        o_list["l"].append() = 1;
+        check_has_diff(n_ref, o_list);
+    }
+
+    { // leaf sizes //
+        Node o(n_ref);
+        o["v"].reset();
+        o["v"].set(vals,3);
+        check_has_diff(n_ref, o);
+        EXPECT_TRUE(n_ref.has_diff_compatible(o));
+        EXPECT_FALSE(o.has_diff_compatible(n_ref));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compare, has_diff_large_and_strided)
+{
+    // several comparison blocks, odd size
+    index_t num_eles = (1 << 20) + 37;
+    std::vector<float64> vals((size_t)num_eles);
+    for(index_t i = 0; i < num_eles; i++)
+    {
+        vals[(size_t)i] = (float64)i * 0.25;
+    }
+
+    Node n, o;
+    n.set(vals);
+    o.set(vals);
+    check_has_diff(n, o);
+    EXPECT_FALSE(n.has_diff(o));
+
+    // a small difference near the end, inside and outside epsilon
+    o.as_float64_ptr()[num_eles - 2] += 1e-3;
+    check_has_diff(n, o);
+    EXPECT_TRUE(n.has_diff(o));
+    EXPECT_FALSE(n.has_diff(o, 1e-2));
+
+    // NaN compare like diff: NaN deltas are not differences
+    Node n_nan, o_nan;
+    n_nan.set(std::numeric_limits<float64>::quiet_NaN());
+    o_nan.set(1.0);
+    check_has_diff(n_nan, o_nan);
+
+    // strided vs compact
+    std::vector<int32> inter(200);
+    std::vector<int32> compact(100);
+    for(size_t i = 0; i < compact.size(); i++)
+    {
+        compact[i] = (int32)i;
+        inter[2*i] = (int32)i;
+        inter[2*i+1] = -1;
+    }
+
+    Node n_strided, n_compact;
+    n_strided.set_external(DataType::int32(100,0,2*sizeof(int32)),&inter[0]);
+    n_compact.set_external(compact);
+    check_has_diff(n_strided, n_compact);
+    EXPECT_FALSE(n_strided.has_diff(n_compact));
+
+    compact[99] = 7;
+    check_has_diff(n_strided, n_compact);
+    EXPECT_TRUE(n_strided.has_diff(n_compact));
+}
@@ -0,0 +1,300 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_compress.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <cmath>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+void
+create_mesh_like(Node &n)
+{
+    n["coords/x"].set(DataType::float64(4096));
+    n["coords/y"].set(DataType::float64(4096));
+    n["fields/ids"].set(DataType::int64(8192));
+    n["fields/small"].set(DataType::int32(10));
+    n["name"] = "mesh";
+
+    float64_array x = n["coords/x"].value();
+    float64_array y = n["coords/y"].value();
+    for(index_t i = 0; i < 4096; i++)
+    {
+        x[i] = (float64)(i % 64);
+        y[i] = (float64)(i / 64);
+    }
+
+    int64_array ids = n["fields/ids"].value();
+    for(index_t i = 0; i < 8192; i++)
+    {
+        ids[i] = i;
+    }
+
+    n["fields/small"].as_int32_array().fill(7);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compress, codec_round_trip)
+{
+    // mix of runs, repeats and noise
+    std::vector<uint8> src(100000);
+    uint32 state = 12345;
+    for(size_t i = 0; i < src.size(); i++)
+    {
+        state = state * 1103515245u + 12345u;
+        if(i < 20000)
+        {
+            src[i] = 0;
+        }
+        else if(i < 60000)
+        {
+            src[i] = (uint8)(i % 251);
+        }
+        else
+        {
+            src[i] = (uint8)(state >> 24);
+        }
+    }
+
+    for(index_t ele_bytes = 1; ele_bytes <= 8; ele_bytes++)
+    {
+        std::vector<uint8> block;
+        compression::compress(src.data(),
+                              (index_t)src.size(),
+                              ele_bytes,
+                              "lz",
+                              block);
+        EXPECT_EQ(compression::decompressed_bytes(block.data(),
+                                                  (index_t)block.size()),
+                  (index_t)src.size());
+
+        std::vector<uint8> res(src.size());
+        compression::decompress(block.data(), (index_t)block.size(),
+                                res.data());
+        EXPECT_TRUE(res == src);
+    }
+
+    // empty and tiny inputs
+    for(index_t nbytes = 0; nbytes < 9; nbytes++)
+    {
+        std::vector<uint8> block;
+        compression::compress(src.data() + 60000, nbytes, 4, "lz", block);
+        std::vector<uint8> res((size_t)nbytes + 1, 0);
+        compression::decompress(block.data(), (index_t)block.size(),
+                                res.data());
+        EXPECT_EQ(memcmp(res.data(), src.data() + 60000, (size_t)nbytes), 0);
+    }
+
+    // corrupt blocks raise errors
+    std::vector<uint8> block;
+    compression::compress(src.data(), 20000, 1, "lz", block);
+    std::vector<uint8> res(20000);
+    std::vector<uint8> trunc(block.begin(), block.end() - 1);
+    EXPECT_THROW(compression::decompress(trunc.data(),
+                                         (index_t)trunc.size(),
+                                         res.data()),
+                 conduit::Error);
+    EXPECT_THROW(compression::decompress(block.data(), 8, res.data()),
+                 conduit::Error);
+
+    EXPECT_TRUE(compression::supports_method("lz"));
+    EXPECT_FALSE(compression::supports_method("zstd"));
+    EXPECT_THROW(compression::compress(src.data(), 10, 1, "zstd", block),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compress, compress_and_read)
+{
+    Node n_src;
+    create_mesh_like(n_src);
+
+    Node n;
+    n.set(n_src);
+    index_t alloc_bytes = n.total_bytes_allocated();
+
+    n.compress();
+
+    // large leaves are compressed, small ones are left as is
+    EXPECT_TRUE(n["coords/x"].is_data_compressed());
+    EXPECT_TRUE(n["coords/y"].is_data_compressed());
+    EXPECT_TRUE(n["fields/ids"].is_data_compressed());
+    EXPECT_FALSE(n["fields/small"].is_data_compressed());
+    EXPECT_FALSE(n["name"].is_data_compressed());
+    EXPECT_FALSE(n["coords/x"].is_data_external());
+
+    EXPECT_LT(n.total_bytes_allocated(), alloc_bytes);
+    EXPECT_GT(n.total_bytes_compressed(), 0);
+    EXPECT_LT(n.total_bytes_compressed(), alloc_bytes / 4);
+    EXPECT_EQ(n.total_bytes_compact(), n_src.total_bytes_compact());
+
+    // const access sees the original values
+    const Node &n_const = n;
+    Node info;
+    EXPECT_FALSE(n_const.diff(n_src, info));
+    EXPECT_FALSE(n_src.diff(n_const, info));
+    EXPECT_EQ(n_const.hash(), n_src.hash());
+    EXPECT_EQ(n_const.to_json(), n_src.to_json());
+
+    const float64 *x_ptr = n_const["coords/x"].as_float64_ptr();
+    EXPECT_EQ(x_ptr[65], 1.0);
+    float64_array y = n_const["coords/y"].value();
+    EXPECT_EQ(y[4095], 63.0);
+    int64_accessor ids = n_const["fields/ids"].as_int64_accessor();
+    EXPECT_EQ(ids[8191], 8191);
+    EXPECT_EQ(n_const["fields/ids"].to_int64(), 0);
+
+    // const access doesn't decompress permanently
+    EXPECT_TRUE(n["coords/x"].is_data_compressed());
+
+    // copies hold decompressed data
+    Node n_copy;
+    n_copy.set(n);
+    EXPECT_FALSE(n_copy["coords/x"].is_data_compressed());
+    EXPECT_FALSE(n_copy.diff(n_src, info));
+
+    Node n_info;
+    n.info(n_info);
+    EXPECT_GT(n_info["total_bytes_compressed"].to_index_t(), 0);
+
+    // non-const access decompresses the leaf
+    float64 *x_wr = n["coords/x"].as_float64_ptr();
+    EXPECT_FALSE(n["coords/x"].is_data_compressed());
+    x_wr[0] = -1.0;
+    EXPECT_EQ(n_const["coords/x"].as_float64_ptr()[0], -1.0);
+    EXPECT_TRUE(n["coords/y"].is_data_compressed());
+
+    n.decompress();
+    EXPECT_EQ(n.total_bytes_compressed(), 0);
+    EXPECT_EQ(n.total_bytes_allocated(), alloc_bytes);
+    n["coords/x"].as_float64_array()[0] = 0.0;
+    EXPECT_FALSE(n.diff(n_src, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compress, options)
+{
+    Node n_src;
+    create_mesh_like(n_src);
+
+    Node opts, n;
+    n.set(n_src);
+    opts["threshold"] = 0;
+    opts["shuffle"] = "false";
+    n.compress(opts);
+    EXPECT_TRUE(n["fields/small"].is_data_compressed());
+    Node info;
+    EXPECT_FALSE(n.diff(n_src, info));
+
+    // shuffled integers compress better
+    Node n_shuffle;
+    n_shuffle.set(n_src);
+    n_shuffle.compress();
+    EXPECT_LT(n_shuffle["fields/ids"].compressed_bytes(),
+              n["fields/ids"].compressed_bytes());
+
+    opts.reset();
+    opts["method"] = "zfp";
+    EXPECT_THROW(n_shuffle.compress(opts), conduit::Error);
+
+    // external data is left as is
+    std::vector<float64> vals(10000, 1.0);
+    Node n_ext;
+    n_ext["vals"].set_external(vals);
+    n_ext.compress();
+    EXPECT_FALSE(n_ext["vals"].is_data_compressed());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compress, cache_budget)
+{
+    index_t orig_budget = compression::cache_budget();
+    compression::clear_cache();
+
+    Node n_src, n;
+    for(int i = 0; i < 8; i++)
+    {
+        Node &leaf = n_src.append();
+        leaf.set(DataType::float64(10000));
+        leaf.as_float64_array().fill((float64)i);
+    }
+    n.set(n_src);
+    n.compress();
+
+    const index_t leaf_bytes = 10000 * sizeof(float64);
+    // room for three leaves
+    compression::set_cache_budget(3 * leaf_bytes);
+
+    const Node &n_const = n;
+    for(index_t i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(n_const[i].as_float64_ptr()[9999], (float64)i);
+        EXPECT_LE(compression::cache_bytes(), 3 * leaf_bytes);
+    }
+    EXPECT_EQ(compression::cache_bytes(), 3 * leaf_bytes);
+
+    // evicted leaves are read again
+    Node info;
+    EXPECT_FALSE(n_const.diff(n_src, info));
+
+    // the two most recent leaves are kept even without a budget
+    compression::set_cache_budget(0);
+    EXPECT_EQ(compression::cache_bytes(), 2 * leaf_bytes);
+    EXPECT_FALSE(n_const.diff(n_src, info));
+
+    compression::clear_cache();
+    EXPECT_EQ(compression::cache_bytes(), 0);
+
+    // removing compressed leaves removes their cache entries
+    compression::set_cache_budget(orig_budget);
+    n_const[0].as_float64_ptr();
+    EXPECT_EQ(compression::cache_bytes(), leaf_bytes);
+    n.reset();
+    EXPECT_EQ(compression::cache_bytes(), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_compress, swap_move_and_freeze)
+{
+    Node n_src;
+    create_mesh_like(n_src);
+
+    Node n_a, n_b;
+    n_a.set(n_src);
+    n_a.compress();
+
+    n_a.swap(n_b);
+    EXPECT_TRUE(n_b["coords/x"].is_data_compressed());
+
+    compression::clear_cache();
+    const Node &n_b_const = n_b["coords/x"];
+    EXPECT_EQ(n_b_const.as_float64_ptr()[65], 1.0);
+
+    Node n_c(std::move(n_b));
+    Node info;
+    EXPECT_FALSE(n_c.diff(n_src, info));
+
+    // set_external refers to decompressed data
+    Node n_ext;
+    n_ext.set_external(n_c);
+    EXPECT_FALSE(n_c["coords/x"].is_data_compressed());
+    EXPECT_FALSE(n_ext.diff(n_src, info));
+
+    n_c.compress();
+    EXPECT_TRUE(n_c["fields/ids"].is_data_compressed());
+    n_c.freeze();
+    EXPECT_FALSE(n_c["fields/ids"].is_data_compressed());
+    EXPECT_EQ(n_c.total_bytes_compressed(), 0);
+    EXPECT_THROW(n_c.compress(), conduit::Error);
+    n_c.unfreeze();
+}
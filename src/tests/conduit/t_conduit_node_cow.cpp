@@ -0,0 +1,190 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_cow.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+void
+create_mesh_like(Node &n)
+{
+    n["coords/x"].set(DataType::float64(100));
+    n["coords/y"].set(DataType::float64(100));
+    n["fields/pressure"].set(DataType::float32(50));
+    n["fields/ids"].set(DataType::int64(50));
+    n["name"] = "mesh";
+
+    n["coords/x"].as_float64_array().fill(1.0);
+    n["coords/y"].as_float64_array().fill(2.0);
+    n["fields/pressure"].as_float32_array().fill(3.0f);
+    n["fields/ids"].as_int64_array().fill(4);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_cow, share_and_isolate_writes)
+{
+    Node n_src;
+    create_mesh_like(n_src);
+    index_t src_bytes = n_src.total_bytes_allocated();
+
+    Node n_cow;
+    n_cow.set_cow(n_src);
+
+    Node info;
+    EXPECT_FALSE(n_src.diff(n_cow,info));
+
+    // nothing was copied, all leaves reference the same memory
+    const Node &n_src_const = n_src;
+    const Node &n_cow_const = n_cow;
+    EXPECT_EQ(n_src_const["coords/x"].data_ptr(),
+              n_cow_const["coords/x"].data_ptr());
+    EXPECT_TRUE(n_cow["coords/x"].is_data_shared());
+    EXPECT_TRUE(n_src["coords/x"].is_data_shared());
+    EXPECT_FALSE(n_cow["coords/x"].is_data_external());
+
+    EXPECT_EQ(n_cow.total_bytes_allocated(),0);
+    EXPECT_EQ(n_cow.total_bytes_shared(),src_bytes);
+    EXPECT_EQ(n_src.total_bytes_allocated(),0);
+    EXPECT_EQ(n_src.total_bytes_shared(),src_bytes);
+
+    // a mutable access copies only the accessed leaf
+    float64 *x_ptr = n_cow["coords/x"].value();
+    EXPECT_NE((const void*)x_ptr, n_src_const["coords/x"].data_ptr());
+    x_ptr[0] = -1.0;
+
+    EXPECT_EQ(n_src_const["coords/x"].as_float64_ptr()[0],1.0);
+    EXPECT_EQ(n_cow_const["coords/x"].as_float64_ptr()[0],-1.0);
+    EXPECT_FALSE(n_cow["coords/x"].is_data_shared());
+    EXPECT_EQ(n_cow["coords/x"].allocated_bytes(), 100 * sizeof(float64));
+
+    // other leaves are still shared
+    EXPECT_EQ(n_src_const["coords/y"].data_ptr(),
+              n_cow_const["coords/y"].data_ptr());
+    EXPECT_EQ(n_cow.total_bytes_allocated(), 100 * sizeof(float64));
+
+    // set with a compatible dtype writes in place, so it also copies
+    n_cow["fields/ids"].set(DataType::int64(50));
+    n_cow["fields/ids"].as_int64_array().fill(-4);
+    EXPECT_EQ(n_src_const["fields/ids"].as_int64_ptr()[10],4);
+    EXPECT_EQ(n_cow_const["fields/ids"].as_int64_ptr()[10],-4);
+
+    // writes to the source are isolated from the copy as well
+    n_src["fields/pressure"].as_float32_array().fill(-3.0f);
+    EXPECT_EQ(n_cow_const["fields/pressure"].as_float32_ptr()[0],3.0f);
+
+    // adding a derived field only changes the copy
+    n_cow["fields/derived"].set(DataType::float64(10));
+    EXPECT_FALSE(n_src.has_path("fields/derived"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_cow, lifetime)
+{
+    Node n_cow;
+    {
+        Node n_src;
+        create_mesh_like(n_src);
+        n_cow.set_cow(n_src);
+    }
+
+    // source is gone, shared buffers remain valid with a single ref
+    const Node &n_cow_const = n_cow;
+    EXPECT_EQ(n_cow_const["coords/y"].as_float64_ptr()[99],2.0);
+
+    const void *y_addr = n_cow_const["coords/y"].data_ptr();
+    // sole owner, so mutable access takes ownership without a copy
+    float64_array y_vals = n_cow["coords/y"].value();
+    EXPECT_EQ((const void*)y_vals.data_ptr(),y_addr);
+    EXPECT_FALSE(n_cow["coords/y"].is_data_shared());
+    EXPECT_EQ(y_vals[0],2.0);
+
+    // chained copies share the same buffer
+    Node n_cow_2, n_cow_3;
+    n_cow_2.set_cow(n_cow);
+    n_cow_3.set_cow(n_cow_2);
+
+    Node info;
+    n_cow_3.info(info);
+    EXPECT_EQ(info["total_bytes_shared"].to_index_t(),
+              n_cow_3.total_bytes_compact());
+
+    NodeConstIterator itr = info["mem_spaces"].children();
+    while(itr.has_next())
+    {
+        const Node &mem_space = itr.next();
+        EXPECT_EQ(mem_space["type"].as_string(),"shared");
+        EXPECT_EQ(mem_space["ref_count"].to_index_t(),3);
+    }
+
+    n_cow.reset();
+    n_cow_2.reset();
+    EXPECT_EQ(n_cow_3["name"].as_string(),"mesh");
+    EXPECT_EQ(n_cow_3["fields/ids"].as_int64_ptr()[0],4);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_cow, non_owned_leaves_are_copied)
+{
+    float64 vals[4] = {1.0, 2.0, 3.0, 4.0};
+
+    Node n_src;
+    n_src["external"].set_external(vals,4);
+    n_src["owned"] = (int64) 10;
+
+    Node n_cow;
+    n_cow.set_cow(n_src);
+
+    EXPECT_FALSE(n_cow["external"].is_data_shared());
+    EXPECT_FALSE(n_cow["external"].is_data_external());
+    EXPECT_TRUE(n_cow["owned"].is_data_shared());
+
+    const Node &n_cow_const = n_cow;
+    EXPECT_NE(n_cow_const["external"].data_ptr(),(const void*)vals);
+
+    // compact trees have a single allocation at the root,
+    // their leaves are copied
+    Node n_compact;
+    n_src.compact_to(n_compact);
+    Node n_cow_compact;
+    n_cow_compact.set_cow(n_compact);
+    EXPECT_EQ(n_cow_compact.total_bytes_shared(),0);
+    Node info;
+    EXPECT_FALSE(n_compact.diff(n_cow_compact,info));
+
+    // a list
+    Node n_list;
+    n_list.append() = 1.5;
+    n_list.append() = "here";
+    Node n_cow_list;
+    n_cow_list.set_cow(n_list);
+    EXPECT_TRUE(n_cow_list[0].is_data_shared());
+    EXPECT_EQ(n_cow_list[1].as_string(),"here");
+
+    // leaf to leaf
+    Node n_leaf;
+    n_leaf.set_cow(n_src["owned"]);
+    EXPECT_EQ(n_leaf.as_int64(),10);
+    EXPECT_TRUE(n_leaf.is_data_shared());
+
+    // swap and move keep the shared buffer
+    Node n_other;
+    n_other.swap(n_leaf);
+    EXPECT_TRUE(n_other.is_data_shared());
+    EXPECT_FALSE(n_leaf.is_data_shared());
+    n_leaf.move(n_other);
+    EXPECT_TRUE(n_leaf.is_data_shared());
+    n_leaf.set((int64)11);
+    EXPECT_EQ(n_leaf.as_int64(),11);
+    EXPECT_EQ(n_src["owned"].as_int64(),10);
+}
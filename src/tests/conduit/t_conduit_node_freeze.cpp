@@ -0,0 +1,273 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_freeze.cpp
+///
+/// Note: the concurrent tests are most useful in builds with
+/// ENABLE_TSAN=ON, where the thread sanitizer reports any data races.
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+static const int NUM_READERS = 8;
+
+//-----------------------------------------------------------------------------
+static void
+make_mesh(Node &n, int num_domains)
+{
+    for(int i = 0; i < num_domains; i++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << i;
+        Node &dom = n[oss.str()];
+        dom["state/domain_id"] = (int64) i;
+        dom["coordsets/coords/type"] = "uniform";
+        dom["fields/u/values"].set(DataType::float64(100));
+        float64 *u_vals = dom["fields/u/values"].value();
+        for(int j = 0; j < 100; j++)
+        {
+            u_vals[j] = i * 1000.0 + j;
+        }
+        dom["list"].append() = (int32) i;
+        dom["list"].append() = (int32) -i;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// reads every domain with const access methods, returns the number of
+// mismatches
+static int
+read_mesh(const Node &n, int num_domains)
+{
+    int errors = 0;
+    for(int i = 0; i < num_domains; i++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << i;
+        const Node &dom = n.fetch_existing(oss.str());
+        errors += dom["state/domain_id"].to_int64() != i;
+        errors += dom.child("coordsets").child(0)["type"].as_string()
+                    != "uniform";
+        errors += !n.has_path(oss.str() + "/fields/u/values");
+
+        float64_array u_vals = dom.fetch_existing("fields/u/values").value();
+        float64 sum = 0.0;
+        for(index_t j = 0; j < u_vals.number_of_elements(); j++)
+        {
+            sum += u_vals[j];
+        }
+        errors += sum != i * 1000.0 * 100 + 4950.0;
+        errors += dom["list"][1].to_int32() != -i;
+
+        NodeConstIterator itr = dom.children();
+        index_t count = 0;
+        while(itr.has_next())
+        {
+            itr.next();
+            count++;
+        }
+        errors += count != 4;
+    }
+    return errors;
+}
+
+//-----------------------------------------------------------------------------
+template <typename Func>
+static void
+run_readers(Func func)
+{
+    std::vector<std::thread> threads;
+    for(int i = 0; i < NUM_READERS; i++)
+    {
+        threads.push_back(std::thread(func, i));
+    }
+    for(size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_freeze, freeze_basics)
+{
+    Node n;
+    make_mesh(n,2);
+    EXPECT_FALSE(n.is_frozen());
+
+    n.freeze();
+    EXPECT_TRUE(n.is_frozen());
+    EXPECT_TRUE(n["domain_1/fields/u/values"].is_frozen());
+    EXPECT_TRUE(n["domain_0/list"][0].is_frozen());
+
+    // non-const access to existing paths is fine
+    Node &u = n["domain_1/fields/u/values"];
+    EXPECT_EQ(u.as_float64_ptr()[2], 1002.0);
+
+    // changes raise errors
+    EXPECT_THROW(n["domain_0/state/domain_id"].set((int64)5),conduit::Error);
+    EXPECT_THROW(n["new_path"],conduit::Error);
+    EXPECT_THROW(n.add_child("new_child"),conduit::Error);
+    EXPECT_THROW(n["domain_0/list"].append(),conduit::Error);
+    EXPECT_THROW(n["domain_0/list"].remove(0),conduit::Error);
+    EXPECT_THROW(n.remove("domain_1"),conduit::Error);
+    EXPECT_THROW(n.rename_child("domain_1","domain_2"),conduit::Error);
+    EXPECT_THROW(n.reset(),conduit::Error);
+    EXPECT_THROW(n.endian_swap_to_big(),conduit::Error);
+    Node n_other;
+    make_mesh(n_other,2);
+    EXPECT_THROW(n.update(n_other),conduit::Error);
+    Node n_tmp;
+    EXPECT_THROW(n_tmp.swap(n["domain_0"]),conduit::Error);
+
+    // nothing changed
+    Node info;
+    EXPECT_FALSE(n.diff(n_other,info));
+    EXPECT_EQ(n["domain_0/list"].number_of_children(),2);
+
+    // frozen nodes can be copied, the copy is not frozen
+    Node n_copy(n);
+    EXPECT_FALSE(n_copy.is_frozen());
+    n_copy["domain_0/state/domain_id"] = (int64)5;
+
+    // a frozen root moves with its frozen state
+    Node n_moved;
+    n_moved.move(n_copy);
+    EXPECT_FALSE(n_moved.is_frozen());
+    n_copy.freeze();
+    Node n_moved_frozen(std::move(n));
+    EXPECT_TRUE(n_moved_frozen.is_frozen());
+    EXPECT_FALSE(n.is_frozen());
+
+    // moving a child out of a frozen tree copies it
+    Node n_child(std::move(n_moved_frozen["domain_0/state"]));
+    EXPECT_EQ(n_child["domain_id"].to_int64(),
+              n_moved_frozen["domain_0/state/domain_id"].to_int64());
+    EXPECT_TRUE(n_moved_frozen.has_path("domain_0/state/domain_id"));
+    Node n_child_assign;
+    n_child_assign = std::move(n_moved_frozen["domain_0/state"]);
+    EXPECT_FALSE(n_child.diff(n_child_assign,info));
+    EXPECT_TRUE(std::is_nothrow_move_constructible<Node>::value);
+
+    // frozen nodes can't be move assigned to
+    Node n_other_src;
+    n_other_src.set((int32)1);
+    EXPECT_THROW(n_moved_frozen["domain_0/state"] = std::move(n_other_src),
+                 conduit::Error);
+    EXPECT_THROW(n_moved_frozen = std::move(n_other_src),conduit::Error);
+    EXPECT_EQ(n_other_src.to_int32(),1);
+
+    // children of frozen nodes can't be unfrozen
+    EXPECT_THROW(n_moved_frozen["domain_0"].unfreeze(),conduit::Error);
+
+    n_moved_frozen.unfreeze();
+    EXPECT_FALSE(n_moved_frozen.is_frozen());
+    EXPECT_FALSE(n_moved_frozen["domain_0/list"][0].is_frozen());
+    n_moved_frozen["domain_0/list"].append() = (int32)3;
+    EXPECT_EQ(n_moved_frozen["domain_0/list"].number_of_children(),3);
+
+    // frozen trees can be destroyed
+    Node *n_ptr = new Node();
+    make_mesh(*n_ptr,2);
+    n_ptr->freeze();
+    delete n_ptr;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_freeze, freeze_cow_and_hash_cache)
+{
+    Node n_src;
+    make_mesh(n_src,2);
+    Node n;
+    n.set_cow(n_src);
+    EXPECT_TRUE(n["domain_0/fields/u/values"].is_data_shared());
+
+    // non-const access to frozen cow data does not unshare it
+    n.freeze();
+    n["domain_0/fields/u/values"].as_float64_ptr();
+    EXPECT_TRUE(n["domain_0/fields/u/values"].is_data_shared());
+    n.unfreeze();
+
+    // frozen leaves aren't converted to shared buffers
+    Node n_frozen;
+    make_mesh(n_frozen,2);
+    n_frozen.freeze();
+    Node n_cow;
+    n_cow.set_cow(n_frozen["domain_1/fields/u/values"]);
+    EXPECT_FALSE(n_cow.is_data_shared());
+    EXPECT_EQ(n_cow.as_float64_ptr()[1], 1001.0);
+    EXPECT_FALSE(n_frozen["domain_1/fields/u/values"].is_data_shared());
+
+    // hashing a frozen tree with the cache option gives the same result
+    Node opts;
+    opts["cache"] = "true";
+    uint64 h_frozen = n_src.hash(opts);
+    n_src.unfreeze();
+    EXPECT_EQ(h_frozen, n_src.hash(opts));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_freeze, concurrent_readers)
+{
+    const int num_domains = 64;
+    Node n;
+    make_mesh(n,num_domains);
+    n.freeze();
+
+    const Node &n_const = n;
+    std::atomic<int> errors(0);
+    run_readers([&](int tid)
+    {
+        int res = read_mesh(n_const,num_domains);
+        // also use the non-const fetch of existing paths
+        std::ostringstream oss;
+        oss << "domain_" << tid << "/fields/u/values";
+        res += n[oss.str()].as_float64_ptr()[1] != tid * 1000.0 + 1;
+        Node info;
+        res += n_const["domain_0"].diff(n_const["domain_0"],info);
+        res += n_const.has_diff(n_const);
+        errors += res;
+    });
+    EXPECT_EQ(errors.load(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_freeze, concurrent_readers_lazy_mmap)
+{
+    const int num_domains = 32;
+    Node n;
+    make_mesh(n,num_domains);
+    std::string fname = "tout_node_freeze_lazy.conduit_pack";
+    n.save(fname);
+
+    Node opts;
+    opts["lazy"] = "true";
+    Node n_mmap;
+    n_mmap.mmap(fname,opts);
+
+    // freeze creates the pending children up front
+    n_mmap.freeze();
+
+    const Node &n_const = n_mmap;
+    std::atomic<int> errors(0);
+    run_readers([&](int)
+    {
+        int res = read_mesh(n_const,num_domains);
+        res += n_const.to_json() != n.to_json();
+        errors += res;
+    });
+    EXPECT_EQ(errors.load(),0);
+}
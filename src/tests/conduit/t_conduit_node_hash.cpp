@@ -0,0 +1,255 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_hash.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+static void
+make_tree(Node &n)
+{
+    n["a"] = (int32)10;
+    n["b/c"] = 3.1415;
+    n["b/d"] = "some text";
+    n["e"].set(DataType::float64(5));
+    float64 *e_ptr = n["e"].value();
+    for(int i = 0; i < 5; i++)
+    {
+        e_ptr[i] = i * 1.5;
+    }
+    n["f"].append() = (int64)1;
+    n["f"].append() = (int64)2;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, equal_trees)
+{
+    Node n1, n2;
+    make_tree(n1);
+    make_tree(n2);
+
+    EXPECT_EQ(n1.hash(), n2.hash());
+    EXPECT_EQ(n1["b"].hash(), n2["b"].hash());
+
+    // a compacted copy has the same hash
+    Node n3;
+    n1.compact_to(n3);
+    EXPECT_EQ(n1.hash(), n3.hash());
+
+    // empty nodes hash consistently
+    Node e1, e2;
+    EXPECT_EQ(e1.hash(), e2.hash());
+    EXPECT_NE(e1.hash(), n1.hash());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, differences)
+{
+    Node n;
+    make_tree(n);
+    uint64 h = n.hash();
+
+    // value change
+    Node n_val;
+    make_tree(n_val);
+    n_val["a"] = (int32)11;
+    EXPECT_NE(h, n_val.hash());
+
+    // dtype change with the same value
+    Node n_dtype;
+    make_tree(n_dtype);
+    n_dtype["a"] = (int64)10;
+    EXPECT_NE(h, n_dtype.hash());
+
+    // name change
+    Node n_name;
+    make_tree(n_name);
+    n_name.rename_child("a","z");
+    EXPECT_NE(h, n_name.hash());
+
+    // structure change
+    Node n_struct;
+    make_tree(n_struct);
+    n_struct["g"] = (int32)0;
+    EXPECT_NE(h, n_struct.hash());
+
+    // child order matters
+    Node o1, o2;
+    o1["x"] = 1;
+    o1["y"] = 2;
+    o2["y"] = 2;
+    o2["x"] = 1;
+    EXPECT_NE(o1.hash(), o2.hash());
+
+    // seed changes the hash
+    Node opts;
+    opts["seed"] = 42;
+    EXPECT_NE(h, n.hash(opts));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, structure_only)
+{
+    Node n1, n2;
+    make_tree(n1);
+    make_tree(n2);
+    n2["a"] = (int32)-5;
+    n2["e"].as_float64_ptr()[3] = 100.0;
+
+    Node opts;
+    opts["data"] = "false";
+    EXPECT_EQ(n1.hash(opts), n2.hash(opts));
+    EXPECT_NE(n1.hash(), n2.hash());
+
+    // but dtypes still matter
+    n2["a"] = (int16)10;
+    EXPECT_NE(n1.hash(opts), n2.hash(opts));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, strided_vs_compact)
+{
+    std::vector<float64> vals(20);
+    for(size_t i = 0; i < vals.size(); i++)
+    {
+        vals[i] = (float64)i;
+    }
+
+    // every other value
+    Node n_strided;
+    n_strided.set_external(DataType::float64(10,0,2 * sizeof(float64)),
+                           &vals[0]);
+
+    Node n_compact;
+    n_strided.compact_to(n_compact);
+    EXPECT_FALSE(n_strided.dtype().is_compact());
+    EXPECT_TRUE(n_compact.dtype().is_compact());
+
+    EXPECT_EQ(n_strided.hash(), n_compact.hash());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, bits)
+{
+    Node n;
+    make_tree(n);
+
+    Node opts, res;
+    opts["bits"] = 128;
+    n.hash(opts,res);
+    EXPECT_EQ(res.dtype().id(), DataType::UINT64_ID);
+    EXPECT_EQ(res.dtype().number_of_elements(), 2);
+
+    uint64_array words = res.value();
+    EXPECT_EQ(words[0], n.hash());
+    EXPECT_NE(words[0], words[1]);
+
+    opts["bits"] = 64;
+    n.hash(opts,res);
+    EXPECT_EQ(res.dtype().number_of_elements(), 1);
+    EXPECT_EQ(res.as_uint64(), n.hash());
+
+    opts["bits"] = 32;
+    EXPECT_THROW(n.hash(opts,res),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, cache)
+{
+    Node n;
+    make_tree(n);
+
+    Node opts;
+    opts["cache"] = "true";
+
+    uint64 h = n.hash(opts);
+    EXPECT_EQ(h, n.hash());
+    EXPECT_EQ(h, n.hash(opts));
+
+    // set invalidates the cached subtree and its ancestors
+    n["b/c"] = 2.0;
+    uint64 h_set = n.hash(opts);
+    EXPECT_NE(h, h_set);
+    EXPECT_EQ(h_set, n.hash());
+
+    // update
+    Node n_up;
+    n_up["a"] = (int32)20;
+    n.update(n_up);
+    uint64 h_up = n.hash(opts);
+    EXPECT_NE(h_set, h_up);
+    EXPECT_EQ(h_up, n.hash());
+
+    // adding and removing children
+    n["b/new"] = 1;
+    uint64 h_add = n.hash(opts);
+    EXPECT_NE(h_up, h_add);
+    n["b"].remove("new");
+    EXPECT_EQ(h_up, n.hash(opts));
+
+    // a cached hash computed with other options is not reused
+    Node opts_seed;
+    opts_seed["cache"] = "true";
+    opts_seed["seed"] = 7;
+    EXPECT_NE(n.hash(opts), n.hash(opts_seed));
+
+    // writes through pointers are not tracked, invalidate_hash handles
+    // them
+    uint64 h_before = n.hash(opts);
+    float64 *e_ptr = n["e"].value();
+    e_ptr[2] = -1.0;
+    EXPECT_EQ(h_before, n.hash(opts));
+    n["e"].invalidate_hash();
+    EXPECT_NE(h_before, n.hash(opts));
+    EXPECT_EQ(n.hash(), n.hash(opts));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, threaded_large_leaf)
+{
+    // larger than the hashing block size
+    index_t num_eles = (3 << 20) / sizeof(float64) + 17;
+    Node n;
+    n["big"].set(DataType::float64(num_eles));
+    float64 *ptr = n["big"].value();
+    for(index_t i = 0; i < num_eles; i++)
+    {
+        ptr[i] = (float64)i * 0.5;
+    }
+    n["small"] = 1;
+
+    Node opts;
+    opts["bits"] = 128;
+    Node res_serial;
+    n.hash(opts,res_serial);
+
+    opts["num_threads"] = 4;
+    Node res_threads;
+    n.hash(opts,res_threads);
+
+    opts["num_threads"] = 0;
+    Node res_hw;
+    n.hash(opts,res_hw);
+
+    Node info;
+    EXPECT_FALSE(res_serial.diff(res_threads,info));
+    EXPECT_FALSE(res_serial.diff(res_hw,info));
+
+    ptr[num_eles - 1] = 0.0;
+    opts["num_threads"] = 4;
+    Node res_changed;
+    n.hash(opts,res_changed);
+    EXPECT_TRUE(res_serial.diff(res_changed,info));
+}
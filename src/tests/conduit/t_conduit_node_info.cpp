@@ -11,6 +11,8 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -84,3 +86,120 @@ TEST(conduit_node_info, simple_3)
     
     
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_info, cached_totals)
+{
+    Node n;
+    n["a/b"].set(DataType::float64(10));
+    n["a/c"].set(DataType::int32(10));
+    n["d"].set(DataType::uint8(16));
+
+    // store the totals of each subtree
+    Node opts, ninfo;
+    opts["cache"] = "true";
+    n.info(opts,ninfo);
+    EXPECT_EQ(136,ninfo["total_bytes_allocated"].to_index_t());
+
+    EXPECT_EQ(136,n.total_bytes_allocated());
+    EXPECT_EQ(136,n.total_bytes_compact());
+    EXPECT_EQ(120,n["a"].total_strided_bytes());
+
+    // changes below a cached subtree update its totals
+    n["a/b"].set(DataType::float64(20));
+    EXPECT_EQ(216,n.total_bytes_allocated());
+    EXPECT_EQ(200,n["a"].total_bytes_compact());
+
+    n["a/e"].set(DataType::int64(2));
+    EXPECT_EQ(232,n.total_bytes_allocated());
+
+    n["a"].remove("c");
+    EXPECT_EQ(192,n.total_bytes_allocated());
+    EXPECT_EQ(176,n["a"].total_strided_bytes());
+
+    Node other;
+    other["d"].set(DataType::uint8(32));
+    n.update(other);
+    EXPECT_EQ(208,n.total_bytes_allocated());
+
+    // strided views
+    Node view;
+    view.set_external(DataType::float64(5,0,16),n["a/b"].data_ptr());
+    EXPECT_EQ(0,view.total_bytes_allocated());
+    EXPECT_EQ(40,view.total_bytes_compact());
+    EXPECT_EQ(72,view.total_strided_bytes());
+
+    // copy-on-write sharing moves bytes between allocated and shared
+    Node cow;
+    cow.set_cow(n);
+    EXPECT_EQ(0,n.total_bytes_allocated());
+    EXPECT_EQ(208,n.total_bytes_shared());
+    EXPECT_EQ(208,cow.total_bytes_shared());
+    cow["d"].as_uint8_ptr()[0] = 1;
+    EXPECT_EQ(32,cow.total_bytes_allocated());
+    EXPECT_EQ(176,cow.total_bytes_shared());
+
+    // frozen trees keep their totals
+    n.freeze();
+    EXPECT_EQ(208,n.total_bytes_shared());
+    EXPECT_EQ(176,n["a"].total_bytes_shared());
+    n.unfreeze();
+
+    n.reset();
+    EXPECT_EQ(0,n.total_bytes_allocated());
+    EXPECT_EQ(0,n.total_bytes_shared());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_info, summary)
+{
+    Node n;
+    n["a"].set(DataType::float64(10));
+    n["b"].set(DataType::int32(10));
+
+    Node opts, ninfo;
+    opts["summary"] = "true";
+    n.info(opts,ninfo);
+    std::cout << ninfo.to_yaml() << std::endl;
+    EXPECT_FALSE(ninfo.has_child("mem_spaces"));
+    EXPECT_EQ(120,ninfo["total_bytes_allocated"].to_index_t());
+    EXPECT_EQ(120,ninfo["total_bytes_compact"].to_index_t());
+
+    opts["summary"] = "false";
+    n.info(opts,ninfo);
+    EXPECT_EQ(2,ninfo["mem_spaces"].number_of_children());
+    EXPECT_EQ(120,ninfo["total_bytes_allocated"].to_index_t());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_info, totals_shared_source)
+{
+    // total_* don't write to the tree, so threads can copy from the same
+    // (unfrozen) source, which uses total_bytes_compact
+    Node src;
+    for(int i = 0; i < 16; i++)
+    {
+        src["fields"].append().set(DataType::float64(100));
+    }
+    const Node &src_ref = src;
+
+    std::vector<index_t> totals(4,0);
+    std::vector<std::thread> threads;
+    for(size_t t = 0; t < totals.size(); t++)
+    {
+        threads.push_back(std::thread([&src_ref,&totals,t]()
+        {
+            Node dest;
+            dest.set(src_ref);
+            totals[t] = dest.total_bytes_allocated();
+        }));
+    }
+    for(size_t t = 0; t < threads.size(); t++)
+    {
+        threads[t].join();
+    }
+    for(size_t t = 0; t < totals.size(); t++)
+    {
+        EXPECT_EQ(16 * 800,totals[t]);
+    }
+}
@@ -11,7 +11,9 @@
 
 #include "conduit.hpp"
 
+#include <atomic>
 #include <iostream>
+#include <vector>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -356,3 +358,184 @@ TEST(conduit_node_iterator, ref_constructor)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_iterator, leaf_iterator)
+{
+    Node n;
+    n["a"] = (int32) 1;
+    n["b/c"].set(DataType::float64(4));
+    n["b/d"] = "text";
+    n["e"];  // empty, skipped
+    n["f"].append().set((uint8) 5);
+    n["f"].append().set((uint8) 6);
+
+    std::vector<std::string> paths;
+    std::vector<index_t> nbytes;
+    NodeConstLeafIterator itr = ((const Node&)n).leaves();
+    while(itr.has_next())
+    {
+        const NodeConstLeafSpan &span = itr.next();
+        EXPECT_EQ(span.number_of_leaves(), 1);
+        EXPECT_EQ(span.leaf_index(), (index_t)paths.size());
+        EXPECT_EQ(span.data(), span.leaf().element_ptr(0));
+        paths.push_back(span.path());
+        nbytes.push_back(span.number_of_bytes());
+    }
+
+    ASSERT_EQ(paths.size(), 5u);
+    EXPECT_EQ(paths[0], "a");
+    EXPECT_EQ(paths[1], "b/c");
+    EXPECT_EQ(paths[2], "b/d");
+    EXPECT_EQ(paths[3], "f/[0]");
+    EXPECT_EQ(paths[4], "f/[1]");
+    EXPECT_EQ(nbytes[1], 4 * 8);
+    EXPECT_EQ(nbytes[2], 5);
+    EXPECT_THROW(itr.next(), conduit::Error);
+
+    itr.to_front();
+    EXPECT_TRUE(itr.has_next());
+    EXPECT_EQ(itr.next().path(), "a");
+
+    // paths are relative to the iterated node
+    NodeLeafIterator sub_itr = n["b"].leaves();
+    EXPECT_EQ(sub_itr.next().path(), "c");
+    // a leaf iterates itself
+    NodeLeafIterator leaf_itr = n["a"].leaves();
+    EXPECT_EQ(leaf_itr.next().path(), "");
+    EXPECT_FALSE(leaf_itr.has_next());
+
+    // non-const spans give writable access
+    NodeLeafIterator w_itr = n.leaves();
+    const NodeLeafSpan &span = w_itr.next();
+    ((int32*)span.data())[0] = 42;
+    EXPECT_EQ(n["a"].as_int32(), 42);
+
+    NodeLeafIterator empty_itr;
+    EXPECT_FALSE(empty_itr.has_next());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_iterator, leaf_iterator_coalesce)
+{
+    std::vector<float64> vals(20, 1.0);
+    std::vector<float64> other(4, 2.0);
+
+    Node n;
+    // a, b, c are contiguous
+    n["a"].set_external(&vals[0], 4);
+    n["b"].set_external(&vals[4], 4);
+    n["c/d"].set_external(&vals[8], 4);
+    // gap
+    n["e"].set_external(&vals[16], 2);
+    // strided, never coalesced
+    n["f"].set_external(&vals[18], 1, 0, 2 * sizeof(float64));
+    n["g"].set_external(&vals[0], 2, 0, 2 * sizeof(float64));
+    // separate buffer
+    n["h"].set_external(other);
+
+    NodeLeafIterator itr = n.leaves(true);
+    EXPECT_TRUE(itr.coalesce());
+
+    const NodeLeafSpan *span = &itr.next();
+    EXPECT_EQ(span->number_of_leaves(), 3);
+    EXPECT_EQ(span->number_of_bytes(), 12 * 8);
+    EXPECT_EQ(span->path(), "a");
+    EXPECT_EQ(span->data(), (void*)&vals[0]);
+    EXPECT_TRUE(span->is_compact());
+
+    // e and f are contiguous (f has a single element)
+    span = &itr.next();
+    EXPECT_EQ(span->path(), "e");
+    EXPECT_EQ(span->leaf_index(), 3);
+    EXPECT_EQ(span->number_of_leaves(), 2);
+    EXPECT_EQ(span->number_of_bytes(), 3 * 8);
+
+    span = &itr.next();
+    EXPECT_EQ(span->path(), "g");
+    EXPECT_FALSE(span->is_compact());
+    EXPECT_EQ(span->number_of_bytes(), 2 * 8);
+
+    span = &itr.next();
+    EXPECT_EQ(span->path(), "h");
+    EXPECT_EQ(span->leaf_index(), 6);
+    EXPECT_EQ(span->number_of_leaves(), 1);
+    EXPECT_FALSE(itr.has_next());
+
+    // a compacted tree is a single span
+    Node n_compact;
+    n.compact_to(n_compact);
+    NodeConstLeafIterator c_itr = ((const Node&)n_compact).leaves(true);
+    EXPECT_EQ(c_itr.next().number_of_leaves(), 7);
+    EXPECT_FALSE(c_itr.has_next());
+
+    // compact and serialize use the coalesced walk
+    std::vector<uint8> bytes;
+    n.serialize(bytes);
+    EXPECT_EQ((index_t)bytes.size(), n.total_bytes_compact());
+    Node n_load;
+    n_load.set_data_using_schema(n_compact.schema(), &bytes[0]);
+    Node info;
+    EXPECT_FALSE(n_load.diff(n, info));
+    EXPECT_FALSE(n_compact.diff(n, info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_iterator, for_each_leaf)
+{
+    Node n;
+    for(int i = 0; i < 100; i++)
+    {
+        n.append().set(DataType::int64(10));
+    }
+
+    // write leaf ids in parallel
+    Node opts;
+    opts["num_threads"] = 4;
+    n.for_each_leaf([](const NodeLeafSpan &span)
+    {
+        int64 *vals = (int64*)span.data();
+        for(int j = 0; j < 10; j++)
+        {
+            vals[j] = span.leaf_index();
+        }
+    }, opts);
+
+    for(int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(n[i].as_int64_array()[9], i);
+    }
+
+    // each child owns its data, so spans may or may not coalesce
+    const Node &cn = n;
+    std::atomic<index_t> total_bytes(0);
+    std::atomic<index_t> total_leaves(0);
+    opts["coalesce"] = "true";
+    opts["num_threads"] = 0;
+    cn.for_each_leaf([&](const NodeConstLeafSpan &span)
+    {
+        total_bytes  += span.number_of_bytes();
+        total_leaves += span.number_of_leaves();
+    }, opts);
+    EXPECT_EQ(total_bytes.load(), 100 * 10 * 8);
+    EXPECT_EQ(total_leaves.load(), 100);
+
+    // serial default
+    index_t count = 0;
+    cn.for_each_leaf([&](const NodeConstLeafSpan &)
+    {
+        count++;
+    });
+    EXPECT_EQ(count, 100);
+
+    // exceptions from func reach the caller
+    opts["num_threads"] = 4;
+    EXPECT_THROW(cn.for_each_leaf([](const NodeConstLeafSpan &span)
+                 {
+                     if(span.leaf_index() == 50)
+                     {
+                         CONDUIT_ERROR("leaf 50");
+                     }
+                 }, opts),
+                 conduit::Error);
+}
@@ -11,6 +11,8 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -170,3 +172,112 @@ TEST(conduit_node_move_and_swap, move)
 
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move_and_swap, move_sub_tree_parents)
+{
+    Node n;
+    n["a/x"] = 10;
+    n["a/y"] = 20;
+
+    Node n2;
+    n2.move(n["a"]);
+
+    // children and schemas must now belong to n2
+    EXPECT_EQ(n2["x"].parent(),&n2);
+    EXPECT_EQ(n2["y"].parent(),&n2);
+    EXPECT_TRUE(n2.schema().is_root());
+    EXPECT_EQ(n2["x"].path(),"x");
+    EXPECT_EQ(n2["x"].schema().path(),"x");
+    EXPECT_EQ(n2["y"].to_int64(),20);
+
+    // the sub tree left behind is empty, but still part of n
+    EXPECT_TRUE(n["a"].dtype().is_empty());
+    EXPECT_FALSE(n["a"].schema().is_root());
+    EXPECT_EQ(n["a"].schema().parent(),n.schema_ptr());
+    EXPECT_EQ(n["a"].path(),"a");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move_and_swap, move_construct_and_assign)
+{
+    Node n_src;
+    n_src["a/b/c"] = 10;
+    n_src["a/d"] = "word";
+
+    void *data_ptr_orig = n_src["a/b/c"].data_ptr();
+
+    Node n_ctor(std::move(n_src));
+    EXPECT_TRUE(n_src.dtype().is_empty());
+    EXPECT_EQ(n_ctor["a/b/c"].data_ptr(),data_ptr_orig);
+    EXPECT_EQ(n_ctor["a"].parent(),&n_ctor);
+    EXPECT_EQ(n_ctor["a/b"].parent(),n_ctor.fetch_ptr("a"));
+    EXPECT_TRUE(n_ctor.schema().is_root());
+
+    Node n_assign;
+    n_assign["junk"] = 42;
+    n_assign = std::move(n_ctor);
+    EXPECT_TRUE(n_ctor.dtype().is_empty());
+    EXPECT_FALSE(n_assign.has_child("junk"));
+    EXPECT_EQ(n_assign["a/b/c"].data_ptr(),data_ptr_orig);
+    EXPECT_EQ(n_assign["a"].parent(),&n_assign);
+    EXPECT_EQ(n_assign["a/d"].as_string(),"word");
+
+    // move from a Node that is part of another tree
+    Node n_sub(std::move(n_assign["a"]));
+    EXPECT_TRUE(n_sub.schema().is_root());
+    EXPECT_EQ(n_sub["b"].parent(),&n_sub);
+    EXPECT_EQ(n_sub["b/c"].data_ptr(),data_ptr_orig);
+    EXPECT_TRUE(n_assign["a"].dtype().is_empty());
+    EXPECT_EQ(n_assign["a"].parent(),&n_assign);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move_and_swap, vector_of_nodes)
+{
+    // vector growth should move (not deep copy) existing nodes
+    std::vector<Node> nodes;
+    std::vector<void*> data_ptrs;
+    for(int i=0; i < 64; i++)
+    {
+        nodes.emplace_back();
+        nodes.back()["values"].set(DataType::float64(16));
+        nodes.back()["child/id"] = i;
+        data_ptrs.push_back(nodes.back()["values"].data_ptr());
+    }
+
+    for(size_t i=0; i < nodes.size(); i++)
+    {
+        EXPECT_EQ(nodes[i]["values"].data_ptr(),data_ptrs[i]);
+        EXPECT_EQ(nodes[i]["child"].parent(),&nodes[i]);
+        EXPECT_EQ(nodes[i]["child/id"].to_int64(),(int64)i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move_and_swap, schema_and_dtype_move)
+{
+    Schema s_src;
+    s_src["a/b"].set(DataType::int32());
+    s_src["a/c"].set(DataType::float64());
+    Schema *s_child_ptr = s_src.fetch_ptr("a");
+
+    Schema s_dest(std::move(s_src));
+    EXPECT_TRUE(s_src.dtype().is_empty());
+    EXPECT_EQ(s_dest.fetch_ptr("a"),s_child_ptr);
+    EXPECT_EQ(s_dest["a"].parent(),&s_dest);
+    EXPECT_TRUE(s_dest["a/c"].dtype().is_float64());
+
+    Schema s_assign(DataType::int64());
+    s_assign = std::move(s_dest);
+    EXPECT_TRUE(s_dest.dtype().is_empty());
+    EXPECT_EQ(s_assign.fetch_ptr("a"),s_child_ptr);
+    EXPECT_EQ(s_assign["a"].parent(),&s_assign);
+
+    DataType dt_src = DataType::float32(10);
+    DataType dt_dest(std::move(dt_src));
+    EXPECT_TRUE(dt_dest.is_float32());
+    EXPECT_EQ(dt_dest.number_of_elements(),10);
+    dt_src = std::move(dt_dest);
+    EXPECT_TRUE(dt_src.is_float32());
+}
@@ -13,9 +13,11 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <sstream>
 #include "gtest/gtest.h"
 
 using namespace conduit;
+using namespace conduit::utils;
 
 //-----------------------------------------------------------------------------
 TEST(conduit_node_paths, simple_path)
@@ -115,3 +117,100 @@ TEST(conduit_node_paths, path_empty_slashes)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, pre_parsed_path)
+{
+    Path p("/fields//pressure/values");
+    EXPECT_EQ(p.number_of_segments(),3);
+    EXPECT_EQ(p.segment(0),"fields");
+    EXPECT_EQ(p.segment(2),"values");
+    EXPECT_EQ(p.to_string(),"fields/pressure/values");
+    EXPECT_THROW(p.segment(3),conduit::Error);
+
+    Node n;
+    EXPECT_FALSE(n.has_path(p));
+    EXPECT_THROW(n.fetch_existing(p),conduit::Error);
+
+    // non-const fetch creates the path
+    n.fetch(p).set(DataType::float64(10));
+    EXPECT_TRUE(n.has_path(p));
+    EXPECT_TRUE(n.has_path("fields/pressure/values"));
+    EXPECT_EQ(&n.fetch_existing(p),&n["fields/pressure/values"]);
+
+    n["fields/energy/values"].set(DataType::float64(10));
+    Path p_e("fields/energy/values");
+    const Node &n_const = n;
+    EXPECT_EQ(&n_const.fetch(p_e),&n["fields/energy/values"]);
+    EXPECT_EQ(&n_const.fetch_existing(p_e),&n["fields/energy/values"]);
+
+    // the cached child index must not be trusted if the tree changes
+    n["fields"].remove("pressure");
+    EXPECT_TRUE(n.has_path(p_e));
+    EXPECT_EQ(&n.fetch_existing(p_e),&n["fields/energy/values"]);
+    EXPECT_FALSE(n.has_path(p));
+    n["fields"].rename_child("energy","pressure");
+    Path p_p("fields/pressure/values");
+    EXPECT_FALSE(n.has_path(p_e));
+    EXPECT_EQ(&n.fetch_existing(p_p),&n["fields/pressure/values"]);
+
+    // parent paths
+    Path p_parent("../pressure/values");
+    EXPECT_EQ(&n["fields/pressure"].fetch_existing(p_parent),
+              &n["fields/pressure/values"]);
+    Path p_root_parent("../a");
+    EXPECT_THROW(n.fetch_existing(p_root_parent),conduit::Error);
+
+    // leaves don't have children
+    Path p_leaf_child("fields/pressure/values/bad");
+    EXPECT_FALSE(n.has_path(p_leaf_child));
+    EXPECT_THROW(n.fetch_existing(p_leaf_child),conduit::Error);
+
+    // empty paths
+    Path p_empty("///");
+    EXPECT_TRUE(p_empty.is_empty());
+    EXPECT_FALSE(n.has_path(p_empty));
+    EXPECT_THROW(n.fetch(p_empty),conduit::Error);
+    EXPECT_THROW(n.fetch_existing(p_empty),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, pre_parsed_path_timing)
+{
+    index_t ndoms = 100;
+    index_t nreps = 100;
+
+    Node n;
+    for(index_t i=0; i < ndoms; i++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << i << "/fields/pressure/values";
+        n[oss.str()].set(DataType::float64(1));
+    }
+
+    std::string spath = "fields/pressure/values";
+    Path ppath(spath);
+
+    Timer t_str;
+    for(index_t r=0; r < nreps; r++)
+    {
+        for(index_t i=0; i < ndoms; i++)
+        {
+            n.child(i).fetch_existing(spath);
+        }
+    }
+    float t_str_val = t_str.elapsed();
+
+    Timer t_path;
+    for(index_t r=0; r < nreps; r++)
+    {
+        for(index_t i=0; i < ndoms; i++)
+        {
+            n.child(i).fetch_existing(ppath);
+        }
+    }
+    float t_path_val = t_path.elapsed();
+
+    std::cout << "fetch_existing(std::string): " << t_str_val << std::endl;
+    std::cout << "fetch_existing(Path):        " << t_path_val << std::endl;
+}
@@ -466,3 +466,258 @@ TEST(conduit_node_save_load, load_save_array)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, pack_round_trip)
+{
+    Node n;
+    n["a/int32"] = (int32) 42;
+    n["a/str"] = "my string";
+    n["b/vals"].set(DataType::float64(17));
+    float64 *vals = n["b/vals"].value();
+    for(int i=0; i < 17; i++)
+    {
+        vals[i] = i * 1.5;
+    }
+    n["c/list"].append() = (int8) -1;
+    n["c/list"].append() = (uint64) 3;
+    n["c/empty"];
+    // strided (non compact) leaf
+    int32 strided[8] = {1,-1,2,-1,3,-1,4,-1};
+    n["d/strided"].set_external(DataType::int32(4,0,2*sizeof(int32)),strided);
+
+    std::string fname = "tout_node_save_load_pack_round_trip.conduit_pack";
+    n.save(fname);
+
+    EXPECT_TRUE(pack::is_pack_file(fname));
+    EXPECT_FALSE(pack::is_pack_file("tout_node_save_load_pack_missing"));
+
+    Node n_load, info;
+    n_load.load(fname);
+    n_load.print();
+
+    EXPECT_FALSE(n.diff(n_load,info,0.0));
+    // strided leaves are stored compactly
+    EXPECT_EQ(n_load["d/strided"].dtype().stride(),
+              n_load["d/strided"].dtype().element_bytes());
+    EXPECT_EQ(n_load["d/strided"].as_int32_ptr()[3],4);
+
+    // header details
+    Node about;
+    pack::about(fname,about);
+    about.print();
+    EXPECT_EQ(about["version"].to_int64(),1);
+    EXPECT_EQ(about["schema/offset"].to_int64(),64);
+    EXPECT_EQ(about["data/offset"].to_int64() % pack::PACK_ALIGNMENT,0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, pack_sub_path)
+{
+    Node n;
+    n["a/b/x"] = (int64) 10;
+    n["a/b/y"].set(DataType::float32(5));
+    n["a/c"] = "c string";
+    n["list"].append() = (int16) 1;
+    n["list"].append()["z"] = (int16) 2;
+
+    std::string fname = "tout_node_save_load_pack_sub_path.conduit_pack";
+    n.save(fname);
+
+    Node n_sub, info;
+    pack::load(fname,"a/b",n_sub);
+    EXPECT_FALSE(n["a/b"].diff(n_sub,info,0.0));
+    // only the bytes for this sub path are read
+    EXPECT_EQ(n_sub.total_bytes_allocated(),
+              pack::PACK_ALIGNMENT + n["a/b/y"].dtype().bytes_compact());
+
+    pack::load(fname,"a/c",n_sub);
+    EXPECT_EQ(n_sub.as_string(),"c string");
+
+    pack::load(fname,"list/1/z",n_sub);
+    EXPECT_EQ(n_sub.to_int64(),2);
+
+    // leading and repeated slashes are ignored, as with string paths
+    pack::load(fname,"/a//b/x",n_sub);
+    EXPECT_EQ(n_sub.to_int64(),10);
+
+    EXPECT_THROW(pack::load(fname,"a/missing",n_sub),conduit::Error);
+    EXPECT_THROW(pack::load(fname,"list/5",n_sub),conduit::Error);
+    EXPECT_THROW(pack::load(fname,"list/bad",n_sub),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, pack_mmap)
+{
+    Node n;
+    n["a"].set(DataType::int64(100));
+    n["b"].set(DataType::float64(33));
+    n["c/d"] = (uint8) 7;
+    int64 *a_vals = n["a"].value();
+    for(int i=0; i < 100; i++)
+    {
+        a_vals[i] = i;
+    }
+
+    std::string fname = "tout_node_save_load_pack_mmap.conduit_pack";
+    n.save(fname);
+
+    Node n_mmap, info;
+    n_mmap.mmap(fname);
+    EXPECT_FALSE(n.diff(n_mmap,info,0.0));
+
+    // leaves are 64 byte aligned in the file, and the mapping
+    // starts at a page boundary
+    NodeConstIterator itr = n_mmap.children();
+    while(itr.has_next())
+    {
+        const Node &chld = itr.next();
+        if(chld.dtype().is_number())
+        {
+            EXPECT_EQ(((uint64)chld.element_ptr(0)) % pack::PACK_ALIGNMENT,
+                      (uint64)0);
+        }
+    }
+
+    // changes to the mmap are written to the file
+    n_mmap["a"].as_int64_ptr()[5] = -5;
+    n_mmap.reset();
+
+    Node n_load;
+    n_load.load(fname);
+    EXPECT_EQ(n_load["a"].as_int64_ptr()[5],-5);
+    EXPECT_EQ(n_load["c/d"].to_int64(),7);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, mmap_lazy)
+{
+    Node n;
+    for(int i=0; i < 10; i++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << i;
+        Node &dom = n[oss.str()];
+        dom["id"] = (int64) i;
+        dom["fields/u"].set(DataType::float64(50));
+        float64 *u_vals = dom["fields/u"].value();
+        for(int j=0; j < 50; j++)
+        {
+            u_vals[j] = i * 100.0 + j;
+        }
+        dom["list"].append() = (int32) i;
+        dom["list"].append() = (int32) -i;
+    }
+
+    std::string fname = "tout_node_save_load_mmap_lazy.conduit_pack";
+    n.save(fname);
+    std::string fname_bin = "tout_node_save_load_mmap_lazy.conduit_bin";
+    n.save(fname_bin);
+
+    const char *advice[] = {"normal", "sequential", "random", "willneed"};
+    for(int i=0; i < 4; i++)
+    {
+        Node opts;
+        opts["lazy"] = "true";
+        opts["advice"] = advice[i];
+
+        // fetch a few leaves
+        Node n_mmap;
+        n_mmap.mmap(fname,opts);
+        EXPECT_EQ(n_mmap.number_of_children(),10);
+        EXPECT_EQ(n_mmap["domain_7/fields/u"].as_float64_ptr()[3],703.0);
+        EXPECT_EQ(n_mmap.fetch_existing(Path("domain_3/id")).to_int64(),3);
+        EXPECT_EQ(n_mmap["domain_5/list"][1].to_int32(),-5);
+        EXPECT_TRUE(n_mmap.has_path(Path("domain_2/fields/u")));
+        EXPECT_EQ(n_mmap.total_bytes_mmaped(),n_mmap.mmaped_bytes());
+
+        // full traversal
+        Node info;
+        EXPECT_FALSE(n.diff(n_mmap,info,0.0));
+
+        Node n_mmap_bin;
+        n_mmap_bin.mmap(fname_bin,opts);
+        const Node &n_mmap_bin_c = n_mmap_bin;
+        NodeConstIterator itr = n_mmap_bin_c.children();
+        index_t count = 0;
+        while(itr.has_next())
+        {
+            const Node &dom = itr.next();
+            EXPECT_EQ(dom["id"].to_int64(),count);
+            count++;
+        }
+        EXPECT_EQ(count,10);
+
+        // printing visits every node
+        Node n_lazy_json;
+        n_lazy_json.mmap(fname,opts);
+        EXPECT_EQ(n_lazy_json.to_json(),n.to_json());
+    }
+
+    // lazy mmaps can be changed
+    Node opts;
+    opts["lazy"] = 1;
+    Node n_mmap;
+    n_mmap.mmap(fname,opts);
+    n_mmap["domain_1/fields/u"].as_float64_ptr()[0] = -1.0;
+    n_mmap["domain_0/new_child"] = (int32) 10;
+    n_mmap.remove("domain_9");
+    EXPECT_EQ(n_mmap.number_of_children(),9);
+    EXPECT_EQ(n_mmap["domain_0/new_child"].to_int32(),10);
+
+    // children of moved nodes are still created on demand
+    Node n_moved;
+    n_moved.move(n_mmap["domain_2"]);
+    EXPECT_EQ(n_moved["fields/u"].as_float64_ptr()[1],201.0);
+
+    Node n_copy;
+    n_copy.set(n_mmap["domain_3"]);
+    EXPECT_EQ(n_copy["id"].to_int64(),3);
+    n_mmap.reset();
+
+    Node n_load;
+    n_load.load(fname);
+    EXPECT_EQ(n_load["domain_1/fields/u"].as_float64_ptr()[0],-1.0);
+
+    opts["advice"] = "bad";
+    EXPECT_THROW(n_mmap.mmap(fname,opts),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, pack_memory)
+{
+    Node n;
+    n["a/b"].set(DataType::float64(5));
+    n["a/c"] = "string value";
+    n["list"].append() = (int32) 3;
+    float64 *b_vals = n["a/b"].value();
+    for(int i=0;i<5;i++)
+    {
+        b_vals[i] = i * 1.5;
+    }
+
+    index_t nbytes = pack::packed_bytes(n);
+
+    // the buffer holds the same bytes as a pack file
+    std::string fname = "tout_node_save_load_pack_memory.conduit_pack";
+    pack::save(n,fname);
+    EXPECT_EQ(utils::file_size(fname),nbytes);
+
+    std::vector<uint8> buff((size_t)nbytes);
+    pack::save(n,&buff[0],nbytes);
+
+    Schema s;
+    pack::load_schema(&buff[0],nbytes,s);
+    Node n_view, info;
+    n_view.set_external(s,&buff[0]);
+    EXPECT_FALSE(n.diff(n_view,info));
+
+    Node n_file;
+    n_file.load(fname);
+    EXPECT_FALSE(n_file.diff(n_view,info));
+
+    EXPECT_THROW(pack::save(n,&buff[0],nbytes - 1),conduit::Error);
+    EXPECT_THROW(pack::load_schema(&buff[0],nbytes / 2,s),conduit::Error);
+    buff[0] = 'X';
+    EXPECT_THROW(pack::load_schema(&buff[0],nbytes,s),conduit::Error);
+}
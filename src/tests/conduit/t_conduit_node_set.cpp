@@ -11,6 +11,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <vector>
 #include "gtest/gtest.h"
 #include "rapidjson/document.h"
 using namespace conduit;
@@ -7049,3 +7050,95 @@ TEST(conduit_node, node_set_with_offset)
     EXPECT_EQ(av2[2],2.0);
 
 }
+
+//-----------------------------------------------------------------------------
+static int owned_free_count = 0;
+
+static void
+owned_free(void *data)
+{
+    owned_free_count++;
+    free(data);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, node_set_owned)
+{
+    owned_free_count = 0;
+    float64 *vals = (float64*)malloc(4 * sizeof(float64));
+    for(int i = 0; i < 4; i++)
+    {
+        vals[i] = i + 0.5;
+    }
+
+    Node n;
+    n["a"].set_owned(vals, DataType::float64(4), owned_free);
+    EXPECT_EQ(n["a"].data_ptr(), (void*)vals);
+    EXPECT_FALSE(n["a"].is_data_external());
+    EXPECT_EQ(n["a"].as_float64_ptr()[3], 3.5);
+
+    // writes don't copy an adopted buffer
+    n["a"].as_float64_ptr()[0] = 42.0;
+    EXPECT_EQ(n["a"].data_ptr(), (void*)vals);
+    EXPECT_EQ(vals[0], 42.0);
+
+    // copy-on-write shares it, the last reference frees it
+    Node n_cow;
+    n_cow.set_cow(n);
+    const Node &n_cow_a = n_cow["a"];
+    EXPECT_TRUE(n_cow_a.is_data_shared());
+    EXPECT_EQ(n_cow_a.element_ptr(0), (const void*)vals);
+    n.reset();
+    EXPECT_EQ(owned_free_count, 0);
+    EXPECT_EQ(n_cow_a.as_float64_ptr()[0], 42.0);
+    n_cow.reset();
+    EXPECT_EQ(owned_free_count, 1);
+
+    // leaf types only, the buffer is freed on error
+    void *obj = malloc(8);
+    EXPECT_THROW(n.set_owned(obj, DataType::object(), owned_free),
+                 conduit::Error);
+    EXPECT_EQ(owned_free_count, 2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, node_set_vector_move)
+{
+    std::vector<float64> vals(100, 2.0);
+    const float64 *vals_ptr = &vals[0];
+
+    Node n;
+    n["a"].set(std::move(vals));
+    EXPECT_TRUE(vals.empty());
+    EXPECT_TRUE(n["a"].dtype().is_float64());
+    EXPECT_EQ(n["a"].dtype().number_of_elements(), 100);
+    EXPECT_EQ(n["a"].as_float64_ptr(), vals_ptr);
+    EXPECT_EQ(n["a"].as_float64_array()[99], 2.0);
+
+    // c-native types
+    std::vector<int> ivals(3, 7);
+    n["b"].set(std::move(ivals));
+    EXPECT_EQ(n["b"].dtype().id(), DataType::c_int().id());
+    EXPECT_EQ(n["b"].to_int64(), 7);
+
+    std::vector<uint8> empty;
+    n["c"].set(std::move(empty));
+    EXPECT_EQ(n["c"].dtype().number_of_elements(), 0);
+
+    // lvalues are still copied
+    std::vector<float64> copied(10, 1.0);
+    n["d"].set(copied);
+    EXPECT_EQ(copied.size(), (size_t)10);
+    EXPECT_NE(n["d"].as_float64_ptr(), &copied[0]);
+
+    // compatible sets write into the adopted buffer
+    n["a"].set(std::vector<float64>(100, 3.0));
+    n["a"].set(DataType::float64(100));
+    EXPECT_EQ(n["a"].as_float64_array()[0], 3.0);
+
+    // copies of the node are regular allocations
+    Node n_copy(n);
+    EXPECT_FALSE(n_copy["a"].is_data_shared());
+    EXPECT_EQ(n_copy["a"].as_float64_array()[99], 3.0);
+    n.reset();
+}
@@ -11,6 +11,7 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <vector>
 #include "gtest/gtest.h"
 #include "rapidjson/document.h"
 using namespace conduit;
@@ -116,3 +117,71 @@ TEST(conduit_node_to_array, dynamic_type_to_vector)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_to_array, strided_and_large)
+{
+    // interleaved int32 pairs, convert only the first of each pair
+    const index_t num_eles = (1 << 20) + 37;
+    std::vector<int32> vals((size_t)(2 * num_eles));
+    for(index_t i = 0; i < 2 * num_eles; i++)
+    {
+        vals[(size_t)i] = (int32)(i - num_eles);
+    }
+
+    Node n;
+    n.set_external(DataType::int32(num_eles, 0, 2 * sizeof(int32)),
+                   &vals[0]);
+
+    Node res;
+    n.to_int64_array(res);
+    int64_array res_vals = res.value();
+    ASSERT_EQ(res_vals.number_of_elements(), num_eles);
+    for(index_t i = 0; i < num_eles; i += 4099)
+    {
+        EXPECT_EQ(res_vals[i], (int64)(2 * i - num_eles));
+    }
+    EXPECT_EQ(res_vals[num_eles - 1], (int64)(num_eles - 2));
+
+    // float64 to float32 and back
+    Node n_f64;
+    n_f64.set(DataType::float64(1000));
+    float64 *f64_vals = n_f64.value();
+    for(int i = 0; i < 1000; i++)
+    {
+        f64_vals[i] = 0.5 * i;
+    }
+    Node n_f32;
+    n_f64.to_data_type(DataType::FLOAT32_ID, n_f32);
+    EXPECT_EQ(n_f32.as_float32_array()[999], 499.5f);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_to_array, utils_convert)
+{
+    std::vector<int32> conn(10);
+    for(int i = 0; i < 10; i++)
+    {
+        conn[(size_t)i] = i * 3;
+    }
+    int32_array src(&conn[0], DataType::int32(10));
+
+    std::vector<index_t> dst_vals(12, -1);
+    index_t_array dst(&dst_vals[0], DataType::index_t(12));
+    utils::convert(src, dst);
+    EXPECT_EQ(dst_vals[0], 0);
+    EXPECT_EQ(dst_vals[9], 27);
+    // extra dest elements are untouched
+    EXPECT_EQ(dst_vals[10], -1);
+
+    // strided dest: every other float64
+    std::vector<float64> xy(20, 0.0);
+    float64_array x(&xy[0], DataType::float64(10, 0, 2 * sizeof(float64)));
+    utils::convert(src, x);
+    EXPECT_EQ(xy[2], 3.0);
+    EXPECT_EQ(xy[3], 0.0);
+
+    // dest too small
+    index_t_array small_dst(&dst_vals[0], DataType::index_t(4));
+    EXPECT_THROW(utils::convert(src, small_dst), conduit::Error);
+}
@@ -243,3 +243,90 @@ int main(int argc, char* argv[])
 
 
 
+
+//-----------------------------------------------------------------------------
+// -- functors for conduit::dispatch
+struct SumValues
+{
+    index_t  nele;
+    float64 &res;
+
+    template <typename T>
+    void operator()(const T *vals) const
+    {
+        for(index_t i=0; i < nele; i++)
+        {
+            res += (float64) vals[i];
+        }
+    }
+};
+
+struct FillValues
+{
+    index_t nele;
+
+    template <typename T>
+    void operator()(T *vals) const
+    {
+        for(index_t i=0; i < nele; i++)
+        {
+            vals[i] = (T) i;
+        }
+    }
+};
+
+struct CopyValues
+{
+    index_t nele;
+
+    template <typename A, typename B>
+    void operator()(const A *src, B *dest) const
+    {
+        for(index_t i=0; i < nele; i++)
+        {
+            dest[i] = (B) src[i];
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, dispatch_utility)
+{
+    const DataType dtypes[] = {DataType::int8(10),
+                               DataType::uint16(10),
+                               DataType::int32(10),
+                               DataType::uint64(10),
+                               DataType::float32(10),
+                               DataType::float64(10)};
+    for(const DataType &dt : dtypes)
+    {
+        Node n(dt);
+        dispatch(n, FillValues{10});
+
+        float64 res = 0;
+        const Node &n_const = n;
+        dispatch(n_const, SumValues{10, res});
+        EXPECT_EQ(res, 45.0) << dt.name();
+
+        res = 0;
+        dispatch(n.dtype(), n.data_ptr(), SumValues{10, res});
+        EXPECT_EQ(res, 45.0) << dt.name();
+
+        // convert to every other type
+        for(const DataType &dest_dt : dtypes)
+        {
+            Node dest(dest_dt);
+            dispatch2(n_const, dest, CopyValues{10});
+            EXPECT_EQ(dest.as_float64_accessor()[9], 9.0)
+                << dt.name() << " -> " << dest_dt.name();
+        }
+    }
+
+    // non-numeric types are an error
+    Node n;
+    n.set("text");
+    float64 res = 0;
+    EXPECT_THROW(dispatch(n, SumValues{1, res}), conduit::Error);
+    Node empty;
+    EXPECT_THROW(dispatch(empty, SumValues{1, res}), conduit::Error);
+}
@@ -240,3 +240,62 @@ TEST(conduit_node_update, update_external)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_update, update_contiguous)
+{
+    Node n_src;
+    n_src["a"].set(DataType::float64(10));
+    n_src["b/c"].set(DataType::int32(5));
+    n_src["b/d"].set(DataType::uint8(3));
+    n_src["e"].append().set_int64(7);
+
+    float64_array a_vals = n_src["a"].value();
+    for(index_t i=0; i < 10; i++)
+    {
+        a_vals[i] = i * 1.5;
+    }
+    n_src["b/c"].as_int32_array().fill(-3);
+    n_src["b/d"].as_uint8_array().fill(9);
+
+    Node n_src_c;
+    n_src.compact_to(n_src_c);
+    EXPECT_TRUE(n_src_c.is_contiguous());
+
+    // same layout, both contiguous
+    Node n_dest;
+    n_src_c.compact_to(n_dest);
+    n_dest["a"].as_float64_array().fill(0.0);
+    n_dest["b/c"].as_int32_array().fill(0);
+    n_dest["e"][0].set_int64(0);
+
+    void *dest_ptr = n_dest.contiguous_data_ptr();
+    n_dest.update(n_src_c);
+    EXPECT_EQ(dest_ptr,n_dest.contiguous_data_ptr());
+
+    Node info;
+    EXPECT_FALSE(n_src_c.diff(n_dest,info));
+
+    n_dest["e"][0].set_int64(0);
+    n_dest.update_compatible(n_src_c);
+    EXPECT_EQ(n_dest["e"][0].as_int64(),7);
+
+    // dest with striding holes, holes must be preserved
+    float64 strided_vals[20];
+    for(index_t i=0; i < 20; i++)
+    {
+        strided_vals[i] = -1.0;
+    }
+    Node n_strided;
+    n_strided["a"].set_external(DataType::float64(10,0,2*sizeof(float64)),
+                                strided_vals);
+    Node n_src_a;
+    n_src_a["a"].set_external(n_src_c["a"]);
+    n_strided.update(n_src_a);
+
+    for(index_t i=0; i < 10; i++)
+    {
+        EXPECT_EQ(strided_vals[2*i],i * 1.5);
+        EXPECT_EQ(strided_vals[2*i+1],-1.0);
+    }
+}
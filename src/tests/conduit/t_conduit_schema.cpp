@@ -11,10 +11,13 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <map>
+#include <sstream>
 #include "gtest/gtest.h"
 
 
 using namespace conduit;
+using namespace conduit::utils;
 
 
 //-----------------------------------------------------------------------------
@@ -425,6 +428,368 @@ TEST(schema_basics, schema_to_string)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(schema_basics, many_children)
+{
+    // exercise objects large enough to use the hashed child index
+    Schema s;
+    index_t nchld = 1000;
+    for(index_t i=0; i < nchld; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        s[oss.str()].set(DataType::float64(10));
+    }
+
+    EXPECT_EQ(s.number_of_children(),nchld);
+    EXPECT_EQ(s.child_index("field_0"),0);
+    EXPECT_EQ(s.child_index("field_999"),999);
+    EXPECT_TRUE(s.has_child("field_500"));
+    EXPECT_FALSE(s.has_child("field_1000"));
+    EXPECT_THROW(s.child_index("field_1000"),conduit::Error);
+
+    // child names keep insertion order
+    EXPECT_EQ(s.child_name(42),"field_42");
+
+    // remove shifts the indices of later children
+    s.remove_child("field_10");
+    EXPECT_EQ(s.number_of_children(),nchld-1);
+    EXPECT_FALSE(s.has_child("field_10"));
+    EXPECT_EQ(s.child_index("field_11"),10);
+    EXPECT_EQ(s.child_index("field_999"),998);
+    s.remove(0);
+    EXPECT_FALSE(s.has_child("field_0"));
+    EXPECT_EQ(s.child_index("field_1"),0);
+
+    // rename
+    s.rename_child("field_500","renamed");
+    EXPECT_FALSE(s.has_child("field_500"));
+    EXPECT_EQ(s.child_name(s.child_index("renamed")),"renamed");
+    EXPECT_EQ(s.child_index("renamed"),498);
+
+    // copies and comparisons
+    Schema s2(s);
+    EXPECT_TRUE(s.equals(s2));
+    EXPECT_TRUE(s.compatible(s2));
+    EXPECT_EQ(s2.child_index("renamed"),498);
+    s2["extra"].set(DataType::int32());
+    EXPECT_FALSE(s.equals(s2));
+    EXPECT_TRUE(s2.compatible(s));
+
+    // shrink back below the hash threshold
+    while(s.number_of_children() > 4)
+    {
+        s.remove(1);
+    }
+    EXPECT_EQ(s.child_index("field_1"),0);
+    EXPECT_TRUE(s.has_child("field_999"));
+    EXPECT_EQ(s.child_index("field_999"),3);
+    EXPECT_FALSE(s.has_child("renamed"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, many_children_fetch_timing)
+{
+    // compare child lookup against a std::map name to index baseline
+    index_t nchld = 10000;
+    index_t nreps = 20;
+
+    std::vector<std::string> names;
+    std::map<std::string,index_t> map_baseline;
+    Schema s;
+    for(index_t i=0; i < nchld; i++)
+    {
+        std::ostringstream oss;
+        oss << "zone_field_" << i;
+        names.push_back(oss.str());
+        map_baseline[oss.str()] = i;
+        s[oss.str()].set(DataType::float64(1));
+    }
+
+    index_t chk_map = 0;
+    Timer t_map;
+    for(index_t r=0; r < nreps; r++)
+    {
+        for(index_t i=0; i < nchld; i++)
+        {
+            chk_map += map_baseline.find(names[(size_t)i])->second;
+        }
+    }
+    float t_map_val = t_map.elapsed();
+
+    index_t chk_schema = 0;
+    Timer t_schema;
+    for(index_t r=0; r < nreps; r++)
+    {
+        for(index_t i=0; i < nchld; i++)
+        {
+            chk_schema += s.child_index(names[(size_t)i]);
+        }
+    }
+    float t_schema_val = t_schema.elapsed();
+
+    Timer t_fetch;
+    for(index_t r=0; r < nreps; r++)
+    {
+        for(index_t i=0; i < nchld; i++)
+        {
+            s.fetch_existing(names[(size_t)i]);
+        }
+    }
+    float t_fetch_val = t_fetch.elapsed();
+
+    EXPECT_EQ(chk_map,chk_schema);
+
+    std::cout << "lookups:                " << nchld * nreps << std::endl;
+    std::cout << "std::map baseline:      " << t_map_val << std::endl;
+    std::cout << "Schema::child_index:    " << t_schema_val << std::endl;
+    std::cout << "Schema::fetch_existing: " << t_fetch_val << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, serialize_binary)
+{
+    Schema s;
+    s["a/b"].set(DataType::int32(10,8,8));
+    s["a/c"].set(DataType::float64(3,
+                                   200,
+                                   16,
+                                   8,
+                                   Endianness::BIG_ID));
+    s["a/empty"];
+    s["name with spaces"].set(DataType::char8_str(12));
+    s["list"].append().set(DataType::uint8(2));
+    s["list"].append()["x"].set(DataType::int64());
+    s["list"].append();
+
+    std::vector<uint8> sbin;
+    s.serialize_binary(sbin);
+
+    Schema s_res;
+    s_res.deserialize_binary(sbin);
+    s_res.print();
+
+    EXPECT_TRUE(s.equals(s_res));
+    EXPECT_EQ(s_res["a/b"].dtype().offset(),8);
+    EXPECT_EQ(s_res["a/c"].dtype().stride(),16);
+    EXPECT_EQ(s_res["a/c"].dtype().endianness(),(index_t)Endianness::BIG_ID);
+    EXPECT_TRUE(s_res["a/empty"].dtype().is_empty());
+    EXPECT_EQ(s_res["list"].number_of_children(),3);
+    EXPECT_EQ(s_res["list"][1].parent(),s_res.fetch_ptr("list"));
+
+    // the binary encoding is much smaller than json
+    std::cout << "json bytes:   " << s.to_json().size() << std::endl;
+    std::cout << "binary bytes: " << sbin.size() << std::endl;
+    EXPECT_LT(sbin.size(),s.to_json().size());
+
+    // leaf and empty cases
+    Schema s_leaf(DataType::float32(7)), s_empty;
+    sbin.clear();
+    s_leaf.serialize_binary(sbin);
+    s_res.deserialize_binary(sbin);
+    EXPECT_TRUE(s_leaf.equals(s_res));
+
+    sbin.clear();
+    s_empty.serialize_binary(sbin);
+    s_res.deserialize_binary(sbin);
+    EXPECT_TRUE(s_res.dtype().is_empty());
+
+    // truncated and oversized buffers are errors
+    sbin.clear();
+    s.serialize_binary(sbin);
+    EXPECT_THROW(s_res.deserialize_binary(&sbin[0],(index_t)sbin.size()-1),
+                 conduit::Error);
+    sbin.push_back(0);
+    EXPECT_THROW(s_res.deserialize_binary(sbin),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, structural_hash)
+{
+    // the same layout at different offsets
+    Schema s_a, s_b;
+    s_a["x"].set(DataType::float64(10,0));
+    s_a["y"].set(DataType::float64(10,80));
+    s_a["m/conn"].set(DataType::int32(30,160));
+    s_b["x"].set(DataType::float64(10,1000));
+    s_b["y"].set(DataType::float64(10,1080));
+    s_b["m/conn"].set(DataType::int32(30,1160));
+
+    EXPECT_TRUE(s_a.equals_structure(s_b));
+    EXPECT_EQ(s_a.structural_hash(),s_b.structural_hash());
+    EXPECT_FALSE(s_a.equals(s_b));
+
+    // relative placement matters
+    Schema s_c(s_b);
+    s_c["y"].dtype().set_offset(1088);
+    EXPECT_FALSE(s_a.equals_structure(s_c));
+    EXPECT_NE(s_a.structural_hash(),s_c.structural_hash());
+
+    // names matter
+    Schema s_d;
+    s_d["x"].set(DataType::float64(10,0));
+    s_d["z"].set(DataType::float64(10,80));
+    s_d["m/conn"].set(DataType::int32(30,160));
+    EXPECT_FALSE(s_a.equals_structure(s_d));
+    EXPECT_NE(s_a.structural_hash(),s_d.structural_hash());
+
+    // dtypes matter
+    Schema s_e(s_a);
+    s_e["m/conn"].set(DataType::int64(30,160));
+    EXPECT_FALSE(s_a.equals_structure(s_e));
+
+    // lists vs objects
+    Schema s_l;
+    s_l.append().set(DataType::float64(10,0));
+    Schema s_o;
+    s_o["a"].set(DataType::float64(10,0));
+    EXPECT_FALSE(s_l.equals_structure(s_o));
+    EXPECT_NE(s_l.structural_hash(),s_o.structural_hash());
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, serialize_binary_dedup)
+{
+    // many domains with the same layout
+    Node n;
+    for(int i=0; i < 64; i++)
+    {
+        Node &dom = n.append();
+        dom["coordsets/coords/type"] = "explicit";
+        dom["coordsets/coords/values/x"].set(DataType::float64(100));
+        dom["coordsets/coords/values/y"].set(DataType::float64(100));
+        dom["topologies/mesh/elements/connectivity"].set(DataType::int32(400));
+        dom["fields/u/values"].set(DataType::float64(100));
+    }
+    n[10]["fields/v/values"].set(DataType::float32(100));
+
+    Schema s_compact;
+    n.schema().compact_to(s_compact);
+
+    std::vector<uint8> sbin, sbin_dedup;
+    s_compact.serialize_binary(sbin);
+    s_compact.serialize_binary(sbin_dedup,true);
+    std::cout << "binary bytes: " << sbin.size() << std::endl;
+    std::cout << "dedup bytes:  " << sbin_dedup.size() << std::endl;
+    EXPECT_LT(sbin_dedup.size() * 10,sbin.size());
+
+    Schema s_res;
+    s_res.deserialize_binary(sbin_dedup);
+    EXPECT_TRUE(s_compact.equals(s_res));
+    EXPECT_EQ(s_res[63]["fields/u/values"].dtype().offset(),
+              s_compact[63]["fields/u/values"].dtype().offset());
+    EXPECT_TRUE(s_res[10].has_path("fields/v/values"));
+    EXPECT_FALSE(s_res[11].has_path("fields/v"));
+    EXPECT_EQ(s_res[5]["coordsets"].parent(),s_res.child_ptr(5));
+
+    // non-compact layouts
+    Schema s_ext;
+    for(int i=0; i < 8; i++)
+    {
+        Schema &dom = s_ext.append();
+        dom["a"].set(DataType::float64(4,i * 1000));
+        dom["b"].set(DataType::float64(4,i * 1000 + 64,16));
+        dom["c/d"].set(DataType::int8(3,i * 1000 + 200));
+    }
+    sbin_dedup.clear();
+    s_ext.serialize_binary(sbin_dedup,true);
+    s_res.deserialize_binary(sbin_dedup);
+    EXPECT_TRUE(s_ext.equals(s_res));
+
+    // invalid references are errors
+    std::vector<uint8> sbad;
+    sbad.push_back(Schema::BINARY_REF_ID);
+    uint64 ref_vals[2] = {3, 0};
+    sbad.insert(sbad.end(),
+                (uint8*)&ref_vals[0],
+                (uint8*)&ref_vals[0] + sizeof(ref_vals));
+    EXPECT_THROW(s_res.deserialize_binary(sbad),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, parse_cache)
+{
+    EXPECT_EQ(Schema::parse_cache_size(),0);
+
+    Schema s_src;
+    s_src["a"].set(DataType::float64(10));
+    s_src["b/c"].set(DataType::int32(5,80));
+    std::string json = s_src.to_json();
+    std::vector<uint8> sbin;
+    s_src.serialize_binary(sbin);
+
+    index_t hits = 0;
+    index_t misses = 0;
+
+    // disabled by default
+    Schema s_res;
+    s_res.set(json);
+    Schema s_json_ref(json);
+    Schema::parse_cache_stats(hits,misses);
+    EXPECT_EQ(hits,0);
+    EXPECT_EQ(misses,0);
+
+    Schema::set_parse_cache_size(2);
+    EXPECT_EQ(Schema::parse_cache_size(),2);
+
+    for(int i=0; i < 3; i++)
+    {
+        Schema s_json(json);
+        EXPECT_TRUE(s_json_ref.equals(s_json));
+        Schema s_bin;
+        s_bin.deserialize_binary(sbin);
+        EXPECT_TRUE(s_src.equals(s_bin));
+    }
+    Schema::parse_cache_stats(hits,misses);
+    EXPECT_EQ(hits,4);
+    EXPECT_EQ(misses,2);
+
+    // cached schemas can be set into children
+    s_res.reset();
+    s_res["child"].set(json);
+    EXPECT_TRUE(s_json_ref.equals(s_res["child"]));
+    EXPECT_EQ(s_res["child/b"].parent(),s_res.child_ptr(0));
+
+    // changing the result does not change the cached schema
+    s_res["child/a"].set(DataType::int8(1));
+    Schema s_again(json);
+    EXPECT_TRUE(s_json_ref.equals(s_again));
+
+    // the least recently used entry is evicted
+    Schema s_other;
+    s_other["x"].set(DataType::uint8(3));
+    s_res.set(s_other.to_json());
+    s_res.deserialize_binary(sbin);
+    Schema::parse_cache_stats(hits,misses);
+    index_t prev_misses = misses;
+    s_res.set(json);
+    Schema::parse_cache_stats(hits,misses);
+    EXPECT_EQ(misses,prev_misses + 1);
+
+    // parse errors are not cached
+    EXPECT_THROW(s_res.set("{\"a\": bad"),conduit::Error);
+    EXPECT_THROW(s_res.set("{\"a\": bad"),conduit::Error);
+
+    // Node::load of conduit_bin uses the cache for its json schema
+    Node n;
+    n["a"].set(DataType::float64(10));
+    n["b"] = 42;
+    n.save("tout_schema_parse_cache.conduit_bin");
+    Schema::clear_parse_cache();
+    Node n_load;
+    n_load.load("tout_schema_parse_cache.conduit_bin");
+    n_load.load("tout_schema_parse_cache.conduit_bin");
+    EXPECT_EQ(n_load["b"].to_int(),42);
+    Schema::parse_cache_stats(hits,misses);
+    EXPECT_EQ(hits,1);
+    EXPECT_EQ(misses,1);
+
+    Schema::set_parse_cache_size(0);
+    EXPECT_EQ(Schema::parse_cache_size(),0);
+    Schema::parse_cache_stats(hits,misses);
+    EXPECT_EQ(hits,0);
+}
+
 //-----------------------------------------------------------------------------
 ///
 /// commented out b/c spanned_bytes is now private, 
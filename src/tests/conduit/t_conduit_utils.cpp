@@ -426,6 +426,108 @@ TEST(conduit_utils, base64_enc_dec)
     EXPECT_EQ(n_src["c"].as_int32(), n_res["c"].as_int32());
 }
 
+//-----------------------------------------------------------------------------
+std::string
+base64_encode_to_string(const std::vector<uint8> &src)
+{
+    index_t enc_buff_size = utils::base64_encode_buffer_size((index_t)src.size());
+    std::vector<char> enc_buff((size_t)enc_buff_size);
+    utils::base64_encode(src.empty() ? NULL : &src[0],
+                         (index_t)src.size(),
+                         &enc_buff[0]);
+    return std::string(&enc_buff[0]);
+}
+
+//-----------------------------------------------------------------------------
+std::vector<uint8>
+base64_decode_to_vector(const std::string &src, index_t nbytes)
+{
+    index_t dec_buff_size = utils::base64_decode_buffer_size((index_t)src.size());
+    std::vector<uint8> dec_buff((size_t)dec_buff_size,0);
+    utils::base64_decode(src.c_str(),(index_t)src.size(),&dec_buff[0]);
+    dec_buff.resize((size_t)nbytes);
+    return dec_buff;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_enc_dec_sizes)
+{
+    // known values
+    const char *txts[] = {"", "M", "Ma", "Man", "Many hands make light work."};
+    const char *encs[] = {"", "TQ==", "TWE=", "TWFu",
+                          "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu"};
+    for(int i=0; i < 5; i++)
+    {
+        std::string txt(txts[i]);
+        std::vector<uint8> src(txt.begin(),txt.end());
+        EXPECT_EQ(base64_encode_to_string(src),std::string(encs[i]));
+    }
+
+    // cover the simd block sizes and tails, using all byte values
+    for(index_t nbytes = 0; nbytes < 300; nbytes++)
+    {
+        std::vector<uint8> src((size_t)nbytes);
+        for(index_t i=0; i < nbytes; i++)
+        {
+            src[(size_t)i] = (uint8)((i * 37 + nbytes) % 256);
+        }
+
+        std::string enc = base64_encode_to_string(src);
+        EXPECT_EQ((index_t)enc.size(),((nbytes + 2) / 3) * 4);
+        EXPECT_EQ(base64_decode_to_vector(enc,nbytes),src);
+
+        // the stream encoder creates the same text
+        std::ostringstream oss;
+        utils::base64_encode_stream(src.empty() ? NULL : &src[0],
+                                    nbytes,
+                                    oss);
+        EXPECT_EQ(oss.str(),enc);
+
+        // the bounded decode writes exactly the requested bytes
+        for(index_t dest_nbytes = std::max((index_t)0, nbytes - 4);
+            dest_nbytes <= nbytes;
+            dest_nbytes++)
+        {
+            std::vector<uint8> dest((size_t)dest_nbytes + 8, 0xAB);
+            index_t written = utils::base64_decode(enc.c_str(),
+                                                   (index_t)enc.size(),
+                                                   &dest[0],
+                                                   dest_nbytes);
+            EXPECT_EQ(written,dest_nbytes);
+            EXPECT_TRUE(std::equal(dest.begin(),
+                                   dest.begin() + (size_t)dest_nbytes,
+                                   src.begin()));
+            EXPECT_EQ(dest[(size_t)dest_nbytes],0xAB);
+        }
+
+        // chars outside of the alphabet are skipped
+        if(enc.size() > 40)
+        {
+            std::string enc_nl = enc.substr(0,40) + "\n" + enc.substr(40);
+            EXPECT_EQ(base64_decode_to_vector(enc_nl,nbytes),src);
+            std::vector<uint8> dest((size_t)nbytes + 8, 0xAB);
+            EXPECT_EQ(utils::base64_decode(enc_nl.c_str(),
+                                           (index_t)enc_nl.size(),
+                                           &dest[0],
+                                           nbytes),nbytes);
+            EXPECT_TRUE(std::equal(src.begin(),src.end(),dest.begin()));
+            EXPECT_EQ(dest[(size_t)nbytes],0xAB);
+        }
+    }
+
+    // large buffer, spans multiple stream chunks
+    std::vector<uint8> src(1000003);
+    for(size_t i=0; i < src.size(); i++)
+    {
+        src[i] = (uint8)((i * 131) % 251);
+    }
+    std::string enc = base64_encode_to_string(src);
+    std::ostringstream oss;
+    utils::base64_encode_stream(&src[0],(index_t)src.size(),oss);
+    EXPECT_EQ(oss.str(),enc);
+    EXPECT_EQ(base64_decode_to_vector(enc,(index_t)src.size()),src);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_utils, dir_create_and_remove_tests)
 {
@@ -280,6 +280,38 @@ class Test_Relay_IO_Handle(unittest.TestCase):
             with self.assertRaises(IOError):
                 h.read(node=n_read,options=opts)
 
+    def test_io_handle_cache(self):
+        test_file = "tout_python_relay_io_handle_cache.yaml"
+        if os.path.isfile(test_file):
+            os.remove(test_file)
+
+        n = conduit.Node()
+        n["a"] = int64(20)
+        n["d/here"] = int64(10)
+
+        opts = conduit.Node()
+        opts["cache/max_bytes"] = 1024 * 1024
+        h = conduit.relay.io.IOHandle()
+        h.open(test_file,options=opts)
+        h.write(n)
+        for i in range(3):
+            self.assertTrue(h.has_path("d/here"))
+            n_read = conduit.Node()
+            h.read(path="a",node=n_read)
+            self.assertEqual(n_read.value(),20)
+        info = conduit.Node()
+        h.cache_info(info)
+        print(info)
+        self.assertEqual(info["enabled"],"true")
+        self.assertEqual(info["read/hits"],2)
+        self.assertEqual(info["read/misses"],1)
+        h.close()
+
+        h.open(test_file)
+        h.cache_info(info)
+        self.assertEqual(info["enabled"],"false")
+        h.close()
+
 
 
 if __name__ == '__main__':
@@ -9,6 +9,7 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_relay.hpp"
+#include "conduit_relay_io_adios.hpp"
 #include "conduit_error.hpp"
 #include <iostream>
 #include <cmath>
@@ -626,6 +627,110 @@ TEST(conduit_relay_io_adios, test_time_series)
     delete [] out;
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_adios, test_load_selected_steps_domains)
+{
+    std::string path("test_load_selected_steps_domains.bp");
+
+    // Remove the file if it exists.
+    remove_path_if_exists(path);
+
+    // Write 3 steps of 2 domains each.
+    int nts = 3;
+    for(int ts = 0; ts < nts; ++ts)
+    {
+        for(int dom = 0; dom < 2; ++dom)
+        {
+            Node n;
+            n["domain"] = dom;
+            n["fields/a/values"] = ts * 10 + dom;
+            n["fields/b/values"] = ts * 100 + dom;
+            if(dom == 0)
+                relay::io::add_step(n, path);
+            else
+                relay::io::save_merged(n, path);
+        }
+    }
+
+    // Read field a of domain 1 at steps 0 and 2.
+    Node opts, in;
+    opts["steps"].set(DataType::c_int(2));
+    int *steps = opts["steps"].value();
+    steps[0] = 0;
+    steps[1] = 2;
+    opts["domains"] = 1;
+    opts["fields"] = "a";
+    relay::io::adios_load(path, opts, in);
+    in.print();
+
+    EXPECT_EQ(in.number_of_children(), 2);
+    EXPECT_EQ(in["step_000000/domain_000001/fields/a/values"].to_int(), 1);
+    EXPECT_EQ(in["step_000002/domain_000001/fields/a/values"].to_int(), 21);
+    EXPECT_EQ(in["step_000002/domain_000001/domain"].to_int(), 1);
+    EXPECT_FALSE(in["step_000000/domain_000001"].has_path("fields/b"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_adios, test_time_series_changing_layout)
+{
+    std::string path("test_time_series_changing_layout.bp"), protocol("adios");
+
+    // Remove the file if it exists.
+    utils::remove_path_if_exists(path);
+
+    // Steps 0,1 share a layout, step 2 adds a variable and step 3 resizes
+    // an array, which forces the step group to be defined again.
+    int nts = 4;
+    Node *out = new Node[nts];
+    for(int ts = 0; ts < nts; ++ts)
+    {
+        Node &n = out[ts];
+        n["a"] = ts + 1;
+        std::vector<double> v((ts < 3) ? 10 : 20, double(ts));
+        n["v"] = v;
+        if(ts >= 2)
+            n["c/d"] = float(ts) * 0.5f;
+
+        relay::io::add_step(n, path);
+
+        int qnts = relay::io::query_number_of_steps(path);
+        EXPECT_EQ(qnts, ts+1);
+    }
+
+    for(int ts = 0; ts < nts; ++ts)
+    {
+        Node in;
+        int domain = 0;
+        relay::io::load(path, protocol, ts, domain, in);
+        Node n_info;
+        EXPECT_FALSE(in.diff(out[ts],n_info,0.0));
+    }
+
+    delete [] out;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_adios, test_opts_parameters_node)
+{
+    Node orig;
+    relay::io::adios_options(orig);
+
+    Node opts;
+    opts["write/transport_options"] = "verbose=3";
+    opts["read/parameters/max_chunk_size"] = "1024";
+    opts["read/parameters/verbose"] = 3;
+    relay::io::adios_set_options(opts);
+
+    Node current;
+    relay::io::adios_options(current);
+    EXPECT_EQ(current["write/transport_options"].as_string(),
+              std::string("verbose=3"));
+    EXPECT_EQ(current["read/parameters"].as_string(),
+              std::string("max_chunk_size=1024;verbose=3"));
+
+    relay::io::adios_set_options(orig);
+}
+
 TEST(conduit_relay_io_adios, test_node_path)
 {
     std::string path("test_node_path.bp");
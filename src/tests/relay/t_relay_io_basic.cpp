@@ -10,6 +10,8 @@
 
 #include "conduit_relay.hpp"
 #include <iostream>
+#include <atomic>
+#include <thread>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -173,6 +175,14 @@ TEST(conduit_relay_io_basic, identify_protocol)
 
     io::identify_protocol("test.adios",protocol);
     EXPECT_EQ(protocol,"adios");
+
+    // conduit pack check
+    io::identify_protocol("test.conduit_pack",protocol);
+    EXPECT_EQ(protocol,"conduit_pack");
+
+    // block compressed conduit_bin check
+    io::identify_protocol("test.conduit_bin_zlib",protocol);
+    EXPECT_EQ(protocol,"conduit_bin_zlib");
 }
 
 
@@ -217,6 +227,10 @@ TEST(conduit_relay_io_basic, identify_file_type)
     io::identify_file_type("tout_identify_ftype.yaml",protocol);
     EXPECT_EQ(protocol,"yaml");
 
+    n.save("tout_identify_ftype.conduit_pack");
+    io::identify_file_type("tout_identify_ftype.conduit_pack",protocol);
+    EXPECT_EQ(protocol,"conduit_pack");
+
     Node io_protos;
     relay::io::about(io_protos["io"]);
     bool hdf5_enabled = io_protos["io/protocols/hdf5"].as_string() == "enabled";
@@ -232,10 +246,90 @@ TEST(conduit_relay_io_basic, identify_file_type)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_basic, identify_file_types)
+{
+    Node n;
+    n["answer/is"] = 42;
+
+    std::vector<std::string> paths;
+    std::vector<std::string> expected;
+
+    n.save("tout_identify_ftypes.json");
+    paths.push_back("tout_identify_ftypes.json");
+    expected.push_back("json");
+
+    n.save("tout_identify_ftypes.yaml");
+    paths.push_back("tout_identify_ftypes.yaml");
+    expected.push_back("yaml");
+
+    n.save("tout_identify_ftypes.conduit_pack");
+    paths.push_back("tout_identify_ftypes.conduit_pack");
+    expected.push_back("conduit_pack");
+
+    remove_path_if_exists("tout_identify_ftypes_missing.json");
+    paths.push_back("tout_identify_ftypes_missing.json");
+    expected.push_back("unknown");
+
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    if(io_protos["io/protocols/hdf5"].as_string() == "enabled")
+    {
+        io::save(n,"tout_identify_ftypes.hdf5");
+        paths.push_back("tout_identify_ftypes.hdf5");
+        expected.push_back("hdf5");
+    }
+
+    // the same files many times, to run on several threads
+    std::vector<std::string> many_paths;
+    std::vector<std::string> many_expected;
+    for(int i = 0; i < 20; i++)
+    {
+        many_paths.insert(many_paths.end(), paths.begin(), paths.end());
+        many_expected.insert(many_expected.end(),
+                             expected.begin(),
+                             expected.end());
+    }
+
+    io::clear_file_type_cache();
+    std::vector<std::string> res;
+    io::identify_file_types(many_paths, res, 4);
+    EXPECT_EQ(res, many_expected);
+
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        std::string file_type;
+        io::identify_file_type(paths[i], file_type);
+        EXPECT_EQ(file_type, expected[i]);
+    }
+
+    // cached results are refreshed when a file changes
+    io::identify_file_types(paths, res);
+    EXPECT_EQ(res, expected);
+    remove_path_if_exists("tout_identify_ftypes.yaml");
+    n.save("tout_identify_ftypes.yaml", "json");
+    io::identify_file_types(paths, res, 1);
+    EXPECT_EQ(res[1], "json");
+
+    std::vector<std::string> protocols;
+    io::identify_protocols(paths, protocols);
+    ASSERT_EQ(protocols.size(), paths.size());
+    EXPECT_EQ(protocols[0], "json");
+    EXPECT_EQ(protocols[2], "conduit_pack");
+
+    std::vector<int> counts;
+    io::query_number_of_domains(paths, counts);
+    EXPECT_EQ(counts, std::vector<int>(paths.size(), 1));
+    io::query_number_of_steps(paths, counts);
+    EXPECT_EQ(counts, std::vector<int>(paths.size(), 1));
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_basic, save_load_subpath)
 {
     std::vector<std::string> protos = { "conduit_bin",
+                                        "conduit_pack",
                                         "json",
                                         "conduit_json",
                                         "conduit_base64_json",
@@ -262,6 +356,7 @@ TEST(conduit_relay_io_basic, save_load_subpath)
 TEST(conduit_relay_io_basic, save_merged_load_merged_subpath)
 {
     std::vector<std::string> protos = { "conduit_bin",
+                                        "conduit_pack",
                                         "json",
                                         "conduit_json",
                                         "conduit_base64_json",
@@ -289,9 +384,315 @@ TEST(conduit_relay_io_basic, save_merged_load_merged_subpath)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_basic, save_merged_load_merged_in_place)
+{
+    std::vector<std::string> protos = { "conduit_bin",
+                                        "conduit_pack"};
+    for(size_t i=0;i<protos.size();i++)
+    {
+        std::string ofile = "tout_conduit_relay_io_merged_in_place." +
+                            protos[i];
+        Node n;
+        n["a"].set(DataType::float64(100));
+        n["b/c"].set(DataType::int32(10));
+        n["l"].append() = 1.0;
+        float64_array a_vals = n["a"].value();
+        int32_array c_vals = n["b/c"].value();
+        for(index_t j=0;j<100;j++)
+        {
+            a_vals[j] = (float64) j;
+        }
+        for(index_t j=0;j<10;j++)
+        {
+            c_vals[j] = (int32) j;
+        }
+        io::save(n, ofile);
+        index_t file_size = utils::file_size(ofile);
+
+        // update leaves that already exist
+        Node n_upd;
+        n_upd["a"].set(DataType::float64(50));
+        float64_array upd_vals = n_upd["a"].value();
+        upd_vals.fill(-1.0);
+        io::save_merged(n_upd, ofile);
+        EXPECT_EQ(utils::file_size(ofile), file_size);
+
+        Node n_load, info;
+        io::load(ofile, n_load);
+        float64_array load_vals = n_load["a"].value();
+        EXPECT_EQ(load_vals.number_of_elements(), 100);
+        EXPECT_EQ(load_vals[49], -1.0);
+        EXPECT_EQ(load_vals[50], 50.0);
+        EXPECT_FALSE(n["b"].diff(n_load["b"],info));
+
+        // load_merged reads into existing compatible leaves
+        Node n_dest;
+        n_dest["b/c"].set(DataType::int32(10));
+        n_dest["b/extra"] = 7;
+        const void *c_ptr = n_dest["b/c"].data_ptr();
+        io::load_merged(ofile + ":b", n_dest["b"]);
+        EXPECT_EQ(n_dest["b/c"].data_ptr(), c_ptr);
+        EXPECT_FALSE(n["b/c"].diff(n_dest["b/c"],info));
+        EXPECT_EQ(n_dest["b/extra"].to_int64(), 7);
+        EXPECT_EQ(n_dest["b/c"].hash(), n["b/c"].hash());
+
+        io::load_merged(ofile, n_dest);
+        EXPECT_EQ(n_dest["b/c"].data_ptr(), c_ptr);
+        EXPECT_EQ(n_dest["a"].dtype().number_of_elements(), 100);
+        EXPECT_EQ(n_dest["l"].number_of_children(), 1);
+
+        // new and incompatible leaves
+        Node n_new;
+        n_new["b/d"] = "new field";
+        n_new["b/c"].set(DataType::float32(4));
+        n_new["l"].append() = 1.0;
+        n_new["l"].append() = 2.0;
+        io::save_merged(n_new, ofile + ":sub");
+        io::save_merged(n_new, ofile);
+
+        io::load(ofile, n_load);
+        EXPECT_EQ(n_load["b/d"].as_string(), "new field");
+        EXPECT_EQ(n_load["b/c"].dtype().id(), DataType::FLOAT32_ID);
+        EXPECT_EQ(n_load["l"].number_of_children(), 2);
+        EXPECT_EQ(n_load["sub/b/d"].as_string(), "new field");
+        EXPECT_EQ(n_load["sub/l"].number_of_children(), 2);
+        load_vals = n_load["a"].value();
+        EXPECT_EQ(load_vals[0], -1.0);
+        EXPECT_EQ(load_vals[99], 99.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_basic, save_incremental)
+{
+    std::vector<std::string> protos = { "conduit_bin",
+                                        "conduit_json",
+                                        "conduit_base64_json",
+                                        "conduit_pack"};
+
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    if(io_protos["io/protocols/hdf5"].as_string() == "enabled")
+    {
+        protos.push_back("hdf5");
+    }
+
+    for(size_t i=0;i<protos.size();i++)
+    {
+        std::string obase = "tout_conduit_relay_io_incremental_";
+        std::string ofile_0 = obase + "0." + protos[i];
+        std::string ofile_1 = obase + "1." + protos[i];
+        std::string ofile_2 = obase + "2." + protos[i];
+
+        Node n;
+        n["state/a"].set(DataType::float64(1000));
+        n["state/b"].set(DataType::int32(10000));
+        n["state/l"].append() = 1.0;
+        n["state/l"].append() = "two";
+        n["state/empty"].set(DataType::object());
+        n["name"] = "sim";
+        n["state/a"].as_float64_array().fill(1.0);
+        n["state/b"].as_int32_array().fill(2);
+
+        // a plain checkpoint can be a base
+        io::save(n, ofile_0);
+
+        n["state/a"].as_float64_array()[10] = -1.0;
+        io::save_incremental(n, ofile_1, ofile_0);
+        EXPECT_LT(utils::file_size(ofile_1), utils::file_size(ofile_0));
+
+        // only the changed leaf and the index are in the file
+        Node n_raw, opts, info;
+        opts["incremental/resolve"] = "false";
+        io::load(ofile_1, opts, n_raw);
+        EXPECT_TRUE(n_raw.has_path("state/a"));
+        EXPECT_FALSE(n_raw.has_path("state/b"));
+        EXPECT_FALSE(n_raw.has_path("name"));
+        EXPECT_TRUE(n_raw.has_path("_conduit_delta"));
+
+        // load reassembles the full tree, in order
+        Node n_load;
+        io::load(ofile_1, n_load);
+        EXPECT_FALSE(n.diff(n_load, info));
+        EXPECT_EQ(n.to_json(), n_load.to_json());
+
+        // unchanged leaves refer to the file that holds them
+        n["state/b"].as_int32_array()[0] = 7;
+        n["state/new"] = 42;
+        n.remove("name");
+        io::save_incremental(n, ofile_2, ofile_1);
+        io::load(ofile_2, opts, n_raw);
+        EXPECT_FALSE(n_raw.has_path("state/a"));
+        EXPECT_TRUE(n_raw.has_path("state/b"));
+        EXPECT_TRUE(n_raw.has_path("state/new"));
+        EXPECT_EQ(n_raw["_conduit_delta/files"].number_of_children(), 2);
+
+        io::load(ofile_2, n_load);
+        EXPECT_FALSE(n.diff(n_load, info));
+        EXPECT_EQ(n.to_json(), n_load.to_json());
+
+        // without a base, all leaves are written
+        io::save_incremental(n, ofile_0, "");
+        io::load(ofile_0, opts, n_raw);
+        EXPECT_TRUE(n_raw.has_path("state/a"));
+        EXPECT_FALSE(n_raw["_conduit_delta"].has_child("files"));
+        io::load(ofile_0, n_load);
+        EXPECT_FALSE(n.diff(n_load, info));
+    }
+
+    Node n_leaf;
+    n_leaf = 1.0;
+    EXPECT_THROW(io::save_incremental(n_leaf,
+                                      "tout_conduit_relay_io_incremental_leaf.json",
+                                      ""),
+                 conduit::Error);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_basic, save_empty)
 {
     Node n;
     io::save(n, "test_conduit_relay_io_save_empty.conduit_bin");
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_basic, conduit_bin_zlib)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    if(io_protos["io/protocols/conduit_bin_zlib"].as_string() == "disabled")
+    {
+        CONDUIT_INFO("zlib support disabled, skipping conduit_bin_zlib test");
+        return;
+    }
+
+    Node n;
+    n["a"].set(DataType::float64(10000));
+    n["b"].set(DataType::int32(5000));
+    n["c/d"] = "here";
+    float64_array a_vals = n["a"].value();
+    int32_array b_vals = n["b"].value();
+    for(index_t i=0;i<10000;i++)
+    {
+        a_vals[i] = i * 0.5;
+    }
+    for(index_t i=0;i<5000;i++)
+    {
+        b_vals[i] = (int32) (i % 7);
+    }
+
+    // small blocks, so leaves span several of them
+    Node opts;
+    opts["block_size"] = 4096;
+    opts["threads"] = 4;
+    std::string ofile = "tout_conduit_relay_io_bin_zlib.conduit_bin_zlib";
+    io::save(n,ofile,"",opts);
+
+    // the data is compressed
+    EXPECT_LT(utils::file_size(ofile),n.total_bytes_compact());
+
+    Node n_load, info;
+    io::load(ofile,n_load);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    // sub path loads only decompress the blocks they span
+    io::load(ofile + ":b",n_load);
+    EXPECT_FALSE(n["b"].diff(n_load,info));
+
+    io::load(ofile + ":c",n_load);
+    EXPECT_FALSE(n["c"].diff(n_load,info));
+
+    // empty node
+    Node n_empty;
+    io::save(n_empty,"tout_conduit_relay_io_bin_zlib_empty.conduit_bin_zlib");
+    io::load("tout_conduit_relay_io_bin_zlib_empty.conduit_bin_zlib",n_load);
+    EXPECT_TRUE(n_load.dtype().is_empty());
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_basic, concurrent_save_load)
+{
+    std::vector<std::string> protos = { "conduit_bin",
+                                        "json",
+                                        "yaml"};
+
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    if(io_protos["io/protocols/hdf5"].as_string() == "enabled")
+    {
+        protos.push_back("hdf5");
+    }
+
+    // each thread saves and loads its own files with every protocol, and
+    // reads them back through its own handle
+    const int num_threads = 8;
+    const int num_iters   = 10;
+    std::atomic<int> num_failed(0);
+
+    // hdf5 filters small chunks on threads of its own, outside of the
+    // lock relay holds while it calls hdf5
+    Node opts;
+    opts["hdf5/chunking/threshold"] = 1024;
+    opts["hdf5/chunking/chunk_size"] = 1024;
+    opts["hdf5/chunking/compression/num_threads"] = 2;
+
+    auto work = [&](int tid)
+    {
+        try
+        {
+            Node n, n_load, info;
+            n["a"].set(DataType::float64(1000));
+            n["b/c"] = (int64) tid;
+            n["b/d"] = "thread";
+            float64_array a_vals = n["a"].value();
+            for(index_t i = 0; i < 1000; i++)
+            {
+                a_vals[i] = tid * 1000.0 + i;
+            }
+
+            for(int iter = 0; iter < num_iters; iter++)
+            {
+                for(size_t p = 0; p < protos.size(); p++)
+                {
+                    std::string ofile = "tout_relay_io_concurrent_" +
+                                        std::to_string(tid) + "." +
+                                        protos[p];
+                    io::save(n, ofile, protos[p], opts);
+                    io::load(ofile, protos[p], opts, n_load);
+                    if(n.diff(n_load, info))
+                    {
+                        num_failed++;
+                    }
+
+                    io::IOHandle h;
+                    h.open(ofile, protos[p]);
+                    h.read("b/c", n_load);
+                    if(n_load.to_int() != tid)
+                    {
+                        num_failed++;
+                    }
+                    h.close();
+                }
+            }
+        }
+        catch(conduit::Error &e)
+        {
+            std::cout << e.message() << std::endl;
+            num_failed++;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < num_threads; t++)
+    {
+        threads.push_back(std::thread(work, t));
+    }
+    for(size_t t = 0; t < threads.size(); t++)
+    {
+        threads[t].join();
+    }
+
+    EXPECT_EQ(num_failed.load(), 0);
+}
@@ -827,3 +827,523 @@ TEST(conduit_relay_io_handle, test_ref_path_error_msg)
     }
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_write_async)
+{
+    std::string tfile_base = "tout_conduit_relay_io_handle_async.";
+    std::vector<std::string> protocols;
+
+    protocols.push_back("conduit_bin");
+    protocols.push_back("yaml");
+
+    Node n_about;
+    io::about(n_about);
+
+    if(n_about["protocols/hdf5"].as_string() == "enabled")
+        protocols.push_back("hdf5");
+
+    for (std::vector<std::string>::const_iterator itr = protocols.begin();
+             itr < protocols.end(); ++itr)
+    {
+        std::string protocol = *itr;
+        CONDUIT_INFO("Testing Relay IO Handle async writes with protocol: "
+                     << protocol );
+        std::string test_file_name = tfile_base  + protocol;
+
+        utils::remove_path_if_exists(test_file_name);
+
+        Node n;
+        n["a"] = (int64) 20;
+        n["fields/vals"].set(DataType::float64(1000));
+        float64_array vals = n["fields/vals"].value();
+        vals.fill(1.5);
+
+        io::IOHandle h;
+        h.open(test_file_name);
+
+        // the copy is taken before write_async returns
+        std::future<void> f_copy = h.write_async(n);
+        vals.fill(-1.0);
+
+        // the referenced node must not change until the write is done
+        Node n_ref;
+        n_ref["step"] = (int64) 2;
+        Node opts;
+        opts["async/snapshot"] = "reference";
+        std::future<void> f_ref = h.write_async(n_ref, "state", opts);
+
+        f_copy.get();
+        f_ref.get();
+
+        // sync methods wait for pending writes
+        std::future<void> f_b = h.write_async(n["a"], "b");
+        EXPECT_TRUE(h.has_path("b"));
+        f_b.get();
+
+        h.close();
+
+        Node n_read;
+        h.open(test_file_name);
+        h.read(n_read);
+        h.close();
+
+        EXPECT_EQ(n_read["a"].to_int64(), 20);
+        EXPECT_EQ(n_read["b"].to_int64(), 20);
+        EXPECT_EQ(n_read["state/step"].to_int64(), 2);
+        float64_array read_vals = n_read["fields/vals"].value();
+        EXPECT_EQ(read_vals[0], 1.5);
+        EXPECT_EQ(read_vals[999], 1.5);
+
+        // close finishes pending writes
+        h.open(test_file_name);
+        h.write_async(n_ref, "final");
+        h.close();
+
+        n_read.reset();
+        h.open(test_file_name);
+        h.read("final/step", n_read);
+        EXPECT_EQ(n_read.to_int64(), 2);
+        h.close();
+    }
+
+    io::IOHandle h;
+    // closed handle, read only handle and bad snapshot errors
+    Node n;
+    n["a"] = 1;
+    EXPECT_THROW(h.write_async(n), conduit::Error);
+
+    std::string tfile = "tout_conduit_relay_io_handle_async_errors.yaml";
+    utils::remove_path_if_exists(tfile);
+    h.open(tfile);
+    Node opts;
+    opts["async/snapshot"] = "bad";
+    EXPECT_THROW(h.write_async(n, opts), conduit::Error);
+    h.write(n);
+    h.close();
+
+    opts.reset();
+    opts["mode"] = "r";
+    h.open(tfile, opts);
+    EXPECT_THROW(h.write_async(n), conduit::Error);
+    h.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_read_cache)
+{
+    std::string tfile_base = "tout_conduit_relay_io_handle_cache.";
+    std::vector<std::string> protocols;
+
+    protocols.push_back("yaml");
+
+    Node n_about;
+    io::about(n_about);
+
+    if(n_about["protocols/hdf5"].as_string() == "enabled")
+        protocols.push_back("hdf5");
+
+    for (std::vector<std::string>::const_iterator itr = protocols.begin();
+             itr < protocols.end(); ++itr)
+    {
+        std::string protocol = *itr;
+        CONDUIT_INFO("Testing Relay IO Handle read cache with protocol: "
+                     << protocol );
+        std::string test_file_name = tfile_base  + protocol;
+
+        utils::remove_path_if_exists(test_file_name);
+
+        Node n;
+        n["a"] = (int64) 20;
+        n["fields/vals"].set(DataType::float64(100));
+        float64_array vals = n["fields/vals"].value();
+        vals.fill(1.5);
+
+        Node opts, info;
+        opts["cache/max_bytes"] = 1024 * 1024;
+
+        io::IOHandle h;
+        h.open(test_file_name, opts);
+        h.write(n);
+
+        // repeated metadata queries and leaf reads are served by the cache
+        std::vector<std::string> names;
+        for(int i = 0; i < 3; i++)
+        {
+            EXPECT_TRUE(h.has_path("fields/vals"));
+            h.list_child_names("fields", names);
+            Node n_read;
+            h.read("fields/vals", n_read);
+            float64_array read_vals = n_read.value();
+            EXPECT_EQ(read_vals.number_of_elements(), 100);
+            EXPECT_EQ(read_vals[99], 1.5);
+        }
+        ASSERT_EQ(names.size(), 1);
+        EXPECT_EQ(names[0], "vals");
+
+        h.cache_info(info);
+        EXPECT_EQ(info["enabled"].as_string(), "true");
+        EXPECT_EQ(info["read/misses"].to_index_t(), 1);
+        EXPECT_EQ(info["read/hits"].to_index_t(), 2);
+        EXPECT_EQ(info["list_child_names/misses"].to_index_t(), 1);
+        EXPECT_EQ(info["list_child_names/hits"].to_index_t(), 2);
+        // one of the has_path hits comes from the read miss checking its path
+        EXPECT_EQ(info["has_path/misses"].to_index_t(), 1);
+        EXPECT_EQ(info["has_path/hits"].to_index_t(), 3);
+
+        // writes invalidate the cache
+        vals.fill(-2.0);
+        h.write(n["fields/vals"], "fields/vals");
+        n["fields/other"] = 1;
+        h.write(n["fields/other"], "fields/other");
+        h.cache_info(info);
+        EXPECT_EQ(info["entries"].to_index_t(), 0);
+
+        Node n_read;
+        h.read("fields/vals", n_read);
+        float64_array read_vals = n_read.value();
+        EXPECT_EQ(read_vals[0], -2.0);
+        h.list_child_names("fields", names);
+        EXPECT_EQ(names.size(), 2);
+
+        // as do removes
+        h.remove("fields/other");
+        EXPECT_FALSE(h.has_path("fields/other"));
+        h.close();
+
+        // a small budget evicts the least recently used results
+        opts["cache/max_bytes"] = 1000;
+        h.open(test_file_name, opts);
+        h.read("fields/vals", n_read);
+        h.read("a", n_read);
+        h.read("fields/vals", n_read);
+        h.cache_info(info);
+        EXPECT_EQ(info["read/hits"].to_index_t(), 0);
+        EXPECT_GT(info["evictions"].to_index_t(), 0);
+        EXPECT_LE(info["bytes"].to_index_t(), 1000);
+        h.close();
+
+        // no cache without the option
+        h.open(test_file_name);
+        h.cache_info(info);
+        EXPECT_EQ(info["enabled"].as_string(), "false");
+        h.close();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_mmap_conduit_bin)
+{
+    std::string test_file_name = "tout_conduit_relay_io_handle_mmap.conduit_bin";
+    utils::remove_path_if_exists(test_file_name);
+    utils::remove_path_if_exists(test_file_name + "_json");
+
+    Node n;
+    n["a"] = (int64) 20;
+    n["fields/vals"].set(DataType::float64(100));
+    float64_array vals = n["fields/vals"].value();
+    vals.fill(1.5);
+
+    Node opts;
+    opts["mmap"] = "true";
+
+    io::IOHandle h;
+    h.open(test_file_name, opts);
+    h.write(n);
+
+    // reads are views into the mapped file
+    Node n_vals;
+    h.read("fields/vals", n_vals);
+    EXPECT_TRUE(n_vals.is_data_external());
+    float64_array view_vals = n_vals.value();
+    EXPECT_EQ(view_vals[99], 1.5);
+
+    // leaves with the same type and size are written in place
+    vals.fill(2.5);
+    h.write(n["fields/vals"], "fields/vals");
+    EXPECT_EQ(view_vals[0], 2.5);
+
+    // new leaves and leaves that change type are appended, earlier
+    // views stay valid
+    Node n_more;
+    n_more.set(DataType::int32(10));
+    h.write(n_more, "fields/more");
+    h.write(n_more, "extra");
+    Node n_a;
+    n_a = (float64) 3.5;
+    h.write(n_a, "a");
+    EXPECT_EQ(view_vals[99], 2.5);
+
+    std::vector<std::string> names;
+    h.list_child_names("fields", names);
+    EXPECT_EQ(names.size(), 2);
+
+    h.remove("extra");
+    EXPECT_FALSE(h.has_path("extra"));
+
+    Node n_read;
+    h.read("a", n_read);
+    EXPECT_EQ(n_read.dtype().id(), DataType::FLOAT64_ID);
+    EXPECT_EQ(n_read.as_float64(), 3.5);
+    h.close();
+
+    // the files are plain conduit_bin files
+    Node n_load;
+    io::load(test_file_name, "conduit_bin", n_load);
+    EXPECT_EQ(n_load["a"].as_float64(), 3.5);
+    EXPECT_EQ(n_load["fields/vals"].dtype().number_of_elements(), 100);
+    EXPECT_EQ(n_load["fields/more"].dtype().number_of_elements(), 10);
+    EXPECT_FALSE(n_load.has_path("extra"));
+    float64_array load_vals = n_load["fields/vals"].value();
+    EXPECT_EQ(load_vals[50], 2.5);
+
+    // read only
+    opts["mode"] = "r";
+    h.open(test_file_name, opts);
+    n_read.reset();
+    h.read(n_read);
+    Node info;
+    EXPECT_FALSE(n_read.diff(n_load, info));
+    h.close();
+
+    // lists can't be written
+    opts["mode"] = "rw";
+    h.open(test_file_name, opts);
+    Node n_list;
+    n_list.append() = 1;
+    EXPECT_THROW(h.write(n_list, "list"), conduit::Error);
+    h.close();
+}
+
+//-----------------------------------------------------------------------------
+// in memory handle used to test protocol registration, files are nodes
+// in a map keyed by path
+//-----------------------------------------------------------------------------
+static std::map<std::string,Node> &
+test_memory_files()
+{
+    static std::map<std::string,Node> files;
+    return files;
+}
+
+//-----------------------------------------------------------------------------
+class TestMemoryHandle: public io::IOHandle::HandleInterface
+{
+public:
+    TestMemoryHandle(const std::string &path,
+                     const std::string &protocol,
+                     const Node &options)
+    : HandleInterface(path,protocol,options),
+      m_open(false)
+    {}
+
+    virtual ~TestMemoryHandle()
+    {
+        close();
+    }
+
+    virtual void open()
+    {
+        HandleInterface::open();
+        if(open_mode_truncate())
+        {
+            file().reset();
+        }
+        m_open = true;
+    }
+
+    virtual bool is_open() const { return m_open; }
+
+    virtual void read(Node &node) { node.set(file()); }
+    virtual void read(Node &node, const Node &) { read(node); }
+    virtual void read(const std::string &path, Node &node)
+        { node.set(file().fetch_existing(path)); }
+    virtual void read(const std::string &path, Node &node, const Node &)
+        { read(path, node); }
+
+    virtual void write(const Node &node) { file().update(node); }
+    virtual void write(const Node &node, const Node &) { write(node); }
+    virtual void write(const Node &node, const std::string &path)
+        { file()[path].update(node); }
+    virtual void write(const Node &node, const std::string &path, const Node &)
+        { write(node, path); }
+
+    virtual void list_child_names(std::vector<std::string> &res)
+        { res = file().child_names(); }
+    virtual void list_child_names(const std::string &path,
+                                  std::vector<std::string> &res)
+        { res = file().fetch_existing(path).child_names(); }
+
+    virtual void remove(const std::string &path) { file().remove(path); }
+    virtual bool has_path(const std::string &path)
+        { return file().has_path(path); }
+    virtual void close() { m_open = false; }
+
+    static HandleInterface *create(const std::string &path,
+                                   const std::string &protocol,
+                                   const Node &options)
+    {
+        return new TestMemoryHandle(path, protocol, options);
+    }
+
+private:
+    Node &file() { return test_memory_files()[path()]; }
+
+    bool m_open;
+};
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_register_protocol)
+{
+    std::vector<std::string> exts;
+    exts.push_back("tmem");
+    io::register_protocol("test_memory", exts, TestMemoryHandle::create);
+
+    EXPECT_TRUE(io::is_registered_protocol("test_memory"));
+    std::string protocol;
+    io::identify_protocol("my_file.tmem", protocol);
+    EXPECT_EQ(protocol, "test_memory");
+
+    Node about;
+    io::about(about);
+    EXPECT_EQ(about["protocols/test_memory"].as_string(), "enabled");
+
+    // IOHandle
+    Node n;
+    n["a/b"] = 10;
+    n["a/c"] = 20.0;
+    io::IOHandle h;
+    h.open("my_file.tmem");
+    h.write(n);
+    EXPECT_TRUE(h.has_path("a/b"));
+    Node n_read;
+    h.read("a/c", n_read);
+    EXPECT_EQ(n_read.to_float64(), 20.0);
+    h.close();
+    EXPECT_TRUE(test_memory_files().count("my_file.tmem") == 1);
+
+    // save and load, with and without sub paths
+    io::save(n, "my_file_2.tmem");
+    Node n_load, info;
+    io::load("my_file_2.tmem", n_load);
+    EXPECT_FALSE(n.diff(n_load, info));
+
+    Node n_sub;
+    n_sub["d"] = 30;
+    io::save(n_sub, "my_file_2.tmem:a/b");
+    io::load("my_file_2.tmem:a/b/d", n_load);
+    EXPECT_EQ(n_load.to_int(), 30);
+
+    io::save_merged(n_sub, "my_file_2.tmem:a");
+    io::load_merged("my_file_2.tmem", n_load);
+    EXPECT_EQ(n_load["a/d"].to_int(), 30);
+    EXPECT_EQ(n_load["a/c"].to_float64(), 20.0);
+
+    // registered protocols take precedence over built-in ones
+    io::register_protocol("json", TestMemoryHandle::create);
+    io::save(n, "my_file_3.json");
+    EXPECT_FALSE(utils::is_file("my_file_3.json"));
+    EXPECT_TRUE(test_memory_files().count("my_file_3.json") == 1);
+
+    io::unregister_protocol("json");
+    io::unregister_protocol("test_memory");
+    EXPECT_FALSE(io::is_registered_protocol("test_memory"));
+    io::identify_protocol("my_file.tmem", protocol);
+    EXPECT_EQ(protocol, "conduit_bin");
+    EXPECT_THROW(h.open("my_file.tmem", "test_memory"), conduit::Error);
+
+    EXPECT_THROW(io::register_protocol("", TestMemoryHandle::create),
+                 conduit::Error);
+    EXPECT_THROW(io::register_protocol("test_memory", NULL),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_shm)
+{
+    Node about;
+    io::about(about);
+    if(about["protocols/conduit_shm"].as_string() == "disabled")
+    {
+        return;
+    }
+
+    std::string name = "tout_conduit_relay_io_handle_shm";
+    io::shm_remove(name);
+    EXPECT_EQ(io::shm_generation(name),0);
+
+    io::ShmSegment seg;
+    EXPECT_FALSE(seg.open(name));
+
+    Node n;
+    n["a/b"].set(DataType::float64(100));
+    n["a/c"] = (int32) 10;
+    float64 *b_vals = n["a/b"].value();
+    for(int i=0;i<100;i++)
+    {
+        b_vals[i] = i;
+    }
+
+    EXPECT_EQ(io::shm_write(n,name),1);
+    EXPECT_EQ(io::shm_generation(name),1);
+
+    // zero copy view of generation 1
+    EXPECT_TRUE(seg.open(name));
+    EXPECT_EQ(seg.generation(),1);
+    Node info;
+    EXPECT_FALSE(n.diff(seg.node(),info));
+    // leaves are mapped with pack alignment
+    EXPECT_EQ(((uint64)seg.node()["a/b"].element_ptr(0)) %
+              conduit::pack::PACK_ALIGNMENT, 0);
+
+    // a new generation, the old mapping stays valid
+    n["a/c"] = (int32) 20;
+    EXPECT_EQ(io::shm_write(n,name),2);
+    EXPECT_NE(io::shm_generation(name),seg.generation());
+    EXPECT_EQ(seg.node()["a/c"].to_int32(),10);
+    EXPECT_EQ(seg.node()["a/b"].as_float64_ptr()[99],99.0);
+    seg.close();
+
+    // IOHandle reads are views of the current generation
+    io::IOHandle h;
+    Node opts;
+    opts["mode"] = "r";
+    h.open(name,"conduit_shm",opts);
+    Node n_read;
+    h.read("a/c",n_read);
+    EXPECT_EQ(n_read.to_int32(),20);
+    EXPECT_TRUE(h.has_path("a/b"));
+    h.close();
+
+    // IOHandle writes are published on close
+    opts["mode"] = "rw";
+    h.open(name,"conduit_shm",opts);
+    Node n_new;
+    n_new = (int64) 42;
+    h.write(n_new,"d");
+    h.remove("a/b");
+    EXPECT_FALSE(h.has_path("a/b"));
+    EXPECT_EQ(io::shm_generation(name),2);
+    h.close();
+    EXPECT_EQ(io::shm_generation(name),3);
+
+    // relay::io save and load
+    std::string protocol;
+    io::identify_protocol(name + ".conduit_shm",protocol);
+    EXPECT_EQ(protocol,"conduit_shm");
+
+    Node n_load;
+    io::load(name,"conduit_shm",n_load);
+    EXPECT_EQ(n_load["d"].to_int64(),42);
+    EXPECT_FALSE(n_load.has_path("a/b"));
+
+    io::save(n,name,"conduit_shm");
+    io::load(name + ":a/c","conduit_shm",n_load);
+    EXPECT_EQ(n_load.to_int32(),20);
+
+    io::shm_remove(name);
+    EXPECT_EQ(io::shm_generation(name),0);
+    opts["mode"] = "r";
+    EXPECT_THROW(h.open(name,"conduit_shm",opts),conduit::Error);
+    EXPECT_THROW(io::shm_write(n,"bad/name"),conduit::Error);
+}
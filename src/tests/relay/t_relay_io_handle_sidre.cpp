@@ -318,3 +318,53 @@ TEST(conduit_relay_io_handle, test_sidre_read_mesh_bp)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_handle, test_sidre_shared_buffers)
+{
+    Node io_protos;
+    relay::io::about(io_protos["io"]);
+    bool hdf5_enabled = io_protos["io/protocols/hdf5"].as_string() == "enabled";
+    if(!hdf5_enabled)
+    {
+        CONDUIT_INFO("HDF5 disabled, skipping sidre shared buffers test");
+        return;
+    }
+
+    std::string tfile = relay_test_data_path("texample_sidre_basic_ds_demo.sidre_hdf5");
+
+    // reference copies
+    io::IOHandle h;
+    h.open(tfile, "sidre_hdf5");
+    Node n_ref;
+    h.read(n_ref);
+    h.close();
+
+    // b_v1 and b_v2 are slices of the same sidre buffer
+    Node opts;
+    opts["sidre/external_views"] = "true";
+    h.open(tfile, "sidre_hdf5", opts);
+
+    Node n_v1, n_v2, n_info;
+    h.read("my_arrays/b_v1",n_v1);
+    h.read("my_arrays/b_v2",n_v2);
+    EXPECT_TRUE(n_v1.is_data_external());
+    EXPECT_TRUE(n_v2.is_data_external());
+    EXPECT_EQ((uint8*)n_v1.element_ptr(0) + sizeof(float64),
+              (uint8*)n_v2.element_ptr(0));
+    EXPECT_FALSE(n_ref["my_arrays/b_v1"].diff(n_v1,n_info));
+    EXPECT_FALSE(n_ref["my_arrays/b_v2"].diff(n_v2,n_info));
+
+    // the subtree reads above cached part of the meta data,
+    // full reads still see everything
+    std::vector<std::string> rchld;
+    h.list_child_names(rchld);
+    EXPECT_EQ(rchld.size(),3);
+    h.list_child_names("my_arrays",rchld);
+    EXPECT_EQ(rchld.size(),6);
+
+    Node n_read;
+    h.read(n_read);
+    EXPECT_FALSE(n_ref.diff(n_read,n_info));
+    h.close();
+}
@@ -1400,6 +1400,777 @@ TEST(conduit_relay_io_hdf5, conduit_hdf5_save_generic_options)
 
 
 
+//-----------------------------------------------------------------------------
+// returns the chunk size of a dataset (0 if not chunked) and its number of
+// filters
+void
+hdf5_dataset_chunking(const std::string &file_path,
+                      const std::string &dset_path,
+                      hsize_t &chunk_size,
+                      int &num_filters)
+{
+    hid_t h5_file_id = io::hdf5_open_file_for_read(file_path);
+    hid_t h5_dset_id = H5Dopen(h5_file_id, dset_path.c_str(), H5P_DEFAULT);
+    hid_t h5_cprops_id = H5Dget_create_plist(h5_dset_id);
+
+    chunk_size = 0;
+    if(H5Pget_layout(h5_cprops_id) == H5D_CHUNKED)
+    {
+        H5Pget_chunk(h5_cprops_id, 1, &chunk_size);
+    }
+    num_filters = H5Pget_nfilters(h5_cprops_id);
+
+    H5Pclose(h5_cprops_id);
+    H5Dclose(h5_dset_id);
+    io::hdf5_close_file(h5_file_id);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_write_per_call_options)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    Node defaults_before;
+    io::hdf5_options(defaults_before);
+
+    Node n;
+    n["a"] = DataType::float64(1000);
+    n["b/x"] = DataType::float64(2500);
+    n["b/y"] = DataType::float64(2500);
+    n["c"] = DataType::float64(2000);
+
+    Node opts;
+    opts["chunking/threshold"]  = 1000;
+    opts["chunking/chunk_size"] = 8000;
+    Node &ovr_b = opts["overrides"].append();
+    ovr_b["path"] = "b";
+    ovr_b["chunking/compression/method"] = "none";
+    Node &ovr_by = opts["overrides"].append();
+    ovr_by["path"] = "b/y";
+    ovr_by["chunking/chunk_size"] = 4000;
+    Node &ovr_c = opts["overrides"].append();
+    ovr_c["path"] = "/c";
+    ovr_c["chunking/enabled"] = "false";
+
+    std::string tout = "tout_hdf5_write_per_call_options.hdf5";
+    utils::remove_path_if_exists(tout);
+    io::hdf5_save(n, tout, opts);
+
+    hsize_t chunk_size = 0;
+    int num_filters = 0;
+
+    // one chunk for the whole dataset, compressed (shuffle + deflate)
+    hdf5_dataset_chunking(tout, "a", chunk_size, num_filters);
+    EXPECT_EQ(chunk_size, 1000);
+    EXPECT_EQ(num_filters, 2);
+
+    // 2500 elements in 3 equal chunks, not compressed
+    hdf5_dataset_chunking(tout, "b/x", chunk_size, num_filters);
+    EXPECT_EQ(chunk_size, 834);
+    EXPECT_EQ(num_filters, 0);
+
+    // 2500 elements in 5 chunks of 500
+    hdf5_dataset_chunking(tout, "b/y", chunk_size, num_filters);
+    EXPECT_EQ(chunk_size, 500);
+    EXPECT_EQ(num_filters, 0);
+
+    // not chunked
+    hdf5_dataset_chunking(tout, "c", chunk_size, num_filters);
+    EXPECT_EQ(chunk_size, 0);
+
+    Node n_read, info;
+    io::hdf5_read(tout, n_read);
+    EXPECT_FALSE(n.diff(n_read, info));
+
+    // the defaults are unchanged
+    Node defaults_after;
+    io::hdf5_options(defaults_after);
+    EXPECT_FALSE(defaults_before.diff(defaults_after, info));
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_io_handle_options)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    Node defaults_before;
+    io::hdf5_options(defaults_before);
+
+    Node n;
+    n["a"] = DataType::float64(1000);
+
+    Node h_opts;
+    h_opts["hdf5/chunking/threshold"]  = 1000;
+    h_opts["hdf5/chunking/chunk_size"] = 4000;
+
+    std::string tout = "tout_hdf5_io_handle_options.hdf5";
+    utils::remove_path_if_exists(tout);
+
+    io::IOHandle h;
+    h.open(tout, "hdf5", h_opts);
+    h.write(n);
+    // per call options take precedence
+    Node w_opts;
+    w_opts["chunking/compression/method"] = "none";
+    h.write(n, "b", w_opts);
+    h.close();
+
+    hsize_t chunk_size = 0;
+    int num_filters = 0;
+    hdf5_dataset_chunking(tout, "a", chunk_size, num_filters);
+    EXPECT_EQ(chunk_size, 500);
+    EXPECT_EQ(num_filters, 2);
+
+    hdf5_dataset_chunking(tout, "b/a", chunk_size, num_filters);
+    EXPECT_EQ(chunk_size, 500);
+    EXPECT_EQ(num_filters, 0);
+
+    Node defaults_after, info;
+    io::hdf5_options(defaults_after);
+    EXPECT_FALSE(defaults_before.diff(defaults_after, info));
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_threaded_compression)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    // 10007 values, split into 11 chunks, the last chunk is partial
+    Node n;
+    n["vals"].set(DataType::float64(10007));
+    float64_array vals = n["vals"].value();
+    for(index_t i = 0; i < vals.number_of_elements(); i++)
+    {
+        vals[i] = (float64)(i % 97) * 0.5;
+    }
+    n["ids"].set(DataType::int32(10007));
+    int32_array ids = n["ids"].value();
+    for(index_t i = 0; i < ids.number_of_elements(); i++)
+    {
+        ids[i] = (int32)(i / 3);
+    }
+
+    Node opts;
+    opts["chunking/threshold"]  = 1000;
+    opts["chunking/chunk_size"] = 8000;
+
+    Node opts_threaded;
+    opts_threaded.set(opts);
+    opts_threaded["chunking/compression/num_threads"] = 4;
+
+    std::string tout_serial   = "tout_hdf5_compression_serial.hdf5";
+    std::string tout_threaded = "tout_hdf5_compression_threaded.hdf5";
+    utils::remove_path_if_exists(tout_serial);
+    utils::remove_path_if_exists(tout_threaded);
+
+    io::hdf5_save(n, tout_serial, opts);
+    io::hdf5_save(n, tout_threaded, opts_threaded);
+
+    // both files hold the same compressed chunks
+    hsize_t chunk_size = 0;
+    int num_filters = 0;
+    hdf5_dataset_chunking(tout_threaded, "vals", chunk_size, num_filters);
+    EXPECT_EQ(chunk_size, 910);
+    EXPECT_EQ(num_filters, 2);
+
+    const std::string dset_names[2] = {"vals", "ids"};
+    for(int i = 0; i < 2; i++)
+    {
+        hsize_t storage_size[2] = {0, 0};
+        const std::string fnames[2] = {tout_serial, tout_threaded};
+        for(int f = 0; f < 2; f++)
+        {
+            hid_t h5_file_id = io::hdf5_open_file_for_read(fnames[f]);
+            hid_t h5_dset_id = H5Dopen(h5_file_id,
+                                       dset_names[i].c_str(),
+                                       H5P_DEFAULT);
+            storage_size[f] = H5Dget_storage_size(h5_dset_id);
+            H5Dclose(h5_dset_id);
+            io::hdf5_close_file(h5_file_id);
+        }
+        EXPECT_EQ(storage_size[0], storage_size[1]);
+        EXPECT_LT(storage_size[1],
+                  (hsize_t) n[dset_names[i]].dtype().bytes_compact());
+    }
+
+    // serial and threaded reads of each file
+    Node read_opts;
+    read_opts["chunking/compression/num_threads"] = 4;
+
+    Node n_read, info;
+    io::hdf5_read(tout_threaded, n_read);
+    EXPECT_FALSE(n.diff(n_read, info));
+
+    n_read.reset();
+    io::hdf5_read(tout_threaded, read_opts, n_read);
+    EXPECT_FALSE(n.diff(n_read, info));
+
+    n_read.reset();
+    io::hdf5_read(tout_serial, read_opts, n_read);
+    EXPECT_FALSE(n.diff(n_read, info));
+
+    // read into existing compatible storage
+    Node n_dest;
+    n_dest["vals"].set(DataType::float64(10007));
+    io::hdf5_read(tout_serial + ":vals", read_opts, n_dest["vals"]);
+    EXPECT_FALSE(n["vals"].diff(n_dest["vals"], info));
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_paged_file_space)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    // many small domains, like a multi domain root file
+    Node n;
+    for(int d = 0; d < 256; d++)
+    {
+        Node &dom = n["domain_" + std::to_string(d)];
+        dom["state/domain_id"] = (int64) d;
+        dom["fields/pressure/values"].set(DataType::float64(16));
+        float64_array vals = dom["fields/pressure/values"].value();
+        vals.fill(d * 0.5);
+        dom["fields/pressure/topology"] = "mesh";
+    }
+
+    Node opts;
+    opts["paged_file_space/enabled"] = "true";
+    opts["paged_file_space/page_size"] = 4096;
+
+    std::string tout_paged = "tout_hdf5_paged_file_space.hdf5";
+    std::string tout_plain = "tout_hdf5_plain_file_space.hdf5";
+    utils::remove_path_if_exists(tout_paged);
+    utils::remove_path_if_exists(tout_plain);
+
+    io::hdf5_save(n, tout_paged, opts);
+    io::hdf5_save(n, tout_plain);
+
+#if H5_VERSION_GE(1, 10, 1)
+    {
+        hid_t h5_file_id = io::hdf5_open_file_for_read(tout_paged);
+        hid_t h5_fc_plist = H5Fget_create_plist(h5_file_id);
+        H5F_fspace_strategy_t strategy;
+        hbool_t persist = 0;
+        hsize_t threshold = 0;
+        hsize_t page_size = 0;
+        H5Pget_file_space_strategy(h5_fc_plist, &strategy, &persist, &threshold);
+        H5Pget_file_space_page_size(h5_fc_plist, &page_size);
+        EXPECT_EQ(strategy, H5F_FSPACE_STRATEGY_PAGE);
+        EXPECT_EQ(page_size, 4096);
+        H5Pclose(h5_fc_plist);
+        io::hdf5_close_file(h5_file_id);
+    }
+#endif
+
+    Node read_opts;
+    read_opts["page_buffer/size"] = 65536;
+    read_opts["metadata_cache/size"] = 4 * 1024 * 1024;
+
+    // paged files use the page buffer, others fall back to plain access
+    Node n_read, info;
+    io::hdf5_read(tout_paged, read_opts, n_read);
+    EXPECT_FALSE(n.diff(n_read, info));
+
+    n_read.reset();
+    io::hdf5_read(tout_plain, read_opts, n_read);
+    EXPECT_FALSE(n.diff(n_read, info));
+
+    // one field of one domain
+    n_read.reset();
+    io::hdf5_read(tout_paged + ":domain_200/fields/pressure/values",
+                  read_opts,
+                  n_read);
+    EXPECT_FALSE(n["domain_200/fields/pressure/values"].diff(n_read, info));
+
+    // handle options are passed when the file is opened
+    Node h_opts;
+    h_opts["hdf5"].set(read_opts);
+    io::IOHandle h;
+    h.open(tout_paged, "hdf5", h_opts);
+    n_read.reset();
+    h.read("domain_7/state", n_read);
+    EXPECT_EQ(n_read["domain_id"].to_int64(), 7);
+    h.close();
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_read_selections)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    std::string tout = "tout_hdf5_read_selections.hdf5";
+    utils::remove_path_if_exists(tout);
+
+    // a 4 x 6 x 5 dataset, value = 100 * i + 10 * j + k
+    const hsize_t dims[3] = {4, 6, 5};
+    std::vector<int32> vals(4 * 6 * 5);
+    for(hsize_t i = 0; i < dims[0]; i++)
+    {
+        for(hsize_t j = 0; j < dims[1]; j++)
+        {
+            for(hsize_t k = 0; k < dims[2]; k++)
+            {
+                vals[(i * dims[1] + j) * dims[2] + k] = (int32)(100 * i + 10 * j + k);
+            }
+        }
+    }
+
+    hid_t h5_file_id = io::hdf5_create_file(tout);
+    hid_t h5_grp_id = H5Gcreate(h5_file_id, "fields",
+                                H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t h5_dspace_id = H5Screate_simple(3, dims, NULL);
+    const char *dset_names[2] = {"a", "b"};
+    for(int d = 0; d < 2; d++)
+    {
+        hid_t h5_dset_id = H5Dcreate(h5_grp_id, dset_names[d], H5T_NATIVE_INT32,
+                                     h5_dspace_id,
+                                     H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Dwrite(h5_dset_id, H5T_NATIVE_INT32, H5S_ALL, H5S_ALL,
+                 H5P_DEFAULT, &vals[0]);
+        H5Dclose(h5_dset_id);
+    }
+    H5Sclose(h5_dspace_id);
+    H5Gclose(h5_grp_id);
+    io::hdf5_close_file(h5_file_id);
+
+    // slab i = 1..2, every other j from 1, k = 3..4
+    Node opts;
+    int64 slab_offset[3] = {1, 1, 3};
+    int64 slab_stride[3] = {1, 2, 1};
+    int64 slab_size[3]   = {2, 3, 2};
+    opts["hyperslab/offset"].set(slab_offset, 3);
+    opts["hyperslab/stride"].set(slab_stride, 3);
+    opts["hyperslab/size"].set(slab_size, 3);
+
+    Node n_read;
+    io::hdf5_read(tout + ":fields/a", opts, n_read);
+    EXPECT_EQ(n_read.dtype().number_of_elements(), 12);
+    int32_array res = n_read.value();
+    EXPECT_EQ(res[0], 113);
+    EXPECT_EQ(res[1], 114);
+    EXPECT_EQ(res[2], 133);
+    EXPECT_EQ(res[11], 254);
+
+    Node n_info;
+    io::hdf5_read_info(tout + ":fields/a", opts, n_info);
+    EXPECT_EQ(n_info["num_elements"].to_index_t(), 12);
+
+    // size defaults to the rest of each dimension
+    opts["hyperslab"].remove("size");
+    n_read.reset();
+    io::hdf5_read(tout + ":fields/a", opts, n_read);
+    EXPECT_EQ(n_read.dtype().number_of_elements(), 3 * 3 * 2);
+
+    // point selection, values come back in the given order
+    Node pt_opts;
+    int64 coords[9] = {3, 5, 4,
+                       0, 0, 0,
+                       2, 1, 3};
+    pt_opts["points"].set(coords, 9);
+    n_read.reset();
+    io::hdf5_read(tout + ":fields/a", pt_opts, n_read);
+    res = n_read.value();
+    EXPECT_EQ(n_read.dtype().number_of_elements(), 3);
+    EXPECT_EQ(res[0], 354);
+    EXPECT_EQ(res[1], 0);
+    EXPECT_EQ(res[2], 213);
+
+    // per leaf selections, relative to the read path
+    Node sel_opts;
+    Node &sel_a = sel_opts["selections"].append();
+    sel_a["path"] = "a";
+    sel_a["points"].set(coords, 3);
+    Node &sel_b = sel_opts["selections"].append();
+    sel_b["path"] = "b";
+    int64 b_offset[3] = {3, 0, 0};
+    sel_b["hyperslab/offset"].set(b_offset, 3);
+
+    n_read.reset();
+    io::hdf5_read(tout + ":fields", sel_opts, n_read);
+    EXPECT_EQ(n_read["a"].dtype().number_of_elements(), 1);
+    EXPECT_EQ(n_read["a"].to_int32(), 354);
+    EXPECT_EQ(n_read["b"].dtype().number_of_elements(), 6 * 5);
+    res = n_read["b"].value();
+    EXPECT_EQ(res[0], 300);
+
+    // the same selections from the root of the file
+    sel_a["path"] = "fields/a";
+    sel_b["path"] = "/fields/b";
+    n_read.reset();
+    io::hdf5_read(tout, sel_opts, n_read);
+    EXPECT_EQ(n_read["fields/a"].to_int32(), 354);
+    EXPECT_EQ(n_read["fields/b"].dtype().number_of_elements(), 6 * 5);
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+
+    // bad selections
+    Node bad_opts;
+    int64 bad_rank[2] = {0, 0};
+    bad_opts["hyperslab/offset"].set(bad_rank, 2);
+    EXPECT_THROW(io::hdf5_read(tout + ":fields/a", bad_opts, n_read),
+                 conduit::Error);
+
+    int64 bad_size[3] = {4, 7, 1};
+    bad_opts.reset();
+    bad_opts["hyperslab/size"].set(bad_size, 3);
+    EXPECT_THROW(io::hdf5_read(tout + ":fields/a", bad_opts, n_read),
+                 conduit::Error);
+
+    int64 bad_point[3] = {4, 0, 0};
+    bad_opts.reset();
+    bad_opts["points"].set(bad_point, 3);
+    EXPECT_THROW(io::hdf5_read(tout + ":fields/a", bad_opts, n_read),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_appender)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    std::string tout = "tout_hdf5_appender.hdf5";
+    utils::remove_path_if_exists(tout);
+
+    Node opts;
+    opts["append/buffer_size"] = 64;
+    opts["append/growth_factor"] = 2.0;
+
+    // a few values per cycle for many series
+    const int num_cycles = 100;
+    {
+        io::HDF5Appender appender;
+        appender.open(tout, opts);
+        EXPECT_TRUE(appender.is_open());
+
+        Node n;
+        for(int c = 0; c < num_cycles; c++)
+        {
+            n["time"] = (float64) c * 0.5;
+            n["cycle"] = (int64) c;
+            n["probes/p"].set(DataType::float32(3));
+            float32_array p = n["probes/p"].value();
+            p[0] = c; p[1] = c + 1; p[2] = c + 2;
+            appender.append(n, "series");
+        }
+
+        // type must match the dataset
+        n.reset();
+        n["time"] = (int32) 1;
+        EXPECT_THROW(appender.append(n, "series"), conduit::Error);
+
+        appender.close();
+        EXPECT_FALSE(appender.is_open());
+    }
+
+    Node n_read;
+    io::hdf5_read(tout, n_read);
+
+    float64_array time = n_read["series/time"].value();
+    int64_array cycle = n_read["series/cycle"].value();
+    float32_array p = n_read["series/probes/p"].value();
+    // trimmed to the values appended
+    EXPECT_EQ(time.number_of_elements(), num_cycles);
+    EXPECT_EQ(cycle.number_of_elements(), num_cycles);
+    EXPECT_EQ(p.number_of_elements(), 3 * num_cycles);
+    for(int c = 0; c < num_cycles; c++)
+    {
+        EXPECT_EQ(time[c], c * 0.5);
+        EXPECT_EQ(cycle[c], c);
+        EXPECT_EQ(p[3 * c + 2], (float32) (c + 2));
+    }
+
+    // continue the series of an existing file, using an hdf5 id
+    hid_t h5_file_id = io::hdf5_open_file_for_read_write(tout);
+    {
+        io::HDF5Appender appender;
+        appender.open(h5_file_id, opts);
+        Node n;
+        for(int c = num_cycles; c < 2 * num_cycles; c++)
+        {
+            n["cycle"] = (int64) c;
+            appender.append(n, "series");
+        }
+        appender.flush();
+
+        // datasets are over allocated until close
+        hid_t h5_dset_id = H5Dopen(h5_file_id, "series/cycle", H5P_DEFAULT);
+        hid_t h5_dspace_id = H5Dget_space(h5_dset_id);
+        hsize_t dims[1] = {0};
+        H5Sget_simple_extent_dims(h5_dspace_id, dims, NULL);
+        EXPECT_GE(dims[0], (hsize_t) 2 * num_cycles);
+        H5Sclose(h5_dspace_id);
+        H5Dclose(h5_dset_id);
+    }
+    // the appender does not close ids it did not open
+    io::hdf5_close_file(h5_file_id);
+
+    n_read.reset();
+    io::hdf5_read(tout + ":series/cycle", n_read);
+    cycle = n_read.value();
+    EXPECT_EQ(cycle.number_of_elements(), 2 * num_cycles);
+    EXPECT_EQ(cycle[2 * num_cycles - 1], 2 * num_cycles - 1);
+
+    EXPECT_EQ(DO_NO_HARM, check_h5_open_ids());
+
+    // only extendible datasets can be continued
+    Node n_fixed;
+    n_fixed["series/fixed"].set(DataType::int64(4));
+    io::hdf5_save(n_fixed, tout);
+    io::HDF5Appender appender;
+    appender.open(tout);
+    Node n;
+    n["fixed"] = (int64) 1;
+    EXPECT_THROW(appender.append(n, "series"), conduit::Error);
+    appender.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_read_existing_layout)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    std::string tout = "tout_hdf5_read_existing_layout.hdf5";
+
+    Node n;
+    n["fields/a"].set(DataType::float64(8));
+    n["fields/b"].set(DataType::int32(4));
+    n["name"] = "restart";
+    float64_array a = n["fields/a"].value();
+    int32_array b = n["fields/b"].value();
+    for(int i = 0; i < 8; i++)
+    {
+        a[i] = i * 1.5;
+    }
+    for(int i = 0; i < 4; i++)
+    {
+        b[i] = 10 + i;
+    }
+    io::hdf5_save(n, tout);
+
+    Node opts;
+    opts["existing_layout"] = "true";
+
+    // external arrays: one of the same type, one with a different
+    // type, and one strided
+    float64 a_vals[8];
+    float32 b_vals[4];
+    Node n_read;
+    n_read["fields/a"].set_external(a_vals, 8);
+    n_read["fields/b"].set_external(b_vals, 4);
+    io::hdf5_read(tout, opts, n_read);
+
+    EXPECT_EQ(n_read["fields/a"].data_ptr(), (void*) a_vals);
+    EXPECT_EQ(n_read["fields/b"].data_ptr(), (void*) b_vals);
+    EXPECT_EQ(n_read["fields/b"].dtype().id(), DataType::FLOAT32_ID);
+    for(int i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(a_vals[i], i * 1.5);
+    }
+    for(int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(b_vals[i], (float32) (10 + i));
+    }
+    // leaves that were not in the output are read as usual
+    EXPECT_EQ(n_read["name"].as_string(), "restart");
+
+    // interleaved values
+    int64 b_strided[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+    n_read.reset();
+    n_read["fields/b"].set_external(DataType::int64(4, 0, 2 * sizeof(int64)),
+                                    b_strided);
+    io::hdf5_read(tout + ":fields/b", opts, n_read["fields/b"]);
+    for(int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(b_strided[2 * i], 10 + i);
+        EXPECT_EQ(b_strided[2 * i + 1], -1);
+    }
+
+    // with a selection
+    float64 a_part[3];
+    Node n_part;
+    n_part.set_external(a_part, 3);
+    Node sel_opts;
+    sel_opts.set(opts);
+    sel_opts["offset"] = 2;
+    sel_opts["size"] = 3;
+    io::hdf5_read(tout + ":fields/a", sel_opts, n_part);
+    EXPECT_EQ(a_part[0], 3.0);
+    EXPECT_EQ(a_part[2], 6.0);
+
+    EXPECT_EQ(DO_NO_HARM, check_h5_open_ids());
+
+    // the leaf must hold as many values as the read selects
+    float64 a_short[4];
+    n_part.set_external(a_short, 4);
+    EXPECT_THROW(io::hdf5_read(tout + ":fields/a", opts, n_part),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_packing)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    Node n;
+    n["coordsets/coords/type"] = "uniform";
+    n["coordsets/coords/dims/i"] = (int32) 10;
+    n["coordsets/coords/dims/j"] = (int32) 20;
+    n["coordsets/coords/origin/x"] = 0.0;
+    n["coordsets/coords/origin/y"] = -1.0;
+    n["coordsets/coords/spacing/dx"] = 0.5;
+    n["coordsets/coords/spacing/dy"] = 0.25;
+    n["state/cycle"] = (int64) 100;
+    n["state/time"] = 1.5;
+    n["fields/p/association"] = "element";
+    n["fields/p/topology"] = "mesh";
+    n["fields/p/values"].set(DataType::float64(200));
+    float64_array vals = n["fields/p/values"].value();
+    for(int i = 0; i < 200; i++)
+    {
+        vals[i] = i;
+    }
+
+    Node opts;
+    opts["packing/enabled"] = "true";
+    opts["packing/threshold"] = 256;
+
+    std::string tout = "tout_hdf5_packing.hdf5";
+    io::hdf5_save(n, tout, opts);
+
+    Node n_read, info;
+    io::hdf5_read(tout, n_read);
+    EXPECT_FALSE(n.diff(n_read, info)) << info.to_yaml();
+
+    // small leaves share one dataset per group, large ones are datasets
+    hid_t h5_file_id = io::hdf5_open_file_for_read(tout);
+    EXPECT_TRUE(io::hdf5_has_path(h5_file_id, "state/__conduit_packed"));
+    EXPECT_TRUE(io::hdf5_has_path(h5_file_id,
+                                  "fields/p/__conduit_packed"));
+    EXPECT_TRUE(H5Lexists(h5_file_id, "fields/p/values", H5P_DEFAULT) > 0);
+    EXPECT_FALSE(H5Lexists(h5_file_id, "state/cycle", H5P_DEFAULT) > 0);
+    // a single leaf is not packed
+    EXPECT_TRUE(H5Lexists(h5_file_id, "coordsets/coords/type", H5P_DEFAULT) > 0);
+
+    // packed leaves can be found and read by path
+    EXPECT_TRUE(io::hdf5_has_path(h5_file_id, "state/cycle"));
+    EXPECT_FALSE(io::hdf5_has_path(h5_file_id, "state/bananas"));
+    Node n_leaf;
+    io::hdf5_read(h5_file_id, "coordsets/coords/spacing/dy", n_leaf);
+    EXPECT_EQ(n_leaf.as_float64(), 0.25);
+
+    std::vector<std::string> cld_names;
+    io::hdf5_group_list_child_names(h5_file_id, "state", cld_names);
+    EXPECT_EQ(cld_names.size(), 2);
+    EXPECT_EQ(cld_names[0], "cycle");
+    EXPECT_EQ(cld_names[1], "time");
+    io::hdf5_close_file(h5_file_id);
+
+    // later writes update the packed leaves
+    Node n_update;
+    n_update["state/cycle"] = (int64) 200;
+    n_update["state/domain_id"] = (int32) 3;
+    io::hdf5_append(n_update, tout, opts);
+
+    // and replace them when a leaf is written as a dataset
+    n_update.reset();
+    n_update["state/time"].set(DataType::float64(100));
+    io::hdf5_append(n_update, tout);
+
+    n_read.reset();
+    io::hdf5_read(tout, n_read);
+    EXPECT_EQ(n_read["state/cycle"].to_int64(), 200);
+    EXPECT_EQ(n_read["state/domain_id"].to_int32(), 3);
+    EXPECT_EQ(n_read["state/time"].dtype().number_of_elements(), 100);
+    EXPECT_EQ(n_read["state"].number_of_children(), 3);
+
+    // existing layout reads into external leaves
+    float32 origin[2] = {-9, -9};
+    Node n_ext;
+    n_ext["x"].set_external(&origin[0], 1);
+    n_ext["y"].set_external(&origin[1], 1);
+    Node read_opts;
+    read_opts["existing_layout"] = "true";
+    io::hdf5_read(tout + ":coordsets/coords/origin", read_opts, n_ext);
+    EXPECT_EQ(origin[0], 0.0f);
+    EXPECT_EQ(origin[1], -1.0f);
+
+    EXPECT_EQ(DO_NO_HARM, check_h5_open_ids());
+
+    // off by default
+    std::string tout_plain = "tout_hdf5_no_packing.hdf5";
+    io::hdf5_save(n, tout_plain);
+    h5_file_id = io::hdf5_open_file_for_read(tout_plain);
+    EXPECT_TRUE(H5Lexists(h5_file_id, "state/cycle", H5P_DEFAULT) > 0);
+    EXPECT_FALSE(H5Lexists(h5_file_id, "state/__conduit_packed", H5P_DEFAULT) > 0);
+    io::hdf5_close_file(h5_file_id);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_io_stats)
+{
+    Node n;
+    n["a"].set(DataType::float64(100));
+    n["b/c"].set(DataType::int32(10));
+    std::string tout = "tout_hdf5_io_stats.hdf5";
+
+    Node n_stats;
+    io::set_stats_enabled(false);
+    io::reset_stats();
+    io::save(n, tout, "hdf5");
+    io::stats(n_stats);
+    EXPECT_EQ(n_stats.number_of_children(), 0);
+
+    io::set_stats_enabled(true);
+    io::save(n, tout, "hdf5");
+    Node n_load;
+    io::load(tout, "hdf5", n_load);
+    io::set_stats_enabled(false);
+
+    io::stats(n_stats);
+    n_stats.print();
+
+    const int64 nbytes = n.total_bytes_compact();
+    EXPECT_EQ(n_stats["hdf5/save/count"].to_int64(), 1);
+    EXPECT_EQ(n_stats["hdf5/save/bytes"].to_int64(), nbytes);
+    EXPECT_GE(n_stats["hdf5/save/time"].to_float64(), 0.0);
+    EXPECT_EQ(n_stats["hdf5/load/count"].to_int64(), 1);
+    EXPECT_EQ(n_stats["hdf5/load/bytes"].to_int64(), nbytes);
+
+    EXPECT_EQ(n_stats["hdf5/dataset_create/count"].to_int64(), 2);
+    EXPECT_EQ(n_stats["hdf5/dataset_write/count"].to_int64(), 2);
+    EXPECT_EQ(n_stats["hdf5/dataset_write/bytes"].to_int64(), nbytes);
+    EXPECT_EQ(n_stats["hdf5/dataset_read/count"].to_int64(), 2);
+    EXPECT_EQ(n_stats["hdf5/dataset_read/bytes"].to_int64(), nbytes);
+    EXPECT_TRUE(n_stats.has_path("hdf5/file_open/count"));
+    EXPECT_TRUE(n_stats.has_path("hdf5/file_close/count"));
+    EXPECT_TRUE(n_stats.has_path("hdf5/compatibility_check/count"));
+
+    io::reset_stats();
+    io::stats(n_stats);
+    EXPECT_EQ(n_stats.number_of_children(), 0);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_hdf5, conduit_hdf5_group_list_children)
 {
@@ -1552,8 +2323,89 @@ TEST(conduit_relay_io_hdf5, test_remove_path)
     // make sure we aren't leaking
     EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, test_create_link)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    Node n;
+    n["a/data"].set(DataType::float64(4));
+    float64_array vals = n["a/data"].value();
+    vals.fill(3.0);
+    n["a/leaf"] = 42;
+    std::string tout = "tout_hdf5_create_link.hdf5";
+
+    utils::remove_path_if_exists(tout);
+    io::save(n, tout, "hdf5");
+
+    // links to a group and to a dataset, with new parent groups
+    hid_t h5_file_id = io::hdf5_open_file_for_read_write(tout);
+    io::hdf5_create_link(h5_file_id, "/a", "b/group_link");
+    io::hdf5_create_link(h5_file_id, "/a/leaf", "c/d/leaf_link");
+    EXPECT_THROW(io::hdf5_create_link(h5_file_id, "/a", "b/group_link"),
+                 conduit::Error);
+    io::hdf5_close_file(h5_file_id);
+
+    Node n_load, info;
+    io::load(tout, n_load);
+    EXPECT_FALSE(n["a"].diff(n_load["b/group_link"], info));
+    EXPECT_EQ(n_load["c/d/leaf_link"].to_int64(), 42);
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
 //
 //
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, test_read_structure)
+{
+    // get objects in flight already
+    int DO_NO_HARM = check_h5_open_ids();
+
+    Node n;
+    n["a/data"].set(DataType::float64(4));
+    n["a/b/c/leaf"] = 42;
+    n["x"] = "str";
+    std::string tout = "tout_hdf5_read_structure.hdf5";
+
+    utils::remove_path_if_exists(tout);
+    io::save(n, tout, "hdf5");
+
+    hid_t h5_file_id = io::hdf5_open_file_for_read_write(tout);
+    io::hdf5_create_link(h5_file_id, "/a/data", "soft");
+    io::hdf5_create_external_link(h5_file_id, "other.hdf5", "/y", "ext");
+    io::hdf5_close_file(h5_file_id);
+
+    Node n_struct;
+    io::hdf5_read_structure(tout, n_struct);
+    n_struct.print();
+    EXPECT_EQ(n_struct["a/data"].as_string(), "dataset");
+    EXPECT_EQ(n_struct["a/b/c/leaf"].as_string(), "dataset");
+    EXPECT_EQ(n_struct["x"].as_string(), "dataset");
+    EXPECT_EQ(n_struct["soft"].as_string(), "soft link: /a/data");
+    EXPECT_EQ(n_struct["ext"].as_string(), "external link: other.hdf5:/y");
+
+    // depth limit
+    Node opts;
+    opts["depth"] = 2;
+    io::hdf5_read_structure(tout, opts, n_struct);
+    EXPECT_EQ(n_struct["a/data"].as_string(), "dataset");
+    EXPECT_EQ(n_struct["a/b"].as_string(), "group");
+
+    // sub path
+    io::hdf5_read_structure(tout + ":a/b", n_struct);
+    EXPECT_EQ(n_struct["c/leaf"].as_string(), "dataset");
+    EXPECT_EQ(n_struct.number_of_children(), 1);
+
+    EXPECT_THROW(io::hdf5_read_structure(tout + ":bad/path", n_struct),
+                 conduit::Error);
+
+    // make sure we aren't leaking
+    EXPECT_EQ(check_h5_open_ids(),DO_NO_HARM);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_relay_io_hdf5, file_name_in_error)
 {
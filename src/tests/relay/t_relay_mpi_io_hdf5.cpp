@@ -0,0 +1,210 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_relay_mpi_io_hdf5.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit_relay_io.hpp"
+#include "conduit_relay_mpi.hpp"
+#include "conduit_relay_mpi_io.hpp"
+#include "conduit_relay_mpi_io_hdf5.hpp"
+#include <iostream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+using namespace conduit::relay;
+
+//-----------------------------------------------------------------------------
+// Builds a tree whose leaf sizes and leaf set depend on the rank.
+void
+create_rank_node(int rank, Node &n)
+{
+    n.reset();
+    n["state/rank"] = (int64) rank;
+    n["state/name"] = "rank " + std::to_string(rank);
+
+    const index_t nvals = 5 + 3 * rank;
+    n["fields/values"].set(DataType::float64(nvals));
+    float64_array vals = n["fields/values"].value();
+    for(index_t i = 0; i < nvals; i++)
+    {
+        vals[i] = rank * 100.0 + i;
+    }
+
+    // every other rank has an extra field
+    if(rank % 2 == 1)
+    {
+        n["fields/odd"].set(DataType::int32(rank));
+        int32_array odd = n["fields/odd"].value();
+        odd.fill(rank);
+    }
+
+    Node &lst = n["list"];
+    lst.append().set((int32) rank);
+    lst.append().set(DataType::uint8(rank + 1));
+
+    n["empty"];
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_io_hdf5, save_load_shared)
+{
+    const int rank = mpi::rank(MPI_COMM_WORLD);
+    const int size = mpi::size(MPI_COMM_WORLD);
+    const std::string path = "tout_relay_mpi_io_hdf5_shared.hdf5";
+
+    Node n;
+    create_rank_node(rank, n);
+
+    // non compact leaf
+    float64 strided[6] = {1, -1, 2, -1, 3, -1};
+    n["fields/strided"].set_external(DataType::float64(3, 0, 2 * sizeof(float64)),
+                                     strided);
+
+    mpi::io::save(n, path, "hdf5_shared", MPI_COMM_WORLD);
+
+    Node n_load, info;
+    mpi::io::load(path, "hdf5_shared", n_load, MPI_COMM_WORLD);
+    EXPECT_FALSE(n.diff(n_load, info));
+    EXPECT_EQ(n_load["fields/strided"].dtype().stride(), sizeof(float64));
+
+    // one file, with the values of each leaf in one dataset
+    EXPECT_EQ(mpi::io::hdf5_shared_number_of_ranks(path), size);
+
+    Node n_data;
+    mpi::io::hdf5_read(path + ":data/fields/values", n_data);
+    index_t nvals_total = 0;
+    for(int r = 0; r < size; r++)
+    {
+        nvals_total += 5 + 3 * r;
+    }
+    EXPECT_EQ(n_data.dtype().number_of_elements(), nvals_total);
+    float64_array vals = n_data.value();
+    EXPECT_EQ(vals[nvals_total - 1], (size - 1) * 100.0 + 5 + 3 * (size - 1) - 1);
+
+    // any rank can read what another rank wrote
+    for(int r = 0; r < size; r++)
+    {
+        Node n_expected, n_read;
+        create_rank_node(r, n_expected);
+        mpi::io::hdf5_read_shared(path, r, n_read);
+        n_read.remove("fields/strided");
+        EXPECT_FALSE(n_expected.diff(n_read, info)) << "rank " << r;
+    }
+
+    Node n_domain;
+    mpi::io::load(path, "hdf5_shared", 0, size - 1, n_domain, MPI_COMM_WORLD);
+    EXPECT_EQ(n_domain["state/rank"].to_int64(), size - 1);
+
+    EXPECT_THROW(mpi::io::hdf5_read_shared(path, size, n_domain),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_io_hdf5, save_shared_leaf)
+{
+    const int rank = mpi::rank(MPI_COMM_WORLD);
+    const std::string path = "tout_relay_mpi_io_hdf5_shared_leaf.hdf5";
+
+    // root is a leaf
+    Node n;
+    n.set(DataType::int64(rank + 2));
+    int64_array vals = n.value();
+    vals.fill(rank);
+
+    mpi::io::hdf5_save_shared(n, path, MPI_COMM_WORLD);
+
+    Node n_load, info;
+    mpi::io::hdf5_load_shared(path, n_load, MPI_COMM_WORLD);
+    EXPECT_FALSE(n.diff(n_load, info)) << info.to_yaml();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_io_hdf5, save_shared_mismatch)
+{
+    const int rank = mpi::rank(MPI_COMM_WORLD);
+    const int size = mpi::size(MPI_COMM_WORLD);
+    if(size < 2)
+    {
+        return;
+    }
+
+    // all ranks raise the error found by rank 0
+    Node n;
+    if(rank == 0)
+    {
+        n["a"].set(DataType::float64(2));
+    }
+    else
+    {
+        n["a"].set(DataType::int32(2));
+    }
+    EXPECT_THROW(mpi::io::hdf5_save_shared(n, "tout_relay_mpi_io_hdf5_bad.hdf5",
+                                           MPI_COMM_WORLD),
+                 conduit::Error);
+
+    // leaf on one rank, object on another
+    n.reset();
+    if(rank == 0)
+    {
+        n["a"] = 1.0;
+    }
+    else
+    {
+        n["a/b"] = 1.0;
+    }
+    EXPECT_THROW(mpi::io::hdf5_save_shared(n, "tout_relay_mpi_io_hdf5_bad.hdf5",
+                                           MPI_COMM_WORLD),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_mpi_io_hdf5, io_stats)
+{
+    const int rank = mpi::rank(MPI_COMM_WORLD);
+    const int size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    create_rank_node(rank, n);
+
+    io::reset_stats();
+    io::set_stats_enabled(true);
+    mpi::io::save(n, "tout_relay_mpi_io_hdf5_stats.hdf5",
+                  "hdf5_shared", MPI_COMM_WORLD);
+    io::set_stats_enabled(false);
+
+    Node n_local, n_stats;
+    io::stats(n_local);
+    mpi::io::stats(n_stats, MPI_COMM_WORLD);
+    io::reset_stats();
+
+    int64 nbytes = n_local["hdf5/dataset_write/bytes"].to_int64();
+    Node n_nbytes, n_nbytes_sum;
+    n_nbytes.set(nbytes);
+    mpi::sum_all_reduce(n_nbytes, n_nbytes_sum, MPI_COMM_WORLD);
+
+    EXPECT_EQ(n_stats["hdf5/dataset_write/bytes"].to_int64(),
+              n_nbytes_sum.to_int64());
+    EXPECT_EQ(n_stats["hdf5/dataset_write/num_ranks"].to_int64(), size);
+    EXPECT_GE(n_stats["hdf5/dataset_write/time"].to_float64(),
+              n_local["hdf5/dataset_write/time"].to_float64());
+    EXPECT_LE(n_stats["hdf5/dataset_write/time_min"].to_float64(),
+              n_local["hdf5/dataset_write/time"].to_float64());
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
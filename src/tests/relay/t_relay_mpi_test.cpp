@@ -983,6 +983,79 @@ TEST(conduit_mpi_test, all_gather_using_schema_simple)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, union_using_schema_simple)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    n["values/a"] = rank+1;
+    n["values/b"] = rank+2;
+    if(rank != 0)
+    {
+        n["values/d"] = rank+4;
+    }
+    n["shared/c"] = 3;
+
+    for(int root = 0; root < com_size; root++)
+    {
+        Node rcv;
+        mpi::union_using_schema(n,rcv,root,MPI_COMM_WORLD);
+
+        if(rank == root)
+        {
+            // same as updating with every rank's tree from root up
+            Node expected;
+            for(int i = 0; i < com_size; i++)
+            {
+                int r = (root + i) % com_size;
+                Node r_n;
+                r_n["values/a"] = r+1;
+                r_n["values/b"] = r+2;
+                if(r != 0)
+                {
+                    r_n["values/d"] = r+4;
+                }
+                r_n["shared/c"] = 3;
+                expected.update(r_n);
+            }
+            Node info;
+            EXPECT_FALSE(rcv.diff(expected, info));
+            EXPECT_EQ(rcv["values"].child(0).name(), std::string("a"));
+        }
+        else
+        {
+            EXPECT_TRUE(rcv.dtype().is_empty());
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, all_union_using_schema_identical)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    // every rank has the same tree, except the last one adds an entry
+    Node n;
+    n["fields/pressure/path"] = "fields/pressure";
+    n["fields/pressure/number_of_components"] = 1;
+    if(rank == com_size - 1)
+    {
+        n["fields/vel/path"] = "fields/vel";
+    }
+
+    Node rcv;
+    mpi::all_union_using_schema(n,rcv,MPI_COMM_WORLD);
+
+    EXPECT_EQ(rcv["fields"].number_of_children(), 2);
+    EXPECT_EQ(rcv["fields/pressure/path"].as_string(),
+              std::string("fields/pressure"));
+    EXPECT_EQ(rcv["fields/vel/path"].as_string(),
+              std::string("fields/vel"));
+}
+
 
 //-----------------------------------------------------------------------------
 TEST(conduit_mpi_test, bcast)
@@ -1227,6 +1300,1129 @@ TEST(conduit_mpi_test, bcast_using_schema_non_empty_node)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, communicate_using_schema_wait_some)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    // every rank sends a node to every other rank
+    Node n_send;
+    n_send["rank"] = rank;
+    n_send["vals"].set(std::vector<int64>(10 + rank, rank));
+
+    std::vector<Node> n_recv(com_size);
+    mpi::communicate_using_schema C(MPI_COMM_WORLD);
+    for(int r = 0; r < com_size; r++)
+    {
+        if(r == rank)
+            continue;
+        C.add_isend(n_send, r, 100 + rank);
+        C.add_irecv(n_recv[r], r, 100 + r);
+    }
+
+    // each received node is complete as soon as wait_some returns it
+    C.start();
+    int num_received = 0;
+    std::vector<Node *> received;
+    while(C.wait_some(received))
+    {
+        for(Node *n : received)
+        {
+            int src = (*n)["rank"].to_int();
+            EXPECT_EQ(n, &n_recv[src]);
+            EXPECT_EQ((*n)["vals"].dtype().number_of_elements(), 10 + src);
+            int64_array vals = (*n)["vals"].value();
+            EXPECT_EQ(vals[0], src);
+            num_received++;
+        }
+    }
+    EXPECT_EQ(C.finish(), 0);
+    EXPECT_EQ(num_received, com_size - 1);
+
+    // execute does the same in one call
+    std::vector<Node> n_recv2(com_size);
+    for(int r = 0; r < com_size; r++)
+    {
+        if(r == rank)
+            continue;
+        C.add_isend(n_send, r, 200 + rank);
+        C.add_irecv(n_recv2[r], r, 200 + r);
+    }
+    C.execute();
+    for(int r = 0; r < com_size; r++)
+    {
+        if(r != rank)
+            EXPECT_EQ(n_recv2[r]["rank"].to_int(), r);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// x and y interleaved in one buffer, plus a scalar in another allocation
+//-----------------------------------------------------------------------------
+void
+set_strided_xy(std::vector<float64> &xy,
+               int32 &id,
+               Node &n)
+{
+    index_t num_pts = (index_t)xy.size() / 2;
+    n.reset();
+    n["x"].set_external(DataType::float64(num_pts, 0, 2 * sizeof(float64)),
+                        &xy[0]);
+    n["y"].set_external(DataType::float64(num_pts,
+                                          sizeof(float64),
+                                          2 * sizeof(float64)),
+                        &xy[0]);
+    n["id"].set_external(&id, 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, strided_send_recv)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    const int num_pts = 5;
+    std::vector<float64> xy(2 * num_pts, -1.0);
+    int32 id = -1;
+    Node n;
+    set_strided_xy(xy, id, n);
+    EXPECT_FALSE(n.is_compact());
+
+    if(rank == 1)
+    {
+        for(int i = 0; i < num_pts; i++)
+        {
+            xy[2*i]   = i;
+            xy[2*i+1] = 10 * i;
+        }
+        id = 42;
+    }
+
+    // non-compact to non-compact (blocking and non-blocking)
+    if(rank == 1)
+    {
+        mpi::send(n, 0, 0, MPI_COMM_WORLD);
+        mpi::Request request;
+        mpi::isend(n, 0, 1, MPI_COMM_WORLD, &request);
+        mpi::wait_send(&request, NULL);
+    }
+    else if(rank == 0)
+    {
+        mpi::recv(n, 1, 0, MPI_COMM_WORLD);
+        for(int i = 0; i < num_pts; i++)
+        {
+            EXPECT_EQ(xy[2*i], i);
+            EXPECT_EQ(xy[2*i+1], 10 * i);
+        }
+        EXPECT_EQ(id, 42);
+
+        std::vector<float64> xy2(2 * num_pts, -1.0);
+        int32 id2 = -1;
+        Node n2;
+        set_strided_xy(xy2, id2, n2);
+        mpi::Request request;
+        mpi::irecv(n2, 1, 1, MPI_COMM_WORLD, &request);
+        mpi::wait_recv(&request, NULL);
+        EXPECT_EQ(xy2, xy);
+        EXPECT_EQ(id2, 42);
+    }
+
+    // non-compact to compact: same bytes as a compact copy
+    if(rank == 1)
+    {
+        mpi::send(n, 0, 2, MPI_COMM_WORLD);
+    }
+    else if(rank == 0)
+    {
+        Schema s_compact;
+        n.schema().compact_to(s_compact);
+        Node n_compact(s_compact);
+        mpi::recv(n_compact, 1, 2, MPI_COMM_WORLD);
+        float64_array y = n_compact["y"].value();
+        EXPECT_EQ(y[num_pts-1], 10 * (num_pts-1));
+        EXPECT_EQ(n_compact["id"].to_int(), 42);
+    }
+
+    // with schema
+    if(rank == 1)
+    {
+        mpi::send_using_schema(n, 0, 3, MPI_COMM_WORLD);
+    }
+    else if(rank == 0)
+    {
+        Node n_rcv;
+        mpi::recv_using_schema(n_rcv, 1, 3, MPI_COMM_WORLD);
+        float64_array x = n_rcv["x"].value();
+        EXPECT_EQ(x[2], 2);
+        EXPECT_EQ(n_rcv["id"].to_int(), 42);
+    }
+
+    // gather from non-compact nodes
+    id = rank;
+    for(int i = 0; i < num_pts; i++)
+    {
+        xy[2*i]   = rank;
+        xy[2*i+1] = rank + i;
+    }
+    Node n_gather;
+    mpi::all_gather(n, n_gather, MPI_COMM_WORLD);
+    EXPECT_EQ(n_gather.number_of_children(), com_size);
+    for(int r = 0; r < com_size; r++)
+    {
+        EXPECT_EQ(n_gather[r]["id"].to_int(), r);
+        float64_array y = n_gather[r]["y"].value();
+        EXPECT_EQ(y[3], r + 3);
+    }
+
+    // communicate_using_schema from non-compact nodes
+    std::vector<Node> n_recv(com_size);
+    mpi::communicate_using_schema C(MPI_COMM_WORLD);
+    for(int r = 0; r < com_size; r++)
+    {
+        if(r == rank)
+            continue;
+        C.add_isend(n, r, 300 + rank);
+        C.add_irecv(n_recv[r], r, 300 + r);
+    }
+    C.execute();
+    for(int r = 0; r < com_size; r++)
+    {
+        if(r == rank)
+            continue;
+        EXPECT_EQ(n_recv[r]["id"].to_int(), r);
+        float64_array x = n_recv[r]["x"].value();
+        float64_array y = n_recv[r]["y"].value();
+        EXPECT_EQ(x[4], r);
+        EXPECT_EQ(y[4], r + 4);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, communicate_using_schema_persistent)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    // x and y interleaved (non-compact), plus the step
+    std::vector<float64> xy(20);
+    int32 id = rank;
+    Node n_send;
+    set_strided_xy(xy, id, n_send);
+    n_send["step"] = (int64)0;
+
+    std::vector<Node> n_recv(com_size);
+    mpi::communicate_using_schema C(MPI_COMM_WORLD);
+    C.set_persistent(true);
+
+    for(int step = 0; step < 6; step++)
+    {
+        for(size_t i = 0; i < xy.size(); i++)
+        {
+            xy[i] = rank * 100 + step * 10 + (float64)i;
+        }
+        n_send["step"].set((int64)step);
+
+        // the schema changes at step 3, the receiver's node at step 5
+        if(step == 3)
+        {
+            n_send["extra"].set(std::vector<int32>(3, step));
+        }
+        if(step == 5)
+        {
+            for(int r = 0; r < com_size; r++)
+            {
+                n_recv[r].reset();
+            }
+        }
+
+        for(int r = 0; r < com_size; r++)
+        {
+            if(r == rank)
+                continue;
+            C.add_isend(n_send, r, 400 + rank);
+            C.add_irecv(n_recv[r], r, 400 + r);
+        }
+        EXPECT_EQ(C.execute(), 0);
+
+        for(int r = 0; r < com_size; r++)
+        {
+            if(r == rank)
+                continue;
+            Node &n = n_recv[r];
+            EXPECT_EQ(n["id"].to_int(), r);
+            EXPECT_EQ(n["step"].to_int64(), step);
+            float64_array x = n["x"].value();
+            float64_array y = n["y"].value();
+            EXPECT_EQ(x[2], r * 100 + step * 10 + 4);
+            EXPECT_EQ(y[9], r * 100 + step * 10 + 19);
+            EXPECT_EQ(n.has_child("extra"), step >= 3);
+            if(step >= 3)
+            {
+                int32_array extra = n["extra"].value();
+                EXPECT_EQ(extra[2], 3);
+            }
+        }
+    }
+
+    C.set_persistent(false);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, gatherv_heterogeneous)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    // different sizes and children on each rank, strided x and y
+    std::vector<float64> xy(2 * (rank + 3));
+    for(size_t i = 0; i < xy.size(); i++)
+    {
+        xy[i] = rank * 100 + (float64)i;
+    }
+    int32 id = rank;
+    Node n_send;
+    set_strided_xy(xy, id, n_send);
+    if(rank % 2 == 1)
+    {
+        n_send["odd"] = "yes";
+    }
+
+    Node n_gather;
+    EXPECT_EQ(mpi::gatherv(n_send, n_gather, 0, MPI_COMM_WORLD), 0);
+
+    Node n_all_gather;
+    EXPECT_EQ(mpi::all_gatherv(n_send, n_all_gather, MPI_COMM_WORLD), 0);
+
+    std::vector<Node *> results;
+    results.push_back(&n_all_gather);
+    if(rank == 0)
+    {
+        results.push_back(&n_gather);
+    }
+    else
+    {
+        EXPECT_TRUE(n_gather.dtype().is_empty());
+    }
+
+    for(size_t k = 0; k < results.size(); k++)
+    {
+        Node &res = *results[k];
+        EXPECT_EQ(res.number_of_children(), com_size);
+        const uint8 *buff_begin = (const uint8*)res.data_ptr();
+        for(int r = 0; r < com_size; r++)
+        {
+            Node &n = res.child(r);
+            EXPECT_EQ(n["id"].to_int(), r);
+            EXPECT_EQ(n["x"].dtype().number_of_elements(), r + 3);
+            float64_array x = n["x"].value();
+            float64_array y = n["y"].value();
+            EXPECT_EQ(x[1], r * 100 + 2);
+            EXPECT_EQ(y[r + 2], r * 100 + 2 * (r + 2) + 1);
+            EXPECT_EQ(n.has_child("odd"), r % 2 == 1);
+
+            // views into the single receive buffer
+            EXPECT_TRUE(n["x"].is_data_external());
+            EXPECT_TRUE((const uint8*)n["x"].data_ptr() >= buff_begin);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, hierarchical_gather_and_broadcast)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    // identical schemas on the even ranks, an extra child on the odd ranks
+    Node n_send;
+    n_send["id"] = (int32)rank;
+    n_send["vals"].set(DataType::float64(4));
+    float64_array vals = n_send["vals"].value();
+    for(index_t i = 0; i < 4; i++)
+    {
+        vals[i] = rank * 10 + (float64)i;
+    }
+    if(rank % 2 == 1)
+    {
+        n_send["odd"] = "yes";
+    }
+
+    Node n_expected;
+    mpi::gather_using_schema(n_send, n_expected, 0, MPI_COMM_WORLD);
+
+    // shared memory groups, a group per rank, and pairs of ranks. Rooting
+    // at the last rank makes root a non leader for pairs.
+    int group_sizes[] = {0, 1, 2};
+    int roots[] = {0, com_size - 1};
+    for(int g = 0; g < 3; g++)
+    {
+        for(int r = 0; r < 2; r++)
+        {
+            int root = roots[r];
+            Node n_gather;
+            EXPECT_EQ(mpi::hierarchical_gather_using_schema(n_send,
+                                                            n_gather,
+                                                            root,
+                                                            group_sizes[g],
+                                                            MPI_COMM_WORLD),
+                      0);
+
+            // send the expected result to root for comparison
+            if(root != 0)
+            {
+                if(rank == 0)
+                {
+                    mpi::send_using_schema(n_expected, root, 0,
+                                           MPI_COMM_WORLD);
+                }
+                else if(rank == root)
+                {
+                    n_expected.reset();
+                    mpi::recv_using_schema(n_expected, 0, 0,
+                                           MPI_COMM_WORLD);
+                }
+            }
+
+            if(rank == root)
+            {
+                Node info;
+                EXPECT_FALSE(n_gather.diff(n_expected, info));
+                EXPECT_EQ(n_gather.number_of_children(), com_size);
+                EXPECT_EQ(n_gather.child(com_size - 1)["id"].to_int(),
+                          com_size - 1);
+                EXPECT_TRUE(n_gather.is_compact());
+            }
+            else
+            {
+                EXPECT_TRUE(n_gather.dtype().is_empty());
+            }
+
+            Node n_bcast;
+            if(rank == root)
+            {
+                n_bcast.set(n_send);
+            }
+            EXPECT_EQ(mpi::hierarchical_broadcast_using_schema(n_bcast,
+                                                               root,
+                                                               group_sizes[g],
+                                                               MPI_COMM_WORLD),
+                      0);
+            EXPECT_EQ(n_bcast["id"].to_int(), root);
+            float64_array bcast_vals = n_bcast["vals"].value();
+            EXPECT_EQ(bcast_vals[3], root * 10 + 3);
+            EXPECT_EQ(n_bcast.has_child("odd"), root % 2 == 1);
+        }
+    }
+
+    // the default groups share a node
+    Node n_gather;
+    EXPECT_EQ(mpi::hierarchical_gather_using_schema(n_send,
+                                                    n_gather,
+                                                    0,
+                                                    MPI_COMM_WORLD),
+              0);
+    if(rank == 0)
+    {
+        Node info;
+        EXPECT_FALSE(n_gather.diff(n_expected, info));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, tree_reduce)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    // mixed types, a strided leaf and a string
+    std::vector<float64> xy(6);
+    for(size_t i = 0; i < xy.size(); i++)
+    {
+        xy[i] = rank + (float64)i;
+    }
+    int32 id = rank + 1;
+    Node n_send;
+    set_strided_xy(xy, id, n_send);
+    n_send["timers/io"] = (float32)(rank + 1);
+    n_send["timers/comp"].set(DataType::uint64(2));
+    uint64_array comp = n_send["timers/comp"].value();
+    comp[0] = rank;
+    comp[1] = 10 * rank;
+    n_send["dt"] = 1.0 + rank;
+    n_send["count"] = (int16)1;
+    n_send["name"] = "mesh";
+
+    // one op for all leaves
+    Node n_sum;
+    EXPECT_EQ(mpi::tree_all_reduce(n_send, n_sum, MPI_SUM, MPI_COMM_WORLD), 0);
+    int rank_sum = com_size * (com_size - 1) / 2;
+    float64_array x = n_sum["x"].value();
+    float64_array y = n_sum["y"].value();
+    EXPECT_EQ(x[2], rank_sum + 4 * com_size);
+    EXPECT_EQ(y[1], rank_sum + 3 * com_size);
+    EXPECT_EQ(n_sum["id"].to_int(), rank_sum + com_size);
+    EXPECT_EQ(n_sum["count"].as_int16(), com_size);
+    EXPECT_EQ(n_sum["timers/comp"].as_uint64_ptr()[1], 10 * rank_sum);
+    EXPECT_EQ(n_sum["name"].as_string(), "mesh");
+    EXPECT_TRUE(n_sum.is_compact());
+
+    // per leaf ops, the receive tree is reused
+    Node leaf_ops;
+    leaf_ops["timers"] = "max";
+    leaf_ops["dt"] = "min";
+    leaf_ops["count"] = "prod";
+    Node n_res;
+    n_res.set(n_send);
+    const void *res_ptr = n_res["dt"].data_ptr();
+    EXPECT_EQ(mpi::tree_all_reduce(n_send, n_res, leaf_ops, MPI_COMM_WORLD), 0);
+    EXPECT_EQ(n_res["dt"].data_ptr(), res_ptr);
+    EXPECT_EQ(n_res["dt"].as_float64(), 1.0);
+    EXPECT_EQ(n_res["timers/io"].as_float32(), com_size);
+    EXPECT_EQ(n_res["timers/comp"].as_uint64_ptr()[1], 10 * (com_size - 1));
+    EXPECT_EQ(n_res["count"].as_int16(), 1);
+    EXPECT_EQ(n_res["id"].to_int(), rank_sum + com_size);
+
+    Node n_reduce;
+    EXPECT_EQ(mpi::tree_reduce(n_send, n_reduce, leaf_ops, 0, MPI_COMM_WORLD), 0);
+    if(rank == 0)
+    {
+        EXPECT_EQ(n_reduce["dt"].as_float64(), 1.0);
+        EXPECT_EQ(n_reduce["timers/comp"].as_uint64_ptr()[0], com_size - 1);
+    }
+    else
+    {
+        EXPECT_TRUE(n_reduce.dtype().is_empty());
+    }
+
+    EXPECT_THROW(mpi::tree_all_reduce(n_send, n_res, MPI_LAND, MPI_COMM_WORLD),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, nonblocking_collectives)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    // strided values
+    std::vector<float64> xy(6);
+    for(size_t i = 0; i < xy.size(); i++)
+    {
+        xy[i] = rank * 10 + (float64)i;
+    }
+    int32 id = rank;
+    Node n_xy;
+    set_strided_xy(xy, id, n_xy);
+
+    Node n_bcast;
+    if(rank == 0)
+    {
+        n_bcast["a"] = 42;
+        n_bcast["b"].set(DataType::float64(4));
+        n_bcast["b"].as_float64_ptr()[3] = 3.5;
+    }
+
+    Node n_bcast_leaf(DataType::int64(3));
+    n_bcast_leaf.as_int64_ptr()[2] = rank == 0 ? 7 : -1;
+
+    Node n_sum;
+    Node n_gather;
+    Node n_all_gather;
+    Node n_gather_schema;
+    Node n_all_gather_schema;
+
+    Node n_var;
+    n_var["vals"].set(DataType::int32(rank + 1));
+    n_var["vals"].as_int32_ptr()[rank] = rank;
+
+    // start them all, finish with one wait_all
+    mpi::Request reqs[7];
+    mpi::ibroadcast_using_schema(n_bcast, 0, MPI_COMM_WORLD, &reqs[0]);
+    mpi::ibroadcast(n_bcast_leaf, 0, MPI_COMM_WORLD, &reqs[1]);
+    mpi::iall_reduce(n_xy["y"], n_sum, MPI_SUM, MPI_COMM_WORLD, &reqs[2]);
+    mpi::igather(n_xy, n_gather, 0, MPI_COMM_WORLD, &reqs[3]);
+    mpi::iall_gather(n_xy, n_all_gather, MPI_COMM_WORLD, &reqs[4]);
+    mpi::igather_using_schema(n_var, n_gather_schema, 0,
+                              MPI_COMM_WORLD, &reqs[5]);
+    mpi::iall_gather_using_schema(n_var, n_all_gather_schema,
+                                  MPI_COMM_WORLD, &reqs[6]);
+
+    MPI_Status statuses[7];
+    EXPECT_EQ(mpi::wait_all(7, reqs, statuses), MPI_SUCCESS);
+
+    EXPECT_EQ(n_bcast["a"].to_int(), 42);
+    EXPECT_EQ(n_bcast["b"].as_float64_ptr()[3], 3.5);
+    EXPECT_EQ(n_bcast_leaf.as_int64_ptr()[2], 7);
+
+    int rank_sum = com_size * (com_size - 1) / 2;
+    float64_array sum = n_sum.value();
+    EXPECT_EQ(sum[2], 10 * rank_sum + 5 * com_size);
+
+    if(rank == 0)
+    {
+        EXPECT_EQ(n_gather.number_of_children(), com_size);
+        EXPECT_EQ(n_gather_schema.number_of_children(), com_size);
+    }
+    EXPECT_EQ(n_all_gather.number_of_children(), com_size);
+    EXPECT_EQ(n_all_gather_schema.number_of_children(), com_size);
+    for(int r = 0; r < com_size; r++)
+    {
+        float64_array x = n_all_gather.child(r)["x"].value();
+        EXPECT_EQ(x[1], r * 10 + 2);
+        EXPECT_EQ(n_all_gather.child(r)["id"].to_int(), r);
+
+        const Node &vals = n_all_gather_schema.child(r)["vals"];
+        EXPECT_EQ(vals.dtype().number_of_elements(), r + 1);
+        EXPECT_EQ(vals.as_int32_ptr()[r], r);
+
+        if(rank == 0)
+        {
+            x = n_gather.child(r)["y"].value();
+            EXPECT_EQ(x[2], r * 10 + 5);
+            EXPECT_EQ(n_gather_schema.child(r)["vals"].as_int32_ptr()[r], r);
+        }
+    }
+
+    // poll with test, then wait on a finished request
+    Node n_bcast2;
+    if(rank == 0)
+    {
+        n_bcast2["s"] = "hello";
+    }
+    mpi::Request req;
+    mpi::ibroadcast_using_schema(n_bcast2, 0, MPI_COMM_WORLD, &req);
+    int done = 0;
+    while(!done)
+    {
+        EXPECT_EQ(mpi::test(&req, &done, MPI_STATUS_IGNORE), MPI_SUCCESS);
+    }
+    EXPECT_EQ(mpi::wait(&req, MPI_STATUS_IGNORE), MPI_SUCCESS);
+    EXPECT_EQ(n_bcast2["s"].as_string(), "hello");
+
+    // wait on a single request
+    Node n_min;
+    mpi::iall_reduce(n_xy["x"], n_min, MPI_MIN, MPI_COMM_WORLD, &req);
+    EXPECT_EQ(mpi::wait(&req, MPI_STATUS_IGNORE), MPI_SUCCESS);
+    EXPECT_EQ(n_min.as_float64_ptr()[1], 2.0);
+}
+
+//-----------------------------------------------------------------------------
+// simulated device memory: the "device" holds every byte xor'ed with a key,
+// its memcpy handler converts between the host and device representations.
+// MPI reading or writing device memory directly would garble values.
+//-----------------------------------------------------------------------------
+void
+device_xor_copy(void *dest, const void *src, size_t num)
+{
+    const uint8 *src_ptr  = (const uint8*)src;
+    uint8       *dest_ptr = (uint8*)dest;
+    for(size_t i = 0; i < num; i++)
+    {
+        dest_ptr[i] = src_ptr[i] ^ 0x5a;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+device_plain_copy(void *dest, const void *src, size_t num)
+{
+    memcpy(dest,src,num);
+}
+
+//-----------------------------------------------------------------------------
+void *
+device_alloc(size_t items, size_t item_size)
+{
+    return calloc(items, item_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+device_free(void *ptr)
+{
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+float64
+device_value(const Node &n, index_t idx)
+{
+    Node n_host;
+    n_host.set(n);
+    return n_host.as_float64_ptr()[idx];
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, device_staging)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    index_t dev_id = utils::register_allocator(device_alloc, device_free);
+    utils::set_device_allocator(dev_id);
+    utils::set_memcpy_handler(dev_id, device_xor_copy);
+    utils::set_memcpy_handler(dev_id, dev_id, device_plain_copy);
+    mpi::set_device_aware(false);
+
+    Node n_vals;
+    n_vals["a"].set(DataType::float64(4));
+    for(int i = 0; i < 4; i++)
+    {
+        n_vals["a"].as_float64_ptr()[i] = rank * 10 + i;
+    }
+
+    Node n_dev;
+    n_dev.set_allocator(dev_id);
+    n_dev.set(n_vals);
+    // the raw device values are encoded
+    EXPECT_NE(n_dev["a"].as_float64_ptr()[1], 1.0 + rank * 10);
+    EXPECT_EQ(device_value(n_dev["a"], 1), 1.0 + rank * 10);
+
+    int next = (rank + 1) % com_size;
+    int prev = (rank + com_size - 1) % com_size;
+
+    // point to point
+    mpi::Request reqs[2];
+    Node n_rcv;
+    n_rcv.set_allocator(dev_id);
+    n_rcv.set(n_vals);
+    mpi::isend(n_dev, next, 0, MPI_COMM_WORLD, &reqs[0]);
+    mpi::irecv(n_rcv, prev, 0, MPI_COMM_WORLD, &reqs[1]);
+    mpi::wait_all(2, reqs, MPI_STATUSES_IGNORE);
+    EXPECT_EQ(device_value(n_rcv["a"], 2), prev * 10 + 2);
+
+    if(rank == 0)
+    {
+        mpi::send_using_schema(n_dev, next, 1, MPI_COMM_WORLD);
+    }
+    if(rank == next % com_size && com_size > 1)
+    {
+        Node n_rcv_schema;
+        n_rcv_schema.set_allocator(dev_id);
+        mpi::recv_using_schema(n_rcv_schema, 0, 1, MPI_COMM_WORLD);
+        EXPECT_EQ(n_rcv_schema["a"].allocator(), dev_id);
+        EXPECT_EQ(device_value(n_rcv_schema["a"], 3), 3.0);
+    }
+
+    // collectives
+    Node n_sum;
+    n_sum.set_allocator(dev_id);
+    mpi::all_reduce(n_dev["a"], n_sum, MPI_SUM, MPI_COMM_WORLD);
+    int rank_sum = com_size * (com_size - 1) / 2;
+    EXPECT_EQ(device_value(n_sum, 1), 10 * rank_sum + com_size);
+
+    Node n_gather;
+    n_gather.set_allocator(dev_id);
+    mpi::all_gather_using_schema(n_dev, n_gather, MPI_COMM_WORLD);
+    EXPECT_EQ(n_gather.number_of_children(), com_size);
+    EXPECT_EQ(device_value(n_gather[com_size - 1]["a"], 2),
+              (com_size - 1) * 10 + 2);
+
+    Node n_bcast;
+    n_bcast.set_allocator(dev_id);
+    if(rank == 0)
+    {
+        n_bcast.set(n_vals);
+    }
+    mpi::broadcast_using_schema(n_bcast, 0, MPI_COMM_WORLD);
+    EXPECT_EQ(device_value(n_bcast["a"], 3), 3.0);
+
+    // nonblocking collectives
+    Node n_igather;
+    n_igather.set_allocator(dev_id);
+    mpi::Request req;
+    mpi::iall_gather(n_dev, n_igather, MPI_COMM_WORLD, &req);
+    mpi::wait(&req, MPI_STATUS_IGNORE);
+    EXPECT_EQ(device_value(n_igather[rank]["a"], 1), rank * 10 + 1);
+    EXPECT_EQ(device_value(n_igather[prev]["a"], 1), prev * 10 + 1);
+
+    Node n_ibcast;
+    n_ibcast.set_allocator(dev_id);
+    if(rank == 0)
+    {
+        n_ibcast.set(n_vals);
+    }
+    mpi::ibroadcast_using_schema(n_ibcast, 0, MPI_COMM_WORLD, &req);
+    mpi::wait(&req, MPI_STATUS_IGNORE);
+    EXPECT_EQ(device_value(n_ibcast["a"], 2), 2.0);
+
+    // communicate_using_schema
+    Node n_comm;
+    n_comm.set_allocator(dev_id);
+    mpi::communicate_using_schema C(MPI_COMM_WORLD);
+    C.add_isend(n_dev, next, 2);
+    C.add_irecv(n_comm, prev, 2);
+    C.execute();
+    EXPECT_EQ(device_value(n_comm["a"], 3), prev * 10 + 3);
+
+    utils::clear_allocator_memory_handlers();
+    utils::set_device_allocator(dev_id, false);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, buffer_pool)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+    int next = (rank + 1) % com_size;
+    int prev = (rank + com_size - 1) % com_size;
+
+    // device staging goes through request buffers
+    index_t dev_id = utils::register_allocator(device_alloc, device_free);
+    utils::set_device_allocator(dev_id);
+    utils::set_memcpy_handler(dev_id, device_xor_copy);
+    utils::set_memcpy_handler(dev_id, dev_id, device_plain_copy);
+    mpi::set_device_aware(false);
+
+    MPI_Comm comm;
+    MPI_Comm_dup(MPI_COMM_WORLD, &comm);
+
+    Node info;
+    mpi::buffer_pool_info(comm, info);
+    EXPECT_TRUE(info.dtype().is_empty());
+
+    Node opts;
+    opts["mpi_alloc_mem"] = "true";
+    mpi::set_buffer_pool(comm, opts);
+
+    Node n_vals;
+    n_vals["a"].set(DataType::float64(100));
+    Node n_dev;
+    n_dev.set_allocator(dev_id);
+    Node n_rcv;
+    n_rcv.set_allocator(dev_id);
+
+    for(int iter = 0; iter < 4; iter++)
+    {
+        float64_array vals = n_vals["a"].value();
+        vals.fill(rank * 10 + iter);
+        n_dev.set(n_vals);
+        n_rcv.set(n_vals);
+
+        mpi::Request reqs[2];
+        mpi::isend(n_dev, next, 0, comm, &reqs[0]);
+        mpi::irecv(n_rcv, prev, 0, comm, &reqs[1]);
+        EXPECT_TRUE(reqs[0].m_pool != NULL);
+        mpi::wait_all(2, reqs, MPI_STATUSES_IGNORE);
+        EXPECT_TRUE(reqs[0].m_pool == NULL);
+        EXPECT_EQ(device_value(n_rcv["a"], 99), prev * 10 + iter);
+    }
+
+    // the first round allocates a send and a receive block, the others
+    // reuse them
+    mpi::buffer_pool_info(comm, info);
+    EXPECT_EQ(info["misses"].to_int64(), 2);
+    EXPECT_EQ(info["hits"].to_int64(), 6);
+    EXPECT_EQ(info["in_use_bytes"].to_int64(), 0);
+    // 800 bytes round up to the smallest block
+    EXPECT_EQ(info["idle_bytes"].to_int64(), 2 * 4096);
+
+    // single stage collectives use the pool too, a pool without idle bytes
+    // frees blocks as they return
+    opts.reset();
+    opts["max_bytes"] = 0;
+    mpi::set_buffer_pool(comm, opts);
+
+    mpi::Request req;
+    Node n_sum;
+    n_sum.set_allocator(dev_id);
+    n_sum.set(n_vals["a"]);
+    mpi::iall_reduce(n_dev["a"], n_sum, MPI_SUM, comm, &req);
+    mpi::Request pending;
+    mpi::ibroadcast(n_rcv, 0, comm, &pending);
+    EXPECT_EQ(mpi::wait(&req, MPI_STATUS_IGNORE), MPI_SUCCESS);
+    float64 expected = 0;
+    for(int i = 0; i < com_size; i++)
+    {
+        expected += i * 10 + 3;
+    }
+    EXPECT_EQ(device_value(n_sum, 5), expected);
+
+    mpi::buffer_pool_info(comm, info);
+    EXPECT_EQ(info["idle_bytes"].to_int64(), 0);
+    EXPECT_EQ(info["in_use_bytes"].to_int64(), 4096);
+
+    // blocks still in use when the pool is dropped return safely
+    mpi::clear_buffer_pool(comm);
+    mpi::buffer_pool_info(comm, info);
+    EXPECT_TRUE(info.dtype().is_empty());
+    EXPECT_EQ(mpi::wait(&pending, MPI_STATUS_IGNORE), MPI_SUCCESS);
+    // rank 0 received from the last rank
+    EXPECT_EQ(device_value(n_rcv["a"], 0), (com_size - 1) * 10 + 3);
+
+    // freeing the comm frees its pool
+    mpi::set_buffer_pool(comm, opts);
+    MPI_Comm_free(&comm);
+
+    utils::clear_allocator_memory_handlers();
+    utils::set_device_allocator(dev_id, false);
+}
+
+//-----------------------------------------------------------------------------
+static int stats_regions_begun = 0;
+static int stats_regions_ended = 0;
+
+//-----------------------------------------------------------------------------
+void
+stats_begin_region(const char *name)
+{
+    EXPECT_EQ(std::string(name).find("relay::mpi::"), 0u);
+    stats_regions_begun++;
+}
+
+//-----------------------------------------------------------------------------
+void
+stats_end_region(const char * /*name*/)
+{
+    stats_regions_ended++;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, stats_and_annotations)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    EXPECT_FALSE(mpi::stats_enabled());
+    mpi::set_stats_enabled(true);
+    mpi::reset_stats();
+    mpi::set_annotation_callbacks(stats_begin_region, stats_end_region);
+
+    Node n_snd;
+    n_snd["a"].set(DataType::float64(100));
+    n_snd["b"].set(DataType::int32(10));
+
+    if(rank == 0)
+    {
+        mpi::send_using_schema(n_snd, 1, 0, MPI_COMM_WORLD);
+    }
+    else if(rank == 1)
+    {
+        Node n_rcv;
+        mpi::recv_using_schema(n_rcv, 0, 0, MPI_COMM_WORLD);
+        EXPECT_EQ(n_rcv["a"].dtype().number_of_elements(), 100);
+    }
+
+    Node n_gather;
+    mpi::gather_using_schema(n_snd, n_gather, 0, MPI_COMM_WORLD);
+
+    Node info;
+    mpi::stats(info);
+    info.print();
+
+    index_t data_bytes = n_snd.total_bytes_compact();
+    if(rank == 0)
+    {
+        EXPECT_EQ(info["send_using_schema/calls"].to_int64(), 1);
+        EXPECT_GE(info["send_using_schema/messages"].to_int64(), 1);
+        EXPECT_GE(info["send_using_schema/bytes_sent"].to_int64(),
+                  data_bytes);
+        EXPECT_GE(info["gather_using_schema/bytes_received"].to_int64(),
+                  com_size * data_bytes);
+    }
+    else if(rank == 1)
+    {
+        EXPECT_EQ(info["recv_using_schema/calls"].to_int64(), 1);
+        EXPECT_GE(info["recv_using_schema/bytes_received"].to_int64(),
+                  data_bytes);
+    }
+
+    // sizes, schemas and data
+    EXPECT_EQ(info["gather_using_schema/calls"].to_int64(), 1);
+    EXPECT_EQ(info["gather_using_schema/messages"].to_int64(), 3);
+    EXPECT_GE(info["gather_using_schema/bytes_sent"].to_int64(), data_bytes);
+    EXPECT_GE(info["gather_using_schema/time"].to_float64(),
+              info["gather_using_schema/data_time"].to_float64());
+    EXPECT_EQ(info["total/calls"].to_int64(), (rank < 2) ? 2 : 1);
+    EXPECT_EQ(stats_regions_begun, info["total/calls"].to_int64());
+    EXPECT_EQ(stats_regions_ended, stats_regions_begun);
+
+    // the sends and receives within union_using_schema count as part of it
+    mpi::reset_stats();
+    EXPECT_EQ(mpi::stats_enabled(), true);
+    Node n_part;
+    n_part[std::string("rank_") + std::to_string(rank)] = rank;
+    Node n_union;
+    mpi::union_using_schema(n_part, n_union, 0, MPI_COMM_WORLD);
+    mpi::stats(info);
+    EXPECT_EQ(info["union_using_schema/calls"].to_int64(), 1);
+    EXPECT_FALSE(info.has_child("send_using_schema"));
+    EXPECT_FALSE(info.has_child("recv_using_schema"));
+    if(rank == 0)
+    {
+        EXPECT_EQ(n_union.number_of_children(), com_size);
+    }
+
+    // disabled: nothing is recorded, the annotations remain
+    mpi::set_stats_enabled(false);
+    mpi::reset_stats();
+    int begun = stats_regions_begun;
+    mpi::all_gather_using_schema(n_snd, n_gather, MPI_COMM_WORLD);
+    mpi::stats(info);
+    EXPECT_EQ(info["total/calls"].to_int64(), 0);
+    EXPECT_EQ(stats_regions_begun, begun + 1);
+
+    mpi::set_annotation_callbacks(NULL, NULL);
+    mpi::all_gather_using_schema(n_snd, n_gather, MPI_COMM_WORLD);
+    EXPECT_EQ(stats_regions_begun, begun + 1);
+}
+
+//-----------------------------------------------------------------------------
+// Byte counts above 40 use chunked datatypes (16 byte chunks), and gathers
+// above 40 bytes use the point-to-point and broadcast fallbacks. The real
+// limit is INT_MAX, these run the same paths without 2 GB messages.
+//-----------------------------------------------------------------------------
+void
+set_large_count_test_values(int rank, Node &n)
+{
+    n.reset();
+    n["id"] = (int32)rank;
+    n["vals"].set(DataType::float64(rank + 9));
+    float64_array vals = n["vals"].value();
+    for(index_t i = 0; i < vals.number_of_elements(); i++)
+    {
+        vals[i] = rank * 100 + (float64)i;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+check_large_count_test_values(int rank, const Node &n)
+{
+    EXPECT_EQ(n["id"].to_int(), rank);
+    EXPECT_EQ(n["vals"].dtype().number_of_elements(), rank + 9);
+    float64_array vals = n["vals"].value();
+    EXPECT_EQ(vals[0], rank * 100);
+    EXPECT_EQ(vals[rank + 8], rank * 100 + rank + 8);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, large_count_send_recv)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    mpi::detail::set_large_count_limits(40, 16);
+
+    Node n_snd;
+    set_large_count_test_values(0, n_snd);
+
+    // tags not used by the other tests
+
+    if(rank == 0)
+    {
+        mpi::send_using_schema(n_snd, 1, 1020, MPI_COMM_WORLD);
+        mpi::send(n_snd["vals"], 1, 1021, MPI_COMM_WORLD);
+
+        Request req;
+        mpi::isend(n_snd["vals"], 1, 1022, MPI_COMM_WORLD, &req);
+        mpi::wait_send(&req, MPI_STATUS_IGNORE);
+    }
+    else if(rank == 1)
+    {
+        Node n_rcv;
+        mpi::recv_using_schema(n_rcv, 0, 1020, MPI_COMM_WORLD);
+        check_large_count_test_values(0, n_rcv);
+
+        Node n_vals(DataType::float64(9));
+        mpi::recv(n_vals, 0, 1021, MPI_COMM_WORLD);
+        EXPECT_EQ(n_vals.as_float64_ptr()[8], 8.0);
+
+        Node n_ivals(DataType::float64(9));
+        Request req;
+        mpi::irecv(n_ivals, 0, 1022, MPI_COMM_WORLD, &req);
+        mpi::wait_recv(&req, MPI_STATUS_IGNORE);
+        EXPECT_EQ(n_ivals.as_float64_ptr()[8], 8.0);
+    }
+
+    mpi::detail::reset_large_count_limits();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, large_count_broadcast)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    mpi::detail::set_large_count_limits(40, 16);
+
+    Node n_bcast;
+    if(rank == 0)
+    {
+        set_large_count_test_values(0, n_bcast);
+    }
+    mpi::broadcast_using_schema(n_bcast, 0, MPI_COMM_WORLD);
+    check_large_count_test_values(0, n_bcast);
+
+    Node n_vals(DataType::float64(9));
+    if(rank == 0)
+    {
+        n_vals.set(n_bcast["vals"]);
+    }
+    mpi::broadcast(n_vals, 0, MPI_COMM_WORLD);
+    EXPECT_EQ(n_vals.as_float64_ptr()[8], 8.0);
+
+    mpi::detail::reset_large_count_limits();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, large_count_gather)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+    mpi::detail::set_large_count_limits(40, 16);
+
+    Node n_snd;
+    set_large_count_test_values(rank, n_snd);
+
+    // equal sizes: chunked datatypes
+    Node n_vals(DataType::float64(9));
+    float64_array vals = n_vals.value();
+    vals.fill(rank);
+    Node n_gather, n_all_gather;
+    mpi::gather(n_vals, n_gather, 0, MPI_COMM_WORLD);
+    mpi::all_gather(n_vals, n_all_gather, MPI_COMM_WORLD);
+    EXPECT_EQ(n_all_gather.total_bytes_compact(), com_size * 72);
+    EXPECT_EQ(((float64*)n_all_gather.data_ptr())[9 * com_size - 1],
+              com_size - 1);
+    if(rank == 0)
+    {
+        EXPECT_EQ(((float64*)n_gather.data_ptr())[9 * com_size - 1],
+                  com_size - 1);
+    }
+
+    // different sizes: the gathered total is over the limit
+    Node n_gather_schema, n_all_gather_schema, n_gatherv, n_all_gatherv;
+    Node n_igather_schema;
+    mpi::gather_using_schema(n_snd, n_gather_schema, 0, MPI_COMM_WORLD);
+    mpi::all_gather_using_schema(n_snd, n_all_gather_schema, MPI_COMM_WORLD);
+    mpi::gatherv(n_snd, n_gatherv, 0, MPI_COMM_WORLD);
+    mpi::all_gatherv(n_snd, n_all_gatherv, MPI_COMM_WORLD);
+
+    Request req;
+    mpi::igather_using_schema(n_snd, n_igather_schema, 0,
+                              MPI_COMM_WORLD, &req);
+    mpi::wait(&req, MPI_STATUS_IGNORE);
+
+    std::vector<Node *> results;
+    results.push_back(&n_all_gather_schema);
+    results.push_back(&n_all_gatherv);
+    if(rank == 0)
+    {
+        results.push_back(&n_gather_schema);
+        results.push_back(&n_gatherv);
+        results.push_back(&n_igather_schema);
+    }
+
+    for(size_t k = 0; k < results.size(); k++)
+    {
+        EXPECT_EQ(results[k]->number_of_children(), com_size);
+        for(int r = 0; r < com_size; r++)
+        {
+            check_large_count_test_values(r, results[k]->child(r));
+        }
+    }
+
+    mpi::detail::reset_large_count_limits();
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -71,6 +71,34 @@ TEST(conduit_relay_web, node_viewer)
     delete n;
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_viewer_io_handle)
+{
+    Node n;
+    n["a"] = (uint32) 20;
+    n["fields/pressure"].set(DataType::float64(100000));
+    float64_array vals = n["fields/pressure"].value();
+    vals.fill(3.14159);
+
+    std::string data_file = "tout_relay_node_viewer_io_handle.json";
+    io::save(n,data_file);
+
+    io::IOHandle h;
+    Node opts;
+    opts["mode"] = "r";
+    h.open(data_file,opts);
+    EXPECT_TRUE(h.has_path("fields/pressure"));
+
+    if(launch_server)
+    {
+        // the viewer reads the schema and leaf slices through the handle
+        web::NodeViewerServer svr;
+        svr.set_port(8080);
+        svr.set_io_handle(&h);
+        svr.serve(true);
+    }
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
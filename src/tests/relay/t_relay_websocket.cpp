@@ -102,16 +102,120 @@ TEST(conduit_relay_web_websocket, websocket_test)
     {
         utils::sleep(1000);
         
-        // websocket() returns the first active websocket
-        svr.websocket()->send(msg);
-        // or with a very short timeout
-        //svr.websocket(10,100)->send(msg);
+        // broadcast queues the message for all active websockets
+        svr.broadcast(msg);
+        // or send to the first active websocket
+        //svr.websocket()->send(msg);
         
         msg["count"] = msg["count"].to_int64() + 1;
     }
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, binary_frames)
+{
+    Node data;
+    data["state/cycle"] = 10;
+    data["state/time"]  = 1.5;
+    data["fields/pressure"].set(DataType::float64(1000));
+    data["fields/density"].set(DataType::float32(500));
+    data["fields/mask"].set(DataType::int8(3));
+    data["coords"].append().set(DataType::float64(50));
+    data["coords"].append().set(DataType::float64(50));
+
+    float64_array pressure = data["fields/pressure"].value();
+    pressure.fill(2.0);
+
+    web::BinaryFrameWriter writer;
+    std::vector<uint8> frame;
+    Node info;
+
+    // first delta is a full frame
+    EXPECT_FALSE(writer.write_delta(data, frame));
+    EXPECT_FALSE(web::is_delta_frame(&frame[0], (index_t)frame.size()));
+
+    Node res;
+    web::read_binary_frame(&frame[0], (index_t)frame.size(), res);
+    EXPECT_FALSE(data.diff(res, info));
+    index_t full_size = (index_t)frame.size();
+
+    // change one leaf: the delta holds only its data
+    data["state/cycle"] = 11;
+    EXPECT_TRUE(writer.write_delta(data, frame));
+    EXPECT_TRUE(web::is_delta_frame(&frame[0], (index_t)frame.size()));
+    EXPECT_LT((index_t)frame.size(), full_size / 10);
+    web::read_binary_frame(&frame[0], (index_t)frame.size(), res);
+    EXPECT_EQ(res["state/cycle"].to_int64(), 11);
+    EXPECT_FALSE(data.diff(res, info));
+
+    // nothing changed
+    EXPECT_TRUE(writer.write_delta(data, frame));
+    EXPECT_EQ((index_t)frame.size(), 16);
+    web::read_binary_frame(&frame[0], (index_t)frame.size(), res);
+    EXPECT_FALSE(data.diff(res, info));
+
+    // strided leaves are sent compactly
+    Node strided;
+    strided.set_external(DataType::float64(50, 0, 2 * sizeof(float64)),
+                         data["fields/pressure"].data_ptr());
+    pressure[10] = 7.0;
+    pressure[11] = 9.0;
+    data["coords"][1].set_external(strided);
+    EXPECT_TRUE(writer.write_delta(data, frame));
+    web::read_binary_frame(&frame[0], (index_t)frame.size(), res);
+    EXPECT_EQ(res["coords"][1].as_float64_ptr()[5], 7.0);
+    EXPECT_FALSE(data.diff(res, info));
+
+    // a schema change sends a full frame
+    data["fields/energy"].set(DataType::float64(10));
+    EXPECT_FALSE(writer.write_delta(data, frame));
+    web::read_binary_frame(&frame[0], (index_t)frame.size(), res);
+    EXPECT_FALSE(data.diff(res, info));
+
+    // a full frame restarts the deltas
+    data["state/time"] = 2.5;
+    writer.write(data, frame);
+    EXPECT_FALSE(web::is_delta_frame(&frame[0], (index_t)frame.size()));
+    data["state/time"] = 3.5;
+    EXPECT_TRUE(writer.write_delta(data, frame));
+    web::read_binary_frame(&frame[0], (index_t)frame.size(), res);
+    EXPECT_EQ(res["state/time"].to_float64(), 3.5);
+
+    // after a reset
+    writer.reset();
+    EXPECT_FALSE(writer.write_delta(data, frame));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, broadcast)
+{
+    web::WebServer svr;
+    EXPECT_EQ(svr.websocket_queue_size(), 4);
+    svr.set_websocket_queue_size(2);
+    EXPECT_EQ(svr.websocket_queue_size(), 2);
+    EXPECT_THROW(svr.set_websocket_queue_size(0), conduit::Error);
+
+    Node msg;
+    msg["value"] = 42;
+
+    // no-op before the server starts
+    svr.broadcast(msg);
+    svr.broadcast_binary(msg);
+
+    svr.set_port(8082);
+    svr.set_document_root(web::web_client_root_directory());
+    svr.serve(false);
+    EXPECT_TRUE(svr.is_running());
+
+    // no connected clients
+    svr.broadcast(msg);
+    svr.broadcast(msg,"conduit_json");
+    svr.broadcast_binary(msg);
+
+    svr.shutdown();
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -258,3 +258,87 @@ TEST(conduit_relay_zfp, unwrap_zfparray_with_compressed_data_dtype_mismatched_wi
     ASSERT_TRUE(fetched_arr == 0);
 }
 
+
+TEST(conduit_relay_zfp, unwrap_zfparray_values_and_range)
+{
+    // create compressed-array
+    uint nx = 9;
+    uint ny = 12;
+    uint nz = 5;
+    uint ntotal = nx * ny * nz;
+
+    double * vals = new double[ntotal];
+    for (uint i = 0; i < ntotal; i++) {
+        vals[i] = i * 0.5;
+    }
+
+    double rate = 16.0;
+    zfp::array3d arr(nx, ny, nz, rate, vals);
+
+    Node result;
+    EXPECT_EQ(0, io::wrap_zfparray(&arr, result));
+
+    // decode a sub-range, compare with the array's own decode
+    Node range;
+    EXPECT_EQ(0, io::unwrap_zfparray_range(result, 100, 50, range));
+    ASSERT_TRUE(range.dtype().is_float64());
+    ASSERT_EQ(50, range.dtype().number_of_elements());
+    float64_array range_vals = range.value();
+    for (uint i = 0; i < 50; i++) {
+        EXPECT_EQ((double)arr[100 + i], range_vals[i]);
+    }
+
+    // decode scattered values
+    index_t idxs[4] = {ntotal - 1, 0, 17, 250};
+    Node indices, picked;
+    indices.set_external(idxs, 4);
+    EXPECT_EQ(0, io::unwrap_zfparray_values(result, indices, picked));
+    float64_array picked_vals = picked.value();
+    for (uint i = 0; i < 4; i++) {
+        EXPECT_EQ((double)arr[(uint)idxs[i]], picked_vals[i]);
+    }
+
+    // out of range
+    EXPECT_EQ(2, io::unwrap_zfparray_range(result, ntotal - 1, 2, range));
+
+    delete [] vals;
+}
+
+TEST(conduit_relay_zfp, save_and_load_compressed_zfparray)
+{
+    // create compressed-array
+    uint nx = 64;
+    uint ny = 64;
+    uint ntotal = nx * ny;
+
+    float * vals = new float[ntotal];
+    for (uint i = 0; i < ntotal; i++) {
+        vals[i] = i * 0.25f;
+    }
+
+    double rate = 8.0;
+    zfp::array2f arr(nx, ny, rate, vals);
+
+    // the saved node only holds the header and compressed words
+    Node result;
+    EXPECT_EQ(0, io::wrap_zfparray(&arr, result));
+    EXPECT_LT(result.total_bytes_compact(), (index_t)(ntotal * sizeof(float) / 2));
+
+    io::save(result, "tout_relay_zfp_compressed.conduit_bin");
+
+    Node loaded;
+    io::load("tout_relay_zfp_compressed.conduit_bin", loaded);
+
+    Node info;
+    EXPECT_FALSE(result.diff(loaded, info));
+
+    Node range;
+    EXPECT_EQ(0, io::unwrap_zfparray_range(loaded, 64, 64, range));
+    ASSERT_TRUE(range.dtype().is_float32());
+    float32_array range_vals = range.value();
+    for (uint i = 0; i < 64; i++) {
+        EXPECT_EQ((float)arr[64 + i], range_vals[i]);
+    }
+
+    delete [] vals;
+}